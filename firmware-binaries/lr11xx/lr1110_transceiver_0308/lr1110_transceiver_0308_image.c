@@ -0,0 +1,6875 @@
+/*!
+ * \file      lr1110_transceiver_0308_image.c
+ *
+ * \brief     Firmware transceiver version 0x0308 for LR1110 radio, definition
+ *
+ * The Clear BSD License
+ * Copyright Semtech Corporation 2022. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT
+ * NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Array containing the firmware image
+ */
+#ifdef __cplusplus
+extern "C"
+#endif
+const uint32_t lr11xx_firmware_image[] = {
+    0x8ec3b951, 0x63c99646, 0x6806da09, 0x8cb28e89, 0x54761fb2, 0xb61cdecc, 0x56d0146e, 0x0f0ec5f0, 0xab386cd5,
+    0x47785e28, 0xd1e5e9e0, 0xaecfdbc8, 0xdaa520c1, 0x664bedb6, 0x42e2b9e0, 0x7b4e8486, 0x5e4c48ed, 0x5f6c1a43,
+    0x24d3a08b, 0x6fc17098, 0xb9ad3a15, 0x39988e8e, 0xb3666c4f, 0xd62428b5, 0x3201c3e7, 0x6c68a618, 0xa7d2809f,
+    0x0c8069ed, 0xe2d92c92, 0x8654e916, 0x547844c3, 0x927090d3, 0x89ea9e36, 0x14cb9ca2, 0x9a7e1e4f, 0x1b306a1c,
+    0x899a6518, 0x30d224cb, 0x39cb398d, 0x3e4b2daa, 0xc852b069, 0xe3c170b2, 0xcd488ad3, 0x42b55353, 0x11f84ab5,
+    0xa4e914b6, 0xe3d5c496, 0xd8c7c724, 0x24815d94, 0x35fc4f48, 0x08117bd5, 0x9b7973f7, 0x93efdc68, 0x46210a66,
+    0x3abef3d0, 0x90738b0a, 0x2f52fbcb, 0x0ce35a92, 0x3dd2df14, 0xaa27b561, 0xc30530e2, 0x4076289b, 0x6db7358a,
+    0xc9917a13, 0x1990bc7f, 0x1f9dcb24, 0xbea6a6f9, 0x6e970084, 0x0b9981dd, 0xba67d2fd, 0x0ad0f3f7, 0x60a98c51,
+    0x84d84b20, 0x5710125c, 0x925b6d6b, 0x1b502d0f, 0x0f3406c1, 0xcec6137c, 0xea03851e, 0xab4649f9, 0x94a22871,
+    0xcf5e83dd, 0x03e336dd, 0x3d5b2643, 0x09a02efa, 0xfe52e184, 0xfef3c9c6, 0x9dbdb0c0, 0x27c8e9bb, 0x01d3980f,
+    0xbfac588c, 0x06d2c35e, 0x7e432624, 0x5e66be47, 0x015f831a, 0x238f7e8e, 0x52d33a40, 0x3e5c931f, 0x66258a64,
+    0x25bdc79f, 0xa18ff402, 0x296df700, 0xd79d1744, 0x97b54b09, 0x2c84d3c8, 0x6866a632, 0x0b7da0c3, 0xda16ebce,
+    0x05a9a1a9, 0xc2be3546, 0x09c96f06, 0xf060763c, 0x15de09c1, 0x071c18b3, 0xf481e672, 0x8f980b05, 0x828efb6d,
+    0xf35f5ad6, 0x990fc5f3, 0xfe9784de, 0x08b85ca2, 0x6de86313, 0xe992cd47, 0x0cb6cd80, 0xe468d778, 0xb4fe4750,
+    0x3d99006d, 0x13fc2f72, 0x3e2ce289, 0x3c5bfca9, 0x0f14e557, 0x7f3a74e4, 0xf0b1e7a1, 0x0c6ee4d0, 0x49020688,
+    0x63b41799, 0x4f81cd89, 0xcebc4e4a, 0x4f61a455, 0xca537cbe, 0x6dfc5d84, 0x40708aa4, 0x4de5e023, 0xbd1e70f8,
+    0x5e069a74, 0x1d73a432, 0xd936889e, 0x29a88d3b, 0x81bdcea6, 0x5af3b5e8, 0x84d2aa54, 0x2e6fe3ba, 0x301c07e6,
+    0x710c4612, 0x0c90803e, 0xd2cb9589, 0x57d3f5d6, 0x2745db0a, 0x94fe5e39, 0x450f73aa, 0x300097f6, 0x632a34b6,
+    0x28177c39, 0xe32293b6, 0x49c19ed7, 0x3f3e2112, 0x6b71cafd, 0x56442901, 0x222e7938, 0x6da85c83, 0x8f69d6aa,
+    0x25d9a87d, 0x28927ae5, 0x55ea48be, 0xac0d050d, 0xb6bc6f26, 0x307aa2fa, 0xa1299e82, 0xd380aab1, 0x4e4ff021,
+    0x4e345f83, 0xbc3e592a, 0x0a1e4cbf, 0xe9369fd0, 0xd23940bf, 0xb6edf36c, 0x7b6fe400, 0xb2f26b25, 0x7c5c88e1,
+    0xd377f0a5, 0xb5b65718, 0x96a50104, 0x16f76871, 0x9c5d4f83, 0xd9c7aee9, 0x9d307cda, 0x6b7b42ba, 0x6e03c929,
+    0xbac87d8d, 0x8bc1abc3, 0xb5442201, 0x50841372, 0xc824a494, 0x854d837c, 0x12678064, 0x080948d8, 0x74adcd86,
+    0x70152efa, 0xfbfe30fd, 0x27eeef18, 0x0ee68f71, 0xddd00e0d, 0x0b4f1483, 0xdc6945e0, 0xd0f7563e, 0x4e5d0043,
+    0xba12e21b, 0x65b67071, 0x7fbfde91, 0x52273a60, 0xda1cc748, 0x91650bb6, 0xde36898a, 0x68beda16, 0x6d9bd9fb,
+    0x00c2897d, 0x44f6d148, 0x7a906225, 0x8221f50e, 0x025c7168, 0x90587c95, 0x9f2f37b8, 0x7eb3f648, 0x91d4a824,
+    0xe1bc153c, 0x6800f6be, 0xeccf429a, 0xb794f11a, 0x782718d6, 0x20c8a08e, 0x744ffdac, 0x0276ca0c, 0x0afbe865,
+    0x2f78f594, 0x07d3f3c9, 0x401d83c0, 0x79310f05, 0x3142ee2e, 0xa0cc2ec6, 0x17630723, 0x0c7f686d, 0x50b6ed71,
+    0xaa59c845, 0x1c50c801, 0xa0d507ac, 0x58507d43, 0x440434cf, 0x6577ebf2, 0x8cec08f2, 0x3705d669, 0x8b713a8d,
+    0x55b839f8, 0x8f5d42ab, 0xbfe754d1, 0x44bb8656, 0x5c38130b, 0x8dda1a66, 0x96ad676d, 0x2713dce8, 0x91347be7,
+    0xf97dbb69, 0x6d0298dc, 0xf88ae546, 0xdc5bf75f, 0x6be9ef2e, 0xbc9b4058, 0x95d22f21, 0xc34abf5e, 0x71b7059c,
+    0x02e7c25a, 0xb9d9e240, 0x204580f9, 0x3afad3ab, 0x75a9f9a9, 0xa3bc4505, 0x5f499ca7, 0xd8c961d0, 0xc562e772,
+    0xccbc4b93, 0xf3e6778c, 0x210df615, 0x0ec3f767, 0x831f3206, 0x9cfeb0a9, 0xe7f0d661, 0x2018c171, 0x6db617b3,
+    0x91712e53, 0xc2467db2, 0x4c1628a1, 0x9ca4f367, 0x428d5b84, 0xa35095ac, 0xf1248596, 0x75ed083f, 0x1f131ead,
+    0x7fe3fdcf, 0xf1d97dd5, 0x0cba6c5f, 0x9acbae99, 0x19d32f53, 0xcc9d8408, 0x9f0117c7, 0x3111edfb, 0x61f9b08a,
+    0xe87dc785, 0xee303195, 0xadb2afbd, 0x5b6c4e66, 0x7d298555, 0xd7385a71, 0x8a7b88c0, 0x54e4fa2a, 0x245fa79f,
+    0x36b7be0d, 0x382e274d, 0xfe708552, 0x30176c2c, 0x962dbb42, 0x6bf547b7, 0x76ec9a64, 0xa9c55ced, 0xd2ebce8a,
+    0xdcfd3459, 0x4dc61db7, 0x2307854b, 0x24eb5fab, 0xd3d5ee47, 0xbfbb970a, 0xdd715ee7, 0x488f703b, 0xa0073b3a,
+    0xa4ebc8fe, 0x0b3facfd, 0x2057865f, 0x37754e8c, 0x7dd4a391, 0x9a635b95, 0xb8613d01, 0x320da102, 0x35f7ea1d,
+    0xe93ab7ba, 0xa8f506f3, 0xd9cc64ff, 0x9d2d1629, 0x39b71887, 0xcd1826d9, 0xef3e41fa, 0x8d9e289b, 0x81a01555,
+    0xa42f1239, 0xe4a20174, 0x2abbc8f2, 0x01966ef0, 0xd3118ecb, 0xa2852ec5, 0xaf8b3149, 0x3c205022, 0xdcd1e254,
+    0x6bd58cc4, 0x4eebb56d, 0x1833eee6, 0xa7a3da56, 0xedc2de47, 0x5a3262d6, 0xc603d90b, 0x025192ed, 0x8c1cfc9d,
+    0x9fe6df2d, 0xfb9ee5ba, 0xe41c7b4e, 0x13fb6522, 0x012121d2, 0x3c1b5add, 0xc6e0bb88, 0x1fa12a8c, 0x5e29dbc6,
+    0xb593b5ed, 0xcaf1e4a0, 0xd67e55ff, 0xf64e3105, 0xdf524d6a, 0xeaf123fc, 0x0cb68e6f, 0xf7d69b3a, 0xb634d64e,
+    0xf97192c9, 0x7e9dcb21, 0x0da089f9, 0xe57bd463, 0xd50d02a5, 0x8a531b1c, 0x08cb6b05, 0x440d0e01, 0xf71d902e,
+    0xb087be47, 0xfae78175, 0x34e53a75, 0x8f90ee2a, 0x1a08a5ac, 0xf3d9a8db, 0xb3f21c46, 0xc56f0999, 0xc4e724ad,
+    0x27f6d68a, 0x7d0e8e5f, 0x32e6bf30, 0xcbaeb386, 0xf2dc7d40, 0x89c1929f, 0x8232cbb8, 0xb8160cc6, 0xd6f22cec,
+    0x394dbaeb, 0xad273421, 0x986d3a7f, 0x93611bef, 0x4b372876, 0xfebb8d1f, 0x9e102e3a, 0x177e1c58, 0x1730a6ec,
+    0x8dff4fb0, 0xd7c80be9, 0x6d4ccbe5, 0xe7945b66, 0x5826f5bf, 0xe36af450, 0xb65f3076, 0x62344f60, 0x80ceefa3,
+    0x98e0e4be, 0xc3c44d53, 0x9633dc88, 0x35350c88, 0x09fd933a, 0xe5c19c5c, 0xfe79a633, 0xfb56d6a0, 0xb708b922,
+    0xd385feeb, 0xd0c8d0da, 0xf492ee4d, 0x3bebab56, 0xa610fa11, 0x3b46aa73, 0xb9a0ad9d, 0xf25a694f, 0xa3c45b60,
+    0x7d7c970b, 0x5fccf602, 0x4349e0bf, 0xed153023, 0x512f3bb5, 0xc21ad95a, 0x19c27a58, 0x49f1398a, 0x7989d837,
+    0xc9a6226c, 0x8f00e284, 0x8b3bbaf6, 0xf67ba537, 0x29ac3425, 0x156b4495, 0x29096f9a, 0xe389307d, 0x62215f00,
+    0xd48d32bf, 0x6c1f8a3d, 0x14b7e2f3, 0xcbeb71d1, 0xbded9997, 0xa409500b, 0xfe28d63f, 0xbc7649f7, 0x105bd562,
+    0xe164c769, 0xce945902, 0xf8db2777, 0xa86ead87, 0x710bf19c, 0x5443219d, 0xc98977b4, 0xf8918811, 0xc124b706,
+    0x996145a6, 0xbb573b74, 0x29ee1ee8, 0x1b8c1df4, 0xe6585944, 0xc0d91db5, 0xde35499c, 0x0af8af83, 0xb942f688,
+    0x49c59249, 0x2232aa30, 0x6b84d667, 0xb7836911, 0xee42b2e2, 0x9e4a2f19, 0x125622b7, 0x147da1f9, 0x3a29f1f5,
+    0xc46febc2, 0x10c37558, 0x39137998, 0xe42effa5, 0xa3c97a13, 0x4f48f6d4, 0x844e85e4, 0xfa8b2b0b, 0x63fed4eb,
+    0x7a53f565, 0x8bd60496, 0x99a65956, 0x19878ccc, 0x0164ae49, 0x637e5d5e, 0x7f00156c, 0x91ccdc41, 0xe2662257,
+    0xd3fec119, 0x77de22fa, 0x0d5e8b05, 0x7d1f7a13, 0xbda1e703, 0xe5c9d5dd, 0x69fc419f, 0x13bfedfc, 0xaae10cb6,
+    0xf0744aec, 0x55a277f5, 0x78539c78, 0xecfad5d5, 0xda9e4a46, 0x6d17b9d7, 0x384e5dfc, 0x62a31052, 0x431b598d,
+    0x865f90f7, 0xf1c012cb, 0x49fc2ad2, 0xe28c7397, 0x04e3d7d3, 0xc2c95dd6, 0x404b0f35, 0x1aa9d108, 0xee474d3c,
+    0xb859030e, 0x58ecdbe6, 0x05cd7792, 0xa031f730, 0x172bec35, 0x0801dbeb, 0xfc42117a, 0x58a37c51, 0xf8f95d6b,
+    0x5beff029, 0x2cc44095, 0x0a609a24, 0xe8a19334, 0x8906639b, 0x4a5137f5, 0x220f9cfd, 0x5e6ef29b, 0x1c963ad8,
+    0xea682aaa, 0x4acd39d0, 0x5c48f2d5, 0xfc327a25, 0x2f841f49, 0xe126d9d3, 0x72659669, 0x4aa9090c, 0x162fa6ee,
+    0x4158f523, 0x5e3ef6de, 0x412abdb6, 0xc732cd99, 0x6472dcc5, 0x9fd1937c, 0x983b76d9, 0xf3d15adb, 0x36c78dee,
+    0x6c20e3d9, 0xe344d28f, 0xaf474be1, 0x9772052f, 0x2db0d013, 0x77558dd1, 0x92e9a135, 0xbcb94a98, 0x54e06205,
+    0xee06c3db, 0x65e4940b, 0x9ae54773, 0xf9fb4f96, 0x54cfe1b9, 0x52daad88, 0x35272be4, 0xe38d35ca, 0xf9ee6af9,
+    0xbd308f6e, 0xf565d2e4, 0xa9b181e2, 0x8f83fad6, 0xa887a08f, 0xc9fcadda, 0xfc7b5d21, 0xcbf6824b, 0x6e872c88,
+    0x08b1cd5c, 0xb2cc2645, 0x8a8c4196, 0xbae3d250, 0x5beedea9, 0xebd0ff01, 0x6e24eea4, 0x3eff7429, 0x7e2a2653,
+    0x8645bd22, 0xa6d5bda1, 0xc02f75ac, 0xed261dfc, 0x7f76ce9c, 0xcdac6906, 0x0a7eb46d, 0xdf808b77, 0xd770c4ba,
+    0xcc5353dd, 0xfd2c08cc, 0x65e88519, 0x7d4898b1, 0xb490c194, 0x07755768, 0x94e3fc6c, 0x6fe2378b, 0x7bff77e9,
+    0x6308fad0, 0xee74827e, 0x4b5d9087, 0xa34be938, 0xfd320a37, 0x914be728, 0x7b6854b0, 0x0a968fad, 0xc369e55f,
+    0x4d8a248a, 0xdce28b63, 0xe00de9bb, 0x53f87fb0, 0x2f5e6f12, 0x5742f9cf, 0x7b5161ab, 0xf7518929, 0xc880bca6,
+    0xdb6c7f23, 0x6cffae31, 0xfb882c74, 0x3fd960f1, 0x505edefc, 0x44588cb6, 0x0c430604, 0xc14c6d39, 0xbadce9c1,
+    0xd426e32c, 0xeafc49c4, 0x04c2c9be, 0x1b91b9c3, 0x12507f2b, 0xcdff114d, 0x971bfe72, 0x5489c2ff, 0xe33cfc93,
+    0x7f6e96d7, 0x7adc94ec, 0x62e9fe79, 0xcd617801, 0xe9381623, 0x89619707, 0x8ff24973, 0xb9682714, 0x3b608880,
+    0x805f1cd5, 0x7bd6d007, 0x62f414a1, 0x74b05392, 0x8371f590, 0x86594819, 0x86933249, 0x186ee98b, 0xec1550ff,
+    0x8349184b, 0xd2243d7e, 0xd0485af1, 0x67078d11, 0x6b95275d, 0xa5d737ec, 0xbd4e07c3, 0x0e5e0b26, 0x945e2cae,
+    0xdd7daef1, 0x022c7a2f, 0xeb6b8cd6, 0x284bc377, 0x740f7745, 0xe921563b, 0xfd8bc566, 0x067bdcb8, 0x4fd91418,
+    0xfad8141f, 0x89f23bb1, 0x67bdb7a6, 0x213ace90, 0xe9d89160, 0xc9f3fae7, 0x6a0e4865, 0x757fef91, 0x445c61eb,
+    0x822ad358, 0x355071cd, 0x429247c1, 0x97458f01, 0x84f82e2e, 0x81c7bfa6, 0x5408f355, 0x0aaea394, 0x07b8916b,
+    0x4a4ff2b4, 0x56d5fbec, 0xba4bd7cd, 0x2ff77edc, 0x8dbf8bdd, 0xf2c12fde, 0xfaf116c6, 0xa67f1f77, 0x3048c108,
+    0x71f76e1b, 0xcf4b6a23, 0x485c8ddc, 0x2d673cb1, 0xb6932b50, 0xca03a8ad, 0xad3584f7, 0x732fbb57, 0x75204ffa,
+    0xd885d06a, 0x54ce36cc, 0x891efe37, 0xc8094ce8, 0x9309638e, 0xa67999b3, 0x13f517a0, 0x07cfb9ad, 0x1e12c9e6,
+    0x8a3d242c, 0x06f9e62b, 0xf7e89569, 0xdc26ab49, 0x980f87c0, 0x8a662643, 0xb6a80f25, 0x1d877eb8, 0x7f347898,
+    0xd5c0dc91, 0xedb56c83, 0x31e18e3a, 0xb3b2cb8a, 0xaa025285, 0x173f5171, 0xdc6aa954, 0x35c8398e, 0xb6031c39,
+    0x404bba76, 0xae4919d3, 0xbedaaf1f, 0xc37d9a54, 0x813f478e, 0xd3801619, 0xad29c1df, 0xd68e1143, 0xe8bc0c70,
+    0x513ffee4, 0xc3ff5f19, 0x422fbee2, 0xc48dc0f9, 0x1e708d2f, 0xbb44b00b, 0xb052219b, 0x284c8244, 0xcd998424,
+    0x44a42cad, 0xfa7faa81, 0x5c04a9e1, 0xe086efa4, 0xd43399ab, 0xfba43078, 0xd2b081df, 0x54ab7f85, 0x6965e29c,
+    0x70894a65, 0x57336996, 0x1c1d1ce0, 0x80b3944f, 0x46c6202b, 0xd3e7c90b, 0x6a86d9c9, 0x30462c43, 0xd79a8db3,
+    0x10af7239, 0x6979bc16, 0x659bb567, 0x8b0642fe, 0x784e473b, 0xbcf0567a, 0xe1f07337, 0x39323233, 0x0d8efbce,
+    0xc763cd44, 0x37940951, 0xfa118a7f, 0xa03046db, 0x1bc13b51, 0xc24a5db5, 0xdfe9312e, 0x00220f16, 0xe5d91e1a,
+    0x35438e02, 0x1d1b41f1, 0x2e483a33, 0x2e00698b, 0x4dd10585, 0xf51327a6, 0xd038ad85, 0x86070183, 0xb34f9099,
+    0x27a4c553, 0x995e5f38, 0x42b36584, 0x463f6410, 0x168d3273, 0x6e0fe70a, 0xf38aee92, 0x3b1317bb, 0x1c3ee3bb,
+    0x2a2bb18b, 0x32272006, 0x14a71470, 0x94244b21, 0xe9ef2ca0, 0xa20a6ecc, 0x13206cf4, 0x54606d9d, 0x02cbbbaa,
+    0xaf8cfa18, 0x43e28da5, 0x76c8aaf5, 0xc4738569, 0x7bba0422, 0x17f47430, 0x1de1e536, 0xffe31fe7, 0xeea64e6d,
+    0x5e0a7b75, 0xf9a6dfe8, 0x13010634, 0xab657b76, 0xf1253e34, 0xb81b0684, 0x57f76882, 0x774437b0, 0x70b736c6,
+    0x8b7270d2, 0xa61f31fe, 0xad763188, 0xad5a5fda, 0x2df7b88b, 0x33d5bcb9, 0x9550f7a9, 0xaaa0229d, 0x28e88acb,
+    0x9234e5e5, 0xd01965b8, 0x08027ba1, 0xd32afaa4, 0x53894061, 0x0429b755, 0xf3b82731, 0xfd767200, 0x998a6421,
+    0x68d68956, 0xdd3c6cc1, 0x29a04b23, 0xf97adae1, 0xbe021251, 0x8c46b675, 0x058fa5f7, 0xe436ee1f, 0xb8276afb,
+    0x74fbbbae, 0x413cd2a8, 0x6ab94340, 0xd83ed371, 0x92c96626, 0x6d9bd129, 0x930c7f6f, 0x6381390f, 0x3a8c725d,
+    0x4727b343, 0xcee730bc, 0xe937929b, 0xf53c201c, 0xc163c8b7, 0x9b1d1b5f, 0xcb657bb9, 0xf900e1c3, 0x119fb088,
+    0xb58a34c1, 0x4bbe3514, 0x7af97f64, 0x8f146c23, 0x9ed6cef1, 0xd2c8d79a, 0x30261411, 0x1c97bee9, 0xfaa14760,
+    0x0ba71c31, 0x347a36e1, 0xb74910ff, 0x7393cd94, 0xd2afc544, 0x6c4db6f3, 0xba51e12d, 0xd3049ca2, 0x1aa92c68,
+    0x266f5bfb, 0x9c2af0b4, 0x77b64f9e, 0x4fd7269b, 0x86615c7f, 0xdebdbd83, 0x8cda3c6a, 0x0a7d79aa, 0xd56c5f0a,
+    0xd8c4e56e, 0x4d0a17bd, 0xe33938ea, 0x35722e8a, 0x16bb769c, 0x5fbe5d6d, 0x5aafdaaa, 0x159175ff, 0x2722a46e,
+    0x4be492ee, 0xc3fcf92a, 0x13e28dff, 0x7298e2be, 0x8a5ace20, 0x9f160c99, 0x6f5015f1, 0x30b1182f, 0xfdd63e1d,
+    0x48ae5d54, 0xe42af1e3, 0x8f8911dc, 0xecf5c962, 0xf06b83de, 0xf572d6b7, 0x3c13d9c4, 0x6d8a2300, 0x6bb35a10,
+    0x38fb2fed, 0xc746f6f6, 0x22eb20c9, 0xda3109e8, 0xe6145eb1, 0xa3b00199, 0xc8591951, 0xe930d99f, 0x6618205e,
+    0xf7534777, 0x1430e198, 0x3cf2a376, 0x75c9a111, 0x16ef3387, 0x4d279576, 0xef0ca591, 0x42dd6f81, 0xcfe32141,
+    0x235394c2, 0xd3565c4d, 0x1807c7a4, 0x2c036ca3, 0xd560e9a9, 0xe1cdd7b1, 0x0c8d0e92, 0x85b8c61c, 0x41a65c9b,
+    0xd6e2ed83, 0xbd2a1f05, 0xca5cc960, 0xa3324b02, 0x3197ff00, 0x8f38e69c, 0xf74c8773, 0xd677fc90, 0xdea10704,
+    0x7ff0423e, 0x86854dd4, 0x49b90a88, 0xf98dfeaf, 0xee001370, 0xa0862e8c, 0xfc6f90c4, 0x93c94796, 0x66fc7336,
+    0x2654161b, 0xb5c1af4d, 0xc15ca32e, 0x26ee653e, 0x16d7c542, 0xaaa6b414, 0x09a7883b, 0xd94a6986, 0x8737dcfd,
+    0x97d2625a, 0x0cf1c7e0, 0x97fd0d74, 0xd925bd08, 0x67ee020b, 0x19342be5, 0xe8e828ab, 0x1d892597, 0x141d1c5c,
+    0x71186b1f, 0xf897d223, 0x70ffe534, 0xf9b811e9, 0x18b2ddd7, 0x3d74efc2, 0x19df61ed, 0x4d488d0b, 0x4c09656a,
+    0xc83711c2, 0x724184c1, 0xef3c6620, 0x94d97bf3, 0x0b17b7bb, 0x4d8086c6, 0x6bb11ec0, 0xd52852bd, 0xa296bc26,
+    0x04dd02e9, 0x4bb86d8e, 0x153a3802, 0xd2fb89d9, 0x534a50d7, 0xa60df23f, 0x42ba4cbf, 0x4fa430d3, 0x25b3da41,
+    0x004231ed, 0xc19b2616, 0x3eeb646b, 0x85b22227, 0xccdf1ab5, 0x6c2309ec, 0x8a0af86d, 0x3843bc2d, 0x6f83db6d,
+    0x1565c15f, 0x3c117e2b, 0xcddaae16, 0x5cf3a105, 0xf1c766ea, 0x4f79f406, 0x2a76f1bd, 0x8aed4525, 0x9fa34ff8,
+    0x3fd79236, 0xf7027e0e, 0x726288c1, 0xc00e7cc3, 0x9ccbc366, 0xd931bcea, 0x2d61be3a, 0xa3ce50b8, 0x1923d306,
+    0x0d68297e, 0xfd74bd94, 0x5345914b, 0x4b3c5a51, 0x7588a424, 0x097fdc50, 0xcd6b046a, 0x53b39441, 0x03083f35,
+    0x8fa6ec26, 0x7bc65a0d, 0x9c075034, 0xe0aa8749, 0x44bd00dd, 0x8f286836, 0xe69ab4ff, 0x0681a0a6, 0x2af40639,
+    0x760a060d, 0x13c57db8, 0x24c26672, 0xbae060c3, 0xffb7d395, 0xd4b1f494, 0xbb1a905b, 0x65986f5b, 0x1653c1b8,
+    0x5605daeb, 0xe0880f7e, 0xe218aba9, 0xd77477ed, 0x186cd7be, 0x002fa538, 0x2ccf01ea, 0x166f8a89, 0xd90ed1a3,
+    0xe300ffe6, 0x3dc3ae58, 0x301ba64f, 0x345f7e34, 0x78edf844, 0x17a23ce7, 0xa4781b4d, 0xebbdb357, 0x0b960aa0,
+    0xee63c1ab, 0xa4ca057f, 0x9699c00c, 0x441f6545, 0x9fa6baed, 0x635fed86, 0x9cbedc7a, 0x7dc148be, 0xa1f06d81,
+    0x6118a206, 0xc6155f8c, 0x4d185e77, 0x63f8913b, 0x15621d0d, 0xef152c58, 0x9e0e93d0, 0x532cd706, 0xc6ce8ac9,
+    0x5c4006ba, 0x2c6e1bcb, 0x6a907056, 0xea84dfcd, 0x6f93d855, 0x34dc4d1f, 0x4dc77b62, 0xa7d4a8b4, 0x7e00250b,
+    0xfb02fa58, 0x0c2da933, 0x435fb3da, 0x82cf2875, 0xf663d1bf, 0xb44a6e45, 0x46f6918b, 0x6e731117, 0x84169048,
+    0x72e621ac, 0x5419191e, 0x2ac745f8, 0x7b9de817, 0x2361581f, 0x0d468227, 0x900d77ed, 0x3e4ed9ae, 0x516f5fa5,
+    0x51cfe4a9, 0x443d7e45, 0x6306fdd5, 0xdab4ea97, 0x30cd08a0, 0x9d821f6c, 0x82ba0b51, 0x96fe46c8, 0x83d49a6e,
+    0xf2d08541, 0x8b6aad93, 0x474f6695, 0xedc5bb13, 0xa575361c, 0xb4557417, 0x6ecb61a3, 0x84f7e60c, 0x4a0f5163,
+    0x8cdcb3d1, 0xad9124c0, 0x890c3d9e, 0xbf169b3c, 0x720e7602, 0xf1fa54e1, 0x6b818d42, 0x44d8e955, 0x86664bc6,
+    0x90377c22, 0x22382fbe, 0xccf418c5, 0xf838c0dc, 0x946b1d66, 0xc11be40a, 0x7a151938, 0xdc4336c2, 0x28c43eb2,
+    0xc1f12298, 0x98cd9669, 0x166880cb, 0x84cffc47, 0x37c84d89, 0x1889a4cd, 0xdf2ce016, 0xded06116, 0xfae867c5,
+    0x8d23d06b, 0x827dacf8, 0xfd11d25f, 0x68485ddb, 0xed506883, 0x43c5e555, 0x0330a16f, 0x3f7576af, 0x5f70c716,
+    0xf298b8ce, 0x9e1df62a, 0x46fa9d88, 0xb06e68d0, 0xc3803412, 0xe8ba5d5d, 0x615d8c71, 0x1b0d6c3c, 0xb638706b,
+    0x187d6983, 0x0e33f64f, 0xd9dd7778, 0x12410a8a, 0xcef7eda5, 0xfe74e21e, 0x60b70fc5, 0x8ed94fa2, 0x6cfde259,
+    0x8058b411, 0x1ca93807, 0x19625c5a, 0x34215cec, 0x165baddc, 0x0ab44f83, 0xa6363e74, 0x3f7a766a, 0xdd702a61,
+    0x3d0ca687, 0xd0909c3e, 0xdc7f7712, 0x3d9001ea, 0xc5d19495, 0x8017b1f6, 0x65da0eed, 0x0d030d48, 0x998c10e6,
+    0x06f1c97d, 0x35204b05, 0x1c0da754, 0x777b48fe, 0x01521640, 0x203bfb59, 0x25e83cfa, 0xa3d40b91, 0xf396bd60,
+    0x093880c7, 0xd5a77950, 0xe06ddcac, 0x87936f25, 0x12c7d991, 0x16103a0f, 0x4a1ee98c, 0xf70e1c84, 0x2f3f894e,
+    0x176c0300, 0x34c08cc6, 0x89eff014, 0xb7d5666e, 0xf7636a27, 0x128ece3c, 0x71e7ddb6, 0x1070d4aa, 0x2dab9a05,
+    0x3cdc279b, 0xe88781cc, 0x2771abc8, 0xf01d6e74, 0xe8cc296b, 0xeaafe927, 0xa3b3e542, 0x872acfc7, 0x4033a228,
+    0xa922a98c, 0x82b18f3b, 0x6d5efbb5, 0x31d13a83, 0x6c4a1b1e, 0x7d5df44f, 0x539dfd5d, 0xda1e186b, 0x60f6948d,
+    0xb4c2bb13, 0xa903a2c4, 0x76a5595b, 0xb85fc368, 0x87e3c57c, 0xeec8ee07, 0x39f42e4b, 0xdc13d659, 0x03ac1daa,
+    0x123bab9d, 0x7789dec0, 0x5dba0ba3, 0xcee72d9f, 0xea4aa38f, 0x315633a7, 0xff276fb0, 0x0468ef67, 0x7fb82124,
+    0xeb586ed5, 0xcdadda70, 0xb37e12d8, 0xe4411b87, 0xc740e4f5, 0x41ca5e11, 0x8e54997b, 0x023d8b2c, 0xda4cfb4e,
+    0xee115485, 0xf9a61a29, 0x98aefaa4, 0x2523432a, 0xcfa165ae, 0xc2b7231b, 0x903e24dd, 0x51e1eadc, 0xa3c13481,
+    0x706e7ca4, 0x91b49529, 0x9054a71c, 0x233aba6b, 0x71f936a9, 0xa4d9dd36, 0x28e1ac78, 0x3a11d6aa, 0x64d29cf6,
+    0x13b8ab63, 0x5d79238c, 0xf32a4dc7, 0x0727decf, 0x28a07a6b, 0x93c87398, 0x3f38edc0, 0xa55183ee, 0x9d16dbcf,
+    0x4f036f09, 0x18204e85, 0xbec37c86, 0xf9495b14, 0xea5f2985, 0xde66be29, 0xc2904053, 0x33b3b123, 0x74a7e8d6,
+    0x4eb18918, 0xe09cee53, 0x0e78167c, 0xe178d616, 0x4e4c4040, 0x58f65173, 0x5f75567d, 0x93c49a0a, 0x85841b06,
+    0x0a5d96ca, 0x334f19a1, 0xefbee2ae, 0x3bb40e65, 0x0f423c37, 0x4ee85403, 0xf808babd, 0xa0fd3afb, 0x8c41724c,
+    0xab131c43, 0x3b37c1b6, 0x0def72d9, 0xf246dcc8, 0xfc882e51, 0x410eee00, 0x74f3890c, 0xa1173d0a, 0x3591d9c1,
+    0x178b1342, 0xdbdaac95, 0x803d14c8, 0x2f85d66f, 0x2232e606, 0x5ff7e268, 0x48cd827a, 0x8efccf0b, 0xa2764d6a,
+    0xadfd84a5, 0x00cf4e81, 0xebc1dd35, 0x507b20fa, 0xc83b94b8, 0x14f827be, 0x674b5b0c, 0xdf509dcf, 0x22fb0f6a,
+    0xf57e3d4c, 0x9b0ac7f8, 0x788cda17, 0xe4e2d74f, 0xea6bf365, 0xfd81a21c, 0x9b0cc7c7, 0x528abb76, 0x85afe6e5,
+    0x467f59ef, 0x176345c9, 0x01aeb8ec, 0x0ac99080, 0xcef5c1a2, 0x35d3d8c3, 0xc594045a, 0x0c24212e, 0x64f2bfe8,
+    0x28c4ad41, 0x1d9b420a, 0xf2f3384a, 0x6f31d111, 0x0cf933ce, 0x2c02664d, 0x410bb5a8, 0xd53f3a9d, 0x41026d01,
+    0x413542fe, 0x04ec0bfe, 0xa93a938c, 0x52d0f93e, 0x85be523d, 0x0548edbd, 0xb39e120a, 0xdefda9ad, 0xf786edf3,
+    0xada97dc7, 0x2881915c, 0x31b6bd07, 0x562eadf5, 0x5f99c623, 0x44aa87ce, 0x2ce0fcad, 0xa90e0761, 0x26a979d7,
+    0x59c707da, 0xd06da796, 0xb5e3065d, 0x3072d897, 0x210a5209, 0xc3ee212b, 0xf5477368, 0x0aff322a, 0x47005eb9,
+    0x52e83ba8, 0xad7a9b2b, 0x6757b753, 0xabf47686, 0x58eca24d, 0x0331d06a, 0xb6c34c97, 0x4d62de86, 0x026c13e1,
+    0x6df33ac8, 0xc7781674, 0xdfe45142, 0x2d2fa855, 0x78d27b19, 0xdcf5d3fd, 0xf74ca47a, 0xfeed03e0, 0x9c2c28fc,
+    0xc130aa4f, 0x022fa67f, 0xe0c298ea, 0x5eacafeb, 0xb4622b7c, 0x88bc7c56, 0x9715968d, 0xe5501291, 0xea408c5b,
+    0xf89242d0, 0xb447000b, 0xa5ed47de, 0x7086510c, 0xdcddc6c8, 0xe952bf1b, 0x53783a22, 0xe01cf03e, 0x3c1af3e8,
+    0xc41733a7, 0xa6a90745, 0xef737442, 0xe1a52998, 0x119f3b25, 0xc175fdc8, 0x8a6e92ce, 0xfd38376a, 0xac8c3bd0,
+    0x1e92971b, 0x6972bb0f, 0xd0bbef0e, 0x15ffb52c, 0xfbb1387e, 0x68ca1382, 0x2d00e29d, 0xcca4821f, 0x75947a4c,
+    0x06e2ffb6, 0x09ab8d3e, 0x5428bc20, 0xfece9022, 0x32244d94, 0x19e7e9b3, 0x829e3deb, 0x2fd89bd7, 0x999185ec,
+    0xb509be64, 0xbf8eee61, 0xaca1a0de, 0xf58ccea1, 0x3574251b, 0x1b9ed91f, 0xdefbbc92, 0x985d7074, 0xec5ac844,
+    0x9fea6ec0, 0x02772d38, 0xf5661c24, 0xbbb2029e, 0xff1acac7, 0xbaff5e32, 0x1d08869f, 0xde45d178, 0xfb9aa8fa,
+    0x2e1fded8, 0x7954ef8b, 0x8c46e3fc, 0x3f65f051, 0xc19f02ea, 0x3dcc6ef8, 0xab180ecb, 0x301e0be7, 0x4a237014,
+    0xee8cda26, 0xa3cafe2b, 0xe356d56c, 0x275ca8c4, 0xae6bd8d1, 0x2447e93e, 0x363996cd, 0xa9fa08b2, 0x3f8504e7,
+    0xe7efabb1, 0x00ef7ded, 0x86357a05, 0x9c31a1a8, 0x6b75a8e7, 0x6d32df9b, 0x05e20013, 0xc0bdb066, 0xe79ce531,
+    0x49734f2d, 0x493c237b, 0x526d2c7b, 0x1f6769ce, 0x1eb8a6aa, 0x85792754, 0xd30cf571, 0x9b8bce2e, 0xae17cf7e,
+    0xc06860ab, 0x384d7760, 0xfc22f580, 0xb1911555, 0x8cc3504c, 0x7a6dfb12, 0xb6ac8ea2, 0x9540b403, 0x5f9c0a11,
+    0xc9e5502b, 0x0cbb80c9, 0x33396395, 0xc071d3bf, 0x14db2e40, 0x8888bacf, 0x5e2406f3, 0x81337f60, 0xf0a2f854,
+    0xb2549d2f, 0xd80a2ac2, 0x901a768f, 0xf43c9495, 0x7c52acc7, 0xa27df639, 0x0aee6e34, 0x5610a037, 0xa8be06a8,
+    0xc0a419c7, 0xdbdfc2f8, 0xa35c5506, 0xeb3a1489, 0x2e1bc0e2, 0x55ace85e, 0x17ff5559, 0xbabe86e5, 0x92232fb7,
+    0xfd23a956, 0x7efa2a66, 0x265b9085, 0x731d6cc5, 0x41d2416d, 0x8a8bbbf4, 0x3eab1fe7, 0xc4129b46, 0xbf84be46,
+    0x8e535093, 0x7aaf0ba8, 0x04ffda67, 0xd477905d, 0xe5ea27f1, 0xdbb1beed, 0xcc18745f, 0x61be9320, 0x6cd8d5ce,
+    0xb9d2ea34, 0x64600df6, 0xb0f750d0, 0x063eff47, 0xb87cd72d, 0x8ea821bd, 0xe262fb60, 0x82fc6f07, 0x336ae518,
+    0x2e15e625, 0xffc24baf, 0x2a92fa83, 0x8d096b5a, 0x5e0a819f, 0x91462f1d, 0x813d36b4, 0x0dfafc44, 0x336d1c0a,
+    0xac85ccd4, 0x259ec127, 0xec944b04, 0x3f1d28a8, 0xb2eca469, 0x9b36873b, 0x460b00fa, 0x6cf9878e, 0x07959e18,
+    0x807d6d8d, 0xe171fd33, 0xee2c2d4f, 0x9c6bef8a, 0x2985439d, 0xa7c3d46e, 0xc3854843, 0x06da3591, 0x18def60a,
+    0x3269a1eb, 0xe98cc00e, 0x318faffe, 0x9cfccdc2, 0x7415a0f8, 0x8f53a1c0, 0xe3ddaf89, 0xc57be40b, 0xdb54e71c,
+    0xf06515d0, 0x8403d476, 0x87c1415c, 0x25216032, 0xf676e758, 0xf46cd116, 0x70dde003, 0x0e610131, 0x92260e89,
+    0xd69fd79f, 0x51d11438, 0x3aaad517, 0xaf443748, 0xffe90976, 0xd8de8abf, 0x0de68a96, 0x6aa20495, 0xc2dfc02f,
+    0x5b733ac5, 0x65163218, 0xc3003e14, 0xa6f200da, 0x053287dc, 0x25b7ae62, 0x052fc2ff, 0x4847fc19, 0xa0e560ee,
+    0xcaf44edc, 0xa2658249, 0xbd85f71b, 0x8c438cce, 0x46815c41, 0xd07fb5f9, 0x61ceecd0, 0x9289838b, 0x8d88d3ef,
+    0x87b8695a, 0xa9e63e56, 0x16716eb5, 0x52cc0e72, 0x8b5ea058, 0x8f2bf739, 0xeafee539, 0x0dfec59d, 0xc6bc22af,
+    0x89aab9c4, 0x7b1ff956, 0x8f804144, 0xd1671c9d, 0x599ef42d, 0xb2385ca0, 0xdee50170, 0xdc6a6285, 0x976e393b,
+    0x73a889ee, 0xb1ecfda6, 0x9eef5b52, 0xc6b7b2a4, 0x680e28f7, 0xde0d0c74, 0x3636bd88, 0x0a7a643f, 0xf4042f15,
+    0x9475f84c, 0x04b6675f, 0x7c179c77, 0x24eda6f5, 0x386ee567, 0x8593d5b1, 0xe315664a, 0x0f143deb, 0xe766c503,
+    0x940b9002, 0xb4986f13, 0xfb95a1df, 0xaf68fd7c, 0x4eb016a6, 0x43767999, 0xe326ec22, 0xb5ab2bbb, 0x58897cac,
+    0x2eb9b599, 0x6ff46028, 0xdb025b26, 0xbce90f0c, 0xd362cca8, 0xce99d33e, 0xbe18c85f, 0x245d9e77, 0xbf5d1935,
+    0x7371fbf4, 0x7907595d, 0xe4fa4307, 0xcf94f929, 0x0206efb2, 0x7ba3e6a9, 0x8de799e7, 0x09c0ac59, 0x9915b8b4,
+    0xaab86e58, 0x41d533bc, 0x5fc5f0a9, 0x21fb2827, 0x8f2bf72a, 0x7d0d2161, 0x202fab67, 0x4bd169e4, 0x37dfdd57,
+    0x26ba3a55, 0xbecfb91c, 0xd8dafb2c, 0x38afb9bf, 0xc936f2c6, 0x4fc1a008, 0x1c57375f, 0x5f83d3f5, 0xc1b5819d,
+    0xb21271b8, 0xa0493baa, 0xda46e79a, 0xb5d6f724, 0xaf247ef9, 0x0e2210dc, 0x9a178dd7, 0x2c66e199, 0x3d94e075,
+    0x03e60148, 0xe3208a00, 0xc77fbbad, 0xae7ad547, 0x0937f817, 0x01fb4643, 0x6123b98c, 0xce2192b0, 0x3fcffd08,
+    0x42b6d7a3, 0x899a6b01, 0x09905f7b, 0x15a303bc, 0xbfbf88e2, 0xfa062d7b, 0xf6d5d699, 0x216f6f56, 0xcee98af1,
+    0x2242f881, 0xb613defd, 0x3ca1a9c2, 0x1d05be3f, 0x9ece8d3c, 0x2cc070b1, 0x6caf3274, 0x0c46851b, 0xe28d59a7,
+    0x1f4af6a6, 0xb71c38f3, 0x6cb38ad3, 0x4450f01e, 0x24ac4256, 0x698c0285, 0xe7d968a9, 0xd1613c58, 0x3e41127e,
+    0xa5623490, 0x3b0636c0, 0x2f766d95, 0x24a75e01, 0x443732b2, 0x7169a89b, 0x32ad22be, 0xaea81cd4, 0xbed9eebf,
+    0xd69bccb4, 0x469f4ffe, 0xdebe0d7c, 0x9803f37b, 0x54128341, 0x12b15873, 0x97cefcee, 0x4733ac2e, 0x5d0cdc73,
+    0x2c9e8e92, 0xc3473526, 0x460ac8cb, 0x2b359e4c, 0x3c2caf58, 0x2f1f4f47, 0xa98d20f2, 0x75b85667, 0x8a3d6c1e,
+    0x8379a780, 0x13f5ba3b, 0xbf42ee10, 0x4a12beca, 0xf34ea3d7, 0x3dfe749d, 0x9c5170ad, 0xee189d13, 0xae6ff269,
+    0xd580c8bb, 0xb7f98032, 0xa4f919a8, 0xe0065454, 0xe36b998e, 0x52922b76, 0xdd1f05c0, 0x21865b4d, 0xdae82d7c,
+    0x9e1e03ac, 0xda8e373c, 0x2ada856c, 0x8bb27220, 0x59880699, 0x65179fbf, 0xbad07691, 0xd1234227, 0xc7436630,
+    0xf42c41a5, 0x4895fd1f, 0xcdc2af11, 0x583b96c4, 0x50133261, 0xecd91731, 0x80260cb0, 0x5282916f, 0x9ef548ed,
+    0xcb6f0cd5, 0xccdf045d, 0x505d754a, 0xa59ed9d9, 0x1aaa273f, 0x57f64f2d, 0x10acc4be, 0x4cd09a18, 0xd2656e8f,
+    0xba1a42a7, 0xcd6d84c6, 0x1c4970fc, 0x967aec9b, 0x9084706b, 0xe2045835, 0xa6f87e00, 0xf686989f, 0x6ee12411,
+    0xf041b481, 0xba4272c4, 0xc5eba89c, 0x2da87e67, 0xa01146cd, 0x8aa3cd1b, 0x50c003f0, 0x77e8adc6, 0xa5fd7936,
+    0x6c141938, 0x10202f76, 0xb8f0e650, 0xb1ee7973, 0x1985293c, 0x4f902b5c, 0x43ec3bbe, 0x4ac63675, 0xcafbe327,
+    0xc41ba188, 0xbffd8ce4, 0x25cccba3, 0x2488b869, 0xf80a6aba, 0x6495b217, 0xb30c4004, 0x8969cb31, 0xd09f3531,
+    0x2fc6dea2, 0x225a00ad, 0x0aeac1c0, 0xbd8df1fd, 0xf330b114, 0x4119828a, 0xeed30df9, 0xda9bce74, 0x9999d603,
+    0x2099d44b, 0x206b4fe8, 0xd0820e3c, 0xc4d0f49c, 0xce5ffc56, 0xcbb5a4c6, 0xa8dbaf51, 0x726f0b5c, 0xa34b2da9,
+    0x05c37b69, 0x0eee7d00, 0x25451f33, 0x74562e93, 0x8742f821, 0x76d7d99d, 0x7a406743, 0x5ec72ccd, 0x6955940c,
+    0xcf05b3bd, 0x7e44ecea, 0xf8aa988a, 0xb2d64d59, 0xb1109fe3, 0xc3ee274d, 0x9d8eaf68, 0xf51213e8, 0xe173ba2c,
+    0x82d5fb37, 0x602e2f31, 0x09d3c258, 0x7de1e7c3, 0xe30b8c21, 0x3a6679c1, 0x8b5a8366, 0x8ce6e0ed, 0x06c009b3,
+    0x6b0abb4f, 0x34a11af5, 0x203117ff, 0x090c9b49, 0xc62a6882, 0x35656bdb, 0x3e16c550, 0xec4acb03, 0x306e82ca,
+    0xf2cbf0ab, 0x0403efa5, 0x2584b92c, 0x22b9c44b, 0xe6cadd83, 0xafe60cc0, 0x6786feda, 0x9a5e8e6b, 0x7bc6d641,
+    0xc57a108f, 0xce77748c, 0x055f4452, 0xe40bd882, 0x3e0b24a4, 0xc27bc480, 0xdc04ee0d, 0x28d96211, 0x00b1122b,
+    0x2cfc49df, 0xc101a256, 0x0c1dab26, 0xc94c9eed, 0xadf60651, 0x163743dd, 0xe6691b27, 0xcc623c4c, 0x0256c6bb,
+    0x12471d05, 0x3a07c8d0, 0x56eb0fba, 0x7d03150f, 0x4b04b9db, 0x725a2251, 0x25b09e0c, 0x4cb466e0, 0x38daba83,
+    0x70832213, 0xbbb35999, 0x58884a7c, 0x01e9f367, 0x0e3c3a64, 0xaf957a63, 0x251cbd06, 0x3b12ddb0, 0x0b9ea786,
+    0x163ef441, 0x057f702b, 0x3400fadc, 0xb122a5ec, 0xf1340564, 0xcca35c92, 0x69dc9493, 0x34fdfade, 0x016b07b4,
+    0x9ad8ba4c, 0x1fa72b25, 0x154c8684, 0xd6f2ec4a, 0x1a48b8d9, 0x5d9ae004, 0x1ef49fcc, 0x8f73b724, 0xb5b59cf2,
+    0x35b671d4, 0x8e2714be, 0x8a830694, 0xd12e2760, 0xcd9702b3, 0x675abd55, 0x426a472a, 0x5a90be16, 0x88434941,
+    0x9bc59d79, 0x809f7e27, 0xd636f6ab, 0x61235810, 0x39367e05, 0x74bf224c, 0xa9191a98, 0xa60fa1ba, 0x1d0d8a0b,
+    0x9db73cf1, 0xaf87fe9f, 0x19063639, 0xed218a0f, 0x82bb93dd, 0x42148a35, 0xe207fdd6, 0x9741efd5, 0xd42a115d,
+    0x2b3ec4e9, 0xba5bc18e, 0x4ed01e76, 0x66250c8f, 0x647f61f4, 0xf4fee8b9, 0xf50cac0c, 0x7538caa8, 0xfb32e57f,
+    0x84bc9b2a, 0x36b4c72b, 0xef05a44a, 0xdae0af19, 0xbe87ada7, 0xe621c9c9, 0x33693fd0, 0x2fda478b, 0x91596f49,
+    0x70b5041b, 0x6b7d4426, 0xaa354c42, 0xab323da4, 0xaec4ed43, 0xcd27b6df, 0xf050760b, 0x393b5bbe, 0x4ad47a73,
+    0x936a357f, 0x7ae5c9d1, 0x5b436a3d, 0x4360ef8a, 0x941c5db7, 0x82f75b55, 0xc03bced9, 0x08999305, 0xd247caf1,
+    0xd5b079ea, 0x7ed786ab, 0xf644f0b7, 0x915ccaa7, 0xabc7cc4d, 0x05e4cc2b, 0xf59e3f01, 0xe319afd6, 0x0558be86,
+    0xb38de8cd, 0x4d72f36d, 0xb050877b, 0xa79c9dd5, 0xa1c6e4d3, 0xd7b0f1b6, 0xe366d998, 0x3205ab7d, 0xc3bb58d1,
+    0xa2b3cb9d, 0x43d9cf9c, 0xcad86c46, 0xb75e3d31, 0x98a10f80, 0x6ab0ffc6, 0x4a45f958, 0xa915164c, 0xf17ddfed,
+    0x5a223f26, 0xcd01cdac, 0xab6e5cda, 0x0d76896e, 0x6e67f1fb, 0x2f0cf10d, 0x6780b077, 0xed43ff8c, 0xa8c6fc8c,
+    0x99afe121, 0xbcb3f216, 0x9666cce6, 0x4580aef9, 0xba8c131c, 0x7adfe0f3, 0x1f557951, 0x419d1da6, 0xaddb9044,
+    0x27dafd09, 0x413a8bc2, 0xbfb64f22, 0xe288d036, 0x138de8d8, 0xf960301c, 0x3ec6b646, 0xfc68b48e, 0xe2afa893,
+    0x1e4a9e31, 0x8bb3a108, 0x67dfd0a2, 0x8bb31e8f, 0x90601a46, 0x984bf2d8, 0x82669037, 0x93a1b264, 0xccf35911,
+    0x107240b8, 0x0fcfb435, 0x33547dbc, 0x105e8f56, 0xdc8d07fe, 0xe6d320f9, 0x19c3b3c5, 0xd5563912, 0x46fb9d41,
+    0xd6c30403, 0x0f39b980, 0xa62c6889, 0x68d9bbaa, 0xa3d16444, 0x911fa4ac, 0x104349bd, 0x24ff6402, 0x9f760b5f,
+    0xb69a307e, 0xa0189a29, 0x3309536c, 0x690b739d, 0xb765e9e1, 0x47bdaf4d, 0xc279f6e0, 0xafe394f3, 0xb3ea6b58,
+    0x9377a868, 0x7872ffee, 0x523432c9, 0x53a76eed, 0x26b99289, 0x453e78f2, 0x16e80027, 0x0875e2dc, 0xf3963da2,
+    0x2fa46c61, 0x5e52a8ce, 0x12cbef05, 0x82abb041, 0x8dba534f, 0x595635b6, 0xe703bd12, 0xbc9e04cb, 0xfd1bacb7,
+    0xd0c1e664, 0xefe00090, 0xd35600e2, 0xa1a01efb, 0x59738496, 0x3015bc63, 0x5bf4fdb9, 0x36801b49, 0xd0c91562,
+    0xae14f82f, 0xc6069e4c, 0xc95f4ff4, 0x7777a39e, 0x637d3d98, 0x955bafa2, 0x8058c9b0, 0x06814113, 0x309d9a35,
+    0x5d5a5cef, 0xcba0c35c, 0x68c54cf2, 0xf8329a4d, 0xc2e71fc6, 0x43e955db, 0x1c7fdaea, 0x850e07ba, 0x948bf8b2,
+    0x4ebdbcd0, 0xc73e7fa9, 0x7221ad96, 0x947bd9eb, 0x8197c88c, 0x69c200eb, 0xbdc094e0, 0x89b9a4ea, 0x610e7f24,
+    0x20b28732, 0x5f755686, 0xdc4dce14, 0x5b1b88cb, 0xf9c4cee1, 0xda0cfbc4, 0xbd977705, 0xf2158da5, 0xb128bded,
+    0x04ba3999, 0xf2ec978e, 0x2b4faa82, 0x69094a77, 0x651fe6c1, 0x9f8cbabe, 0x28dad03e, 0xe7f98b85, 0x9a9971bc,
+    0x3d09767d, 0xfbca3f8e, 0x75925391, 0x313d8156, 0x1476bd4b, 0xea7bcbfe, 0x453220b7, 0x7e0b2525, 0x6b7ce7d0,
+    0x30add434, 0xf429999e, 0xfc8f562a, 0x8c2975ea, 0x7abc4fc2, 0x1aa4bd35, 0x2f84d99b, 0xcd4a8a76, 0xc2608c16,
+    0xc94841e0, 0x00d3279c, 0xa765040b, 0x06432f26, 0x10359a54, 0x08b1f5cc, 0xfd38c2ea, 0x5259897d, 0x1356f40e,
+    0x8d8553c0, 0x605810fb, 0x2ab911e5, 0x08696317, 0x650bbb25, 0x64fc73b0, 0xfbf18c96, 0xad5845bb, 0x46c15fb6,
+    0x9f340d33, 0x951a8b1c, 0x49e93535, 0x2b83b2fb, 0x9993e8a4, 0x34daf845, 0x16121678, 0xfdb4ec33, 0x4b0e2476,
+    0x03fe549d, 0x49a361f9, 0xc78cf0db, 0x5c04ccc6, 0x51f3350d, 0xebd59857, 0x68167361, 0x3375cee5, 0xbe0706dc,
+    0x9114c3dc, 0xf8807408, 0xcb88c89b, 0xa0682e1f, 0x80217788, 0xfcf96ec7, 0x6be76e6f, 0xd50c0fb2, 0x696c5f54,
+    0xcfa65fbc, 0x9308cb0a, 0x36717b06, 0x7f591666, 0x2888184f, 0xf07a342a, 0xd7f3be51, 0x95fe7fca, 0xea53a152,
+    0x505637c9, 0xe1b0ea68, 0x7bf049ca, 0xb65a893a, 0xfbf06c7b, 0xe18f0ecb, 0x93c03900, 0x1b5c0435, 0x7844ca52,
+    0x05688477, 0x6d42e7ff, 0xac33c911, 0x63f4b842, 0xccb7bad6, 0xec3f957f, 0x8852fdfd, 0x0ba5de95, 0x41438d07,
+    0xcc1d3ce0, 0x7131eec0, 0xca715849, 0x58ac56bb, 0xf1437da1, 0xf9268b3b, 0xfcdc6254, 0x7d25f2be, 0x77adc912,
+    0x7e12d43f, 0x778df631, 0x23c8ea81, 0xc7c8839c, 0xe397cebf, 0x5f63cc8e, 0x79168a66, 0xa571f8c0, 0x1cdc963e,
+    0xf23c18de, 0x4159b3b8, 0x93a631f1, 0xb2301625, 0x604d4b24, 0x515ec858, 0x051e4f61, 0xb5255ec7, 0xedcafe17,
+    0x0c5b2fef, 0x314fda81, 0x02c418a7, 0xdbb576a8, 0x5eb5e1bf, 0x01182d2a, 0x483f14a4, 0x343fa67c, 0x2a45f974,
+    0x31468011, 0xfe88e3f9, 0xdf79c9cd, 0xb8ab6bd3, 0xb6e85f09, 0x20425f2f, 0x83fba877, 0xd171140c, 0xe8738a5c,
+    0xf2460115, 0x1a0708fd, 0xb841d952, 0x5668d715, 0x13a3b09f, 0xa2e280af, 0x262d95db, 0x09528a9a, 0x2c8ee10c,
+    0x8e5c8d9f, 0xefd1c038, 0x27af8753, 0xd1dc942f, 0x5649d8a6, 0x612504db, 0xaecb301f, 0x98458b05, 0xb28ef831,
+    0xdc92414a, 0x1f377173, 0x8ef9779e, 0x906040e0, 0xd6db4ec0, 0x21c19db7, 0x62591a07, 0xe711b1dc, 0xf90f8575,
+    0x901e14cd, 0x960c09ed, 0xa4eee650, 0x503d762b, 0xec76f352, 0x7a4f0792, 0xdb342ae7, 0xb35a36e1, 0x6407b767,
+    0x07b53ca4, 0xf8014922, 0xe2b18354, 0x49f19423, 0xc3ba6d60, 0xa14340dd, 0x30271933, 0x3f53910c, 0xae747e55,
+    0x98902158, 0x9f827f6d, 0x76ae6242, 0xac725ee2, 0x893c025e, 0xa63ca569, 0xb798f9d9, 0xb9224cca, 0xe0e934c1,
+    0x26522ecd, 0x1768352e, 0x136e98a9, 0x06990b4f, 0xa51fd2d9, 0xaf5233aa, 0xb409ca0d, 0x8da10490, 0x9a92f748,
+    0xfaa19c85, 0xf8a592ce, 0xbda798a4, 0x638be21e, 0x7a68243d, 0x4f31e849, 0x9825c810, 0xdcaa0210, 0x7f1ab343,
+    0xe2aed4c1, 0xeb2958ce, 0x6b2056a2, 0xcb050e54, 0x1594bea0, 0x1b081048, 0xb7a518bd, 0x3d6914b2, 0xca9797b5,
+    0xe5e79c98, 0x31f43fff, 0xf11ff758, 0x5e9bcaa0, 0x4c4c6c2a, 0x0ad211ec, 0x08951766, 0x08276b7c, 0xede16f75,
+    0x420a6e57, 0x6d91eb4b, 0xf3a0909e, 0xb5090c65, 0x1fdcdbbf, 0x6dc13359, 0xd09a4b0e, 0xba818018, 0x0eb3facf,
+    0x77535c27, 0x45355458, 0x1e035e04, 0x97d4e0bd, 0x6e186916, 0xff958dc4, 0x95bfdf93, 0xa97f2d5c, 0x7015b8b9,
+    0xa91836f0, 0x4cc7829e, 0x6e00dd38, 0xc1753ca4, 0x3061d15a, 0xe0e15f8c, 0xb494bafd, 0x566321a9, 0xe1da84f5,
+    0x5ba20d30, 0x87ce2176, 0x85844ebf, 0xc9310a42, 0xa08ad896, 0xc680d594, 0x591618d3, 0x83a4b0d4, 0x3d29edaa,
+    0xa2c49dd6, 0xabd27a9a, 0xbbc8b5f5, 0x4cebab0a, 0x2baf9196, 0xd6cc052f, 0x7aa6bf76, 0x94fab615, 0x73e880a6,
+    0x6a76bb2f, 0x34cd4281, 0x052664a8, 0xbf809d61, 0x4f694a14, 0xcf612a9d, 0x25c81ce7, 0x4a748695, 0x537876be,
+    0x22053552, 0x04301521, 0xc6ec48b2, 0x54868952, 0x85c559d6, 0x62d5c19f, 0x3c8eb2a5, 0x3465dabc, 0x7dd38962,
+    0x1398d744, 0x851fdbd3, 0xeeeca8fe, 0x216e4da5, 0xa12cc7e7, 0xf9173f62, 0x690aab66, 0xd79b9b6a, 0x782a849b,
+    0x14135aae, 0x2cefa5cf, 0xc71accc6, 0xa27efd1d, 0xc90203e6, 0x1aa07be6, 0x61efe573, 0x1669fcb5, 0x36c352cc,
+    0xc62432b6, 0xfc4dd73e, 0xdb322c31, 0x6a490e2d, 0x84eaf745, 0xe68955b5, 0x1d0f84b9, 0xe311a123, 0x5f65a2cb,
+    0x573fb3c6, 0x806d49d7, 0x8c29e82c, 0x944d278b, 0xad17ca13, 0xc28dbfb5, 0xa9058ee1, 0x623976f7, 0xa4650d0b,
+    0xcf684767, 0xb5901f1a, 0x750aa305, 0xead2a421, 0x3d621c15, 0xfe32023a, 0x00490cbd, 0x3c1ffeaa, 0x006c2772,
+    0x9be8b9da, 0x91f44d4f, 0x662c8a97, 0x0acbbe18, 0xe81225f9, 0x0bf14ab7, 0x84f68466, 0x1a009d10, 0x637b10cc,
+    0x33267881, 0x594e6c49, 0x946d3b46, 0x7f7568fc, 0xca9c2662, 0xc1e5440a, 0xe4451def, 0xc8d4415c, 0xeb09c8da,
+    0xe9fa3495, 0xc6d90bf0, 0xc22f549d, 0x38f8533b, 0x91d9b8be, 0x0b0530af, 0x22fad1af, 0x47f41cc8, 0xd6377b72,
+    0xe87b4e07, 0x8a5f3842, 0x4f080060, 0x820e9307, 0x45d90ad6, 0x7bcbc653, 0x316eee99, 0x8e6abefd, 0x279d9d44,
+    0x8c450ea2, 0x0a4f99f1, 0x1f9c9dec, 0x80c1b1c6, 0x11edce85, 0x583787d1, 0xe7e06dd5, 0xf3a3e420, 0x186df41b,
+    0x72edb1b8, 0x2bca18c3, 0xb4c292f6, 0xd31cdf36, 0x5b47465b, 0x2edc1d26, 0x068e2de4, 0x7bff009c, 0x285e3a20,
+    0x098d4881, 0xa948722f, 0x52354f16, 0x21d5b20d, 0x1c3236bd, 0x0a79785c, 0xbbfa1b99, 0x01448139, 0xfeff03b4,
+    0x333931c6, 0xbcb21df4, 0xc4d30118, 0x8f38a438, 0xef8598e0, 0x825b7c30, 0x0ae0994e, 0xabe54dd4, 0x82dbda10,
+    0xf179dfcc, 0x870505bc, 0x151180e3, 0xeb39c429, 0x593d94ab, 0xd2097437, 0x081f1890, 0x194c53bf, 0xe2ed211c,
+    0xdc9eaad0, 0x138b1c38, 0x0f1ef7fa, 0x007df4f0, 0x1b56c716, 0xdea94cf2, 0x82d2d9dc, 0x24608b4c, 0x41b03699,
+    0x00df3384, 0x57d647b2, 0xf7e949ed, 0x17570d8f, 0x059b26f8, 0x7304071b, 0x505974d1, 0x376b3ffc, 0x7b7cbed1,
+    0xb33ecbb5, 0x83d32209, 0x0ba726b2, 0xb7ddc418, 0xb31fdc6c, 0xcd5ab25c, 0x454e720b, 0x08fe5ac7, 0x6807bcbd,
+    0x8c7befaf, 0x5024ed87, 0x9f243747, 0xbad115f8, 0xc76c5dc2, 0x6ffc880d, 0x199872f7, 0x88fa3d35, 0x6fc2df82,
+    0x96f203a0, 0x145e7ba5, 0xc23ed683, 0x9a8013bb, 0xff350014, 0x51b4a658, 0x76f65e03, 0x0f1731d6, 0x018acd77,
+    0x9bd87402, 0x008d9544, 0xb8d3a29f, 0x4ef88ac0, 0x1d59d394, 0x13717ee1, 0xeeb08d95, 0xb08e2009, 0xc1a9aee3,
+    0xa5d54182, 0x578b030a, 0x289dfab0, 0xbb01813c, 0xbc8f3908, 0x1797d2f3, 0xbe399f47, 0x24536829, 0x931a0aba,
+    0xc4fb6e78, 0xdc2f6f09, 0x5b400c32, 0x3332d985, 0x1154c11f, 0x9e4fda9d, 0x14ba579f, 0xca8bf902, 0x6f52804a,
+    0x92c28d7b, 0xd811774b, 0x065c4132, 0xb88574fc, 0x2861c523, 0x582b1866, 0x428f5dc2, 0xad2ddc4d, 0xa41c4085,
+    0x17a8092e, 0x3466aa60, 0xad7f1f3b, 0xa4c03ccb, 0x61a5f758, 0x5382c319, 0xa3a6dd81, 0x9c9dae9d, 0x7fba4b26,
+    0x3ad0d10d, 0xd7064b08, 0xd0421f9b, 0xae5d9468, 0x6c2b6c8d, 0x9a82bdd3, 0x3600fbd9, 0x3dd9410d, 0xf2b5f721,
+    0x5514bf64, 0x4f29c052, 0x48221978, 0x4b743f9a, 0xdbff6cf8, 0xe371f36f, 0xb6c2840b, 0x35ae13d9, 0x3c6181b3,
+    0x7945c931, 0xcb6182aa, 0xcf5f28e3, 0x310e641f, 0xc51b8a15, 0x10631dfa, 0x26236d4a, 0x2c149a10, 0x2491709b,
+    0x514cbc80, 0xf3552516, 0x6e42955e, 0xecb1edb8, 0xed217d47, 0x7c95a633, 0x7af232f9, 0x1fd0bd5e, 0xde153e6d,
+    0xb22d3c63, 0xb4a26391, 0x89d88b13, 0x22d9be33, 0x762a9649, 0xd12c401d, 0xcf262869, 0xe7dd1bcd, 0x020e7d57,
+    0xe3fb2898, 0xb3dc63f1, 0x71672578, 0x43cb89a1, 0x7b8b89b1, 0x0c8fb989, 0xfe5999c3, 0x626847c9, 0x52335341,
+    0xefd87706, 0x7e72e0cb, 0x704e1f7b, 0x668025ef, 0x1fe9650b, 0x0c876b68, 0x3e66bbc0, 0x37e81b26, 0x78d2fe8d,
+    0x0a51a6f7, 0xd3d38807, 0x1b5ea47b, 0xaf2a3d02, 0xccf6bc28, 0x83491383, 0x555e1155, 0xfa5cbe5d, 0x8060f580,
+    0x70d31402, 0x24cd0e85, 0x718ff533, 0x3a3026a0, 0xc970be04, 0x423e5e6c, 0x8b1c7493, 0xe337e7c4, 0xa8fbe62d,
+    0x2c992123, 0x4aecca4b, 0x9319ff51, 0x6246f201, 0xac87c6ad, 0xbb060b79, 0x21d1f354, 0x9b5a11b2, 0x567319fb,
+    0xefdf9bf1, 0x878d0199, 0x1a6f1152, 0x37544990, 0xbe893385, 0x2d67a6ed, 0xb6567bc9, 0x3cebe577, 0x4aea8030,
+    0xeead0e51, 0x4da346ff, 0x783d607d, 0xfb7aba58, 0xf69e8493, 0x65ce9884, 0xee28515d, 0x86cc0899, 0xb728e6d0,
+    0xd32ae13b, 0x74f3edcc, 0x91c3177b, 0x725e6af1, 0x99ff6fbf, 0x4ab59678, 0xc9287b3d, 0xd5c68ee8, 0x35ac62e2,
+    0x2f7cc958, 0x2847f1f1, 0xca3ff287, 0x13591208, 0x0d14f051, 0xd7b43f48, 0x823643fc, 0x32abff94, 0x3b126959,
+    0x2bc62a73, 0xb66767d2, 0x43d0b1c4, 0x6fcb526f, 0xc224d156, 0x5805c704, 0x2c0f58bf, 0x5241d2fd, 0xa04b350b,
+    0xb34d64b7, 0x427930af, 0xcda3a32b, 0xeb346d33, 0x6e3627dc, 0xea87aae2, 0x811abb9a, 0xd14bdb0b, 0x070e2db9,
+    0xa3a89b8c, 0x76644f6c, 0x0c1fd8a8, 0xdb247ab5, 0x5c194523, 0x11a05c03, 0xde5868e0, 0x1f20a518, 0x0e79f141,
+    0x56ad6163, 0x4e2751f1, 0xa1f92c9b, 0x244528c4, 0x48e5e9f7, 0x9425760a, 0x1835e390, 0xae1e51e4, 0xe311cb16,
+    0xfecfbcbc, 0x5774f507, 0xa4ca1bfe, 0xe72ff201, 0x9c514865, 0x2b238d48, 0x83f09396, 0x5ac8a82f, 0x317f53fc,
+    0x14b2a2f7, 0xc6f81467, 0x44d35ef5, 0x0d4fc7d6, 0x1defcd8c, 0x64c740c6, 0x8117319a, 0x0ae33991, 0x6a56994e,
+    0xb7523909, 0x22746d78, 0x86bd80d7, 0x2086d016, 0x4a6cf95b, 0x200e2fc8, 0x0a29a390, 0x72db7499, 0xe54b56a0,
+    0x48ae5834, 0xbedce49e, 0xdabbf8df, 0x4b5ac9ae, 0x708b68c2, 0x0a82c244, 0x865cdf19, 0x9a36759f, 0x742aebe3,
+    0xf8c7d285, 0x47874ca8, 0x12a5f3fc, 0x88f8c61b, 0x360d53d1, 0x278de231, 0x18b3365e, 0x124d5b71, 0x0a7f3dc8,
+    0x083496a1, 0x7e8b033c, 0x6a8b57e4, 0x420de4da, 0xdc91f405, 0x2a7b3d2a, 0x696a466c, 0x47cb1436, 0xf5fce6c2,
+    0x476f94bf, 0xa1b81b6d, 0x7dbdf959, 0x82c73562, 0xe294e4d9, 0x231208fa, 0x6d74727a, 0x9948ecee, 0xd7686046,
+    0x4d563a81, 0xfe91b8c8, 0x356cc769, 0x3fa92121, 0x4bdca304, 0xdc5fea36, 0x3548666b, 0xc44b432c, 0x6f141bf6,
+    0xa8acb0f0, 0x6447818c, 0xdc068755, 0x87c8f864, 0x0da662f7, 0xba7775b8, 0x49acb420, 0xe6a21bd2, 0x5ae57bb6,
+    0xdb6028f1, 0xa17f7d76, 0x283ef33b, 0x02954214, 0x9b60839a, 0xb8f0e04e, 0xcf3a01f1, 0x33299063, 0x91ebdf18,
+    0x3a675ccb, 0x9a013ccb, 0x27c83796, 0xefd9632f, 0xda4272e2, 0x0770ed40, 0x1b03552b, 0x5a1d3793, 0xc3073898,
+    0xad2ead5e, 0xe6c6ad93, 0xd9d0ca87, 0xdcc17094, 0x51c47529, 0xab888dad, 0xb02daf89, 0x0d7b35c9, 0x606ecf96,
+    0xc4eb7f1f, 0xb14d9b19, 0x19e9cf46, 0xf36f3003, 0xbb897790, 0x8bb154ec, 0xd0dce8ef, 0x88faf447, 0x09581749,
+    0x98a975b0, 0x94f45c0a, 0xa0cb3192, 0x06bf99aa, 0xf2f55eb0, 0xb2afac8e, 0x5f1d6c09, 0x34d607f0, 0xa98d6e75,
+    0x04cee39b, 0x898cf5df, 0x4d236bcf, 0xdb93c83b, 0x4dad1435, 0x3fd9c3f3, 0xc2bd2bba, 0x05ff7309, 0x1b1f8787,
+    0xe23cc641, 0xc8539400, 0x4ded0afc, 0x45fde2a3, 0xf328907e, 0x660b0efc, 0x350ef5a1, 0x9cf955bc, 0xdcf1c59d,
+    0xe7b25070, 0x35039702, 0x634bf7c7, 0xe7eabbec, 0x64c1ab0b, 0xd2bfa0ec, 0x90f27353, 0x8c684ad7, 0x3614d9e7,
+    0x24fc2b58, 0x43fdaee7, 0xc7e4f766, 0x0b1d900d, 0x1abbd123, 0xe5a677f0, 0xb7cb2321, 0x0db23f2f, 0xfa1aa4a5,
+    0xc404aad3, 0xbbdae717, 0x4f365e7d, 0x18a93441, 0x807efc7d, 0xaa1d6ff4, 0xb90adffd, 0x2605b775, 0x999ff91c,
+    0xc2c83406, 0x634dbd8c, 0x72a52ee0, 0x53a0caf6, 0x77ea69f4, 0xb1e49556, 0x592e4052, 0xf3ed43cc, 0x97cdaaff,
+    0x13036129, 0x2271bde6, 0x8a36dc44, 0x92dd316c, 0xf7f1b43f, 0xd5ce4d16, 0x9c32cbfb, 0x7f712fc8, 0x81b8de18,
+    0x094ee18a, 0x762f6c13, 0x0d09d818, 0xdf3ccaa8, 0xc5ceb091, 0x646182fa, 0xa1cdf2f9, 0x11c49093, 0x600736ea,
+    0x304d0a38, 0x9a54dd54, 0x48f009da, 0xbbb0f204, 0xfcfce7e3, 0xdba85408, 0xa3b54fc5, 0x7aad2b5f, 0x9bc49bed,
+    0x46fd9f6b, 0xfc4c9d63, 0xbb589240, 0x308fa075, 0x013d16da, 0x4f370964, 0x7e44f438, 0xcc03af9c, 0x0256fba3,
+    0x52425829, 0xf2712502, 0x9d411112, 0xfdfd2684, 0x90d0f959, 0x6a0edb92, 0xd78802a6, 0xdc1a5bfe, 0x03290b3d,
+    0xcac9a39b, 0xfd2a8d7c, 0x335719b4, 0xe4bccf05, 0x89e3d4f3, 0xf50b586b, 0x76de3792, 0xabde194c, 0x8cecfbf5,
+    0xabe4fbc0, 0x2a11dca3, 0xe59d8279, 0x1993268d, 0x2cc6575b, 0xd8e9b11c, 0xec14a2cf, 0x34c77745, 0xa07758c2,
+    0xed1a15e9, 0x587c6a95, 0x1d510df5, 0xbf6762a6, 0xd72cd264, 0x4e4b7a7b, 0x46323819, 0xdbd8df74, 0xda3a5bc4,
+    0x6c86690a, 0x4ed36819, 0xb0ee3d59, 0x7db7840a, 0xf5b2ff24, 0xc25d03b7, 0x3bab9f7a, 0x89d2517b, 0x6e8551f9,
+    0x6986b25b, 0x518dfdca, 0x90d08965, 0x2ee70253, 0xf27f58a8, 0x40b89416, 0xeac10bce, 0xf08b9aa2, 0x96848009,
+    0x23b5cb5f, 0x9328668f, 0xdc62aaed, 0x036b2e60, 0xc34c48e6, 0x9be34676, 0x10f1bcb0, 0x36ef35dd, 0xed09397e,
+    0xc4fdfc57, 0x1b4e95d0, 0xe8dba564, 0x046a4ce9, 0x888efed4, 0x492c1b73, 0x2558062d, 0xad7fa3a5, 0xd5f5c44f,
+    0xc77c3255, 0x7ddce913, 0x0f3dc3c1, 0xcbee9bec, 0xf27bcb2e, 0xd013393a, 0xdd4c442d, 0xca816257, 0x266770d4,
+    0x71c7cbea, 0x7b120570, 0xdf15c212, 0x90122506, 0x0b538e9f, 0x54138edd, 0xad2b4ed4, 0x8bae6055, 0xa022866f,
+    0x32410014, 0x8222ea01, 0x383f8142, 0x3ed9d3d7, 0x60c1d2db, 0x0d260926, 0xabcb4285, 0xff101102, 0xb01413ec,
+    0xe22e5ec9, 0x46958e87, 0x65445b81, 0x1a87db70, 0xfa159a80, 0xc94d2cea, 0x600b4e4c, 0xc3e754fb, 0xb3cc5f49,
+    0x794f8ed9, 0x5585544e, 0xee186fa2, 0xa42c8955, 0xe21e07a6, 0x88d1fd8e, 0x52093ffe, 0x478ea775, 0x6597a2bb,
+    0x775d0d17, 0x80aa87ff, 0xd4dd6d54, 0x88a6af6d, 0xe3b63696, 0xdf22b5b9, 0x36c84c2e, 0x4cf35a14, 0x16534d4a,
+    0xad3436de, 0x398d6c7a, 0x36f795fb, 0x1d8a82c3, 0x064c31dc, 0xe7937fc1, 0x854e2a6d, 0xfa9578ee, 0x5683017c,
+    0xad1aed5c, 0x859c7eb7, 0xf8a26d4b, 0x09d02e97, 0xea5064e2, 0x41c71b44, 0xdd299faf, 0x84fdb6e9, 0x2ca8bb9a,
+    0xdb46a9f5, 0x370c37fc, 0xd4a1b85d, 0xedb1b08b, 0x498cce69, 0xa92303c7, 0xfaa61d31, 0xe8923cc1, 0x8dd2eb02,
+    0xf5844bcd, 0xede641e4, 0x9447e0ec, 0x5445f93d, 0x54044755, 0x1d0a1d84, 0x8bd4bab8, 0xfe0ac7d2, 0x806f51df,
+    0x2d701e22, 0xc471b722, 0x0a59be9b, 0xc97556dc, 0xbd52596b, 0xe910ec5d, 0x4b774ce0, 0xba0c8434, 0xe9d9a212,
+    0xa197f055, 0x16c91654, 0x04922bb4, 0x4361f249, 0x10f47457, 0x25a32bb2, 0xf438df1d, 0x88a3afa8, 0x3a3b0071,
+    0x9f8811ff, 0x92901f00, 0xac9e38b5, 0x599ce929, 0x80f8a1f4, 0x3ac56fe9, 0x60a58a38, 0xbe8fcc0a, 0x400f73e4,
+    0x29d586b7, 0xf6bfeb87, 0xee452a7b, 0x356d2395, 0x17be8165, 0xb24fbe3e, 0x155c622d, 0x2e436369, 0xcc81ee19,
+    0xc6ece564, 0x002830c1, 0x3809c98d, 0x71cc63b8, 0xfd96f65f, 0xb3f17f97, 0xd7fe17ac, 0x75373658, 0xfcd7d314,
+    0xe47808f1, 0x9195a7a8, 0x4e5c402a, 0xcf02a039, 0x06b5fcee, 0xa8e4ef6b, 0x5d1cc33a, 0x5e75d3a3, 0x48812098,
+    0x68badf89, 0x4238127d, 0xbc45dc61, 0x3bb54714, 0x2b93323a, 0x321bf367, 0xba1f9b51, 0xe3509369, 0x5e6a70e4,
+    0x5ec825a5, 0x1b8bef3d, 0x6eac676a, 0xb0f6ff3a, 0x2124e306, 0xaa273e07, 0xbabfceda, 0xd3f6c362, 0x3e3a0ec9,
+    0x42d2809e, 0x8c48352a, 0xfe3873f0, 0xde8064eb, 0xb8ce75c8, 0x03a28c39, 0x2f2d2ef0, 0x27583bdf, 0x1943b3e4,
+    0xaf1ed277, 0x73a7a295, 0x325c8d1b, 0x287dce7b, 0xf4828c5e, 0x0e94bf5f, 0x9a031f4e, 0xdd636996, 0xb7a937a9,
+    0xd31a0bff, 0xd8f7ebd4, 0xc578b5cc, 0xb0f8d4a0, 0x5b133b90, 0x85c7c388, 0xca593057, 0x4ca39fbe, 0xaca531e7,
+    0x9c7bff41, 0x35e52f92, 0xf279f2bb, 0x9438d63d, 0x0b2485d7, 0xcb402353, 0x06621999, 0x93952861, 0x6e7014bd,
+    0xa599754d, 0x7987b3a5, 0x7eb5184d, 0x5ea21841, 0x34ea7c0b, 0x383f57a8, 0x870fba66, 0x6c05442c, 0x1302f627,
+    0xff15cbfa, 0x1ebc4623, 0x587e2eaf, 0x2de3bf21, 0x557f1def, 0xf9d9067c, 0xdef9ac57, 0x432aa280, 0x63f1cdae,
+    0x14a0f50e, 0x0a43c459, 0x6af1346a, 0x58c6a871, 0x253651ab, 0xd9f8e770, 0x1c45868d, 0x9eb40f1b, 0x36df200d,
+    0xb7428e57, 0x793fe828, 0x872b3f39, 0x72eb1dbb, 0xc1d2b60b, 0xc5281493, 0x70f85721, 0x99c792e6, 0x994e3498,
+    0x20ff11fc, 0x90e032fa, 0x8684c89d, 0x3cdf52eb, 0x49ea7a0b, 0x2981a09a, 0xf3f75812, 0x377c05ae, 0x4a913e3b,
+    0x1852d160, 0x83092fbd, 0x308e9871, 0x0ff4114c, 0x467fbc40, 0x06530207, 0xc907cd9c, 0xef12bdaa, 0x4aa76a3e,
+    0x8e636dae, 0x8b7db755, 0xdfd0d4e6, 0x49d9ed13, 0x651e2cef, 0x834a796a, 0x156d3956, 0x122cf73d, 0xc0c6531f,
+    0x9677d413, 0xff34fb1c, 0x4146b7b5, 0x54bab231, 0x56e0e11b, 0xd852dda1, 0xf18b2adb, 0xfad7232a, 0x012d3f52,
+    0x86425379, 0x7cca1e92, 0xfdd664f3, 0x9fa92a4f, 0xabdfc5a2, 0x1c643c46, 0x1f4ef696, 0xd97a47a8, 0x9d6f4dd5,
+    0x220767e9, 0x300d42aa, 0x0288dc7b, 0x6476532e, 0xcd297632, 0xf148f764, 0xb29dfe0d, 0xf28220c3, 0xb0fbad30,
+    0x7b70cc89, 0xd21d2865, 0xbfeb3791, 0xa35155b1, 0x90b75177, 0xe7a9feda, 0x85e8c878, 0xec5c006d, 0x251ee487,
+    0x10c51877, 0x93a241f7, 0xce4ff7da, 0x4e3620b5, 0x5e5e7e6f, 0xf50f69dd, 0x11b179e7, 0xe37f59fa, 0x4d872b3e,
+    0x4288d063, 0xf191bb99, 0x240fdbaf, 0x1215b1c0, 0x15725b2e, 0x04789d0f, 0x12b6b6a0, 0xbb86fdcc, 0x6d52791e,
+    0x0c4873de, 0x79c4b1ab, 0xfde7116d, 0x1132cfc9, 0x16d4cf34, 0x8b0f6e35, 0xa1b7d947, 0x825d1dae, 0x1a7f3e6e,
+    0x5eaf3071, 0x7f715e6a, 0x4ad400ff, 0xf100ec43, 0xfdc832fb, 0x98ed5596, 0xd3c5306f, 0xdb8aebaf, 0xaa6cd385,
+    0xa1e13997, 0x67c03945, 0x87fbb40d, 0x4701d33e, 0xc135576d, 0x1c0744e9, 0x7c8024fe, 0x59d8c5df, 0x249dcf6e,
+    0x9a2e9ea8, 0x901921ff, 0x52efb0b9, 0xdd656992, 0x0aef9cc2, 0x05968d17, 0x5e62a6e1, 0x03957625, 0x7de5b447,
+    0x5436ffb9, 0x2676cd65, 0xb5a86420, 0xbffbd0bf, 0x547b1d7c, 0xa2032995, 0x9bcdadc8, 0xbac37e74, 0xbcb1299a,
+    0xde390a28, 0x79aa6120, 0xfd18c5cc, 0x1fb3a4ad, 0xefab2337, 0xe73ced2c, 0xee1e88f6, 0x91425b3e, 0x54ffa8da,
+    0x9590bdbb, 0x9d94fe36, 0x9f3a3352, 0xf28aaf46, 0xf066d0ff, 0xcd98d9bd, 0x84d53d86, 0xdef46e1f, 0xfb7d8172,
+    0xa87db4d3, 0xdfa47e85, 0xc4e2e25c, 0xb46f8895, 0x41300ef3, 0x9f837ad4, 0xda1ba381, 0x3c87baff, 0xcc8fddcb,
+    0xe1de8241, 0x7a57e20a, 0xdb18d7b9, 0xda9f54c1, 0x8e0e2216, 0x18c90869, 0xb851d97d, 0x1bc8f4df, 0x935d2446,
+    0xf2382177, 0x60cf7efb, 0x31a466d8, 0x02d0f343, 0xac22ce7f, 0xe67c3b48, 0x4209ecbf, 0xf00fdfbd, 0xd896c9c0,
+    0xf9adcc1a, 0xb1e536d8, 0xab641f64, 0xc9445a64, 0x0d577af5, 0xb5192130, 0x508eed4c, 0x62e65958, 0x9aacf865,
+    0xe9d2258b, 0xd694758e, 0x616992e7, 0xcf1c9018, 0xe2967e07, 0x3001424e, 0x9eb1a9f5, 0xe8d6057e, 0x77bad72f,
+    0x788a1077, 0x50688c00, 0x1cc7d5e2, 0x3060730f, 0xeaeb5e65, 0xd87f0518, 0x0afc57b0, 0x0ffc9472, 0xd1fd9d2b,
+    0xa8cfff40, 0xcc6f1b45, 0x8346975b, 0x5a0ea37e, 0x46ade0bb, 0xac10e341, 0xad045320, 0xfb022a75, 0x9c4a7634,
+    0x4b3e1122, 0x4759094d, 0x8ace0861, 0x50820dcc, 0x39e9a816, 0xea3be0e7, 0x297c9dec, 0x0b38f2cd, 0x75a30195,
+    0x9fbfe5ce, 0x3d6e20aa, 0x06f4a083, 0x5ddef790, 0xf0a49b51, 0xb79ddf1e, 0x2eee5c9e, 0x5ab717e7, 0xeaab27d8,
+    0xe9753a65, 0xa400cf9e, 0x0e46de2b, 0xf75545e3, 0x58ad0710, 0x5237501c, 0xd6e82374, 0xeb1d8ce6, 0x24304514,
+    0x52ff45f9, 0xdde47865, 0x939fd35c, 0xe492d7e4, 0xc444d34f, 0xd38bed87, 0xf689d17c, 0x4094b24f, 0x36cae910,
+    0xfe99093d, 0x008277bf, 0x2ac00c5a, 0x41c7b681, 0x9bb2974c, 0xc3852956, 0x7eda43de, 0x3aaf4929, 0x365cec52,
+    0x6254574d, 0xbdd8e7cd, 0x27223e8d, 0x3cc66f12, 0x75c5da5c, 0xb486824e, 0x9d8a5ee1, 0x3dea7b65, 0x3f71e1a9,
+    0x2f97232a, 0xe57134c2, 0x7f8290d0, 0x5767d834, 0xf48329eb, 0x510cbdd0, 0x622cc2e9, 0x14d489d0, 0x9f6d3e2c,
+    0xcd5aee7a, 0x93846531, 0x30171290, 0x6342f7d8, 0x1185cdf1, 0x66565046, 0x69125c68, 0x53ed326d, 0xf8b876ca,
+    0x9720fa9f, 0x329fd9b0, 0x8361ca49, 0xf077f6ed, 0x5649a56c, 0xb0e89721, 0x38de44a1, 0xea99a79d, 0x68d20584,
+    0x2fd806dc, 0xed20b8c9, 0x9cfd536a, 0x54569d6b, 0x2de9f725, 0x4fd18d59, 0x90fc67b4, 0x6d74e468, 0x82fb9188,
+    0x37c159ed, 0x62d89409, 0xf6f14593, 0xccac01ca, 0x9f0c2a0e, 0xb402c74a, 0x6c9e2c9e, 0x0b8946f5, 0x4749e88d,
+    0x9b76b9df, 0x77be5a78, 0xdaee67e1, 0x7ddcd612, 0x6eb7dca8, 0x6b21dbb0, 0x808b196f, 0x85d15510, 0xbb80b864,
+    0x6d0a7939, 0x7cace2ff, 0x47b22725, 0xa290357f, 0x18e25a7e, 0x831ee58b, 0x82f1cb11, 0xf60e8831, 0x0f404772,
+    0x5a2747b1, 0x453a7fd4, 0x0f3a3f9e, 0xeddddd97, 0x9deba034, 0x60bb1f2c, 0xa6597124, 0x0f06ded2, 0x814be741,
+    0xab22be89, 0x0ad18c45, 0x298bb882, 0xc4beee9c, 0xd7c54c22, 0xbe523f6d, 0x0d4b6995, 0x04c2d761, 0x61b482a7,
+    0x816b9bee, 0x686fee47, 0x55092510, 0x0f24a0aa, 0x97735989, 0xcfea65fd, 0x1c770fd6, 0x2283d8ac, 0x0a3d86ea,
+    0x9a8c9f81, 0x2a71ae6a, 0x10a440f1, 0x08c074e3, 0x55a75294, 0x4ae9de8c, 0x8b2c8bc0, 0xa4bfff55, 0xa4d0b214,
+    0x231be88d, 0x16e7bf58, 0x912d54d1, 0xdfe5e4db, 0xac8cb59e, 0xa9a9c3d6, 0xe5b2658b, 0x79e57898, 0xbe5f2597,
+    0x60499013, 0x065c7fe8, 0xcd35488c, 0x7643fb54, 0x52dca8cc, 0xeea346d9, 0xe9643547, 0x049f2dcf, 0x10db2868,
+    0x46eea6e7, 0x4b71850a, 0xf945bcfb, 0x1caf63b7, 0x5a58e2f9, 0x9acb8fcd, 0x226c35f9, 0x48fc34a2, 0xa069a9d6,
+    0xcb4eeb0f, 0x8b76697d, 0x229f50ee, 0x63b13256, 0x6c38e480, 0x25665887, 0x701895ac, 0x0911a6b9, 0x6ee236a0,
+    0x78919fe0, 0xe112d6eb, 0xaf9743c1, 0xfeb018be, 0xce8464d9, 0xb941722d, 0x42e6757e, 0x7a99afcd, 0xde8164fa,
+    0x7c307e22, 0x288e22b1, 0x1d57f8dc, 0xf35fac2d, 0x2996f8de, 0x02be78a0, 0xcd14e821, 0x0a207a7b, 0x5f49348f,
+    0x0627379c, 0x9176ce9b, 0x895b008c, 0x3fc37a38, 0xc46ed145, 0x573fb2e2, 0x52fba4b1, 0xd034d988, 0xc9ad100a,
+    0xbad553c9, 0x9f261cfa, 0xa6589a8c, 0x60787a4b, 0x57523d76, 0x59233954, 0x84e26863, 0x9abcabf5, 0xc35b1e3a,
+    0x2c740e4e, 0x090e2f6d, 0xb3367b91, 0xf39a53f2, 0x03821629, 0xdd54747f, 0x2b6de7c7, 0x9b04ec43, 0x17e42c1b,
+    0x40b8e439, 0x4cbdf181, 0x46547606, 0xf2f7616d, 0xde30cb61, 0x6280879e, 0x1ead24e6, 0x24ba2e38, 0x5765acde,
+    0xeb6273d5, 0x32ebdbf8, 0x530fa02d, 0x0d9b7204, 0x1b37576e, 0x89408e76, 0x8dca91fb, 0x2d9bb372, 0x56be6ff2,
+    0xe312826e, 0xb1ca4e78, 0x84298f5e, 0x25b29346, 0x9aa7754f, 0xb01ab1f2, 0xb22842f9, 0xbf720976, 0x0188eaed,
+    0xd064be52, 0x50e6e5fe, 0x19f3bd74, 0xffdf3497, 0x040f62e3, 0xa263857e, 0x668dc458, 0x3469394d, 0x2521d602,
+    0x11dc89e1, 0x00a50a2e, 0xf35de62c, 0x026310d7, 0xb28b93d6, 0x90647e03, 0x2ace9da1, 0xed32f295, 0xe215a20f,
+    0xd2846899, 0x0d9d71a2, 0xe7783710, 0x15cbdb2b, 0x6901a726, 0x54561d67, 0x963e979d, 0x7603c33a, 0x6f959b12,
+    0xf8ef0765, 0x80feefd4, 0x10330db5, 0xc29305a5, 0x6491a610, 0xb5025ceb, 0x00790264, 0x21eaaa74, 0xc1bf08cb,
+    0xf93183ba, 0xdf1bd8b7, 0x4a8c5095, 0xffb24a69, 0x6677c168, 0xf0b7bf5d, 0xdf0ee06c, 0x24c39fa2, 0x4b0ce480,
+    0xf073d4a2, 0xf5a33189, 0x25b33f27, 0x347b332f, 0x7598ead5, 0x55fd49c8, 0x0689d818, 0xa4c91c07, 0x9cb2e4d1,
+    0xe93718ca, 0x2489a4f6, 0x71a51a04, 0x0ba312c6, 0x3761ca26, 0xc8c57294, 0x3727eefb, 0x7c4783e9, 0x462c5d23,
+    0xd28e318c, 0xa72e0e49, 0x1f33d3c1, 0x83b1035d, 0x42d6c3ea, 0xab247299, 0xd14820ba, 0x4deb43c5, 0x90575cf3,
+    0x45c18a1c, 0x6ea7a746, 0x2f181a75, 0xd50cae2f, 0xc61b6369, 0x19741001, 0x5e2542fd, 0xa18334b0, 0x4cfb545e,
+    0xe75994c3, 0xfa64f422, 0x802556c2, 0xcdb3aa5f, 0x5e5312c1, 0xfd50e641, 0x71c56a42, 0xc086a3b1, 0x78acf9de,
+    0x3e70d6a1, 0xa550af3a, 0x166abc4b, 0x38927f79, 0x45f9892d, 0x540f0004, 0xb02cf1ad, 0x98f148c4, 0x305d95b8,
+    0xedc101da, 0x3cc9b1f3, 0xbdffb26b, 0x12907b48, 0x6dae43a0, 0x8ee644b4, 0x9a888f6f, 0x05454c25, 0x6f5b62cd,
+    0xe35c439f, 0xe6f12edb, 0xbf5e7ab0, 0x25b42abe, 0x54d9e251, 0xe487d1d1, 0x2d0947b0, 0x0f0644e0, 0x9eca6512,
+    0xed5687de, 0xdf4407c9, 0x4660f33e, 0x31b2e1cb, 0x13530cd1, 0xb688a2b8, 0x0fbf0cf2, 0xa7480d41, 0xe3e20489,
+    0x606984db, 0xef6566dc, 0x96f2a02c, 0x97c1b639, 0x2eb6c5f1, 0xd6bba352, 0xd13363cf, 0x1965a36b, 0x8fcde1bf,
+    0x215ba830, 0x529ef662, 0x309ac8ec, 0x8faaa9dd, 0xb55391c2, 0x063d620d, 0xaefe885f, 0xd6c12672, 0x527eecc9,
+    0xb18b20ec, 0xce87d39a, 0xf951f65b, 0xa0e8994f, 0x325160ad, 0x54fee849, 0xb17be680, 0xc3b6e015, 0xdf7a8be4,
+    0x2cc25391, 0x70fea8da, 0xcd746662, 0xcc3f19b2, 0x79fefe54, 0x765b0b27, 0x45c3321a, 0xf1922f6b, 0x71d6d474,
+    0x570fd842, 0xd275e16c, 0x58f7502b, 0x819a06d3, 0xd5021dca, 0xece544c6, 0x699aaa3d, 0x07887f0f, 0x31a08325,
+    0x7048f335, 0x4e43e6f0, 0xfc2b7fd2, 0x21caa6a9, 0xcf11f81c, 0x74197912, 0x45b8317f, 0x88dfd5a1, 0xb97b9dab,
+    0x65185594, 0x5a20cebe, 0x0037f330, 0xe62576fd, 0xa7693f67, 0x3a484f6e, 0x10b2222a, 0xd3de6878, 0xbf6eb6e8,
+    0xcf1b3da8, 0x37a06a5b, 0x517f1b68, 0x63cf4f9f, 0x2d1d2e43, 0x0798415a, 0xdfc5ba9d, 0xcf3a2eb2, 0x637d2aee,
+    0x8d866088, 0x96ad1fab, 0x128e27e1, 0x8cc255fe, 0x98a0e149, 0x552bf9ae, 0x5c1fbb18, 0x3d406eab, 0x699cb1e6,
+    0x5d69ea32, 0xd6056cc2, 0x651d37af, 0x0a53a987, 0x95fec709, 0x6c4ebec6, 0x5b7f8008, 0x40a726d1, 0x2718af1f,
+    0x4ef2baf7, 0xd7356390, 0x39924cc7, 0x04c217fa, 0x70bb882f, 0x2ce9d986, 0xe124a885, 0x14e110b3, 0x8a6cbf20,
+    0xf86d9e1b, 0x54d3d387, 0xabed1633, 0x0fc0191e, 0xa451fa31, 0x34527b63, 0x680cd1f5, 0x5b8d0033, 0x833f4238,
+    0x8c4646e4, 0xab2a171f, 0xc4be2112, 0xaf50ec8f, 0xdcad43d1, 0x08d5312b, 0x1a213480, 0xa03dad07, 0xdfc84cfc,
+    0xcd601943, 0xa32f6a40, 0x81f85e9c, 0x989c0583, 0xe22f1ba1, 0x7d39dc00, 0x660796e3, 0x27bac35a, 0xde647925,
+    0xcd9c6fd2, 0xe89c9a49, 0xd8d2a0d0, 0x8733643f, 0x19c8f7b6, 0xca5bd09e, 0xba234d21, 0x468806b9, 0x9843857c,
+    0x43fc6901, 0xb8dc9a8e, 0x37a923fa, 0x490ca02a, 0x831f7e6d, 0x5d90e4e5, 0x7eeb7549, 0xfa68d692, 0x205070da,
+    0x1600d435, 0x4edb6892, 0xde8ed196, 0xeef703b6, 0x69eca985, 0xbbc713d2, 0x8bc8b3fe, 0x61e81818, 0x2934cbb8,
+    0x74f5f9c9, 0xd2407bce, 0x948fc904, 0xfff2e7d7, 0x294411a0, 0x562ea1d1, 0x0d13950d, 0xe8c6b04b, 0x57af7ad0,
+    0x44e3a773, 0xcbc00bcd, 0x92b37925, 0x19f5d462, 0x479a4f91, 0xb35b5e6b, 0xcad939c5, 0xf9b0892e, 0x0936c8d4,
+    0xdbfb3343, 0xe33eecb3, 0xf928702d, 0x55a52c79, 0xd8f6c180, 0x7adbb298, 0x9881505c, 0x79fa5706, 0x27b5d0f5,
+    0x813833ae, 0xd107a386, 0xec63906c, 0x4f51c3ab, 0xeb5b4e03, 0xeba01228, 0x99df547b, 0x22638817, 0x5d8519ce,
+    0x2afb6ed6, 0xe63cdb2f, 0x5099d670, 0x8ec9e0d3, 0x57b874c3, 0xd18cf2a6, 0x1b295abb, 0xe2220b01, 0xe89cdecc,
+    0x2166b6a8, 0x9378b5de, 0xbc0e66aa, 0xbd4b730b, 0x6ed412c2, 0xbd2cb3c5, 0x616ed22b, 0xc958e1fd, 0xe85f6573,
+    0x48f214ff, 0xd5a67390, 0xb0760dd1, 0x5757ca41, 0x207a4a52, 0xfc3419c3, 0x6742a0a0, 0x6ebc2805, 0xde97bc59,
+    0x9c870230, 0x9c45a8b6, 0xe6d81122, 0xca71c419, 0xd4c0b2ac, 0x1546db6d, 0xf59e6e0e, 0x73dbda8a, 0xf1501447,
+    0x9ca32321, 0x28aa2ad3, 0x6196538a, 0xd09c0082, 0xacc446c3, 0x7619b494, 0xedda1b8b, 0x2ee817ec, 0xac4d8c67,
+    0x6f3f94ed, 0xed5911c5, 0x7a861f64, 0xf1ef3832, 0xefc53090, 0x029477e9, 0x13a48327, 0xb69c32ce, 0x511cb7bf,
+    0x991824b1, 0x108834a6, 0x155d0050, 0xcdf6a44b, 0x10908041, 0xa7085f35, 0x337af5fe, 0x88b94479, 0x06e8efd3,
+    0x5fe75673, 0x5fbc6932, 0xe0491028, 0x415d3398, 0xddd65594, 0x634e6209, 0x53a36f17, 0x9868e49d, 0xd897ae9f,
+    0xc8f217a9, 0xabb547fe, 0xdadd4ea5, 0x598fac57, 0x6bb6f2f3, 0x640e27a9, 0x35dc9ccf, 0xd86db337, 0x75dffe78,
+    0x91caf838, 0x36b085d4, 0x6ed768ee, 0x450aa248, 0x75581860, 0x3e453f24, 0xa51bc67a, 0x20e0acca, 0x47e70eb8,
+    0xaa9b7ccb, 0x7134c149, 0x23853285, 0x21839cad, 0x2f7c32e4, 0x5840143f, 0xed302fbd, 0x581b8c36, 0x4920f9db,
+    0x73a5a4dc, 0x7967c2ef, 0x9f35edba, 0x4a843409, 0xb7c9b5b8, 0xe458745d, 0xb6ea0cb1, 0xd1a38150, 0x3bc87b2e,
+    0xa77c2bc8, 0x64352466, 0x546fc08e, 0x54dc73b1, 0x6f71ba3f, 0x22cc8ff4, 0xf0a59832, 0xf1d07c60, 0x5ad8e28d,
+    0xa802621a, 0x9d2f7453, 0xd06b4d99, 0x97f49b06, 0x965eb221, 0x38dbb785, 0x1192910a, 0xc3f9a85c, 0x77ab0370,
+    0x2ab8602a, 0x914c68a6, 0xfbb322c0, 0xa523c113, 0xe60149de, 0xf84235d8, 0xe3dc0fd9, 0x4eacd9a1, 0x90f3bc7b,
+    0x7ac21e84, 0x4c201aab, 0x5f30959c, 0x981a6b16, 0xe1480f1c, 0x287098e5, 0x4aad77fd, 0xa0836557, 0x6a7da09f,
+    0x54d04441, 0xc54a5f21, 0x80c0c42f, 0xa7db2efc, 0xfd769e3b, 0xb826096c, 0xa17c98b4, 0xa85849b5, 0x9d25b728,
+    0x6d020a0a, 0x58ee3a0e, 0xaba7af02, 0xe02af851, 0xba5ee6fc, 0x55c666fc, 0x1fc6ac9b, 0x3defdad5, 0xadd16744,
+    0x39c1f2c8, 0x21f04dce, 0x773dcd2f, 0x912439ad, 0xe69b40eb, 0xd34099f1, 0xb352b6b9, 0x9d0612ea, 0xfcc9dcf3,
+    0xdc522f49, 0x994e33b9, 0xcba796bd, 0x5d73dd6e, 0xf5a6064e, 0x4e4d287f, 0x96f7ea77, 0x27725253, 0xb1ea353e,
+    0x2fabf02c, 0xbd08b9bc, 0x798936fb, 0x54f032a7, 0x4ec19e6c, 0xf4cbc730, 0xca5a9520, 0x9fe9f376, 0x8b6ce5d6,
+    0x7e0fcd55, 0x12c6f935, 0x5cc43d1e, 0x543c33b7, 0x7041826a, 0xa5256d80, 0x2720f70f, 0xe121cb51, 0xcc96b596,
+    0xd74bdfdc, 0x3f71dfca, 0xaf56b426, 0x67d94aae, 0xc8b276e4, 0x46092c01, 0xa510fad4, 0x9d30444c, 0x7ab2bf4a,
+    0x31c9c5c4, 0x815f7c12, 0x2de950f6, 0x273bb46e, 0xb8ec5432, 0x1f44bb3e, 0xe93063ed, 0x6e07bcd9, 0xc238d590,
+    0x268eb553, 0xcddf37d2, 0xb8c39eee, 0xdf4be870, 0xb269538c, 0xb7a74fcd, 0x5f4944c9, 0xd81d3d62, 0xba9c4864,
+    0x529cfb97, 0xff81c72a, 0x8599f2c5, 0x1034f226, 0x52fd9219, 0x802d4da2, 0x0843005d, 0x11573e35, 0x64f9294d,
+    0xee319983, 0x9e20484f, 0xf7de9a63, 0x84ee0e0e, 0x6172461b, 0xef7d14c4, 0x7eddb92a, 0x05d819c8, 0xeb12a55e,
+    0x729b04f8, 0x066e33dd, 0x5c557078, 0xc1d538a7, 0xa1ce9e64, 0x3962c31b, 0xda9956eb, 0x10d7037a, 0xdf2dfb93,
+    0x627ea0a0, 0x944807c8, 0x09940f7d, 0x01995c32, 0x38367e7a, 0xf43c006b, 0xfb7438df, 0x40496934, 0x1efb35ba,
+    0x1f675f03, 0x521a3928, 0x1c0cdd57, 0x47d22b77, 0x2fba6015, 0x5a370ed9, 0x138072ec, 0xf2cb9e91, 0xe275f730,
+    0x7e582c18, 0x91ee7970, 0x18f561f5, 0x2a13542b, 0xe2a370f4, 0xd4751e0c, 0xeae1983d, 0xea5cb34f, 0xee244eec,
+    0xaa5857a0, 0xbff2af59, 0x25dc25ed, 0xd076596e, 0xbb3c08f9, 0x4e566d47, 0xed138054, 0x5b564390, 0x09f4e86d,
+    0xdc6a57a9, 0xbffa78c7, 0x9169ef9e, 0x0dde876f, 0x05182130, 0x11030150, 0xe908c171, 0x3ba07429, 0x9ad45b32,
+    0x0627b191, 0x3a0a312a, 0x2d47e370, 0x78bff691, 0xfe1e8868, 0x24131c91, 0xb21543b8, 0xf0206a56, 0x79607c9a,
+    0xe1d7344a, 0x731aa786, 0xa162c393, 0x3843e614, 0xb4f31ad6, 0xb5be76fb, 0xbb541d80, 0xb2baf0ac, 0x85d61ebb,
+    0x6ceaabfd, 0x2ff00ec4, 0xf470551a, 0x1a965dba, 0x2d662bdc, 0xea754df5, 0x68a149f9, 0x59b7a6e6, 0xeca15c4a,
+    0xb910daa4, 0xbaebab50, 0xf5556c2a, 0xa42664f4, 0xf7cf1f99, 0xee3a3daa, 0x00c18764, 0x71577e62, 0x0e77b976,
+    0x6dfb4b57, 0x08983c74, 0x7bbedb39, 0xf9ecda61, 0x6b2bed5f, 0xa0eb944c, 0xb767a93f, 0x6f9ebd3b, 0x890f01c3,
+    0xf7839199, 0x011f2895, 0x4ea29c16, 0x4a6752c4, 0xae75a849, 0x6b0dfba5, 0xd48ceedf, 0x41960fcc, 0xfbea33f6,
+    0x310c826d, 0xef809f2d, 0x1d58bf3a, 0xa055a871, 0x2d9b88a8, 0x82c0728a, 0x5f6a9cda, 0x770f30b9, 0x51c1bc34,
+    0x32941aaa, 0xaca44d21, 0x374da8aa, 0xebb54de9, 0xbc20fe8e, 0xbee57f0d, 0xc5fb1b00, 0x196b381b, 0x5cc13bdd,
+    0x24f72e41, 0x7b353e77, 0x92d8a114, 0x36e38467, 0x8c6a7f67, 0xdffc0590, 0xc166b3e4, 0x1550078c, 0x2bbf6e54,
+    0x02d7231e, 0x250fe882, 0xa33cfdb1, 0xd915cc82, 0x776488e8, 0xd65aeb97, 0x433eef8f, 0x41f40d2b, 0x503e3d80,
+    0x77cdafd6, 0x18cd82f5, 0x35235684, 0x2609979f, 0x805cd157, 0x4e896d31, 0xfa834f96, 0x8b04e80e, 0x9246a829,
+    0x8b1602ac, 0xedd5d795, 0x65149527, 0xed994e6a, 0x33c404b0, 0xde74a4d3, 0x25743363, 0x02bc05b0, 0x211b47ab,
+    0x6a00cf61, 0xcb5d6c3e, 0xd0f0609b, 0x4526a271, 0xf4a2694c, 0x1818a853, 0x852f2058, 0x27c54841, 0xb2020dda,
+    0x3a1f8e4c, 0xf1cbd79d, 0xfd79b4e7, 0x9dd47f83, 0x7493cabc, 0x5f058d5b, 0xf6357c52, 0x9d22892e, 0x8c407707,
+    0xaa2bc39b, 0x33004af8, 0x9a4a119e, 0xf61981fe, 0x464ef6f0, 0xd2969dbc, 0x36190e47, 0x60d329cd, 0xca63dca0,
+    0xad650481, 0xbab43a89, 0xb254442c, 0x033fc21a, 0x8d2dd132, 0x1390eece, 0xa5fdec08, 0x95a5ab2a, 0xeb1be751,
+    0xcd4b62a2, 0x1fee330b, 0xac6a54f9, 0x837f112d, 0x7a41e201, 0x11c38bfc, 0x55034a6a, 0x40f0bd45, 0xc2aeb8c1,
+    0x3871c247, 0x7b5b4b93, 0xa38c7cd9, 0x131d7f04, 0xc455029c, 0x79b18fab, 0x94365cad, 0x049553fa, 0x6afe2453,
+    0xe8152f1a, 0xf1053fc6, 0xcf5e8d05, 0x00ce5ce4, 0x7841b05c, 0x418dffa9, 0xb24449cd, 0x099986db, 0x570c0812,
+    0xeefde2fa, 0xebdd324a, 0x6700861b, 0xf2c82130, 0xc6296f15, 0xaa042927, 0xb826b85d, 0x9a6c09e9, 0xc7f221de,
+    0x2469feb8, 0xb56144e7, 0x23fbd941, 0x301c651e, 0x5d50a96a, 0x56814af9, 0x316da7c3, 0xc4f5fe08, 0x6fbcc112,
+    0x1d9bac29, 0xcfdc433f, 0xd487a244, 0xad525f12, 0x31dab567, 0x6b7f926b, 0x88c96ae9, 0x12953031, 0x91362dc5,
+    0x23d2bd03, 0x7e59f7de, 0x905eec28, 0xeed21530, 0x6a9f3b46, 0xa1b61a45, 0x1b43be57, 0x3b57a6e9, 0xbff5fcbf,
+    0x6fde06fa, 0xf7143b3d, 0x0f30251f, 0x53c6a251, 0x2cd15977, 0xae221301, 0x23e67261, 0xc0327a05, 0x8be0f2a3,
+    0xa384766b, 0x4f896c4d, 0x52950044, 0x45372d66, 0x60c12af7, 0x5e3cd079, 0x28ff7053, 0x2cfe0bf4, 0x744c6aa8,
+    0xafd28cfd, 0x5c0e04ed, 0x61f6d4dc, 0x389f3150, 0x0ebad3ea, 0x1e6d38b9, 0x53d625bd, 0x9c94d037, 0x6ff1a93d,
+    0x32590c08, 0xc64dd545, 0x75843858, 0x0296318a, 0x455021cf, 0x9f319627, 0xc660c6eb, 0xabe7abc0, 0x183cc494,
+    0x2e308e36, 0x1d58e6fc, 0x1aca1276, 0x45474cd6, 0x10d1f285, 0x5b797143, 0x1a944534, 0x00e42780, 0x3ac3f2ed,
+    0xa80fbee8, 0xa7f41048, 0x4a3d7c10, 0xd06b94e5, 0x1d9d3cf6, 0x8d79facf, 0xfb53dc4f, 0xbe564c0b, 0x479222b6,
+    0x72b62012, 0x090ad2d5, 0xbe286733, 0xda1b0221, 0x3417c0eb, 0x1d680221, 0x6c4faeba, 0x8c0eed9b, 0x145e348a,
+    0x76ccee7b, 0xc5e534f9, 0x993d8ffe, 0xd76aae11, 0x4787bd2f, 0x839fccc4, 0xa9c21924, 0x500cad11, 0x6074d821,
+    0x531d7a3a, 0x1540be68, 0x61c614ee, 0xd7841d9a, 0x52756f78, 0xd201e542, 0x0ec4ceed, 0x4bba0aa8, 0xb70a5abd,
+    0xbdf1b95b, 0x5d50c3ea, 0x94484c80, 0x56ee08e7, 0x3d3ab718, 0xd120fee2, 0xc2ff56f8, 0x4b5054ca, 0xb7e75c80,
+    0x8d3de007, 0x274a06ed, 0x90ca1f60, 0xe365ed1b, 0xd7a2de16, 0xaa7a2781, 0xf3bbaed1, 0xf63c6a44, 0x4273c734,
+    0x1147a4b8, 0x02be6fd5, 0x636decb1, 0xb57700d3, 0xa5c4e63a, 0xb3244bcd, 0x01ff2a02, 0x7e383f2f, 0xd73f24f7,
+    0x94fc5839, 0xfd1dfe46, 0xfc98f229, 0x16a16455, 0x09c65ae7, 0xa744fe27, 0x5c6c5d4d, 0xc9cadf2c, 0x74284df0,
+    0x2a9d5d6e, 0xadbe4451, 0x8de98d94, 0xdb5e7094, 0x3131c0af, 0xdcaf0f9e, 0x8f886004, 0xaa3ded18, 0x647b5072,
+    0xc2496fa0, 0x22785f51, 0xe1c95bb1, 0x3fab84f0, 0xc524c1da, 0xc14e6443, 0x98811abd, 0x10633c91, 0x2744f1a9,
+    0xde317504, 0x825d0086, 0xfdf23b7e, 0x80273975, 0x2137c50e, 0x6a2d0f87, 0x95014818, 0x9f59226a, 0x803d2695,
+    0x9e840af1, 0xfb331ef8, 0x78b2a2bb, 0x64dd7672, 0x7ede3192, 0x90919268, 0x116fdcdc, 0x1dc99dac, 0x0e0624d5,
+    0xcf6b2526, 0xc56d7529, 0x0cf5a5e4, 0x99bce1bb, 0xed26c3ed, 0x4cc86548, 0x181bbbe9, 0xb65f3924, 0x6df891c2,
+    0xf0335900, 0xb7ab394f, 0xb9e5653d, 0x053dfed6, 0x21442178, 0xc6b86ae1, 0x41dcf782, 0x8acc6a89, 0xf1213d43,
+    0x6a564d51, 0x6cd6adb2, 0x14b11dc9, 0xbf50fd05, 0x0164d160, 0x1cce608e, 0x1735c7df, 0xb3d6b29e, 0x8d2b2930,
+    0x76afc7da, 0x4754e831, 0xcdb0aef4, 0x04990205, 0xc7afc64a, 0x06c4dbb4, 0x690e7c65, 0x6a4de68d, 0xfa9b26db,
+    0x92d8e4c1, 0xa648f10a, 0x313af7f4, 0x31ff2d85, 0x096ac1b3, 0x60ed49b0, 0xa233fdcf, 0xc722f59d, 0xea4d5747,
+    0xb10e93d1, 0x6469631e, 0x16d872c9, 0xc03e8b79, 0x4b8bd211, 0x8dc89ba7, 0xdae14eeb, 0x7ba21e9d, 0x71941cdf,
+    0xc69cc42b, 0x12d59841, 0xfc9eb9b5, 0x327216bc, 0x76b311ef, 0x8e3e5c53, 0xdafa0b4a, 0xdadbfacf, 0x273ba447,
+    0x515b2cd2, 0xee3c3e8e, 0xcb766109, 0x77d20a06, 0x5268b4bd, 0x896c5763, 0x373a086a, 0xf65e73ad, 0xfeea60af,
+    0x2c3d340c, 0xab5eb21b, 0x1dab92f0, 0x4c61dab9, 0xebffdb7c, 0xe9b584f5, 0x3080252a, 0x72d54a78, 0x655688f2,
+    0x48f8a61f, 0xba10d7fd, 0x91961e05, 0x9db722ea, 0xa4576b4e, 0x987c4a38, 0x69b62f9a, 0xb0d03d05, 0xf54a0412,
+    0xd65a05df, 0xbc159e3e, 0xf664c440, 0xe487430e, 0xa74e221b, 0x9c6bd471, 0xf099b128, 0xc752b27b, 0xf972d775,
+    0xe68a9673, 0x1706f69f, 0xcac48a76, 0xf90275f0, 0x5bfbc978, 0x21576ea9, 0x6836500e, 0xd02c6172, 0x20f84c1e,
+    0x0bac149e, 0x5845734c, 0x988f9f78, 0xc6242708, 0x7221b055, 0xf8cc893b, 0x9a672687, 0xaa577694, 0x078b0b68,
+    0x25df6225, 0xe61dd909, 0xf19083b6, 0x4d093992, 0x0cd6344c, 0x7e4eb234, 0x08946f55, 0xd6322889, 0x423cd163,
+    0x0eef6933, 0x3c8364f2, 0x20d025e3, 0xa3db50f7, 0x5f0524ca, 0x25f7e45c, 0xc1ed4455, 0x4c82d7e5, 0x38863ad3,
+    0x7c14086d, 0x6d478451, 0x796e7aa5, 0xa68ed34a, 0xf22fb6ee, 0xfd02b176, 0x0eea559a, 0x0082ab98, 0xba1460e9,
+    0x2c7b687d, 0xf9577290, 0xe203534a, 0x13242a0c, 0x2b899cf1, 0xa0014376, 0xc5d56844, 0x75926a09, 0x7ff95868,
+    0x59edb8c5, 0x7c417fb2, 0x0c8f5bbc, 0x2a3f4f8c, 0x0e7a9b81, 0x1a468684, 0x23b6e6f1, 0xaa01768f, 0x082f64f4,
+    0x973459bb, 0x6d56a10f, 0xa6f87a4a, 0xe50a997c, 0xbefa79ca, 0x808779ae, 0xb76aab5b, 0x0645f7f7, 0x5f037dda,
+    0xee858acd, 0x1b6271be, 0xd6cdf205, 0x95117484, 0x3021f9f8, 0xee7a8554, 0xda0c3603, 0x09c9974e, 0xcfc08e0b,
+    0x687d9a11, 0x79252840, 0x4011f8ce, 0x5a0c6d4d, 0x1d28bf1b, 0xa65afb77, 0x3f8f0fd9, 0x7b1efb6b, 0x844c0091,
+    0x632b6fa9, 0xe751464c, 0xcf5c5e6d, 0x71edbfc3, 0xaad8a940, 0xb5a6da24, 0x157f0ab9, 0x9721a9b9, 0xa3271d61,
+    0xf7ce0e2e, 0xcdc6e36f, 0xc3e06696, 0x594d5374, 0xd8a689b0, 0x5cef848e, 0xe4b3f9d8, 0xaf47ef84, 0x4f03b1cb,
+    0x76faf8e9, 0xebcae4e0, 0xa30b489e, 0xf675099c, 0x1c8c4fb2, 0x22b8e505, 0x3330acd8, 0x22bc38f9, 0x3ec67bc8,
+    0x8a8a8b11, 0x7cb6cdf2, 0x5d93cce8, 0x0773b7c4, 0xcf5cc54d, 0x9543d507, 0x0e58a009, 0xa623cb07, 0xfe8d2271,
+    0x8bb980f1, 0xc55fc5d5, 0x573bf2cc, 0x2ea28e2e, 0xe6ebe1a2, 0x3efae9b6, 0x388dbb7c, 0xb4638af0, 0x5d09e976,
+    0x09d8c6bd, 0xa1707036, 0x117c26b3, 0xcd972a13, 0xa36de9ec, 0x35861e13, 0x67703db5, 0xce22a56f, 0x52424cb2,
+    0xf5518da4, 0xbebb25dd, 0x0de0f6a7, 0xab282af4, 0xbeba9bfe, 0x5d7c297a, 0x8cb2404b, 0x736f95f9, 0x598a3231,
+    0x314d82c8, 0x5e41369e, 0x79633fe8, 0xdfe56a0b, 0x35dcd0d9, 0x0a619747, 0xbdc84bf8, 0x0e90f269, 0xa301da44,
+    0xa9397a11, 0xd271b01b, 0x23feb328, 0xde5cd2f4, 0x98beddbc, 0xf31dce6e, 0xd1033ee1, 0x14fbf47f, 0xa719d2d5,
+    0x0e993819, 0xc0770a44, 0xb7dd9d7e, 0xcba60206, 0xf3dbae91, 0x62d3c6c6, 0xaa77e9b6, 0xab548bb5, 0xd6f76554,
+    0xede1a36a, 0x5eb40e28, 0xe231ae8b, 0x69ac848d, 0x9b9457c7, 0x649c14b7, 0xc9c61bee, 0x89752fd0, 0x8ed5e6a7,
+    0x81ddac28, 0xfcca9351, 0x97641eff, 0xae242179, 0x4de1ea87, 0x207486bc, 0x81a8ee2c, 0x94d1b933, 0x125d90ec,
+    0x4992a701, 0x0186e141, 0x899bfc8c, 0xb9d3c6ea, 0x310fe9d2, 0x255310cc, 0x8f3f90b9, 0x14a0981a, 0x2b31895f,
+    0x72f10f74, 0xca151d14, 0x99f38283, 0xfc3be8b1, 0x90cfba09, 0xb87e2c0d, 0xc1eb1bce, 0x0d5b57e1, 0xf94b24d3,
+    0xb183178b, 0x874b2a2d, 0xc06b47a4, 0xd2fafd8e, 0xabc60b70, 0xe7b332d4, 0xe0af6d7d, 0xb37625d2, 0x91509d56,
+    0x0120fe0a, 0x1a98f644, 0xcadd7122, 0x170c79c4, 0x6ef1bdb5, 0x4f72b02f, 0xb646cfd2, 0x71034837, 0x0efac47b,
+    0x5fbaf5f1, 0xd328c258, 0x6cc65352, 0xd48507b7, 0xfb0ccd41, 0xcd76ebfd, 0x78765b05, 0x8e12eda8, 0xdf1c289c,
+    0xd4533d4b, 0x44d667a4, 0xa013194a, 0x718db9ec, 0xec08e7a9, 0x3c0fc2e5, 0x4323a192, 0x1f4e43ba, 0xaa28ec1b,
+    0x5f9dfbc8, 0x88fc6779, 0xe9a8a225, 0x22f87e8e, 0x05d51367, 0xbdaccaa1, 0x3527b923, 0xc5ddbe37, 0x22c7c5d7,
+    0x9609b772, 0xd6a4f3d8, 0x2e1cd529, 0x68c49c7c, 0x19c70dd5, 0x37067859, 0xb5361b7d, 0xf2556c4a, 0x758f4f10,
+    0xcfe1498a, 0x1fb7e821, 0x8a02b49e, 0xda48cd46, 0x4f6efc39, 0x2b49f6d7, 0x7e37bf81, 0xe7828041, 0xdbfa841a,
+    0xa9d361c6, 0xec908956, 0x97efa27e, 0xf95e518f, 0x7dfbd3fa, 0xc05e7de4, 0x04eb4bf5, 0xbb90d91e, 0x00b04a53,
+    0x839ea357, 0x3be73e1b, 0x43961a92, 0xa5ce6e9f, 0x149a05a6, 0x1a309fe0, 0xece9077e, 0xb8c4dd36, 0xd531821f,
+    0xf25b9cd3, 0x7c068a34, 0x7177ece8, 0x65b8d68f, 0x19450f76, 0x9f86e9bb, 0xba2ee5a1, 0x2e2d4ab1, 0x68ce9081,
+    0x3626da17, 0x893e3190, 0xb0f94756, 0x0fa11b5d, 0x34c53e45, 0x819d4e19, 0x57e6e618, 0xcfd4eec0, 0xd983f32e,
+    0x4d9af6ec, 0x9330049c, 0x2f849dd6, 0xd1923124, 0xac1f541e, 0xa19ddfa6, 0xe59e618b, 0xc772b036, 0xb2c7f681,
+    0x5b5bc81b, 0xe5822ee2, 0x1ab51964, 0x556672eb, 0xa0b7212e, 0xd21f7858, 0xb90fdb15, 0xc97ca251, 0xd9ed6ce8,
+    0x8cadc0e9, 0x0fe937d8, 0x74b1c757, 0xa36967b2, 0x5390f84f, 0xaab7b926, 0x0f156280, 0x4a77202d, 0x84c41cbd,
+    0x8814a1a3, 0xf42a45a6, 0xf55590c7, 0xdf9fff33, 0x03326137, 0x863a8da0, 0xdb350f65, 0x1d97ad8e, 0x52b3b965,
+    0xcc3b3482, 0xbba60036, 0x367ed973, 0x987aef98, 0x60fcee46, 0xb8736673, 0x95260161, 0x0c7e6cd3, 0xef998e22,
+    0xc9f3a08f, 0xb0360aac, 0xd5ce1945, 0x351cf9fa, 0xd855358f, 0xc58011c6, 0x3fd614e5, 0x3464d1e4, 0x4a57c2ca,
+    0x16145200, 0x2e17d85a, 0x2e2733ee, 0x77d25185, 0xc5432a83, 0xe9895463, 0xc9efbdff, 0x49e50013, 0x85971c15,
+    0x1c127dc7, 0x43a213e7, 0x2c4d2a07, 0x9c7bd1b3, 0x92f9ea96, 0xf345fa16, 0xc402962a, 0xe2aed5d6, 0x2e4bf395,
+    0x035da6de, 0xe712360f, 0xdfb3a96a, 0x6841b68d, 0xfcffea4f, 0xd131fd25, 0xca4fabfe, 0xec09381d, 0x9249ac9d,
+    0xa48b41ec, 0xd9559b64, 0x4bef31bb, 0xe98146f5, 0x668d87f4, 0x79e401b2, 0x542fa177, 0x7e2c1a26, 0xbeef1457,
+    0xc9c4ff17, 0x6e762b21, 0xd2fd961a, 0x7d58ffb6, 0xa7d5a477, 0xda64e291, 0x813f9723, 0x9c862252, 0xba533447,
+    0xa2d7160e, 0x3885d7aa, 0x7eaabee8, 0xc56367d0, 0x6197c261, 0xb3afc2a2, 0xd21dda53, 0x1a45cf95, 0xad655dfb,
+    0x6e6db47d, 0x67225e6d, 0x40f31086, 0x5cc6a53e, 0x8de6028f, 0xc41f1b1b, 0xd8d4814a, 0xd0645393, 0x6de0a03f,
+    0xa02bb75b, 0x30903604, 0xe54a9643, 0x5bf27a06, 0x090ce886, 0x3d851762, 0xd9aef626, 0xff326c9d, 0x7bf2b96e,
+    0x0f83bf53, 0x6cbf4186, 0xb38edc2e, 0x317f746d, 0xfe9ace58, 0x7e52eacd, 0xc24529ed, 0x52c552f9, 0x61ee9c75,
+    0x27a11b62, 0x45bd63d1, 0xf78195ea, 0x589795b6, 0x0ec417b2, 0x0c6a82d5, 0x89e5417f, 0xe2d6a9d2, 0x918f5672,
+    0xd21dc468, 0xa30d4284, 0xdea7c420, 0xb014348d, 0x498ac072, 0x7a230caa, 0xabefcc9b, 0xeb31e6e4, 0x9b59c0a4,
+    0x9fb99b9d, 0xaf4211db, 0x824389b1, 0x6b684d0c, 0x692d214e, 0x37b78a03, 0x6c25c0e6, 0x3bfc072f, 0x8c0d0687,
+    0x5af39475, 0xeb818879, 0xdc726f5f, 0x3bd8c911, 0x552ba581, 0x452d7105, 0x387c358d, 0xb7f5962f, 0xb9c58dd3,
+    0xf791dd4e, 0x603436a0, 0xbbeb8c3e, 0x41e8e93f, 0x198d972e, 0xa5424280, 0xf1b7371e, 0x5d355021, 0x65d58cf4,
+    0x3489ab59, 0x90b7360e, 0x7948bed3, 0xb99b55c5, 0xd5fd72a7, 0xd42133e8, 0xed974411, 0xb35d3b86, 0xe1ea9fda,
+    0x31198917, 0x6c515ada, 0x36214d08, 0xb1c16972, 0x1f44058b, 0x88226354, 0x438a3e95, 0x8dce6a65, 0x7f205ecd,
+    0xaf08b81c, 0x78d67156, 0x83343579, 0x1dacc36f, 0xdc0e7924, 0x43b9e5e0, 0x7b742356, 0x661b4de9, 0x489bba84,
+    0x6bb970f5, 0xdc45edf3, 0x0b877ddb, 0xe20ebd12, 0xda5d61bd, 0x59049e83, 0xcc23ffb5, 0x0d4c6101, 0xd6024509,
+    0x218a5782, 0x964d0986, 0xf6f8b2c2, 0x802d964e, 0xc311932c, 0x8d248d11, 0xd55286a5, 0x1abdc8a8, 0x81421416,
+    0xbee29019, 0xc3d7344d, 0x9c42a114, 0xb08dbb55, 0xfc629722, 0x30a49bb3, 0xe8f06958, 0xd50c6634, 0xf56a7790,
+    0x707d3b2b, 0x7e122351, 0x572eaf00, 0x41409aff, 0x5380a44a, 0x37cbfb39, 0x3259de14, 0x683fd45b, 0xd2a98bfc,
+    0x8d92947e, 0x2ec974c6, 0xf8415ffd, 0xa36a6af4, 0x7c7cb077, 0xa2b3f313, 0xde2c6d76, 0x3525cac0, 0xc2154241,
+    0xc64af8f4, 0xd5a1ec76, 0xb12cf168, 0x4aa474a5, 0x66e6adc0, 0x961c7571, 0xc13d6bfc, 0x9f8f8931, 0xa534338b,
+    0xd3c5c3dd, 0xfdb8f39a, 0x680f92e2, 0xec88241e, 0xbeec9bb1, 0xa790551b, 0x8924d1ac, 0x50c81d0d, 0xeb12bcd0,
+    0x2440ffd1, 0xfdd11fe3, 0x594afbb6, 0x627cf2ce, 0xdef56df8, 0x77b046f1, 0xb438548c, 0xdbd5c55e, 0x6b99e508,
+    0x4eeb7112, 0xb57d2937, 0x093f1abd, 0xd11bf825, 0xb2d48286, 0xdf268af4, 0x8992e32f, 0xd69ac52d, 0x080b8b83,
+    0xf5670e9b, 0x56b5a24d, 0x182b5997, 0x0dca7d0d, 0xe1b0190f, 0x5f1f502a, 0xee38b535, 0xd3ea797a, 0x6815e21a,
+    0xff7b1dae, 0x65f91298, 0x3ae5e499, 0x78a0b966, 0x7c9ca698, 0x956309ff, 0x3826e65b, 0xb7c35a56, 0x2d8ea8e8,
+    0xcb821fef, 0x6c161fd9, 0x3dd1ba7a, 0xe65863f3, 0x4354cd5c, 0x4cb35ae2, 0x463a9d20, 0x23cb5fc0, 0xd270acbb,
+    0x27bfbb45, 0x8d5bbdd4, 0x22197d28, 0x20cdd2e1, 0x17f4e302, 0x2548e947, 0x45dba9ef, 0xa7e93f87, 0x49e9504c,
+    0xd9f51eef, 0xababca16, 0x6fbb6b3c, 0x9d8a620d, 0x5a35d0e1, 0x44837b30, 0x4aeec0d3, 0xc3bab222, 0xd2e92983,
+    0xbf21f594, 0x648f5bd8, 0x4a7800db, 0x321fecd8, 0x9764ad0b, 0xac53277a, 0xda90fc1d, 0x31bd9317, 0xcccacf00,
+    0x89617f82, 0xce12a594, 0x0df1d2ec, 0xa1802d82, 0x9edc7167, 0x048c344c, 0x0223481b, 0xef068c27, 0x10c0209f,
+    0xbfd222f5, 0xba68ca7f, 0x6cacfc02, 0xef38d5ae, 0xab183b5c, 0xa1e50bc3, 0xd122f3c4, 0x38b1f285, 0xee34a1fc,
+    0xffa697d5, 0x117df807, 0xada60451, 0x27a30d0e, 0x6c817fea, 0xf29b4b99, 0x2110560d, 0x5a9b561a, 0x8851df45,
+    0x5ef56f94, 0xb87397bf, 0x0f5f6e89, 0x1adff3d9, 0x8a3da693, 0xd4fed11b, 0xd0d74d9d, 0x032eef38, 0x27e1d491,
+    0xee7598b7, 0x7d06c2d9, 0xf7f84d82, 0xc4343df9, 0x5f877025, 0xbe329dae, 0xf7488fe6, 0xbe0aed4f, 0xd70efd1b,
+    0x6e3d905b, 0xe8dac8d2, 0xa8235302, 0xf81a94aa, 0x5fe70cad, 0x6bfd2ba2, 0x626eb086, 0x65da6d96, 0xfb13158d,
+    0x4517d2ba, 0x8086a0e5, 0x5f7220f6, 0x60ca0a40, 0x69433587, 0xcb948a32, 0xea0417ab, 0x9f371090, 0xe97d3476,
+    0x8f441b1f, 0xc449221e, 0x30cd15a8, 0x1e0faae2, 0x01273c04, 0x01dcede4, 0x44dff8c1, 0x185f7fc8, 0x2c04475b,
+    0xa1c6c3d2, 0x25699ce2, 0x07874266, 0x8ded172a, 0xed9e2c4c, 0x28540f9e, 0xa7ad784c, 0xe8ff66c7, 0x63922747,
+    0x57c28eba, 0xe2aef5d7, 0x145337cd, 0x0f7d2a82, 0x4d7d49e3, 0x155956e2, 0x171b23b4, 0xab60e697, 0x705816ab,
+    0x102c9344, 0x2d74de8f, 0x7e6f12ee, 0xd4a069ea, 0x8c4215d9, 0xb9c41f27, 0xfe7b4c8e, 0xa3f53f4a, 0xee5d8482,
+    0x50c25f7f, 0x15760ba3, 0xc826d155, 0xfcaecae0, 0x7defcddc, 0x47e1e6dc, 0x482b40d4, 0x54b5e129, 0x2cff2ea8,
+    0x7ed7e7e1, 0x4edf8245, 0x892161f9, 0x79eae598, 0xd8842b47, 0x78b2507c, 0x520267cc, 0xbf80e74d, 0x0a12d048,
+    0x39e74e76, 0xa6423b86, 0x3abc2009, 0x9507b4d1, 0x870cfd05, 0x4dd993d9, 0x337fa308, 0xbe4b3bb0, 0xbc7cad2b,
+    0x562fa2f3, 0x18328539, 0x8ce3291c, 0x362c236f, 0x6f41cafe, 0x91d12226, 0x5ca01ada, 0xb88b2f28, 0xda6828cc,
+    0xb3a4f8a3, 0xc632b35e, 0xcb506596, 0x79432d62, 0xd84df17b, 0x6c410374, 0xe763e091, 0xef7be902, 0xd7a2e6bf,
+    0x32ebc17a, 0x482e18f8, 0x76c9835c, 0x26da1080, 0xf6410478, 0xb10f210c, 0xd74a46a9, 0x0b75fd42, 0x5883dd76,
+    0x5f8c6c14, 0x06dd947f, 0x8728b42d, 0xbb57442c, 0x82f9d29b, 0x995d009b, 0x65f09012, 0x312c5ccf, 0x5e03d740,
+    0x75237e5c, 0x5a30ac27, 0x8cdf6b01, 0xa06bfee1, 0x951576cb, 0xcaa0812b, 0xe8ca6a05, 0x356ee980, 0x5ea7b1a4,
+    0xfe7f68e1, 0xd5e17d29, 0x07e6b021, 0xdeba161f, 0xb65432b5, 0x61c19cda, 0x58dd3ef1, 0xf556439b, 0x2f0e208a,
+    0x8d759485, 0xb74e7bc4, 0xe213afe5, 0x88d8620c, 0x99c2e7b5, 0xd51f33da, 0xbe09eb17, 0x06b939fc, 0x77785e2c,
+    0xc02625e5, 0xa786b292, 0xcf97e87c, 0x2b885199, 0x38a5a231, 0x66dfe7e1, 0xf4d09d98, 0x625747fc, 0xb2d8a461,
+    0x409e8b6b, 0x274d8d84, 0xfc14f31b, 0x86b32ed8, 0x5318da8c, 0xbb49e066, 0x9e18ef68, 0x1ce1ef2c, 0xf872e754,
+    0xa8a0e991, 0x80333b16, 0xd789f225, 0x23132001, 0xb630d736, 0xc9b78b49, 0x23233d98, 0x86ddd404, 0xadd69ddf,
+    0x2d155f73, 0xb4d29639, 0x6f479792, 0x24e04b6e, 0x651cc466, 0xd37bec23, 0xb70048e9, 0x901dbfc2, 0xfe1c7925,
+    0x88058790, 0xc553c85e, 0xedd0ceac, 0x3a9cb08c, 0x7e956320, 0xaa753469, 0xbc5e6e60, 0x6d8fe162, 0xd8fb6e27,
+    0x5c724e90, 0xa481d24f, 0xccd73b79, 0x5e8a7adf, 0x0178e04e, 0xd5e9857b, 0x20aea369, 0x75d3ac2a, 0x05f2be02,
+    0x23189b56, 0xb8815746, 0xd4049e5e, 0xb5607ab0, 0x0d914800, 0x59dac230, 0x9409820d, 0x71655e35, 0x99177b9a,
+    0x20451443, 0x7db8caf0, 0x6c66ebf0, 0x8b72484b, 0x343ff80c, 0xe8b3308b, 0x5763f9e3, 0x2ab7c4eb, 0xa0db2c83,
+    0x378e300b, 0x5ba9ca40, 0x3bbb7851, 0x916a8223, 0x56463766, 0x91114420, 0xc6c8674a, 0x4882cccc, 0x1d914c6a,
+    0xf5a5464e, 0x5b8af1a0, 0x8f58b319, 0x9de93c29, 0xd941f10c, 0xd6b0842f, 0x4ad322b5, 0xe6491958, 0xfefa4151,
+    0x4d8ffb75, 0xb05196ff, 0xc4e00234, 0x1f21838e, 0x69549e9d, 0x0f334dd1, 0x78b96971, 0x0816eeda, 0x92ea0c08,
+    0x41d3389d, 0xfaa934f4, 0xff515dde, 0x1f34ca6b, 0x77af3704, 0x3a5707a1, 0xc5a26db6, 0x80e8449f, 0x256393c0,
+    0x0a7da6d8, 0x61eff00e, 0xa55b044a, 0x208d0f81, 0x69448751, 0xfd7cb042, 0x3ac82bcc, 0xd42f252d, 0x177a792c,
+    0x150be4df, 0xb2cfc031, 0xbf247a06, 0x997975cf, 0x8db2c79e, 0x7a5cff5a, 0x15ace551, 0xe9cdb1b5, 0x0937d109,
+    0x4dc0eb43, 0xab120938, 0x55b5d214, 0xcca8b4c0, 0x99ab0e51, 0xfbd6423d, 0xd4ef729b, 0xcb09dadb, 0x3a19aa67,
+    0xb948af6a, 0xff064758, 0x0a2f4f9b, 0x435a1272, 0xcce37fdb, 0x1c1d1c73, 0xc5db2115, 0x2d3dd677, 0xb6354160,
+    0x81dba5f2, 0x0a607d94, 0xfa659f8d, 0x86efe085, 0xe0a654fc, 0x4724c0e8, 0xe6464853, 0x59ce88f4, 0x5a002a06,
+    0xa8857d13, 0x2074b008, 0xf5e08f3a, 0x609d059c, 0x8ed9d834, 0xdf4ae456, 0xe51eb4c3, 0x81408433, 0xcca2157e,
+    0x964ec4ad, 0x34f62bfb, 0xb2ac8763, 0x763be27b, 0x39217608, 0xf9609a89, 0xe7efc1cd, 0xf6d7b5e1, 0x5f7a295d,
+    0x70885621, 0x8fef74e0, 0x3cc3e941, 0x6e3e43c1, 0xfdef73ca, 0x5aeab6be, 0x027e4376, 0x4067fc71, 0x2a4069c3,
+    0xd80e4744, 0xd240d9e8, 0x0a48521b, 0x4ed8c8a9, 0xc31efca5, 0x5f5a66e8, 0xe338bf0c, 0x58cbdc49, 0x65c50ea1,
+    0x76e32b64, 0x485f2b0b, 0x95836f9f, 0x3f027a24, 0x48b877a2, 0x617632fe, 0xb02f0bf8, 0x3b8dc44d, 0x184b2d85,
+    0x445cf73a, 0x870dc9ec, 0x30c24397, 0x5624c2e4, 0x2b932e8e, 0x3f6c744d, 0x7a47e6ee, 0x8fe97ad6, 0x8827553d,
+    0x725be1fe, 0x3fed7731, 0xce6101e6, 0xdf0bb54b, 0xfa57098f, 0x27fa4278, 0x33c53144, 0xa4bd4d86, 0xe8538e30,
+    0xbe16712c, 0xa9980b3d, 0x5c39c0e3, 0xfc950ef3, 0xd842bec5, 0xa55ad639, 0x136af852, 0xebaea8ea, 0x7eec81fd,
+    0xbeff5245, 0xe4fb64b7, 0xe43d8354, 0x9639e3a5, 0x3d78ab43, 0xb929f900, 0x6c5c7288, 0xde64a1a4, 0xff5487f3,
+    0x30be6668, 0x1e22c0cc, 0x21f9676b, 0x57916c63, 0x3f6c2d29, 0x046efbd1, 0xd0f1d5b4, 0xbfa8bd11, 0x28df949c,
+    0x8acc5dc4, 0x96b80255, 0x7c00991c, 0x5c44c5e0, 0x8d962c84, 0xca6f8374, 0x1b1190dd, 0x83586747, 0x59602260,
+    0x1ba0fe8e, 0x105f0613, 0x2baac676, 0xe4dacc54, 0xb91826e3, 0xff733967, 0x5c74c63c, 0x9aff5d91, 0x92f52a88,
+    0xc61f0c79, 0xb45cf009, 0x044c26ef, 0xbbf9a9cb, 0x37bb6ea0, 0xffe9cf08, 0xc845a289, 0x61f04957, 0xf6d6e4a5,
+    0x8c866571, 0xba3d3ffe, 0xa52226ab, 0x4451128b, 0x05888378, 0xaae18e0e, 0x52cdd79c, 0xfa1f974f, 0xcf93b2cd,
+    0xcf841542, 0x47f8c566, 0x28091e1e, 0xe95fea15, 0xc0f39696, 0x9fb7b300, 0x9702af6b, 0x653f5857, 0x2c9a45e9,
+    0xed4a711c, 0x53cda8d0, 0x00138cb5, 0x9b827cb5, 0x9aeb4266, 0x259d24a8, 0xceaadd33, 0xd3e1949a, 0x95921f75,
+    0x7fc34d9b, 0xa56bd262, 0x7d87c38e, 0x90ece0f9, 0x64d5ab44, 0xb797e0a6, 0x57eebce5, 0xf74872b9, 0x3d6ca62b,
+    0x1b6befd8, 0xae3901e3, 0xf0a40290, 0xcc4b842d, 0x49375969, 0x5f17c21e, 0x3096bded, 0xa0353acd, 0xa10fc7ef,
+    0x7c595dba, 0x959a5c9d, 0xb9310369, 0x9d96c26d, 0xea707d64, 0x67aed083, 0x7fe073fa, 0xd91c912f, 0xce46bac2,
+    0x428317fa, 0xbdaccb32, 0x4e3680a6, 0x936eca3a, 0xb5a79bb9, 0xa2ba82af, 0x11cde27d, 0xd7b674dc, 0xf246d333,
+    0x963e1e0a, 0x0d33f6d4, 0x7850b554, 0x9cbed5d7, 0x88ebceda, 0xad547214, 0xed0d37a7, 0x318db4f4, 0x62869aef,
+    0x4242e9d5, 0xef282adc, 0x07fc9b62, 0x105d67df, 0xefa713de, 0x188ade61, 0x46ad9fc1, 0xd1fcefba, 0xad929ec6,
+    0xc4b54f03, 0x9d732b79, 0x367562f4, 0x70c5880f, 0x7d529a7c, 0x1dcdbc43, 0x7cc55300, 0x48bb883f, 0x1ca7cfe2,
+    0x3b9a32f9, 0xead22b69, 0x3370d10f, 0x09890e47, 0x20146350, 0x81bc4c6b, 0x76975a7b, 0x72b79f3f, 0x17d7f19b,
+    0x9a1d4c73, 0x57aaff9f, 0x736ea0c0, 0x31371109, 0x5e71dc89, 0xa4cafccf, 0xec451dd2, 0x6f18a1da, 0x98f6e00b,
+    0xf3cbf816, 0x4504288e, 0xae83325b, 0x5b069460, 0xfde9e168, 0xb6b6f681, 0xac36692e, 0x91a3677f, 0x8fafc2bc,
+    0xc06f8b69, 0x04c2bce9, 0xcab2b531, 0x869b4511, 0x0db4776a, 0x8f6d8814, 0x6b15f546, 0xd4523432, 0x8496ac1e,
+    0x0f10c74c, 0x8dccb619, 0x71fae047, 0x50d95475, 0xcfd51599, 0x4d2fc0a6, 0x75fb76da, 0x15667084, 0x7a86cec5,
+    0x6ca6ec9b, 0x6f2ffc2f, 0x2145ce60, 0xaf6b2559, 0xbb4bfabb, 0x6e4877ef, 0x32b2a196, 0x9b0d8a5f, 0x09749250,
+    0x65b4dab2, 0x2d0a0f6f, 0x6e599146, 0x7845fd3e, 0x38a491f3, 0x2cc8c88d, 0xf86ab822, 0x8cf424bf, 0x9fcb01b0,
+    0x71982069, 0x57a139c4, 0xa81a6739, 0xf97211b0, 0x0ea5a45e, 0xb625e8cd, 0x8988aae8, 0x92b04517, 0x38a23c70,
+    0x7689f9b0, 0xcd558181, 0x54da69de, 0x646c729a, 0x9bbf3aa5, 0x392a2708, 0x3cf6c78a, 0x1895ebf0, 0xb4052574,
+    0x179faa49, 0xce1948fb, 0xcd4eed0a, 0xa951c5a2, 0xaf58366e, 0xf8e44245, 0x6af91341, 0x086a14d4, 0xb27895ae,
+    0x68b8e6f8, 0xe6449f4b, 0x5972f126, 0x8f15dba1, 0x077d32e6, 0x7f3b3b8e, 0x6521b928, 0x4c8e8514, 0x803b16f9,
+    0xfd5f429f, 0x1df8efc9, 0x69260f8a, 0xc1ab4c13, 0xa638c801, 0xe73e547e, 0x8c69ea0e, 0x22da2a99, 0xfccac0bb,
+    0x6479d13a, 0x5fd0793c, 0x2aae0197, 0x85052df3, 0x5f9fc3c4, 0xb115c0f8, 0xa5925102, 0x5fc5286b, 0xa8c1fd28,
+    0x2a159fae, 0xc8cb8363, 0x6ce0861a, 0x2ac6ee8a, 0xf3d9d6cf, 0xb489cc03, 0xdf2195fe, 0x039fb959, 0x7917f3aa,
+    0xf58229e1, 0xefd01297, 0xebc3e914, 0x2a1c93a7, 0x6b26283b, 0x8dd2020c, 0x6903a93f, 0xc9468f11, 0xb891291b,
+    0x06bb3070, 0x83d7cfbd, 0x88b56cb6, 0x7d798032, 0xea2065ba, 0xcc177651, 0xc1ad83fa, 0xd4c28c15, 0x9b79a716,
+    0x7c4665bd, 0xe4b4f97c, 0x7577361f, 0x5487955e, 0x8a58358d, 0x33c2ce54, 0x72ca6e2b, 0x1a6aef32, 0x1b0d9480,
+    0x9a92aa64, 0xef3de55f, 0xfe813458, 0x77703591, 0xf6f085af, 0xb33f8d27, 0x58bcf0dd, 0x222f0f70, 0x6c7e889f,
+    0xeb2658db, 0x3dfc5f99, 0xbdf79e35, 0x03ca3f38, 0xe9979860, 0xe5004d66, 0xb92ec371, 0x34689b66, 0x5d8e9f3d,
+    0x3722e4e2, 0xeb37d518, 0x38a40e07, 0x1a1eaeb1, 0xda6de347, 0xb0e166e6, 0xbbcaba40, 0xac8ec74b, 0x453614ec,
+    0x5f6a4421, 0x271266d0, 0xe9e8e984, 0xf7b1e455, 0x4ea86414, 0xe8106465, 0xaf205ff9, 0x1c956beb, 0x1bb38964,
+    0xfce32a4d, 0x019521b6, 0x60e85d29, 0xb20d7139, 0x678eac49, 0xea4ba891, 0x41ba2b5f, 0x79d032f7, 0x97c9ff67,
+    0x89a6af1e, 0xf6d8c522, 0xc0818207, 0x07165f41, 0xc89421f1, 0x2e39d388, 0x816756c5, 0x647b0943, 0xacd22cac,
+    0x46293d68, 0x6db23907, 0xec311e56, 0xdf0149b8, 0xed0d9e40, 0xbba8f7ae, 0xa0cf96dc, 0x87f8e816, 0x4b8ba2f6,
+    0x9e031bbb, 0xa012a393, 0xa0f7fd74, 0x68811499, 0x98212a57, 0x9ec705ed, 0x64e68bd4, 0xf850e677, 0x49cfde4b,
+    0x54291461, 0x2e65fb91, 0xc308a579, 0x0cc16092, 0xee15dc1c, 0x47e010a6, 0x6cb57440, 0x68bdf48a, 0x8caf1f87,
+    0x3664c7d2, 0x07ccdfac, 0xea5b5a4e, 0x4b250991, 0x93189bf7, 0x56572c2a, 0xb7a8bec8, 0x2d13e7af, 0x289717e4,
+    0xe0e3f2e3, 0x91603dc7, 0xb117ca8a, 0xb9b2e6ba, 0x79ab3ed5, 0x51c09fe3, 0xf86decc8, 0xadca69b9, 0xbe82872f,
+    0xd9fad42a, 0x89a18536, 0x65b7dace, 0x1ae34809, 0x0657ab58, 0x2773e184, 0x8949a706, 0xf6a85175, 0x313eb5b9,
+    0x49275440, 0x39f7c43c, 0x14699884, 0xde4ec94b, 0x3a0ed21a, 0x27e6ee75, 0x4c53613e, 0x67906808, 0x7f7149a3,
+    0x94091829, 0x95262190, 0x32bb97c1, 0x8982f3c3, 0xecc98f5f, 0xfca8a7fb, 0xfe737921, 0x2c343e9b, 0x22f71244,
+    0x16ffadb6, 0x1cca8759, 0x86eee041, 0x088bf553, 0x1986de3d, 0x18a64924, 0xdb3bf17b, 0x1e4d57a6, 0x75631bf2,
+    0x59bc4ebb, 0x818e814c, 0x1538149c, 0x1b4a0b55, 0xd5349e2c, 0x9f82fb2b, 0x7a728025, 0xc467d790, 0x9669b4c1,
+    0x4c53ccbc, 0x0d078639, 0x22337d2b, 0x5a11e743, 0x3a3fa8d9, 0x10a4ce9d, 0x641f41d9, 0xad779394, 0x1477816e,
+    0x5b91cde5, 0xdc83ea6c, 0xa10c56e8, 0x7bf32d2b, 0xeba3b195, 0xc7874fcc, 0x8ba0ce89, 0xb61c338f, 0x44810e96,
+    0xfcf512f6, 0x02eb6ac6, 0xc0077faa, 0xa556d93a, 0x0695981c, 0x0801e78f, 0x815dcc3b, 0x14e35d73, 0x7cd136be,
+    0xe4bfd515, 0x64f3bf43, 0x26ed6006, 0xb3484e1f, 0x7c245d29, 0xc6509265, 0x9383b76f, 0x012d968a, 0xe5b108fd,
+    0xf8bde1aa, 0x1e38ae69, 0xcbee5c45, 0xc5596ea9, 0xbf7ff53e, 0xe567d354, 0x22a2d250, 0x5ef4f712, 0xbcdbc4e1,
+    0x81b997e5, 0xd9a73b22, 0xab736069, 0xc20c2bba, 0x6efccf2f, 0x47234c65, 0xe6bb6410, 0x7e77207b, 0x32807060,
+    0xfaa67aee, 0xd8ac176c, 0xcb56ab63, 0x91a467c8, 0xeea09e70, 0x571c6b4a, 0x4fa83bfa, 0xd7dafc7f, 0x4f04d856,
+    0xde595cb3, 0x2695c50e, 0x211dcb00, 0x436e6c1a, 0xeb494a70, 0x5d7cd910, 0x8bc01ee0, 0xcc58c000, 0xe431a679,
+    0xa3401b0d, 0x79dc14c6, 0xf67abd5c, 0x52fe050b, 0x78c90777, 0x015cd7e7, 0x6d891093, 0x89ff8ed6, 0xc83b64e0,
+    0x51c7f972, 0xbb715ddb, 0x83bb3ed6, 0xa0bf1d27, 0x056538e0, 0x2f40e777, 0x561f3f07, 0xfd0b83ee, 0xa3c999f8,
+    0xd878121c, 0x32147991, 0x5fd27e3d, 0xcfc9c2a5, 0xf20b94b3, 0xcd0af9d2, 0x42372258, 0xe0ecd28a, 0x542e31f9,
+    0x0f19a3a7, 0xa29dc6d2, 0xff2e5c34, 0xb7f6070c, 0x1d9b258b, 0x36d00d32, 0xa1cfc2f2, 0xff081609, 0xd2cdb3c8,
+    0x0ebb69fc, 0x432225e8, 0x16694f8d, 0x9ca2380b, 0x7c6b394a, 0x10498875, 0xe0def286, 0x873d838e, 0xf1c943b5,
+    0x2fa42367, 0x4cec6d76, 0x9fda76b8, 0x2e2e0287, 0xac79e5f7, 0xd8536970, 0xa34c126b, 0xe29415f6, 0xf69b0b17,
+    0x44f3341c, 0x88f65e9c, 0x48f7c3d6, 0x125f7564, 0x997ed4cc, 0xb5c92f39, 0xa825fabf, 0xb108d749, 0x9cd29d95,
+    0xde2b2e2c, 0x0d343e74, 0xbd77b912, 0x3f319dec, 0x0cebbf59, 0x2b836cd3, 0x29ed47e6, 0x379f8a77, 0xf12e55a1,
+    0xb88a9910, 0xb350b050, 0xa68e1eaa, 0xb936d7fb, 0xfde442de, 0x3ef1e452, 0x8a996872, 0x0643aa8e, 0x7f49d5d2,
+    0xdac84d69, 0xde2e2ca8, 0xb960edd6, 0x89004ee1, 0x78cdea5d, 0x09b53547, 0x70e11bb9, 0x32e9fdf7, 0x17890b63,
+    0x37045004, 0x01fe6e71, 0xf2e4686d, 0x5420c748, 0xdbf44963, 0x5eff37fc, 0x051e1a4e, 0xd68d3136, 0x64142a77,
+    0x865130d8, 0x4cf33662, 0xf002d33a, 0xa87dcd05, 0x7d762dfe, 0xda617b5c, 0x7a825520, 0x1eb20486, 0xa268c049,
+    0x7dd204cb, 0x17e4378c, 0x86aa87dd, 0xe68a30b3, 0x383d4336, 0x203677ba, 0x5edc667a, 0x90bcd908, 0x35fbc18c,
+    0xc236860e, 0xff40bbb8, 0xb0a0dd49, 0x0f35163e, 0x060131f2, 0x0391a10a, 0x36202848, 0xc79db493, 0xc2951049,
+    0xadac298b, 0x4388e0ca, 0xe914d29b, 0x723ba919, 0x3f31e0e9, 0x24f8fcfe, 0xbff24410, 0x4b4b725b, 0x0e242bd5,
+    0x4b1d32b4, 0xe5d9fa98, 0x62f7ec95, 0x25340f0a, 0xfdfe9089, 0xd11d7968, 0x600e7377, 0x76148b91, 0x06780c11,
+    0xd5baaf34, 0x6d468c5e, 0xfa4b262b, 0xb101f8e8, 0xdc84bb8e, 0xc98d6e49, 0xbd82c097, 0x0fbf7599, 0x8329fe73,
+    0xff3954a2, 0x4d49c389, 0xb3493920, 0x9a60c33e, 0xbab5fa17, 0xbcb0d8bb, 0x33d90308, 0x971180c2, 0x9c9feaf1,
+    0x0787f532, 0xe331c411, 0x41f362d7, 0x922df75c, 0x0397fc4d, 0x5e65e90c, 0xb7c311c3, 0xd1ce9ea4, 0x56488f8a,
+    0x9650a4cc, 0x86dfd274, 0x447124cf, 0xe0b831c7, 0x0d0ea00d, 0x6a7d8413, 0x9ee08440, 0xa44eece1, 0x725f6a33,
+    0x2e5e614c, 0x1756bc8b, 0x58bee20a, 0x526bf7bd, 0x17c94f64, 0x0ee621f0, 0xa976218f, 0xd7dbbfb9, 0xa4426124,
+    0x0ee3b621, 0xea09d77c, 0x17cd7c67, 0x41433904, 0xd23571dd, 0xa8ba8839, 0xf87c7ac6, 0x5a69edd5, 0xcc483b0d,
+    0x24cad04a, 0xffa77f3b, 0xad1da4a6, 0x4e590fe4, 0xc455de83, 0x2c846666, 0x94b51530, 0xc76e7f35, 0xe3fd3c37,
+    0xa33b39df, 0xbc7d3afb, 0x8054072f, 0x53293480, 0xa6ef83c8, 0x318b9f51, 0x658b9fca, 0x6c7d7b17, 0x2dcc069e,
+    0x18701e45, 0x790bd4fe, 0xe16688d5, 0x86a048a0, 0x886467e6, 0xd67d33b2, 0x86cb2de8, 0x6bfc4b65, 0xece90955,
+    0x63a8e720, 0xeca3c286, 0x956aeded, 0xbf11107a, 0x281c4675, 0x69207220, 0xcbf7d194, 0xf753b476, 0x6ba3bd78,
+    0x92917eda, 0x2046762a, 0xb27d8cce, 0xf11aff0e, 0x3e8be045, 0x7cf989e0, 0xfda125ea, 0x7a68cdf7, 0xb6c54ae8,
+    0xae479be1, 0x50ab9777, 0xb32abf68, 0xd9a66bb9, 0x7b11906c, 0x34e8df78, 0x2fecac04, 0xe29e1edd, 0xa60b1659,
+    0x3f719d7d, 0xa7798928, 0xba483fa8, 0xa2f915e0, 0xfe12c842, 0x25633ae5, 0x587f457b, 0xf0b95668, 0xcaf1153b,
+    0xbc766a80, 0xc72953ca, 0x723f674c, 0xa125e78f, 0x0f37deaa, 0xf2e43ed9, 0x14aaf86a, 0x80edf05d, 0xbc3b351e,
+    0x31993983, 0x8798ab62, 0xc7880106, 0x04f9a605, 0x2d282d48, 0x43b63cff, 0xf07f39d4, 0x2bfe0fa1, 0x2a933570,
+    0x03d9a268, 0x9b37b614, 0xc787da95, 0x8362b649, 0x0f63a2fb, 0x4303ba82, 0x655664f8, 0x749ac295, 0xcb3837b0,
+    0x4c62ef2e, 0x9e41596c, 0x9a217ff3, 0xd1997b12, 0x722d5bd7, 0xa871f823, 0x81ba921a, 0xb72bb64e, 0x7765eb8d,
+    0x7e27986f, 0x24bb0832, 0xbab6b91c, 0xe195bc71, 0xf5aa2a42, 0xd71c11ec, 0x3b94bfe0, 0x1c8cb805, 0xafab98e3,
+    0x4eb42b73, 0x499781ca, 0x7f335f08, 0x2575279d, 0x2ecd3781, 0xd7867ce4, 0x107070db, 0x6efe376c, 0xc666088e,
+    0x8186f5d3, 0x253d8f12, 0xcea69f06, 0xc8c32500, 0xd4758a09, 0x508b6f47, 0xe8d3ba43, 0xcf1fbcbe, 0x4ee53507,
+    0xb7403f0d, 0x02e03b3c, 0xe556e285, 0xa80c5afe, 0xa4726ddf, 0xb6cd91f4, 0xbafdbac0, 0x6d399fb5, 0x9d990abf,
+    0xbb6df5ab, 0x22716c12, 0x04e9f1f2, 0x6c18c816, 0x02ff2c2b, 0xced645e4, 0x8def711c, 0x0c481d6d, 0x90123196,
+    0xd8220ab1, 0x8ef82770, 0x3761af5c, 0x97b45281, 0xc8a7bebd, 0xd5e01b9a, 0x9dd4bdaf, 0xc64f1f52, 0x401e4cbb,
+    0x4652113c, 0x1c8117c4, 0x3194adf8, 0xe7e323e9, 0x21c3857c, 0x97b57817, 0xf11f0308, 0x840fcd17, 0x6d8a6477,
+    0x798afd9d, 0x750eeff2, 0xecfd776b, 0xf6821b09, 0x7387a359, 0x457b6cc5, 0xb4de1932, 0x7a6a1395, 0x62e0e0b8,
+    0x41a127d0, 0x7e7bf133, 0x34cf227c, 0xc876345c, 0xa2a56bb7, 0x3a44d9cc, 0x1951259f, 0x76941f2c, 0x64318227,
+    0x834e175e, 0xa61d1e18, 0xa537f346, 0x3e06d430, 0x5d51a247, 0x2658c0f7, 0xb5087634, 0x9e565fe0, 0x650d2c7c,
+    0x48f2a04b, 0x8959aa79, 0x4775ac2f, 0x073a7ce2, 0x6e5aff64, 0xbd3fa880, 0x4d1b2fbb, 0xe9ea415f, 0x5a9fcdb2,
+    0x59705818, 0x702ca783, 0xba8c1a1f, 0xfffd68b3, 0x3cdbe437, 0x24f4f767, 0x1500ba82, 0xe1fda9de, 0x5be0fb7a,
+    0x7811d23e, 0xca871f0d, 0xf51d3741, 0xbecd3f93, 0xf3ae1dac, 0x2f0c9991, 0xdb960099, 0x91d86b02, 0xf0b0b053,
+    0x4db19c82, 0x3c7599b4, 0xe87e1157, 0x4f8af2bc, 0x88ceb624, 0x029ae22f, 0x7b10f412, 0x87b4f5aa, 0x9c5b7e4d,
+    0x807c2c99, 0x33330294, 0x48d83cfe, 0x952332fb, 0xb23e71f8, 0x2d4fc6b3, 0x2c5e463f, 0xbd264ce8, 0xfbbf17c8,
+    0xdbfee850, 0xc55d949f, 0x9417ed39, 0xa92ed01c, 0xd5bd5937, 0x19b7a758, 0x4463efd0, 0xee11324e, 0x72dc78a3,
+    0x5fb97f68, 0x77902c78, 0x720618f6, 0x7d5972a9, 0x700818ec, 0xe78d7205, 0xbd195a5c, 0xa153367f, 0xe0cba9f3,
+    0xd9701ea7, 0x62d6fc60, 0x71e0fa49, 0xc6f2cd26, 0x6cd56471, 0xd5183a63, 0x74f7dbb5, 0x41935aa0, 0x7a6cc46c,
+    0x0ca3ca98, 0x653baa88, 0x92b0b7b4, 0x0e5ff9a8, 0x029b628e, 0xc12819cf, 0xf5410a43, 0xcaf33f7d, 0x7d7f6bbc,
+    0xc99f02c1, 0x3b3954fe, 0x77bbd568, 0xc13111c4, 0x01808830, 0xe6f5f063, 0x6c13de3b, 0x52c5322b, 0xb136619a,
+    0x7163eb23, 0xc5eb08eb, 0x09cdb630, 0xf1e4f364, 0x465ede0f, 0x45196e5c, 0xdf10f0d1, 0x4e19c867, 0xe25b82e7,
+    0x999ed759, 0x003cc6f4, 0x8224e9a6, 0x01bcd24f, 0xfa40996c, 0xadd72bdd, 0xf1fc5007, 0x89777187, 0x87b94727,
+    0xebbef147, 0x4c1dcaa1, 0x7bec5f64, 0xc4ab4507, 0xc0513cb4, 0xf1eb6a8e, 0x0a6bb9c8, 0x44231228, 0x8ac4353d,
+    0x8a3773bc, 0xd769323d, 0x8b9649a7, 0x44dd4b16, 0x9c2ee972, 0x743fc455, 0xfba4b797, 0x178fc642, 0x53dcd227,
+    0xf2772a91, 0x167c0264, 0x9c71177d, 0x9e6cd4be, 0x3a4c26c8, 0xb83f78f3, 0x04c61f80, 0xc600bb86, 0xbeb95517,
+    0xc42248f7, 0x30e5bc27, 0xd2661c49, 0xb22d79a0, 0x985a6749, 0xc024801b, 0x12f1c4ed, 0xe2b2da79, 0x753dd5ad,
+    0x668243e6, 0xcefdf204, 0x546a764e, 0x17fd987e, 0x32b54a38, 0xb41d657c, 0x9c12da79, 0x49c8fcc7, 0xe8a5fbcf,
+    0x181cfc22, 0x9ffa6d34, 0x6ee64f32, 0xbb67eecf, 0x8072c830, 0x6ef3ec26, 0xb3527b62, 0x646a1982, 0x8c8dc12e,
+    0x5dca3e73, 0xd7cd86d4, 0xc795cac4, 0xbfca60e4, 0xd57dd5c7, 0xbaec88e2, 0xd2aba192, 0x76186d0e, 0x369f4aed,
+    0xd36cdf31, 0x9f6fc12e, 0xb7e82eff, 0x4198fc3d, 0x25645afe, 0x911dad43, 0xef5b7149, 0xcf08879a, 0x7ad75939,
+    0x50a72886, 0x40fe6856, 0xdd474414, 0x2009b442, 0x4ff20933, 0x8adabb5d, 0xdeff9b38, 0xaddac17c, 0x8ca15027,
+    0x95f30b3c, 0x4b6a2c52, 0x6eb23a2d, 0xa43a9a83, 0x9766ca81, 0x0e4acc77, 0xdfb92890, 0xd5431e45, 0x89bcf021,
+    0xae605490, 0x89378ac6, 0x2641452c, 0x4d125105, 0x9a01e5ec, 0x7519c5a4, 0x394987de, 0x5fa43918, 0x6224c736,
+    0x61573329, 0xad008cc1, 0xca534d5f, 0x833e1bbf, 0xfee3098f, 0xe95df663, 0x825a7964, 0x3e07b403, 0x56279bec,
+    0x0d38999b, 0x85bd58cb, 0x4516c02f, 0x77b972a7, 0x2766bc7f, 0xb532c24a, 0xd017d29b, 0x605d0524, 0xc42d39f2,
+    0xbad4e1ae, 0x3ccf2a96, 0xf1d99708, 0x1a44adfb, 0x50befac8, 0x21ea275a, 0x45f019cf, 0x97cbdf71, 0xc9cafdb4,
+    0xfe2dae26, 0xb7e0f20f, 0x4fd62804, 0xf9420e5e, 0xef95ce26, 0x7e2677c1, 0xb95dd44b, 0x41c76aa2, 0xe88b85f7,
+    0x32bffa06, 0x1cc59e63, 0x4479cf32, 0xc7ca0b78, 0xd432efa7, 0x61b7a36d, 0x2ff48e58, 0x8f1d4a29, 0xaa5400c9,
+    0x30bd355f, 0xccdbba0c, 0x690dc218, 0xfe9f00b7, 0x1ba6b43e, 0x0d02d29a, 0xde5e14c9, 0xd9d5f874, 0x95c3fd68,
+    0x2e1324fe, 0xe924fc7a, 0xcc65ca7a, 0x120207e0, 0x54001b5a, 0x0dbf310f, 0x3a6d33ae, 0xf35c0af4, 0x6be2c6b8,
+    0x603c0adf, 0x06d35650, 0xa9c269af, 0xba2001d4, 0x80b93bc0, 0x13df7496, 0x56f751ef, 0xd84666d1, 0x85fe2b34,
+    0x2d50ea34, 0x0d32c814, 0x2f68e238, 0x3c8fb40c, 0x0fba4794, 0x2c84da7e, 0x47a88b65, 0x0e2edf8e, 0x4401b165,
+    0x870d094a, 0x15a3f849, 0x8c8f48a5, 0x13cdad67, 0xb591eebc, 0x7af64068, 0xc64b8d5a, 0x9e351697, 0x8f49c6b9,
+    0xc141ba9c, 0x3e11df1b, 0x5068c8b9, 0x877ed039, 0x06f4cffa, 0x0b317fa0, 0x366c7b23, 0x8cdcdd92, 0x6761e3fb,
+    0x506512d3, 0x28f3fb14, 0x7476df74, 0xdcbce131, 0x6289fe6c, 0x1c11cb85, 0x4eee5e75, 0xaf39d0cd, 0x3d7846d0,
+    0x66808c95, 0x7fb1bc81, 0x924613ca, 0xe47b8cdd, 0xdff1a0f2, 0x791ded22, 0x8d275dd2, 0xcefd448a, 0xce29949d,
+    0xd6e666e6, 0x84e045e7, 0xfef0da96, 0xaa63ef09, 0x96e4a0a5, 0xc94f6c09, 0x94495110, 0xdbd65dfb, 0x180d96c1,
+    0x68fde5c3, 0x2a0e2d0c, 0xaf3e8c65, 0x2ed3d0ad, 0xf0b3dc8d, 0x770fc3c2, 0x01ec58f3, 0xf8d86004, 0x46128efb,
+    0x43791198, 0xf6869d59, 0x3c351ce4, 0xb2c4606a, 0x3fa5fa03, 0xdb3efef0, 0x9bda4a28, 0x7f68fbbc, 0x0382c823,
+    0xf6cae51c, 0xd5fbd753, 0x7eb4ff13, 0x64f41504, 0x5020cfad, 0x27e94edf, 0x89d0c12c, 0x00947122, 0xc7a159db,
+    0x6ae895fc, 0xc1afa03d, 0x418bc01e, 0x19cab911, 0xcd591e12, 0xe4edfa6e, 0x5f2a30ee, 0x7f434c59, 0x2bee3d34,
+    0xfc680bde, 0x7472effd, 0x8b44453a, 0x7a582961, 0xbaaeaa76, 0x0de1f3e6, 0xe0643e29, 0x623e576f, 0x9c802e68,
+    0x2c159e68, 0xe9137e51, 0x8d20fcc2, 0x26af0efe, 0x9d8ae888, 0x67051077, 0x3dc2a04d, 0x3573a0d3, 0x1b69613b,
+    0xcfb27c3f, 0x36c56574, 0x2b670478, 0x8bafaff3, 0xab675dea, 0xf9c21958, 0x84f40c97, 0x00092c80, 0xa1a514ec,
+    0x6de60337, 0xc9ff8aec, 0x9faa8849, 0x700af696, 0xc40a9d44, 0x76bd4aae, 0x975030cb, 0x6d1e7ca4, 0x018398c5,
+    0xcdbb100a, 0x486483b9, 0x7796b44b, 0x79cdcbcf, 0x27b8f6a0, 0x793d030d, 0xdff37fce, 0x5e08adad, 0x7ef304c8,
+    0xc469fff9, 0xac0648c3, 0x2c3840a0, 0xbcf6ff67, 0xfdead478, 0x5b740ea9, 0x53f565b1, 0x1f264067, 0xe5efb3bc,
+    0x389a04ab, 0xb8ae7eab, 0x16efc4a9, 0xf2c993f3, 0xf8896a51, 0x9c8577a2, 0x21353fee, 0xd81f4a0a, 0xf93a74a7,
+    0xca993f14, 0xc1100a6e, 0x905a2468, 0x3b957d33, 0x908c9737, 0xb7d9f6da, 0x8e74abd4, 0x9ec8c8ff, 0xbe42b662,
+    0x0a460b1b, 0x7770b907, 0x6f4189b6, 0x20e8b659, 0x2b5257f8, 0x4b072181, 0x5b2ecdee, 0x486e7cac, 0x890a50b8,
+    0xe6d1ace3, 0x7a844cdd, 0x974e63c2, 0xe018583c, 0x88082f5c, 0x9cad3e69, 0x234bf447, 0xa5f4ecc7, 0x5f365a29,
+    0x8b5f6769, 0x6766fc34, 0xa6fa7b9f, 0x38f27525, 0x102ab66d, 0x7c56259b, 0x340c0889, 0xe7c0fcc8, 0x72dcbcbd,
+    0x33451580, 0x5d97236c, 0x4be1b818, 0x7d2fe431, 0x18ae2244, 0x97c24dec, 0x3139e0f4, 0x6c76e288, 0x88665370,
+    0xc95b1b47, 0x8c453130, 0x4e5044f5, 0x24099de6, 0x8237c3ec, 0x40448c5a, 0x8b1e817f, 0x3acb38f9, 0xb84ed1f0,
+    0x554d5303, 0x34a56776, 0x147407e8, 0xe6aaa776, 0xae4f3d84, 0x74ab9ac4, 0x7c750cba, 0x224cc04d, 0x5b1f388f,
+    0x9e40b066, 0xbf6628f8, 0xcb75ceba, 0x2dd2d04e, 0x22f0fd65, 0x6a96b119, 0x6038450a, 0x980a1ade, 0x5d46da87,
+    0x81ab85bf, 0xaee7fd02, 0x79100762, 0xdf1fbc61, 0x6132ac30, 0x53ffdf1d, 0xd03c9a11, 0x57816849, 0xc8d163a9,
+    0x1ae6bb69, 0xf37c9239, 0x20ed88dd, 0xe7ba0c4e, 0x0429be21, 0xac7a51b2, 0xa80f4568, 0x0d183454, 0xf5fee168,
+    0x0c47c477, 0x04cd6250, 0xa4dbbfdf, 0x0f3890eb, 0x37c4f374, 0x519d0264, 0x43dfe547, 0xfb48162b, 0x1a981df1,
+    0xca9ace53, 0xf35bdb81, 0x45a09f0e, 0x0618068a, 0x7f3d8f37, 0xb05eb224, 0xc3e4ce98, 0x6bf4a746, 0xe3fa35db,
+    0xedc1b3bb, 0x6c216592, 0xf92ec821, 0x8d28ea39, 0x625d14f7, 0x71129105, 0x8f81e9f5, 0xa20550ca, 0x02c66388,
+    0x802f61d3, 0x50117435, 0xd5ae8c5a, 0xab478e1f, 0x1e8611d9, 0xfac83677, 0x7ff1ad57, 0xeabdde27, 0x8baade23,
+    0x8f0f51df, 0xd48517c1, 0xd1f32389, 0xf6b8383d, 0xb694adb3, 0x47fe072b, 0xbf0fbc40, 0xadfeaa4a, 0x0592ba9b,
+    0xb8c53dc1, 0x88f4923b, 0xb379070c, 0x5898ba99, 0x0d6e4cc2, 0xfddf451b, 0x4fe5ac1d, 0xe95014ca, 0x36d1ec2f,
+    0x2a5c6de4, 0x0b9e7cbd, 0x86fba736, 0xe1215211, 0xf1d7c2d2, 0x23e692c1, 0xc3b9b1a9, 0x35dc41a4, 0x87221e16,
+    0xec0ad738, 0x91ed49cb, 0x41219d1c, 0xab114130, 0xd786f867, 0xa6e58e57, 0x0fdeaf1b, 0xcbb057fe, 0xc0be5905,
+    0xa9d721e2, 0x3b14ad95, 0x44ab8e51, 0x84c1e441, 0x2aae942a, 0x027261d7, 0x31f79fc6, 0xcb7aa0a4, 0xc5bf881d,
+    0xfecaaf46, 0x01059e02, 0x6ba52007, 0x7aab4a97, 0x4c255a68, 0x83ce96df, 0x4c461976, 0x3498e55f, 0xa1fb5fd0,
+    0xb56160ac, 0xc22eb50a, 0xf57c39be, 0x5bbdd530, 0x4af6f43b, 0x2d629e8d, 0x52092118, 0x794bcdf0, 0xebecc8fb,
+    0xc4f5b9f8, 0xbf80b32e, 0x97a1fcfe, 0x2dfc4bdb, 0x8eaa8760, 0xe0336310, 0xff676f27, 0x176b7ad1, 0x1ccaa490,
+    0x844700f1, 0x65f66d5b, 0xaf80bcd5, 0xd877a8bf, 0x0c5bb52a, 0x12cea584, 0xccc319a3, 0xfd2b4f9d, 0x5901f244,
+    0x893b6226, 0xee478a41, 0x76e6eaaa, 0x3b0835ab, 0xe97b31a6, 0xbde8ab63, 0x3c58ad4c, 0xe9ecd212, 0x7e9a8452,
+    0xb3f36767, 0xd81f4439, 0x5e02a6c6, 0x367ee199, 0x0e14f738, 0xfc1c779c, 0x5b5fca57, 0x494ff678, 0x4c0acd7f,
+    0x7c623723, 0xe8034c3a, 0xf9dc24ba, 0xad05348a, 0x4509bf4c, 0x515dd9d5, 0x12d4d5a3, 0x73889036, 0x39a38bb8,
+    0x6f4bef52, 0x908ce0f1, 0xd55173e2, 0x620a9c92, 0xc9161d4e, 0x08926f6b, 0xa74d8c42, 0x9c5a2f44, 0xc7a70fa8,
+    0xef83e9a7, 0xf42e2d58, 0xa5684db8, 0xb68d8200, 0x3b16ff75, 0x1c52477f, 0x55b27fc0, 0x7efc0047, 0xd95bb883,
+    0xb0c839d1, 0x5add869c, 0xfa144709, 0x7ddc56e6, 0x3cff8a4a, 0x28944bc0, 0x686a029a, 0x43ff5a09, 0xedc45d94,
+    0x0bd36245, 0x64286ed3, 0x0b737639, 0x43668ba7, 0xd93e1852, 0x02b0c332, 0x844c3d02, 0x2b1073af, 0x0ffaf7c3,
+    0x9c97bcda, 0x5cebafce, 0xdca60794, 0x6173303d, 0xa442badf, 0xccf3fc54, 0x991cf7db, 0x4e67a9ad, 0x0c1f8e2d,
+    0x56b30b34, 0xcc5123a9, 0xdf6622e0, 0x9937d35b, 0x3f6dd7bb, 0x8ce0864b, 0x69c17091, 0xa7df49d0, 0x33303256,
+    0x9f0d0ba1, 0x4a513618, 0x24c93ff6, 0xa7484fa0, 0xad684b84, 0x42402c2e, 0x28fafa2a, 0x76ed2da1, 0x98d6fcc8,
+    0xbfe8f553, 0xee86c46b, 0x33e8a20a, 0xf45c3eef, 0x6dc09e9a, 0x878e15b9, 0xb057f926, 0x14023ad0, 0x5599455f,
+    0x7d353f97, 0xb5fa798e, 0x6f920135, 0x5c51a8d9, 0x43698840, 0x5150a3c2, 0x91c881d2, 0x93daf015, 0x2c2c7095,
+    0x928a4e83, 0x262722c9, 0x37d4928c, 0x32865181, 0x32d143c0, 0xcd2de9a9, 0xc80fa486, 0xe103aafb, 0xc2461c6f,
+    0x8ecb0cb9, 0x8ef1948d, 0xa31d4863, 0xada62a38, 0x9a7e9a89, 0xe81f0fd8, 0x73457401, 0x83fe2a28, 0x4edc6c8c,
+    0xa3396305, 0xbc5c9fa9, 0x0b20f3d2, 0x4ceb3ed4, 0x4988890a, 0xb146cb25, 0xfb87d767, 0x2c8322aa, 0x5c9def78,
+    0x034dd196, 0x2655950b, 0x89327702, 0x4c4950f1, 0x68e92ed0, 0x6be51a35, 0x091ee2ad, 0xb7b23487, 0xeb18a132,
+    0xbe7883a5, 0x23083470, 0xff83d94f, 0xc9f14bd3, 0x8bf09fc3, 0xa26fd227, 0x8aaa7d6c, 0xe19a2531, 0xc8648271,
+    0xb3f477b6, 0x43f76de8, 0x280f15ef, 0xd7b629ef, 0x5f4031b5, 0x9c0cbc28, 0x5e3b6dfd, 0xf1ad74f5, 0x773e6ae4,
+    0xc0edc9f4, 0x41b0bff2, 0xcb2cb54d, 0x15f5a303, 0xf87066e6, 0x5f4e7d0c, 0xd84b07ea, 0xb1e44adb, 0xb83e9d12,
+    0x7efd6375, 0x7817c4bd, 0x9f61c189, 0x4bc280fa, 0xb8a4dbb7, 0x61c53ad7, 0xb39b9551, 0x2503e7a0, 0x83bb91cb,
+    0x3b34fcb4, 0x2fc4aeec, 0xbdf8a38d, 0xa5999c6b, 0x9115153f, 0x4b8c8375, 0x2e4355dd, 0x2d56fc6f, 0xa2c7bfb3,
+    0xca3d3157, 0xd6523937, 0xa8628a5c, 0x5f61cb30, 0x41e32720, 0xaea8dcfa, 0x403256cd, 0x72c7f512, 0xf0187915,
+    0xf21d48df, 0x7aa599e3, 0x561f626f, 0x277ff4a2, 0xf5d9c7fe, 0xef4af5b3, 0x9a925e3f, 0x2b3ab4d2, 0x80a2bcce,
+    0x37313b00, 0xbc50adf3, 0x6f2008e8, 0xc7aaa25d, 0x947dcac5, 0x75170de8, 0x006a31af, 0xaa0dc7f0, 0xe2df55c7,
+    0x7e800f1e, 0xc38bfbb7, 0x98294d86, 0xe04b9567, 0x9b62c307, 0x9622b115, 0x6aeabec5, 0x52417eb1, 0x4abe680f,
+    0x781004fe, 0x145d5533, 0x5ead2287, 0x73e0446c, 0xcd941417, 0xdeb6244f, 0x0e61155d, 0x655bae38, 0x3e688e1c,
+    0xb645a00b, 0xffe4dd23, 0x06541fba, 0x0086a0fd, 0x857e6169, 0x349d75f5, 0xdc85622f, 0xa5dc2f4d, 0x5a8a060d,
+    0x2756ca49, 0xac574f42, 0x696978ee, 0x6087345f, 0x5c38aa3e, 0xf2a18a83, 0xb295c86a, 0xa932a4ac, 0x15e6fc3e,
+    0x1563ca49, 0xa098d6e5, 0x2bb5acb1, 0xb5321de5, 0x53669d6d, 0x030adcd6, 0x6228e10f, 0xde2c77a4, 0xa4cf1280,
+    0x59409e78, 0x66d41b04, 0x16323ae1, 0x4f64781f, 0x3c20e0ae, 0x1be84663, 0xef266b0e, 0x0654a9b0, 0x8985d39c,
+    0x3173f9e9, 0x1a0c5c59, 0xb45b90f4, 0x56ed3482, 0xd5c3dc40, 0x0ec262fd, 0x6088719c, 0x8bf31168, 0xea7de4ad,
+    0x4be2f36a, 0x0cebe2fa, 0xdefee2b1, 0x44adb2f2, 0x86a6cd51, 0x2e9123e1, 0x43b75db0, 0x99d38cfc, 0xb51be1c5,
+    0x7a307e69, 0x327a6a78, 0x135dd203, 0xf84f6eea, 0x63cd3d79, 0x705683a9, 0xd4b43bcb, 0x9f8c24ca, 0x58954943,
+    0xff5754e1, 0xeb2381e3, 0xc2853714, 0x2354eb74, 0xbd2ade0e, 0xed472c74, 0x5e11efd4, 0x72b4d765, 0xa3135f21,
+    0x1937beb5, 0xf335a69c, 0x8595929d, 0x53a05229, 0xa115de42, 0x66efb982, 0x3aedb40e, 0xa2862494, 0xfd4344ab,
+    0x2fc438c4, 0x9bf76f6e, 0xa97e59ec, 0x326bab72, 0x28f1d517, 0x236cc15a, 0x623b465e, 0x65b859ee, 0x92088a8d,
+    0x25bb04e5, 0x27b4fefb, 0x8c24b464, 0x11eac599, 0x1c1a796a, 0xb957047d, 0xc78a2c33, 0xe1016357, 0xc5d0ee80,
+    0x8b9c29ba, 0xbec5ec68, 0xb82f5b9a, 0xb83b396c, 0x79bf0f3c, 0x287036ab, 0xe65a09e8, 0x33540fa6, 0xf06989a7,
+    0x8c66de4b, 0x803e82dd, 0xf3b9326c, 0x539e2fac, 0x6424044c, 0x1af4ccb3, 0xa2295e76, 0x91485659, 0x7f6f8696,
+    0x5872a3e5, 0x7eaf81b1, 0x708b4980, 0xecb70482, 0x361f49f9, 0xb71ed318, 0x05aa1eac, 0x64cb2fca, 0xd1ee1b07,
+    0xea3f99ce, 0xce2010a1, 0xa071155c, 0xcf97e009, 0xb95f6eec, 0xd66c2cfc, 0xa4dae105, 0x1c7f534c, 0x82c69378,
+    0xc179d2f3, 0x0ebad05f, 0x32fb6884, 0x574bca13, 0xa1c5cb5b, 0x310a61c5, 0xef275619, 0xd130f649, 0x68620c57,
+    0x586109d0, 0xa427f189, 0x8e51dea4, 0x60bec167, 0x53a69ec2, 0x0d2472b5, 0x00056c3c, 0x03cec5ff, 0xe2fb97ed,
+    0x2439c502, 0x8a82511a, 0x2c1feab7, 0x1e103434, 0x50096f09, 0xb9b9af9a, 0xdb227096, 0x2ec86c7f, 0xcf3bff46,
+    0xe02a47f6, 0xb69c0ff1, 0x6a62e3fd, 0xf3d9dcfc, 0x2f364e7d, 0xbd091e39, 0x5b0ee6c3, 0x78d760b1, 0x3d124c8f,
+    0x9eb8baac, 0x70b26528, 0x342487ac, 0xd9f3bd54, 0x14159a0e, 0xa1988287, 0xe9222b9a, 0xb1337874, 0x66468448,
+    0x77351058, 0x2fd893d7, 0xf2923c10, 0x7d98b939, 0xc9718872, 0x961c3769, 0x7db5021c, 0xeb47aa01, 0x63a4a725,
+    0x4dcd1a30, 0xcbc9b619, 0xdaabe693, 0xa3b74ad4, 0x934d20e4, 0x7dfd315b, 0x4d446152, 0x4c7fbda9, 0x4ab562ab,
+    0x7a5e26f7, 0xf69d8d28, 0x5d87259c, 0x5a589bf4, 0x7d404e8a, 0x4937e863, 0x0906e79c, 0x66c45646, 0x874a1949,
+    0xfcf95ef5, 0xcfbc5256, 0xc535d923, 0xe8cf7c49, 0xfd364b67, 0x009dc958, 0xfbd1b5c6, 0xb4850b88, 0x381dc993,
+    0x2d88d087, 0xc9b65635, 0xd6e33c72, 0x795911b7, 0x39e6ba37, 0x506b9b8d, 0x2b68e05d, 0x06ff0c65, 0x95d5242e,
+    0xd60c6354, 0xe538b4a3, 0xdc2d2da8, 0x06259d13, 0xa5dcebd0, 0x59dfbe79, 0xcf2fc243, 0x85262df6, 0x274cb8f8,
+    0x1a081a12, 0xb87fd5e4, 0x112076ec, 0x76a6a789, 0xe314528d, 0xee46a47d, 0xe3302f8d, 0x0cd70c2d, 0xde2430bf,
+    0x892192f8, 0xdf16fca0, 0xdf5e287b, 0x2f61f9b3, 0x421852e7, 0x937316c3, 0x494089e5, 0xf13764c8, 0x17174ff9,
+    0x82299a7d, 0xe1be7836, 0x5a45e596, 0x6d8fb65a, 0x2dacb259, 0x7e627e8e, 0x51e810bb, 0x505ab32e, 0xb74c9242,
+    0x946e806c, 0x83d7b084, 0x577501b4, 0x48c2d570, 0xc0d0245e, 0xd497d7a0, 0xcc00972c, 0xf5ea41b8, 0xa7b8046b,
+    0x04edde5c, 0xec0520fe, 0xed6e736b, 0x760a1ad1, 0xfd18d9cd, 0x5fbcd33b, 0x7a1aba1b, 0xc4f7967d, 0x1f80ad06,
+    0x47e0de10, 0xe30d374a, 0x47798e64, 0x0ddd7628, 0x554a0095, 0xec16592b, 0xb4b6b694, 0x40d48a32, 0x8cae7375,
+    0x66b3bf4b, 0xf3c6a2ae, 0x17bd961d, 0x197c44ae, 0xd291e9b0, 0x4ff34074, 0x67924877, 0x8a018fd9, 0x41cb02e8,
+    0xf47ac036, 0xcb939be1, 0x7090c9f1, 0x4538c89b, 0x38adfd3d, 0xd4f966b4, 0x82000151, 0x166ee01b, 0x073344d8,
+    0x972150a3, 0x9f44ff30, 0xe9438ca1, 0xff39c494, 0x433cba63, 0x5e5b9c23, 0xde53a022, 0x23031b52, 0xf4159689,
+    0xbc9d28ff, 0xf0ca9da9, 0xaa9f932f, 0x41720f80, 0x69dd3de1, 0xf3249124, 0x5d2b581f, 0xa01bdd02, 0x54bae589,
+    0xe96737a2, 0xfac3de97, 0x0b4e8267, 0x316cb131, 0x45624393, 0x633296dc, 0x184a4e6f, 0x90680cb8, 0xecada60e,
+    0xbb50ce03, 0x24df8ae5, 0x874cab30, 0xd0c632d2, 0x5793afef, 0xc7b3b0e0, 0xa89787d3, 0x2959987f, 0x981a93c7,
+    0x77f0f9ce, 0x96389336, 0x4b866bb4, 0xfaf7daeb, 0xe12ea583, 0x6d59b842, 0x9c17135e, 0x8d057cbb, 0x53253022,
+    0xbf41d39f, 0x87406788, 0xd8339f6e, 0xc8e8f82c, 0xa0f79e52, 0x81a09a1e, 0x06325911, 0x4913ae1f, 0x457a9e72,
+    0xed62c8fd, 0x1471e1c1, 0xcdd7cb32, 0x6a710641, 0x0c042c70, 0x28bdf92f, 0x05b6680a, 0x15f12dab, 0xbbf65634,
+    0x3188180d, 0x0160becd, 0xbee8a539, 0x08b24d67, 0xed66bf8d, 0x185756cc, 0xf34a4fa5, 0x82977372, 0x8aa2a1fe,
+    0xbcb6f39a, 0x598d936b, 0xaf9cc0d9, 0x83daa331, 0x3a0cd725, 0x2c459ab5, 0x238bdd6e, 0x69efed58, 0x696aa82c,
+    0xcfc2e415, 0xce7037b9, 0x92624812, 0x12b1290f, 0xa93b1360, 0xb1e06301, 0x351f564f, 0xa0dc1ba4, 0x906e6c04,
+    0xf4e188b5, 0x2b031dd7, 0x90743fb6, 0xda4672a9, 0x54e86ffa, 0x5d158316, 0xa5d943d6, 0x28a3e0d1, 0xe5edb3d6,
+    0x2fb8c066, 0xf3e51758, 0x9953b524, 0xbfd0853b, 0xbd26f3e0, 0xaf5ab59a, 0x54a69595, 0x3211aba6, 0xe80e7057,
+    0xd90e00d3, 0xc38203bb, 0xa8b8a9eb, 0x14ed78b9, 0xf277b54a, 0x43d92e44, 0x5a32d3b2, 0x71e38df5, 0x113b1c80,
+    0xdef2cdb9, 0xf688cea1, 0xe9c2d219, 0x8a829174, 0xf35da9eb, 0x5d9b43d5, 0xf4cc57e0, 0xd66cf75b, 0x5b7172c3,
+    0xec5fa185, 0x5fecf8bd, 0xb810c690, 0xc7372949, 0xedcaf8a6, 0x7124c343, 0x8a7a9058, 0x7c8f672f, 0x8bab664f,
+    0xbe99d9a0, 0x1fc1785e, 0xa382f844, 0xf010333b, 0x8092d5af, 0x498c329a, 0xb9a7b68b, 0x8de07807, 0x335581e4,
+    0x499d74fa, 0x0f1e7c0e, 0xd9932149, 0x21cb2caf, 0xd95f2a2f, 0x5edf9ae9, 0x8743bc70, 0x171337e2, 0x5a0c00d1,
+    0x4ac21e5d, 0xb7041f83, 0x67556969, 0x8da69732, 0xd6cb0c42, 0x8ac14f6e, 0xf273179f, 0xc7a98165, 0xad887f4f,
+    0x250d98e7, 0x472df18e, 0x99870c3e, 0x0e872c31, 0xa5eecbda, 0x870bd67c, 0x1d120b57, 0x873aa6fa, 0xb933b155,
+    0xfd0954a8, 0x4c561919, 0x4237bff3, 0xad9622b1, 0xd5eb7b89, 0x96c2b156, 0x5cba4dce, 0x255c6254, 0x096012a1,
+    0xa854772f, 0xcf8a221e, 0xc0c9aa41, 0x4dd38edc, 0xc922f3ef, 0x4591ac6f, 0x49e1cfa5, 0x29fdaa9e, 0xf6852f29,
+    0x6d4174ae, 0xb9aec956, 0x3261123d, 0x05946876, 0x5b622196, 0x30235521, 0x3fa35436, 0x3564e5de, 0x3580af27,
+    0x9b0e8d01, 0xcd90f92b, 0x5ccb59e7, 0xa48ef889, 0xbb6e3044, 0x6d528df5, 0xb9d2bbca, 0xbe7937c1, 0x6fcb90a7,
+    0xe4b7d58b, 0xefb2e5b4, 0x453a7f84, 0xeb94b79e, 0x184b2645, 0x8b40ac04, 0x186f50ed, 0x04e614bf, 0x5e96a1cc,
+    0xe5fa664c, 0xc55b7386, 0xcff6c5f6, 0x03e3cacf, 0x848fbb9b, 0xaea2a22a, 0xc021c845, 0x7330f272, 0x2f004ce4,
+    0x52fe953e, 0x159eb2bf, 0x8d851783, 0x1d0585c2, 0x83c79986, 0x7c8cdd3e, 0xaf535ea7, 0xe6d05522, 0x0b43cc36,
+    0x12a5765a, 0xf7831429, 0xad091980, 0x80536337, 0x9e8a0493, 0xb5ddca68, 0xff0e6862, 0xeaf4b4b4, 0x6f6497ce,
+    0xc1f07a30, 0xb4a6d4fa, 0x06bc305f, 0x96d0c4b8, 0xc92ca7fe, 0x000aaf9a, 0x1b92fd96, 0x3c9c99be, 0x69c1d5ab,
+    0x2059f5ac, 0xe380c0b4, 0x96004f45, 0x51ae2aec, 0x1646482e, 0xc2faeef4, 0xa14c3d71, 0x442753a9, 0x8dc313cd,
+    0xb44c8af3, 0x5bed5bdd, 0xbad184b5, 0x6f50d3a7, 0xd35fcc4b, 0x08ba5fee, 0x5e56427e, 0x59b04d8b, 0xcb5b99ef,
+    0x3ce53097, 0xf5b30994, 0x77cebd31, 0x09572548, 0x6a75d063, 0x54a78ab3, 0xcb91aa4c, 0x9d2248d3, 0x4a52f7ee,
+    0x0fa436c9, 0x94abb569, 0x7a67934b, 0x7983713e, 0x2a8d5ab8, 0x561d4015, 0x5dd098bb, 0x0b632667, 0x3b0f94ff,
+    0x35b1995c, 0xf5f3ff6b, 0x1c73ee93, 0x23f5ee3f, 0xf087f699, 0xe47acf98, 0x2c1601a8, 0x477ecb22, 0xeb020553,
+    0x0712b1c6, 0x27e34753, 0xa084ebb0, 0x8a05b5c8, 0x0c6ef128, 0xa107de8f, 0x2bf3e374, 0x93d5c7a9, 0x29681056,
+    0x1bd54712, 0x8b18e593, 0xddb5e6e0, 0x06687bb5, 0xf2960a18, 0x84e95049, 0x684f70ed, 0xa4f29df7, 0xa2d45990,
+    0x86684169, 0xb19e068c, 0xcd0647c3, 0xdddf007d, 0xa440ae2c, 0x3476d71c, 0xd844199d, 0x9f8c2975, 0x331c1867,
+    0xa3231f61, 0x5a6a7f88, 0x329390b1, 0x6d7ba92a, 0xe786a3c3, 0x782f9a07, 0x2b37f659, 0x5f45efc1, 0xdec8fe06,
+    0xfbf323f5, 0x29e32170, 0xd25b2e19, 0xb4b53901, 0xf451455f, 0x4fbd9e39, 0x94e9fcc1, 0xdb9c5a67, 0x9e66e470,
+    0x727ad38d, 0x9bb45f09, 0x050cc9b5, 0x4c55e70b, 0xb52cb3b1, 0x8170e3cb, 0xa9419ed7, 0x31d3561e, 0x66bc4bfe,
+    0xa7660add, 0xbe7b4908, 0xf5900a8c, 0xe75a8759, 0x74fc46b3, 0x853eaf0a, 0x61c9ab98, 0xdb7b493c, 0x9b95e689,
+    0x1b0b3805, 0xba3f2e95, 0x8ca3e78d, 0xa95943db, 0x94b13e6b, 0xb0a00b31, 0xdd5c717f, 0xc66d56c1, 0xd8b97cbc,
+    0xd61f3b2d, 0x49c4a409, 0x1773c65a, 0x00156293, 0x5827cafc, 0xd970ded2, 0xf7376fc9, 0x031fe503, 0xe8933baf,
+    0x11f5a539, 0xeda7835c, 0xe18348d7, 0x149daa68, 0x4ae3b48b, 0x0a287a7c, 0xd84c8909, 0x269b1e1b, 0x5fa1701d,
+    0xd4f6343c, 0x21f2a749, 0x603d223d, 0x0f6e7570, 0xfc37a82c, 0xd7845088, 0xdc5783a4, 0xb3445d69, 0x19ecbb8c,
+    0xa298bbb5, 0x8e0931b0, 0x0c609458, 0xc6d3ba14, 0x2ed29f82, 0x566ea5e7, 0xa4c48f92, 0x6c90af79, 0xec76e6ff,
+    0x0ce09ba8, 0x096651fd, 0x93c3a398, 0x678689ff, 0x2eb18358, 0x871313bb, 0x451959bf, 0x45999c5f, 0x83446c18,
+    0x1fff80df, 0xca231eb9, 0xf35a1545, 0x30823fdb, 0x18b34cb1, 0x227badd6, 0x466cb970, 0x76e95b83, 0xe0ac2cc8,
+    0xbbae7c13, 0xa3c1e634, 0xa69c17a2, 0x1ea931eb, 0x86c4b3d2, 0x37cb4123, 0x363161b3, 0xd61b3501, 0x116cd287,
+    0x757fd337, 0x6883edf8, 0xd057190c, 0x4e52b71b, 0xaf520260, 0xd55cf745, 0x7e6607f7, 0xe928620d, 0xb0bae5e9,
+    0xb3f8192d, 0x6e6dcdeb, 0x099b90f5, 0x9c853946, 0x69e07229, 0x1f0f6c1d, 0xc0ce1ece, 0x639f28b2, 0xb007b016,
+    0x0dd1d420, 0x1e678ff5, 0x63b90442, 0x442f7d32, 0x8250a2b3, 0xca148ea2, 0xabce359a, 0x8d1d5126, 0xa61ed97c,
+    0x6b4f4848, 0xc5b26d32, 0x420090a8, 0x6bba4398, 0xaa69668b, 0x97b66976, 0x08ae692e, 0xb818caf0, 0xb200b626,
+    0xa2c94e1f, 0xc29d3fa3, 0xb2c37449, 0xb68fa489, 0x1e5df719, 0xac4e39d9, 0xbd9db58b, 0xdeb9898f, 0x000595b3,
+    0x526bf34c, 0x2e5a5940, 0xc64b707e, 0x24099ca0, 0x7540bd22, 0xe999f293, 0x6ec80246, 0xc1f31a59, 0xbc348f38,
+    0x32163de3, 0xaae45020, 0x2a7d070a, 0xfb09fdd0, 0x3afe1d2e, 0xc86f0098, 0x6825be31, 0x8b4ecf85, 0xb647a461,
+    0x1982d0dd, 0xfc66949c, 0xe69a18b6, 0xec2eec72, 0xf34e7b4f, 0x190a0bea, 0x0b227e06, 0x6c000849, 0xc66895e4,
+    0x63e48ab4, 0xc75a7d2a, 0xbede3398, 0xf7bc3f65, 0xb6f4a485, 0x40976795, 0xe9667891, 0x151b8704, 0x754df147,
+    0xcd114438, 0xeca64c46, 0x36254ca1, 0x381fc1a7, 0x679292a2, 0xa408e8db, 0x8207bc55, 0xcd8b4d23, 0xbf391ad2,
+    0x1a02ac2e, 0xb7da2e39, 0xbd3c96f2, 0x8fd219af, 0x00192bcd, 0xc492e665, 0xd3f78dd0, 0x564d7138, 0xef1f9645,
+    0xbe8384c8, 0xec6ae71f, 0x8cd63517, 0x875f5768, 0xbde568e5, 0xb2568a5e, 0x8987f51c, 0xa3e10107, 0xb630e24f,
+    0x9c340402, 0xade19423, 0x76b09d49, 0xf857581a, 0x1f7db0ed, 0x59cd53a9, 0xe20abb76, 0xe690e5d2, 0x0de9a261,
+    0x83084435, 0xcfd333f3, 0x5b063569, 0x5932851d, 0x6ef0c1c9, 0x346e7ef6, 0xc54a0e89, 0x78b04ec2, 0xf0206e92,
+    0x2c06d854, 0xd67efcd7, 0x15110d17, 0x846f6c32, 0xcc35fffc, 0x5ae9c141, 0xde62f73f, 0xdee2965e, 0x46db9d44,
+    0x02f22731, 0xf334dde7, 0x52f4ec35, 0xcc311de2, 0x47eeabc3, 0xb58c8cbc, 0x8971103b, 0x5921212d, 0xcab2f168,
+    0x1613f23b, 0xef259f71, 0xd0fb900a, 0x191c4136, 0xc5e5ea10, 0x1c6fb504, 0xe4fc94ba, 0x040137ac, 0x9b8191ed,
+    0x8f8cac1f, 0x159c1dde, 0x43f87514, 0x7afa95b6, 0xb116f390, 0x8b0d0882, 0xd5ca3f86, 0xc06c378b, 0xaa1fa6ca,
+    0xe2fea342, 0xf6d4495a, 0xee6f59f1, 0x61d7a0bb, 0xe4d884f1, 0x21b019c5, 0x3b11e5e2, 0xbcb57d2e, 0x2468e27d,
+    0x1cf01b64, 0x7fec3c82, 0xa0252cec, 0x6fb64941, 0x0fadb297, 0xdad967f7, 0x3e02801c, 0x250be2ce, 0x59847636,
+    0x185b37fb, 0xe1ac7601, 0xa6a2dbcc, 0xb99a27ab, 0x795c1619, 0x6149772f, 0x5d9e73ae, 0xb8aa39af, 0x70c21ac7,
+    0xbc457ab2, 0x8311bcf5, 0xe070d025, 0x28818bfe, 0x523167c8, 0xd20bc25d, 0xc23f26a5, 0xae8e556c, 0xc55b24d2,
+    0xceb6c35d, 0xf3cae026, 0x9583f28d, 0xffaf9683, 0xbabb9f28, 0xd7f31eb4, 0x5c70ec95, 0x3e4a8a6d, 0xd4632cc9,
+    0xa11485ba, 0xfb128331, 0x21d4caa8, 0xe8afca6b, 0x196191f4, 0xc67a8093, 0x5fb9de6f, 0x1e22b488, 0x2cee05cb,
+    0xc26e145a, 0x145cb5ee, 0xd4dffb8e, 0xdf885867, 0x73966832, 0xb6445317, 0x9b220239, 0x0957a5ea, 0x3c58296f,
+    0x5e8a0d57, 0xf184a69a, 0x96ab605f, 0xa6598631, 0x45c35c87, 0xfd05dab3, 0xa6043c5a, 0xe3cbc9b5, 0x9ca1dc27,
+    0xc0413a84, 0xf0a6521d, 0x64e4f89f, 0x8ef88df3, 0xde8f7e40, 0xee936087, 0xbc524810, 0xc2138781, 0x17fcdade,
+    0xdfc5e42f, 0xeee68d47, 0x9fceb6f9, 0x48f6dd29, 0x0fbc1599, 0x187f032f, 0x4b202763, 0x0defd9a8, 0x1f6ab73a,
+    0xd883f064, 0x600a8515, 0xab0c189b, 0xecec9faf, 0xcd7ea250, 0x0ab04f6c, 0xb237aacd, 0x5e058284, 0x997cebd1,
+    0x78046e99, 0x75d96eda, 0xcacb9101, 0xb94e35b6, 0xb8641a36, 0x47cb8b7e, 0x10b6e31b, 0x57057182, 0xa721a700,
+    0x1535254a, 0xcdf1616b, 0x5b8f0a98, 0xa62a946e, 0xf7422429, 0x7c1e8794, 0xb1779166, 0x4a494e90, 0xb095d3f5,
+    0x9868827f, 0xcdc9c196, 0x65694366, 0x1a6eaf3d, 0x58c13709, 0x35a78990, 0x73b198e9, 0x1694ceca, 0x85194cde,
+    0xa9dd94d4, 0x71acc65c, 0xa990a5e1, 0x66ef2f6e, 0x82fd3c72, 0x081eb275, 0x521208e4, 0x04976207, 0x4489942f,
+    0x7635fdb3, 0x7b7145ee, 0xdb9f07ef, 0xa8ad1425, 0x8fb6276a, 0xe71c6dba, 0xd4ff3d47, 0xafc1f07e, 0x1d6c2c70,
+    0x1e2e3574, 0xcb2700ab, 0xb2122d54, 0xb73c0e6b, 0xeba0b51f, 0x0e602f02, 0x469810bc, 0x70625127, 0x01e662fc,
+    0x402821f8, 0x63c55111, 0x2ddd8c0e, 0xbaa52992, 0xf35657bf, 0xe5f77773, 0x2b2debf7, 0x2a88b97f, 0x6fa740b2,
+    0xbffb3ff2, 0xd743c925, 0x63314c48, 0xe311d2a4, 0x2777d66f, 0x7d7f5577, 0x4d074930, 0x7edee5b1, 0xe96f2441,
+    0x5d7a43bc, 0xa537fd70, 0xa1460a93, 0x569bd4ac, 0xc0c3ac40, 0x43c93217, 0x86ac8474, 0x174b3970, 0x1f8046f1,
+    0xba79f4ae, 0x370d9641, 0x765ee7fc, 0x8a29d2d9, 0x1ed300a8, 0x4c96ef12, 0xf367da61, 0xaa742a63, 0x25c2c85c,
+    0x1e351fb3, 0x21ba6556, 0x70393a00, 0xbbb6d3da, 0x15931b2e, 0x197166ea, 0xb76babb7, 0xa18d0765, 0x697352c0,
+    0x51db4195, 0x72b860c8, 0x97c24842, 0x7511a66c, 0xa604d0aa, 0x43396197, 0xbd0e294c, 0x05c59612, 0x5159adde,
+    0xe99f5b23, 0x123c07c2, 0x1400b317, 0x537bc267, 0x5093d9a9, 0x5faf3c9a, 0xe9d55078, 0xad8493b6, 0x67d3396f,
+    0x014f7e47, 0x274e2441, 0x86fc2017, 0x99ea5f44, 0xdcff23d1, 0x41c9f9f3, 0xf64c33a3, 0x7b6df0d6, 0x91fc341d,
+    0xcdc88fbf, 0x7f312041, 0x66bc67e2, 0xb2c372e0, 0x22f230c0, 0x17033fe8, 0x559f2383, 0x00ed0875, 0x22fefc70,
+    0x8bdbbe41, 0x3298282c, 0x2b297bd2, 0xfd7c2d92, 0x6d05cb00, 0xd15ea7af, 0x5e18cc5a, 0x8147c7ef, 0x1a610b7f,
+    0xebfbb74c, 0x06339467, 0x13f3e49b, 0x319fc0cb, 0xfbc6dc43, 0xf0b2ad06, 0x0112c53c, 0xe5965db1, 0xcf62f5fe,
+    0x241557bf, 0xaf292ba5, 0x970f6b0d, 0x5cf01938, 0xc077944f, 0x6414d9e8, 0xbcb787f4, 0x20a0126f, 0x7730b194,
+    0xb1cb4cf4, 0xe91dd2d6, 0x61b8416f, 0xe69485e0, 0xf8f8fa13, 0x085a7bd0, 0x47516a94, 0xddafe4d0, 0x987d9cd1,
+    0xbdacc511, 0x3f8b977d, 0x4c86223e, 0x739d0448, 0xe46b2ebc, 0xdaf83c91, 0xa6002c35, 0x97bdb88d, 0xd0200372,
+    0xef4cf0e5, 0x731cac8e, 0x5df5e1a3, 0x06096ba0, 0xad7918ef, 0x6497e7e7, 0x3f84b97e, 0x8db969a7, 0x8e993bb5,
+    0x3876f02e, 0x0d5353d0, 0xd5d9f3e0, 0x17458cd7, 0xe54d6a23, 0xa24db2f9, 0x5c29a03f, 0xa519fb83, 0x5158b70f,
+    0xae978f12, 0xf96cc130, 0x971a5f7c, 0x62f6e86c, 0x320f92f5, 0xef445ce1, 0x44e8567d, 0x4aaf0999, 0x7d6d5ffb,
+    0xf772d9ea, 0x9c2f2a4b, 0x1f4d0039, 0x75c8e03b, 0xa35ffde7, 0xc89e2675, 0x51db5189, 0xebb66e5d, 0x6116d777,
+    0x31e543ef, 0xbbcf02df, 0x6c109172, 0x7449d2ab, 0xd9fa2baf, 0xf35c4a08, 0xbce1f2f6, 0x2b60be40, 0x4ef19342,
+    0x70441229, 0x23f1da53, 0xd3f4891f, 0x4d80b9aa, 0x38f94897, 0x063fd7b8, 0xa7c7a80c, 0x4653475c, 0xc10545df,
+    0x27731e28, 0x35b28bc4, 0xe9f4387b, 0x09b16775, 0x46fe01ac, 0x7611a0ed, 0xdf6ac3ed, 0x87b417d8, 0x32c5594c,
+    0x39761eb5, 0x41b23c17, 0x2b7989e2, 0x2dbf9381, 0x0b1b48a2, 0x156471cf, 0x33f681e9, 0x3b1d93ec, 0x67469a93,
+    0x6bca0a84, 0xc7877095, 0xca9310dd, 0x56f9ec4d, 0xa85e9d01, 0xad1e37a7, 0xcbc66b9f, 0x27e6c7ac, 0x9aa252c4,
+    0x3f6fdfae, 0xd7b231d6, 0x89c8fb55, 0x26ff6a20, 0xa0fd4f1b, 0x9a383bb8, 0x26599a11, 0x7e9bf940, 0x07c6499f,
+    0x5f32b319, 0x49d91e79, 0x2a3eb9e9, 0xd412082d, 0x0ae5283d, 0xb6e95402, 0x17c225f3, 0xc3e8872c, 0x16486acf,
+    0xabda5145, 0x43c288b7, 0x9d9e7a07, 0xa26563e5, 0x5c1f5a1f, 0x5cc4d41e, 0x43640692, 0xf20f1095, 0xe3636c03,
+    0x930057db, 0x6012e172, 0xd2e4caa2, 0xdc6b7aed, 0x166b29ef, 0xb19dc746, 0xd97dd3e6, 0x11f8bd0e, 0x4e07327e,
+    0x9ceeab2f, 0x9401e6ae, 0x32c31dd6, 0xf0e3fd56, 0x7804ae1c, 0x5acc7056, 0xb0397497, 0xb22e4f7b, 0xb36afc2c,
+    0x86b58a1f, 0xd9ee70f0, 0x0993ce74, 0x5beaa3db, 0x97183474, 0xb17fe289, 0x69825b18, 0xd4d08786, 0x0df1207c,
+    0x0d663650, 0xd97af359, 0xf581c097, 0x7678d79c, 0x1a1b7555, 0x72a21a3c, 0x53f32282, 0x692cced9, 0x387a8d7c,
+    0xf4823efe, 0x6aadaf3c, 0xb9d583a0, 0x10de479f, 0x11850abe, 0x3558048b, 0xcdf732b0, 0xf8e84184, 0x1715a1c6,
+    0x38653f31, 0x73edb8d5, 0xfc87521c, 0xe132bc1c, 0x87e9bd7e, 0xcd8de435, 0x6fff1ec7, 0x6522c9a7, 0x08620870,
+    0x404fae1e, 0x4e0e183f, 0xe415cd3f, 0x5506d9e8, 0x8595e007, 0xd4ecc1a3, 0xef3f0892, 0xd8e8a17a, 0x06cab6da,
+    0xcb715309, 0x6b2b9c52, 0x8342d8ab, 0x0bdd8951, 0x939570e6, 0xc496569e, 0x55397b5a, 0xa488cbeb, 0x37c72715,
+    0xbb0996d9, 0xe27701c5, 0x656c8e4b, 0xae3593db, 0xff884842, 0xd50398d7, 0x031ae030, 0x6b17c25e, 0x8ead7874,
+    0xd53dff81, 0xd87e3221, 0xde055b23, 0xe0ae702a, 0xadd5c7be, 0x74f800b5, 0x0016ea72, 0xd6131b97, 0x842aafe3,
+    0xb7f7d58b, 0x605fc244, 0x4d9fa823, 0xe16c7143, 0x77e47079, 0xe8606237, 0x54f14970, 0x88a1b269, 0xd420cc0d,
+    0x58d88698, 0x12fbb61d, 0x5663ad27, 0xa5785f56, 0x293dcf79, 0xeadea0e4, 0xd7bc0a70, 0xb543c142, 0xc3d0822c,
+    0x2719cabd, 0x0ce5701e, 0x73baac00, 0xe6263fa9, 0x0d2b8b55, 0x0b1250c2, 0x7611819d, 0x64a58799, 0xab79d77f,
+    0x33112c24, 0x509dfff3, 0xa5be601b, 0xdeb34197, 0x67662501, 0x3920b3e1, 0x7d394dbc, 0x597d389a, 0x98414bfe,
+    0x6a19bee6, 0x0f2a2cb0, 0x110ec935, 0x8adba3d9, 0xe3223ab9, 0x85e6811e, 0xde7061c4, 0xf3c7b461, 0x44b61ac6,
+    0xd48026eb, 0xbd8a5add, 0xcd8972ff, 0x7c71d3ac, 0x0003794a, 0x8c704ba1, 0xe30e4288, 0x407d9ee3, 0xcd5d9632,
+    0xbb36385d, 0xb377f8c7, 0x43f81640, 0x0d1040cf, 0x54bb9f29, 0x17026d3b, 0x128e5485, 0xb91be295, 0xabd128c8,
+    0xbb41d6dc, 0xc9c4a838, 0x6e5f946c, 0x3c7d26a4, 0xcea75e5f, 0xba70308d, 0x7fe85ca6, 0x58c9e018, 0x7cb249b6,
+    0x6b900203, 0xf2e59610, 0x4e560c06, 0xee6faaef, 0xa7c7eaea, 0xa9da79cd, 0x46b4cad2, 0x0ef7aaa7, 0xcdba477d,
+    0x5b72484a, 0xc9d676e6, 0xa0449cc8, 0x587d1753, 0x4a4e7a37, 0xafea9aba, 0x6c3165d3, 0x1a14c7dc, 0x15a4f377,
+    0x68db1fdf, 0x4e2a0532, 0x3c4373b7, 0x9a1036f8, 0x5cfa04e3, 0xbb9105b6, 0x407f236e, 0xf9854428, 0x6558a1aa,
+    0x3317c436, 0x0183ac1d, 0xd398ab6d, 0x3e33a150, 0xd4b05639, 0x4cfbc25d, 0x02a74642, 0xe67a636c, 0xc424e947,
+    0x9f06b775, 0x627737ff, 0x8b5c5e2b, 0xfd9794e9, 0xb56b7c59, 0xb9028ea1, 0x03c2124b, 0xe5596d42, 0x08861061,
+    0x4aafa598, 0x9ad8e484, 0xc783a0ac, 0xe74bff8b, 0x47ac3976, 0x59b6a313, 0x7fc30cbd, 0x9fa8993a, 0xb016e8a3,
+    0x324f6976, 0x2d86b9a0, 0x42e2238b, 0x37ee3634, 0x0a2adb23, 0x1fbbb1cc, 0x3acc2a7a, 0xe7821e4d, 0x3dcad0af,
+    0xfbdf65ad, 0x7ca55e27, 0x7d8084a4, 0x2060696e, 0x88aec329, 0x466f9468, 0x19bb0a27, 0xe7f55d70, 0xfaf281e5,
+    0xdb65b902, 0xec90434b, 0xeffb7d78, 0xf54b5322, 0x9fd00f88, 0xac717e58, 0x07ac36a3, 0xf756b944, 0xc0070977,
+    0x0709690c, 0x0f5e5d76, 0x31b6e5ba, 0x3680e8d9, 0xd1e66d11, 0xca75e982, 0x3bd9978e, 0xac20ebf5, 0xc8ab653a,
+    0xab3fe0f9, 0x4499e1fc, 0x89d00a3b, 0xa7b2d34a, 0xad1b377e, 0x10df0bcb, 0xbf87cc83, 0x620fa727, 0x468a8db2,
+    0x637fa613, 0xef412560, 0x6ec2814e, 0x75d847c7, 0x25229029, 0x44c8bd04, 0x4a2dd6e4, 0x25cea18d, 0x61081999,
+    0x41b4af58, 0xbd96c3cf, 0x524e71fb, 0xb7582647, 0x483334ad, 0xa6837094, 0x1cc3a2a8, 0xea4fc3b1, 0x1642bc87,
+    0xe3317a2d, 0x37120193, 0x906d6ef5, 0x8560fcb1, 0xd53c6e0f, 0xfb686210, 0x29cfcdf5, 0x7c82bcb6, 0x45aab045,
+    0xf1cc323c, 0x0117baeb, 0xaf461cf8, 0x2dd7d09c, 0xbbc85419, 0x8434f2ec, 0xca90f65f, 0xb338effe, 0xf82aaf19,
+    0x25f18d68, 0x50ae57da, 0x03b5b5b9, 0x7fcca7e5, 0x216fa3f6, 0xd8ed41a9, 0x0657bff8, 0x7a8ffc2a, 0xb133329b,
+    0x7b461930, 0x3b42b8bd, 0x77788572, 0xf5b9a8d5, 0x6f0a2d92, 0xe866097e, 0x5e5889c1, 0x2156513d, 0x84cb5130,
+    0xb1ef1ac1, 0x4552a36a, 0x38733f5c, 0xa6f72e2b, 0xb5381576, 0xc5df30f6, 0xc87b39e4, 0x1f5c7f5d, 0x45407eba,
+    0x35df0228, 0xe6dd1589, 0xe8be09c7, 0xf1ab9d2f, 0x83ab6baa, 0x20f34b40, 0x40aa843c, 0x3a72d429, 0xd8785039,
+    0x2309b274, 0x9b460024, 0x657a7314, 0x7978e3b8, 0xa43e93c2, 0xe09096df, 0x7583a7c8, 0xfcd9ccf4, 0x182c5a21,
+    0xc77d2b2d, 0x4ab3dc75, 0x93b8e9d4, 0x294e3080, 0x80bfee76, 0x58ab2ce3, 0x906b6e18, 0xf3507fd9, 0xe48588d1,
+    0x4a22fc08, 0x1e69bc92, 0x694f35e0, 0xf89cb7aa, 0x0861f491, 0x3ecf623e, 0xc321c840, 0x63d5166c, 0x0509dc90,
+    0x1c34a2c5, 0x60f98d0e, 0x7a07f821, 0x086d67fe, 0x436cf4cc, 0x92764935, 0x099a3f64, 0xc773f0dd, 0x4edadf0e,
+    0x647824db, 0x3b901ceb, 0xcc858c7e, 0x51f6de35, 0x1e9b7924, 0x2f23f45c, 0xd9111f89, 0x5bbdf767, 0xb54bc547,
+    0xd9619dc5, 0x0a141330, 0x6e3ec690, 0x12627d53, 0x6047450c, 0x3d786dc9, 0x7fc5bb16, 0x0eee8b55, 0xd4a5a07d,
+    0xe2422509, 0x13b85c22, 0xeff18a0b, 0x82c5612a, 0xed5f68d3, 0x6fff90de, 0x31b7e2c7, 0x9823bac7, 0x0a6d4adf,
+    0x177aae7e, 0x172d2771, 0xd3fefb6f, 0x55fae28a, 0xe58180f8, 0x72c62f11, 0x3847f06f, 0x9900fbab, 0x1368881e,
+    0x1995bbeb, 0x99af9161, 0x33461a60, 0x029580d2, 0xad94c539, 0x22f4640b, 0x14c63b2f, 0xfd999c41, 0x9a8440df,
+    0xeafff43b, 0x82d58e21, 0xd50991e4, 0x22ac2168, 0x3727b3e7, 0x1b236f11, 0x5676fc32, 0xdbeb9c91, 0x0b9c654b,
+    0x02c2c99d, 0xa3bf19e0, 0x5aa3d1bc, 0x4e2cab86, 0x21f5badf, 0xcc034718, 0x70d4baa5, 0x698d181c, 0x78fe7289,
+    0xb4d1f268, 0x8a3ce25f, 0x64e1cc4a, 0x941bbbf0, 0x24b8f609, 0xee173131, 0xa3f6c398, 0xbd21fa6c, 0x789238da,
+    0x0bd49a43, 0xcce900fd, 0x16497283, 0x3d41fcf2, 0x056057f6, 0x2567953c, 0xffc923bd, 0x88c6515b, 0x8259f010,
+    0x2ed1c4b0, 0xa442e7c7, 0x96e0ffc2, 0x75efc322, 0x089991df, 0xe97a74eb, 0x5e55c938, 0x540c9f75, 0x5831cef0,
+    0xe7c41021, 0x2499f6c8, 0x19d11a58, 0xbf301d71, 0x66559928, 0x61df73b9, 0x8057cc50, 0xdb0ab8a8, 0x36d419e9,
+    0x766b2726, 0xa513250e, 0x0b166974, 0x65535844, 0x34344d8d, 0xa8189449, 0x0ce41bf7, 0x74a58341, 0x1422a48c,
+    0xc0be1872, 0xb7250639, 0x59c7fe89, 0x5c974489, 0x8966f70a, 0x2479d3fd, 0xdc51cf4c, 0x77ff1b05, 0x35041042,
+    0x6649d1a1, 0xf5b789ee, 0xfa144367, 0xa6cba758, 0x087f9495, 0x92349f05, 0x9949131e, 0x9f34e128, 0xdaaf1563,
+    0xf9d40651, 0x701315b7, 0xe3bdca86, 0x4ade04a4, 0x861e36de, 0x67460e37, 0xb1d33938, 0xf84068d5, 0xa7eba9bd,
+    0xe24249d9, 0xb6d0a953, 0xf9322466, 0x59cff42f, 0x03b2238c, 0x76dce826, 0x218aa2ad, 0x3f3c8d6b, 0x52691098,
+    0xee812dbf, 0x7cb7da0c, 0xcb3442ca, 0x4a670b3a, 0x4365ebde, 0xe5d0e2c8, 0x37990997, 0x18d80cc8, 0x6971b548,
+    0x563b5e2f, 0xc11c3351, 0x53ecc854, 0x13b31689, 0xe1d28767, 0x3a8de93d, 0xd82b9efe, 0x044a8d5b, 0x8c341b57,
+    0x5e22b3a0, 0x2421c3c5, 0x4d123c75, 0xf38fc5db, 0xab376726, 0xa1103b5f, 0xa6f3dcc9, 0x5370810b, 0x29cc0308,
+    0x4d0a1dd3, 0x95ea3fd8, 0x742e00ea, 0x5786a68a, 0xd29e7e9c, 0xdc69beed, 0x37999460, 0x89c45c53, 0x2f7deab5,
+    0xfc7745bb, 0xc718e32a, 0xaf09d45e, 0xcb5aea40, 0x1279fcbc, 0x8ce1585d, 0x20c4ac61, 0xb2f1cfa7, 0x78627bd9,
+    0xe23ac578, 0x35c53db2, 0x434ecd14, 0xd9f98966, 0xedef8748, 0xe3767d3b, 0x820e806c, 0xa948b10d, 0x9b7451da,
+    0x52dae128, 0x9269745e, 0x3dbdee0d, 0x92031abe, 0x31d0dd61, 0x716787e1, 0xafa6d3eb, 0x3eb0d709, 0xf53be2be,
+    0x14cf60ea, 0x82cb7130, 0xcf6e3469, 0x071ce4ac, 0x4bb65fb5, 0x2e38f683, 0x57c87796, 0x23693822, 0xd56600de,
+    0x0e65f62a, 0xf35b43e9, 0xa73a28c4, 0xc55c5368, 0xb5131ae8, 0xc7f67592, 0x9bb248b5, 0xe0ba7503, 0xbafdacc8,
+    0xb917e95e, 0x680d1845, 0x4315c013, 0xc8c82e8c, 0x7c3c4919, 0xb578a81d, 0xa89c079a, 0x7452122c, 0x787e20d3,
+    0xf9fde270, 0xe8f7ca93, 0xe4be8176, 0xd5c93a5f, 0xdf550d25, 0xb45567af, 0x5942de88, 0x9ba8a85b, 0x419fd6e8,
+    0xc2d15b3f, 0x26c99601, 0xfb8a44ff, 0x55e44762, 0x40555423, 0xcff59aba, 0x5d3ad877, 0x74aefed6, 0xbe8e0048,
+    0xdcc1e11a, 0x46df0343, 0x744cbf93, 0x916eeb6e, 0xe3c8dcf7, 0xab9fa9bf, 0xe03e6600, 0x9987188c, 0xbe5ee099,
+    0x7d5fb45d, 0x7ba6e158, 0x45b0c4ce, 0x2c80f2c4, 0xccf0a056, 0x970bc6ec, 0xc610b098, 0x12b52513, 0xed71f3f6,
+    0x15c6fbe3, 0x55fc04a6, 0x9298e5cc, 0x1118cdb0, 0xe58d2c21, 0x88141d7d, 0x228742d7, 0x02d91104, 0xe1c81927,
+    0x9778bb03, 0x603707b6, 0x480a4bc8, 0x1d5c8653, 0x49c8fb1f, 0xe845b7b7, 0xfe214c19, 0xbfad7af7, 0xe8959464,
+    0x8615318d, 0x6747d1e3, 0x1032c254, 0x096d65b0, 0x787a7a5f, 0xb4b656a7, 0x1c02596f, 0x8577050e, 0x46c471b8,
+    0x3abc5f2f, 0x569ecd25, 0x8f2bbc9b, 0xe9ded2e1, 0x1ffa6d38, 0xe21af6ac, 0x08d7919f, 0x6550e930, 0xc37f659e,
+    0xac70d612, 0x6705b573, 0xd06a7aac, 0x64f064df, 0xd746e3ef, 0x27d80194, 0xc4c77910, 0xbe911318, 0x1c2b6b49,
+    0xc2a274ad, 0xaa209a62, 0x7c21a7e8, 0x2b182b97, 0xa22f547f, 0xa10ac5d2, 0x823137c2, 0x80945817, 0xbbf208f6,
+    0x6257f8ee, 0xa020b3a0, 0x0adccd6a, 0xf8bd7a81, 0x3d32d335, 0x0078a5d7, 0xebfc52f2, 0x4fb42fc8, 0x7413bd90,
+    0xbe822ede, 0x6888d024, 0x7ce5461f, 0x44326cf0, 0xc6c42b13, 0xae2c59c2, 0x72e9d10d, 0x0141c08d, 0xfdc50a50,
+    0xda006449, 0x90c2c770, 0x0c2b1cd8, 0xf88a8dc9, 0x6940d382, 0x658251da, 0x0e081622, 0x4dac7acf, 0xc0e5a15c,
+    0xf3d00cb7, 0x4e28d176, 0x672afdec, 0xff22c602, 0x60df8a4c, 0x7eed1552, 0x46276302, 0x886d4224, 0xdc572361,
+    0xd7a685f5, 0x404b0edc, 0x339409aa, 0x85835f58, 0x13711427, 0x6f3765b2, 0x4dad4208, 0xd1be8293, 0x36a88e77,
+    0xdd27fe58, 0x7395ad30, 0x3522a514, 0x04d53e74, 0x3f48bbac, 0x7a6c565e, 0x3c6cb9b7, 0x992053cc, 0x355377cb,
+    0x19065158, 0x5df6036a, 0x8cc4cb33, 0x8e53afc3, 0x6fe1e4e2, 0x2c911277, 0xee1235fa, 0x15369078, 0x2d94a1eb,
+    0xcdbdbe97, 0x4af767aa, 0x0d6ecf41, 0xfbadb1c9, 0xde9adb2b, 0x78067dcb, 0x39d8e66e, 0x375d73a9, 0xd2086a91,
+    0x22b31138, 0xbc14c6cc, 0x918752b6, 0x9f3e7cfb, 0x5177c54e, 0x035ff808, 0x9228ff78, 0x87dd9505, 0x43558f57,
+    0xc0ade123, 0x53c14172, 0xf48f6182, 0x198e0ec0, 0x023157da, 0xbecd91ce, 0x984761c9, 0xa8577ece, 0x182b7a77,
+    0x6b410054, 0x57aa09dd, 0x9986761b, 0x28f426c6, 0x3dbac89f, 0x068bdd79, 0x3e59c776, 0xf37469f2, 0x9aa99386,
+    0xb7ca3c75, 0x7227a691, 0xd12b4b32, 0x7197db37, 0x07eb0fd3, 0x3a5a9320, 0x5acd6517, 0xd3eb6958, 0x705a0067,
+    0xab66a598, 0xa84a4d36, 0xca1ba2b5, 0xc62d750e, 0x62488168, 0x0815ecb9, 0x7c4b4673, 0xcad95a11, 0x7dc68851,
+    0xbcbc419a, 0x79940229, 0x07449054, 0x5246bd84, 0x8e794cb7, 0x4c817e59, 0xb29bd12c, 0xcaf1b041, 0x436e8fde,
+    0x4fe044b8, 0x2aa06096, 0xbc0f5e76, 0xe5eb1ea1, 0x1734c8aa, 0x27cb1a88, 0x4c3be71c, 0xbccb7f86, 0x137d8faa,
+    0x341e9167, 0x0dbb6217, 0x2d47dec6, 0xc838327a, 0xdbf0b628, 0x882e75ba, 0x9d758a2d, 0x5a4294e7, 0xacfec2c5,
+    0xa0b1057b, 0x1f9db051, 0xe9b2f9ce, 0x2b20ca74, 0x7ba25925, 0x4714510f, 0xb7813aa6, 0x5ebe19c0, 0x2b7b21ed,
+    0xc8eead1f, 0x863aa956, 0x2797bdbc, 0x2e3e98e5, 0x15d9a832, 0x8ee7e008, 0x15341b1e, 0x93128e50, 0x58d416f9,
+    0x1aed0992, 0x383654f4, 0x85adab74, 0xb0a923b1, 0x3093e7fd, 0x3da8f23b, 0x913582f9, 0x35a27506, 0xf9998de5,
+    0x1d7752f9, 0xd57e56a6, 0x8153bac4, 0x67e913bf, 0x23cfdf2a, 0x9cc2a6ca, 0x5358ce18, 0x6dab45df, 0x058ac6cd,
+    0xd9ab66e7, 0x4a8d596c, 0x2df948f1, 0x283592e1, 0x1b7ca59e, 0x8589541b, 0x6169ca2e, 0xb6760f13, 0xf429ba03,
+    0x1c6b9084, 0x6b179137, 0xd5a351a2, 0x81a28faf, 0xa075609b, 0x75f88cba, 0xc9c50cf7, 0x5ecf89e4, 0x223e20b3,
+    0x6f2a3284, 0x3d011ac3, 0xcf6af90c, 0x31cc3923, 0x8093d59e, 0x2ab3a96a, 0x0be8edbe, 0xa0c84c12, 0x587cd11e,
+    0x0d9985a1, 0x1a5eac96, 0xc9d58211, 0x31de0fe3, 0x9a25ae80, 0xb8121483, 0xde53b699, 0xd9266bd7, 0x0186e272,
+    0x97f126ad, 0xfadb85de, 0xd3c72cf0, 0x8302d47a, 0x927d242f, 0xd034c094, 0xa598021f, 0xd6964718, 0x10396a96,
+    0xbcb93b20, 0x613b70e3, 0x9efd1350, 0xbf60d513, 0x7cda6a6f, 0x23406b79, 0x2cb77846, 0x47c8edd3, 0x40417428,
+    0x05abaa20, 0x8816875a, 0xc741a82e, 0x6ba04a70, 0x76bbb93b, 0x5e2183c7, 0xb6a7b89f, 0xfaeb7558, 0x31e5b92c,
+    0x0e61c36b, 0xe098b7ae, 0x4b6a3442, 0x39e5ebc4, 0xb1a0b95e, 0x6b75a5d4, 0x1731318c, 0xde79e206, 0x5c88fc32,
+    0x800842f9, 0x6415bb24, 0xff7d1a5f, 0x0fd91d65, 0xd7321f07, 0x66bd221e, 0xa03eceba, 0x95012cb8, 0x53664ff0,
+    0x137b9b1b, 0xeb843c38, 0x48e389d9, 0x80f363c2, 0x1013a70f, 0xb5f5d049, 0x600e288b, 0x57652d6d, 0xf8de5053,
+    0x25b642bd, 0x69484e2d, 0xa4471b72, 0x3ada0e23, 0xd1b6909a, 0xb633001b, 0xb2fa1b51, 0xa6f017f8, 0xb43b2703,
+    0xfe6cb33c, 0x855ba22d, 0xd40b359b, 0x402da0d3, 0x59b7de6a, 0x8fe33dc3, 0x8cdc07a6, 0x7005efeb, 0xa96803b9,
+    0x661b12eb, 0x460da2d1, 0x127df002, 0x87bcbe2c, 0x06329e39, 0xfff86bbc, 0x82524e89, 0xda42baa0, 0x4f8c942d,
+    0x6c7da28d, 0xaa57f6c0, 0x2487676a, 0xd771df0e, 0x7e8a372e, 0x37b96b37, 0xea445a65, 0x31831967, 0xb6a520c2,
+    0xe092f65b, 0x5e89dac9, 0x0ff27aa8, 0x7b48c17c, 0xf2e5e6f1, 0x99ecd94e, 0xab93bce4, 0x9baee96e, 0xbd42b8a1,
+    0xc4c561c1, 0x391ca733, 0xb4485481, 0x01c526a3, 0x565f35e8, 0x8334e3d3, 0x9c0b30fe, 0x23e71eca, 0x0ac9624b,
+    0x95cd1f19, 0x6f815738, 0x7be139fb, 0x1b0217d3, 0x3d892cff, 0x730c907e, 0x83bfdf37, 0x2d9dc015, 0x6fa9d825,
+    0x0af1bbfd, 0xd01d6c58, 0x06ce2978, 0x7e429803, 0x3c0e033f, 0x90a675da, 0x163e7c78, 0x279522b3, 0xa7e2a41d,
+    0x8fb55b73, 0xc2f67dc2, 0x16e1d9f1, 0xa1ba9e86, 0x2c760d56, 0x884f44cb, 0xd7db4682, 0x097ed715, 0xb81dd250,
+    0xd060b3bd, 0x338ed957, 0x77d5f951, 0x9920608f, 0x6aeace24, 0x9d136356, 0x263eeb20, 0x1de1c1ed, 0x519b1537,
+    0xcb9f6b78, 0xd60ee261, 0x353cb28f, 0xba19cb72, 0x24777bb0, 0xa979961f, 0x9f579819, 0xa03985bc, 0x499fbc90,
+    0x000e9984, 0x7498639f, 0x607e9fbd, 0x5fe991fc, 0xb8198c4a, 0x0da2f3fc, 0xc98771ad, 0x456ce24b, 0xe540d6bb,
+    0xe49b8fd9, 0xa7dcc95c, 0xd80d1ee8, 0xecca9792, 0xf3850620, 0x4c14be0c, 0x41ea570d, 0x7c31fca0, 0x927b9f31,
+    0x3d700830, 0x1779a810, 0xa2c644b6, 0xbb042a71, 0x7addcbfc, 0x0701bddc, 0x5b68c9cb, 0xfcce8545, 0xa324da23,
+    0x6b274654, 0xd9d4695e, 0xad279268, 0x001bf207, 0x39fd4824, 0x2d7c2030, 0x711914e9, 0xc56c9379, 0x8aaa2b96,
+    0xfc5e7923, 0x54af3053, 0x7d5bb853, 0x944f31f0, 0xb93671c9, 0x174ac15e, 0x5134afa6, 0x7a6bc970, 0x96c722ee,
+    0x062c3a81, 0x57b119cf, 0x3a7a377c, 0x7379f759, 0x4c6cc7a7, 0x54b27b01, 0x49a13a12, 0x3950d9c0, 0xea3088ca,
+    0x6b1be993, 0x8c43c653, 0x58186953, 0x61f378c1, 0x702d780d, 0x3f153a40, 0xc7db4914, 0x059b5229, 0x644cb3e6,
+    0x209e9ac5, 0xd8fa9759, 0x6d34cdd2, 0x6a3b4a4d, 0x17abb529, 0x26bb1a63, 0x6cbfe419, 0xf3dab4fc, 0xd303f731,
+    0x5093c486, 0x57137c8b, 0x101da220, 0x526eff10, 0x3a88a36b, 0x8a6b1719, 0x3cda579d, 0xea3acfc2, 0x3f9700e5,
+    0x2546035b, 0x61381205, 0xbd3346fd, 0x857ef394, 0x57edc3d1, 0xf56404ca, 0x8c03e57e, 0x29262a44, 0x59e2afc5,
+    0xcebb9d30, 0x89ab24f8, 0x90d22cc3, 0xcd04695b, 0x7bd4cb60, 0x3b4aec5f, 0x70133cdc, 0xf2026f36, 0x30f34426,
+    0xf1e4112d, 0x696ad124, 0x5c7f0952, 0xaeb95288, 0xee8ba844, 0x7dfd44da, 0x628f7872, 0xdf316ab3, 0xb9842ccd,
+    0x19a42e42, 0x887d7c99, 0xd2cc2030, 0xd380e4c2, 0x97e2ea96, 0x61607355, 0x21260217, 0xb5bfed11, 0x8b350266,
+    0x4f114fa2, 0xc69ab624, 0x0bdc1310, 0x717492e2, 0x573720ff, 0x56802163, 0x25139510, 0x62617d8d, 0x79208d98,
+    0xa1443dcb, 0xed44a87d, 0x3a3902cc, 0xbdbebfe7, 0xdbefc402, 0x46d72396, 0x93030374, 0x2252ba0c, 0x611d9091,
+    0xed5defcb, 0x2f575ee5, 0xb0983870, 0x7d78beb9, 0x256be473, 0x3ce03679, 0xc34e6817, 0xd16974d2, 0x8cb1fc7b,
+    0xc70a8af1, 0x3ae56d16, 0x94c2cd44, 0xbbbe017c, 0x09eb18e3, 0x0451c3d2, 0x1df73e35, 0x8dcdb4a6, 0x1bfb300c,
+    0x1477643a, 0xdcbf224e, 0x09507d31, 0x56437892, 0x80e9cfe2, 0xfca76bdc, 0x0f86fa81, 0x830e8db2, 0xebcf9ebf,
+    0x83c4566b, 0xe92ebf7f, 0x9fe9bfff, 0x6d755af3, 0x4d80765e, 0xdd218b18, 0xd1ef16a6, 0x89d4f686, 0x134036a6,
+    0x16c2ae15, 0x8b4b550d, 0x30680cb9, 0xe2f8aa66, 0x5df7596c, 0x9e4f3b48, 0x96d5912f, 0x2b64691a, 0xdd2c44bd,
+    0x24b100bc, 0xd03c01a7, 0x5579292b, 0xb5aec27b, 0x780a20b4, 0xa78132d2, 0x674f7c39, 0xc0458db3, 0xe5e083f5,
+    0xfdb4732a, 0xc35c13fc, 0xf76cd21d, 0x73194f3a, 0xf51ce398, 0xfa1713d5, 0x4b05c87f, 0x2c81ac5b, 0xab4816fd,
+    0xd4b7dde9, 0xf1d46a0c, 0x4543ccff, 0xa1b1629f, 0xfe326a2a, 0xbfc32acd, 0x2311ac18, 0xe2280c69, 0xa1a9c90a,
+    0x6bba8bfe, 0xb4ffa62a, 0x1a71def4, 0xcbc4026b, 0x4800d4f6, 0x16f3ab56, 0x25c17cef, 0x9ceca009, 0x99a45b3b,
+    0x1a7fcb2c, 0xc9e22b41, 0x346877f6, 0x58843e86, 0xdeb7beb0, 0x21e31141, 0x6d1e583b, 0x3f03c6aa, 0x378fbcdb,
+    0xb780c60c, 0x335c9bf5, 0x669dbd36, 0x2e22ad09, 0x019feb65, 0xca8b8e9f, 0xc45a9678, 0xc8a4fd56, 0x3a156d12,
+    0x76d45da9, 0x4cfcb027, 0x7092e65f, 0xb008a3db, 0x06851b5e, 0xf1201a13, 0xa5c7bee6, 0xc2be8164, 0x533f389e,
+    0x4d2f64a3, 0x9cba90fe, 0xfa6e036b, 0x4c21d3c3, 0xefeedef3, 0xd2de59b2, 0xf215cbfd, 0x1bb9bb30, 0x5641b7be,
+    0xa9d773bc, 0x5d2733f0, 0x19364ff2, 0x0ecc83d2, 0xe98dec74, 0x81822a36, 0x15afc1b6, 0x7e4e5b0c, 0x18881c96,
+    0x6c2d3d51, 0x1d35de2f, 0xc1208a52, 0xde02b7f7, 0x41146c90, 0x0f881e85, 0x57bf62f2, 0x404e3954, 0x49907594,
+    0xc35f2901, 0x98bd6e03, 0xe97cdfeb, 0x68e33737, 0x9e7f4e30, 0x4c1174c2, 0x41dd30b0, 0xb868b73a, 0xc3d2ff28,
+    0x36906292, 0xfa1e0eed, 0x59ce8ce0, 0x038c36b9, 0xf411086b, 0x2c37cf9f, 0x55a49a30, 0x4959f8f2, 0x4cf0e95d,
+    0x6fda88d0, 0xc2c8468b, 0x333eaa34, 0x6ae6b1a5, 0x5c9d284f, 0x83e33efb, 0x1425909c, 0x9aedbcfb, 0x660a42a7,
+    0xc9f6c985, 0x1b9511a9, 0x790afb66, 0x69c33f57, 0xc27fe6ac, 0x17f256c4, 0x0293a63b, 0x329c2c9d, 0x123d3bfc,
+    0xf1e0c5b5, 0xc2b11b22, 0xfaac94a0, 0x5b181501, 0x18f61828, 0x2af196f6, 0x172f6a0e, 0xb1e0ab3a, 0xb2a334bc,
+    0x505b46bf, 0xe8ad6d60, 0x9d1970c0, 0xdd95208e, 0xa4185f1b, 0xab01f76d, 0xcb727549, 0x417be59b, 0x96c11b26,
+    0x24fb0c89, 0x21469472, 0xcdb20ebd, 0x8d3ede40, 0x564f5841, 0xcbfbd708, 0xc997e9f9, 0x4bea50ca, 0x3d28dacd,
+    0x5b912428, 0x0116e57d, 0xc991fcd7, 0x1342a040, 0x54ec098c, 0x6c785f6d, 0x6240220e, 0xca2bad93, 0x581188af,
+    0xdc93417f, 0x1baa11fd, 0xb297161e, 0xf5d4b369, 0x7114c5f3, 0xb1e872a3, 0xd0924baa, 0x608d6257, 0xf9446a8f,
+    0xb937a0fe, 0x698aef24, 0xee7739a0, 0x9ff4ca47, 0xc78a71b8, 0x66ffd18b, 0x72386096, 0x06fcb925, 0xd068f2f4,
+    0xd3cb23dc, 0xe4d4cd11, 0xa61dfaad, 0xeb912801, 0x3431f22c, 0xc6c98110, 0x6309fa3a, 0x3373574d, 0xd2dfb63e,
+    0xeafe102a, 0xc6c63d71, 0xd6e6cf64, 0x1b0b0a57, 0xbbad7e09, 0xb10071f8, 0xf4f600b8, 0xed44409e, 0xdc9277e1,
+    0x332cf15f, 0x82fe00f8, 0xef2aba55, 0x2ba331fc, 0x45834141, 0xe837ee44, 0x31ac3fc9, 0x79aeb739, 0x7821fa1e,
+    0xe1f391a1, 0xb7fe31df, 0x7498b82a, 0xa392379a, 0xb34f9960, 0x5c314c21, 0x7f2b58b7, 0x24598801, 0x0c8288dc,
+    0x98b539c9, 0x927b8095, 0x8b871307, 0x16630951, 0x091a3639, 0x0bf32d2c, 0x3245ebd0, 0xe286f618, 0x89f2d7eb,
+    0x4ba4e88e, 0x322ef169, 0xed78ec01, 0x37b832d3, 0x3b27bef3, 0x991f7b05, 0x9ff10252, 0x96d6001f, 0x98f30bf5,
+    0x66ce34c2, 0xacdd90c9, 0x4cb24e5d, 0x46516553, 0x29ea96aa, 0x48227913, 0x26eed91e, 0x1ee8f56a, 0x942de65a,
+    0xb92f5935, 0xe10bdd97, 0x760bf04f, 0x354f07f2, 0x94fb0c92, 0x71b41ea9, 0xc1eec4c2, 0x3d1523f8, 0x4717bd0c,
+    0x869709ec, 0x38816bb7, 0x0c0aea64, 0xdd4d0dfa, 0xa34f707b, 0x987bce25, 0xbd6b7823, 0xea7a3c54, 0x98c7b487,
+    0xe6bd9b76, 0xe8e5e3f2, 0x29a744ea, 0xdd3ca62e, 0x00141483, 0x70b9f638, 0xbfc7b7ff, 0xfa9ae891, 0xb615a586,
+    0x3ac793da, 0xede73c82, 0xbbc4ddd7, 0x4fcce274, 0x83e3efa5, 0x5d0c7330, 0x559ea7ac, 0x463556b2, 0xc55f6ca4,
+    0x7bbb6eab, 0x93362644, 0xed77f10c, 0x3b60aada, 0x9d17e39b, 0xd2da2926, 0x00a92c7f, 0xecd309de, 0xfa508ffa,
+    0xbe354770, 0x6c3c0009, 0x909d950c, 0x9ccd99e3, 0xe8299184, 0x39df5ef9, 0x04fc76e3, 0xf393ea81, 0xc4b2730f,
+    0x9f8d2b67, 0x4da03938, 0x6d83c733, 0xf0cc17a1, 0x9229496d, 0xb1da6a1c, 0x44c037e7, 0xc3de9ab3, 0x9543de46,
+    0xbbf4e981, 0x252c0d41, 0x26339d8f, 0x270b4054, 0xe8dbc954, 0xc3840ad8, 0xc2ba370b, 0x5212b486, 0x96f3e96b,
+    0x18f62d31, 0x8a425161, 0x7c7f10d2, 0x763ff0b2, 0x57866357, 0x3741854c, 0xf98a222a, 0xf6341076, 0x7622732c,
+    0x437a371c, 0xf64958f0, 0x7993ca36, 0xb5e597b9, 0xcd6f794e, 0x6610b0ef, 0xa082398a, 0xbd0beee8, 0x35beee1e,
+    0xdd7ef1ca, 0xf3da12a5, 0x13ac152b, 0xa949a1c0, 0x3902dcb6, 0xbd971be0, 0x28d6ad14, 0x896fc065, 0x788ef86a,
+    0x76b42773, 0x57c327af, 0xf835a687, 0x425c0366, 0x1c294da6, 0x6417724a, 0xbbd74307, 0x50e55237, 0xf101f579,
+    0x4d39f4a3, 0xbd281346, 0x98da3b11, 0x47abc9dd, 0x51b1d293, 0xb6daff31, 0x7cb222b6, 0xef9afc57, 0x01212ec7,
+    0x1b73d8fd, 0x90c21309, 0x041305a6, 0x3f43eca7, 0x798cac12, 0xf8a48dac, 0x863fa55d, 0x39da53c6, 0x1629b220,
+    0x7423eb9d, 0x7273138b, 0x4c3ab2fb, 0xe9e0d515, 0x79d3051b, 0x8fac62d4, 0x9814490a, 0x0e8cb06a, 0x7a6bc12b,
+    0xd73917a4, 0x7bd18650, 0xab5dfefe, 0x63a4047c, 0x76b821af, 0x33f4bdca, 0xd70cd3c6, 0xaccc9cbe, 0x93b33c7c,
+    0x4696f6df, 0x95487b04, 0xaa9929bd, 0xb1a6bb47, 0xb10e2f28, 0xf4495f19, 0xf3c84ead, 0x41e8fb27, 0xbf9507d9,
+    0xd30acf43, 0x585cff8b, 0x6aebd473, 0xd7057089, 0xbe8d26a8, 0xea10397e, 0x03f94711, 0x47cd701a, 0xe7793ee5,
+    0x7ceb7bf6, 0x17e5cc3d, 0x47c7a73e, 0xb5eeb157, 0x0c97b070, 0xaf5e3fbd, 0x1762b168, 0x19b54f1f, 0xe3c08cd5,
+    0x5fa08573, 0xe3eaf9f2, 0xfdafbd77, 0x24ba4d76, 0x23aa0b23, 0x6903850e, 0x93b8e61c, 0x7ffaa70d, 0x9d672b5a,
+    0x290c9791, 0xe096cd3b, 0x56169d04, 0x56dd99b7, 0x9adf61d1, 0x312f1845, 0x5fa63b27, 0x219a8c2a, 0xc032ac35,
+    0xc56d2729, 0x95fb67a9, 0x3caa1a8d, 0x3029d4be, 0x94b61f79, 0xba8d2f0b, 0xdc1e23f0, 0x0e861a6a, 0x409c3ce7,
+    0xaa70e0d8, 0x554fe2c6, 0x4057bab0, 0xb8183bce, 0xe5385828, 0x58e76055, 0x01471fe9, 0x50e6e605, 0xa8ab7990,
+    0xbe014182, 0x1eda83ec, 0xd45e49b1, 0xc4f3cf6e, 0x584e455d, 0x7e2efb99, 0x517315b4, 0xd026539c, 0x247308da,
+    0xf07ad6d2, 0x41bfb48f, 0x73a34727, 0xc70e979c, 0x9e06584d, 0x77e279e6, 0xb59d5cae, 0x9f8cbe97, 0x440bb664,
+    0xc455dcd7, 0xe26816cd, 0x07e53f0f, 0x4b7112f4, 0xee2ebdd3, 0xdf8126e9, 0xe9642f0f, 0xb29524f9, 0xce773664,
+    0xffc86a15, 0x9a241391, 0xd41c8aa6, 0xd2637e3a, 0x403e9fd2, 0xdb7d7cbd, 0xb341db58, 0xb94338ba, 0x4f0a14bf,
+    0x35f50696, 0x6864d073, 0x66866b0f, 0x984a6783, 0xb7905067, 0xc418e26d, 0x3eb23f50, 0x47792fc5, 0x489f4155,
+    0x06feb0ce, 0x36585794, 0x3efc5539, 0x35916c3a, 0xad91e70e, 0x856c1a76, 0xce3da876, 0x03001217, 0xa73dd1c3,
+    0x0703cf1d, 0x9ff17064, 0x1b737ba0, 0x170c44bf, 0xd857215b, 0x9906c203, 0x47c5c432, 0x37070bee, 0xe1426b85,
+    0x390037ba, 0x3fa14b9b, 0xb46cb18c, 0x039ddf7e, 0xbd615a20, 0x9157797b, 0x2439b8c5, 0x76a23c23, 0x0cc66757,
+    0x3d63b1cd, 0xe9949652, 0xf6067f64, 0x87cfb898, 0x63ac4802, 0x464a128f, 0xa9929e86, 0x594dd189, 0x0bab66fd,
+    0xe996b600, 0xfabea429, 0xeca45a7b, 0x46150949, 0x70f73290, 0xcd9ca01d, 0x302a1e0c, 0xa98d3935, 0x4cc2c011,
+    0x8f8e35c4, 0xc077b8ec, 0x0ea7f9cd, 0x12b5d0b0, 0x9553b248, 0x4b3c613e, 0x5a52c903, 0x575042dd, 0x7bb3d340,
+    0x03054044, 0x77439efa, 0xcf35939c, 0x4980421a, 0xd593473b, 0xd6741d26, 0xd85363bf, 0x7cf539da, 0x2aac1fbf,
+    0x08027d29, 0x34f8e615, 0x2ffd9d12, 0x6f47c0df, 0xdff9ed3a, 0xdadd4b4c, 0x3c4ebed0, 0xfa279730, 0xfd5adc7a,
+    0xffa961a7, 0xdc553d64, 0x5927694d, 0x7b0a26b8, 0x51eff638, 0xf73e2941, 0x3cf4e428, 0x500a8568, 0xd1b66f05,
+    0xb6dc6aaa, 0x900096b3, 0x79689d51, 0xb09e2326, 0xcabebdb7, 0xd79150c0, 0x069941db, 0xec19a1b5, 0x82d26adb,
+    0xef029a0a, 0x6876bf27, 0x95565b4f, 0x56c3a305, 0x63f43b91, 0xa34733c1, 0xa9573310, 0x5e8c9509, 0xa91d594c,
+    0x151a82f3, 0xe887265a, 0x789599ba, 0x49a30ce8, 0xe2089cfd, 0x33f6d6d7, 0xed92806d, 0x9f321d2b, 0xd14a1052,
+    0x9b7f6346, 0x12711911, 0x4ff881a6, 0x0795855b, 0x36af2adf, 0x10d6c865, 0x631a0efd, 0x75901724, 0x4b91118c,
+    0x11a25930, 0xc6e0b7ff, 0x1c91f50c, 0x04306f8c, 0x9388d36b, 0xda33253a, 0xf1635427, 0xbf6ca342, 0xad66bfd9,
+    0xf19cd930, 0x32de3416, 0x0aeb36f7, 0x02b0a011, 0x769de189, 0xa5780166, 0xf9ad8a81, 0x0d997ca6, 0x7b63969c,
+    0x79c5e25e, 0x053aef74, 0x93549f88, 0xf8bf9ee3, 0x85058449, 0x3f3c5de3, 0x3c3ed4ff, 0x2b295a03, 0xa9fb60ed,
+    0x972d3477, 0x988ce70b, 0x659a823d, 0x73abdd68, 0xd4f515a8, 0x3f62e503, 0x07c729d6, 0xfd94f241, 0xf8b909a2,
+    0x5778f66d, 0xcf72ebe8, 0x51c54843, 0xa4fe1ebd, 0xc55ca767, 0x07448843, 0x98da6cd4, 0x60d45a80, 0x5f62f25a,
+    0x2b4e0fbd, 0xde0e0c63, 0xce759f14, 0x6f7d9f48, 0x89b732ad, 0x4a6aafff, 0xbec42b18, 0x0ab7429f, 0xb3b31182,
+    0xfc1cf5ef, 0x1e641c97, 0x9467c694, 0x50c38edc, 0x64102cfd, 0xc871d4b1, 0x0e9092e0, 0x694e188b, 0x4bde10e1,
+    0x86d1f74b, 0x91c8419a, 0x0332d3a7, 0xf01e4fd6, 0x3e497918, 0xc423d06e, 0x1da4d294, 0xa0e5f681, 0xfb1483c1,
+    0xf727610d, 0x03cfbde0, 0x7493e19f, 0x095c5a7a, 0x4d7211cf, 0x5eabc160, 0x0fc31bba, 0xda45ed86, 0x7651af6b,
+    0x3fea972a, 0xb05e76d9, 0x4dfe23f3, 0x3cb5eae9, 0x20ef74bd, 0xb23c5a27, 0xc92fba7c, 0x906c6e37, 0x31323aba,
+    0x5a0fc327, 0x4c759318, 0xec9d8d79, 0x8fa2b630, 0xfe25af5f, 0x8b29dd71, 0x1f8057d7, 0xc4c6a70d, 0x8ea02d6b,
+    0xa8aa03dc, 0x68af24d4, 0x9074268d, 0x8db4ec0b, 0xddc0a6f3, 0x6a98ee16, 0x6bde9594, 0xa1fcc41c, 0xcc21535b,
+    0xeb3c1e36, 0xa20c25b3, 0xfcb95777, 0xf8c1ff3a, 0x9714190a, 0xbeb8e78c, 0x65b927e3, 0xca724de6, 0xe5ef9b27,
+    0x007cd970, 0xdd9c1f82, 0xed551662, 0xb0b76adc, 0x9bee25e8, 0xcb0b8695, 0x59ecd2e4, 0xa7af4106, 0x053a216b,
+    0xdbe18467, 0x9de5375e, 0xd9dacb64, 0x62e62d8f, 0xf90c84ea, 0x5e795486, 0x0a3a2415, 0xa4b28a11, 0x6fc46b05,
+    0xb5306ba0, 0x4be028ea, 0x5e6e1d1c, 0xabed9c68, 0xb450fb3e, 0x3dbb1fcc, 0xa2c36943, 0x2e19f34d, 0xfe1b07b7,
+    0x91492229, 0x6137d1a7, 0xd50ce194, 0x9ca6e73c, 0xbd2cf32c, 0x4df145bd, 0x044fb917, 0x2acf9ac2, 0xc12baceb,
+    0xe5f9b664, 0x05f98c8c, 0xe5a211dc, 0x6450f7ce, 0x6be67193, 0x34a97a84, 0x4b07eaa6, 0x5b509b27, 0xe5f84b41,
+    0x7a071652, 0x88fc9988, 0x2df3b3fb, 0x5514a4e5, 0xdbff836a, 0xf61b7d4c, 0x68fa2475, 0x6016f5b4, 0x9284b000,
+    0xdf016c33, 0x577c44c9, 0x54034288, 0xae95f9d8, 0x00c9880c, 0x0a85d2ba, 0x4ff87592, 0x916cbe56, 0x6b81de3d,
+    0xcce0bb2b, 0x1fa17015, 0x890760ed, 0xfe62c02f, 0x65828ee3, 0x76cd6508, 0x6dbe1c2e, 0xb2d3fb30, 0x1ec5d0e0,
+    0x70a5f573, 0xe32a39a0, 0x197f6c6a, 0x44f4744f, 0x95f6cf74, 0x34de031d, 0xf981cdb7, 0x58c56dde, 0xe03c851f,
+    0x4f4e4cef, 0xb3b8ca16, 0xb890473c, 0x1a492c98, 0x77944c3f, 0x4d9135b7, 0x5e8c3c14, 0xde7c104b, 0x7f3a4810,
+    0x7562b4f2, 0x3526d045, 0xe73491ce, 0xcc3865e1, 0xd32be389, 0x25029c67, 0xd73bfd2b, 0xe0ce82cc, 0x757f3655,
+    0xda2bd0b6, 0xc1e96df4, 0x8b69c402, 0x2ab5e34c, 0xffd12790, 0xd44d6266, 0x499c4d1e, 0x48de1871, 0x01281270,
+    0x310ee468, 0x13cc4132, 0x39ec6828, 0x01eaf164, 0xc7d78bb0, 0x08358bbc, 0x2988b9f0, 0x1db9a8d9, 0x00ad3418,
+    0x688bc88b, 0x0c5a8f3f, 0xc68aa1be, 0x24def579, 0x61d03962, 0xbeb347b3, 0xdeabe44b, 0xef726865, 0xc1dfdadf,
+    0xe10ad45d, 0x7b9fa2b4, 0xcc61db49, 0xd466b43f, 0x8755b3f8, 0xd8faa290, 0xece7a173, 0xd28adda6, 0x5d2b8201,
+    0xcdd0650b, 0x984495af, 0x12333a67, 0x531623c2, 0xa3dd9a2f, 0x35bb24ac, 0x82c10efe, 0xa73ea073, 0x8b87bddc,
+    0xde4639df, 0x030a76dd, 0x1f2dc16d, 0xf209c8e0, 0x3b132fb0, 0xb622adc5, 0xdd0e9ecd, 0xa8617d81, 0x33728d71,
+    0xf11fe1c9, 0x70d85f06, 0xbb6a6e46, 0xf4b3f768, 0xe72ceb84, 0xb527bff1, 0x9729c36a, 0x4952a17a, 0x267bcbed,
+    0xdec7404d, 0x078e29c7, 0xfda23594, 0x7d905f41, 0x74c2ba75, 0xc0037884, 0x43c00b92, 0xea4436ed, 0x211d7396,
+    0x78574dea, 0xaae5ddc8, 0xdc5aa1e4, 0x119350d7, 0xbeb281ac, 0xc2e3fe26, 0xfdb043d0, 0x2404689d, 0x881192ab,
+    0x68634159, 0x499a5749, 0x17e33902, 0xfbbfff7f, 0xbf0def40, 0x0fd0e2e2, 0xbd57be02, 0x6e0b7507, 0xe481c21a,
+    0x1b0d8fd9, 0x536758a6, 0x7563c655, 0x12642285, 0xdad58c22, 0xee80f7b7, 0xcae87fa2, 0xe3d4b29e, 0x29fe48ba,
+    0x4c45ff7a, 0xd975392c, 0x81480fa7, 0x52a943d6, 0x216ea8f1, 0xf6dac1e6, 0x9118e4b1, 0x8936df8a, 0x3753ad08,
+    0x7b5931bc, 0xed67d809, 0xe82aca73, 0x267c26df, 0xde20a002, 0xc89605b8, 0xc4a9e27a, 0xbf81348d, 0x37d58b17,
+    0xf12aa0cc, 0x21474f6e, 0x83531ab2, 0xc1c64e92, 0xa988c317, 0xd22b2dac, 0x77fb2470, 0xe8b92358, 0xc34c34eb,
+    0x1fc60e1e, 0x415a21a6, 0x5a7579f7, 0xb19fcd71, 0x31ccc287, 0xc8ef8e35, 0x6bedfba7, 0xcf2df363, 0x58cbc273,
+    0x7903b03e, 0x18414877, 0xdfa7676d, 0x9a182a33, 0x3933fbc3, 0xdfa2ec2a, 0x9942f293, 0x9c581845, 0x345b4477,
+    0xff189c09, 0xae5745ce, 0x400c298d, 0x9e7fde26, 0xe06c80ae, 0x91d02da4, 0x79f0dfa4, 0xdb5ff81a, 0xb44bcea2,
+    0x0a8707dd, 0x53278795, 0xb674354b, 0xffaa8590, 0x0ee7b61d, 0x5b0dbc47, 0x02c14077, 0x5daf6362, 0xc26d6d1b,
+    0x986b99a3, 0x62c75a02, 0x13cf083c, 0xdaed4278, 0x95b34fa1, 0x69586f34, 0x1db593f6, 0xba10e400, 0x65228259,
+    0xe529b4f6, 0xe4abc739, 0x19ce7caa, 0xaa83afc7, 0x60034f74, 0xeb0ca1be, 0xd903d188, 0xea181e01, 0x824e6b62,
+    0xec1bb8ce, 0xe6b1603d, 0x1ae860e3, 0xa485f4f0, 0xb8fa23bd, 0xdddc58eb, 0x861531fd, 0x6d452d78, 0xc01e2af1,
+    0x1fb47965, 0x72f8d344, 0x7d60c2f1, 0x6617b903, 0x287a0305, 0x6162240d, 0x797701d9, 0x4d424cfa, 0x13f98319,
+    0x3c31f751, 0x83e41d28, 0xc83d3b04, 0x7535f911, 0x0890f197, 0x60427c5f, 0xfa4f9cb4, 0x91582daa, 0xa8996384,
+    0xeddc4d36, 0x888968c0, 0xcb6f2589, 0x5b9c8903, 0x0960913d, 0x26002119, 0xb66b90c9, 0xb1e019b4, 0x9ec15ad9,
+    0x69544d2d, 0x616e59b1, 0x774e699c, 0xdeff7cb6, 0x74d01180, 0x987a91c2, 0x3480e35e, 0x153529d0, 0xf7bcd0e3,
+    0x9f4ac4b9, 0xed0a5790, 0xa3a040b6, 0x917904ab, 0x42c22558, 0x3b02e5ed, 0x9869dcf9, 0x91557a01, 0xd57fa3ce,
+    0x69b7d5c4, 0x4209cbe4, 0xd4b3c994, 0xb89edaa0, 0x96f337ef, 0x32455f2d, 0x4e1ffd5f, 0xed69cae5, 0x5ae57aad,
+    0x9a9c186a, 0x2a926043, 0xe5747dd6, 0x5a4128e2, 0xd33a11c2, 0x6d70ab33, 0x7e293746, 0x857baf81, 0x5186e98a,
+    0xd5f38534, 0xdc7bfc4c, 0xa409b175, 0x47b837cc, 0x32864edd, 0x7d49c555, 0x8ccee762, 0x2a4f07f1, 0x65568ddb,
+    0xc1f6c788, 0x78f972b8, 0x38a9df6c, 0xd7bacf5b, 0xb74b7f3b, 0x4fb1357b, 0x8c1d9f03, 0xe3b239a5, 0x063defa9,
+    0x8cd3d2c7, 0x53e5e78e, 0x84c57acd, 0x4a1adf65, 0x85eabd73, 0xa6d3b31b, 0x2bc09cba, 0xc636d014, 0xb82e6f23,
+    0x6b9deb72, 0x14f5ecd1, 0x908d35c7, 0x8af1833f, 0x73b452d9, 0x7c952840, 0x982501b3, 0x7c76f916, 0xdfc0b98b,
+    0x2a6bae99, 0xdbc485d4, 0xdc2ccc84, 0x6f8f3781, 0x9ac1f5cf, 0xde640dff, 0xf0f7d4fd, 0xf69dd0ff, 0xfc5bb9bd,
+    0xf7daa63c, 0x862c2be2, 0x47d98bff, 0x96af84af, 0x4c3e7c12, 0xb702e478, 0x303bd1ed, 0xf4dd7dae, 0xf487a725,
+    0xd57edbd8, 0xcbc1c182, 0x60936d1a, 0x02b2eb5c, 0xaec20932, 0x38af9a5b, 0x65c7631a, 0x6ff54d3d, 0x894c21bb,
+    0x9447efcd, 0x994fbef1, 0xe5afc2e7, 0xc6faa2d0, 0xd8a2bc07, 0xc3b88761, 0x8edcb124, 0x2aa051b6, 0xe0e06191,
+    0x4537e7ad, 0x520c47d5, 0xeb4208c3, 0x04dbbc4e, 0x823ce444, 0x583004ba, 0xdfb33c91, 0x4814fe0f, 0x054841f8,
+    0xfb976ec5, 0x01589a01, 0x324b9c8d, 0xf1764472, 0x4d9c00d9, 0x6bb5e03b, 0xc2f1173e, 0x10686da7, 0x7109fe90,
+    0x44993d2c, 0xc0fe50b3, 0x16742a56, 0x16c6175f, 0x44b57428, 0xa4a46c7e, 0x46507869, 0x5261f3c9, 0x64d38dee,
+    0x44566528, 0x64a7098b, 0xae2889f7, 0x423ccd84, 0x2aa9f71a, 0x8879bf37, 0x1707cdb1, 0x0f37b469, 0x9ebd6c73,
+    0x2625f830, 0xba1ca9f6, 0xbd6ea801, 0x1d3b94c0, 0xb66d32fd, 0x988b7127, 0xa70760a4, 0x8cfa3297, 0x8bb13533,
+    0x1210cc1a, 0x56041781, 0x350d44e8, 0x5fcedbc2, 0x6948627a, 0x94dcdd31, 0xf9f632a0, 0xcc82d90b, 0x09f680c6,
+    0x08d083dd, 0x06a38e62, 0xf1937b92, 0x700eaf2e, 0xa7c57e13, 0x2a28d181, 0x33ddbe60, 0x11046c80, 0xdedc1e0d,
+    0xd455d83f, 0x1eaaea68, 0xb3bbbbcd, 0x9761eb6b, 0x3ab7ba8b, 0x587b3392, 0x2389b72d, 0x3f46484d, 0x49dd8fca,
+    0xd58a06a6, 0x9d2458ac, 0x2c339dd3, 0xa636131d, 0xae6e667e, 0x0d329f22, 0x3afe7bc0, 0x02cf082f, 0xe2544e02,
+    0x3453b875, 0xe016f464, 0x51a1eabc, 0xffc48631, 0x418f9612, 0x5ea182ce, 0x952e54e6, 0x692f9fb5, 0xd57e2cc6,
+    0x3329f9fc, 0x3751e7fb, 0x35f23d9b, 0x168d36e9, 0xcf16d1e9, 0xf06c207e, 0x1d5638c9, 0xa4d17de5, 0x51199e52,
+    0xe76f8a6c, 0x2a8f5394, 0x853a6797, 0x44628f55, 0xd4e7b036, 0xa104053b, 0x6f3209ac, 0xd2b107b2, 0xde04d6cc,
+    0x0a527683, 0xfb2e3e12, 0x61b0cdee, 0x77ddabde, 0x7da17bdf, 0x98c98400, 0x54b2d53c, 0xccf6175c, 0x9630930a,
+    0x876f4cce, 0x846c565b, 0x0cc26bd3, 0xbb8108d2, 0x90cf8863, 0xb8840a2d, 0xee737b8e, 0x59cb515d, 0x2f9fa2b1,
+    0x0a1cd99e, 0x1f6654b3, 0x9162770c, 0xfd46eda0, 0x532c4b41, 0x91608dba, 0xa7f94b7e, 0xcf2603b1, 0xd0f6aba0,
+    0x212a1828, 0xab553d0e, 0xaaece470, 0xcd332d35, 0x6cfc06b6, 0xfa39b499, 0xb461d3f7, 0x1b6cd71f, 0x587ed92b,
+    0x47745171, 0x4974a6ca, 0x94fda23a, 0xe750c8b5, 0x8707903a, 0xd21fe0e7, 0x8ceacfa7, 0x275e5782, 0x9828a0d0,
+    0xf4ff2a91, 0x73a19d30, 0x6f5f1c18, 0x046639af, 0x291ae266, 0x37402742, 0xd3465928, 0x844ae4e5, 0x8647612e,
+    0x22e2a052, 0x2fc727d6, 0xb1bb47b8, 0xf1cdc4ea, 0x312af877, 0xe6fbe6cb, 0xc8cba1e6, 0x6d1beb64, 0x902a18e7,
+    0x998bc0e8, 0x3650b81c, 0x4576089b, 0x435d3008, 0xa4219e2f, 0xb9be0074, 0xf6e6f60d, 0x8c2ebfba, 0x2a873bd4,
+    0xe696ed62, 0x0a385396, 0xd85f3297, 0xd92565ea, 0x3f7dc798, 0x68e37b8c, 0x7d3d036a, 0x93ccf0e3, 0x2d99140a,
+    0x60b0c8a3, 0xff8468b9, 0xa1821aca, 0x1dd6db0f, 0x47612cb5, 0xd40370cd, 0x3eae5655, 0x451298d3, 0xf2c834c9,
+    0xf8bb738e, 0xb595ef57, 0xe248239b, 0x90449ed3, 0xc2331ead, 0x8da2d828, 0xd0629b40, 0xb9629a44, 0x7e1e1f51,
+    0xfdc3d949, 0x7ac82173, 0x4e26b6a4, 0xc24d61a4, 0x41aa8fb9, 0xc87f344b, 0xe030fd6e, 0x5dd58040, 0x852c3cb9,
+    0x69559ee4, 0x46bb3726, 0xa4894cda, 0x9477b6c3, 0xef03b51c, 0x39e2bf52, 0xbd273c17, 0xdd68f406, 0xe6460a77,
+    0x2ea18782, 0x03a0c8d2, 0xddff8836, 0x594173d2, 0xdf02b399, 0x4ecf6d97, 0x7c57227d, 0x2f4415ea, 0x3bb5bec2,
+    0x23f04d66, 0xd3b14294, 0x2e34c451, 0x9971c9b0, 0x950e793b, 0xcb50fbaa, 0xf77adddb, 0xe7eef8df, 0xa0709d26,
+    0x5fdf52da, 0x802f24e5, 0x7bd74419, 0x9e131819, 0xda8a6409, 0x53fb228f, 0xfeab0763, 0xb359014c, 0x2ee545ed,
+    0xfa31310d, 0x3b87fe6f, 0xb8dc7813, 0x6b7859e5, 0xcc005af6, 0x19745f5c, 0xd381593a, 0x0d09a4c3, 0x37ffff8e,
+    0x6dc17d8c, 0xb9c1d371, 0x6e66a5b0, 0xdd701586, 0x370439c2, 0xb131c9b1, 0x1e3dbd76, 0xa2cd8920, 0x40af3d3b,
+    0x13f27d79, 0x8e604d65, 0x898dd753, 0xbab4efb6, 0x1b430f3f, 0xda2cf013, 0xdad869ac, 0x6d1b45bb, 0x0a261db3,
+    0x89d221ae, 0xffb61ccc, 0xf8518d2e, 0xde15898b, 0xea24dae5, 0xfbfdf5e0, 0xfb8923c8, 0xccb0984c, 0xf3798bbe,
+    0x8ed40254, 0x21edf061, 0x65f1bbb7, 0xa603f986, 0x45ab603a, 0x8bebd3dc, 0x97b2457d, 0x12dca365, 0x1f9f0b29,
+    0xfd755ae9, 0x7c8fd0f2, 0x8f5d34df, 0x3ab962f3, 0x6965feea, 0xb00edf17, 0x6f5ce1d7, 0xa1cf6d80, 0x387f79d9,
+    0x5f3ed63d, 0x46150e60, 0x3138a5f7, 0xce1acac2, 0x0c9329df, 0x3000a695, 0xb1ced29e, 0x3034205e, 0x1f6100f6,
+    0x56fd94bf, 0xdcf99b08, 0x24d7bf67, 0xa664c0ca, 0x0af51907, 0xba13ab7f, 0x77f805f6, 0x73dbccd6, 0xb7b85991,
+    0x5001fc48, 0xbeb783a4, 0x283e7e2b, 0x92d11774, 0x90e03e10, 0x8c09ca58, 0x6fd3a21e, 0x348892fc, 0xf042bdf2,
+    0x63a8fe13, 0xf8a91207, 0x6f818e2e, 0x8bf65341, 0x8b2cbb44, 0x183f909d, 0x6b66f795, 0x7c94a9ce, 0x32b86a45,
+    0x5e68d925, 0x169bd896, 0xd83dbbc0, 0x97fbf3bc, 0x52ddb505, 0xa3bfcb7a, 0xd5e3d6a7, 0x3824bf37, 0x5d7d8f93,
+    0xd11e4b7e, 0x629ba92a, 0xdeeef067, 0x86a86e6f, 0x28cca596, 0x193989e3, 0xf63d73bf, 0xc10bda4f, 0x0face5aa,
+    0x9057d975, 0x42de856f, 0xd2c1ca09, 0x2847ce5c, 0x39b47e61, 0xf8db26a4, 0x57c4ef38, 0xddf0f4ad, 0x3f5c2cec,
+    0x2cc37d0f, 0x4c292764, 0x60fdab96, 0xaf3bd44c, 0x3532e8a0, 0x371c60ea, 0x4dca1632, 0x1d050ef2, 0x96e9446a,
+    0x7f3f5a0a, 0x7e5ef0e8, 0xcaa902dd, 0xb834d634, 0x505f9098, 0xf9206af2, 0x75d77477, 0x689bfb66, 0x7f7cff15,
+    0x65ec33f7, 0x86afdfeb, 0x886266b8, 0x681c6bc8, 0x6e9f2ebc, 0x825a9cb0, 0x39153a41, 0xd3f77ee8, 0x29ba9bbe,
+    0x489f8815, 0xded951b5, 0xccf89150, 0xeca7ef73, 0x5d6f0dc5, 0x972af5fa, 0xad497288, 0x0c63cfc9, 0x2c85a659,
+    0x505a1224, 0x3202e675, 0xa8c7236d, 0xe46833c4, 0x7093f0c4, 0x57b18ad4, 0x148897c9, 0x271bbadb, 0x6da15de6,
+    0xc6d836c8, 0xb3a511b2, 0xef81af7e, 0x5449124f, 0xb89a1960, 0x597ed44a, 0x7cbdd184, 0x4ccf3604, 0x10a397d3,
+    0xf6bf9bce, 0xcacaec98, 0x588475ba, 0xc3efcbad, 0x2e486ae1, 0xb853d99e, 0x3008a014, 0x3c044aa4, 0x7e3218be,
+    0xa48e302d, 0x82c36c8b, 0x65ffd258, 0xad0814ac, 0xdd007708, 0x0dcc4dd2, 0x18b87d82, 0xf7149bfb, 0x7ba2e8e3,
+    0x3ec1e5e3, 0x33d7eb5c, 0x1604207b, 0x51fd39bc, 0x8a401071, 0xbf451683, 0x3899b798, 0x02f9afc2, 0xc1303954,
+    0xfe45031b, 0x885dd905, 0x6c47be9b, 0x3287561b, 0x57b254d1, 0x55bf77db, 0x8bdfb5b2, 0xcf16e1cf, 0x71f7262d,
+    0x032473d5, 0x7e4bef5c, 0x8c16a0fa, 0x2dc2cfd7, 0xd3c3d218, 0xe4cd70a6, 0x7df30e47, 0xb489d2bd, 0x291a543b,
+    0x3703feb7, 0x1591136a, 0x0e6ebb0c, 0x9a3ad1aa, 0xadfcf266, 0xdd7d5716, 0xbd2f2f35, 0x16b2ca68, 0x58466871,
+    0x3b0f7d89, 0xd2913e4f, 0x31b6d056, 0x16223387, 0x53223c11, 0x7756519e, 0xb5bb9bed, 0xc909f7b0, 0xa6fbf928,
+    0x3ccbaf70, 0x71cf4e28, 0x4c8effc6, 0x00b20b28, 0x631554d4, 0x5d9c14fd, 0xb6746894, 0x952acca2, 0x848290e4,
+    0x7a2f80b9, 0xc83f2d20, 0xbd316542, 0x70b3cfa9, 0x9078446c, 0x64ba95a4, 0x49f7b865, 0x289aed69, 0x00084efe,
+    0x655ef8a4, 0x3c56c3df, 0x693728f2, 0x30f1d25d, 0xcdb0770b, 0x07966b17, 0xeba6fb1a, 0xbfae7c19, 0x609acc63,
+    0xbdd991cc, 0x34a2b280, 0x2e5233dd, 0x9398c506, 0x20a7794e, 0x8a8167a9, 0x766a8b37, 0x1c689089, 0x20c543ff,
+    0xda2c54cc, 0xc87e2daa, 0x17d58646, 0x7b8bfd57, 0x41c130d5, 0xd695deba, 0x560c9a2f, 0x7c067081, 0x0ee60d45,
+    0xf63a13d3, 0x6c0b0c57, 0x9782b1d1, 0xf7360509, 0xe4cc89b5, 0xd884bf93, 0x10a48f8e, 0x0a161c5f, 0xa64a8a2e,
+    0xfd262ceb, 0x4d0776a0, 0x337cd0ef, 0x7d312514, 0xf194cc6a, 0xf7835bba, 0x79f22a0f, 0xedf85e9b, 0x452ae25c,
+    0xf77d79b3, 0x5012cfa4, 0x73b9f437, 0x743ecf98, 0xc53775f2, 0x814bb57f, 0x57d955fc, 0xde04b7fb, 0x340711e1,
+    0x6c995dbc, 0x2d88c187, 0xf082ed74, 0xcb92c8e7, 0x09e865c8, 0x5d3eea34, 0x78ab309a, 0x2c3b1a5f, 0x6643edc9,
+    0x7694b162, 0x964b722c, 0x94336de7, 0xc9f45166, 0x42b6ea82, 0xe3037b36, 0x491e28ea, 0xe1ffafa9, 0x86247f09,
+    0xca06b1ed, 0x09834dd3, 0x3e6a56fa, 0x0ee87c9a, 0x2503ab54, 0x73888840, 0x39896c4d, 0x3ba83ac2, 0x599ab59b,
+    0x2cb8b814, 0xed049d0a, 0x0f6c7ba1, 0xdf44560b, 0x832bd5dd, 0xd5dcb4bd, 0x3cda1feb, 0xd0a9f12d, 0xf7e5cb90,
+    0x9dfaa046, 0x7c69913e, 0x155bdf17, 0x4d496277, 0x5a2111f3, 0x830daf69, 0x209dec5f, 0xd36f804c, 0x549022f0,
+    0xd2ceb54f, 0x8b671a7a, 0x59786181, 0x2d33eeaf, 0x906a3ec2, 0x8e6fce77, 0x93dfea7d, 0x3f9396db, 0x790e19e6,
+    0xdf0ba712, 0x6c833bd7, 0x8085461c, 0x3e1f95d9, 0xc33b2eac, 0xa1e7621f, 0x64c828c3, 0x00121642, 0x0763c90a,
+    0x61c10587, 0x7fbc138a, 0x9a858882, 0x906b5f83, 0xcd3d40d5, 0x0e92498e, 0x25c1622c, 0xe539ea51, 0x747d357f,
+    0x5440dce6, 0xd8e04dfc, 0x2d03b801, 0xd364f450, 0x01b590ef, 0xd350c867, 0x5e50d978, 0x9864ad14, 0xc737d7b3,
+    0x0ec3769b, 0x291e836f, 0x9f2e677a, 0xfa7fd941, 0x2abe19e4, 0x51cf0413, 0xf7e64a9d, 0xcade1038, 0x7aa46ab9,
+    0x5e7ea657, 0x23eb3175, 0x2b56f816, 0x99e034b2, 0x1fc70356, 0x8994c490, 0x6633a069, 0x359be47f, 0x48423d8a,
+    0x47d51c37, 0x181ee27a, 0xd7fae015, 0x4888ab2f, 0x61c990a6, 0x55ada3b7, 0xcf629e92, 0xee877822, 0x84ba01cc,
+    0x9fbb099e, 0x97f6dd5d, 0x8f601869, 0x08f40f44, 0xd9981f3d, 0x6962b2d0, 0x6b962f98, 0x87e8d0a3, 0xf46d7dd0,
+    0x001d5042, 0xd6e7fccb, 0x1c49321a, 0x47819490, 0x1e7bc9f8, 0x89a3eaef, 0xc746086e, 0x023fb4b7, 0x9056f1e0,
+    0x39717880, 0xd0fc02e0, 0xf94ba0bf, 0x81303dae, 0xd2a3cf6e, 0x19cdac12, 0x879e02de, 0x51d1102b, 0x24c83b6f,
+    0x7644613f, 0x3f782c8a, 0x07cbcab2, 0x10aae983, 0x7cb98fad, 0xf1eb2a12, 0x0b45e053, 0x4d216ed2, 0xb0bd30c8,
+    0xcb392a04, 0x4b8104ca, 0x20db3550, 0x4f4a3b12, 0x6bfee79e, 0xc69784e0, 0xefa22b5b, 0xf87fedbb, 0xe4d7a45f,
+    0x4f821647, 0x862f2e36, 0x3613d265, 0x0ed98351, 0x613fdc0d, 0x5f2132be, 0xb16e56bf, 0x004144b5, 0x7ee90d4f,
+    0x833bbe2d, 0xb9aec0fd, 0xa3b62fb3, 0x440bfe6a, 0x6fcd90ea, 0x00efbccc, 0x0625c238, 0x3982db21, 0x0628cce6,
+    0x65e9afa9, 0x2ceaa3c7, 0x508e0b1a, 0xda07594e, 0xd5c20d1b, 0x75b97be5, 0x8f6fa2d8, 0x1d2c2479, 0xb23e6918,
+    0x043d4ddb, 0xbfed2ec5, 0x3ff038cc, 0x86d5ff8b, 0x7a483627, 0x82e64716, 0xaf11d374, 0x0bc3c2dc, 0xef76d61b,
+    0x7cdb00ea, 0xcd1d3ff6, 0x069a2877, 0x7f964902, 0xf1db3495, 0xd29542aa, 0x99d6fbfe, 0xfa04bf90, 0xbbb9845f,
+    0x3fd9ada4, 0x1cd76fa4, 0x532f5e3f, 0xeb5ea56f, 0x019c3949, 0x2ed40b6e, 0xfff601d8, 0xf65682d1, 0xaba49ce9,
+    0xf0208a45, 0x52c84c1f, 0xbd78d1bc, 0x66f28975, 0xb9a8e4d4, 0x3b8fb2a3, 0x86a3df1f, 0xcea21b90, 0xc674dd39,
+    0xb98b673a, 0xb4f16bc9, 0x7c4e0f06, 0x82e5410a, 0x8d5025f4, 0x3b2f3c86, 0xb78bf393, 0xc257519a, 0xdb474e52,
+    0xb93e2ea8, 0x123af5a4, 0x94801eb6, 0xaf9eae90, 0x4470618f, 0x9f63c681, 0x75d7ee86, 0xa415f825, 0x6467b108,
+    0xd547c357, 0xeb52b02e, 0xb53d1553, 0x1f61bb5f, 0x59631ea8, 0x79b68a12, 0x89d81316, 0x29263085, 0x83a32a84,
+    0x9fda9104, 0x63fa641e, 0x31e6320a, 0x12f60406, 0x54fadbf2, 0xb48ad27d, 0x91a34f73, 0x227813b0, 0x99469062,
+    0xc8bb02ff, 0x35234899, 0x618eabe9, 0xdfdd07be, 0x1b7092f1, 0x44931372, 0xb1eaf494, 0x3fcc3772, 0x711db168,
+    0x018cd961, 0x7e71c111, 0x8d11ae86, 0x6b9b3784, 0xe01145f5, 0x4064422d, 0xc1595fee, 0x160933c9, 0x2d7946b1,
+    0x0dc0afa9, 0x5e0d9019, 0x8c56a389, 0x97ab3c21, 0xae10fb01, 0x7dfdf8bc, 0x5fd1cf28, 0x623e8424, 0x1f0f4524,
+    0x24ee4f2b, 0xac1fac82, 0xdcf2fb12, 0xa7f46d09, 0xf55e9473, 0x92686e2a, 0xf1e31834, 0x653b6c05, 0xa74d83e8,
+    0x46111c09, 0x91fe97dd, 0x81916481, 0x19bfbcd8, 0xaece0683, 0xecd24d6c, 0x0a000608, 0x0fb2b836, 0x2bddeaa3,
+    0x04b2d797, 0x420c816d, 0xdf1deabb, 0x2132ab53, 0x1fb1be50, 0xe98f793b, 0x3489dcbc, 0x0f8829b1, 0x59bb3b9d,
+    0xf23cb106, 0x02a8ee46, 0x10566980, 0x43fc5ef2, 0x53f82e9d, 0x6091d261, 0x3604d77c, 0x9b8fcd43, 0x264895e2,
+    0xb7270762, 0x9cfc6257, 0xaa36c9bf, 0xce4aea91, 0xd00132c5, 0xd1042c65, 0x9f43739c, 0x6f218976, 0x9ced3b49,
+    0xb30b9920, 0x0bd6846b, 0xf6d6a9c3, 0x4aea8e05, 0xd8a8ea51, 0x7602c3d9, 0x246c2801, 0x157546ac, 0xea8e2b9f,
+    0xa6505ac4, 0x9992a20a, 0x226b467f, 0xa8c40276, 0xa081698e, 0x6bb3b587, 0x7407a323, 0xcd637d1a, 0x464289bb,
+    0x1772c27b, 0x9a9e7ce2, 0x9f3bb7ca, 0x47393e31, 0x15235f1c, 0xb7d1b47d, 0x1d0484c4, 0x1e6fcd1c, 0x84e20508,
+    0x3e0d914d, 0x306a2d51, 0x36f83038, 0x45abfd3f, 0xa5129977, 0x3c80a330, 0xa3179aff, 0xea2f603b, 0x68d1bb8a,
+    0x97084f99, 0x1d895720, 0x18f128c1, 0x7f714fbf, 0x78804925, 0x215166ac, 0x1a7b6cc7, 0x1a11ac7b, 0xe9869d43,
+    0x758ba800, 0x825c7173, 0x628891ee, 0xc311fab7, 0x235535fa, 0x4ddce492, 0x17264bb9, 0xc3026783, 0x2ead30f5,
+    0xb3d84ece, 0x45694859, 0xbf87d29c, 0x6ec18b40, 0x076fb909, 0xe8559203, 0x3bc6d02e, 0x507a54da, 0x830206eb,
+    0xfafc9823, 0x15f397e9, 0xfa7814d7, 0x0f0c234c, 0x74e87fa9, 0x1b45fda7, 0xc7432d61, 0xc3e7e56b, 0x8a612cf2,
+    0x1b7e8996, 0xe184c49f, 0x3037c631, 0xae6128f1, 0xd11d4f26, 0xbf0ccc57, 0x29154d2c, 0x17ea5282, 0x1eb96042,
+    0x32dbc192, 0x367ff089, 0x3e4062a8, 0x5c229832, 0x9a3209de, 0x9df74879, 0xf2b645b5, 0x8222fbb8, 0x89e72368,
+    0xbea4267a, 0x4b24b394, 0x94e0ff6c, 0x90fdea48, 0x8da628cd, 0x921a1129, 0xa691a11b, 0x43266e80, 0x7f0f75ad,
+    0xd62ba917, 0xebdf2333, 0x2b069558, 0x4ac78286, 0xcd7a09ae, 0xf62fdecd, 0x2cee7964, 0x8d4f358e, 0xbf59ecf3,
+    0x429baf00, 0x48dbcca4, 0x3d1f29a9, 0xddd6e316, 0x9c13f072, 0xf340efd5, 0x026d671b, 0xaceff9d4, 0xde1e8d71,
+    0x008596d2, 0x3b1b24c6, 0x6ca347e2, 0xe436392b, 0xa3cc1200, 0x8af66ff8, 0x5673b9c8, 0x83d7b347, 0x43863797,
+    0x856d8865, 0x52f3bf76, 0x8ef56884, 0xd3eb82dc, 0xe13fdf1a, 0x84f805b7, 0x72abc88b, 0xd4da8ceb, 0x635fcb6d,
+    0xb3b7c831, 0xc21e0a26, 0xf1f28ed5, 0xad20fc04, 0x1af09496, 0x7c15abba, 0xd96b8d95, 0xa723f95c, 0xa1e29cc6,
+    0x1555d746, 0xeb45522f, 0x67fcc902, 0x8fcb47ef, 0xda48505c, 0x75c19b68, 0xf037f3ef, 0x9f27148b, 0x022b41d7,
+    0x9fc5f022, 0x3814db5f, 0x3721ab99, 0xaaec519b, 0x3cb4be4f, 0x7c8129b9, 0x15f8c847, 0x47e0a047, 0x1578fd09,
+    0xe5c4996f, 0xa60da0ea, 0x7689489b, 0xb7ddb8bd, 0xd6a04ca1, 0xeb9eea2c, 0x87de447f, 0xd85e1ec0, 0x68ed4d77,
+    0x4fd7c3d0, 0x16804519, 0x6d9a1b50, 0x54bbeecf, 0x80947a96, 0x39f8701b, 0x52639fcc, 0x3eb677f4, 0x8a979be1,
+    0xf59bdfc2, 0x3e57925b, 0xc709ff74, 0x389a2e52, 0x8215a845, 0xd07d827e, 0x1dcb47e6, 0x44dbc6db, 0x91d14a76,
+    0x5752b1a8, 0x59cce776, 0xd50ff5c5, 0x8c739224, 0x12b58960, 0x7907ba13, 0xff9d6370, 0x7f64ffb6, 0x2b17df4f,
+    0x1a625a22, 0xd6487408, 0x41957b40, 0x61d14ea0, 0xfe3b18f3, 0x9494a268, 0xa9336805, 0x49bd093d, 0x565407d5,
+    0x8288fd2f, 0x5e9db215, 0x7594a980, 0xf29c229a, 0xe5b89f23, 0x9ed21fd8, 0xeac9e844, 0xb0f5feb3, 0xf3321082,
+    0x3c9cc813, 0x31554040, 0xd0fdb47f, 0xbc3f90ac, 0x63061f40, 0xce8e6f4a, 0x1a438be4, 0xcf8884d2, 0xc650f01a,
+    0x277647e1, 0xc5439248, 0x2871e657, 0x6747a086, 0x81d1244c, 0xefed2c7c, 0x0799cab1, 0xf56fa71f, 0x7cc868bf,
+    0x38723500, 0x45cef67d, 0x3649405d, 0xdffa9fca, 0x5ea29c54, 0x798d2dfa, 0x943849f9, 0x591d8f7c, 0xcbfce62f,
+    0xc19decbb, 0x98f0a74c, 0x8e43992a, 0x21965e93, 0x0abbf6c6, 0xae7bc0c3, 0xe6aceb96, 0x9cf8af4f, 0x94ce8d6c,
+    0x95764ee4, 0xfd329b77, 0x92ae2ffa, 0xf9ca1760, 0x2569c899, 0x3e48bda9, 0x2621fbaf, 0xe1123f1d, 0xdf60a3cc,
+    0x5e2bc02d, 0xae4281d4, 0x386cedbb, 0x4ca65755, 0xfc26f91f, 0x88568f40, 0x331f2259, 0x5e90e086, 0x93b505ae,
+    0x16c92d1c, 0x2bd83fd2, 0x67f9a4ef, 0xad9c85f2, 0x6b452cd7, 0x2c73097a, 0x19efed2b, 0xabf83fe5, 0x0db2903b,
+    0xe0ea9efe, 0x64459836, 0xdc0e804a, 0x346d1e16, 0x8956e13e, 0x9e2d7844, 0x3d7f52bc, 0xb18ddb48, 0x5fa6ea5a,
+    0x8fcb92d6, 0x73b24665, 0x6694150a, 0x801854e0, 0x245fe7ab, 0x038eda55, 0x07e3c1e3, 0x55d36341, 0xd381a1c9,
+    0xa1653cab, 0x19854b2a, 0x12811ab7, 0x28481a14, 0x272c08b8, 0xf929db52, 0xa4354e9f, 0xd9be7fa2, 0xa11ca3cc,
+    0xa00fe3a8, 0x46c2ad6d, 0xf17cb0a0, 0x4011ade8, 0xda95a177, 0x9bdbf54f, 0x5623411b, 0xca3cdfe3, 0xda1b3bdc,
+    0xf48c0b18, 0x7d788ff1, 0xb7656505, 0x6545ad72, 0xa05550e3, 0xf410fa6e, 0x853e367d, 0xbc703d2d, 0x49e3ae02,
+    0xc3fe2e7a, 0x44c64590, 0x0828251b, 0x86755ad9, 0xedf042d3, 0x98657c61, 0x74bec45e, 0x3ec0823b, 0x8cb69dd6,
+    0x30210b3d, 0xe8c95457, 0x92957c81, 0x90c9933b, 0x7d7bedbe, 0x906ee0fd, 0x97e83772, 0xa6ef68d6, 0xa7ab1e3b,
+    0x553518f8, 0x62fad740, 0x67149aae, 0x0a42c36d, 0x18bbdfdf, 0xa4baf3da, 0x1645f261, 0xe21fa7a9, 0xf7315c5f,
+    0xa4654fe8, 0xd2b1aed7, 0xf81fe581, 0xb586e19d, 0x61857558, 0x0db0ab20, 0x326d8954, 0xf12caeeb, 0x3a92f4e1,
+    0x3f7f0742, 0x47be0eb6, 0xb2cf5e8a, 0x8235ac98, 0x80cc9aa6, 0xbfcbbde3, 0x3353fbe8, 0x9189e281, 0x2d68edab,
+    0x1b0f606d, 0x5fc6ef64, 0xa0ebd164, 0xb8ef1721, 0x83b0b926, 0xb8c06320, 0xff45c4fc, 0x2b2fbab0, 0xc6452c47,
+    0x0312d4ed, 0xcf40ed7c, 0xf8509566, 0xb8727bd8, 0xd5e91940, 0x89123f21, 0x733515dd, 0x94d48d8c, 0x9f1e7edd,
+    0xa388c85f, 0x84c9667f, 0xbeaa6757, 0x971d9104, 0x0290f443, 0xc182a145, 0xd80d0be5, 0x5093bc04, 0x8683322a,
+    0x36c7619b, 0x4f951c68, 0x5f42a014, 0xa1e7a943, 0x27e52f9a, 0x63b85436, 0xa72715f4, 0xd9ee045b, 0x6f545da4,
+    0x4353b26d, 0x33ee4c83, 0x894ab7fe, 0x087ed6ae, 0x7f66c8b0, 0xa8956e33, 0x7032f6c8, 0x41d31469, 0x8265b2a9,
+    0x0ab6adf7, 0x487b56c0, 0xe29158bc, 0x073568a2, 0xfbb43ff1, 0xf9395927, 0x325dbdb9, 0x9b6b54fa, 0x064eb356,
+    0x7e52e5d2, 0xde767acd, 0x0aedd594, 0x548ab6b6, 0x1cbf9565, 0xb798e145, 0xbb170670, 0x6766c14d, 0xc339dff8,
+    0x2c680dc9, 0x41870bed, 0x373eb053, 0x5a003b57, 0x96e2865c, 0x61a15301, 0xd91a911e, 0x06949dff, 0x2ff818d4,
+    0xa31d45a8, 0xfc9f5a33, 0xf7b567fd, 0xbd8e6033, 0x149999b5, 0x94341a46, 0x2dbd8022, 0x9519cfe4, 0x2488f5b4,
+    0x763a5f60, 0x04d8080c, 0x88ad6b74, 0x817f611b, 0x52704b46, 0x4c555249, 0x64a1c4cc, 0x776a64bc, 0x43227bcf,
+    0x1ed3d3e6, 0x7e48a05c, 0x12291992, 0xa9698ba3, 0x51c14ecf, 0xa8b3b5e8, 0xf810268b, 0x23ecff5a, 0xe143e8ea,
+    0xe075cb1a, 0x9faeaedb, 0x83cf5d7e, 0xdd61d7f7, 0xfacc42b9, 0x79a15c96, 0xf3af4297, 0x5eabdd2c, 0x5db3bb00,
+    0xdda5ba22, 0xd095de89, 0x05b3c26b, 0xdf172f2c, 0x13fcb311, 0x6b984612, 0x7f3b4caf, 0xdd0271ef, 0xd0fcacf7,
+    0xbb689bd7, 0x8145b41f, 0xf761a3f8, 0x15c9540e, 0x95d6ad51, 0x48e89127, 0x118ad058, 0xf0eaf605, 0xb82a8183,
+    0xdd7b2ad5, 0x46624678, 0x5dee669a, 0x9de7392c, 0x40e01d31, 0xc7734389, 0x3d4f2f73, 0x732fdadb, 0x3f0d3e33,
+    0x24cbe961, 0x10350b38, 0xd27448a4, 0x59670dac, 0x498b1eda, 0xee121929, 0x48a658c6, 0x939cbe9a, 0x6b524b22,
+    0xdbf8bcdc, 0xffba7cb8, 0x98c9a535, 0x67721661, 0x764aa15c, 0x826a0dae, 0xa50f71d6, 0x5dfe5f3f, 0xb807d16c,
+    0x598b3f86, 0x1987755a, 0xd37fc539, 0x80d1c2bc, 0xc0a40594, 0xa2175a79, 0x79eeb5cb, 0x770b6e91, 0xff542ae8,
+    0xc7e83c57, 0x02632100, 0xb3c70377, 0xee336140, 0x89105797, 0xd81785c6, 0xa7145523, 0xc00295bd, 0x1174a551,
+    0xbcc36260, 0x9525366d, 0x0d29d8d0, 0xb8878333, 0x951bdf68, 0x0d13740a, 0x9b291a42, 0xfdc80627, 0xd847dbb7,
+    0xb926875a, 0x7136b488, 0x536ffb4d, 0xce7be39d, 0x9beb06f7, 0x5e303eab, 0x0b0244d5, 0x1cbb969b, 0xc0652244,
+    0x2ccd3df7, 0x17c4ee00, 0x07feafbc, 0xdd957f88, 0x7caa1cda, 0x7e6af46e, 0xfdc8f2fa, 0x25abc11b, 0x6025aaed,
+    0x79eb6569, 0x02e7ac8a, 0x304ed5b0, 0x896ccc3a, 0x2f621ef5, 0xb22e57be, 0xafd79ddf, 0x011eeaf4, 0x311fd643,
+    0xc703a762, 0x89e505a2, 0x16c115a2, 0x0891bdfd, 0xe26c6e95, 0xa7b3fb90, 0x5df8523a, 0xeb011829, 0x134d3a48,
+    0x1a25506d, 0x0a03ba68, 0xa6027317, 0x1a346762, 0x6ccae43d, 0x9eb304e7, 0x0fac1849, 0xf7d703f4, 0x5bc4aef4,
+    0xe98dd563, 0x2ba35970, 0x67b15f98, 0x60d72386, 0x4634655a, 0x8938f6f3, 0x0a5fa227, 0xeabbe333, 0x169914a8,
+    0x53a30f35, 0x164ad5fb, 0x3e58a9fa, 0xc7365072, 0x69b2b25f, 0xe0a7ed0f, 0x5e9380c7, 0x4a65fff1, 0x974c1a3a,
+    0x240f103d, 0xb7ac44a3, 0xc732598f, 0xc0b58db5, 0xb07ea775, 0xff83eafd, 0x7bc3900d, 0xea7d2792, 0xff4cc8c9,
+    0xf6cf1971, 0x15b17a13, 0xc349cc11, 0x634c15b6, 0x80533794, 0xe70084dc, 0x05df5c55, 0x2642ed59, 0x5406be65,
+    0xc7aeaae1, 0xc426955f, 0x316e23f8, 0xd06c8373, 0x36a6f2c9, 0x14181642, 0x73bcab85, 0x6ac876cb, 0xbb4b5f38,
+    0x52a9040f, 0x4bd423ca, 0x4f073fcc, 0xc71b0178, 0xfca0a25b, 0x8ffcf911, 0xfec5f6c7, 0x52d5029d, 0xf9cdee80,
+    0x7eef2085, 0x2f5f7dab, 0xcc3c632e, 0xea8f5f55, 0x7ccc3615, 0x5736bad7, 0xb1ee70c4, 0xd8e4c618, 0x9420df0b,
+    0x7d41dfec, 0x5718576d, 0xcd75c279, 0xc50472e5, 0xb63b0a7e, 0x6f5d1242, 0xc3b089d9, 0xc86a9a2d, 0xa8ad2d15,
+    0x5dc71018, 0xd16cc50f, 0xf986411c, 0x2829ec16, 0x81f17cf8, 0xcee5fd37, 0x0e13da88, 0x246998e3, 0x29dbf525,
+    0xcf920504, 0x4fa92c51, 0x4c22c890, 0xb7c96c54, 0xf3db3899, 0x924627e1, 0x1a4d84f7, 0xfb86a121, 0xc2fbc639,
+    0x329b71c2, 0xa62d6191, 0x245099dd, 0x5b68962c, 0x7d23d510, 0x00b44c67, 0xce3f77e2, 0x9ffb2201, 0xc78c71cd,
+    0x6e072dee, 0xcdf582e1, 0x1aacd81b, 0x1fdb27a5, 0xc508751c, 0x64ae3778, 0x41179da3, 0x4516d672, 0x11597eab,
+    0x33837c8a, 0x1f082c99, 0xa348a309, 0xbeda0b4a, 0x342b7baa, 0x443fb227, 0x73389c57, 0x86ef3779, 0xce037beb,
+    0xebeaa4b0, 0x4830b06f, 0x5adc2ca7, 0xc0565c2f, 0xb31ddc25, 0x2b05f7c2, 0x124c5484, 0xd0d479df, 0x14d4c2a3,
+    0x2ee855a1, 0x73ef664b, 0x4d28b75a, 0x9fcda8f0, 0xdb4c4ead, 0x123f2ff3, 0xa5d02a3f, 0xd7e89f7b, 0x0f0c5751,
+    0x16d7ebd1, 0xaae13383, 0xebad6216, 0xc3139fa8, 0x74d37415, 0xedf97e9f, 0xd3316472, 0xcdd17d8c, 0xf5bb7ba2,
+    0x89bf42e3, 0x83c9e014, 0x919fc821, 0x725cef59, 0xf4e03ec5, 0x7c7fea69, 0xf79d0533, 0x3be48132, 0xcce58c76,
+    0x5dffa016, 0xc2320c1c, 0x7c662373, 0xacc4da05, 0x5134e06b, 0xf2a8175a, 0x8457d508, 0x96155acc, 0x89fd7829,
+    0xc22b3f8a, 0x2e22b85a, 0x89efb2f8, 0xbba22261, 0x706600c7, 0xacb8a373, 0x01aa735c, 0x156baba0, 0x2e43cca3,
+    0xb1e90286, 0x9a8b95ad, 0x1c166506, 0x04d4629d, 0xe646b4a1, 0x7cd2a2d0, 0x72e8b1de, 0x78a4a1d4, 0x045fefc5,
+    0x55693f27, 0xe1535a8d, 0x2fa35478, 0x6acf67b5, 0x8bbb9664, 0x36902397, 0x7ebd5094, 0x014a9f22, 0x3e249290,
+    0x80d0e39a, 0x0b7700b6, 0x3bcfd87e, 0x259ba995, 0x5f9c47db, 0xa3f3843a, 0x8eccb330, 0x0a969014, 0x1fdc4c80,
+    0x1fd78674, 0x3959bd0f, 0xf2cdafd8, 0xb6317529, 0x57c148a3, 0x01b38bce, 0x63fa3599, 0x2b836672, 0xeeb8b979,
+    0xf3c418c9, 0x200cb1f5, 0xa81dd589, 0x34275470, 0x1d7219ba, 0x43c2d71d, 0xbc1af342, 0xe4033de4, 0xe91d12d8,
+    0x2e50b031, 0x521d7ff8, 0x899a5d7b, 0xe7b3e1e6, 0xd3895beb, 0x5b0e1aaf, 0xcae381f4, 0x5d7959a1, 0x10d0d8d3,
+    0x1f562b57, 0xe0c27f7a, 0xe68d4fbb, 0xab0e71cb, 0xd40eca39, 0x8011ca7e, 0xd19ee0f7, 0x179012b6, 0xdc20754b,
+    0xdd1912bb, 0x313bde0b, 0x9f5159bd, 0xfb2730b5, 0xabd32262, 0x12f59fa3, 0xc37a78bf, 0xcb3d2aa5, 0xf98ee8e7,
+    0xcd9de5e7, 0xedd0ffde, 0x637cb85e, 0x7f8ef717, 0x4a65feb2, 0xfe2da1f1, 0xb2a7c929, 0xe5113c84, 0x0bc06737,
+    0x2d774ac9, 0x7bac0ab8, 0x617f5aad, 0x03fd78ce, 0x6f266125, 0xd394915b, 0x6a4b7c43, 0x56b40dc4, 0xc5dde566,
+    0xec226d0e, 0xfce627b3, 0x037207f4, 0x6899ea88, 0x3674a3bf, 0x60f9c76d, 0x4c40c8e5, 0xec4e7dd9, 0x5670f0a3,
+    0xeffaaf7b, 0x6a060fdc, 0xfc47e40b, 0xb39ddfe9, 0x0dfb20ea, 0xa3bde803, 0x5169916a, 0x3cb4da42, 0x7d5b9fe8,
+    0xef905f11, 0x4e23b57b, 0x24a33ab6, 0x36ae50e3, 0x6b20a777, 0x245233bd, 0x99618656, 0x2dd5ba37, 0x7044eb91,
+    0x9cfb4b15, 0x60f3f5de, 0x10b3fab7, 0x184da9b9, 0x319662c9, 0x8fe09ac8, 0xd3e6a032, 0xca0b3da1, 0x537121ac,
+    0x86700573, 0x6b485f04, 0xcde77b48, 0x4a9c6b59, 0xad0d9429, 0xe350fefe, 0xae0f55bf, 0xf812fb76, 0xead8f64b,
+    0x1cd76508, 0x3c283d69, 0xb33584e2, 0xa0f030eb, 0x7c33b18e, 0x932b74f9, 0x404555b7, 0x0c1dbf08, 0x4b66fdd7,
+    0x630fedb0, 0x94151871, 0x803314d5, 0x44a1063b, 0xe8ad3d06, 0x295497cb, 0x08842ed8, 0x3dcb4bf6, 0x69b1f9ea,
+    0x1dd483f5, 0x4510a296, 0xafa632ee, 0x891a050c, 0xf98314a9, 0xb140348d, 0x7e9860db, 0xc4af6ad6, 0xc801399f,
+    0xb9e1bc2c, 0x2f11143e, 0xc46a4fc9, 0xe0cc2f5b, 0x3cd9e51d, 0xdf7b8319, 0xa5258aae, 0x63e851cc, 0x6b5d2024,
+    0x01b4ab28, 0xf118ec04, 0x409934de, 0x9a9725f9, 0xfddf711e, 0xfce44121, 0xafc09995, 0xeef28341, 0xcfe71839,
+    0x4eb8b166, 0x9e60f457, 0x46aa4f48, 0x9c0751de, 0x475911d2, 0x710e8413, 0xebcc2d41, 0x653f4faa, 0xf94d8358,
+    0x2645758a, 0x0b64d8e9, 0x340ab632, 0xa99a110c, 0x6d7b43a3, 0x18aa953a, 0xc0823410, 0x72e23e07, 0x75495249,
+    0xeaf2ddab, 0xe4a89e91, 0xbd484d5c, 0xde6dd471, 0x1190d934, 0xc950e578, 0x6e3cec13, 0xf5db11a6, 0xa13b9aea,
+    0x7624ab35, 0x2e3a2eca, 0xded7cab2, 0x3e9c560e, 0x2f39d836, 0xfc597fe0, 0xb4d01aec, 0xb22e3c28, 0x1ae327ec,
+    0x413af243, 0x68cfda56, 0xc5dd171c, 0xf3bcd89e, 0x9683f79d, 0x4476b406, 0x75b9516d, 0xd6e1fd5d, 0xd9da32c7,
+    0x3dd6c0c4, 0xe4142d47, 0x2bbf6e58, 0xb1f85ec3, 0x1df98f14, 0x65148f97, 0x196e9ef3, 0xfb9d9139, 0x8a8ca75b,
+    0x74f18b02, 0x0f91b46a, 0x9b3625f3, 0x5ae4f093, 0x1a96289f, 0xa29bd2a1, 0xa7ad79fe, 0xb0074a97, 0x45a19aec,
+    0xa963b1ba, 0xebe650f9, 0x1294e9a9, 0xdd675712, 0x052ad740, 0x4f14751b, 0x3b95f563, 0xc2b6d953, 0x9407f89a,
+    0xb65b6f0f, 0x64367ba6, 0x72a8e4e8, 0x8dbc07f6, 0xa8944c22, 0x3802146c, 0xc854fdeb, 0xe58a8fd0, 0x9504c94e,
+    0x33230c63, 0x044a1ca2, 0x2aa6a304, 0x2c493bf8, 0x4f566392, 0xc7f6c0c5, 0x3a611608, 0x132f4bb2, 0xd202f7a9,
+    0x9455a684, 0xb0cab826, 0xca3c8915, 0x0e090ebd, 0x5cf21128, 0xb2ea0000, 0xad29483d, 0x8c205b86, 0xc10bb0ce,
+    0xafb563e0, 0xadfdfcf7, 0x00a13069, 0x0081f691, 0x8e84c230, 0x39415adb, 0x2a524837, 0x271840d7, 0xd1a0d035,
+    0x1e6334d5, 0x767410f5, 0xb1d50c7a, 0x1a9b91fe, 0x96ec66c9, 0x7f4afd63, 0x0fbcdd6e, 0x635fc40b, 0x25b1a87b,
+    0xcb2bc0cd, 0xc172630f, 0xbae8440e, 0x29e9293f, 0x08f96a96, 0xb706db6d, 0x9b5dff16, 0x8deb51a9, 0x5a404f93,
+    0xe2b17517, 0xa7ac24e6, 0x8612ad35, 0xaf58e4d4, 0xc44ed014, 0x81f8a271, 0x06996be7, 0x6ea38b84, 0x9b7f707b,
+    0xa0854a05, 0x5d0ef0ed, 0x09e64747, 0x326c8ce7, 0xa020fdec, 0xe10cdf50, 0x0b776245, 0x68b0ebfa, 0x9cbdd122,
+    0x798f0738, 0xfd28635a, 0x63235b44, 0x5ddb6149, 0x94312f6a, 0x08cec433, 0x2784aadd, 0x78349b4e, 0xf9b4fb60,
+    0xcc2524d8, 0x49914894, 0x524e8d4f, 0x58829724, 0xfad2dee9, 0xca1e5dd6, 0x175300e4, 0xb4dfd4c1, 0x774175ad,
+    0x7a5f9a70, 0x694efbac, 0x6856c661, 0xdca8b288, 0xb0d2bef1, 0x6f7ccb4c, 0x77ca4155, 0xb9a0dba6, 0xe379cb4d,
+    0x054d08a2, 0xc039c975, 0xc96f1e05, 0x3105667b, 0xf754c68e, 0x7047d9b1, 0x4bc95222, 0x5fe94b32, 0x028ca97e,
+    0x077b9706, 0xddf299d5, 0xc94ba3d5, 0x7d80321c, 0xf1c7e1c0, 0x7307e4b3, 0xb7d8da39, 0x4b661761, 0x9811b60b,
+    0xc9f8652f, 0xed7affc4, 0x9d42d35a, 0x9b8abf22, 0x6c883279, 0x49d8db53, 0x38053dd8, 0x9c730dd9, 0xf42a57fa,
+    0x9beb0ce0, 0xcc490411, 0x7a80c95e, 0xf91b8dab, 0x20b023a3, 0xa807ada9, 0x0240d541, 0x123ae9a5, 0x89e4d6fc,
+    0x5cb616d1, 0x12dd6b72, 0x335cc2d2, 0x29edea2f, 0x8ac73ce3, 0x17467d2d, 0x26e8554f, 0x5c4bdf24, 0x7fa43581,
+    0x723752f1, 0x9895a6fa, 0x4db300d1, 0xdd7fa02f, 0xa52eb6aa, 0x4669a112, 0x0c41d249, 0xd7761fa1, 0xb2efee7f,
+    0xd1c2893a, 0x1fe24300, 0x26d2b453, 0x5ba39f6a, 0x07eaefc9, 0xefd0f2b1, 0x67c5013f, 0xf51ea625, 0xba3255fc,
+    0x19f1da6b, 0x9f1c5cf4, 0x697059ef, 0xf6eca19f, 0x6dc9fa5c, 0x600b9197, 0xd154dcb3, 0x23041617, 0x8258bbfd,
+    0xe24ff10b, 0x393b39f7, 0xa2226064, 0x5d4a97b1, 0x4bab76a3, 0x583c24cf, 0xc15c85f5, 0xa07cf771, 0xfdd52328,
+    0xc9578f29, 0x88ff3e81, 0x71ccfc4b, 0x8231f7b4, 0xc2d4c226, 0xc677149d, 0x4b074c4c, 0x7617bb36, 0xc267ebb0,
+    0xdb186713, 0x8a047329, 0x349fd525, 0x4a3b9daf, 0xfe788e7b, 0xb19be589, 0x00b5b591, 0x4ce60ae9, 0x55f44fe3,
+    0x50b59730, 0x268e1b55, 0xa7ce2003, 0xa48560ab, 0x266e6881, 0xe2c25276, 0xaa90b378, 0xe920ea01, 0xa1950dec,
+    0x1aad4e21, 0x7177a5e6, 0x048f665d, 0xe78a1bec, 0x3cd8fc35, 0x8cf59658, 0x930649d9, 0xf63c9499, 0xbf1ace10,
+    0xcec1a4c0, 0xb463e04d, 0xfb25c6cb, 0x7c69fee6, 0xa3d19b81, 0x10c3e571, 0xb2f28ec2, 0x038fffc8, 0x70814427,
+    0x461262ea, 0x94d9988b, 0x1c36c533, 0xe3488414, 0x4191bba0, 0xa8d43335, 0x2c950ee4, 0x7a442f82, 0x7a707ef3,
+    0xb87efe92, 0xe41cdf5f, 0x489c7917, 0xff943963, 0x24d85ffc, 0xdb7b8193, 0x2d77b06b, 0xadeaa601, 0x5d8c70ed,
+    0x11c5c57f, 0x087d6e7e, 0x7a0d7f2c, 0xe7ee1f22, 0xee61c1c8, 0xb6704c5f, 0x0a13f16e, 0x94310dc3, 0x269672c6,
+    0xef50b53c, 0xe9816a71, 0x26a4270b, 0xab1aba31, 0x44b3fd4b, 0x3cf1971b, 0xc8e12baf, 0x8ac02f9d, 0xc0353ad1,
+    0xd9a172c2, 0x4bd33634, 0xbbf87a27, 0x033d87da, 0x13a9c83d, 0x02c26230, 0xa58999f5, 0xf93e81c9, 0xc36c65b1,
+    0x386b4e91, 0xbd136d57, 0xc72ab3b0, 0x66aa2d68, 0x7a2805fc, 0xd4f5a3ea, 0xd4472728, 0x769f519a, 0x8aaf34dd,
+    0x04cc412f, 0x767a07d9, 0x3f8aaeb0, 0x4e6a98e0, 0x78f5fabe, 0x250ead22, 0x01f85e16, 0x29b4e856, 0xe1fa7d06,
+    0xa22b013b, 0xff75263b, 0x11d91a48, 0x1472bd96, 0xa935741c, 0x1836ca84, 0xe1c34720, 0xb3e76b78, 0xa1bfe52c,
+    0x30ce9af0, 0x14220d9e, 0x8e4cb6e7, 0x6c8ed755, 0xd5ce5efd, 0x47afbe04, 0xe5a9631c, 0x2de1a575, 0x84537dae,
+    0x97c54dc9, 0x9fb87350, 0xcdbce44b, 0x155b09ff, 0x44ef97d8, 0x3bbaa1cb, 0x2c74113b, 0x1c631907, 0xc5fc41bb,
+    0xcaa93c89, 0x3c07eed7, 0x2ff2804f, 0x0d41fdbb, 0x7612f855, 0xc5d02ac6, 0x87eb39fb, 0x92f37e01, 0x2f27e971,
+    0x244f68ca, 0xfec9ab21, 0xef504068, 0xb69c2aab, 0x60b69d7e, 0xdf7d6312, 0xf970a4d2, 0x1dbc553b, 0x29765167,
+    0x1f79bf9b, 0x5893648a, 0x88c29a66, 0x01e7e082, 0x9b67e839, 0xddbfb267, 0x8f80a214, 0x2c90d8fe, 0xd6f4a082,
+    0x183935e1, 0xe7c070b4, 0xe082632b, 0xa2376011, 0x353aa102, 0x25517d83, 0x9a6a57d9, 0xa32d20e9, 0xb0599dc3,
+    0x36db0dc5, 0xf387473a, 0x3aeeadbd, 0x1b426d1a, 0xea15edd8, 0x7da0511a, 0xfc656666, 0xeae0688e, 0x68ac57d7,
+    0x5f1ab182, 0x2bafdb3e, 0x4d80c845, 0x0c92b6f8, 0x3d53d96a, 0x90c15034, 0xb83d6275, 0xa15bfaa1, 0x5813721f,
+    0x443e7983, 0x545a3fa9, 0x2bef59ce, 0xa6c5ac93, 0xb90e1cb0, 0x06b217e9, 0xefd35dbc, 0x18ed17d4, 0x4adf3222,
+    0x798509eb, 0x78ced4d4, 0xb9a57ae3, 0x146f92af, 0xc6cf6404, 0x97e53463, 0x5c758d87, 0x24469991, 0x2721e399,
+    0x78573714, 0x8bf79231, 0x2e093039, 0x39b809aa, 0x324e68f4, 0x610bf13d, 0xaa8b87ab, 0xf5a42b63, 0x027dad81,
+    0x059d2e8b, 0xa3e592e9, 0x9ffcb919, 0x1fae59ee, 0x5172b6d5, 0x015a2ca5, 0xd727b270, 0x47964d73, 0x38a3d6e0,
+    0x0ccd1d35, 0xae44ad12, 0x090b9e43, 0xf1f37666, 0xbd39e32e, 0xd265273e, 0x547aa12e, 0x9b1fb67e, 0xae7b10c6,
+    0xe964def0, 0xba218074, 0x3630960d, 0xf6a891e4, 0x0e030a55, 0x0ebd72bb, 0xd7bb1ea4, 0x4b7803b9, 0x98ea9e15,
+    0x5cddd3d8, 0x956bc0cf, 0x4908e4ec, 0x0f338087, 0xb8264cd0, 0xb457479f, 0xcea61b58, 0x48e79423, 0x1b4aab8e,
+    0xf1fbb879, 0xf338fd04, 0x20262379, 0xef31ffbc, 0x54f33409, 0x6d15f7ed, 0xbf990b6e, 0xfabaaa77, 0x186c1cf3,
+    0x8c91c310, 0xb184c265, 0x74956eb8, 0xd0f5e05f, 0xb7088bc8, 0x00078891, 0x8969a79a, 0x27068259, 0x297f6181,
+    0x70577e46, 0x9e34d951, 0x54b60165, 0xe24a64e3, 0xf8f37464, 0xb843d994, 0x071ff01d, 0x5d49e773, 0x53fbefab,
+    0x3b58eeaf, 0x0df24287, 0x3f13c400, 0x72b5c381, 0x69521bbe, 0x8e8e031a, 0xb757b75b, 0xa4a40d30, 0xe4a673d5,
+    0xc7fa833a, 0xda966abb, 0x71b221c1, 0x18411bf6, 0xedb7a53f, 0x96e2c568, 0xe8fee27e, 0x9938d874, 0x9bf1cf7c,
+    0x556df0b2, 0x6fbfce00, 0x34564bac, 0x0348fc6c, 0xde545610, 0xc52f7502, 0xf63ba9d2, 0x5a4128a8, 0x7fa8eae7,
+    0xcd99a8a7, 0xf30d39a5, 0x3c5f410e, 0xbce80a14, 0xb939236b, 0xe41fe00e, 0x26bd7e7f, 0xda5b8858, 0x44912c05,
+    0x9ac4e5b2, 0x6dfe0649, 0x4045792a, 0xc4c99ce3, 0x5fe8b1db, 0x148366db, 0x6313caee, 0xbb62aa85, 0x7ea4c6cc,
+    0xed51571b, 0x4469ffbc, 0xef01e316, 0x0420c5df, 0xe0c83fba, 0xedf88321, 0xf7f57064, 0xf5a6ea8b, 0x6032044c,
+    0x069927d4, 0xb03b4efc, 0xdfa9daf3, 0xde5b0b5f, 0x98d7dd2c, 0x47ce09d4, 0x3c3e85ed, 0x39af128e, 0x527913bf,
+    0x82a77b01, 0xcfde42a4, 0xaf151efd, 0xedbe6d02, 0xfd1af95d, 0x0ed3dc96, 0x2bd228d4, 0x48d89856, 0x4be61d17,
+    0x4a1e61e6, 0xf9569767, 0x786c6695, 0xea535d99, 0x9b4e73cd, 0xe6b87295, 0xab08b3cb, 0xfd3c9b65, 0x1847f377,
+    0xf5813e87, 0xb64d56ff, 0xc4e742ad, 0xf0efbd5c, 0x28fd6417, 0x6e543767, 0x71a43397, 0xb3987ad2, 0xd30d76d0,
+    0x8ddc206f, 0x66893973, 0xc179deaf, 0xd71abbf8, 0x54f1d7f2, 0x879968d5, 0xde55a950, 0x80dffef4, 0xa13943ee,
+    0x2ccd6c7a, 0x32c9cfbe, 0x790bd750, 0xa4f59fbd, 0x2db7aabf, 0xb803f83d, 0x2ce297e2, 0x48190124, 0xada47fdf,
+    0x9344aa0b, 0x6cf59dd4, 0xb5dca967, 0xa5be7481, 0x4beb4f01, 0xccd4c6ba, 0x31a2697b, 0x07123cf0, 0x277c0f64,
+    0x08687e61, 0x71a431c6, 0xb0765cc8, 0xcfb7cc8a, 0x235278b8, 0xecaab3fc, 0x3a6a96b2, 0xd5ee6f21, 0x4d9e8585,
+    0x164dd6c9, 0xfc5e27cb, 0x828ee442, 0x0409d50b, 0xb877cb19, 0x374e39ea, 0x8ca8565f, 0x7cea3fd9, 0x178ba593,
+    0x2d31d820, 0x4118b914, 0xc218dc21, 0xcef8d0be, 0xd05fd8bc, 0x45aaec72, 0x7be792fc, 0x11fac0dc, 0xb83aadf9,
+    0x43293306, 0x5d93e966, 0x423ee537, 0xfe5d203e, 0xd96305af, 0x5330f299, 0xfc9c501f, 0x45de9115, 0x3dfd1e47,
+    0xb74d6cff, 0xa95d71c6, 0x3e99b10a, 0x6fd1d94c, 0x0626e5b8, 0x8f6aae77, 0xc03494f3, 0x0ba6558b, 0xbb605d59,
+    0x51f972d4, 0x5fa46215, 0x2b6a0a2c, 0xd132fdda, 0x1d2587b3, 0xd3dddbc7, 0xd163f05b, 0x597caf86, 0x1c6da68c,
+    0xe4aa6126, 0x8cd2a5a1, 0x18384612, 0xa3dd8fef, 0x7f30557f, 0x235fc5b2, 0x705967e5, 0x493edede, 0xd550f9f5,
+    0x00047350, 0x60eda8f7, 0x898c348c, 0xb2bf9cfb, 0x56d6654d, 0x1c0cfb6e, 0x6d1cee5c, 0xd6dea805, 0x3a1ae3a5,
+    0x685b46d8, 0x36b88463, 0x7cdc7adc, 0x4b7c5d28, 0xf95b6d14, 0x7d7d5c49, 0x0884c5a2, 0xb133eeff, 0x317ac6ae,
+    0xdb27a303, 0x70661a56, 0x9702380b, 0xe2397683, 0x62912a1c, 0xbe2cdb33, 0x4bab6ce5, 0x4e17e467, 0xea379ff3,
+    0x8412c4db, 0x216a936a, 0x527286db, 0x32cd694b, 0x5b2d6451, 0x79c6276f, 0xc47dc592, 0x03646a5f, 0x4a5946b0,
+    0xac12c0c5, 0xd0458bc0, 0xb341bd9d, 0x937efefa, 0x0846cea4, 0xf30c8c9f, 0x61c64d6a, 0x8d21a682, 0xbf9b8ec8,
+    0xa61ae3e1, 0x1ba79c39, 0x767f7716, 0xce09e72f, 0x9ddb23e1, 0xc7185c88, 0xfa4c52a8, 0xc019e935, 0xe06e3571,
+    0x9589254e, 0xf5daf63e, 0x9846c274, 0xef6d73fa, 0x852d3508, 0xf1085391, 0x9cd34c00, 0x3100789f, 0xfd3a07d3,
+    0xf238cef5, 0x7d9d32f9, 0x199d306e, 0x73330bad, 0xac8d10ed, 0xf89eea4b, 0x8a89fb16, 0xf60ba8d6, 0x69a3112c,
+    0x854b46e8, 0xbba9d5a2, 0xfdf4e7ec, 0x0dec40f6, 0x10b1cdfc, 0x2e2116eb, 0x06979fb7, 0x6eb121de, 0xbb5d6f70,
+    0x14dac746, 0x924a87c6, 0x03113267, 0xe86a3989, 0xa91cf08f, 0xb92c9b15, 0xb46507a3, 0x14b41a77, 0xd6843685,
+    0xc9e4a54c, 0xcd05a677, 0x0f527428, 0xf97ef9a8, 0x87055796, 0xc4cfc208, 0x790b1a41, 0x0c44da7a, 0xc57c264a,
+    0xea25a923, 0x29dafffd, 0x71230ad7, 0x6b713d6f, 0xe2f8651f, 0x5482c23c, 0xa1aba175, 0x4aad66c7, 0x16db6575,
+    0x21335125, 0xa9e5cec5, 0xad9435c3, 0x54b2d379, 0xd8e31642, 0xb9fd41f0, 0x387dcf1d, 0x175da749, 0x9611fc2a,
+    0xbc5c0859, 0x4b0fe475, 0x90dfe29c, 0x62cb8daf, 0x74ebda01, 0x28d544ef, 0x0e24c82b, 0xf3f5e8b9, 0xcfe7edc1,
+    0xfd4db37e, 0x04311091, 0xc9eea1ae, 0xecdfc043, 0x6cf3c473, 0xec17079b, 0x00dd38c5, 0xd32056b3, 0xca390b14,
+    0x11caf1e9, 0x30d027bf, 0x46ee4bdf, 0xee3cbb7e, 0xd6fb83cb, 0x882667d7, 0x9fb75b6c, 0xf60736ac, 0x92ffb1f5,
+    0x941ea54f, 0xbc3b5847, 0x5239d4b0, 0x193fd05d, 0xdc70d079, 0x9394b965, 0xb0f71470, 0xff24639f, 0xcf09fde8,
+    0x2703817d, 0x1988fd73, 0xd3811142, 0x5f6ef91f, 0xadadaeb7, 0x0ce9e655, 0xf9ad22b9, 0x05d258c7, 0xf428c16f,
+    0x68c3bba3, 0x68304c8e, 0x92c5febf, 0x5e9fa69b, 0x4732086f, 0x9ed2c3d6, 0xd5536471, 0xcb91d81b, 0xb8e40e48,
+    0x6829068f, 0xeefc11f9, 0x578d90cc, 0xe9e16c64, 0xc2f30800, 0x85e27e56, 0x3476f551, 0x6a858aad, 0x25e2bd5d,
+    0xb2b7df04, 0x33865c03, 0x182d0a2c, 0x5787a074, 0x56f395a5, 0xe04c53c5, 0x2be82e24, 0x7d315f73, 0x9aaf3a80,
+    0xe2778fdd, 0xf6895fa8, 0x9d40fa61, 0x4ac62b99, 0x1c1e159d, 0x634887e5, 0x51d0b754, 0x0148a880, 0xd44e1087,
+    0x7272e49b, 0xb136f745, 0xb38e698b, 0x553074bf, 0x889a4b78, 0xb9867280, 0xdb9f326d, 0x86aa6a46, 0xcee0431b,
+    0xeec864ee, 0x53dc5543, 0x50b57623, 0xc549ff55, 0x61c9aa21, 0xe160e423, 0x22b9aaff, 0x6dda8a55, 0x54621c9f,
+    0x0d2350c4, 0xb8b8302c, 0x334936f3, 0xadec82b6, 0x915909e9, 0x6191df35, 0xd4942f4a, 0x478d2245, 0xa541e3a1,
+    0x672b54c3, 0x9f018e66, 0x2a683a04, 0x6a0d80a9, 0x5888feed, 0x62616bf1, 0x6d98fe1d, 0x4fcaad93, 0x0056ea79,
+    0x748b270a, 0x454f0925, 0xe44c6fdc, 0x198ecbea, 0x8f715f81, 0x12c52006, 0x6e616abc, 0x8012cf70, 0xebbad99e,
+    0x23439da6, 0x9e2b57d2, 0x7f5261d5, 0x50dcb0b8, 0x84ea069a, 0xacbb40dd, 0xcb5b3c7e, 0xfcf5ea8f, 0xa4874839,
+    0x253665ea, 0xa7ff00d7, 0x993ab984, 0x3cd83cfc, 0x8a741bda, 0x9c1222f0, 0xc046bcf1, 0x3d5e16d6, 0xa28b8c52,
+    0x8b33a6a7, 0x912455b8, 0x179f3705, 0x7cc659ed, 0x7c7c29da, 0x9741a1bb, 0x80f65b96, 0x4a2cdd9d, 0x579e86a9,
+    0x840ce2e4, 0xfa5e7d01, 0x35475240, 0x3da54639, 0x9ea498d8, 0xb3884360, 0x790d8d63, 0xa4aa629e, 0x459c32eb,
+    0xb755eb7f, 0x76895fcc, 0x1ada1d75, 0x0c281fb0, 0x66544aef, 0x69166910, 0x0a4cefd0, 0x8403b204, 0x2b80a86f,
+    0xfae3e9a0, 0x46ae9817, 0xd5a91cc9, 0xb4f992bc, 0x468cc4b3, 0xa968ccdb, 0x2797c8bd, 0xa25aa978, 0x8bb185f7,
+    0x6eb9730b, 0xb60bc93a, 0x3dc9ef31, 0x93e49e3d, 0x2d1a10b4, 0xc3a3f1e1, 0x27b1b376, 0x653ba138, 0xc4487757,
+    0x1971cfcf, 0xefd13767, 0x2e9fdd81, 0x171485a6, 0x7ee05844, 0x210309cb, 0x42d72633, 0xbb0136b4, 0x1bb08815,
+    0xd32ee52a, 0x55b72eef, 0x4685510d, 0x9eedcd41, 0xefe69359, 0xc86ea3ed, 0xa845d71e, 0x10bab1b3, 0x356818f3,
+    0x524da4db, 0xce784afc, 0x9a458226, 0x7f4f9fc4, 0x7f3f0183, 0xcbab3805, 0x3a5d25da, 0x5b35a6de, 0xcca03c76,
+    0x6bbda4e1, 0xdfccc551, 0xe9382f39, 0x77f2fbed, 0x0cdd4de6, 0xefb20d8f, 0x9b759f1a, 0x8e707219, 0x9c825558,
+    0xbb813ac4, 0xdeae04aa, 0xae403f6e, 0x047144a3, 0x6de0e5b8, 0xcbd0d1d4, 0x3ad42111, 0x4dd33b25, 0x86ed77a0,
+    0x0a592ef7, 0xc8b44f55, 0x61d182c9, 0x5b3bc0e3, 0x8e9627fe, 0x8487772b, 0xea7bf55a, 0xc7170c9a, 0x282dcd27,
+    0x5a95cdc5, 0x5060f106, 0x74a0f688, 0x6543db20, 0x79f5b677, 0x32c63235, 0x62acfcfe, 0x4c65f58d, 0x0b3f10c4,
+    0x25c631d0, 0x9ce4ab72, 0x07005b89, 0x405756e8, 0x16e9411b, 0x33fc8a3d, 0x0e19e5ed, 0xf58209f7, 0xa0683973,
+    0x0dc0760a, 0x506d8089, 0x89a54ae9, 0x73313c1c, 0xe667c101, 0xffdd78d9, 0x13e3d8de, 0x80e85e87, 0xbbc16377,
+    0x64b4e947, 0x46043dc6, 0xd6ba03a7, 0xc6e9ce0f, 0xad93db29, 0xcce5852e, 0x00335e26, 0x05abc57d, 0x84fe0a7a,
+    0x23ebd346, 0x986f33cc, 0x7efbcfab, 0x57b52a96, 0x9073f503, 0xa13703ea, 0x826c0371, 0x1e5af877, 0x732a1fe0,
+    0x3e9b113c, 0xababd3a2, 0x54280723, 0x60d5c381, 0xa8dc52c4, 0x4ee40621, 0xadce92e4, 0x1e4b152b, 0xfde29102,
+    0x37aa48ff, 0xe18d14b9, 0xe91822aa, 0x8c4c6a90, 0x488049cb, 0x2d773f95, 0xb5228d4c, 0xadb8fb7c, 0x82fb3826,
+    0x014d030d, 0x4baba8f7, 0x27134297, 0xb25f3adc, 0x7ef97a0f, 0x1db5aeba, 0x3f9a0815, 0xb0de6477, 0x36b6f886,
+    0x7246c8bd, 0x19d37964, 0x4e389278, 0x9288ba1f, 0x5e50cfe2, 0x87955167, 0x53e42131, 0x3a1e0f5c, 0x50f179d3,
+    0xa0d04db7, 0xb904d114, 0x621113e3, 0x975f9d32, 0x7828d621, 0x9ff17e6b, 0x8277c830, 0x3705e11b, 0xab796624,
+    0xeff9daf8, 0x168294ae, 0xa6c34680, 0x07f7f9c9, 0xacf87f5f, 0x7a7a3e66, 0x6f7be7ae, 0xc2ed828a, 0x3016d642,
+    0x2014c3f3, 0x344929be, 0x62b1af61, 0x4fa24e03, 0xb4124ce6, 0x639a9829, 0x3068d40a, 0xb0b6e092, 0x2a4306c5,
+    0xd98ffad2, 0x058a771d, 0x31b549df, 0x478bcfe0, 0x737d6cfd, 0xf807b77e, 0xb64e8042, 0xe7174ba2, 0xce347660,
+    0xf17dacca, 0xdc474a92, 0xbbc86642, 0xab10f5be, 0xe4007804, 0x7bdd659e, 0x962e60ff, 0x32e3605c, 0xd92e57c8,
+    0x40c89aff, 0x1d3455ab, 0x64bff5c0, 0x5c8e591b, 0x8dd85927, 0xfa6553ef, 0xad52435b, 0x731ce398, 0x50357bd5,
+    0x05218309, 0x47e06c2e, 0x91c93eab, 0xa8786347, 0x3ba0ffdc, 0xc8ff386f, 0xef56a5d1, 0x9db81bc0, 0x72574a31,
+    0x5d3b7e2c, 0xb0778b53, 0xe2745e2b, 0x523bb181, 0x93e343f9, 0x2cadb938, 0x1ec2e849, 0x9ba90676, 0x3c2a4e8a,
+    0x323783ff, 0x6840c356, 0x3bb316bc, 0xa977aa8e, 0x801d8dca, 0x43c33350, 0x7a36b565, 0xd26fc964, 0x4f7a5ead,
+    0x9e611163, 0xa77adf3c, 0x27a9cbb8, 0x93aa349f, 0x15c112b7, 0x84b18c72, 0x17e06b22, 0x3369cdd3, 0xfa5b783d,
+    0x813eeebb, 0x74057940, 0x6061c82e, 0xbedb61b0, 0x13ee521d, 0xe3e18f46, 0x624685e8, 0xa573217d, 0x5a145657,
+    0x96129557, 0x5e82b3ef, 0x39457d7b, 0x5a620bad, 0xa6181130, 0xc82e6338, 0xa245fd7c, 0x47b50a1b, 0x636aaa88,
+    0x58b473f7, 0xc417ebbe, 0x30ef8bf1, 0x44900e7a, 0xc7036e75, 0x92a90db2, 0xa1ad8ab0, 0xb0811407, 0xc37a21e2,
+    0x3cf216f6, 0x24dac32b, 0x264da0ca, 0xc2b7db0f, 0x4eea9f20, 0xea9f5577, 0x6f506eb5, 0x78f6271e, 0x8c9f0626,
+    0xdfe7b74f, 0xd4aa3c67, 0x6ee5c48c, 0xa59f7919, 0x43b62284, 0x5cf9bc84, 0x637a21fb, 0x7ece4d16, 0xb2111b34,
+    0xadecd27d, 0x3a118b2f, 0x334f731a, 0xcd15ad1a, 0xceb32e95, 0x736431bc, 0x101f00d1, 0x99281993, 0x6db7847a,
+    0x001918f4, 0x99db18ab, 0x55fb8584, 0x1d98167c, 0x49c7645c, 0xb118e260, 0xd562eb11, 0xe8bcd250, 0xf75e56f7,
+    0x9dc94ec1, 0x93c32394, 0xc057d41b, 0x6ee6de5e, 0x071680b2, 0x41c21e5b, 0x9009f6f4, 0xa48fbe6e, 0x5e12eddf,
+    0xfba01c61, 0x12c41121, 0xa11c9c86, 0x7e6ce5cf, 0x528b4f3c, 0xd4bf4c54, 0x8968a0df, 0x49bc637c, 0x176d0a53,
+    0x90f82fbb, 0x26a654c6, 0xa004d3a1, 0x17908792, 0xc7d56976, 0x14df05e9, 0x9c3974af, 0x3df8b15a, 0x84401cd3,
+    0x15c38bf3, 0xc1b100e1, 0x27eac0ba, 0x79727d23, 0x03a85748, 0xa9dd8be4, 0x253768d2, 0x7ea73633, 0x2115b732,
+    0x06fcb210, 0xa7c67140, 0xd634004c, 0x3579a5b5, 0xff62a308, 0xf6f75e3e, 0x04aa27f4, 0x20a93d90, 0xc572f46a,
+    0x0ce45d07, 0xd39bd305, 0xfd9431fd, 0xa796fe2d, 0x4d14bec5, 0x3b9913be, 0xd941a640, 0x0e60adc9, 0x7289d239,
+    0x4ecafa17, 0xcb4e4685, 0x5404ee7d, 0x48934c33, 0xf12e0d30, 0x4f02ee0c, 0xcd549cc0, 0x376b113f, 0x92cfc00d,
+    0x7443b688, 0x010d393e, 0x05cd5445, 0x4cf10eb4, 0xab784b1f, 0x92a773a5, 0xaa7fb427, 0x95238016, 0xaf073793,
+    0x7f68b530, 0x3fabfd3c, 0x0b452d7a, 0x6a2d1da6, 0xe9d8a40b, 0x19417553, 0xf0e3ce7a, 0x15c02cf2, 0xfb25c1bf,
+    0x09d0cb02, 0xdfcac66f, 0xea1d4b1a, 0x82df9873, 0xee93fe60, 0x9f029a9b, 0xa7ca8145, 0x1c1b7cce, 0x62200121,
+    0xf299562c, 0x3f112e6a, 0x0bbecd5b, 0x503a7932, 0x5abcc742, 0x2ef4ad89, 0x4209c791, 0x4cc557ae, 0x7d9c887f,
+    0x49d5be48, 0x5ca13837, 0xecd10bb5, 0x0c981dcf, 0xa775ebba, 0x24c54874, 0xe362e829, 0xcaafb84b, 0x721358fe,
+    0xb11b72ff, 0xd480f960, 0x0ae2a785, 0x139de0f7, 0xa6ff8162, 0x42582540, 0xefea8084, 0xaeb83774, 0x130a8a6a,
+    0x6ddc6405, 0x3e604c94, 0xd73f7111, 0xd309b5ae, 0x80918eb9, 0xc9f14a46, 0x07688f53, 0xae85d3b6, 0x0778ed83,
+    0xbf5c1f3d, 0x97d5b559, 0xa71e3541, 0x3246b075, 0x48927996, 0xd9b86d6c, 0xa413c81d, 0xdbc47107, 0x6fd0709e,
+    0xe2701f45, 0xc6aa9aaf, 0xb7e9056b, 0x2c36a1b5, 0xdb43b1da, 0xace3395c, 0xb12c7b85, 0xf2102945, 0x6750243b,
+    0xf6ec565d, 0xabb7058a, 0xc2482ef0, 0x5f8ef9b0, 0x504d970b, 0x37418cd6, 0x394333e1, 0x3c235d07, 0x90bcb4fa,
+    0xf8d62ce8, 0x6ca4401b, 0xf79b193c, 0x94b9720d, 0xff59766d, 0xbab11dba, 0xfad51067, 0xb4dfc4a8, 0x3971e161,
+    0x944f0905, 0x4a1b10d2, 0xdde26e2b, 0x1e159399, 0xd7e6717b, 0xbb6c6b92, 0xfd6095fc, 0xff46d90d, 0xb9d6fee2,
+    0x13abb0ca, 0xec0269d6, 0x136b6500, 0xf3750f41, 0x3944f66e, 0xf2c41534, 0x54f47c7e, 0xbc558126, 0xa093c0aa,
+    0xba437e55, 0xa32b43d4, 0x1dbd0032, 0xef708859, 0x2bb65fc4, 0x6315623e, 0x196f3cc4, 0x5e4e07f1, 0x18e9380b,
+    0x6118cf04, 0x81b8fee3, 0xcb1674b9, 0xb33849e6, 0x676f041a, 0xc1993807, 0x5acbbf02, 0xf9797ba2, 0xca6fce93,
+    0x6091734c, 0x7ec3bcf7, 0xe24e77c1, 0x7f4c97d4, 0x9397878f, 0xcd616229, 0x68cf030b, 0x60565826, 0xe05671cb,
+    0xe9caac2e, 0x7e1e0c5d, 0xc32f1de1, 0x01dd665e, 0x36160645, 0x785074af, 0x4b540a42, 0x1914bf9c, 0x88a7680e,
+    0x4b90d3d2, 0xa3252dda, 0xe82ba8b5, 0xc4c5fd12, 0x20ade882, 0x75fe14d1, 0xa2891ec6, 0xc79d24fb, 0xbaa4383c,
+    0xd2ec5133, 0x03d95f57, 0xc10a9e9e, 0x62c4d38b, 0x2f77bc6d, 0x4200aa86, 0xa3c48fed, 0xb16abe7d, 0xb6c05f94,
+    0x95400204, 0x3018328c, 0x2eb159fa, 0xd8c1fdde, 0x639efd9a, 0xfeb7bc60, 0x16f33222, 0x7fbe769e, 0x3adaacfa,
+    0x2dd03b8c, 0x48e98daf, 0xf844b0d2, 0xf30be6ba, 0xfba2d03f, 0x2009e6b9, 0x6872a5e9, 0x6592d677, 0x8c701033,
+    0x518cf301, 0x5e9d3b0b, 0x06a5d9bd, 0xa78799c9, 0x965e784f, 0xc32b1d64, 0xbb1b50ad, 0x176c5632, 0x0e852e22,
+    0x755e424f, 0x3ce63ad7, 0x830ee494, 0x2be2045e, 0x5208efb5, 0x9ba880c2, 0x95348566, 0x7dbf95a4, 0xd3df2ef9,
+    0xae73d011, 0xd60f2a04, 0x9cef8bf7, 0x825af9f3, 0x8e1fe0d4, 0x97068494, 0x6a307a7b, 0x3c2e303c, 0xd86c9268,
+    0x642f0f54, 0x1e66bbf3, 0xbd6d75d9, 0x5f2aa2b9, 0x0f8e9e2b, 0x75c565ee, 0x87b7c137, 0x55bd9da1, 0xcba285e2,
+    0xc6d56e47, 0x2e12cef2, 0x15bbc8b3, 0xd31430d0, 0xd6d8f5ab, 0x841ad12c, 0x7ca10f0b, 0x3ebee6b8, 0xb97ea535,
+    0xcfff2762, 0xbcc0e7d6, 0xe5121419, 0xb33d403c, 0x98803a7f, 0x469d5e1c, 0x57abcf2f, 0x76d4bd2d, 0xfc04bc85,
+    0x5caf62be, 0x0d081862, 0xd6c6c65a, 0xd691f4c3, 0xc3bd1080, 0x85d97661, 0x611a9030, 0x6cb1c0f3, 0xa3b69f79,
+    0x9eb1e91d, 0x1dc2fd28, 0xf00f91eb, 0x0c7b745f, 0x7f55ca76, 0xff14efa6, 0x7bd8081f, 0x9e50630c, 0xf8d3f2b5,
+    0x95ab6aac, 0x07ffbac8, 0xe3ea3e12, 0xeb30d64f, 0x85eff3ad, 0x96ea2c73, 0x3204b6d2, 0xe876f34d, 0x87ab832f,
+    0x07d53738, 0xea6a3cde, 0xc6bea7b4, 0x9ee7c3e4, 0x63c11d5f, 0xbc14fc50, 0x23a8dbc5, 0x0bdce961, 0x732dffeb,
+    0x303d91ec, 0xfa2a2c3b, 0xeef8a5c2, 0xca460483, 0xfc481ff5, 0x1cf06081, 0x803e007a, 0xcdd870bf, 0x2b5c0249,
+    0x7e46a4c2, 0x56cb499a, 0x511ebd73, 0x613f6792, 0x8dc79df2, 0xe7212180, 0x1068a55f, 0x016dd5a4, 0x91e237ea,
+    0x9bddf026, 0x09bc9344, 0xcb870f03, 0x54bdda3b, 0x88bc0684, 0x4896e3b9, 0x80d91ca2, 0x8a6a7b44, 0x2e49bacc,
+    0x893af543, 0x214b3eb9, 0x31d23890, 0xd706a86b, 0xb38fe8ec, 0xde75015b, 0x61c79681, 0x05bc628c, 0xc5a790b6,
+    0xddaa8ad6, 0x777213d1, 0x86ddf4a9, 0x7a5d831c, 0x89fd5ecb, 0x38ca762c, 0x78158232, 0xff923e60, 0xeb4126ff,
+    0x804a8005, 0x506c0eb5, 0x444dd314, 0xa0eb2c0c, 0x8292fd6a, 0xe8093be7, 0x83b38260, 0xca01a5db, 0x9340c6d4,
+    0x649a7c56, 0xb46cd7db, 0x13a9174f, 0x466e0ef0, 0xea55a299, 0xaf616bd6, 0xddac7e2b, 0xc728ddc6, 0x39cdbde3,
+    0xeafe437f, 0x56551127, 0xd6fda22e, 0x09d363a0, 0x0729da9b, 0x023d21e6, 0x8f8fa320, 0x1a841cc2, 0x96530f0d,
+    0x9edb8ebf, 0x01dbe57a, 0xb922ea5c, 0x3fc23968, 0x7b1aaa61, 0x068cb8cd, 0xf5a2d679, 0x2f4238ec, 0xc1219c75,
+    0x95ad0c93, 0x07304546, 0xe36331ea, 0x040ef95d, 0x77d9a7b1, 0xbbac9018, 0xbd9bfa44, 0xbde29ac9, 0xfb0f265a,
+    0x066fa55f, 0xb0c8116e, 0xba6d5c9d, 0x940cc555, 0x5926ce33, 0x9a2f6116, 0x16b538b9, 0xd24fc2a5, 0x6e1c7124,
+    0x91822c4f, 0xe827a3f9, 0xf10e51ec, 0x668d9d97, 0xcaf92953, 0xb2430591, 0x8b3c7a36, 0x49238f10, 0xc7926bee,
+    0x936be0f7, 0x46ae60b8, 0x6b88bb05, 0x20d66f42, 0x92918882, 0xa5a33ed1, 0xa54604af, 0x61aeeb6b, 0x936fe9ea,
+    0x454efa70, 0xb3466f38, 0x8e44278f, 0xad6f6f18, 0x833234c1, 0x2408cd2a, 0x1c1fa229, 0x6bb80421, 0x9b1a86ad,
+    0x00c4c2e1, 0x8dcb65d7, 0x92e85678, 0xf82ae17d, 0x32b37912, 0xa452d405, 0xa800dfde, 0xbd14c448, 0x048a3c9e,
+    0x53671c78, 0xb335ab8e, 0x3ac53c83, 0xacad666f, 0x1948d29d, 0xc85658ef, 0x0c6a9306, 0x51ac12d4, 0xdf1ff5a2,
+    0xd82fc781, 0x0a1c19cc, 0x2beb9fe1, 0xfa30c593, 0xec70a4ec, 0x95a5c33b, 0x2f5fbfc6, 0xb03fd4e3, 0xddca67a8,
+    0x7049bacc, 0x37e2a2b7, 0x8e99b028, 0xea00f491, 0x7c2004bc, 0x230fecd3, 0x4be56373, 0x8b78a662, 0x76978b7c,
+    0xa48ec66c, 0x6430ccba, 0xbad86325, 0x841b1b5c, 0xf2e9bbae, 0x6830cf5c, 0x0bd5030d, 0x1e7972e4, 0x83d71ab5,
+    0x9a2172b6, 0x4c68163a, 0xb7985500, 0xbe8a2c1d, 0x0a372f92, 0x6fe4c94c, 0x55e621ba, 0x7e86077c, 0xa4d7d236,
+    0x180f8729, 0xe6072802, 0xbd0c2233, 0x40b19ecf, 0xc3766769, 0x834c59ce, 0xe34c216a, 0x0fee2d82, 0xf536f70e,
+    0xbaf8b2ad, 0x3e7280fc, 0x869a2cd4, 0x770b9c9e, 0xa5a589dd, 0x657e3302, 0xe53057e2, 0x4a887910, 0x237afaba,
+    0x60c25bb9, 0xfed3953a, 0x26dfa29e, 0xda1f9d35, 0x248ee591, 0x5797756e, 0x37ea559f, 0xa2409a5f, 0x8d1d70a4,
+    0xc2f292f4, 0xa2348dee, 0xd66920b2, 0x6759b9a6, 0x1955795d, 0x6ae839d7, 0x91953120, 0x1c931557, 0xb33de81f,
+    0x4669f106, 0xf9680def, 0x91429c2c, 0x4af1846f, 0x93aba167, 0x3e88d416, 0xf7799a70, 0xb1c7861d, 0x99386fa3,
+    0x69ad6e08, 0xccac9627, 0x0358eac0, 0x4aeb33d2, 0x695c0514, 0x85e6ba1a, 0xe45409e4, 0xe995d02d, 0x73d125a8,
+    0x3430c538, 0x6a34c89b, 0x39001a64, 0xde66d6c8, 0xe2a2670c, 0xae29918c, 0x40824d25, 0x2212210d, 0x003247ce,
+    0xd595e6e7, 0x9d740f97, 0x3f466b20, 0x649244a7, 0x23245da9, 0xc82695e3, 0x946a03b5, 0x3b45fd31, 0x270f06db,
+    0xb869abb2, 0xf711dd96, 0x5c019068, 0xccde463c, 0xf070ea01, 0x85b81dbf, 0x34df6e28, 0x1b0cc5aa, 0x5ad15e1e,
+    0x2582f60e, 0xb39c3a7f, 0xd136e7a6, 0xe72bf665, 0x6e2f8d73, 0xecc1f1eb, 0x6375c437, 0x9f74af01, 0x360d8297,
+    0x71a08bfb, 0x623a48be, 0xbbbb6ba7, 0x9cef2760, 0xf106be7a, 0xb7063d35, 0x4f78d100, 0x7ba1586c, 0xfdd10ea7,
+    0xfef65604, 0x7224ade4, 0x29e6c940, 0x73570e4e, 0xd70e1f4c, 0x3a82ea97, 0x61f365b0, 0x1d0b97b4, 0x5abc3437,
+    0x328d3ecf, 0x3f0c934a, 0x3e090fe9, 0x57cf4e12, 0xa6eaeeca, 0x23a36842, 0xcc58e443, 0x6d70a698, 0x56032367,
+    0x38dda07e, 0x928407ab, 0xd1ed3eff, 0xe14642f3, 0x21ba0cbc, 0xebf6cb2b, 0xb89331dd, 0x1b042743, 0xdcc7e1f4,
+    0x3d88d419, 0xd7b5af7e, 0x54282e85, 0x629fb57c, 0xc3748d6b, 0x6f64eb3b, 0x4da947da, 0xa0612798, 0xcbd0b50d,
+    0xe88bb643, 0xf9903a70, 0x862160e3, 0x6ee908ac, 0x38786c2d, 0x920e4f2f, 0x0811571b, 0x51ce8fd1, 0x88b6da34,
+    0x57e9442f, 0xc3a5f4a6, 0x80c4a442, 0x07fa8039, 0x7c75e266, 0x330a942f, 0x27003d0e, 0x655a7a25, 0x2e062093,
+    0xb98be3d5, 0xc8f3054f, 0x2befe431, 0xeab94c93, 0x298f4923, 0x8e32460e, 0xc76b4d5a, 0x7ca77d35, 0x92db6bbc,
+    0x6b8e6627, 0x8c19f546, 0xc3738310, 0x9fd9657a, 0xc859dc33, 0xcef58219, 0x72ea262b, 0xf5cc02bb, 0x6f4f91de,
+    0x425610c0, 0x6cf389d5, 0xbbc300ab, 0x99499131, 0x36f6c577, 0x8f686b1e, 0x59219335, 0xb990686f, 0x56189909,
+    0x519a311c, 0x4da10c16, 0x097440f8, 0x427e42bb, 0x1f870ca0, 0x589b5b09, 0x689378cd, 0x19dd1558, 0xe1e42fc8,
+    0x94c2e845, 0x7b74a267, 0x8658e3a2, 0x22564f87, 0x26ce5598, 0x0a6c4f6c, 0x250818b0, 0xd6c9f7ae, 0x4a361653,
+    0xe98fdbc7, 0x1f4e8e9e, 0x789a3594, 0x329abe16, 0xcdc0986d, 0x651a165c, 0x83961499, 0x7911d8a6, 0x5320793b,
+    0x16431f7e, 0x6fc8e822, 0x67f5db56, 0xe56bab75, 0x08646ff9, 0x7deecb69, 0x6ebd872b, 0xa629d3cd, 0x07aab3b6,
+    0x19c6e2c7, 0x97b6d5ef, 0xb513e4cb, 0x56b1e81e, 0x327d6380, 0x9a4f10ad, 0x5fddcc74, 0xd011c699, 0x31126f8d,
+    0x026d386f, 0xec11029d, 0xc64f98a4, 0xfdc045be, 0xb7e86e55, 0xf89a3867, 0x6904bae2, 0xc6b792c3, 0x6adf733d,
+    0xf712c183, 0xac133324, 0xd15def31, 0x10066fa1, 0x6c5d642b, 0x7f8a867e, 0xa9a7653c, 0x02296171, 0x24ab80da,
+    0x3a7e56ac, 0x00619549, 0x8e5dd0a4, 0xe0439d58, 0x9c29e073, 0x272a707b, 0x5e02e17c, 0xebe2aa5f, 0xfc0ce650,
+    0x243c8b48, 0xf4993af4, 0x83c0bf13, 0xb6fcf326, 0x56615cdc, 0x8bdf04ba, 0x3a016a4a, 0x1773dd3a, 0xe3165ced,
+    0x76359caa, 0x9f06e765, 0xb0069e33, 0x5f7cc78d, 0xe77257af, 0x80a20c65, 0xc3ca5e7c, 0xa4845aa4, 0x2c1381bc,
+    0x046c2db6, 0x3006a90f, 0xf9a73c1c, 0xaca96b13, 0xadc05fe6, 0x522180a8, 0x3620e795, 0x877570da, 0xd3a8b806,
+    0x55e80f7d, 0xd8ed6a06, 0x6730e36d, 0x6473d1c3, 0x8470219b, 0x5c62a218, 0x9cf4257c, 0xf0529fdf, 0x68b5d7d4,
+    0x9693641e, 0x43a608eb, 0x5bb552a3, 0x2306b876, 0x68676028, 0xbac2d5e9, 0xb6207e7c, 0xb6306f2b, 0xc36a8db5,
+    0x300cfbb8, 0xd960acc1, 0x5bdca09b, 0x8b117dbb, 0xe97b2822, 0x9ece6766, 0xcb77574f, 0x8cb59092, 0x1258041e,
+    0xdd2b42d7, 0xe7f679bc, 0x9bf493d7, 0xbb558f26, 0x89645fd7, 0xd4eb8bca, 0x59c2b894, 0x109de0fb, 0x74e489dc,
+    0x85fd453a, 0xd7ab69e5, 0x416e0815, 0x3075e2ae, 0x11b6609f, 0xe7dedcc6, 0x14da6468, 0xa39f0544, 0xd475d0d7,
+    0xc014d0d1, 0x8cef3c2d, 0x99ffad1c, 0xf3481e1f, 0x169e7b31, 0x6455fba8, 0xbd2562d5, 0x5055c3a6, 0xade08541,
+    0x8bcd9de8, 0x2cc0736d, 0xd3f9c494, 0x4288a4eb, 0x41bb2f38, 0x763ccfd1, 0xf893bfd1, 0x8976e1b1, 0xca37107e,
+    0x0f1938e3, 0xf3723960, 0xdf36bac6, 0x5e35f320, 0x9cdccdb4, 0x27185b20, 0x55ee7d8e, 0xb714ced9, 0xf54a1648,
+    0x16d82052, 0x562a69c5, 0xe21a1f8a, 0x3dd4553b, 0x66a88ec9, 0xeb287702, 0xe0a6884a, 0xbd3acdd7, 0xae86c185,
+    0x32dde97c, 0x228bd267, 0xcdec5272, 0x7163513f, 0x6354b1b6, 0x039bc22d, 0x5bec7015, 0x081a010e, 0x9396b495,
+    0x6b6076ce, 0x54ebb803, 0xf39b7bfb, 0x502e9213, 0x6743e1d6, 0xcb909a0a, 0x01b22e4b, 0x03ae35b7, 0x52d0205c,
+    0x524ebed7, 0x6e561d45, 0x4ae498c3, 0x523610df, 0x2ba80408, 0x4dfa748a, 0xef56dd47, 0xd9637143, 0xeadfef46,
+    0x7b323b8c, 0x1e939de0, 0x727bf7bd, 0x29ac553d, 0x21faa0c7, 0x922eaa3e, 0x1414d291, 0xa892280e, 0x2ed04a76,
+    0x5b9166ea, 0xe6ee4c36, 0x5161c447, 0xc2369560, 0xbf262c33, 0x8e70e78f, 0x8c0c920b, 0x8fc6103e, 0xe170f95c,
+    0x99d847fb, 0x57cdf9ae, 0xe71ebbab, 0x0c202b00, 0x519254cb, 0x2b9fa068, 0x0f08e6e0, 0x1da1f827, 0x4aeaa28e,
+    0xc9080ccd, 0x8fb3454f, 0x1a8641e0, 0x7023d105, 0x3ca6551b, 0xa7659297, 0x16c17b92, 0xd6a50a64, 0x87d5a3dc,
+    0x2f1c4913, 0x692c252b, 0x526752c2, 0xedc0d9f9, 0xcc953cfd, 0x2a8ed3ca, 0xec315e9e, 0xccf3b42d, 0x82447a6f,
+    0x4fb6d172, 0x8a61218b, 0xadc78f3b, 0x89a22180, 0x897bb444, 0x8f3efc45, 0xf28999fa, 0x8779cb22, 0x8343b2e8,
+    0xe5163c41, 0xa881daf1, 0x84dd9c2a, 0x0d292ab9, 0xc0dc5844, 0x30fa04fe, 0x3f92e194, 0x97fb5beb, 0x3df42717,
+    0x78cc0a3e, 0x704fdf35, 0x14fe28ec, 0xbc618358, 0xa506a116, 0x7d00e187, 0xeaf2c147, 0x2f7e9893, 0xe58ef7a4,
+    0xfb62122e, 0x7683129e, 0x099b44bc, 0x7e7a9e7f, 0x7a565294, 0x473b61ec, 0x4ee019a3, 0xa0f9a103, 0x546b6406,
+    0x03440a2d, 0x85915023, 0x1058f0c0, 0x9ccd15d6, 0x8f92bcde, 0x188198eb, 0xe92da621, 0xe8da354f, 0xfd5cdcb5,
+    0xad59a48c, 0x3d2890ea, 0x7be09dd3, 0x0c761e98, 0x47da2a30, 0xb4d6eb6d, 0xbba6ca06, 0xc5e5a61b, 0x46891bcd,
+    0xb7bb9fef, 0x3b37cc91, 0xe0b8851e, 0x955caea1, 0x1d31a55f, 0xf3d3b5d9, 0x931e4a6c, 0x86208b47, 0xe116ab35,
+    0xf70cd5e5, 0x9004d895, 0xbb3fe7e9, 0x561ff051, 0x1ae90acf, 0x7e1c22d1, 0x77e9a3ae, 0x8d8b15a5, 0x0f55fd24,
+    0xe818c806, 0x8e8b2276, 0xab7aca8f, 0x00a0550d, 0xe3cb60b7, 0xf54a528d, 0x7c37b0bf, 0xaff81c63, 0xd85d9e2d,
+    0xfbf84da0, 0xf9a4e8d9, 0x6e33f432, 0x7ad23d55, 0xc58db0b6, 0x2ad037ed, 0xfb5ee36f, 0x42c6f12f, 0x16ecb577,
+    0xf5672d1e, 0x2fa6a5b2, 0x8283cfa9, 0x2c751035, 0xbe0034fa, 0x3057590e, 0xdca1a523, 0x5bfc44e7, 0x6510bb55,
+    0xaca94a85, 0x24f4f399, 0xa045cc22, 0x18986067, 0xd6e99972, 0xba140251, 0xe6d45114, 0x5120d2bc, 0xeb125984,
+    0x63937ecb, 0xb7e5c5c5, 0x8767d159, 0xa7bc67ba, 0xd656a68e, 0xcbf72b91, 0x5f3e872a, 0xe363bf62, 0xa68465d5,
+    0xc74a1410, 0xd8ff5d32, 0x7a0a7f36, 0xb039769c, 0xa160f51b, 0x3a41e464, 0xeb7fdddc, 0xab10bd15, 0x1ce35c27,
+    0xa6958dc5, 0xe6ff7ad7, 0x6847c4fa, 0x8f4b3af3, 0x5c78d91d, 0x8d8c96bf, 0xc519f8ba, 0x13b2033e, 0x270adaa9,
+    0x753e6c23, 0x2f4a66b1, 0x291d677f, 0xf6a2ff0a, 0x455913d3, 0x3aff0b58, 0x522b2e71, 0x6dbcdfe9, 0x578f5a18,
+    0x766f2113, 0x2396f539, 0x8660dfc3, 0x4badfc53, 0xa09bca38, 0xacf99e75, 0x374f1c51, 0x4f551bd9, 0xb4cc9f2b,
+    0x750184b9, 0x6c0d0c6d, 0x5c1450b8, 0xe8e98d5f, 0x75d72b1b, 0x4c99b136, 0x660240cb, 0x3e7bc2db, 0x9ae0542c,
+    0xbb0e7920, 0xd5a6e7bd, 0xc1b5c30c, 0xa9035cbc, 0x0b26ab58, 0xa96cbf56, 0x467679d5, 0x32cb47d8, 0x3e401583,
+    0x1282f340, 0x240e54c3, 0xcd291dce, 0xd8c9c526, 0x439850cf, 0x02241fd3, 0x8c1015e1, 0x8cd4429f, 0x82318977,
+    0xc65df9a8, 0x5bfbd4df, 0xadc1ffad, 0xf89f9b3b, 0x1198ade8, 0x295b13f3, 0x35b1aa2b, 0x3381110f, 0xab0a9b43,
+    0x7c420322, 0x302556ca, 0x49316421, 0x8cbe53d5, 0xc35c5965, 0x32237fee, 0xd76e45a3, 0x831d0b03, 0xa505e544,
+    0xcdb91361, 0xbf2e39c6, 0xb1dafb20, 0xb38149eb, 0xb00f72ed, 0x1f981d65, 0x0de3f044, 0xd634e8b7, 0xdc40a460,
+    0x7dfc5d96, 0xf98fa677, 0x5bac5f8f, 0xf92e132b, 0x208e6020, 0xa367d223, 0x3e3a4eb6, 0xf3366821, 0x975b1330,
+    0x8cd1ecb4, 0x73ef415f, 0x4424fffa, 0x05f315f9, 0xbe37daff, 0x91a2b353, 0xcf4a7877, 0x4435f6d8, 0xbbcf6fb1,
+    0xf3fd2028, 0x6f2607d6, 0x537d651b, 0x596b8edf, 0x02e0f0e8, 0xd4850ffe, 0x91c9a47d, 0xaeaf12e2, 0x10d31741,
+    0x142fc007, 0xf8cb5fc7, 0xbaf55d2f, 0x0d68d56b, 0xd003cbc7, 0x270fde15, 0x1a751d43, 0x759c739d, 0x32699220,
+    0x558ac03b, 0x4c0fc036, 0x5ede225d, 0xd9f88368, 0xf6508264, 0x84b238d6, 0x704b5d4f, 0x7fdac505, 0xd0941a36,
+    0x37968af0, 0xbda5a671, 0x7ebd6100, 0x1cd618db, 0xaf380ecf, 0xbbe03007, 0x80a88669, 0x08978edf, 0xdf0041e9,
+    0x17a11ca9, 0x861fb470, 0x15a7b374, 0x835fc153, 0xf87a1008, 0x4e89547c, 0x5333d38d, 0x78e90648, 0xae8df60c,
+    0x01b28402, 0x0df9a4d3, 0xad2743d1, 0x905f456b, 0x08bb1234, 0x19202148, 0x792d7576, 0x5f1b602e, 0xc08fc85b,
+    0xaf690081, 0x1235b641, 0x800eb546, 0xb5277ed0, 0xec3123c5, 0x4a95690c, 0x5c4dbaf5, 0xc51f4964, 0x85f1c397,
+    0x344b8d1b, 0xb445e052, 0x77d5a1d2, 0x14f417cd, 0x9cb67f0e, 0x9fdbbcba, 0x0d32f21d, 0xb7812b6e, 0xb1970ff2,
+    0xe6447270, 0x33f1a085, 0x25894eb8, 0x9e548d4f, 0x26d0ee9a, 0x9a80939e, 0x869cdfac, 0xa259c551, 0x1f318108,
+    0x13e3a044, 0x217d30cf, 0x8f520951, 0x485449cb, 0xe50d5a97, 0x91a98c60, 0x40f08536, 0x4a14e4ac, 0x0a0ed862,
+    0x750be3cf, 0xd9ff36de, 0x3cb87315, 0xc65b2536, 0xd43150cc, 0xe067cf3f, 0xedc581c8, 0x15ca2ae2, 0xe9dd300e,
+    0x4af987a1, 0x43ac4c7c, 0x53873cc4, 0xc6d8b0da, 0xb0d0bf08, 0xa02b3a92, 0xad7fecf6, 0x021ad91f, 0xee579876,
+    0x72f1c20b, 0x478e20b0, 0x3e8d32c3, 0x5654d921, 0xf13f8d11, 0x861291e6, 0x953010dd, 0x0e6f8fb1, 0x19cb9e1a,
+    0x882fe199, 0x27e2ae01, 0xc07e4ab2, 0xf7e4b5f8, 0x36737245, 0xc1314d59, 0xda246ac8, 0xed5ab711, 0xdc0b3b69,
+    0x63243a01, 0x00295846, 0x899c44a5, 0xf74ec0d4, 0xeb499068, 0xc2ce0a76, 0xde8156a6, 0x7e0eeaab, 0xd5058b9f,
+    0xdf56d0ef, 0xe6225298, 0x5f958d55, 0x071157ba, 0x842e2c5f, 0x6e6b582f, 0x4cab0876, 0x8e345c09, 0x91f0d450,
+    0x26e2f512, 0xf2ade63e, 0xf22b93fb, 0xc96a6961, 0xf575f7bd, 0xc0d22c3c, 0xb9c1a55d, 0xc7bf3239, 0xb14ae5a7,
+    0xd5c097a6, 0x21f90e40, 0x9d934e3a, 0xd1641235, 0x1239d7cd, 0x90fff903, 0xf344a7b2, 0xc560cf21, 0xa7d6d56e,
+    0x9f088307, 0xcf886d5a, 0x52b63c6a, 0x46c071bf, 0x7461fc99, 0xfa7f99e9, 0x9d6ba78b, 0xcd6cdf1e, 0xdcfde7e8,
+    0xdcc7a022, 0x8e18cbfa, 0x355f5edf, 0x2bfdecea, 0x62f5074d, 0xb1e9167b, 0x9fd700e6, 0x84a6fecd, 0x6a209fdb,
+    0x81424547, 0xab34b083, 0xaa324d20, 0x46b3900f, 0x31f67b68, 0x043eb142, 0xe83d3bad, 0x5436895d, 0x0555c4ee,
+    0x52e51e18, 0x25fa1c6b, 0xc2313475, 0x8c5d0718, 0x91597fec, 0x4b653222, 0xd228fc9c, 0x0f036761, 0xbbac641d,
+    0xaccfb7f7, 0xe819ccc3, 0x685423a9, 0xf1dce016, 0xb9c429ad, 0x10b5ef92, 0x031e5462, 0x4928eb0f, 0x939a30cb,
+    0xfae1da2b, 0x6f08b2f2, 0xfb67e3af, 0x2ad15b59, 0x0785e9bb, 0x86bf2d0b, 0x55445c70, 0x128a89f9, 0xcaf0d959,
+    0xc31404ea, 0xd6275f97, 0x248651b7, 0x7bc9ef82, 0x8c23fe83, 0xb6a811a3, 0x6793d646, 0xab855f7e, 0x6f817d19,
+    0x560ca491, 0xdc96c8bb, 0xf3b62016, 0x7b3ca398, 0xa29793b6, 0x5cc9654a, 0x9d10953d, 0xc8edeae0, 0xdf881cee,
+    0x8b715451, 0x421124fd, 0x2dcf1deb, 0x79d66be4, 0x8c62b145, 0x46ce442e, 0x3dfd2a3b, 0xb2461a18, 0xd3f3cbce,
+    0xa866d61d, 0x9e2adf10, 0xcd207e6b, 0x9bed6445, 0xd0e212ad, 0x7ad24ac7, 0x6afb56c7, 0x3444cdd5, 0xa98b80df,
+    0x17c1400c, 0xab881afa, 0x5c968030, 0x2965cdb5, 0xad034bd9, 0x49a76a00, 0x183fadeb, 0x4ed93511, 0x143c1b9c,
+    0x29da7ec5, 0x3bdbbf54, 0xca19815b, 0xd086c29f, 0x8cdc3c78, 0x8168ff25, 0xc75e8d88, 0xba80ab30, 0x3427e14c,
+    0xa191cfd0, 0x7ef83e32, 0x61de015b, 0x72dcd3ab, 0x2c535496, 0x93a70578, 0x9524e3dc, 0x5af7166c, 0x72099f8a,
+    0xd6ff5984, 0x6bcc939e, 0xf3f3df87, 0x41028a66, 0x47986c89, 0xf9b083c5, 0xbd7b4b80, 0x0eda9936, 0x65de25ea,
+    0xf6ba4d5d, 0x0ecb8832, 0xb038ffee, 0x55ad268c, 0x5cc4f363, 0xe82dfcb7, 0x3b32f3df, 0x8f0737c3, 0x6ebf4c87,
+    0x9c0f8164, 0xb216639f, 0x1bed287a, 0x46a1627a, 0x7cf7093b, 0xba8dbc26, 0x3690f76e, 0x43eadf2c, 0x0bfb5818,
+    0x42088c3d, 0x78be8221, 0x1bb05bc4, 0x07fde5b0, 0x8bd62d25, 0xba44594f, 0x1b75dd05, 0x230e9010, 0x6df40626,
+    0x0957b7b9, 0x669b9c7b, 0x104548aa, 0xdd53da45, 0x8a0f8fd5, 0x9f3b475c, 0x142ec636, 0x2289b19a, 0xee9836d5,
+    0x6e94969f, 0x50726097, 0x031a4619, 0x9dd5946f, 0xb37f91dd, 0x25ecde6e, 0xcdfbda56, 0x8a81a058, 0xcea9d8bb,
+    0x787ef176, 0xa3b4f06e, 0x0fbefdf8, 0xb4deeba3, 0x271224b3, 0xd754532a, 0x6f161df1, 0x99eb6cff, 0x92d48794,
+    0x6de058f5, 0x1dc9e408, 0x6ab57a38, 0x21ee3047, 0x9824f61b, 0xb8303174, 0x27344f8f, 0x23bad112, 0xa55a928a,
+    0xcb2d74ac, 0xf29d59b7, 0x176b8a7c, 0x054ffdaf, 0x5204b85f, 0xdc460f2b, 0x5e9dadf1, 0xb89a300e, 0x7aa5c545,
+    0xe56fff7d, 0xda8e9f82, 0x51cf0308, 0x42b46e39, 0x31ffc76f, 0x502100f6, 0xc669785c, 0x52c76c21, 0xde9b2d7f,
+    0xf08008b2, 0x5ab6abaa, 0x0d44e23d, 0xccee9735, 0x005782ef, 0x96c1c4c0, 0xd47cfa97, 0xd9000c44, 0x6c9879b4,
+    0x5f6de4f0, 0xcdbafe40, 0x638200c8, 0x0cabfb3e, 0x8b8dad58, 0x3bf90663, 0x704d83ae, 0xc8e60b8f, 0xfefb7571,
+    0x47030067, 0xbe7e355e, 0x45ca0d7c, 0xc4e4b523, 0xcd58388c, 0xa93bc985, 0x53529d09, 0x0602bab5, 0x62171ae9,
+    0xeee6ae9e, 0xfb3f3b33, 0xb4f8fd70, 0xecaec6f2, 0x846a69a0, 0x2004fe59, 0x447eb196, 0x29595d8b, 0x136e5de4,
+    0x5b833bb5, 0xb032cbcd, 0x62c230a2, 0xbb221480, 0x9b05f8c6, 0xe34daf6b, 0x8cc7ee98, 0x4cea125b, 0xf5b2141f,
+    0xb77815db, 0xdc6b811c, 0x5fa9c4a9, 0xf496314a, 0x3a95bfdc, 0x63131609, 0x906f87a4, 0xfecc992d, 0x54391481,
+    0xebf65e2d, 0x247d5492, 0x4da8dc0c, 0x213b83a1, 0x52e65a1c, 0xdab8d2a3, 0xa77ded45, 0x66791551, 0xeb5b80de,
+    0x994dc71c, 0x1fa4dd08, 0x6d6de746, 0x8492c6e0, 0xd0f22ffc, 0x9064074d, 0x9f0d17f2, 0xf225fdea, 0x0671ba60,
+    0xd489414f, 0xdd771659, 0xefce38e6, 0xd120e183, 0xa1ffbbee, 0x4000d32c, 0x86a7f4ed, 0xb5c44508, 0x3b641157,
+    0xb5b23e08, 0x75de6407, 0x86025d23, 0x054874b1, 0x7e280f8a, 0x2de0684d, 0x127afc5d, 0x2a51d218, 0x85255923,
+    0xb9af24a9, 0x4a0a7afa, 0x13af4b25, 0x25b82653, 0x4ab3c00e, 0x74d30251, 0x0e68bb28, 0x9b221705, 0x69735cf1,
+    0xd6266732, 0xc44f92ea, 0xf7107304, 0xa03bf3c3, 0x57fc5790, 0x13dbfcdb, 0x5496f479, 0x4ba85269, 0xc65fd8ed,
+    0x850d8fb5, 0x42e921ee, 0xc8ffb391, 0x6de68b2f, 0x0483c68d, 0x3e7ef497, 0x39306337, 0xdb6f440c, 0x15d27c40,
+    0x2ab6cdda, 0x487a498d, 0x1b821eab, 0x37a0ecb6, 0x3de5058a, 0x34f68802, 0xc2d51ebf, 0x100dc9fc, 0x946127fe,
+    0xc6357ea7, 0x358bef8a, 0xf8a00632, 0x9a76c563, 0x3d8c1d76, 0xea6015c3, 0x59a3044f, 0xd08f8d66, 0x0a2da859,
+    0xf7db374c, 0xb8728ce3, 0x6d4e0a41, 0x9b1977e2, 0xa39dedf8, 0x01a23730, 0xac69f015, 0x1f52dcc5, 0x6e7fa421,
+    0x0622721f, 0x509efece, 0x0e7e91d4, 0x3edb7c1d, 0xd7a72780, 0xbc89ced8, 0x12334a6f, 0x4c5439d4, 0x773f41f6,
+    0xa9d80351, 0x3a4cd324, 0x2cabb343, 0x48ee4f9b, 0x51d18cf4, 0x53dcc46c, 0xf98acb5f, 0x192752c5, 0x751103ad,
+    0x96171f1d, 0x659f3ae4, 0xbfa89f61, 0xf078f520, 0x233607f7, 0xe971f66f, 0xbd1c31fe, 0x372c3b0a, 0x389af978,
+    0xb975358e, 0x69dc20ea, 0x5c51d86c, 0xa3213611, 0x4e70d94b, 0x1785c077, 0xe4786c48, 0x56d978f8, 0x31aa465a,
+    0x1bc5c89d, 0x951d0f27, 0x80d8ed17, 0x2e5893d2, 0x4ee37d70, 0xf1b61add, 0x2d2defe5, 0x7f7fbcd5, 0x230271a6,
+    0x204bb0b1, 0x4ff4f36b, 0xc92ad96c, 0x28382d00, 0xe6d9578f, 0xbf46b99a, 0xcbd72255, 0xb6436987, 0x0190eaed,
+    0x66157232, 0x95ce62e2, 0xfff92f56, 0x6f72c54c, 0xf61e3196, 0x972a4b7c, 0xc84fe040, 0x0b5a765d, 0x14042a63,
+    0xe3adf872, 0x9fd94d99, 0x759926a6, 0x5283248f, 0xba48279d, 0x14ff7d7c, 0x2874b643, 0x78e75193, 0x32ccae87,
+    0x38e5a1fc, 0xce8bcab7, 0xf85cc68f, 0x1ae5f3b2, 0xd94f8941, 0xf1df076d, 0xc0447f22, 0xd6fd46e5, 0x45a226b6,
+    0x073c8fa7, 0xcc0a8d3f, 0x8828cab4, 0xb77fa6ed, 0x6d597b6d, 0x1c37e1c2, 0x4528586c, 0xb49bfc5a, 0xa179e920,
+    0x34317663, 0x1c28795b, 0x809cedee, 0x287e2d9b, 0x9d8a4180, 0x5caba288, 0xf7bb6da4, 0x7ecd48dc, 0xfc03bd6f,
+    0x97c1ada7, 0x05ae96a3, 0xcf2adfcd, 0x3a8d11f5, 0xdd6b69b2, 0xc0723704, 0xe0a060c5, 0xfba0bf58, 0xe57a7b1e,
+    0x9500e75b, 0xb94146f9, 0x79b07dcb, 0x145d2523, 0x9e5fbdb7, 0x43132d92, 0xd439b324, 0xb52f471e, 0x80ce562f,
+    0xddf15d94, 0x7b2e815a, 0x94e62f3d, 0x4ffdfd9d, 0xc5c363c8, 0x1e962112, 0x6caadf32, 0x8313d4b3, 0xc167dcea,
+    0xe38ca881, 0x4d318daf, 0x8adff43f, 0x8b4a7d3f, 0x65772e23, 0xbb4fdebf, 0x8d1d0f46, 0x3d4e6d39, 0x984799e3,
+    0xa3b43e49, 0xb1feec01, 0x445307cd, 0xc39835da, 0xeea7aa12, 0x8e0172a4, 0x5486ac33, 0x9fb8b6de, 0x283583e4,
+    0x4c321411, 0x3c1edcfc, 0x0c0530c1, 0x0419a677, 0x5775b8d6, 0x09cdd79f, 0x1a9fff46, 0x384744e0, 0xe7dae38a,
+    0x298374c0, 0x5c471e7c, 0x3d0c2064, 0x2a7aaa88, 0x498f9c31, 0x04269caf, 0xeb0dd23d, 0x946a6229, 0x3cc1edec,
+    0xc29efb9a, 0x63f2a732, 0x6d805561, 0xe0b83b71, 0x2aad9da0, 0xd94e1a62, 0x5e1c8813, 0x58bb4fa6, 0x4cadc324,
+    0x491f676e, 0x2ea7cb57, 0xb146b928, 0x70b26880, 0xb9945133, 0x3974e4b1, 0x7bc07c30, 0x60c83cbc, 0x25e38123,
+    0xc14a4141, 0xc4b4557d, 0xf630b2cc, 0x3aff7a4d, 0xafb19698, 0x12ea7201, 0x1536d75e, 0xa196128d, 0x7d479056,
+    0xc7e56a5e, 0x46eabd64, 0x84e57b38, 0x622e4a42, 0xcd74cd6b, 0x30703c63, 0x4ef1aca0, 0x314a85e4, 0x51ce0e87,
+    0xbdd07a95, 0x8dd2c635, 0xd8c3feb3, 0x06f14726, 0xc8624bb9, 0x59b09efb, 0x0422e23c, 0xc081b9ff, 0xc1739b3b,
+    0x0ef0e2e5, 0x36b4b5d8, 0x400cc816, 0x44a17f54, 0x02a8ef71, 0x5a960288, 0xe3ac15a1, 0xd4483df1, 0x7467d2fc,
+    0xc6d34fa2, 0x0c3c4fa9, 0xfbffc338, 0x1ab79b46, 0x4e363ea6, 0x4c01e3ce, 0xa4659a18, 0x5b5b537d, 0x85040fd2,
+    0xe182003a, 0x28d02877, 0x7e6439f3, 0x2d059bb1, 0x20ff08a4, 0x4635da09, 0x4678ec93, 0x7101aad7, 0x6b614ef8,
+    0x3741dc09, 0x2d967cbd, 0x4e925d60, 0x2e8b8b04, 0x85dce306, 0xf97f44a0, 0x44259e55, 0xde231e89, 0x3619ec0a,
+    0xb644aa4d, 0x65603e50, 0x7ac74af4, 0xe228f84f, 0x5d7a34f2, 0xb9a2b85f, 0x0e783a37, 0x020e2615, 0xc43e1c57,
+    0x06581154, 0x73c22f17, 0xcbe0f35f, 0xac629160, 0x96dadc38, 0x698da3b8, 0x9c0048ee, 0xeb660fcf, 0xc9e6df96,
+    0x475329c7, 0x9c65f0e5, 0x8a3d73e8, 0xf69a9b77, 0x8d14c7a3, 0x5bc8ef6c, 0x067bb777, 0xc52379f7, 0x372c792f,
+    0x9af9fbe0, 0xe8dd4d0e, 0xa83a36b8, 0x834d3a9a, 0x6710f8fa, 0x8951c561, 0x5ddfef22, 0xbc1829a3, 0x21413777,
+    0x7c1caaa5, 0xaca942a4, 0x34fdc188, 0x03976d5d, 0x0316e2c0, 0xe34e33af, 0xbb9aa938, 0x3a594427, 0x99c70e44,
+    0xdf857df7, 0x079556ab, 0x5c53838d, 0x646ed9c5, 0xbbfb48ed, 0xe07ee61b, 0xbc778171, 0x078804b0, 0x79029c0b,
+    0xb753bfeb, 0x75f6c4c6, 0x3f9b0d33, 0x1c63174d, 0xa5400a62, 0x26aa82c5, 0x5c5003ab, 0xfe2fac62, 0xa1ef31d3,
+    0x803ef821, 0x8d9f5921, 0xf7384bbe, 0xf47b9199, 0x6d6b3be5, 0xb42c6dc2, 0x4552dfd7, 0xbbf7526d, 0xea771f8d,
+    0x0d000961, 0xad88405a, 0xc6bcd865, 0x2cc3d508, 0xcb34a4fd, 0x63806976, 0x32528ae1, 0xbb27f864, 0x8a5a07df,
+    0xe3cc0060, 0xe58d3a7a, 0x28be312e, 0xc443ed49, 0x4ab02a98, 0xd029ce4e, 0x0505a2ea, 0x0f6484e6, 0xd2b61f41,
+    0x3298625e, 0x5da09b8a, 0xb0fb2033, 0x01f1632c, 0x58e8e47c, 0xeb9c7ec2, 0x4d0d7279, 0xf1ea0d32, 0xf8d880a2,
+    0x615c5bf3, 0xa136c1ca, 0xca1e836b, 0xd60053f0, 0xfcda7554, 0x9b364e11, 0xb2e4a8e1, 0xac609a2d, 0xeac51286,
+    0x41c9237a, 0x5ffb0cd8, 0xfac9c77f, 0x39910405, 0x4b4d86e1, 0x27b28ad9, 0x117f450d, 0xe71b4273, 0xb75c5687,
+    0x57f4cebb, 0x412f1de3, 0xf7e06aed, 0x450ce7c8, 0x63bff46d, 0x675aec4c, 0xd131b97c, 0xf03e436d, 0xb71cdeaf,
+    0x1e74fb8b, 0x7d189789, 0x0c9b9ee9, 0xac60388d, 0xa8594f5f, 0xf2ed08f9, 0x76682cbe, 0x2579e071, 0xbe453b61,
+    0xa7d20794, 0xc7cb198b, 0x56dbb09a, 0x83a3a9e0, 0x4ec68d86, 0xc460c525, 0x05356296, 0x6f2f5c69, 0xe86cc6d0,
+    0x905a98ec, 0xa03cb3e4, 0x9d2cc662, 0x9a6be35d, 0x3bad7e10, 0x93db95c2, 0xd9410c57, 0x6924e5c1, 0x5c35d2e6,
+    0x23d34fd1, 0x563311ae, 0xc2488e90, 0x871a3f16, 0xdb7e96bb, 0xf9609a45, 0x6457137e, 0xf9c0f1fb, 0xc3864892,
+    0xd71d4800, 0x94991b2c, 0xdc4c2641, 0xfd59d3f9, 0x1e818d77, 0xd84d2495, 0x498640d8, 0xff7ee3cf, 0xd33e2b23,
+    0xf24d1fda, 0x7753bde9, 0x082df816, 0x4959692f, 0x19bdf45f, 0x5b5a2359, 0x6631d34e, 0x2923f3e6, 0x2fec71fd,
+    0x0a8a70d1, 0x5702de27, 0x92313841, 0x449791ac, 0xb387742b, 0xe851d2b4, 0xb75dae46, 0xeb0d7bd8, 0xad3ecde0,
+    0xe912e559, 0xb830ab43, 0x52b754bb, 0xee8dfe05, 0x938fbd1a, 0x061f4545, 0xb4c18df2, 0x4ecef72d, 0xa9610186,
+    0x46b62635, 0x4ce26867, 0xf946ddfa, 0xb9ceaf28, 0x730e0324, 0x2933eca3, 0xe94a2023, 0xc9b0730b, 0xfc93ff44,
+    0x4c3907c7, 0xb95b0fb9, 0xb6938f1d, 0x5a9a2ef1, 0xa249a9d7, 0x0472aeb8, 0x3e24c5f7, 0xb4599ec6, 0x9daec0f3,
+    0xa3b70d62, 0x3ce87aa0, 0x74b4e317, 0x5fa848a3, 0xc2674248, 0x7fade30d, 0x105d2095, 0x22c4017a, 0x53bbcfd9,
+    0xc1ec0bdd, 0x521ba2f9, 0x55965fa5, 0x18d47b85, 0x5eb83e5e, 0x6ae05f1c, 0x9387964f, 0x1f32dd0a, 0x46737e02,
+    0x43a2a488, 0x83c377a6, 0x4f682c49, 0x350e34a4, 0x1bf25633, 0xbf8ac4d2, 0xa51fe75e, 0x930b6287, 0x21e75f13,
+    0x92842b54, 0xcefb46d7, 0xd2f04fa0, 0x05c173e5, 0xe351cf79, 0x186cd123, 0x2c6328c8, 0xa254e6b5, 0xc15494ec,
+    0x0c0f91e2, 0x8e233c9b, 0x7a8714db, 0x5ad92907, 0xbacb71e0, 0x16d62f2a, 0x9fe88b25, 0xf3f9cb39, 0x3b9646a5,
+    0x040cb141, 0x7af757c6, 0xd6eb4881, 0x4602d1c4, 0xc4564a7b, 0xef369429, 0x1d2e942b, 0x67692f2d, 0x0478fae4,
+    0x7ad00729, 0x130d1344, 0x290c1ac7, 0xc0994354, 0x927f73e3, 0x4ee6615b, 0xe47c953f, 0x11cd49c7, 0xa8d2b334,
+    0x258a0a8c, 0x5427935c, 0x1ebe4283, 0x42e7a454, 0xcee6c96b, 0x407f1c47, 0xa4faae82, 0x237dbf6c, 0x45bc95b7,
+    0x9e195bd6, 0x3396ae0a, 0x0e6d0413, 0xd045c0f2, 0x0788a353, 0x428c36d7, 0xc1855eab, 0x51ebadde, 0x4736eb20,
+    0x6ac920ee, 0x12937ae5, 0x7bf6df81, 0x939a4597, 0xbd526b85, 0x33c7d5de, 0x8987d594, 0xb735539b, 0xcdaf56c6,
+    0x71acfb73, 0xf6e0b739, 0x8205d010, 0x7e3c1399, 0x3966d99b, 0xb58f6528, 0x39a268e6, 0xfb261e0d, 0xac11bfbb,
+    0x482442cb, 0x18a635b0, 0x7c51b88b, 0x3ae12d23, 0xfb76a8e8, 0x24acf814, 0xa7bc459d, 0x40a2530f, 0xef1d260e,
+    0xd74aa101, 0x98ccbe05, 0x330cf9a8, 0x001edbfd, 0x1cdf590f, 0x848025bf, 0xca7f9d9d, 0x57089850, 0x694cd504,
+    0x097d0849, 0x121232a2, 0x13e6688c, 0x15bccbe6, 0xc6ba4c43, 0x64ff7b61, 0x2f2f2592, 0x66a55d49, 0xa35d612e,
+    0xd510f77f, 0x7b9b8f71, 0x60f03608, 0x64a02825, 0x2ac813a5, 0xfb7d3e77, 0x537c140f, 0x3dd85df2, 0x7a326116,
+    0x50ce29c7, 0xa80e429c, 0xf99e6bc5, 0xc0898e2e, 0xfc0c899e, 0x4e62d93b, 0x453a3b4c, 0xd807f550, 0x89af5430,
+    0x97d91ca8, 0xd444ae01, 0x275c02f2, 0xf662f7ba, 0x3d4df649, 0xf79d1899, 0x8d37b8b5, 0xd61e0796, 0x3c8070c1,
+    0x9d8970c1, 0x49971256, 0x56e9338b, 0x28cafd9a, 0x50fab884, 0x572e42cf, 0xc91643b6, 0x98a2f605, 0xba2698d9,
+    0x612907f9, 0x8a610764, 0x01802572, 0x186f379f, 0xcd10674a, 0xe39e3ea7, 0x13ac028e, 0x761fe3f5, 0x3e015824,
+    0xb5030220, 0x0c11cf3a, 0x0241e794, 0x967ff0e8, 0x5700351d, 0x6ce254ba, 0xc622802f, 0x5a9b09a1, 0xd5111f04,
+    0xc34c3e3f, 0x0ab84a73, 0x3ccf4a58, 0xdc60adc5, 0xd2d4bae0, 0x21ce685b, 0x742d1deb, 0xbf2a2865, 0x1cdac378,
+    0x708ec7cf, 0x6af8f090, 0xa9705cfb, 0xb31c6fd7, 0xddebc0d5, 0x87d063fb, 0xa5fde28c, 0xce68dc60, 0x3a65cd82,
+    0xdf2a90b0, 0xbc06117b, 0x3c56465f, 0x6f156db2, 0xe8763009, 0x92f559ae, 0x13f2bd1f, 0xe4be79cc, 0xe8d06287,
+    0x1f028078, 0x800c61e3, 0xe190df17, 0x3477cf90, 0x83572426, 0x2860cb3a, 0xe242c28d, 0x2bd789e8, 0xc4ab3a74,
+    0xf298cf09, 0xb54db387, 0xc2f13805, 0x269413ca, 0x6f3fe9b8, 0xaceabb11, 0x05da2a60, 0xa62c1c0e, 0x70008077,
+    0x9c094316, 0xb53c3815, 0x56a34ef0, 0x378b8cf7, 0x437e9c47, 0x94a88c27, 0xd416547d, 0xc6c18a64, 0xbc59f605,
+    0xf9582149, 0xf268c576, 0xdcb1e686, 0x1de7018e, 0x95907a98, 0x82d5f4ae, 0xeb90bd3f, 0xf475684f, 0x38bbc233,
+    0x441c6cad, 0x8f48bb58, 0x2dfc1516, 0x1f91fa5e, 0x4947c85d, 0xce41728d, 0x8f45655a, 0x98539fa7, 0xe47728fd,
+    0xa89696e3, 0x44bb5135, 0x3f7d5eb3, 0x99a63ca5, 0x86f8df6a, 0x0775715a, 0x7ebeb68e, 0x1c18c90f, 0x364e43b8,
+    0xa0cfdb3f, 0xcfe669f4, 0x2b764ffe, 0x6b4de98f, 0x68d6cfcd, 0x44909bee, 0x396323f3, 0x3535b536, 0x72b325b8,
+    0x7b3e7c7c, 0xf3750ce0, 0x3f67b977, 0x30419763, 0x44e0bdc0, 0xf9b82a6a, 0x8cabf7a9, 0x463a4316, 0x2ba8b313,
+    0xdceaabfc, 0xe1ce19de, 0xcbf3c6c3, 0x0e37e747, 0x4a919312, 0x238a5cd1, 0xab3a32cd, 0x1db08b03, 0x0c533db8,
+    0x56cab1dd, 0x2de8fb44, 0xf44cf82c, 0x41e5050e, 0xacac9b29, 0x988ca421, 0x81d08b6a, 0x0af79b02, 0xba8ab3b6,
+    0x8744f674, 0x79c92880, 0x2e5280d9, 0x157502c8, 0x1de23f34, 0x83e180cf, 0x62973287, 0xd2c33f5a, 0x43a8e5d4,
+    0x2f823bb6, 0x5244bd62, 0x11cfffbc, 0x599936d3, 0x7688b1f7, 0x38674954, 0x2814e2be, 0x89547242, 0x1cef7f26,
+    0xecae952f, 0x7476f663, 0x68e8c156, 0x3ae3f342, 0x49b7905b, 0xf6839c4f, 0x515427ab, 0x2291dec8, 0xc3e489b4,
+    0xcc39e994, 0xc1b5f349, 0x1896b164, 0xd013bd49, 0x29b1f49b, 0x32b482a4, 0x982e78e4, 0x3f4b479e, 0x65a6a648,
+    0x30a5ed44, 0xb21e86d4, 0xd985d1f6, 0x0b3cebb3, 0x3b1f1737, 0x2eb68611, 0xa4d6b772, 0xc16b7515, 0xd805ee5d,
+    0x5efd3e68, 0x08a13b50, 0x2d01eee9, 0x2e181161, 0x09e9b3b7, 0xd648ae21, 0x054ab5b7, 0xa27df43b, 0xc8debed6,
+    0xcf764646, 0xd3cba23a, 0x59a9c4f8, 0xe8ab8667, 0xc2d5d1bc, 0xcf3c3350, 0x965b1a26, 0x7a5a5455, 0x3f70ffdc,
+    0x2b45a588, 0x0a0abad6, 0x77e84ffe, 0x6a4c960f, 0xd4a17f18, 0xe2a7b0df, 0x882332e9, 0xff6c6b19, 0x3a34a783,
+    0x03ca7f18, 0x4340c788, 0xc5f3023a, 0x24fffc91, 0xb1650329, 0x07f6c423, 0xbc359c66, 0x7ab5137f, 0x8bb53362,
+    0x56c48dd5, 0x7e4432aa, 0x47e87994, 0xdd185796, 0x1a6108ab, 0x7e871c6b, 0xac0f75bd, 0x2ea1d023, 0x9ce2151c,
+    0x6771249f, 0x0c8a0687, 0x512ab5a6, 0xbef9f740, 0x46ac465f, 0xb7fd3530, 0x5acf9f29, 0x6306c090, 0x7ec6da20,
+    0xcc238dac, 0xfd716f6f, 0xa9cbeb9f, 0x28b9c04a, 0x792d7003, 0x8fb79652, 0x05dda002, 0x53e6bc49, 0x40740b60,
+    0x9ece1b2c, 0xbf3e8886, 0xf2a12104, 0x87197804, 0x898f11f4, 0x1949ca78, 0x9ddafc69, 0xbdbcfec6, 0xd39c20a3,
+    0x8021b54a, 0xbe4b5a3a, 0x398ed5f3, 0x3688efe8, 0x7f7f457c, 0xe3dca4e2, 0x18e7c0a0, 0xc5c2a6fb, 0x5b573565,
+    0x327ccfed, 0xecafb582, 0xeb048fab, 0x52209438, 0x46fc57fd, 0x582368e4, 0xb1dc93eb, 0xd8239878, 0xe4f4935d,
+    0x4b581d15, 0xf4cac300, 0x52c0eaff, 0x530d0236, 0x3e596f53, 0xa7061dc8, 0x55b60b4c, 0x1e1f5ec1, 0x6f02a2d1,
+    0x2fe2aec7, 0x3e9cffee, 0x4264a140, 0x56855482, 0x0a4cfa4a, 0xcf9463dc, 0x85d2c897, 0x00d4dc84, 0xaf39a691,
+    0x3c3d687b, 0x635ca162, 0xa33239fa, 0x13238fa3, 0x6626ff2d, 0x732a404b, 0x9bb9fbcf, 0x29efa0fe, 0xca70891a,
+    0x9d63ba1a, 0x5ba9f277, 0x4513f72b, 0x4ff113ba, 0x6dde22a2, 0x2b526eb5, 0x80fba1f7, 0xb0e24c49, 0x39fc71c2,
+    0xb0ff640d, 0x94328fdf, 0x959da2fd, 0xd7a9aff4, 0x798a254e, 0x017d00f4, 0x74f2df9c, 0x9850d1d4, 0xea4014bd,
+    0xd6965b39, 0x1571b25d, 0x3c816c97, 0xd410aa3c, 0xe23677af, 0xf8421b66, 0xb02a2efb, 0x9789f49d, 0x5febc910,
+    0xcb94842e, 0x04c093db, 0xd03afe89, 0x4e27bcba, 0x63814c9e, 0x8bdc1db8, 0x73feb726, 0x138848f9, 0xbafb4112,
+    0xe5348e11, 0xf0d10980, 0xa6201484, 0xf3f1a98f, 0xa2625369, 0x62fde77e, 0x0e1abd53, 0xd2967f7b, 0x0701c9e7,
+    0x1dffb4a5, 0x66012a39, 0xcdca274c, 0x4faf3c6c, 0x3da7fd86, 0x73a357c3, 0xa5df6177, 0x7eff42a9, 0x9f17ae74,
+    0x1baea2b7, 0x8f947f0c, 0xc1918306, 0xdd05dd03, 0xe223ab0b, 0xd66da2cd, 0x0cba4aea, 0xdb007a95, 0xa02691f0,
+    0xb7ddd5ee, 0x00ccc793, 0xcbc6b764, 0x87de7f2d, 0x6a45c9e5, 0x7cd2f742, 0x56076ac5, 0xb868c009, 0x45d02f11,
+    0x40684fd5, 0xa3f1664c, 0x7142a92c, 0xfdd7ecc0, 0xcdffcfe4, 0x72ce951b, 0x5058c0ed, 0xb2c15808, 0x38d6f7e1,
+    0x4418d9a2, 0xf75ba902, 0x0aaa4bfc, 0xe8ba31f8, 0xd5cb1d09, 0x46053df6, 0x3c70cb54, 0xc17c7d1e, 0x85cee8c2,
+    0x942f87de, 0xe947f5ee, 0xb2e1e237, 0xfe94e72c, 0x930fd982, 0x465ee3c7, 0xc3ca10f3, 0x34fb8c7f, 0xf179c5ae,
+    0xfa92fbff, 0xaa087ae4, 0xb58fb785, 0xe4bbba82, 0x7f6cae1a, 0x73112e0b, 0x85752e5c, 0x3eb87e67, 0x47ce5453,
+    0x8ca2604b, 0xbe607462, 0xe8b0beed, 0xb6f80b4b, 0xa344e253, 0x1b80bfa0, 0x1f430191, 0x5332dad2, 0xa17c64a5,
+    0xd17b9433, 0x708efe85, 0x47b498c2, 0x7b5e7af1, 0xc47e7349, 0x497998de, 0xc44f0bec, 0x32877f32, 0x7a281789,
+    0x7bbd511f, 0x356a68b7, 0x875b2b69, 0xc09f46b8, 0x7de337d4, 0x45cf4b5e, 0xc0462fc6, 0x5cdbf9ec, 0xe9854e0e,
+    0x812d6bde, 0x0afb3438, 0xafec0cd8, 0x606731f7, 0x74350a4b, 0x8ac9e2a2, 0x8d43f195, 0xff1b9e5f, 0x4632fbf9,
+    0xc2e95d06, 0x909fdaba, 0x42a3caa5, 0x40537b60, 0xe9961d9b, 0x7c9e6b90, 0x5d4e93b6, 0xbffb8caf, 0x1f2e9e8e,
+    0x5fa69acc, 0x9fa8f8eb, 0x2153a475, 0x874de097, 0x062340f9, 0xfafd23c2, 0x252b68e8, 0x4955bfdc, 0x793f73cc,
+    0x2403930c, 0x98aa5831, 0x6efe0633, 0xc64702c0, 0xbb12aa50, 0x45758374, 0x9cb53f00, 0x82cb6a5e, 0xdeeb08c0,
+    0x11e5cbdd, 0xdf80ed8f, 0x96e79a3a, 0xed1ae4f4, 0x9816ab64, 0x1d404222, 0x1b9123df, 0xd0874a91, 0x1cb38992,
+    0x3c73463e, 0xcd73df18, 0x3d8983a7, 0x3628e3a1, 0xa9f43379, 0x33dfb059, 0xcde3ce26, 0x32f71da6, 0xfd890adf,
+    0x3c21e4d5, 0x2f805400, 0xa2d5b019, 0xd7057ef4, 0x3f9a790a, 0xf59ec98d, 0x81befeb9, 0x66fc22fb, 0xa5458d0d,
+    0x57940534, 0xaf49b779, 0xa51aa119, 0x1f9f97f2, 0x9473e555, 0x35b821ef, 0x1f339480, 0x4cad342a, 0x42c49fe7,
+    0x60cf8a97, 0x1accbb77, 0xb5e38860, 0x9db3c1e1, 0x620e60c0, 0xf785dd6a, 0xff24d802, 0x3ade5afe, 0xd4b03609,
+    0xb64426fc, 0x8496ae20, 0xb211b935, 0xf13a61d9, 0x6e788773, 0x377e9ca3, 0x638c86bb, 0xbcef07b9, 0x9116a467,
+    0x0c6f3852, 0x205d4063, 0xae687c6c, 0x4ee7cb20, 0x65d50687, 0x7ed96565, 0x9724acfa, 0x48672117, 0x0ee5f42d,
+    0x31700be0, 0xd3d6dd25, 0x6c67a0d9, 0x031ce4ec, 0x06431aa3, 0x174e6b3f, 0x6dd312cf, 0x7b256256, 0x6eca8f40,
+    0x2c6f05a5, 0xffd310c6, 0xd1e4ac3e, 0xce1137dd, 0xc8f38837, 0x5f5e3719, 0xa948a5fd, 0xbb99c2c4, 0xa01e5907,
+    0xfd0d97cc, 0xeb8a9e81, 0xf7928132, 0x163729e5, 0xab20f7ea, 0x42414586, 0x92c22eab, 0xb8d33ca3, 0x36f3145f,
+    0x8e7f7a2c, 0x33920a3d, 0x0e899ad2, 0x8bf42d2f, 0x93e95f7b, 0x2b58cd24, 0xcd3867ee, 0x884313aa, 0xe27d640f,
+    0x09da2c2f, 0x25e64256, 0x244d7ad2, 0xa78565b0, 0xa18e2cbd, 0x8b25192e, 0xd2c869d8, 0x4a3c42b4, 0x16b2c95e,
+    0xfb3a69c7, 0xb62fd1aa, 0xc8adb845, 0xbfcb67db, 0xe6804545, 0xdc6e7f6d, 0x7a5702c5, 0x82a8994c, 0xd0f51c22,
+    0x5b90625c, 0xc1949abb, 0x8e0f89a1, 0xb1fbc0c4, 0xf2c6f51c, 0x92f271ea, 0xa033df21, 0x81d2a96b, 0xeaa1787d,
+    0xbd25f385, 0x0a0df7e5, 0xfb99a654, 0x85fc1542, 0x19abc07c, 0x8a6666d0, 0x94ac4a07, 0xda648476, 0xbfb6ee8f,
+    0x908d62dd, 0x874874f6, 0x4a9587b4, 0xac211a45, 0xf26355b7, 0x72f0beef, 0xf5d81f5b, 0xedaf7c7d, 0x375421f3,
+    0x4b2e565b, 0xe86fad65, 0xbaf4f3fb, 0x75c46a85, 0x965f0749, 0xacdc36c6, 0x29144ea2, 0xf54a2a78, 0x4e33a828,
+    0x1781f180, 0x980f35cc, 0x9c94c87a, 0x3f75803c, 0x80641d4a, 0x39993451, 0x745df065, 0x6eae5c79, 0x3500908e,
+    0xd115f8a3, 0xdb64ea62, 0x9aaf9902, 0x2eb2a018, 0x1a5a1eff, 0xd99c5155, 0x8b782d0d, 0xb7252fe7, 0xf6962778,
+    0xa431d792, 0x5e96b1bf, 0x9f62ed6d, 0x8fe0accc, 0xf9fdb7ec, 0xa639874f, 0xd32061b1, 0xd7e2f1c4, 0x586b0b86,
+    0xe0c2ea93, 0x9044d476, 0xc20142bf, 0x9b228c50, 0xd4e09d98, 0xd230b23c, 0x9f77b258, 0x27db85be, 0xa0c1aae8,
+    0xc30cba17, 0x9be10a72, 0xa75f371c, 0x96b49185, 0x44910616, 0x3e401a9a, 0xc2e6ad12, 0x53445c21, 0x59187a77,
+    0x7bb08d30, 0x97c2c937, 0xd39bd2a6, 0x25a98d74, 0x63cf3bff, 0x89510928, 0x96e7c3e9, 0xecd98666, 0xbf383c8e,
+    0x72cd65fe, 0xd013841f, 0x4583747b, 0x2f7362fd, 0x55829bc4, 0x2d70035b, 0x8a69759f, 0x3e81f5c8, 0x3cefd6cd,
+    0x68267385, 0x0ffd865c, 0x3c73b2a7, 0x95a28095, 0x02bedbca, 0x81a28d63, 0x10b13f5a, 0x9578692c, 0x8ab732d7,
+    0x5c36a5f3, 0x901e1714, 0x4ccc4da0, 0x9a7a5929, 0x0902f6a7, 0x298b45d1, 0xf323420f, 0xa14b3166, 0x8c1a3c2c,
+    0xc7f058c0, 0xcfb935f4, 0x4219bcb0, 0x1e0aadd4, 0x87faf2dc, 0x49841557, 0x95aa7c1f, 0x7499ba8d, 0x86448963,
+    0xef926bfb, 0x316d4949, 0x038718a6, 0xbf9895d3, 0x12cb96be, 0x28ae8337, 0x969e19be, 0xf0e1b2b6, 0x7975f0cf,
+    0x13e838cd, 0xc83950f5, 0x450cb9a8, 0x1f57625e, 0x05969ae0, 0x5bde4336, 0x6039a58e, 0x8a4be8e0, 0x5808b77c,
+    0xad6456fa, 0xd3e59827, 0x09f86c1d, 0xd55f6eb1, 0x1e28fff1, 0xaaf9596e, 0x420910e8, 0x456a8889, 0xc655ca54,
+    0x944134c6, 0x69bf72b0, 0xc7cde788, 0xa734a6e6, 0xeb7431dd, 0x84a616c1, 0xad32697f, 0x84c5c1e9, 0x1618feeb,
+    0x6f63c0b9, 0xb5369d5b, 0xda2d1271, 0x55c0f965, 0xac3f404b, 0x0fec246b, 0x1d3deecd, 0x2512584e, 0xd0d5227d,
+    0x192d6048, 0x8b42ec49, 0xd5774c2f, 0xa93ef1d6, 0xc89de1ea, 0xc363a20b, 0xe99d81f7, 0xff4d68ea, 0xd4fe0a9b,
+    0xfdca09c7, 0x28e10669, 0x1b5e2a40, 0xc1804910, 0xf1b1e6a8, 0xd9720876, 0xc41ec80d, 0x7d59f8fa, 0xd4131d5b,
+    0xf3e0fefc, 0x1c75dcc8, 0xa25a0eb3, 0xba2fbfda, 0xb9d6da19, 0x02ad3470, 0x80140958, 0x482a733a, 0x482fae6a,
+    0xab9dd7d1, 0xfe91f1ea, 0xbe7fb88a, 0x23fa0da4, 0x4ca673ff, 0xbae051a2, 0x58f77953, 0x29e4abcc, 0xc0e570ca,
+    0x02d1e958, 0xd2e9d2df, 0x1a671701, 0x634a5510, 0xe9da5a2a, 0x544bc37c, 0xa02b90c2, 0xac78553e, 0x7457929b,
+    0x4a048661, 0xd84e549c, 0x0b4e1f2b, 0xf02b21d8, 0x80b316e0, 0xe2bd18f1, 0xa850a36a, 0x374d721e, 0x02f52b97,
+    0x580e70db, 0x2a4fb7d7, 0xde48121e, 0x775c9dd9, 0x0f04691a, 0xd90bd228, 0x507309bb, 0x0ce65edd, 0x9b999936,
+    0xb1d7a0d3, 0x8c8b0790, 0xce0fa244, 0x2999ff08, 0x45a22cc7, 0x5485e4d9, 0xd5b18e0e, 0xacdd0a7b, 0xa74cbee2,
+    0x79f2ec52, 0x02bba00e, 0x1481b40f, 0x8c88a4a0, 0xef4100f6, 0x64502f9a, 0x38a660a2, 0xb1ef32ea, 0x5d6085c3,
+    0x49f2d712, 0x95272c20, 0xf7433f97, 0xac2bc7dd, 0x21915a68, 0xe951f2ba, 0xa8de22b1, 0x16fed4c6, 0x671c9665,
+    0x9517a89a, 0xfddd5e93, 0x02db2813, 0x8204a9d9, 0xa57235b1, 0xc3e4cdb8, 0xebd634cb, 0xc0c1c7e4, 0x3a646fca,
+    0x814d1acc, 0x7860c584, 0xed6ef544, 0x620b2778, 0x4db2700f, 0xe2b88749, 0x615c362a, 0x7392c8e2, 0xdd147a28,
+    0x0a201a44, 0x79235eba, 0x86361cf0, 0x5949a2cf, 0x6c077d37, 0xea7ea10c, 0x194efa39, 0x468dbdfc, 0x3efd4bcb,
+    0xf6224b9e, 0x88fb2354, 0x9768576b, 0xc97bd533, 0xe340ce5a, 0xbed996d8, 0xd3f44170, 0xb4c77bce, 0x78472c79,
+    0xe6fbe9c5, 0xafab886d, 0xd9ccfa6b, 0xd8bb447a, 0xc30a39b5, 0xb6005456, 0x8470a5b0, 0x861a99b2, 0x8bd16bc9,
+    0x0c744f2c, 0xf93af127, 0x46b72e10, 0x1a002b20, 0x73e28eb6, 0xcfc7f0c6, 0x2576f4c9, 0xfa6b9228, 0x18d5ed40,
+    0x80a5352a, 0x72569026, 0x6c8e6678, 0x9b439640, 0xc1724d8d, 0x7e43e1f4, 0x8edfed8d, 0xc60dfd93, 0x79fca3d5,
+    0xe42bac1d, 0xc07410c2, 0xde8573ea, 0x84d6f0f7, 0xde973cc0, 0x66fa5f35, 0x4f05012a, 0xfb4b3d49, 0x0477e292,
+    0x21e215bb, 0x921d64a5, 0x0acde91c, 0x4a9b51a3, 0x53ba3165, 0x31e52559, 0xb05061a0, 0xacc23c9b, 0x9371d39a,
+    0x4ea1b7aa, 0x549ff531, 0x3471b9cb, 0xf4689999, 0x4b5079d9, 0x74cfc1c7, 0x266e8496, 0xa6c1d6b7, 0x8a58371e,
+    0x6721aa16, 0xfdeb8c9d, 0x55196aca, 0x1e178f15, 0x1eea5b70, 0xb194c5dc, 0xfee2c7f2, 0x1f785ea1, 0xf628b113,
+    0x1d52c722, 0x3b53c525, 0xc39824d4, 0x30865af8, 0x10439ab7, 0x179b8bc7, 0x3b2c753e, 0xa54f96d4, 0x50b4e5bd,
+    0xab34c1eb, 0x831ed07e, 0x0cd2f69a, 0x27ccbbf2, 0x58302c74, 0xc206b2bf, 0xf6b9d140, 0x31f6b413, 0x2a4b6466,
+    0x9cb0ddb6, 0x143e4dd6, 0x6efa5699, 0x25c1e16e, 0x6796f6e5, 0xb09c6162, 0x4d1b6d77, 0x0d92e5d8, 0xcb362ad4,
+    0xd81c936c, 0x7e95bb59, 0x1c821cb4, 0xc842f5de, 0x28dadee0, 0x8c11ee7a, 0x2f01a9f7, 0xd8d117af, 0xe9de559d,
+    0xa59cb704, 0x00296ca5, 0x846f62ec, 0xc8d7a1e0, 0x1af3bf0b, 0xbde46cb1, 0x1d45d31b, 0x56267ce7, 0x0fc210eb,
+    0x130a9933, 0xafa6b9f9, 0x4adc7f9e, 0x60656bd3, 0xa4c0fb4f, 0x56d5e30b, 0x66315f2e, 0x7cd8e710, 0xb81a674a,
+    0xbb33818e, 0xbe312d87, 0x9647eec3, 0x9c15687c, 0x2ce715bc, 0xf5ef04b7, 0x2a27d3e7, 0x4d16237f, 0x3b9d9769,
+    0x6dc271ae, 0x06514faa, 0x9ea1923e, 0x39d2937d, 0xdf786c73, 0x5d8fa819, 0x72241386, 0x6dded558, 0xe47c3870,
+    0x429cf57c, 0x495470fc, 0xd9c71a0e, 0xcfd89fe3, 0x5d41d853, 0x5c6adee3, 0x758e77fe, 0x459d8b6a, 0xce1eebd1,
+    0x61ef0016, 0x88cb1541, 0x617e08ec, 0x907df9eb, 0xc11ad1c8, 0x78161e21, 0x78dea517, 0x6cb60c75, 0x7545fe67,
+    0x145a9e7b, 0x2f010b79, 0x6407babc, 0x27aa3d06, 0xaf809cd7, 0x2874a7a9, 0x4c06161a, 0x25a36d7c, 0xb9d01ae9,
+    0xeb86a5fc, 0x44f618ba, 0xa1ea27dc, 0x6035048e, 0x609d1e4b, 0x597c0c4e, 0xa7705e46, 0x0097eaf2, 0x2bb1a472,
+    0xb9e09ed8, 0xc2f9e86c, 0x4bd28950, 0x5e521a9c, 0x711f79a8, 0xe0ef089e, 0x7ad5e37d, 0xef784c56, 0x39100dfa,
+    0x4fce66de, 0xb9704793, 0x623efd05, 0xabf38810, 0x1602db71, 0x24fb2d53, 0x38e8148d, 0x906ae1d4, 0x04f345cb,
+    0xcdd9e006, 0xfcea52a9, 0x08fa3cfe, 0x3d43e90e, 0xec27ccbc, 0x9276d01f, 0x5ff2311b, 0x69e64636, 0x66681434,
+    0x754417c8, 0x9d03f500, 0xdf521079, 0xa4d9cefe, 0x52cbaaec, 0xbee7a909, 0x4421e71f, 0xe69f6bc1, 0x2f206410,
+    0x59e1ba0c, 0x19f679e5, 0xbdff3710, 0xb192000f, 0xaaaeacda, 0x5d7dbf3e, 0xd0d6b6f7, 0x6cd2a6d7, 0xb8bb1d0d,
+    0x20a775e3, 0x5196aa1a, 0x5bf1b9c5, 0x47289098, 0x445e801c, 0xc93d8f0a, 0x727a0742, 0xa430a481, 0x6b90c8be,
+    0x53cb35c1, 0x3b216f19, 0xd00e920e, 0xdf2ab3dd, 0x2fe14c32, 0x71ad065a, 0x3e255e90, 0xf3242873, 0x77095e36,
+    0xdddb9c3d, 0x406a9df8, 0x75fd7bb3, 0x745807c8, 0x406af4d5, 0x444e996b, 0x4bb594a1, 0xa025382e, 0xa0aa8608,
+    0xdcc239cc, 0x11a33ab8, 0x7e470086, 0x98dcab61, 0x99c3a34e, 0xcf7be30c, 0xd38358eb, 0x858e7267, 0xa814aa10,
+    0xd0026373, 0xeea8bc8f, 0xa116155f, 0x59bb36f1, 0x3cb990be, 0xf8786196, 0xf41e0ced, 0xebc1f965, 0xdab74faf,
+    0xdc089451, 0xf0d2b312, 0xf979f182, 0xf4e1aad8, 0x319ef124, 0xfce82900, 0xfa85b56e, 0x2857aa45, 0x3b607bbb,
+    0xedcf4e5c, 0x74b3d763, 0x67f7abc7, 0xc879d8d2, 0x1876964f, 0x5b2a96a0, 0x48cfb304, 0xc06a2760, 0x4b9cfe09,
+    0x23d2d7e0, 0xf991a61d, 0x2d3d5252, 0xdf7c260f, 0x0913205b, 0x4b1bb692, 0x2288b407, 0x3042695e, 0xf04bac61,
+    0x1c13b82d, 0xb908536e, 0xf8507da0, 0x95784649, 0xda81a42d, 0x7672ab83, 0x3dfc6c3e, 0xe7a39fd5, 0xb373ec0a,
+    0x2221d298, 0xe4d53de9, 0xa9f5c406, 0x452df968, 0x539e1479, 0x8c5d9682, 0x192174d1, 0x0c3a827d, 0x7bd32a17,
+    0xecb5effd, 0x06516364, 0xee79feee, 0x1ed4a2f8, 0x0c2f077e, 0xed58299a, 0xb99c6b2e, 0xaff2d711, 0x6845a14c,
+    0x0287310a, 0xc04339bb, 0xae413042, 0xc3e61ba9, 0xeb221f4e, 0xc02d8611, 0x2c81b1d0, 0x09dd0244, 0xecd3d3dc,
+    0xf64b2871, 0x8e019fca, 0x793d90d3, 0x44fb3cd5, 0xbad177e3, 0xa25a0dec, 0x66185c7d, 0x70eb0b45, 0xc69a564b,
+    0xdce217b6, 0x17bf2586, 0x6922ef6a, 0xd4bd501e, 0x4051e6c5, 0x22004b1e, 0x286ff8a1, 0x58b3e25d, 0x91c08ce6,
+    0x87a3af84, 0xec37e6dd, 0x749cdc7d, 0xbbe28a99, 0x27e708de, 0xffab88b0, 0x71b0992d, 0x9b39c8d1, 0x93b30db0,
+    0x3979e415, 0x802b8d0e, 0xd054b6c0, 0x71a3800d, 0x6178ab6d, 0xd2950300, 0x8e8919bb, 0x8da08546, 0x21fd4887,
+    0x74cce36e, 0x44a327da, 0x8b9564cf, 0x0939d37f, 0xdaf2d652, 0xecd75d50, 0x58b51ba5, 0x8aa2f3b3, 0xa8f920a5,
+    0x61b29cf1, 0x4eb487e5, 0xdf250e30, 0x6ddc7992, 0x24e282f6, 0xdf03faa7, 0x264b7bd0, 0xb9ca2f8d, 0xb9f66e6e,
+    0x726186fd, 0xb599278a, 0x3cca5d88, 0x860e69f4, 0x07dea244, 0xab4622e1, 0x318e9b33, 0xfee6f5d3, 0x4e1fd614,
+    0xf2ab89b9, 0x58438c76, 0xd5d81c56, 0x38922625, 0x6d5c25c0, 0xf7813091, 0xae450e66, 0x6b0bb35a, 0xa21918c7,
+    0x63ef0e55, 0x7b43aa74, 0x22acd30a, 0xb4d54b6c, 0x19f1cb28, 0xd41ebd4b, 0xf4dd7edb, 0x91aa90ce, 0x8ccc09ba,
+    0xd5ff90cc, 0x743ed239, 0xa692b9c8, 0x6244587f, 0xde97b4e3, 0x913fd262, 0x47a7f0dc, 0x6a070a1a, 0xcf1573c4,
+    0x47227bb9, 0x9959eae5, 0x754541ec, 0xa2de8140, 0x54a2ce99, 0xaa888ae4, 0xd5b19bb3, 0x82f15ad7, 0x093471ec,
+    0xe47f5b7e, 0xfa3ccefe, 0x4aa459ce, 0x3d9df756, 0x572b6a40, 0x5c0cd825, 0x96776dc9, 0xc41593d9, 0x9b7bbb2f,
+    0xf89349c8, 0xeb8e3b2e, 0xa3fd77ac, 0x183daffd, 0x7f5896b5, 0x170f08bf, 0x8ed9dc7b, 0xb447020c, 0x2aabcca9,
+    0x5c7be665, 0x45ff2011, 0x63625c8f, 0xacecebcb, 0x168b2477, 0x1519b17e, 0x3e9c5d6e, 0x23272379, 0xa957b027,
+    0xb41d3e22, 0xb1050246, 0x86d06691, 0xf38c86bd, 0xc33a5e8c, 0x23d50c15, 0x48167d3f, 0x3675ec6e, 0x80241f27,
+    0x57e828bf, 0x75835c9b, 0xb19a0e3e, 0x93b1b7e7, 0x95685cfa, 0xb5712c4d, 0xd52555f5, 0x7a3f0352, 0x6cefd18e,
+    0xa9ce42bc, 0x17bc83c0, 0x0621ad25, 0x9a48a3cb, 0x752cd15b, 0x18c7ac33, 0x80e91dad, 0x42951356, 0x0dfdb850,
+    0xcd65a5db, 0xfa18edb8, 0x0a6b3b85, 0x6a0cfbb0, 0xf4d81760, 0x094e502d, 0xd11dbe68, 0x8c9de5fa, 0x33d21c20,
+    0x05d4e2d6, 0x2c0ca5e6, 0x205c3459, 0xd9f739ce, 0x1409c653, 0x1434656f, 0x55361403, 0x7ffb6cae, 0xf628423a,
+    0x5c9fa120, 0x118170bc, 0x10a19786, 0xfccbc1ce, 0x42d32a5e, 0x9916ea5b, 0xae1febbf, 0x1ea68d8a, 0xb7feb199,
+    0xa53dca3d, 0xe10b5eba, 0xbc85f4bf, 0x0cc84213, 0x01676051, 0x0ce17406, 0x63ade585, 0x4920648e, 0x0a8c6ad0,
+    0x7c75cb18, 0x68eb89e7, 0x995ef9c2, 0x158b490d, 0x2b9c31db, 0xf11525f3, 0x2ea6db22, 0xddbfa24e, 0x9a6db8a9,
+    0xb19dec47, 0x3b5e1833, 0x272ce6af, 0x64d40d1b, 0x6773e632, 0xd9ef7cb2, 0x6d2cef4f, 0xbe85d2b6, 0x4528d868,
+    0x2e8bec59, 0xf6983653, 0x11505620, 0xd5602cb0, 0x599ba9b5, 0x943a03c3, 0x2297183c, 0x09fef7ea, 0x9af5dd6e,
+    0x73176f8d, 0x8829a90e, 0x861e0b18, 0x3bde3aa8, 0xeb1ed178, 0x40bc06a3, 0xb74aaf33, 0x55bb805f, 0x2bced174,
+    0x18112c10, 0xd145250c, 0x27f5bf1b, 0x13bfca3c, 0xbe78a3d9, 0x7bb2264f, 0x246f7a13, 0x1a2961c8, 0xc748b5ee,
+    0x8f291ab4, 0xa8c8ae4d, 0xfcfc737b, 0x5ab55190, 0xb22d50aa, 0x3df86db1, 0x0db2c933, 0xa602012e, 0x6ce02a25,
+    0x51f7b731, 0x20bc3c4a, 0x7045f6db, 0x08dbdacc, 0xf7a07315, 0xdbd3b0ea, 0x1ed8c53c, 0x8dfba1ef, 0x58516f27,
+    0x7da6ae7d, 0x2a8a6472, 0xdb06f0c8, 0x797dad1f, 0x3de3a083, 0x334bb954, 0xacb365ae, 0xa064d8aa, 0x7ad32652,
+    0xc7f8dfc4, 0x6548b191, 0xd3ff4a05, 0x6b925e0d, 0x651653eb, 0x7896b2b9, 0xe80788b9, 0xc20fefc2, 0x7f2eb06b,
+    0x5b2f8276, 0x7aaa8188, 0xf9c2b43d, 0xac5ab4a9, 0xcb00ea0e, 0x560d9bf0, 0xf283a9fe, 0x94558266, 0xd9078265,
+    0x932021ad, 0x596df354, 0x487453f5, 0x37a16f18, 0x0b8bfed5, 0x71c58a22, 0x835b30d0, 0x22b4970c, 0x4ec72b18,
+    0xf3ade298, 0xeaf83e55, 0x45d10038, 0xba27e653, 0x19b2df0e, 0x9f5d42de, 0x96862d85, 0x9e89ce5a, 0x15671264,
+    0xb81b316d, 0x5c54db3f, 0x3800ef79, 0x417cb962, 0x58a29661, 0x135beaa8, 0xa176238d, 0xa33b5322, 0xc67e09d9,
+    0x6532da30, 0xab4cfbf1, 0xf68484f3, 0xe9afa2fa, 0xf7858a19, 0xb86faf80, 0x6f10d264, 0x5a3b416f, 0x0ed0c390,
+    0x01dd895b, 0x9b1be4e7, 0x4b8a5e50, 0x51a9e42a, 0x3d933610, 0xaa2f887c, 0x0465c7cc, 0x3bf5e4e1, 0xd6c2d96c,
+    0x0c0fa93a, 0x1c06aab7, 0xf6cdc795, 0x335190c3, 0x760878f7, 0xbaaa4e4c, 0x3ea76931, 0x6a92ef17, 0x15014579,
+    0x20473ba1, 0xbfbf3ddc, 0xf4a5bd9e, 0xf6941b9c, 0x49e1d611, 0xcc6876a8, 0x6142368c, 0x89efc57e, 0x4b491587,
+    0x64b7d33f, 0xc650100c, 0x974d462a, 0x38a16f21, 0xcbb3fa5d, 0x41b3bfc0, 0x9084c59e, 0x4d85cb76, 0x43c5590e,
+    0xd210465b, 0xee8ea61c, 0x8a9797f0, 0x9cae6095, 0x957d3d41, 0x7427bfd3, 0x0126b864, 0x992a4b16, 0x6b5ab5d2,
+    0x0cd157de, 0xa0206143, 0x6b32b6ce, 0x7ad73902, 0x3137e541, 0xb8422d58, 0x7ebb4bc0, 0xbb23edd1, 0x07e68321,
+    0x86ea19f3, 0xca39f2cd, 0x85d2d5e1, 0x307f99b7, 0x8a4df4d8, 0x10d1d684, 0x7d129a73, 0x17f3e99c, 0x13397566,
+    0x4ee5e62b, 0xb3a46b9f, 0x0dcd0497, 0x1bc5c816, 0xe104cb33, 0x03c58642, 0x62a0b4b3, 0x8addf579, 0x062bdcdd,
+    0xab152409, 0xc72c21e0, 0x7d7f0833, 0xc4ba2550, 0xbe4dccbd, 0xb4ed34c7, 0x8d9e4074, 0xe7440bd2, 0x8cba0795,
+    0x77a128c5, 0xe9579721, 0x082f59ac, 0xe76e12a1, 0xea84c4f2, 0x0924046e, 0x1223e2cd, 0x203a9397, 0x0fdf07b4,
+    0x3e859ee2, 0xb757952d, 0xca106535, 0x0d7c31f1, 0x83a35469, 0xde0b208b, 0x84f4ab2b, 0x46ba1537, 0xd8d6c417,
+    0x04fbff92, 0xdc4b2ef7, 0x10cfeeb8, 0x801a48f8, 0xed097914, 0x16479c5a, 0xf4547770, 0x5ce3a568, 0x7425694f,
+    0x3a221f32, 0xb479232f, 0xd5bc9102, 0x1beed2f0, 0xd377e5f1, 0x7b34c03e, 0x8e46e84a, 0x4a76c77e, 0xfd3a22d1,
+    0xa89058c0, 0xcc82d48e, 0xd757df06, 0x685adabf, 0xca14c4d1, 0x75d8871c, 0xd3d68795, 0x4bb10b88, 0xab681918,
+    0x3ff1183d, 0xcd44c2d9, 0x5ac6294d, 0x2679844a, 0x6420c7fa, 0x70c4026c, 0xa2c29ea1, 0xe0e7f5ee, 0x6206d483,
+    0x97ff38d9, 0x1f0f8b38, 0x1088671a, 0x23d30e27, 0x5dc65efd, 0x07818c91, 0xeee843e2, 0x458ba89f, 0xc9680ddd,
+    0x7f904b6e, 0xc74bfe27, 0x0d91ef24, 0xe5ce4621, 0x6f87130e, 0x4e1452ac, 0xc880236d, 0xfe6f6038, 0x5b8d7e7c,
+    0xd480a335, 0x86fde88d, 0xebfb165f, 0x87fa46f7, 0xcc3e6fec, 0x79a15dd2, 0xd28bb125, 0xafc4dc61, 0x65d3d17e,
+    0x43d414f0, 0xae0938ea, 0xd4beafff, 0xe40cc09f, 0x549cb166, 0x46fd1634, 0x1172f76e, 0x903e549e, 0xbd923970,
+    0x7e126c4a, 0x161aec44, 0xa51128bd, 0x65ce78c8, 0xacef97fd, 0xd34c25f4, 0x1c2c1b1f, 0x5ac06ddc, 0x033928f6,
+    0x86a23125, 0x7353a045, 0x014df84c, 0xbe8b2781, 0xfd440966, 0x41009ec2, 0x06e8eb15, 0x94ce49ec, 0x362367b3,
+    0xcd637e5f, 0xdf28f8ba, 0x24eec01b, 0x66cfbfcf, 0x59b1c015, 0xa8518a73, 0x61eea412, 0xa62a75fc, 0xf8a98e47,
+    0x14127cd0, 0xa7b4b00d, 0x9d035a5d, 0xa71ac2c6, 0x6fba87e0, 0x122d470e, 0x1f725fc6, 0x14815c86, 0x2279e028,
+    0x45f14f0a, 0xe1e172d2, 0xbaf07c29, 0x55bbd838, 0xab6ca0bc, 0x20b74cf9, 0xf7125a79, 0x1a2a9c75, 0x17e584bc,
+    0x7b5d1e09, 0x834af85b, 0x4f32e1c9, 0xe612f1c1, 0x247a859f, 0x393661cb, 0x402e9c58, 0x0f90d692, 0xa7bb6b04,
+    0x41f6e88e, 0x24335cbe, 0x20964b29, 0x4f0fcd96, 0xd388af78, 0xc247aa20, 0x5fd83ab5, 0x1b103e54, 0xeeb9cb91,
+    0xaf028643, 0xea078f3a, 0x4dc3e56c, 0x836eb7e8, 0x845f8f1b, 0x55c51669, 0x8a281e99, 0x4b5a868d, 0xc476940d,
+    0x0790b43b, 0x0a26b1d4, 0xab28ced7, 0xd06b5a71, 0x924acc78, 0x88954796, 0x2290f876, 0x9bac321d, 0x112af9ff,
+    0xaeb76016, 0xcd65062b, 0x4d0c1bc4, 0x95788649, 0x4cd5d34f, 0x996cbf8d, 0x67737f61, 0xdb3b4803, 0x6bdf5464,
+    0x75c08c50, 0x16bd924c, 0x86da57a8, 0xdf8f5db6, 0xa3c7a28e, 0x8ab2d267, 0x87b5b7b2, 0xffffa3d8, 0x0140d1b2,
+    0x08734135, 0xe9ea2610, 0x655b6aed, 0x44affe03, 0xebcd85d8, 0xf495bc51, 0x6232f9e8, 0x9ce674e9, 0x6d62bed4,
+    0x6922b0d5, 0xee5289ee, 0xfcacdd98, 0x72d85cf5, 0xa7c31b58, 0x2ffd4a16, 0x7890dbb1, 0x51f1df81, 0xe9ec5a81,
+    0x4b2e9df5, 0x9eede5d2, 0xb8e6abd6, 0x8f68b2fd, 0xa4463b1a, 0xf079189c, 0x8fac4b86, 0xadaced93, 0x015b9a83,
+    0xfd890a3f, 0x8136c330, 0x67f80227, 0x35e532e6, 0xc08fc5be, 0x3207d3ac, 0x85417c9a, 0x267e7371, 0x67e98cd0,
+    0x81479ae0, 0x9caae138, 0xdb059ec8, 0x17a582c2, 0x832c5e94, 0x02f9ae13, 0x10a0f3ff, 0xab772542, 0x0e18fd86,
+    0x489660f2, 0x4339af45, 0x0d63c53e, 0x6a98246b, 0xe671a95e, 0x6039adfa, 0xbc1217b9, 0xcf569291, 0x73f530ee,
+    0xcf6e8b26, 0x81074d20, 0x80f7dd13, 0xdeb3deba, 0xf1b2141a, 0xc55684c8, 0xc3fdf887, 0xf272c98e, 0x9959afd2,
+    0x930f9fee, 0x3978f6cf, 0xdd43e6bd, 0x8c2fe62e, 0x897b824a, 0x178b15fa, 0x0aed7b86, 0x2dc1b691, 0xdf6bb0c6,
+    0x4f786bbb, 0x35e8464d, 0x8ba6865e, 0x29a2e5e2, 0x42932a62, 0xb84e598d, 0xcf415e48, 0x51a288c2, 0xf02b7d66,
+    0x4eb0d505, 0xc8192f7e, 0x935b2bc8, 0x4eb5c69a, 0xef412005, 0x71e581f8, 0xa11f3de0, 0x8c22bb83, 0x3bde3d7b,
+    0x828d06a1, 0x8956f048, 0x5de51a20, 0x5aeabf4f, 0xc706331c, 0x475c7e64, 0x68167324, 0x30e34900, 0x088336cf,
+    0xa3ffd361, 0x96f1e611, 0x89885410, 0x65fc27ca, 0x82ea23dd, 0x5fc08061, 0x7aadb9ad, 0x0df28f9c, 0x61218c7f,
+    0x79465f89, 0x1503e181, 0x29538c52, 0xa3f5103b, 0x9542394a, 0x0299e5cb, 0xbfed79df, 0xf3926b01, 0x6e829879,
+    0xc8ce8d23, 0x6436f8d7, 0xd5b22031, 0x793a3059, 0x74df073a, 0x48547246, 0x05b368a5, 0x0d693c62, 0x51edbeb0,
+    0x5f106968, 0xdb01c977, 0xa700b612, 0xd3bf5cf5, 0x0932a203, 0xb5a5afa1, 0x9b4fd0b5, 0xee295c61, 0x6cfb0866,
+    0xfbeac2de, 0x1ec51946, 0xe0a23c31, 0x671264ad, 0x3e008665, 0xc4e3e845, 0xc3f1e57c, 0x7b143f48, 0xebe66dca,
+    0xd0f77d3b, 0xe1a2421a, 0x2504cb4b, 0xe53cbd7a, 0x5388a824, 0x9e08cfb6, 0x5cd8cc3e, 0x84cab207, 0xe9668e4f,
+    0x6df75e5f, 0xd164886c, 0x42ae6566, 0x560e4236, 0x88400616, 0xeeaa56f5, 0x6a9c2ae6, 0x7ed2820d, 0x07dc7eef,
+    0x53a8cca4, 0x5e511662, 0x82a636a5, 0x953508df, 0x6f648b54, 0x96afa7e6, 0xcc619166, 0x8dff8cd6, 0x029b372b,
+    0x485504d1, 0x429a665f, 0xf5cc0f85, 0xec4d271a, 0xf999b85c, 0xd0feca34, 0xe14b9d64, 0xabd568b2, 0xc2e9cb89,
+    0x158814eb, 0xd3213252, 0x5240f2d5, 0x15243ce7, 0x7e9aa9c6, 0x5e2947d4, 0x9b35605e, 0x0612ba83, 0x2bc0101a,
+    0x09afda53, 0x247f0b30, 0x17e3f301, 0x3abbbd20, 0x798d6edf, 0x8cf9c834, 0x74ad3f18, 0x5859c356, 0xa1fd3118,
+    0x9c7d74ec, 0xcbd45246, 0x6a8246a7, 0x380b7604, 0x42375402, 0xbd23ad4e, 0x908e40bf, 0x60e563a6, 0x6ea4cc39,
+    0x0d66be92, 0x62cf9aa6, 0x5d85be77, 0x992407e6, 0x5dd70165, 0x3fda2bd9, 0x525f4ba7, 0x7fc9fac7, 0xeb5d0291,
+    0xa8538ac6, 0xfdb63d2f, 0x0a088915, 0x82fc31a8, 0x907952fa, 0x3eb8410b, 0x9d2d8aae, 0x97435c46, 0xbbfe309a,
+    0x475f05ba, 0x00341227, 0xa0094658, 0x6d1ca2a0, 0x53be657f, 0xf2c47854, 0x2fdc39e6, 0xbd10cd79, 0xd5583abf,
+    0xcc12ddba, 0x826b6ee8, 0xcc11a8a1, 0xc6735043, 0x70f3699b, 0x76311dbe, 0xcbd6ae8e, 0x188dda47, 0x7217ac81,
+    0xa455cc5c, 0x09ab4c04, 0xf691dc22, 0x5021e76d, 0xa0372aea, 0x5cd072a2, 0xc02245c7, 0x7bfb9ff4, 0xa1b10968,
+    0x0ca3e5a6, 0xbb3d2359, 0x0abd6c95, 0x3765e418, 0x1139498b, 0x10229627, 0x1f14c29b, 0x327499c1, 0xd0c3854c,
+    0x12d34578, 0xdeafd16b, 0xfb5cc6a7, 0x8cdc31c5, 0x479dd44e, 0x4cace836, 0x54537eef, 0xa78251ab, 0x1cda51fa,
+    0x28a7745c, 0x9b393ffe, 0x00e7b465, 0x5b402b0f, 0x1516c47c, 0x5ea92fbd, 0x7c6be082, 0xf5f7cbe2, 0xe53c9847,
+    0x57e9b659, 0x89e9e644, 0x3ee36c7a, 0xe6babd3e, 0xd9b372b7, 0x214c4648, 0x0df1f21a, 0xd163e2d2, 0x750c5ef9,
+    0x631438a8, 0x2fc0f4bd, 0x7ebf5b77, 0x735ab150, 0x016de2fc, 0x29891191, 0xc597d17e, 0x62663fab, 0x30736cbb,
+    0xf5200dd3, 0x2f7f749e, 0x56fdab58, 0x14ae80e5, 0xf29656cd, 0xc8311b29, 0x80dba3fc, 0x33e105a7, 0xf965399b,
+    0xff903a06, 0xb6e58741, 0x70c02f7a, 0x2bcd1954, 0xb525643c, 0x2e3ac43a, 0x8b0f9f70, 0xef3878b1, 0x19bbd95c,
+    0x61a3b73a, 0xa7a14802, 0x2bb5c688, 0x8a6b5284, 0x7743ae74, 0xcbf6630e, 0x65fc894a, 0x2990c681, 0xbacfbd97,
+    0x70aaaaa1, 0xbebf02c1, 0x72ddfdae, 0x0be371f8, 0x9aa01ab8, 0x6eec039e, 0xf6b7817c, 0x02062edb, 0x33ed0e02,
+    0xfcceb222, 0x7a5aaeae, 0x71c59db8, 0x65dbcf3f, 0x5f4a8db3, 0x762ddf69, 0x60dd0267, 0xccdff131, 0xbb3d7eb7,
+    0xdeb41690, 0x13f027e0, 0x0945bee7, 0xf12a9046, 0xe850e439, 0x17ff48a3, 0x8fcdde0e, 0x0bacf0ce, 0x010c62ca,
+    0x7200037a, 0xa82d0206, 0x66fc64cc, 0x39d84e80, 0x97725f10, 0x018f482e, 0x38a4b7b1, 0xdbedd300, 0x741a4d10,
+    0xf1a083b8, 0xa0a766b3, 0xe5934776, 0x3d5bac5f, 0x9167169c, 0x9987dca0, 0x1c13e7e6, 0x6109a3c5, 0x9e48b66e,
+    0xbd05e6c7, 0xae7f992f, 0xbe055723, 0x61a246e9, 0x0a1c96b0, 0xbf41c3e7, 0x452afc11, 0x67e7efad, 0x821f5145,
+    0xf1933c64, 0x1ec03d17, 0x6df37952, 0xc39d3fa7, 0x1f027b29, 0x52d19e43, 0xc91aba18, 0x17526d10, 0xbaa3e1c1,
+    0x7fa17443, 0x308eb9e5, 0x99050173, 0x555e4368, 0x2721bf5e, 0x73acb09b, 0x47543cd0, 0x2baf0622, 0xb4e89584,
+    0xa2dbded2, 0xa209842a, 0x61cfdaad, 0x4c788700, 0x5721146c, 0xd97eaa16, 0xa3306d2e, 0xe4569a46, 0x1939848e,
+    0xe52d01cb, 0x25c822d8, 0xcd03447e, 0x1cf612da, 0x4d83a547, 0xa51ed955, 0x2c892db3, 0x27b62383, 0xb37247c1,
+    0xe0928d38, 0x716efa63, 0x8d4477b2, 0xd003b3aa, 0xc973eb90, 0x61fb1345, 0x488f8514, 0xa1c602cb, 0x06c9419d,
+    0x887ef9cf, 0x8b57ef89, 0xbf21e735, 0xe149700b, 0x5be92b9d, 0x890f45b3, 0x929850df, 0x55f085b3, 0x3e72a472,
+    0xed464e00, 0x4f3b97f4, 0x24811340, 0x78301094, 0x4952fbf4, 0x4f0dccda, 0xbdedd1e4, 0xa97f53be, 0x78871276,
+    0x4f88fc8b, 0x41916802, 0x2ec3d0ba, 0xb93cc3d1, 0xab2ede0a, 0x50e27458, 0x494c76b5, 0x09fc1d2d, 0xf1c07061,
+    0x50d33ec3, 0x1bbc132b, 0x0dc99ff4, 0xafd3b8bd, 0xdd5b2c91, 0xd5d11961, 0x08ab6225, 0x17b4ef4a, 0x56092dfa,
+    0xfda17afe, 0x57337d14, 0xad531619, 0x4966c6b7, 0xc01fe3db, 0x713d89d8, 0xc87eee48, 0x07010a94, 0x98555808,
+    0x92ff3126, 0x175ddcc7, 0xc1476ca4, 0xd01ba353, 0xfb516c94, 0x21704672, 0x4c0692d5, 0x94e2c206, 0x6220fedc,
+    0x646ff213, 0x66576f94, 0xa93efd39, 0x3a0fe3de, 0x9b47bc0f, 0xa7da3e00, 0x65bdf50c, 0x7c1a932b, 0x2babdb61,
+    0x1113272d, 0x4f6f9007, 0xcf6c8eae, 0x3d0ed56e, 0x16e90e88, 0x509c5d21, 0xf097d3e9, 0x01ec1a85, 0xf90b93f3,
+    0x65748611, 0x806a9536, 0xd772bc4f, 0x6c98d14d, 0x5af1a683, 0x31aa9194, 0xc6bcb148, 0x032dcc00, 0xc641dfb1,
+    0xb4f236b0, 0xdc1a9d4e, 0xbe185fa2, 0x4d15890d, 0xb4b77a49, 0x8eeaef5d, 0xe3fda329, 0xa5b9636a, 0x0ad2b95d,
+    0x705dd20a, 0x1cc32bd1, 0xf7c40a4f, 0x94b1d376, 0x21ee7c4b, 0xd87c3369, 0xb6112b92, 0x939c87bc, 0xdae4cce9,
+    0x336554dd, 0x9c67f332, 0x1fb9c5c5, 0xb8c0e069, 0xbb16809e, 0xabcfeffa, 0x8513e215, 0xef6c0001, 0x72f4a2d6,
+    0xe0aef618, 0x5b0df215, 0x47ba9059, 0x893bdd22, 0x3ae3344e, 0x97a45c83, 0xbd959ef1, 0xe31bbc51, 0x5e40eee2,
+    0x9ae7a8f6, 0xa893a091, 0xaa37fdab, 0x39b59285, 0xe3fe91aa, 0xbe90c435, 0x109eac7f, 0xbcde0ce1, 0xcd8ff7e2,
+    0x83b381ed, 0x64c82bac, 0x6d4c79cb, 0x88812193, 0x15530bb6, 0xf8219e4e, 0xad962323, 0xb4d872ca, 0x57ba7c63,
+    0x81783b22, 0x9f27e08e, 0xe8d8d7bb, 0x92845ea2, 0xa20df19d, 0xac2c5d65, 0x6b4855cd, 0xe9d7c561, 0x4a0befb9,
+    0x8bc36cf5, 0xfe9486fb, 0xd8dd6fe4, 0x532ffd51, 0x2e608e95, 0x67ba20da, 0x99e05f14, 0x3f9e0ef4, 0xa4e62480,
+    0x6a1d2004, 0x58375627, 0x12b9abbc, 0xaa539e23, 0x03194d8d, 0x3d2196d6, 0xc8b1381c, 0x1cdea34d, 0x932f439a,
+    0x4db0d203, 0x575f37a9, 0xb681486c, 0x8110b078, 0x4ddc0658, 0xce26ad17, 0x5f27247a, 0x6f383844, 0xddc5bce5,
+    0xafaf8120, 0xb61ed985, 0xc1655946, 0x5f69c2bf, 0x7627c26a, 0x9bcaa855, 0x92e81484, 0xd3aff4d4, 0xa10159a6,
+    0x017f5588, 0x8176fd8a, 0x889ea6d2, 0x0ea3ef09, 0xd7fee4b6, 0x8a38a356, 0x7592d4a9, 0xb46bf5c0, 0xfc7dc9c5,
+    0xc395e46f, 0x212ad04c, 0x10339d30, 0xb75145ba, 0x5b2682db, 0x668fa32b, 0x9437f50e, 0x27b3c0ca, 0x7ee87770,
+    0x93276f21, 0x035a19d5, 0x41d2e0ca, 0xb5244103, 0x1a46cbed, 0x8d10f5a4, 0x3143f176, 0x94225fed, 0x56d645ce,
+    0x39fa90f6, 0xc81f8b4b, 0xacd504f2, 0xcfb79a75, 0x2a544b04, 0x7107e2a3, 0x4addea45, 0x3ec55114, 0x73fd8b97,
+    0x59ab2230, 0x98dafb38, 0xf09e7070, 0xf8fbd621, 0xfef040e3, 0xdbba91b0, 0x14d8a2b1, 0x121d4319, 0x3b571eb1,
+    0x03b6a66a, 0x1009044c, 0xd5e96e46, 0x7b3803d8, 0x942811ce, 0xc2b7704c, 0x2f70403f, 0xc55d9483, 0xd5ae795e,
+    0x00601111, 0x5148fc2f, 0x1a5f0c13, 0x208bd4d0, 0xae6784d4, 0x27a71bb0, 0x8f2cc772, 0x58f4ddf7, 0xd116e789,
+    0x23140862, 0xdf0cc9dd, 0x24a01ca1, 0xdd94f54f, 0xc01591bb, 0xb3f4283b, 0xc81e2feb, 0x48280679, 0x7b91a2d1,
+    0xa73a8fa2, 0x12f34bd4, 0xdd43e60b, 0x00761d4a, 0x0fa69647, 0xd3f20d6f, 0xf7ae22fe, 0x0e9592d6, 0x6d14da9d,
+    0xaa1848ca, 0x70846d77, 0x68df1d8e, 0x9360fe34, 0xcd91af10, 0xfde00c76, 0xd5decea0, 0x26b54ad4, 0x6433edc1,
+    0x97f8c38a, 0x4b52555b, 0xb8bc407b, 0xf1a173b8, 0x137b11ba, 0x3f7868fc, 0xe00990f4, 0xc697cfb8, 0x8bae0457,
+    0xe00cbd80, 0x284a3250, 0x9a1b7a8f, 0x445b6ca9, 0x69bab65f, 0x6804218c, 0xcbbf86b2, 0xd6298f74, 0x4dad880e,
+    0x45aea576, 0x4f42c743, 0x87b9f0ef, 0x6fe3d168, 0x6a231fe0, 0x7e4d6ba6, 0x5642db82, 0xe443f3e7, 0x01e80bf9,
+    0x73e79ec0, 0x6bcc19ad, 0xd7329cf8, 0x87885834, 0xaea4aec5, 0xd34c4e60, 0xe1057ca1, 0xedbd12a0, 0x7080bb48,
+    0x06b3879f, 0x4240aa49, 0x09e83beb, 0xf0bfadb2, 0x54c9dad5, 0xe705a4d4, 0xd97327a2, 0xb015052a, 0x9bf91b72,
+    0x8738eec3, 0x94a01ce1, 0xf9c5dffc, 0x8cb12611, 0xfcbe029a, 0x387f1b9c, 0x5620c1b1, 0xe1d3882f, 0x5f4d2f2f,
+    0xe127c950, 0x4d7a516b, 0x2d1e43da, 0x89eb0a82, 0xae7dd76e, 0x647c445e, 0x49d89894, 0xee9246fe, 0x4b997fb9,
+    0x95bb6a1c, 0xf306ce0f, 0x5c6abe82, 0xcdd2b61e, 0x48ad4b38, 0x52490e02, 0x8b7886b8, 0x572c9f96, 0x1a8cddd8,
+    0x3709425c, 0x9cab90ef, 0x92de3b48, 0xbad52978, 0x6bde83ac, 0x26d5d32c, 0xdcec1363, 0x64382344, 0xb47517cc,
+    0x15d66aca, 0x21e1b22a, 0x73539dc8, 0xbabfd012, 0xca719b99, 0x1aacad35, 0x7e109521, 0x755c6d2b, 0x26d66ad9,
+    0x66674a43, 0xe960d4ab, 0x85e03edf, 0xbb2667d3, 0xcd4e0758, 0x9338d42b, 0xbd8c75e6, 0x1e106a87, 0xe645f7a0,
+    0x27dd707e, 0x6ffcf34f, 0xeb2d8515, 0xafcc9443, 0x331def57, 0x4b2a2f4a, 0x47ffc698, 0x9a78a47e, 0x56077e0a,
+    0xcb7236dc, 0x8b8fc712, 0x1a093a94, 0x0b835ad2, 0x99017916, 0x79ffe0bf, 0x0555ace9, 0xbe43a170, 0x83ef2838,
+    0x8a6a8bb4, 0x30e7cefe, 0xea1a7f47, 0xd51c9d42, 0x22ae65c9, 0x923fa415, 0x00b49d77, 0xdbf8c7a3, 0x9d739dd4,
+    0x675bc7b6, 0xe3e5cc78, 0x551c9fda, 0xf2e12b50, 0x5b1afe9d, 0x80955b49, 0x2965b366, 0x023358c8, 0xa6305c7e,
+    0x97d3b2d7, 0x8a1be91f, 0x3e07cd63, 0xa84d4c62, 0x62f6965f, 0x3ef5f484, 0x24109b54, 0x5d27334f, 0x736748ea,
+    0xefc91b48, 0x8beff8f2, 0x78a63a90, 0xf50b291f, 0x996727d9, 0xd13c104e, 0x646c5e4d, 0x812e4aa3, 0xf77f31ec,
+    0xb6ae0617, 0x7560b0ea, 0x9377de52, 0xed3e6020, 0x8d2922b6, 0x13bfccc1, 0xde3aba79, 0x185a3ebe, 0xebcfdeda,
+    0x7e35bf89, 0x6cfc628d, 0x6312efb8, 0xd3aa2775, 0xc468317c, 0x9ab9f704, 0xa60d804c, 0x176bfc14, 0x2c12f661,
+    0x9a52dfbe, 0xba106d5a, 0xae2f4b55, 0xe3fdbc42, 0x5a162b6d, 0x4e3fd443, 0x621df5f2, 0xf3913dc5, 0x57586fb5,
+    0x47816954, 0xaaafefc6, 0x3c76cc2c, 0x470cde53, 0xca6d3627, 0x3942eece, 0xeef5399f, 0x8158bdb8, 0x5df5a4e3,
+    0xd23ca24e, 0x41ddb19c, 0xe8f243d7, 0x26e9f27c, 0x0a0751e0, 0xd7541b16, 0xfe2b24c0, 0x9f48f9f9, 0x57fb7d49,
+    0x4ac0c67e, 0x298ef4de, 0xdb32ea9f, 0x79edbd5b, 0xf9f90213, 0x0181b32c, 0xfdd90e58, 0xcf258ba0, 0x28b11417,
+    0x45b4e3fd, 0x56b98098, 0xb77c3002, 0x797c5781, 0x15097443, 0x0c7b0f4e, 0x192e7ae2, 0x4bc86bce, 0xca15ea19,
+    0x59f87466, 0xabe344ce, 0xee3dd193, 0x4f6cf200, 0xee09948f, 0xf2fb01dd, 0xf1542835, 0x38355a42, 0x0e1571ec,
+    0xdadf0946, 0x745b0d71, 0xd9ba99b4, 0x46ed5b62, 0x9cf45dc7, 0x98daa019, 0x6ac4a878, 0xd6d9912b, 0x7ae7f3ee,
+    0x706a7304, 0xd5ed0326, 0x5cacc404, 0xd24dcfbe, 0x6c6d134d, 0x36101f4f, 0x2e595047, 0x767bb073, 0x4a7f996e,
+    0x151339b0, 0xc1946015, 0x23c59887, 0x2754cda1, 0xe5b0d707, 0x4f1b6efa, 0x3c1d602d, 0x1e6db5a1, 0x28c7eaef,
+    0xcb054a87, 0x4664502b, 0xed3c7e5d, 0x7b2a346e, 0x26f8d38c, 0x131c280a, 0x423983dc, 0x985e98f8, 0x2b767239,
+    0x1e3b7aa0, 0x698e0dbd, 0xb94fa5fb, 0x7cc54a86, 0xa45f3688, 0x5ca1f2e6, 0x594265f9, 0xe92dba42, 0xadd146ba,
+    0x95351d89, 0x730bc14f, 0xf517652c, 0x56bdeec3, 0x24def6c9, 0x415f39ce, 0xe08f9be8, 0x345aeba3, 0x03453048,
+    0xfc4076a7, 0x90c4d082, 0x84671077, 0x2f057077, 0xf6309926, 0x79ae07ac, 0xbab588b3, 0x67aa2b55, 0x60935d1c,
+    0xc48679ab, 0x453d4332, 0x573ae9c8, 0xf6cdd009, 0x4e1768e5, 0xbefd35f9, 0x1458f7eb, 0x7f95b52a, 0xb6bd2542,
+    0xffbbf9b2, 0x5b4489e1, 0x80c10682, 0xf19b83af, 0x1577a6a6, 0x62b6350f, 0x0888a327, 0x746f466d, 0x48c3f9b2,
+    0x713a6236, 0x9cf0ede5, 0xfe042b5a, 0x36ac8100, 0x5b10d27b, 0xda7e5fc8, 0x50716177, 0x4d786a45, 0xda04fad7,
+    0x60e1bb67, 0x1bcc7b4d, 0xa88a250e, 0x4bc59d26, 0x10465953, 0xf2de75e0, 0x09bab12b, 0xe46ba4bf, 0x7d1c1251,
+    0x8837a644, 0x4ebbca2b, 0x4150644c, 0x056e99d5, 0x574581ec, 0x8378204b, 0x707f73e5, 0x90bbb683, 0x1ea7098a,
+    0xa547d394, 0x2008fb15, 0x07171b22, 0xc3a869b0, 0x3ce7b8fc, 0x85b29d54, 0xd4b3251e, 0xce5cfbbc, 0x21159202,
+    0x8778f4a2, 0xb9e3e344, 0xaf580f48, 0x07e4cc12, 0x0bebdc89, 0x51617e0f, 0x7ea5b421, 0xfd682046, 0x32d8195b,
+    0x15c77785, 0x0d2f38ab, 0x2839041f, 0xa36e668e, 0xde3288f8, 0x19a91bf7, 0xba0d0bfc, 0x07956c57, 0xfcdf688a,
+    0xc2e2cf42, 0x276fb749, 0x5557c7ee, 0xc334cef6, 0x233681fd, 0xa25f1070, 0x72c79b24, 0x4dc2dbe7, 0x4ee14cf8,
+    0x36d47e84, 0xdb08d0e7, 0xd906d115, 0xbabfeb17, 0xa8c9a818, 0xf46ba61e, 0x58e75035, 0x6d6c3db0, 0x566da59b,
+    0xa70bccac, 0x469c1ab6, 0x7cedbfbb, 0x81d32f9d, 0x25a0326d, 0x8c9ad74a, 0x6edf1b43, 0x591280f7, 0xaca49000,
+    0x77e267c7, 0xbe13046b, 0xd71bce5d, 0x112efb1b, 0x27108546, 0x206f6721, 0xc3bd7f7d, 0xff0acfad, 0xd1f924d0,
+    0x522c8f42, 0xfb1a86c5, 0xac283258, 0x0f599d81, 0xd957ef8b, 0x905b3555, 0x00f0e26b, 0xad305589, 0x4c6e0158,
+    0x0a577f82, 0xd15ce729, 0x9f88158d, 0xfae91864, 0x560dcd7e, 0xe1b6ab18, 0x920f089a, 0x85ae1058, 0x152c74bd,
+    0x02d2cbf6, 0xc7f81866, 0xd2b23edb, 0x612b8b2a, 0x1f8da01f, 0x88499357, 0x709e6bbd, 0xcac36b84, 0xe636d2ec,
+    0x65e32ec7, 0x731e4286, 0x2d6474a3, 0x840dc51c, 0x7af67d39, 0xefff8ec7, 0xff72d1ff, 0xaa7130aa, 0x6c479116,
+    0x9bb6ae01, 0x93d5a376, 0xc11eabed, 0xcd3d93f6, 0xaa7b22e6, 0xabb360c6, 0x6d77ba06, 0xf7815990, 0xb2a75bd6,
+    0x477c5291, 0x72d2d187, 0x835bb6c7, 0xeb2ffa69, 0x94942217, 0x6b4f8b87, 0x9be4b37c, 0x5b1bbdf5, 0x83612149,
+    0x09cf83e6, 0x8d4f5bf7, 0x3a561148, 0x32ee851d, 0x9b6b9a56, 0xc8f57b81, 0x9ab3c56c, 0x811d0cfa, 0x103ecfff,
+    0x517c810c, 0x6159725f, 0x2366f7b6, 0xbb13df03, 0x1823c5bf, 0x90923ad9, 0x46d75f4e, 0x5f669dda, 0x74122b5b,
+    0x194321a7, 0x7fc19d40, 0x305ea7a0, 0xc28451ad, 0x8fbee929, 0x90e65744, 0x6bb713a2, 0xcfc15232, 0x16f0edc5,
+    0x51c8c353, 0x12d3c12c, 0x73b39680, 0xb007abd3, 0x191727fc, 0xb5267c74, 0xd3c57bab, 0x5d9bc440, 0x366be7cc,
+    0x372b520c, 0x676b1569, 0x90c35643, 0xe7741fa0, 0x28f1aa22, 0x1f7f8491, 0x398d5e6e, 0x6e3713f5, 0x3ba69a24,
+    0x65a2f878, 0xa5cd6498, 0x9a551dee, 0x50125a15, 0x864bdec2, 0xb9093618, 0x1b5ff202, 0xe1db4a4a, 0x62dc9e77,
+    0x0a5e70c6, 0xc9551170, 0xe66dc94c, 0x7a6bb30c, 0x37400bbb, 0x0d948dd4, 0xcf723443, 0x6716b61d, 0x98cdadf9,
+    0x389f587f, 0x19ab0801, 0x0c30ff9e, 0x83dab158, 0x82f357e1, 0xbfb49314, 0xcbb13899, 0x0807bc20, 0x1bd6166d,
+    0xf8a0d162, 0x4f807d26, 0x81cd1ff8, 0xe39cc9dc, 0xa382f6e7, 0x02c1599d, 0xe1290982, 0x71172491, 0x6d1672ad,
+    0xf474935b, 0x5259d927, 0x0ad6444e, 0x657bde53, 0x8877a7ec, 0x1e3ba895, 0xef5f5c3c, 0xcbdc83a0, 0x752f259c,
+    0xe8be06e3, 0x5fb6ebeb, 0xf2c47292, 0x4f1ec815, 0xd9b12361, 0xa3a6fbb5, 0xa3ad9efd, 0xc65fe7ef, 0x6ca20b11,
+    0xaeb89170, 0x15a5a449, 0xb216eaec, 0xbac14c44, 0x788e7cb4, 0xbe1205e9, 0xb41e02f9, 0x550d3208, 0x7357a0f3,
+    0x0b3bd201, 0x0767fd32, 0x31139e31, 0x5fe7f17e, 0xef42cd21, 0x3c5368ea, 0x6fdca428, 0x4eda0ffd, 0x2d36f5db,
+    0xa36b0529, 0x0011f7d1, 0xfcd64dce, 0x0e3bb453, 0xee181fb1, 0xf1bfe4e5, 0x65f93cd7, 0x8aa931ee, 0x08164212,
+    0x5000d710, 0xdc841307, 0xddce9b7d, 0x4f2812c9, 0x3cdfd9d8, 0x44aa11fd, 0xf29b6870, 0xd0e85315, 0x73c0733e,
+    0xc893a2c2, 0xf0330a16, 0x974af045, 0x91b7fc87, 0x002a05a4, 0x709dadce, 0x4a29da2f, 0x92d959ce, 0xf72ef1a4,
+    0x549a5668, 0x331d2310, 0xe180cb81, 0x3a1c912b, 0x13fb40d0, 0x01b8f392, 0xef236eb8, 0x9b973128, 0x8de6c122,
+    0x8ae5a02f, 0xce1afb92, 0x00852280, 0x9b545943, 0x1460447e, 0x1c7611e2, 0xcb1894b7, 0x019260da, 0x1ad2a197,
+    0x9280c62e, 0x0e742f18, 0xef7ded66, 0x43fe131b, 0x1e98ee44, 0xc8f28dfc, 0x1136d276, 0x463122b5, 0x2b109aae,
+    0x7ac9e817, 0xb3e716f9, 0xc2cf74b3, 0xdb845f0f, 0x8336ee02, 0x024ba526, 0x81cc78b0, 0x43b15e94, 0xd14cf28a,
+    0x63ca453c, 0x82b8afd9, 0x42b89753, 0x67589bd7, 0xee7b49a5, 0x174aecb1, 0x989ada55, 0xe881951d, 0xa143ddd7,
+    0xf4450bbf, 0x982735ea, 0x4d00a7cc, 0x4c46d2db, 0x37442cea, 0xd1e145d8, 0x80212b14, 0x25f197e3, 0x337b9eb3,
+    0xf728d5a6, 0xf0cdb9a0, 0x690934f6, 0x24236947, 0x7c6527ef, 0xcee697b7, 0x2c9bd26e, 0x830c799e, 0x66e7883a,
+    0xa22125aa, 0xcf9d3019, 0x29e4cc9a, 0xf2e7064d, 0x431eb213, 0xf8aa1fd5, 0xbf2b8d21, 0xe70c14ca, 0x3a132138,
+    0x36ad856b, 0xe3a6cfd1, 0xe2265875, 0xfbb6ff1d, 0xd42c43ef, 0xa91f703e, 0xede3cc3c, 0xe398b306, 0xc7ae5ed2,
+    0x2d49f027, 0xad939387, 0xc321236d, 0x781d664c, 0x9a72151e, 0xcb54b09a, 0x50ccb05c, 0x591d2e2a, 0xd27e8ce8,
+    0x38bad818, 0x04be6be0, 0xc780d550, 0x6de6ab47, 0x000ad46d, 0xc9b7a827, 0x133e1f33, 0x0a002980, 0x74a99614,
+    0x43e23662, 0x36814b68, 0xa34db32d, 0xeb4a87bf, 0x0600a607, 0x4351949d, 0x8fcf6b7a, 0x8f360052, 0x24baeece,
+    0x1a6b67ff, 0xa835e579, 0xdc790078, 0xc63cbed7, 0xc76b5124, 0x68762ab9, 0x3219b509, 0xd2ec141f, 0x92e7ba8f,
+    0x9ad5eb30, 0x6210fe8f, 0xa72797b5, 0x18d14a77, 0x053422af, 0xb8dc3c38, 0xaf58fab9, 0x14cccb94, 0xe1081b01,
+    0xac24ffc7, 0x2558172e, 0xe86f0cde, 0x58ca7deb, 0x7d76e5be, 0x068d9149, 0x08a05426, 0x204b5177, 0x5ce19256,
+    0x5dfa8a04, 0x0f3c3569, 0xbb20d212, 0x9c217975, 0x3a7acbf7, 0x46c044f5, 0xc3777353, 0x9150c3e3, 0x7e4d728f,
+    0xa63f2f43, 0x3d802e2b, 0xcbca1be2, 0x38eae501, 0xdb67e939, 0xeec9d420, 0x9357a953, 0xe3f97c7d, 0xd157da3d,
+    0x23509ea0, 0xe2163b38, 0xb23da80a, 0xff01c1df, 0x5cbc9361, 0x95927bc3, 0x80fcfc65, 0xdc23b0dc, 0xb43c5eea,
+    0x3c3c0107, 0x7de8c4ae, 0xeef0db5a, 0x28b31ea0, 0xe4e2c3a5, 0xf8a826e8, 0x0cad6931, 0xcb4dbc7f, 0x8a3a8bb0,
+    0xe5521314, 0x80dedf91, 0x6cd3976e, 0x8ab2eca1, 0x46b66775, 0x9744a8a7, 0x84c8da43, 0xf6b34751, 0x05aa3110,
+    0x9b0b659a, 0x5236aa04, 0x6045840e, 0x4c3779f0, 0xc2b587c9, 0x105dad3a, 0xa3d88466, 0xed6e534b, 0xbb1be9a6,
+    0x75dbf146, 0x8f3bf2f6, 0xb9288d48, 0x1a96d323, 0xd50d0560, 0x304f113c, 0xe263bc92, 0x2c63525c, 0x6ee2f24a,
+    0x5d0a1d92, 0x9aad0543, 0x79b35529, 0x6548310a, 0xb2ed9d30, 0x6bd42f7b, 0x491710ba, 0xe9b7ee87, 0x6ee0a60c,
+    0xbcac7a8c, 0xe127d759, 0x1942697f, 0x34b31df1, 0x7c2128b0, 0xe938146f, 0xc42bc7ab, 0xc470ac17, 0x3b15ffce,
+    0xcae773b6, 0xf7d1829f, 0xa26fb8ee, 0x930aa011, 0xf28d89b4, 0x3f4660e9, 0x375bede0, 0x4353653b, 0x722e1caf,
+    0x2534d020, 0xf872a858, 0x94dc8eef, 0xf0a20382, 0x91e4e310, 0xd3bb1110, 0x9f6187ab, 0x28f451f0, 0x65e369e6,
+    0xeba81b2f, 0x599e99d4, 0xb3fcd41a, 0xb09c04a8, 0x79ff2730, 0x52c3bb6f, 0x927d43d1, 0x0e3b99ae, 0xb9269463,
+    0x8b9f4fa3, 0x2a2dfd3d, 0x541177b4, 0x52f0f6e6, 0x658fec51, 0x18eca21b, 0x4e3e953d, 0x2e6b8b20, 0xb6ac2824,
+    0xbddaa70f, 0x101a4390, 0x52a3b285, 0xbdad0bf7, 0x46721a09, 0x6b72b591, 0xa34f7e1b, 0xaaf66824, 0x63063ccd,
+    0xd2a40d4a, 0x8fa5a7d4, 0x0d95aa01, 0x6ed6f7ae, 0x19d0e8c6, 0x627437cf, 0xa49923ff, 0x168b3f0e, 0xf6489c24,
+    0x4b984ba5, 0x0c309ea6, 0x90c9b732, 0x55d83962, 0xc7c770fb, 0xd84ac898, 0x876366bd, 0xc04fef87, 0xafe6fb6d,
+    0xfaff3977, 0x5a1cabd2, 0x69f58c72, 0xb34310a8, 0x7849d185, 0x3ca56539, 0xccac3c10, 0x55bbe3da, 0x2a0da53e,
+    0xb742f123, 0x4df93ece, 0x4d0b897a, 0x06562a93, 0x9b172c01, 0x79287305, 0x2a00daaf, 0x2de4500c, 0x3ac468e1,
+    0x1c6cdea1, 0x15d07f63, 0xd4a77cd0, 0x2735a60e, 0x92a5072f, 0xab40ffeb, 0x5a80f5a3, 0xa7f7911f, 0xa78878f2,
+    0xcf20bb82, 0x2cda6089, 0xf5cad7b1, 0xec8d80bf, 0x8b222db4, 0x1df1e680, 0x46ec9b89, 0x3fbd0da1, 0x9c54762b,
+    0xc45efd00, 0xdca84ecc, 0xb7479500, 0x717e2171, 0xdacc7171, 0x4a13e0b0, 0xf5331fff, 0x09797be4, 0xc8929f9d,
+    0x5ec54b5b, 0xeecc89b4, 0xb4b67da3, 0xf4482cad, 0x47c4fdf7, 0x094ed7c0, 0xabf48235, 0x6d4bbba5, 0x09b5d30f,
+    0xb24f88e1, 0x04400d7d, 0x14ac00ee, 0x74ca1943, 0xe2b542c3, 0x08f765c1, 0x55a58599, 0xa0a7f2d7, 0x6c711990,
+    0x2fbf2cff, 0xc4a57d6d, 0x76c55c63, 0x529b0dfa, 0x8841f7a2, 0x51b74ab2, 0xece06ed8, 0xb463f904, 0x7516fe2f,
+    0x3d40520d, 0x32d4a45c, 0x8baf5a84, 0xbc9818d4, 0xbc4cc524, 0x42205a25, 0x29b5f542, 0x3ad97555, 0x8aad4d89,
+    0x0ed0978c, 0x4e6a7f3d, 0x87be8e69, 0x707905a9, 0x4f7e3cc0, 0x39cc166c, 0x00e4e16d, 0x0d9b42ff, 0x996e8208,
+    0x7e7b86e1, 0xdc7338e9, 0x38b56350, 0x0d3cf65a, 0x05010a79, 0xa0c25ecd, 0xb29c14af, 0x8bf0a1ab, 0xbb1db938,
+    0xc3909da6, 0x004be540, 0x46be49bc, 0xbc1d3827, 0x43c0e169, 0xd6bc66f5, 0x40963aa1, 0xbe12cdbf, 0xcdce3096,
+    0x1e049f38, 0x8ef6e902, 0xe35e28d0, 0x37e1cc42, 0xfac563ca, 0xcad58b07, 0xaecc6a13, 0x4cb3dc45, 0x2377421a,
+    0x5c8e608c, 0x1c73cdb9, 0xd120597c, 0x5fdaed38, 0x40e7040d, 0x2625a531, 0x937651d9, 0x1b01c64a, 0x80519d4e,
+    0x85bd234a, 0x3d81b739, 0x9a623090, 0xb03a6aea, 0xa5aca061, 0x6b119203, 0x7a4a2ac5, 0xf15ccf88, 0x18ec9432,
+    0xb40f97e2, 0x948eecca, 0xf7e3cfc6, 0x3144fae1, 0xe52069c9, 0x18324809, 0xc655fcb7, 0xbe9afde7, 0x8302787d,
+    0x47e9a414, 0x34e0380a, 0x2f0bc601, 0x44b2c5f3, 0x846e25d1, 0xf31830bd, 0x35a50521, 0x8fec446d, 0x5f4e2b38,
+    0xdc218b86, 0xdb884a7c, 0xbc18ad62, 0x6f1f004a, 0x9239d020, 0xbb89cfbf, 0xadca116f, 0x0f7195fb, 0x73546f6b,
+    0xbf827c61, 0x63c0027c, 0x3a81e0d1, 0xe1ecb3ca, 0x9bf934ce, 0x4709c923, 0xf63b8101, 0x34cad0f3, 0x9d683bef,
+    0xd93c84e1, 0xfd83dad5, 0x5d04928c, 0xce21ffd8, 0xb885ddf9, 0x2f222f3d, 0x4e013741, 0x7652dd2d, 0xe34cf4f6,
+    0x33739eac, 0x841ed796, 0xe1d64e4d, 0x538409a1, 0x9ed73cce, 0xc81c9c94, 0xe72ca12b, 0xb79492fe, 0xc7fe081b,
+    0xfad9bd66, 0x74e4bfa6, 0x543636e6, 0xfa23e9c4, 0xfe9c2928, 0x3d44a109, 0x14c3828c, 0x6aaa86a7, 0x237f52a1,
+    0x5b7c67cf, 0x17739bc1, 0x6f7052aa, 0x5948c6e1, 0x409928bb, 0x8574bf4b, 0x28f769fc, 0x422a5604, 0x93b94149,
+    0x539c0699, 0x76e3eb38, 0x09d8b018, 0x15d0759d, 0x0e15b86d, 0xd7a40a5e, 0x3d6f9a8e, 0xae906b14, 0xf3a5ea50,
+    0xbad5e0d4, 0xf2748796, 0x76fb2e1e, 0x51a8d036, 0x258ac956, 0x0e069738, 0xf4ecc0a4, 0x1c952908, 0x089b8a7d,
+    0xb8e63d58, 0xe9d30016, 0x5e53b1c0, 0x66f2fa55, 0x8377607c, 0x24ac1e10, 0xf3f1e3c2, 0x79f6a39f, 0x06b0aebf,
+    0xd0b12011, 0x9144b362, 0xb70228b9, 0xb5f44ee7, 0xcddb2ac9, 0x81438a1e, 0xc86558f1, 0x977d6626, 0x6523ea99,
+    0x5c5a6c69, 0x7df3edfe, 0x83f4d51d, 0x32ee0e1d, 0xc1c6942b, 0x87005b65, 0xce12eeb1, 0x93bfe68a, 0xb0c41665,
+    0x96ad2c90, 0x69fe53c7, 0xb8c74bb4, 0xf542bde8, 0xe095c113, 0xde10bc43, 0x5d1f42cb, 0xb86b93d9, 0x1dc1b8d6,
+    0xa782fd48, 0x76ae4585, 0x311782c1, 0xdb3a216e, 0xad14942c, 0x47b3f375, 0xc4f6a875, 0x63b76ebb, 0xb4fdea81,
+    0xa8bc5636, 0x99c4d80d, 0xf92a9dda, 0x3223004d, 0x2f8221f9, 0x322a3303, 0x5b6b946d, 0xfbd36f2b, 0xc5ed42d7,
+    0x5296b779, 0x6ca3da8d, 0x5661081f, 0x23573734, 0xba187ec5, 0x6777766b, 0xa2d7c3a5, 0xfbb1cef7, 0x4d00f3f4,
+    0x85a7b7bf, 0x728a15f1, 0x70d44371, 0x9c8a6452, 0x0c19abf7, 0xd43337be, 0xfe92f72f, 0x3e1cdc53, 0x6f224de3,
+    0xbf902140, 0x5f2c1d07, 0x66e657e3, 0x0b766760, 0xe584fd20, 0x7c2be7bb, 0xbdf12496, 0xaaa6d4c8, 0x9bab58ff,
+    0x9d740956, 0xa4ed0689, 0x5153b479, 0x6183a805, 0x7da93c00, 0xd844dae0, 0xa86ec278, 0xb1960caf, 0x8110f633,
+    0xe159220c, 0xc6225e09, 0xd16fcf28, 0x7f2cd3e3, 0x3f781195, 0x44b3b408, 0x8c37d4be, 0x30235451, 0xd4fd4abc,
+    0x639da700, 0x643b9cf3, 0xd24b34a5, 0x56c12d77, 0xa95c8987, 0xe48366c8, 0x2af3383c, 0x2e8b9589, 0x6d6880e8,
+    0x50f0b102, 0xe5fc4dca, 0xa3f48dec, 0x7b05e4d6, 0x7974381c, 0xa76753a7, 0x30f841fb, 0x62a621cf, 0x5e1881c8,
+    0x1a29e9fc, 0xf2afdc19, 0xfc233809, 0x985d6b3d, 0x49c38271, 0xfa7cc2ce, 0x837fb1c5, 0x57ae017c, 0x702c86db,
+    0x4d76ce9c, 0x19c28bab, 0xa58db9ea, 0x66949fcb, 0x5463e11a, 0x8d4e3c9a, 0x1b1fcb67, 0xff174799, 0x7541a641,
+    0x7c1da398, 0x552d77c5, 0x813db583, 0xf0070830, 0x695e9452, 0x0333d1f8, 0x998d32e1, 0x4d541eac, 0xe554a185,
+    0x5247efff, 0xccace693, 0x1cf42b2d, 0x039bfaba, 0xd5147710, 0x2cee93a4, 0x0516a148, 0x62102355, 0x11ccde30,
+    0xfa758348, 0x3f2c5b36, 0x2c8bad98, 0xda91fc8d, 0xaa254d4f, 0xf7c30417, 0xf795f8cd, 0x332e02f3, 0xc52b48e8,
+    0x0b860642, 0x9c148d3c, 0x316cf260, 0x7ba08737, 0xf9e3e96f, 0x0c05d2de, 0x0b32fafe, 0x0071d3ea, 0x896e8fc8,
+    0x85542fdb, 0xc33ccb96, 0xebacf429, 0x48a2c087, 0x3f812454, 0x2ce6e033, 0xbd774d23, 0xb9583745, 0x5fc47166,
+    0x71f8cd52, 0xe52c666d, 0x38b294e5, 0x79011dd0, 0xa6270b30, 0xf14a30d9, 0xbb7c1b2f, 0x3fc63624, 0xef82edb5,
+    0xa9724435, 0x61f249e8, 0xb032360a, 0x849139fd, 0x27d27c09, 0x86085206, 0x8b69c39d, 0xeb42fb44, 0x44c3876e,
+    0x61eb9e56, 0x18a309db, 0xf58723f4, 0x5cbb8594, 0x91e8ae19, 0x60a74959, 0x32e49be9, 0xef785e5e, 0x9e212fbd,
+    0x6f7d68cd, 0x2efd9603, 0x0405f351, 0x421ac291, 0x18b31a3f, 0x6b074ea6, 0x59f32ed7, 0x94f291cb, 0x4f9edb00,
+    0xb1370125, 0x7d50c990, 0xa358a478, 0xfa0ea4da, 0xa5fde599, 0xdf586fb9, 0x2b358a64, 0x29f38be8, 0x777d8eac,
+    0x156a0865, 0x5ba09b22, 0x2f293f9d, 0x1531a7f1, 0x84e88cfa, 0x6273e1e2, 0xe2a0f426, 0x50dc0178, 0xba056f25,
+    0x67424bbc, 0xf329b566, 0xa67977a2, 0x0d0557a6, 0x7a71bde8, 0x025c2064, 0x7b62ee2e, 0x8a562c7d, 0x4ef467b2,
+    0x50053d3c, 0x01792092, 0x31fc1c1d, 0xeccfce91, 0x6ffc633b, 0x7db6251b, 0xec6f004d, 0xe111be29, 0xdac3ecc9,
+    0xd8ae5fd0, 0x152de3ea, 0xb3a0b2a3, 0xb7b7ea0a, 0xa4df035d, 0x55e63223, 0xedc45f68, 0x9d64b089, 0x3727a072,
+    0x587c4e85, 0x97984dbb, 0x066b36d5, 0x8a74a9b6, 0xa2b2e841, 0xe8fa457e, 0xb1698f86, 0x986cd6d1, 0xf91981a4,
+    0x29699e99, 0x83b007aa, 0xf6b28d1d, 0xf4744ce4, 0x6c151999, 0x2ad4336e, 0xc07285cd, 0x561e6853, 0x15504870,
+    0xf39afd8e, 0x05c7bba1, 0x02d74165, 0x59b90fc8, 0xda5ecd44, 0x67d98811, 0x2656ec18, 0x3d63a194, 0x7a423fa0,
+    0x313d3087, 0x78840ba1, 0x8ec97884, 0x8f5f2bbd, 0x8c3573a9, 0x71798a1b, 0x83e3d122, 0x38559085, 0x1b8a0441,
+    0xc8a0706d, 0xf4748a6e, 0xfd78e17c, 0xf9d9265a, 0x06d0e43d, 0x978d63a1, 0xce188391, 0xf8993ab5, 0x633dfc67,
+    0xaac6979a, 0x0817e53d, 0x3e5cbbf4, 0x69fcec6e, 0x2dfc3325, 0x74d43679, 0x076c20bc, 0xe9cd6b8e, 0x3331ccb3,
+    0xb77a631a, 0x6ceab91f, 0x17fab409, 0xf3e02b61, 0x2a0272ae, 0xf96afe44, 0x5879b631, 0x2c460ef6, 0xfb523099,
+    0x2de388d9, 0xca1954a0, 0xc97ecd89, 0xb60be543, 0x29844121, 0x14ce8365, 0xc3607ce1, 0x38ca6fa8, 0x85154614,
+    0x3d1c9463, 0x6ae66996, 0x0cccf2f9, 0xf84005f0, 0xfbccee1d, 0xee139942, 0x176405e9, 0x0e44a581, 0x4cefb68e,
+    0x57bfcb06, 0xca56bd5f, 0x4930c148, 0xc9951417, 0x85847cf7, 0x1da64025, 0x6519536c, 0x77731df8, 0x8e2227db,
+    0xa73f189e, 0xd29f2d94, 0xdf4e4ac4, 0x22213657, 0x966a7963, 0x489b0469, 0x240456d9, 0x6f9d0e27, 0xd9fbe2a8,
+    0xc0b16e88, 0x752c37b9, 0x4c780691, 0xfbcf7437, 0x21ecc6fc, 0xcfc5ab19, 0xfe8a7f6e, 0x08e474fb, 0x0b20d410,
+    0xa5096569, 0x845ac54d, 0x9c34bf30, 0x05ec6765, 0xa5d8baa5, 0x75e0e336, 0xbc15a181, 0xc10b97ff, 0xf84fe565,
+    0xd19d0099, 0x3542fd2d, 0xe866341f, 0xc8279b01, 0x5ec29b50, 0x1354b9f5, 0x5ca13729, 0x7a117bcb, 0x67e4cd20,
+    0x4e00fff1, 0x5da7b6c7, 0x7571ad74, 0x24a4a511, 0x669addb7, 0xb00a20ff, 0x2f0b1e92, 0x2d0c607d, 0x6868c682,
+    0x8af553da, 0x9aa7ff14, 0x21436836, 0xbd8ae3d6, 0xe843edbd, 0x3ed1d89b, 0x3ea3c67d, 0x9a9729ea, 0x6c53fe29,
+    0x767863ca, 0x957212f7, 0x15c7474b, 0xa105ab37, 0xce510209, 0x56f3c0a0, 0x8e0465e1, 0xc080fdbb, 0x203d1aa2,
+    0xfdfa4b89, 0x24e19807, 0x3ed4788b, 0x0ec54e24, 0xdf70a58e, 0x87cf1d90, 0x83196320, 0x538ae0ef, 0x640b4bd4,
+    0x18768891, 0x415e03ea, 0x1f7a8ead, 0x9e535320, 0x593a1a4e, 0x2d6732d7, 0xaa00ad81, 0xd91888c8, 0x3efdccff,
+    0xc2d6e88a, 0x277791b0, 0x23fadc68, 0x44a96116, 0xc763733b, 0x4a71079f, 0x4cb3e452, 0xea61c346, 0x93c1453b,
+    0xec01d232, 0xf306974c, 0xd5ad082d, 0x8b37d5d9, 0x9e98b7c9, 0x914125a3, 0x05c2426a, 0xee22fe1b, 0x0aac2084,
+    0xa940946f, 0x839931ac, 0x52779e7c, 0xde79738e, 0x6a604597, 0x2fb5e594, 0x160c1ed4, 0x0879267a, 0x3afc7134,
+    0x4551bc61, 0xdb026be1, 0x408780a3, 0x523ac015, 0xb625fda7, 0x8e8c6e14, 0x3b33b460, 0x13ccff77, 0xbd9ba557,
+    0xae1f77cf, 0x1747ae29, 0x3a1ef3a9, 0xe60b6f18, 0x99628dc3, 0x9b837b26, 0xf956c594, 0x167d752b, 0xf782d749,
+    0xcd8a484a, 0xb58cc236, 0x5f96be4e, 0x118ab37e, 0x905cefe4, 0xcd897c13, 0xfb75db1d, 0xb8216960, 0x9c27087f,
+    0x8df8cf99, 0x09b32d64, 0x35f7835f, 0xf3044a5b, 0x3ecbb473, 0x2a7a86ca, 0xeea4e2e4, 0x9a8fc14f, 0xf8cc06f4,
+    0xcaf202e6, 0x7468e0b2, 0x76e9092b, 0x85cecfd2, 0xaaf1bd29, 0x472bb2fd, 0x78587a82, 0x20a1e1d3, 0xc9959df8,
+    0x3ef5ea27, 0xc9ad7b9f, 0xecaff54d, 0xae35e0e3, 0xff6b6317, 0x5413de0a, 0x322ed005, 0xf2bf7fde, 0x5f9b664c,
+    0x29199564, 0xe24f7150, 0xf764c451, 0x5059f3ec, 0x559a199f, 0x063114d7, 0xa7fe8054, 0xd27377dc, 0xc3d1d28c,
+    0x00cb8f0e, 0x0975f072, 0x3af6b6f7, 0x9267d2b2, 0xfc4d196b, 0x24dba44c, 0x15fb6b5d, 0xf3e209fa, 0xf9bd7191,
+    0x6ab2ef9d, 0x1c5210e4, 0x2d255c90, 0x958e9ef0, 0xe3ea3e1b, 0x3aa4098b, 0x7163d812, 0x15a6bc7f, 0x66873291,
+    0x7ce465ea, 0x6815a1b5, 0x250558e2, 0x8dba31f2, 0x313ea673, 0x86b3b89e, 0xb1dc077a, 0x3f9d3b90, 0x6c5ead63,
+    0xedc6d2b9, 0x3d37c0b4, 0x26e85a84, 0x555c2608, 0xd7cf7a3a, 0xf85f4b3c, 0xeb5ae67d, 0x468c314f, 0xe2e172a8,
+    0x97cd5532, 0xb9bf50f2, 0x84bb2eea, 0xb0498901, 0x7ecc8536, 0x55409ab3, 0x01f649b4, 0x6bd9d60f, 0x096b0f9e,
+    0xaa1721bd, 0xfdb2cd5e, 0x5d1f11f6, 0x638360ed, 0x7dbaf8df, 0x48badff0, 0x5a75c20c, 0x98ffee21, 0xda53338c,
+    0x9af072cf, 0xc002e147, 0x88d6c0e7, 0xf2f83d3c, 0x09246b2d, 0xbbed1cb0, 0xb4d06a2b, 0xc30ac657, 0x5737d212,
+    0x481f9710, 0xcf7bc4b5, 0xa7869790, 0x341d6676, 0xfdd4d107, 0x7923aa10, 0x53b10fda, 0x2f9b7346, 0x16eb3f87,
+    0x03b03e95, 0xf71cb3ef, 0x0f6f596f, 0xd81902e3, 0x4ac5e7aa, 0x631cb8bc, 0xe4e7d273, 0x334d139f, 0x470df346,
+    0xe7fab909, 0xba80f1bc, 0x000a6f6c, 0x20673ebd, 0x5ed7f936, 0xa148e5ad, 0xa40014fd, 0x87d34e7a, 0x486a83f1,
+    0xa14c5d90, 0x17e4a435, 0x867129b4, 0xc9899cb9, 0x879a8842, 0x7d940dd1, 0x168067ad, 0xfa4fb5ca, 0xaf6930af,
+    0x2c0cc316, 0xd744654d, 0x56eccacf, 0xfc4bdf38, 0x7eb41068, 0x42feb3b5, 0x373ee024, 0x1080b4bd, 0x4e9404cd,
+    0x36ab4e25, 0xb5607482, 0x3359935e, 0xa7faec93, 0x382189ff, 0xeded12d8, 0x049f7741, 0x63cd45c1, 0x2550f6f8,
+    0xb79bb6e3, 0x48607869, 0x4cca0496, 0xc29eccac, 0x3f831965, 0x487276f0, 0x52d25b28, 0x6d96b04c, 0x4b1e7815,
+    0xf4b90a3f, 0x07f91c99, 0x6255be3b, 0xb1f4edc2, 0x715b4246, 0x244f2ea9, 0x932a5663, 0x96080ef8, 0xb0e1091b,
+    0xda7b0860, 0x286e8575, 0x790aecda, 0x5c5a1fc7, 0x3f8f808a, 0x7002f086, 0x9a7ac259, 0xd2b890da, 0x36432e74,
+    0x151a94d4, 0x7fd66d09, 0x1f3e14ee, 0x04e17ca3, 0x635576d3, 0xef0769f9, 0xb136c7a3, 0xcb03bedd, 0xd9203a22,
+    0x9b35790e, 0x6001d810, 0xa6a9c912, 0x3bc27664, 0x265fa55b, 0xb55cda59, 0x1b0604bd, 0x86f6931b, 0x7c61f4be,
+    0x6722fc24, 0xf7cc83b1, 0x565ec657, 0x4cb70561, 0xb2dd3a5f, 0x95d0efe0, 0x522c10e8, 0x70fd157d, 0x6ae6b161,
+    0xf8a1d010, 0xaa90df79, 0x11c301ec, 0x188c456d, 0xc44c5161, 0x977fce9c, 0xc8f8d72b, 0xd1a19f6b, 0xd91fa6ff,
+    0x875096b1, 0xbfbf21f3, 0xe8040b3f, 0xf4dd0244, 0x6f8a5cb4, 0xff69cbc1, 0x2b9b70ed, 0x691e9e0c, 0x199b718a,
+    0x4d85ed85, 0xd05bf207, 0xaa848c02, 0x2afc59ad, 0xc37b2b1a, 0x57c80cc2, 0xa459251c, 0x0a42ccc1, 0x5fc8289f,
+    0xff5c41da, 0x7739de7d, 0xb4e1c3bb, 0xf4ae951e, 0x72161351, 0x74dbaff3, 0xe5aeafc4, 0x9ca5303c, 0x573dc8a9,
+    0xd9222e37, 0x39908da4, 0xa562e6e5, 0x9f52689b, 0xce9fbd1c, 0x9d23a5e8, 0xc3287191, 0x4103ca4c, 0x14fb8890,
+    0xc66f8f3b, 0x20b21a1c, 0x2a954ad9, 0xc67c5d5f, 0x0a02c223, 0xe28c3b9a, 0xa3c7756f, 0xa131d510, 0x7818b011,
+    0x1295cb8e, 0x19b7e978, 0xa0d7c210, 0x366f0635, 0x4a7077f2, 0x5a79a060, 0x58842cb6, 0x03372c8f, 0x73187117,
+    0x62e812b1, 0x67fe7363, 0x8fc91d78, 0x2cd8986b, 0xdb1858f4, 0x8d3e5070, 0x73d345bc, 0x3d1e0fae, 0x9e2428a3,
+    0xb974f1e5, 0x00654ca2, 0xdb009615, 0x00b5d001, 0xa90de392, 0x684ddb61, 0x9feaf8c2, 0xb9dacf1a, 0x1a9c7daa,
+    0xb6cd39ff, 0x8008c8d2, 0x05d9f668, 0x7e258cd4, 0x13cf6678, 0xee1046f4, 0x5b1b3e0d, 0x20c25a51, 0x7a19ad5e,
+    0xa0ab58f7, 0x93147c6b, 0xeef3c23c, 0x0544332d, 0x30121071, 0xefe906ea, 0x318b29e0, 0xce40659d, 0x3a1f1b43,
+    0xf2dd4437, 0x1dfcfa7e, 0x6455fba1, 0x95544172, 0xdd1653d9, 0xf88a3096, 0x0541d1d4, 0x0b4a8fbe, 0x7980768c,
+    0x85c00398, 0x755c7420, 0x17dccc20, 0x94e649bb, 0x3e0ea56c, 0x6de86621, 0x3c106ac0, 0xa71f1edc, 0x4263e709,
+    0x2d5347b3, 0x8a8d48e5, 0x228aebbe, 0xde394b6d, 0x4e53e34a, 0xb303a6ea, 0x875dad49, 0x8408d3fe, 0x71f287c0,
+    0x1a9661d0, 0x62deeedc, 0xc1361fb4, 0x726c29cf, 0xf8638ad4, 0xfa3b4a0b, 0x45bbf0ea, 0xb6cf6975, 0xe2edb287,
+    0xd8e659ee, 0xb197a525, 0xa3b722bc, 0xc65e1c1e, 0x5cb5a86c, 0x71ceb5b0, 0xdaac9e76, 0x31b68968, 0x10e6a76a,
+    0xd600827c, 0xc1dc2836, 0xd72e9d71, 0x7eea1b98, 0x7d6bb43a, 0xaba2a476, 0x9b0e8590, 0x84571d94, 0x145fbb78,
+    0x7ca9521a, 0x89d2a927, 0xc64d02dd, 0xbc80263b, 0x8166e736, 0x4786ce0e, 0xd241d3ab, 0x440e9eee, 0x2f10f0ae,
+    0xba230fe6, 0xedc6f873, 0x006b6ec7, 0x5e6151c1, 0xd6377593, 0x21f92fcb, 0xfc5c1b6c, 0x303290fc, 0x45fca98c,
+    0x4d7762d7, 0xc6901b2c, 0xe1d08566, 0x12e45a1a, 0x17559b2b, 0x4dc869dd, 0x3fae7063, 0x5f83ae8f, 0x03d50942,
+    0x6dc1cf22, 0x90f2a8bf, 0xa0837d60, 0x4480e52f, 0xc2828def, 0xd33b3337, 0xa6c6ccbd, 0x7f74a70b, 0x466a1495,
+    0x9bdf6aed, 0x8f14f84a, 0x5ec9f898, 0xf54d1e39, 0xdc402696, 0x9ca67539, 0xd34f18f4, 0x69d5812c, 0x16cf2940,
+    0x000266e3, 0xaa5fece4, 0x2a1c19e0, 0x8f8ffddc, 0x092ebf6a, 0xbb216f8b, 0x3be379d3, 0x67ec2cb0, 0x3e624e42,
+    0x2b891984, 0x4d42106f, 0xda6e38a1, 0xd7533a71, 0x10ea738d, 0x382e340a, 0xa0f51e76, 0x72ce9ca9, 0xad2616bf,
+    0xa6241c58, 0xa5166754, 0x9a4fd52b, 0x80f833c2, 0xb5b27bad, 0x09bf9fbd, 0x4f8a0848, 0xc9cc88cd, 0x4131381d,
+    0xe6bfc5a9, 0xe0233cc4, 0x7aca140b, 0xb61e896a, 0x3c2e9cc3, 0x42165ccc, 0x45d7772c, 0x3437daf0, 0x488b6dd9,
+    0x4cd5f62d, 0x6c59b526, 0xef11f91e, 0x27810dd6, 0x5bb703d2, 0x3fba01ab, 0xfbd3c9ba, 0xf10df224, 0x1a0defe3,
+    0xf4e58428, 0x4e6cffd4, 0xe27d887b, 0x9024ba68, 0x84a24d5e, 0xfc5a46f4, 0x73d0275e, 0x3898c949, 0x9bc579c9,
+    0xf63b7d28, 0xb6c39ee7, 0x8539e915, 0x4901f7ac, 0x362bf850, 0x6a3ec147, 0xdc42b816, 0xc1b095da, 0x8687882f,
+    0xff330c2e, 0x516bc6cf, 0xe021a5c5, 0xe1e52670, 0x7a3f5b7a, 0x7c58a7b8, 0x7f6615b4, 0x367a7d65, 0xa6cf12ba,
+    0x8a52824b, 0x61c8b5b1, 0xdc55ddf9, 0x0bb4e8aa, 0x137bdc20, 0x38cf2336, 0x885fd8bc, 0x549962a1, 0x8fe3253d,
+    0xfd764f85, 0xe47f6557, 0x8251fd27, 0x6eb02568, 0x139ca59a, 0xc25124d2, 0xaf35e695, 0xb2329dcf, 0x6b2a483f,
+    0x113e395d, 0x68920a31, 0x07088cde, 0x9745ce49, 0x66ec7320, 0x59b64d10, 0xb139a64c, 0x62e4ad75, 0xabe2e33d,
+    0xadebd10b, 0x5365095a, 0xf8d39b39, 0xa406429a, 0x11d4829c, 0x9b9551ed, 0x33d7798a, 0x35b8145b, 0xfcf8c97d,
+    0xe57b204f, 0x5d7dad69, 0xbc5d5ff7, 0xa575877b, 0xa6423436, 0xeebccede, 0x4e0f29cc, 0x2fc7a874, 0x7bc98d65,
+    0x28ffabe4, 0xf8ce13e3, 0x1a103d50, 0xc1b24f8f, 0xacb2fdb8, 0xf6345f64, 0x11587f8a, 0x993cc7f6, 0xfe4fd709,
+    0x0bd10778, 0x28101ed6, 0xb9ac5de6, 0xe3463f2a, 0x414b394a, 0x80067c24, 0x7efe347d, 0xd9d393ee, 0x84fbb492,
+    0x860fdf7b, 0x52f22a78, 0x5a3b6dca, 0x46fa2359, 0xe128ddf5, 0x84fb11c8, 0xdeaf9bfc, 0x162ac4a3, 0xeccb1e9a,
+    0x222edc23, 0x7ace1a0e, 0x2ec23c6e, 0x8543aa00, 0x3b10e56d, 0x908128ee, 0x828727b4, 0xc58de809, 0xca6cfd26,
+    0x9b5f9ad5, 0x7c6b4dde, 0xbd1cb6ec, 0x59f8c7a0, 0xe732a03d, 0x58972773, 0x72804f28, 0x0a6c753f, 0x12c561e3,
+    0x5d5d8f4f, 0x868b28ba, 0x23ae9764, 0x8a3a9daf, 0xf5a03859, 0xaa9ae0c6, 0xb2e7f0de, 0x113cf81f, 0xe7312bd2,
+    0x73fdffe4, 0xc175907f, 0xbd52d4a9, 0x4f2c78d9, 0xfa3a2eef, 0x1900b736, 0x26a26cf9, 0x66b8a87b, 0x214e5666,
+    0x935185e7, 0x125d958d, 0xefce600c, 0xd6f695bc, 0x010e1e86, 0xa2e7ec38, 0x83ce1bcc, 0x4ea14294, 0x40110eb8,
+    0x3426e033, 0x5968a91f, 0x3c5f144a, 0xd53bace5, 0xb2c09574, 0xf222baf7, 0x97a2ddc3, 0x762b44c3, 0x350d889f,
+    0x929169b1, 0x0318c8be, 0x82ad810e, 0xda00969c, 0x4b36f418, 0x1ebc8401, 0x06e7b760, 0x786809c2, 0x895be648,
+    0x502694ae, 0x9f002f84, 0xbd48a265, 0xe6d9ae08, 0x0bb7ce0e, 0x347edd11, 0x35d0995f, 0x81532dfb, 0x233dc6f0,
+    0x29032aa8, 0xc5d6fe62, 0x495a4bf2, 0x6a0c879a, 0xf2976451, 0xf93ef218, 0x001796b1, 0x78262f47, 0x92d29adc,
+    0x8d96e28b, 0xcee43de5, 0xfcfe06d0, 0xc19f23fa, 0x2dd6db02, 0xee5700af, 0x63276b81, 0xa0e07ec3, 0x76a2be5d,
+    0x2c3222ed, 0x1b4e4b22, 0x85954384, 0x6e928ef9, 0x33a5edd9, 0xd16812b0, 0x95d4eee0, 0xbccff516, 0x2513d2f1,
+    0x2f8ea1b7, 0xeea85915, 0xf12313f0, 0x80f4bbbf, 0x58767eaf, 0x94f8c232, 0x0008a5b4, 0x8ba5cedb, 0x03c25da2,
+    0x1e6c719a, 0xfe9c9806, 0xbb36badf, 0x66adf84b, 0x549c7299, 0x04580aff, 0x8503cca5, 0x4c4cd04f, 0xa2fa9654,
+    0xb0b02551, 0x3c513b66, 0xc2ff9fca, 0x21cb057b, 0x1ae0ade4, 0xef079801, 0x58f2b4e5, 0x40f15c61, 0x0109b9e1,
+    0xdfcbda49, 0x78d6aad4, 0x34bc9135, 0xf5aa3dc0, 0x81c68081, 0x16425d87, 0x87182281, 0xe7d194fe, 0xf909f360,
+    0xdf9bdcf0, 0x0fb247dd, 0xf4959f9a, 0xd14b85b3, 0x717692f9, 0xc1fc87bf, 0x61b013d0, 0xf2e545af, 0x4dae24cb,
+    0xb4f3db7e, 0xfbfd8759, 0x68806144, 0x12d00eed, 0x1fbd26e0, 0xc68128c9, 0x34aed498, 0xb42802f8, 0x31e3d884,
+    0xd8e98064, 0x03a16ef5, 0xcede4aa2, 0x19bc94d2, 0x0d684724, 0x07495860, 0x24c21404, 0x24a359d7, 0x6c4dc587,
+    0x93176ee7, 0x96b2143f, 0xae402308, 0x36506c0a, 0x97ea8a35, 0x1d67317c, 0x04f3da38, 0x4b4701c9, 0xed61ce4c,
+    0x9391a5b6, 0x05a19c4f, 0x840ac017, 0x5ceb1a89, 0xfdd0b332, 0x13655c51, 0xd653ea5c, 0xa57b9951, 0x91dcdc5c,
+    0x26f34d70, 0xdae0d673, 0x27c38094, 0xcb553397, 0x752a685f, 0x7d5bbaf3, 0xf9a29362, 0x0552a20c, 0x4abcb49e,
+    0x11b2ad1c, 0x70e06493, 0xdac3a47c, 0x56fa0b0b, 0xadc9eeee, 0x1afdd878, 0xbd3c4911, 0xa3b68dd3, 0x9737ab21,
+    0x7dd94c24, 0xadb3b5bc, 0x6d02cb2f, 0x89e94f56, 0xf4ec952b, 0x31cee45d, 0x323f0b6f, 0xc2249fc1, 0xabd2f201,
+    0xaf2dff85, 0xa64f4f17, 0x24915ac7, 0x541d3ec5, 0xed5f8c2a, 0xf0ef24c5, 0x12299a75, 0x09349af7, 0xc4463b16,
+    0x805bcfb7, 0x94af2500, 0xbc8f1665, 0x6a6bb161, 0x19ae6b1f, 0x26dd7b2c, 0xb54cb8f8, 0xfdd26d00, 0xbe596ff0,
+    0xfe30c855, 0x55452243, 0x840244b1, 0xfd1c7ffe, 0x57486418, 0x0e0aae9a, 0xddece953, 0x44553e4d, 0x95fdebee,
+    0x1122d777, 0xbf6c0992, 0x7ebd6138, 0xbf84e347, 0xba13cc84, 0xd9e377c9, 0xe52feafc, 0x36663b7f, 0x6cd15c67,
+    0x66a183fe, 0xcf62809e, 0xc81501ab, 0xc7be5d53, 0x62a3888c, 0xf4187dba, 0x4bd3ef8a, 0x2b57a4b1, 0xf5bdbe4e,
+    0x72df2881, 0x65ace438, 0x5663f172, 0x3539a8ea, 0xa46bf984, 0x50e9149b, 0x34249d87, 0x9e2c4671, 0x0e39f920,
+    0x200d97a2, 0x2640dade, 0xab166f3e, 0x51b79924, 0xd32cf8fc, 0xdd9586db, 0xf517cbaf, 0x574d0802, 0xad9aa4fc,
+    0x42113545, 0x76ce6956, 0x34131fe1, 0xc8445af7, 0x8ea84c7a, 0xcff8973d, 0xa7c60c91, 0x52cdaa05, 0x8745cbb2,
+    0x86dec980, 0xc9f3a7f8, 0xdbbf62e9, 0x3b94183d, 0xda93cb16, 0xe68107e6, 0x3eb2bf63, 0x64b96ec3, 0xcd2c6c9d,
+    0x0ae8c7a3, 0x9cf0d23e, 0x21963d43, 0x6f93a4f4, 0xf7b05789, 0x0278f0ab, 0x14bf4a8c, 0xd3c2a3be, 0x85067a3b,
+    0x3a538eed, 0x1794399d, 0x351d00c1, 0x4cf4eb37, 0xf1412351, 0xa361a9ff, 0x40b5fb3b, 0xe5520024, 0x4efcd29a,
+    0x310d022f, 0x7358fe68, 0x07710b6d, 0xee728062, 0xd7610c7d, 0xd2ac21c4, 0xba3f3d5d, 0x2717aa2f, 0x27240e12,
+    0x004d47a6, 0x9a7a6431, 0x49a061dc, 0x41ce6716, 0xb4f00da0, 0x4e193776, 0x79be2fc6, 0x40c2431a, 0x7290a180,
+    0x905b3cef, 0xa1716a53, 0x813f972e, 0x659e52a6, 0x21606b05, 0x05db94d5, 0xf9389160, 0x725af45d, 0x5c95fa9e,
+    0x81d7f6a4, 0x599ffeb5, 0x8dda6a08, 0x9dc2d9e0, 0x790e761c, 0x2722890f, 0x89ad47d0, 0xa2ea2519, 0x1738fede,
+    0x3caeb508, 0x379ad9b1, 0x65c0ab40, 0x33ecc6e4, 0x7128953b, 0x3e2bf25d, 0x5bee12e7, 0xa7396197, 0x2f077530,
+    0x54bac5fc, 0x28ab870d, 0x914bba47, 0xa3fae335, 0xa6703e3b, 0xfe708010, 0xe633c7a5, 0xf43ddd75, 0x0eb6d3cb,
+    0xee789665, 0x45673f9e, 0x7d0fac27, 0xa6b915ed, 0x7698174d, 0x3c971d64, 0xd87a9b75, 0x4256874f, 0x6daaf805,
+    0x6b403d3b, 0x8de26e11, 0xf2d7422a, 0x73ffbebb, 0xc195a1ea, 0x31e21e95, 0x0165cb27, 0xb9e1650e, 0xed75e09f,
+    0x79ead099, 0x07525d78, 0xa091792c, 0xfb89564c, 0x3b9755f6, 0xabaa2018, 0x03a07970, 0xb1931750, 0x25d0412e,
+    0x31fd6aea, 0x2fe25b26, 0x0124c10e, 0x4d5690a1, 0xb06fb3c6, 0xb953f092, 0xb8afe77e, 0x7eef37df, 0x5e75a400,
+    0x0aa83b88, 0x3bef1f2f, 0x5dd5a547, 0x39b77729, 0x21e1172a, 0xf13ed351, 0xc45e8fa5, 0x7427fc22, 0x6495e723,
+    0x2770ba55, 0x47aadbb2, 0x6a8066d8, 0xbf995b84, 0xb95d4a18, 0xab07c4e2, 0x85132ceb, 0x0cfc0da0, 0xfe2cdd0c,
+    0xc350e15d, 0x8d54e839, 0xc1e9d591, 0x6f856501, 0x2f52121c, 0x0ac60eb0, 0x11dfe0a0, 0xe69a7045, 0xc73b1534,
+    0x5f61ccd4, 0x28825d80, 0xb5b27d50, 0x97b0d343, 0x600edb9a, 0x9612f960, 0x125a7c45, 0x37e82bca, 0xdbf03420,
+    0xe02c699e, 0xe3d0e7c8, 0x8fb050d6, 0xa6b293c8, 0x30bbae2f, 0xfafee395, 0xb345dadc, 0x9769ce5c, 0x2a27f8ba,
+    0x4fcdfaac, 0xecd14e45, 0x812c95e3, 0xb93a91d5, 0x612db4ec, 0xecc3ad74, 0x845ce089, 0x46e18899, 0xeda61719,
+    0x1c9f61ae, 0x6951b6a2, 0xddc57615, 0x8d2db581, 0x9ef8cb4b, 0x286f2ae2, 0x87e600c1, 0xc812bcf7, 0x64f9f74d,
+    0x40c6a757, 0xb3b4e38d, 0xc55a0c0b, 0x0edb1ab8, 0x32f18985, 0xf63218bc, 0x23b1525c, 0xa724b9aa, 0xe40cab6e,
+    0xf7ca4651, 0x310cff69, 0x2b5e61e1, 0x7699f465, 0x96a7b18e, 0x247e18db, 0xc94201d2, 0xe70ae07b, 0xb9adaba3,
+    0xe872e81a, 0x3a507cfd, 0xc84708ca, 0xad8f7236, 0xf4b12e59, 0x673bd385, 0xa15b69f8, 0x53a3aaf4, 0x4e8f2b00,
+    0xf8f083c9, 0xfb36643c, 0xc2884f7c, 0x73c9e001, 0x860af9c4, 0x216ebac2, 0x41b402b4, 0x2fd49947, 0x6382a359,
+    0x1738318b, 0xa5a51360, 0xe1980d14, 0xbaa1946e, 0x34850215, 0x1567c659, 0x1e244683, 0x87bda00d, 0x31936421,
+    0xe6ff89e0, 0xcb8eccae, 0x6a6540bd, 0x37b7f3ed, 0x932717df, 0xc90965c5, 0xe9bc19c3, 0xd2200a45, 0x846a1897,
+    0x1c1f9e0a, 0x0a037d90, 0x1965af77, 0x97e15853, 0xd6843512, 0x3464d67d, 0x5925215e, 0x6f523fd0, 0x7a60005a,
+    0x70e6242e, 0x02fa27c9, 0xb8f738e3, 0x9f9e529a, 0x4207e8a4, 0x463bc8d5, 0x82be6f3c, 0x154438df, 0xd3247733,
+    0x3c38179f, 0xbab7520d, 0xcb8bee3c, 0x9afd2e11, 0x59819fda, 0xb600aa61, 0xfb0c2ed1, 0xf1f87abc, 0xd75fe07c,
+    0x4fb92497, 0x9df76263, 0x7baa18ef, 0xdc029ae5, 0x36c546fe, 0x37c1ff4c, 0x68d05cbe, 0x32078f41, 0x6189b624,
+    0x4fa38c44, 0x7495cdfe, 0xdf455685, 0xcc99659f, 0xe481cbac, 0x9e265d69, 0xf324a68a, 0x8c863ff7, 0x4342a900,
+    0xd3f0b28a, 0xc2b32ac5, 0xb17231f4, 0xbf0b3bb1, 0xa6c971d7, 0x9e41ea03, 0xbc0cde33, 0x0b8309d2, 0x9517a700,
+    0x156d3662, 0xe6900601, 0x2127625f, 0x4f0ca544, 0x4203da3c, 0x5fed7965, 0x7f6bc92f, 0x9212232e, 0xd18adcd8,
+    0xbcb086c2, 0x50773f9d, 0x49632243, 0x483d0285, 0x96af728b, 0x1465b7f5, 0xdf97db25, 0x4b56dcb7, 0xd9b3a8e5,
+    0xd5ff02c4, 0x80af00f0, 0x62655fdb, 0xa7768c28, 0x67a65eb8, 0x1e70ee36, 0x71b41096, 0x411a2abb, 0x6c781ee1,
+    0x697023ea, 0x8ed404de, 0xf41e9019, 0x361de846, 0x73700793, 0xd07662dd, 0x93399a45, 0xda414909, 0x00bc315f,
+    0xa3a51b4b, 0xdf9ce652, 0x4a22353c, 0x4fe6f4c7, 0x9fd5d209, 0x633f0ca1, 0xe4e4b8af, 0x4e3b0ebc, 0x8e0006ce,
+    0x0da0e15a, 0x69daf921, 0xef23c389, 0x7ba3e24e, 0x2430ce41, 0x4f839143, 0x7ca529e2, 0xf90c1f4c, 0x2775d408,
+    0xc325dbc9, 0xf0bd033f, 0x24635a58, 0xf4150519, 0xeb4ff0af, 0x9fa63a02, 0x33a2f3e6, 0xb22c0d9d, 0x09dc7b0a,
+    0xdfea8e07, 0x81e89c2f, 0x070ea201, 0xf257f0c0, 0xf16b71e4, 0x56c7afab, 0x31a955ae, 0x296a9115, 0x3507eda6,
+    0xa4a64fb2, 0x8c953aaa, 0x9ab0983c, 0x3398e8c3, 0x9a2737a7, 0xc61f5826, 0x2bc82c39, 0x2d241145, 0xe372ed0a,
+    0xcd96e0e7, 0x87ee942b, 0x67584c83, 0x2a45b9d2, 0x3c6add94, 0xae808b77, 0x8fb2c6cc, 0xb257d33e, 0xe0076836,
+    0x5b86b1df, 0x5466eb3c, 0x4420361e, 0xb582a4de, 0x404b1c41, 0x54c9fe6b, 0x176bc33b, 0xd5cc72b6, 0x7dbf3553,
+    0xdc2be858, 0x68b8e2a8, 0x1d63f035, 0x9fa1561d, 0x65e285f7, 0x884c6518, 0x03314ee0, 0xd1e0163f, 0x40753743,
+    0xb873eafb, 0x31c32393, 0x5d5cdfce, 0x5955b1d6, 0x3a0d5658, 0x2f0bc34f, 0x32873561, 0xb3720184, 0x0952eb95,
+    0x129abea9, 0xe899e9e5, 0x03c7f5c7, 0xc394b527, 0xf957df9a, 0x7699ccc7, 0x599dd10b, 0x9fc85501, 0x1de5c38f,
+    0x25c046d4, 0x1da36322, 0x07a8a779, 0x44d475cd, 0xbfb91847, 0xe736f71a, 0x7b348cb1, 0x40dc613c, 0x5ae42716,
+    0x33135de4, 0x2e7a3249, 0x7a55d291, 0xccc27f39, 0xd4601f74, 0x0f0fe825, 0x59f20218, 0x85ddc2b8, 0xb700776e,
+    0x2b9bc2b0, 0x334a5ac3, 0xf829dfed, 0x9fd81aaa, 0x122ee190, 0xac98cdfe, 0x5a819ef2, 0xa901187d, 0x0f0e7910,
+    0xa475390a, 0xbe84e51e, 0xfd3fac60, 0xdb19cde2, 0x23fa91a8, 0x9acc3285, 0x4ae2bb68, 0x77068e52, 0x93d6707b,
+    0x5482f83a, 0x926643d8, 0x50137040, 0xfde303b4, 0x0713ebec, 0xb9fd3d6c, 0x624247d2, 0x8f2000db, 0x58790af6,
+    0xee4231f1, 0x068e2f6e, 0x57568319, 0x4205d310, 0xb70b8a74, 0x47fe8897, 0xdb92a66e, 0x0a603f43, 0x5b7e04db,
+    0x4eb1d95e, 0xacad7353, 0xe2ca72a8, 0xb5561270, 0x0bc88917, 0x913f85a9, 0x30acd009, 0xdfd5228b, 0x2d975adf,
+    0x6d761442, 0xa959ec75, 0xce87fe1f, 0x462e5168, 0xfa8e252f, 0x23caaf5d, 0x88d08ca8, 0xbda33179, 0x4b292f0d,
+    0xc766e8cc, 0xdf1aca80, 0x91438c37, 0x5365bbf5, 0x4aa10464, 0xba0412a5, 0xf9c195ff, 0xe92c94f9, 0xcf93799c,
+    0x74e93251, 0xa1ff1a81, 0xafa8c93f, 0x7b0befbc, 0xf78ea9e7, 0x84d54ce2, 0xa7ad12ef, 0xde62734f, 0xddf3c78d,
+    0xa8236b1f, 0x15ac9a0b, 0x022e43da, 0x4296c561, 0xf8a65783, 0xf0f4ef92, 0x0e2c098b, 0x07c451d0, 0xec3801b5,
+    0x2487cacc, 0xb7bcbd1f, 0xcbd302b6, 0x29f36c5b, 0x465372f5, 0x402da436, 0x222e71e8, 0x31074ae8, 0x0a1646ae,
+    0xd826af93, 0x68cc3b68, 0x76b9ba9b, 0xafe8eccf, 0x06194058, 0xaf42cc2e, 0x64c8e577, 0xf388b429, 0x326ba7e8,
+    0xa31c5cce, 0x6a1c426d, 0xfb8a0a06, 0x36140cbf, 0x73cbec6d, 0xef785302, 0xbc828bb1, 0x7005f8fa, 0x09d6d4da,
+    0x3aca140a, 0xc40b6256, 0x655aab55, 0xc49355c8, 0xc972ee69, 0xaa8114e9, 0xef489c3f, 0x862dde7f, 0xc3e001df,
+    0xf731d788, 0x0f6c2e1c, 0x1016d0a3, 0x6bb68800, 0xe2997e0a, 0xd70ad551, 0xc21fdfa5, 0x0faab822, 0x814906d3,
+    0xdb1b4d10, 0xcb24cde7, 0x1cf2dc91, 0x1fa46d02, 0xa47b3528, 0xc1650099, 0xc2032b39, 0xcb671367, 0x5ef29661,
+    0x32df9bf6, 0x2b8a3a98, 0x5395d489, 0x1860644f, 0x7e395900, 0x9fd3d41c, 0x0c45cd48, 0x7668a70a, 0x26f7518f,
+    0x09c1d892, 0x90f35cbc, 0x7cc559f3, 0x2ca9f3a5, 0x3799f988, 0x0e6340b8, 0x0af9c366, 0x9ec51c7b, 0x507c2bfc,
+    0x0e8e0601, 0xeca9c493, 0x457ed610, 0x6b39445e, 0x8a9209a0, 0xdd417b89, 0x311a816e, 0xdc6ed7ea, 0xb8a2f4a6,
+    0x8dbd7190, 0xd6f7347f, 0x9c28d2f9, 0x351d682e, 0xb6827bad, 0xbe2c3bb9, 0xbf5ff5d8, 0x1a1c00e0, 0x4342e3f8,
+    0xdd6ca254, 0x6ca2e4f0, 0x924d770a, 0xd84e36d4, 0x094c658b, 0xda90c4a0, 0x4bfcee8d, 0x718b23e8, 0xbbd2c9a1,
+    0x7859b665, 0x697add42, 0xcea00180, 0xe3074a5d, 0xe5475087, 0x5fa78bce, 0xc945f897, 0x417d6997, 0x8e7af417,
+    0x5f19b95f, 0x6aa6274b, 0x5ecc257f, 0xe7c34759, 0x16a30bbb, 0xfbb5c575, 0x26a10b1a, 0x6ec36580, 0x2d2f5958,
+    0xa9ff45ae, 0xf684877b, 0x4d858b18, 0x6d828265, 0x74be56fb, 0x91b88d21, 0xee173868, 0xe42f7dec, 0xd21841cd,
+    0x366cd1f2, 0xaf4bf275, 0xed25f60e, 0xc481cfe7, 0xdedbf7ef, 0x974e09a0, 0xb657cd1b, 0xbf605878, 0x604da2d7,
+    0x6f9413cc, 0x980bd4e8, 0xa28db0e3, 0xed4794f6, 0x41aa6ad6, 0xdb478567, 0xa9956922, 0x32766180, 0xf5ca3f74,
+    0xf74c3e23, 0x463fbe22, 0xd3122e73, 0xfa99f829, 0x5397b281, 0xfa3f9722, 0x9bb62007, 0x853028fa, 0x04e3310f,
+    0xa6a58b54, 0x980e7a89, 0x39dbe144, 0x2698154a, 0x35ea7b48, 0xb6ae1dc0, 0x7015ae91, 0x140cc1b0, 0x0b46832e,
+    0xf95384bb, 0x44fa12db, 0xdacdfb8e, 0xc68b7470, 0x44fa5216, 0x1cf0c9ee, 0x68ed1b58, 0x7417d801, 0xdecfda63,
+    0xa1d9a24f, 0xef80b91c, 0x3b875217, 0xd8c491ce, 0x38254d5f, 0x205054a6, 0xd9f36130, 0x4dbe33b9, 0xbf6dfe16,
+    0x2751101a, 0x7dc67d90, 0xafa34058, 0xf13f7111, 0xaad3d9d0, 0xbe8eb401, 0xde9b5f89, 0xce43ac90, 0xa9c797a7,
+    0xf800dee2, 0x10a939ed, 0xabc462ec, 0x0bca3963, 0x44d2491f, 0xdfd3dfe2, 0xa2726bf0, 0x66163177, 0x7a0c13d4,
+    0xaffb89bb, 0x572a36b3, 0xa10a3482, 0x45142eed, 0x1bbe73b7, 0x8dd15fcb, 0x88b99dcc, 0x98c6b4aa, 0x066fbb16,
+    0xdda53bb3, 0x8bd21276, 0xbef6e6a8, 0x5ea9b256, 0x64ecb3d1, 0x6bf4b9ab, 0xa5ab4530, 0xb8d6f89e, 0xbbac536e,
+    0x0859b20a, 0x56e5fe0c, 0x14bdbfff, 0x485499ef, 0xa4d223fb, 0x50e791aa, 0x040380fa, 0x09213c82, 0xc5928a91,
+    0x5c9679cf, 0xd4110182, 0xff6f486d, 0x42e09d52, 0x77941729, 0x1f940841, 0x2ad42039, 0xf04bbef1, 0xf3cbdd89,
+    0x7f6eb158, 0x5bcda246, 0x3ef7bbb3, 0x87cfee98, 0x4a8cafc2, 0x0b3ebeaa, 0xd6d598f4, 0x28cb241e, 0xa989c68d,
+    0x1e18967b, 0x72d6333e, 0x06d1c867, 0x2ee86abf, 0xcedefa78, 0xdea90824, 0x5b5b3899, 0xef63a82c, 0xd809bc64,
+    0xde58f068, 0x9c1b60f7, 0x215c4ad0, 0x8bbd5ead, 0xc4455a0c, 0x8a430748, 0xb62f7754, 0xbf544bbf, 0xd3032de8,
+    0x8ec8079f, 0x034611b2, 0xdeeffe9b, 0xb221a7cc, 0x54fb0980, 0xd2453a51, 0xf874375f, 0x951b58d3, 0x4ae7f60f,
+    0x3fce4e4a, 0xeebb2d82, 0x2dce3bbb, 0x975fb7c6, 0x11778294, 0x385d3513, 0x7f604673, 0xe6d25fc7, 0x2cc562b5,
+    0x22a401bf, 0x7ca60449, 0x9313eb15, 0xe3e7ced5, 0xc43048f6, 0x5a37ee9a, 0xf0f464d5, 0x339c8298, 0x3d41f0a5,
+    0x924e1233, 0x7d230e77, 0x75b92fad, 0xb379be44, 0xdceab32a, 0x064d566e, 0x47e226a0, 0xd2596dd0, 0x4e9b5bd8,
+    0xceed6661, 0xa850171c, 0xfc1b2d6b, 0x06330387, 0x2a8ab2ca, 0x098ab8ff, 0x0f4fbf8a, 0x8d9d528e, 0x41f9d623,
+    0x5be1a9ab, 0x6bbd4174, 0x7d9d049b, 0xf9ed326f, 0x3acd4bd8, 0x95c1a69b, 0x25009cc2, 0x64c4652e, 0x94ee05d4,
+    0x4afcbc32, 0x83875634, 0x2aff8fe8, 0x022dda37, 0x381d114f, 0x978f8bd7, 0xa9611c36, 0x86944a65, 0x5a8708e7,
+    0x58852807, 0xe118fa92, 0x28c5b824, 0x70fe2e8b, 0xb24f9476, 0x59fde72b, 0xd755920e, 0xb88616ef, 0xf5909012,
+    0x5bf67c0b, 0xe16577e8, 0xf8109618, 0x81bbb798, 0x9bf1e861, 0xedd548d3, 0xc6066c63, 0x057dad7d, 0x9ad4ab46,
+    0xde6e80e4, 0x45c27d3f, 0x833c2ed3, 0xbae0b63f, 0x22800af6, 0x93749f0d, 0xadd0e3c3, 0xe55fe67d, 0xcdf702f5,
+    0x80f038c2, 0xec2eaef9, 0xccff8744, 0x17b5cab3, 0x513c5d47, 0xcee43528, 0x8e09f336, 0xa6801817, 0xe9d22d9b,
+    0x0b69021b, 0xc785cf86, 0x5c8ffda7, 0x8bde804f, 0x60d6fc85, 0x8df77b70, 0x19030b83, 0x3a3bdcbc, 0x360f0aed,
+    0x4f59033b, 0x2f9f9ab2, 0x3a032f80, 0x35dfde06, 0x9a719f5e, 0x6e6ccb97, 0x2b407136, 0x0445d761, 0x58561e41,
+    0x76d13c27, 0xd88b0c12, 0x3ec4d23c, 0xd8d92998, 0xef06f7e2, 0x0ca0d8bd, 0x7c5dce51, 0xaec47c18, 0x226d816c,
+    0x41001485, 0x37e3b29a, 0x4386ed75, 0xf7d8ed38, 0x934e2fe3, 0x2953ac02, 0x73717e11, 0xab19a822, 0xeab83cb2,
+    0x0c75b65f, 0x48fc3e30, 0x21f12a45, 0x1d2ea428, 0xccaf019f, 0x384e3346, 0xa11207bc, 0xaa0f096c, 0x6d884afd,
+    0x3f1553cb, 0x690b7f8d, 0xa3bd3c22, 0x4206358e, 0x6cd2eae9, 0x16e9e427, 0x65a1b4e2, 0xfa835e8e, 0xbf553a7d,
+    0x88a8b53f, 0x05afdbf6, 0x3351caa8, 0x0074bf8d, 0x1223caf2, 0xf06e9aaa, 0x6dfca291, 0x2e0079bf, 0xd79a5498,
+    0x37a2c7ab, 0x96fc22a7, 0x248be6f7, 0x80dbf7be, 0xdb3d255c, 0x6c0b5bf5, 0xedc4d1be, 0x4eb0340b, 0x46719b59,
+    0xeba9de13, 0xd658a813, 0x36a25354, 0xacd0c756, 0x1dc6a7d7, 0x950e82da, 0xd6ca1959, 0x8f8f0618, 0x34b29cf4,
+    0x94f8d19f, 0x5d3bfb38, 0x5f94537e, 0xd5b29f04, 0x0bdf1309, 0x4a4e7e55, 0x8b58db51, 0x95a17dd8, 0x4276a396,
+    0x279c02ac, 0x4552313f, 0xf96969e7, 0xa036b052, 0x43545df8, 0x9a3b89b3, 0x9b673491, 0xbc29be01, 0x9c3eab28,
+    0xb01264dc, 0x31c58fce, 0xad84d835, 0xfa3a72d7, 0x7948a0a7, 0x3c411a5c, 0xa85a1bfb, 0x5b543d14, 0x360ef716,
+    0x5139dafc, 0x2e823eab, 0xf4aa489e, 0xe5c73fc0, 0x9cd5e967, 0x57a32dcd, 0xf3e34620, 0x1a8065db, 0xb1759e50,
+    0x7afaa71c, 0x1f610b99, 0x4ae28d28, 0x6977ebd8, 0xbec97d2d, 0x4d74a548, 0xf4b3f3e2, 0x96f64fee, 0x26fb7560,
+    0xe6d212ff, 0x1a40d971, 0x2e4f1414, 0x670024e1, 0x2b0309dc, 0x13449092, 0x7f2a7451, 0xdf7c4012, 0x1ebfda8a,
+    0x10b72177, 0x8642e465, 0x27790f86, 0x4e5061d6, 0x4ef056ec, 0x9b7807ff, 0x2863b329, 0x28955724, 0x4609db3b,
+    0x60ae2abe, 0x447d98eb, 0x30eb705f, 0x42d97c15, 0x772638a7, 0xff4bd30f, 0x77d47ca0, 0x1a33989a, 0xddade06d,
+    0xf54c90df, 0xfa56b8b4, 0xfb27374c, 0x08ecb317, 0x80a92bd6, 0xa4caeade, 0x6788dc81, 0xe436ecce, 0xc2d08c14,
+    0x84235bc0, 0x060ce3f3, 0x109f573e, 0x861f484b, 0x881c7e05, 0x083aa401, 0xbd59b573, 0x3a37c9f8, 0x77d2efe6,
+    0x8125fee9, 0x8ced1d17, 0x70cfcbe5, 0x4c0dfe20, 0xc9e5ead5, 0xe83131d0, 0xdd2b8512, 0xd9174d1d, 0x4bb07f44,
+    0xca30d8ee, 0x0cfc0f8f, 0x2151289d, 0xfcdf091c, 0x162abdd6, 0x558af934, 0xc23dffa8, 0x78fccb05, 0x500a448a,
+    0x7c346926, 0xd0ee5df9, 0xe299389e, 0x586fdc65, 0x6ac9b555, 0xe36f8487, 0xff4a75eb, 0xcdaf476b, 0x24efa6ed,
+    0x8c9e912b, 0x49e8dad5, 0x76e1dde3, 0x5cb0c256, 0x90c35e5d, 0xdf566728, 0xdb5905fc, 0x8dce5c84, 0x2f6fbf39,
+    0xf9e7f0f2, 0x061d8792, 0x3b35e98b, 0xfbed9249, 0x023328b0, 0xd4919fea, 0xb2bbd743, 0x9b932da4, 0x37a41e7a,
+    0x778da1ec, 0x048c99fb, 0x4ff2ceac, 0xc78db9da, 0xe00c388d, 0x63b9ff63, 0xc4555999, 0xc80fa854, 0x4afcb644,
+    0xa6e2e309, 0xd1cf7199, 0x169f9f91, 0x8e7cd4e3, 0xca585ce4, 0xc30e4760, 0x1357c88f, 0x59a0ad2c, 0x436edff9,
+    0x5f863aa9, 0x232e29bd, 0x8ee642e6, 0xdee514ad, 0x1683f4f2, 0xfcd143ba, 0x932391bc, 0xcea6da13, 0x227763bc,
+    0xae7240d2, 0x6bf71216, 0x82b2a5c7, 0x3fc4fcf4, 0x531f0faf, 0xfbd98a70, 0x7eaa53e4, 0x55ef6a42, 0x444e1a5f,
+    0x0a40eefa, 0x70db9ef5, 0x1ab57467, 0x33fc10a7, 0xf31bb7fa, 0xa0f9f180, 0x1311ecc5, 0x28f5abe3, 0xf0ba73b1,
+    0x8252bf3b, 0x3efa0668, 0x46c207c5, 0x63b9a42c, 0x8794280f, 0x823add2a, 0x2b496d6f, 0x5583900a, 0x489fa820,
+    0x31343d5e, 0x97c75945, 0x332eb976, 0x90c9c11d, 0x4bb5536d, 0x60a4ab6c, 0x1b0e9369, 0x8eafdeef, 0x1e6b2d35,
+    0xc9ac5f8c, 0x5490dfb4, 0xcabaf0b7, 0x09a6c9a8, 0xe8a4817d, 0xbd95a034, 0x11b77cfc, 0xf58fa7da, 0x6a1c7295,
+    0xb65ae610, 0xb4b18b9d, 0xb6b2cf06, 0xe4c526a6, 0x714ff8ed, 0x393a5ca5, 0x98b1e821, 0x493b6614, 0x8dbe9b08,
+    0xe934119a, 0x127cd42d, 0x4bbeae95, 0x8c9c96c4, 0x097ccbc7, 0xace0afa1, 0x732f4037, 0x33613f9e, 0xc9b74a0c,
+    0xf1591fc1, 0x3611f6f9, 0xf2d68446, 0xe5646c29, 0xf837f0b0, 0xb62f424a, 0x1bfa7ba8, 0xe6fe38a9, 0x2db44afa,
+    0x2bc059db, 0xad69d10a, 0x7cc43cf4, 0xe60faf15, 0x5fb54683, 0x681a05bc, 0x52535539, 0xaa776be2, 0x99d6c074,
+    0x61a2dee8, 0xbaeaf0de, 0x5c24418a, 0xbed16f07, 0x1f318265, 0x2092cbfc, 0xd21995e7, 0xf9cf94a6, 0x23c71cfe,
+    0x66438f6c, 0x2f827044, 0xbfcc9fa6, 0x1a14f91b, 0xe19ed5f3, 0xff3a0c74, 0x0ddec70a, 0x1fb1c182, 0x1bd969fb,
+    0xee6e7ca8, 0xcb8cc124, 0xa703b7ed, 0xaa4b81f5, 0x0d686ccc, 0xcd8b9a2a, 0x95982f05, 0x9ee810e4, 0xa197d2c3,
+    0x7fbac1ed, 0xa6f13e0c, 0x14f755be, 0x4e50f00d, 0x0184b07f, 0x211a7cff, 0x11a25b75, 0x8dff47d7, 0x7f62e6d1,
+    0x1bd81813, 0x14cbad9d, 0x631f8b20, 0x8f27668b, 0x285f40da, 0x0b82734c, 0x4a4553e9, 0x9a201e37, 0xdc0ddc15,
+    0x807e24b7, 0xa15afc2f, 0x57287689, 0x043d155a, 0xf28a4823, 0xe143c76a, 0x680e6a60, 0x1510a548, 0x26c37ab0,
+    0x555aa3e6, 0x399c9d23, 0x0ad5362c, 0xe36a0423, 0xe4b7d819, 0xa4995de6, 0x05aec66c, 0x5e9059fe, 0x23959de9,
+    0xb12bbe3b, 0xa3801113, 0xfa02a50c, 0x5222bbec, 0x2cdd394b, 0xa7893d78, 0x5f2dd938, 0x697adb66, 0x301316f5,
+    0xf1bf47e5, 0x6e09ce9f, 0x393ad495, 0x31d789c9, 0x4046ac20, 0xd182dc1b, 0xb4e4f328, 0x73a055d1, 0xa2d2a5e8,
+    0xe59a8fe1, 0x272bb5cf, 0xaf04488d, 0x252f53a9, 0x9d918712, 0x4ec2fbe5, 0xefac834f, 0x9e772a4e, 0xcd9b9029,
+    0x149bd2ef, 0x89bae615, 0xb16ed0eb, 0x0f80aa04, 0x10c879f7, 0x0a7133d5, 0x10a2e051, 0x07a1ce5d, 0x0cef4803,
+    0x8f4c0515, 0x31020d4a, 0xc79605ce, 0xadc04155, 0x55483e4e, 0xbae562b6, 0x386f8537, 0xbba791ea, 0xc1bbab0a,
+    0xfa24dccb, 0x760a11d0, 0x907c1349, 0x15a81098, 0x2b2d2a7f, 0xef4632e0, 0x14ccc5b3, 0x5ef9511f, 0x5bf9f73c,
+    0x719076ab, 0x6538730d, 0xd2f4fe1d, 0x7288d58d, 0x2e56e88f, 0x5b0e78bb, 0x826ae505, 0x4a369dff, 0x4bdd8010,
+    0xb6360692, 0xc1218f48, 0x1442147f, 0xb3fb22ea, 0xfa314369, 0x548a885f, 0xd5c9a226, 0x7e75da13, 0x14d8b186,
+    0x0600f183, 0x1a34506f, 0xf0b97c5c, 0x170c1693, 0xaf4ff566, 0x836e19ac, 0x3868c45b, 0xd47afa17, 0x2221abc1,
+    0x76d903d4, 0x32ca4cba, 0xb397ea8b, 0xca1f165d, 0x52d14fcd, 0x217b681f, 0xc1408f6d, 0x822ba989, 0x10092cc7,
+    0x18e5601b, 0xd0df8e82, 0x4d2d7196, 0xcf67b9be, 0xfa5ec85a, 0x170ec24b, 0x90085a79, 0xd38729fc, 0xa8b717bb,
+    0x13cc64ce, 0x82b62be6, 0x035acfea, 0x3605e661, 0x1e9656b7, 0xffa81336, 0x88f54167, 0x174e77a6, 0x3aae90c4,
+    0xa25f1205, 0x8c604321, 0xead50492, 0x7c2ca727, 0x25f434f2, 0x735f1bec, 0x507664cb, 0x04163f3d, 0x3b178ae5,
+    0xea5330d4, 0xaed8c53f, 0x5efa6f66, 0x14edaf61, 0x562e1914, 0xcddbdf28, 0x1478990d, 0xf1a88602, 0x926a1162,
+    0x449383a4, 0x3ea5f10a, 0xa3edfa56, 0x77b40817, 0x899b348e, 0xc5603a86, 0xc62c533a, 0xb6466dcb, 0x8ed400d3,
+    0xa3d7fdee, 0x32f4a735, 0x85599ad3, 0xc30018b3, 0xd4649221, 0xd61bf97b, 0xba9e23f9, 0xfd9fb8d5, 0x868ab280,
+    0xf2c74f06, 0x6e9cf47d, 0x9d398695, 0xb3083eee, 0x94f39801, 0x219239e7, 0xe095af93, 0xdd425e4b, 0xed57d84d,
+    0x38b86511, 0x2257ceed, 0xe1f66ecb, 0xd0fe7f3e, 0x4c0bdaed, 0x048ba690, 0x749bff08, 0x6c556756, 0x33a4d2f4,
+    0xef14bbbe, 0xcbdff04a, 0x47667bca, 0x0b7dce66, 0x6f58af07, 0x61a53797, 0xf44e8456, 0xa941c215, 0xe4f62234,
+    0x103b7701, 0xf90f2d55, 0x209d17a3, 0xe54dd599, 0x0e6ce16c, 0xd9d63ab0, 0x333a544e, 0xd94e720d, 0x8e04ed57,
+    0xed8a801a, 0x6911d12b, 0xe2d411e0, 0xaa2eff46, 0xf4039bcd, 0x6f2eae0f, 0x4c781567, 0xbf49f25f, 0xb0beaf52,
+    0x2f12cae5, 0xcb3d9a7c, 0xb64035c5, 0x2613f145, 0xa9839baf, 0xcb4a6d5a, 0x746c69d8, 0x6ce4706f, 0x76f7a6a9,
+    0xe341fa47, 0xad893e8f, 0xb3ef1649, 0x82892a07, 0xa335cf7b, 0xfe282596, 0x57eab128, 0xae349a7a, 0xdbf74a7f,
+    0xee4b789d, 0xe7a18fa1, 0xe761b722, 0x7a6e603d, 0x05d13700, 0x288b226c, 0xc613643e, 0xbfa60a0e, 0x711a0b1d,
+    0x4a5ce0a8, 0x0fc86fd6, 0xf082a4ad, 0x968fe4b1, 0xa26cd523, 0x318ddd8b, 0x7a656274, 0x032a858c, 0x54fe3374,
+    0x0f1fba8b, 0xa3f4136b, 0x4cba63f2, 0x1512b1b5, 0xfbd92f2f, 0xfb4680bb, 0x3735e497, 0x41e45d6f, 0xe8d8971b,
+    0xf7ac48fd, 0xa8583940, 0x110c6ce8, 0x3ffb057c, 0xda90eb98, 0x6001ba3d, 0x8b2d6866, 0xc88bcb8b, 0x57b0ccc5,
+    0x7503b6a1, 0xe0ea19f0, 0x7b78f6a5, 0xed00d166, 0x20d21811, 0xd76aae09, 0x941e852d, 0x417afbe5, 0xee9fb1f6,
+    0x3675f977, 0x42184504, 0xe54acc43, 0x6df50f8f, 0x13bcf1d6, 0xa3e0c107, 0xe05c36ac, 0x4ec5dea9, 0xccd72edd,
+    0xfa4b5d15, 0x28fc073b, 0x107ad3e3, 0x3f8add5d, 0xd95862d9, 0xa220713e, 0xa81a7b31, 0x4219c57d, 0x8fc09a97,
+    0x1d10b9b3, 0x62c650db, 0x21df284a, 0xff6439fa, 0x95af2513, 0xdacd4fc6, 0x6753eeae, 0xc771f199, 0xb4e94cf3,
+    0x2cd27d22, 0xc52e1263, 0xc77f0143, 0xc7e60791, 0x8a82898c, 0x4dc90ec5, 0x57b0f683, 0xf9110154, 0x2fb3b666,
+    0xd72108db, 0xa0631544, 0x912e59ad, 0x15bfefc6, 0x4e924cdc, 0x83eca698, 0x012081a8, 0x3b38df20, 0x9339c4fd,
+    0x411c0b87, 0xbf060ff8, 0xffbbfd24, 0xae88a871, 0x4576dad0, 0xc2e070df, 0x450bb228, 0x4b01b46c, 0x1978f9e4,
+    0xef6e6c59, 0x5aace7a8, 0xac5c23fc, 0x8ca802c3, 0x3e420c08, 0x5c2954b8, 0xc1c3c504, 0xe375bcc9, 0xb83b5151,
+    0x4dfd3f1a, 0x4cae4f70, 0xe7c8e75d, 0xac21bd87, 0xd57d5e72, 0x001d2062, 0xe97814c3, 0xf3e681b9, 0x13bd35d8,
+    0x5fb15537, 0xd207ce15, 0xd38e354e, 0x2daed530, 0x713b5ad1, 0x6ae1c049, 0x627f819f, 0x8b551a52, 0xfd107290,
+    0x690a551b, 0x11946e26, 0x681692af, 0x7f2a1220, 0x905a5b72, 0xef1cf8fe, 0x58b0dfe1, 0x2e3912d5, 0x82b0a177,
+    0xbd681d7b, 0xd8236b25, 0x74b79b7f, 0x927f24c2, 0x3ab2f75a, 0x1b90eec0, 0x387cdd2b, 0x13ad03aa, 0xa709a9c9,
+    0x937fc129, 0x439242ed, 0x5ac8997f, 0xd8d73d08, 0xdf29c0a5, 0xd4b25b6a, 0x6322219a, 0xa7c5e902, 0x1e1e5a4f,
+    0xabd9f1b3, 0xf29e1031, 0xd7518c13, 0xcd372046, 0xd0777306, 0x3515dfc2, 0xcdcc9a24, 0x3828496c, 0x2995839b,
+    0xb459d25e, 0x5adf6e5a, 0xeffea06f, 0xd092f8ae, 0xc47cd05a, 0x6c0bddce, 0xe6686c98, 0xdd4aed5b, 0xc8df9f88,
+    0xa09c088b, 0x54f3805b, 0xb30126b2, 0xc39c6502, 0x2da24472, 0x1be19b27, 0xb00a2616, 0x5a6a9ace, 0xd003002f,
+    0x88b71c6b, 0xe09147d6, 0x8ccfbaa7, 0x1d019664, 0x24e8126e, 0x4a69d5e3, 0x3681956f, 0x709654c3, 0x17c8fe87,
+    0x03a251a0, 0x9873aa4c, 0xe0627cad, 0xe2460f20, 0x42d4c987, 0x17b23efe, 0x9ad3fa17, 0x709e64e8, 0xbef8e5ef,
+    0xe5f09ab6, 0x2d63bc12, 0xd8b4cee5, 0xecbf073d, 0xe038c0de, 0xac490405, 0xd8b5003b, 0xd761b25f, 0xd46a0bda,
+    0xf5f9c977, 0xb8134077, 0xd0df6e15, 0xf9e9b4c0, 0x028f0c9c, 0xec00b4a8, 0x1c762592, 0xaa55c4b6, 0x8e8bccf4,
+    0xef19668a, 0x36ccbdef, 0x4cf9a8ed, 0x4179d3bd, 0xe5f74f40, 0x28a1e9a0, 0xcf2a93a9, 0x4320214f, 0xf80cc02d,
+    0x9342158c, 0x2c54f538, 0xfe493163, 0x631a0eac, 0x04d03ded, 0x21ff6c9a, 0x89e53bfb, 0xbb2bed13, 0xba1e20e1,
+    0x11d1ead2, 0x69a274fd, 0x4d89bc7d, 0x4dafaa7f, 0xe216e399, 0x7a5fa7c7, 0x98cce4ae, 0x4fefc306, 0x1322bd51,
+    0x839ac49e, 0xf2f0e7f5, 0x9d29f8e6, 0x59e07c4a, 0x70eae979, 0xe486e851, 0xc5b5cc73, 0x0d0d479d, 0xf1be3804,
+    0x331224d5, 0xc8b59e07, 0xa477d49a, 0x41106c65, 0xbba03284, 0x914c4377, 0xafad450e, 0xd96daeb8, 0xf19b0863,
+    0x9feb6669, 0xff4a671d, 0xefe5fe74, 0x937ff5bf, 0xc5607f2a, 0xa82f3434, 0x1151883a, 0xb7a38a4e, 0xbee06339,
+    0xc781f9fe, 0xdc1bf12c, 0xed16225b, 0xa24ed0ab, 0xb6d61e61, 0x8ffe636e, 0x387e3d0e, 0x6a8540a0, 0x383fc618,
+    0x6ff4b03a, 0x89f4c620, 0xb886960e, 0xec85fd5a, 0x531e1923, 0x1083507d, 0x4d0d493e, 0x6d277128, 0xc2c3136c,
+    0xbdf0aecd, 0xb9564c12, 0xd343900a, 0x688fe661, 0xd05b1e6f, 0x155ba267, 0xfb0466ed, 0x2026d2d7, 0x5e343ce1,
+    0x7ed59994, 0x6ccb88f1, 0x663707b3, 0x036b11db, 0x4b0b0f47, 0xea06fbe6, 0xc1346622, 0x6a135347, 0x62ec331d,
+    0x2e2fc544, 0xcf8d92f9, 0xf1fe3939, 0x49b62fa7, 0x9d9140b6, 0x5544cef9, 0xc35c6584, 0xf9fd8a10, 0xddeca3f7,
+    0x5764c70b, 0x0306a48e, 0xe3cacc50, 0x445edfa5, 0x59a574e1, 0xd9b005a2, 0x91d5e91d, 0xcaea41e2, 0xcc4444d9,
+    0x7a7303f7, 0x82307b51, 0xd6ad83cf, 0x62af50eb, 0x96af6449, 0xcc0df0d9, 0x2596b39d, 0x26cba6a2, 0x22e27301,
+    0x450c2560, 0x487d5747, 0x0d5affde, 0xcd0eebfb, 0x97e69044, 0x502844b7, 0x946b40e0, 0x65e28825, 0x0b0fae40,
+    0xe4615054, 0x66749ed5, 0xa580a749, 0xbc6ae613, 0x2069d26a, 0x8191cd29, 0xed964b83, 0x9029bb34, 0xee4f170d,
+    0x5520faa8, 0x98ad318d, 0x723c6a05, 0xb8db5ae3, 0x46186d81, 0x1764f1b0, 0xb114c7f1, 0x11a436e6, 0x4991bdf1,
+    0xaba5f2ca, 0x4c0aada6, 0x7c166009, 0x516d55b9, 0x27967628, 0xa63e9e1e, 0x91912ea1, 0x17b0ac68, 0x907f6ebd,
+    0x5f3c6a54, 0x79df5a3a, 0x11054127, 0x903960e1, 0xfc94ef4b, 0xcf3e3404, 0xd5ddf20e, 0xdb5b2827, 0x4673c7c8,
+    0x8550252f, 0x0b053525, 0xc553323a, 0xab62767d, 0x690db6d7, 0xfc53ff48, 0xbd10c599, 0xcdbab953, 0xa3e480e9,
+    0x1266f7d1, 0x358cb5ee, 0x4e004756, 0x66222de1, 0xf2ac12d2, 0xc6be3807, 0xb5c412cd, 0x254bc8fa, 0xe66a7955,
+    0xeecd2e0f, 0x061662c8, 0x4ce67162, 0x8b314a77, 0x096b30e2, 0xd3f8428b, 0x83292f12, 0xab8ad4fc, 0x2a6d46fb,
+    0x5ca8aaeb, 0xfbb43273, 0x7b0abbcf, 0xc26007f4, 0x93983296, 0x492852a3, 0x167660ff, 0xa0b39b39, 0xa7551aa8,
+    0x907704f8, 0xbe4a728b, 0x4dc92f44, 0x4b4dfc97, 0xd1ab4e7a, 0xe51960c1, 0xee09c84e, 0xf5e4233d, 0xf3946a62,
+    0xb751518d, 0x6a9b77ec, 0xd09f31b1, 0x520ce104, 0x66b49a18, 0x148020c4, 0x49f764ec, 0x2c1f5e43, 0x063889dd,
+    0xd7244f75, 0x7778df76, 0xe6ca3154, 0x96eb9962, 0xd2a9d5f8, 0xc612b604, 0xfbe176ad, 0x829d5ed5, 0x9705170e,
+    0x9421fe6b, 0x963c265f, 0x3cebb0b3, 0x1493b29c, 0x23666dc5, 0x3dec8b2b, 0xc075d851, 0x393f76cb, 0x6e513608,
+    0xc4fb785f, 0x46f9f2c6, 0x82f84631, 0xaa83309a, 0x01ffdecd, 0x8584dddc, 0xd0be2151, 0xb2f977a1, 0x0e68bb9b,
+    0x72876fa2, 0xaefe475f, 0x352ae319, 0xd4c27516, 0x98188a6a, 0xfbce9a9b, 0xfa252a51, 0xf0ff4dd3, 0xd033207e,
+    0x997dc54e, 0x8b698872, 0x3a1c62ae, 0xb48dcdfb, 0xc06921b4, 0x73abb7af, 0x4e98a651, 0xdd313f75, 0xa3a2d6ee,
+    0x412903b7, 0xfd5e9e2e, 0xcb9dc92d, 0x59df272e, 0xc44ceb55, 0x6feec807, 0x5a97af29, 0xa11319f9, 0xfc2922a0,
+    0x7d6d0662, 0x5ed8434c, 0x3903d708, 0xcd77a8ed, 0x4109dce5, 0xe8154f51, 0xc618745d, 0xccf34810, 0x73ddc671,
+    0xc00c9277, 0x6ffa21b9, 0x2e87e96b, 0x5308f686, 0x33f55661, 0x7f490d85, 0x39e149f2, 0x5fe6069d, 0xddba494a,
+    0x0dda5c47, 0x012cbba4, 0xb7b17293, 0x0194a52e, 0x07a05831, 0xd36917a4, 0x621ec732, 0xdb4a8d91, 0xd4bb1c18,
+    0xb6e57e35, 0x0c82c2a5, 0x9ad4ea09, 0x647c0ae0, 0x2f6548d5, 0x66064edc, 0x4997184c, 0x0bf2982a, 0x1d83bff3,
+    0x929da04b, 0xcca2d77d, 0xe8878d13, 0x37471db7, 0x70676225, 0x3ac2257e, 0x8ee8bc16, 0x55277e28, 0x8bdc9044,
+    0xed064850, 0xe0557111, 0xd2c5aa97, 0x43ea7ade, 0xdb9463ba, 0x2a1a4369, 0x5bd23f9e, 0xda9d42e7, 0xd7daf882,
+    0x1445c0a2, 0x43679c4d, 0xb6b78623, 0x13c87361, 0xfd3258af, 0xbd7f6d81, 0xb979db50, 0x4ca8138a, 0x66468052,
+    0x2a0c8ed4, 0xa7dbcee4, 0xc3724d5c, 0x438fb2db, 0x60cc99e3, 0xea3991c6, 0x8ea6f2d4, 0x0fa93ec7, 0xaf121fa6,
+    0x75232c2a, 0x458a7db0, 0x0c55ceeb, 0x8e4416fb, 0x7038b95e, 0xae6e9dca, 0x0eede105, 0x0753934b, 0xe4664a39,
+    0x50b4f35e, 0x9ce40e55, 0xfdcfced6, 0xde2a4336, 0x3d0dd923, 0x869fa502, 0xe8594b1f, 0x29484c3b, 0x524c5f09,
+    0xbcc5dc83, 0xbf7c5332, 0x93730581, 0xf0d0c2ef, 0x0fa90930, 0xa5d8386a, 0x21286fde, 0x9b81884d, 0xe5c559fa,
+    0x570900f8, 0xf5795ea3, 0x221883df, 0x13f748c3, 0x7f89c8f1, 0x427835b7, 0xc398bb85, 0xfcfd6ec0, 0x85fb165a,
+    0xe7fd4a55, 0x077e58df, 0x701ec253, 0xf4243c18, 0x11ea6f06, 0x87a07da5, 0xa966e144, 0x11d000d0, 0x1f65c02f,
+    0xb9a39cde, 0xa0d17b65, 0xe1e20f99, 0xcb4af865, 0xeab882e1, 0x37e0e09a, 0x498c560c, 0xd91cb956, 0x3f7cf301,
+    0x0b1f4162, 0xe0f10d67, 0xd71f4b9e, 0x2d4d83f8, 0x0707c143, 0x70fc0427, 0x3e9be491, 0x4626d75f, 0x32b05fc4,
+    0x2b0f07dc, 0x28617d05, 0xa02fd805, 0xe6a8c2c2, 0xeb311923, 0x1c3ed3af, 0x9c72d604, 0xee310d7a, 0xc2b7d08a,
+    0x3a011755, 0x22c96fe9, 0xfa79e817, 0x05848bff, 0x578d81bb, 0x340fd327, 0xb91a0d96, 0x653c2d55, 0x7d197415,
+    0xd348c8bd, 0x3a04ba5f, 0x6def4970, 0x63997938, 0x36a5a495, 0x5900132a, 0xb6104712, 0xdee0d353, 0x56e89c25,
+    0x093dde65, 0xf25a9e85, 0x9af5c7e3, 0x78fbab94, 0x386bcd7f, 0xf4dcd735, 0x38a2e0d3, 0x6173a817, 0xc021116e,
+    0x198b5b11, 0x3fd05d4f, 0xb6329737, 0x8716f8c7, 0xa6abfe48, 0x5de1989c, 0xec1224a0, 0xf752f350, 0x25524480,
+    0x9bfd3289, 0x82a8a26f, 0x55e98dc4, 0xb7c4b37c, 0x0ef48e9a, 0x5c3d22f6, 0x2d0e1df0, 0x1ec4f8ec, 0x76130f13,
+    0x791df044, 0x89f632eb, 0x7273e005, 0xe9478e2d, 0x4a0e380a, 0xd90bbe64, 0xf088d2aa, 0xdca04b32, 0xe2864a21,
+    0xfd06330f, 0x0781ed16, 0xc0fc5c24, 0x8269f72f, 0x6c2284ce, 0xc992d46f, 0xe9311641, 0xd0865e00, 0x9c0513ea,
+    0xbe7ec6c3, 0xcdb237d3, 0x36d45606, 0x40f0049d, 0x8edfa0d9, 0xbc0c83b0, 0x34eeb6e5, 0xb0c0daf3, 0xf02f62e6,
+    0x6483bd1e, 0xae6d2d39, 0x0edf168c, 0x25391b8c, 0xe39549f4, 0x77622057, 0xa549218b, 0x055ed8c6, 0x287b0f84,
+    0x33686f58, 0x398fcc15, 0x11733136, 0x453f6df8, 0x91795897, 0xd0531507, 0x3f727605, 0x6f973acd, 0xa91d1e60,
+    0x2ac9ee50, 0xf19b8c35, 0x292c51a1, 0x40118f25, 0x3464dbcc, 0x532d6d16, 0xb1785d39, 0x0f9a2dfb, 0x4cbd8a80,
+    0x17e46ee0, 0x8ce56621, 0xd412ba3d, 0x97a90e50, 0x63c41cf1, 0x35a4352a, 0xb26b8af8, 0x911f069d, 0x6f7f7c94,
+    0x3f30ab58, 0x5906449b, 0x04842937, 0xf2a3798a, 0x5b935a06, 0x6ee42bec, 0xe0fbf99a, 0xe9455b12, 0xba6695c6,
+    0xf6e86d39, 0x3b672508, 0x8e68c597, 0xd66b45ad, 0xdb885311, 0x4b47b114, 0x60b18f92, 0x4f04503c, 0x90f3b105,
+    0xbbfa7557, 0x06d4b717, 0x97473122, 0xf8d2c3e6, 0x828a9552, 0x4841ddb5, 0x7dc06c46, 0x31660abf, 0xe7ef66fe,
+    0x6d66269c, 0x9f336c67, 0x4f47e94f, 0x5e95dc1b, 0x75261aa7, 0xbe4c8f5a, 0xdaa2dbeb, 0x6fa2b0a1, 0xbee38e25,
+    0xd50eaf7b, 0x84806734, 0x35c64719, 0x581c1270, 0xfa0c40a6, 0x026e593e, 0x2c03ad57, 0xdf603615, 0xe3b029a3,
+    0xadb6371d, 0xd28f22fe, 0x7d77e288, 0x18f170ef, 0xdcbfdd0d, 0xfb1f4c3e, 0xd28a3385, 0x8bcbffca, 0x00c16fc7,
+    0xe8b3e1fc, 0x967716f4, 0xa9e1f954, 0xb2196d2a, 0x5be03b34, 0x863d9bca, 0x62136c2f, 0xde10839a, 0x066d9403,
+    0xd50be6dc, 0xe00d9a42, 0x00f20c9a, 0xb17e10b0, 0xeae9a34a, 0x96fe2588, 0xa84899d5, 0x0398e666, 0xe933dcf8,
+    0x9177942e, 0xd47fbc27, 0x8e0960f4, 0x9f09de9f, 0xb1d07985, 0x9a163a46, 0x5675a9b1, 0x070863cd, 0x6b61fae2,
+    0xa6cacc4c, 0xe5ef4b13, 0x072fabfd, 0x3934fad8, 0x8ad1e630, 0x191f2c4e, 0x63c01c93, 0xe1a4e4ee, 0xa48e1028,
+    0xd58ae364, 0x035ed28e, 0x85664aa4, 0x468effe9, 0xc377f5fb, 0x3d4fc469, 0x404b7db9, 0x6e16e28c, 0x87dc6936,
+    0x62b642e3, 0xc38e917f, 0x742b100a, 0x1662f9bf, 0x9927e149, 0x5961667b, 0x15273007, 0x2fa2057c, 0xf04434fc,
+    0x8a8553ec, 0xee3dc850, 0x4c808ad1, 0x50ff7bd3, 0x0537ab8c, 0x76a161fa, 0xf1e6fe0c, 0xc6acfad5, 0x5183e620,
+    0x61b86531, 0xeeef4273, 0x3d7f45d3, 0xab462d8b, 0x6fa97983, 0x61d4bff9, 0x8ae2cadd, 0x3fabd882, 0xf727be28,
+    0x4ca05a63, 0x5a89633a, 0xd1b95f6b, 0x8500be1a, 0x41959746, 0x8d305874, 0x775a9120, 0x3485549c, 0xa398ed43,
+    0x404402fb, 0x1d1dc3a3, 0xe13c9cd7, 0xf44d19bb, 0x8fccd029, 0xbfdc5116, 0xd1fc84bc, 0xccd0b5f1, 0x327c0f41,
+    0x15a4b26c, 0x994c509a, 0x1ffcc2cf, 0x3d3f863f, 0x4bdb6fb9, 0x0595dd0c, 0x785a2102, 0x5c2c3032, 0x0006ecae,
+    0x5ab13026, 0x93877b91, 0xfb8c0d62, 0x2a98258a, 0xd19cc6e9, 0xdc00477f, 0x0011d0ba, 0x4d4b83e4, 0x8691a12b,
+    0x7be9139f, 0x1ba1f2ee, 0x1cd7a751, 0x6e8f7a3d, 0x4c65986b, 0xdecf38f8, 0x34a53191, 0xda30ff45, 0xe0b1c635,
+    0x595c2d07, 0x68932da2, 0xc544228b, 0x000e0685, 0x1562d1de, 0x7cb5572b, 0x5d011c05, 0xcce12d5b, 0x80eb2f24,
+    0x4341592b, 0x6b25d162, 0x15885f62, 0xb649cb6b, 0x3558c234, 0x010b902e, 0x0b0a27cd, 0x3c1917a7, 0x6b4dc3e8,
+    0xef0b3433, 0x4d1b06fe, 0x00c298e8, 0xd259640b, 0xea58891d, 0xaafcecc3, 0x5e9363c3, 0x50eec055, 0x9dbcdfda,
+    0xfdc692de, 0x0ac68aa1, 0x57357245, 0x55e4e877, 0xdf38fa2e, 0x9922f0e2, 0xe5690a27, 0xa15fc2be, 0x19e79f4d,
+    0xbe66f404, 0x08eb94a6, 0x33e23326, 0x5ffb9a61, 0x6654caf7, 0xa2cfee3c, 0x2e5bc30d, 0x49494e15, 0x94f3fba9,
+    0xd4e530d5, 0x8e3bda79, 0x4d284071, 0x0f6960e3, 0x4aa01923, 0x4cfc76a2, 0xadc3b52e, 0xe4fe6b49, 0x0f164aff,
+    0x39aa5a4b, 0xffa5d822, 0x557c63f3, 0x1d77ba54, 0xa1dbe4fc, 0xe1eaad6f, 0x2dbe11d6, 0x84d0bc17, 0x3e5a6e84,
+    0x0c3ce7ad, 0x0e69008e, 0x89e7c892, 0xb559782d, 0x790d36e7, 0xeece1626, 0xa9c4fe8f, 0xacdee5b0, 0xa7a706c7,
+    0xacb8ebab, 0x07dfa5c6, 0x4218a893, 0x36dfbd07, 0x2c181ca4, 0x935ef0e1, 0x73f486ac, 0xcccfd1b5, 0x48996f94,
+    0x672cadd5, 0x2588c0d9, 0x89400d17, 0xd2020189, 0xfc65714f, 0x0991296a, 0xbe176c8d, 0xce706e4d, 0x67afab49,
+    0xd3b12cad, 0xac835ec0, 0x6e33595e, 0xceb01d66, 0xdde7fe58, 0x793b8fb2, 0x9f807593, 0xf904c941, 0x2b08c61b,
+    0xe5ba7ad0, 0xb5a1b5ef, 0xbf7dce3d, 0xea949b7b, 0xdfc31347, 0x986f1339, 0xd2df488c, 0xfbcadc8e, 0x162ee2ae,
+    0xa15b13c7, 0x158fe394, 0xd7c66a8d, 0xa732f2a7, 0x5d883ac3, 0x2e94ff9f, 0xf507ab5a, 0xd7698b0a, 0x4adb5897,
+    0xa52e708c, 0xe47b3600, 0x4c7664ab, 0xa64a6f39, 0x1444effa, 0xd5930b6f, 0x0795bcaf, 0xef593a2a, 0x9c22c229,
+    0xf133205d, 0x41bf1524, 0xa8e79838, 0xadd25cad, 0xb0b97b30, 0x2bdc096c, 0x77afd496, 0x80050c2a, 0xfead2878,
+    0x4df22cf6, 0xea291154, 0xb0ed8dac, 0x5ef21ab2, 0x95aa23eb, 0xb09d3bb7, 0xcd0c0cb1, 0xb44583fe, 0x25363d11,
+    0xd9a3e543, 0xb2081e22, 0xf5c06cac, 0x43ca66c6, 0xae0874a6, 0xca5e068f, 0xd7b9281d, 0xa1036b56, 0x1a7a03e9,
+    0x40af50e6, 0x54eb5222, 0xfca74d8e, 0x4f694414, 0xeb95ed0b, 0xff64354c, 0x5458e2f2, 0x4226a164, 0xc87dee64,
+    0xd2992946, 0x45908324, 0xdf5721e9, 0xab008334, 0x4e17ba79, 0xd9db2dd0, 0xb8911ab4, 0xa8de2889, 0x5fac4628,
+    0xf566d859, 0x22ac8cc0, 0x8f6ac358, 0x10f3dd72, 0xd0356986, 0x7758db6e, 0xa68e795f, 0x7f4e8afd, 0x37b75ba2,
+    0x4312b60a, 0xaf4d37fd, 0x160eb142, 0x0cf80dc6, 0xa1ff3296, 0xcdbead46, 0xab12260c, 0x1b936beb, 0x3515f28d,
+    0x289fd317, 0xbcae88b9, 0x52231948, 0xcb72003c, 0x21adc47f, 0x352a89cc, 0xe7e7179a, 0x42ffa3cf, 0x778ea4d1,
+    0xcca97a5d, 0x2b62950f, 0x65222015, 0xa2342e76, 0x2a4df1e7, 0x1208c246, 0xe1fb2002, 0x19e30382, 0x2f34608d,
+    0xdbebea7a, 0x841ddd63, 0xdb943373, 0x0ee7a0db, 0x67999b46, 0x53bb6e43, 0x92520bdf, 0x892d4dd9, 0x04708ba8,
+    0xf3a08015, 0x5c33431a, 0x05d8abfc, 0xf4a2ec64, 0xd3858925, 0x96e09f66, 0x7e75c2ef, 0x456c353a, 0xea6da87b,
+    0x666c004d, 0xcd88c3bc, 0x3b9eb6b6, 0xa96f01ba, 0x6f33b572, 0xc7f61994, 0xa17a219c, 0x5d0070ff, 0x37d02937,
+    0x8555932e, 0xa659caaa, 0x1b4240e1, 0xcc18b7ec, 0xe919f097, 0xfd26f7ae, 0x6797049c, 0x815b0243, 0xb5052661,
+    0xc0e78443, 0x305db9cf, 0x16aa04dc, 0x47bc1640, 0x7240c33d, 0x77fa8ba7, 0x0c46db31, 0x1a0272d8, 0x76177c35,
+    0x57a34999, 0x2b5ac606, 0x3953bd13, 0xc0cb1a1b, 0x762d43d9, 0xc609cdcb, 0xd47ef2ae, 0xc7e77db0, 0x855e216b,
+    0x4aac8d0f, 0x3f63eea9, 0x01530230, 0x90110cb7, 0x02519ab8, 0xdf7ae568, 0xadb427f8, 0xd86cb22a, 0x8d9d9573,
+    0xb6f9c094, 0xef23c4fc, 0x9a119aa5, 0x9a8495ed, 0xbd3355e2, 0x4b89e820, 0x14c7e3e4, 0x79c4b839, 0x4f6d07b1,
+    0x34f866d2, 0x21cebc98, 0x07ea27ae, 0xb45ef579, 0x57f6b36a, 0x6524bd77, 0xf968cea2, 0x7a4ad6b6, 0x26e964f4,
+    0x2de4de17, 0xc8ed3f75, 0xb843c8e6, 0x5fe7903e, 0x411b9625, 0xc3374c1f, 0x0915c7ad, 0x96f7e130, 0x73c25ddd,
+    0x8cfe3d2d, 0x8df4c90d, 0xeec49057, 0x054db53b, 0xd520c377, 0x0a9c5a6b, 0x18020344, 0x6fd47f1c, 0x76088114,
+    0x2c6b7690, 0x18bff942, 0x0cb3ffce, 0x0a8e2d12, 0x9dcf3239, 0x5ddcccd9, 0x148383b9, 0xc09cdb27, 0x67cd0f73,
+    0x6266f7e0, 0x02edda9b, 0x6546be59, 0x1ff17708, 0x517b6cbf, 0x372c7fbc, 0xb656a065, 0xd36ae16b, 0x84c4cfc5,
+    0xba63e200, 0xa5d18699, 0x71439c78, 0x64a1fefc, 0x10927b67, 0xb2eada79, 0xd02bedbd, 0x3d706472, 0xaaa3ae44,
+    0x2ac159cd, 0x622076ff, 0xc7394b3a, 0xc8b33244, 0x660bf529, 0xa729a80a, 0xbc10c091, 0xaadc9d4f, 0x2a3978f9,
+    0x31602d0e, 0x139c40e6, 0x4543a0a5, 0x6d23bd99, 0x8d46ae4c, 0x5e1d9a86, 0xf0a346d4, 0xa355b780, 0xdc1cb1f5,
+    0xbbae7af2, 0xd86e2561, 0x731f3913, 0xb06dc264, 0x9eaba121, 0x44613bd8, 0x707aa7ee, 0x10945d29, 0x043475f2,
+    0x03d2f634, 0xf6a78b50, 0x3678cdf5, 0x741ba537, 0x49379ade, 0x39632e23, 0x61a2b92b, 0xb2188759, 0x1d1da2c5,
+    0x7592441c, 0x85d99ef8, 0x1a8a9c63, 0x2d5cbcdf, 0x9d482008, 0x3d4fc1ed, 0x2933cd00, 0xa07c30f6, 0x5977033a,
+    0xa309742d, 0x1e91b534, 0xe4b7c02d, 0x679aee76, 0x1c22f714, 0x80a47e5d, 0x8b4077f4, 0xbff20f18, 0x5de71fec,
+    0xf443b638, 0x8fce79b2, 0x7d4e7fc8, 0x3f973c1d, 0x9b85508c, 0x18b9642d, 0x022b5620, 0x7f96c97d, 0x52acaf7a,
+    0xcc83bc59, 0xe51fae7b, 0x5088fe29, 0x9f693330, 0xbcb7664c, 0x8b12ca5b, 0xda0d26bf, 0x3cfd2dfd, 0x3799d847,
+    0xa7c6f997, 0x7126b565, 0xaf349f7e, 0x7e6710d2, 0x2877ff78, 0x8238e8e1, 0xc2762ed4, 0x83388e90, 0x57bab791,
+    0x619e266f, 0x7b85ba1e, 0x6af78b61, 0xa3f612cb, 0x0407d507, 0x6a9c03df, 0x9ed68f08, 0xe9e5f494, 0xe535d7f3,
+    0xd6c365c1, 0x7aa2319c, 0xe0f84e48, 0x638defde, 0xd27bb5ee, 0x9c6920bd, 0x9fcbb209, 0x0f4f51db, 0x0527eab9,
+    0x99c76403, 0x01fe41c5, 0x143b46fa, 0x0601cb30, 0x97763264, 0x8ce5069f, 0xbe67841f, 0xf314b69d, 0xc8b01011,
+    0xab818006, 0x93292943, 0x26acee89, 0x01b6ccd7, 0x8944fb81, 0x102f5efd, 0xcc51ac3a, 0x8981dec9, 0x5dd42e7c,
+    0x943d87c4, 0x916a9bb2, 0x465e346b, 0xf65d31dd, 0xed6286ea, 0xeaf34c1d, 0x3228f9e4, 0x8f8b71c1, 0xea22628c,
+    0x8c8775c9, 0x8dcee7c5, 0xff581b2a, 0xb48cf92e, 0x089e0409, 0x587a9871, 0xcb208b89, 0x7e35e28f, 0x178e4f2e,
+    0x060d5780, 0xf5fd06a2, 0xcd7c2f7d, 0x7cf2643d, 0x9fc58aed, 0xafa47e04, 0x82be19bc, 0x885a8325, 0x4ece7f78,
+    0x4b8c1ab4, 0x6d654cc3, 0x78b43d47, 0x30e46c43, 0x2fa495de, 0xb9c54716, 0x15224658, 0x0e1861b1, 0x41c58683,
+    0x28bce598, 0x0d5124a9, 0xa897b5b6, 0x674c2a7c, 0x5c33db68, 0x9b78423e, 0x053091c9, 0xf248fe65, 0x0d7f9203,
+    0xaae9f7e3, 0x216b843b, 0x5450ae53, 0x09fac3e0, 0xee610823, 0x9068d870, 0x0e8dd42e, 0x260a6854, 0xd8a1ea3d,
+    0xb645869e, 0x875d3322, 0x8ec2bd72, 0xa4655a68, 0x9a7c6b03, 0xa9be5f2b, 0x9e49fe8a, 0xe50adcaf, 0x68db6837,
+    0x7a5c998d, 0x9f513a38, 0xc07015a1, 0x78d5dd26, 0x3d096b3b, 0x19b6f425, 0x72e597f8, 0x2bd92f82, 0xcbad2aa3,
+    0x0de3c50f, 0x1244a410, 0x49d1d070, 0xd4026035, 0x1d6a812b, 0x396ec04e, 0x6f26fca8, 0x6e686178, 0xe254cfae,
+    0xede1a6cc, 0x91980aae, 0x2f665c2f, 0xad137ae0, 0xf0b54d3a, 0x0f1645d9, 0x3c544ee5, 0x18c8cebe, 0x8f9c678c,
+    0x932628b0, 0xdf8adf6c, 0x3a2a7ad0, 0x5c6bb34b, 0x48d88380, 0x2247e788, 0x1dc773fe, 0x0e76125c, 0x0bdd06f2,
+    0x93a15a16, 0xf8417c47, 0xb0fcda2b, 0x00d98b30, 0x1b2bdfd5, 0xf023d233, 0x639f4a89, 0xfbfffe33, 0x8e404644,
+    0x0b30ff81, 0xd476558a, 0xe955be7a, 0x0a460674, 0xc0a4c175, 0x7fe34706, 0x51bb7e8c, 0x4649795c, 0xc3927f5b,
+    0x1fa11730, 0xb8651423, 0x35db61a3, 0x5102d83b, 0x478d9029, 0x1e4a5d6b, 0xdd11bed0, 0x5143b24d, 0x906ff158,
+    0x5470f017, 0xf5358ef2, 0x214f6ef6, 0x5de31da2, 0xcdd8d516, 0x49201dfe, 0x610dbfca, 0xf3a386a4, 0x0a5a009c,
+    0x93ea677a, 0x9b21da7d, 0x1e13384a, 0x7f403e00, 0x953ef10d, 0x82b8e580, 0x317c887c, 0x08c89c46, 0x1e66f756,
+    0xecf4ff10, 0x2d86c7c7, 0x083bd7b4, 0x299b56e5, 0x60c105e4, 0x041f9315, 0xd4583465, 0xfecc52f2, 0x24d97183,
+    0x844a009b, 0x607272cb, 0x8f67b9be, 0x5b6c23ec, 0x979ea5ab, 0xa21019ba, 0xaa06fb34, 0xfb49201c, 0xb3f20d36,
+    0xe433fa30, 0x81e1f631, 0x9144e1c0, 0xd807a7a5, 0x3fe4f4e6, 0xf4f9a13e, 0x1632c6d2, 0xa8a3c21c, 0x03e85105,
+    0x6c49b16f, 0xfdd51b62, 0xab5c7756, 0x4432783d, 0xa666d703, 0xe4b29d5c, 0x58ac29fc, 0x1c2c3c60, 0x1fa16c3f,
+    0xa9ca44ee, 0x8f1f7778, 0xe17eb991, 0x222a0a2e, 0x11e7d6be, 0xfc21bf50, 0xc536474e, 0x20dd4426, 0xc75b7e65,
+    0x7b40df1c, 0xc35a30fb, 0x0fd4fac6, 0x07dc37d8, 0xe4c49f63, 0xebc2ea88, 0xd96015b6, 0xdc337f73, 0x3de3347a,
+    0x9fa91d0b, 0xb4a56f7e, 0x5577c533, 0xf4cca073, 0x3c84360d, 0x7e2eb264, 0x3c35b312, 0xd04f8b6a, 0xfdb70caf,
+    0xd3916e8a, 0xc8ef2803, 0x3f2a8dcb, 0xb701b7e6, 0x284273fa, 0x7e3ae3f8, 0xc358cc7e, 0x14b1992e, 0x8bfe7c44,
+    0x29b30a4a, 0x1736fcd2, 0x9628de7a, 0x3549cbd5, 0x8bbc471d, 0x31f1a9a2, 0x1bdaed61, 0xe764f9cb, 0xed0ef6cf,
+    0x39a86ab1, 0x875f7487, 0x4e37dffb, 0xe93af5fa, 0x241f741b, 0x6092fef8, 0x5f03b23d, 0xad3ee9e5, 0xdf4df07c,
+    0xe4d05d8d, 0x30c05055, 0xc8d78b94, 0x16cdf95b, 0x44dfa0f2, 0xffd6570e, 0xa75cd62a, 0x14a77cbf, 0x87cbdde9,
+    0x7b5614a2, 0x153a1b57, 0x3b204497, 0x399320c3, 0xddbec89e, 0x8dbc27a4, 0x14e32844, 0x4110af93, 0x2b8a5f49,
+    0x72e11a52, 0x7685aa5a, 0x682bf48b, 0xed81d17f, 0x2c38ddb4, 0xa693415e, 0xb15ff4ab, 0x2f589c3f, 0x8427cdc3,
+    0x68513d7a, 0x728d5e51, 0x3b2a3337, 0x001da644, 0x81a76abf, 0x2a5c7e23, 0x2b6b7c86, 0x0c20c953, 0xe4a6df16,
+    0x95afa25f, 0xd5c77b13, 0xf6b2ddba, 0x0ecd14be, 0x89523c39, 0xb98acac7, 0x83adbaa7, 0xeb535b4a, 0x6c51ddbc,
+    0xcdaa8760, 0x159abe83, 0xaf9157d2, 0x7c3ecb52, 0x2be7d730, 0x5799b9c8, 0x8ca9579b, 0xd9373c8e, 0x44c1c216,
+    0xb925d7a0, 0xa1f93b25, 0xa3efc401, 0xbd517070, 0xa5a73572, 0xcee59507, 0x93e424f9, 0x474a1d7a, 0x03ce5300,
+    0x13499134, 0xbaa52d96, 0xfbc7a63a, 0x12fc59bc, 0x5f4d0655, 0x94cc4649, 0xf71e8298, 0xfbac91fd, 0xa3885dd8,
+    0xfb02c793, 0x7a4b7898, 0xc8a174c9, 0x50fda6bb, 0x49aa9452, 0xd07d554a, 0x2fd1e8f2, 0x6ea506ef, 0xa7a74b77,
+    0x0bfc573a, 0x5ffa61e0, 0x0620f318, 0x549d6128, 0xb9e51607, 0x727b5266, 0xab243fe6, 0x270cd565, 0x9a5a8ab4,
+    0x4b1b849b, 0x6bf221f3, 0xc49cc6e5, 0x7ef35578, 0x471bd82d, 0x47327ba8, 0x41b6b878, 0xb955ae1b, 0x577d483b,
+    0x5b63c9c6, 0x4be71ca0, 0xd3a37e17, 0xae4b4a40, 0xe48bc4af, 0xedfbd6da, 0x71f5362d, 0xb68f61dd, 0x90017cb8,
+    0xb28982a2, 0x884d29e9, 0x554509ad, 0x9b09615a, 0x32f6f803, 0xb4808769, 0xc74e516e, 0x69338e77, 0x81da56d6,
+    0x2fdd5c19, 0xcf743b24, 0xb0bfcc6a, 0xe5f1736d, 0xe4f3cf0a, 0xb4625cf9, 0xda601354, 0x8ba3c246, 0x247c6755,
+    0x966852be, 0xbdb18691, 0x3263e36b, 0x2fe11315, 0x6573d654, 0x26a5f038, 0x12da8da1, 0x9e68648c, 0xe0907db5,
+    0xff1228e0, 0x356601d2, 0x520cb973, 0x6b6addb4, 0x1e0da9be, 0xe5908fed, 0x58a32ce1, 0x48a8cddb, 0x54709a7e,
+    0xa6907f08, 0x089225c7, 0xf3757a37, 0x795c6216, 0xeb896295, 0xa8de0d0d, 0xedc15a96, 0x9f78bfc4, 0x413c0def,
+    0xdcc687e8, 0x53fddf58, 0x667be66b, 0x59826439, 0x4e51d707, 0x4d9070c5, 0x6dcbc65e, 0x7cf5f1b1, 0x63f63cf6,
+    0xc568ace2, 0xcef3d89f, 0xfae66b62, 0xcd12f14f, 0xd2725e1f, 0x7d74f5cd, 0xbaa7b738, 0xcb08bfd5, 0xdbfe15c3,
+    0x0446b937, 0x0da1eba9, 0x29a4537d, 0x6a98df26, 0x234edcc0, 0xb7f4c960, 0x818ff628, 0x590c5971, 0x520313b3,
+    0x45100677, 0x0148fdfe, 0xb8f90800, 0x2b2b6ba2, 0xc66864e6, 0x2aba3c63, 0x9a3c3779, 0x57066ab2, 0xbf49bb35,
+    0x31003a96, 0xea4d4a34, 0xf6c728a7, 0x3ff61242, 0x663566db, 0xc77cfd66, 0x27f0eaa8, 0x3a3c325d, 0xf4995c9b,
+    0xe0089e94, 0xdd38c3b9, 0x204415e0, 0x7ff561a9, 0x30cd7e74, 0x1219676b, 0x33aacc0e, 0xd7a9249f, 0x70e27c76,
+    0xcd4b4195, 0xc6b4abf2, 0xa93a709f, 0x697aa673, 0x88105302, 0xb027ac3c, 0x3d85e86a, 0xd2d0d919, 0x55ee73d6,
+    0xcd22a113, 0x4d1d2324, 0x8fbd4799, 0xdc4a70a5, 0x320d9a97, 0x7dfb2b87, 0x1cdad0a0, 0x49259627, 0x81bcbfd4,
+    0xa4a4435a, 0x9dfa392a, 0x8e23f946, 0xb44c2c42, 0x4ace4894, 0xe7d77109, 0x9e0ec490, 0x890210e9, 0xb7260ec7,
+    0x20b313cd, 0x7cec889a, 0x89bd5ed0, 0xb34509a3, 0xebe7b06b, 0x16326bc1, 0xa5985c6b, 0xe1f48a28, 0xc4c7e9b2,
+    0xbc18d80a, 0xed80f706, 0x77894393, 0x050ffc95, 0x6e74bc02, 0xce9380f0, 0x1010bfc6, 0xbd5c5720, 0x8a559b2e,
+    0x4f3272b4, 0x4867d5cc, 0xc1eae16f, 0xcc269800, 0xa17d7285, 0x06fca37d, 0x37cd9927, 0xbcd79ae9, 0x821b4339,
+    0x9ebc1a34, 0x2b14603b, 0x962e612d, 0xab16c5b1, 0x375430e6, 0xd9ba129f, 0x4f9e8d46, 0x3ae0c17f, 0x0aaaf396,
+    0x4d39591b, 0xf5f1ec5b, 0x30816f92, 0x3f0be447, 0x83825f54, 0x9617516e, 0x38d2eef0, 0x5db7798b, 0x884a5435,
+    0x7914732b, 0x9a24bd91, 0x86c2844e, 0x17094f89, 0x21e2ca58, 0x988cbb36, 0x761f8302, 0xd16fb07a, 0x88244253,
+    0x7844a213, 0xaf75afe2, 0xb9ad24aa, 0xcd6adac6, 0xe6ae69bd, 0xf592c52a, 0x8d532e74, 0x938707e7, 0x63709780,
+    0x6fcd287f, 0x5ef0d3ec, 0x20c654a9, 0x33de7cb0, 0x838a2300, 0x04f21087, 0x786248e9, 0xbf55753a, 0xed434bb3,
+    0x5cbad327, 0xf30747fe, 0x1b8d7818, 0xdf6bbae7, 0xe5c136e8, 0xf1a2009c, 0xc751c9c0, 0x0e0cb8da, 0x1bdfe226,
+    0xb58937ec, 0x7e8a4415, 0x191f42fb, 0x0f103fbe, 0x53f54188, 0x9988284f, 0xd4105310, 0x6a18b299, 0x0b147084,
+    0x5dcdbc06, 0x9bbf7d27, 0xbecaa9e3, 0x078e66e1, 0xc260274e, 0x8b659cb3, 0xccc867e5, 0x38439b74, 0x8263803b,
+    0x24f7be9a, 0xdca7d25c, 0x6cc0ee5d, 0x08970167, 0x8f308b2f, 0x881c7043, 0x103ca45e, 0x68911465, 0x4ed1fb73,
+    0xce1f1025, 0x10b413b7, 0x4bfaa7e7, 0x2b66c8fa, 0x21ba3bc7, 0xa0e194e3, 0x9390d233, 0xb859409c, 0x969714f3,
+    0x95574920, 0x947115f3, 0xed9df9e4, 0x388849b8, 0x221f847e, 0x682b82cf, 0x44c81e62, 0x714b2ca3, 0xd214d376,
+    0xf19b6f86, 0x9e63bbd3, 0xb5a659bd, 0xf57ce460, 0x63879222, 0x46622d21, 0x3f60327d, 0x7ecafb38, 0xdc5340ec,
+    0xe36ded38, 0xb5c4543f, 0x1c698679, 0xafa33019, 0x539add43, 0xd58335a2, 0x2c05b736, 0xd7066414, 0x17f8bc96,
+    0x305b82f6, 0x0f2885c2, 0x15aa3700, 0x5b466975, 0x6f1c7267, 0xeb23306d, 0x371b000e, 0x7b8ed2bd, 0x9721a75f,
+    0xb3ccdab6, 0xe2df9d43, 0xc3ff63a3, 0xb26a92a4, 0x84eb810a, 0x3b8cc47c, 0x3c6e1808, 0xdf585328, 0xaca197a6,
+    0xabd4d27e, 0xd7d42689, 0x1eb6bfa6, 0xf831348a, 0xf1d91435, 0x13eca895, 0x83ff54f9, 0x93c16c80, 0x7010cd95,
+    0x8f2097e8, 0x3c2e8efa, 0x3714c0de, 0x096e51bf, 0x6adcb0d5, 0xa9248fa2, 0x2c1be903, 0xb29bb451, 0xd4b1ce48,
+    0x23aaa587, 0xac30b763, 0x6b217fd6, 0xce0ca941, 0xdf7e2b4d, 0xbc17cc31, 0xd5db97b7, 0x16931435, 0x026556e5,
+    0x83683251, 0x10ff6ffb, 0xd4e77ebd, 0x4bf32bfa, 0x447d18a0, 0xe0717b22, 0x9130e4ed, 0x5db36e2c, 0x09d62b55,
+    0x7b610cbd, 0x3f8ff7e7, 0x4c6f0da6, 0xa80dca0e, 0x35506221, 0xc69c325b, 0xc867d3e1, 0x1c5697df, 0xc4807800,
+    0x4a291210, 0xc77d2a8e, 0xac6a2b38, 0xfbb7c967, 0xc73e619e, 0x7a99a856, 0x7150a880, 0xa44aa84d, 0x9e8938bd,
+    0x6819a094, 0x5b894fbe, 0x905f271f, 0xddf93177, 0x5191cf1c, 0x5563efc7, 0x0939e1e4, 0xb9c0aae4, 0x4eab1483,
+    0x80d49a12, 0xfbf08662, 0x9b35f54c, 0xe228afe7, 0x3e978b8c, 0xf2d96599, 0xeffe5c16, 0xdd072e8f, 0x57901ea3,
+    0x841c045e, 0x6baa8939, 0xe95183d8, 0x9520d01f, 0x460f9a51, 0x6b4d388f, 0x75375536, 0x674e4590, 0x31c0d699,
+    0xd63cf0ac, 0x408eda70, 0xb8a7dbf5, 0xec8d023b, 0x3dd09955, 0x8356bfa1, 0x0f523406, 0x4c5517e1, 0x86ce8204,
+    0x52cd40a7, 0xe8f7be25, 0xad5960cc, 0x69657c36, 0xdc2638a7, 0x76e1d4e9, 0xf16ad66a, 0x3f50443a, 0x40408702,
+    0x6358e05c, 0xc69d1620, 0x6d5ba3a5, 0xe0cfb3fc, 0x6d334382, 0x774fa4b4, 0x5aaeee0d, 0x92624150, 0xebe1d9fd,
+    0x12cda136, 0x8a79902b, 0xfb892da9, 0x40d7a9e7, 0x0f3760c6, 0x1504db73, 0xd6dfff17, 0x6074093c, 0xeeb30f5f,
+    0x3b4e5f96, 0x4f359846, 0x5b5f77bd, 0x19d43e39, 0xbb363ab7, 0x4c10a35f, 0xd9a1e3b4, 0x6043b017, 0x11ebaf61,
+    0xd28fdcb9, 0xc49cd030, 0x966a5571, 0x703b3224, 0x94d19a0e, 0x3bb09cc3, 0x12a1d9e6, 0xf9ce1571, 0x1bf40c5f,
+    0xf9126fc2, 0x28d71011, 0x43a7bb9f, 0x0e00ea0a, 0xaf30e478, 0xce5c8f39, 0x026b2d94, 0x4cedc987, 0x9a0cb69a,
+    0xacbbf086, 0xc2e80363, 0x5301b02c, 0xe2a72c70, 0xa57ea8d9, 0xd16a927a, 0x79da8d06, 0x940ded27, 0xa62a7cf1,
+    0x865b4b3e, 0x23ca4bb8, 0x5619fe4c, 0x2d544ba9, 0xf30559b9, 0x8f450c9b, 0xc7bbed50, 0x18fa5cf4, 0x460dbcb3,
+    0x031c9d9b, 0x4f36b1ca, 0x1bca6e8c, 0x956b4feb, 0xa43c28c3, 0xd640ac6d, 0x3f537239, 0xd109e829, 0xc3c0977c,
+    0xf9176b55, 0x84a2d49e, 0xa27c92a8, 0x002e06d6, 0xa97af5b5, 0x0860a6a0, 0x6d1bc8fc, 0x85e2c3f9, 0x245322cf,
+    0x8997e898, 0x1b4f3ea5, 0xe0e51c57, 0xe6106649, 0x58e30a30, 0x548f57af, 0x9eb408f1, 0xba150a82, 0x4ddc5326,
+    0x0ad4a4ce, 0x14b22563, 0xa2b7dc79, 0x3d86c8d9, 0x32e2f7ef, 0x37fc1a9a, 0xcddf7612, 0xe8b01eea, 0x4ea3d66f,
+    0x48c3b352, 0x1472b0e2, 0x9fa6cd59, 0x69b5f362, 0x6f62b44e, 0x1d297ccf, 0x95e86045, 0x0aff5437, 0xeb00cbb9,
+    0xda14826b, 0x35276b43, 0x1a9f04a4, 0xb9f328f1, 0x4325f425, 0x36355d33, 0x602c24e0, 0xe4d96ae6, 0xc8722883,
+    0x0ca6343d, 0xf9a81e67, 0x553f8941, 0xf0366e77, 0x0871f05b, 0x6d6d38a7, 0x0b37a12d, 0xd617816f, 0xb2f1bcff,
+    0x231417f4, 0xf7bbdebf, 0x94855131, 0xa4cfe86e, 0xb677f299, 0xc43410cb, 0xc402dfda, 0x05f4624c, 0xdca41864,
+    0xfa8dfb22, 0x556e4ee2, 0x1fa09c66, 0x036000c6, 0x5616dd10, 0x39dab5ae, 0x2ac4e3d0, 0x8792d892, 0x6887f520,
+    0x5b68aa45, 0x4423d3a8, 0x04f80413, 0xa34f1c25, 0xed2f5d56, 0xfe24b289, 0x4283966c, 0x60dc5e36, 0x90c3587c,
+    0x0f394edf, 0xcaa44c5c, 0x30a29546, 0x9a1dfd83, 0x89e6122c, 0xe9631d78, 0x9e92f891, 0x6a759172, 0x628a0e94,
+    0x46b0e925, 0x8c25231b, 0xbd3cf517, 0xfe2c7356, 0xb608c1d4, 0x8e92dc68, 0xc21efe67, 0xcdc526b7, 0xc208cf30,
+    0xe9615779, 0xb0ddcd33, 0x453b438f, 0xe75bf625, 0x14814a1f, 0xfb0a8fd6, 0x19829265, 0xf57e2d0f, 0x465c88a7,
+    0x5170ea9e, 0xce09fa81, 0x519177f4, 0x76c30037, 0x8de79ee2, 0x47f4d79c, 0x4d5e85f4, 0xb392a71d, 0x3b6599f4,
+    0x7a7f0e60, 0xc89d6832, 0x6bef73e0, 0x0757456e, 0xbdae1180, 0x47717e4c, 0x966a5e58, 0xf41c7527, 0xf128806b,
+    0x97fd6e2b, 0x18bc5162, 0x3ac1901e, 0x5cfd32c4, 0x0b1687e9, 0x862196cc, 0x4058b606, 0x2ea6509a, 0x0e716708,
+    0x559df437, 0x4d2d9f75, 0x0ecb4403, 0x48f9d7ea, 0x2fbcadae, 0x651570ac, 0x72b61bc8, 0x670c8390, 0x19bcbc74,
+    0x7457e381, 0x440145e2, 0x19c6758a, 0x51e9bd6f, 0x964367f3, 0x81e08e81, 0xc9ab2e59, 0x54b0f977, 0x5ef4c598,
+    0x6ff00dc1, 0x543d3a87, 0x3406d7cb, 0xe5e930ad, 0x5bbc60ec, 0x21b78849, 0xcc5b1f88, 0xcd30bd09, 0xc22ab78f,
+    0x8ee82094, 0xe5e5e439, 0x9e2be9be, 0xc671c3b0, 0x0a4fd5f7, 0xdfa341b5, 0x148910b3, 0xe3fdcf1a, 0xa5b461c1,
+    0xbcd3b2c4, 0x91a7c622, 0x7078cee8, 0x9fd4cf0c, 0x6f716987, 0xdc12b414, 0x53cac5d7, 0x7ba1e9eb, 0x9589b32a,
+    0x30d7862d, 0x0f30d385, 0x7f20ef91, 0x0c35c306, 0x996be89c, 0x9a5134ae, 0x67d3c622, 0x9753dd03, 0x7318d8be,
+    0x9fa5c433, 0x3a5cc0b4, 0xc4f2901b, 0x61cc7693, 0x13051498, 0x450c8830, 0x7faaa877, 0x35967921, 0xad3a4f1b,
+    0x803e3bf0, 0xee4f9a35, 0xc4af8a93, 0x93c39cb2, 0xe5e9b45f, 0x98ca5487, 0x3bb38812, 0x8a1d97e5, 0x5659de3e,
+    0x39b36bab, 0xba1593f2, 0xefccc805, 0xdd7a18e9, 0x5653f12d, 0x2454141c, 0x48cc7656, 0xdcc00076, 0xf6e7ddcd,
+    0x7a25cbee, 0x4138b89c, 0x8f34e519, 0xe0d205b4, 0xd6c6dc99, 0x88707ab3, 0x0c85c7f6, 0x00238ca3, 0x6dee6566,
+    0x4877e82a, 0x61527dc2, 0xc15083b0, 0x15396e09, 0x13053d43, 0x69b50332, 0xe3927020, 0x1e7b8ac7, 0x1d19add9,
+    0x81c341e9, 0x06584221, 0xf4b21be5, 0xd67f71fc, 0x3a225f51, 0x05b7bd4e, 0x9d8c6f5e, 0x028720f1, 0x626a2fd4,
+    0x1d87e568, 0x5c25624b, 0x41c2c84c, 0x8c1f69ed, 0xf36a2930, 0x1784e072, 0xa7004822, 0xb9e6f56b, 0x9fe63402,
+    0x3a17c0fd, 0x1670957d, 0x1a432dde, 0x08b1653f, 0x92e7c984, 0xf28c4184, 0x81449a71, 0xef569237, 0xa1b46ff9,
+    0xb117c55c, 0x2b60f342, 0x7bf89e00, 0x4552b836, 0x5d4db3bb, 0x01f3a96f, 0xe085875b, 0xf6bf782f, 0xbe399a41,
+    0xca01955b, 0x21cc76e8, 0x926ab7dc, 0xb16e8c85, 0xa5afb196, 0xb6fbd59b, 0xe10807dd, 0x2ad341a8, 0xed976f36,
+    0x845b2015, 0x9c780f47, 0x5acf935f, 0x65678aa4, 0x0f720af6, 0xfaf60787, 0x5e665ea4, 0xb77c5894, 0x3618569a,
+    0x77b1fdbc, 0xedece7f9, 0xb8050c3f, 0xd46dd38a, 0x0e5c0696, 0xa33925f7, 0xd1412a54, 0xe737eebe, 0x0f008706,
+    0xc91e9022, 0x3bed04ec, 0x9620da6d, 0xf2d081ff, 0x51bd9123, 0x80e4ff8d, 0x00132505, 0xba2bfc62, 0xd32071c8,
+    0x03e1873a, 0xb40269d2, 0x419ed99a, 0x99bfd25b, 0xbfd7afd3, 0x01283a1a, 0xafd7b406, 0x1d13a1a8, 0x0f02723b,
+    0xa8064376, 0x7bcd820f, 0x9c655947, 0xdf377ebb, 0xd6cf25bc, 0xcbc7d996, 0x954bace3, 0x4d3d145f, 0xf9456886,
+    0x4cb28393, 0x972d702d, 0x4bd831e2, 0x1fb39f9f, 0xebfd7338, 0x27a07823, 0xc9b841a3, 0xd597deb7, 0xb13078e4,
+    0x9d631a00, 0xc41d8943, 0xafb00b3c, 0xd157ddae, 0x6a30bb3d, 0x10cf90d2, 0x24b5cec1, 0x4732c7d9, 0x16a3b649,
+    0x21db4411, 0xa9e4c75a, 0x0a04b7c7, 0xc491f07a, 0x6f3c4b9b, 0xeb0477bb, 0x95ac9146, 0x06fd09df, 0xe68c87b4,
+    0x7b5fcbf1, 0xadfa132b, 0x12c4efcb, 0x706cd18b, 0x88114dfd, 0xbdcba067, 0x7cf6f979, 0xe23e611e, 0x9c11b1c3,
+    0x984d2095, 0x5afef88d, 0xcc02e59c, 0xad6738c6, 0x5163e12f, 0xe83439e0, 0xe8b917df, 0xfa710fdd, 0x356c86d7,
+    0x54b81b6d, 0xe89fbeb4, 0xda69d28b, 0x37d69b6b, 0xceb4096c, 0xb8ccbbf5, 0x286a2afb, 0x07811642, 0x98a1512e,
+    0x56556886, 0xa28a6dd9, 0x6cd1f7a2, 0x9603b3b9, 0xeb29d54e, 0x6b1c926c, 0xaa50b648, 0x63fb67e4, 0xbeea9a07,
+    0xbb5f081a, 0x924d5afe, 0x248dd777, 0xb1923b55, 0xa3bdf951, 0x5155d3d6, 0xb7cbaf01, 0x10ef8e52, 0x3703b979,
+    0x7eaabdd0, 0xde4ebb32, 0xd3664930, 0xf728664f, 0x33df3f86, 0x460cd126, 0xac2ee83f, 0x0a4db8b2, 0xd6e062b1,
+    0xc58b2495, 0xcdbdac4a, 0x502f8746, 0x9636c4aa, 0xc7334a7b, 0x25244540, 0xe1aa723f, 0xa1b9ef18, 0x33127dd9,
+    0xdf038a50, 0xe82cdae1, 0x8e7ff659, 0x516e5383, 0xfc91660e, 0xc8055368, 0xd5c9726a, 0x8c7298c0, 0x561e3c3c,
+    0x10148469, 0x1b554796, 0x2271c0f3, 0x7048ddcf, 0x76f89fa4, 0x66706eec, 0xc0ed97be, 0xab58e603, 0x4dad9097,
+    0x604a8574, 0xcdc1c452, 0xc733d546, 0x397f4b68, 0xb568d86c, 0xf17c63f2, 0xde5a52df, 0x3586a281, 0x9acf4a45,
+    0x5f3ca174, 0xc2dfc532, 0xff85f954, 0xf13594b3, 0x591e8b7f, 0x863ed6ad, 0xc5bb89c4, 0x81ba31b9, 0x35a95abc,
+    0x2bdbe9a4, 0x9df83b12, 0x88d38aae, 0x286ec225, 0xaa615c87, 0xd109bc51, 0x6d363ca0, 0x44fa9fe0, 0xa8fcf89d,
+    0xe8db80a9, 0x98ddd795, 0xc52648a1, 0x6500b265, 0xbda2798c, 0xe128c0f3, 0xf98c536a, 0x44376ebb, 0x2bf12512,
+    0xafa09e2b, 0x7ce3c38e, 0x69175416, 0x4c9fe7b7, 0x56e38275, 0x6da53ef8, 0xa797d898, 0xdf30ddc5, 0x0d902f9d,
+    0xc4b6601d, 0x83f92694, 0xccae0332, 0x0a9a7bf4, 0xe7092363, 0xcb005011, 0x37c9ec9b, 0x5a7b98fd, 0x4f83bcea,
+    0x8c40fcb6, 0x3c5f82c0, 0xdc2a9a13, 0x06e633ae, 0x50c3b201, 0xcc985ead, 0x4aa6595d, 0xfa5355cc, 0x3ea257d0,
+    0x2719ad35, 0x6f16fab8, 0x794ee07b, 0xf8aa035b, 0x769e43c4, 0x66669ac7, 0x458939e4, 0x422c4552, 0x677f16ae,
+    0xf5f873c9, 0x32c7d431, 0x5ac37edb, 0x74028f59, 0xf923fc3f, 0xdb445f7a, 0x10462106, 0x486afd78, 0x2781a15a,
+    0x6af2264a, 0xb795c53a, 0x74640bd6, 0x05b3fea3, 0x490ba6f7, 0x151c21bb, 0xa6ea713b, 0x7e5d7120, 0xfeb3e3fa,
+    0xae7a6bd1, 0x505e24bc, 0x451cc6f7, 0x4e26c0d3, 0x5332b44c, 0x88fc4718, 0xf61e6c75, 0x7181bfeb, 0x1c5e3238,
+    0x0a735877, 0x1f86aa4f, 0xa7939688, 0x5061ad47, 0x878a56d5, 0xa3e7dded, 0x1b0821ba, 0x044d20c2, 0xe1a98ad5,
+    0xe658c56d, 0x33874821, 0x21c6b17b, 0xf8b8248f, 0xc41207b9, 0x8e8e148f, 0xf5c39943, 0x6cac96df, 0x69a3d7a0,
+    0x3103b94f, 0xe9f93273, 0xd8be5e0c, 0x071faded, 0xc95304d8, 0x5caa006c, 0xf5e3e003, 0x33fa7518, 0x72f7ee54,
+    0x740801dd, 0x1688237d, 0x78a372d1, 0x73e8d622, 0x109e95ae, 0x899eb6f8, 0x24efac56, 0x1a0a041e, 0x16dd2ecd,
+    0x4c4f972e, 0x689cb40d, 0x901f8931, 0x1833f331, 0x37d78c6f, 0x0f487de2, 0x8aa086cd, 0xf2d4ab46, 0xb4417b30,
+    0xf34aeb8b, 0xfd3ea8cf, 0x3da28c16, 0x7b96b665, 0xeba13daa, 0x46189fa5, 0xfb9c6032, 0xb5aa6e9d, 0xe34e0209,
+    0xa01064f0, 0xaef58bcc, 0x7557617a, 0xd32850fa, 0xac76d41a, 0xd823a836, 0x59530dda, 0x0075b9e6, 0xa2bfeb03,
+    0x17b1d674, 0x8066c4a3, 0xf29319de, 0x33ad84ca, 0x6fbc728d, 0xd208dfcc, 0xd0f5c3ac, 0x6753d49d, 0x077dd1c8,
+    0xba1f2bf7, 0xa906a620, 0x934b81c8, 0x70430606, 0xe2bd48e1, 0x225cbfd5, 0x550cfc5f, 0x7fcbf8d1, 0x95e5e0cd,
+    0xaf1b8e95, 0xb0295a80, 0x6190231b, 0x9897c9dd, 0xb7dc9af3, 0xb65baaaa, 0xfc31d5d9, 0xa2d4302e, 0xf02f50dd,
+    0xe858f2c1, 0x5b0740e9, 0xb6b2fc31, 0xb49f0934, 0xcdd8faee, 0x4e7cd83d, 0x08d78830, 0x66a4892e, 0xbe72bcf1,
+    0xa22933b2, 0x2bd1d778, 0x96a03864, 0xf8c9a933, 0xf915dfd1, 0x424b864f, 0x8e9f75e1, 0x960c07c8, 0x4f5464b9,
+    0xacf56e09, 0x04ef3e09, 0xf79ce14a, 0x85c9710f, 0xe5a18784, 0x89abb4bc, 0x141f4aa1, 0x1bd27951, 0x056582fd,
+    0xde9b9726, 0x13ac301f, 0x4eb7ba08, 0xcf0d7fe9, 0xce8ad2b3, 0x5716955d, 0xbde2fe18, 0x13a37c20, 0xf17dee11,
+    0x9af3f57a, 0xb4b544a6, 0x4c70c5ee, 0x6e0f77e2, 0xd5fe0624, 0x751890bc, 0x1e6ce453, 0x187b8c33, 0xafba601c,
+    0xab3a75f0, 0x5f46657e, 0x6b8a02ac, 0x7b0bc79a, 0xa99073d1, 0xc606195d, 0xd7ed5ab1, 0x9c8481c6, 0xb56bf0b5,
+    0x2358549d, 0xf2f4c216, 0xd79afe32, 0xd00f9b16, 0x380b7e20, 0xabf98f40, 0x210abb5a, 0xdbaf87e8, 0xf3aea328,
+    0x72905748, 0x21125830, 0x817adfef, 0xdbf68696, 0xcb0b2b42, 0x408a9a05, 0x2ecbf429, 0xc4a352d9, 0x4e8f6de0,
+    0xa67556cc, 0x0c8768d0, 0x57f22a76, 0xc7c1b852, 0xca537b25, 0x60808bf4, 0x68c8a688, 0xbf8c5953, 0xe820fe69,
+    0x54cfab1c, 0xe90d4ca8, 0xf3b49361, 0x3c241bd1, 0x200dd4fe, 0x31b64e19, 0x4b59ca2b, 0xf2a6a648, 0xcd23a1f3,
+    0xe59c6671, 0xd688a99b, 0xf7168b0e, 0xf0d22d71, 0x8bc4ba30, 0xf2a5821a, 0x89be88f4, 0x29456403, 0x884ca3d7,
+    0x0cb34b96, 0x7950cf9b, 0x8f0d8fa5, 0xe3f9e59e, 0x099668b9, 0x971335a4, 0x6663790b, 0x990926a0, 0x0078c3ef,
+    0x3f18aaa1, 0x9f9d1ae1, 0xaf8f93be, 0x1b7c9b60, 0x9cb2cbb7, 0x8a5f1d35, 0x73301fb8, 0xc8ade601, 0xd513d570,
+    0x09e9b75b, 0x0f1a126c, 0xa0a0c511, 0x632df6bf, 0xb77265c9, 0x0447f08e, 0xa055b890, 0xe96a957c, 0xbb1058ac,
+    0x4a639aa7, 0xaee3aa0b, 0xefff2a5a, 0x8f2c5a10, 0x1759f5d5, 0x956c9317, 0xd2ad2633, 0x1212b165, 0x36a16a57,
+    0xd075c54c, 0xd4e655f5, 0x2c5f7287, 0x674521d4, 0x0f7789ff, 0x313742fe, 0xf14db7fd, 0x3becbc6f, 0x7fcebd58,
+    0x7ff0f440, 0x235436c3, 0x093a0317, 0x141a5ca7, 0x4798ca2c, 0x36b4f0ff, 0x5867d592, 0x4c98964b, 0xeffd4f13,
+    0x3b80adf1, 0xf7f32060, 0x32e1fe85, 0x73af704e, 0x3d98156b, 0x67ffd75e, 0xfc4a3589, 0xa9167f30, 0xbef348a7,
+    0x966061f0, 0xe57c6341, 0x190b5578, 0xab3e4aa8, 0xc4ba8b73, 0xd4318a41, 0x68284449, 0xeda20682, 0x7a9d5ab5,
+    0x53f5902d, 0xfc2bf4f3, 0x4898addd, 0x27704ccf, 0xddd6640a, 0x83750544, 0x379a9440, 0xc2ab9410, 0xc3177e07,
+    0x2829ab8b, 0x7e4eead4, 0xce9a0c35, 0x9783c9ad, 0x4b2f53f7, 0x3729d4ad, 0xe6b3c79d, 0x3b85266a, 0xecb33540,
+    0xaeccf3da, 0x594a04f9, 0x68fa59a2, 0x1bf8818a, 0x49f6fa54, 0x36eaf38d, 0x57d06114, 0x81f02c87, 0xb2e9cd3f,
+    0xacd16988, 0x02227c7e, 0x108bd4b9, 0xccf66b70, 0xd44d8e2d, 0x522626cb, 0x703e296d, 0x875c9fc9, 0x3855623c,
+    0xc5245505, 0x838a456a, 0xff97d717, 0x63e461f4, 0x6530721c, 0xeb96d9e4, 0x8fc94e8b, 0x57acd54f, 0xf5155ccb,
+    0x07622cf0, 0x42c43190, 0x6bacbe73, 0xf1b380ef, 0x2c374e12, 0x7c4b1197, 0x3416f849, 0x7c6248be, 0x4586313b,
+    0xa0843a12, 0x879f2d1d, 0x93a76021, 0xf602fcbb, 0x2c16790a, 0x01e8445c, 0x9e438999, 0xe2e6de8e, 0x9ca112eb,
+    0xecc25cfe, 0x5a2e1b61, 0x8a9e8a36, 0xfe78dc7d, 0xe65fc4b8, 0x060aa1a3, 0x0a543fba, 0xa894c177, 0xbc647c44,
+    0xac44e17e, 0x4e990ca8, 0xe6fb53e1, 0xe2f47b1c, 0xaf1a4900, 0xa2796558, 0x19305aba, 0x9593106b, 0x0516d8eb,
+    0xdf78dc03, 0x2890ac84, 0x715814d1, 0x114f1377, 0x3a699fec, 0xa3c4f1e6, 0x0fd4ae6f, 0x78d185f6, 0x40b660ec,
+    0x55ce0555, 0x35396e95, 0xb69631a5, 0x0e1a358b, 0x7d6946be, 0x5166a7d7, 0xec4281fd, 0x3c60cec2, 0xa6b6a6ab,
+    0xee919e8f, 0x775b9a52, 0x3d31dfee, 0xa876ef46, 0x513e22f5, 0x3c46498a, 0xd669b36e, 0xc0fc5428, 0xead79cbc,
+    0xe31fc2f9, 0xa63870bd, 0x991d8eb3, 0xfec3d8e1, 0xd47fa455, 0x78a6ca61, 0x8f4bb0a9, 0x8cf8346f, 0xbb4682e1,
+    0xb39ccb86, 0x613bcabf, 0x62301a42, 0x4fef6913, 0x45716da5, 0x8d2c1d2a, 0x908268e6, 0xe7ad884e, 0x5456782f,
+    0x733822e5, 0xb4cf26a4, 0x20876b4c, 0xfea1df2b, 0x13960f5e, 0x58e9e015, 0x245e8e59, 0xdf253fe7, 0x4471829f,
+    0xb78e6913, 0xe66edc3b, 0x5680eb4f, 0xc5afa04b, 0xfe2ac4f1, 0xcaca4c96, 0xb8026e5a, 0xa5196464, 0xb6871b39,
+    0x51e318b0, 0x0ebfdabf, 0x393fba11, 0xc1497a40, 0x7bf1ac62, 0xaf8beca4, 0xbd5fb35f, 0x2eeb381d, 0xef7c9d67,
+    0x6b5b9c90, 0xf73766b3, 0xea02d01b, 0x2036e41a, 0x1979ec5a, 0x40a73492, 0x20c1a744, 0x8c6b3184, 0xc29a2973,
+    0x5777f339, 0xc8c0a1b7, 0x314c30c0, 0xd7f06bc5, 0xee1f4de5, 0x03b6ed17, 0x3ed3c90f, 0xfa8f6d27, 0x749d5c93,
+    0x678c7b2d, 0x295f6eea, 0x3077d48b, 0x4411fa2d, 0x9382c66f, 0xd6f60fe0, 0xc27c8056, 0xed982bd6, 0xba30e2c0,
+    0xcee45a46, 0xc09a197e, 0x994ecbda, 0x069243fb, 0xc75df086, 0x7b43b224, 0x11c3a148, 0x20ceabbb, 0xf5a9b97c,
+    0x326e28da, 0x1e200164, 0x4829d5da, 0xc3f045c6, 0x678bec2b, 0x197159e0, 0x5a7b82a9, 0x433b874f, 0x06830475,
+    0x46347b0f, 0x74ee1241, 0xd1246c2f, 0x469bda61, 0x6aad9b20, 0xcca9bb40, 0xd57163fb, 0x34f36eb3, 0x38b517d5,
+    0xefd251c1, 0x85f56e9f, 0x82428d9d, 0xd987a632, 0x1ab5f614, 0x570cc268, 0xd679516f, 0xafb56273, 0xd574b0ea,
+    0xe49d4351, 0xbfc1623f, 0x0f442dcc, 0xb6747d2c, 0x99dfc7b1, 0x92bae255, 0x53313b24, 0x579da8e9, 0xf1b4b007,
+    0x7f6a942a, 0xe9294bd1, 0xc7836a07, 0x7f9b4012, 0x4bae2425, 0x5c607740, 0x3d3d28ad, 0x1a770129, 0x8a5bd68a,
+    0x3d4b0e59, 0xc5a8ed0c, 0x59140230, 0x203dd5a7, 0x7eafc1f9, 0x855ed000, 0x2a8a8dad, 0x7e87e927, 0x9a09d69e,
+    0x4ba3924b, 0xa0e34ff1, 0xba44e52b, 0x4896c83d, 0x756481a4, 0xe7125e73, 0xfa53ae7b, 0xc569d9ed, 0x659f8752,
+    0xbd204354, 0xf6266414, 0xc83604b7, 0xc2e80392, 0x8c783fc7, 0xa41e3d2d, 0x634e63b6, 0xadc20e87, 0xb0130efa,
+    0xcf5eb758, 0x184a706e, 0x19b75efd, 0x93cc3d74, 0x7795911f, 0x1bf67447, 0x8c186fb1, 0xf3a4bc97, 0x20cd8e1c,
+    0x84795bd0, 0xa6a3c4fa, 0x7ae78a39, 0x731f6f96, 0x2410b8b2, 0xcf02d4b7, 0xb32baafd, 0x8eebf562, 0xa342831d,
+    0x486fe0a8, 0xc6a723cb, 0xdbd4321b, 0xada3dbc3, 0x860de739, 0xc120c4e2, 0xa22fff6a, 0xe6812689, 0x4691d36c,
+    0x2ff08010, 0x0f4b2fa7, 0xd99687e3, 0x76083ffa, 0xd5030414, 0x5581e3ea, 0xffaba84f, 0x3ad771b2, 0xd38df0f3,
+    0x01ca1940, 0x84d627f8, 0xdfc24fcb, 0x8bde74a9, 0xf8693f85, 0x629a4522, 0x28d61c74, 0x3fdb3c70, 0x7ff9afe3,
+    0x09d64693, 0xb9d806d6, 0x3800edae, 0x6f49866a, 0xfd47c5d1, 0xf0beb93a, 0x7ad02fb1, 0xa1e6fdce, 0x7fa55681,
+    0x35fc0b03, 0x6a980ce8, 0xe5069464, 0x75637138, 0x6e6873f7, 0x133c429d, 0x4b3d0d9d, 0x3f6a8cc9, 0x2421639e,
+    0xca7b95f2, 0x5bfd8b40, 0xf316ea12, 0x99614b70, 0x2ccdb532, 0x8fc0b5f7, 0x3453f2af, 0x3ee9ff42, 0x43f34cf4,
+    0x160fce7b, 0xfd78b2ec, 0x57bf2d5a, 0x6c6276be, 0x542ad90f, 0xbd4326ae, 0xfd7a22e1, 0x8bf8c950, 0xd445507c,
+    0xd122dde5, 0x3ab0efad, 0x297281dd, 0xb4b65a9e, 0x1a2b6de6, 0x49cf38da, 0x6b201aa9, 0x85640636, 0x70e25f1c,
+    0x291bff9c, 0xf3dfcc4e, 0x88a582ec, 0xe8e14576, 0x55de5139, 0x48707979, 0x8296eab7, 0x39eee416, 0xc9240770,
+    0x82a9732e, 0x243439e3, 0xa0215ce1, 0x8a6d2550, 0xa386f21f, 0x54993020, 0xce0adda5, 0xbbfa5d39, 0x32511160,
+    0x6ec3f802, 0x9e46d8db, 0x9af6f42f, 0xb3e549f9, 0xb6cb4a70, 0x1124b2f2, 0xa8ea9165, 0xd1f76251, 0x626d9254,
+    0xc63f6229, 0x81d1f5bd, 0x080d1035, 0xd6a6ddfe, 0x09ec1fdf, 0xc1c910a3, 0xdd34dd90, 0x75013e01, 0x046a56bb,
+    0x5385f7f1, 0x188f8e19, 0x4a49160f, 0x8b4bc5c3, 0xd1b7f407, 0x476f7d74, 0x7ed70005, 0x65d7921b, 0x1f08bd3a,
+    0xde3d2a7a, 0x3d2b77bd, 0x8dc9bffe, 0xe5a1f8fd, 0xf277e9ad, 0x2b6bb9e3, 0x891d0657, 0xa600a8da, 0x2800c7ad,
+    0x5bbc8638, 0xf2b72d7a, 0x241d049f, 0x8f762f11, 0x6e92d4f9, 0x8b0d6ce8, 0x735729f1, 0x58d71f92, 0xf07017de,
+    0xf9db3704, 0xc315db62, 0x7c2f5018, 0x2b6a1f9b, 0x11665e82, 0xf2a7fffd, 0x49b384bb, 0xf329210b, 0x8347f190,
+    0x2dd28033, 0xb4b4dfec, 0x9719e3db, 0xd51b487b, 0x0d797397, 0x946a57d0, 0xf267061a, 0x1be3e21f, 0x568de30f,
+    0x19331fa3, 0x096189b8, 0x90d91966, 0x2a527c0a, 0x5c65dc21, 0xf4f2376b, 0xb93bf2c1, 0x22d91c0a, 0x06cab242,
+    0xefc7ffa5, 0x7cd3e75b, 0x47101ef2, 0x83abf60d, 0x5da4dab0, 0x419a3ad3, 0x6e8a83c8, 0xc9339252, 0xbb10800a,
+    0x8af272a7, 0xa89194d7, 0x2b7ed0ec, 0x7733b57b, 0x2a889925, 0xbedbb70a, 0xf07f80e2, 0xdf23463f, 0xa3ccccce,
+    0xd71a897e, 0x0b9ab486, 0x4bff4db6, 0x91507a34, 0x3ae27275, 0xff7e8490, 0xe054648f, 0x75f77339, 0x2f1da54d,
+    0xa4f5a228, 0xfb3e2d2c, 0xceadb361, 0x0a8a6100, 0xc95cf489, 0x42f8f4dc, 0x577c4422, 0x8959bddb, 0x354909f6,
+    0x348a8fb6, 0x70534f11, 0xfbd37c6f, 0x0a2e1c1d, 0xbae37ecf, 0x64fece1e, 0xf0b00d6c, 0xbe41c1ec, 0x391b3cf9,
+    0xd506af93, 0x11290451, 0xc9e13445, 0xbb515be6, 0x744e9c9e, 0x60d8cf8e, 0xfad1b8a5, 0x1997429a, 0x3bf3e3d6,
+    0xa8b0f310, 0x338ab8d0, 0x6d19e766, 0x20acc6d4, 0x74a900db, 0xe3e6fc11, 0x6e4d58e3, 0x3f7bb1cb, 0xdbbc1567,
+    0x276ec07d, 0xc57d820f, 0xdf155f5f, 0xee8eebfd, 0xc7b109aa, 0x8ea0885e, 0xbc5773ce, 0x3cb27487, 0x215f6a85,
+    0xe70254ea, 0x637b53fe, 0x1611ca1b, 0x93316a44, 0xbf77111b, 0xc8f954e8, 0xbb3e06c8, 0x553d6c81, 0x17bcc5cb,
+    0xa6b0eb7b, 0x6cda47c6, 0x819fb2e7, 0x144346a1, 0xa09d6849, 0x76a8586d, 0x8cf477e7, 0x21d64776, 0x97015b41,
+    0xeed5d9e6, 0xf59867bd, 0xc817cf29, 0x5b8c7014, 0xbb8508f5, 0x507deb8b, 0xa65c0770, 0x60f8abbe, 0x01ce7782,
+    0xc55e455b, 0x90ad1a50, 0x7bfe3dc4, 0x697728dd, 0xd80931af, 0x2d270a51, 0x36f52839, 0xac219b5c, 0xec137575,
+    0x0e38c965, 0x0432ef68, 0x8fd09ba7, 0x75b798b8, 0x3c870779, 0xa2afbf85, 0x7780a17c, 0x1dc35adb, 0x3e2489b3,
+    0x591aad01, 0x891b5a82, 0x63eba35f, 0x3c19f901, 0x64ea4c8f, 0xfbbb0f2a, 0x7f4d527c, 0x8e5bb4ba, 0x3d15ffbd,
+    0x6201c6b4, 0xd4ae1373, 0x0b67218e, 0x6c945b14, 0x9af8e37c, 0x3edbd78e, 0xac99e67a, 0x5fa30566, 0x47cdd759,
+    0x500ff28a, 0x077a4dfa, 0xef23746a, 0x05e059be, 0xbcc5137a, 0x76f505ca, 0x4acc6bb0, 0xd9f25697, 0xe1572282,
+    0xc145558c, 0x797f9eb9, 0x8256731e, 0x4a95aa8d, 0x903b8d61, 0x2e23f674, 0x9183d4bc, 0x8267dabb, 0x7d1a2c81,
+    0x591cd4d8, 0xd8131f54, 0x47886d7a, 0x6f45d66e, 0x9c17990b, 0xf6407cea, 0x36711fd6, 0x46045dc6, 0xd9b3aa29,
+    0x6b83317e, 0x68841a3e, 0x01274c35, 0xbe6f65e2, 0x590d61d1, 0xf726f144, 0x5ce27e4e, 0x379a087d, 0x20a3e7de,
+    0xa0852a8f, 0xdfb3da53, 0x48a3440a, 0x57d56149, 0x562a3fb6, 0xa529ddf3, 0xf1f282ee, 0xc7f29a18, 0xfe5357ed,
+    0xe9c4b57a, 0x9a89c042, 0xa24932d7, 0x8f879452, 0xdcc39245, 0x7a2f6a4d, 0x172a8fbc, 0x8a080edd, 0x9cab61ed,
+    0x281680af, 0xcbf6b6f0, 0x82287ef5, 0xacdfaa39, 0x20004715, 0xee8dc9f1, 0xaee3274f, 0x8debaf6d, 0x4d37da0f,
+    0x851c0763, 0xbaf40a82, 0xa5bab9db, 0x956ae1f1, 0xecd67210, 0x2365516f, 0xe394b89a, 0x64aa58b8, 0xc0334fbf,
+    0x45f294ca, 0x1aaa9ef5, 0x66362c9c, 0xfc1f477b, 0xbc322930, 0x41588133, 0x72bfc11e, 0xddc0fbb6, 0xb34078d0,
+    0x1739fc22, 0xd5d1dd77, 0x9c3fdbdc, 0x6366b4fa, 0xc4ef4416, 0x6981e017, 0x75a29250, 0xb23d501f, 0x6c2884a5,
+    0xbb24bf48, 0x2225a4cf, 0xa58fb4bd, 0x5c5248b3, 0x9ff92574, 0xd15a128f, 0xf2d2b8f3, 0xf0f026ec, 0x1ae49be1,
+    0x776706dc, 0x698bdb49, 0xaac41b07, 0xc078c543, 0xd74fef65, 0x6ebe7260, 0xeb9202b1, 0xd218d013, 0x64b2ece5,
+    0xc2006b1a, 0x405168c1, 0xe902a3b3, 0x5dff82c7, 0x70cf3cd0, 0xd0877304, 0xcddef1bc, 0x73eb3863, 0xcc4228df,
+    0xf66e8418, 0x31c7af56, 0x938882aa, 0xcbafe2ee, 0x4357acb8, 0x0ff322ef, 0x5d334ed9, 0x2f231984, 0x558ef287,
+    0x422a34ba, 0xc759ccd3, 0xf3c6b894, 0x1edbb029, 0x71bc6cdd, 0x4eb1354e, 0x0c30032a, 0xfc761658, 0xb4e70d39,
+    0xc31e5f5b, 0xff01703d, 0x1dec442d, 0xcf58572b, 0x2b8b8d10, 0xe9499806, 0x9c3f27f4, 0x3d38dc0b, 0x928f13ce,
+    0x7db23a84, 0xc07adee0, 0x73df43ff, 0x95729d47, 0x0fe49482, 0x6520bb53, 0x78e351df, 0xee33b671, 0x5169934f,
+    0x200ecebd, 0x51e50da5, 0x0e62b1a7, 0x6c8f546e, 0x88843a8e, 0x659f09f1, 0x471a1cb6, 0x099b58c8, 0x44c1c93a,
+    0xba7c15ce, 0x2f9f6b69, 0x0362ed31, 0x0b3d8d09, 0xdcfc3c27, 0x93eaea67, 0x7dc35c6c, 0xdec47c4c, 0xcafda8ed,
+    0x81ad4cc1, 0x70134dd5, 0xe0e88a25, 0xbe462910, 0xf2b5b1f7, 0x44ed536b, 0x59cc03f4, 0xcd87d79d, 0x421f7a30,
+    0xb79a53fb, 0xaddb955f, 0x30641e89, 0x7ab73fbe, 0x8ae34fdd, 0x55042fc0, 0xd91bd970, 0x44805ee7, 0x5e50069c,
+    0xd0d73a9a, 0x4d9afbf3, 0x41e12f26, 0x47cc9c1c, 0x5773a657, 0x8a99759a, 0x0ae056e3, 0x5fc4df4f, 0x6b09d67e,
+    0xff826f95, 0x7ca24a49, 0x7eeb29eb, 0x2b5d3bb1, 0x50314a83, 0x6f0cf229, 0x46372695, 0xb834a623, 0xc0565677,
+    0xc6d3676c, 0x66b1fcc2, 0xe50c3f94, 0xb0b34959, 0x9e96818e, 0x7bfc8dc5, 0xbffc49c4, 0x79d4523f, 0x38718585,
+    0xd31ed0ea, 0xde8b24ab, 0x92b22320, 0x933fb369, 0x9d14ad76, 0x16ebea29, 0x5d50d2bc, 0x6ffaa8d0, 0xb573bc4a,
+    0xdd5ba5cd, 0x365ae0b1, 0x5fbf5f97, 0x58b25a45, 0xd9f0e98e, 0x89d19846, 0x23636ca3, 0x89e9aee7, 0x31601e6d,
+    0x85f5e50a, 0xa412057f, 0x5224b319, 0x01149354, 0xc3e055b2, 0x64312d45, 0xdec7818f, 0xb8589c2d, 0x5b7628fc,
+    0xfa289ddf, 0x0f070f17, 0xaa5ff47c, 0x632c3489, 0xfa8909ed, 0x13abee5d, 0x4014ae5d, 0x895430d0, 0xeb9e55e5,
+    0xf1fbb1ff, 0xb10383de, 0x99ab112c, 0x1124fded, 0xa3a62c47, 0x109906fe, 0x188f69e5, 0xb00460fe, 0x12da739b,
+    0x7eebe695, 0x4687b8ad, 0x91fd3924, 0xfb525c57, 0xc13b5439, 0x15646b97, 0x5256c12f, 0xa66edc25, 0xfd48f890,
+    0xeef77997, 0x89c402a5, 0x6bee50a8, 0x68511be7, 0x07e159d0, 0x9b3df230, 0xcd0b1c8a, 0xf847db17, 0x1c2365fc,
+    0xa5c6eda9, 0xd5755c84, 0x8506ff92, 0x4bbf61ae, 0x91a100c0, 0x05bad911, 0x4e6f2eb6, 0x8e1f601c, 0xeee030aa,
+    0x2ab7ed5d, 0xb4c7cfb6, 0x761ee504, 0x3910a592, 0xd8f8d937, 0x5910d992, 0xd0cd1a95, 0xd2649406, 0x796e47c0,
+    0x9b7fbb71, 0xdb1840b8, 0xb3612b58, 0x62068cfe, 0xe9d0e32c, 0x08c22a11, 0x9ec02b3a, 0x5c3610f3, 0x5047c6bc,
+    0x8b368f9f, 0xd2e99c71, 0xdfe02cb0, 0xecd757e9, 0x127a126c, 0x5f7b281d, 0xe0b75389, 0x9b2d27a6, 0x32137c95,
+    0x60d055b2, 0x59fd8382, 0xc0f770f1, 0xc36d03e4, 0x0de001c8, 0x8e06e879, 0x0643c88e, 0x9a06e8dd, 0x47512667,
+    0xad07554e, 0xbf0133e8, 0x4bd7b0b9, 0xfa512981, 0xd05c8a94, 0x6657397f, 0x012c9a73, 0x22fcaa30, 0xc186a6d6,
+    0x8dcea2ce, 0x0905201c, 0x1f66f9ed, 0xbf079018, 0x2a0825a5, 0x3a19fce8, 0x86644d8c, 0x2a8e0daa, 0xe92d395a,
+    0x36fbb62f, 0x4892d374, 0x99ce4107, 0xfb26617a, 0xe884b5e8, 0x9ae98d07, 0x12300f45, 0x22226de1, 0xa19ad06b,
+    0x99f67a86, 0x920c75f0, 0x8e1fa5cd, 0x2d3761e9, 0x73b019cc, 0x8aa7c2aa, 0x97fc0c8e, 0xdd286d84, 0xeae9b005,
+    0xb5ef9709, 0x6808ef21, 0xf8a01d01, 0x59cd6cd3, 0xd6bdb8f0, 0x218fe067, 0x4a4bf249, 0x3c07d200, 0xaa6891a0,
+    0xc8f9b777, 0xf20d5276, 0xb3369630, 0x73024913, 0xcb6a9331, 0x4431cc76, 0x88a86447, 0x0b6fde33, 0xab6887bc,
+    0x1da55dab, 0x0c9bf86f, 0x0fe4cc86, 0x7a793b78, 0x410f0684, 0x3cc1fef3, 0x5eec2d96, 0xbdd41d68, 0x28883844,
+    0xabf5d067, 0x5bc5e311, 0x5e45b429, 0x610f927b, 0x36faf43e, 0xf8c4e1ec, 0x33e9229b, 0x12365fe4, 0x5ec98bf5,
+    0xa34db000, 0xcd5969da, 0x02e73d49, 0x8756be53, 0x9905d219, 0x47ea57c8, 0x4a7d86c0, 0xb6f1e850, 0x3cefd7a5,
+    0xb95a899c, 0xa42875cb, 0xea734432, 0x63847dbf, 0xe000474c, 0x3d956480, 0x6cefe572, 0xc78a09f5, 0x004e73ff,
+    0x94fa111f, 0x7166674b, 0xa18cd5b0, 0xbef7cfca, 0xb440ec91, 0x8bb6c717, 0xc97228dd, 0x7ca55c91, 0x2f53bb20,
+    0xde053eab, 0x0d383f31, 0xa534d345, 0x0e3acdc7, 0xe3b51134, 0x0d79ea2f, 0x3cee53e2, 0x46036c01, 0xcf9839e8,
+    0x3bf4f248, 0xa8c62fa6, 0xcd2f087e, 0x3d159891, 0xc15ae0b6, 0x4564dddb, 0x7ae1fc17, 0x27944264, 0x129f88d8,
+    0xe9ffa60e, 0x66ed7557, 0x7e0db77f, 0x530e4e99, 0xd9b3a093, 0x534ed0eb, 0x89d39583, 0xf1a41a86, 0xe7fb4523,
+    0x6f047c6b, 0xc13b9fe9, 0xba56b490, 0xb64913e0, 0x56b7b78c, 0x7723304e, 0x491ac402, 0x813b3d2c, 0x7e2b7c74,
+    0x052c9438, 0x8027ffb9, 0x1f348d02, 0x9a993c6f, 0xaf76425c, 0x2e2de85a, 0x18f0106d, 0x6344e442, 0x8eec2111,
+    0x041697e2, 0x72c0c7cf, 0xcf882333, 0x68dc7382, 0xd25d2a42, 0x3f2b3c29, 0xb64b242b, 0x900c07e3, 0xc15c235c,
+    0x3e3399e5, 0xef9af975, 0xa89d6e25, 0x9d62f3e3, 0x63b8c8ac, 0x74a89dc2, 0x44983cc7, 0x2445f995, 0x79c51c79,
+    0x51f2c995, 0xf9a7c987, 0x1d695df2, 0x211226ef, 0x3bcacaff, 0x0949a2ac, 0xc557d428, 0x2174b5d7, 0x21b8196c,
+    0x28affed6, 0xda95a01a, 0x697fc09c, 0x67b55384, 0x6279cd1c, 0xd0262653, 0x2bd7a1d4, 0xff69bc9d, 0xc2eb93e0,
+    0xb6d32872, 0xc6dafaca, 0x89f674a5, 0x3ebfc03c, 0x0b74a407, 0x47587260, 0xe3a15bc8, 0xb0ceb022, 0x05e93a77,
+    0x9b81f6bc, 0x9329549b, 0x6e731dad, 0xf3a29ef6, 0x04c215c8, 0xea3d8a1b, 0x5bff38da, 0x1d694c99, 0xbd38f015,
+    0xca3b96e3, 0x8452e1f6, 0x61802791, 0xabe9c016, 0xdd0d107c, 0x06dff3d9, 0x627870ed, 0x94565805, 0xba5a29b2,
+    0x433bae6e, 0x5b90c95e, 0x4f22569e, 0x01717fa8, 0x80c8291b, 0xd831bad9, 0x327c7772, 0x868cc52a, 0x409d6530,
+    0x99881008, 0x387db540, 0xac8bc231, 0x27c959e1, 0xa556049d, 0x744fdb4a, 0x5a783980, 0x53e7967a, 0xce8281bc,
+    0xe56a91cb, 0x7ffdd68a, 0x223a82be, 0x984bac87, 0x395f229c, 0x2e6cee06, 0xf5536bc6, 0x7ba8ba70, 0x0ac9ad64,
+    0x04feb596, 0xe59811c0, 0xa259245d, 0x220bb5b2, 0xfbca0603, 0xb9b9dac9, 0x0f7f0b46, 0x308bb0e8, 0xcb4d43b6,
+    0xbc107268, 0x57204c58, 0xa4f810ed, 0xe3fc505e, 0x6c040f11, 0x7f894cde, 0x16657c7a, 0xaa953c70, 0x8ae5b075,
+    0xa9e7494f, 0xc40239ae, 0x4dcb7be2, 0xa73dfb3e, 0xa92dd354, 0xede7df4d, 0xd6f7d666, 0x1ebbe31c, 0x27e9c871,
+    0x0aacea64, 0xd496428a, 0x3dea3100, 0x1e11a0b7, 0x65b9b85b, 0xd781a90b, 0x024d955c, 0x8b6fde4c, 0xbcd5bf7b,
+    0x809bb3dd, 0x7bf5c317, 0xfffda270, 0x2ee4a59d, 0x1e4ffdfd, 0xcfcf589f, 0xf79c2f5f, 0x748e73a1, 0x5b7cd610,
+    0x71b28734, 0xd5e981c8, 0xe72bb5d2, 0xf0f641e5, 0x427017ae, 0xd5c07c96, 0x1c619792, 0xa7e8d2e5, 0x49b30ee0,
+    0xac2eea3e, 0xc5dce055, 0x5db57d45, 0x51c07c88, 0x029ed502, 0x8c1e207e, 0x96692eab, 0xfd96be23, 0x8f23a30a,
+    0x301c1347, 0x4ad569d1, 0x413960e7, 0xcc994730, 0x328ef8ca, 0xb59b98b2, 0x822ad3d5, 0xc212bf02, 0x5c060d26,
+    0xfd61fd2c, 0x1af7bdd9, 0x976929e2, 0xbc444cc7, 0x2cd83229, 0x866e8f60, 0x2fc33e01, 0x1a802589, 0xc4b184c9,
+    0xcfc0c6e4, 0x56352514, 0xf4417f26, 0xb0a2a553, 0xc43c4f93, 0x70fba896, 0x4e6444a2, 0xd24e882d, 0xea5317c4,
+    0xdfde3029, 0xda9dcbac, 0xe79851f0, 0xba6205e8, 0xf059885d, 0x7b312f8b, 0xd570f4d9, 0xa7e086b3, 0xb637eae6,
+    0xb2f4db85, 0x2c4f7ac3, 0xdab8b9ca, 0xe05287b7, 0x42d095e2, 0x41f9a576, 0xdaf88c29, 0xc23760c2, 0x852b81d3,
+    0x1af725db, 0x60686233, 0x69e36b2f, 0xd1a7f120, 0x04c856ad, 0x4566c769, 0x4f1b0eae, 0x9ad6585c, 0xd92d0211,
+    0xfc09d18b, 0xfa061d22, 0x2464978a, 0x055ffcf3, 0xd5ec26a1, 0x607a5df6, 0xb87cc426, 0xa6e2db7c, 0xd5488781,
+    0x0bcf384c, 0x92a1686a, 0x6be81234, 0xb755163e, 0x3dcc3724, 0xfd4614c6, 0x943bad16, 0xec35080b, 0x052600f8,
+    0x1d1e37df, 0xa9c19a28, 0x850dd872, 0x23c1acde, 0x126610d4, 0xc7f8f2cd, 0x24536a09, 0xc224a0c5, 0x47d71bb1,
+    0x8db63252, 0xbbe1a69b, 0x8ffbc397, 0x98e9be72, 0xb86795dd, 0x6ac02dec, 0x3b0a793a, 0xdb55d38a, 0x61c28f2f,
+    0x6e774159, 0xcff25b37, 0x11800495, 0x9f447a42, 0x9f6a9bd3, 0xa7c69fe2, 0x6605066f, 0x6349b4fe, 0x2b66324e,
+    0x23691ec2, 0x57c8e54c, 0x6b6e175e, 0x0dd76bd4, 0xd27d538c, 0x4b43b203, 0x57912af8, 0xa000bbe2, 0x7fc4d53f,
+    0x25ec1f49, 0xa96b7754, 0x6e2689bc, 0x50656d25, 0x8cfba107, 0x364d3e71, 0xfe83bdb9, 0x695e93ea, 0x063c9902,
+    0x695caf4a, 0x3f9d8dea, 0x2124b9d5, 0x0930c502, 0x9c10a5aa, 0xc12803b3, 0x1a4988f5, 0xc332ca86, 0x9cbc72f1,
+    0x566d2c7e, 0xb1840f23, 0x992b51f6, 0x3b84659f, 0x395532a5, 0x6ce7aa6a, 0x9f9c0be8, 0x5d824e26, 0x63c21811,
+    0xe14b59c1, 0x7240182c, 0x147c8c25, 0x9e99d5f4, 0xaf80029c, 0x01b19261, 0xc53749b7, 0x84d02439, 0xe8c6f840,
+    0xe8929e99, 0xcdf0d64f, 0x43925f38, 0x567499d0, 0xc2d9530c, 0xe39942e7, 0x8e1232ac, 0x7d17ce39, 0x66f41e04,
+    0xaa16e9f5, 0x83b4ec05, 0x6bc0cade, 0x67b5876a, 0xa74a9151, 0xdb62be43, 0x32ed306d, 0x71850756, 0x5ce3549e,
+    0x9d06a409, 0xe4b52779, 0xbeb1f5e1, 0xde0a7341, 0x2b467a6b, 0x504f9ce5, 0xa76a173b, 0xaca6cdd3, 0xc372651c,
+    0x4a3a3aff, 0x65f6144d, 0x4e53324b, 0x8b26cd5e, 0xc8327e9b, 0x10939825, 0x64098078, 0x035c7ab8, 0x8542ea7c,
+    0x45189271, 0x9472cf01, 0x52151327, 0xf31bde8b, 0xcb2de1ef, 0x3c0e98b1, 0x4c2ecbf6, 0x5a503d9c, 0xd8666333,
+    0x17027dfa, 0x474a153c, 0x0ca84beb, 0xe5eba6ca, 0xe3c48267, 0xc0a6e0e0, 0xd23af17c, 0x82d340c5, 0x4edba760,
+    0x09f64918, 0xbe648b36, 0xdefc6b03, 0x7980e1c7, 0x7cfcef3f, 0xaeb4ef1b, 0xdb6634dd, 0xebc7feaf, 0xb7cc95eb,
+    0x739f0a20, 0x031a5c6a, 0x20377b98, 0xd93d63c2, 0x59839bd3, 0xb389c1bd, 0xe8646d3e, 0xfbe52e15, 0x7e1000e0,
+    0xc5e447c2, 0xf8d2e132, 0xb4e5e99b, 0xc247f970, 0x6f66c1f0, 0x906c53b6, 0x71bff7e0, 0x7d3fa905, 0x9186da88,
+    0x49afa6e5, 0xd61ebb72, 0xa20734ab, 0x1be4e7b6, 0xc129ef56, 0xef3034df, 0x487b6ea8, 0xd328f496, 0xcc7822ac,
+    0x74622148, 0x22474198, 0xd4379237, 0xbf39a68d, 0xcffc9f58, 0x8f51fa36, 0x22fb18bf, 0x464445bf, 0x95acaaa1,
+    0x072ebdb7, 0xeb48d658, 0x39aafed9, 0xbbfaf371, 0x94047277, 0x74fa43fe, 0xe13a8918, 0x931ef15b, 0x172c68b8,
+    0x03ced234, 0x2d6d7271, 0xa4a0bc1f, 0x48f03e4b, 0xf4cd3b51, 0x266d2adc, 0x82bfc2d7, 0x43daa264, 0x078622be,
+    0x14a31922, 0x5ce6352e, 0xf943a6df, 0x298a6034, 0x65b5287e, 0x529b0eec, 0x71db9a3a, 0x0d6ec796, 0x9a58f215,
+    0x848bf18e, 0xd5bcacd0, 0x0424377b, 0x60e7bea9, 0x420ec728, 0x98064288, 0x70a08ab0, 0xfba38e2e, 0x82943543,
+    0xf215a98a, 0xb05e3e43, 0xbf9060da, 0xc6de35c2, 0xbc973274, 0x6ea5416c, 0x8ebb82bc, 0x3aa9e44f, 0xbe9a7df1,
+    0xc3f7cbea, 0x3c866eec, 0x3301670e, 0x893d84eb, 0x6b863054, 0xee0ccc2d, 0x62ed41cf, 0xdb0d0aab, 0x3759dad4,
+    0x1b239d0f, 0xfb1dbe26, 0x4230b984, 0x3f87f72e, 0xfa0674e1, 0xef9c7a85, 0x09f4f5e8, 0x5363d1f7, 0x6bb529fa,
+    0x441e7e2a, 0xf555c00e, 0xf3b185b2, 0x03371475, 0x37d2a602, 0xbe965bf9, 0x422ee35c, 0x6799988e, 0x4689a0f7,
+    0xefdf68b4, 0x19971eef, 0x962a1e2e, 0x8f89b0b4, 0xe31890e7, 0xf907ac8d, 0x2282df54, 0x7f6d83e7, 0x4305ef16,
+    0x3a44f275, 0x4917095c, 0x12759102, 0x948b0ff2, 0x890f9b58, 0xe32c1731, 0x15a9af94, 0x8915d181, 0x33081a17,
+    0x258d918b, 0xa0b56bb9, 0xc5a20c93, 0xde083f96, 0x8cf6d683, 0x8dd122ed, 0xf20feae3, 0x17edace4, 0xe41d2920,
+    0x198168c7, 0x2e7cc14a, 0xdc5d29c7, 0x91905259, 0xb7328526, 0x3c3016b8, 0x54c5f610, 0x682277fa, 0xcb4d34ee,
+    0xf74034a3, 0xb46bed23, 0xcd4ec110, 0xead86593, 0x6a16e288, 0x543d7a43, 0x57a4e104, 0x39a0c477, 0xe0805e57,
+    0x711c1500, 0x5f6fac6a, 0xf59307bf, 0xa972333a, 0x28f91dd5, 0xf406cce2, 0x7ab4279d, 0x51bf96f4, 0x32f99ad9,
+    0x749d777a, 0xc0d3fce6, 0xd3dc2259, 0x512b61d0, 0x6432c192, 0xad90dc90, 0xcc3c2cef, 0x624a93e6, 0x465afbb7,
+    0x4856dcb8, 0x595a39ea, 0xd0c9b99b, 0xc01582ab, 0x621fe32b, 0x17bc08de, 0x4f315170, 0x544597cf, 0xf86f066a,
+    0x3d428996, 0x205aa14b, 0x1143d746, 0x3ee5726a, 0x7364e617, 0xe7630f32, 0xec9b6f0b, 0x4b99231c, 0x721a6c23,
+    0x1c727b60, 0xa0228e71, 0xe6e48043, 0x7a437285, 0x1df8e040, 0xfed6a030, 0x7a80207b, 0xfbb1ad65, 0xb093f085,
+    0xb7d56b32, 0xd5980bfd, 0x49af478f, 0xda19e375, 0x2203f463, 0x4351e8a1, 0x5c493d59, 0x18028e86, 0xb72792f7,
+    0xc7a890af, 0xcf6c7e7a, 0x87fa7200, 0x70fcb074, 0xda7ab526, 0x456b0674, 0x6d849a9e, 0x1f6552d4, 0x9d16eb5f,
+    0xd9c013b0, 0x6540a2d6, 0x9dd24a7d, 0x3db64f7e, 0x88c6be65, 0xd8af4911, 0x5a284b4d, 0x89a69045, 0x8e25d318,
+    0xab9baa2a, 0x6e772294, 0x44ed37cc, 0x6c0b3862, 0x3f21f075, 0x80d866c4, 0xb9080009, 0xd62a01ef, 0xf73ce11c,
+    0xd5503276, 0x09bceb86, 0x76cad292, 0xf29b22f2, 0xb153a96e, 0xa6a24d1d, 0xda4b8225, 0xa60f31e9, 0xb1dfa09c,
+    0x2e8c5fc0, 0x1ae6568a, 0xb33dda73, 0x5ea87c71, 0x2110be47, 0x17077712, 0xa45546b6, 0x67f3ffd0, 0xeee0cd81,
+    0x6aad6b00, 0xf93b63ef, 0x0f79f9f0, 0xab808991, 0x3e6921dd, 0xbce9c010, 0x6c0d2225, 0xed629c06, 0x34461ecf,
+    0x01e57c2f, 0x0630529a, 0x8dc4b77f, 0xd6e863b6, 0xf481dbb6, 0xf77670a7, 0xc4458afb, 0x03215723, 0x58fecb1b,
+    0x7e4d54b4, 0x3d7cd094, 0x92325319, 0xa05596aa, 0xee9b5003, 0xc2bd30e9, 0x1aaa6362, 0xf4fad7b5, 0xb1409031,
+    0x9df6cca2, 0xdbbeef9c, 0x61df0804, 0xadf3f17c, 0x47ce3a2c, 0xd94685c8, 0xf08dd0d4, 0x0f7c2a0c, 0x426b2d94,
+    0x86b06e45, 0x38e18aef, 0xdc45fab0, 0x51badb7f, 0xc538e51d, 0x6eb166ff, 0x874e8568, 0xadc2e7e0, 0xd89e3fa0,
+    0xdd5891cc, 0xe701a114, 0xcb74c8ed, 0x2e7788a8, 0x5236f886, 0x39edb6bd, 0xacc5dac5, 0x8d421c27, 0x8d5a1782,
+    0x8084ff0a, 0xee60fc2a, 0xcd53b3f2, 0x9dce2adc, 0xa1e1ff7d, 0x8b21866d, 0x9ba84bd9, 0x22697629, 0x4c676aaf,
+    0xb6f99dc7, 0xc98ca190, 0x7e18014d, 0x7f8b10f4, 0xb014198d, 0xdbc6e927, 0x959b7346, 0x94841245, 0x7d40ca55,
+    0x190f38c1, 0x1f605fe0, 0xffb50440, 0x4d3db2b6, 0xf69ae175, 0xe5e854f6, 0x527d7436, 0x0a5e20bd, 0x84f137b9,
+    0x355aa4f4, 0x8af17992, 0x55f5d591, 0xe2158e54, 0x816b6173, 0x403d1997, 0xb6097c96, 0x882ce972, 0xf78dc739,
+    0x7cdb7fd3, 0x47347786, 0x5ae95783, 0x9c78e9b9, 0x0409b32c, 0x32b1cd3b, 0xcebc9081, 0xea21a036, 0x4a9ae607,
+    0x99a0175c, 0x97fdaf1c, 0xcc46dd67, 0x560803e0, 0xcd223e23, 0xbb22e00d, 0xabb034ca, 0xfa84eac0, 0x51c6ae88,
+    0xdafd708d, 0x7858684b, 0x8dbf5c2c, 0x2ccd716d, 0x83f3d441, 0x85e7f4ea, 0xca05b0fb, 0x043d8ecb, 0x1fa6058c,
+    0x95fb4ebd, 0x011afc45, 0x6c680fbc, 0xd6dbb869, 0x081f0ced, 0x67b5b65c, 0x4ce35e72, 0x34ff4c08, 0xa7ddf8b2,
+    0xe6d59f71, 0xeb655b08, 0xe071ad0a, 0xdd4b301e, 0xfb8f657e, 0x3e90bd78, 0x0be7723e, 0xcccd2f9c, 0x4d87e07d,
+    0x97a3ba17, 0x847acffb, 0xc19078f8, 0x4eacbc8d, 0x4de317b1, 0xb50cc7ba, 0x88fa8972, 0x4ab22b47, 0x590c3aee,
+    0x510c41b6, 0x53ef0ae6, 0x976200e6, 0x3da24763, 0x759eea0c, 0xf2e3e037, 0x03a5a4fb, 0xbf46d2dd, 0xf453269e,
+    0x03db4380, 0xe4a0e96b, 0x9f089be9, 0x27b2a815, 0x3b3ca739, 0x69fcbf3f, 0x1e2d10a7, 0xee578102, 0xbba47e25,
+    0x648bca1d, 0x681de828, 0x5a0e4d1c, 0x37acf394, 0x4d9d2a7f, 0x9a4deaf9, 0xfc914ec7, 0x6e8c302a, 0x3a504ef3,
+    0xf8d4a0df, 0x5bd77e95, 0xf08a2498, 0x3992969a, 0x159e0e74, 0xd0d68e1d, 0x49a7df92, 0x8789ec85, 0x61c23123,
+    0xd9f80227, 0x42a0cb74, 0x116db56f, 0x714ab7d3, 0x23460c1d, 0xdb893b2d, 0x9c0ec5aa, 0x3c7d3699, 0xb1b7a4e2,
+    0xfdbed9d0, 0x721f20e9, 0xe82671aa, 0x74bb03b4, 0x48b1022e, 0xa8db6e0f, 0x428045c2, 0x34e9eee0, 0xdd2f8e6a,
+    0x27381f87, 0x349cdca1, 0x0472ddd4, 0x7dd7a2af, 0x6752bbde, 0x95e14213, 0x35e625df, 0x2e42bef9, 0x21e4a9cb,
+    0x257381ef, 0xbbf84651, 0x3f133e5a, 0xe1279084, 0xd63b9b54, 0xa0f68883, 0xd63b86d9, 0xafdb2ff7, 0x5d114823,
+    0x86bc325f, 0x16a7617f, 0xa6a094ac, 0x109f0abd, 0xb35557aa, 0xc4974187, 0xc8eb102c, 0xdafcf62a, 0x0356657c,
+    0xce6fcca1, 0x6a31738f, 0x4ba91240, 0x4d78454b, 0x6ef2b542, 0x5ff87d49, 0x6423cc80, 0xecb8dd8d, 0x2877c628,
+    0xca1f0294, 0xe49c6225, 0x9bbbddab, 0x5dbf12df, 0x265c34d1, 0x7fc02e26, 0x39f2cf16, 0xc039d687, 0x70f5fb71,
+    0xd3baaf09, 0xf97286e3, 0xba4936a7, 0x8407bba2, 0xe6d59dc9, 0x823e63dc, 0xc914e832, 0xd11d40e9, 0xa8ea5eb9,
+    0x0ff261e7, 0x15eb1319, 0x33915176, 0x5b3f95ee, 0xc960585c, 0x9af71abd, 0x4209bb23, 0x9083a759, 0xbf420ecf,
+    0x3967a345, 0x36394a8c, 0x65d34bd0, 0x78fcc807, 0x0595fb1d, 0x7025fdaf, 0x05ebd149, 0x91d71075, 0xda721a9c,
+    0xa2fc39c9, 0xf20c25b5, 0x7d1c33d2, 0x0a64f1c6, 0x0d5096e3, 0x43104ced, 0xc86e999c, 0x3332fa16, 0x8453849b,
+    0x57cfa35a, 0xa2ebe27c, 0x00d4257e, 0x7c4cf1f8, 0x73c9e89b, 0x0031d1ab, 0xf0a76bfe, 0x8e088332, 0x1b1acf0e,
+    0x09de7240, 0x5fd56b29, 0x3deaa4da, 0xae360ef5, 0x690a855b, 0x7cc9e11c, 0x60bd61ae, 0xcf92a29b, 0xd7efbc94,
+    0x03b17ebf, 0xfaf7c518, 0x71b6ea10, 0xe7a0de7e, 0x305e4d04, 0x1b90e589, 0x2f44033c, 0xcf51f4b2, 0x230dae56,
+    0x8bfd1b6f, 0x5aac397a, 0x82b5b7df, 0x6bc1eb29, 0xf13a29b5, 0x4ddec8d3, 0x9bc1efcb, 0xb99c91c4, 0x6fa93bf4,
+    0x958a9bb3, 0xec4caae6, 0x785e82c6, 0x561bcfff, 0x46b643b8, 0x68314462, 0x9cc9526b, 0x053a2016, 0x14efc499,
+    0xa5265942, 0x6bc8da1b, 0x21a14191, 0x828c488d, 0x7f43610f, 0x014394c4, 0xaff8c308, 0x43752ba6, 0xe038ae4e,
+    0x226f5910, 0xe4047ca5, 0xa2755b2d, 0x395d7c86, 0x13ba30c3, 0x661478de, 0xe3cb5362, 0xbcb4c365, 0xad664275,
+    0x0e75f918, 0x35737482, 0xab1a7d86, 0xb1bc75b6, 0x1885261f, 0xb170669f, 0xf0af4ce5, 0x78763a20, 0x9cd50415,
+    0x0282b0e7, 0x1d4251c6, 0xba314777, 0x91ec6368, 0x40656d5a, 0x1f9bc352, 0x728a066b, 0xd8759baa, 0x5d9fcfd3,
+    0x74ab74a6, 0x6ca2516c, 0x9130117c, 0x7e184a90, 0x5d93da5f, 0x01a787c2, 0xf520a519, 0x276adb67, 0xe231e445,
+    0x5f825dfc, 0x151a3f7d, 0xe5abe75a, 0x59a29919, 0x91216653, 0xe9ecd1e0, 0x3c257335, 0xfc3a6d40, 0xd85bc31d,
+    0x32415ea2, 0x5a9e56af, 0x312d6177, 0x3f24001b, 0x1eb8b1a7, 0xe140b532, 0xd80e14a8, 0x7ce42d6e, 0x7b721614,
+    0x654489d1, 0x7818243f, 0x96195bf3, 0xfda92246, 0x9a1b61cf, 0x3c7d52c9, 0x3490a2a2, 0x47777dcb, 0x7ec27c52,
+    0x704286ba, 0x8064e9f9, 0x4f00e3fa, 0xa1e65057, 0x70664e2c, 0x742498ee, 0x7efd8584, 0x659b7410, 0x0754a583,
+    0x848f5646, 0x673fe321, 0x72188220, 0x546dab96, 0xa6d4c079, 0x9317817c, 0xf9b280ab, 0x89db5391, 0x4a24387c,
+    0xea250388, 0x3bbaec32, 0xe3bbefcc, 0xfddeb04e, 0x71ed1e62, 0x1085883c, 0x678c046d, 0x6220d919, 0xcfbe8903,
+    0x7a78f7c4, 0x00d0bb5a, 0xc96a1b29, 0xcab84b62, 0x292de4ce, 0x7f7be7c1, 0xdc6c6135, 0xd69914e8, 0x21cf80ea,
+    0x64505934, 0x5f88e85c, 0xa37bfc3b, 0x06e3e54a, 0x3ff5cac6, 0x419b100c, 0x1b504a5b, 0x0ec5db30, 0x06815b14,
+    0xc06da404, 0xef52d174, 0xc4ad4609, 0x4bb4cceb, 0xf74305e7, 0x0a8f1aad, 0x03cc0b9c, 0x1523d12e, 0x4702408c,
+    0x96558a0b, 0x6dfbb904, 0x42583006, 0x6121f202, 0xc9081639, 0x1d4905f8, 0x7406f0da, 0xfd7abc92, 0x4fce9c11,
+    0xcadee92a, 0x215ee28e, 0x304787f5, 0x5475e6d0, 0x941b9f60, 0x3fa5b65b, 0xc653e51b, 0xd0d4c51b, 0x9d832998,
+    0x64d9a1ca, 0xc5b71513, 0xbec78c7b, 0xd6aa94f8, 0x671a438e, 0xc8c4d5d5, 0x6e8ba6c9, 0xa0a1671a, 0xb7345e86,
+    0x44e251ee, 0xc6f13931, 0x8880c8e0, 0xd35bf989, 0xae323a74, 0xfc53f07d, 0xd7820a2c, 0x7ec426b4, 0x7dafb303,
+    0x4b4c6d8d, 0x561f9520, 0xe8c2e945, 0xe7c2537f, 0x1cd6566e, 0x32a516df, 0x4172108f, 0xac3025fd, 0x89baccd7,
+    0x5f19bf12, 0x1e76df7e, 0x32842f96, 0xce4e11e2, 0xa2860419, 0xf11f0c7f, 0xcb81c931, 0xec649f03, 0xc948c6b6,
+    0xc43ce9ef, 0x34adf94f, 0x3af98753, 0x07b7fc4a, 0x131d9d5f, 0x506d286b, 0x11507bf2, 0x574c45f9, 0xbadf2f15,
+    0x432c64c0, 0x109b2b07, 0x2aef15fb, 0x7c6e6e03, 0xb1984fd0, 0xeb251e71, 0x1374a4fd, 0x5c2b55d3, 0x572576c3,
+    0x58eef9cf, 0xb49d72d8, 0xf0e98819, 0x35fb2f68, 0xebab9326, 0x9e499e02, 0x30c34e47, 0xb926ab35, 0xa6770b9d,
+    0x7b89dbb4, 0xc5105dc9, 0xbfc9d7a3, 0xb8414483, 0x18478f1b, 0x9b2a1f06, 0xc0cd7f69, 0x80237116, 0x449ce963,
+    0x77ad1c3c, 0xb8189618, 0x2025533e, 0x7514b7a0, 0xd5f96aab, 0x3080a187, 0x5daf5bb2, 0x8a764215, 0xbe75edaa,
+    0x7e0cec9e, 0xbd083e31, 0x5701b9d9, 0x96cbbd60, 0xa97ba14f, 0x3caa93b1, 0xecf33e89, 0x5bf33d73, 0xf5290ffc,
+    0xf4982f1a, 0xdf9d7f90, 0x3f4d7434, 0x260be088, 0xd969c085, 0x04131819, 0xa7b85205, 0x7d5ec134, 0x3c9d735c,
+    0xe410f9c6, 0x0b880392, 0xb6a4507e, 0xda1fce35, 0xba8b8d08, 0xbbd6b925, 0xc128fd1e, 0x04fa2db4, 0x0e3a6074,
+    0x8a182a5d, 0x9f58a998, 0xcaa5a756, 0xa08d90b1, 0x77c68671, 0xa89279fd, 0x90a2b8d0, 0x5bd707ec, 0x18da8a55,
+    0xb7652bd5, 0xc6b1d54d, 0xabbc7e6d, 0x89db08dd, 0x8e96c7a4, 0xa1c19aac, 0x37a158ad, 0x87a10a5c, 0x17b86b78,
+    0xef2ad906, 0x0af37205, 0xccd89cd4, 0xef67ff69, 0xd2d3b887, 0xceed7e71, 0x417e54ed, 0x41122d3e, 0x864faca8,
+    0x02f63431, 0xab2f2a2d, 0xe7e8755b, 0x00259e38, 0xd5386636, 0x9cc2af11, 0xbd20c984, 0xd259498f, 0x5dc361ed,
+    0xa2de805c, 0x4403cdae, 0x0aac2e07, 0x55b917de, 0xee408f68, 0x1ced187e, 0x6711a43e, 0x4a8cbc0d, 0x095363a6,
+    0x42061585, 0xb288735d, 0x8f964ca6, 0x4ee62b19, 0xf334bbb2, 0xa0b260b4, 0xf86d1913, 0xc4c4e48c, 0x820bdcc6,
+    0x4652533e, 0xc314a39c, 0xdae1bcac, 0x08359e57, 0x75b8fec1, 0xb829caa5, 0x769eba82, 0xfc99cf44, 0xecf18d71,
+    0x6cae9ae5, 0xbe177fb2, 0x2dcd2046, 0x2f46d309, 0x9eed166f, 0x80e6fd91, 0x70f1a343, 0x2c18a70b, 0x0141ab09,
+    0xf400d2a1, 0x4f7ab75a, 0x553dc38a, 0x01fdb0aa, 0x2cb3cb38, 0xbc76bfdf, 0x56a15307, 0xb2d9931f, 0x65121151,
+    0x4c88157d, 0xc4af8812, 0x72e642b8, 0xf62dce33, 0x7bc139da, 0xcb80e339, 0x9c07b446, 0xe4d3e3e1, 0x43bd2241,
+    0x0c2c3d59, 0x3094c670, 0xfe55f98f, 0x0e7633b8, 0xb848e306, 0x5a681727, 0x820f32f6, 0x790ed418, 0x90542f1e,
+    0x301ce5c0, 0xdfec317c, 0xc8cffc76, 0x4b702278, 0x5fafde23, 0x8e09ca50, 0xf8f74abe, 0xb4ab8f8a, 0x1787b0d3,
+    0x307914bc, 0xbea4bde7, 0x0a7c5c95, 0xb1274fd4, 0x4244321d, 0x68284faa, 0xf8a4fcaa, 0x00777a55, 0x87f7a55e,
+    0x020e8c1c, 0x9cd713be, 0x6c79d6b8, 0x6fd8bd76, 0xd0078d05, 0x6f1254d5, 0x416c068d, 0x12319c1f, 0xa7d2dc06,
+    0xb38d655b, 0x3005caa4, 0x569ec82b, 0xb4fd9aba, 0xbec3212b, 0xe8d83fae, 0x291c6884, 0x737f25f7, 0x95f4c6c8,
+    0xdf0eeb76, 0x2fc39662, 0xf65fc383, 0x4914aec0, 0x0182c3ea, 0x6248e4e4, 0xf1405ee8, 0x36fb6ef0, 0xa5d5fd7b,
+    0x4230c1c5, 0x664d6bb7, 0x874d3b25, 0x672dbb4c, 0x573bc226, 0x69cdc5b6, 0xf8a67dc4, 0xb0d96a7d, 0xf9c742b0,
+    0x59f55eda, 0x7b0f8fe2, 0x2d04b33f, 0x58c53c7a, 0xb1996b4b, 0x9e694778, 0x4fc6bfad, 0x00137284, 0xfdc68000,
+    0x3cd466e3, 0x4c7551f5, 0x61e13c9d, 0xf67d5799, 0x24d49b76, 0x0eae02b5, 0x9e6ccb8f, 0x2c8d8796, 0xb229905c,
+    0xbeaaace2, 0x1624718d, 0xade5b4b0, 0xbf05f0ae, 0xed5b6179, 0xffd78bed, 0x972e47a7, 0xc0ad8246, 0xc4877495,
+    0xe39578d6, 0xe42c3cab, 0x81778d90, 0x3ad9fd51, 0x8d92dfdb, 0x4095bf2a, 0x16ca0582, 0xc5900164, 0x20191d7c,
+    0xab5b3968, 0xf5d964e6, 0xb44f9d55, 0x5c08cb1a, 0xe3003d7f, 0x5bdeb219, 0x76e84576, 0x9678b671, 0xf5db12ea,
+    0x3e872c25, 0xb612a410, 0xc624eaef, 0x1a8a982a, 0x3252b222, 0x9a2b3e1c, 0xdab82163, 0xd37f4b04, 0x537f8e70,
+    0xc6f73908, 0x7626fa5c, 0x831c9298, 0x4378785b, 0xaaf97650, 0xd7b348ef, 0xaf993a25, 0xa3f438da, 0x8fafb713,
+    0xfd9e6e55, 0x920a6d37, 0x5ac7cf73, 0xc9d416c3, 0xf107cafe, 0x5a980779, 0x9ad3f292, 0xc7e21fae, 0x6a99d9f0,
+    0x16b3b500, 0xa1f079a6, 0x061d7455, 0xcfb8c906, 0x47d21939, 0xe914025d, 0xbd1f7db1, 0xc98e245c, 0x12b877a8,
+    0xaaa09c1d, 0xd13cdbf7, 0x58159958, 0xbfa2dff4, 0xc0e488b4, 0x0ab134b2, 0xbd8d5aec, 0x06cb53ca, 0x76720b11,
+    0x8bd0d06a, 0xf64b9ea4, 0x6430382f, 0x128c5a92, 0xd51d6660, 0x351ca992, 0xa7ea1fcb, 0xf91d06e7, 0x9b5c7604,
+    0x4f54ef8d, 0x81646253, 0xde678c45, 0xec1b37fb, 0xf8c5e9fe, 0xc52b23b4, 0xd0c24c5f, 0x3c6aa0c6, 0xed84481e,
+    0xcb34fc24, 0x8771fd35, 0x4ce04f80, 0xcc0693c2, 0x321de8a3, 0x11c06e0f, 0xcd13dddc, 0x26556e77, 0x00322dcd,
+    0x66dbe106, 0x95ab58cd, 0xa255a5c9, 0x53bc5f1a, 0x42b63eb2, 0x85ccc9df, 0x479b2335, 0x405dd25a, 0xe3b388ad,
+    0x60699400, 0xe945e2db, 0x3b622794, 0x8ab5077e, 0x2a0598ce, 0xfd93aba1, 0x0faf83e1, 0x5dc0cc7c, 0xc011bc37,
+    0x2807cad4, 0x608cb60c, 0x2bd36a51, 0xc5e576c9, 0x34ff9f0d, 0xd9266de2, 0x0ee9b6de, 0xa8b35bb0, 0xaeeb3bc8,
+    0x2c8edf3f, 0x39ba6648, 0x673f9a9b, 0x31f9e63c, 0xb287652b, 0x7aca8021, 0x4a65844d, 0x2399ab44, 0x877962c0,
+    0xda1b5cff, 0x5f10709a, 0xf94542ea, 0x9ac9c996, 0xea30b8ef, 0x6d8b196c, 0x046813da, 0x83b8d547, 0x3fe9032d,
+    0x7a1849d7, 0xc40e0d03, 0xac9d0c5b, 0x3f12f34e, 0xb1d1b66d, 0xc0b32e4c, 0x31248cf0, 0x8033149f, 0x378fabca,
+    0x80e93a4d, 0x8a94e2a7, 0x0f4fc864, 0x7732229f, 0xaa736d5b, 0x3f47ee68, 0x21a015d6, 0x8d6dfd9e, 0x5550dec0,
+    0x6c7780b8, 0xc4804340, 0x1b4f7fc1, 0x8cbf248b, 0x65ec0ad5, 0xf696e1b2, 0xf7389f9b, 0x935c5233, 0xebbc7704,
+    0x9b429faa, 0xad8e9abe, 0x2ceec178, 0xccfdb257, 0xc9126945, 0x4dcfc00b, 0x8b26e06e, 0xb13b2e7a, 0x0f1947a3,
+    0xf05b6898, 0x16b1216c, 0x7f134ada, 0x450cbed9, 0xe721b9f0, 0xec744317, 0xd1b17377, 0x5a62b94f, 0xcf9c3e92,
+    0x3314b6d4, 0x32e0f91d, 0x4ce78bce, 0x74d3c13f, 0x44f17583, 0xfcb25265, 0xc48c0136, 0x0e1e148c, 0x16690520,
+    0x161c1289, 0x21362bf1, 0xef7a2641, 0x7a4754bc, 0xba0d9109, 0x8d5f85ad, 0x57c08e6a, 0xa6cbd9c0, 0x52fe41b0,
+    0xa1944e49, 0x66cc72ff, 0x095f9d1b, 0xe75ea6a0, 0x05017888, 0xfec28876, 0x9a051ff7, 0x8e8a8f96, 0xab1ef991,
+    0x1a05a147, 0x17947799, 0x0221c487, 0x14e8c0fd, 0x2b96dc0e, 0xd5b7151e, 0xf33a7fb4, 0x95ac16db, 0x903ee66a,
+    0x001869bd, 0x0abfc039, 0x34b26572, 0x9af9ae6d, 0x696cc1a3, 0x0b9c5d69, 0xcb25d8b4, 0x0cbb7bc5, 0x25df0991,
+    0x06de0bf9, 0xfbaf571e, 0x7a906b23, 0x66312a1e, 0xd32e7a28, 0xaf2f116b, 0x78aba6b9, 0x8ff127bd, 0x9479afa1,
+    0xda6fcd1e, 0xc31c7702, 0xedc61274, 0x8f4df163, 0xeb514c1c, 0x782c559c, 0x43ea75c0, 0x09e5f482, 0x2031f7bb,
+    0xf38fadbd, 0xeb4455d3, 0xc78e1835, 0xa30b2b88, 0xfb1b43fc, 0xc23808ee, 0x91ff3230, 0x0121cc52, 0xf338c31a,
+    0x66a43738, 0xa71a6c8a, 0xda68bd60, 0x746f09af, 0x08939eb7, 0xef1e0271, 0x4bcbf418, 0xadd005c4, 0x96ac1282,
+    0xe13032d4, 0x669c44a4, 0xabbbe9f4, 0xa92f040a, 0xf5d66ee2, 0x4eeba426, 0x7f1c0a27, 0x2616a6c8, 0x35db7883,
+    0x0f256f43, 0x7e1156d5, 0xd943b715, 0xccd23a4d, 0xb0678fef, 0x87be5022, 0x73d2d74f, 0x68367ae2, 0xe329f243,
+    0xa8ac3ebf, 0x2b604cd8, 0x83245959, 0x9a3f8618, 0xf6f6793c, 0x67201350, 0x34557cfd, 0xb9c6732f, 0x88c931d4,
+    0x129815dd, 0x1c7d9804, 0x89dab0de, 0x101e382e, 0x4d253d7f, 0xe21dcfce, 0x930ced78, 0x7f863406, 0x94580765,
+    0x4090e829, 0xfb563ee9, 0x1bb546a0, 0x1cf58151, 0xef0a8c1a, 0x2d725bdb, 0xb1493f5a, 0xdc9238f9, 0xebb7be0c,
+    0x67711241, 0xcf15a056, 0x13e4e5f7, 0x6af85a6f, 0xc587be48, 0x258bdf0c, 0x6de9948c, 0xc2bb63d0, 0xcc8ba5e3,
+    0x50fd8cb8, 0xed8f88aa, 0x9b0b1cbf, 0x836bb7cd, 0x9b1cd340, 0x77f1bfe9, 0xb71ddcf6, 0x63a0bf70, 0x45f137d6,
+    0x9595b15a, 0x6b7ad3bc, 0xe6d9e6f7, 0x559dce01, 0x879f68c8, 0xb004acbf, 0x1e4838b5, 0xd6bf5580, 0x28ba2e2f,
+    0x0dd95e51, 0xac3c6740, 0xa3c53019, 0xf294e1a1, 0xf8a06857, 0x612f3eae, 0xeff55247, 0x54c783e5, 0x1d61d48a,
+    0xc3a0ef2c, 0xa8507ffe, 0x5e99837a, 0xb62aae11, 0xc9bd37c5, 0x9d5dc190, 0x0a9b33a9, 0xca104881, 0xb81df183,
+    0x4fb6fae1, 0x3eece06a, 0x743fbede, 0x7437f563, 0x58245d94, 0xd7c83eab, 0x1cdeed2f, 0x2b1fb4d4, 0xb94647ea,
+    0x09c5396c, 0xf5777c50, 0x8cd6f46b, 0xc757385d, 0x876eb377, 0x50a40c5d, 0x3819ea7a, 0xd7b48b15, 0xb6e47977,
+    0xa286ab59, 0x7effcca6, 0xd260a4d9, 0xf07c413d, 0x6082e4ee, 0x5ffa5cd7, 0x3b332657, 0x18b0bc12, 0xd378f922,
+    0xcf48dbf6, 0xa0833341, 0x469cb65a, 0x465ee304, 0x81d630bf, 0xb914b95c, 0x52d2066a, 0x6958aa90, 0xc6de936f,
+    0x557d3d9a, 0xb7c62d92, 0x912b8197, 0x2149e390, 0x8c6ad3a2, 0xc13be708, 0xee6747f6, 0x8c08b040, 0xef966d61,
+    0x9d09328d, 0x0a4e3245, 0x659d7f22, 0x7023c706, 0x3bca65b1, 0xb70df260, 0x7f9797cf, 0x508dc7c0, 0x6dbdddf9,
+    0xf13a0182, 0x92c8a8fc, 0xa006fd0f, 0x9e4686fe, 0x89d6e07c, 0x151ec199, 0xf76b231a, 0x9b5e29b3, 0xc5bb2b03,
+    0xf9b0fdbc, 0x8e4d5e79, 0x29418372, 0x36a2fa44, 0x177962d4, 0x176273cb, 0x2824b3b0, 0xf5dc745b, 0x63820c8b,
+    0xdc03fe4c, 0xbb9854b3, 0xf093efe0, 0xda6a8c71, 0xbb5138c0, 0xc4ee8037, 0x40481b38, 0xfe68d259, 0x2dfbcac9,
+    0xf960598c, 0x7787fb33, 0x034ae8da, 0x40585937, 0xd6466d6e, 0x5146fb71, 0x06dc11c3, 0x855fd86e, 0xd3e3b44b,
+    0xac10dd70, 0xac528b44, 0xfea1e7ec, 0x7d4410be, 0x00867c33, 0x576f1963, 0x5884cfc8, 0xb97f4246, 0xdbbe51ea,
+    0x32bdd88e, 0xca6ff953, 0x4b5217fa, 0xdc970a1a, 0x428ce7b5, 0xa8b80546, 0xe2d11bb3, 0x563cc404, 0x64a4d7ad,
+    0x75adfdf3, 0xaede7be4, 0x64e7a5b1, 0xb47c7889, 0xf29f8ea4, 0x80dc5678, 0x176099ec, 0x21b27641, 0xadcba258,
+    0xf1cc396d, 0xb8f72934, 0x5efae44f, 0x1ce7b41c, 0xff4b7367, 0xaef060d6, 0x15bf7ee2, 0x5f61a5e3, 0xc2ff6a20,
+    0x16b7f403, 0xe1043836, 0xab6aa617, 0xea5772e7, 0x8c1655ee, 0x4b77560d, 0xe1e7df63, 0xb200aeb6, 0x6cee7d46,
+    0xca305b58, 0x18a20ba7, 0x83693bfd, 0xaddfc58b, 0xfd2b981b, 0x78103dca, 0x68b00b86, 0x0c5a3369, 0x4e480847,
+    0xc7f81edf, 0xdc7a97dc, 0xd93f4215, 0x03fe912b, 0x714a9fbd, 0xdd8d008b, 0x26f09a60, 0x62228fcc, 0x687b4519,
+    0x13ef0545, 0x3d7ce727, 0x3c94c18c, 0xb9dfffde, 0x8e8b1ffa, 0xd37354d8, 0xf17d7efc, 0x4e9b0360, 0x7060846b,
+    0x2dcc5cd3, 0x80baebc2, 0x45a1f491, 0x647497ca, 0x7cf37e74, 0xc7056642, 0x0f0ad219, 0xc2a81324, 0x4c002419,
+    0x17c1d980, 0x35108904, 0x2c383758, 0x9a9a846d, 0xeb833d6b, 0x7e061461, 0x2f2f0f8d, 0x554510d7, 0xe046edf7,
+    0x4a723dfd, 0xba9ea399, 0xc2b22139, 0x37f58359, 0x46c11292, 0xde02566f, 0x1a3f22d4, 0x9ad75c6e, 0xd5d526b4,
+    0x374c4e95, 0x1e67045a, 0x8ff4ff9c, 0x868f1a84, 0x99c3bd90, 0xc61a80b1, 0xb908ba9f, 0xec2675f4, 0xf5a80821,
+    0x335baefc, 0xc963a804, 0xbc2f3723, 0xc8cc9ab7, 0x84858dc5, 0x44ddcf04, 0xdf799e55, 0x65cb9517, 0xade4a5fe,
+    0xd71e82f2, 0xcdd245ec, 0x688e1f0f, 0xa8f78b6e, 0x4ab3c087, 0x976c926e, 0x2ba5fd19, 0xba3cdbd1, 0xa053a030,
+    0x40e065d8, 0x01ad9e9d, 0xf6b7236f, 0x2c11f3d8, 0x0dd77f9d, 0xba767bff, 0x005563c3, 0x5df3afd6, 0x97b084ba,
+    0x9838271d, 0xcadb538a, 0x1ce4198c, 0x278b78fb, 0xa0af6488, 0xa5ea1122, 0xf1fec19f, 0x296651ef, 0x50a42439,
+    0x4a016cd7, 0xc7767edc, 0x77837dc3, 0x0e3170fc, 0xd54ee136, 0x870dd1d4, 0x6a6ca604, 0xd9dc1e03, 0x7de23e32,
+    0xb20843db, 0x2c9910b7, 0xb9c4039b, 0xc4bb8d43, 0x0241c669, 0x69c2397f, 0xe52ae11d, 0x3c55ab47, 0xf44adfde,
+    0x7e612847, 0xf76fd159, 0xb37c4e4f, 0xc390adf3, 0xb102af3a, 0xdeeda0d1, 0x3651ad5c, 0xe6c83c9b, 0x37c55fc8,
+    0xbe2a0c33, 0x8aa44b81, 0xa5107ee4, 0x98b6ba56, 0x646ed242, 0xe3209469, 0x47f7f1fc, 0xbfca96f2, 0xe2516a83,
+    0xca0512ec, 0xd8087e89, 0xc1912d87, 0x7018d14d, 0x6711d373, 0x9e8fb5bf, 0x3082a5fd, 0x7861b5ec, 0xca59fbeb,
+    0x6d5ebf94, 0x231e2d8f, 0x5f8f80ff, 0x2e48eb2b, 0xdc571f84, 0xf4466d9a, 0x0e3283a1, 0xb4c8b6c4, 0x7c2f5bb0,
+    0x36888d20, 0x87b6cf2a, 0xef17d2f5, 0xc08e4576, 0xd0608282, 0x5fc08125, 0x70534bf5, 0xa24f0ae4, 0x5af568c0,
+    0x94f96f9d, 0xd251e55e, 0xc5cc412e, 0x5c6cc96e, 0xade6a5a7, 0xcc9604b8, 0xf45d983d, 0xb8e65214, 0x95b67036,
+    0x3bdc8dd4, 0x2035f6c7, 0x3b2b854e, 0xb7d964c9, 0xbe734727, 0xe6be5d98, 0x9d594128, 0x31cbef1c, 0x2ca19785,
+    0x76e73266, 0x119dabc2, 0x064d9ffa, 0x8df6bed4, 0x6b9a9e89, 0x809b8772, 0x0a486afd, 0xd549c4b7, 0x5335ba1f,
+    0xe2114586, 0x0662be07, 0x5c9ddc6d, 0x7e0aa964, 0x6e455a46, 0x19f1f49a, 0xf0a444c6, 0x79370059, 0xf2d90f2f,
+    0x66fe180c, 0xbadfcf50, 0x4399e4ed, 0xb3579106, 0x6d3a3710, 0xb97a4a21, 0xcefe58d5, 0x9fedc827, 0x0ac88b42,
+    0xc2b1d3c0, 0x2686644e, 0x85c79393, 0x5cb21274, 0x436b7c1b, 0x4ec11eff, 0xb39a6e12, 0xef945f7f, 0x6928634d,
+    0x6ad008e8, 0xf4e9c62e, 0x43365ce5, 0x28707430, 0xa7421fb2, 0xd8f9abac, 0xea31cacc, 0xb37858bb, 0x4ddb81a5,
+    0x99a0aebf, 0x84e60ab6, 0xb0030f7b, 0xdc035eec, 0x4a42519a, 0xf95cfec2, 0xdbd51dbb, 0xfb002083, 0x63677d39,
+    0x61dba037, 0xf2f716e4, 0x0f42ecc3, 0xf9249deb, 0x55a19487, 0xd9953706, 0xd9643519, 0x56216aac, 0x05420805,
+    0x766d9014, 0x725991a7, 0xb418c296, 0x641e32e2, 0x5c19fc24, 0xe20b22b6, 0x2ccb6d5c, 0x6f7273c1, 0x80d37c02,
+    0xfbd60145, 0x9abb1936, 0xdae71516, 0x1a006c9c, 0x743e303c, 0x3498a9ca, 0x18044640, 0x632616b1, 0x9d1b791e,
+    0x0d7bc0cc, 0x9ad21e6f, 0x7137d1b4, 0x303cad86, 0x6033ff5f, 0xae9c6a3b, 0x798e77c2, 0x6e8f7ada, 0x91d67ffd,
+    0x218aae25, 0x42acc224, 0x208021ee, 0x67412ae1, 0x6495e1ab, 0x47cde9cc, 0x5299bec1, 0x10f5a6d2, 0x2bbcabd4,
+    0x7645f66e, 0xf985d84d, 0xace4701b, 0x13f89aca, 0x350537f0, 0x7e55a104, 0xe607ca04, 0xbac99f1d, 0x0bfdabd7,
+    0x9eec13d5, 0xae193a9c, 0x83f7ef5e, 0x8c4e3244, 0x76f41b2f, 0x96036689, 0xf618f886, 0x491ae0cb, 0x63117610,
+    0x24092a3d, 0xfd7b5a32, 0xc9ac21bc, 0xb0f7f85e, 0xe874db18, 0x9290e072, 0xe4ad3a7f, 0x24e211ef, 0xf893e32c,
+    0xb5dc141d, 0x583b0ddc, 0xcc9cd893, 0x32409f9c, 0xc75da738, 0xb3ce726e, 0x1a6e5691, 0x71f59649, 0xeb094f75,
+    0x40b1391d, 0x4bbeab2b, 0xab7b174a, 0x861718fb, 0x1869f4c1, 0xf2d60ea1, 0x49a71d28, 0x8e8256d1, 0x6bb483ec,
+    0xef35e9e2, 0x4aa6dd19, 0xc1506347, 0xe2b041df, 0x635f7034, 0x3ddb0cb9, 0x7733190e, 0x057e8294, 0xb6f6a1d3,
+    0x699b86d4, 0xf231ec4e, 0xd83cb0bf, 0x74f39f58, 0xd83937e1, 0x7be99133, 0x9e09d799, 0x30b48568, 0x2dca7161,
+    0xfcac4cee, 0x0ca679ac, 0x4033fac8, 0x79c6585d, 0x713edc39, 0x1955a47d, 0x46552347, 0xfdcc9893, 0x9cd1b604,
+    0xbb4e7073, 0x27e5de44, 0xe537aa5d, 0x12355c10, 0xfa919ad9, 0xfeac7efd, 0xc0729e74, 0x2b5228de, 0x7ad9c1af,
+    0xf051d659, 0xad88d6a8, 0x21661aad, 0xf08661d7, 0x606d9020, 0xcf74f4eb, 0x6b8ecaff, 0xe0310dbb, 0x60f3ac8a,
+    0x050c3c51, 0x100d3a54, 0x94a6a7c3, 0xcc196243, 0xb75176da, 0x7307847e, 0x55aec3ee, 0x1c9a94be, 0x83f2b81c,
+    0x406c26b3, 0xd17b4137, 0x37691686, 0x3d5e06b1, 0xeb7ef346, 0x82dd0524, 0x7b9322cf, 0x4c48a470, 0x293b6900,
+    0x3e6b830a, 0x03153078, 0x88b3d4f5, 0x70bf432c, 0xbfe897ef, 0x6a6c0910, 0xa9fca897, 0x706305dd, 0xefd89017,
+    0x503e62f5, 0x54dc0063, 0x5fa92006, 0x811d356c, 0x6ee9232c, 0x784ba9a5, 0x4f0c7165, 0x0306e7a5, 0x8361b8b1,
+    0x3ca0b3ae, 0xd9c3cdaa, 0x72a274cf, 0x1b4eb239, 0xec08ef90, 0x246cbc64, 0x6fe495d9, 0x10f24871, 0x3f38c80d,
+    0xfddfaa83, 0x7ffd18af, 0x7b3a8f6f, 0x477725d3, 0xb269dc18, 0x0f1a8a60, 0xac76ec07, 0x5aad9bf8, 0xac7a6c5f,
+    0x19e87ecd, 0xc49731e0, 0x6e9c5401, 0x96567c07, 0x62628947, 0x6431b029, 0x312d2dc0, 0x1948212a, 0x7b6027ea,
+    0xbf00c236, 0x049a382a, 0x96fc1366, 0x731e4719, 0x6c6df6b7, 0x76af4442, 0x7b8b240d, 0xe26df8f0, 0xc91e6819,
+    0x4f8e26a2, 0x0677312d, 0x2fd3200e, 0x697235f2, 0xaa716ab7, 0x33269507, 0xb4ee0b7f, 0xe29f877a, 0xcfea0128,
+    0x2f3a50ce, 0x21194758, 0x41e62013, 0x5eaa53d0, 0xdead1ccd, 0xe51ada72, 0x9cc95193, 0x199fe089, 0xaac475b4,
+    0x1d4a323b, 0x1d60ce82, 0xd52728b2, 0x54b49445, 0x8016ed15, 0x626d92e7, 0xc98e2853, 0x5f26e121, 0xd6528a2b,
+    0x9f14ff0a, 0xbf4872c3, 0xc8cf33f9, 0xe1a77d1f, 0x9a2e7325, 0x0ee857a2, 0x0cb04a80, 0xc8523d28, 0x237ff31f,
+    0x68e06684, 0x85caabee, 0x980517a4, 0x9e83eb1a, 0x07d1b0e5, 0x12b125a9, 0x9901bd22, 0xfe983b22, 0xe71c1968,
+    0x265a4383, 0x98e04336, 0x3b8c517c, 0x0fcffbc8, 0x1ba37fdc, 0xa1c03f5e, 0x9bda0354, 0x05ed6197, 0x25310635,
+    0xcf60afe7, 0x5347593f, 0x90b1d317, 0x2cdf2e9f, 0x6cd14d68, 0x140de615, 0xd9bc75c4, 0x8458dac2, 0x30f19a18,
+    0x281545b8, 0x135988df, 0xc71c83cf, 0x6cdb976e, 0xe5b491a3, 0xd3538782, 0x535f7b80, 0x1a771580, 0xb0839225,
+    0x37de7721, 0x48cbdfd3, 0xff96ecc8, 0xf3674c20, 0xfdea382a, 0xdd5017d3, 0x211a8aaf, 0xf814f92b, 0xef8ea39b,
+    0x40e5225f, 0x6d2d5238, 0x16b95a06, 0x9cc57c67, 0xecee73e3, 0x596f01d2, 0xde37ebd6, 0x75306b9d, 0xc8934d2a,
+    0xf6205b10, 0x80b69445, 0xe5193219, 0x9772819e, 0x986da88e, 0x522fe0c1, 0x3d64449f, 0x4b54c160, 0xf417c258,
+    0xf5cc456b, 0x1f7ea730, 0x38164c35, 0xc67081ef, 0xd3680e52, 0xa7d85d18, 0x1cfa2f7c, 0xf66b739d, 0x1aa9feac,
+    0xaf00df5c, 0x5541c1f6, 0x973e0357, 0x74b19f85, 0x51ec501c, 0x1f30c5f3, 0x458ef1cf, 0x68f26386, 0xe9a2ba63,
+    0x7d4629ae, 0xae05de4d, 0x37f62c1c, 0x9be22ef9, 0x82dc762c, 0x6e3c7d2d, 0x6749aae7, 0xbba121dd, 0xbc720e51,
+    0x9d1a90c5, 0x5ff91625, 0xc4ef67ea, 0x528a64ef, 0x21afbf53, 0x14ac9b5d, 0xcb9749bc, 0x7a745197, 0xa0eee766,
+    0xd1fceac3, 0x389fcd30, 0xc3e1e6d4, 0x4bbcb080, 0xe3b89af5, 0xd55e7ab6, 0x673145e1, 0xdb69532b, 0xbf93d1f2,
+    0xc7b8568c, 0xf007bdc8, 0x338d271e, 0x5c495f69, 0x160b9a79, 0x5c2b61ac, 0xbfdb890e, 0x95552f2c, 0xab4ecb8e,
+    0xa60a8c12, 0x06e961c6, 0xb2475034, 0x62cad560, 0x801ab5e1, 0x45584cb7, 0x113af72e, 0x46fb2cc6, 0xf444c31f,
+    0xc1ecd6fc, 0x204ebe7e, 0xc7bc1163, 0x23910445, 0xb79a5fb7, 0x4e499307, 0x1429fe46, 0x352adad6, 0x5aabab43,
+    0x81ea316f, 0x23482492, 0x5d2c7b1f, 0x4e7ce4a5, 0x693309be, 0x12931ce6, 0x516b2c9f, 0x9da2ef30, 0x26835e68,
+    0xfd0894f7, 0xa6b1c074, 0x94c52856, 0x9cc3464e, 0x67e0f2c5, 0xf1a41690, 0xf845db29, 0xa82b53aa, 0x8ea34b81,
+    0x29e245b9, 0xf35bf317, 0x1073f95d, 0x51488849, 0x2468a5a7, 0x5892d50a, 0x33b0fe72, 0x5baea3d4, 0x1cf07f39,
+    0x04c980dd, 0xa35b5ffc, 0x1717a3f0, 0x8a27a793, 0x1d540a24, 0x3ea7e2b8, 0x24e701f0, 0x7cc35630, 0xad7df873,
+    0xbde2aa24, 0xe12b1baf, 0x254eee81, 0x60fb8c3e, 0x06099123, 0xafd662d3, 0x61cf5894, 0xaa283fda, 0x2ea2079d,
+    0xad57b4e1, 0xb0bc6aad, 0xee68f4a8, 0xf277e2e0, 0x76c3e2ad, 0x3f11ed8c, 0xf81209ed, 0x42526bda, 0x57524d8e,
+    0xea09febb, 0x88d66f03, 0x79597bb1, 0x4d9fc7ec, 0xdc00c40d, 0xefa3b5dd, 0x9d3879d0, 0x5acbc3bc, 0x4562e3c9,
+    0xfe034da0, 0x2c499d37, 0x89309abb, 0xc2e2cd82, 0x5da9c0e1, 0x4c71b7df, 0x658600a8, 0xa4fbd5c5, 0xedde6041,
+    0x1bd50b02, 0x75c04a6f, 0xc02e63d6, 0xc3419b67, 0x4fdf6c2b, 0x6fc6a68c, 0x1e5714a1, 0xc30b978d, 0x13c1ff7e,
+    0x3b69bc68, 0x0dc0b859, 0xabbbc1a6, 0x2c3e481c, 0xbe5da3eb, 0xbc5971dc, 0xb0d931e6, 0x2901f616, 0x8f4e4b4a,
+    0xb8f2beea, 0xc9f7d01f, 0xf9007cba, 0xb812401f, 0xca2936d8, 0x724bef9d, 0x4b201b7a, 0x5342b647, 0xcf563116,
+    0xde74f7bd, 0x07096002, 0xfe58a5a6, 0xc5ebb5e5, 0x26161fcf, 0xc6df9592, 0x42b072d6, 0xf82cb4cf, 0x7393224e,
+    0x8ce12dcb, 0x28ac78a0, 0xfa2ebf08, 0x1d2b1a55, 0xbb978a34, 0x76e1d5f1, 0x786d2ab4, 0xbdccdbc6, 0x2813db34,
+    0xec38a334, 0x38850be8, 0xafee4a33, 0x74e6b4a2, 0xc9ffb99e, 0x42acae9e, 0x807fd379, 0xddd88979, 0x97c9bab5,
+    0x3314f32e, 0xa35e2573, 0xcf951bfb, 0xfecc70de, 0x2c393ceb, 0xf19c05d8, 0x7741f468, 0xbdf1e8b4, 0x63effc80,
+    0x66a8cd85, 0xac96c54d, 0x3e77b140, 0x49352c87, 0x822d4774, 0x8872f2be, 0x8ca96d1f, 0x5576bb2b, 0xd8c33ecd,
+    0x7a6a3a7a, 0x75e1e086, 0xc23f999d, 0xaa2f8a31, 0x819d0869, 0xcad06158, 0xb2d69dc9, 0xef222ff4, 0xa2b7eece,
+    0x0e8c7c28, 0x0f4f9ecc, 0xeb650f91, 0xb1cbc5cd, 0x293519e6, 0x99c12b27, 0xd4888849, 0x5f60be68, 0x9c3d92a6,
+    0x87488917, 0xc93ee20a, 0xa0950f5a, 0x64d79963, 0xaa489605, 0x9e076f6d, 0x59e7455e, 0xb7d6f0e6, 0xe1fb9798,
+    0x6ceda809, 0x50ba435b, 0x0104cd73, 0xaa92f5c9, 0xbff5d195, 0xb94421ab, 0x9d10cf0b, 0x0593e8c1, 0xa3722d98,
+    0x8a6814d8, 0x17e3bf8d, 0x58b39ad2, 0xd07e753a, 0x6680e9d3, 0xa687940a, 0x719cbd3c, 0x6a62d6ad, 0x6ef2f735,
+    0xd5cbf5d0, 0x02916463, 0x00a0e4b8, 0xd585b986, 0xd8fc08c5, 0xf7c77c60, 0xc4d31d22, 0xd89a0463, 0x4f49c4b5,
+    0x6597e5b8, 0x50334aa3, 0xcead2ff0, 0xd284d88e, 0xd7b0b3e8, 0x343c46c7, 0xd5b62868, 0xb88eb8c2, 0x7a2147fd,
+    0xd4fd92e5, 0xbd6881b3, 0xde1cc229, 0x41cf34a9, 0xe5e581a6, 0x78c96173, 0x88ccda07, 0x76bf143c, 0x390322e6,
+    0x8e53c370, 0x3335db26, 0xadcf6a6f, 0xc0e94352, 0x0960a520, 0x743d94b9, 0xb4b8a743, 0x0fd1e096, 0x9ee32018,
+    0xbc9c6141, 0xf68c9abe, 0xce380b78, 0x6f121044, 0xef423433, 0xa971a5ab, 0x3f73eda0, 0x8d981e3b, 0xc4b075aa,
+    0xa1ad01ea, 0x1bbec477, 0xf75d75bb, 0x7c3d9ba6, 0x20e38641, 0x21539154, 0xe69ae3d0, 0x558ea6fc, 0x4d5e4b43,
+    0x1d2e3c1d, 0x1609be29, 0x7237a216, 0xbb47c401, 0x84bec430, 0xaa48c833, 0xe5791c93, 0xa7e06c68, 0xae9a2083,
+    0x293112b6, 0xd9765fff, 0x8ce80234, 0x31361857, 0xbc632fc8, 0x08ff7a42, 0x80f4b6be, 0xadd7172d, 0xe1d5e6d0,
+    0xf95c76a4, 0x0fbb9a95, 0x1dd746ef, 0xf58af8f4, 0x4d5e8c4b, 0xd6ccef76, 0xe15e1e66, 0x454818ea, 0x01933bcb,
+    0x55ecafb8, 0x80ae0d47, 0x30e4d4ec, 0xac72c4e1, 0x75b5825f, 0xe65119a4, 0x0fbf7c8a, 0xe1630f6d, 0x5ae3aba1,
+    0xff085274, 0xc59ac17b, 0x654b2888, 0xd44e298b, 0xdf38ffe4, 0x54966503, 0xc99ba926, 0xd52a2e2e, 0xbbf70c9d,
+    0x92e8a590, 0xd2c8902e, 0xf37dd77c, 0x9f816c2c, 0x3a669720, 0xa0f94811, 0x52c44ac7, 0xd4d48de2, 0x4d39309b,
+    0xe0c57979, 0xefb3b97b, 0xbbe523c6, 0x232c3c3b, 0x9a3d14a0, 0x5a5d2940, 0x5e530b28, 0x7be570c9, 0x4242b38f,
+    0xa097e8c3, 0x0c6a3b66, 0x621fff8d, 0x9908be78, 0x20c7c41b, 0x5b6678ef, 0x0b629cd0, 0xce5fa6e3, 0xf311f352,
+    0xc2d2474f, 0x768b4bd3, 0xd10664a1, 0x3cb1a8b9, 0x3e078a90, 0x041582cb, 0x643eca0a, 0x7ff05283, 0xe6cae8ce,
+    0x20101a4d, 0x5af055d8, 0x01d585bb, 0xe798b9c5, 0x9373ec5d, 0x9ebe5961, 0x98898694, 0x13c62017, 0x249e80cc,
+    0xeedf605d, 0xb324f5dd, 0x66c79897, 0x4e66dbb9, 0x307ee954, 0x21c6b9d3, 0xcf8f71da, 0xc083bd89, 0x25fbca56,
+    0x952a7e55, 0xeaeae774, 0xdfbbe538, 0x03eff7fd, 0xa50ba586, 0x4e3639fe, 0xfb2a6f73, 0x21a56842, 0x0fb45f55,
+    0x23cd4317, 0x7e64f4d8, 0xa2c91504, 0x809df291, 0xc2290e24, 0xe075d2e0, 0x3cde84a6, 0x19945db4, 0xddffe5c4,
+    0x84d46589, 0x56f2ba9a, 0x80eeb802, 0xc76da1cf, 0x89994cb9, 0x02aa3faa, 0xf76ec603, 0xd56f74a4, 0x9cbfb2c4,
+    0xf4d7713b, 0xc336abff, 0x27da7a59, 0x126d7dca, 0xdef5981c, 0xd7c299b9, 0x3c508d3e, 0x4fa4e738, 0xd3b3820e,
+    0x3d9a1c9e, 0xde499132, 0xbfba597c, 0x8b49ae03, 0x5b5110ee, 0x33eb0da8, 0x9c37d4f7, 0x52f56d37, 0x403aba4e,
+    0x56ffe07d, 0x4ef8c714, 0x7f143dce, 0x3a2da040, 0xb8965390, 0x8cddf9c3, 0x3c8e92ab, 0x3e4c4261, 0x023ee767,
+    0xebb8758e, 0xb7fbd382, 0x02dbcb95, 0x120e74d1, 0x23240ac0, 0xdb68a2b4, 0xfb92c473, 0x4d6b843e, 0xcff71007,
+    0xf36de5dc, 0x99d1c016, 0xdda771f0, 0xc2298c0b, 0xd112c8da, 0x1ae794a7, 0xc35f1998, 0xe6b7d1fb, 0xa7d0bcfe,
+    0x403a12f0, 0x6a4b74ec, 0xdc1d0e2c, 0xbd7c98e2, 0xd777162c, 0x54240fbd, 0x211ceb5c, 0x160d7afc, 0x10eca63c,
+    0xb6134080, 0x516ae1ba, 0x963ce944, 0xb89d4c73, 0xf3739fe4, 0xd471f0db, 0xe8f4d82e, 0x981a392d, 0x24e49689,
+    0x488816dc, 0x01edda6b, 0x585c9e52, 0x9fa8e68f, 0xded57e0f, 0x0f7e73d9, 0x7c1d4f6a, 0x461e99d3, 0xb83abe3f,
+    0x47582112, 0xb3bf3cac, 0xddd57106, 0xba0bf85a, 0xb11ec7cf, 0xe420d0df, 0xc038acee, 0xb7560ed1, 0xb15a408c,
+    0x141d8905, 0x304b63d8, 0xe76381b3, 0x28febf77, 0x5ff4eecc, 0xb03249cd, 0x79aef537, 0x8fa9cb09, 0xedb45164,
+    0xdddd2614, 0x50f27c34, 0xf8e95f1c, 0xac2e1940, 0x171b5942, 0x3bbdcfff, 0xdcf1c8b7, 0xdcd422a3, 0xc587be8e,
+    0xcda5c72c, 0xbcd1685e, 0x216fb40c, 0x1c8b32a3, 0x14197937, 0x8299447d, 0xfb75c99f, 0x6d26209b, 0xcf30cc0d,
+    0x0a55c4c7, 0x3b99486e, 0x2326403c, 0x270383cf, 0xef3c2eec, 0x176793dd, 0xdced6006, 0x12a36780, 0x7de9e6f7,
+    0x6d88d0a6, 0x2d4959e9, 0x9db85f5b, 0x0d9629f7, 0xed3623e1, 0xd6030d51, 0x7f624147, 0xeedf52c7, 0x8b8ba217,
+    0xab7bf7c2, 0x873e107c, 0x75bd4dc0, 0xab105dcf, 0x3f0245be, 0x79c3ae4f, 0x11a06c20, 0x6fd42b03, 0x6e772a54,
+    0xa344ec12, 0x53f622f2, 0x5ba56519, 0xd4db25b2, 0x8fa592b5, 0x64b9eb64, 0x6b961e21, 0x6c5bde6b, 0x4d73f80c,
+    0xa135dd8b, 0x61c3e9a5, 0xba390fcf, 0xa269b0e2, 0x8d5a5ced, 0x29f5f387, 0x95c262dc, 0xcbd06721, 0x5f71abd0,
+    0x2d1e5552, 0x5961c3d8, 0x632b415c, 0xb5e790da, 0x4ea47568, 0xc40c8252, 0x57e5a783, 0x556a3326, 0x82ddad34,
+    0x6daf58dc, 0x99e079e6, 0x54d78fd5, 0x71457b75, 0x14cbfbfd, 0x8f44ff49, 0x169429eb, 0x3ade359f, 0x3ae82025,
+    0xa310110b, 0xc20346a8, 0x78de39de, 0x102497e1, 0x93a24e57, 0xa6b49257, 0xd00f67f6, 0xf63d0d4b, 0x923574e7,
+    0x9de980aa, 0x55d92405, 0x3006c2c7, 0xcdd39baa, 0xfe4dabf0, 0x12ec1797, 0x8e736598, 0x3a4e5ed4, 0x9f371dba,
+    0x49100f25, 0x9abe65e2, 0x1466b8fb, 0x420ed163, 0x443ea28b, 0x51cf535f, 0x48beeb54, 0x8741b148, 0xfab3b029,
+    0xbbe99167, 0x042bd8b7, 0x03864c21, 0xa9955533, 0x2cd2ae3a, 0xc318a591, 0x1580d1ce, 0xaa67c22f, 0x40ddeba1,
+    0x8aed8b54, 0xeca036e1, 0xec450f7d, 0x000070c1, 0x4eb46aae, 0x4bc09f23, 0x24434c51, 0x02d36490, 0x7b684935,
+    0x214b4056, 0xf54698cf, 0x8bb02a74, 0x4a15abca, 0xa53af007, 0x0c04c4f9, 0x81707f9b, 0xf390a9e3, 0xc76494e4,
+    0xb9a02bd5, 0x53884d1d, 0xfaaa9cb0, 0x1181502a, 0x08472999, 0x9ddef3eb, 0x72f3a8ab, 0xa20d4aa5, 0x26b56c50,
+    0x39001226, 0xc31d0f25, 0xf5b0790c, 0x0bc5f42f, 0x99461807, 0xdd519080, 0x8e2f7472, 0xfc25a926, 0x79cb29c4,
+    0x3d4bb0cf, 0x571c6369, 0xa3053fa6, 0xaf08976b, 0x9f70039b, 0xd543b417, 0xf00a6ee2, 0x9e4cd167, 0x2f122f56,
+    0x9ce6d0d3, 0x2ea7f4a6, 0xb75bcebd, 0xc6cf93cf, 0x7ed636bb, 0xb8301160, 0x232feb74, 0xae380a77, 0xcf715a20,
+    0xc0e96b5b, 0x6c923974, 0x314ffe46, 0xc0e265c7, 0x4a52fc8d, 0x098057a8, 0x9ad07a33, 0x01689306, 0xfd84e07e,
+    0xb3b51ecd, 0x71b69d23, 0xb617138b, 0x78335d15, 0xda978d7d, 0x2549999f, 0xb45667ae, 0xd2f5314d, 0x9713abbf,
+    0x391a5d07, 0x89f4569a, 0x1562485a, 0xe60cddc8, 0x68f09599, 0x78c01ad9, 0xb3f57850, 0xfe2250b8, 0xd924ff8e,
+    0xafe7e29b, 0x84432655, 0xc3c34631, 0xe7e9ee58, 0x3b9bfbf1, 0xc567d975, 0xec4c024a, 0x8ac05d06, 0xb90bc4aa,
+    0xeee6ff89, 0x51e538b1, 0x6116a723, 0x020ab75d, 0xecfa51de, 0x95565352, 0xb9df4c5c, 0x3c0d087d, 0x71124f88,
+    0x80344e13, 0x7a938242, 0xa7b388a9, 0x57bd1827, 0x20f4d37b, 0x7fc2bbcb, 0xa0f0ca59, 0x125cc5a9, 0xe3db48a1,
+    0xa44e426d, 0x553b2b61, 0x1102156d, 0xf4249fae, 0xc26d5220, 0x73e11cbf, 0x2e46bd28, 0x5f2b761c, 0x51a05aee,
+    0xb7cc95a7, 0x06c136d5, 0xa91770b0, 0xc2f53f1f, 0x1fdc6aaa, 0x646bb18c, 0xf925b168, 0x87c9124e, 0x1bd5e96e,
+    0xa0555629, 0xdeff2060, 0x847e93cb, 0xf5dce455, 0x6ffb16d0, 0xa7ca21ce, 0xc84c2ba0, 0x8762d486, 0xef4b6509,
+    0x406b5c33, 0x3c4a1ad9, 0x82713574, 0x73642d5c, 0x79205950, 0xc487fdcd, 0xc9351229, 0x844ad1ac, 0x2d48cc6c,
+    0x40227924, 0x70e003f8, 0xf0d149af, 0xab8a15b7, 0x5dbb5279, 0xb0182e97, 0x8f5f647e, 0x0e9d35e0, 0x52f20927,
+    0xa60f4748, 0x8f6521ec, 0x836dd047, 0x899df159, 0x87e6e34b, 0x1ced734c, 0xa2a64df4, 0xdc194b15, 0x68af4514,
+    0xe984f8bb, 0xdf747684, 0x42721728, 0x783a8c05, 0x67cfc79a, 0xbb45400a, 0xbed4fa8f, 0x35c19683, 0xccb17745,
+    0x8f4225db, 0x92d12e9b, 0xa620a9b5, 0x452896e3, 0xf6733eef, 0x4b98e977, 0xfcf260c9, 0x70fd841b, 0x9cb2c465,
+    0xdc9abb48, 0xbca4ff3d, 0x7bb7d0a5, 0x315f9c32, 0xbf48091c, 0xd96d1eb9, 0xee0a5163, 0xfb4d869f, 0x472fc51b,
+    0xbe0c1712, 0xe497847a, 0x42ce26c9, 0x41835804, 0x82a89775, 0x18ca5daa, 0x899da044, 0x15d48635, 0xc21e6aa5,
+    0xe4a930fa, 0x8e4af88f, 0x28872c86, 0xc7826517, 0x1e048337, 0xec7128c4, 0x7f92dc7f, 0x6b499fed, 0xcb07df37,
+    0x556dcea6, 0x90bb842b, 0xdb4acf38, 0x03e26049, 0x38bb9ed0, 0xcedc5afa, 0xf15204f7, 0xf9631b16, 0x1e9059af,
+    0x9ed963cb, 0x4b76ac6c, 0x175b89b0, 0x7bc9a96b, 0x35c44627, 0x5ebb6135, 0x5079d871, 0x41f8cf98, 0x55c61a86,
+    0xfe7766f4, 0xd9758f18, 0x5803b618, 0x33fe0836, 0x3d8c37c6, 0x4830f859, 0xb77a5526, 0x5da321ba, 0x18bf4ec4,
+    0x0a490e8f, 0xbf58b54d, 0x5b9feced, 0x4d4191fe, 0xab7fefa0, 0x4955b0d5, 0x99367048, 0x6d747a4a, 0x83cd6adf,
+    0x29b200f9, 0xa02be4c1, 0x7ac15ca4, 0xcf86291c, 0x4ff6d63f, 0x87022f87, 0x147b3ea0, 0x18474bc6, 0x2a40f61f,
+    0xe6a9bf92, 0x427548ad, 0xa52414e8, 0xf9099e8f, 0xf0596388, 0xb417dc1e, 0x70fe3cc3, 0x680a283c, 0x158aa073,
+    0x2f81580a, 0xb5b23d67, 0x9301e21b, 0x32178e94, 0xe5148878, 0xfa426f28, 0xa0287242, 0x2f4073f1, 0x553f48af,
+    0x282b6c84, 0x1f787d83, 0xc535fdb2, 0xcbc9dcd0, 0x91a1e8a6, 0x2d404f70, 0xe2f6484d, 0x2eb3c955, 0x3f9bae36,
+    0x2e528159, 0x5600f038, 0xea5680e3, 0x90744f94, 0x2def1581, 0x0fd411ac, 0x5434676e, 0xcfefceb6, 0x7a92f56d,
+    0x14a5d1a8, 0x9e7d75bc, 0xbaeb61fd, 0xadef03fd, 0x6cdcb2ae, 0xc730fd91, 0xfd889634, 0xdc40b892, 0xd4a8492c,
+    0xcc3e6526, 0xdee6f1a9, 0x0021db7b, 0x188fe5fd, 0x96dac78b, 0xff276c2b, 0xabd65f17, 0x6e33cf80, 0x5733f8a5,
+    0xacdf8bbb, 0x7c96aea2, 0x324a2c7e, 0x5217346b, 0xcfe42921, 0x51d02713, 0xe07d805c, 0x5531b829, 0xf2613f7c,
+    0x42691322, 0xf476e386, 0x928a558d, 0xf72f671c, 0x3c08cd6e, 0xa9f4e758, 0x76985db4, 0x1e5f10f6, 0x1c026e6e,
+    0x47937020, 0x4fab094d, 0xd041ef20, 0x8e469770, 0xf43da07f, 0xf2e9dc4b, 0xb561167c, 0xe75179ee, 0x6b578e66,
+    0xa612c0dd, 0x3e736aca, 0x6e4c1695, 0x6938a2af, 0x85902b96, 0xc49f2572, 0x316bc877, 0xc0ed9d99, 0x88dd81ec,
+    0x8e73c859, 0x06c97244, 0x0e15fdc2, 0x1fd89cfb, 0x3f2aa919, 0xf9832823, 0x5a4f26f1, 0xb6081164, 0xc1af7f02,
+    0xb80ad52c, 0x4c504250, 0x5dc7d2ab, 0x4c9a1701, 0x90fd91a1, 0x157d95ba, 0xfb0fb63c, 0xdb256a71, 0x94708c89,
+    0x4ab34472, 0xaf9fe84b, 0xceaa92e2, 0x4539b705, 0xab9608b3, 0x7db22f0a, 0x622072b8, 0x769b2362, 0x95ea6907,
+    0x672c17a3, 0x9a55bfa9, 0xede7abab, 0x7795d6f6, 0x551d84e3, 0xea4cc80e, 0xd4db00d9, 0x48da2feb, 0xdc9ce08e,
+    0x50826d6f, 0x1cb89ade, 0xd4116a0c, 0x6d9982bd, 0x4e9eaff9, 0x06bef494, 0xa746ee8c, 0x47034409, 0xd19da75c,
+    0xe7dec380, 0xad7fc827, 0xcd26c2fb, 0x6765254b, 0xa281df0e, 0xd0fd2ee1, 0xc552c3c3, 0x8e59c8fa, 0xa82fec09,
+    0x045b8260, 0xe44e6315, 0xd4c5ac47, 0xdaba1a73, 0xad7927b2, 0x0a0f9565, 0xd75701eb, 0x9f341869, 0x36325ba2,
+    0x27643f19, 0x799122b3, 0x0c0acd46, 0x3421ca16, 0x693ea835, 0x76f792cf, 0x55c7a4e2, 0x623c643b, 0xf0a69232,
+    0xbb061660, 0xf9795ac1, 0xc33e081b, 0xfbb7b8a2, 0x1fe4283e, 0x2688b014, 0xd1a18a41, 0x473391fd, 0x574a76e7,
+    0x35db8643, 0xfd277f76, 0xc9286fa0, 0xc5d02f8c, 0x23cd6569, 0xb93ce701, 0xbfb5850d, 0xba450707, 0x633cade9,
+    0x2fc062bb, 0x6a314dd3, 0x3e45897a, 0xd905d5f1, 0xaad7f5f5, 0xd31370ff, 0x3ca6d177, 0x1c96746b, 0x7a8aa61e,
+    0x2d2ba2c6, 0x28abda9d, 0x87071290, 0x72b075ad, 0x5a799a3b, 0xffd93b7f, 0x0fa447bf, 0xc5c73cce, 0x437d06dc,
+    0x03c9465d, 0x6bfc40b8, 0x57c330ab, 0x5dac7956, 0xe7dbc6ad, 0x40b25d62, 0xf57baa7a, 0x112d8d2e, 0x1a890a63,
+    0x06f1941d, 0xa542d6d3, 0x4f28ad1c, 0x4a67a585, 0x75ca55ea, 0x55978437, 0xf13a1c85, 0xa0452223, 0x90cc74bf,
+    0x1f83d2af, 0x1f2fc5fd, 0xb313e283, 0xe5df7d2c, 0xad94fb1e, 0x00b72dd8, 0x589eab56, 0x9810a4b5, 0x45b4daa8,
+    0xc0e9937a, 0x14b76854, 0xb605840c, 0x74ecae3c, 0xc448cfec, 0x0a9a8c34, 0x01fcb78e, 0x9e9b24a9, 0x816b3cf8,
+    0x726b32c4, 0xbb186ca7, 0xe1c11b5f, 0xd7321e37, 0x5a5ea2dc, 0x60fba600, 0xc6700fe7, 0xbde667d2, 0xadb86ae7,
+    0xeea1e080, 0x272d4847, 0xcc64af8a, 0xcc05a105, 0x6ad55bba, 0xc2f6d1de, 0x9d6b9e99, 0x05cb0f58, 0x290707c8,
+    0xaef31611, 0x3ab8c15f, 0xdd96cbc2, 0xcff0569b, 0x182f7941, 0xc82b7055, 0xcf91bea6, 0x975bb166, 0x19d9ce1a,
+    0xff2c309c, 0x2bb11ea3, 0x966cac47, 0x071e6901, 0x56aa8dd1, 0xd0164639, 0x989f3fc1, 0x3175cb0b, 0x206fe322,
+    0xbb07d8b9, 0x3738a7cf, 0xe7b20143, 0xc2cf04ad, 0x31ed2fa0, 0x45688314, 0x00e9f7c5, 0xb999b81d, 0x905dd1ce,
+    0xf3d7b96d, 0x8ba84cec, 0x52b065cd, 0x328f0910, 0x4bbcc87b, 0x492c1321, 0xb0ad3c07, 0x30aa6a9e, 0x33676393,
+    0xac2b7115, 0xa59ed4c8, 0x91a5e2eb, 0x88599d53, 0xe59609c8, 0x7b7625d8, 0x5447c256, 0x94007d27, 0x28e3a70f,
+    0x1d67824e, 0x8f8b5f1f, 0x75abc78f, 0x9eddcd15, 0x13f97f8a, 0xa0eee928, 0xba34e95d, 0xc9c7055a, 0xeb1ceb5d,
+    0xd2fb696b, 0x8fa6f506, 0x2e051b76, 0x6158a191, 0xe4a64772, 0xd61b1746, 0x9a991d43, 0xf97d07e0, 0xb11cbab6,
+    0xa7645a3c, 0xfe3c88a6, 0xc883b4ff, 0x77894e46, 0xb643ba25, 0x25b2d5a3, 0x6db82d7c, 0x725ecc7b, 0x42234c4e,
+    0xd9dd762d, 0x657a9424, 0xc150a77c, 0x7c9e4625, 0x7c47c58c, 0xd3769545, 0x9bfdb772, 0x15a6c40a, 0x23bdec44,
+    0x3de7d60a, 0x53faa735, 0xdccb78e8, 0x65f66ede, 0xb8224c58, 0x748b9293, 0xae504ca7, 0x3fd49a30, 0x213e16b4,
+    0x70735f3e, 0x539d8a9d, 0x77c08a51, 0x164b9965, 0xaedd4b4b, 0xbf913b87, 0xb4663958, 0x40013ec2, 0x15cb0438,
+    0xb8f0e43f, 0x8a3a0a9d, 0x04d17740, 0x406db4e7, 0x6ecba9ec, 0xea821c51, 0x4a8d48f1, 0xf125794c, 0xb75a8133,
+    0xc24b654a, 0x2c2be658, 0xc716c606, 0xb09bba05, 0x050f9542, 0x4c15b40e, 0xafe9e8e0, 0xbd8bd3cb, 0x9e0351a2,
+    0xb60c2e63, 0x92fd944c, 0x25f36a1e, 0x7d6ecde0, 0x130f9449, 0xefd16864, 0xfba66459, 0x118eb116, 0xd3185e5c,
+    0x62ae2b5f, 0x0a41217a, 0x7051cb74, 0xa95d5825, 0xced1a416, 0x526281d8, 0x775a5270, 0x0e1f5a92, 0x890d75be,
+    0x3f3683d9, 0xfe91a12c, 0x59140ac8, 0x0403c6b9, 0x0964d315, 0x5d1dcb10, 0x2d9139a9, 0xaf48380a, 0x873cc8a8,
+    0xed76565c, 0x5e3eb7da, 0x18769802, 0xf7889b36, 0x121ae32e, 0xa67dd00d, 0x8ea3c28f, 0xbf1d2d85, 0xc7f715a4,
+    0x2c46bde2, 0xf439d2da, 0xc99358db, 0x20914bb1, 0xac6692f2, 0x661cae9f, 0x0b1b07c5, 0xcdb4dcaa, 0xf959558d,
+    0xdfd14862, 0xc0ca5a73, 0x469128f5, 0x33b64268, 0x46d4c74e, 0x3ab59aca, 0x71d23ac1, 0x2f385d43, 0x1dd735fd,
+    0x44dc241a, 0x226cbca6, 0x4c2c4405, 0xe3f77f1f, 0xbaea3293, 0xb500a973, 0x3cd3cb9b, 0xcdcc704b, 0x8f3300a9,
+    0x13b4e44c, 0x356447ff, 0x4182e96a, 0x70c249d8, 0x0a8cd659, 0x95e40313, 0x7449f696, 0x6afdf602, 0x0c17f889,
+    0x3d487d3b, 0x551154db, 0x35815e51, 0x2e3c933d, 0x89415669, 0xc846538d, 0xae730c81, 0xeaa552bd, 0x9829d8a2,
+    0xce4e758e, 0xcd0c32fb, 0x15606c5a, 0xa714a79a, 0x8d94c0fd, 0x7d6bef15, 0xdd83881f, 0xc6bd945b, 0xa578598e,
+    0x10b1766a, 0xf3055b21, 0x5d617b79, 0x1547b876, 0xc37feca4, 0x28db1cbc, 0x83f7bc6e, 0x263b48ec, 0x4a448928,
+    0x08e9220d, 0x6e2ca131, 0x421b0a4b, 0x52330b4a, 0x87fd8de2, 0x63a65ddc, 0x5858cc0e, 0xc4d3fbc2, 0x5372dda3,
+    0x6a8ec384, 0x481c3711, 0xb280ce43, 0xb3b00daf, 0xd8c45b48, 0x9e109b97, 0xaa8f454c, 0xa40d6e84, 0xa6930b00,
+    0x8dcdd906, 0x0662f2ac, 0x2d0ce609, 0x1d9a84bd, 0xc5c2ebe6, 0x9608bcd3, 0xf50d6888, 0xe82f3066, 0x2a42b6e3,
+    0xfe84d238, 0xa1f42a44, 0xf33a4694, 0x8a115c1a, 0xeb008ac8, 0x6a7b6908, 0x6999e148, 0x4b7e0a1c, 0x12688eff,
+    0x2dd7602d, 0x40c2d956, 0x32723544, 0x777b9da9, 0x742ad440, 0xa8d8e890, 0x919f2624, 0x2fd9f306, 0x2558f360,
+    0x6fb8a8fa, 0x824f6105, 0xee6208b4, 0xbba88c66, 0x861690a0, 0xb85fd428, 0x6bb77a21, 0x7093db47, 0x694fa6d0,
+    0xc92ed3af, 0xb0d872ef, 0x74f45af4, 0x7b6deddf, 0xa596509a, 0x392f0bbc, 0x2b98a970, 0x7e86d7d8, 0x43388cf0,
+    0x905cce1a, 0x90662125, 0x5a679d66, 0x7b181181, 0x2c6141a6, 0x6f6e2d9f, 0x5b45ae2b, 0x01eb6a6b, 0xbc19add7,
+    0xc388b952, 0x6428ae50, 0xbfdd4d57, 0xfded1cff, 0x236d9b68, 0xb7d506b8, 0x99c89439, 0xa96bd57f, 0xac3cb30e,
+    0x769ce7cb, 0xa9ae78ed, 0xffa7744e, 0xf4c33144, 0x8e5e1b7a, 0x61962de7, 0x03a3cf55, 0xaff2558a, 0xa6f6f485,
+    0xad33d19f, 0x2c7b02a7, 0x4ae05fbc, 0x04d32051, 0xd4779b9d, 0x7300c0fb, 0x3dfa68a4, 0x7c118f74, 0xf30c14b0,
+    0x408ffed8, 0xe70f0202, 0xe2eeedf7, 0xe2f1d2f3, 0x198227b4, 0x39b7be76, 0xfea8f8b2, 0x79d4ddcb, 0x5044a0cb,
+    0x981d9f59, 0x6bc0f227, 0x527f3628, 0xae8b1f81, 0xaa82832b, 0xbdb8a24c, 0x55981cda, 0x38948e10, 0x5809cd8d,
+    0x5fc75453, 0x704d7ff4, 0x55694450, 0xa8bd38b1, 0xf18d3061, 0xcd529eb7, 0x93d0a501, 0x756559c5, 0x7f66bce1,
+    0xf5034a3c, 0xe6fdcb64, 0x77ff116e, 0x770fa451, 0x8667c68c, 0x31719909, 0xe445c9ae, 0x80d758e0, 0x40bb1aec,
+    0x748893df, 0x4d85c47f, 0xba15c473, 0x8b7db732, 0xeb7bdce3, 0x35da12d9, 0xc09ddafb, 0xe75dd5f4, 0x90b19727,
+    0xc5b2a6bc, 0x631930ca, 0x8184f998, 0xc8d62a56, 0xa7c29815, 0xfdf7a02b, 0x1f88a099, 0xfc8224d7, 0xc40231c5,
+    0x99d6420c, 0x7c631967, 0xb50ecf34, 0xbc4791d2, 0xa9b60020, 0x27ddef45, 0xd05974eb, 0x4483c62d, 0x20ae304d,
+    0xc4ac3457, 0x61087a2b, 0xde3685b6, 0xfde1aaf3, 0x099d3c90, 0x81168820, 0x446925d0, 0x0d35e8bf, 0xc5232486,
+    0xe153ecfe, 0x2fa03a24, 0x8a3e8da2, 0x9d9b3940, 0xe88dbb90, 0x791db5e9, 0x9f09f640, 0xfe015e37, 0x8a3ab22f,
+    0x56e3d8da, 0xca9cc8d4, 0xf38dda4a, 0x2831ede6, 0xc45d3daf, 0xec86a284, 0xfce0a965, 0x3f739c76, 0x5d591cef,
+    0xe01014c9, 0x4608e039, 0x4241a3ca, 0x154d02f4, 0x7d53fda0, 0x58287311, 0x4da0d3f0, 0x0a6d0094, 0x90720eef,
+    0xfd07b50d, 0x02b90db1, 0xa15b240f, 0x7b89881d, 0x422de496, 0xb136022e, 0x57cf3d57, 0xed0e5a87, 0xe4d569e8,
+    0xc77a50ec, 0xec4baa43, 0x60049991, 0x8c7a0719, 0x8927e681, 0xe953228b, 0xa0d85341, 0x721556dc, 0x19a9c6bc,
+    0x84948a87, 0xad9c3c42, 0xe1785e45, 0xa846f911, 0xddd883e2, 0xdd7a45a9, 0x1c6b3203, 0xfc377b14, 0xd5c15ebf,
+    0xccbc27ac, 0xb8336f17, 0x70fe2ea3, 0x4e3d6f47, 0x5918ae81, 0xcc6cf09f, 0x80ddcf25, 0xdf983e9f, 0x9d38f394,
+    0x9d068ebc, 0x51aa0a68, 0xcfc522bb, 0x500017cc, 0x9eaeceb1, 0x18ecc5c1, 0xa8dab353, 0xfaf809e2, 0xb5174218,
+    0x171e79d4, 0x17d31e71, 0x17ac945c, 0x2a10efb4, 0x614a9562, 0x045d72d2, 0x891f1240, 0x4514896e, 0x6dbeb91b,
+    0x9e9637f6, 0x7031c5d2, 0x5c05afb8, 0xf0b24a76, 0xc2699666, 0x1b81d5ff, 0x157f0e74, 0xe10f94b0, 0x5493691d,
+    0x038e8c7e, 0xd64f1f4a, 0x0064a7dd, 0x420c2c8d, 0x05ab0f3e, 0x0377cd1b, 0x209c2518, 0x586148d0, 0x57427343,
+    0x50060b72, 0x329a1d60, 0x092bd766, 0xa71bbca6, 0x7d501381, 0x1893e4b1, 0x5b296927, 0x3087a79c, 0x6f9df3b8,
+    0xafab67f6, 0x0d8acd1e, 0x31e9a90c, 0xbbf78481, 0xe06f222f, 0x7306fe48, 0xcc579d90, 0x364a9471, 0xc07a7a6f,
+    0x85363237, 0xe7b26ea5, 0x8a92222e, 0x31e92e7d, 0x7772a6a1, 0xdf8440c1, 0x08187bef, 0x725e4a31, 0x807184da,
+    0x37ae971b, 0xa65c7586, 0x384939fb, 0x69789d23, 0xf6de0a67, 0x8c0e8a9f, 0xe8986d03, 0x6320fb25, 0xfec54746,
+    0x22d72f56, 0xc7416db6, 0xa16a97c7, 0xfb845267, 0x5538fb70, 0xa5138644, 0xcff5fcca, 0x92cfd7ed, 0x6089c739,
+    0x63ee08c7, 0x0664cf13, 0x8337e488, 0x42ce4e41, 0x2c139b5a, 0x6077f1d1, 0x8ac2cc75, 0xeef71370, 0xfac80c66,
+    0x533043f9, 0x38c09d9d, 0x4397f111, 0x3b546362, 0x0bd8be09, 0xccb469fd, 0x9dddf133, 0xfed976b1, 0x5ae1382a,
+    0xb352ad00, 0x1dad2efc, 0x89cc51b7, 0x3e8de42f, 0x6629b65e, 0x06fc7463, 0x0b26b0ba, 0xb77d1857, 0x348e7df5,
+    0xb205d791, 0xbd90c1ae, 0xe97b7db9, 0x2e6773f4, 0x138aebcf, 0xb815d0a1, 0x0a321aab, 0x493e466e, 0xa89139f0,
+    0xa2da5042, 0xfd2f8d2c, 0x30b6966f, 0x94f7d11d, 0xc0ab087d, 0x9cd50f9b, 0x3fa9af03, 0xcf8f7414, 0x98fecd93,
+    0xff513b05, 0xc394f59c, 0xd52a743e, 0x97f53ff8, 0xa9640126, 0x74177796, 0x9f8e979a, 0xb54edb57, 0xc2512f41,
+    0xa403c8c6, 0x59b307b1, 0x3bb53d03, 0x580a9eb3, 0xeae60df8, 0xfedb4706, 0x2a7372d1, 0xed57f281, 0x9996b142,
+    0x109ea474, 0x58b27a15, 0x2018bde3, 0xf0babcac, 0x0480e007, 0x1cbbdd3f, 0x33b789df, 0x3ca01b91, 0xe1dfb355,
+    0x16596d5b, 0x8d0f02d3, 0x0684fd4b, 0x8b2fa8a0, 0x13ff40aa, 0xbc15606a, 0x196ee284, 0xda4edd54, 0x39b5b292,
+    0x1c6dee89, 0xdeb82fcd, 0x908f9266, 0x5d1d159f, 0xcecf6a01, 0xb9daf442, 0x90be64b2, 0xd3ee0da3, 0x83a267c9,
+    0xadc82dd7, 0x6966b731, 0x7128d69a, 0xdd294366, 0x5b24ffb8, 0x581de68e, 0x0bf5ae26, 0x350ec452, 0x0cd96140,
+    0xd758ba39, 0x1304db07, 0xd7ef7859, 0x3029b87e, 0xdd494b73, 0x4dc67f93, 0xcd6573b6, 0x9c028f78, 0x703259b8,
+    0x1bf469f9, 0xc2c4e7b0, 0x062807ef, 0xe50a065e, 0x78cce8b0, 0x7e2ba16f, 0xf8707ce6, 0xb55a06fc, 0x7376d882,
+    0x02164ac6, 0x07c6a745, 0x87a15434, 0xa6b87f9f, 0x669345e0, 0x925fd24a, 0x47496d01, 0x988642b4, 0x3b747310,
+    0xd66336f7, 0x70a05c16, 0xf6f4d66b, 0x28570749, 0x8bc9af8d, 0xd83c9f48, 0xbe9a3d55, 0x7273f185, 0xd934a0c3,
+    0x6cc81c69, 0xf6ed4d23, 0xb58c86a1, 0xf1c2c0ba, 0x44134f78, 0x62d846f4, 0x363c1615, 0x7bf65434, 0x3c40accb,
+    0x4b7c2f6c, 0x6c0ccc4c, 0x06ac88dd, 0x10680ca6, 0x0e4fbabf, 0x6e9c04f2, 0x0c7cc5bb, 0xfd8eb77c, 0xc2c04f79,
+    0xa168464e, 0x74da28b8, 0x0041a178, 0x98b3f64a, 0x15f52ab5, 0x7b210988, 0xa0b85504, 0x206f6ac6, 0x15b795fd,
+    0x68c3e66f, 0xcbd0d24b, 0x7506bfcd, 0x46d58159, 0x10434360, 0x2ba0cec8, 0x6f75adae, 0x8a28a1d5, 0xce5f0c92,
+    0x370feb0c, 0x8455a1c2, 0x5adb8c90, 0xa7159a49, 0xf15467bf, 0x8802e5cf, 0x2fe02d5e, 0x7fea805c, 0xd693e937,
+    0x085557e0, 0x0f29af02, 0xa87ec494, 0xc9c5477e, 0xc240fd39, 0xde06c3a9, 0x0b65c55a, 0x69702206, 0xd105de5f,
+    0xb0555d77, 0x3af76b0a, 0x6a041a81, 0xca73a20a, 0x039e3119, 0xa0267e8c, 0x018c97bc, 0x1d3bc469, 0xfea7ab0a,
+    0x1df999b9, 0xa1d370bd, 0xf078db42, 0x970c8846, 0xdc7e696b, 0x8aec5123, 0xae0d750e, 0x0fc56239, 0x43f101f3,
+    0xc56aee82, 0x38667f97, 0xbbfacd60, 0x62e78af6, 0x7185abe1, 0xc0b49665, 0x595b56e8, 0xca14444a, 0xaf8dd35f,
+    0xd821c65a, 0x704faf67, 0x16d19163, 0x184cc7c0, 0xf7fbaa5a, 0xf7a6bdd1, 0xf10a6743, 0xe4b85f9d, 0x68af1666,
+    0x8d2f26f4, 0x4b20675d, 0x3878f583, 0xf81cad11, 0x236b8d89, 0x47c1fe22, 0x82eb98ab, 0xc88ebbbc, 0xf6244b41,
+    0x3fe1c445, 0xc05f537d, 0x068fd797, 0x2ac0d4d5, 0x99581add, 0x3cd2e3c5, 0x05a45ef6, 0xd7eb198d, 0x4f4b10ec,
+    0x28837069, 0x0aa9305b, 0x0ec67398, 0xa90609a0, 0x03377d3e, 0x6da70897, 0xfb38ed4b, 0x7a291510, 0x0094393a,
+    0x6e660e0d, 0xe2982077, 0xd86095be, 0x77d319a4, 0xe89897e6, 0x19a1ca79, 0x35691396, 0x3da14cf4, 0x2333b07d,
+    0xe334722e, 0xee5a7565, 0xca26571e, 0x52cf705b, 0xf5e57d32, 0xa87a03f8, 0x471644ef, 0x43dcc55e, 0x0530297c,
+    0x8cda987e, 0x13205d08, 0x9946d751, 0xbee06fd3, 0xb1e3914b, 0x0b1b016e, 0xf44da49f, 0x89fd469d, 0xb25e0234,
+    0x4c863e76, 0x596354fe, 0x820a37cf, 0xdb579932, 0x5fb55bfd, 0x34d3bfec, 0x548d8a89, 0x4f2fa31a, 0x7c6b87bd,
+    0xe16ff3e7, 0xa156bc12, 0x912d7b25, 0x28bf284d, 0xf7380429, 0x773b18e6, 0xbf6cd4c5, 0x42e4a719, 0x3f102afd,
+    0xf1df9df2, 0x26c0e05c, 0x5bf0936d, 0xc5ff7152, 0x8fe5faa4, 0x4a487ae8, 0xd87804c6, 0x59b9ec85, 0xd258e0a9,
+    0xbddd6191, 0xebbb3485, 0xc856f03c, 0xeb53700f, 0xb630360c, 0xa4bca35f, 0x63b1635a, 0x87a3e2e0, 0x9a61438c,
+    0x4bb1c584, 0xaa02eb5c, 0x3c87a50b, 0x0bc33ed0, 0x6fc4138e, 0xef3a71ee, 0x6ff6dc69, 0x3ea02619, 0x55972b38,
+    0x96aeb90b, 0xf6f4a306, 0xde6719d9, 0xab0a09a2, 0x683e1708, 0x950441c3, 0xca080871, 0xdebb142b, 0xdb841a67,
+    0xe4a5bae8, 0xddb23cee, 0xa4e12fa3, 0x103872e5, 0x4050f7d1, 0x07bd906c, 0x1f58934f, 0x9b750dca, 0xa2a8190e,
+    0x60135f26, 0xbd680dbf, 0xb1c7410e, 0x4c47a9e7, 0xc81704d4, 0xa2a89e70, 0x2d44200a, 0xb0814ab7, 0xf34d8533,
+    0x44522e35, 0x5a95b014, 0x67ebf2ea, 0x6fec37f7, 0x2b127f93, 0x8b88662f, 0xb4c1d30c, 0xc5f93c2a, 0x1b5a5555,
+    0x59acf691, 0x68bd24bd, 0x2e5220ea, 0x7893d064, 0x5bc0f686, 0xc7f075dd, 0xf450a35d, 0xc697a868, 0xbb144cb2,
+    0xe2bb055c, 0x487e4b1f, 0xd45d785e, 0x5e708523, 0xa23e33e6, 0x52ee3c40, 0x5a1ab47b, 0xf423f20d, 0xcdc9d8ff,
+    0x9333d574, 0x850a1861, 0xecea0151, 0xda0ed5fd, 0xa92998c7, 0xc2e5b662, 0x91cfbc2b, 0xbbe41d10, 0x16be5cd1,
+    0x3bddaeaf, 0xedcf6a38, 0xa07e498f, 0x9efbacf5, 0x10afb04f, 0x7236d2a6, 0x89735ba3, 0x32568aa2, 0x06aef048,
+    0x7805e754, 0xa1c71abf, 0xf2aaed7d, 0xfac3e92f, 0xb4c94884, 0x5f14d33e, 0x89ebbd6e, 0x7220b59f, 0xaa0261a4,
+    0x5dc24cbf, 0xb988b1c8, 0x595345b2, 0xc0a302ec, 0x7e28332b, 0x0e020d6b, 0xf3a3ec1d, 0x0362a93c, 0x875550ef,
+    0xfe6d8447, 0xc17db43e, 0xfc25dfe2, 0xfff17068, 0x8cd6bfe5, 0x8a74d46f, 0xa918c9af, 0x4f167277, 0x5b22f325,
+    0xcc93c0ed, 0xdee8a99c, 0x0c3c3a90, 0x3a425640, 0xe8cf72b6, 0xe082e302, 0x20258fc5, 0x5f646d3f, 0x867521e3,
+    0x08d8df73, 0x9ab033b0, 0xbcdf490b, 0x6d89a1f6, 0xc8eb0741, 0x0a3ef30c, 0x951f4ea3, 0xb6ebcaaa, 0x146983bd,
+    0x73411724, 0x6f49ae60, 0x4cdc611f, 0x8881134f, 0x0ef8e9eb, 0xa7499aa3, 0xefffdfd5, 0xa52ac6d7, 0x2aeba066,
+    0xea17df0f, 0x022c190c, 0x643d088c, 0xc852ae80, 0xda039792, 0xa14d3aa0, 0x1cb1881f, 0xaa21975f, 0x9f1cfa6d,
+    0xc2351ad9, 0x1a8b5071, 0xbd678efc, 0xa0928676, 0x61df6882, 0x6bc7c982, 0xf00384dc, 0x60d44e4d, 0xf9af111c,
+    0xf8084221, 0x4afd8d31, 0xfa572c8d, 0x861fdc23, 0x81533bf9, 0xda817cc2, 0x19c4c9af, 0x73fab396, 0x60a87779,
+    0x72b1d7d0, 0x9a7505fc, 0x7ffeb687, 0xd267a5a2, 0xc73d1f31, 0x9ddc0108, 0xb07a34c6, 0xf3ef1b00, 0x28ff5c6e,
+    0x0cc89ba2, 0x650f22a1, 0x673f781f, 0xb9eac713, 0xae1d4625, 0xbcfc1e08, 0x241325f0, 0x0e9f53af, 0x9aa852a3,
+    0x62a1b89b, 0x688cbc29, 0xdbde63ae, 0x22ddf53f, 0x740d4f71, 0xecdb6edf, 0x83180d4b, 0x3b23650c, 0x82ac9443,
+    0x2b8fab43, 0x924a56ae, 0xcd34d435, 0xba097115, 0x7cc3c1ae, 0x1a755546, 0x00091cf5, 0xb584834a, 0x3af65105,
+    0x637c5355, 0xdf5aa79f, 0xdae890aa, 0x6d4bf12c, 0xb48b1a4f, 0xcb558224, 0x0b671acc, 0x2736f187, 0x836430e4,
+    0xf8fd91b8, 0xdd47d840, 0x0be537fb, 0xa9abf3cf, 0xb4f94c48, 0x1792ecbf, 0x0e85f9bd, 0x5d02aee4, 0xd91bc722,
+    0x97414088, 0x7ed5de92, 0x88ee82bf, 0x8c53c0d4, 0xd01398d8, 0x6cf4d256, 0xa560c744, 0xf93dc214, 0x290266c7,
+    0xd31aa640, 0x615244cc, 0x12cdce6c, 0x1ff0a0c0, 0x381e810b, 0x792c4ede, 0x000aa07f, 0xa8c7eeb3, 0x0fa14d8c,
+    0x301407d4, 0x66273530, 0xd9c298ab, 0xa23effe8, 0x173c4274, 0x2d9a3f21, 0x9bae34c1, 0x25ec3c96, 0x330ce379,
+    0x3a372785, 0x22c21ea5, 0x75c4d29f, 0xf8af6da1, 0x17da70c9, 0x959279fa, 0x16c5486a, 0xaac34d1e, 0x16f17cfc,
+    0x56c6915a, 0x2e9a2895, 0xf8578765, 0xfed34725, 0xb4c5aab2, 0x3a71a4c5, 0x8bd86e6a, 0xfbab2d7a, 0xe826433c,
+    0xba805de8, 0x08d519b6, 0x0dcc6c92, 0x4f609a10, 0x005c02fe, 0xa21dc87b, 0x9f9492cd, 0xb2b060a4, 0x64576153,
+    0x81786e6e, 0xf458ac36, 0xba665bb8, 0xffb8b9c3, 0x16811848, 0xc9c0dc9a, 0xc4086b0d, 0x4d117b0b, 0xbf10bd3c,
+    0xdf356ac2, 0x0cf427d2, 0xcee0fbb7, 0x8caa5e4a, 0xeaac7f83, 0x8142cce5, 0xc53ca760, 0xf1573c83, 0xa9c9ab6a,
+    0x1ba160dc, 0x0dbe1e0e, 0x73c455eb, 0x62d829b0, 0x45cc3555, 0xc0922a9a, 0x81d2dab2, 0x9ddf9777, 0xc4901896,
+    0x35d0c921, 0xeff02eae, 0x62efd47e, 0xf3880c6a, 0xde9f76b4, 0x99346334, 0x38f8387c, 0x16b9875c, 0x3c6dca23,
+    0x5ed47ce9, 0x502618e1, 0x7147b39f, 0x6cd62912, 0xc12d8cf6, 0x40f43123, 0x83dada4f, 0xe31bdc3e, 0xd23a961a,
+    0xac77d77b, 0xfc4b23b8, 0xdb2cfb6a, 0xf18b7888, 0x9a1620fb, 0x2f6a5183, 0xb3cd7c63, 0x06873261, 0xbef7f318,
+    0x51ad8831, 0x567f36eb, 0x594973d8, 0xd5b93df1, 0xca189dd4, 0x317520e5, 0x17239fbf, 0x681abe1f, 0xa5aaf901,
+    0x8aab9f0c, 0xbba5966f, 0x69bb3632, 0xc868f880, 0xb9383d94, 0xb16066a3, 0xc42970c6, 0x29da2efd, 0xd6f1957e,
+    0x3b30ed4d, 0xc0402077, 0xcc2ed9d8, 0xa8f7813b, 0x792537bb, 0xb36ea4cf, 0x1354a9ae, 0xe8d74012, 0x3f6ed505,
+    0xc08b18f8, 0x86f146cb, 0x8ca9d70c, 0xdb7bc85e, 0xfac5a473, 0x1eac4986, 0x21d9d3ab, 0xe317d28b, 0x0d0fe9a2,
+    0xcbe6e48c, 0xdead3486, 0xa111d087, 0x49ab1726, 0xe87ba2b2, 0xda727f8a, 0xf371b54a, 0x1efcbef8, 0x8eeff6f9,
+    0xd7ede393, 0x984dfefb, 0xc75a5048, 0x82187be1, 0xe37e3cd0, 0x596bbee0, 0x91961634, 0x78519a71, 0x85844cd6,
+    0xac7e29fe, 0x906aa988, 0x8f5e156d, 0xe32756d2, 0x024c061c, 0x0384155a, 0x46744512, 0xc1c82446, 0x9de5ba43,
+    0x678e29a2, 0x03d1a903, 0x534a7bf5, 0x738a9e83, 0xfe0cefee, 0x4d2a316e, 0x7786caca, 0xf06ef9f8, 0xc356da31,
+    0xd5ec6aab, 0x98d4ab0f, 0x1e321982, 0x659f3b27, 0x396d29ac, 0xb2c49e29, 0x920df3c2, 0xdebb9e2f, 0xf2035c53,
+    0x565d5ed2, 0x3d8302a5, 0x9a4ed604, 0xd5d0fafb, 0xab37e76d, 0xd03c72f2, 0xefab66bb, 0xebe47a42, 0x60b0688e,
+    0xefa644e0, 0xa42595d9, 0xc63c3f30, 0xde141a98, 0xff51dd16, 0xe4fb88d1, 0x3f5469e1, 0x13da2adc, 0x84796e52,
+    0x59ac3c91, 0x1b49704b, 0x49363371, 0x50a95233, 0x8a3d2a5e, 0xb2d88b97, 0x4e4e5b7a, 0x3c3229b9, 0xb320cacb,
+    0x9bcf5586, 0x9656f51c, 0xc86af1b9, 0x2a56c391, 0x2ebca7c4, 0x63e4d2b5, 0xb8bb0833, 0xf0c492c8, 0x279c17c9,
+    0xda73910d, 0xb377782e, 0x9697bade, 0x7922881e, 0x9669a991, 0x4c55eed2, 0x7805d71d, 0x20b75b71, 0x9743f6bc,
+    0xc313181d, 0x1469633c, 0xc21549ce, 0xd5450944, 0x64c9148e, 0x5b7f2931, 0x0e8b9948, 0x7245a264, 0x00fa4a5c,
+    0x04db1fc4, 0x204626c1, 0x38933608, 0x249e5388, 0x2a718b6f, 0xd9954cb4, 0x9b597e7d, 0x757c0a48, 0x93ca10e2,
+    0x20f5def1, 0xde870966, 0x82fcda18, 0x88b4b1a6, 0x1c4170ae, 0x6c348980, 0xf7d1f8c2, 0xad07d146, 0x18793947,
+    0x016df2ad, 0x488edebe, 0x982056a5, 0x0129ed2c, 0x43a222ee, 0x155341a5, 0x23b825fe, 0x1589bf8f, 0x6255d261,
+    0x26790df4, 0x45bea96b, 0xa391908f, 0xd9b04f9c, 0x4d58d551, 0xf0ec178a, 0xb3405f7f, 0xf3e46528, 0xb337c04a,
+    0x2afd266b, 0xca919f27, 0x6eb0754d, 0x99bd1638, 0xa56d8a94, 0x37c12b24, 0xcabacfbf, 0xef9aaba0, 0x459a852d,
+    0x935ae9cd, 0x21d2d8f3, 0x5d02e642, 0x4230143d, 0x6467bed1, 0x54c9bf34, 0x58a418a7, 0xf5e1cb4a, 0x2c175ba1,
+    0xe1ab6ba0, 0x3be356d5, 0xa2f5ac38, 0x044d386d, 0xb8a87b70, 0xb40a6e88, 0x38acbc32, 0x8718b31b, 0x832699ee,
+    0xc81db85b, 0x71542378, 0xc49b0cb7, 0xb229ccb6, 0x3ba63d72, 0x6932aa10, 0x469d4f7b, 0x7ab4f4ef, 0x8d6edbad,
+    0xdb298732, 0x6be845e3, 0x63c0e06a, 0x8a2ce944, 0x5b252eb0, 0x76945bd8, 0x8a95da99, 0x3f392ca7, 0x5af0fcf1,
+    0xed0503e8, 0x96d5dfed, 0xe568efbf, 0xb1a531f6, 0x4cd7c490, 0xf61c4bdb, 0x6f1ac7f3, 0x17f90059, 0x54203115,
+    0x382de9a1, 0x0fc53167, 0xad604ad1, 0x4526d973, 0x0aa32147, 0x3a15f0c5, 0x7ba23e71, 0x8d6f3eb6, 0xc2ce85ca,
+    0xa1677cbc, 0xa2631f27, 0x585db471, 0xa889c849, 0x8c22ac57, 0x2c44d461, 0x9ec13bde, 0xf9b7b912, 0x18af5194,
+    0xed86c8b8, 0xbbbf2db3, 0x9cee31bd, 0x5ad2693e, 0x3a786c28, 0x757512e2, 0x6aa3c3ea, 0x75bdf39c, 0x264a06c4,
+    0xdc4637d5, 0xa39b3cdc, 0xf3062646, 0x03805cf3, 0xef820919, 0x2179504f, 0xc4d5daf4, 0xe6b567e7, 0xe158b16b,
+    0x52210f8b, 0xdfb774e8, 0xf5d28e3a, 0xa2e32904, 0x778c5c2c, 0x4f4f5f8f, 0x4cd3cefc, 0x96db745f, 0x67a2e3f5,
+    0xc74e06b3, 0xa9a6cb9e, 0x2c62cea5, 0x21619558, 0x0dab90f4, 0xd476abdb, 0x0c945299, 0xb4c845f4, 0xc75a7bca,
+    0x2ce4ae28, 0x9d39bfa2, 0x3001397c, 0x6b28ba29, 0x37181cf5, 0xea7d8197, 0xa94901b2, 0xf8da9e2c, 0xdb123d59,
+    0x3db3f385, 0x283c824d, 0x030136ce, 0xcc937438, 0xdebb37ca, 0x55f31ab4, 0x711a3139, 0x46776a72, 0x42495e91,
+    0xe2f573e4, 0xbde3fbd6, 0x67ba640f, 0x3b92ec8e, 0x71dc1e0c, 0x16c12b45, 0x83f63a20, 0x84453768, 0x0f9b6fd8,
+    0xa6e2cb43, 0xe62a130b, 0xf32b8ed4, 0x6751b7af, 0x2ea9555a, 0x0dfbe7b4, 0x5ae45fce, 0x59ba1fe1, 0x7b0b75f9,
+    0x2db30e1c, 0x4d9d84b5, 0xbc808c69, 0xfe8a85a4, 0x9be7542a, 0x8abc6aea, 0x5207b90b, 0xe2fd7533, 0x11f56fc6,
+    0x733ef81e, 0xf1121609, 0x894e95e8, 0x91602019, 0x60bee8ca, 0x2d8e442c, 0x38be324f, 0x5d1388ce, 0x1dc53b99,
+    0xfc23e5fd, 0x5e1d5c7a, 0xf76595ff, 0xad7d2a33, 0x45891476, 0xde5fbf15, 0xf984fff9, 0x90e80f49, 0x208b9193,
+    0x3041f5ef, 0x3a195399, 0xd718b008, 0x84ae2a4f, 0xb8ca032f, 0xe0837dd8, 0xbfce53d7, 0x2199c91c, 0xad8cad0e,
+    0x037fe77a, 0x7c61a2c6, 0x8c97b7d9, 0xbb7dbafc, 0x2b9b9a10, 0x243e08ea, 0x581b002e, 0xaff9d51f, 0xaffc3e67,
+    0xa50b2129, 0xdcace1fb, 0x7cf37f95, 0x1a87a0bd, 0xc7ecb6cc, 0xbb86800d, 0x2c2e287f, 0x320e40ac, 0x3fcd6efc,
+    0x988b3559, 0xad8af910, 0x3758f327, 0x1a769df9, 0xd58fb60c, 0x354a2a87, 0x5d07de1c, 0x8c517b22, 0x62f9a4e1,
+    0xa2468fd4, 0xae793051, 0x77d30d0b, 0xf3325b9a, 0xba377b59, 0xd892e90a, 0xb74a8aec, 0x6e2c6294, 0x22b5409b,
+    0x8d11a8db, 0xef72b01d, 0xdd3980a3, 0x2c526e58, 0xcd7080bf, 0xbc7d3e21, 0x0ddad139, 0xa44bd2b3, 0x94faa151,
+    0xf9e5dcb6, 0x26aa7ed3, 0x44c81af5, 0x80db14f3, 0xed4c6e43, 0x276e5831, 0x6011bd06, 0x90bb4301, 0xc197156c,
+    0xa1e3eca8, 0xf6ed9bc3, 0x806cc200, 0xefc74179, 0xf6f8c01e, 0xdbbd343d, 0xdd15afeb, 0xc0dd02f7, 0x492e127d,
+    0x77e6712b, 0x29c8adb9, 0xb95efd05, 0x16a64cb7, 0x46554732, 0x87898594, 0x8e119505, 0x951e13db, 0xae61b93a,
+    0x74535203, 0xc34c3240, 0xe0d62593, 0xb0d7ce6c, 0xddb92662, 0xab364db4, 0x0ff7812a, 0xa3b2f9dd, 0xed2cb086,
+    0x2cc995d5, 0xb6271c45, 0x61b4ecc2, 0xa0d693c0, 0xb5a843fb, 0x406bd781, 0x7db8add2, 0x55f3b4bb, 0xd7dec6a5,
+    0xa306aba4, 0xad635d65, 0xc2f3dca2, 0x066055bd, 0x814998ac, 0xd611bdb5, 0xf9138c51, 0x1767b134, 0xd077f3e9,
+    0xc0ad9ee1, 0x1d62d142, 0x1325a8e3, 0x70a52a1d, 0x52ac144d, 0xa4d1b117, 0x582e88fd, 0xc74da1d0, 0x1c1acb55,
+    0x58e51ee6, 0x23f06302, 0x6f658ff5, 0x3c0918db, 0xee893f5c, 0x785573c1, 0x7d30f7f7, 0x69e9a2a7, 0x16970455,
+    0x940f64a6, 0xe1c3f56c, 0x4593d775, 0x1a68352c, 0xa6275d24, 0x704469f9, 0xcf1cfa7b, 0xb24d3e4a, 0xecd5aedb,
+    0x4f631fdc, 0xb232f4b4, 0xff68b9b3, 0xd9212696, 0x0f92c27f, 0xa1bb7fd8, 0x40436bf9, 0xb0c0e6b6, 0x340bd0c4,
+    0x4b4700e2, 0x4f3942d6, 0x482f48f2, 0x49a1a076, 0x4b53dff2, 0x9768cfe1, 0xc7456705, 0xba27390b, 0xcc7550da,
+    0xc16b9372, 0xb2679573, 0xd5d48cd3, 0x0f36c0bc, 0x9d28fd1e, 0x0809c41a, 0x989bbd84, 0x01517ed9, 0xd57b13bc,
+    0x2a9b3e63, 0xad66da85, 0x4c72ac47, 0x3cb924d7, 0x6dd669eb, 0x5afabc5d, 0x60766226, 0xff5a67c2, 0xfd48689c,
+    0xe9a3fda4, 0x4b30e6a7, 0x876656e0, 0x7e27fe8f, 0x51f5cc51, 0xa0b9fa1f, 0x384110b7, 0x4e963fec, 0x321c0f2b,
+    0xe94d3887, 0x6d24421f, 0x60f49722, 0x1c3f363a, 0x0251e695, 0x437594af, 0x160dd09f, 0x1367db4a, 0x3d2d1cf6,
+    0x3e4254aa, 0xef56bf8d, 0x4ec0e5ea, 0x19a577ac, 0x99bdf878, 0x0e545bd0, 0xb1490703, 0x5230dde7, 0x053d9ac5,
+    0x7b0f8b87, 0xc3027f91, 0x026bc4a2, 0xed7ef5fb, 0xd3db58ca, 0x440da7ac, 0x43fa32cd, 0x43320688, 0x6a0fc1ec,
+    0xe91c9e1d, 0x20c28f42, 0x9f677058, 0x57e7d397, 0x401ad428, 0x39c00f50, 0x8077497f, 0x98ba06b3, 0xb5329760,
+    0xcf536768, 0x9e2683b7, 0x9a9b472b, 0xb7998661, 0x0a2c1914, 0x1113fae5, 0x319d48ec, 0x35627cec, 0x9d9523fa,
+    0x5e2f4779, 0x0489382f, 0xe9fb5bfc, 0x28e7a519, 0x5cdb5b5a, 0x20d7bd66, 0x3abc6264, 0x1ba9faa3, 0xe689cba1,
+    0x5b9e2a91, 0x139b3062, 0x08d99e14, 0xc1d34c8b, 0x81f595b8, 0x7f4a5270, 0x7e0494f4, 0x1503a010, 0x5ccdb7a8,
+    0xe5353993, 0x9bf0cd31, 0xc5c519f3, 0xda874c0d, 0xf4eda0c1, 0xba3dc00c, 0x51b3c893, 0xed9928b5, 0x77068d1b,
+    0xd0efddb9, 0x6fa4b503, 0xfbe6c367, 0x0420ef61, 0x526d4d79, 0xed699bab, 0x2cad8d16, 0xa241e075, 0xb0010028,
+    0x717dd49e, 0xdf956832, 0x6d14a4e7, 0x835b51e2, 0x50ba6e42, 0x70c0f0c8, 0xa62d920e, 0x3c36af1e, 0xfdb14ad2,
+    0x38f8c386, 0x15094581, 0x3b6d8437, 0x4a1958dd, 0x0f9605a2, 0x5edb2b44, 0x764e0db5, 0x65630949, 0xbc122cde,
+    0x8080d675, 0xe4c71170, 0x6bb7f473, 0xd5aa3a73, 0x95f71fb0, 0x6c841cc8, 0x29635a21, 0xe8e64b0d, 0x7af722c2,
+    0x6429ee7e, 0xc7dd07f1, 0xe3582b42, 0xc62fa9ff, 0xadc858ea, 0xd0d0c9da, 0x373952f3, 0xaa4de594, 0x0852804b,
+    0xb2ff6227, 0x95d61eea, 0x11f14a3f, 0xcda7e594, 0x662c0578, 0x2917e286, 0xf2f55e52, 0x34de9a84, 0x3092eeef,
+    0x1338f36d, 0x354c0163, 0x663052ed, 0x366adfdf, 0x2298f32b, 0x0cc0b25d, 0xd96c10f0, 0xf9bd11da, 0x31104400,
+    0xf3c425f1, 0xa438645a, 0x07b46c9b, 0xb9e499c0, 0x678fa1f2, 0xc6e1dcb2, 0xc147ec64, 0x3b4507a9, 0x2fabba33,
+    0xe22cbfeb, 0xb22eca1b, 0x30cd08a3, 0x65d4866e, 0xa8942552, 0xc0f185ce, 0x8b28ddfe, 0xee81dddf, 0xaf5ab688,
+    0x983381bb, 0xcd46a4d3, 0x9d133f74, 0xdb1dd28a, 0xfc98c582, 0xe79e66e7, 0x214b9af5, 0xff8fa7cc, 0xd54a0030,
+    0xd6073d45, 0xe9684eee, 0x527d84e5, 0xe85d3719, 0x7089485b, 0xd7bc8daa, 0x210b5438, 0x7ce13e86, 0x52ad20d6,
+    0x6628bc03, 0x5f134c03, 0xe4da8678, 0x0d73489f, 0x0f3feefa, 0xcbb09821, 0x40608bbe, 0x6e18d894, 0xc1fc3bd4,
+    0xbaa80856, 0x34cdb39f, 0x979164a0, 0xbdcc79f1, 0xe651b421, 0x302a9689, 0xe0926358, 0x0afb485b, 0x593c0ea5,
+    0xa83c389b, 0x8a48a52c, 0xc76fded2, 0xbb18021e, 0x3f2ad426, 0xd68414c4, 0xfecdd2d1, 0x8fee8dfb, 0xc8da8e0d,
+    0x9c9a1baf, 0x6aa33e52, 0xece3e810, 0x8758b2f7, 0x1ee6f252, 0x1008810c, 0x4925188f, 0x6d2469ef, 0xeb9980b8,
+    0x08cfbba0, 0x36deb724, 0x25cc90dc, 0xd7019b03, 0x0a25b835, 0xac4724fb, 0x66b0e23e, 0xe8662402, 0x935dd815,
+    0xa3a050d0, 0x90f352c3, 0x82c855fa, 0x59ca856a, 0x0439ca36, 0x266abf4a, 0x468b948d, 0x75c3059b, 0x3cf5775c,
+    0x9750ac27, 0x781a45e8, 0xf87017f5, 0x59c39c06, 0x27ba2e18, 0xe1b316eb, 0x2539085c, 0xcab28eec, 0x0c755134,
+    0xc79cc20a, 0x16619f0c, 0x9cc84647, 0x7872fc8a, 0x62100a3a, 0x945f5d84, 0x43841a60, 0x1b697e98, 0xce1922d3,
+    0xc442e55e, 0x34ec8cad, 0x231b749e, 0x8eb14d3c, 0xc3d0e4ac, 0xfe3120d5, 0x75eea79e, 0x7e5ff260, 0x4db09c08,
+    0x8b48d16c, 0x4d6679db, 0x08adc9ed, 0x36500f1f, 0xafcc3023, 0x191cdfc1, 0x273e1daa, 0x632a07a5, 0x7a670399,
+    0xaf747008, 0x500629fe, 0x3bdd62a7, 0x7a904286, 0x457ccc5d, 0x3fc9672f, 0x431c26e7, 0x0a28a874, 0xa44776da,
+    0x8981c38f, 0x2ceccece, 0x3189f2af, 0xc10d3a97, 0x1a2aaa26, 0x12454010, 0x18cd11cb, 0xd0558529, 0x26708d90,
+    0x6207e90a, 0x6c201cce, 0x80fa9afa, 0x40e275e3, 0xd7a01715, 0xf0fb16a8, 0x967b0f6c, 0xedc3dcda, 0x3b612c9b,
+    0x23fffca8, 0x8b095414, 0x3485333f, 0xf70b18f3, 0x84733ca6, 0x6c2f9802, 0xfadd215a, 0x51309f50, 0x87e470e8,
+    0x96aeade9, 0x625be084, 0x42503eab, 0xef8b3bde, 0x13fe232c, 0x9e72d51b, 0x2fdbd3fb, 0x3fb51c4f, 0xa982f1f8,
+    0xc582ded1, 0xab3067fc, 0x2f8f6b04, 0x43bb66be, 0x81781871, 0x267a380f, 0x9a7460fb, 0x4471a917, 0x3154f078,
+    0x31f90b00, 0x41114f15, 0xf9d2bb8a, 0x1bd62fc4, 0x57a91a3a, 0xcef2dcfa, 0x56c8a7ee, 0x0257ff54, 0xc8e09f35,
+    0x6f92d8b3, 0x6d62d39a, 0x81d15a13, 0x6b7cc502, 0xe71294ee, 0x92d3488f, 0xd2469348, 0xda6396a3, 0x01d8cdfd,
+    0x72acfbf8, 0x9a50eaaa, 0x4edc2d17, 0x73e31316, 0xe711d716, 0x2348e621, 0x85efc70b, 0x01b680a1, 0x570354b0,
+    0xc197df55, 0xce40939b, 0x64271bc3, 0x42fd9670, 0x05a7f7a2, 0x704761fe, 0xba3a9633, 0x8f95eb04, 0xe08f5955,
+    0x73bd38e5, 0x3b7ed3b4, 0xdd2fbd32, 0x6c3d6e6f, 0x73075df5, 0x864f7540, 0xeaac20de, 0x810b602a, 0xe4ae7ba9,
+    0x364de84f, 0xb7976a09, 0x8d3a3cd8, 0x2264d5f5, 0x9bfbbd4e, 0xe17ab443, 0xd1ffb02d, 0x5bc7d6fe, 0xb4c6ee99,
+    0x4d9c8c6a, 0x2749142e, 0x4a8f66cc, 0xe4ccecaf, 0x712df902, 0x46af662f, 0x5d6a7672, 0x5e9dffe3, 0x1a309a13,
+    0x39883626, 0xd24eb45e, 0x14b8c2d2, 0x789625ed, 0xfe722e82, 0x2cd24876, 0x66c636c1, 0xa0127830, 0xa72bfbb5,
+    0xcb1ba7b3, 0x066b6f6d, 0x22fe2bf6, 0x8945db29, 0x01f082f4, 0x779c8907, 0xb196033d, 0xf293cc95, 0x04506e20,
+    0x5fcdc84c, 0xa75fd7d3, 0x52d8922b, 0x70c976fd, 0x51d1475c, 0x59ddb425, 0x4e14b950, 0x98d50326, 0x62796a4a,
+    0x7cf2336d, 0x1eb17db6, 0x77b18e56, 0x5187fe02, 0x61421c50, 0xeea6e257, 0x3dd82e61, 0x4d0afe71, 0xe7120f29,
+    0x988b9703, 0x2c6d64af, 0x69ddfd9d, 0x639d53a2, 0x5239984f, 0xcf6e45b6, 0x83264f00, 0xa4471d31, 0x0dce319e,
+    0x1a7bcc54, 0x8147c82a, 0x38a4395d, 0xd8ed35b6, 0xe9190296, 0xf5ef4049, 0x23dcfcc5, 0xf0841180, 0xd8448fee,
+    0x9b8fa5de, 0xce2eb709, 0x691d5aab, 0x67d4f90c, 0x5dcc5137, 0x51f2954a, 0xef0d6185, 0x963a27ca, 0xae6d8d76,
+    0x2add8c8c, 0xc41d3c49, 0x2c98c304, 0x50eb482c, 0x05e4eabe, 0xbff14c2e, 0x0a80a227, 0xfcf8a6e3, 0xebcb5779,
+    0x117e5957, 0x2879c290, 0x2d38ce7e, 0x0c142f64, 0xd07255f7, 0x4c33d023, 0x73cb9627, 0x2b798820, 0x39fea7e1,
+    0x60bb2654, 0x688c44f3, 0x63db05c0, 0x9de36569, 0xb4b6b9c0, 0x6ea917ad, 0x73e5c024, 0x890f2ef1, 0x10008695,
+    0xfbcdd7b5, 0x195d90ca, 0x1e5bb855, 0xce42c844, 0xa13f5283, 0xd9fe5231, 0x937ca2d7, 0x7ad5042b, 0x3465cd8a,
+    0x938df2c8, 0x2237197b, 0x4a83cc3a, 0x36480322, 0x8fd6d358, 0xd87d0d7d, 0x712b31fe, 0x6e3c167b, 0xb94b76c9,
+    0xf8fd624e, 0xc54310df, 0xd0568e78, 0x197a311c, 0xf62f4556, 0xe58a2cf1, 0x11dac440, 0x0fabf9ca, 0x6e7954c6,
+    0x0ff59768, 0x8891a4f2, 0x893f25e2, 0x2da66959, 0xbb26712b, 0x91b4e21e, 0xda9b41e9, 0x9f85302a, 0xa0a86dfd,
+    0xbd05450f, 0x8c8a9bd8, 0xd6e0f86e, 0xe18c10b1, 0x544b1b9c, 0x44f35fe4, 0x9cecdfcf, 0x1a63e5ec, 0x228c73be,
+    0x3826c33d, 0x4b53102b, 0xd5a19a2a, 0x5c20ec66, 0x17a2952b, 0x9175fc43, 0x1886a95a, 0x245aa6f5, 0xbd3369cd,
+    0xde3ef906, 0xb064d49d, 0xffe68a4d, 0x552089cf, 0x09778050, 0xc937ae1c, 0xa4a3090e, 0xd2ce7a5b, 0x4b53b54d,
+    0x97da109b, 0xa3edfe4f, 0x98cc5d11, 0x4c39e634, 0xd2858017, 0x6554da51, 0x9b9d4aa9, 0x1e731314, 0xe5671c8f,
+    0x3fe522da, 0xb033a9ab, 0x08b21af2, 0x101407a3, 0x091225e1, 0x4410efdc, 0x79567bbb, 0x7764fa1f, 0x87470bc5,
+    0x14beda68, 0x692103bf, 0xa60cb8de, 0x0c9cd698, 0xa5e183c4, 0x7b78dabc, 0x88a451b1, 0xb7cd4197, 0x7e6db655,
+    0xc4bbe5ca, 0x10d82e1c, 0xc3916ea9, 0x764e78c8, 0xd4c44ee4, 0xd5d549e2, 0xabda96eb, 0x93db3b6c, 0x17e3563b,
+    0xb68ddc9f, 0xaa4b8178, 0x24c10eb3, 0xa9ac4359, 0xad08c3ca, 0x70fd63a0, 0x101eca32, 0x2aef8300, 0xd88e258a,
+    0x50c26aa5, 0x4e25148f, 0x9bd397f7, 0x26ef520c, 0x31070e85, 0x06bea29e, 0x27af02cc, 0xc95adf87, 0x9bf60c21,
+    0xfcf1b343, 0x579d8761, 0xd3b540bd, 0x2bb2f3f2, 0x23db6f14, 0x8155c4aa, 0x1217d128, 0xec391f80, 0x4d41e593,
+    0x7d82247a, 0x3eff2321, 0x17a551a8, 0x784b7bfb, 0xb22e5e41, 0x0f195e5a, 0xd37a740b, 0x280d6601, 0x2625c735,
+    0x16508800, 0x82b8cb7a, 0xfcfaf87e, 0x2490cbfa, 0xdc552396, 0xb95e05e1, 0xcb0cdc97, 0x6f66fd9b, 0x5894faf7,
+    0x1f52a6c8, 0x3c6999a8, 0x535d5dc8, 0xaeb1ff64, 0x8cf23bf3, 0xc32e907a, 0x18cf6b65, 0x5e19f9b1, 0x887ae96f,
+    0xa7a80e24, 0x2af17130, 0x4227242e, 0xe33eaa38, 0xf759ba90, 0x2067e46e, 0x1eb40e6b, 0xb48d52d0, 0x3b27f396,
+    0xba6ee0b8, 0x3c53390c, 0x7493136a, 0x360a25d6, 0xdc8acefe, 0x6f31e0f7, 0x4a42253f, 0xd7b42a2f, 0x30e9f1fc,
+    0x07e3cd77, 0xe892fd9f, 0xa4fbf27d, 0xb20c1554, 0xcf649a62, 0x695a18ca, 0x2607e757, 0x50e62e19, 0x7c422b43,
+    0x1b650593, 0x909b2154, 0x0ec98a65, 0x06ed3383, 0xd37143ae, 0xf9024701, 0x51837257, 0x6369926e, 0x1ef53e65,
+    0x05e18929, 0xed0d82de, 0xd4737223, 0x91918640, 0xe04b0d4c, 0x9d2899db, 0xc9af0b60, 0x85b6262f, 0x54630a3d,
+    0x54548abc, 0x2bfca3ec, 0x7bddf977, 0xda640ed9, 0x242b5cb3, 0x131891ec, 0xf60ccd1d, 0x08f8a9f1, 0x2a0b0e55,
+    0x2121f5f5, 0xe1d45463, 0x84e67533, 0xc3aa0e66, 0x115cd6c5, 0xa9367435, 0x1a72580e, 0xc2321e7c, 0x6d760dc0,
+    0xb1e58c89, 0xc1f7ac3b, 0x7e428b45, 0x5c66da21, 0x8790a5fc, 0x3d623d15, 0x8c64e332, 0x13923069, 0x21def422,
+    0xff3ba0d8, 0xe8f13949, 0x1c51409e, 0xb77b867e, 0x292be1ce, 0xd0c7a665, 0xdc85cf34, 0x7bdcec31, 0x709c1cca,
+    0xe06f28f3, 0x0f561ee6, 0x1ddc733b, 0xbcd90156, 0x7cf9e28a, 0xde53336e, 0xb0b5abf7, 0xf50eac9c, 0x30e757ce,
+    0xecd4793d, 0xf294c895, 0xa1237f0e, 0x1f442aa0, 0x80ed8ff3, 0x17ecbcba, 0x7adb092a, 0x8e59ca67, 0x9219b4dc,
+    0xb665d1df, 0x662e0c3f, 0xa1b79fa7, 0xdc739eb2, 0xe37dd181, 0x30552def, 0x7119f9e7, 0xcc81ae31, 0x94d7c241,
+    0x919299d8, 0x873bea5a, 0x562da620, 0xa557b5a2, 0x9617c7db, 0xf790f0db, 0xe7d56779, 0xa9b65671, 0x822da105,
+    0xfb8ad974, 0xd3ec67ac, 0x613eb8c5, 0xcbf6fa45, 0x9fd593d0, 0xe1b438e0, 0x02cdf4eb, 0x30d9ac72, 0x70f3a404,
+    0x380a5208, 0x710fa5ea, 0xb8350dd4, 0x453bd578, 0x57faca58, 0x333303ed, 0x1a597e5a, 0xb0f247cc, 0xb48c454e,
+    0x0d730557, 0x9ec72196, 0x2afb2256, 0xdae8e3b6, 0x7f44d880, 0x19a0c206, 0xe8c1c1ee, 0x60188aae, 0xb8c487b2,
+    0x136a8057, 0x36c1660d, 0x8b7da0a3, 0x89e17a06, 0xf227ea80, 0x1ecfd868, 0x64431aac, 0x81cccc4e, 0xeb737b79,
+    0x579c164a, 0x4d43cf38, 0xe428443f, 0x0ec39f16, 0x669ed6dd, 0xed374be4, 0x49ecbe12, 0x06441251, 0xb845f39b,
+    0x7943dd1f, 0x75612699, 0x8739c698, 0x731d4dd0, 0x425fb322, 0x6ce00a72, 0xe7053e7e, 0x06ceb9e8, 0x09ac5be7,
+    0x8ff4edc3, 0x90754cab, 0x2a3070df, 0xc3d4cda2, 0x8c30699e, 0x0c774aba, 0x3939fee8, 0x2e79f6c7, 0xc1387e7d,
+    0x48d10970, 0x622f14ad, 0x5e3d9614, 0xd02f92b5, 0x1abf55bd, 0xaef44268, 0xc56d9056, 0x7a6d8bfd, 0x4a9d99e1,
+    0x1ae97e7e, 0xc61d07e4, 0xd8683f40, 0x91d3e95b, 0xadb67ad2, 0x0f031cf8, 0xc2de34d0, 0xb04b86d6, 0x5f0ff399,
+    0x8b23490a, 0x6eb0de6c, 0xcf489f58, 0x3e10bfde, 0xbd106857, 0x46d564ab, 0xa05f81aa, 0x9a5e088d, 0xebf51257,
+    0x538472f2, 0x3e4ee9f1, 0xacca9dc6, 0xcd6a2ae3, 0x6a5a2b0a, 0xfca2ebea, 0xeef996c1, 0xbb2d3872, 0xd5a14bb5,
+    0x28a9cc31, 0x69206101, 0x08508512, 0xe252a25c, 0xc7b85719, 0x128bbfca, 0x5b7539c0, 0x3a12900d, 0x4128fbfa,
+    0xfe3cdb48, 0x3d528e5f, 0x0196d263, 0x2c8f32a9, 0xb1970763, 0x0d97d33a, 0x61ceeab5, 0x8920c4eb, 0xa43b808c,
+    0xc6187e72, 0xaac90260, 0x2294b379, 0x1b08344d, 0xa5c72439, 0x19c3f0e9, 0xa06f0e99, 0xc7f4f73c, 0x5e0a090c,
+    0x4a2b547e, 0x2eadf428, 0xfbb7d88d, 0xa3ad1aef, 0x534e84df, 0xb78e794e, 0xee4b4c9f, 0xc2cbbf72, 0x54b53aed,
+    0x9b9f66cf, 0x1d3c0a0a, 0xa06beb02, 0xae5c9b44, 0x7e4f15ec, 0x52d6fde1, 0x05353219, 0x093b64de, 0x8d053db4,
+    0x7fe79ca1, 0x1b784c8a, 0x8925385b, 0x82d3474b, 0xe38a426e, 0xb6e876ef, 0x5cb9dc78, 0xa211fa78, 0x8a1b09fc,
+    0x6b465314, 0x9583a057, 0xe135f595, 0x2d0196ff, 0x931f95eb, 0xc2692f6a, 0xd50977cf, 0x5c10aad5, 0x86b2bac7,
+    0xe140cff3, 0x9e0151a7, 0x43750d0c, 0x05302634, 0xc8e6423a, 0x0d513213, 0x0ae72d31, 0xc9e770ca, 0x13d6eb80,
+    0x1dea0d93, 0x1b5075d6, 0x333bb73d, 0xbc49487f, 0x5bc991e8, 0x8f0517f3, 0x0bf8d6d6, 0xb908f7bd, 0xcb17987e,
+    0x9ac34dad, 0xa7fe33f8, 0x29ff9196, 0x77b0bb3b, 0xaf4bcddc, 0xf2e334dd, 0xa479d57b, 0xdfd79539, 0x2968af62,
+    0x50b95f1c, 0x8d552d50, 0x54cfd7ef, 0xb9d48c4d, 0x80ddbfee, 0x0b58b0f5, 0x93b0580f, 0x4b72e4be, 0x8588db8a,
+    0x1bdde163, 0xc549adc6, 0xf610a3d4, 0xa1c89408, 0xbab6071e, 0x7faee935, 0x4c694d41, 0x02de5a6f, 0x7b64d2db,
+    0x8394df69, 0x68f6170d, 0xdc6a101f, 0x0fa8dd1b, 0x3334f2df, 0x8d1d1d7d, 0x0f820976, 0x967d374b, 0x15171caf,
+    0xf4968abd, 0x422e7136, 0x1f9cc61a, 0x8824c31b, 0x979f4e84, 0x662e8fd5, 0x7811b3fd, 0x6a761438, 0x180a6f73,
+    0xdfad4317, 0x64c51707, 0x23b5ab03, 0x0520e101, 0x2cefe605, 0x32e6c943, 0x144def01, 0xfea4c7cb, 0x495771a4,
+    0x345e96b5, 0x6c52c755, 0x0f310628, 0x4f939278, 0x1cbdec09, 0x24e5b48d, 0x30aef757, 0x07909479, 0xa32f7313,
+    0x2016279d, 0x4961649f, 0x13e896da, 0xe31b4d9f, 0x65c75c57, 0xe5740044, 0x5dc07b26, 0xfffc25ca, 0x48ad708e,
+    0xd61bc9f4, 0xaa21dc30, 0x895d6ddd, 0x2be660ed, 0x1c3b35f9, 0xf08b8826, 0x419a2a63, 0x2f519867, 0x1a869458,
+    0x9ade75d2, 0xc825c369, 0xc321b06e, 0x39234d6a, 0x6910e515, 0xdb2bf91f, 0x0f29c983, 0x952d237e, 0x37a817a7,
+    0x3dc8ad84, 0xeba35d94, 0xd4003713, 0x22c3e34f, 0x7c2aa3f1, 0xd4694beb, 0xeb72cde8, 0x50909666, 0xed999344,
+    0xcd423684, 0xeafb64cc, 0x363d0e5d, 0xed4616c1, 0x249d4fdc, 0xd2902e16, 0x5ffe56e5, 0x03fb115b, 0xd03f5c18,
+    0x9811edfe, 0x05dd9813, 0xd52ced98, 0xd7175cb0, 0xeacace22, 0x62bb8a56, 0xded124e5, 0x6557fb5f, 0x13a1131d,
+    0x6a42d448, 0x7c8e341a, 0xa774abc8, 0x42c867f0, 0xb7cf7913, 0x400871f7, 0xe2e64d95, 0xaadec261, 0xab17a32a,
+    0x2fdc0ae7, 0x999faaef, 0xbb257184, 0x53de6f3f, 0xf321a6e1, 0xc30e2f2e, 0xa1506645, 0xc83d5596, 0x80be8e93,
+    0x9801a157, 0x0881d99a, 0x800a21b6, 0x930503fe, 0xee711b7c, 0x99b1f7a0, 0x7b7b433d, 0xfb8c38ae, 0xd3754b4d,
+    0x12f554f3, 0xdd9e9ecf, 0x079d74a4, 0x5e03bb19, 0x4b724345, 0x122bcc54, 0xe1edf02f, 0x96dd1253, 0x43b27e0c,
+    0xa4f898e7, 0x59a7d063, 0xad38be52, 0x389f7e3a, 0x44b3021b, 0x133ea819, 0x0103aab3, 0x46246644, 0x5cd60e3d,
+    0xe9e86434, 0x2a3585a2, 0xb12b3ba5, 0xb4197c2c, 0xb3d62eec, 0x4613ab1d, 0x4c8715b6, 0x3ac383e2, 0xd3d7fa5e,
+    0x293f212e, 0x714f8524, 0xd005ca27, 0x27176c01, 0x1d515b20, 0x4d1df263, 0xbe5130f5, 0xbcd9b944, 0x637598cb,
+    0x06a1bc85, 0xea51b9c7, 0x3e7532aa, 0xde7608f3, 0x90da23e3, 0x215f5092, 0xc90cbaa7, 0x794fe0e2, 0x2ff847af,
+    0xac6f4691, 0xfeee4986, 0xcbe3b9b2, 0x4f501060, 0x451b6ee2, 0x6b66b6a8, 0x20521107, 0x0b49da4e, 0x0ad5e737,
+    0xd9573b40, 0x964bb6fb, 0x604ba9c4, 0x6e7926a3, 0xf08980fd, 0xe08c0f9c, 0xc465ec56, 0x0ee03686, 0xf9ca2eab,
+    0x2ba55b08, 0x1645848a, 0x5093d4d9, 0x563c7ebe, 0xb29f7015, 0x99f5613b, 0x3eee69a0, 0xcdc71536, 0x317d5635,
+    0x3d6794b7, 0xf7cb66c0, 0x1529b192, 0x2286eafa, 0xa639a862, 0xce5c70c0, 0x7a69258a, 0x9604b749, 0xa6876c9a,
+    0x4f59a845, 0x9006cfb9, 0xd7f6144f, 0x838b1405, 0x07930f7b, 0x6b3fb870, 0xbfb2c47e, 0x996147f5, 0xe0de7d52,
+    0x52e8592e, 0xb01e35d5, 0x66d2e1d8, 0xf7780a45, 0x39af858e, 0x0a1b1182, 0xe8568b26, 0xb241556a, 0x494e8379,
+    0x5f98006f, 0xebdb9307, 0x38460f1a, 0x41b639b3, 0xc919e117, 0x5b2fa1cf, 0x1f99f1eb, 0xc49164d0, 0x92502bf7,
+    0x19748889, 0x13080884, 0xe9033583, 0xba7f4ca8, 0x2ad254bc, 0xf047ce3f, 0xf8a6b199, 0x2a544bec, 0xc796a458,
+    0xc3efd83b, 0x79af45e3, 0xba3562dd, 0x374b1541, 0x1a767052, 0x498ed38d, 0xc1361d6d, 0xae77c476, 0x8ba13129,
+    0xbfa0e927, 0xc72d48c6, 0x4592a485, 0x1d2b6911, 0x1886374f, 0xa463af0d, 0xe4f1795a, 0x3d1fb74e, 0xe865ac90,
+    0x68f8f1b0, 0xcb3733c2, 0x2b39097b, 0x924ee0d6, 0x3d4c065a, 0xc3e4c7ed, 0xef810487, 0xb77397ba, 0x109b4bef,
+    0x82412885, 0x4a9e1d39, 0xe379b023, 0x40d4012d, 0xcbc7af8a, 0x3354331c, 0x4d6fa8df, 0x40bb2c2d, 0x9b33ea23,
+    0xce998214, 0xbe893378, 0x24b19f9a, 0x8d7a90f4, 0xbfe2aa4f, 0x8849e89c, 0x7c8e0c2b, 0xf445034a, 0xb787b2d1,
+    0x88403006, 0xe79f468a, 0x1fc49f6d, 0xa3644543, 0x8ce265ac, 0x44c3fcb7, 0x14b7b4d6, 0xbeb193cf, 0xce2e5421,
+    0x3896ccd6, 0x214286f2, 0x8e6fdb71, 0xedc65aad, 0x87b86fbf, 0x32cc9563, 0xb8ed4ef1, 0x7adada9f, 0x73982e36,
+    0x9b7faa1f, 0xcb702603, 0x17a04d4a, 0x44a533a9, 0xbab6fe4e, 0x5339757a, 0x9e0f4d34, 0x8864f866, 0x6b0f397f,
+    0x7fe0513e, 0x8d991db8, 0xc9714533, 0xccdb69ed, 0x27624ae1, 0x20c61c48, 0xddd67e1d, 0xb6bf908f, 0x7eacf65e,
+    0x143a4c6d, 0xe978335c, 0x6df9e839, 0xb7633932, 0x5519dc9d, 0x17230972, 0xb605b9f7, 0x18b92770, 0x8e6d77d1,
+    0x9d0468f5, 0xc4892329, 0xa5de790b, 0xdb4ffc34, 0xd4f02685, 0x471391f5, 0x842e8ae9, 0x628c8aea, 0x25d1d706,
+    0xbd1d383a, 0x6db781dc, 0xc2a327c4, 0xf0c4b356, 0x63cc1dc0, 0x7642a84a, 0x4fa98393, 0x29b2b0cb, 0x3412763d,
+    0x4effa761, 0xf6bd0336, 0xe1f209a8, 0x5233ff5a, 0xa92a0bed, 0x6495df83, 0x439f053a, 0x73271e4f, 0xdbfe7446,
+    0xbf9668fb, 0x3cfde1d3, 0x71a70524, 0x5df1488e, 0x0e43f07c, 0x67f9287b, 0xbf04bb2f, 0xc9ffea67, 0x9c2cc8eb,
+    0x74281a6a, 0x9649343c, 0x09fde17b, 0x877be207, 0xb504860d, 0xe06cd06e, 0x48103f6d, 0xe2043f48, 0x268c3d69,
+    0x1500ae4b, 0x45f83f22, 0x4ec84259, 0x1fa1e641, 0x198b933e, 0x8f068cba, 0x243e6867, 0x27dc326d, 0x88c18b23,
+    0xc30325c3, 0xa7c58af9, 0xc1f46a39, 0x29a024d7, 0xe8f52afe, 0x549d1746, 0x022500da, 0x758fbdeb, 0xc4cc2764,
+    0x9b1495e2, 0x4f5ff893, 0x7287dc86, 0xbfafd2d7, 0xdc32c7ef, 0x8594147b, 0x553b0b8b, 0xc4ed30f0, 0xfa9765df,
+    0xc6258f7c, 0xeab62314, 0x6278747e, 0x27d163f2, 0x66342534, 0x6c47e4e6, 0x0670dbbe, 0x3927ddd7, 0xd48e96c8,
+    0x55e37d46, 0x3f354919, 0xb648683c, 0x618aca08, 0x949e74a9, 0x29367a2a, 0x0750dfe7, 0xe0042b24, 0xc1a90bb9,
+    0x93aaf072, 0x48211274, 0xf8759d97, 0x18df9460, 0x8e3e051b, 0x53e2806b, 0xcb683196, 0x63afb9de, 0xdad00713,
+    0x6251adee, 0x759fb158, 0xa5b91309, 0xd78dd450, 0x80ab92c6, 0x6b436212, 0x8b3dbd07, 0xa95cfb63, 0x20041dad,
+    0xa7d253f9, 0xf3790175, 0xafb3c9e4, 0xfa491462, 0x1fbfcf5d, 0xcbb61d8a, 0x9fb9544c, 0x08b4fa62, 0x3a11b572,
+    0xeffed6b0, 0x588234a3, 0xa3b52055, 0x533e3a4d, 0xf7283b98, 0x53a2cc78, 0x5ad01e62, 0xacf3f914, 0x9ab50216,
+    0xbab67db3, 0x9ad06fe0, 0xa4a16587, 0x967e9ce2, 0x111a28ef, 0x8e2173a3, 0x1e141013, 0xb6092d87, 0xf86a558e,
+    0xbf2fa0b2, 0x21fcc3f2, 0xf5cd0103, 0xd60013c5, 0x8bdf9427, 0xdf6bc22c, 0x20912d53, 0x7b38eff6, 0x03546084,
+    0xc7d6873e, 0x7f0923fa, 0x6fd86317, 0xb95b44b1, 0xe918e053, 0x86948224, 0x07a68222, 0x1cee1986, 0x67fb72b0,
+    0xeae341fa, 0xe7f713ac, 0x2a5bfd6f, 0x10e49f43, 0xca458fd2, 0xa4fff7e5, 0x5b6628f4, 0xed840d2c, 0x35a7d052,
+    0xc0d186f4, 0x613afbe9, 0x13134d96, 0x0186b3c3, 0x3692b1dd, 0x3bb52328, 0xb9d5ea64, 0x9f307225, 0xb20c791f,
+    0x34ec21fe, 0x9c1b7d32, 0x4ca6c59b, 0x654e669b, 0xb6bed80f, 0x8acd77cd, 0xf518928f, 0x9ac8c69d, 0xbc978e88,
+    0x87102a21, 0x635551c5, 0x1f1b0696, 0xc5044cb6, 0x0ef322d3, 0xafd1e9cf, 0x755f6078, 0x4c3ef8c0, 0x477b3f76,
+    0x8a6df76f, 0xb728efb6, 0xf4990a7c, 0x560b97f9, 0x79edf7bb, 0xb5b5fba0, 0xb8ec7ac7, 0x3f75cf85, 0xa058c51e,
+    0x80f9f043, 0x710b3b39, 0xc0e83049, 0x465dd7a5, 0x859cc855, 0x0e678210, 0x67dfe37f, 0x7ea629c2, 0xc3cf7108,
+    0xf16990d5, 0x1f83d175, 0x518dcd03, 0x806671a8, 0xb57da12b, 0x22541f90, 0x24efcb07, 0xfce8c0de, 0xce89b916,
+    0xa7f6972f, 0xe3ec9311, 0x68c09a90, 0x073cd42b, 0x5dde5882, 0x455b7a72, 0x69e281df, 0xaa4600da, 0x67fdb1d2,
+    0xdc700b6e, 0xd80ff1cf, 0x2aeae381, 0xd1faddac, 0xe1605518, 0xc158c9d2, 0x54ca3c93, 0x2e277e6d, 0xfd654c3b,
+    0xddad3df3, 0xc8eeac28, 0xc644b1c7, 0x13bf67d8, 0x0c9684c2, 0xc32f57b6, 0x05106777, 0x852b4ae0, 0xbb058415,
+    0x13d7d092, 0x8801ea29, 0xaec50fd3, 0x6550f769, 0xe58a16c6, 0x8436acf5, 0x3fc93a13, 0x45f75959, 0x834afd6d,
+    0xae54b33e, 0x66607902, 0x183af68e, 0xce34f24e, 0x4fe3da81, 0x5e68edeb, 0x32ac7925, 0x4baadfd3, 0xefaddf33,
+    0x410443be, 0xb8a3d830, 0x4f193c4f, 0xa4022cd2, 0x6ed0d9a5, 0xe7e704a7, 0x393aed90, 0x7d6aa321, 0x2195269c,
+    0x285773e8, 0xad468833, 0x517fe698, 0xe540293e, 0x8bf3aab1, 0x4aa1bb4b, 0x5503ed2a, 0x6aa38c8e, 0xc30a1f74,
+    0x0dbde301, 0x68b065dc, 0x2d3a272b, 0x9bf80f8f, 0xc8cf6d17, 0xbdda1a10, 0xf8f0932d, 0xb38053a2, 0x29953a3b,
+    0x15d64bbf, 0x5316a476, 0x944968d2, 0xd2f22048, 0x4ea19ead, 0xc24d7049, 0xa2289ea8, 0xdd53f7c4, 0x59ae7703,
+    0x49be8787, 0x9e7dd83e, 0x84922997, 0x2ab9a89f, 0xdc942d37, 0x4652945c, 0xbfbe2377, 0x998c9b2f, 0x04f8d013,
+    0x8df4dbef, 0x97c9a858, 0xe58f9113, 0xd76d0c81, 0x0c12af4b, 0x2fbc3cce, 0x7b03feb4, 0xc7bf0dac, 0xbd782cd1,
+    0x99a64a32, 0x2d9416b6, 0xc77a7b88, 0xcb974aac, 0xaf1a193d, 0xd300a0cd, 0xc1aae5d0, 0xc643374f, 0x99492a30,
+    0x44777769, 0x752ade7a, 0x490d9391, 0x59bbfa8c, 0x34e804f5, 0x283ef3ff, 0x9af0d126, 0x0fb3c5aa, 0x43f744ff,
+    0xb84ac696, 0x904994b5, 0x0d46509f, 0x26c030a9, 0x658ab36a, 0xca4ed0be, 0x6af3d20c, 0x1c602be9, 0x6a19bd0a,
+    0x343465cb, 0xcff4867a, 0xa53c20b8, 0x4c6e4cf1, 0x30e3eef2, 0xe599e683, 0x0e0c323b, 0xa09e7dbb, 0x9c205698,
+    0xb370d5bb, 0x9e7451f4, 0x96c47f17, 0x815532ba, 0x860c4956, 0xebb675d3, 0x2955cb2b, 0xe3f860e3, 0xc0fdd850,
+    0x5c3aa721, 0x049be23d, 0x16ecd44a, 0x93dbc415, 0x45b261f9, 0x877d115d, 0x8b73b983, 0xa18fc3e9, 0x94bf9cf7,
+    0xad0cb7ee, 0xb2426324, 0x05ef7685, 0xee02daa1, 0x7c37b9e0, 0xef1a9560, 0x680dbcc6, 0x13e5570d, 0xb325a48c,
+    0xd1e1df97, 0x4947a973, 0x354ef1b6, 0xf313ed27, 0xf16fa5ff, 0x44b9972d, 0xc34d3a2e, 0x0e021ed8, 0x74b5afbf,
+    0xba1330ec, 0x8e183223, 0xb8dd911a, 0x4b113304, 0x4b6e196f, 0x6d4a39ed, 0xc37a42a0, 0xcc7dc5e3, 0x376c2194,
+    0x7c53c0ea, 0xb9d01b9e, 0x261b287a, 0xd1196ce6, 0x7a562521, 0x1e9e2103, 0x8f890796, 0x5e6c4c5f, 0x8f3517d0,
+    0x1f12bd5b, 0x54a7e501, 0x3aee8268, 0xe59313c3, 0xfd074447, 0x23767530, 0xee2f3c6a, 0x74567e88, 0x0b63e219,
+    0xf8649d3f, 0xf71c6871, 0xf6603c48, 0x8ed9c058, 0x2f33bccf, 0x0ebef79c, 0x009a4160, 0xb169ddb3, 0xa83506dd,
+    0x4afaa4d0, 0xa4b23fac, 0xc8afaf08, 0xe7af9db3, 0x7c0badda, 0x36bb0ed2, 0xd4c62357, 0x50c4dafb, 0x849425f5,
+    0x03929937, 0x61b5d16a, 0x9a718c6f, 0xa5a8e2ef, 0x31fce7f7, 0xcad89c57, 0x9831da65, 0x9777fba4, 0x810c892c,
+    0x9768a528, 0x50d98729, 0x855cbe94, 0x8f3d2d34, 0x107fa88a, 0x2517d899, 0xae659132, 0x1dd7e17d, 0x5d80bcce,
+    0x66deb0af, 0x8f084590, 0x6bba14c6, 0xc08a1681, 0xb662d008, 0x1b1366e4, 0x14736c8a, 0x8c87ff0a, 0xfaab7770,
+    0x15584ae5, 0x041ffc88, 0xcaac8a85, 0x057494aa, 0xec5d4835, 0x67febdfc, 0x24585914, 0xb44cd503, 0x63d36aca,
+    0x7b10d4b8, 0xd81ad087, 0x4ff5ad7f, 0xf562f387, 0xfe226ea3, 0xbecd1c06, 0x0f4db7c3, 0x63197ce3, 0x3f5fa664,
+    0x599664be, 0x4e69ae55, 0xcfeff4f7, 0xfe5cbf0c, 0x63cf01c8, 0xd1bc5a17, 0x63e5a38e, 0x20465560, 0xee29b302,
+    0x32b2594c, 0xe702a4f0, 0xda12a7b8, 0xf1e2ae0e, 0xb8916ee9, 0xd2694897, 0xc285fa24, 0xdf568652, 0x431ed903,
+    0x57e58c56, 0xcaaf2724, 0xdda77be9, 0x54b68b55, 0xcb5e7a99, 0xdfabcbf6, 0x5d9c8e80, 0xb10a777f, 0x6a484599,
+    0x257df4fc, 0xf268f1a2, 0x5f975b91, 0x880e8484, 0xcb76a0df, 0x07fbe9f9, 0x66b80f31, 0x63eb8176, 0xd7e73271,
+    0xed0e9730, 0x3d93f44b, 0xd4baf448, 0xe188f28f, 0x35025782, 0x795b0f0f, 0xbcc5017a, 0x58ab225f, 0x8fe9a35e,
+    0x89d5b8b4, 0x2ad40480, 0x06dc9c37, 0x18a52013, 0xecefa385, 0x1e7a6b23, 0x0e850978, 0xde66ead2, 0x467cd4af,
+    0x657e08e0, 0xeef7a50d, 0xf844e972, 0x84ee80bc, 0x3bb61dbc, 0xb04c72b9, 0xb38f2832, 0x37102ac4, 0x6b8d787e,
+    0xaecad772, 0x8b7da88e, 0xcae5757f, 0xfcc1d57e, 0x2b36cc48, 0x96558819, 0xce4d623b, 0xc9067653, 0xecb85234,
+    0xee151fa2, 0x375840e1, 0x2eacaa5c, 0x2c8a5243, 0x785eec0f, 0xad80f872, 0x119591c4, 0x560cbdd0, 0xcc0885a7,
+    0x9858e48c, 0x65c08b64, 0x51dbead2, 0x143e42c9, 0xda7ebdb5, 0x835df7a3, 0xcec826a5, 0x6398e0fc, 0x2dfbe1d4,
+    0x6321af1a, 0x41b6703e, 0xbc59a422, 0x0c5d4449, 0x55bfac11, 0x1c794abb, 0xcf7cd13c, 0x7c4d70f7, 0x5b2a6410,
+    0x22f8897b, 0x70b86dd0, 0xa877034e, 0x492271a6, 0xae177038, 0x5d7fff3f, 0xd1a41422, 0xd2b4390c, 0xfeb1681b,
+    0x7200f228, 0xbc197a3a, 0x0462b5c1, 0x5df17e06, 0xe6aef610, 0xa205f1a2, 0x94c0efa9, 0xc49ccc33, 0xbc0e23ec,
+    0x7e1db5cd, 0x0c00d8d5, 0xa17d7716, 0x355f8347, 0x9cda945e, 0xf81d31e2, 0x3490356d, 0xdf8f0465, 0x7d6a68a0,
+    0x19a1a548, 0x09dde077, 0x92f290a2, 0xaecfa293, 0xb2e52cc2, 0xab167652, 0xa04f0358, 0xd3483737, 0xedb1d9cd,
+    0x5db921af, 0x0c26b64f, 0x7aa69eba, 0xd2062e74, 0x1c1364a3, 0x7898d729, 0xb1040232, 0xcffec806, 0x441d17a1,
+    0x37e260ee, 0xb791f7cf, 0xe8680f46, 0x82d36273, 0x6fa462fb, 0xc6d29e5d, 0xa8a8dd33, 0x3e083b5c, 0x9ea842ea,
+    0x0eaf1fc1, 0x52080015, 0x5289552c, 0x833aef28, 0xf1aa3d34, 0x75997729, 0x364cab59, 0x49531bce, 0xe8c9e1a6,
+    0xfc1413b6, 0x0945a537, 0xeca4ce56, 0xbacf3650, 0xd5d3fe71, 0xb68ee580, 0xef2594a6, 0x675cac13, 0x6db26d6f,
+    0x838ac380, 0x53c30b32, 0xeb498547, 0xfed1cd48, 0x70ac42ca, 0x07fe815b, 0x03bbc7af, 0x09bd256a, 0xa372c8f8,
+    0x7d5b59ea, 0xc16fe720, 0xcd568626, 0x2fcef398, 0xcdebb2ef, 0x3bc71a53, 0x24e1accd, 0x21120698, 0x396df496,
+    0x1c8d07ab, 0x3b161782, 0x0dc9c2fc, 0xa9429f7d, 0xf33b099a, 0x84a743e0, 0x2b7189b4, 0x44f2775f, 0x7fa0d8ce,
+    0x8e7e0d70, 0x612c141e, 0xf5c6a29d, 0xd5161fa1, 0x8a13591e, 0x124ae588, 0x00681a40, 0x60e5bfa2, 0x1a495706,
+    0x1faeda9e, 0x541425fa, 0xf93e2794, 0xa52841ec, 0xfacdffdb, 0x8815ce1c, 0xb12f9164, 0x4bfcd75b, 0x433a230d,
+    0x695062ad, 0xed18504f, 0x784eec23, 0x2e73b541, 0xd273f932, 0x5cf8b224, 0xea315aa9, 0x7a6a9107, 0x1190de52,
+    0x2adcc796, 0xd5a751b3, 0xbf20ede9, 0x1320fd47, 0xd42251f4, 0x4fa11daf, 0x27679abc, 0x5d4aa59d, 0x10518145,
+    0xe110af06, 0x8bf909fb, 0x6f8a5832, 0xe24ef61b, 0x5762ebeb, 0x0c52032d, 0x35a32057, 0x51d955bd, 0xf45bf589,
+    0x2bd4cfc6, 0xad06f85a, 0x9fb8bb3b, 0x8abe13a7, 0x1074de84, 0x53af7b8e, 0xae270671, 0x9f3f179c, 0xf65c426b,
+    0x9cb58cf3, 0x93eaa3d2, 0xb0e3522e, 0x46256cf2, 0xf87e5b18, 0xfd358751, 0x4753d690, 0x186da980, 0x77b39e40,
+    0x7a5f29fb, 0x1d474a73, 0x0db96219, 0x8613689e, 0x3fc5ff4c, 0xaa19c559, 0xf5889d33, 0x0dc9bee4, 0xd1c1b29a,
+    0xcbdb41da, 0x1ced4983, 0x2286db8f, 0x69157920, 0xee8eef74, 0xf014cb06, 0x8532b9df, 0x671e267e, 0x58de8f6f,
+    0x157bef1a, 0x42980829, 0x690c0667, 0xdf3dabdd, 0x7cb2eaf8, 0x10a8d8f3, 0xb2181c27, 0xa8dcbe8b, 0x8a52d826,
+    0x765a62c3, 0x15420303, 0x76fb2b18, 0x3b34e983, 0xf43f40a6, 0x77119df6, 0xea33654f, 0xb9ab0e07, 0x1fb68901,
+    0x5721215f, 0x2bf1e57e, 0xea093e38, 0xccfe629c, 0x4163d4a8, 0x8a9e29c7, 0x7c086a08, 0x2928812d, 0xe385fedc,
+    0xc42299e9, 0xac4b7622, 0x19c63564, 0x08370d3f, 0x525e2037, 0xb14b2a6c, 0x8821d1f9, 0x9335ac18, 0xc29c4f96,
+    0x3f6f22d5, 0x6ab9c5c0, 0x06c15f7d, 0xf1472545, 0xa03494c9, 0x0386469d, 0x393c11d7, 0x2c829098, 0x49b0edea,
+    0x6d82e60b, 0x6735c236, 0xc9bf9791, 0x4a3db468, 0x033250e4, 0x14b9a1f6, 0x46f78085, 0xecd168b1, 0xcba95092,
+    0xa7da882c, 0x17de012c, 0x1e125708, 0x053a2729, 0x32223732, 0xa77caea5, 0x28a4fb37, 0x36265c61, 0x58c2cbc0,
+    0x7329fc16, 0x77bed276, 0x02aa9d43, 0x846245b6, 0xb39aac44, 0x1651c517, 0x17459f45, 0xdc146a52, 0xc4308e37,
+    0x43ad6eca, 0xabbb9d2a, 0xe18d7f7e, 0x777b24fe, 0xcd9346a3, 0x4335b204, 0xf84c0885, 0x8b3d6b84, 0xb5dcd45c,
+    0x27a62415, 0x4fdc8b6c, 0x63c271ff, 0xd3d9031d, 0xf10f57ef, 0x979b55b6, 0x11dedf2d, 0x543a259b, 0x3215d85b,
+    0xade74808, 0xeb6cc51b, 0x6cbe0881, 0xbbbcf197, 0xf0383bf6, 0x1ee6c15c, 0x6571920e, 0x60847ee4, 0xe1b71b59,
+    0x0994d6b9, 0xe7da0c75, 0x51cf6b57, 0x5ee22294, 0x0476d7d3, 0x74611015, 0x43eac692, 0x02572278, 0xb94d139f,
+    0x055bed92, 0x21cdbe93, 0x7da73c45, 0x28ba73c9, 0x493c60b7, 0x7de7d133, 0x1c7b8391, 0x66aee1ec, 0xf7a48369,
+    0xc5c01a22, 0x0ea1761d, 0x90bba361, 0x87110c17, 0x44aecadc, 0x7d0ef836, 0x6e5864b8, 0xa54f3a97, 0xc2771063,
+    0xa249cd6c, 0x68e268a5, 0xc8aac20d, 0x3d3b80a6, 0x66420495, 0x61f42d24, 0xeab88ef0, 0x870303a8, 0x9d41bd99,
+    0xaa9ad227, 0xcb3ba69c, 0x453f9a39, 0x780a9e7f, 0x825bc09e, 0x75dd5712, 0xc0366ada, 0x968679b9, 0x649bdebb,
+    0xe8a5abc8, 0xe3e8ad19, 0x8cce91f1, 0x4c4404c9, 0x26eabcb4, 0x902d8587, 0x3ee677d7, 0x9daa1164, 0xd8f4af71,
+    0xde430144, 0x67251a83, 0xb166cce9, 0xfcad5b42, 0x44eeb67c, 0x4ac480a0, 0x940da84b, 0x9a4520df, 0xd0c503c8,
+    0x29d8f46d, 0xdc11ae16, 0x74858555, 0x50ef3102, 0xbebe97a3, 0xe1243561, 0x99becbb7, 0x883782d3, 0x50ff8eca,
+    0x8a2f6569, 0x0c57915a, 0xbd0739db, 0x3c645829, 0x7a192c94, 0x3a777eb5, 0xbfa4e43c, 0x8368e63b, 0xae179909,
+    0x430e99f8, 0x9eed7822, 0x2c08f28b, 0xb8f17882, 0xb405e97d, 0xec5372a3, 0x8edc6513, 0xfb0a0e25, 0x1c186e22,
+    0x97c0ba32, 0x3031232d, 0xc8357519, 0xb81c5318, 0xa86f0366, 0x07c2e4ce, 0xeeb87bcc, 0xd7c0b28e, 0x715536d5,
+    0xde1cef5b, 0x55167ed6, 0x6eede073, 0x7ea87d70, 0x4e217ed2, 0xd09853bf, 0xb078706b, 0x6472e4a4, 0x3b8fac2a,
+    0x147e7d71, 0x9c542062, 0x81f67749, 0x836f30f7, 0x844acfcd, 0x5573d683, 0xab0819fa, 0x15632e69, 0x96cb38de,
+    0x12b83eee, 0x21d50d62, 0x41b142ad, 0x5312fdc9, 0xc35cd2c2, 0x357704b9, 0xf57ffa9c, 0xff82f6fb, 0xad214bd0,
+    0x89b0c5c6, 0xf2b83537, 0x77bf5a01, 0x65ac40aa, 0x0f4bf8c7, 0xb132d670, 0x5bdc8de4, 0x9e3afdd0, 0x734f5ea8,
+    0x2f7d056d, 0x18145cee, 0xb9c0ad51, 0xeea2a8f9, 0xea757ad4, 0x6fa1bc38, 0xf1991b57, 0x8fe2d25e, 0xcb9bf880,
+    0xb754b4bf, 0x000c4963, 0x100ced75, 0x6a2c2185, 0x28458f2a, 0x1340a38e, 0xb9b35e21, 0x4790dcde, 0xdfce806e,
+    0xf98c9ed8, 0x83136647, 0xab25c1bd, 0x206b8ff3, 0x7bceb432, 0xd3753880, 0x182edd1e, 0xa6d625d4, 0x50f600a9,
+    0x7db24952, 0xa1f178cc, 0x5abc49fa, 0x8033fe7e, 0xbfeb8d23, 0xd2dd5d2d, 0x13b841bb, 0xba760a99, 0x2b11c288,
+    0x45621d1d, 0x44ea00d9, 0xc34ae254, 0xdfb79a29, 0xda4776b5, 0xea56b265, 0xb6add9b2, 0xd77269f5, 0x9272d5cf,
+    0x50875925, 0x72eeb2c1, 0xb2b24d62, 0x16ff4e7c, 0x26e15cb1, 0x2add03d1, 0x9b35bddd, 0x55ea76fc, 0xaa65bca3,
+    0x5438a259, 0x6c91a155, 0x22a80ccf, 0x5c29627a, 0xfcceb59c, 0xd10b46ba, 0x6160c379, 0x306e95b9, 0x058c9552,
+    0x54c14205, 0x4219ac27, 0xb38a8d84, 0x835a9c00, 0x96c07806, 0xc53af24f, 0xa7e39ccb, 0xebe0f35e, 0x62a6b24c,
+    0x3b42b06a, 0x13502825, 0x3a60a801, 0xee63e517, 0x534100e1, 0x63477aa4, 0x4459913d, 0x778ace5d, 0xb4703a96,
+    0xc3ebce21, 0x6a933205, 0x4ec60ac9, 0xb0dda5ac, 0x93c6e51e, 0xd494a353, 0x9337fe65, 0x867ecc55, 0x80e77d80,
+    0xaddf8d26, 0x709fb226, 0x6a40fc23, 0x81368744, 0x115765bd, 0x8895d667, 0x21b30f26, 0xa3ac8b71, 0x01cb5a30,
+    0x4b0d8dbc, 0x3cc85724, 0x0387fa56, 0x7f41b7b8, 0x571601bf, 0x62d8b680, 0x8d3e20c0, 0x64cd6f94, 0x6f8d5c44,
+    0x766ed43c, 0x0f3737b3, 0xe247b5cb, 0xd6ebd769, 0xf0ea2c3e, 0x3c768231, 0x02d0f0ad, 0x4805f75e, 0x44c46bc7,
+    0x1f64bba7, 0xc3faa691, 0xdea137a4, 0xf56c0603, 0x5130e5b2, 0x892ee35b, 0x983aa37c, 0xf54b0b28, 0x60a00ae1,
+    0x8b2ded79, 0x73e3b6e1, 0xd0cfef93, 0x73154fee, 0x76f542b6, 0x4c34c11b, 0x2c6fbe1a, 0x418f2a02, 0x1bb4ad92,
+    0x61770f6a, 0xafed5c8c, 0x0c977119, 0x70afe630, 0x5878b386, 0x3d84b6c5, 0x666ff28c, 0x3c94861d, 0xcb184dac,
+    0x4b2daac8, 0x15233102, 0x66717cf3, 0x35eaf1c2, 0x94dfb092, 0xbbb6e28c, 0x637a57ad, 0x209ef293, 0x99d1ef1e,
+    0xea052fc9, 0x0f250050, 0x6d4195f3, 0x2c5c086d, 0x7492c972, 0x99f4485d, 0x00267c0c, 0x0b14958a, 0xd5dd2a3d,
+    0xb21951ec, 0x09b11ba6, 0x21ab2641, 0xb408aec3, 0x63e84cfe, 0xc2a7d441, 0x2ce771e6, 0x24d45b59, 0x60ed638c,
+    0x63d0e272, 0xf6545778, 0x2374b537, 0xded82eec, 0x56e8f664, 0x8631ecb4, 0xe15f23c4, 0x830ea30b, 0x90ef8146,
+    0x39cb9e75, 0xf13a4dfa, 0x76aa7032, 0x08fc324c, 0xd3ed92ac, 0x19eb5eea, 0xbe64638c, 0x85dd20cc, 0x863eaca5,
+    0xfe9489d1, 0xa029e4c7, 0xee5af9e2, 0x46572726, 0xfcce0c19, 0xd27b9147, 0xe178d60b, 0x13a5dd23, 0x2bd20dd8,
+    0x3db57b33, 0x888386c8, 0xc2b87d86, 0xbd138662, 0x7b2e9269, 0x631e9772, 0x65e3d592, 0x08e1a05d, 0x7b13ce75,
+    0x918f7d6d, 0x17680af0, 0xb40ed21f, 0xdfeed068, 0x3243db80, 0xf5499397, 0x5d352520, 0x93364a8d, 0xa00bacb1,
+    0x50930ed4, 0x2e93e00e, 0xfb5a4439, 0x92b41309, 0x31e81f71, 0x34287ae6, 0xa78bd909, 0x7cce4cc6, 0x3b205ae9,
+    0x92f25414, 0x21930b61, 0x3fcbe7ea, 0xe26ff315, 0xe344f80e, 0x2660c342, 0x6d0e7ed0, 0x4037d2c1, 0x7a932e23,
+    0xce001f19, 0x8b9ba518, 0x75ce957c, 0xa47d22ae, 0x2a239fa0, 0x2c6e35cb, 0xea402623, 0xdc0b9fec, 0xa4c1f5ae,
+    0x922d1781, 0x1c7cb6be, 0xd379a79d, 0x4e3df04f, 0xbf834738, 0xa4049892, 0x99630c78, 0x0ff3cf9f, 0xf41c0f22,
+    0xa8f5b95d, 0xc94a7925, 0x70320027, 0x25b38b5c, 0x4a533957, 0x233b64c9, 0xfc93a05a, 0xe4070484, 0xf7d659ac,
+    0x13f8685e, 0xeb26d5c4, 0xa7954424, 0x3e694067, 0x6be2915b, 0xd83b1976, 0x6b74f3ff, 0x8cb2d1a5, 0x57a14cd8,
+    0x8e9c3f5e, 0xcf934e9a, 0xc57411e1, 0x1ae79e32, 0x8f35a34a, 0xb63dfd14, 0xec7f30fd, 0x381fb118, 0xfac21327,
+    0x0983d00b, 0x958cac42, 0x2c1ccdaa, 0x1c4f6bea, 0x4ce23016, 0xd2a417e6, 0x44d2e96b, 0x4f5acf0a, 0xa72e4796,
+    0xae4c690f, 0xd06ddad7, 0xb5549943, 0x782d620a, 0x680223fe, 0x5160d40a, 0xf8f0b149, 0x6b2a5f34, 0x719cf492,
+    0xe5b9a8f6, 0xf4873862, 0x8ecc09d4, 0x89d32b08, 0x3f638f73, 0x198c309f, 0xfeacbb84, 0x9f368b00, 0x0eec3e54,
+    0x572693fa, 0x65687dba, 0x9e2e38fe, 0xe939e70e, 0x07a0eb4b, 0xd57d36a4, 0x52eab842, 0xd842739d, 0xa1afbefd,
+    0x3b17e652, 0x885196ac, 0x757fb5c8, 0x0661bef8, 0x2c914360, 0xce728d03, 0x27ae7f6f, 0xe785f039, 0x64693483,
+    0x05513573, 0xf5f05805, 0xc8cf702e, 0x4ea4af5d, 0x2c1d9932, 0x390f9ab1, 0x6a6c2245, 0xfba1a19c, 0x67061806,
+    0xaed142ea, 0xcebd9e2b, 0x149c41aa, 0xd4e22217, 0x76deb46b, 0x19bcf732, 0xdd20c1fa, 0xffdf4c71, 0x452b4e8a,
+    0xbe77d404, 0x6cc5f178, 0x648d495f, 0xf08ceebf, 0x085347a8, 0x6172c8ff, 0x00c48cfd, 0xe725dd6e, 0x0d8937c7,
+    0xbe846dfa, 0x5db78e69, 0x0e006c12, 0xc2cf6255, 0x322d1ab6, 0x6bdbc815, 0x2e3d0172, 0x131565b1, 0x937b13a2,
+    0xacf27041, 0x08097564, 0xc351da23, 0xd2ab078f, 0x74af9abd, 0x9ee9daf8, 0x4c9e450d, 0x73fc612a, 0x882a91e9,
+    0x8d38d8de, 0x6839e645, 0x1a703705, 0xff750a29, 0x5bc004be, 0x4173bca1, 0x2efa4852, 0xf89abb75, 0xb97658ab,
+    0x4156712f, 0xa78c8ac4, 0xc62cd85a, 0x662a6bac, 0xb76590d5, 0x84293455, 0xa99d121e, 0x3380f48f, 0x8bdecef7,
+    0x6c33bcf2, 0x71ec2dc3, 0xb2f0ec55, 0xb1416527, 0x82abb50a, 0xfea1c8be, 0x359f52b4, 0xdc0c04c5, 0xb6f496e4,
+    0xba07d278, 0xcd31dfd0, 0x9b24764f, 0x00dd1c52, 0xa4620ead, 0xc0287314, 0x9dd31385, 0x2b9d9c36, 0x75652ff2,
+    0x24fc0a73, 0x517d1262, 0x6c0c21a4, 0xcb47b6d3, 0x2fa79224, 0x74334aaf, 0xb7af22aa, 0x8fab1064, 0x960709c6,
+    0x102798d7, 0x0b8ee976, 0xfa90180a, 0x60ff2314, 0x1f19a0a3, 0xeba70d5b, 0xa0a399fc, 0x57ea3101, 0x1892084f,
+    0x43204b0e, 0xec8f6cf9, 0x83c2ef23, 0xcfb53913, 0x416a69f6, 0xf95dbd0f, 0x7901d6be, 0xbbf2a1ed, 0xc7483168,
+    0x56ac9883, 0x104bd80f, 0xd6c0c9b5, 0xfc3ab28f, 0x6b78cd0f, 0x425c56e2, 0x50022298, 0x22abf87a, 0x856cb87e,
+    0x8f54c7be, 0x65d084d4, 0x3590ff73, 0xbfbc9394, 0x7b565c7b, 0x3c6f686b, 0x75f484df, 0x05f2edab, 0x9bbf9ec5,
+    0x5695efc4, 0x593ee9e0, 0x514ab99f, 0xff268d7a, 0x7d09dab7, 0xc8e6cddf, 0x37595457, 0xe6df0fb7, 0xcb2ff0d0,
+    0xe8e6425b, 0xcc15de89, 0x80472d28, 0xa4380f3d, 0xd8565c23, 0x9bfca4cf, 0xaf1f96a3, 0x7a6b296a, 0x98162a09,
+    0x9a3c371d, 0x023ea9f6, 0xcc10c983, 0x67bb14fc, 0xa6ab5d0d, 0x66966a7f, 0x0e5ee0c0, 0x07bc43ce, 0xd863b2e8,
+    0x571a7d02, 0x0e41674a, 0x7356bddb, 0x467c5b0e, 0xc51e1a6a, 0x6cd86e1e, 0xbbe59ea0, 0x3a0a102b, 0xc884b4ae,
+    0x3823a6e0, 0xb844555e, 0x3382e582, 0xaa685636, 0xced89091, 0xa20e6ccb, 0xcb9ef39c, 0xd56c0fc8, 0x44f1775c,
+    0x5301a9e3, 0x655274dc, 0x85da2d08, 0xce896209, 0x1d076a66, 0xddbbfc0c, 0xccdd0cdc, 0xd70778ed, 0xa7ee7d69,
+    0x59a7172b, 0xe6deec6f, 0x2dfa877a, 0xc9918c85, 0x08e1344e, 0x82125b15, 0xc9fb6cf8, 0x95bdf173, 0x64521d9e,
+    0x6dfb7abe, 0xc3956fac, 0x660fe1f6, 0x4eee5a92, 0x89e6514b, 0xb0abf6c7, 0x490daaaa, 0x784a2678, 0x79099a9b,
+    0xf3a085c1, 0x722ee6c8, 0x9486820b, 0x597e73dd, 0xed677bad, 0xf7ad061f, 0xcbeb84d4, 0x4792b8a6, 0xe3bbdf34,
+    0xbb10c6b6, 0xaf7dd130, 0xee46e549, 0x1b9ce9af, 0xb021f8a0, 0xd0d2f125, 0xa9943512, 0x7ad3b948, 0xed0aa97e,
+    0x755b4741, 0xa0390659, 0xe06f5c7c, 0x3f4b7999, 0xb3cf9a03, 0x0b3920d8, 0x37d0404a, 0x150b4cf2, 0xec3bdf7f,
+    0x8228a507, 0x0726c541, 0xd58797e1, 0x100c4e4e, 0xf8b8d140, 0x666c256b, 0xf48c3516, 0x0f83f9d6, 0xf16d2444,
+    0x2307515c, 0x7e2e0946, 0x15ce12ec, 0xcb52c444, 0x54c20095, 0xd8d68744, 0x1c0bd571, 0xa802018a, 0x78095b0d,
+    0x75079ed3, 0xbaad98cc, 0x77fa9ecf, 0xa2745937, 0x86fb1d4b, 0x60fa4a1b, 0xf1b49e37, 0x10d17b94, 0x4e857aa5,
+    0xd728f2d5, 0x9eff521d, 0x72f048a8, 0xd35ad1ab, 0x3f183c4a, 0x14167cb3, 0x28fe62f1, 0xb15bd450, 0xabef83e8,
+    0x3ca6339f, 0x4fec629d, 0xf809bf6a, 0x30a24864, 0x63aa5ca4, 0x1cb3fb51, 0xedc8d58e, 0x6c214fcc, 0x1569d827,
+    0xd250bbb8, 0xa3937546, 0x982cdb7a, 0x6549a633, 0x1c4de556, 0x58f13f2a, 0x779aa06f, 0x486346b3, 0xf75b60ac,
+    0xac20dc94, 0xd2023982, 0x1c5d5baf, 0xba52c8dd, 0x09ff07c0, 0x0c26904c, 0xde60e959, 0x479241ed, 0x1b711c87,
+    0x95299541, 0xef59d597, 0x9ef721d7, 0xa6c08b8a, 0x3fc23a44, 0xb2a10487, 0x9716ce77, 0x582e4372, 0xda655e49,
+    0x3c6df441, 0xfce2e8cd, 0x727dcad2, 0x54829fe2, 0xfa08516e, 0x770b566f, 0x6ea4041c, 0xc28d622f, 0x1037d1e9,
+    0x4a58a4e8, 0xd4b6112a, 0x940aef13, 0x40636e8f, 0xe39b2e12, 0xa00e2ece, 0x2d086f6a, 0xaea3c69e, 0x4b60fe85,
+    0x7661922c, 0x75d65770, 0xb194bc7b, 0xf68b11c9, 0x4551d97d, 0xa101eb5d, 0x6168d29e, 0x42595cc3, 0x0742a506,
+    0x1722c25d, 0x16381740, 0x81f531e0, 0x3933b338, 0x614f9ce6, 0x4d701a8e, 0xc69cc128, 0xad2b2867, 0xbe9e4878,
+    0xca95912c, 0xd33d2a6c, 0xbea61dfd, 0x9c18de93, 0xb5e14f1d, 0x30bf26ad, 0x8a734e77, 0xab24a248, 0xfd2311c6,
+    0xdb0ca948, 0x831904c2, 0xa24389c2, 0xa3f4106a, 0x040cf575, 0x9387ebd3, 0x3ad373c6, 0xdba66182, 0x64b4fa90,
+    0x32b55bee, 0x93c52e59, 0xca6b9fa1, 0x23f9c726, 0x2d474f7b, 0x328af842, 0xbd328ef7, 0xa916dddc, 0xb30feeea,
+    0xd69f8f3f, 0xdbee6367, 0x2075166a, 0xe0012e35, 0xb8a78ba6, 0xcfc1f07e, 0x1fa48472, 0x18bce449, 0xf20fbde4,
+    0x812a9f75, 0xe928b2cb, 0xbbf80979, 0xfc2b194b, 0x8dd41299, 0xa8db1d88, 0xca76d617, 0x087baf5a, 0x41aa54ba,
+    0x4977ea37, 0x5969ea0b, 0x816a6ca5, 0x0a93b28b, 0xcb0ebe69, 0x9e343b30, 0x8511c9cf, 0xda05056e, 0x211524fc,
+    0x5f59490a, 0x6091dab7, 0xef6e3c89, 0x5dd98f6d, 0x0820e56f, 0x9cd5ac36, 0x12837217, 0xb913df19, 0xc19ad6d1,
+    0x8761390d, 0xe767fa18, 0x2b85c845, 0x4350b1ca, 0x13ae605f, 0x23600d0a, 0x996f0c39, 0x6c804873, 0x3898be28,
+    0x302aff46, 0x803d5d23, 0x847c7378, 0xfad791a4, 0xb0f68b5d, 0xa5aec671, 0x9e7118c2, 0xd87d05f3, 0x1be8bfc6,
+    0x85041df0, 0xd6edfa19, 0x8d9149e7, 0xd1ba0968, 0x3ec89cc0, 0x7bd49421, 0xd24a9762, 0xaedfaacc, 0x82a3f64f,
+    0x3e710f90, 0xda4cdb41, 0xe6ab5df3, 0x8404e124, 0xd93ff01b, 0x083ac3fc, 0x2a1ed1be, 0x1e7a0d0f, 0x1fd54b01,
+    0x19163b1f, 0x53042113, 0x65b3b185, 0x9ae458ae, 0x8c1c8f2d, 0x2e243995, 0x88e65d29, 0x2629ce1b, 0x0d954ca5,
+    0x04b2afe9, 0xbe31744f, 0xd94ddb92, 0x1cf11dfb, 0x930b41ff, 0x68068266, 0x7f440dca, 0xf44eff5c, 0xbf932934,
+    0x8e635538, 0xdb3dab3b, 0x155ed8ef, 0x4a1e1d81, 0xd96f512b, 0xfbd0406a, 0x3c4c39d3, 0x7d8cbc57, 0xd5608ff8,
+    0x622c1677, 0x7bb1360b, 0x68d18c63, 0x1467ae5f, 0xbcd6bb59, 0x7ecdda60, 0x6d9a3218, 0xdb15e99e, 0x78741c79,
+    0x495128ff, 0x8f30f670, 0xc3c6a246, 0x4c0a00f8, 0xe966a3cf, 0xe0eae451, 0x31edb809, 0x5824a38f, 0x837bebda,
+    0xb26b9ead, 0x77e94cb5, 0x466c23c2, 0x41403a76, 0xdfa10b4f, 0xe578f17b, 0x26d73bc3, 0x0278fb60, 0x279c2c89,
+    0x7357599a, 0x03f65236, 0x17478d1c, 0x4adbacd3, 0x1db80e18, 0x9e47b1e5, 0xb1ad2012, 0x463be1b9, 0xff537a61,
+    0x88fa936a, 0x5921ed55, 0xc61fb19e, 0xeb2de1b8, 0x4b53b76f, 0xd6e43d56, 0x92743630, 0xd220a476, 0xf742a520,
+    0x9b825844, 0xf801f8aa, 0x1cd0d771, 0x4d477f75, 0x368def47, 0xd7d689fc, 0x3de97b10, 0x74f1b92a, 0x76168630,
+    0x2c2d9bf4, 0x8b93311e, 0x390f48b3, 0x8c169a8b, 0x74f56239, 0x51efd3cd, 0x3ec6f092, 0xbe508b49, 0x96aae945,
+    0x26854434, 0xbe5d0c95, 0x3cb701b3, 0x080bad6f, 0xb1a6a8ed, 0x6d4b0e6e, 0x80cdaff8, 0xba82f1da, 0x30109088,
+    0x2c293e97, 0x70635ac1, 0x58cb5ad0, 0xd1ae5477, 0x2b33bc2e, 0x9fde3b0c, 0xbc3ab56e, 0xf331acae, 0x79fac7b5,
+    0x9bc3eb13, 0xb68d9c13, 0x4addacd2, 0x8b0d4824, 0xf8700bd7, 0x163b8b7e, 0xa7a4cd10, 0xa0694574, 0x70f4a9a2,
+    0x5a7ff1b0, 0x05ab5d77, 0x155ecb9a, 0xd06817ac, 0x76ec4419, 0xf0543735, 0x5e999b7e, 0xd1109367, 0xefb90cec,
+    0x592d9dfd, 0x8a84521a, 0x79151d7d, 0x7f4c636c, 0x3bd9fe4d, 0x8ca04114, 0x40cf5052, 0xf7bf26cd, 0x1683bca9,
+    0x69d6642d, 0xd0eb74e0, 0x04602c4c, 0x048b4b81, 0x9ced00ef, 0x887ca0c6, 0x7fcadc05, 0x2e36d76e, 0xdaf35bb5,
+    0xb46bbf85, 0xfc36e3ce, 0xf3c3b550, 0xd687086e, 0x224d293d, 0xa929bee2, 0x0852cb70, 0xcd0c62ec, 0xf7cbb4b6,
+    0xf51c523d, 0xc83756a2, 0xa54273bf, 0x431aaa33, 0x4b450332, 0xa26291ba, 0xb10bdc44, 0x1e1d90e9, 0xb42a1639,
+    0x143940a2, 0xf3024892, 0xde936b1f, 0x191af35f, 0x02ac936c, 0xba27ee67, 0x439ed02b, 0xb05650ca, 0xb5eb067e,
+    0xc08fa98b, 0x9045fb48, 0x54aef742, 0x7bac7c28, 0x7f72aa68, 0xdaffd328, 0x4f9b0f74, 0xa3b8393f, 0x7e010e4a,
+    0x4951e2e0, 0xae68d4cf, 0xe7069978, 0x0887e04c, 0x0d92ccf9, 0x02b3e2d6, 0x231be296, 0x6a286fbb, 0xa4e033d8,
+    0x8699dcc6, 0x99439959, 0x0b26b527, 0x749be9fb, 0x7bf4f717, 0x39a2f3f4, 0x0179ee74, 0x2160b358, 0x38633d55,
+    0xd8264960, 0x79fcd0c2, 0xdf19dfb5, 0x56463e53, 0xdf1a253e, 0xe319cc62, 0x2c6bd408, 0xd86e136a, 0x10997ee5,
+    0x13debfc9, 0x6406584d, 0x86d42d0c, 0x12b97143, 0x4c5276de, 0xe1209687, 0x77f13316, 0x48ad240e, 0xf9f7fa6d,
+    0x48cdb64e, 0xe9be2a33, 0xdfb640b1, 0x13cd85b3, 0x41ecff90, 0x090610e4, 0xb5922b45, 0x23521c03, 0x448aea1a,
+    0x335f9c84, 0x86421460, 0x6bd84725, 0x3b32cdbd, 0x441906a7, 0x93c1d965, 0xfeaba5da, 0x00c58f4e, 0x2ea32d7b,
+    0xdc64b07b, 0x5f90ccef, 0xcd7a6805, 0x4c14cd89, 0x071f5757, 0xbc0f1c7d, 0x11dbfa48, 0x3c53e4dd, 0xf1f24e0b,
+    0xf2dd4d42, 0x3d514200, 0x20e29373, 0x017dc3fd, 0x72aac2e4, 0x48f73156, 0x47b18470, 0xb919f909, 0xae570553,
+    0x44a0564e, 0xdb5b0930, 0x420e596a, 0xe8e59e5a, 0x8d0a35c1, 0x293ddd85, 0x111bbee9, 0xeabf1f33, 0xafa1e14a,
+    0x617bfce4, 0xdca2d0e7, 0x1e455e9a, 0xeca52bb9, 0x862ab2f2, 0xcf134269, 0x17546eb4, 0x4eff477f, 0xc03aafb0,
+    0xdd2f7151, 0xd8997b9b, 0x35afee24, 0xa9b48b96, 0xcc54d85d, 0xa7a5c595, 0x8b7d53a2, 0xec0a65b6, 0x82018b99,
+    0x4392b6a1, 0x1cdc824e, 0x54a0d93c, 0x523e0d06, 0x99157ee8, 0x2d2385c8, 0x39adca3a, 0xb0418c52, 0x650a740e,
+    0x5ae54187, 0x33a99187, 0xdca4c400, 0x8f0fea69, 0xc71cafab, 0x72ff58e4, 0xe7683440, 0xea2fcf2b, 0xba0dc12e,
+    0x8ee09b4b, 0xe557ba06, 0x0499ff38, 0xccc0fc68, 0x3adc0cc6, 0x5a2878bf, 0x632e491b, 0x8f974645, 0x9c808d14,
+    0x847892f6, 0x8a6d73c4, 0x758dc06f, 0xfb675a27, 0xef3b4574, 0xce9f4fbb, 0xbc8ef3f9, 0xac90cdeb, 0xae7d112f,
+    0x12d558c5, 0x7ab0bbd4, 0x77b64e30, 0xa2e8c233, 0x5d36ec7f, 0x0ef6109e, 0x256fbb71, 0x62c48e7b, 0x2f0478eb,
+    0x05cfd715, 0xc2e69c99, 0x6e41d534, 0x7f73ea90, 0x127b5afc, 0x97ac1adc, 0xaa85a8f0, 0xd0262f22, 0xdbacc929,
+    0x092c8b8b, 0xcbd26a25, 0xae13a3aa, 0x047421a1, 0x8668c77f, 0x9f42bf0a, 0x90bfe512, 0x14620b3d, 0xcecd1b5d,
+    0x17c728d5, 0x85e132b0, 0x3102a3c3, 0x1159101b, 0x419d456a, 0x2b07f225, 0x2e995572, 0x90ad2883, 0x86ab2241,
+    0x2461507c, 0xb1b41a10, 0x74cbea9e, 0x4310249e, 0xe0bc5f6b, 0x571ee001, 0x8fd118c6, 0xc97db10c, 0x6feb345b,
+    0x7db5d8e8, 0x13fe944f, 0x338555c3, 0xd1c68e5c, 0x44fbcc0c, 0x39c26ebd, 0x23bc5909, 0x5b6b2a3b, 0xa31b492d,
+    0x26643a61, 0xeac88e5e, 0x1c87072a, 0x96acd861, 0x9bfbd9d8, 0xf84f54de, 0x9bda8246, 0x316b1eba, 0xe1a8c8f3,
+    0xf8e6b3af, 0x35ce4a21, 0x98cb3c57, 0x4b0788b9, 0xf426cb0e, 0x3a9e50e2, 0x0c690326, 0x2656816e, 0xf1816e70,
+    0xcf36018f, 0x5f049676, 0x56a33907, 0x1360e883, 0x7eb4817b, 0x5254d2af, 0xb93484e3, 0x7bba5c6e, 0xdfefa8c7,
+    0xc4d16df3, 0x44cb7e37, 0xc1961e91, 0x2c2b6357, 0x753afd01, 0xa4be9b54, 0xe12520e4, 0xfa61534b, 0xd709f216,
+    0x901c26dd, 0x1a366401, 0xd93c282e, 0x1f2489b0, 0xc53dde0d, 0xa14ebe57, 0x4207d17e, 0x67571e16, 0xeee8f011,
+    0x7fce975f, 0x71685ccb, 0xc8c83645, 0xb772c6e5, 0xcd6f1f53, 0x3edf05d7, 0x618ecd4f, 0xe5136990, 0x70d61732,
+    0x3840d928, 0x0b5da379, 0xf426ca82, 0xe59530ae, 0x9948a465, 0xbb5c17df, 0x6ee41f28, 0xd9970e4c, 0x3d30c496,
+    0x28ddc755, 0x20ed5e71, 0x1fb6ed7e, 0x04bd7f8a, 0x1d8c65aa, 0xc725ff83, 0xe4cd7ed9, 0xf9e3a655, 0x046fe9e5,
+    0x00765168, 0x035d7753, 0x77594e02, 0x6f6d1d74, 0xc19240d8, 0x4ca0d30a, 0xc6b2af76, 0x1b676857, 0x0b1011ec,
+    0xb6745e16, 0x291c851e, 0xea8b984e, 0x29e900de, 0x7605ad1f, 0x9115be07, 0x18c918e5, 0x3986c292, 0x210d9c53,
+    0x7773a503, 0x02e37fb6, 0xbcd3cc49, 0xa4e4961b, 0xc4f7ba04, 0x880a16d7, 0xb5b6cbe2, 0x8364d607, 0xe07d2992,
+    0xd2bd3ad3, 0x315e034f, 0xe51423cf, 0xf2276d77, 0x20344448, 0x5ba60ccc, 0x196c16e8, 0x8ff7c3ed, 0x9a115fe3,
+    0x2b00a514, 0x87d7ea76, 0x7c3bf5a5, 0x59741852, 0x64e3d8a8, 0xe0e0887b, 0xa12804a4, 0xd3e64f0e, 0x242070af,
+    0xf17931db, 0x841fd921, 0x0032edc9, 0x6966ceb2, 0x5668967a, 0x88a8e4e0, 0x9885e697, 0x2065e8cd, 0xdd836623,
+    0xb95e98d5, 0xec808a96, 0x1a1adce5, 0x10d39fdf, 0x0706e50a, 0x741677db, 0x7e14def8, 0xebd2c80f, 0xd46e63d7,
+    0x5025fd65, 0xf47012f5, 0x46d31514, 0x5ddf153c, 0x4c04a54f, 0xd2461368, 0x8f00279b, 0x5776c014, 0x5b5e451f,
+    0x4532f0d3, 0x9df38fad, 0xa80c6ea1, 0x78ccb6c6, 0x213d8fba, 0x73a6a44a, 0xfeb4c241, 0x83718a04, 0x0969ea6a,
+    0x8ddf0b53, 0x6d1646ae, 0x2441557b, 0x0526d9c8, 0x611c933d, 0x349e3718, 0x0c3a1467, 0x644177f6, 0x4de36ab1,
+    0xbe0f2ab5, 0xea76f6bd, 0xe12822e8, 0x34587de8, 0xf9f7dcca, 0xe3e5b12a, 0xfb1abe73, 0x26476974, 0x4eb4b7da,
+    0xc9959201, 0x8186e33a, 0x7e0805d0, 0x87143257, 0x4113b80a, 0xc36b4ba0, 0xaa0db600, 0x06d6da30, 0x4fae7237,
+    0x561682fa, 0x9951f8ca, 0x04e731e8, 0x87e7fb03, 0xc9998e79, 0x19ebecd4, 0xf94309a3, 0x72515c76, 0x1eb97642,
+    0x9a6d0009, 0x7b4d88a6, 0x09465016, 0x4dc1f9f7, 0xc266de54, 0xb5d812db, 0xb16a7c0b, 0x25f9fdda, 0x540d06f6,
+    0x6b2673f4, 0xea8f4c1d, 0x69b51d52, 0x573258cc, 0x38cc9195, 0x104663bd, 0xcbc49b5d, 0xe1cf89b3, 0x64293af8,
+    0xd2b0553a, 0xe4141988, 0x83bb2819, 0x1bbb92d8, 0xc798ab66, 0x3f91f5d5, 0xb4aebba3, 0x30e91dd1, 0xff86844a,
+    0x40ab779c, 0x0e2c1a73, 0x488c7cd1, 0x765dbbef, 0xc8b965f4, 0xc64e0438, 0xe980a7bd, 0x4f11d97c, 0x003267a6,
+    0x0f21aca4, 0x3658119f, 0x593d54a1, 0x8f84e9e7, 0xed32b3b9, 0x7c7ab363, 0xc7e8e629, 0x723c3c94, 0xb2a37864,
+    0x0260eb5a, 0xa1b12d94, 0x07f6b43b, 0x79890a65, 0x7b9199f9, 0x1b286f76, 0xaf07fef7, 0xbf572eab, 0xc3dff870,
+    0xc1ffd755, 0xf3cfc430, 0x04f1b908, 0x4ac1b6c9, 0x9d1b4083, 0x12221047, 0xf0189a85, 0xbf4099b9, 0xb666be04,
+    0x2f49788b, 0xb84fcf4d, 0x9c5dd38d, 0x161374f7, 0x5a4540fe, 0xa0f14343, 0xf2e7acf2, 0xed254322, 0x03d49e31,
+    0x6f7c2fa0, 0x98ca44a8, 0x7d3cded2, 0x0ef7e286, 0xc5c9c50c, 0xe14cf505, 0xf5732392, 0x9906a720, 0x96f19152,
+    0x5b00610d, 0x61ea4c41, 0xba5fe4c8, 0x9cb301d5, 0x03e96c6d, 0xeb731be4, 0xd0fc4288, 0xbfa3ecfe, 0x57be9fe0,
+    0x92df1dd0, 0x7bbba605, 0x49e876cc, 0xcd47f7cd, 0x6e961eb7, 0x279233a9, 0xda6391a4, 0x4f0b9014, 0xd91cba0a,
+    0x47374efb, 0x6bf9f70d, 0x0fc98d96, 0xd4bfc18c, 0xd260988c, 0xa5909238, 0xbc2ab045, 0x3a66940c, 0x9bb88fb6,
+    0xb6b83b83, 0x1ad3bfd3, 0x2f50b18b, 0x34e0bcbc, 0x82e4674b, 0xfe6bd68a, 0x220dcb8c, 0xe3e69f1a, 0x19015446,
+    0xf9be2570, 0x2044edc6, 0xb2a84ae6, 0x784fa436, 0x53ebec58, 0xfc777497, 0x0021fa6a, 0xb20ceb12, 0xa5dda059,
+    0x26b67462, 0x8428c177, 0xf895518a, 0xbf85c9e1, 0xae4c54ed, 0xac6fd944, 0x809a9342, 0x1f75637b, 0xc00e7986,
+    0x208697ff, 0x0b92ba0b, 0x9236cd21, 0x849132e0, 0xd32a83a7, 0x84cdb8f2, 0xcc349107, 0x08a3db72, 0x063b788d,
+    0x8bb81b52, 0x62a01576, 0x0f73b24f, 0xdfefa406, 0x165af3ff, 0x0ba3cd6b, 0x340b8f33, 0x1a9470f4, 0xc8738f35,
+    0x1d900fad, 0x4a24678c, 0x0ae5e6dc, 0x5d655c04, 0xc9de74d6, 0x57000766, 0x084e05bb, 0x554c8753, 0xd6e1a736,
+    0xf14562c7, 0x03ebe549, 0x1c3f71d6, 0x16880de0, 0xeebbe74a, 0xbd8da759, 0x6f54ff4c, 0xc5a3005f, 0x57dfcc59,
+    0x54776766, 0xd9334141, 0x7ddf2af5, 0x52f6694a, 0x85971dc1, 0x60fcf820, 0xecce6764, 0xcc36f8c3, 0x9d9fbd7c,
+    0xa5d582fc, 0x549f3915, 0x607cc28c, 0x8b98da4c, 0x52f41e0d, 0xcb121e2d, 0xa2b15d88, 0x8e4459a7, 0xca6323c4,
+    0xbeb0e6f3, 0x1162347f, 0x503b224a, 0x38891a75, 0xe855b9a4, 0x21ca5714, 0x2d828e8e, 0x74ecc0a3, 0x5dcda61e,
+    0x36d5c294, 0xce4bf8cf, 0x0bf67243, 0xce02424a, 0x7258c588, 0xe43d6146, 0x54aee549, 0x559e8369, 0xa188d5a9,
+    0x625f3092, 0x40a4184c, 0x4924a10e, 0x0bc2dbc2, 0xe2389789, 0x9f8cd528, 0x6c4f2667, 0x05773244, 0x19fa0b0e,
+    0x85d659d1, 0x2708dffe, 0xaf438494, 0x3543938e, 0x48c6daba, 0x3c58b996, 0x977c7ce0, 0x656438ee, 0x05452131,
+    0x7b6e6118, 0x86a5f16c, 0x1a4e983c, 0x57119064, 0xaba58204, 0xcbae9f81, 0xb36f1fc6, 0x5221ec90, 0x5fbe5a27,
+    0x54be037e, 0xbed68fd4, 0xe6927aa7, 0x41cf44a6, 0x0c7c6255, 0x9e8ed736, 0x50fae29c, 0x3ce2ff05, 0xd7264633,
+    0x588c42fa, 0x773b2621, 0xce13acad, 0x04fd79cd, 0x821a6c94, 0xcab79c02, 0x5fe0c4f4, 0x4f5b91b5, 0x027ad6b3,
+    0xf59f357a, 0xe79de129, 0x61b48228, 0xcf22fcc3, 0x5b003f46, 0x4d93bc51, 0xe9abf9bd, 0x5299ed1b, 0xe4bf4f20,
+    0x6d78e47d, 0xdcd0fc7b, 0xed0db979, 0x86e9ad41, 0x55aa9dc0, 0xeeb37551, 0x66628108, 0xaaf7602f, 0x3572d535,
+    0x81e49daf, 0x638b0f2f, 0xccce635f, 0x70b05a5b, 0xdd72eedc, 0x1e6f0f10, 0x5e8cdec8, 0xfac11815, 0x32038a58,
+    0x982a8f0b, 0x083e5843, 0x88277c40, 0x2f38bd61, 0x55bdb856, 0x81b20c3d, 0x2bbbb07d, 0xe6fd8637, 0x8facf235,
+    0xb64ee174, 0x1a661ebe, 0x090aeee4, 0x74aefdb5, 0xa41d8371, 0x14bd54e6, 0xfc144e25, 0x50834e85, 0x22485197,
+    0x5d4fd32b, 0x5eccf4f6, 0x861bb07f, 0x680ceb3d, 0x035ededd, 0xd6469d35, 0xfbb2fa28, 0xbb70ea98, 0x191f2981,
+    0x124956e0, 0xbf209606, 0xfd6468d6, 0x2deb2958, 0xa846bf40, 0xb056e546, 0xe0a06829, 0xbfba7d1e, 0x839c9b44,
+    0xf14e5fd0, 0x64448473, 0xde6f3142, 0x6c142675, 0x3d660973, 0x74227d60, 0xc5f56a8d, 0x53ea7b3b, 0x8b84d505,
+    0xbc3636a6, 0x5a10162e, 0xdc3c7ba9, 0x6dbc53a7, 0x22e3af52, 0xfec9eeb4, 0x14695a31, 0xe1f94d4d, 0x5e8b26d7,
+    0xce5a48bf, 0x413aa770, 0xc0816da3, 0xa9e9d887, 0x4caf89a9, 0x6b29a615, 0xb413029c, 0x95943ffa, 0x23e6c3ae,
+    0x1d07bdd4, 0x1b08ec87, 0x247af152, 0xee1df6b8, 0xa10ef827, 0xccbe9688, 0x3b87a10d, 0x6981f0ca, 0x15195ab8,
+    0x7e187f8e, 0xc5679b82, 0x3f6011f4, 0x3477209e, 0x2c00fde6, 0x64499ea7, 0xaf110f91, 0x8dcbdad3, 0xd2319109,
+    0x0de682e0, 0x8c4232ca, 0x9c960601, 0x9994276c, 0xa7ac4cba, 0x31e2c0d3, 0x83e5f192, 0x157c950b, 0x083472af,
+    0x58ad1d52, 0x96d6bf54, 0x03a6198b, 0x644fccd6, 0x8dc80bca, 0xe18d836f, 0x1f1d1bb6, 0xbf78c84b, 0x9865ea5d,
+    0x11495cd8, 0xae147f36, 0xe62cbe53, 0x88af880c, 0x9ef66c14, 0x6a029b94, 0x8492cf33, 0x28bed103, 0x98f6343c,
+    0x3ef6d56e, 0x5f624d8e, 0x38fb1bb0, 0x5444a26f, 0x49822483, 0x68c92315, 0x093d6115, 0x6e7fac07, 0xfd2076ca,
+    0x8c5966db, 0xe5efb061, 0xe521b7c2, 0x7c29c63b, 0xe7a91c58, 0x8add745b, 0x75cae5af, 0x80070e04, 0x6db51c7e,
+    0x620c57f7, 0x03badb5b, 0x39962460, 0x72378dfb, 0xe81d028e, 0xbcef585f, 0x0c74f539, 0x50b10a6c, 0x6e8a307f,
+    0x098e6cb0, 0x0927c8cb, 0xacc7e3a8, 0xd1362f8d, 0xe7053ec7, 0xfaf67137, 0xdc6b1738, 0xe5acd45e, 0xe28c719e,
+    0xa9ce7f85, 0xc4aa2928, 0xb9191959, 0x28f61d3c, 0x9b3d03d0, 0xd8d32173, 0x7809e4a1, 0x137525bc, 0x4c0af4dd,
+    0xe5ba2acc, 0x89c105fd, 0x7d2db4e4, 0xb01d90b8, 0x2b745375, 0xde920bc0, 0x3c9a5936, 0x035c7177, 0xb440df97,
+    0x108baef2, 0xf10b3bd4, 0x63b6e105, 0x7f8e96d5, 0xdd33f895, 0x27d6a135, 0x1ef1423c, 0x2fbf17cf, 0xfc62158d,
+    0x5d76bdca, 0x5be12c53, 0x9c520207, 0x13e97255, 0xe660d4f2, 0x039bf5ee, 0x4f91eb02, 0xfb2fecc3, 0x9c7b6763,
+    0x4fcdca56, 0xce01b573, 0xa87a09bb, 0x625dfc00, 0x7776025c, 0x6ba3ed7c, 0xb16ef7f8, 0x02b8b092, 0xb6c04f9d,
+    0x2ba1f973, 0x73dc1616, 0x8e0a6b7a, 0x6993e66a, 0xc75a852a, 0x3bad57d0, 0xfd4491bd, 0x55a8946b, 0x0fce318f,
+    0xd47e82a0, 0x414a0bca, 0xdc06d9da, 0x71b0d20b, 0x33cf3e83, 0x40f8a467, 0xc106ff68, 0xf95e4c29, 0xc1cd39a5,
+    0x4130a8f5, 0xadd17960, 0x5b976d0c, 0x98b540a4, 0x4d6e8042, 0x52979001, 0xceee78cc, 0x1a7fcb6b, 0xf60015f2,
+    0x4579c26a, 0xcb153709, 0x2bdb35a1, 0xf276ad2e, 0x12454820, 0x199a5de4, 0xeefc2c37, 0x46454fbe, 0x3346b9e6,
+    0x8da975ae, 0x4665b94f, 0x0ff38fec, 0xb41462ab, 0x68ed1bb9, 0x0313f51c, 0x83d56b11, 0xb4c449dc, 0xcc026ae9,
+    0xb7ad28fb, 0xd330df8a, 0xcd41ae39, 0xec8ab450, 0xef100bca, 0xcea9ed5a, 0xce262488, 0x373c9e21, 0x4cb6ec36,
+    0x8310e3bc, 0x12745b4f, 0x3c5aa756, 0x9bccf6f9, 0xea76e733, 0x1baa9c6b, 0xad43bf73, 0xbe837c1f, 0x7de13944,
+    0xfc19295e, 0xefc3232b, 0x19f3cf7c, 0xa9122ca2, 0xa1fa776c, 0x023b4898, 0xb95f75e5, 0x6f55cc54, 0x1bb0e1f4,
+    0x425d5ad5, 0x0bcb9f16, 0x3143a494, 0xe01ff6a4, 0x82c2f47e, 0x95c5482d, 0xaffbfe19, 0x59efb9f2, 0x0d1b1674,
+    0x08bdd339, 0xd1de1068, 0x9a1156ed, 0xf8fb321e, 0xf17c6ae6, 0xfeee3241, 0xb7b06f59, 0xd8217ac3, 0x9cd6a77c,
+    0xb63c30a3, 0x620c1856, 0xb7b55000, 0xdc4a75fa, 0x4a5bb15c, 0xc0647295, 0x9aa5d0f0, 0x8e304c43, 0xcb829a5f,
+    0x1b8be4d0, 0xdd359d3f, 0x87ba065f, 0xa0f23e39, 0xb4bf28e6, 0xc7148f76, 0x568f6d43, 0x9a0df59a, 0x18919caf,
+    0xac3296c3, 0x38b3fea4, 0x4640aa76, 0x3f76edc4, 0xafb86a92, 0x61f0edab, 0xd304cd32, 0xa7d35622, 0xe4703ca4,
+    0xf6ff5c8d, 0x387e85f0, 0x586bbb2a, 0x7d11710d, 0xda46f993, 0xd9676030, 0xb4acf8fb, 0x734d48f0, 0xcafaf824,
+    0xb70b0f8b, 0x9be79cfd, 0xcc627728, 0xc78c6d92, 0xf61679cb, 0x9eaa3950, 0x5ef09d8d, 0xe334c441, 0x500a85e2,
+    0xde131f79, 0xcf64719a, 0x3935b0d6, 0xe939436d, 0x8d29c728, 0x0da9eb1b, 0x0451ce78, 0x42772a7d, 0xfd6de32a,
+    0xc0273294, 0x7a4a1e48, 0xaa67b26d, 0xeeefa9bc, 0xc36b25f9, 0x6e343d1f, 0xfb2e0a79, 0x7c7e3454, 0xa5fd8a1d,
+    0x612f46e9, 0x061dd8f7, 0xa3b5e967, 0xe85f9136, 0xd3223d28, 0xc9582d0f, 0xe8d1e974, 0x5fd3a8bc, 0x887f4419,
+    0x8ec3c7c9, 0xac1b39af, 0x5c64bde6, 0xf4f1773d, 0xd7b11c8a, 0x793e4c9e, 0x00063fed, 0xc228b670, 0xc15fae13,
+    0x9287092d, 0x32bd3bd8, 0xb6e5cfdc, 0x5b013ae1, 0xf5f95843, 0x928a744f, 0x37131bd8, 0xc195cc3b, 0xcd2ca178,
+    0x77333d56, 0xc3f1a3c3, 0xcf4336d5, 0x10ec0979, 0xf3f8e636, 0x1f472d5c, 0xf6b3b6b4, 0x9040adb6, 0x513c674f,
+    0x508637ba, 0x3433c9ca, 0x2396be5b, 0xc5ff606c, 0x356fd845, 0xd843bbbd, 0xd687e446, 0xbdbdfc24, 0xdab1faf0,
+    0x7eba1369, 0xebee972f, 0x462f613e, 0x1bd1d27d, 0xb2924eb4, 0xcf87f5a3, 0xaa56ab72, 0xd6c0be25, 0x3f736218,
+    0xdb194ff6, 0x68411c87, 0xe1499dab, 0x296da464, 0xf0371a1c, 0xa1a475bc, 0xbb866f11, 0xf62834cb, 0x917aedda,
+    0x56976d6c, 0xc3bdb3c2, 0x1be3a771, 0x542b0949, 0xc3b6b688, 0x13a6d2e4, 0x273d9ee1, 0x2d551abc, 0xfe5ecf47,
+    0xcdb8419b, 0xbaae19ff, 0x45ccd3ac, 0x8434263b, 0x91c83a73, 0x90fde69f, 0x6270df02, 0xee9010b6, 0xee615521,
+    0xce302aa7, 0xcdbbe813, 0x6dfdde67, 0xf5498074, 0x0ccc7d5b, 0xf4815ae4, 0xc3b4f6c4, 0x65b2a940, 0x231bac55,
+    0xb93a115f, 0x65c437d1, 0xeb1a5791, 0x3af25577, 0x1ccf154d, 0xae03974f, 0xd1664053, 0x756053f8, 0x1f1bee0e,
+    0x04ecee3f, 0xc0cf5a47, 0x4a34bcf1, 0x2777d7de, 0x1197b571, 0xa5e6ec08, 0x7a709689, 0x7bfe5865, 0x5446292d,
+    0xa64e59c5, 0x45a4963f, 0xb55eaa87, 0x8c5f87a0, 0xaae647c0, 0x996a2ad8, 0x1a47929a, 0xd7134a1f, 0x66077eb8,
+    0x64e5b498, 0xd3d91a29, 0x5bb16c94, 0x89fedc2d, 0xdf825c2c, 0xefbde310, 0x1bd55839, 0xc14868e5, 0xbd54a4f3,
+    0xc1d3f713, 0x65712e5b, 0x7e575d45, 0xe89af253, 0x37b35e11, 0x3ff8c05f, 0x24ebd98a, 0xa9d92842, 0xdfe921a5,
+    0x7299dcb7, 0x78136baf, 0xbf37cbf5, 0x654e2996, 0x61a7bd2f, 0xbecc81db, 0xdc9e8bd9, 0xc269813c, 0x2b7f2fa5,
+    0x36ced51d, 0xc7b30000, 0x518fbdf9, 0x7c04f6fc, 0x95d88115, 0x7f294b1d, 0xc189f805, 0x7fa239e3, 0x8b6ba28a,
+    0x87d3c15e, 0x11c64434, 0xb4934568, 0x66af3899, 0x0b1d0467, 0xc464765a, 0xb68704b9, 0xb49db990, 0xb67606a0,
+    0x50357a67, 0xa6d7ad21, 0x94d19dc9, 0x8a3c9515, 0xcf7be7ff, 0x3bab154c, 0x3696b971, 0xa780d9bc, 0xd95bbfdb,
+    0xa91220c7, 0x34590598, 0x676d629a, 0x3e6dd591, 0xa529b3cd, 0x84ee5257, 0x13c8068b, 0x4ee871e0, 0x4651a246,
+    0x0ed04156, 0x65a99a49, 0x20765bcb, 0xa19bb12d, 0x03eafb95, 0x3e7c6532, 0x8ffc7c70, 0x2314fdaf, 0x41a3b1f0,
+    0x76b2d3d9, 0x0ebe30d2, 0xa57736db, 0x051c625b, 0xe1be7c38, 0x102e03f9, 0x9cdfe1e9, 0x2123ff6a, 0x8cada030,
+    0xf44970bc, 0x1c37b5db, 0xc9835e05, 0xb7ba0b37, 0x58cd055a, 0xf9fdb50c, 0xf4099522, 0xf452985a, 0x7c2adddc,
+    0x65f8a106, 0x68013028, 0x774f87e9, 0xf22b1935, 0xf881fcd2, 0x1166c2c8, 0x37cff7fc, 0x6b448620, 0x9ced30f4,
+    0x55618e19, 0x50304672, 0xded1797b, 0x70dde0d2, 0xb63bd763, 0x39b60fa0, 0x1d8d9730, 0x6f7965ad, 0x3d9f0597,
+    0x20dc5058, 0x491a22c5, 0xbe0fc08a, 0x778e67ec, 0x51fab6f2, 0x89723584, 0x2ef2ef68, 0x14eb48d6, 0x619e61b6,
+    0xf763b873, 0x8de98bbf, 0x6407c06c, 0x3460198a, 0x9cf93cf6, 0xf4da1f27, 0x9cf9f534, 0xd5a62aa1, 0x5967187d,
+    0xab6aaf3f, 0x4df419f4, 0x822db070, 0x0ce84024, 0x97b8b604, 0x005b5741, 0xa94c0f9e, 0x50d24da5, 0x7d2bd080,
+    0xd34188db, 0x756568f6, 0xd2ee2111, 0xac6f18ff, 0xdc4efb1c, 0x60edc12d, 0x981a0684, 0x1f2781f3, 0x98271318,
+    0x30f2f409, 0x7abda07e, 0x0c21d70c, 0x54d74b7e, 0x5ed1aecb, 0x68c9fcd6, 0xd730c736, 0xa9965ed9, 0x122529ff,
+    0x5dd7c813, 0xf340f24b, 0x474c73f7, 0x8b67472c, 0x5e12771d, 0xbbf2c9e2, 0xe06c57a8, 0x1cbf64b2, 0x63731a1c,
+    0x0da0bd13, 0x44af65ff, 0x7a5dbc5a, 0x406410d3, 0xba115b13, 0xa7e51c77, 0x5a34ef8e, 0xffc959c4, 0x34ba519c,
+    0x10c6e5f1, 0x47bfff15, 0x69b555c9, 0x94322229, 0xba176334, 0x9e895c68, 0x66ac62e1, 0x290bfff6, 0xf8af11c3,
+    0x3d8d315f, 0xbac28821, 0x3cdab156, 0xa2346475, 0xb976144c, 0x83f3b59f, 0x082dce9a, 0xaedd6de4, 0xc3e6e0c3,
+    0x04a636e5, 0x63c5353c, 0x62ae063f, 0x3d1642c8, 0xb573c8ab, 0xe9421582, 0x53bc1632, 0xcbc2b2bb, 0xa3e36124,
+    0x4ccd4688, 0xe1960c2a, 0x2130ae71, 0xc0033a60, 0xbcf3425f, 0x12902db9, 0x0605c547, 0xfcd65611, 0x3959499f,
+    0x5dfa4c83, 0x721deb27, 0x0b0d244e, 0x933f6a83, 0x05dbbd3a, 0xb650e6f4, 0x28353782, 0x1245a2d9, 0xcd9c4031,
+    0x6137e6ac, 0x6ad350ac, 0x38977ab4, 0xb473c000, 0xe1869097, 0x55ce6753, 0xa2cffee7, 0x5ada0aa8, 0x28b3d48f,
+    0xb4092605, 0x03a23b9d, 0x2c1d3f17, 0x18cc38fc, 0x4446f909, 0x0555be51, 0xb1712b74, 0x931cb5d0, 0xb982b448,
+    0x13c656a6, 0x32f03995, 0x605e2352, 0xd6b7dd30, 0x8b07ca9e, 0x59299c1d, 0xbfdd2836, 0xe02357d9, 0x6bebc850,
+    0x2ae5e31f, 0x72ce0df9, 0x12e7efdc, 0xac9735bc, 0x8b5ac63e, 0x6263982e, 0x567e8be6, 0xf066f3bf, 0x755325e1,
+    0x1f806dfa, 0x5d2df0b4, 0x06037ba8, 0x9b1c0fdc, 0x38fd9b0d, 0x2f3c5aa7, 0xc71c683a, 0x5af0b2a3, 0x2536f9b6,
+    0xafbf0120, 0x17183e6a, 0xc08f2bf0, 0x26aaaedc, 0x3fd415ea, 0x0d4d3b9d, 0xdaf30e36, 0x0082fa27, 0x495b5b9f,
+    0xa47ae3eb, 0x20ea9044, 0x3ab878b8, 0x6290c6fa, 0xd150e6c8, 0x84b360d5, 0x50c144f9, 0x2cfefc97, 0x881fe218,
+    0xe0863e5e, 0x3bb915a5, 0x298bdf4b, 0xccfcee85, 0x5f8340b9, 0xc7dd73bf, 0x13953e9d, 0x0bb2531d, 0x8a10efcc,
+    0x8f425938, 0xc52d1e7f, 0x8a5cf586, 0x36154225, 0x0ae6664a, 0x6a949717, 0xfcdad514, 0x022b912c, 0x6e5b5b0f,
+    0xc0f2b4f1, 0x32304550, 0x32f31ff9, 0x2277e5c2, 0xa14d06b4, 0xe28a25fe, 0x556396ef, 0xee94b750, 0x16d5acf6,
+    0xe9a7d1ca, 0x6b432f30, 0x133d6232, 0x4fdbd875, 0x497d6bbc, 0xf0983f94, 0x93add9ac, 0xf1cd9b4b, 0xb871b17f,
+    0xfe67acbb, 0xcc6f6ee3, 0xfd831aed, 0x0715db4b, 0x737222b9, 0xfcf8d1fa, 0xf7b6fd16, 0x7370c761, 0xad0c6f37,
+    0x65616f49, 0x42406827, 0x808f44aa, 0x64bce8c8, 0x91363826, 0x39cdfeeb, 0x9b51f093, 0x3a6a6953, 0x1c6c6b64,
+    0xf1e9e5df, 0x419f132a, 0xd6ce42ac, 0x50b3d97c, 0xa8587a36, 0x97892f6c, 0xfb8fcd04, 0xfda49910, 0x7f07dcc4,
+    0x666d6c00, 0xd271e296, 0x75457a9a, 0x40558f1a, 0x02ad5fe8, 0xab50b813, 0x2a38e0ec, 0x171ed8fa, 0xd6ed70ce,
+    0x40a77229, 0xc4f37e8d, 0x82deeac7, 0x6b01614f, 0x4b2a2f5d, 0x6fca4bcd, 0x0fba865c, 0x788e1271, 0xc79100a1,
+    0xa9ffd994, 0x643c4444, 0xfad81826, 0x385363e3, 0x6de3eae4, 0x2b81601b, 0x7c44d637, 0x9399c7a8, 0x991fee7d,
+    0xff947a74, 0xa33b99ac, 0x11b97d98, 0xac05100f, 0x69fad0f9, 0xcf4deeb3, 0xa347e824, 0x130b950b, 0x3b55aaea,
+    0xfe9a8ff5, 0xeb25e52a, 0xf3d5dfcf, 0x74df2803, 0xaba67f5a, 0xb507e04a, 0x83330e66, 0xc939270e, 0x70fe0fdd,
+    0xa2deced8, 0x3cbf655d, 0x8edfa12b, 0x1be2f76d, 0xaeebb885, 0x9ced0a0e, 0x7d3f8660, 0x770c3e34, 0x8a141150,
+    0xfd6765a2, 0x8f5a453e, 0xcdae3056, 0x3354c882, 0x19bf9d13, 0xbbc2a7e9, 0xebebcc73, 0x07130a9d, 0xc2e39c1d,
+    0x9c17f666, 0x0be342aa, 0x4cca441f, 0x866635c2, 0x494b09c9, 0xdf4187cd, 0xd080986c, 0xd79987c1, 0x722558dc,
+    0x77823958, 0xb28394dc, 0xefd79310, 0x82eb3190, 0xd037ac71, 0x3af89111, 0xfdc9b2a0, 0x9a758f0f, 0xad36189b,
+    0xe53ef5d3, 0xf65a5597, 0x44d4132b, 0x7150ca52, 0x1dc65045, 0x5dc350b3, 0xea6c8f8a, 0xdb3cbc7e, 0xd33b5084,
+    0x392f7b72, 0x755294c6, 0x59d3fb96, 0x6305f1fb, 0x09d1b5a4, 0xae5268ce, 0x408f62f6, 0x5fff530f, 0xce0894b2,
+    0x77868eaa, 0x1fc58d18, 0x0fd5ff97, 0x91a7d19a, 0x9057d3d4, 0xcc67f50c, 0x1799ff22, 0x3eb76335, 0x9f388cfa,
+    0xf7dd15ca, 0xea9c39c8, 0x755ef069, 0xa785f15c, 0xc1e8194d, 0x4d8957ad, 0x1d7a2a96, 0x5d8917b3, 0x1bc7a82d,
+    0x504f7a75, 0x92b84c4d, 0x82371d85, 0x6ef28ae9, 0xfcc9c59a, 0xdfa1545f, 0xf3f6ec6a, 0x488722f9, 0xee2928b4,
+    0x9d17fe6c, 0x41e23bf5, 0x41eb22cb, 0x06c69506, 0x55560e20, 0xab2bf67c, 0x788ad56b, 0xbdd445e0, 0x4f28fd15,
+    0xde6b2c70, 0x5c4aa0d0, 0xab2e976f, 0xe42e6813, 0x6c0ea4e6, 0x5cbf4fdc, 0x70722c8e, 0x1a9e912e, 0xf1898021,
+    0x644bf7fb, 0xe725e911, 0x2b9341ed, 0x0dd86ff7, 0x53db0b26, 0x09ad289d, 0x675bb59e, 0x8edb9269, 0x593d4251,
+    0xc69349e4, 0x5bc015a1, 0x10bc0333, 0x041d0ccd, 0xc258250f, 0x55d66ef0, 0x57176f45, 0xeb63012c, 0x8d8a723a,
+    0xec3f431d, 0xb927bfae, 0xfd4399f1, 0x26da2934, 0xb6881f4c, 0x2f1b8c61, 0xdb3a0c4a, 0x7b7bf8a7, 0x92498405,
+    0x9ec7bfe9, 0x6a305479, 0xbec51d12, 0xe6c4366f, 0x6f020210, 0x49c3a448, 0x14371a82, 0x583113af, 0x2d5f4a60,
+    0x0ebd74ae, 0xaaa04aea, 0xa471ada7, 0xa2280be3, 0x34461346, 0xf4aa249c, 0x1be92c9a, 0x91a981c3, 0xe4068c5c,
+    0xb8884071, 0x98a57f15, 0x9147c16f, 0xde46f4c5, 0xc333a740, 0x34c7e7ea, 0x25ca66f8, 0x8bf56b06, 0xf4facdef,
+    0xf523196b, 0x9840e88a, 0xd26bc756, 0xc2368c5b, 0xec656629, 0xd12c16cb, 0xb7eaeaa3, 0x88a17000, 0xdf541ce5,
+    0xa247c540, 0xa6771fb9, 0x5df3e788, 0xfefb0557, 0x46d0e136, 0xfbe025ba, 0xf055f263, 0x535cc7ec, 0xd0f217fe,
+    0xbc063a3a, 0xc5b5c830, 0xaaefa5a6, 0x6fd32c0f, 0x0219ca78, 0xb8a1b286, 0x7281c48e, 0x951a041b, 0x59109b89,
+    0x130068a5, 0xfcffe7c3, 0x8d535b09, 0x15d9a9db, 0x22f02778, 0x57f38ea3, 0x950dfad2, 0x033063c2, 0xeaa588c6,
+    0xc1062cdc, 0x9771efe9, 0x5aac5c9b, 0x602f1070, 0xc73e78ce, 0xc926ff02, 0x46a85aba, 0xd0ba704d, 0x530338f7,
+    0x24179c54, 0xcd80ef7a, 0x74baa396, 0xb17b9c1e, 0x1fbaad2c, 0x85ba2cd3, 0x378a86a7, 0xf4bfdde4, 0x567192e0,
+    0xa39e2a7b, 0xa9c5c69a, 0xf4ed2d38, 0xaf689384, 0x51ad92e4, 0x860418d0, 0xc0c0d4bf, 0xc0afe19b, 0xaa26fe5e,
+    0x1326da58, 0x562ceb94, 0x207c8260, 0x78a4258e, 0x35da0cd3, 0xf9e94833, 0x9ec6f6f5, 0x390ea8e8, 0x0d04a474,
+    0x12f3de34, 0x885c0243, 0x050c9e46, 0xdff0323b, 0x3617646f, 0xdbc3a288, 0x6905f3ca, 0x9bef1022, 0xc2b81c14,
+    0x1005eaf1, 0xf3dec340, 0x060d694b, 0x936ae875, 0xff39f7f1, 0xe7146f6b, 0x8a7934d1, 0x526a1632, 0xe75a85ab,
+    0x2a464a4c, 0x4cf13e7b, 0x676cb179, 0x44957589, 0xb18d3c44, 0x973f1f58, 0xa6a435cf, 0x384c63e3, 0x44465b29,
+    0xaabe3964, 0x9e885e9d, 0xe21a6bd1, 0xd3851300, 0x1aa6eb2a, 0x022bcc24, 0x07ca3700, 0xe8ec51f1, 0x3c85209c,
+    0x1cba9961, 0xf49d4383, 0x58d7a05e, 0x52570100, 0xa44273f0, 0x5526fcae, 0xa4c31750, 0x9bef83e2, 0x0013db31,
+    0xb6d7f55f, 0x3fdf342b, 0x583b96ff, 0x86e48275, 0x30931925, 0x760e4c01, 0x6acdf83c, 0x90f0bdbd, 0x34973570,
+    0x323708c5, 0x5bcc1c84, 0xb28a2abc, 0xe6d62863, 0x653b5f73, 0xda5ae0f2, 0xf52cae30, 0xbaa6a7eb, 0xc273c961,
+    0xb463650f, 0x327e0655, 0xb25f6e90, 0x263640bc, 0x41d366ab, 0x6cf53427, 0xd3056bdd, 0x1d2bd095, 0xc9e7146c,
+    0xc391f1cb, 0x515d5c46, 0x3f16ada0, 0x1836e812, 0x7f2aba61, 0xee7d9ac2, 0x8dec9594, 0xb54aba9d, 0x1fe6f7e1,
+    0xc38f4576, 0x06c17a15, 0xd3557601, 0xafd82b2f, 0xac62c2ea, 0xb8c98b93, 0xf6319a82, 0x1995648d, 0xf89ef2ef,
+    0xc300b8be, 0xa9b5978a, 0x14a1dded, 0x7d60071e, 0x9756ddd4, 0xa770cc79, 0xc87acc86, 0x8c4492e3, 0x7bf3f966,
+    0x4fcac9d9, 0x5e1dde4d, 0xe1cf989a, 0xb61231ed, 0x565e7d1d, 0xf7a21cf4, 0xdf9bd0b3, 0x9420543a, 0x33a60ae7,
+    0x57a567cd, 0x35a9ba3b, 0xf711d73b, 0x388d3c77, 0x28fbe9d7, 0xc49e0b44, 0x4eb321cf, 0x21933c7b, 0x30391aa6,
+    0xbc572a5f, 0x1147c2aa, 0x11c28c33, 0x40f58686, 0x64d891e1, 0x654519a8, 0x41e81139, 0xc4ed78ab, 0x9ba90b76,
+    0x5e58ee4f, 0x5f0fa446, 0x79130fe2, 0x94513c4b, 0xdcc2b213, 0x7821610f, 0xb4ede021, 0xab2d271b, 0x7192dce4,
+    0x02bdb53a, 0xc5812ee6, 0xdeb4b3ef, 0xd50a31b3, 0x18c336dd, 0x93d6cfb8, 0xfb360d43, 0x4701f552, 0x0566f3ef,
+    0xacc3e484, 0x60a6436d, 0xe830f3fd, 0x776862ac, 0x746674bb, 0x508d6792, 0x75f34f09, 0xecae26af, 0x19417d33,
+    0x8092ef98, 0x3e474fac, 0xe55525bf, 0x9f7e5119, 0xbe992e68, 0x19e162b6, 0x4093773c, 0xf2e597a9, 0x3843c69c,
+    0x2b26acf9, 0xf2fc098d, 0xfcb880b9, 0xc0e199d6, 0x48963014, 0x236fb67b, 0xd3b56983, 0x537c8fbe, 0xca98878a,
+    0xbd698e5e, 0xe8c4d3fc, 0x5d2b1456, 0xeb544c53, 0xf4080995, 0xfa4b04e2, 0xb77e887e, 0x8d733695, 0x81e69aa8,
+    0xd1afccfb, 0x251606e8, 0x71906a99, 0x60b3045a, 0x80bef68c, 0xa95da2f9, 0xd5503cbe, 0x9766c4ec, 0x82000976,
+    0x2e5bdd5b, 0x92c96649, 0x7027d627, 0xcdb23297, 0xc6a5a3c7, 0x2aa13537, 0xbf04af21, 0xcb2bbd03, 0x03f13d17,
+    0xaf74037c, 0xb595aa91, 0x779ad059, 0xa240ac7a, 0x0f27976f, 0xbd71bf07, 0x48d3017f, 0xd8560b6c, 0x13e2e329,
+    0x5a2c697d, 0x5cb29638, 0x03ed0a94, 0x6167a622, 0xcb473333, 0x3919326a, 0x2c98623e, 0x3d244caf, 0x90d51bb6,
+    0xeb11fed2, 0x875a7f5b, 0x74dde759, 0xd91d010e, 0xfd5955bd, 0x0ce1469a, 0xc808bbb6, 0x487d70e0, 0x5bbb7df7,
+    0x200ebc8c, 0xbcde0e15, 0xfbd36925, 0x1cf08121, 0xa166fb88, 0xb0340add, 0xe90caf5f, 0x4f62f569, 0xa74deabc,
+    0xfab19309, 0xe8f55a17, 0xc8acf3d6, 0x0820d55b, 0x11c2e01e, 0xbccf9aec, 0xe3ba07f1, 0x7e4c9663, 0x4e9b7a3e,
+    0x9aa1dc50, 0x8cf79a8f, 0x73f99544, 0x34fc1bea, 0x48c97f7c, 0x43b4ed80, 0xca8ed092, 0x5f7c7ee2, 0xa231fb6a,
+    0x5456022b, 0xd17985cc, 0xc1faf969, 0x8e25259e, 0x61cdae41, 0x8a546afd, 0x4c1df59a, 0x401781b1, 0xf42ab986,
+    0x15668ab3, 0x14d69d99, 0x629eab5f, 0x4694be9b, 0x223a58de, 0xc72eb31a, 0x1c7785ab, 0x00e005e8, 0xc58fd8fe,
+    0x385682e1, 0x4cdbfca9, 0x4d15c153, 0xa6643e9e, 0xdfb66ff1, 0x81ea7be9, 0x095adc28, 0x86bbbd91, 0x67159085,
+    0x8bef051c, 0xa34a545e, 0x05322a0b, 0x4020a034, 0xb9f3fbde, 0xa8e6c546, 0x1b31e8ef, 0xd52c4985, 0x70cca50c,
+    0xe7b67ac0, 0xb1794f9d, 0x7bcb8068, 0xc6b40e38, 0xfcf78710, 0x54d75dfd, 0xb1890930, 0xaa8670bd, 0x574a045f,
+    0x63a7ea3a, 0x3d1518da, 0x45afde93, 0x2fb4c044, 0x1caf761f, 0x3cd3a7c0, 0xcb88dc19, 0x5e279a67, 0xba130bca,
+    0x59084bd5, 0x7dedbc85, 0xdab1c6b3, 0x515bb239, 0xc2ad0ebf, 0x25d4f95f, 0xca11cf21, 0x69d00805, 0x703d4885,
+    0x4ac4009c, 0xf397e834, 0xb63549c2, 0x626759bc, 0x3c1e4ea1, 0x35957b94, 0x102a60e5, 0x2e9aa040, 0x05a51a9c,
+    0x50229d0d, 0x6409d3b8, 0x1d63866f, 0x52ead6c5, 0x293ee7e4, 0xb6c057ad, 0xac549bed, 0x86dc2599, 0xa287d3ca,
+    0xb9ad8d51, 0xffa79d02, 0x6e581933, 0xfd3f0246, 0xc9397668, 0x6a04d8fe, 0xe98e45f6, 0xc1e131ff, 0xcbdb305a,
+    0x21477e8e, 0x9bdb6321, 0x79087b02, 0x2078a68c, 0x2612e70e, 0xacdba456, 0xead37fe3, 0xb75e0d8a, 0x84f83a11,
+    0xf0160485, 0xe22f0afa, 0xc13c010d, 0x88e5a4c2, 0xdca681f8, 0x41accd1c, 0xe9677aa0, 0x2207b753, 0x616e50d8,
+    0xba4a59e0, 0x0609bd0f, 0x0e66caf4, 0x9cd5f178, 0x1b26f8a5, 0x8aea926b, 0x7b7f6792, 0x92bb6214, 0x0e1e7e5a,
+    0x9c451bcc, 0xa7e2d743, 0x86f9f5cf, 0xbcb1e9b8, 0xfc882026, 0xe6516a5a, 0x6ea03613, 0xae0d4eb7, 0xdd15d198,
+    0x7013f8f5, 0x360700ec, 0xd1498b10, 0xbd97cc78, 0x0cd4ede3, 0x51e5a4d1, 0xecadf8c5, 0x68388611, 0xd57e1235,
+    0x24b03c4e, 0x11193a7f, 0x663b4a90, 0x70388d21, 0x1858aed5, 0x3b6be8e0, 0x6cb5bf16, 0x3a6f7173, 0xb67c63f5,
+    0x7cf1ef49, 0x6b06d745, 0x7ca928a2, 0x40fd9192, 0xdcd3e1a9, 0x6e151d24, 0x6f3c3e5c, 0x03ef9902, 0x9c7727f7,
+    0xd93fc249, 0xe8bdf6ad, 0x50f72d5f, 0x637dd8e8, 0xd846e5eb, 0xe8c2a869, 0x5e79fba6, 0xd608be92, 0x5adffeec,
+    0x2f4951bc, 0xae075b13, 0x4566104f, 0x0974a7b8, 0xde1afed4, 0x3d7d93df, 0x372c2f20, 0xa72f8cf8, 0xaaeba036,
+    0xca9b3d34, 0x18a70bb7, 0x1cb08d0a, 0x15b4ed4f, 0x84db5083, 0x53647566, 0x9945b992, 0xb54b5040, 0x8bf7bb86,
+    0xa079b606, 0xb84533e3, 0x9724fb53, 0x4a817481, 0xbcffb793, 0x7a769610, 0x34239243, 0xe7a0d919, 0x15b05480,
+    0xeb268268, 0xe5ceabb1, 0x682dcffb, 0x06c6f1a1, 0x2fd2929a, 0xd902625b, 0x13af4600, 0x2f62563a, 0x8abdfdbc,
+    0x21fc6ab0, 0x7c7c3269, 0xce8bdba6, 0xc4a8c513, 0xcf08184d, 0xa26460ae, 0xcc02140a, 0xeaefcb72, 0xb66d1e45,
+    0x9cc35c4d, 0xb2446a38, 0xdf793960, 0x067f6afb, 0x4f7cf469, 0xc1130daf, 0xc162a7ab, 0x64b73d71, 0x68a37dc3,
+    0xcbe0a233, 0x3b1f2b82, 0xaaef1103, 0xf7cdf7d6, 0xe4f5a01f, 0xa7044df6, 0xb0c88497, 0x22461fc2, 0x0a775875,
+    0xcaea9687, 0xa875cea4, 0xe4329585, 0x1352a1d3, 0x491ae95a, 0x9953e216, 0x33092c0a, 0xe361bb24, 0x52ffd3c1,
+    0x9eba6a77, 0xc587a418, 0x244a2a6b, 0x7218220e, 0xe4678ef1, 0x99294db6, 0x06d05715, 0xf4670b8e, 0x72f3a6bd,
+    0xe4c37152, 0x5a3738b7, 0xfe1b9c6d, 0xde98cfeb, 0x77fb97f8, 0x619d6667, 0x5291a054, 0xa77df291, 0xeddc62bc,
+    0x90982a24, 0x81be6f4a, 0xf439a9b9, 0x69c2b4d3, 0x9eb5f081, 0x844a9ff1, 0x33fef7a4, 0xbb1c4354, 0x4d0b5138,
+    0xe3a7405c, 0x61715c39, 0x06ef180d, 0xebb568f2, 0xeb1d3283, 0xf7582e4c, 0x5db9a4ec, 0x5d6f932f, 0x9f79ff18,
+    0x51d31f4a, 0x12f08acf, 0x1b03e6cb, 0xff375081, 0x5fa5f4d0, 0x6d493748, 0x4b965c7d, 0xc30df0cd, 0xfbb1db04,
+    0x4200bd90, 0x70d7ceac, 0xb2c7afde, 0x6b58e157, 0xe21d9932, 0xa3c197f9, 0x21e05adc, 0xc7d97e7b, 0xd8cdd5e9,
+    0x30414717, 0x54ef015f, 0xb93506e0, 0xb760b2cc, 0x68197f85, 0x72dfa2bc, 0xe9effc7e, 0x984cb383, 0x8d2ba20d,
+    0xc1eb5f50, 0x7a3cf61d, 0xd04cb1e6, 0xca737744, 0x0ac243ac, 0xc1ebc786, 0x43b80680, 0x74623583, 0x37a375a1,
+    0x5907ab49, 0xde408a71, 0xd3e7f670, 0xf7196eaa, 0x4c10a103, 0xe785530e, 0xf0f74c15, 0xb2893e99, 0x79be08af,
+    0xfe1775b0, 0x14adc9cd, 0x61ca0eca, 0x895627b2, 0xd505328c, 0x1b6c60ad, 0x082d7d58, 0xa030735a, 0x028f7e87,
+    0xe3956d46, 0x0c8dc55e, 0x9843048b, 0x483dc4d5, 0xb4b4d027, 0x173aa51a, 0x19f4ef3f, 0xd6e85234, 0x67080679,
+    0x2934f464, 0x6c89d71b, 0xe24cc651, 0xb48748d0, 0xaeeb0c96, 0x3eb68b44, 0x9df92255, 0xe3425306, 0x50df5bd7,
+    0xdb110efd, 0xc08c9ff7, 0x79d18536, 0x0cb7c95a, 0x31221b19, 0x4770c64c, 0x5afc5f6f, 0x42ecd910, 0x69288058,
+    0xc0845fde, 0x0ddba229, 0x306cbc14, 0xf3d4f323, 0x627aef6f, 0xffa70704, 0xb898ac63, 0x589a529d, 0xf5ef3c50,
+    0x594f1c82, 0x9f3ee883, 0x98182d07, 0x4c6d07c5, 0x53a8807a, 0xa19bd2ef, 0xe354c84a, 0xa698ea88, 0xe6a70de4,
+    0xdbb89e80, 0xb17e6d52, 0xee69fe74, 0x9295b04f, 0xc8c827ec, 0x30e75a44, 0x85a7c2ae, 0xcb79b2a1, 0x25b7163a,
+    0x56960f66, 0x25a0db0c, 0xe0caaeca, 0x02380f6d, 0xc409b37f, 0x599a98dd, 0xaa374402, 0xfac6c3f3, 0xf9c58115,
+    0xf206a950, 0xfab93c84, 0x20ec6160, 0xedcc5f11, 0xc968b832, 0x0cdc1cc9, 0xf3e6132b, 0x23752843, 0x4a6dccff,
+    0x3df4e4b1, 0x07c143ad, 0x774e109c, 0xed5d880f, 0x3cd63d59, 0xdf7c2780, 0x177ae7cd, 0xe4db5938, 0x21ce4c0a,
+    0xe77ca6ee, 0x36d1ce3f, 0xfd464877, 0xfb9ae2a0, 0x838e6b74, 0xbab2a1c7, 0x9e81f734, 0xb4a55b94, 0x99abecc0,
+    0x57123e13, 0x9c8ca0e7, 0x5d5d3d3d, 0xac083818, 0x19468281, 0x65d5d767, 0xfa12788e, 0x003d1da0, 0x57c959bf,
+    0xfee32f90, 0x000e831b, 0x7669ed13, 0x29b2d332, 0x87bee94f, 0xf301fcbf, 0x44a045fe, 0x9931c6a2, 0xa11cc36b,
+    0x58830c3d, 0x702bfbee, 0xe5cc68ec, 0x6e9295af, 0xa0073e5a, 0x1bc28a0d, 0x45f8364a, 0xee8b2192, 0x01312fff,
+    0xee1c980a, 0x1018f902, 0x5fc4cf55, 0xf07e950a, 0x71162d6a, 0x5b8cbf32, 0xcc1e0be5, 0x30036308, 0x534a09d3,
+    0x75fca157, 0x2a5c59d7, 0x7942b6e8, 0xee176fd3, 0x5c0fbe59, 0x2ff264c4, 0x298b39b6, 0xc3108c57, 0x906d2343,
+    0xb5e7e191, 0x15a6a42d, 0xf2c891bc, 0xa8ece146, 0x48dc013a, 0xeb6377eb, 0x0742620d, 0xce19f2e5, 0x10a9f80b,
+    0xca79fc71, 0x5273d60f, 0x1fec670e, 0x781a7b8e, 0xc2a2b353, 0x45ff8600, 0xbe95417a, 0xecb366e8, 0x0c7a27f2,
+    0x39ea39c4, 0x7404f7c0, 0xb9f000a8, 0x97de41e6, 0x191d97d7, 0x47b1c08a, 0x0525cf71, 0x5afbaa3a, 0x4f4164bd,
+    0x483f974e, 0xb938dfcc, 0xf176bb94, 0x8664a56e, 0x1cb2da40, 0x3a7aa939, 0xb8313fa8, 0xd5986540, 0x6ce2f80e,
+    0x8d091dc6, 0x3f503058, 0x65c35e82, 0xbc95316d, 0x76aeb464, 0x3089bb48, 0xbbcddecc, 0x6b8386a0, 0xf8a36a78,
+    0xd46c9dbd, 0x9155db1c, 0x3cd59926, 0xc0d02017, 0xd63c2481, 0xb7b73298, 0xa1d8a674, 0xad86fe59, 0xca80e4e0,
+    0x189c2496, 0x29a136aa, 0xd704c56a, 0x9eb9a03a, 0xfae4cd77, 0x760a155a, 0x4fb5dde4, 0x3435bf4d, 0x1a041409,
+    0xc11037bb, 0x07499875, 0x5f5ba51b, 0x26e29702, 0x404109ae, 0x3b844785, 0x4c2fbbdd, 0x9caf321a, 0xe2340902,
+    0x89a2a6eb, 0xcc40c4f5, 0xcd99c1c4, 0x6a7a81ac, 0xd4e05e5d, 0x1e7f5028, 0xae90706b, 0x8ff2a148, 0xb7dee0f5,
+    0xf6800571, 0xe5dbcda2, 0xb0049e32, 0x2a25e0c3, 0x46695904, 0xd536e2a6, 0xb326e29b, 0x70e5db2e, 0x6f29cf60,
+    0xb421ab53, 0x02686889, 0x2a98ac05, 0x04a49266, 0xac53e1cb, 0x91d834a1, 0x66d17e4d, 0x7ee603fe, 0x92b1098c,
+    0x11c8bfb5, 0x9f6f31e8, 0xbd0fe909, 0x4a699dda, 0x13b83c1c, 0xc6607491, 0x088513e1, 0xd171dab8, 0x28094a49,
+    0xb880d480, 0xcb508325, 0xfc5b786c, 0x366124bc, 0x93e6c19c, 0x6d839180, 0x88c60b67, 0xd19b0159, 0xf0aba9d8,
+    0x7ed3b5bf, 0x3f7e3d4e, 0x129a94a2, 0x5afda4d0, 0xde3fd10f, 0xd7d7b6b1, 0x8b1f3c15, 0xfe43eb67, 0x7abb40ac,
+    0x1005e615, 0xaf2be0ae, 0x6c542202, 0x5c29799b, 0xe453ff0b, 0xb5146491, 0x0fa21e2e, 0x15f2ac93, 0x8429c738,
+    0xe340a92d, 0x017395d1, 0x38943fce, 0x8146cd86, 0xe544e79d, 0xb4c15058, 0x01b06a9f, 0xe233e276, 0xdbdb1cc5,
+    0x91dcccb5, 0x76b44481, 0x4ad04d52, 0x228b87d7, 0x774619dc, 0x90100467, 0x633e1129, 0x00af2836, 0x80de31c7,
+    0x8998b54a, 0xf094dd89, 0xf2a461bd, 0x7d06cd0c, 0x54d75e79, 0xa66710c7, 0x89973914, 0x15bc1089, 0x616d3f2b,
+    0xb6dbe7df, 0xac3fb887, 0x33b956cc, 0x354ef54e, 0x2e8f7ec0, 0x427d3c65, 0xe1f7e747, 0x887ebb85, 0x1cbfc4d0,
+    0x659ef979, 0x976ba9cb, 0xf65e082b, 0xaaed9538, 0xd4a40961, 0x3822bf75, 0xd5b1c051, 0x1d2aaa66, 0x1aa0b4a4,
+    0x2d48fe56, 0xd3d197d0, 0x4ae0053b, 0x086e3a23, 0x7853167a, 0x5b576304, 0x981a4715, 0xcc5980fb, 0xedd59532,
+    0xd446adff, 0x51e3e6a0, 0xe060a66b, 0xb771ce1d, 0xe27b6255, 0xf47d982a, 0x15954920, 0xffcf4f3f, 0x1919f047,
+    0x08d02235, 0x3051f1f9, 0xc71014a9, 0x4264a988, 0xfe121124, 0x3a14e025, 0xb19399ba, 0x60114d27, 0x32d9739f,
+    0xd02c73a0, 0x2ae69052, 0xb6e3bb3c, 0x37b61d20, 0x5f96c613, 0x4b4db70e, 0x9a1a9d85, 0x1d1ff113, 0x45bbabbc,
+    0x30e2029f, 0x97df8b03, 0x0c62768e, 0x71b52a4e, 0xd7711c14, 0xafa2bb9e, 0xb6321992, 0x27ae2455, 0x070a6311,
+    0xfd21714a, 0x56cdeeba, 0x10273bd4, 0xfc00b733, 0xe6490175, 0x8eb24436, 0xc8cc8db4, 0x533720a0, 0x6c9e496b,
+    0xfa6ac56f, 0x61a8ec44, 0x13b1b789, 0xa202cf08, 0x014b9b25, 0x75b6e9e7, 0x3a7a51c3, 0x7b3a1878, 0xdd13a888,
+    0x5afeea59, 0x67f4891e, 0x1fc5958e, 0x2b7c954f, 0x2013ad00, 0xabd71adb, 0x72e173d6, 0x6519a5ed, 0xa6ff03d7,
+    0x35c49e18, 0x3b371123, 0xd124bf92, 0x89a9b4cf, 0xaa2e7381, 0x365d9309, 0xa46b3f73, 0x41b6d786, 0x518dc0ef,
+    0xcb6a0fac, 0x92c1b4f1, 0x6fed0ef5, 0x324502a1, 0x9c8b7f6f, 0x3c0c1297, 0x87cf0bc6, 0xc769a353, 0x8aa50d94,
+    0xe4a5c6d7, 0x4d3caa22, 0x19a9b993, 0x30a53fc5, 0xeac3502c, 0x7d6be931, 0x07ab09ac, 0x7f51aefc, 0x9b51ce7f,
+    0x2274f655, 0x29942ee1, 0x70eb8c58, 0x193c4166, 0x5cf8800c, 0xbdb742a6, 0xe7d0edbb, 0xb632465c, 0x4c1351d6,
+    0xdf52689c, 0x9c02022d, 0x0def8b82, 0xccd02d17, 0xf7a6d823, 0xb824c77f, 0xe9224d95, 0xd03f4eba, 0x86d54076,
+    0xa57f3948, 0xfa59ffe0, 0x6d10a9db, 0x696fa48c, 0x6896909e, 0xbb40ce4b, 0xbdd9e615, 0x653b7c91, 0x50e138cc,
+    0x06299d69, 0x2635b316, 0x57b0a8b9, 0x86d8ca2e, 0xdf15d476, 0x0adca9b7, 0xe182462f, 0xd5ea0194, 0x7d1b2900,
+    0xae18cf0b, 0xc94ffd80, 0xb5451072, 0x3bd5af61, 0x41d6aa33, 0xaa35e369, 0xce7f1a62, 0x4fcd56b8, 0x47249420,
+    0xb7fcd68c, 0xcb0f3a6b, 0xc55e7a9c, 0x86ef253d, 0x85e58c0f, 0x19e1a641, 0xf8856388, 0x595fa257, 0x56ec2946,
+    0x790d08e9, 0x4cd1b4f8, 0x5fc3d2e2, 0xafd355e7, 0xf9580296, 0x3802bc07, 0x1b0d523c, 0x3e809712, 0xfe005069,
+    0x9a98fc05, 0x0b40d9ff, 0xaf7a718c, 0x796b87bc, 0x728e076f, 0xbf9c995c, 0xdf6d225a, 0xe0941874, 0xfe736f68,
+    0x1f9296dd, 0xed726c0e, 0x57e01d0e, 0xbb7acb3c, 0x2d1dd415, 0x9356e0e8, 0xf239357a, 0x5597ab92, 0x38c94c6a,
+    0xb3711322, 0x5e8e2cfa, 0xdedaa1a7, 0x578f394c, 0xc89ad02a, 0x76648541, 0x912b4069, 0x5559381f, 0x8af084f0,
+    0x52c3e17e, 0xd19d4088, 0x5578a1a9, 0xa8dca4a4, 0x71806b29, 0x2a8820ac, 0xd59ce42f, 0xdc865f0f, 0xe6862ec8,
+    0x5cf732b2, 0x216b8cc2, 0xf73a785d, 0xd434a916, 0x44df8c8c, 0x269f86ed, 0x044ee37e, 0x40b0c553, 0x8c529a54,
+    0xe2ec5308, 0xa67bd33c, 0x25f882b1, 0xc1502c3f, 0x975cd795, 0x546f6095, 0xee8ada4e, 0x284de14c, 0xc6ea2086,
+    0xf5e76c88, 0x44fb99eb, 0x27809c2e, 0x9482617e, 0xaac1bdbf, 0x1c469059, 0x38e5ba20, 0x5d7db405, 0x66de6488,
+    0x17b9dbf4, 0x2de35630, 0x43e6c916, 0x5d1f0567, 0xa233f820, 0x0b1a7f93, 0xc91f10dc, 0x58243bd8, 0x95098698,
+    0xee32e798, 0x1cd73ada, 0x86d77f92, 0x2b6ea72a, 0x1ad4b4c2, 0xdd6683c6, 0x858d10d2, 0x8cc66b3d, 0x0f52c06b,
+    0x95720588, 0x97c0a2e9, 0x83ee9582, 0x27e48e7e, 0xb1d34bab, 0x0dda0ae3, 0x2aa75c43, 0x9e3a5f56, 0x5d926b28,
+    0x1144aecf, 0x0c0aa3af, 0x0f68b1ef, 0x93fde7c0, 0x122bf056, 0x3c4a93d8, 0xe71fd4cd, 0x442724e8, 0x76ff0fb2,
+    0x1e45782a, 0xf6456871, 0xe0184a2b, 0x75d6112f, 0x59676359, 0xb7518caf, 0x35d9c873, 0x70a7e5a2, 0x0d1790d2,
+    0x3357f657, 0xddace92a, 0x3551fa59, 0xbf9a2480, 0x908042d7, 0xe8dd40d7, 0x3b2b552a, 0x0bfba24d, 0x2b642d79,
+    0x8a91c39d, 0xeeb1ef78, 0x6c69853b, 0xcfa2774f, 0xfc6f477e, 0xf180650c, 0x21336628, 0x3753059c, 0xeb5d7e5c,
+    0x827cf1ba, 0x8008e018, 0xf2e9a7f4, 0x5ff9401d, 0xfb0f474d, 0xe05c5ef7, 0x3ca9f790, 0x7b4fa984, 0xa8ad64d9,
+    0xb5d9a3c4, 0x1625492c, 0xd7556704, 0xd9394f61, 0x5d835961, 0x3182bd6b, 0x2b238f76, 0x9a835d4e, 0xa278aa8d,
+    0xd0dd5513, 0x86c6f27c, 0xfbcbeb6b, 0xe40110a5, 0xdd04558b, 0x7cfe7ed3, 0x909924b6, 0x9207e8aa, 0x4b212bf8,
+    0xabd0c373, 0x1c818040, 0x96ed3051, 0x5105df46, 0x2bd4b829, 0x0be26e75, 0x33e8c217, 0xe46cbf46, 0x0918d2d9,
+    0x421c7f1c, 0x7f2fa3f1, 0x991f17f0, 0xa8fb2b68, 0x308384cd, 0xd3ef7532, 0xc0a73112, 0xc8618a85, 0xc7a26ac7,
+    0x20b4d337, 0x77b43013, 0xcb00e128, 0x97bb2c4a, 0xc436a5e6, 0x10b417d6, 0x6d4fb58c, 0x987899ad, 0x3bf7a51f,
+    0x6c911c42, 0xc2a4ab6d, 0xff723cda, 0x0b886e11, 0x4aa03ea7, 0xffd611c2, 0x8895cafc, 0x386aaafc, 0xec35ea39,
+    0x6d312f6d, 0xe82aa666, 0xcebc9105, 0x27fc5079, 0x0514a597, 0x95403821, 0xb00e8255, 0x86d6a4ce, 0x72c0434b,
+    0x7b8d89b2, 0x0981d0e0, 0x4be4604d, 0x093f1a37, 0x748c727d, 0x3caecd31, 0x76ee9fd6, 0x0d9300cb, 0xc17dc95b,
+    0xfad07bc1, 0xc7c11cc5, 0xa7aabb4d, 0x79bea780, 0xecb072ce, 0x36f59c7c, 0xe14bb23f, 0x146b855a, 0xc042c5e9,
+    0x88ad9354, 0xd23739ad, 0xd5e7c8d9, 0x42224063, 0x05e7e133, 0x749388e6, 0x3aad0b9e, 0x0557f4c2, 0xa27f3da3,
+    0x9a504522, 0x2624a10d, 0x1d084f7e, 0xba94f5f1, 0xb203aaa1, 0x29d2a5f1, 0x96c81e4d, 0xa3fa2449, 0xfae5bfd7,
+    0xd923273a, 0x9cb81182, 0x06bcd5e8, 0x653161a7, 0x3294ea91, 0xa2c175dc, 0xc49010fa, 0xc2eaa4d8, 0xe14a5a3f,
+    0xc278a0c5, 0xf2bf53d8, 0xd6d5cfad, 0x4fc94b95, 0xad1ba720, 0x7a19c706, 0x3a53a8ed, 0x15a8b85c, 0xf4baa75e,
+    0x8dd5ab3a, 0x7eee0ab6, 0x211cbf4a, 0x940ad9c5, 0x4864fc0d, 0x38f95a09, 0x6f7d7f1d, 0x015ccd92, 0xba8b6e57,
+    0x894e018a, 0x8feaa091, 0x665b5af0, 0x97ea010c, 0x9425c7f5, 0x817fc23b, 0x9292a5c2, 0x6fb07616, 0xa1be3cd8,
+    0x58c8cfe7, 0xad6037b0, 0x45ff04cf, 0x3b5dce09, 0xd833acbd, 0x9f0b030f, 0x7dcb5542, 0xeb9f1a78, 0xbd060054,
+    0x667896f8, 0x399748de, 0x68af1930, 0x5dfaae52, 0x1b3830cd, 0x834c5bcd, 0xcfbcac90, 0x91a7c991, 0x1d8be117,
+    0x80852f67, 0x71d73854, 0x0e837f71, 0x955059b9, 0x41a35903, 0x72c73c3c, 0x7ceb749e, 0x3c54ea91, 0x768fadb2,
+    0x40b064a3, 0x949f38af, 0x9647930a, 0xe38cd3b2, 0x5c3683c1, 0x4071218b, 0x8dbeacc6, 0xa7a66142, 0xbadcc282,
+    0xccf1aa91, 0xdb10d44e, 0xf509113b, 0x508433d1, 0x65e7eaaf, 0xb96bb806, 0x87982376, 0x5de88090, 0x679ba536,
+    0xcb4330e6, 0x3c9db2c4, 0xb0516877, 0xfc2d823c, 0x3d4adfb9, 0x46d83e32, 0xc3f9efdf, 0x5a827df8, 0x38a80402,
+    0xb3ed1631, 0x2340f2c6, 0x32af43f1, 0xd6fbb18b, 0x6830449f, 0x57b9d27f, 0x99bb0d21, 0x119ad4e8, 0x6e3c84ed,
+    0x3d19f58e, 0x8b406d0e, 0x576324d8, 0x8f8b18a4, 0x24a15d94, 0xe87ce812, 0x2512b2a8, 0xbacd6567, 0x5a7085d3,
+    0x0da1fa23, 0xd18afea3, 0x106ba71e, 0x32893bcd, 0x066352db, 0x571efeb6, 0xf5d9375f, 0x18d66a52, 0x6f9b51da,
+    0x64282040, 0x4c3e09f8, 0x7c5598c5, 0xc33b200d, 0xf6afb749, 0x4256db02, 0xee5d7b88, 0xc7380753, 0xe684e24c,
+    0xd38872f8, 0xa7d48993, 0x7c2869e6, 0x6c102f53, 0x398c64fa, 0x8b0841c2, 0x9435bc5a, 0x8320160d, 0x273be0d3,
+    0x3ad000b4, 0x7e0400a3, 0x9e9a40c5, 0x89cc4ac5, 0x2f6d8932, 0xc5cf80d6, 0x90329c75, 0x8cc0afc7, 0x58a4a775,
+    0x2544bfd0, 0xca8330ec, 0xf2e034a7, 0x44dc7cc9, 0xe30ff85f, 0x9be057b4, 0xca3fd76e, 0xbf0feb44, 0x23ec9bb1,
+    0x6f1bb934, 0x650e32fd, 0xe5e4ec2d, 0xfe9069b6, 0x1eb19cc1, 0xfaaaaddf, 0xa4ac9bca, 0x49322725, 0xbf194450,
+    0xb2312a6b, 0x5714e6f0, 0x50f2ded4, 0xb2a13f9f, 0x14496e45, 0xa16e39a2, 0xbf36786f, 0xbe7c87f9, 0x64d8c6d2,
+    0x23901bcd, 0x2b9e72b8, 0xb70a5df5, 0xeaf988bb, 0x47e50915, 0xec3d1927, 0x89633968, 0x3e82b56d, 0x7b8fba03,
+    0x52e194ff, 0x54964992, 0x9ccf0c47, 0x8e7c088d, 0x205b4c10, 0x3c4697f7, 0x5a26c25e, 0x0bb79394, 0x09fd9838,
+    0x2652c484, 0x450839cd, 0x9977c6ca, 0x1291cd99, 0x54aa4aae, 0xc7147b4d, 0xdb370a9d, 0xd14911fd, 0xbdfdbab3,
+    0x81aa625e, 0x3412a328, 0x4b4bb805, 0x28b02027, 0xde1de463, 0x8f4788ae, 0xb6eabb70, 0x769136d8, 0x4d5c284b,
+    0x397cbf68, 0x9ce13f51, 0xacd08813, 0x0ac21a0f, 0x42f22f5b, 0x7580b096, 0x9b171135, 0x5ba3e175, 0x23db6dd4,
+    0xe1730e5c, 0xc3d89e1d, 0x9a09077e, 0x1e78b717, 0x66ca0f91, 0xcb628b47, 0xc2cde455, 0xedb04161, 0x00208ecd,
+    0xf2028597, 0xa4d04a6e, 0x5d6086ca, 0x31b9c70c, 0xe0f9615c, 0x2e3fadf7, 0x46fcaee5, 0x4e371991, 0x72ca8ac3,
+    0xd0429131, 0x511e0356, 0xb2f9b390, 0x52ed0c03, 0x6320acdf, 0x28d4bcef, 0x76bcfa84, 0x3d912f02, 0x1e2dbd39,
+    0xac480a2e, 0xf8722698, 0xf4ff7deb, 0xd9d55bbb, 0xc05975fe, 0x5ab2ac0e, 0x415a22fb, 0xedd62648, 0x4745462f,
+    0xefd7da71, 0x8067f1e2, 0x2d8227fd, 0x158e4e4d, 0xf6833604, 0x56d1bc88, 0x2e9e92cb, 0x7517d8a8, 0xf4c0d80d,
+    0x32ec4700, 0x2686c1fa, 0x89f35aad, 0x720831b7, 0xfcb87c0d, 0x5dabddce, 0xce60d627, 0xcfe2083d, 0xa0091033,
+    0x87142d4a, 0x4d5fd554, 0xe36c032a, 0x62a6e731, 0xfe0d3581, 0x11d881d5, 0x59018efc, 0x8f80f0a2, 0xd10f9ee9,
+    0xd0330c3d, 0xaf80c751, 0x211839b7, 0x961ba1a6, 0x491a0166, 0x7d250ecc, 0xec9daadf, 0x2a67e664, 0x4306ef95,
+    0x605c2493, 0x98643eca, 0xcfd4d9bf, 0xb1e84668, 0xe1e5a46b, 0x1095714a, 0x0273c063, 0xf2ea6068, 0x74e12bae,
+    0x0ef35812, 0xe35130a9, 0xeaecd2cc, 0xe76620d4, 0x337d4b26, 0xf70feb56, 0x25f14c3c, 0x01f41cdb, 0xb613989e,
+    0x43ef6c0b, 0x8db40ed4, 0x40481aec, 0xf3f03339, 0xd12dfdaf, 0x422edc71, 0x27197a87, 0xd374bbc3, 0xcb09ea22,
+    0x22b09f1b, 0xa3b26234, 0x1ef31de0, 0x77d98c9b, 0x47e8ecfe, 0x64613288, 0x5543f80e, 0x95554dc8, 0xaf0048d4,
+    0xbe8e6221, 0x7bc3c82f, 0xcdc76417, 0x3af7915a, 0xb6f8ebbc, 0x261e38cc, 0x1f1a17e5, 0x3d3a7cc5, 0x63098d99,
+    0xb2a2fbe1, 0xb4585b2e, 0x408d3ae6, 0xef17b40d, 0x2ae8dc35, 0xfb9df738, 0xd90a2970, 0x17015260, 0x6ad13a8d,
+    0x8ce35c29, 0x96d89f00, 0xa7f7e790, 0x3ce65b40, 0x9fe846f2, 0x5d76d68e, 0xa40b5fdb, 0x3f9cd092, 0x9a90c15d,
+    0x32e80826, 0x3cbeb2f7, 0x2c91f9f8, 0xe6a98355, 0x47b6c34b, 0x3565f4a6, 0x6894c75b, 0x3fc933b1, 0x54da72e4,
+    0x46b75c35, 0x624c6b1c, 0xaa880812, 0xcdad96fb, 0xfa33dde7, 0x8f80af97, 0xb848d746, 0x3700ea51, 0x228d0cd9,
+    0x62bc6c51, 0x8ae390d3, 0xd73623a1, 0xca683a65, 0x525e6e04, 0xbcc6dfdc, 0x7727efa8, 0xea720a1e, 0xa0fc8eae,
+    0x3a21916e, 0xff77c7c4, 0xb6dc6ea8, 0x2681120a, 0x04b53a2f, 0xb99e2edd, 0xaff7d29b, 0x8cac760f, 0xe465b790,
+    0x33e246ca, 0x49b61327, 0x71acef36, 0x3db2eb97, 0xf7402e67, 0x8287ba11, 0xe29127fc, 0x0aeed8ef, 0x506552fd,
+    0x2b4efd11, 0xa4e4c507, 0xca28f6e3, 0x45c4d85f, 0xbb3305cc, 0x79c20e90, 0x29bacb08, 0xfb662bef, 0xe9238b48,
+    0x055ffb36, 0xf40fd630, 0xe0e92968, 0x6692fc4d, 0x6ffc8825, 0x66ccf6f0, 0xcd013519, 0xb9e573c7, 0x616a1589,
+    0xef1bedec, 0xf2476d19, 0x2799af23, 0x415eeaf6, 0xa7bd4806, 0x55891f04, 0x440682b8, 0x9ed9cbe9, 0x09688ad7,
+    0xebb79080, 0x4fbdbdc5, 0x2cbeb0dd, 0x9248c0dd, 0x32bced03, 0x9a912d6d, 0xd33e95dd, 0x2881babc, 0x6ac5dd3e,
+    0xd1f19d09, 0x274e0a3e, 0x95f73ddd, 0x54122404, 0x1f6160cb, 0x0b0b181a, 0xb72bfc3f, 0x608106c0, 0x6e5567d0,
+    0x42675bba, 0xb635ac59, 0x41f753d6, 0xbced1f47, 0x43722ac7, 0xaa1ed624, 0x4b716ef5, 0x1f4b5305, 0xc4832446,
+    0x3f9db084, 0x2ef21f3c, 0xd53da81d, 0x8444411a, 0xd020fe98, 0xbbb83248, 0x269c366e, 0xc2ae7c37, 0xe3f0bdd5,
+    0xeba2f0a7, 0xb72bab91, 0x4db09bc6, 0x27335148, 0x4b129f69, 0xb19bfa8a, 0x02dea8ac, 0xd3746c46, 0x21c1c5d9,
+    0xfae07c96, 0x1709169a, 0xea97de35, 0xd614254c, 0x5b292d81, 0xb92ad38e, 0xc599ed29, 0x5849aa2e, 0x726c4c51,
+    0xef35567e, 0x51d2e51d, 0x6a19a966, 0x454f0a6a, 0x4d7b3c9d, 0xeb2c25e5, 0x81b42771, 0x6509fe09, 0xde086eb6,
+    0x76d89579, 0x148a0e3d, 0xc888fb5e, 0x819a5818, 0xc942cae5, 0x204c42c0, 0xc9a0cb14, 0x6300eddb, 0xfe379e49,
+    0x3d05cc2c, 0x42635f1f, 0x896dbb08, 0x19168c80, 0xf942df54, 0x8d720bfb, 0xc28babe0, 0xccd3dbab, 0x9029e115,
+    0xc6742420, 0x3f36eec7, 0x6b98db8a, 0x361d67c7, 0xf7cf5108, 0x61b188ce, 0x9e5ff28b, 0x20842e2f, 0x9862cc4f,
+    0x8013df5d, 0x036fb9aa, 0x4692aa0e, 0x6c607d28, 0x10c8b595, 0x32dc87eb, 0x41fabeaf, 0xe26c4279, 0x37f423ee,
+    0x30565f3d, 0xe1df0f69, 0x9c490aad, 0x63791411, 0x693db1bd, 0x83931074, 0xe5684be4, 0x5f8cdf5a, 0x482b27b7,
+    0xb24cdb1c, 0xdd83ddd8, 0x9cc9a84d, 0x1181c9bb, 0xb5dabfea, 0xdeb3ff9c, 0x264c5a16, 0x61bbf9b4, 0x8d81906f,
+    0xf2020bdc, 0x4d901528, 0xa8ed408a, 0x4ceef0c1, 0xe36163ce, 0xe60199dc, 0x63b64fff, 0xa550e1fc, 0x2371b170,
+    0x73651b03, 0xa041c6d7, 0x8152c37f, 0x149e9a4f, 0x3f03a65d, 0x5e662d89, 0x485b4b0c, 0xccba1e99, 0xd522dc40,
+    0x548105a3, 0x5f1c6a17, 0x22f7449b, 0x110c9343, 0xba96e0c5, 0xa2eb6d46, 0xf57b2ff1, 0x04b24867, 0x8f2bd1c9,
+    0x2ffddda9, 0xca442afc, 0xac4163a5, 0xe24b85a7, 0x90059cb7, 0x8f1057b6, 0xc7a4f74c, 0xb07bab2c, 0x6ff8d7d6,
+    0x4b9de7ba, 0xb6bdc463, 0xa2cb3d89, 0x8f765b83, 0x52d3b913, 0x8b18084c, 0x3595e02c, 0xf82358ea, 0x7580b4c9,
+    0x68b59998, 0x07c9cc1c, 0xbb25e1bf, 0xd5bee98d, 0x4986398e, 0xd33149df, 0xafb711f9, 0x728635b1, 0x768955a6,
+    0xaee1bbb7, 0x25c88dbb, 0xff85a5c9, 0x6e281d04, 0x95b5bed1, 0x665fc1c4, 0x1d8c8746, 0xc47062a9, 0xa7259cd9,
+    0xaaf302a5, 0x6ed96703, 0x59310d15, 0x0efd2c9a, 0x1e5cce53, 0x3152474e, 0xbea1981b, 0x42f872d1, 0x024c34f5,
+    0x50874936, 0x348bfd29, 0x46d8285f, 0xc216049e, 0xd3206da6, 0xd6cbfc0c, 0x06de5d64, 0xce4df307, 0x036e8e6e,
+    0xae706571, 0x72f6e28c, 0xf36dba42, 0x4dd25253, 0xacd352ff, 0xa3bfad39, 0x35fad40c, 0x6bee9e98, 0xa496c813,
+    0x01e25eee, 0x8b05e466, 0xeab0e73f, 0x8b496c3a, 0xe759580f, 0x5cbfa189, 0x5249679b, 0xe950faa0, 0x79b0c94f,
+    0x4120ef7d, 0x6f7ab435, 0xab6e4675, 0x9553e5b0, 0x91068610, 0xbd427bf8, 0x85b96274, 0xebb8b8ca, 0x37977793,
+    0xb89a27db, 0x07ddd123, 0x891f8154, 0xbcc2f5a5, 0xed7d64e1, 0xf527ea78, 0xcaf47f24, 0x435f9408, 0x2d1dacd2,
+    0xd86a1c3e, 0x634e96a1, 0x3a21519a, 0x86d79a6b, 0xa2baab7d, 0x8172ae9f, 0x243c99ae, 0xcd1bc5a5, 0x0853ee7f,
+    0xf8316531, 0x15223153, 0xdd248ce3, 0xc268177c, 0xdc748522, 0x679fe807, 0x062eeb23, 0xb31f7058, 0x08c94908,
+    0x69c4cb1d, 0xebbc3336, 0x704ad96f, 0x20b1d0f8, 0x20513eea, 0x180bc3a5, 0xe5b2b712, 0x9fc37379, 0xa8d68d26,
+    0xad8c66db, 0x4196f10c, 0x8bc47215, 0x8aabccce, 0xa7c88fe2, 0xade36968, 0xc00d63d0, 0x7ca057d9, 0xb6c669d8,
+    0xb8a6feb1, 0x2e01f7d9, 0xc50375b3, 0xcef0297e, 0xc939a975, 0x87f421ac, 0x38b40840, 0x7af5c745, 0xc2183826,
+    0x19e3aadb, 0xfde34142, 0x17e0f771, 0xe65074d0, 0x4bb46c3f, 0xc8afeb7f, 0xf018029c, 0xe27b4883, 0xded44d72,
+    0x124c3d8f, 0x8a3029d4, 0xdc30e29c, 0x5eb34bf9, 0x4f08f26e, 0x9669f4a4, 0x903616a6, 0xdd281aee, 0x216e7ea7,
+    0x349767db, 0xd2772c21, 0x53a082e0, 0xcdad513f, 0xce339db8, 0x0e1e6000, 0xbb2b3fad, 0xd12e0764, 0x2f7582b1,
+    0xeaf1d617, 0xe7ab05ec, 0x33776d7e, 0xd8ba014d, 0xb446a9ea, 0x01083d59, 0x0242b604, 0x5003ae6b, 0xfb1ebe5e,
+    0xc23d9c6b, 0x165df4e7, 0x33527647, 0x9e01444e, 0x17a311bd, 0x71d39765, 0xb8c4998d, 0xc4351368, 0x4f7aa484,
+    0x3f197732, 0x7de7bc42, 0x596aad52, 0xedc79fa5, 0xc6fe0df3, 0xe1ef1bf5, 0x8f339493, 0x7042139a, 0x1d603842,
+    0x473b59b1, 0x6df9e940, 0x0d48df55, 0x452daf01, 0xa42e413f, 0x567aac4c, 0xd823b330, 0x73651422, 0xa310fb3e,
+    0x9b1efcba, 0x5eab820f, 0x446fbf32, 0x79f8f2a9, 0x90525b33, 0xe32dadab, 0x83f2838a, 0x304a7cc5, 0x8024d23e,
+    0xff38c158, 0x7f3267ca, 0x90bdaeeb, 0x7b207cf3, 0xa7244df7, 0xd916571b, 0x3da5597f, 0x10f32048, 0x98828f54,
+    0x7fa9a7af, 0x18f9fbd8, 0x805cd8c6, 0xb45a176d, 0x276a6338, 0x7e6e0401, 0x05e62eb4, 0xe1835420, 0xadc5ba3b,
+    0xa932766a, 0x67793744, 0xa18ef930, 0xe8210718, 0x7fbcfeaa, 0x0c0bcc3c, 0xecffb86e, 0xa1b58752, 0x9ba352a6,
+    0x20dd9cdd, 0xb08e8539, 0x84c01bdc, 0x4ef5f368, 0x66ae7aa8, 0x50e63aca, 0x52d7b1ff, 0x43d07820, 0xd00fe62f,
+    0x872e36dc, 0xa4a83976, 0xc1a17da5, 0xb421e7f8, 0xcd0d5941, 0xbf814ea9, 0x52957623, 0x2b474c3f, 0x0ede64dc,
+    0x06c35ae8, 0x373fe325, 0x09bd1411, 0x47f01073, 0xb50d3ce3, 0x71e77988, 0xac5aadee, 0xcbc25df8, 0xdb2298fd,
+    0xa5c81bce, 0xa26573cf, 0xaf300a65, 0x1052f440, 0x4c1c247f, 0x90c74397, 0xbdec16ce, 0x853af781, 0x1804ead3,
+    0xc02ccea0, 0xf6533b66, 0x6c8ee715, 0xa527d466, 0xf1799e8a, 0x2b121951, 0x9b38abe2, 0x10d9f4f9, 0xe9abd81a,
+    0xb8d4b1a6, 0x94a8e05f, 0xae21a1d0, 0x6f92b589, 0xfba26732, 0xf994366b, 0xb289da86, 0xe5810474, 0x6277acde,
+    0xea8c430c, 0xd86fd05d, 0x7e6547dc, 0xd5eeb852, 0x6ddf6c2e, 0x52d2b3b0, 0x171f1e31, 0x352f3858, 0xf97d236f,
+    0xae0ee4f8, 0x0175a3e7, 0x509ac81d, 0x9f9cacf2, 0xbb9effa5, 0x03644e28, 0x9233f2df, 0xd701fc88, 0xf766c8bf,
+    0x79f99626, 0x4de2cab2, 0xebf36db5, 0x99cee99a, 0x75e36fdf, 0x5082528c, 0xb7542a74, 0x7f6d1062, 0x3ba2ea7e,
+    0xb01c54a2, 0xe5bfc7f8, 0xdc437de3, 0xb20789d8, 0x50729ea5, 0x80e31708, 0x8374fbc9, 0x523a4b93, 0x5063e5ee,
+    0x3f6cf0ea, 0xecc5f2e7, 0x71a76a7a, 0x40c6a30b, 0xeff3277f, 0x150b1a6c, 0xd86fc24c, 0xa7a52cb1, 0x89e23833,
+    0xd072b255, 0x8a80b0cb, 0xf3026d4f, 0x790fd89f, 0xfc49dd45, 0x3158ee64, 0xffa297ec, 0x42fb0b8b, 0xa2837664,
+    0x6190ea4f, 0xab34bae1, 0xc615df38, 0xdc4f3321, 0xb847f6c0, 0x8b0018d4, 0x1f323f5c, 0x5ad4ed8a, 0x867f2de6,
+    0x6949f6c0, 0x010dd543, 0x856eebe2, 0xfa8f00b0, 0xc482f6b4, 0xf20581f8, 0x8fa9c8e0, 0x61d841a6, 0x0ee2ca39,
+    0x80d5dea4, 0xb3638aa7, 0xc28eaa25, 0x5c64f0e6, 0x58aeceb3, 0xad59180f, 0x4c4edc69, 0xa8b86d2c, 0xdef54d32,
+    0xc5c09d1b, 0x55fa8553, 0x8758ad96, 0xa5a6e380, 0x37a3722f, 0xf956d3a1, 0xf1824f20, 0xe6fdc45f, 0xf86efa27,
+    0x5098ca21, 0x4417f136, 0x446c5a33, 0x20ee2c35, 0xf4797af7, 0x0cf72a33, 0x37310d47, 0xd9407f3e, 0xc95b88e2,
+    0xab1cbb6e, 0xfda6eafa, 0x39aa4d0a, 0x4fe357ad, 0x43b698f3, 0xce2f6148, 0x48ce0eeb, 0x25e2280d, 0x84091e9f,
+    0x032a8449, 0x6019af16, 0xae0709a0, 0xab3d7eb7, 0xe6dc8868, 0x6db38e7f, 0x8fce82ab, 0x67e5a35d, 0x0a5cdfe7,
+    0x08eecd45, 0xcaf5f730, 0xf37cd5f7, 0x5b28ce78, 0x0f05543a, 0xf799d7b0, 0x979e8a4b, 0xeb751e3e, 0xbeaaaeda,
+    0xb4a3ca52, 0x70ebe907, 0x30b94d3d, 0xab6df92e, 0x9d9b4b50, 0xbe3b275a, 0x45fd6a25, 0x45d58577, 0x1b82fc72,
+    0xc8411828, 0xc1d1574a, 0x09ddf8be, 0xdc76975f, 0xda675d53, 0x65489d17, 0x254f7209, 0x3ca0d112, 0x7ba1394e,
+    0xc23972c5, 0x742e7dfb, 0x9ea2db38, 0xd40ff444, 0x2312f10f, 0x8bb674a5, 0x1d3dacde, 0x1030d7fc, 0x61913e97,
+    0x486507b8, 0xe2554036, 0xfed22665, 0xe2869fd5, 0x8424ecc0, 0x61e9f3e2, 0x1aa86eb5, 0xff434d26, 0x22819a2d,
+    0x22106b24, 0xad7a885e, 0xbb74d8d2, 0x629a11d7, 0xc255cdda, 0x6b5e0b80, 0x0176aa23, 0xcf83087a, 0x584fa6b4,
+    0x5f7419c0, 0x59fbc764, 0x65ba2c2c, 0x12d94820, 0xba4f58a4, 0xa6c63def, 0x282e7ade, 0x9bed356b, 0xa6f173d3,
+    0xbf5f0158, 0x5d564359, 0xd3e4024a, 0xd10020b4, 0x0e1996c7, 0x7f02c9e2, 0x50494bb1, 0x3d6349f8, 0xec636a4d,
+    0x58d058bf, 0xd111b7a3, 0xf34420bb, 0x2b57ff91, 0x4c7b8d60, 0xb8417781, 0x513b8dd3, 0x49eeca43, 0x83ac8d67,
+    0x701385bd, 0x8f763c3a, 0x022fd102, 0xe8dfbfae, 0x1340de0a, 0xd89655c8, 0xa06cad2c, 0xf9730b12, 0x3bb5e855,
+    0x52f71882, 0xedee63c2, 0x4ec77a9c, 0x30e73da0, 0x57626965, 0x419a3dab, 0x168b4e6e, 0x4e736913, 0x89833c53,
+    0xdef0aadf, 0xa7de4526, 0x0cbc7079, 0x6338c1d9, 0x5d3816b3, 0x2ea35cd1, 0x750c5895, 0x1ea06874, 0xbd1dcd2a,
+    0xdc05a0c7, 0x2fa0655c, 0x7ced26cc, 0x414d778d, 0x347bddf5, 0xeff050c7, 0xbf38a752, 0x220263cb, 0x0d4486b4,
+    0xf506c06c, 0xe0a3faef, 0xddf73b31, 0xf24f2a84, 0x2aae2d52, 0x643145d6, 0x327c6a91, 0x361804a6, 0x1d208c86,
+    0x47bdaeee, 0x6199a3a5, 0x74e4296e, 0xf670c971, 0x7a62f737, 0xdbe888a0, 0x34cf2f72, 0x89e0f0f1, 0x3a1d5787,
+    0x59f8da42, 0x87b4361f, 0xca0cd5a1, 0x279a5208, 0x4db5258f, 0x160b69e1, 0xe54a445f, 0xea08a529, 0x992349cc,
+    0xb5677f5a, 0xafaa37e0, 0x68de1c15, 0x87019112, 0x124ae1d4, 0x32b1ffc8, 0x2b1f9b83, 0xb933a92e, 0x4ca886af,
+    0x78a9c023, 0x44761536, 0xcc453151, 0x9f57493d, 0xad857c83, 0x6fe2a19d, 0xaf981be8, 0x7ffb91b4, 0xbd46903b,
+    0xc6b90d7d, 0x4f118aa4, 0xbadaeda6, 0xc9ecd14a, 0xcab108c1, 0x918ad03c, 0xadfd5d54, 0xb8f82475, 0xed8e5103,
+    0x6beaaeee, 0x2e2daa89, 0xcae727b0, 0xcb6fb2b6, 0x63a2d247, 0x4e0a9238, 0xf5fe43d8, 0x7df9e31d, 0x42eee5cb,
+    0x208a3425, 0x2de1c345, 0xa4d30b10, 0x29e510c2, 0x3d00227c, 0x6c9f48e7, 0x7d7556b6, 0xab838519, 0x4282f571,
+    0x137d1ca4, 0x88b1d509, 0x856a089c, 0x8cc27807, 0x781f3ca7, 0xe7708bf4, 0x0f9548e5, 0xccd8d3b9, 0x43aa648e,
+    0x55a2662c, 0xc1bc6eeb, 0x0b6b0b64, 0xdfbe77dd, 0x3dc87f02, 0xebb84133, 0x190fefe9, 0x218ffcbe, 0xefd91a88,
+    0x71884b7a, 0xec5bfee2, 0x680d878e, 0x0822ac88, 0x3a78f140, 0x66428dda, 0x5b386053, 0xa0049d90, 0x9e792cab,
+    0xbd2ff9e5, 0xce62c152, 0x51bd6a10, 0x0e8201ae, 0x3ef6d270, 0x4b628c82, 0x8db6f1fa, 0xb3e08a04, 0xd578c584,
+    0x8d0c7c88, 0xee763f5f, 0xf112fed6, 0x70023e8e, 0xbc055a8b, 0xe39d65d9, 0x5d4f74f6, 0x54ca4e05, 0x1912502b,
+    0x577ffe1a, 0x424f8603, 0xd5c28b4d, 0x9f53f517, 0x566a062c, 0xd637ccec, 0x5ffccbc2, 0x32c363dc, 0x256f87d7,
+    0x03c65c78, 0x2e47c40f, 0xbddc80b5, 0xd2989a36, 0x467503d0, 0x328ddf9b, 0x07733e95, 0x57b22002, 0xd4ee77cd,
+    0xada4a0f9, 0x9f8083dd, 0x63fb87e5, 0x5ae93fa0, 0x4ddcc2ef, 0x4e27264a, 0x2f885eef, 0x2dbe424d, 0x9ca84b82,
+    0x4d175acf, 0x1d2dd51f, 0xea9e616f, 0x1f05f00f, 0x31ac773e, 0x09e9f0e9, 0x6437b1a1, 0xf1cafe79, 0xe8afcbcd,
+    0x81ac11fd, 0xff265cb4, 0x747a9040, 0x0d3057df, 0xff675ff0, 0x90107ca4, 0xa3f82ecb, 0x0e875c07, 0xcdb2a09c,
+    0x5729b68c, 0x9746f07b, 0x5945984e, 0xb4ace5b7, 0x30a39b7e, 0x9927810f, 0x7213c11c, 0xdebf8910, 0x2ac59272,
+    0xf4a803a4, 0x55d1993d, 0x3411a373, 0xf89a8453, 0x21126e02, 0xc4baf51d, 0x445bf559, 0xa6b2eafd, 0x9febc936,
+    0xbff7bab7, 0xeaae3f55, 0x60f8705e, 0xf8c734db, 0x4cd67c1e, 0x7ae1ad3c, 0xb0e0a7bd, 0xeedf5ac3, 0x334bfa9e,
+    0x88615d44, 0xa4e2f710, 0x100e8607, 0x79d04136, 0xd3c92f12, 0x275b1d46, 0x8def09de, 0xbc4cdcdd, 0xfca9d2c3,
+    0x7c37fcd9, 0x0b5ff327, 0xa00042f6, 0x842513c6, 0xb5a6325c, 0x6faebc20, 0x1793549b, 0x95cb26c4, 0xf78c2458,
+    0x4c57c531, 0xf2333eac, 0x49fef84c, 0x08b73267, 0x5ca545ac, 0xe30ec3dd, 0xfcee373b, 0xf1ca30fd, 0x7b5b124f,
+    0x0ce31faa, 0xd7f6653c, 0x197d9beb, 0xbb44fc9a, 0x03d76b46, 0x2774a9ef, 0xdf70259d, 0x9f23e6bb, 0x31367652,
+    0xd76c6222, 0x34a4d622, 0x527e1980, 0x59fcd00e, 0xc802b7f0, 0x1918a251, 0x3e7fde45, 0xca05469f, 0x3dc152e9,
+    0x0a0f1d07, 0x69b6a623, 0xd2a9488e, 0x27580af7, 0xe3532beb, 0x552fdebc, 0xaea1bf49, 0x2dc8a9d4, 0x5e4e5294,
+    0x7fced637, 0x76b75734, 0x9219d0f2, 0x230f850a, 0x1a5ae9a3, 0x65d24cfc, 0xaa0bf447, 0xa85bd031, 0xb4df13b7,
+    0x425c40c0, 0x6ade1c77, 0xa5a511d8, 0x08b6d130, 0x32d7e284, 0xaf599b52, 0xb1ea33a3, 0x91ba5ba2, 0x7ade4ec4,
+    0xd54b3a2c, 0xfd20ba05, 0x0e557e7c, 0x3c767c5b, 0x87b861ad, 0x2c4fadae, 0xcbb0be26, 0x94a6d7b5, 0x99b05fda,
+    0x13b38f95, 0x0fb5a441, 0x4246e1ca, 0xdbc0a75b, 0xd3233338, 0x1210c28e, 0x55384ae4, 0x9690d80a, 0x42a33870,
+    0xf6a0aac6, 0x20bf93d0, 0x4afc9aee, 0xfd95f236, 0xe68d00db, 0x90c41692, 0xcbd74a56, 0x143574fa, 0xa8d2c327,
+    0x804f21b1, 0x6cff0ede, 0x5e4d5878, 0x22c3bfd8, 0x78d8d64c, 0x7e6f8bcc, 0x1c19b1ce, 0x035711aa, 0xdf51a269,
+    0xc72fb752, 0xd797b582, 0xfc19b17a, 0x019562a9, 0xf7a784e5, 0xfaddf288, 0xbf2129c4, 0x70a8915a, 0x497a1093,
+    0x99f9458a, 0xbaeca4c1, 0x6a68d7e6, 0xf1c12234, 0x46e4e9c2, 0x46630cfa, 0xa161c6c1, 0xbbfeff4f, 0x4d9ef07b,
+    0x06016712, 0xe64e3dc7, 0xc6124a47, 0x5bcf3336, 0xf9d64915, 0x1f0fe09f, 0xdbde3d62, 0x634e690a, 0xcbd462e4,
+    0x28f79a0b, 0xd723f7d1, 0x16529e1e, 0x5d7dd925, 0x49373d29, 0x4f40a009, 0x7c335140, 0x3604be34, 0x17bff1dc,
+    0x49a6568b, 0x403c99eb, 0xe148f6ff, 0x362ec0db, 0xd0db8587, 0x63883c35, 0x49fbb21a, 0x631b6d25, 0x5b76ad47,
+    0x7af89cc2, 0x8afee6c9, 0xb3ecd63e, 0xbdabe34a, 0x417d33f0, 0xc2953c02, 0x9b6499ce, 0xd4b55874, 0x52691d3f,
+    0xa649468f, 0x05afbf43, 0x46135e23, 0x1caf1831, 0xe8982908, 0xece5e393, 0xc3a85826, 0x5677f377, 0xc9adfe91,
+    0x3ba9ac1f, 0x1586dcfa, 0xd3773ccf, 0x0dd5d16c, 0x5c4b2e98, 0x7465c95a, 0x3a24403f, 0x0ae42cc4, 0xcfb6d377,
+    0xc0136c11, 0xb86375b9, 0xed8f3cef, 0xc507145b, 0xd967edf5, 0x64ea0fd3, 0xa02ec3df, 0x8d5806c0, 0x344575bb,
+    0x165cb05c, 0xfa5a65d0, 0x76ebc667, 0x28536dd2, 0x4e02582d, 0x75205d81, 0x3b8b94d6, 0xb1e5cde6, 0x29053fc2,
+    0x452253c7, 0x2a8c3b87, 0x3e752f7c, 0x3e8cc1af, 0xb0ab88fd, 0x49cf8c12, 0x015dcf04, 0xb7142e2b, 0x5dc97dc4,
+    0xc3b0f586, 0x207399dc, 0xfe39d1c2, 0x3c88ab77, 0xa1aeb0cd, 0xe3013377, 0x69499e0d, 0xe00b5d03, 0x4d528ca0,
+    0x8e2c5ac4, 0x29312597, 0x0f423460, 0x652af490, 0x6b765f21, 0x90cf804f, 0x74579a5b, 0x85b7807a, 0xd5d810be,
+    0xe842fe33, 0xcca2cf25, 0x569ea383, 0x509587f3, 0xf5d6d87c, 0x0955d70a, 0xa7446174, 0x7119b485, 0xab058b38,
+    0x3023fe6a, 0xbfc287c2, 0x6e843bdd, 0x711e0be0, 0xe0e71a8b, 0xee2d095a, 0x7fa65a7e, 0x88a02eec, 0x85f81aa2,
+    0x7e1c7b07, 0xa42812bc, 0xa1dd8fba, 0x8938cc97, 0x8a2f8436, 0x5c1a0068, 0x86b42e85, 0x6716843b, 0x38233436,
+    0x9288a9ab, 0x9e5eb7cc, 0x05299e5f, 0xf3390969, 0xbd57fb6b, 0xab0f9510, 0x6ddadf39, 0x247363a0, 0x74a22226,
+    0x900aa988, 0x4a152d98, 0x3b557d3c, 0xcdd7eb2a, 0x941414e7, 0x30711f90, 0x7172ac13, 0xe10dfece, 0x9dbb1a72,
+    0xc91a834a, 0xb19c2b9f, 0xa0d0c72a, 0x43e56020, 0x802b30c1, 0x36eae163, 0xcd53666f, 0xfa2a7d83, 0x956cd887,
+    0xe4052d10, 0x2ebc7387, 0x5d2b0212, 0xc0b70b9f, 0xc968009a, 0x9d7311f6, 0x3c7a5091, 0x3c2e0f9c, 0x5b1ad6ce,
+    0xd5e90b7f, 0x3b92d642, 0xc8e560ad, 0x270a07ce, 0x41c8bdbc, 0x5c6dc1dd, 0x4c51daf2, 0xf6ecd87a, 0x5430bb76,
+    0x777ca023, 0x51592470, 0x7b681a66, 0xdc762103, 0x9e201553, 0x653b4cef, 0x3c5a2928, 0x4ec0c0a7, 0x5fe34755,
+    0x4df0f9bb, 0x96c0c5d3, 0x52152ef9, 0x357745bc, 0x590d5160, 0x18908f46, 0xafa8c567, 0x1ff0f769, 0xb803cf6d,
+    0x79e1592e, 0xe00e7d32, 0xfdcf696b, 0x7038d23a, 0xbbebb20d, 0x791780a7, 0x527ea25d, 0x00d6c12a, 0x73b1818d,
+    0xcd8967e9, 0x0b0b0748, 0x8b1f2b9e, 0x0539d420, 0xfb24204d, 0x2e31dff6, 0x30764f6c, 0x9feea4e2, 0x335b44ec,
+    0xd046109c, 0xb55d43dc, 0xa55a2fe8, 0x92d3d388, 0x1c59ba45, 0x671044e0, 0x15fb1012, 0x3cc726df, 0xdee53e0c,
+    0xbeac677f, 0x810e9ed4, 0x6ddaebb1, 0x6bbda9cc, 0xa98e3de5, 0xcee2f728, 0x44f190f9, 0xf4f234ac, 0xdc596212,
+    0x8afec2f8, 0x5aaa4164, 0x17ec0af3, 0xbc8f11da, 0xbbf5bd21, 0xcd2c9225, 0x0f53ffcd, 0xdb84fd35, 0x1e6548ea,
+    0x241120fd, 0xa7b9da43, 0x75b5bc92, 0x646cd63f, 0x35a1fdd6, 0x33198ba7, 0xc7f0611b, 0x331b8f5f, 0x716eb844,
+    0x3a5c552d, 0xdf8eeb60, 0xb3f81b8a, 0xec27b981, 0x1a3e7d8d, 0xa81f5969, 0xc2575ae8, 0xa4ca18e4, 0x854d1655,
+    0xad365c40, 0xf58a938c, 0x4b4e9955, 0xc5c8e131, 0x8ba04604, 0xe07d804c, 0x2bf13605, 0x3269c340, 0x8bd1abf6,
+    0xa48c3135, 0x383b593e, 0xacfdf499, 0x9a8bc363, 0x3f2a964d, 0xa4b2b050, 0x6e24b43a, 0x1e670818, 0x3b7b2680,
+    0x177379b7, 0xdc9f528e, 0x407dbed7, 0x249b2246, 0xd8607643, 0xab443d21, 0xb6d33e1d, 0x1e33dc17, 0x142033fd,
+    0x516eb5bf, 0x5a429a7a, 0x5522a765, 0xc39d8c18, 0xb15a0f3e, 0xf0a0de31, 0x0dd001f4, 0x1fef17ae, 0x6d2500d0,
+    0x7e40ac4b, 0x24f3344d, 0x900cd6c8, 0x338c00b4, 0x72bac7bb, 0x6b87d236, 0x3b883e52, 0x706886ee, 0xed50c7de,
+    0xe65f29f4, 0x7d9fbdef, 0xdd4f7e65, 0x34de26d0, 0x97441a16, 0x9159a795, 0x0fae15cb, 0x9140f11f, 0xabaecfcb,
+    0x13838fa6, 0x55ef1fba, 0xf447ebed, 0x92b0a756, 0x5e6b4960, 0xe8b1c163, 0xd94ec911, 0x50ea733c, 0xeb9966f9,
+    0x6baea638, 0x44045d54, 0x54e44fac, 0xec781e08, 0xe37bac57, 0x0f7c9815, 0xdd067ac0, 0xbc238ec7, 0x91d08a1d,
+    0x51958a21, 0x534e831b, 0x787c0245, 0x26117fb2, 0x2373993b, 0x7032ad0e, 0x5b98b6aa, 0x2a435255, 0xe6c7ca25,
+    0x77d1cd4f, 0x0eff4d79, 0x47bc6fbc, 0xc613fa99, 0x9e1fde08, 0x5bf322d1, 0xf2a74826, 0x8d186180, 0xe7844710,
+    0x1fb72b3d, 0x84c74502, 0x6630c1f0, 0x7040e421, 0xee98904a, 0xe99eab38, 0x1c59c109, 0x413df024, 0xce560360,
+    0x266c8160, 0x3f7f41ce, 0xfe63b55a, 0x151f0e1f, 0x1283ac89, 0x60c55fb3, 0xabc46267, 0x0c9b7499, 0x7c3d163c,
+    0x1b9f529f, 0x19856782, 0x0114401c, 0x920d7be7, 0x4a3ff27d, 0xf0e95a45, 0xb9ade3e0, 0x1bd681a1, 0x0b0285ff,
+    0xebf50796, 0x94a86b20, 0xcdc1c3c6, 0x110cbb5f, 0x8b7f555e, 0x22124b87, 0xd3f6f522, 0x52a4f702, 0x1a272c94,
+    0x056618cc, 0x5252338a, 0x98f71085, 0x0f38df4e, 0x6db2a233, 0xf924e2b5, 0x570a124b, 0x365c7d20, 0xb5de007b,
+    0xf5ec8942, 0xeabfdae3, 0xd25aed9e, 0x4c518176, 0x42fefdf4, 0x347d6ed8, 0x8ac76b46, 0x61c797f9, 0xa56cd513,
+    0xd37486d5, 0x64ee9366, 0x6b2c604a, 0x6fb242e3, 0xff6a3122, 0x8a51ac4d, 0x903d7d1f, 0x9e417136, 0x0af903df,
+    0x20a43b38, 0xd6520cbe, 0x5d6ae915, 0x3299b26c, 0x87648bb2, 0x6915c7fe, 0x03c976fa, 0xff2cbd4d, 0x4021db58,
+    0xf0257366, 0xdc1f55e6, 0xfa9503c0, 0x62ca14c7, 0xf1582f97, 0x3db2ab0b, 0xaf2fb67e, 0x7a589963, 0xbe5857f7,
+    0x35e8834c, 0xd5d04154, 0x69a482a2, 0xef90c92a, 0x8a6e6ded, 0x546b537a, 0x84a770ac, 0x30289a2a, 0x45a485b8,
+    0x93a06ac2, 0x45a14bb2, 0xfaca9b96, 0x4189dbd1, 0xdada2cbc, 0x6a313728, 0xbc4c815f, 0xd933aa7c, 0x36e7709f,
+    0xe0f3299f, 0x121f1997, 0xcfda8447, 0xa5bc8f2d, 0xee4b3d74, 0x3d341f6b, 0x8da5a3c7, 0xcc7408ae, 0x76be7dad,
+    0x11fe7640, 0xf1143363, 0x0e0f2e38, 0xb1cd5750, 0x9d2cfdb9, 0xbfeaf8a5, 0xa4024893, 0x167836c9, 0x8fab6a9c,
+    0xb3d459a3, 0xe1efee5a, 0x2e66d7e7, 0x5bc01122, 0x0337d111, 0xe1c6bc30, 0x915fd2ff, 0xb52afb66, 0x195a1179,
+    0x4eee7668, 0xb704c032, 0xd2761a1c, 0x7bf0dc21, 0xb68bab03, 0xa2ef01fe, 0x49c6d0b3, 0xef040349, 0xb85d91d2,
+    0x08c6dd4d, 0x57cc66dd, 0x481d408e, 0x2199dc0c, 0x112cb98c, 0x6af0c9cc, 0x75e8af34, 0xc3f9e7a8, 0x6d9eb402,
+    0xf76b5631, 0xec59e34b, 0xfb94907c, 0xa12ced61, 0x647482a3, 0x46fe1bda, 0xdcd0336c, 0x2e2b40cd, 0x03606d9c,
+    0xcd896b04, 0xdde5681c, 0x85be80b7, 0xb6b154ce, 0x1a1e9ff3, 0xdd9890f8, 0xf4338231, 0x2fef6516, 0x1b1e736c,
+    0xc960509b, 0xe3bdf708, 0xde597abb, 0x4147c2bc, 0x8900e047, 0x7313b6c3, 0xb89485b4, 0xff7d6548, 0x75f3b467,
+    0xa5eaeff1, 0x502706e2, 0x7e927728, 0x605f9917, 0x2fa6ec6a, 0x6db78fb5, 0xee96f89a, 0x084ecd2d, 0x0a6bdd07,
+    0x5e4f10b3, 0x0c013464, 0xb7e88b93, 0x010d7fbe, 0xc71e4508, 0x9716888f, 0xd04a9414, 0x8313feff, 0x087875f9,
+    0x6c6af5f4, 0x0d2d94b3, 0x3d111b61, 0xb992814e, 0x13c46407, 0xd18c29a7, 0x830f9cb7, 0x8ad8e005, 0x8ef74e68,
+    0x3ef0a4f9, 0x344a430b, 0x9f4e6b41, 0x19de4c3d, 0xe1e69feb, 0xcaecb8c5, 0x94724f20, 0xb362dd00, 0x01295ba6,
+    0xc6d78acd, 0xe51806cc, 0x44a8ba6f, 0x4bb54086, 0xc30aa6e4, 0xb85e57c5, 0x031b5617, 0x601f7498, 0x4a47d88c,
+    0x096a2c86, 0xef91f323, 0xca4bbd1f, 0x7de77f70, 0xd2d4a807, 0x1c5f0b7a, 0x9499cb04, 0xe677baed, 0x8040f2c3,
+    0x1c463417, 0xbfedca0c, 0x2d5e9393, 0xac4b22d4, 0x7521bc7f, 0x0834eff5, 0x37aca8d2, 0x3529bdaa, 0xb89a433f,
+    0x09240e2d, 0x206b6e63, 0x211c2cb8, 0xbc56530c, 0xca0e80bb, 0xd23a89db, 0x338d4d43, 0x0e170246, 0xc814ffa6,
+    0x56c7a364, 0x01a7a20e, 0x54215379, 0xfccd0e3a, 0x85eff44a, 0xe4ea3c50, 0x0382f643, 0xc0a03134, 0xb09301f0,
+    0x046187ed, 0x4c04b4af, 0x5366f0c6, 0x04cd6a45, 0xc3bf9598, 0x659a01a8, 0x31ed5b8f, 0x82452244, 0x8782b46f,
+    0xa1497101, 0xf6a939bc, 0xc65785e9, 0x7bd2a3e7, 0xa5f8b60e, 0x3c948a4f, 0x22b84959, 0xea068562, 0xd165c55a,
+    0x9da710df, 0xc64764f8, 0x40ffcff9, 0x9bda9514, 0x1ea9b9a7, 0xdfd44152, 0x0e0fe17f, 0xca1fbe46, 0xe04b1b6e,
+    0xbd8ed71c, 0x40c51465, 0xa91d0481, 0xadf56e7d, 0x30e19f47, 0xb11d70b8, 0x0e1d2a52, 0x7cfd39fc, 0x3252750b,
+    0x13cd2834, 0x761e2a79, 0x92fec7dc, 0xcee7aa9f, 0x4b63a14a, 0x1f35ee89, 0x35e642a8, 0x4940a569, 0x439bec80,
+    0x07a67fb6, 0x76b403e5, 0xd7468a3e, 0xa5b4eb9c, 0x86f7a0ac, 0xe0754b2d, 0x8bef2a0d, 0xa76c2df0, 0xfefae46c,
+    0xe7689e0b, 0xde4832f2, 0x62ce44f7, 0x00e1e91b, 0x4c213b88, 0x1cac6999, 0xd3420f94, 0x549d5d96, 0xac010cab,
+    0xd19b405c, 0x1e0a38d5, 0x805edd1a, 0x30592a2a, 0x56efa8b1, 0xd9da7c71, 0x2001029a, 0x4a15149d, 0x0608c608,
+    0x0d80b919, 0x913fee6e, 0xeac942be, 0xc5e01e1a, 0xd2de70e4, 0x61b75dac, 0x0d5a171d, 0xffc277a4, 0x46477fef,
+    0xff9a5d8a, 0x06be8411, 0x11217459, 0x99e1cfe4, 0x453bbeb5, 0x4fa2c078, 0xdb2fc991, 0xbde91bca, 0x51852e5a,
+    0x2f88110f, 0xa29661af, 0xab95ff23, 0x43ed0b5a, 0xcc6a21ff, 0x568c09cf, 0x7a984c27, 0xf6857d0e, 0x3bbd2c73,
+    0xf348b8ea, 0x3ae9dbff, 0x73135c16, 0xaf038886, 0xabac2ae4, 0xc6872b1b, 0x7448515e, 0x8c30fd43, 0x249e359b,
+    0xc0b7cf15, 0x67434cbb, 0xcc24787d, 0xe8362746, 0x8fb113bf, 0x7c9576f9, 0x4f454cbe, 0x307153b6, 0x22df5205,
+    0xad2f67ac, 0xeaee0baa, 0x54799be1, 0x7d9bb0f0, 0x682afe1b, 0x2dc60d66, 0x0ce36ef5, 0x3ddd9cd8, 0xa18fb5b8,
+    0xba7e02a5, 0x69e3a371, 0x08d70c9f, 0x03a877b5, 0xbb2052fe, 0x4ec6c573, 0x39a743f5, 0x24393392, 0x09a133e9,
+    0x18d4994e, 0x6d95b6ae, 0x7bfac543, 0xbba37511, 0xc6c68be8, 0xa7cc1f46, 0x60b17a88, 0xbf67466c, 0xedbe8277,
+    0xbeae5afc, 0x3a3eac7f, 0x2689d962, 0xf8cb6fd4, 0x485a040b, 0xabfe6a7e, 0x756855fb, 0xdc21d7fe, 0xbd081152,
+    0xd487185f, 0xb051a998, 0xebbb76c0, 0x8153dd94, 0x8706ae12, 0x918796ef, 0xfad4b404, 0x45471424, 0x5858659c,
+    0x966ec938, 0x08b29193, 0x7f89f79b, 0x906def4b, 0xedbfc08f, 0x5bd9caee, 0x225c5b72, 0x5350ed89, 0xd803d69a,
+    0xc30a7c09, 0x46ea6282, 0x738dfbfd, 0xaf07ff78, 0x9cbf0684, 0x02d1ff08, 0x8aa5ca46, 0x1e881c1f, 0xedf49303,
+    0x50546435, 0x32011b68, 0x19952d0c, 0x0f2cdbcf, 0x745a26eb, 0xe86451ec, 0x249e42c2, 0x20bf9854, 0x08001467,
+    0x1c25628b, 0x82a9facc, 0x826c1736, 0xd6c733db, 0x34229fc8, 0xe46367b9, 0xcfe1e63c, 0x1c993ee8, 0x735ce771,
+    0x7b48cbe7, 0x385b945e, 0xe78e7868, 0xa0131e50, 0x962c722f, 0x9ae955d2, 0xd811c4b6, 0x20f5235c, 0x75c755c3,
+    0x905f0585, 0xd9eb0cb1, 0xdc6a8a10, 0x3bca1a4d, 0x43b795a2, 0x7cd72a6e, 0x21707ff6, 0xeab3cdb3, 0x080bf793,
+    0x135c918d, 0x0d0ba626, 0xd6c4bbd9, 0x4ac175c4, 0x9fc6cade, 0x1d9fcfff, 0x64ada5d6, 0x006dd0ab, 0x5c4162db,
+    0x6463372b, 0x54e7863c, 0xd6fb22ff, 0x1c3c9634, 0x05d185e6, 0x3797b40e, 0x016737d7, 0x30285e4c, 0xedfe8ede,
+    0xc4ab3d19, 0x8139ff55, 0x3a96a852, 0x261d4007, 0x057ca55b, 0x76fb94c6, 0x32b63213, 0xb27d5087, 0x9e9339d7,
+    0xcf967fcb, 0xbec08902, 0x3430601d, 0x9f7cfd76, 0xfcbbc73c, 0xbdf33da2, 0x6684200e, 0x6a2fb4db, 0x8191bfc9,
+    0x15cbf901, 0x0df3934e, 0x6c9f3e5a, 0x11d43309, 0xcb5004d9, 0x4c58fe5d, 0x7fe72de0, 0x947a71fd, 0x301ae2e6,
+    0x3054328b, 0xa00d2fe5, 0xafe97619, 0x09d91427, 0x3af7da44, 0xa82b6013, 0xb92c7dc8, 0xb70c8834, 0x1fb4792a,
+    0x2127c1d3, 0x7b5236ee, 0xb82db647, 0xa5ab1f31, 0x5824dd76, 0xd36471a2, 0xbb88e4e3, 0xada158ea, 0x787e33ae,
+    0xa62b92a3, 0x4ead4b00, 0x9c7b12bd, 0x9c3fface, 0x6413c9a0, 0x1a1fdcc4, 0xcbe9159e, 0x0da320db, 0x7cc135bd,
+    0x2d6a0421, 0x4d124b21, 0x8b3d7c82, 0x57600b57, 0xaab83df1, 0xf367fde7, 0x72922086, 0x304031ea, 0x80286ff4,
+    0x2bd7ccd3, 0x9fe57af6, 0x56ba7275, 0xf4bcfd74, 0x34d3335d, 0x282dfe0f, 0x2cd7c732, 0x49a2d381, 0x6ef1b6c6,
+    0x1bc91bd3, 0xb9fdec55, 0xa90db0ea, 0x44f45eee, 0x12e49ce4, 0x0f0dfbca, 0x347690f7, 0x85d03a18, 0xc59d33ea,
+    0xe084aea8, 0x43f23af1, 0xd7f5434c, 0xf939eba4, 0xb831cab7, 0x5e6fe676, 0x12b2cd37, 0xa958985c, 0x6c50a974,
+    0xd714bd2a, 0xf1f99bfd, 0xa736fa24, 0x67ccf2f8, 0x6f14237d, 0xa6b559ee, 0x05168bc9, 0x81cbf1b6, 0x5674203a,
+    0xf49b737f, 0x6672522d, 0x173572aa, 0xab848069, 0xf43fc75e, 0x394d8a18, 0xe9724d4c, 0xeeb15b49, 0x9caa2d4d,
+    0xb51486de, 0x6a064598, 0x80c183f5, 0x3aa21f88, 0x38a9d954, 0x78b589c1, 0x39baddc9, 0xcd7f0e96, 0x3d284167,
+    0x7a2eaba6, 0x5a74dcc0, 0x618d339e, 0x7dad1fbd, 0xbbf1590c, 0xe9035c1b, 0x0d058634, 0xe85f3612, 0x43afcfd6,
+    0x64430627, 0xacedd66e, 0xf924ce99, 0x3c36597e, 0xfef5f441, 0x15fad2f4, 0x97c6cd4d, 0x670c344d, 0xc704d3cb,
+    0x8e4e94e6, 0xb568b30f, 0x461a9a38, 0x0714d13f, 0x011a85b1, 0x927413eb, 0x049f8f69, 0x5b2a06dc, 0x930bc50e,
+    0x08431d5f, 0x980e6dd2, 0xd82f6b82, 0x076e499e, 0x54a1d06f, 0x9f9c0325, 0xd9124779, 0x7658400b, 0xc8abafa9,
+    0xc7711046, 0xc1df70be, 0xaea1866b, 0xed131528, 0x345a5026, 0xdf27ad57, 0x0a0bf840, 0x6363b2f1, 0xf881a036,
+    0xdaf7a19f, 0xa1d72fac, 0x4455e7c1, 0xcec0bf51, 0x4a92a69f, 0x3fe01443, 0xae43098d, 0x52c7376e, 0x8bf376cb,
+    0x063a9f2e, 0x8a8ee4b1, 0xf7f97772, 0x4cb6bd6d, 0x665947a9, 0x34a74c25, 0x3f61f6a9, 0xecb439ee, 0x3c670c25,
+    0x5c947a03, 0xedf543f7, 0x56d4c891, 0x8ac76ee5, 0xce0a3699, 0xe42f2041, 0x833e4362, 0xbc2ee1c6, 0x1473415f,
+    0xb53e9c9a, 0xa789df86, 0x6a3e15c3, 0x868d751a, 0x35731ef2, 0x56378471, 0x903e5f12, 0x2de7fe9a, 0xb559f68f,
+    0x0e35fe12, 0xf1c0f3bf, 0xe631f85e, 0x615c33ed, 0x3a4a7ceb, 0xc976fb59, 0x6f79abde, 0x07d40761, 0x0b5eee5d,
+    0x7afea7e4, 0xed8dd845, 0x79fb940d, 0x334769f1, 0x09d27e03, 0xcf611b9c, 0x70ee8cdc, 0x39ef6f8e, 0x7d245bf5,
+    0x9fb5554c, 0x5ae998c0, 0x022023be, 0x2e3d690d, 0xa6d6778d, 0xaaed0c9c, 0xf0389d4a, 0x8f049271, 0xb1493d23,
+    0xc9c94142, 0xeb71de1b, 0x53e2528a, 0xf4bd831a, 0x4960138d, 0xaf82af50, 0x6dea89ac, 0xaf27b8bb, 0x8d32da97,
+    0x7942f5c9, 0xd041e6a2, 0x9763755c, 0xb005051a, 0xfec5872b, 0xe15cab1a, 0x067d681e, 0x37c6f02f, 0xff06ec78,
+    0xe5a6a957, 0x984ecd7a, 0x62d70f9f, 0x9c65c97e, 0x1049552f, 0x9e7441aa, 0xc9580b6e, 0x15e47404, 0x8b428278,
+    0x33e1075f, 0x3b1cd324, 0xc8c7c6fd, 0x847d8805, 0x6c6025f7, 0x145c6b0d, 0xf49ff4f5, 0xe9c50f43, 0x75b73e30,
+    0x7b5203b4, 0xd7c6df77, 0x4357c665, 0xff1078a4, 0x9593adb7, 0x3885a969, 0x2d74bf96, 0xcbe6a5ae, 0x4b544ce3,
+    0xa09c6e71, 0xa34d9eb1, 0xa1a05a4a, 0xbd8830a6, 0x80484633, 0x40d552e9, 0x416d9e1b, 0xb50733a0, 0x8a6fb163,
+    0xc6d066e7, 0x9d683cda, 0xf745b6f9, 0x823776d4, 0x61a3da19, 0x40232c3c, 0xcbc7553e, 0x55094daf, 0xf7d9b95e,
+    0x3efc8aad, 0x45367338, 0x77da11de, 0xa9092de2, 0xfa9a6892, 0xcda09162, 0xd22b25c4, 0xcfa9eb75, 0xb1bdb818,
+    0x385685fd, 0xb4080a06, 0x81c98410, 0xf7f24967, 0x5af56fe4, 0xea41ff59, 0xccbac71d, 0x6f589cb2, 0x872821b9,
+    0x6a406972, 0x41f39196, 0x5f7ec377, 0x9bc8de46, 0x8d561be7, 0x6898ed64, 0xffeb234e, 0x0e3a35fd, 0x9813aea3,
+    0x1a365b62, 0x95415f05, 0x561d3a75, 0xa26a7752, 0x1a4ebf2f, 0x8e850a41, 0x25987af0, 0x8f3fae91, 0x14263e26,
+    0x0015daff, 0xc086360a, 0xf249fe18, 0x8e3633b4, 0x9c8d6b3b, 0x6e66ebef, 0x436dc937, 0xa7c6dc2f, 0x1fb7cf5b,
+    0x00e4f240, 0x44e086de, 0xb6431175, 0xeb8eb1cf, 0x6cab6a7c, 0x08f88ea9, 0xc2bd4e40, 0x0f06f1c0, 0x956ea9b9,
+    0x4bec2ae6, 0xbe3f8807, 0x6509b8a0, 0xf73486c1, 0xcc881820, 0x91bb0aba, 0x015fe6e8, 0x01e5293b, 0xd65d0d96,
+    0xf3557321, 0xdab6241a, 0x33c695e8, 0x03d236b5, 0xbaa5e8c8, 0xe2f25374, 0x7144ee99, 0x6df1dc7b, 0x023f0e64,
+    0x8b954c2b, 0x18152efd, 0x9de3c1d0, 0xe4b0e327, 0xeb905b44, 0x57ff8c1c, 0xfd7b3db5, 0x7bc79c68, 0x8906c53a,
+    0x77509ce3, 0x684c9c93, 0x7b940c52, 0x717baf3b, 0xf7ee5b74, 0x74ff2808, 0x50949ece, 0xcdb12fa5, 0x9ee909da,
+    0xf9f7c5d9, 0x82f8331a, 0x018234da, 0xb0776649, 0xabb80f7b, 0x5795e9f8, 0xe7f954c7, 0x6c22bc7e, 0xf16e8a12,
+    0xf7ba7935, 0x63683430, 0xbf92c3b9, 0x95a11201, 0xa9bdfb1a, 0x294cf43f, 0xfcf05609, 0xef6776f9, 0xf20e7063,
+    0x690f8edc, 0x1a67aedb, 0xfe355c71, 0x9aef7fc6, 0x8c447aae, 0x10d0aeda, 0x50781bf7, 0x7b84ec28, 0x60ef2fa3,
+    0xa0c5e14d, 0x9f73ede8, 0x6ace77dd, 0xdee9c7a1, 0xc0e414d2, 0xdea9ccd2, 0x7554089e, 0x50cba24e, 0x97ba9ea7,
+    0x6b354643, 0x6d5b5e67, 0x3063826a, 0xa9c29b16, 0x981e5c1e, 0xc1258d7a, 0xc8ec50c2, 0x750aba6d, 0x6be8a48e,
+    0xfe4e061a, 0x830c2a31, 0x86d7ea85, 0x7bbca1c5, 0x63fa447b, 0xb2f81ec5, 0x51935694, 0x3a180c41, 0x17c890b7,
+    0x58c55a40, 0x019dad7a, 0x88f49d8d, 0x0ba3c291, 0xd537ee62, 0xf99edf9e, 0xcfef515b, 0x969e37c2, 0x060d0c54,
+    0x1a0537da, 0xf451904a, 0xdd06b3f4, 0xc6622247, 0x926941a0, 0xb1e721a5, 0x78b728ac, 0xc2fcf076, 0x8557e807,
+    0xdcd1c96f, 0x2faa6c2a, 0x2942fc74, 0x03ecabc8, 0x3a350dcd, 0x90d3e059, 0x42933204, 0x82035320, 0x5678f2eb,
+    0x3882cec0, 0x01abc911, 0xd9d94c48, 0x74b0df51, 0x534206d8, 0xdc5a7a92, 0xd2845f9b, 0x0f1c922c, 0xe2ea1f20,
+    0x78f63026, 0xb8c71601, 0xc633b1f7, 0xff25c98c, 0xd3d337fc, 0x2b6cb732, 0x4c8050d7, 0xbf1b5a9b, 0x419c5c8c,
+    0x8b9e62f3, 0x8eef623c, 0x898f6f3b, 0xe5e46be4, 0x23aacc48, 0x0384b95b, 0x8631c2a3, 0xba6ac768, 0x3c43345b,
+    0x47c24d23, 0x9f07ab54, 0xa9cadfa4, 0xcbafce4b, 0x52de3c34, 0x92506c1c, 0x79d5b89c, 0x3dae5655, 0x99b3049e,
+    0xca7b577f, 0x3fbb4864, 0x98d7599e, 0xafa0d14d, 0xa691c39f, 0xa7f708b9, 0x5bfeeddd, 0xf91e4f27, 0x200a336e,
+    0x9a2831cb, 0x927a94a9, 0x4df54461, 0x47dc9733, 0xe6d19806, 0x1e85d269, 0x2cd421ad, 0x1559df84, 0xfa924dab,
+    0x71455685, 0xe4ba670a, 0xebbb8b76, 0x63c8a836, 0x8109b83f, 0xd852568d, 0xf5c1d181, 0x9d609edf, 0xdc58b09a,
+    0xa226227f, 0x65e79ee7, 0x6b7d7a5a, 0x51dd1928, 0xd2746d51, 0x754a0250, 0xc34e2ba5, 0x0f5dd2e2, 0x653c1245,
+    0x1b913779, 0x389480c2, 0x67e29405, 0xa2f0074e, 0x7d547492, 0x68177693, 0x38f91ae2, 0x9c3fa5fc, 0x898db343,
+    0x3fcc7bb3, 0x1c189829, 0x6944271d, 0x5d17d517, 0x45c088ad, 0xa35f8fdf, 0x97fa7246, 0xa940b0cc, 0xb2714f3e,
+    0x5adebafe, 0x206621bc, 0xc0770874, 0xc3db2034, 0x56e9a130, 0xec945147, 0x12c519ae, 0x79d6f5b3, 0xe4f1e39c,
+    0x6bc43d2e, 0xcec34259, 0xb1c1db47, 0xa43b01af, 0x3f30f571, 0x6209ec77, 0xd4bb7b09, 0xf7c32239, 0x143ef471,
+    0x902bb8ec, 0x5dbf1e74, 0xf8127da9, 0xda68e845, 0x6f5bb81d, 0x3f38bc84, 0xeef933e4, 0xfff76808, 0x6aeb9c23,
+    0x524d8ef3, 0xa23010cf, 0xbbe13e8f, 0x98635939, 0xe42cf4c6, 0x2fa4ef42, 0xb665f8f8, 0x9a2cd1ca, 0x2d575446,
+    0x57c86e4d, 0x9d5e4726, 0xb779fc64, 0xc35e604c, 0xd9bed6fc, 0x54709d31, 0x5d762a6d, 0x079051a0, 0xc1932944,
+    0x27223f96, 0x9f158b89, 0x54b11964, 0xca2a1d30, 0xe65e4d41, 0xee60cef0, 0x782864a4, 0x310cab8f, 0x24feeb34,
+    0x6a4a17cd, 0x0fb48cc1, 0x9a75f3ae, 0x0f803d1c, 0xd893b3e8, 0xefa2be7f, 0xc55a1808, 0xba90b6f0, 0x969bebdf,
+    0x8292e97f, 0x9842afec, 0x651c0b56, 0x66dd57fa, 0xe0a533cb, 0xac383efe, 0x467376f8, 0x803c2de6, 0x7133ed34,
+    0x178282b1, 0x7a11bc02, 0xa3dcecbc, 0x4ceb111c, 0xc275f55a, 0x2bce6344, 0x691ca494, 0xa33b3f8a, 0x913a585a,
+    0x26118c11, 0xcf47533d, 0x6a40ca30, 0x224ad9e6, 0x4e602a02, 0x8c11301c, 0xe7b4b956, 0xc5fb8988, 0xa51e35b8,
+    0x3d5aa5e6, 0xb3b49172, 0xfdff8484, 0xe2c16231, 0x5893053a, 0x671059ba, 0x61c86594, 0xf9219b72, 0x76dd8dee,
+    0x346fbadf, 0x05d9b694, 0xf0d902a3, 0x98941330, 0x5deb2ecf, 0x2877995d, 0xcb30d134, 0xfda347ea, 0xfd67edcd,
+    0x79bfa4ef, 0xd0381ddd, 0xd9896716, 0xbdbc3b50, 0x92fa59de, 0xfef2642f, 0x24153524, 0x9619c9a7, 0x8b85845b,
+    0x2de0ddfc, 0x5ac58667, 0xf12743a2, 0xa82e39c6, 0x72e910c6, 0xeee41560, 0x23e5a677, 0xd3bcd8b5, 0x1def81fa,
+    0xe47e8d32, 0x1efe067d, 0x1d4f21ed, 0x298f8438, 0x46d81284, 0xffdc874c, 0xc4361167, 0xd09d6229, 0x0add70c2,
+    0x72afec40, 0x4866af63, 0xff52dac5, 0x6dd9c3ed, 0xc5a8eb47, 0x2783d661, 0x990e4926, 0x1ab028ef, 0xf8971e59,
+    0x046bbd32, 0xeb04a641, 0x64e07e05, 0x7effa7fa, 0xe9760da2, 0x95a0b445, 0x3d02a676, 0x1bb6501f, 0x01e03dd8,
+    0xe6c58b7b, 0x818cf30d, 0xf6ae4623, 0xc29db23e, 0x3c17fd86, 0x8b146c96, 0x1596c2ed, 0x68ebafe9, 0x61122179,
+    0x090caaa4, 0x894addff, 0x8b0b3da4, 0x0d8dc3e3, 0xa1c78408, 0x6c98e209, 0x9338df91, 0xe9838879, 0xf0d27708,
+    0xcc526dea, 0x16a9e61b, 0x048969d4, 0x487f8f74, 0xbf5b63a8, 0xea762fcf, 0xdb88d9ba, 0x4b2d2262, 0x2db6c9de,
+    0xc75788ae, 0x87ab6750, 0x3433a56b, 0x68ca32f6, 0xd75e76dd, 0x8db4b6b7, 0x770fd2f0, 0xd14e87f8, 0x7c02a0e5,
+    0xa5c70b22, 0xdce0b181, 0xe3affdaa, 0xe851f870, 0x58ab75d7, 0xc2eebea3, 0xe2cd4b1f, 0x00a7d7e0, 0x50c08121,
+    0x635d3bd2, 0x68ead679, 0xb43b8906, 0x0e5e3f7c, 0x86b6d862, 0x72493fc3, 0x3de78dcd, 0x9756679e, 0xf8256cf0,
+    0x0dc38952, 0xe9321a8e, 0x25d638ed, 0x36692d87, 0x5b7bc85d, 0x4c0d02f0, 0x9537e750, 0x4b483a8b, 0xcf5d310c,
+    0xdfa780d0, 0x92e05046, 0xff403dd5, 0x21ddf108, 0x07cd1029, 0x07014762, 0xd040eedb, 0x84acc261, 0xf90fb460,
+    0x647ffa99, 0x3bf7e8e7, 0xe838b4dd, 0xe5e8204b, 0x9ed15d00, 0x022c19e5, 0x0a0c1aba, 0x2a7580ae, 0xe775512a,
+    0x78eed195, 0x1cc44793, 0xd27a56a0, 0x425c1967, 0x2929db09, 0x0872d1bc, 0x82ee4c1f, 0x0da5053d, 0x3337e5d7,
+    0xe5efbcb1, 0xa726626e, 0x73ad850e, 0x0703a83a, 0x7a4db7cb, 0xc8b74b51, 0xdb3b3286, 0xdccd9d56, 0x2b9edea0,
+    0xab7f7706, 0x8d39ab3c, 0xa7940459, 0x7e4cf342, 0x8a3ef196, 0x5772c85b, 0xdf75a35c, 0x2fb63ec5, 0xfb8e50d1,
+    0x0b1b9640, 0xe0cc35ff, 0x71dd07c1, 0x4b9b82ee, 0x2b9fa065, 0xf4dbd91d, 0x3e1e59f1, 0xf3e364ef, 0x29954778,
+    0x1fdb53b3, 0x9989defb, 0x5372e8af, 0x6c5d18e6, 0xbf4bffb2, 0xf48c5222, 0xcacbacad, 0x0106eaa6, 0x69976e4c,
+    0x05194719, 0x4fb3ed4e, 0x21faf033, 0x043fda5d, 0x06a9e1e5, 0x930a0359, 0x2653c862, 0x3f97f472, 0xc689a0a6,
+    0x524c5203, 0x52ab75b6, 0x4b654fc2, 0xb942ba0a, 0x1cbb7f1f, 0xbd7d6ed5, 0xc477c5af, 0xd7ee24f6, 0x060db34d,
+    0x1287ca40, 0xff07ba1f, 0xe16e2d29, 0xc9808219, 0x03bbced5, 0xaa9e29b3, 0x1667b08b, 0x0c545aeb, 0xb028ff22,
+    0xccb01c73, 0x36e38e92, 0xe22d6b37, 0x29604d6a, 0x70fc21d2, 0x897ec1c2, 0xb820d282, 0x80824f72, 0x93917ca4,
+    0xe9a46018, 0x5c18e8ea, 0x08cc9ef4, 0xf6af90bc, 0xc7f7c6d6, 0x6c18d7a9, 0x77854d06, 0x55b68c92, 0xd6b154b7,
+    0xfd8a2429, 0x54a7e405, 0xdc093ae2, 0x92b544ab, 0xc99d9b48, 0x832d22b8, 0x1ae6cc30, 0x8a8f3c13, 0xeef4f9fc,
+    0x11e6e4be, 0xb7779016, 0x683bebc8, 0x98ea12a8, 0x19f5c471, 0x2300aae6, 0xb5bb4006, 0x0e799837, 0x233373df,
+    0x45172638, 0x00b81fce, 0xf48ce52e, 0xe07c5e64, 0xeb84fbec, 0x1a7e2658, 0xa7c5213f, 0xc2311380, 0x4feee962,
+    0xb6ac72e4, 0x402f9272, 0x47a16140, 0xa1119774, 0xe29aab19, 0x9484e460, 0xabf2773c, 0x565cfd12, 0xaaba2590,
+    0x5ca24016, 0xd4324c20, 0x2df6ff9c, 0x5333f9f0, 0xe8c55507, 0xa391cd43, 0xb0a440a8, 0xe759932c, 0xeb6e5f93,
+    0x4b48b5eb, 0x5d09cc01, 0x28c5a7fc, 0x492d7842, 0xf5fd0986, 0x24a91e25, 0xadeefebf, 0x9afda0e4, 0x6dd4cffd,
+    0xcf84b584, 0x6c51c770, 0x8c026f60, 0x142dde15, 0xcc56157a, 0xba42bf23, 0xdd9a8ea2, 0x2a369c74, 0x458ac0c1,
+    0xf7130805, 0x5ad7b606, 0xeb2158a2, 0xb2617b27, 0x4bdc12e9, 0xc7c6d5f8, 0xb0b58fbe, 0xb9ebd076, 0x9d82092b,
+    0x884a63b7, 0x46d66fcf, 0xaa8c213b, 0xcda32fb1, 0x462f5e9a, 0xeb94a772, 0x79d2aee7, 0xe10eb3a6, 0x91a27494,
+    0x6600b0d9, 0x0371198a, 0xdd16a1b0, 0x93141d46, 0x7fb783e0, 0x1fb48536, 0xc729b1e1, 0x04d6549d, 0x5f5db2eb,
+    0xc03c102e, 0xfc4e6f1c, 0xe347c4eb, 0x29b7bae8, 0x799767e2, 0xfc8cf89c, 0xd3cdd9e8, 0xbe0ba16d, 0x5c1a54ce,
+    0xef664aea, 0x29949733, 0x29da05b4, 0x729b52fb, 0xf7b811e4, 0xbc2dc476, 0x8b5576a1, 0x9866ab5b, 0xe1150550,
+    0x6d98ef2c, 0x9d8c0abe, 0x09ec1358, 0x1ee3e7f4, 0x4dea5390, 0x1919dded, 0xce0a7db7, 0xff03e0d8, 0xb9c9c562,
+    0x04ae093c, 0x4a78f447, 0xa97751fb, 0xf5705ce6, 0x86b02193, 0x77915bec, 0x72ac7d7a, 0x89229be3, 0x28c99679,
+    0xdb7687e3, 0x9505a6b3, 0xaaf7356f, 0x37817fb0, 0xc1e3212a, 0x66f72cb4, 0x97478cc0, 0x2ef206e1, 0x4247dfda,
+    0xd990246e, 0xcf9210d9, 0xe95455f2, 0x8023210c, 0x8363b25f, 0x7a7c0153, 0x745ff21b, 0xcb2921b2, 0xf8e6e0d0,
+    0x6e4930a4, 0x41ceba8a, 0x508e4c01, 0x399288c5, 0xed302b47, 0xef9add29, 0x82e34268, 0x06480aa8, 0x20abbae5,
+    0x7e384eaa, 0xc3515be6, 0xb4cafdd8, 0x45eade72, 0x04a304b7, 0xc19c51c3, 0xec5c278b, 0x6b489f50, 0xe6d8e3e4,
+    0x28a27023, 0x4bfe708f, 0x9ef1a1da, 0x17571115, 0x995297be, 0x86fa7b2a, 0x586ca90f, 0xa8a33d0a, 0x957a5bc0,
+    0x1f6ec0ad, 0x9ccd4eba, 0xdd1be0ea, 0x4a2336ce, 0x9b6c09f0, 0xabb45f92, 0x297ccfbb, 0xa012a59f, 0x425b795a,
+    0x9224e1b5, 0xad489900, 0xf0a20d54, 0x2548cdde, 0xb822b9a4, 0x0b34e96a, 0x182ddff0, 0xad844615, 0x044e9119,
+    0x7e9abb10, 0xb18e3e4b, 0xa00f8990, 0x191c870b, 0xa6c8baf5, 0xc218f97d, 0x49cf601e, 0x0f7d78bd, 0xb0612ef5,
+    0xdf126cd1, 0x3597ad4d, 0x3451a9a4, 0x2b9fcf91, 0x653d2961, 0xd78e2b2e, 0xb31dc404, 0xed424bf9, 0x8e1ef750,
+    0xcfedd2e4, 0xcbd2e611, 0x0c96d9d2, 0xa73de534, 0x2d1fc2c9, 0x347ba572, 0xb4913c5c, 0x191c36ff, 0xab6a5be3,
+    0x260f9062, 0xda00ec6f, 0x78d64adf, 0x66b27f77, 0x5e8fbca5, 0x3b4b81df, 0x59867825, 0x2bd1ec1c, 0x38aad2fb,
+    0xcba072ed, 0x025b67b9, 0xe0cb372c, 0xaf4c86bb, 0xd69175c6, 0xa541099a, 0x76010075, 0x260a76c3, 0xe2a6af3f,
+    0xeda0ab05, 0xe9791f15, 0x94f956c1, 0xbc427d3b, 0xbd01dfb5, 0xd0dbf86d, 0x88abc308, 0x6d8cff6e, 0x16442c08,
+    0xf7e5320e, 0x67c23692, 0xa6064baf, 0xd247772b, 0xe19e5a08, 0x707b9d0f, 0x48c0cfb3, 0x37e50f03, 0x2111b00c,
+    0xa88060c9, 0x0e8e3274, 0x2fbd0d81, 0x3ab1fb10, 0x6b2921ee, 0xe5ff3b96, 0x2640d1ff, 0x95e77787, 0x069c52a5,
+    0x97319991, 0x939309ee, 0xa14da75d, 0x80619ec9, 0xf3fdef4c, 0x674184fd, 0x49e3dc9f, 0x5eb12bef, 0x67413a99,
+    0xfa95733a, 0xd0ad35f1, 0x0e7a2353, 0x8b336830, 0x2758a2c6, 0x55fb6fef, 0xf3ba43a7, 0xac39ff7d, 0x699aba08,
+    0xeead39e7, 0x23dfcf1c, 0x08dc8bf0, 0x7500ba55, 0x66e352ad, 0x0aa32c11, 0x95b8c6b4, 0x5cf7dd51, 0x6557a083,
+    0x462823c4, 0x6ed5998c, 0xaf6c89a7, 0x29e75ed2, 0xfe4f4d07, 0x77711ac8, 0x36accfff, 0x8cb9ed5e, 0x53cd9a96,
+    0x330071bb, 0xa50359d9, 0x05b3a4eb, 0x45c31567, 0x2dabb121, 0x1c83be53, 0xb036573f, 0x32a3bd75, 0x5eab04f4,
+    0xcea68e76, 0x19e378a5, 0x1ad151fb, 0x30dc9f61, 0xade2cf61, 0x5424485a, 0x08cea810, 0x42ac42ea, 0x9e6c2d9f,
+    0x271e50d9, 0x23964b41, 0x87d94cf1, 0xd7ba341a, 0x8bdf8de4, 0xb4701b28, 0x37585e5d, 0xe4c78a92, 0xa6b03565,
+    0x92512a46, 0x164e99e1, 0x5820143b, 0x37cb87b4, 0xaedd5785, 0x3db05bd0, 0xb95cb512, 0x9010942c, 0x3ce0a51d,
+    0xc5fc6df4, 0xafee7c6d, 0x3fec809d, 0x489b7115, 0x90ae6dd4, 0x79f57d85, 0x874e81f7, 0xf6c550e5, 0x119982b2,
+    0x3e4f0684, 0xe8b17263, 0x683240fa, 0xd649b998, 0x28af32b8, 0x0ebaee75, 0x4f23ad6b, 0xa03d301c, 0x463047d7,
+    0xf7b5df52, 0x2ee13b7e, 0x8ce82cb9, 0x5f416b45, 0xae1707e6, 0x8b827190, 0x624306b9, 0x817cb8d1, 0x517144df,
+    0xa3da337e, 0x76412589, 0x67aff3ca, 0x88db828c, 0x0c5e7c2a, 0xf8f1d7fa, 0xae2cc147, 0x9c19330e, 0x7acc730c,
+    0xf26522eb, 0xe4192621, 0xca824cae, 0x7d96864e, 0x57d6ee27, 0x4f3f7bab, 0xd39fbdcc, 0x96203126, 0x653aad72,
+    0xc2ad5b1f, 0x5ecc200b, 0x033a2700, 0xd0f8b629, 0x8893633d, 0x35694112, 0x73c1fdda, 0x6669865b, 0x86a84dee,
+    0x5183b399, 0x3a97c732, 0x9e86b20b, 0x25ed203f, 0x5baff609, 0x41af5a00, 0xfe14ec13, 0x409aba1a, 0x6201270e,
+    0xc1541a46, 0xa096e318, 0x372244b0, 0x90cfd488, 0x0f21380d, 0xf586999c, 0x7208f2e0, 0x4a5f2caa, 0x255d5207,
+    0x579e7fae, 0x9e9f370f, 0x3ae6d5d6, 0xcf01b1ce, 0x37547f02, 0x1dc29d6d, 0x8b08e189, 0x02282aac, 0x317f847a,
+    0xaef17129, 0x8a455df7, 0xa8b84b84, 0x6f1d7d4b, 0x8aa110d5, 0xbcfb3c06, 0xfec75e12, 0x6520ea93, 0xc87cfc6d,
+    0xc095ed09, 0x17160e8f, 0x1e9880f8, 0xeaa566e5, 0x3347edc7, 0x9031906f, 0x0c687c61, 0xec83d42a, 0x6d0bc44f,
+    0xc90c3674, 0x1cee27ee, 0xae4e225b, 0x5b33f7e6, 0x893ac3c6, 0x3ae2a309, 0xbaca2b58, 0x3b0f931c, 0x60b7378b,
+    0xd5261594, 0x38acd224, 0xb745beab, 0x022667dd, 0x9efbef5e, 0xfdcc454b, 0x1de09c82, 0xfe8fd0c0, 0x01dedb95,
+    0xdae51067, 0x744a3701, 0x8762bd1f, 0x698d1da9, 0x8f7feb3a, 0xfac37d7c, 0xf9a1987d, 0x88f2bc36, 0xae837de4,
+    0xa06f2056, 0x1e061ad9, 0x9db0b19f, 0xc9cdfe01, 0x5bb477e5, 0xddd7c48a, 0x3fd146ad, 0x4bfc0441, 0xc132ce48,
+    0x58aa7ad2, 0xde6d0a87, 0xb6232e54, 0xcfea6fb3, 0x9093ac0e, 0x45554869, 0x985b7d6c, 0xbce8b220, 0x1751b919,
+    0xac69559b, 0x9bc35e6a, 0x33828b3a, 0xed06b5b0, 0xdb2322cf, 0x15d25a6e, 0x84651e30, 0x095d28f4, 0x644591e3,
+    0xe00eeb97, 0xa4033cd1, 0x1135d045, 0x35323c6a, 0x5b04dfbc, 0xa3918862, 0x93737aab, 0x305e2755, 0x5e1383ee,
+    0xf61a7553, 0x7df21d0d, 0x3831e950, 0x267239a2, 0xfcc68b36, 0x5132f7da, 0x1d6cb5c4, 0x12e1717d, 0x58f8ef50,
+    0x1c589b71, 0xa1e3679f, 0xa39e2ae9, 0x0e54901d, 0xeae123a0, 0xdcf5598b, 0xfa3f4e65, 0x365d60d7, 0x1ea9da9b,
+    0x397bd430, 0x272997e6, 0x9279e813, 0xb7f47f15, 0x855cda17, 0x86c124b3, 0xdb3985be, 0x4740728a, 0x40f0e789,
+    0xeb6f05ad, 0x7d68ed06, 0xad4125d1, 0x259a0e6f, 0xc8e5bc5c, 0xc037e4f5, 0x63ebc7c5, 0x3c1f1065, 0x8d5d3aba,
+    0xfac46b18, 0x8ff9c038, 0x44d5c2da, 0x03c53bc1, 0x960783da, 0x18cf397d, 0xd3e1c7d8, 0x4c4ac355, 0xfe5239a5,
+    0x1a91fa85, 0xe1678209, 0xd798774b, 0x1e5e3220, 0x9d73d44e, 0x82f6904a, 0x3f3e6cba, 0xbdde1f53, 0x4bc88b73,
+    0x623dc6ee, 0x5577dece, 0xe8cb706a, 0xa537789e, 0xaf65fa9a, 0x786a2738, 0xfb422ff2, 0xfd41a97f, 0x6e8ed23a,
+    0x1685fbfa, 0x0a5b604d, 0xa8ffde36, 0x373e25c4, 0xef5cfe20, 0x03e00cdb, 0x2d2cfd9c, 0x14a615af, 0xf06c3ffc,
+    0xa4849beb, 0xdd75b433, 0x0718fda7, 0xec144cdd, 0x5177f26d, 0x43d4095e, 0xae484034, 0xcb0a8eb5, 0x71e75a24,
+    0xdbe7f514, 0x14e1ee03, 0xaaa72b6c, 0x6c934b52, 0x75b13b44, 0x9e0f847b, 0x280ced78, 0x94106bcf, 0x7e99f91a,
+    0x0f557c79, 0xab4e34b5, 0x7e648da8, 0xe3e54ad3, 0x735a5353, 0x6cdc7a11, 0xfbfe2642, 0x65c91a4b, 0x8d52078e,
+    0xfae7de6c, 0x4c3aa447, 0x39a6ba9f, 0x7bc4cc78, 0x475a2368, 0xa45ab650, 0xdc5a2ac8, 0x4447d5f4, 0x65ce83b3,
+    0x04bb8404, 0x858a9a94, 0x56889b74, 0x57c97ff2, 0x8f45d7b0, 0xda3cd4bb, 0x333a3019, 0x7d69c37a, 0x0ae5a076,
+    0xdc6c66ad, 0x5f1f6075, 0x4599d47d, 0x591ac6f2, 0x77c2d975, 0xd71d9530, 0x6126a900, 0xa33ceae5, 0x0c04b3e6,
+    0x4f83e793, 0x73e8edb1, 0x90183c7f, 0x27521fc2, 0x52d30fd0, 0x3127dc78, 0xd0558701, 0xb21bb131, 0x8e58a9e3,
+    0xd912eae2, 0xc2799536, 0x17931a9b, 0xf62b07c8, 0x256e4a14, 0xd6d2b1b8, 0x8061be6a, 0x0e987522, 0xcafb193c,
+    0xe28c59c6, 0x9cfe3eae, 0xcecd8603, 0xc667b011, 0xcbd2e50f, 0xfcded331, 0x269ed023, 0xaf8bd07c, 0x4f1f0ab4,
+    0x400c45a7, 0xd1c90b5c, 0xdb045638, 0x3ec43730, 0x1c838aad, 0xaa4255c5, 0x4b51b050, 0x45b261b7, 0xb28c2d80,
+    0xc0386076, 0x5e5577c7, 0x46e15059, 0x87f3b45d, 0xcbd6ba8f, 0x740d7c4a, 0xa805cfd5, 0xf7ad4c1d, 0x5eb4f493,
+    0x4391fa86, 0x25b9ca59, 0xfb39b4ed, 0xbdd1cf8d, 0x3cfb1e57, 0x9c4a344f, 0xd7d647c9, 0x9ad7e9e6, 0x9d056256,
+    0xdec58a55, 0x64bf0990, 0xc2fd8d97, 0x38f83a37, 0xec961cf6, 0xbd092ef7, 0x2fc91a46, 0xf0d04c8d, 0x4a17e934,
+    0xf9a50bbb, 0x4bb94a62, 0xeb323048, 0x81e65efb, 0x23539c21, 0x6c05f781, 0xbabec616, 0x30f6f4ea, 0x10e7a96f,
+    0xbec22447, 0x9c28850e, 0x4c848a84, 0x3f177aa3, 0x57c82db4, 0x248a462b, 0x1ca1315d, 0x61236fdb, 0xf3ac1e30,
+    0x9810c426, 0x1a51bc06, 0xfbf0eecb, 0x55b0f0b1, 0x54fd920d, 0x9b0a548a, 0xb5827037, 0xe27bcb72, 0x59846781,
+    0x3fe858bb, 0x1840ef6b, 0x3ab44033, 0xa0273c5a, 0x8075d15b, 0xf37d3852, 0x3e1e96bb, 0x9ccc81a2, 0x26d3be54,
+    0x1136ff68, 0x8b90f896, 0xa93a3cb5, 0x2960267f, 0x4411a157, 0x1c2ba91c, 0xa50fe35b, 0xdc18fb1c, 0x442d4485,
+    0x348b7929, 0x0c59a19a, 0x628c02dd, 0x90330e9c, 0xf188b2a3, 0xf6cc59cf, 0x25b4d2f7, 0x03cdfa63, 0xcfd0484c,
+    0x082af00e, 0x97ac760a, 0xd6059fe1, 0xc283922a, 0xd9fc5b0b, 0xbf283198, 0x59c163c7, 0xf5be0a10, 0x8efd4711,
+    0xffd178c6, 0x3595a7a0, 0xbab8f958, 0x9c59df81, 0xd9ffe9bf, 0x0c8f69a9, 0x6251b9b6, 0xf21dc327, 0xa8c2c59e,
+    0x82420295, 0xb58760a9, 0x87196ee5, 0xc6744122, 0xc53d0a22, 0x0296663a, 0x9d9945cf, 0x6fa4d805, 0x9ce13b9a,
+    0x1b233469, 0x94020db3, 0x7b1ac19c, 0xf19868e1, 0x2024767a, 0x42934658, 0x70a467cc, 0xd92a8ea4, 0x00c3155e,
+    0xbbe3971e, 0x8c543236, 0xc8d6d2ee, 0x4ba37e81, 0xea5225a1, 0x0ea28b6b, 0x26239590, 0x67caecc4, 0x90318a61,
+    0x7e3d19b0, 0x954b20fc, 0xca3fb960, 0x933f5e21, 0x6c78a99f, 0x7fc54bc0, 0xa4b3217d, 0xac6ee380, 0x08078dbc,
+    0x8f0408b4, 0xee4c224a, 0xd84a088c, 0xc5091213, 0xd5c3aeaa, 0xe2080ebc, 0xfb852746, 0x247714bd, 0x9556881c,
+    0x9f633816, 0x8c090629, 0x5b16160a, 0xd2fd49d4, 0xa4dc9f57, 0xe39e557f, 0xed681532, 0x89a3955f, 0x68ebd3fb,
+    0x5667ee8e, 0x9fd27843, 0x3168a5cf, 0x23014cfa, 0x5aba5a9f, 0x24f3f2d1, 0xfb7360cb, 0x0a0bd0e3, 0xb729aede,
+    0xf867aa45, 0x768f6171, 0xc11e3554, 0x302bc103, 0xadd23e22, 0xc6266f45, 0x3eb4f9dc, 0xc0ca3d93, 0x06d097e5,
+    0xbf4dca67, 0x161f8d38, 0xc7fcce75, 0xae09ac66, 0x6158042f, 0xc97a1db3, 0x8978690c, 0x1bb546e1, 0x098d65f3,
+    0x99c20d34, 0x3b25279a, 0xd7e99aa7, 0x704a1a18, 0xad3de7a5, 0x4e6a3ea1, 0x787bbc2d, 0x77cbaabb, 0x2445743d,
+    0x620dd590, 0xd72595a4, 0x62843cd1, 0x66a048fc, 0x23410233, 0x67c82c73, 0x5335bc46, 0x4607f656, 0x7283c057,
+    0x5add7652, 0xd85b8cf0, 0x027f8409, 0x9064e431, 0x69c00046, 0xdaff9698, 0x04ec143a, 0xea1b700f, 0x02945d7a,
+    0x5f684012, 0x65ffee07, 0xb19e2126, 0xc7a2c3fb, 0x48048724, 0x37e9b17b, 0x0b217521, 0x3d4bab2a, 0x2be41d38,
+    0xf0bb3a75, 0x9dd3e0a0, 0xcfbaa379, 0xaa95af15, 0x7a25dd94, 0x622f80ee, 0xb42b52b9, 0xcf99d2d3, 0x21f274f8,
+    0xe53765e1, 0xd189258a, 0xe0c9692a, 0xc14fa3ec, 0xe2409df3, 0xbfbcfb9f, 0x5c0397a1, 0xf8688c8d, 0x5d9f8c64,
+    0xec292316, 0xd33f844c, 0x3fda5e01, 0x8c1e2344, 0xc85414a5, 0xbbc4cee3, 0x3aa9c1c1, 0x64565b8f, 0x70382bad,
+    0xd32503bf, 0xa2bc219e, 0x85e4050d, 0x01b792c1, 0xd62a5cd3, 0x3c18fe92, 0xab5b80cc, 0x753807b0, 0xafadf4ec,
+    0x9d101c06, 0x49fea00d, 0x6fd0933f, 0xbbebe1a7, 0xa4c9e698, 0xff0ef32a, 0x142ee200, 0x870b721b, 0xa4400480,
+    0x098c7df4, 0x3b3915db, 0x389ffaf7, 0xd5340132, 0xa53c765c, 0xfedbea88, 0x17234a63, 0xde3c1112, 0x189e5806,
+    0x62abaf0c, 0xf70aad32, 0x330e57fb, 0x3889c13b, 0x9eb4aefa, 0x9ba28036, 0x0ff7a80f, 0xee150836, 0xfee6d862,
+    0x7295431d, 0x90e6e6fb, 0x94573ab3, 0x9fe3a11b, 0xccfb96e8, 0xcc550846, 0x5e094e05, 0x34cdc8d7, 0x92b90bb5,
+    0x329c61b2, 0xa898739f, 0x379a4ee5, 0x1fbcf0ac, 0x63026fcb, 0xdbe8b5e9, 0xd27e7c9f, 0x0926315f, 0x4a3e0063,
+    0x0735ccd5, 0x40025d7b, 0x12c1d995, 0x0e2f72a9, 0x15933160, 0xb8ac588b, 0x021f9599, 0xf7ac1226, 0x325442c5,
+    0x1e1d0be9, 0x50c1fbef, 0x7f6d605a, 0x343b8cc0, 0x67da1748, 0x44b234ff, 0x8e5a77e1, 0xe521bbb9, 0x61cc8ea2,
+    0x54471662, 0xfe9ac88c, 0x753c6c14, 0x6ba3d5ed, 0x88b59522, 0x8c11c839, 0xc11b614f, 0x08c7cf32, 0x29e1e598,
+    0x10294a6e, 0xbd7d2738, 0x6a73b484, 0xe63935b6, 0xa27e740c, 0x9140959f, 0xa263b99e, 0x8e748116, 0x379d7f2e,
+    0x7402b3bf, 0x30d5d4f2, 0x3cae635f, 0xc8a31d7e, 0x088f8d18, 0x202adb61, 0x63e24a5a, 0xd83896b5, 0xd084ef7a,
+    0x55030d3d, 0x2fc93c92, 0x677bb479, 0x1128aca2, 0x3fcaba1c, 0x3288c51f, 0xb999d883, 0xd052f105, 0x02836332,
+    0x5e93f8c9, 0x7eee5fbc, 0x487f76cf, 0x41b1a95c, 0x4a866e4b, 0xb7a852e5, 0x4dfa817b, 0x99801335, 0x33fbebe0,
+    0xcc0ee79e, 0xc749bebf, 0xd3a8e8f6, 0x14349fb0, 0x3066a77b, 0x736f1b6e, 0x189b0d72, 0xdd5efa9d, 0xc09bf6f2,
+    0x952f7e61, 0x636f1009, 0x0396b09a, 0x8f0f4a82, 0x61abf725, 0x63897d11, 0xcf4f336b, 0x911a1e75, 0x83ca16e1,
+    0x4325b574, 0xda6641cc, 0xb456a8e2, 0xbe79bf0d, 0xc501396c, 0x63295f8f, 0x9e83dc31, 0xf77ee5ee, 0x6b5c38e3,
+    0x6281f82a, 0x6717b128, 0xcc662e7e, 0x61cbdcce, 0xeeb95b18, 0x7d3a9553, 0x12b29dce, 0x6dd7f5ae, 0x624445f0,
+    0x315a958d, 0x26bf71e3, 0x72444b7a, 0xd0eba998, 0xb5759ac5, 0xae3c1461, 0xb1d23f2b, 0x74f1300f, 0x0dbcad96,
+    0x46ed1445, 0xc83fc54b, 0x342faa53, 0xf2adb6bc, 0xad15f2f8, 0x01a91fc8, 0xedc6aa07, 0x2a9c08a2, 0xc2f945c3,
+    0xe7da5414, 0x24628472, 0xfb3056ea, 0x2b6b8834, 0xbbf3e5fb, 0x328890b0, 0xd5da687e, 0x1edc0f9e, 0x22a75f16,
+    0xa6599f62, 0xcfe11d45, 0x9460acf0, 0xca441b36, 0xa26b8505, 0xefe25820, 0x6ed5a02e, 0x4aa87e91, 0x931557cb,
+    0xa5471103, 0xe841af0b, 0x694ca128, 0x195ed6c5, 0xa99c7b21, 0xdc370556, 0x8a7c8fa0, 0x87230b2d, 0x69ba54f8,
+    0xbac9e66c, 0xd7577bb0, 0x8e4926fe, 0xe90db182, 0x04b9c183, 0x5aa145dc, 0x62c24dc4, 0xb0b5ed69, 0xe399948f,
+    0xc0f4d80d, 0x6bc111b0, 0xf7e3a0d3, 0xd0a83a90, 0xfcd979eb, 0x3e0a6e9f, 0x70943119, 0x0b7117b9, 0x540c6cc4,
+    0xfb374807, 0x5f73ff80, 0x8c4992f0, 0x7bc7f04a, 0x2bdbb3a7, 0x6dd862fb, 0xf52d7b02, 0x94ebff6e, 0x55517499,
+    0xb9fe9623, 0x99d018db, 0xd74baa87, 0xf0b6842e, 0x18442022, 0x1c4701f4, 0x13c994ff, 0x395ad821, 0x377f2d75,
+    0x9a69f7eb, 0xde60a686, 0x16741e24, 0x27517ee4, 0x5f8a5e63, 0xcd1cfadb, 0xf2189118, 0x036ea2f0, 0x307955fb,
+    0xd158cf09, 0xb007596c, 0xacb9e24b, 0xfc3899d7, 0x79e4ca63, 0x94d058ae, 0x569c9ff6, 0xf311c0dd, 0xcd371f80,
+    0xa617e71f, 0x75d87580, 0x66b258f1, 0x6d385ad8, 0xa17d1a44, 0x4b98ed8a, 0x51345c15, 0x4454b6d3, 0x592c950d,
+    0xd77cf193, 0x258669b9, 0x8b5c4eef, 0xc8c4fddf, 0xccccaaf4, 0xccad5658, 0x433a7504, 0xe62d4f52, 0x9513192a,
+    0x57b2da88, 0x3500d8da, 0x92cd4029, 0xa45390f0, 0x1815c47a, 0x32d11f15, 0x3dc28bb7, 0xf965c9bf, 0xc809e073,
+    0xd6c56abb, 0xbc90c665, 0xc4c9101f, 0x2ece01b3, 0xb65b4832, 0x96247fa4, 0x1b297a5a, 0x8f30e28c, 0x53f63449,
+    0x6bf7eaef, 0x51f58e68, 0xf2db59db, 0x32cecd4b, 0x423b9a82, 0xb45085b8, 0x4d4708eb, 0x6d6abe88, 0xef2b3020,
+    0xf19f7322, 0x2f89857e, 0xc8411a04, 0x39962455, 0xfc4859fa, 0xc9173d62, 0xc74f32b0, 0xc75f7196, 0xfc73a246,
+    0xf49ed685, 0x75153163, 0x5f822240, 0xf6bec6d3, 0x094c8ff0, 0xfe93341f, 0xc17d1f8a, 0x8e6782ca, 0x3f487af3,
+    0xca7a84a7, 0x9f8e9810, 0x741f319d, 0x70c91f06, 0xa4904cab, 0x2a0d347f, 0x48e4ae9a, 0xa407594d, 0x8ff66327,
+    0x57c604be, 0xe68fc29a, 0x68aaa828, 0xdbd2cf93, 0x0f82e53e, 0x2bf89b7d, 0xca761c1a, 0xdec7e668, 0x93649115,
+    0x8caa307a, 0x0d6bc6ca, 0x26fd8576, 0x878f9183, 0xac9befd1, 0x45075d82, 0xe9788e78, 0xb4686e6d, 0x6ba070bb,
+    0x14459589, 0xbd1c495d, 0xad43f8f9, 0x2d2071f5, 0x1c4750f6, 0x2dae6fd4, 0x18e5b4d0, 0x4491a06a, 0xa3c3f70e,
+    0xe1d94c0f, 0x630c8fa5, 0xa097c779, 0xd571db8f, 0x8a280a9b, 0xc0b6f5a9, 0x657c97ca, 0xf1ae9efd, 0xeae16c8f,
+    0xbe51e7c8, 0xed449176, 0xfc83d917, 0xd5b38930, 0x711d2f81, 0x1ec38ee8, 0x1eb0ac72, 0xfe5a3f7d, 0xf3cbf763,
+    0x386b3aa3, 0x7f26a290, 0xe3cd87c8, 0x2af2c1b5, 0x3b9969f9, 0x793c1859, 0x520b6ea5, 0x80c8f683, 0x3331a85e,
+    0x95748a52, 0x39e7280d, 0x2de76e73, 0x8884c3ad, 0x0a28b57c, 0x9368ca33, 0xa222cf4a, 0x2da9e8ff, 0xb8f0efc5,
+    0x056fbfeb, 0x11f14c3b, 0x504943b9, 0x2375ed81, 0x94826cc8, 0xa954e67a, 0xd6475f15, 0x2e035444, 0x10ba6075,
+    0x65938c26, 0x78b794fb, 0xc7447b20, 0x12554050, 0x6d9b7950, 0x92e80de3, 0xab96cf8e, 0x9a064f4e, 0x6ab91c89,
+    0x102ee080, 0x562b0620, 0x34c3ba9d, 0x8e6d3373, 0xfd97755e, 0x6346c8a8, 0xa8138aee, 0xc32441f8, 0xb76932e5,
+    0x154c90f3, 0x76cdf9e0, 0x7ab8ce3e, 0x325c6072, 0xecfb56f2, 0x90e63083, 0x82186945, 0x5a5cda6c, 0xe3c65f06,
+    0x8e3ba7c8, 0x671a62e9, 0xec3e382b, 0x92cb705a, 0x4d789959, 0x68e78eff, 0x6bc093e5, 0x08c4846a, 0x2c2b5e03,
+    0x9dacfa53, 0x0add20bb, 0x4d29a1aa, 0xbcbf3fd5, 0xb5e557b1, 0x57ef7c7f, 0xb7567ef9, 0x84ff5798, 0x183e918b,
+    0xc6d7e497, 0x918765a2, 0xf617f4bf, 0x23cdb3a8, 0x5bd88eb7, 0x1e17ab2e, 0x73b330bd, 0x0167eadb, 0x8da6df9a,
+    0x8ef4b1d3, 0x7cd6665f, 0x532268fe, 0xb9b56dd7, 0x720e0f07, 0x04c3ad91, 0x7cac02dc, 0xeaea3858, 0x5a9f7a96,
+    0xe072ca9b, 0x0a2c9ff1, 0x0f9bd724, 0x6000c438, 0x9026b2a7, 0x48db8322, 0x74dae37a, 0xeaddab7e, 0x227bbd65,
+    0x2e2e6ae6, 0x8f5e484f, 0xc21b2b66, 0x6a2a9ffd, 0x47cd4594, 0xf8e028f3, 0x0a55c96f, 0x95dbe989, 0xcebfacd2,
+    0x599fdeb8, 0xde54b35f, 0xce796284, 0x1271c28e, 0xf2b733eb, 0xf2d8d191, 0xfe463583, 0x96990b39, 0x564283d3,
+    0xbc4c5a58, 0x5cee1967, 0x4aaa826b, 0xc4366afb, 0x301b00f3, 0xe81993b4, 0xa8692f42, 0x3bf02042, 0xdadaa715,
+    0x7dab77d2, 0xa8c38abe, 0x40035ce0, 0x18539f4f, 0xe88d7c9f, 0xfdac8d17, 0x2204e2c7, 0xfc05e7af, 0xf3696fd3,
+    0xaa7deec2, 0x0b05f1fb, 0xdbf88eeb, 0xd087881d, 0x36778aa6, 0x1eb4cba2, 0x4a688afd, 0xe6b802fe, 0xcf5e9aa7,
+    0x6e1029cb, 0x4e3408f3, 0x9405d31a, 0xd01a404a, 0xcb4cac9e, 0xe2fd0314, 0x5580416a, 0x50bb9f1b, 0x34af3bdf,
+    0xf971fe76, 0xf56226a7, 0x11b5bb08, 0xfeee8a90, 0xbc427acc, 0xe64d4b12, 0xcb99e1ea, 0x93909794, 0xba123982,
+    0x40ae734b, 0x5bbe23d9, 0x61d41ac2, 0xfbb3aa05, 0xa05456eb, 0xff8542e6, 0x5a307e00, 0xde6b7c86, 0x23d048a6,
+    0x2b7712c2, 0xf32a028a, 0xd0988883, 0xc591fe74, 0xe20b1def, 0x1c8c5543, 0xdfe6d64c, 0x1d77d543, 0x768a4915,
+    0xf6e56219, 0x19f1ac3f, 0x6e72b98e, 0xa9cbf590, 0x4a659796, 0x7608d51d, 0x8c11ccae, 0xb2cf92c9, 0x013e6275,
+    0xa55446d3, 0x899f7dd9, 0xf49840c9, 0x692f33a5, 0x48f90bfb, 0x1700d192, 0xe9de2480, 0x6e1ec056, 0x750bcb7b,
+    0xbc7cd627, 0x8c076a0d, 0x11d960b7, 0x107fd3b1, 0xbac557a9, 0x76ff77ed, 0x430b03b9, 0xbe48e251, 0x2e716769,
+    0x4b1599c8, 0x1edf7f81, 0x11715e3b, 0xeecffd47, 0x4c072df2, 0x647d7752, 0xe0dae3f4, 0x58b09a6c, 0x3afcdad5,
+    0x333110c6, 0x6c308c79, 0x887a80a2, 0x8bb5f8bc, 0xe6398176, 0xf0568384, 0x2da033f2, 0xdb23b972, 0xe86cb78b,
+    0xd5bc364a, 0x94bce76f, 0x3d8dff1b, 0x1701086d, 0x2596f735, 0x909c8f51, 0xe98d031e, 0x26b3caa8, 0xfd294670,
+    0xdf16347b, 0x843765e1, 0x00eaba9d, 0xc2a5b53d, 0x28384080, 0x2bd84b79, 0x314cba67, 0xd387f209, 0xa8329215,
+    0x5a2eeefb, 0xb383d0e6, 0xcbbada1c, 0x0c84bdea, 0x1a266797, 0x5b0b77d8, 0xb12d6067, 0x442a7be9, 0x358252a3,
+    0xc9d8df10, 0x18f5dd58, 0xfcb3e57c, 0x765e8c1e, 0x971a5e4c, 0xbc7143a6, 0x3323fee1, 0x8defd517, 0x0f67d3f6,
+    0x4730f8e0, 0x8f3ae035, 0xc4d17c6d, 0x9479a23a, 0x520ffb99, 0x11d81a2e, 0x5d87d8ba, 0x9d1faa01, 0x17695f8d,
+    0x7248c630, 0x51f94f61, 0x36396aee, 0x9e1f60bf, 0x9664924b, 0x5a36899e, 0xaa3219e2, 0xfafe13f5, 0x9a74d156,
+    0xaf409779, 0x80ff2bff, 0xfc7a84f0, 0x0bfb9464, 0xacc7ab89, 0x05260b9a, 0xad77212a, 0x8f0fa649, 0x377ec7ff,
+    0x07f52238, 0x7580ce81, 0x4f327419, 0xaa3ec023, 0xffe0d8d9, 0xc91033ea, 0x58fce1e6, 0x597c17b2, 0xfaa59930,
+    0x00456477, 0x45af6f87, 0x373c9f23, 0x5ed5f8da, 0xba6d220c, 0x03ca30e9, 0x93690b47, 0x1ea70f3a, 0x2af1de8f,
+    0xabfeb79a, 0xc168c65b, 0x594f333c, 0xf1f3230d, 0x26c0603e, 0x38046836, 0x40b4911a, 0x9b983a2a, 0x0380c011,
+    0x3cdb0a11, 0xf59f56d7, 0xf715d490, 0x5f52b231, 0x52ce5b7f, 0x27e42e39, 0x331949d7, 0x6702f70c, 0x5a1351de,
+    0x9a674ded, 0x16641a9e, 0xc0d75e72, 0x637d2081, 0x65cf45c6, 0x8a09ddd8, 0x4fe6f3ae, 0x0dbce90f, 0x06916a1a,
+    0x80fd4f02, 0x4d63b7b4, 0xf4a18a23, 0x9198b7bf, 0x14771fdb, 0x4585c01c, 0xf162df58, 0xc82cb8bc, 0x7682b124,
+    0xb3658517, 0xb70a591f, 0xbd538ddc, 0x7a001cc5, 0x66a68cae, 0xd0f7c9d2, 0x90d9a6aa, 0x46d1e944, 0x3a4cb9fa,
+    0xc8d2c3b0, 0x9d2c57a5, 0x5e3ab324, 0x3de5170a, 0x6310ebb3, 0x7d83751c, 0x1fcbde5e, 0xe3ee4db8, 0xe48baba8,
+    0x5900d4a8, 0xa70ed6cc, 0x2a584045, 0x434b8bae, 0x4081f003, 0xf2619f38, 0xc4a04245, 0xcd7f9808, 0xdc6808a5,
+    0x071e3fe6, 0x25b32431, 0xf80c77e5, 0xd2e8c0c9, 0xfd1f1533, 0x65edab98, 0xee174847, 0x93c13804, 0x388a5162,
+    0xbab01f13, 0x753080f1, 0xae87515a, 0xc3378d00, 0x6c47fcf9, 0x1f9bf68d, 0xfce3284c, 0x67426631, 0xb9c2c4ca,
+    0x8f5a3ceb, 0x6e0a8276, 0xf9550d67, 0x8da4828a, 0xa6939735, 0x956d959d, 0xb5b0fbb8, 0x9e4be54f, 0x2c88c89d,
+    0x0a65ffb3, 0x2f233283, 0xb3a84460, 0x0319d8d6, 0xcf1658ac, 0xd0fa0221, 0xc7ee183a, 0x001adfa3, 0x0e47fa3e,
+    0x3db678d6, 0xde70385a, 0xd05851ff, 0x1f035297, 0xc2ba57f3, 0x1d59a68a, 0x30bc610e, 0xea2d4751, 0x9b88e703,
+    0xc691cf42, 0x3b828e48, 0xb11037a4, 0x5c01b661, 0xbf6a1189, 0xf47d63fd, 0x991edece, 0xc001730d, 0xb39ec914,
+    0x3cb81991, 0x753b2b20, 0x46211fff, 0x1960cd3f, 0xa582cfe9, 0x005fbe7d, 0xf139d720, 0x41bb2224, 0xcbc99544,
+    0xeefdf192, 0x1fd88370, 0xda86e95c, 0xc57c7134, 0xfcf7a0f4, 0x57471dfa, 0xb0329da7, 0x46df1a08, 0x9f190628,
+    0x5c5404d6, 0xe93800d1, 0x489366ba, 0x1b0119ee, 0xac3aa890, 0xf1cc2769, 0x1ab385b3, 0x79cf97fe, 0xf295fbc7,
+    0xf73ef905, 0x738e3498, 0x64b3a4c5, 0x0e9079a8, 0x678f2a4f, 0x1c19304f, 0xddb8b47f, 0xab9078f8, 0xeff255c9,
+    0xcab221f8, 0x475db474, 0x0c22515f, 0x04fac60f, 0x655ae99a, 0xb0c54f39, 0x19559a40, 0x123801ab, 0x2db10005,
+    0x70740a5e, 0x23eb1656, 0x660cea65, 0xabf030c7, 0xfdfcf06e, 0xe1dbf1ff, 0x0c411127, 0xa0c38a1d, 0xda8b216e,
+    0x155f0b6b, 0x3712fc8d, 0x7107dc26, 0x95343175, 0x357ba697, 0xb20728c6, 0x697d4a2f, 0x0d81cb36, 0x0af9085e,
+    0x0fc4820f, 0x9800b170, 0x1cf62d18, 0x3eaa6bd5, 0x135e9e9e, 0x6a037397, 0xd3603d36, 0x82e592ba, 0xf873031b,
+    0x47ab0900, 0x6cfcb82f, 0xd794a50b, 0xf60d2b8d, 0x6a0b8bc1, 0xfc25ef89, 0x56ec1805, 0x4d0c5283, 0x09ee59dc,
+    0x0fff9976, 0xf0597375, 0x26edcbb3, 0x3c3a7f43, 0xcc435b11, 0x0fa4854a, 0x194a7650, 0x17ef8d92, 0x3ccd540d,
+    0x65b7bd75, 0x8765cd06, 0x8e932cd8, 0xc857814a, 0x96b15fd4, 0x0b4322f1, 0xe5260a07, 0x2f82455c, 0x031b704f,
+    0xaf84ba03, 0xe0af90ca, 0xcc3aa04a, 0xed00d223, 0x3a17da1e, 0x37ea3b72, 0x11effaed, 0x6ce92099, 0x676a1675,
+    0xf15ec8a6, 0x66a7e073, 0x1e734101, 0xe5f56e53, 0xe3530441, 0x0ce32496, 0xbecd6fd4, 0xf0f1a675, 0x7bb66d85,
+    0x67f18f11, 0x71d7faee, 0xc52621db, 0x63b484b5, 0x1c37f777, 0x0057f1af, 0x13899fb2, 0x848a6cb4, 0xc212cd14,
+    0x6a6006e8, 0x70685088, 0x644813f8, 0x1def816e, 0x9f3a1e00, 0xfca537cd, 0x639ae709, 0x74263507, 0x2e413cbc,
+    0x6ca4d727, 0x0a675e2f, 0xebae288e, 0xa57fd8de, 0xa66ad125, 0x47f69fe5, 0x893eaa65, 0xeca84a9f, 0x6eedf862,
+    0xc83128d9, 0xf097bc9e, 0xd64f58eb, 0xe8600894, 0xe6704d78, 0xb7c7d777, 0x7dff817b, 0xe2ef1cd3, 0xe370f344,
+    0xc182b30f, 0x89d92a47, 0x87065e95, 0x8a464f19, 0x99641eac, 0xa3020d63, 0xc5abad07, 0x14f1c174, 0xdb0a1244,
+    0xaacdb4df, 0x807aaf6a, 0x9842d2b3, 0xbfe6919c, 0x1a8eeceb, 0x40af95ff, 0xe07b8034, 0x2c9b6293, 0xe528ae37,
+    0xf7ebc937, 0x9344b41e, 0x7ce74f07, 0xfb02d090, 0x6ceb947b, 0xddaa2a5b, 0xf1541227, 0x7cd6456f, 0x39fca94b,
+    0x3a204fe1, 0x58321d62, 0x891855c5, 0xa21aa6fd, 0x9e80c9fa, 0xe6fac70c, 0x48bc50ec, 0x50c341c2, 0x8d280f64,
+    0x5e5af273, 0x3764d500, 0xbce5cd85, 0x058c268e, 0x60d60556, 0x1360e75a, 0xab220627, 0x2b3778ae, 0x420c320d,
+    0x479df501, 0x664f4d3a, 0xbfcee56e, 0x44a4476f, 0xcb08c2d4, 0x82a9481b, 0x7b6b791c, 0xf748277a, 0x6a967a94,
+    0xe594fb87, 0x9fc34e06, 0xc7dcf6cf, 0xc4cc845e, 0x29d49912, 0x715da411, 0xcb294b37, 0xd1782d3d, 0x54f31394,
+    0x7462c2b5, 0xa775f367, 0x34b3cdcf, 0xcb1abe16, 0xf0c66c9b, 0xc2f1af38, 0x7c2ced68, 0x92613e14, 0xc62b3f5b,
+    0x171433b6, 0xeb4c97c3, 0x2b268f08, 0xc4b522c1, 0xacc6d2f7, 0xf3d7f39b, 0x207f8112, 0xee08eba0, 0xfbc8978b,
+    0x799e9812, 0x2057f4de, 0x506b30ce, 0x16c2cea2, 0xbbb9551d, 0xfbcacd18, 0x497f87fe, 0xa79a154b, 0x9e481052,
+    0xe76de995, 0xd6fa949d, 0x7c7fbaf8, 0x280d244c, 0x10fe5fa0, 0x3fa34cc4, 0xd4078076, 0x30536170, 0xe3a4b6c4,
+    0xb9f6aae7, 0xd20afced, 0x6ff19730, 0xea2ace7c, 0x6ce0ab82, 0x9bda9a88, 0xce8d83df, 0xcd4eedad, 0x164ae8ea,
+    0x1bc4eaf2, 0x9b382840, 0xf49780d9, 0x0263461a, 0xc9dce1b0, 0xef92578c, 0x7436cc64, 0x04a0b73e, 0xea02f343,
+    0x388367c3, 0x44c753f4, 0xda34a0f6, 0x70712101, 0x5d94b5f1, 0xfac7e7df, 0x301cc700, 0x336b022d, 0x8d1bcf97,
+    0x8dcaa5bb, 0x0423b7e5, 0xf35e3049, 0x3dfc2aa5, 0xb000a261, 0x92249253, 0x5982eb4c, 0x371da55a, 0x5c0bc5ef,
+    0xb025c0e3, 0x0442298a, 0x142ffa0c, 0x0521b27d, 0x05e5a0a1, 0x2f280d30, 0xe751b264, 0x9eb1b6ed, 0x20de2001,
+    0xededde11, 0xa9bd721e, 0x3258d8e8, 0x15c4e7fa, 0xc66f07f1, 0x9e5722fa, 0x8ad2664d, 0x04e81f8c, 0x56404c3c,
+    0xd935678f, 0x30c5c2a5, 0xa2f0cb53, 0x59942fd5, 0x8c6b7097, 0x63460f26, 0x52cc7b34, 0x30ad705f, 0x5a972f1d,
+    0x6c7d0d2c, 0x8bf531a1, 0xd1ac38f7, 0x58d0b6ff, 0x48e4543b, 0xcbc4e385, 0x64044e19, 0xcf0aafc8, 0x58205bd7,
+    0xb7574ed9, 0x78f4d0bf, 0xe71585a6, 0x2f5351cd, 0x8408abc5, 0x1ed33e0b, 0x57cd2350, 0xf73d0224, 0xe63893f6,
+    0x9efd3e8f, 0x8a350a01, 0x9e4b2d1d, 0x043d4fa2, 0x0bb4bfea, 0xd978ab06, 0x6c689226, 0x1eccc38b, 0x2f0a6715,
+    0x419ea461, 0xe8cf4ca2, 0x63e28257, 0x61628c81, 0xc8ab9b1b, 0xe5636a62, 0xc5fc866a, 0x38a59f76, 0x8bfd1cf7,
+    0x54e6dfbc, 0x61132267, 0x77838f2f, 0x8c36aefa, 0x42b04f10, 0xf901f42c, 0x27cc3015, 0xf94802c5, 0xa379f348,
+    0x550ad60e, 0x5c6191fd, 0xd08f2062, 0xf9eab1b8, 0xb34ba9d5, 0x818879f9, 0x467df52e, 0x1a22cb25, 0xc67b4583,
+    0x668d59f1, 0x719208c3, 0x0549053d, 0x0e96399e, 0xd8e41d97, 0x084193df, 0xadd756ce, 0x75b35391, 0xe717e388,
+    0x422e9bcf, 0xb857a5e4, 0xaf0cf8b3, 0x94e1322d, 0xb2fbdfe6, 0x1da6269c, 0x3ad63ea3, 0x410aec4c, 0x4041c1ab,
+    0x97fa0e98, 0x11edd1c4, 0xeb9299a1, 0x9c3a915e, 0x62f88423, 0xcd71106d, 0x5d81656b, 0xbc94fff9, 0x7751b11d,
+    0xc18167b8, 0x3a854188, 0xc8b4025e, 0xbfa76302, 0xde856cc8, 0x4ba5cf20, 0xcddb16c2, 0xcc28de41, 0xfb597ed0,
+    0x1cbbd4d0, 0xbe765cc6, 0x6c9af75a, 0xc868afff, 0xa367eed0, 0xb15acbfd, 0xb2d4c7d3, 0x041167f3, 0x16c3238f,
+    0x67dabbee, 0x7cabc552, 0x91eec147, 0x1e8cd463, 0x0feb78a4, 0x1349812f, 0x0a3e03ff, 0xe31c1b9d, 0x9167114e,
+    0xc8d4d790, 0xf76599da, 0xc42bca55, 0x8a18b72e, 0x5cc13e0a, 0x952b9fd6, 0x78edbe27, 0x9812ef41, 0xaf4472f1,
+    0x961346df, 0x56af57a0, 0x3bd7a394, 0x980fa871, 0xcffcfa7f, 0xf4a45766, 0xc28c2c07, 0x454cd315, 0x9d44caa7,
+    0x1498290b, 0x8cb9b593, 0x1d63f5b7, 0xeab47011, 0xe433c8ca, 0x3bb0f9f8, 0x74d8565a, 0xc5dcfbed, 0x70d79814,
+    0x859a9051, 0x1300ed50, 0x2b1fe07c, 0xdb5d7acf, 0xc4191f57, 0xfb65ca3e, 0x67aeb29e, 0x4fdc698b, 0x5c2bd70d,
+    0x91acea68, 0x856a0708, 0x27347695, 0xd65014b2, 0x8b02d613, 0x627987a6, 0x6923dd19, 0xf6fb3a1d, 0x429b3962,
+    0xd0828fd3, 0xf42ac10a, 0x2262459b, 0xc1a66b48, 0x2c158f1d, 0x46fcf1ce, 0xa571e597, 0xdfa0d66d, 0x765cb580,
+    0xa2b28671, 0x07e19525, 0x1e06ee5c, 0xb9372f4f, 0x2882b111, 0x4d4fdc11, 0xcc5fae44, 0x8a9bfc9e, 0x22d459b4,
+    0x5cf325ac, 0x2b1c4127, 0x6b71a547, 0xbb9747bc, 0xc2ce8dd5, 0xc8a2dfa3, 0xfe5408b6, 0x74b25d99, 0x157e4a78,
+    0x91122c70, 0x8bebb810, 0x6a33640e, 0x344a57a6, 0x6f5ed3bb, 0xc91e2927, 0xb8082290, 0x3a7be3d3, 0x32696940,
+    0x1aed439d, 0xc340f222, 0xc5e567b6, 0xa8720caa, 0x955258f5, 0xd6301a84, 0x29fe5f12, 0x3d4fb8a3, 0x0593cb58,
+    0x03d23ec5, 0xa9c67c66, 0x3359a029, 0xf2d32cae, 0x93375d50, 0xf48c730b, 0x6d7a4177, 0xdae4acd7, 0x1a189da5,
+    0x824bf6ea, 0xa2338689, 0xabe26b1f, 0x91ddd838, 0xf52811c4, 0x3ce4ceb4, 0x5ccbd81f, 0x8d0caa84, 0xce7e9812,
+    0x851d5f8a, 0x6fa2ecf1, 0xd94bf09a, 0x90407cd0, 0x410bdc67, 0xecb774cc, 0x2ee756f9, 0x957e0002, 0x6fc0ff64,
+    0x26e608b1, 0x0bacafb8, 0x51c88700, 0xfd2cdb04, 0x61513885, 0x90fd60c0, 0xf6e01dd3, 0x2a836721, 0xebd254ec,
+    0xf4336316, 0x8aa6bf52, 0xf24fa159, 0xc2932884, 0xcae94720, 0x8521f7d2, 0xcb485b49, 0x4fef10f4, 0xafeb494c,
+    0x9cdb5a7a, 0x72a6afa6, 0x64559bdc, 0xd8b40abe, 0x6ba1eaa3, 0x7687c31d, 0xd183a782, 0x05f702d9, 0xc1ca75c4,
+    0xe1c99828, 0x0c7bbe17, 0x6cbb6a78, 0x155d206b, 0x08f53a13, 0x2eefb04d, 0xa587d5fb, 0x8b53e57b, 0x7c59c773,
+    0x114ba2ae, 0x5104c0b8, 0x8055802b, 0x16fae0b4, 0x93351367, 0x62693da2, 0x9a2df05e, 0xbac9f93b, 0xcb12ebb5,
+    0x835d8451, 0xeb9603e1, 0xc424a781, 0x029659e3, 0x3e509c1c, 0xc1ccbcb7, 0xea19cbec, 0x806324ed, 0xdc12aadc,
+    0x517fcdb5, 0xacd5d5a7, 0x40fbdeb9, 0xb383f2e8, 0xc39dab25, 0x9dd17595, 0x1401bde8, 0x80c297fe, 0x5ac60158,
+    0x185216a1, 0x851cc2eb, 0x9c0eabb2, 0x6e6ae6e2, 0xd5d34f97, 0x2b601afb, 0x48d3e0b8, 0x826fa3ee, 0xadfd6715,
+    0x5730f4ae, 0x98811fa0, 0x69ab1e66, 0xda8dacb4, 0x26aa8ab0, 0x4b540428, 0x16c754de, 0x9c653aa1, 0x09d60462,
+    0xa6e9f22b, 0xb6bdba09, 0x9ef1792c, 0x7c165943, 0x98980691, 0xcc83aff9, 0xf842d891, 0x245a2e6f, 0xff1150e1,
+    0xc6c37ea0, 0xf24895d3, 0x7384574e, 0x5d2a1657, 0x38abcb8d, 0xcb7771d3, 0x4194da84, 0xf631633e, 0x3a06640b,
+    0x48802585, 0x481dcbad, 0x95bbb161, 0x83868e36, 0x6b7205c3, 0x1f87ca6a, 0x5af60683, 0x7bececf1, 0x7c6a2d7c,
+    0xdfcb2c97, 0x87b98e88, 0x5c9a1384, 0x7ed72c0b, 0xcaa1c12b, 0x6a172e59, 0x6a1de616, 0x1cdc00a0, 0x76b0c96b,
+    0xc3876f17, 0x88582aa8, 0x7677f03b, 0x8af9b1f2, 0x4b80c2b9, 0xb56dce03, 0x46f0bd99, 0x87efc0d7, 0x3b0521b8,
+    0x67039260, 0x19b91075, 0xc0c69b41, 0x60154bb9, 0xd38d40a4, 0xd02735b9, 0xd9507226, 0x0d4234e0, 0x0142009d,
+    0x99b13cee, 0x8cb988e4, 0x3efc6d2a, 0x576f683c, 0xea479083, 0x11565028, 0x16658651, 0xd7a6ff7c, 0x7c4fc0aa,
+    0x10407195, 0x758fe014, 0x31d1b484, 0xf73c2bd9, 0xfc387438, 0x9a3745bb, 0x3a5b5c30, 0x49d6beb7, 0x1b76da88,
+    0x119e1cf4, 0x32760646, 0xa53aa07e, 0xae45c525, 0xc08ffa4a, 0xc2fe38a0, 0x9b953919, 0x8781c655, 0x195b9bd3,
+    0x4562218d, 0xf4db5ad1, 0xc5881df3, 0x02d66c1c, 0xd091f55f, 0x34765f16, 0xe2962c87, 0x1f7081f2, 0xb7d25175,
+    0xeab480d9, 0x7d8947d1, 0x71be1c8d, 0x4ee949c9, 0x8b89c41d, 0x429509d8, 0xdfa5ed74, 0x8517b55b, 0x46b3a26f,
+    0xca7e0118, 0x27b6e18b, 0x31f473ff, 0xa491b4f7, 0x19d6cba7, 0x372a9e30, 0x787029fe, 0xc3e9a53e, 0x8f997780,
+    0xf6496a32, 0xc679b9fe, 0xdc0cf572, 0xef7f6fe4, 0xeb44ca57, 0x483f6b33, 0x4cb060af, 0xf663b266, 0x89b9c43c,
+    0x0a8f86eb, 0xc7eaffcd, 0x8effd67a, 0xbe858d68, 0x3687d466, 0x140c00ab, 0xf0c832ac, 0xe7e9ffb1, 0xafbe6329,
+    0x824de323, 0x8b614f9e, 0xa1fe85e0, 0xdfc57ec9, 0xb3362826, 0x76320f55, 0xe2180cd6, 0xecb02098, 0xed9de176,
+    0x4bdcfb14, 0xda8f3269, 0xc32c8580, 0xab2eb4cf, 0x3583d6f2, 0xb3e2320f, 0x04c3e91f, 0x5680b7a3, 0x11728093,
+    0xdeafaba3, 0xfb3fd38a, 0xa8027450, 0x6d3c4cce, 0xbb5b7e5e, 0x9e166d5b, 0xe297bbb2, 0xd2eba8fe, 0x18bcb06e,
+    0xf4d82fbc, 0x2724e72d, 0x08e8c539, 0x8db41824, 0x375acf7f, 0x5afd6135, 0x38fd7434, 0x988d0a66, 0x3d0f0adf,
+    0x3e8c39b6, 0xd2b3ea39, 0xa6c54eb5, 0xfe1b1df7, 0x7ea288ab, 0xeb705977, 0xcedce738, 0xd25bbbbb, 0xf187ce89,
+    0x4fbe0698, 0xcf9bab9a, 0xda4e9a20, 0x3f3b2072, 0x21245d1a, 0x9201565d, 0x25170922, 0xab61dfc4, 0xbf1f51dd,
+    0xe1deb0ea, 0x76982d33, 0x3fc5d318, 0x176ec98f, 0xbdf819f6, 0xe88dfa06, 0x32eb90f1, 0x0326c15b, 0xd58e1787,
+    0x7a47ce4e, 0x59eefb26, 0xc505a3cd, 0xf24395c7, 0x2688869d, 0x5a290fe6, 0x159efd72, 0x89c8fa82, 0x06016827,
+    0xd9aea6f0, 0x75ad61db, 0xddcc7370, 0xe3f514ae, 0xd5ba8db6, 0x2a14cce9, 0x96fe8add, 0x309a954b, 0xdd6d1825,
+    0x06906f9a, 0x83f5da71, 0xdff014ea, 0x50ae229d, 0xfa8ba6c6, 0x6ce5cccc, 0x4f994042, 0xa16e6bc2, 0x98068473,
+    0xe6250f7d, 0xbe278e70, 0xa597730e, 0x166ce4e6, 0xb3131edc, 0x9a5911bf, 0x644b428e, 0xf1b90fc1, 0x41aa07d9,
+    0x7b331442, 0x93070871, 0x0bec5a52, 0xf43927dd, 0xdea4a6c5, 0x89be16c8, 0x7c0f26d3, 0xcfd823a3, 0x0f681626,
+    0x42383adc, 0x844106c9, 0x716be68a, 0xa0006e95, 0x7c110949, 0x793edc95, 0xb3dd172f, 0xf80f5b9c, 0x39880e4d,
+    0xd312146c, 0x5a7146a7, 0x6860ba0c, 0xf2663be5, 0x3adfb3d7, 0xb1073ec3, 0x12328a78, 0xabbb1cff, 0x71b189ec,
+    0xaba00c15, 0xc0e83cca, 0x444506ff, 0x6cedae51, 0xf49ec6b4, 0xd0ecc4a4, 0x4feaf161, 0x84edbc08, 0x33f2fd68,
+    0x2ef19520, 0x8e84ecd3, 0x68625d43, 0xcc0b319b, 0x97cb72f2, 0x5f524fb7, 0x2e0bbee3, 0xf2fe57a1, 0x2a1c050e,
+    0x6b950ec4, 0x234db84a, 0x27734c1b, 0xe87719fa, 0x7a43c05a, 0x5ab5ec0c, 0x2b08d58f, 0x759d6f06, 0x917f140e,
+    0xf55ce503, 0x450f4813, 0x9d55d048, 0xae1e2001, 0xa4867a39, 0xc9f6dea4, 0xd195e039, 0x81dbcde7, 0x5de23ef7,
+    0x3b914ff7, 0x9bd61b73, 0xe8c7e2d3, 0xbe9eb304, 0x6a37c23b, 0xcb37ce6a, 0xe80676f7, 0xe0edf600, 0xd365a891,
+    0x6dc70318, 0x18fd6d45, 0xdd0d019a, 0x3fd7c82b, 0x0142bcc5, 0xdd2c1cdb, 0x79c45202, 0x53d949b7, 0xc588d8f8,
+    0x5428d0e8, 0x745e305f, 0xabfcdf13, 0x845fa961, 0x8b7827ed, 0xfd7f937f, 0x24f78cd9, 0x05602382, 0x5da673db,
+    0xe257bcdd, 0x7766c9b5, 0x3af3eb8c, 0x36f743a8, 0x56ceefc8, 0xc72cab5c, 0xa5f62f47, 0xe23db9aa, 0xe8a9216f,
+    0xe529d891, 0xcffc8973, 0x67a66e12, 0x3d8d62bd, 0x3f08a994, 0x188cc638, 0x2c5662df, 0xb78a336c, 0x72e73d4b,
+    0x97a97e7d, 0x9969720d, 0x6b8d5693, 0x0d3ee1e9, 0xdc410730, 0x15338312, 0x1ef63c12, 0xd348b824, 0xf50437e3,
+    0x68ef6861, 0x02f049e0, 0x59d0ef12, 0x4e22a8f2, 0x854a1cbb, 0xdac4cfd1, 0x4006c12b, 0xe80c103a, 0x879782d5,
+    0x1c604b54, 0x19b522e1, 0xd33ac6e6, 0x654032ae, 0x2d319807, 0x2d359e99, 0x1a1e9b0d, 0x25ad54e0, 0xaacafdc4,
+    0xdc97b367, 0xe554531c, 0xeee6254a, 0x6c426a95, 0x8d558fa8, 0xb0ea2e86, 0x857b8709, 0x08b12018, 0xb789b91c,
+    0x08d7fcbe, 0x93ba9313, 0xd9585b93, 0xdc4b706d, 0x80dc55cc, 0x2999b72b, 0xa5577449, 0xa2512bee, 0x5a2078eb,
+    0x5e0070ed, 0x0887987d, 0x80565b73, 0x506536c3, 0x7e57b53d, 0x23dd5797, 0x4966ea22, 0x8a500582, 0x21c7240b,
+    0xff7046c8, 0xcf438d1b, 0x86316ece, 0x912abcd9, 0x3fee3d8b, 0xe922e287, 0x90c5db3f, 0xcfe2b84d, 0xaf44fc0a,
+    0x6ee5ff82, 0x829ea920, 0x26d9b901, 0x5a42ada5, 0xcd091e1a, 0xff3cda70, 0xac834940, 0x221cee79, 0x5ed79581,
+    0xcee290fa, 0x85ecb896, 0x9faa3c26, 0x99bcca64, 0x8100e252, 0x63e6917d, 0x73a2351a, 0x869071a5, 0x380ac2d5,
+    0x81cacf42, 0x3f3eefc4, 0x0545a759, 0xa7b82a7b, 0xf370d628, 0x958f4ce4, 0xf8354a51, 0xa9d437af, 0x7e958771,
+    0x6954284c, 0x3822839d, 0xac0946a1, 0x1526bfbd, 0x568e45d3, 0xea6efd49, 0x5aa4c9f9, 0xfe810775, 0x447dadc8,
+    0x133abb5a, 0xad66235a, 0xdd1674f2, 0x94603801, 0xfb0432e7, 0xa788be73, 0xf036664d, 0x1200045e, 0x872f4c5e,
+    0x4930fd29, 0x7a5e2c2e, 0xad5951fd, 0x56f29fc1, 0x935b9c18, 0x73ea6e00, 0x07947aec, 0x4b6d2b36, 0x0a8598f6,
+    0x9267eb7b, 0x18d4f568, 0x0a271c25, 0x85530151, 0x35b215c4, 0x21a879bb, 0x2ef3da8c, 0xe4b33ac6, 0x1b1af382,
+    0x89eae3b2, 0x20030264, 0x2ee78769, 0x930c70e7, 0xa68ec9a8, 0xf12cd26e, 0xe087a0fa, 0x7b97ea92, 0x7670525d,
+    0xffffdae9, 0x71123266, 0x175114f8, 0x8218cdf7, 0xb0443721, 0x09361cb5, 0x40d68f33, 0x9ed3fe15, 0xd9b269f1,
+    0xa22e765d, 0xbc142e94, 0x828b350d, 0x13a3249f, 0xde233dc5, 0x5971ef93, 0xed12c46f, 0x25f1b98b, 0xd25ec8d4,
+    0x0acda1c0, 0x5c791182, 0xb34d9aec, 0xd560057f, 0x099255f2, 0x2db3be06, 0xd82141a1, 0x5cdd2186, 0x14de12ca,
+    0x52f5c5d2, 0x81b72014, 0x1859134b, 0x59b41114, 0x1a0b55f6, 0x196c9d0a, 0xea8ea4d2, 0x3f74338e, 0xa56f73ff,
+    0xdec05e31, 0x96ff5f6c, 0x9fb364b2, 0x94d592f5, 0x0fe15a45, 0xdc0ecac7, 0x30645f00, 0x55c58be0, 0x5d31a237,
+    0xa6e17f07, 0xf472cb2f, 0x7598ac2a, 0x972945b3, 0x0784912c, 0x005cc1fd, 0x84da0aa2, 0x690bb3ef, 0xd9cd36e5,
+    0xe31b7b03, 0xbc578257, 0xd0367b1b, 0x77c6e1c5, 0x025e9b76, 0xfee2425d, 0xc7d0c124, 0x468023c9, 0xee365d0a,
+    0x21cf8e8d, 0x931676bc, 0x7f43719d, 0x18819074, 0xb99f69ce, 0x4cead4a4, 0xfa2c8bef, 0x75a65a4c, 0x3de7a8ab,
+    0xd05b29c7, 0xecc0c4da, 0x17017e3c, 0x96698f29, 0xaeb342c8, 0x232720d0, 0x4166bccf, 0x459ba595, 0x3c411a56,
+    0x763131b1, 0xb18b3074, 0x79d3f7af, 0xc6f7b55a, 0xce468878, 0x65f693f4, 0xf350ec0d, 0x02f38177, 0x95b5fb40,
+    0xc99e9117, 0xbfe303b8, 0x29ff9e5a, 0x254bd200, 0x7f1242e5, 0x9fb691d1, 0x42469e9e, 0x97a8a94a, 0x196a400a,
+    0xb6d0acac, 0xca3d9651, 0xd9917078, 0x82fa0f84, 0xb3b9df74, 0x8de08ebc, 0x4f29975f, 0x5af0eda7, 0x63924ba6,
+    0xcf27f67e, 0xc6cfd452, 0xfe748846, 0x894e78c0, 0x917e0ec5, 0xca5d36ef, 0x81d7ad78, 0x9fcbf722, 0x753d8c59,
+    0x14462d44, 0xa9e7a104, 0x0039be99, 0xbe35e7c0, 0x2c4d30f6, 0x9a0c0cb2, 0x9fad99b2, 0x16c762c4, 0x006ae763,
+    0x79d89550, 0x34ec2959, 0x8d24e242, 0x91b27a91, 0xc48d40e8, 0xbb8f90b3, 0x2010c1ca, 0xb0a228da, 0x529a8ad0,
+    0x84a6f91d, 0xbc1fddee, 0xb246c60b, 0x4edf99a5, 0x7e0861ce, 0x2189b7b5, 0xdccefcbd, 0x0a9dc2d8, 0x646ceaf5,
+    0x4ca766b2, 0xef50ddb6, 0xc0a8df26, 0x49f89e45, 0x32c09f7c, 0x53c3659a, 0xf680a65d, 0x2fab951d, 0x363e8088,
+    0x86caffe1, 0x6b7a1604, 0xb8158c75, 0xfe7a1af7, 0x76624064, 0xdb33afec, 0x3e2c78f9, 0x7d034ece, 0xe1aa8b78,
+    0x0df5b267, 0x20b4aef1, 0x2d2a9805, 0xeac71293, 0x86324078, 0x88e352a0, 0x4c62ff40, 0x1e4974fa, 0x06b44105,
+    0xfd030fb8, 0x4f3e9db6, 0x978f8b13, 0x4d51c9d4, 0x26adce8d, 0x14a79c2b, 0x51523461, 0xbb7b4da0, 0x71da0ca9,
+    0x44e2466e, 0x8f205d3d, 0x4e493356, 0x8e3422af, 0xd6ba4457, 0xcb44445d, 0x54d95ac1, 0xcc92d679, 0xd60c8272,
+    0x7e0a99cc, 0x9c862e04, 0x18a5dbc1, 0x27be81b6, 0x659cb57c, 0xc6a9b724, 0x884858dd, 0x1b46aae1, 0xf33382de,
+    0x179a0306, 0x1568d9f1, 0x23d9b8d5, 0xcf593aa3, 0x12a9af0d, 0xe1ce9c46, 0xb7db09f4, 0x2ea5d721, 0xd7c31e2f,
+    0x0f0d7814, 0x8ade225a, 0x507b0690, 0xfb7d177d, 0xa3217075, 0x2cbb72c9, 0xdd52bca3, 0x5e6a8d93, 0x3c1f8532,
+    0x9cf8e2ea, 0x03e6fb9c, 0xed8cece3, 0x996b7799, 0xcf0e5ef0, 0x7c579400, 0xa15edd73, 0x62a60bab, 0xf4aa6e2a,
+    0x7a9c44b3, 0x1ef5ac60, 0xaba2334a, 0x6773e787, 0x586aa8a9, 0xcd9ef428, 0xb035f668, 0x2b0f23fa, 0x3680d4be,
+    0x2f7021e7, 0x4438bca5, 0x3bc15ea5, 0x7fd74e32, 0x6a629a69, 0xe87f2511, 0x88bc9d11, 0x7bdf93da, 0x912dadd9,
+    0x42edd850, 0xa112e12f, 0xf544c27a, 0xe64d244e, 0x5f9d5a57, 0xd685a03b, 0x750d8dbc, 0x7ce394ef, 0x30298664,
+    0xd912ca22, 0x9af7d76f, 0x65e02f8b, 0x1dd27c1a, 0xb5d519dd, 0xc7b172ba, 0xcf1c090a, 0x6ad3b5bc, 0x53cf016f,
+    0x8681185f, 0x338269a3, 0x6ec858a7, 0x47bddccc, 0x14e4d2f5, 0x1dc21af8, 0x39d707a6, 0x6fd5f3fa, 0x939807e5,
+    0xc96803e5, 0x4f8fe1c2, 0xee698bee, 0x5381aec4, 0xd0f67ed8, 0x53728352, 0xbd8aae34, 0xfba4f12b, 0xdb8886dc,
+    0x4c85feae, 0x5f3068a8, 0x851b3890, 0x8d4f5e28, 0x0134052a, 0x476af871, 0xe107744e, 0xf936e2cf, 0xcf34cbff,
+    0xa3eeb478, 0x552c3230, 0x2cc7317c, 0x4b40b00e, 0xf0aec22c, 0x5e0197f1, 0x75134990, 0x70be63cd, 0xeff8ab81,
+    0xb01113b1, 0x092c0b15, 0xaee2b8cc, 0x582ac50c, 0x0824c59b, 0x86b0baee, 0xdc893e1e, 0x345327cf, 0xcc2f1c5c,
+    0xcfd1967d, 0x6d48f322, 0x07a70639, 0x5c732efd, 0x90cbe794, 0xfbf0befa, 0x8375d79a, 0xb08c6bc0, 0xac76a5f6,
+    0x03d3c1c1, 0xc8c84ade, 0x7546a913, 0x40dc781f, 0x93fd1f40, 0x2ba1782f, 0x94221d95, 0xad27c138, 0x6ff1c284,
+    0xb59823f4, 0xdfc3d318, 0x984deebd, 0x3795de20, 0xd0769eab, 0xb54dc663, 0xeae6b621, 0x39df12dc, 0x09cd9eb0,
+    0x7393d1b1, 0x801604ee, 0xaf37bb16, 0x2b86a17a, 0xb0f42997, 0x77db6524, 0xbec96ce8, 0x4ae23729, 0xb42cc3d3,
+    0x138f7e8c, 0x22c6ca98, 0x0a586b03, 0x3b4a4529, 0x81b335b8, 0xadb7459b, 0x2553857f, 0x905dc086, 0x1a90ab19,
+    0x96aebde8, 0xd5178a9b, 0xbce063e6, 0x7033476c, 0xa5979c55, 0xac80e77c, 0x1f9ddda5, 0xf52e58c2, 0x6cafe992,
+    0x5daa4e44, 0xd0418baa, 0x3000c9f8, 0xbff03b8e, 0x6a3a239e, 0xa1e34e6c, 0xac8175eb, 0xa7e38f17, 0x9bfd61d2,
+    0x20a9f171, 0x8dee22f0, 0xf0764484, 0x4d699789, 0x7e714570, 0x2cec8567, 0x6419a897, 0x338a748e, 0x61425469,
+    0xd6cb856f, 0x3f037265, 0x9c8cbb80, 0xd0e22cac, 0x7b17f555, 0xe2c66adf, 0x158f31ba, 0xa2b167e0, 0x95e903fc,
+    0x63c5045e, 0x6631c312, 0x29c0e6a1, 0x02c1c4dd, 0x35b21b81, 0x9fd6711b, 0xca4b4e40, 0xe6592306, 0x114619c1,
+    0x6b07da86, 0xa76b5025, 0x36421c1a, 0x8e3fccad, 0xdfb1d9a0, 0x46bce482, 0xed802fa2, 0xd5bbeb2d, 0x83011c74,
+    0xe40b9cbf, 0x98d78dd5, 0x1373ce25, 0x35ff33a4, 0x499a16c3, 0xc7609dbd, 0x8bc631ca, 0x322b759a, 0xf793b56c,
+    0x464d158b, 0x803d78de, 0x2093656a, 0xe3ab1633, 0xad0e2598, 0x7ec11cbd, 0xe11a1274, 0xd5df6e48, 0x7542d937,
+    0x37fb07e6, 0x82fa2fab, 0x175960cd, 0xc28b3a52, 0xb28484f1, 0xf48cc684, 0x8a92368c, 0xe19d60bf, 0x9cf1a7b7,
+    0x1a23f0c2, 0xe5534a3f, 0x29f5bc3d, 0x9e79b44d, 0x7c68fdde, 0x82b7033d, 0x3e0ba209, 0xe15d2513, 0xbc54d688,
+    0xab0a8773, 0xbcb971a7, 0xfd9736d5, 0x665a9ba6, 0x651d4262, 0xe41df60e, 0x8b199866, 0xea564a8c, 0x892d4866,
+    0xf671abf3, 0xf3e25a7c, 0xe10528e4, 0xa3f0ba57, 0x50d31109, 0x1d1e032b, 0x0e04e75c, 0x7506eeb3, 0x32f759f4,
+    0xcc6a3d92, 0x74ea14eb, 0x0b290de2, 0xac1e402f, 0xb8a2ebc9, 0x92134e8a, 0x142856d8, 0x2259650f, 0x593c4855,
+    0x68d6fa98, 0x8e03d190, 0xcb559ecc, 0x21042f97, 0x27d92972, 0x040be777, 0x3f083187, 0x350fc4eb, 0xaa8dd017,
+    0x5c518523, 0xb09de1a4, 0xd137496e, 0x4dd60c81, 0x8e641e71, 0x48fd0c37, 0xa4dc9def, 0x76722804, 0x64196485,
+    0xecc098b7, 0x4cbe6d87, 0xe97092c0, 0xee19c0e5, 0x1bd24ba1, 0xcd53149c, 0x6bedfd32, 0xcaea4f5f, 0xe0f2d53a,
+    0x32222cce, 0x62f04f78, 0x281c4aea, 0x92f1d746, 0xddd30925, 0xbce5006b, 0x1964137d, 0x2f339eff, 0x073b06b9,
+    0x3806fabd, 0x7cfdd1de, 0x8ea92392, 0xca2bf0c7, 0x6f19258a, 0xf3dfff39, 0x838e7d04, 0x21ee01b5, 0x4f79ad31,
+    0xc81dec10, 0x8a021570, 0x032740a9, 0x671404de, 0x64b4f318, 0xe425749a, 0xb9f196ad, 0x752ca164, 0x55918347,
+    0xfb3cbd07, 0x4a250a48, 0xf90af985, 0xdf827279, 0x1ff54a6d, 0x73a2e24d, 0x9d8a17a6, 0x22953d50, 0x9ec66708,
+    0x21716936, 0x9ff27cd4, 0x66cabc9a, 0x7b15b7f9, 0xafa68161, 0x63ea3760, 0xef7e1f6d, 0x733d72dc, 0xebc902dc,
+    0xaa8ecd95, 0xc633714b, 0x77cc13b6, 0x997bfd96, 0x289ab7ca, 0xeba7a264, 0xfd5c5651, 0xc3411a5b, 0x5d834ba4,
+    0xd8bf1606, 0xdb24fb68, 0x1b3b9b6b, 0x80bb8791, 0x3f087e8e, 0x41c60f54, 0xe00c8f0a, 0x325554ec, 0xd1a0e434,
+    0x4544b041, 0x9c42a29e, 0xb11832d1, 0x5af8ea30, 0xf9a79ab1, 0xb003d5a3, 0x942ca953, 0x582c8920, 0x2db624e1,
+    0xe1424060, 0x412a9157, 0xc18d9a94, 0x68a427e4, 0x21cad876, 0xba1be04a, 0xd1ef84a9, 0x08988413, 0xe359ea1f,
+    0x4cfe8dbe, 0x59863e1e, 0xf8327125, 0xd9f1753d, 0x77b4a25a, 0xf8b114c3, 0xf4259e25, 0x3d952dfe, 0xa0191376,
+    0xe09dcb7f, 0xb761cbca, 0xfede9076, 0xb1404d99, 0xe1fc4db2, 0x00f50f6f, 0x7ae04d6c, 0xb339f845, 0x8ed71398,
+    0x3a737281, 0xd04cef9f, 0x57a1615c, 0xef045732, 0x04503c6b, 0xddac7645, 0xa8f9f113, 0x61ef0675, 0xd21eb19a,
+    0x0c4d93f9, 0xa485da9c, 0xf2ce65dd, 0xf2245f2d, 0x92090dc0, 0x72d599bb, 0x286d1e79, 0xad640608, 0xc7acf68d,
+    0xeda7eb5d, 0x950e6744, 0x3922089f, 0x7b3037f8, 0x9e11b096, 0x7a46bb38, 0x1a15acac, 0x35902c06, 0xcc114eb1,
+    0x81e319c8, 0x84c439d1, 0xafc550bf, 0xdc85cf14, 0x696e8ab8, 0x0a2ca729, 0x47c2502e, 0x8cf7732d, 0xb7589765,
+    0x076ee187, 0xc4e26443, 0xe1c28f20, 0x8e01fc17, 0x97d32480, 0xcabb61d7, 0x82130285, 0x05aa1ce2, 0x6fd4ffdb,
+    0x679b3fe6, 0x3454908f, 0x471e3edc, 0x36336495, 0x0a4739a7, 0x67cbf051, 0x6af0d047, 0x7da98fbb, 0x66174df0,
+    0x8f75cbfa, 0xb42d0bca, 0xadceb870, 0x049a5a91, 0xa70439f1, 0xbe5b57ac, 0x856f0055, 0x07805fcc, 0xff4a7940,
+    0xba3dd26e, 0xcbe3efbb, 0x90fd3ca6, 0xef180cad, 0xd49a2fe1, 0xeac70e33, 0x47640130, 0xc80fbcfd, 0x60d37b9a,
+    0x66157a7f, 0x33b6be90, 0x9b7f1b83, 0x896fbe7d, 0x638886f4, 0x39b0322c, 0x37dcee0c, 0x54771a0c, 0xba7dd17e,
+    0x19846706, 0xc08e1d00, 0xe17af913, 0x3221206b, 0x4eab89c7, 0xe589fd1f, 0x42b34450, 0x7fe711da, 0x7d235a38,
+    0xbd725ee7, 0x8abcfd6f, 0xff5eb551, 0xdefdf921, 0x11c61d72, 0xc184d800, 0xe0f21ede, 0xbca2053c, 0xd7cce490,
+    0x477fd3a2, 0xfef06802, 0xe205b0a1, 0x6796703a, 0x55a826c0, 0x91f7cd58, 0x28fe3da1, 0x68d27f1e, 0xa154309a,
+    0xbd85d001, 0x4676e242, 0x2a4df060, 0x48767dfa, 0x7ba2eebf, 0xc3477ae5, 0xaf147174, 0x91fba18a, 0x2784b532,
+    0x753a8929, 0xef7923b6, 0x840468d0, 0xee3c5ecc, 0xb98a6df0, 0x6b1977af, 0x59d7d858, 0x044e36dd, 0xc6441e11,
+    0x5ab4eb9a, 0xd6954d71, 0xdbeb3110, 0x2ee22ed4, 0x3b09d65e, 0x226ceb8b, 0xf27a3424, 0x09bf27c5, 0xb1c9aac3,
+    0x2db6a327, 0x3e15b3f9, 0xaab2e756, 0xd553ed67, 0xb694dba3, 0xee34f592, 0x23381868, 0xbb0d2b4f, 0x20a3cbf8,
+    0x31daf122, 0xaf83621e, 0x3f6e3ade, 0x4475370b, 0xd12ddb85, 0x7bb94e5a, 0x970544bf, 0x471571f7, 0x8eecabd5,
+    0x448e570b, 0x7e811c48, 0x76705125, 0xf4d7ef8e, 0xdbfa0a3c, 0x9871cfe6, 0xb9f13da2, 0xd06ce447, 0x9bc03f0d,
+    0x34a34a38, 0x4b125fda, 0xbcc405cf, 0x3086bfd3, 0xf402de74, 0x693de838, 0x390fb739, 0x0304de02, 0xee05c928,
+    0xb9b2b7c5, 0xe8692942, 0xfcff3148, 0xe8b6a95a, 0xba8439a4, 0x94e0ab9d, 0x2b67abe7, 0xf6b887ac, 0xd51d90fc,
+    0x0cfe4129, 0x08bedd8f, 0x20aca1e2, 0x2d97f7dc, 0x768baf2c, 0xe070c4cf, 0x887b630a, 0x39226ce3, 0x223d3135,
+    0x67087ecc, 0xde71591e, 0x9f449967, 0xe29397da, 0x4c86b95b, 0x9d0e9d46, 0xfd45a499, 0x8dff712c, 0x4b9efb11,
+    0x8a7666bd, 0xb34bbc1a, 0xb8edc228, 0xd40a8ef0, 0x1c258871, 0x694cc695, 0x7f4ae6c1, 0x05798857, 0x0b2b387d,
+    0xa3eb06f6, 0x26938660, 0xe6be3e7a, 0x9f04da64, 0x280c94cc, 0x88ba3c14, 0xf1eb649e, 0x1fb22abc, 0x3068af2e,
+    0xd508d5f7, 0x456a7c1e, 0x755ccda5, 0xab47dfee, 0x37baae20, 0x522d9457, 0xd3bf8559, 0x557a5787, 0x54f484d2,
+    0x834f0bf6, 0x90f10bec, 0xc89437f7, 0x40f24d50, 0x7da6c287, 0x85d4673e, 0xf5ef574a, 0x603ad149, 0x776d52f6,
+    0xd5ff1c6f, 0x0b6ae110, 0x7f8e75bd, 0x29f34d63, 0x1a591451, 0xb158e06a, 0xb3cbde06, 0x5efa86f8, 0xb750b02e,
+    0xa1d7d275, 0x928f8907, 0x7c1a228e, 0x59337335, 0xf7b7d508, 0x0ccea95f, 0xa3425d64, 0xdca257c0, 0xc43ca2f4,
+    0xc65aaf40, 0xfee70d4f, 0x2e4112db, 0xbb52a3fd, 0x617d350f, 0x0235fb8d, 0x2738b3a4, 0x94e0034f, 0x57b28e1d,
+    0x1eb54cc6, 0xec150a15, 0x4129a4ba, 0xa4e0a2df, 0x9c47a5ed, 0x8d963a28, 0x9b51b089, 0xcdd65aae, 0xc4bc26f6,
+    0xeab4f15f, 0xc03f5105, 0xbbf8d7a1, 0xbbedb86b, 0x4ff3abf6, 0x4cf91f47, 0x81e3468b, 0x0203924a, 0x1280b5c1,
+    0xfbeafea1, 0xa515e378, 0xa0af03eb, 0xc8ef5d11, 0x0bb01526, 0xae116bd4, 0xfec987bf, 0x455b2152, 0xa573f4cf,
+    0xf7080fa4, 0x5186a1df, 0xb680ffe9, 0x18dac264, 0x3fc55505, 0xadc52c04, 0xab52b9a3, 0xb43d0280, 0xbbce7dc7,
+    0x85a91ee6, 0x71ef84de, 0x4c0fd9fd, 0x3096c86f, 0x4804c9b7, 0x8c3e5aad, 0xdf5ba9cc, 0x6a8d1d59, 0x17525e19,
+    0x85a919f9, 0xe8d2ae05, 0x4fd7bc70, 0x25fb552a, 0x17ed91e4, 0xb1fcf491, 0xd207fadf, 0x987b012a, 0x7570c3e8,
+    0x4ab8eee5, 0x120b730d, 0x6ed38b5d, 0xb957464f, 0xd5d803dd, 0xf6b76176, 0x9d5f8513, 0x9a7ebda1, 0x5f4c70cf,
+    0x25c56da4, 0x6dc8a442, 0x5eff37d7, 0x509f5861, 0x786958c1, 0x0dd17bda, 0x927069bb, 0xec2889c8, 0xb747b354,
+    0x3504c4f1, 0x94258395, 0x05836f5e, 0x12068054, 0x42751853, 0x05859782, 0x784882ad, 0xc3988e94, 0x20c7eb21,
+    0x6f5d9be5, 0x23840867, 0xfc160e47, 0xbb3bfe14, 0x2497e7ee, 0x42e5f8c2, 0xbdb0d262, 0x97d52dd1, 0x512c6081,
+    0xf2beb1b9, 0xdab5a157, 0x9a86a417, 0x1f9a1932, 0xcf9da6e5, 0xf82d53a0, 0x2b0baa7e, 0x2327b4a2, 0xd71a161a,
+    0xdf403475, 0x948bfb49, 0x24fc9862, 0x225123cf, 0xced76b57, 0x755bc1ec, 0xd0a2dc53, 0x64bfa749, 0xeca16661,
+    0x61183c53, 0xcbbf1397, 0x49c5459a, 0x18e394b2, 0x1be4f48c, 0xf7d8ec91, 0xd81fc5c6, 0xcdb1c20b, 0xfe3c90b0,
+    0x4b836637, 0x556781e5, 0x5af18ba0, 0xf0e454e4, 0x79278ba0, 0xe0c76baf, 0xb36c577e, 0xa23b9489, 0x11305ed4,
+    0x1b2cf419, 0x250a4de5, 0xe5cf8de5, 0xc5aba253, 0xaba81623, 0xbf255563, 0x5956abd8, 0x54354af8, 0xae4ae23e,
+    0x138d859c, 0xb6ab68ea, 0x28c55e2c, 0x5dc5e110, 0xb467d47c, 0xc3cc8685, 0xe1566c24, 0x322c8890, 0x677857fe,
+    0xfe8eb38f, 0x0b61ea66, 0xddd1b4ca, 0x6f1cbf51, 0x44f08357, 0xcbe21396, 0x744fe8b9, 0x143b958b, 0xab05e6fe,
+    0x3c54dcd1, 0xa5b694a5, 0x0030a4b7, 0x254a05bb, 0x4214883d, 0xd53902f1, 0xcc0e599a, 0x22298028, 0xa55470d9,
+    0xbee9ff6c, 0xaf1e2a5e, 0x0f69d102, 0xfc02aa22, 0x19f1d3c7, 0xb6aa4ebe, 0xf1751cec, 0x8a0ae852, 0xd180a904,
+    0xad8605a1, 0xb5f57878, 0x6b6db0ed, 0xaaf42553, 0x64f45bb7, 0x9ff787a7, 0x84e527c0, 0xb2839040, 0x4f044fec,
+    0x14cbd950, 0x522ae19f, 0x0030916b, 0x517635ca, 0xc3a74420, 0xf13d6a0e, 0xeadd4b6e, 0x8e20585b, 0x0b36ab20,
+    0x5f6b6be3, 0x6126831b, 0xdf84a59f, 0x4dd6380d, 0xb77899f2, 0xbb5e5703, 0xf2086ddc, 0x6532cc3a, 0xdb8aa73e,
+    0x6570ee92, 0xf32f68c8, 0x019ddfdf, 0xa57896e4, 0xc10e0c77, 0xe3f15ffe, 0x900e26cc, 0x3cd78e47, 0x14354762,
+    0x9d6a699a, 0x3ab5c295, 0x15bd0b3f, 0x751f7fab, 0x134faaa0, 0x70e112a9, 0xad293978, 0xdf35c6f2, 0x4ba653e2,
+    0xc4fefeb4, 0x5b4e5baf, 0xefb1d2dd, 0xf79e0d2b, 0xbc488b42, 0xe7f21b7d, 0x5aa9157d, 0x6b86dec9, 0x835312f6,
+    0x6adf72e9, 0xf613d479, 0xa2379126, 0xefe91cb2, 0x124d80d8, 0xf810e5b7, 0xa9780fd0, 0x15f06bb7, 0x50145248,
+    0x502c59c2, 0xc8271ed4, 0x718152d3, 0xb138b95b, 0xfb031cf7, 0x5c4d4895, 0x7aa222ac, 0x566cacfc, 0x3283df05,
+    0xe3b5f754, 0x91288231, 0xeb9b4a58, 0x3ab36dfe, 0xae69ec8f, 0xf9e33e4e, 0xbe85bb36, 0x870dca46, 0x7154ead6,
+    0x6c3d6885, 0xde765276, 0x09309ecf, 0x5d1c9e35, 0x7cd844a9, 0xa1252152, 0x9967ff0d, 0xa792dde0, 0x2b5e20c1,
+    0xebccd1cb, 0x3ceb2b15, 0x49538aae, 0xc1ae7073, 0x10ea8682, 0x6afbba45, 0xe0973996, 0xda059f47, 0xc5fdac19,
+    0x7f0f74b3, 0x424d8f46, 0xfd844473, 0x2a8aebd0, 0x69dc3074, 0x86fe309d, 0x55c9310e, 0x0d7f978c, 0xc6dbee41,
+    0x19c6edb1, 0x95c916c1, 0x77110905, 0x17deb9f5, 0x8bd33b28, 0xb483f91c, 0x1121b3cc, 0xf6233cb6, 0xef243748,
+    0x9271a226, 0x01d89f4a, 0x2338f83f, 0x215fdd9c, 0xc62470c2, 0x6159032f, 0x7c523bea, 0x1d80e70b, 0x49d67bf1,
+    0xbf6fd8c2, 0x6555f052, 0x224ac6ca, 0x1095a7fa, 0xf4161b64, 0xd3023679, 0x97f93cf6, 0xe8d0a971, 0x7355a50a,
+    0xed4a763f, 0x977bffbc, 0xde073c28, 0x52826765, 0x97e44e42, 0xaed68ae8, 0x8ace251f, 0x71edc9de, 0x16cab2c1,
+    0x96eddbcc, 0xfb734d47, 0x71480c74, 0x84b94b94, 0x6c236c04, 0x4d0c3de6, 0xb562e004, 0x3a986190, 0xadc294cd,
+    0x3b006f5a, 0x2146b5c3, 0x196571c0, 0xdc6552e2, 0xfa52b97f, 0x11f974b4, 0x7b966641, 0x23f081fa, 0xae22a48c,
+    0x056ebc03, 0x5dbb6742, 0x273b0378, 0x19f09b75, 0x35fc426a, 0x16c0e434, 0x97eb86cb, 0x323f6f61, 0x077820d4,
+    0x2ae697d9, 0x2dca47ac, 0xe4b2af3d, 0xb53f500f, 0x7f8e17d1, 0xdcda13a7, 0xc531b97e, 0xdca522c0, 0x226ed058,
+    0x90551792, 0x175e9a12, 0x53d3838c, 0x12f4451f, 0x738d2aea, 0xeb18a832, 0x5646355b, 0x8695d90d, 0x2a87de20,
+    0x237b5c4d, 0x7d56d740, 0x8696dd8f, 0x0eee469e, 0x0477d2be, 0x76420bfe, 0xbfc3c534, 0x2d734253, 0x14749579,
+    0x33a47713, 0xf58375b0, 0x9db44d59, 0x5dd5a550, 0x9594103c, 0x672172b6, 0x9721a601, 0xf22bce5d, 0xc6078ab6,
+    0xc214a017, 0x7d2bcd16, 0x4461cdaa, 0xe9fcccc3, 0x9dd03af7, 0x00d0ab31, 0x4044ba0f, 0x079023d6, 0x3356d18f,
+    0x07f4cc75, 0x8a15eaca, 0xd7e93425, 0x8f749cb9, 0x7f0da3b7, 0x927a943d, 0x23258aa0, 0xe65189c4, 0x1a97f8e7,
+    0xbc772ba8, 0xec579f52, 0x31bca957, 0x0ff87e8a, 0xdba76ad6, 0x98d22cb6, 0xc20f56e0, 0xa647618b, 0xfcafe613,
+    0x0b792c28, 0xd0d3d611, 0xb0206927, 0x91bee8e4, 0xe275c131, 0x5eb76a17, 0xb3aa5551, 0xd2709740, 0xbd98bfa9,
+    0x82d101bb, 0x17ec637e, 0xa1f440a2, 0x4e8ba3f9, 0x22e2e36d, 0xca6a319d, 0xfbb6696c, 0x14137e4b, 0xfd07b93a,
+    0x88187f43, 0xe25ec3c6, 0xeed94802, 0xd3cc9ee2, 0xbf24a2cb, 0x6a135c35, 0x0e03b434, 0x4ec89ccd, 0x6ea06429,
+    0xd48a5822, 0x10189fcd, 0x4d8f8ce1, 0x1fb21f86, 0xdd542d32, 0x944bd3ec, 0x6df5785b, 0x588b4182, 0xf9fd1d64,
+    0x94ff2b13, 0xd01c64b0, 0x02e8d32f, 0xfb51a649, 0x675b91f2, 0xe468ebcd, 0x0b78ef1b, 0x32bd69e0, 0x977084b2,
+    0xedee1dc9, 0x54a06b39, 0xb4c0719d, 0x8b8f4989, 0x608d4eaa, 0x034e4683, 0xb2558cd0, 0x4feb8c0d, 0xc6a764c6,
+    0x97c6225f, 0xb90e31e6, 0xcb6f3bcb, 0x29c445da, 0xf445a686, 0x83fdbecc, 0xd968f247, 0x868d2474, 0x9bd3cb08,
+    0xa0f84f35, 0x91e211ad, 0x93a8c50a, 0x44a68fa8, 0x05aa1550, 0x1fe3a0b7, 0xe31f0d49, 0x6b7586d5, 0xb259cc82,
+    0xf4c1cb1f, 0x942452d9, 0x4ea1beab, 0xa47b1a74, 0x7d1f64d5, 0x4afff063, 0x8533476d, 0x57313806, 0xf63d7c84,
+    0xe3b34678, 0x8d5f885a, 0x4b28b571, 0xf975ed59, 0x895c16da, 0x30c3bc0c, 0x8ebbba49, 0x212ec712, 0x189c94ef,
+    0xe2de388d, 0x12b13ee8, 0xed353d9e, 0xb62fedf6, 0x1c0c0536, 0x77d7ab11, 0x25b7c9ae, 0x69b40dc5, 0x5bf65ca2,
+    0x8e4af743, 0xdee6c528, 0xd9c226e8, 0xddeb659c, 0xfbd87368, 0x0a0c0944, 0x2e1dcc24, 0xd1d71331, 0x6ca6d66d,
+    0x9aa7ed35, 0x89f4b92e, 0xebe97071, 0x14f55b49, 0x4bad0750, 0xe692d6b0, 0xe51f95c9, 0xbd618500, 0x0230a9eb,
+    0x3b6ee594, 0xba3212db, 0x96e1dc9e, 0xb6a8ed36, 0x0e939743, 0x52fad7e9, 0x3ce8c1b0, 0x31d9ba70, 0x6f0cde45,
+    0x162f7ba0, 0x694fcbd7, 0x06d9a23b, 0xecffd9c6, 0xa0ac4b0a, 0x6004d03f, 0x8a6d36d8, 0xa616d57d, 0x9ea25802,
+    0x65fe2b0e, 0x0f2c1340, 0xba689a69, 0x03c0caba, 0xc2c2867c, 0x74508495, 0x5d7e5ff7, 0x5f44a6ee, 0xe05a8d92,
+    0x20641689, 0x7cefbb52, 0xb3abf4b1, 0x68258b5d, 0xfcab5325, 0x9d01fb49, 0x883ff097, 0xda553543, 0x3a09bd66,
+    0x9ec26962, 0x12316d11, 0x9bafc881, 0x453c698c, 0x5b1d47c8, 0x707bf851, 0x7bd92353, 0x8179137d, 0xd6d03391,
+    0xd490037d, 0x9265db64, 0x28e997af, 0xa742c9ab, 0xfbc8f9ee, 0x1976804e, 0xd7532d61, 0x0f81c023, 0x53457024,
+    0x95ebafb7, 0xa5e16160, 0x7cfb5806, 0x73eaff15, 0x934d782b, 0x0ea9c60e, 0xa1e6b17c, 0x3231b481, 0xdb2f5923,
+    0x23207cae, 0x8d5f5867, 0xa2165d07, 0xb312e6ca, 0xfa28b7d8, 0x0bdb5355, 0x73c38cf3, 0x95ed4789, 0x26e8d8af,
+    0x38e0e6c3, 0xb7e8cb7e, 0x0cfeeefd, 0xbc8ea901, 0x0030d958, 0xd0d597d2, 0xfcad5b25, 0x5d950693, 0x131f4e81,
+    0x421fb3dd, 0x723a94b2, 0x13d1549d, 0x5eff5c43, 0xc7199ac4, 0x06be9094, 0x1345abea, 0x6cecd91d, 0xfc78a14c,
+    0x39b505d3, 0x55f77bfc, 0x2f4c8894, 0x00d9ca3b, 0x588a852b, 0x54232571, 0xfa1d3614, 0xce893159, 0xa7eb369c,
+    0x1720d0b3, 0xc7493369, 0xe6d03427, 0x7ac9cd9d, 0x225b4f73, 0x4e5c46e3, 0x0326de68, 0x398bd1f6, 0xfd8ae901,
+    0xcc027be3, 0xdbd37a6f, 0x1187778e, 0xb80e1e44, 0x3bac8341, 0x4045becd, 0x83678105, 0x361d5b98, 0xc041b4ab,
+    0x0ff20c75, 0x6d85769e, 0xcfdf8eba, 0x66ede2b8, 0x7546fabc, 0x31a585d8, 0xd95d8b6c, 0xcd820ba4, 0x17e5f470,
+    0x74ebec06, 0x24c2c8ac, 0x58a8324d, 0x88d28336, 0x1d2cb81e, 0xa3737889, 0x83cb6246, 0xb4870a7b, 0x40e7ce15,
+    0xe6c2d647, 0x7ce1cda2, 0xf519577e, 0xeb98139a, 0xb188dbcf, 0x410a8fef, 0xb32c0ac0, 0x26934fb0, 0xfe6bb85b,
+    0xe6e7e321, 0xfe3815cb, 0x39891e92, 0x9ea928a0, 0x808848c2, 0xaef16ded, 0xf3f5d35d, 0x3f4d699e, 0x61750dc2,
+    0xfc61f29b, 0x16949d63, 0xad27b6ae, 0xe7f80937, 0x8d2ccdd7, 0xf0c5575e, 0x27ec8ca0, 0x76f87a58, 0xb4acd187,
+    0xbc6eca0c, 0xcdd03f43, 0x1636010f, 0x7c569d41, 0xcf6720a5, 0x5a1e05d3, 0xc88dbbac, 0x537ceaf9, 0xd2d1567c,
+    0x471cf798, 0xfc4ea62a, 0x40085c14, 0x8a2f153b, 0xd340d9a4, 0x5e62d588, 0x0b4cbbc4, 0x2af9446b, 0x74a4ec51,
+    0x0b60cb45, 0x2880985a, 0x98b7ca90, 0x84884828, 0xd8b729c2, 0x160cf0e2, 0x8b9e0a33, 0xd528ff1c, 0xf3713f27,
+    0x53789656, 0xfd8d1603, 0xf199d50d, 0xd76ef7f1, 0x1cd59be4, 0xc1f5f721, 0xc299c87e, 0x9f0378aa, 0x112cfe71,
+    0xb0bdbdf6, 0x20e7ea47, 0x0a04f32a, 0xe613f10c, 0x277b4935, 0xb8752a42, 0x456313a4, 0xd7091a19, 0x15c24e40,
+    0xb2218afa, 0x1c6fa453, 0x4333f97b, 0x8143703d, 0x4205ffdb, 0xf53435cb, 0x90f06e14, 0x125e7710, 0x3e8b817b,
+    0x4efc46c7, 0x220aca2c, 0x29ad3364, 0x209d4a4a, 0xe5fb6179, 0xa2cff83c, 0xdf718e93, 0x8c81498d, 0xaa8486b3,
+    0x308de16e, 0x844c793a, 0x7e1e2d40, 0xee069493, 0xa1cc8fcb, 0x21612b7b, 0x9294c821, 0xc640f204, 0x3531fdf6,
+    0x2787b76d, 0x98432667, 0x27de809e, 0x71e85079, 0xa68d1b3f, 0xcd155b42, 0xfd2ce635, 0xf85224f4, 0xb3cee050,
+    0x45447425, 0xa3bcc3f6, 0x7b391115, 0x6c83c7ef, 0xb372e7b8, 0x6b624482, 0xc9a8beec, 0xcd430082, 0xf1eb550d,
+    0xee59781d, 0xd0588afd, 0xf799e61e, 0x54b9434e, 0xdc85c5a8, 0x18dfdd47, 0x128a80f3, 0xdccf26be, 0xeb845176,
+    0x93b7d3b8, 0xc4ab1f61, 0x9aa83897, 0x581681f5, 0xf71d557c, 0xcbf9bb05, 0xa1d5817f, 0x1a32e7f3, 0x6af2c6e2,
+    0xe69f42d7, 0x2bdef124, 0x17477b10, 0x8daf1655, 0xb66c34c9, 0xd7581a72, 0x136ce945, 0x20d22044, 0xf7b3ce34,
+    0xd09db28c, 0xabf654e2, 0xc7bcb6bd, 0x3d3d6f97, 0x42200aaa, 0x6d1f91e3, 0xf184c3d4, 0x89833d4b, 0x28e6804d,
+    0x1621d342, 0x2a4bad38, 0x11f41b4b, 0x8fe52cd3, 0x4fa4225b, 0x4ccea7e4, 0x3dd43888, 0x56f9f22e, 0xf3bf36ea,
+    0x7838d875, 0xc2ab6978, 0x62b79fa5, 0x04409b8e, 0x8c416081, 0x07aeaecc, 0x2f239e11, 0x84545410, 0x5211d675,
+    0x364eb6bc, 0xb789ea7c, 0x9fe64366, 0xf90b449e, 0x062481dc, 0xdf347d37, 0x7dd71cb3, 0xc451d00a, 0xc04dbadf,
+    0x18c3df35, 0xdf32c4e8, 0x570372ee, 0xeb5bb1df, 0xbbae95e5, 0x77e7e52b, 0x059718fc, 0x71c41a94, 0x3fcd86e2,
+    0x3972c4b6, 0x6de00867, 0xecd860d6, 0x5b4fa575, 0x64fe7e9b, 0xbc2421ee, 0x1b272e20, 0x81f55f73, 0xa4ec1311,
+    0xc0c1ca2d, 0x9c11979a, 0x2dc5ab1a, 0x79905742, 0x13b3c373, 0xe4f47f7a, 0x594faf39, 0xa7d76a91, 0xc9c8091d,
+    0xf2e79d66, 0xe0909c89, 0x8a05d398, 0x4a52b86f, 0x35fc9e62, 0xca009dfd, 0x2a5f31c0, 0xaa19da7c, 0x9da05481,
+    0xf6a03189, 0x12f8c923, 0x36527327, 0x181d6027, 0x775fe5e4, 0x4bf77ef2, 0x2500da96, 0x6be8464f, 0xdac0173a,
+    0xf771709c, 0x6e73f62b, 0x25583611, 0x5416bb9b, 0xb8092dfd, 0x72d102a2, 0x8bc34b1b, 0x51c8ca6f, 0x3078be98,
+    0x85efe4bb, 0x4d023799, 0x696001e1, 0x45925265, 0xdf08155e, 0xd72f8eea, 0xb9d47b44, 0xcd095557, 0xb762d1d6,
+    0x9c514142, 0xcad5396d, 0x744f3676, 0xe7dc649a, 0x6c43812a, 0x801df11e, 0x21421cfd, 0x464353ec, 0xf12a5ced,
+    0x0e66b69a, 0x5b1e2274, 0xc52a3263, 0xc1b5f6e9, 0x449fb2b4, 0x832ba657, 0x6462b723, 0xf203e9b0, 0xfcf70f45,
+    0x08ba5c5d, 0xcb96b4a0, 0x5985a570, 0x3744a5d8, 0x8f3e40dc, 0x8aee405d, 0xefab98e8, 0xaad27da9, 0xbb608302,
+    0x770bdaf0, 0xe5a4c61d, 0x29e211bc, 0xf276b5b9, 0x0570c799, 0x321e508e, 0xdd1abc1a, 0xc8346064, 0x1b803a8c,
+    0x9f44ab31, 0x58c83412, 0xcd859c18, 0xb82f1a9a, 0xb2e21376, 0x46a001ec, 0xccc78404, 0x75306cc2, 0x19abe50d,
+    0xabcdd001, 0x933ae5ee, 0x29173e05, 0x7f27199a, 0x8b1456ac, 0xcf4fd945, 0xc769ab6f, 0x4125d2e1, 0x8ce679f3,
+    0x24440b14, 0xeaa8742d, 0x743fb658, 0x095ac15b, 0x581d1bea, 0x92bd1033, 0x79a1da49, 0x424646c0, 0xe0347bc9,
+    0x7dcf0021, 0xb421b43a, 0xc8be6615, 0x652f8cd9, 0x46cb3782, 0xf3bab7a4, 0xa2839090, 0x34c2785b, 0x705fa7a4,
+    0xaa1d7083, 0xc732c292, 0x1fef7f0d, 0x474c09aa, 0x4a0355d2, 0xca029351, 0xceca09e4, 0xd8e3ab36, 0xe71efe2d,
+    0x37666710, 0x4f32e5be, 0x65345af7, 0x47352116, 0x23535b8c, 0x57927b0b, 0x3e1a39b7, 0xbbcae9b6, 0x45b7e2b1,
+    0xc8e2ee92, 0xb937c795, 0x83a0da63, 0x5f560ba0, 0x695dd28a, 0xcb6adf60, 0xfd5036ba, 0x154daa33, 0x15c39118,
+    0xa77278bb, 0xe538e188, 0xe6b717b9, 0x11c3b802, 0xfa91bc78, 0x3bd5c85e, 0x089bef8a, 0x2263562a, 0xda4e7b59,
+    0xe1698e2a, 0xed472ee2, 0x85268f92, 0x36ae9c0c, 0x2e31b796, 0x47d96081, 0x162c6c0d, 0xf9fe6fc6, 0xb2f21cba,
+    0x083b64ac, 0x26991fae, 0x021480da, 0x0a9be338, 0x0cb597d1, 0xf82bdb93, 0x99674c09, 0xc2ef2ee3, 0xea6b9298,
+    0x287626c3, 0xceaf5b22, 0xf33625a1, 0xb60b2bfb, 0xd85c6ca5, 0x6a19e7a7, 0x82a3f0ee, 0x089f85b9, 0x97df6de9,
+    0x44bdbf1a, 0xa2a96965, 0x7078e4cf, 0x1b2ad738, 0xb4fff8d0, 0xbdff601d, 0x0dac0408, 0x9f9d3f76, 0x9f14276d,
+    0x17cf39fa, 0x29228766, 0x52f50e91, 0x9fa7cb0d, 0xe8ae194b, 0xbbf7c1e8, 0x4f4a30ff, 0x8af60b3e, 0x7cd1292d,
+    0x33f0c0ed, 0x5f55860f, 0x66dc282f, 0xe8377ef8, 0x5909fddb, 0xdc216942, 0x293b713f, 0xc7ee7977, 0xcac17ff5,
+    0xd161ebf6, 0x287e4467, 0x665c78e6, 0xcf99a6e1, 0xd5cc878c, 0xfe8e30db, 0xfd8c31ac, 0x21e6ba64, 0xe59f64ef,
+    0x4967b191, 0xb16b7f1c, 0xfa850359, 0xf8cad6e8, 0xec8d08e6, 0x59c82330, 0x86627afd, 0x28e9daab, 0x67d52436,
+    0xe2ac95d8, 0xb9015a43, 0x15e80aa0, 0x29721ef6, 0x9677b030, 0x35940848, 0xd63e8c9d, 0x351a0313, 0x7f8fc681,
+    0x34e57823, 0x52515564, 0xd834ebbe, 0x8dfa3ce5, 0x6f572947, 0x2f174c8c, 0xd7e919a5, 0xd0d970c8, 0x4fe42fa9,
+    0x3214e3e4, 0xd8936f03, 0xd38db567, 0x7c29cb4f, 0xf6257d39, 0x5c065baf, 0xefe6255e, 0x88da2ce9, 0x2e16ec46,
+    0xfcef6a1d, 0xe1b02b8a, 0x971e3d83, 0x340ae725, 0xdcd77616, 0x836a6d55, 0xba478746, 0x2abede00, 0xccb94c2e,
+    0xd010d04e, 0x154f28db, 0x5461fba8, 0x09666baa, 0x697fae45, 0x1dcff8e9, 0x46b154a3, 0xc7c91ab9, 0xa467715c,
+    0x0aa020a4, 0xd075bd9a, 0x7ad8a641, 0x11a9eaa8, 0x6f298a1c, 0xc7303180, 0x4638c946, 0x2e64814f, 0x07937bef,
+    0x9b4324a5, 0x8ea76d5c, 0x686e667e, 0xbd83ce6b, 0x394931f1, 0x447a1bfe, 0xa4cc4f0b, 0x72762bd6, 0x4bc9b299,
+    0xc21a7c63, 0x025a37b9, 0x7712637c, 0xae402638, 0xed12169c, 0x515e1324, 0xad388867, 0x13c01940, 0x97fea327,
+    0x27a09be5, 0xd1a52c37, 0x656fa21f, 0x4ddd40c6, 0xa7c66fe6, 0x1ab2dfd3, 0xd19cb225, 0x1489b389, 0x8f9ae842,
+    0xd3da037f, 0x43dfe8c3, 0x1beff226, 0x73a4b143, 0x724052c3, 0xea9b1b0c, 0x133567f0, 0x6dfc58b4, 0x4f78cdc2,
+    0x63b217e6, 0x62e2ac32, 0x433ce2cf, 0xcfa7487f, 0x8facf052, 0x8ce4b2b1, 0x6225f7f7, 0x2ab1dabc, 0x1c80bec1,
+    0x06eab75e, 0xa586df6e, 0x5bbca8c6, 0x7e10bf8f, 0xf49d5d5c, 0x7b7aa072, 0x66fd9972, 0x4722d3c9, 0x20628631,
+    0x920d6e22, 0x337e7dca, 0xd65f451a, 0x6d6eee04, 0x5ad86d55, 0xbde011ce, 0x237b3f36, 0x1ce3c964, 0xe4332869,
+    0x5724a4b7, 0x3705a9d6, 0xe7b47b21, 0x8193189a, 0xe9b47c7c, 0xe53d7a0c, 0x93bf2297, 0xb28934af, 0x0eaaac60,
+    0x77dcc6ef, 0x11a20fe5, 0xc5eb96b4, 0x5c74927b, 0xe8f4bf26, 0xbb61eafd, 0xe7b74a40, 0x70e588c0, 0xdd3a5f89,
+    0x5e69cc54, 0x0f960107, 0xfab1aef0, 0x3e58b1be, 0x87041330, 0xd9e580ef, 0x6f7b3f5f, 0x8d53c2aa, 0x9bfa66eb,
+    0x1013d5df, 0x3c4bf1fc, 0xf9a53973, 0x08f1ce49, 0x7f28caa1, 0x56c89ae9, 0x9ec6fa3c, 0x2b28bfef, 0x0b331f11,
+    0xd94e1c15, 0x8fe4fe9c, 0xa4879d84, 0x438d0cfc, 0xb6704b5f, 0xfb11ec4f, 0xbb1fa27d, 0xa12406b7, 0x56298c96,
+    0x039b145a, 0x8b487338, 0x463c19db, 0x486fe798, 0xe17047d7, 0xc6cb4de7, 0xc17283a2, 0xe8ec6d09, 0x62b52ebd,
+    0xfe922652, 0xed1e72f4, 0x56e9d697, 0x6cb2467a, 0xde8dd18f, 0x8d552a2b, 0x1adbe5f8, 0xf5a4684e, 0xb9b87bcb,
+    0xe3b63b5a, 0x7dc9e5b3, 0x18c04264, 0xd05db611, 0xc1123931, 0x554c7bfc, 0xb3354e70, 0x15b2bdc0, 0xc13c90de,
+    0xb3f9212c, 0x05065064, 0x6f7e4f6a, 0xb230a8ac, 0xafc06196, 0x626578fc, 0x8eaad2c9, 0x5e6012ab, 0x730bdac3,
+    0xd7f3e9aa, 0xe2a846e6, 0x776481ed, 0x735e3ebd, 0x77db7192, 0x1b15cd0e, 0xc933cabf, 0xe1b6c906, 0x548c2da0,
+    0x8f9363e9, 0x11e6504f, 0x6ef19803, 0x36d2071c, 0xce0966c3, 0x7e811f35, 0x3f87fb13, 0x97771c4b, 0xfc26f57f,
+    0xbd0346f0, 0xe839a13d, 0xb5377036, 0x8e0ddee3, 0xa8b416a2, 0x62318f05, 0x08cae41d, 0xe5f2121f, 0x52939d59,
+    0x03b33031, 0x8f8ae94a, 0x0184ff8b, 0xac95d623, 0xa181aeee, 0x1a453685, 0x00f0f333, 0x64c25b6a, 0x99259e86,
+    0xf5e9fabc, 0x1b1e70d8, 0xd36ad6d7, 0x2063ff61, 0xb111138e, 0x13dbc2cf, 0xfeeb74ce, 0x33b41811, 0x894f12f3,
+    0x7952a307, 0xf1abd6ce, 0x4a039bef, 0x8f4cc102, 0x91f47356, 0x7c753fef, 0x0cbe1c94, 0x00493d48, 0x497235b8,
+    0x4d85f089, 0x0032a4be, 0x796b81fa, 0x3f235021, 0xab5b18fe, 0xd3cbe040, 0xf87a0217, 0xd3d3dc53, 0x21f9ddc7,
+    0xca7ac635, 0xdbd25553, 0x8c958d7e, 0x15cedd71, 0xa9793024, 0x12509b48, 0x888cb7b2, 0x1cd9acae, 0x274e2982,
+    0x333b496c, 0xdd64d085, 0x929fc5c7, 0x8f7ffc45, 0x5afddcda, 0x9ecb7fae, 0x09cbfc8a, 0xb6e32db9, 0xdb622118,
+    0x444dd377, 0xb3b6a34b, 0xc8857faa, 0x6ced7f5f, 0xbade9c5b, 0x5ddbab3f, 0xeeb6dd39, 0xdd6629cf, 0xeb726db6,
+    0x549a94f1, 0x63d3a647, 0xe61454b1, 0x21bbddb4, 0xde185688, 0xd848c30f, 0x61b2e6d5, 0x8fa92e76, 0x4a12dbc4,
+    0x7f3f5c5b, 0xd35a7bb7, 0x80b83b62, 0x487f14df, 0xbd768ef6, 0x251b9eb6, 0x88566ac5, 0x951500b3, 0x4897da96,
+    0x809c2d56, 0xc76b88b9, 0xef2d6ccc, 0x0170c749, 0xae9c7dea, 0xd1575d93, 0x02a099c5, 0x58e6b760, 0xd3219757,
+    0x9cdb4ee1, 0xf0f0ec22, 0x280ee29d, 0xfcfdcba4, 0x91f237bc, 0x85349612, 0x1fd38aee, 0xe3792055, 0x204bce7e,
+    0x2f50b539, 0xa2082d5d, 0x68128731, 0x84e1a93e, 0x78e48d85, 0xf9dd0570, 0x59f0681b, 0xa1284be1, 0x543cb643,
+    0xa7462589, 0x19905dc2, 0xe20a0cac, 0xcfb815cd, 0x62010ea7, 0x603a5d9a, 0x4dfc7b67, 0xc6104ff2, 0x628835cf,
+    0x1ae664b9, 0xbf2529f4, 0xf7b64a26, 0xfaae18ac, 0x6a07d075, 0xf6396e8e, 0xf3181ce8, 0x1f66f06e, 0xbc3d791e,
+    0xe68b4cac, 0x6a328b68, 0xcbebfa49, 0xd7f8cf70, 0x094bca45, 0x346edc19, 0xf291b889, 0x2fbcc4d8, 0x4355da3c,
+    0x050b9863, 0x430de159, 0x1783245e, 0xc9fb02d2, 0x37dd8ac3, 0xc9ff15e6, 0x04d8b7e2, 0x9a6e011b, 0xd535cee2,
+    0x58b189dd, 0x555b6be9, 0xf4163d2b, 0x7f1fc2f1, 0x2d915c6a, 0x1c454c6d, 0x722f0dd6, 0x5084c3fe, 0x95cfe57a,
+    0xf43ccc64, 0x4aea8c07, 0x0efe38ee, 0x395629a0, 0xeb481b9d, 0xcff69b54, 0xf55b121e, 0x842542cc, 0x5d947fcd,
+    0x10d8fba1, 0xdfe72d91, 0x4ba9e691, 0x2829eafe, 0xe1c7a58b, 0x91d1c5d8, 0x334c1a76, 0xfd8a76b3, 0x098aaa29,
+    0x7208b0a7, 0xd218c592, 0x4391c86d, 0x5492be67, 0xfac44e7b, 0x4a87c6ab, 0x9f57521e, 0x6079edfa, 0xc0eecba8,
+    0x8ea4658b, 0x9826afe7, 0x16a739fd, 0x323364f5, 0xdbcf0f8b, 0xbab72a26, 0x72e88b4e, 0xcfcf322d, 0x77b781fa,
+    0xf7914ec6, 0x13d21517, 0xa680ed44, 0x36b0f5eb, 0x4c9db0c8, 0xdbcc6d16, 0xf53ddcd1, 0x7208d83a, 0x13f086dd,
+    0x2ee7684d, 0x73e98701, 0x8aa905c5, 0x82ea2156, 0xe3081ae4, 0xde619f03, 0xa371e0f5, 0x64bd7d0d, 0x18d5d09b,
+    0xbbbc7c03, 0xe6a09c22, 0xf8ca08e6, 0x67c06127, 0x4d8b9f91, 0xa3907d27, 0x85fcde07, 0x7673f42f, 0x9c73bc59,
+    0x0bf57423, 0xd36d6041, 0x1ba9a920, 0x5bf62d1f, 0xd1b43b6d, 0xc0f66b26, 0xbf91a7e1, 0x3d8cf29e, 0x662919ab,
+    0xba5cfad7, 0x1b36a896, 0xfa65809d, 0x251a3cea, 0x8404698d, 0x0b369623, 0x8e1f646a, 0x724c6598, 0xb3fac1ac,
+    0xbcded676, 0x0231d169, 0x6282bd49, 0x4a4d72c0, 0x5b83671b, 0xc0520cfa, 0x97e95cea, 0xd46c9aa1, 0x24f1022c,
+    0x3bdd4e67, 0xd992e377, 0x42022263, 0x1745f402, 0x0630362a, 0xcbdbb2fc, 0x241c8bdd, 0x69a394fd, 0xfd00d732,
+    0x12b58f8d, 0x15930aab, 0x3f84b134, 0x1bc70718, 0x36a6ee7d, 0x0cab7f94, 0x37a5016a, 0x0f8d4c24, 0x605bbf2b,
+    0x07dced77, 0x63df0a1d, 0x5de1ab4c, 0xbde15af7, 0x45740088, 0x6a764623, 0xeb2d907a, 0xdba11b38, 0xcc2c9adc,
+    0xac5406e4, 0x98e56b32, 0x6c1ba4c7, 0xd1aa0d23, 0x369f05b2, 0xc0b39e86, 0xe4e57dd7, 0x1d07cba8, 0xa7d2fe35,
+    0x3402689f, 0x6e19bafa, 0x95a60808, 0x1d950f67, 0x0566e996, 0x10bff093, 0x79bd02c4, 0x5efdfec0, 0x5f720f43,
+    0x32905ff8, 0x46b5e254, 0x331095d5, 0xec2a57b8, 0x8d01738b, 0x76a4456b, 0xfeee7136, 0x47bf7fcb, 0xb8ff6125,
+    0x982ce0fb, 0x44bbacf5, 0x455c045c, 0xf3bfee37, 0xe640b4ac, 0x5876a207, 0xb094f750, 0x700280f7, 0xcd4e5aaa,
+    0x192d32c1, 0x7b88271e, 0x1809ebaf, 0x6d2d1180, 0x29033f92, 0x94f9d2a2, 0x2c4fc7d7, 0x68a6a4d9, 0x0cbc4252,
+    0xb630c039, 0x4792c6ce, 0xaec12f46, 0xe19e655e, 0x50b8f263, 0x12924b43, 0x1b1c3fbc, 0x56fd78d9, 0xce4f9c6f,
+    0xc97d3a72, 0x57164293, 0x383349e6, 0x4da649c4, 0xa9b07b93, 0x002f0215, 0x8667924d, 0x9678fe5c, 0x5863f10f,
+    0x3dac9893, 0x333f3965, 0x1b97f6d9, 0xfc1bd6e3, 0x2f6d4ed4, 0x5ed2146a, 0xc2869c7b, 0xdc8517ee, 0xd93174dc,
+    0x7251189a, 0x61a47cf2, 0x1f13f6bf, 0xd60de9d9, 0x8057d6a8, 0x256ea754, 0x76f4c1f6, 0xc226d0f1, 0x348dcd66,
+    0xc2c16483, 0x4bccf223, 0x65932c09, 0xf921c760, 0x9701f9c2, 0x6ed64405, 0xc1be4cd9, 0x0482fcaf, 0x67730fd5,
+    0x888e7491, 0xed718690, 0x30910aae, 0x096f2b8d, 0x6bbc1aba, 0x306b570c, 0x571efe8f, 0x093d6c01, 0xaccb915b,
+    0x99dc5a09, 0xb52f70b8, 0x7648f1c6, 0x2b04e824, 0x2ca77886, 0xbc686f14, 0x8dd47cf9, 0xc5b455a2, 0x6b54c4ff,
+    0x435822b0, 0xb363f3f1, 0xaa7b2fe1, 0x183e0d79, 0xbd217836, 0x860a657a, 0xcfaaba5d, 0x4921caf7, 0xe04077cd,
+    0x05e08eb0, 0xa1fcef95, 0x5234139c, 0xf7b84530, 0xbd952da6, 0xff58d551, 0x6206e740, 0x22ab63a9, 0x0779e9c3,
+    0xfe004d07, 0xa3d3d042, 0x9b676242, 0xbaa2389e, 0xd970c818, 0x5f83ef64, 0x0de0a7d7, 0x0ef6c037, 0x9d4699ac,
+    0x5a767b89, 0xaf183388, 0x57f6c505, 0xdf5a7e40, 0xcf9114be, 0x53865a32, 0x15c54f5c, 0x63e27f0c, 0x3de9d1e7,
+    0x93eabb84, 0x5b39b8e7, 0x0dfb7aa9, 0xf9c76d31, 0x2a5cf2ef, 0xbe732937, 0xccc6096e, 0x0638b3e4, 0x8d566db0,
+    0xd8e9772d, 0x6c382968, 0x4ecb0f98, 0x06523de9, 0xf5244029, 0xac495b9d, 0xa0f71785, 0xa14bbab2, 0x7c350e40,
+    0xd1899b1d, 0x9bf2be21, 0x6bfcf76c, 0xe89ba755, 0x4b539ec2, 0x4782b7f8, 0x35bad3e0, 0x0d2afdde, 0xe6e0e887,
+    0xd904a9bd, 0x587b79dd, 0x28068eec, 0xf2636924, 0x16b120e2, 0x7a4f8ed3, 0x98c66e8b, 0x760ce279, 0x9cab4acd,
+    0x5c98476b, 0x2e6c8733, 0x77363f05, 0x77b4320b, 0xe709738a, 0x6f8e6555, 0x43977b55, 0x5fd66d5d, 0xbacbbacf,
+    0x3a01488b, 0x1f7fa3db, 0x1f5c74c7, 0xa2280cb7, 0x6dc23df1, 0x76188040, 0xb7520e98, 0x27f609b1, 0x8464a1f2,
+    0x390f131e, 0x00aba320, 0x6993b755, 0xf835e9f5, 0xafb233f4, 0xcb2df6d2, 0xdff73539, 0x4a043a50, 0xab604522,
+    0xbd29217d, 0xaa1fd306, 0x25aa3034, 0x8fbe28f0, 0x7b98ce11, 0x2f24af1a, 0x14684ae4, 0x6b25d5ee, 0x34da8373,
+    0xf06d6d3c, 0x777e6d18, 0x6ba5eced, 0xc0a4b5a6, 0x5ab0abcc, 0xaf440cf5, 0x896a2d85, 0xe3b11137, 0x77aabcdf,
+    0x7bdbb646, 0xc9b9078a, 0xf31e1cc8, 0xdd7d4665, 0x527ff25c, 0x8793d647, 0xaca83a8d, 0x3685ca40, 0x93f8fc43,
+    0x2913341d, 0xc7960568, 0x3233122d, 0x808b98d3, 0xd720b914, 0x69ae737f, 0xf87c6d2e, 0x80a2c7fd, 0x0608f2f0,
+    0x3680e884, 0x29f6cd01, 0x56187725, 0x2085187b, 0x8913383e, 0x395c450b, 0xf3fc52a2, 0x2e7f27b8, 0x696c019b,
+    0xa364bd1a, 0x10f05fd6, 0x728c9fd8, 0x5f06f31d, 0x5d007555, 0xe73ce03a, 0xc4d2a5ee, 0x34be22c8, 0xfad15aba,
+    0x168dbf55, 0xa7955245, 0x06c58db6, 0x54e35ce4, 0x73d18f16, 0x04c1bc42, 0x7dc7dd93, 0xd3b72b0a, 0xe6da13c3,
+    0x61d6629c, 0x9df21798, 0x23b22f09, 0xb25cf714, 0xb5a08a85, 0xceedb3d5, 0x90e1fe76, 0x8f3f977b, 0x4f700f1e,
+    0x80b65b93, 0x9032a160, 0x706224ed, 0xd638c829, 0x8ab32fe4, 0x9b2780d5, 0xcd623098, 0x9755b4b4, 0x9b89c326,
+    0x1c85ceb3, 0x32690907, 0x4e3f4733, 0x6f9b9419, 0x4452df1c, 0xfeb4a8cc, 0x50b3656c, 0x0ace5d73, 0x4dab0009,
+    0x256dafc4, 0x11625c41, 0x62240a7c, 0xd43cf11a, 0x235e46e6, 0xcce2f4d6, 0x393b77cf, 0x75352a0a, 0xd1461009,
+    0x1aee3a6c, 0x6a83821b, 0x486e05f2, 0xc0077ce1, 0x358b6eb1, 0x1371de27, 0xe9420465, 0x6f347ab4, 0xb689fe0b,
+    0x8900ad40, 0xe69baec0, 0xf5fbce45, 0xb0122907, 0x4a82560d, 0x84466f4a, 0x4d54d218, 0x0be145ac, 0x131c6b08,
+    0xd7e7dcd4, 0x97ffa9bc, 0x4f047a8c, 0x61c20927, 0xd3cde6c6, 0x2f5a4c16, 0xfd49d8fb, 0x31e6a7f6, 0xc62338a7,
+    0x68f1678d, 0x27f0bc46, 0xffff55f7, 0x9f382989, 0xef167545, 0xd06393e6, 0xbc6044f2, 0xf2f0c6ce, 0x0ccdd603,
+    0x734ae2ec, 0xc0cb2665, 0x043d24aa, 0x8d111b0d, 0x5b70c59c, 0x244c1bd0, 0x6fb1651b, 0xcf4a6e14, 0xdfe8c3ad,
+    0x77d4003b, 0x1b08fe4c, 0xffe8c8d9, 0xe67c2e47, 0x4caaf841, 0xb19d3c19, 0x5079d2e7, 0x8ca67dde, 0xe3e4abc6,
+    0x097eb1e8, 0x2d42c7f6, 0x3b880c66, 0xb0b6d2d0, 0xf69c1128, 0x7e6c20d6, 0x9d9ba33f, 0x83215307, 0x0a3128ad,
+    0x4b4d3793, 0x3eda96eb, 0x4f7efc95, 0x57a11fee, 0x6995eccc, 0x162176a7, 0xd5a2e081, 0x25f43607, 0x0575208c,
+    0x18316235, 0x829129c5, 0x30426a56, 0x54c377e7, 0xf992eca4, 0x9d82b911, 0x54cc5f04, 0xe57f8aa3, 0x15edafb3,
+    0xa5f5e6c3, 0xd829b472, 0x9123bb6f, 0xa62401de, 0xb053f3e1, 0xd7939a11, 0x4570e3c8, 0xd391f5e8, 0x981a12c0,
+    0xe745a6a4, 0x81a5b292, 0x81bc0fa2, 0xf9352ba7, 0x0e1c814c, 0x6a8feda7, 0x8135d245, 0x3a984091, 0xa0e3b97c,
+    0xe8599d14, 0xc17f5d04, 0x2c6b12a4, 0x28f9a8ec, 0x956ace3a, 0x27c6589b, 0xe91ca2ff, 0xcee36546, 0xf15bda0f,
+    0x9b049dee, 0xfc7cd73e, 0x3051ea52, 0x611eb7bc, 0xcba646f0, 0x3ee641dd, 0x42e7df65, 0xe67249fd, 0x0b62755d,
+    0xec6db8f8, 0xc8ff8e54, 0x51fa22cd, 0xad65640a, 0x4da042c2, 0x27fe1b46, 0xe3b9b3a8, 0x8b6df453, 0xd76421e0,
+    0x294c74dc, 0x686d33b2, 0xb886e4fa, 0xbdc7ecf2, 0x83794449, 0xf23df42d, 0x202162d1, 0x0d3b3f9c, 0x0fa19e61,
+    0x5c944e6a, 0x26b39ffd, 0xbd40f07c, 0x8336c878, 0xf599c93e, 0x8049a9fc, 0xdb9cf234, 0xe3bceca3, 0xe89c769e,
+    0xc05e6cb7, 0x5761469b, 0x0842d337, 0x8e5d9c69, 0x595e54d5, 0x714c2d52, 0xda4de357, 0x19d57c12, 0x22f7c405,
+    0x8ff37ef9, 0xe59177bd, 0xf40e536c, 0x23b55ca1, 0x670feea4, 0x3b421cbf, 0x80d739cf, 0x1ee8e70f, 0x2c7f8446,
+    0xebb55379, 0x5e23760e, 0x2d16d0f9, 0x910274af, 0x3d2fc1c8, 0xcc966ef0, 0x59a197ed, 0xad1065ba, 0xe990ed8e,
+    0x55635305, 0x1391af25, 0x247c9058, 0xa4277895, 0xd09bff24, 0x74d9fd5b, 0xf71968b6, 0xaf7b67b6, 0xd0af1523,
+    0x3e1c5fc9, 0x00074d21, 0x1451a29c, 0x8a97badf, 0x1bf52541, 0xfdb6dc9e, 0x663a168b, 0xe330a63c, 0x4729420b,
+    0xb48957b7, 0xddf6ecc9, 0x4167cab3, 0x8443341c, 0x86aa4cf5, 0x0bbab5de, 0x3ce045c7, 0x6073da9b, 0xc6b96522,
+    0x8857c91e, 0xa292b74a, 0xd83ff830, 0x169065e7, 0x82177a3b, 0x959c44f6, 0x265801e5, 0xa8dbf934, 0xb26ff68f,
+    0x434975ad, 0xe304bfc5, 0x9f549db9, 0xd27467e5, 0x63816690, 0xeee0e9df, 0xe3764d51, 0x6844089a, 0x2ba9d850,
+    0x90d8241f, 0x09bdb75b, 0xeb81562d, 0xbbd0488c, 0x00909f5e, 0x6520ce8a, 0x6db18f5a, 0x0d557742, 0x0044a56e,
+    0xe10a79d6, 0xc69ecf9e, 0x0dcfa2a1, 0x7312db05, 0x9651604e, 0x21853664, 0x071959b3, 0xb8b0cb77, 0x406aa1bf,
+    0x82d67db0, 0x9352b085, 0x5f36947f, 0xc5c4e62d, 0x1d92307c, 0x28c48035, 0xc0aebfaf, 0x2542b54d, 0xa79d97d7,
+    0x54f13fdd, 0xb77054b4, 0xaa461fca, 0x9cd31ef9, 0x38be28a0, 0xd20dc1c2, 0x97be4d9a, 0xfea59699, 0x0c2c6655,
+    0x931e9216, 0xec24eeba, 0x264ef044, 0xfa68f997, 0x917a8cc0, 0x47fe0320, 0x9c27e047, 0xa0e383d4, 0xa7a93e3d,
+    0xd4b4d4e6, 0x8c78cb6e, 0xcf1172b2, 0x9e53324d, 0xde3fc35e, 0xbd6168a9, 0xa4ed6dd2, 0x40a005e5, 0xea97a1bb,
+    0x5197e999, 0xf971e729, 0x6eb6e6c6, 0xf2186f26, 0x956be1c0, 0x198ae0c9, 0xf8837133, 0xc5345061, 0x71523372,
+    0x2c740bb8, 0x6382559a, 0x956212c7, 0x09b22bf4, 0x88915936, 0x9e24e4b5, 0x9966e99e, 0x9b23f80e, 0x07ff318a,
+    0xd8ef7cb9, 0x986eedaf, 0x10ef8dd3, 0x0cff9089, 0x1f257edb, 0x2c237e15, 0x6a7995fd, 0xc43d4d42, 0x138ad595,
+    0x8ffdcb40, 0x55aa67a8, 0x467f1381, 0xe66e83e1, 0xc145d848, 0x34872eb9, 0x3b90edc5, 0x4fd6fcb3, 0x5d3e5045,
+    0xbe079412, 0xc5479a0d, 0x79b05534, 0x747e76d8, 0x31e925df, 0xa87e3525, 0xc4414a25, 0x41ef729d, 0xd230ac7f,
+    0xbc9ec796, 0xb4727881, 0xc82bf346, 0x78ed3d54, 0x9e32c423, 0x9e1a8127, 0xb9fc08cb, 0xd1348fae, 0x9989f1f6,
+    0x5119fa9b, 0x271e6a6f, 0xb501d9f6, 0xbdae23db, 0x02737f5c, 0xc6972fcb, 0xea2252d4, 0x6f02751c, 0xb4a2e2af,
+    0x96ec2c6b, 0x0dcb5ea2, 0x11a521d0, 0xa0bea2b1, 0xaa5fbc07, 0xb2b9a6d7, 0xe74ec9d6, 0x101a5a17, 0x0e00bd11,
+    0xe18da710, 0x38e34672, 0x344427bd, 0x09b07dee, 0xd9ee80b3, 0x1710f3f4, 0x137cefac, 0x3caddfd0, 0x12fb7527,
+    0x4d1e089b, 0xf257478b, 0x1de88770, 0x17626deb, 0x137dda4f, 0x491be67d, 0xac4018ac, 0x44e904fa, 0x71dd7582,
+    0xedee4aae, 0x517c902f, 0x722cad2d, 0xaa77d80d, 0x94f732ac, 0x94a66b9e, 0xa815604f, 0xc1095b01, 0x3ccf402e,
+    0x3c4ad225, 0x610c054d, 0x5da0f8f0, 0x718b0069, 0x19697713, 0x310bbf3d, 0x2b026413, 0x87ca982e, 0x3c51d3b3,
+    0x1c28462f, 0xd9e076de, 0x0a8de2f8, 0x398b5fb2, 0x5e205feb, 0x7f97dc47, 0xf15aea65, 0xf777f2f2, 0xe1cf4860,
+    0x50c4825f, 0x775bc143, 0x591b99d9, 0xfe3b3b04, 0xe2b53ee8, 0x84f9c3d0, 0x67879577, 0xd683455c, 0x6311006e,
+    0x35874796, 0x260ea5c7, 0x279ee8de, 0x4c260a82, 0xf93c65b0, 0x00a93a7b, 0x9e39c181, 0x73207992, 0x49f84f5c,
+    0x0c427642, 0x4a5e3bfa, 0x665e3fec, 0x4a2116f1, 0xb25f4f47, 0xc7187265, 0xbb9976fd, 0x4b5fc70d, 0xaa1ab35c,
+    0xc935f9af, 0xeccd4c01, 0x62ab2f83, 0x5d4ab686, 0x429c5981, 0xdcc8ce86, 0x7da2c94b, 0x0bd1f284, 0xe3bd78e5,
+    0x1de8f2b9, 0x2ce64b0f, 0x4940c79c, 0xbbcd761a, 0x282e241c, 0xe4b22c83, 0x60fce126, 0x36d207f9, 0x57f8f5b8,
+    0xc908ced2, 0xf13f7684, 0x1c16daa9, 0x7881b0dc, 0xcffb4887, 0xeb23ffee, 0x04741745, 0x1a8b440e, 0x2a279e5f,
+    0xe8b87ac2, 0x48514447, 0x1faa4cb6, 0x337e3bea, 0x00a0ca68, 0x84c88fc7, 0x58446190, 0x1e1a3f57, 0xce1bbacc,
+    0xfea594f0, 0x947acd59, 0x6bafa9e9, 0x6965a3eb, 0x0fc46b0f, 0xe0a8aacf, 0x226a56e5, 0xb202ee77, 0x4f0caba7,
+    0x5e9de277, 0x640f1ecf, 0xd758cc98, 0x0f81e2a7, 0xb38f4ac5, 0xd4bb4163, 0x74ed4c82, 0x129beb1d, 0x161cb722,
+    0x8e6dced4, 0x2d8a7243, 0xc8e2801a, 0xce153026, 0x5a1d6568, 0x47e1fea1, 0x3bb72b5d, 0xd7040b68, 0xd17c139d,
+    0xc1d56ac6, 0x3363dd8a, 0xdc5710b7, 0x7711511e, 0x9cbfe5cb, 0x1d42a34b, 0xc2fab8e5, 0x7c865f6f, 0x0213204b,
+    0xfe308333, 0xfb997712, 0xb579ebcb, 0x49c2f396, 0x1bc98a4b, 0xc94935eb, 0x9b84ef17, 0x868bcf75, 0x24012c26,
+    0x668f494c, 0x178b9f6a, 0x6140ace4, 0xcb569d9e, 0x082b6dfa, 0xa6b491db, 0x686060ea, 0xc7a149cd, 0xa1496e1c,
+    0x7d0011c2, 0xdf3a1f77, 0x658df68d, 0xfec13283, 0x1cd3a05d, 0x6946f477, 0x0cd81f71, 0xdd3238a8, 0x35468f1b,
+    0xd09e5e9a, 0x1cd493cc, 0x43c1573f, 0xe020d0e7, 0x6ea79977, 0x77f41bd3, 0xfc6ab36e, 0x1e5b967a, 0x29002d46,
+    0x2997ad7c, 0xa36e36ff, 0x6112f679, 0x77b14bd1, 0x137c351b, 0x50985769, 0xfa014f42, 0x581afa04, 0x85e7efab,
+    0xb9dad285, 0x864c3b89, 0x5c94964a, 0x578ad33b, 0xa310f863, 0x2b7634b2, 0x63da4928, 0xf5bc388c, 0xc2575509,
+    0x221d2fb3, 0x148a2035, 0x9e4eb9d8, 0xc191f057, 0xb2a3325a, 0xbd3e5a38, 0x2427389a, 0x6fd8159b, 0x83ee446d,
+    0xce92ea15, 0x7d73f141, 0x57d842e7, 0x85767cd6, 0x73942fe5, 0x966bb3f6, 0xd6713857, 0xa87d1855, 0xf6f8377c,
+    0xb499e6a3, 0x669a2a74, 0xcff0f256, 0xb31987b0, 0x3ecc16b2, 0x9002b65e, 0xa30d7242, 0x7f6d8394, 0xc873be87,
+    0x9ecf884d, 0x0f809a60, 0x2b06a94a, 0x581c4628, 0xa37088e2, 0xd64a063e, 0xfa366d59, 0x3dbfb501, 0x81b3934c,
+    0xe11b4d16, 0x98981945, 0x851d93ce, 0x4e5f73b0, 0x8713cc4a, 0x990c3e88, 0x3f10dde9, 0x2c741b6e, 0x16ca9e62,
+    0x8a9574c9, 0x5fddd704, 0x91e0f946, 0xe145b261, 0xd6c8e914, 0xd46a195e, 0x836f2b84, 0x888488f9, 0xa0171075,
+    0x5b68e624, 0x69bf7207, 0x97f89c5f, 0xf68bf78b, 0x0e48fcd1, 0xeb49a381, 0xe04b4e48, 0x6c2b4749, 0xa84a84e1,
+    0xe7359ec5, 0x651a830b, 0x9d95b25b, 0x65d139ac, 0xd452f94f, 0x28f3612c, 0x61c87396, 0xe429effe, 0x3ea8483a,
+    0xac2bf450, 0x450615bd, 0xeb94bf71, 0xa759a259, 0x418fadc4, 0x59734a93, 0x7a47a6f9, 0xe1652560, 0x5afb7d14,
+    0xcca9ac68, 0x3516a22b, 0x28d369f3, 0x5d6ea00c, 0xa7c9c0ad, 0x137b9fb3, 0x2c7137c7, 0x733a939e, 0x29a50a01,
+    0x3fa44daa, 0x7160a761, 0xac698f11, 0x1653e030, 0x12d99a27, 0x07a9f12d, 0x45df07e3, 0x010fc0fe, 0xfbc7b3da,
+    0x6d1e6dad, 0xf992a21f, 0x52f3d632, 0x909eed95, 0xb27215d1, 0x732961e8, 0xdcd541b0, 0x28c21d54, 0x0df2b4ac,
+    0xac33143e, 0xa9ea0eaa, 0xcdfa2588, 0xc927571c, 0xca35f8ca, 0xc840a0fc, 0x55b4b757, 0x9434bd7a, 0x2e1ac1e8,
+    0x0a9b1162, 0x8aca7625, 0x034f9307, 0x0491ef04, 0x785d0c72, 0x73b299f7, 0xd17861e0, 0x4323eaa2, 0xd7e0aca2,
+    0xf989705f, 0xc4f09bb5, 0x99fd7f86, 0x271c30d1, 0x27e92bd2, 0x7286960a, 0x255036df, 0x941e2779, 0xdb8eae4e,
+    0xf6adff46, 0x2b49ac54, 0x0a1cef40, 0x1f28d624, 0x8d6162c8, 0xf080d22e, 0xb6bb18f2, 0xa880e3dd, 0xa78846fe,
+    0x4d2fa3ed, 0x05378029, 0xc49b8f5b, 0x2905cb26, 0xd3aeb39a, 0x1629690b, 0xdd1757eb, 0x2ff1f673, 0x9a688a6c,
+    0x1d4d24c1, 0xc9742446, 0xabda29b1, 0xcdaec5b7, 0x295c0d7e, 0xd90ff9d0, 0x978d435d, 0xaf68329f, 0x38bed6ce,
+    0xcff29244, 0xd79a356e, 0x5910c2a9, 0x77e55bd1, 0x505f5a79, 0xd26d9743, 0xe070d255, 0x4e577e72, 0x68f33845,
+    0xc18b2566, 0xa83308d5, 0x022b9e46, 0x2b6f4a24, 0x6c7dfc72, 0xf76630f7, 0xb12f83b8, 0xfbc91237, 0xab95158e,
+    0xf8aa7ac5, 0xd76a5eba, 0x891fbec4, 0xe1cde14e, 0xf5fd0124, 0x123ce625, 0xb2e43de0, 0x65626d23, 0x3333eaf7,
+    0x1f29e299, 0xd6b24c0c, 0x6a6481f5, 0xeb4ad807, 0xd7a16f02, 0x9655eb0b, 0xc22d345c, 0x3bec5fa5, 0xd22848fb,
+    0xb9117606, 0x99d8de15, 0xf58f6e56, 0x7533b564, 0x90ad90f7, 0xa114cff1, 0x7fd502b8, 0xac5a34e0, 0x76e2b46e,
+    0x3e106b77, 0x01e92323, 0x556d779a, 0x18b1a5ad, 0x2d9d2887, 0x54e1bd94, 0x9994a582, 0x59cf2080, 0xe17b5ab2,
+    0xcb1f04ed, 0xd42fe908, 0xcd00aec8, 0x820a5c05, 0x229bee59, 0xc8446595, 0xc9dd9716, 0xdbb9653d, 0xd55f6f4c,
+    0x2183da6c, 0xf615fa3d, 0x88b43107, 0x85f645a8, 0x3436b234, 0x7e553a12, 0x2cef38fa, 0xa738eed6, 0x011e4dd9,
+    0x915ccf5f, 0x20b174c9, 0x25215972, 0x30b7a4cd, 0x2129f05c, 0x29ea8163, 0x13f81c91, 0x9045309b, 0x2064548b,
+    0xf91efa18, 0x579d0262, 0x24c3d838, 0x8b3be565, 0x553939e8, 0x31d0c06b, 0xd314be9d, 0xb6c246d2, 0x114f9e12,
+    0x1d8c0eef, 0x57c98e18, 0x50116040, 0x0778bbf1, 0x30d91dd9, 0x948b14f4, 0x1cd63672, 0xd72dbc14, 0x72c165f4,
+    0xadfd0381, 0xdfee0594, 0xfd8f9a78, 0x29cf2f71, 0xe25469be, 0xec88ecda, 0xaeda0c7c, 0xa4b9957f, 0x5dc1a43f,
+    0x3a77b4e7, 0x62ad807f, 0x04a337ea, 0x9b506605, 0x0379c816, 0xdb7feb21, 0x9702e194, 0x50f3c880, 0x437398f9,
+    0xdb172038, 0x19658647, 0x0cad25c4, 0xdac606c6, 0xb84181d5, 0xb0dd73f1, 0x19065c8a, 0x51f1f7f8, 0xbee06590,
+    0xc89c841d, 0x0c5e131e, 0x35468f66, 0x99cb53ce, 0x406283a7, 0xb2452b5a, 0xc707ab70, 0x74fe1adf, 0xa0e5107d,
+    0x9c00f3bc, 0x24396759, 0xa768b114, 0x5f43e28f, 0x81aa7895, 0x66a389d3, 0xb6fceb34, 0x04ce34fe, 0x3f3905e3,
+    0x5b1cfb92, 0x60cb41c7, 0x737fb221, 0x2a083549, 0xbb8d21a2, 0x1cdf9641, 0x79f3099d, 0xb43db075, 0x7ea7dedf,
+    0x715888e7, 0xd1e4685a, 0x7287bcf9, 0xccdd9a60, 0xbccecffa, 0xbafb6e86, 0xf14a9b3e, 0x61e07c8e, 0x82918d5e,
+    0xeb7d33b8, 0xd556421c, 0x15973a1b, 0xb90c91db, 0xa28faa1e, 0xc75b5121, 0x22dd0094, 0xa1b18fde, 0xc31376fa,
+    0x05ca884a, 0xa5ebb379, 0xf63ac40b, 0x8466e9df, 0x40fbe81e, 0xe48eee20, 0x439b3381, 0x49b7ba18, 0x4219a400,
+    0x5b54e97f, 0x1f080608, 0x72f70697, 0xead22ab7, 0xc8882403, 0x4a225667, 0x6fed4907, 0x9cc37375, 0xcba56457,
+    0x94f85aaf, 0x9530fa6a, 0x3c478d49, 0xbc802dbc, 0x128a1538, 0xfc7e6e7e, 0x56baafa0, 0xeee4137d, 0xe0eaba4b,
+    0xf64fcc01, 0x42bcc451, 0x31d11845, 0x3eec0754, 0x14e34422, 0xcf9564f1, 0x14c28626, 0x4c0d2afc, 0x3b7ac641,
+    0x2e20cbae, 0xf977574e, 0xad3d0f5c, 0xdaa9c35e, 0x2f2e7b3f, 0x887c91b9, 0xf719e901, 0xd9376c89, 0x08adaa13,
+    0xac741cdf, 0x8649efca, 0x8ba0702a, 0xcd6aaa37, 0x2e79f9d9, 0x1b8fbe04, 0xf6749bcf, 0xc5cc75fd, 0xb26605dc,
+    0x84c6a553, 0x0c7e811d, 0x4b8181fd, 0x2674568f, 0x94896210, 0x0d6e87a6, 0xe0480f9e, 0xaf0b04f0, 0xaacd4ccc,
+    0x18cec985, 0x20969a9e, 0xb190cf4a, 0x7add1f18, 0xc036fbee, 0x4245caff, 0xc344905f, 0x1dfe6053, 0xbf0601c0,
+    0xa44ace0a, 0xab6273c9, 0xf2a88c45, 0xd23b8264, 0x34c2ec26, 0xce570e10, 0x0e4630bd, 0xe3eb4789, 0xf665b661,
+    0xe057977b, 0xaa193923, 0x3017954f, 0x7a711b1e, 0x20583480, 0x2532da05, 0xad78e090, 0x3667ca4c, 0x066b7657,
+    0x2567444b, 0x194ec9e0, 0x2edb827f, 0xb1401823, 0xc26cd9ff, 0x6fd7f641, 0x39d2f320, 0x0f0fe22a, 0x742dfee5,
+    0x1ad7277d, 0x6f766d1b, 0xcc88dedf, 0xfa95ff25, 0x67c42dd6, 0x66e510f5, 0x6ed71be4, 0xf265a559, 0x8997aab8,
+    0x4a86abbe, 0x4f047175, 0x59b00f4a, 0x82ba7234, 0xd3a81753, 0xac92292b, 0xe3fd3b24, 0xf6b2c4a0, 0x4c596b11,
+    0x3f742cd1, 0xbb15f74e, 0x56eea259, 0x8b79eb9c, 0xf1de113d, 0x1c3d3dbe, 0xca8ef39f, 0x61b6293a, 0x4e4b74c7,
+    0x319bcb75, 0xf2e48f4b, 0xdb0c8439, 0x285a9edc, 0x97f4e07c, 0xea8c9801, 0xd84438c9, 0xc2def1ce, 0x99f34b3d,
+    0xbb37d944, 0xd632c6d3, 0x28044d93, 0xe200c371, 0xaa8479c1, 0xa188b88a, 0x4b2dbfea, 0xb8e34345, 0x8db34bce,
+    0x329595cb, 0x2905e1bf, 0x007235a3, 0x2a2acf97, 0x0a3171de, 0x3669135e, 0x987358ce, 0x8d692801, 0x8bd03049,
+    0x82a3cecf, 0xbe44d6c5, 0xceb2802e, 0x165d24db, 0x51c801b8, 0x6b84e02c, 0x13261123, 0x46a3ab66, 0xdc50a6f7,
+    0x7c4e95cb, 0xc7a14e17, 0xa03965bd, 0x7fb68aec, 0x2f268d3e, 0xcd6f095b, 0x4ced2018, 0x7b7c3c76, 0x36e8a0c4,
+    0xa53067cd, 0x9469b12f, 0x86ffd9c7, 0x909e84cf, 0x591fb34d, 0xcbec6274, 0x014513ba, 0x3b5ab3a3, 0x1e0ff7a6,
+    0xf99c8df9, 0x41ea2e46, 0xa8124a99, 0x9a61e6c9, 0xd0b0f054, 0xf711d3c5, 0x6214952f, 0xc7bef68a, 0x627ad183,
+    0xb624fcaf, 0x63db7bec, 0xc5c62329, 0x718a79a4, 0x4786d2d5, 0xd198f724, 0x92577935, 0xd9905b94, 0xb9ba3a88,
+    0xa9acd4ee, 0x51ce62c6, 0x2c8c5296, 0x108c38ac, 0x26a82778, 0x27100ed6, 0xc5e83fd7, 0x2a86e960, 0x411cb773,
+    0x5593844a, 0x82586d69, 0x63b05c37, 0x0fd2b681, 0x4de2d032, 0xd40b3d86, 0x1ce8e784, 0x93ed3415, 0x04bb6556,
+    0xdf10fdcd, 0x7fbc8586, 0x1d9a55e2, 0xe48c898c, 0x89a26ac2, 0xd598f771, 0x89e57236, 0x472d887c, 0x01757ad2,
+    0xe98aea11, 0xea51243d, 0x26ccb359, 0xd7ad5777, 0x856017b1, 0xdbdd8f54, 0x5fd25865, 0xff70f445, 0x5e678fc1,
+    0x9143078d, 0xd1001d25, 0x5fb99d91, 0xebdb4a7e, 0x299eed15, 0xf804a8e1, 0x0060b0ce, 0xc8826df4, 0x64fdc4bd,
+    0xa20a85a9, 0xabe218a0, 0xbaeb1d06, 0x97454c3a, 0xe73584b3, 0x2ed4d6d0, 0x075bbe2f, 0x2b066332, 0x5057711d,
+    0x3ea562de, 0x12f19209, 0xddebb68d, 0x9d86f1c3, 0xe67b0ad3, 0x483837a4, 0x8e24bbc2, 0x821478a1, 0x4504b886,
+    0x8581b62a, 0x2602bcd1, 0x22767bf5, 0x3f38761c, 0xd36c62ef, 0x59a75948, 0x5c8770ab, 0xd8c91bae, 0xd58cd2a2,
+    0x1f516691, 0xcf073d87, 0xda7b5736, 0x815e48e4, 0xae93d68d, 0x06dda188, 0x31e9a44b, 0x5d2b4be9, 0x59fb358b,
+    0xb7651551, 0x25516ad9, 0x5c6db49e, 0x6f313106, 0x2ee99099, 0xb77931d6, 0xac758546, 0x04a8349e, 0xd42ff0ca,
+    0x5ac6ca2d, 0x6009589f, 0x4822185c, 0xa06f4d80, 0x4bfec3f2, 0xacd318bb, 0x4e192596, 0x6714b64f, 0xf9825e58,
+    0xfe638a1c, 0x5330cd6d, 0x7ffabff3, 0x70e1a4b2, 0x611c1d6a, 0xb89a15fe, 0x5694fa37, 0x4a2ada65, 0x696bb9d0,
+    0x1cd3f89b, 0xaeb299d4, 0x7c9a6264, 0xe34b24e8, 0xef82fd0a, 0x37d159b0, 0xbb7e06e7, 0x0331a8b3, 0x154efd07,
+    0x11f499e1, 0xb2c94bb2, 0xf2651a86, 0x12263988, 0x628934c1, 0x5f2f7a3a, 0x9a188b7e, 0x18eef4b4, 0xf772ac27,
+    0xcb3642ea, 0x85647a9c, 0x92d99844, 0x6243dab1, 0xdb2cc472, 0x5af6e61d, 0x0879293a, 0x289022b7, 0x775dfbd5,
+    0x2c88d058, 0x303864d9, 0x31cd279e, 0x99109b7a, 0xe9dbbc82, 0xd9f20e02, 0x35a3f5c8, 0x89bcec41, 0xf9b8e1b5,
+    0x7ba2247b, 0x6c36b6c0, 0xff4684a9, 0x20e180d1, 0x1a26f5af, 0x3f029167, 0xc6286578, 0xea671668, 0x7dace0b1,
+    0x9fbac223, 0x07bbed79, 0xa5265f64, 0xc9484628, 0xece44e21, 0xdf2b347c, 0x5d82bffc, 0xfd955ff3, 0x4e7ef717,
+    0x9d3fe9f9, 0x7f32f83c, 0xf00c221c, 0xb4fd09d2, 0x67a02906, 0x777164a8, 0x32d47c14, 0x63a69faf, 0xd284948d,
+    0x0afc1749, 0xf938e7f7, 0xde2679f1, 0x168f8dfd, 0x4783b9d4, 0xf2e3b92f, 0x35006c0d, 0xef93e013, 0x82259e83,
+    0x82f4ca07, 0x4e3a1329, 0x2a443a9f, 0xd9353c37, 0xb2379bf8, 0x77bf23d4, 0x566e873d, 0x1bba9d69, 0x39764f4a,
+    0xccb87f8b, 0x14e2c0b6, 0x7d0f1de4, 0x0ef8d912, 0xbb53ab97, 0x47669e07, 0xea29ce01, 0x43a79faf, 0xaed6704c,
+    0x64868c06, 0xbd82b7ad, 0x629a3f4e, 0x5afa0b51, 0x4ab84053, 0x1a7194be, 0x1b0a8b74, 0xa9d72c5a, 0x75a2e829,
+    0x0f9c49b7, 0x44321f10, 0xd37cfe07, 0xc5033924, 0x1f05eea4, 0x171aee5f, 0x549d29e3, 0x4169e2f0, 0x50042885,
+    0xbc246839, 0x38873ef7, 0x70e71270, 0x2c89bee7, 0x0b0717c6, 0xe4fce65c, 0x4f759dd4, 0x646cef04, 0x3b91f684,
+    0x3a3cb522, 0x52ee1abf, 0xbcdd918c, 0x9b47ceb4, 0xdedf4465, 0x0581d548, 0x04f6a22a, 0x7e3ac534, 0x1ace5460,
+    0x292e9b3c, 0x888a7ecc, 0x111bd10f, 0x99a6c0d0, 0x37cdb16c, 0x8b7a4425, 0x4bb67439, 0xc6ff1f52, 0xcdbb6907,
+    0xfb2c5f71, 0x3b950fa1, 0x0c2d4968, 0xd22eaf28, 0xa64eea0e, 0xe8f970f3, 0x7fd2e257, 0xb715cde4, 0x7dd46897,
+    0xf8289696, 0xbf8a043e, 0x4afa1921, 0x79282c60, 0x23f8c563, 0xac172d8e, 0x400bd37f, 0x9aac6ca3, 0xadff1bf1,
+    0xe38bacf5, 0x87996d7a, 0x54a2cec0, 0x2726dcf4, 0x17c7c9d3, 0xe67e7b39, 0x33663023, 0x538177a8, 0xdd0a4e50,
+    0x1236c4fd, 0xd2e3dc27, 0xf03115e3, 0x7e2023b1, 0x2f7776f3, 0x43eace5c, 0x4cb71de9, 0x3a578723, 0x96330541,
+    0xd66d57a2, 0x79f5e600, 0x1b0bb439, 0x1fed0086, 0x48b9e355, 0xeb8e91f7, 0xabde5122, 0xac4ef5f8, 0xc4594b5b,
+    0xae8b0108, 0x9a83c393, 0xc13dce78, 0x86e71171, 0x1ae2b8b9, 0xd99d9607, 0x4632f1c9, 0x43f4892f, 0x96dc92bc,
+    0x9c0da8f2, 0xeb8b79f9, 0x4207a730, 0x5b41afb7, 0x52fac629, 0xa78fa6bc, 0x0b43422a, 0xdd67e117, 0xcd3887eb,
+    0x40f6f403, 0xbf52d1f6, 0xcd3fde6e, 0x6e201eb3, 0x62038e71, 0x2e4a0950, 0x34794045, 0x66261bf5, 0x91428efc,
+    0x8d7d1036, 0x2b72f182, 0xa66c5063, 0xdea7bca6, 0xc8035e3e, 0x06faa4a1, 0x26722e5a, 0x082c86c4, 0x2a20a5d1,
+    0xcece0551, 0x843be80b, 0x6a17fac9, 0x2caaaf1a, 0xdd865166, 0xb33d96c9, 0x536f1d97, 0x4763c816, 0x165d9809,
+    0x3ad92896, 0x018e14be, 0xe31a780c, 0xe206ea16, 0xb1d37e70, 0x125e4b64, 0xd825cc67, 0x0b065f7d, 0x4e6b7e9d,
+    0x4c6a5492, 0xca0726b6, 0x49c15c6a, 0x51402531, 0x803e3a93, 0x786e0349, 0x090fdaef, 0xe5491043, 0x75afc300,
+    0x71a6bc29, 0x65efd0e0, 0xa15d5345, 0xfb744e2e, 0xc13dab30, 0x23a06cac, 0x359fe5fa, 0xa9e0d9e8, 0xbc01ce45,
+    0xdf7e16a9, 0x5340688c, 0xdd4fe1b6, 0x4ca4ee01, 0xe2dec18a, 0x41caa48d, 0xdd0032ba, 0x71014307, 0xe07bdeb1,
+    0x291c3ba6, 0x12620de2, 0x3d5a6519, 0x2343bc8c, 0x7a8c0e28, 0xf2b6e2ff, 0x479e66ee, 0x9a0025b8, 0x77fafe4f,
+    0x01a4eba7, 0xc6faa1db, 0xbd4f4ffd, 0xd937e0f9, 0xfdf68d03, 0x1061f0ea, 0x6c8be0ba, 0xeed88a46, 0xa8b9b97a,
+    0x2760b9bb, 0x322b6aa0, 0x48052305, 0x7580cc1d, 0xfd19f871, 0xc52bbc84, 0x127ee0d6, 0x2144e28a, 0x9f448e8f,
+    0x9b5343ea, 0xa70a7097, 0x5d38cf2f, 0x2d03e9ae, 0x0bb96210, 0xdef9d77e, 0x2b49e626, 0x4fbd0cdc, 0x7eb0a5c9,
+    0x6d03d59d, 0xc25d0147, 0x4697a2c0, 0x7cdece15, 0x782ee508, 0xb939f2c5, 0x9e981855, 0x6aca0cad, 0x336cce92,
+    0xf030ed89, 0x8cafa7c1, 0xf858c121, 0x2caf1b16, 0xe2dbb97d, 0x6031008a, 0xbb42b6eb, 0x59847b8e, 0xb7debb32,
+    0x2c12f199, 0x9a4c7332, 0xfe985aea, 0xc037cbf8, 0x1e33b2d5, 0xc594a03f, 0x641f9d99, 0x7db1568b, 0xa5c947b2,
+    0x23b12c1b, 0xbe44d91e, 0xc04a8000, 0x1659ca3f, 0xd8b46e15, 0x068c9405, 0x209dc7ee, 0x4ed8962a, 0x4f8dd62f,
+    0x2ede1fc4, 0x244f61de, 0x83daffb3, 0x2b28d968, 0x38dd7b55, 0xd0e6cd0c, 0x1172da17, 0x41f64cbe, 0x3f500d0a,
+    0xeaeebf8b, 0x4f80bcf6, 0x29d9172b, 0x2af6b598, 0xe3a18caf, 0x3dfd77e6, 0xa0d941a0, 0xa3fd9f0e, 0xd6dfd70c,
+    0x5c3f81b3, 0x3d644f24, 0x60082d32, 0x5d4c0676, 0x3afffe89, 0xc80b5547, 0x9d943943, 0x424430a2, 0xb3a4e5c4,
+    0xf5bb2144, 0x1084d92d, 0x7ea3e332, 0x38898888, 0x20cbca4d, 0x18981394, 0x1a26b427, 0x3c5e8685, 0x24715561,
+    0x1a295c97, 0x1728a499, 0x1b6bfa0e, 0x1bca92d4, 0xa8fa7663, 0x717bec98, 0xc4853dbd, 0xd66347bd, 0x6463e22c,
+    0x7a4285c3, 0xc1e2a6d8, 0x2a0bd15b, 0xee10dd49, 0x778cb87f, 0xeb947afc, 0x1e4b04b1, 0xd266e525, 0x8f135d6b,
+    0x19dca368, 0x35abe51d, 0x5d573ee3, 0xfa87b390, 0xece24f0d, 0x3f4dfd79, 0x3a142d98, 0x3ce76539, 0x7987ae45,
+    0x1a617d01, 0xf9eb0345, 0x80cd6931, 0xcfc2e446, 0x6f7d679e, 0xd74de4fc, 0xb660598f, 0x02301c57, 0x3dce6e80,
+    0x65ddbd03, 0x87cfb833, 0x09e5b257, 0x4c501c23, 0x2b28ac94, 0x285b2e98, 0xc6e0c877, 0x76050f1c, 0xe0072456,
+    0x3425366c, 0xc63cc4d6, 0x4d17229f, 0x1f0a4b09, 0x9c7d5a73, 0xf4824cc1, 0x54081524, 0x568fa70a, 0x96635ff8,
+    0x334a7f1e, 0xab1e2a6f, 0x8670c1a9, 0x1192fb9c, 0x0ef31f27, 0x48c7c3b5, 0xa5d44259, 0x011ecaed, 0x570ed039,
+    0x683d1c5d, 0x7ba418f5, 0x81c26577, 0x6df4b105, 0x242fad3d, 0xcf156af5, 0xfb93105f, 0xa98747d6, 0x9d0f32a6,
+    0xbe5f648e, 0x2c9ab4d0, 0x104aa52e, 0x5ccd3fd2, 0x2f59ffed, 0x5611296a, 0x1d66712d, 0x03bac541, 0xaa365585,
+    0xc47c8c84, 0xdda5852e, 0x927ed385, 0xadaacd30, 0x4bd93d89, 0x44542438, 0x26f49cf0, 0x217837d6, 0x7921ff3e,
+    0xa3015037, 0xeeda0115, 0x2d21c8d0, 0x1a111c99, 0xf9ff1a25, 0xd5d404fd, 0x36e4bd8e, 0x075907a3, 0x540a2cd9,
+    0xdd1fce2b, 0x8a88a2bf, 0xf8c1bf16, 0x189c5844, 0xf2020a2e, 0x04b5c0e3, 0x3e574918, 0x3d1dda73, 0xe518d1a1,
+    0xc043786e, 0x323a26b2, 0xcec1b5d3, 0x65d87d34, 0x1e7d2702, 0x905dd1bd, 0xa8395ee5, 0x249a5ee7, 0x4fd5e4a2,
+    0x0d89e747, 0x56d0b3bf, 0x1e52255c, 0x374a0d96, 0x20715cc4, 0xb7100457, 0x32523fbf, 0x4b4ee063, 0xab73fb91,
+    0x24760e62, 0x340091a8, 0x272a129c, 0x03493240, 0xc9d1c52b, 0x40cfb5f9, 0x41bcd22f, 0x23454170, 0x6565c3e2,
+    0x177de95c, 0x930d9d2a, 0xca789491, 0x5427787a, 0x7c483e30, 0xb4b4bc0c, 0xe539b3a1, 0x6fc8e8ec, 0xf027efd5,
+    0x55975b0e, 0x7ebb63e5, 0xa56acbc4, 0x18278a25, 0xa6f6a9e5, 0xbe14dfdc, 0xd2065f4e, 0x3de7c689, 0x2bc9ced2,
+    0x2e5b5983, 0xafbdc2cc, 0xb03596bf, 0x40916d4d, 0xc83a5411, 0xa8c2da53, 0xe6f73f3f, 0xea89ced3, 0xf55dba4a,
+    0x1ee6bbb8, 0x0a9892a7, 0xd56006f2, 0xec138a8d, 0xd01d7ed0, 0x1e4ea83d, 0x8be0c1d9, 0xcfa0b005, 0xf532b9f0,
+    0x80563984, 0xb3a59038, 0xb23e08cd, 0xa5a470be, 0x4bba6dca, 0x1dd6348f, 0x1c49403b, 0xa1853f27, 0xb7b99d57,
+    0x81160a99, 0xe9ea5ec5, 0x08e38190, 0x8ef5f4f6, 0xa8295bee, 0x3011a30f, 0xdd3e6935, 0xb58906e2, 0xd78aa7e2,
+    0x4f823fec, 0xb2ad6be8, 0x3873af4e, 0xe489245f, 0x4c7c95d7, 0x64e3e4ce, 0x8f812234, 0xe34e2e8b, 0xb8e0690c,
+    0xf93594c2, 0x7c247776, 0x4663978c, 0xdca98fa6, 0xf4fbad3a, 0x3bf1d597, 0x8859952f, 0xf9b7f6ed, 0xb2a31f3a,
+    0xb4b93325, 0x379f5037, 0xb905c1bd, 0x19c30685, 0x24e4a7bc, 0x6bf23fa1, 0x95c1100b, 0x519048b7, 0xace71e73,
+    0x3a79dabe, 0x2e28741e, 0x81c69dea, 0x21d4fb3c, 0xa0e6f814, 0x24b96f4d, 0xb987ddb7, 0xe7ee4975, 0xc6581e75,
+    0x1b9f5be5, 0x45d5c546, 0xb8249841, 0x30c5b565, 0x1cc86c3a, 0x5337600b, 0x83784964, 0x513d5024, 0xbe69f80a,
+    0x79790f15, 0x5223ac8b, 0x9f14b51a, 0x6d0a302e, 0x3a403446, 0x5db50618, 0x261660c7, 0xe6f00b11, 0x3977e572,
+    0x06d23287, 0xe87aa100, 0x7653d8a2, 0x8ad07029, 0xdc0f04ae, 0x3edec3be, 0x56048113, 0x6f234b20, 0x5e87f1e3,
+    0xc782d926, 0x0c265d6a, 0x72d032b6, 0xdd15a724, 0x1c1d52f3, 0xe367698e, 0x4294ef0e, 0x4143e789, 0xe82ee7f3,
+    0x212fc9e6, 0x1ad603c5, 0x0f20a3d1, 0x61e50210, 0x0fdc8bcf, 0x5932a583, 0xf1b56bf8, 0x5bb67d8b, 0x8ba45140,
+    0x6ee508d9, 0x7fd68f47, 0x23a808c0, 0x4a168099, 0x58e53eea, 0x703eaf95, 0x3ef2658f, 0xade384a4, 0x6138e01c,
+    0x4a15a496, 0xd29305a0, 0x9f21018c, 0x93cfb677, 0x662c1ec0, 0x7cd8b90d, 0xfd9af42f, 0xb2248ee2, 0x0e9d53d3,
+    0xb0367499, 0xdee4eb92, 0x60e27ac0, 0x815cd91a, 0x8ae80ac4, 0x5ef42cd6, 0x60b28a74, 0x86a6a326, 0x271f96ac,
+    0x185b53fb, 0xbb329cdc, 0x75bbb1f3, 0x7a70adae, 0xfca41b74, 0x7a9f7778, 0x3fcd20dc, 0x6bcb966d, 0xae0b1f48,
+    0x9c11bb2e, 0x45a6aa0d, 0xb6bb0544, 0x50ea381d, 0xadd09811, 0x34f6f98f, 0x050828cb, 0x15ea3717, 0x424faca8,
+    0x0a07673b, 0x449b2062, 0xd7ee65cd, 0x41d2381c, 0x0343e106, 0xeb9f6633, 0xb38be08a, 0x2af63bf3, 0xded57c0f,
+    0x24951246, 0xadf66c46, 0xdd2b97d3, 0x0b31f6e3, 0x3fe85ce2, 0x02a157bd, 0x7125b2a6, 0xa8ed921b, 0x8fe635b7,
+    0x5675e045, 0xb2484af8, 0x309db473, 0x2d593fe3, 0xfd18c533, 0x5ccbabab, 0x816d939b, 0x3a8d7d2a, 0x18a1046f,
+    0xa70f7f07, 0x8ebfd848, 0xdb04cb5d, 0x18679d68, 0xa7c46dc3, 0xaa43d48a, 0x76f0ea38, 0x9f00b75f, 0x4d93ab58,
+    0x97a11726, 0x7279dac2, 0xdf4d15da, 0x46713ffc, 0x772e838e, 0x6a741427, 0xea4d6225, 0xbc28a5f2, 0x020c9ed6,
+    0x3340a141, 0x1b49858f, 0x0c1a5bbb, 0xc79c5877, 0xe9c40b9f, 0x7c8087ec, 0x50fa6e2a, 0xd71d3ba2, 0x3612d60e,
+    0xb32edccb, 0xde625545, 0x9dd1884f, 0x32cdc3b5, 0xec61ac1f, 0xfebd821c, 0x7a172cb5, 0x6e7f9bcb, 0xf45be6f5,
+    0x5db0286c, 0x775a8031, 0xfe341cec, 0xcfe4063e, 0x38beb50a, 0x8419ce45, 0x17123771, 0x8400db40, 0xc3efbead,
+    0x8f5b9513, 0x95344c32, 0xc6dccf4d, 0xa921693f, 0x7050fef3, 0xc49e00e2, 0xc9f5c993, 0xb5ced0e8, 0xac6ba2e6,
+    0xf267773d, 0x63c05f7e, 0xe0ee9f17, 0x2245f10c, 0x829b5bdf, 0x8bc83629, 0x1d3e6a58, 0x1494f0f8, 0xdbea3303,
+    0xa0a6cf33, 0x4160089a, 0x74a2d125, 0x52bb0fb0, 0x4c870caa, 0x251d0e27, 0x77785b1f, 0xf170652d, 0x24354645,
+    0xb35d8108, 0xc6634f94, 0x7682e399, 0xe2d57a0a, 0x98839a66, 0xa12f68be, 0x88e9a2b7, 0xd9f0f4d5, 0x4bcb26f4,
+    0x094c9319, 0x97a12c3d, 0x948b809a, 0x17831f90, 0x7296b7b4, 0xf5e22d34, 0x8108ee08, 0x58283fa2, 0x3f85f63c,
+    0x78848d7c, 0x62926dac, 0xa4d6bf26, 0x41de0d3d, 0x8ed651f9, 0x89cf3df5, 0x492f7e33, 0x2065bf13, 0x3dd3439f,
+    0x8366c69d, 0xc03505e7, 0x07afc857, 0xcd19bf4c, 0xe95ffcbd, 0x5139567a, 0x52bef3c6, 0x5f9dd084, 0xb5768d78,
+    0xf1f4149d, 0x666fc892, 0x932c27d7, 0xec5ff1bc, 0x50d6bac3, 0xbe1aed17, 0xa34e01b8, 0x4aaef768, 0xf3448a73,
+    0x55c860bf, 0x106f33c7, 0x48da17d2, 0xd9df6c2f, 0x70b625b6, 0xf9959a38, 0xb47b0ebc, 0x25200988, 0x29d0c4da,
+    0x819c572a, 0x2b5100fc, 0xcb44efbd, 0x38693bf2, 0xd4701a28, 0xa6cb31f6, 0x5e048628, 0xfb20df8b, 0x451f55e6,
+    0xb1fa0194, 0x5c5632ec, 0xe164d3c0, 0xa91ce4b3, 0x4268adfb, 0x5dd8d8db, 0xf4bdc713, 0x08b68c32, 0x858a64c6,
+    0x0f3a6c8a, 0xd31d93ec, 0x33a2ffb5, 0xdd5a453c, 0xfd5ea415, 0x1c7ec15b, 0xa3146722, 0x7b74e9c7, 0x9f3ca02d,
+    0x1014cee2, 0x3050bf74, 0x051aa679, 0xa05b36fa, 0x4fca0622, 0x6d4f3eb8, 0xc6fa90e4, 0x06a9e646, 0x1d2378cf,
+    0x4d9117a4, 0x684e320e, 0x21be1a49, 0x7c268ab3, 0x7901e6bf, 0x6158ec15, 0x32a261bc, 0xdb41b0fe, 0xb68ff7db,
+    0x51420568, 0x51269cab, 0x45553971, 0x3cfc4ab5, 0xe0968f5a, 0xfda23f36, 0x478abac8, 0x4fe0b545, 0x470471f5,
+    0x24b1ec26, 0x41a00925, 0xd85e79fe, 0x108eb2c5, 0x964de8ff, 0xcffe493d, 0x417eeabe, 0x8c48badf, 0x2203ad1a,
+    0xbc9d7ebc, 0x469a811c, 0xfda71c4c, 0xeb617574, 0x778fa89d, 0x6404ca45, 0xea7eb4e2, 0x75011f37, 0x259f9823,
+    0xa95eb2b5, 0x200166d7, 0x929b967b, 0x3dbc6c8b, 0x887e3bbc, 0x0e91ac6b, 0xc927b046, 0xc3a82d99, 0x14a19cc6,
+    0x648cc1c3, 0x545c6e37, 0x8c89cbed, 0xec54264c, 0x6cbedefa, 0x6431e9ad, 0x9af873f3, 0x1afa08bf, 0x516852a7,
+    0xa7baf26b, 0xc4d35289, 0x3650dc4e, 0x6c83c079, 0x46f19780, 0x2716adcd, 0x268bc16d, 0xd765b804, 0xc4c7d8d3,
+    0x6fbbed76, 0xaead230c, 0x2fcd30ff, 0x920d1001, 0xcb199b70, 0x8279380a, 0x8f1e5676, 0x691aee5d, 0x023367a8,
+    0x40ce04cf, 0x80b28330, 0xecec8f0e, 0x6ddca04f, 0x1b026ee9, 0x8633dded, 0x503fb2e2, 0x7bc3dea4, 0xc981b9f9,
+    0xa38bab35, 0x7bb8521d, 0x6077d00a, 0x1e70f876, 0x445ec589, 0x14eab75b, 0x150140a3, 0x9360a30f, 0xbf687993,
+    0x7bfbddbd, 0x634eb082, 0x5ab9a810, 0x98e6eb0e, 0x2df7b610, 0xf434274a, 0x7e1daaac, 0x58fde125, 0x381f1a3b,
+    0xddaf7c09, 0x7d1b2c52, 0x929c5f34, 0xc69398aa, 0xb53fb5a1, 0x918b135c, 0xaf8f7f25, 0xef3476ce, 0xafb1afaf,
+    0xe5596068, 0x200697de, 0x33be5fc7, 0xa145571b, 0x2c6d26ed, 0x535de201, 0x9e813ece, 0x9128fffc, 0x77d1ad44,
+    0x9befde34, 0xea4b41dd, 0xba7a4913, 0x21e95de8, 0x1e96f7ec, 0x9eec5aa6, 0xe07ae5c8, 0x658d87e2, 0x3d4660de,
+    0x6265ab64, 0x9ff7f78f, 0x4820939a, 0x08fc266d, 0x462eec75, 0x08fc11f2, 0x7af25830, 0x6ac78ee5, 0xc041f5ae,
+    0x69c84975, 0xc51efc7c, 0xc8281c6f, 0x26ade9c0, 0xa6242968, 0x5f10dc76, 0x1db88c5d, 0xff7d9f17, 0x65bbfbca,
+    0xd2805666, 0x432e4d9b, 0x8381d503, 0xa76ddbef, 0xdb1964ee, 0x4c029133, 0xd695f2fe, 0xae161af9, 0xc50e05cc,
+    0x75c8ed93, 0xe3437ad5, 0x08ae7237, 0xf9675c60, 0x8fe0e99f, 0xcadf4be7, 0x3ebf7612, 0x3550d3db, 0xc7c83ef8,
+    0x7c1e1759, 0x00dbc66b, 0x5cbac9d2, 0x3597b922, 0x1e1e3355, 0x10d99744, 0x3f9ea0f7, 0x4ab57ad5, 0xa881ac18,
+    0x10e0d659, 0x24ae9767, 0x1c38f619, 0x39aa2d20, 0xf4fd7219, 0x7155a3ff, 0xce8d6dee, 0x4f475409, 0x16f7efc6,
+    0x0185c15f, 0x935ecca0, 0x4cf071ef, 0xf3af7b49, 0x70c86b7e, 0x41775d25, 0x5a37ca16, 0x008daef3, 0x5100a039,
+    0x2fd53c38, 0x78eaf679, 0x8351fd1e, 0xd7bfe854, 0xac9207b9, 0x87b05ff2, 0xc6f31901, 0xa50f7afc, 0xffde3ca6,
+    0xde079fe7, 0xaee223e5, 0x6e23524f, 0x84951bd9, 0x8c64c52c, 0x66774c4a, 0x4925b493, 0xe4b81421, 0x6b0e1383,
+    0x3a81a959, 0x284861cc, 0xf4fa345a, 0x5d4d1245, 0xffc68fcb, 0x4e6facdc, 0x188ac395, 0x19b13157, 0xd876951e,
+    0xdd995ca1, 0x76549427, 0x2b0b5610, 0x2c1ca852, 0x919a1742, 0x77df8800, 0x7286f2ea, 0x1f4c4b2e, 0xfc014ac7,
+    0x2221d628, 0x4200b9d1, 0xa699d550, 0xdecc521e, 0x920481d9, 0xdade7765, 0x75864446, 0x3e6d147a, 0xfe124883,
+    0x147d8f51, 0x8de7a9d5, 0x1efccd37, 0x30e0c188, 0x9fd328b7, 0x7e6f8ca4, 0x6ce9253e, 0xe3e20b27, 0x4737676c,
+    0x9ea8c3bb, 0x66ac3dcc, 0xc12f6e8e, 0xdb83bd19, 0x77002024, 0x1383a74d, 0x833a1e0b, 0x9f747ade, 0x5d842867,
+    0x8a651fe6, 0x660bf5b4, 0x6126caa4, 0xd288949c, 0x0a375ccc, 0xecefdc8c, 0xb86eafbf, 0x72a24aa5, 0x3e0cbdbc,
+    0x203f0ff8, 0x6d34682f, 0xfb360c80, 0xad7de30e, 0xbd6469c7, 0xc99281c3, 0x83749f4e, 0x6dd204ed, 0x22df29fe,
+    0x3a760d8f, 0xc1d29859, 0xc6f41bcf, 0x426e8dd5, 0x0a78dd67, 0x5697b4cc, 0x54464f5c, 0x4b794a08, 0x629cd208,
+    0xba6e9f7e, 0xe45f8d89, 0xaa9990e8, 0x65362efe, 0xb4b0d1a4, 0x4e94c74b, 0xbe4d4b69, 0x80329293, 0x669848a7,
+    0xd48f3bae, 0xa2e33679, 0xeeb4e514, 0x1370c897, 0xd5c02f6e, 0xefcb0f04, 0xec9bb166, 0x3f7387fd, 0x0cb5e0d0,
+    0xa4e48913, 0x7d21a83c, 0x479b2298, 0xe21c68e1, 0xc4754c09, 0xc712fe03, 0xa06792bc, 0x91b0647c, 0x2917b0b1,
+    0xba84f212, 0xfdd43daf, 0x05978ba0, 0x1ba0a877, 0x59295846, 0xf5eb7c20, 0x27f89e64, 0x9b704292, 0x7fe3bc7a,
+    0xd64ec3bb, 0x591e3eb7, 0xba4bf60f, 0xa0b4812f, 0xeacdbe70, 0x35eced66, 0xb786faf5, 0x116de8e7, 0x5ffc5824,
+    0xdb2b200a, 0xc73fc05c, 0xd6bcaaae, 0x0b4bbf04, 0x788a06ff, 0x63e7a530, 0x6cd36863, 0xd99977df, 0x4a99afd8,
+    0x41f3190b, 0x083e4441, 0x4ba88689, 0xfa0ef62d, 0xd9bccb42, 0xfc0797f7, 0xb3dc581d, 0x4cb1892b, 0x2f7e1498,
+    0xcd9215ff, 0x79ae278f, 0x59838b3d, 0x7b1737e0, 0x54244f7f, 0xb72a52bc, 0x2372985a, 0x12241d53, 0x6adc8539,
+    0x9711abd0, 0xd8b24f36, 0x01980a3a, 0xd8b59f84, 0x75086d69, 0x62b3966c, 0xd01343a6, 0x6eca5c0d, 0x549577f5,
+    0xbe111715, 0xd701d42a, 0x05a1bdb0, 0xf278ef4c, 0xae31e504, 0x6ed7bdee, 0xbf4c349f, 0xa74eb3ea, 0xb71274f9,
+    0x91a56ca9, 0xbec35738, 0x9739f40b, 0xc005cbfa, 0x82cd5983, 0xee0cf47f, 0x4469cf1d, 0xd2aef6dd, 0xbcd7b016,
+    0x986e82fe, 0xfd978861, 0x10c210d2, 0xfcbef2c6, 0x64f9f6ed, 0x15328bf5, 0xd9e50897, 0x457abbdf, 0xc85b4203,
+    0x159cdf7d, 0x6fe38deb, 0xbba6e24c, 0x08771461, 0xbefdd29e, 0x5ca06667, 0xcefecb37, 0xc90661ad, 0x5e14f4dc,
+    0x74f49c9f, 0xda7c7d89, 0xc54fb68b, 0x043b3db6, 0x4c577d46, 0x5785334c, 0x52fc2178, 0x9a0c4c9d, 0x22a6fb86,
+    0x6762809a, 0x916c206c, 0x0be02f2c, 0x0dd94a9f, 0x66ecef06, 0x59a72d52, 0x4d3ddceb, 0x24c99b74, 0xec1bd3ed,
+    0x280e6a89, 0x3fde1fe8, 0xc841196e, 0xdcb4ae66, 0x20e61c69, 0x226a87cf, 0x4ab88f39, 0xcdb51598, 0x1007a046,
+    0x500958da, 0x46dd3be3, 0x7e9e433a, 0x973e279c, 0x35d9cf50, 0xeb26cffe, 0xc471c52c, 0x039ce931, 0xe0f97b52,
+    0x4360a983, 0xf5ce202b, 0x21200db2, 0x32aade18, 0x53afc633, 0x2469d2f5, 0x89d24d88, 0x3bbb8c80, 0xa791e6b9,
+    0xbec46474, 0x70f70413, 0x6ffd6368, 0x3c16cf1c, 0x41d2c391, 0x470bbd7a, 0x5f32bbcb, 0xd56672f5, 0x0199fcb1,
+    0x21d9bf1a, 0xd03cf321, 0x1369cff2, 0x0ef098db, 0x00eedf16, 0x2e133a49, 0xd7b7de5f, 0xe2eb3b2c, 0xf4519b3a,
+    0x0c62b78c, 0x9464783e, 0xdf71e28e, 0xd6bb3b8c, 0xb36cf127, 0xdf5ab111, 0xd0ef39ea, 0xa5721896, 0x3a8b8e81,
+    0xa77fc3c0, 0x3eaa5f4e, 0xbf5566ce, 0x95b6d489, 0x24246e76, 0x3bc2d37a, 0xbcdf8d25, 0x3ebe7a59, 0x7f610c91,
+    0x7736bcdd, 0x75bc2424, 0x85c70d05, 0xbeb7ba24, 0x4423de3b, 0x228f9f73, 0x7c01c1bf, 0x9f0d29a4, 0x61a80872,
+    0x3ec5601f, 0x27ba04c4, 0xd7a5024e, 0x71452235, 0xfb211dc9, 0x61aa93d6, 0xbf25696f, 0x22b2f2a2, 0x969488a2,
+    0x82dff5ba, 0xcfe623fd, 0x88329b88, 0x4cccb4ba, 0xb76482cc, 0xe5023477, 0xa46a3894, 0xbe7c5404, 0xd1fd3901,
+    0xe6bbe2ce, 0x0c4f1b4f, 0xacc9b278, 0x3db561f4, 0x332dc3b6, 0xf38df13c, 0xeae891c4, 0x8f00c6d3, 0x778f1d35,
+    0x99846b91, 0x5f3096ff, 0x4a87ec24, 0x7c7c7bfa, 0x47ee71c1, 0xb372259f, 0x572c7bbb, 0x9fac8e01, 0xbc3e5e7b,
+    0x0a98ad4a, 0x8724098b, 0xb65b4238, 0x08816daf, 0x0ba64183, 0x50cc14e1, 0x42895df2, 0x8858e739, 0xcbe17ba9,
+    0x1b74d24f, 0x4402d400, 0x5cc6ed20, 0x279a68ce, 0x7127622f, 0xb430e865, 0xe15ef496, 0x0ebe1de7, 0xd28793ef,
+    0x1e95ce31, 0x753f0cb8, 0x9bdb6bfd, 0x5ecc4ba1, 0xf4421461, 0xadf6bdfd, 0xc01bd28e, 0x4419125c, 0x2d7d94e3,
+    0x5073c54a, 0x96aeece3, 0x840a2b99, 0xb24aa255, 0x38345e2f, 0xf34125d6, 0xc761e37c, 0xb5ef96ce, 0x11d2d1fa,
+    0xad59d51b, 0x360870ab, 0xbfcdf45d, 0x480e2047, 0x0dfda9b9, 0xdae944f9, 0x6f03ee85, 0x3b6f8dec, 0xed9fd4ce,
+    0x2cfd70f7, 0xcb88d469, 0x5935984e, 0xa8d78801, 0x341df785, 0x020e6c47, 0x65f12cef, 0xdec04f23, 0x03e3fe4e,
+    0xdd3008ff, 0xada46c49, 0x85e22f56, 0x278bb9f1, 0xfdcaa6b5, 0xaf47c5c9, 0x01381941, 0x3f60c1f6, 0x67f8da0e,
+    0xa5939439, 0x4c0f815f, 0x2a17adbe, 0xed844395, 0xf2574d5b, 0x55e0b113, 0xdc8a1aef, 0x7ec73cd1, 0xb4d868e0,
+    0x56f54288, 0x636cab2a, 0x5b33eb1b, 0x1a4f3fda, 0x613a2cb4, 0x5fac0fc4, 0x082f9f9a, 0xddea4a23, 0xc1484a94,
+    0xa75a8bf9, 0x5575b1b5, 0x895bf61b, 0x7e3d5b23, 0x0c504c94, 0x8f7002be, 0xbb91b010, 0xe0c0e536, 0xdb74aee7,
+    0xb1364dd8, 0x2d7610bc, 0xf0b00272, 0xa69f0300, 0x66e18979, 0x3268085a, 0x4efa9e50, 0xd084d664, 0x360f51fb,
+    0x6b7a7c30, 0x2784ab4e, 0x3783c57e, 0xccf4e91d, 0x53b8639e, 0x194c94c8, 0xfe9f1f85, 0x2c3fd121, 0x5f61d770,
+    0x5eae06a4, 0x58696c5a, 0xfc6871d1, 0x190701f4, 0x6ea70120, 0x1aabebf6, 0x634f5197, 0xee0233f9, 0xa86fec8c,
+    0xf8b401e5, 0x3d41f088, 0xd040ff28, 0x35e174dd, 0x5e62e392, 0x7298867f, 0x4a0141f9, 0x16af8a83, 0xe79ade31,
+    0x600f270d, 0xfba0bc80, 0x963ef16f, 0x1d356ea0, 0xfecd8e0f, 0xbe48905f, 0x4e444b91, 0xb00ddb84, 0x50dc11cc,
+    0x66dbbdc1, 0x9b70316c, 0xaa65c3cd, 0xe4c95a37, 0x16807f45, 0x1c780fdb, 0xe48d9478, 0x551787d5, 0x5a9f9918,
+    0x73d898a7, 0xdfadd8fd, 0x1929933e, 0x68ba46fe, 0x20216b46, 0x8ed90a4c, 0x468398db, 0x3d7c8352, 0x1791921e,
+    0xbb5f1e08, 0x7e566151, 0x1c65b9ce, 0xd9a2f352, 0x81d68bd6, 0x80c980f5, 0xc9fd0a8f, 0x536fc6a3, 0x9e9d42bf,
+    0x82fa063e, 0xcb52fabb, 0x07be95ad, 0x4677fb89, 0x3e6ce045, 0xa3b66e20, 0xc5061497, 0xffd971db, 0x5f535bc4,
+    0x8c327bdf, 0xb1bc1ead, 0xea9cbf9d, 0xcdab1f9a, 0x76b2d7f2, 0xc3c2c476, 0xbffc7ea3, 0x0f2a9fdc, 0x33a14617,
+    0x3fd9bb97, 0x07a1f3d9, 0xec3fabfb, 0xa9ff2d22, 0xf777121f, 0xa64456f4, 0xf7d1bd52, 0x411f3c98, 0x0f55fb48,
+    0x053eacbb, 0x700c0ed5, 0x83b963ba, 0x97cd7698, 0x6f220158, 0xca43ce0d, 0x6b29fdf8, 0x60f1b4c6, 0xd547b235,
+    0x0358ad8d, 0x7ebe869c, 0x5af8778e, 0xe2fbc986, 0xbd1c082f, 0xcd059775, 0x3cabcfda, 0xe2376984, 0x4747e9a9,
+    0xd2373caf, 0xf6a5860b, 0xdfa4021d, 0x69ad5b16, 0x2284c521, 0x59d71496, 0x5f9c7000, 0x0c3b6c91, 0xbb9b4879,
+    0x97582d54, 0xe0724668, 0xe2aeaa4c, 0x331f51b8, 0x6e2ca429, 0xc016e51e, 0x1c42d62f, 0x8b48d470, 0x271ae05f,
+    0x5d90e07d, 0xf8785c52, 0x19a9c1e3, 0x02c97c1f, 0xb78faa43, 0xfbaeb138, 0x10586a10, 0x7dd1bd14, 0x91638d23,
+    0xce1b1a7f, 0x30090d9c, 0xfff154b9, 0xdbd388e6, 0xa7ed52f9, 0x7bd0a9f0, 0x413dc608, 0x23475b4c, 0x3c79bb08,
+    0x541906c3, 0xc25bfe53, 0x8cb22920, 0x396c9527, 0xc6e96e6d, 0xb1d78e9b, 0x978fb498, 0x36cd5f22, 0xac668ac5,
+    0x54dafbfd, 0x593de62e, 0x2e42e635, 0xa881013f, 0xc094af28, 0x0efb8375, 0x11dab52e, 0x2540ed9b, 0xa68eded8,
+    0x7abc5440, 0xde98a988, 0x9002bb36, 0xd84f6337, 0x75555601, 0x34586498, 0xd4dc0ef8, 0x7dd5914f, 0x8d99d5ed,
+    0x4610e1a5, 0x270a8dec, 0x20dcbc37, 0x573da163, 0xc3de4fdd, 0xfed241c7, 0x5f702fdd, 0x69ef7655, 0x13a1d8ef,
+    0xd3b95e3c, 0x1a5980fe, 0xb5319513, 0x9db66136, 0x5087d029, 0xfc5ee0b9, 0x3885f5f5, 0x434657f5, 0x3a93e272,
+    0xd9352c83, 0x210a7dac, 0xc94a6161, 0xbecaaf13, 0xa203a2cb, 0xe4b7956e, 0x33a795ae, 0x3013f92d, 0x7017b2a2,
+    0xe9648991, 0xf666727d, 0x87254196, 0x425e6c0d, 0xdd6921f2, 0xbaab70e6, 0x1950b964, 0x12cc95f3, 0x8588ea02,
+    0x9c309889, 0x226d5346, 0x08c0422d, 0x4aaff038, 0x318e1ed1, 0xb1250842, 0xcd92c239, 0x30ac9516, 0xa41a7cd0,
+    0x439c4890, 0xb3d64c18, 0xe7ef72cc, 0x5bf0e280, 0x0630f64d, 0x976e451d, 0xb76c815d, 0x54779a00, 0xa7dc36ee,
+    0x3e6c2eb0, 0xda42f914, 0x39fcb8aa, 0xca8f5498, 0xd528556b, 0xa7861f2c, 0xb83334a1, 0x302e2414, 0x9daf4e66,
+    0x1e11f170, 0x3a143b9b, 0x853f108c, 0x484f2ea5, 0xeef175ec, 0x31e06474, 0x75c4b65c, 0x454d4395, 0xe88aeb5c,
+    0x90cceb6d, 0x9a8f046a, 0x3561242c, 0xb0495b23, 0x7e91a88e, 0xaae05d29, 0xf6438703, 0xd21ecd9a, 0x2cfbf6ac,
+    0x233fc54e, 0x1ea2bd78, 0x50414629, 0x7b1a2dbc, 0x9a32e01c, 0xbaf19dab, 0xf99405c6, 0xb43a22cc, 0x54c14b94,
+    0xaa3714a8, 0xc6d724ed, 0x3efcfc89, 0xac284f06, 0x01b333b9, 0x5c229bb2, 0xd9438eb6, 0xebbb298a, 0x83f5346f,
+    0x2ca83009, 0xcd6d1575, 0x1d869607, 0xc5844af1, 0xfb1d13bc, 0x0a923b7d, 0x543d836d, 0xce7b47c3, 0x09325077,
+    0xddc69fc5, 0xa84fac2e, 0xf1a34dad, 0x037b9aa5, 0x1abb9cb8, 0x9373b949, 0xb990b1c8, 0xa578cf79, 0xe4dcc060,
+    0x66c03367, 0xd9be1315, 0x4d555340, 0x11929d56, 0xaef2901c, 0xc57fdc57, 0xb93b1dda, 0x803acd41, 0x0a9d1d5c,
+    0xace3a189, 0xb301b223, 0x1bcdef5c, 0xb1e320cc, 0x23f223e8, 0xfd7492d0, 0x8d2de4f2, 0xc9c5a5d7, 0x649a3287,
+    0xf215a122, 0xe08f3ffe, 0x65653b50, 0x941fd735, 0xb3d79d1f, 0x7070d2b9, 0x70ce8d7b, 0x67889ef8, 0x9bdc7d28,
+    0xcaf4f4f6, 0x05fef23c, 0x48b7dc57, 0x8bd7fa12, 0xa52c4ef4, 0x89a79b8a, 0x3ba605e2, 0xc819c385, 0x9e9f9104,
+    0x8d5bcbf2, 0xe4fdf73b, 0x0643276f, 0x790eacaa, 0x13a90024, 0x3f1f28f3, 0xd8bd6ef8, 0xd8f910d2, 0x00c6be15,
+    0xe06016f5, 0xaa221402, 0xa029ff77, 0x7817ba1a, 0xf9ed2c16, 0xe0971174, 0x3e7e3b5c, 0x60cdf284, 0xef759e55,
+    0x4020458b, 0x182d9540, 0x85a32cab, 0x7be4e579, 0x1ea122b0, 0xd350c4b4, 0x8d44340b, 0xed086e64, 0xd411bff3,
+    0xc08503e4, 0x032a0396, 0xd221159c, 0x6f7d68ed, 0x895a623a, 0x0909a5bb, 0xbee06f06, 0xb690e2fc, 0xdbd5cebc,
+    0x265deef0, 0x6f2bf00f, 0xacef4f16, 0x09f65401, 0x1aadd1d7, 0x53ae0c18, 0xde0b4424, 0x936b315e, 0x712cb052,
+    0xef49abac, 0xa3f4b791, 0xadbf41e5, 0xfaa53a83, 0x15f0595d, 0xd9e2cbb5, 0x6db0d781, 0x08a045f5, 0x34d4343f,
+    0xe01bb483, 0x4a069213, 0xf5fbc43e, 0x23769f5e, 0xb305d49f, 0x4afef682, 0x3e557f40, 0xc8f8b987, 0xbe8d4db9,
+    0x39704de6, 0x08cacb6d, 0x97c3c23a, 0xfab89da9, 0xe5dffd65, 0x5d11ab26, 0x5985d8b0, 0x8b6f15cd, 0x3731a369,
+    0x9e616045, 0xbb07df01, 0x7d63bf86, 0xe457c930, 0x8f322cf0, 0xad0245b8, 0x5ff2b4dd, 0xc61bbdfd, 0x6242de03,
+    0xe5b42446, 0xe03362fa, 0x7847fb04, 0x5afb1e6d, 0x0a072803, 0x0d48fc22, 0xa63c500f, 0x6fb7c6c8, 0x539ac025,
+    0x55bdd19f, 0xb9b74278, 0x2e29de06, 0x9e71e2c2, 0x3619ca29, 0x8590bc96, 0xa7de08fe, 0x2b6f54cb, 0x34504373,
+    0xe5ac41d7, 0x764b6ea5, 0x0418a0dd, 0x886cfe9a, 0xad5e90c5, 0xa87ae68a, 0xfaea2295, 0x70bda1ae, 0x24b9d102,
+    0xa05d8bfc, 0x67c23eca, 0x1f9aee2e, 0xb6360e7f, 0x2676e750, 0x62fc7ced, 0xed7e3ed7, 0x61b5e969, 0xa6643ef2,
+    0x13f78cec, 0x55d5c9e3, 0x7d0e1837, 0xd73509ce, 0x9ef54531, 0x53c616e0, 0x8debd429, 0x2de3ea22, 0xc498e68e,
+    0x7287080e, 0x9aeac5da, 0x6edd1a1e, 0x1d6ec11b, 0x6314a901, 0xaaa84229, 0xb134b896, 0xc9d9f8d9, 0x8ff53af4,
+    0xc8bc481b, 0x13ec8911, 0x4236d4eb, 0x975e841d, 0x531f9933, 0xad8706a6, 0x219544fb, 0x1c8dee20, 0x933c2bab,
+    0x181b672e, 0xf9720f21, 0xbbe02e5b, 0xf28d5c07, 0x75c60f36, 0x756f764b, 0xb3c19956, 0xa48053d2, 0x14c8d0a9,
+    0x3f541528, 0xe08a771e, 0xaa208bd3, 0x48aafb11, 0xb5a34887, 0xed4968af, 0xaf4a2979, 0x6d12f3d2, 0x7bf15781,
+    0x3d861eb2, 0xc8d093b5, 0xd4af20f4, 0x8f8bec35, 0x61b78976, 0x6bd7c5e8, 0x1ecf4478, 0x89f76893, 0xdd7fc4f6,
+    0x9575c902, 0x353cbd32, 0x122f2f2c, 0x12799078, 0xe115b5b6, 0x300ba238, 0x9641654f, 0x269c8c41, 0x1ba8dfaf,
+    0xb58b6115, 0xccf81b09, 0xc484018e, 0x53e7f876, 0x33cb516d, 0xa598cd85, 0x96ff6cef, 0x6a01be51, 0x7e6da28e,
+    0xec588f84, 0x50a23131, 0x4705dbea, 0xe4130e37, 0x844f43c1, 0x94a5d756, 0xb28a947b, 0x46b9b710, 0x812b8c04,
+    0x08665e95, 0x0bbe6687, 0x3f5db4a7, 0x0d9d6564, 0xb2cd24fe, 0x435c572e, 0x738a8784, 0x734885a8, 0x7ea18bd1,
+    0x76536b62, 0xf0b48e79, 0x60e8a486, 0x3a97dac8, 0xc8115663, 0x549d5228, 0x93664af2, 0x4170d3a6, 0x51cc64a3,
+    0x47e50f43, 0xfd089994, 0xa7bf3669, 0x27c86218, 0xa2247c34, 0xcb0d4c98, 0xb942ea24, 0x7dafaf03, 0x39c8b291,
+    0xa4dae21e, 0xeaff9c6c, 0x9fbe9c1e, 0x5beed636, 0x458721c7, 0x7897d79a, 0x8997ede2, 0x23408af9, 0xa16a6a89,
+    0xf0d8d1fc, 0x88e265c8, 0xac9199f1, 0x51a39e4b, 0xe4445e46, 0xec2efde1, 0xd7d72398, 0xed2268b9, 0xbf073032,
+    0xb7a5df43, 0x2bfcd0cb, 0x9b0125be, 0x71f9f9c9, 0xcc8182f9, 0xc8df86f3, 0x602761aa, 0x90657a06, 0x6ebd28ae,
+    0xafaf29c9, 0xe34694ba, 0x61b2e8c5, 0xce4e7924, 0x657e0afd, 0x763e45fc, 0xc919161d, 0x7901c017, 0x9c411a6e,
+    0x4f992658, 0x8dbac46a, 0x6aeec55e, 0x890995f8, 0x6dbf896e, 0xef063d70, 0x6e43a93e, 0x463ccd4b, 0x930b8bf5,
+    0xbd0c9edb, 0x1a4f00f2, 0xdad07157, 0x4a53d6f2, 0x4507bdeb, 0x1d66ae55, 0x65cd467d, 0x4457ea6c, 0x7b63a40d,
+    0xcc988b9a, 0xc92f1255, 0xb3620de4, 0x20af699c, 0x2d57af04, 0xb8cebe99, 0xca3386c4, 0xcb7064af, 0x250f7d6d,
+    0x89daab04, 0x1fd4df63, 0x03cc955a, 0xe7b65b0b, 0x9f308231, 0xfdee35d5, 0x67952ae1, 0xef57ba35, 0x26debae3,
+    0x278a27c4, 0xaedad107, 0x029afec4, 0x06be2547, 0x03ccdd16, 0x4ae9edf4, 0x164dc66d, 0x72808858, 0x8266b490,
+    0x6371d8da, 0xbbba9710, 0x3a2f8a5e, 0xb7226451, 0xec0e3241, 0x0c013c22, 0xb7635ba2, 0xdb206d85, 0x939de79f,
+    0x7b6dd4c8, 0xda7ff402, 0x1a13e32d, 0x304084dc, 0x23b85ad0, 0x2c06c157, 0x1687aca6, 0x865b43ed, 0x7861b813,
+    0xb846e388, 0x4ad13c16, 0xb35e3b7e, 0x932870f0, 0xcf4d8779, 0x9bbec694, 0x9544d55b, 0x32d4cfff, 0x151ead2b,
+    0x81f3ddf6, 0x4b2f74df, 0xcced2f0a, 0x3ae10a3f, 0x24172442, 0x64b7d114, 0x3ec4d54e, 0xc5e4755f, 0x439b8713,
+    0xeb061e09, 0x7a125e49, 0x5df86019, 0x8ff08119, 0x8ebed408, 0x14ff71aa, 0x5424b7b5, 0xa7b754a5, 0x7036b5bd,
+    0x75762122, 0x7f42117e, 0x2615c731, 0x4312c4bb, 0xdecee840, 0xedb3e8c9, 0xc3002ec4, 0xac55da69, 0xbd0cf99e,
+    0x3e6601cb, 0x47a1a5a2, 0x3576086c, 0x8c625563, 0x06f203b1, 0x314c44c5, 0x9376844d, 0xa30e3fc8, 0xb7607bb6,
+    0x2770d2f0, 0x2ed305f8, 0x9c508944, 0x2d28428b, 0xf5791986, 0x0bea0854, 0xe87682a7, 0x8dcdd57b, 0x3c5f7f62,
+    0xe2c34ed9, 0x88b943bd, 0x3c526f89, 0xe0a81f06, 0xee7ea8e1, 0x92cfbd53, 0x95106aa8, 0x8d90cd5b, 0x1ba728f1,
+    0x9bc67c35, 0x2899f904, 0xa6c6e5e1, 0x226bc9c3, 0x65abe7b1, 0xdce035f6, 0xd2b61238, 0x02e6e2cf, 0x54c12fec,
+    0xc161dbf5, 0x859f2828, 0x8c5b9e79, 0xa5df359d, 0xef3f1b55, 0xf8d268d0, 0x7d95c48a, 0xb830f34a, 0xccac243b,
+    0x077e7db4, 0x7337f267, 0xffad979b, 0xcf02dbb1, 0x47df9fcd, 0x7463edc0, 0x1709b4a4, 0x133ae09e, 0x18814e26,
+    0xda936a79, 0x1c8ebcf2, 0x62817a87, 0xcddbaab2, 0x9bda2a82, 0xbfb6cd6e, 0x9fa115e6, 0x962464f9, 0xeab20517,
+    0x9afbcac0, 0x9a3a3d63, 0xfc4353c6, 0x146c20e4, 0x8c077d7d, 0xda9010c3, 0xd0c019d5, 0x90389132, 0xd302a79c,
+    0x9cd86849, 0x7c1dcb97, 0xa3c7f285, 0xc08b956d, 0x071dae19, 0x98c219da, 0x8f390315, 0xb646c1fc, 0x868b6c62,
+    0x55ac5af1, 0x7cf83310, 0xd20483db, 0x96d87f7b, 0x1fce67a7, 0x1c1a1047, 0xd88e0c66, 0xbd1c41a0, 0x52f19184,
+    0xcc52d74c, 0xbaaad1b7, 0x3b6a80b9, 0x8d9e2df3, 0x430b51d0, 0xcc687781, 0xc5ca82e5, 0xa42c7fc6, 0xc2f54339,
+    0x28290fc9, 0x8d336d6e, 0xb6d9870c, 0xe855c5e3, 0xb9833e86, 0xf2b92f79, 0xf6471c7a, 0x33d180c4, 0x0905c92e,
+    0xb2717f66, 0x3ef96242, 0xe260069e, 0xc8dcaca2, 0x8d93c38a, 0x065984d1, 0x8d4b8cd2, 0x71796a14, 0xa0a27951,
+    0xb75c9090, 0xdf711621, 0xe35f81fa, 0xd2b3e4fa, 0x3a0c98e3, 0x0137e6ee, 0x62b63d61, 0xc45ac451, 0x3e477607,
+    0xf1aedf18, 0x71141b4b, 0x9a3423c2, 0x0d12214b, 0xf20b8ea7, 0x5c3acde1, 0x912d82b8, 0xcf25a406, 0xfed72e8f,
+    0xdf34f620, 0x3bb37f5e, 0xc0d4c85f, 0x22da59d9, 0xed835c03, 0x2215e8ba, 0x4269e829, 0x734232b0, 0xd812550d,
+    0xe5fdef06, 0x3adc21a2, 0x03061a83, 0xe0d6b05f, 0x6a50fa60, 0x44aebdca, 0x6a90c92e, 0xea62fbef, 0xa5a19b7e,
+    0x53b661d2, 0x2b72b7d5, 0x33217196, 0x76836928, 0x7be63aa0, 0x0f32c773, 0xc868ba8c, 0x02f3820d, 0x8e597e57,
+    0x3176f661, 0x9cf5da78, 0xacc37217, 0x1ee68b5c, 0xab67e331, 0xcaa6630b, 0xf0370aac, 0xe91fc5cb, 0x310772de,
+    0x631a911c, 0xa8edcaf1, 0xbdfdca5b, 0xe1b183d0, 0x522cdb46, 0xba6f3bca, 0x43d88a3a, 0xae8c81ad, 0x9e747a46,
+    0x8d7a6c19, 0x90b234be, 0x62d34c63, 0x46c5166a, 0x39e2f1f8, 0xef97420c, 0xa6ebb2dd, 0x9288a17c, 0xb72f690f,
+    0x4e841141, 0xc1445f84, 0x4b9a5daf, 0x2fd649cc, 0x66cf10ec, 0x995d5f95, 0x8c432bca, 0xcb0f1e0f, 0x99f04a1b,
+    0x5cf2a0d0, 0x6993d144, 0x661f1e8f, 0x00e76b6a, 0x5dc38c0f, 0x7a17eb6d, 0x1998abeb, 0xd390a265, 0x101fe557,
+    0xc371a6f9, 0x1e709856, 0xffabf7fe, 0xa3a9973f, 0x9c2ff899, 0xd8fcbc58, 0x79f04a2c, 0x2d54529f, 0xd5bc8517,
+    0x0aa0a55f, 0x81bc1318, 0xf4e78334, 0xdc842b6e, 0x481c2b2d, 0x3cbea61c, 0xc4f8a9e8, 0x7dcabc71, 0x2e0e55d9,
+    0xe573c5b4, 0xe1497518, 0x0dc84dcc, 0xe4f638f5, 0x36daa4ec, 0x744f9ff2, 0x50399ac8, 0xe662c96b, 0x0d4277e6,
+    0xb0aa3558, 0x946ac393, 0xe17956b9, 0xecae1d0c, 0x391bea36, 0xe4c13366, 0xe348641a, 0x8daca675, 0x8e332d8e,
+    0xd4bd9f85, 0xeaa71224, 0x8a3900ff, 0x30c61fe0, 0x4895d297, 0x27affdca, 0xc20c585a, 0x4303af42, 0x927acc3b,
+    0x67376595, 0xa084f3be, 0x012907c4, 0x6f9a6af7, 0xc6633020, 0x1e2bc30b, 0xa63a1196, 0x42fd5522, 0xae73ff91,
+    0x8755dbef, 0x4d8ac1dd, 0xf597c119, 0x27dfc56a, 0x0fb9fd18, 0xbac68ef1, 0xd6afed34, 0xa1b3cd74, 0x6fb33ab0,
+    0x5c72454b, 0x5b8405b7, 0xafbcd4ec, 0x3a2e13b5, 0xa62a1f85, 0x98364004, 0x42924ed2, 0x5d7408f3, 0x772904c1,
+    0x6fbcd820, 0xc3e94414, 0x1bdef62e, 0x6b245e4d, 0xfd559621, 0x3bbbdfa5, 0xaa256463, 0x6647ad25, 0x32486223,
+    0x2ca43110, 0x3c42f050, 0x47bbcf2c, 0xb57b58cf, 0xed935219, 0x938ce832, 0x6eceb9ed, 0xecab65fc, 0x97089e33,
+    0xd969c2d0, 0x50a6e5c6, 0xb1a71397, 0x8dd5c98c, 0xd7e52947, 0xa11fb664, 0x99970615, 0xfd2bee29, 0xf7a61839,
+    0x46499e62, 0xa4399d84, 0x0b381a1f, 0xba020db1, 0x3c785925, 0xfaf8c847, 0x541c0e12, 0x805d14e2, 0xe1850c30,
+    0xe08f66bd, 0x8ce1bd61, 0x6cad310c, 0x682fcc5c, 0x085cc6f6, 0xaaae460b, 0x2c514000, 0x59d01f17, 0x2ac9a26c,
+    0x5a55aa76, 0x4f4733ef, 0x47fef406, 0x41aee863, 0xe75f6460, 0xb5a56e9f, 0x8f4053cb, 0x9ad2c925, 0x98ac87b9,
+    0xf0515544, 0x6a9dcc32, 0x7586c933, 0x78211f03, 0xd1a314f4, 0x502a63c1, 0xbec4c465, 0xba90179f, 0xada6268b,
+    0x609c949c, 0x6c8a3427, 0xef0e1720, 0x41083b9b, 0x8f3da87a, 0x32154fd2, 0x0f1b1377, 0xce945662, 0x1a5406ef,
+    0xcc26381f, 0x174371fe, 0x3d3dd5d6, 0x53ca96e9, 0xc5c50797, 0xd3b387f3, 0xe3d743dc, 0xce7ceb6d, 0x08c27668,
+    0x04879d01, 0x460ae430, 0xb8cba93f, 0x3ec26cf3, 0x93c36450, 0x3e72f2c6, 0x71d57414, 0x21997e1b, 0xa08e2d17,
+    0xcb4a439e, 0x3c705d2d, 0x3decb54a, 0x0374c52f, 0xbd2843d0, 0x2f176563, 0xce9069c2, 0x38399d82, 0x322adbd6,
+    0x69d4b869, 0x29e62ca4, 0x7e7546f2, 0x55d9e41a, 0x9a19b073, 0x9395d32d, 0xaa711c2d, 0xfeee413e, 0xeaa8837f,
+    0xa2a5f124, 0x76f65a42, 0x8f408ecf, 0x4ee995a0, 0xd50e0c2b, 0xb5d1912c, 0xa7546e5b, 0x68a35392, 0x590892ce,
+    0xe7366e53, 0x8bbe0891, 0x98ef078d, 0x13d0d191, 0x65beb278, 0xf3670a91, 0x2c79024e, 0x136d4540, 0xf8245491,
+    0xb948f4ba, 0x30f899e9, 0x5728c3e7, 0x7ef7d995, 0x30f77053, 0x0558febc, 0x242508fe, 0x99cf48fd, 0x66eaa7c7,
+    0xedfa9de6, 0x7e0f5c18, 0x5d771121, 0xf5b82db7, 0xa0e429d7, 0x70cd4549, 0x0f3cbef2, 0x69bf8f0d, 0xf47dbf57,
+    0x0ca3b928, 0xdc560291, 0xf93603c0, 0x93c6efc3, 0xa160327b, 0x500a3212, 0xca026269, 0x2baf86d7, 0x57373a10,
+    0x43347c1a, 0xcc8f56ff, 0xf25f5b6b, 0x8593adae, 0x66dc339d, 0xc774fb14, 0xe5adced6, 0x287bda99, 0x0daaca38,
+    0xe68cabe0, 0x379669af, 0x7d7e3878, 0x644a6fd8, 0x30d4c6d3, 0x0330d2a7, 0x60d6389c, 0xabaa502f, 0xa9a9a9e6,
+    0x332d8753, 0x9d1eca94, 0xae9193f4, 0xde8cb580, 0x8908e402, 0xe51ffb64, 0x999c63b3, 0xfd617497, 0x05d4adb8,
+    0xf9e9031f, 0x0f96d9b1, 0x1efedd55, 0x3539e07d, 0x02ca7918, 0x70bf53af, 0x55c1ea4a, 0xebbd6c23, 0xb0e7c56c,
+    0x02407354, 0xd59fae07, 0x9a0e7707, 0x9faee3a4, 0xa9a04740, 0x398df47b, 0x458b95d6, 0xba7d39c7, 0x69b21e3d,
+    0x7bd6b6a1, 0xba9ed5c1, 0x3de36cf2, 0x270da498, 0x362c08fc, 0x5e93cb4b, 0x1b874657, 0x54af067d, 0x80cf8b84,
+    0x07b3f079, 0x8b78f266, 0x8060fb46, 0xd7138fc1, 0x3dcb1225, 0x74276fe1, 0x35c7ee86, 0x48a58acf, 0x9d4b83ce,
+    0x95a15bfd, 0x0d70463d, 0x8daf6d69, 0xaccf4cb0, 0xac6524d4, 0xf01d5696, 0xfef5ad3b, 0x67b3f590, 0x527ca541,
+    0xd7154d88, 0xb317fda7, 0x144e5da6, 0xeb9d8888, 0x0b87d22d, 0xa5a25056, 0x550f41e1, 0x13f14b96, 0xdadfd378,
+    0xb461c309, 0xce54ef09, 0x628bdf09, 0x1a9fce69, 0x0e31aeb2, 0xa8e6ddd5, 0x9dffea7b, 0x67f2503d, 0xf0998fd3,
+    0x53334557, 0x766875ad, 0xf6c524f3, 0x100418c6, 0x80c9fec8, 0xb89acab6, 0x6dd3b788, 0x63e733c5, 0x3873c22f,
+    0xa9e3453a, 0x2593fb95, 0x35434968, 0x078da9a4, 0x777320c1, 0xa8f666d8, 0x89cdf324, 0xa0ff45e0, 0x5f2ff9cf,
+    0x1669d4e0, 0xaac4d8f8, 0xf9c4427d, 0x925bb311, 0xd125e6db, 0x61077e1b, 0xce1a8041, 0xf42b2418, 0x19819557,
+    0x67ca9f2e, 0xdc7efcee, 0x5fafee2b, 0x30e38299, 0x68b11bc4, 0xc87c629a, 0x7cfa493d, 0x2f92c9b8, 0x41874919,
+    0x3c5daf5a, 0x321ae89e, 0x35ffd898, 0x5737a9d1, 0xb7e5a503, 0x584a71f3, 0x00f5efe4, 0x7a6856c5, 0x243a8b26,
+    0x7e38efe7, 0x8f4cd2c8, 0x5d5c4dc0, 0x49eb0096, 0x717d2e06, 0x0f94759c, 0xc76b5fcb, 0x5e87c011, 0x65b39b41,
+    0xbbe46cee, 0x10e6bd8e, 0x36cc3c7c, 0x0edf2409, 0xdfc45c97, 0x7f864545, 0x83531e05, 0x9dcda3d5, 0xfd139fb9,
+    0xdba826de, 0xff22c1a3, 0x19037270, 0x3992d5d2, 0x88d0f8bf, 0xdb122b56, 0x0b3dfbfa, 0xc4f12a82, 0x6ab6213d,
+    0xdcc4a566, 0x53211da4, 0x8d77d985, 0xd22fab5e, 0x0f795422, 0x3b23a060, 0xebb827f8, 0xb7741643, 0x69b44698,
+    0x61ac5fa1, 0x63fc078f, 0xcda4ef6e, 0x6e36ec63, 0x5d978c8c, 0xc5b4aebf, 0xc978b1b0, 0x5b324351, 0x77c96f8e,
+    0x890f275e, 0x3bfc5cd8, 0xf34b64df, 0x79e4e6df, 0xc515c0e6, 0xd3f87c5b, 0xadbd2a2c, 0xfca4f093, 0xba468fd8,
+    0x793049f2, 0x0b2b3f36, 0x55e5064a, 0x5e6d414e, 0x571258e9, 0x2e8c19ba, 0xeccae93f, 0x70c7da5a, 0x323c636e,
+    0xa392dc4c, 0xe1502de0, 0xa659424e, 0x075f3a8c, 0x079bfbab, 0xd139f9ee, 0xc9a3f3a4, 0x3ef73e49, 0x65f8882a,
+    0x5c11b2e9, 0xd3c4a12c, 0x7182b037, 0xa9b045db, 0xf3d41e88, 0xfd646014, 0xce405494, 0x14a1c02c, 0x57f9706e,
+    0xfe4cdd78, 0xdb1a56df, 0x8ba2dad3, 0xf87a02c3, 0xf1602e0d, 0xa6da06bf, 0x68b73af0, 0x07edfea1, 0x54ac362e,
+    0x0b7fa743, 0x201bc12f, 0xa0ef68fe, 0xffd595fb, 0xc39a7b80, 0xe92dc372, 0xca2f3014, 0xce25d36a, 0x3bee1fad,
+    0x433b899e, 0xbd03c34c, 0xaa20d8b8, 0xfa3cc39a, 0xaa186323, 0x045e2540, 0x8d51a03c, 0x89f1ebed, 0x926f12dc,
+    0x6af80481, 0x2e5d4106, 0xda3cd6ac, 0x35aa0c22, 0xa2a9cd33, 0xbfb9f59d, 0xe5be7a26, 0xa89f9b56, 0xdb7d24c2,
+    0x08e72259, 0xb8b587b4, 0x009952f1, 0x0c84cc70, 0x7543c48f, 0x005db3ac, 0x05bc0456, 0x5936869e, 0x6480184c,
+    0x4294cffd, 0x6a13da09, 0xd0eac4a4, 0x472019c0, 0x1494d5c2, 0x6dfac15d, 0x77fb0907, 0x33ce55bf, 0x71bacd0d,
+    0xcefd40ee, 0x5ae526fa, 0x7e41274c, 0x4bc718a7, 0x081247a9, 0xe6d4c22b, 0xa71410ec, 0x58b5060b, 0xc634d6ec,
+    0x3415cdcf, 0x03d92ee6, 0xf8232ba0, 0xd7103111, 0x64521d81, 0xf211fe73, 0x59eddb7f, 0xba6c9a2b, 0x96745125,
+    0x77f0e1e8, 0xea9511bd, 0x92cc0877, 0x81b9f02b, 0xc773ce5a, 0xde35c3ca, 0x312875c3, 0x4a644e84, 0x252a2ec9,
+    0x8c68f47b, 0x01458907, 0xece5b212, 0x734c0e70, 0x58d790dd, 0xfee2af0c, 0xb83b5f7f, 0x5686bc3b, 0xa7cc4bc7,
+    0xbb1d7b0a, 0x958443d6, 0x6640f243, 0x62199cff, 0x85675fba, 0xb7f57540, 0x71e34984, 0x0070d744, 0xc02eddd6,
+    0x3801294e, 0x56f82390, 0xcf79ccce, 0xba804b2c, 0x67d04ffa, 0x4d0803ac, 0xc242923b, 0xd5b9ce87, 0x189f92ff,
+    0xea7c501e, 0xe9424eac, 0x032aac5a, 0xf7e28b79, 0x2bcf9320, 0x41c117d3, 0xc9c5af5b, 0x611e333c, 0x58577ce9,
+    0xed7ffd48, 0x65932ee0, 0xea38375b, 0xb62524cb, 0xa25b2a9e, 0xbcbcb236, 0x2829739f, 0xa726279b, 0x3a2a7cbb,
+    0xf1f88c4a, 0x56a64009, 0x7ff05aad, 0xc5abfdbf, 0xf3077f31, 0x897a4f06, 0xe92cb0b6, 0x42e9c786, 0x87e24ce9,
+    0xb5543f1d, 0xbd252e8e, 0xb73517e3, 0x27b5dda4, 0xd117e2c8, 0x97a5c47a, 0xf7067bb8, 0x5aa55e69, 0xa7a78e9b,
+    0x79be586b, 0x44eb3feb, 0xf3d241d5, 0x1c8d504a, 0x01517b07, 0xfe7bb97d, 0xf52d07de, 0x05bda0c8, 0xbd598dd4,
+    0xf03f8006, 0x8c190fc3, 0x008f5d78, 0x2ec70ff0, 0x19654336, 0x61be7850, 0xe2468138, 0xba64722f, 0x8d2b10c8,
+    0xe350a236, 0x283bffc5, 0x4f1aed79, 0x5a1beab9, 0x30befbbd, 0x76f3e0a9, 0xd61534d7, 0xcbe36646, 0xb18133de,
+    0x98f9c740, 0x430faf4a, 0xfbb70b73, 0x22e48a81, 0x43e6b117, 0x25c243ec, 0x9bbcc190, 0x301a5d67, 0x31d9b732,
+    0x01085dd0, 0xca552431, 0xeb4ecf90, 0xef6d2902, 0x63a0950c, 0x6ffdda48, 0x7ae9ba90, 0xa2cd32dd, 0x145cd7cf,
+    0xc3890c9a, 0x90bce844, 0xd94e2c3b, 0x533b0551, 0x9884ca03, 0x9e13bff7, 0xc6714b8b, 0x27ed409a, 0x79525871,
+    0x42fbdac1, 0xafeaa2c7, 0xe18b6932, 0x4f7d1848, 0x43b37157, 0x5d8af7b2, 0x12540d78, 0x42580dbb, 0x241fd38a,
+    0xa7eb52be, 0x0ea95b6d, 0x180a1d48, 0xf1f71cd6, 0xa39eae8e, 0x3da412be, 0x399453f7, 0x7da7769c, 0x4fc32641,
+    0xd0b72ece, 0x2a979f87, 0x183878fa, 0x9346bd51, 0x73c836cb, 0xa2817a46, 0xcb380df6, 0x6b37c4c4, 0x2c1e645d,
+    0xd800a51f, 0xbabad700, 0xd0c7ef72, 0xba62c9d9, 0xb4def6f9, 0x596bbb6d, 0xeb95046a, 0x330ddf2a, 0x44cff86e,
+    0x2b8a527f, 0x34414075, 0xc5770753, 0x04bf64ac, 0x27295346, 0xa493d709, 0x17cc179a, 0x9d25b924, 0x9862b7f3,
+    0x503449e3, 0xe9363f9a, 0x44ca2b63, 0xc7578ccf, 0x64a27ac5, 0x84bd8fc5, 0x7d44f1cf, 0xe15e48fd, 0xc5b36a9e,
+    0x4875d366, 0xb1633ead, 0x8111fc14, 0x7aacd415, 0x74b9af32, 0x1d011f48, 0x829e131d, 0xcb782946, 0xb71876b6,
+    0x0b3659ce, 0xc59140db, 0x5b746547, 0xe4b6b46d, 0x01951b9f, 0xde2c23e4, 0xf6cb80fa, 0x424e7298, 0x66fee481,
+    0x20cd804e, 0x86f9b360, 0x14099e53, 0x5081dc5b, 0x70b0bd0d, 0x5c1401c7, 0x6dc8868a, 0xd14e87ec, 0x6127347e,
+    0xfe3bc4d8, 0x6bef8539, 0x7c3194c3, 0x223c894f, 0x6714f56a, 0x96ec4886, 0xc5acd0c0, 0xb2c96584, 0x343d7fa6,
+    0x6ba99556, 0xcbb48bf2, 0xfc2c3485, 0x80800778, 0xeba7b9d3, 0x3a30afde, 0x465fa90e, 0x6714944a, 0x76baacdf,
+    0x02db6595, 0x2fe3547f, 0x3729e399, 0x74ad8d35, 0xe3a4a4e0, 0xf7bd8637, 0x94186302, 0xcef60cd1, 0xd8b7726e,
+    0xfad26c8f, 0x3902e352, 0x8ea8871e, 0xc36025cb, 0xf184381e, 0x52dc7ce1, 0xa38666f1, 0x505d087e, 0x603df3ca,
+    0x2bdb04e7, 0x8b893469, 0xbe782803, 0x932ebe4b, 0x36522dab, 0xc4aa2ec9, 0x52b8a65d, 0x4c30f589, 0xac7a822b,
+    0x40f2088e, 0x1cb45840, 0xe5ca6ceb, 0xf48505eb, 0x945a3b66, 0x3f1d898a, 0xa04c1ed2, 0xc0273a53, 0x30412cb8,
+    0x3d859e0f, 0xc226c7b0, 0x4311c779, 0xc33fc307, 0x6aaca797, 0x2df26dfc, 0xb4f11d81, 0xd350dab7, 0x6557c420,
+    0x408cf507, 0x5a7a947b, 0x25c74896, 0x7c1df36e, 0x5984d0ee, 0xe536f4f4, 0x13eb0805, 0xa3a615e4, 0xdb411d92,
+    0x8c4f5240, 0xb3fb0835, 0x81889744, 0x8b9d9def, 0xbf97acf7, 0xf493f3bd, 0xeb436ad7, 0x52e2d93f, 0x6d5dc7d2,
+    0xc1d3136b, 0x3e239a15, 0x82b8c9f2, 0xee96fbd6, 0xc8a28b6a, 0x8ae80e6a, 0x481440ad, 0xa72e2ce6, 0x3c9b9a42,
+    0xaa4e92a0, 0x7f5881d7, 0x59921f42, 0x88054d10, 0x2d22f63a, 0x6cf2fc6e, 0x3f289a63, 0x23e3c778, 0xa55309b9,
+    0x7e1e80b7, 0xc14f8a9d, 0x6b93b377, 0x42102ef0, 0xe11ab68a, 0x4f5a44bc, 0xc0d303d2, 0x32c34126, 0x82e6f213,
+    0x6ea3864a, 0x595c7a93, 0x9e6bed13, 0x87a7edc6, 0xa1a4c120, 0xcbf5e0f6, 0x14c6200d, 0x1bc1adec, 0xe3892e40,
+    0x1e33ef6d, 0xe0b68e6f, 0x7d59c3a5, 0x42427f62, 0xa008c84e, 0x7e98291b, 0x4af91dc3, 0x73646ce8, 0x5eba2140,
+    0xa9492bae, 0x8c977ffd, 0x45d2675f, 0x557bd37a, 0x2fcef0e9, 0xfb2a6782, 0x46ab030f, 0x609e9951, 0xc94ab1ec,
+    0x303dc8d2, 0x02b26212, 0x68668e2c, 0xfadccb3d, 0xe697ec13, 0x587f1601, 0xdf797b6d, 0xf2f4b47e, 0xeb6f86f1,
+    0xc8efaf00, 0xcb223019, 0xb2aa9844, 0xf715c5aa, 0x72370ce1, 0xbb739aa5, 0x590dcfd0, 0xd6ceb05f, 0xc35a02aa,
+    0x60b742cc, 0xd47bb27d, 0x1dfac348, 0x68260cad, 0x38475e6f, 0xfd848892, 0x7d77d6d9, 0xe47d6217, 0x497765c3,
+    0xdd9626ca, 0x98db9723, 0xe0a7bc61, 0x0a85edd3, 0xaf1cf078, 0xf583fdd1, 0x82a2332a, 0xc4cba90a, 0xcd39214c,
+    0x725e7acb, 0xeb1f3e26, 0x8c4cf67d, 0x928b6b63, 0xd598001b, 0xc3f0a119, 0x58ad5da6, 0x75f463da, 0x588dfcee,
+    0x295d78a2, 0xd7a2a6b5, 0x05f5a03c, 0xf79886a0, 0x76afdd47, 0x00a00138, 0xfe1774f5, 0xbc2fea14, 0x71480902,
+    0x4f4fa2cb, 0x37983d13, 0x7f04fb43, 0x6f39745d, 0x23ee578b, 0x07dd1931, 0x64c5589d, 0xfeff2b8f, 0x09216836,
+    0x420adb24, 0x0035d31e, 0x960df348, 0xf5f735ca, 0x4b12a919, 0xcd0040b7, 0xbdec818e, 0x2a271163, 0x5625fbb4,
+    0xfedf55ca, 0x02110730, 0x58b8ea9b, 0x3bacbdc8, 0x1b16fb3a, 0x1857ce56, 0xf25f967f, 0x091accc4, 0xcd07de20,
+    0x1a7ea4de, 0x609269bb, 0x7860286a, 0x6fb0e4e6, 0x7bbb4ebe, 0xdcd94aed, 0x88a9d6e4, 0x492127e8, 0x3117c592,
+    0x8d0eba94, 0x46c6b2ae, 0x39510967, 0x9007f1e7, 0xb8a62f85, 0x01f438d6, 0x8090c0d2, 0x2bc62709, 0xbef651be,
+    0x286a7d0f, 0xc09430b2, 0x8accaf11, 0xa9c37371, 0xb5949e5f, 0x0fcc3673, 0xc9380994, 0x0b4fbefb, 0x7d94b97f,
+    0x7de2a330, 0xbf03ad13, 0xd74013a1, 0xc4f3b335, 0x1d52840d, 0x078f85fe, 0xa31e39ea, 0x5f3e907c, 0x60c8d9a7,
+    0x1e277a26, 0x92602c70, 0x0b426392, 0x74d41e5d, 0x3627b418, 0x328d13b3, 0xb8432ed1, 0xe2d0806b, 0xeddaed1e,
+    0x46a02c71, 0x29a321c5, 0x3cd7d6d3, 0x85eb09c9, 0x9a551c03, 0xc604c8a3, 0x6d7a8bb9, 0x83cf4754, 0x486339a8,
+    0xb93b2323, 0xd98c5613, 0x9acbc531, 0xe66667bf, 0xbf54e54a, 0xdd75d492, 0x961e3775, 0xad9eafea, 0xd75dcd60,
+    0xdd3f7db5, 0xf9a3b21b, 0xdec730b6, 0x0851f2d7, 0xd2e4fef7, 0x658504b5, 0xa6893bbf, 0x3bf3a5f5, 0xdf6e28fe,
+    0xe16793b8, 0xe0bf5fa7, 0x57c8051c, 0xdc8c315f, 0x80d45439, 0x08a7a04f, 0x0122c8f4, 0xadde44af, 0x9aca2f84,
+    0xa96af956, 0xf66aaa98, 0x87c82e86, 0xdc69b199, 0x5cee8cb5, 0xb2edb201, 0xff54fc91, 0xf3368031, 0xc0b39823,
+    0x3c2675bd, 0xcf534c28, 0x44cdb9d6, 0xd892ea9b, 0x492724d7, 0x651ea225, 0xf9f72c77, 0x1daa5e90, 0x715408f7,
+    0x2a69da36, 0x4a59619b, 0x01dcb4e0, 0x0601e096, 0x3488e54b, 0x75ee353d, 0x82b7ae78, 0xc47d12ee, 0x529d06f8,
+    0x92d07f88, 0x7f471b6e, 0x3bbeab7a, 0x39807db2, 0x94824e9d, 0xc9e94219, 0x7a3168a8, 0xab4313bc, 0x9afb8e29,
+    0x2e95885e, 0x5d9daf0b, 0x76e5018c, 0x19d96bd7, 0xf751a9af, 0x38f5a1f1, 0x85631108, 0x02b0ae01, 0x244a913a,
+    0x4dc6c8d3, 0xaa8eef4f, 0xb44c077f, 0x824a1b79, 0xe35888ac, 0x7d86534d, 0xe52cf404, 0x6fdd7abe, 0xbee2d249,
+    0x76299fe3, 0x35e3a244, 0x2383a89f, 0x46c4aff1, 0x09cad952, 0xe72dede0, 0x67e924d1, 0x223eb1be, 0x65d754d4,
+    0xb0234f76, 0xe8a649d1, 0x55a8af30, 0xd2426b91, 0x8f97117d, 0x3d0173ef, 0xd84e4dc4, 0xb1b3dd05, 0x6fb4e710,
+    0xad02ba62, 0x3ca1b057, 0x7018bbb3, 0xcf40c44d, 0xcbfb4410, 0x3ca5bbb5, 0xeee5651f, 0x0e161659, 0x0090cc4a,
+    0xd351072f, 0xddad1cb8, 0xe8601d2e, 0xc05aa289, 0x5922ff92, 0xa6655b9b, 0x5fe4a1cd, 0x4aaeec06, 0x3131b354,
+    0x41ae8051, 0x5e3eebda, 0x61bc03fc, 0xd42b009b, 0x6dde50c1, 0x678dd67b, 0x501627a0, 0x84921239, 0xd0d781d4,
+    0x3ab98a50, 0xf29392a7, 0x5971cc93, 0xc6b5b8a4, 0xfb185003, 0x5b323513, 0x03196ec7, 0x45623f7d, 0x2b37ab87,
+    0x2debf459, 0x2977860b, 0x46cbdb58, 0x5ce8cc8c, 0xaec790c8, 0x736f312e, 0x0a63aecf, 0x9e33da67, 0x3b9ff724,
+    0x6f915be4, 0xcb734fce, 0xf1543239, 0xfd18d1b9, 0xf7162e81, 0xb3a90c76, 0xad917a9e, 0x1562501e, 0x5a9f9c5d,
+    0x3104f1b7, 0x019cddbb, 0x8c287d17, 0xad617f99, 0xfa88b38e, 0x8b6c609d, 0x56c40754, 0xfa10401e, 0x85a69a6c,
+    0x60392124, 0xc02ef463, 0x78c2416c, 0xa73f384c, 0x58dc6105, 0xf26a22d2, 0xb05b6619, 0x15cd1ff9, 0x03096d0e,
+    0x3195c0ce, 0x89a0d56a, 0x4c4d269b, 0xdfc82745, 0x918b8495, 0xecc84bbe, 0x905d547c, 0xa2ed6362, 0xc2cee5ed,
+    0x30216b6d, 0xd18e5124, 0xf4c6ab8b, 0xa9a327a5, 0xaca23b9e, 0x29fbd7ee, 0x175764da, 0x86efc26c, 0x825de26c,
+    0x1c4fe78d, 0x283ce248, 0x4ac10c0c, 0x50bbf3fb, 0x029f6275, 0xe4fa99bf, 0x03e447f9, 0xb58fe8c4, 0xd3ff4b84,
+    0x62ceb07a, 0x154821ec, 0x57acf840, 0x820ebc15, 0xdc3634b3, 0x5ded71c6, 0x50b7c917, 0xf45c8e44, 0xfa3d34f6,
+    0xac3f72ec, 0x8cddaeba, 0x9fd76792, 0xe8f631cf, 0xec652ab1, 0x4f77b310, 0x8731f203, 0x9b1ca4d4, 0x66bc06b6,
+    0xd7bf2a9f, 0xe85e9a7a, 0x3c4b23d9, 0x500c633c, 0xae4c3699, 0xcf603f66, 0x5516d253, 0xce9cb03d, 0x4e4e94ad,
+    0x9a6c97c8, 0xf64195a2, 0x4654bfaa, 0xfafcb9b6, 0x19d8950e, 0x5b1e76db, 0xbd65ed3c, 0x9a7c9495, 0x6ae08520,
+    0xc5e76655, 0xb8283a1b, 0xa99506f4, 0x9bad69ac, 0x88bd2344, 0xec8462d7, 0x2138c82b, 0xe481c196, 0xfd3f41cf,
+    0xe94bae66, 0x5bcb5b13, 0x2898f120, 0x53bfc982, 0x08f986e4, 0xae207148, 0xc22bfc08, 0x8a5020ce, 0x9b58ea3e,
+    0x6f72422e, 0xbbe61f89, 0x858581f6, 0xc7b1c6e9, 0x469fb2a8, 0xb4610534, 0x9d58f6fe, 0x26bf4649, 0xf315de28,
+    0xcec0f753, 0xeab9d8cb, 0x080fef72, 0x3aeaa30b, 0x66d795c5, 0x4bfdeef1, 0xfc91af88, 0x39416dfd, 0x5bbf1404,
+    0x42a017df, 0x68ed4aab, 0xe62ab313, 0x9e9225ef, 0x43f8c595, 0x23287a84, 0xa2eb5953, 0xb8127b33, 0xe77a570a,
+    0xa44386f7, 0x29d11f1e, 0x9c790194, 0x3b591abd, 0xca34f643, 0x6d19bba4, 0x375d77f1, 0x0b251032, 0x1b9cad58,
+    0x07f75a65, 0xe350bde0, 0x330d51db, 0x9ac02a7a, 0x93850dc4, 0x1c4e38c4, 0x4df16ab4, 0x4d0539b4, 0xbcd073a7,
+    0xdedb7462, 0x9a1735f2, 0x3a270ddf, 0x6e84f448, 0xd43ff76b, 0x6c223839, 0xc0146552, 0xc26d2da5, 0x391cd6b5,
+    0x366b271f, 0x5c7f49fa, 0x1535d991, 0x7b99ed3f, 0x1268bf4a, 0x8feb08f2, 0xb3147781, 0x73eef8ec, 0x9a3baa11,
+    0x471b3d3e, 0x28e15300, 0x2cd29643, 0x7869b033, 0x8ee2e423, 0xeba17e0d, 0x1147e107, 0x10cd31dd, 0xf62b8269,
+    0x770ed913, 0x37c9e6bd, 0x71d5a928, 0x534e3ef1, 0xac6f4f8e, 0x12e4986c, 0x0e980054, 0xd82a7b68, 0xa8b65319,
+    0x0d789d69, 0x04ee8210, 0x5240cec3, 0x44cdf9eb, 0x3e9be0fc, 0x5b4a29f9, 0x63feb3f8, 0x9cfb2a6d, 0x8511a2af,
+    0xa70f0dda, 0x3874ca42, 0x8c1e33ec, 0x5c198862, 0x5d3d2126, 0xca76ab0f, 0x4bcf0901, 0x34634fed, 0x5f2f50d0,
+    0x0a62a4c8, 0xfa3f8f9a, 0x6838c4fa, 0x45bcf291, 0x33420971, 0x3b19032f, 0x5a78ab1b, 0x8a2a2d9c, 0xf6e42092,
+    0xe932953d, 0x21440e30, 0xc80d9ac9, 0xf4e21c8b, 0x2e304404, 0xb0d8a528, 0x502ec2e0, 0xae02393c, 0x1a7f6fd3,
+    0x284f7eae, 0x472e20b4, 0x566fd29b, 0x266e4ffb, 0x094113e4, 0xf89aa4fb, 0x4831b50b, 0xb10d2943, 0xdaaef780,
+    0xbc6bddac, 0xb10a66e1, 0x1b4323d0, 0x4709e2e1, 0xb1c94599, 0x7602fe88, 0x6828bd9f, 0x9fe233f5, 0xe500a509,
+    0xa3d5179b, 0x6781be15, 0x198b1ac4, 0xbb8d607b, 0x59c3b2c9, 0x640974e5, 0x1bec4641, 0x57bfbe8a, 0xb8ee6496,
+    0xa70dc9fd, 0x2d2ef7fe, 0xc8f33ebb, 0x7354232d, 0xb499006a, 0x4753f8cf, 0xbf47144a, 0x15b0f955, 0x08c4d36b,
+    0x8f24c18d, 0x86c613b7, 0xee941bc9, 0xe5a4e391, 0x4c14ca0e, 0x5760ddf4, 0xb79cf32b, 0xd3815126, 0xe07e1924,
+    0xd7d8b2f7, 0xa607b6b8, 0x8644e7bc, 0xa2df704e, 0x12ef3958, 0xc6fdab8b, 0xeae25855, 0xa19cd609, 0x514b1c09,
+    0x51f9fd39, 0xbc71de26, 0xc7be4c41, 0x99a05417, 0xbe634f4a, 0x615edc1b, 0x89f5df75, 0xd933cc15, 0xeda34c06,
+    0xf83f96b8, 0x3a28e253, 0xd4d65669, 0x599587c6, 0xdb59fc44, 0xf610a652, 0x5ca01eba, 0x12c68171, 0x504165ce,
+    0x1034ca59, 0x69a94ef8, 0xe810b073, 0x3d832886, 0x516e34aa, 0xd729fa0a, 0xe22f63aa, 0xae8bcb90, 0xf4965962,
+    0x1750148f, 0x649c4ff7, 0x4417a2ae, 0x574d8c5d, 0xee6368e4, 0x251f2f44, 0x77e9bb1d, 0x4801f2b1, 0x077c927c,
+    0x77bda395, 0xb08a6b4c, 0x6c52e0ca, 0x60e769d9, 0xf619855e, 0x7c7652a6, 0xc47a2d6e, 0xf04f973a, 0x9f572aad,
+    0xedc49347, 0x8eeea5fa, 0xcfc7b7d5, 0x18d29c3d, 0xfdfdf3c9, 0xd209381c, 0xddfc4ee5, 0x1585dfe1, 0x2859f52c,
+    0xd70869fd, 0xd6d6a175, 0xdfe4dec4, 0x0a21b1b5, 0xcfae9b8d, 0x921eb7ad, 0xc9020997, 0x73b44e46, 0xa3bce24a,
+    0x3bbbb9b8, 0x4ea918e2, 0x16288893, 0xec331eaa, 0x3ddeea11, 0x6b22a45a, 0x178f2200, 0x543fbbbb, 0x90c223ba,
+    0xc167a255, 0x968b52c7, 0x237b45f4, 0x39c9679a, 0x12d07be7, 0xcff443f2, 0x3de08c70, 0xf9eb46bf, 0xecd3696f,
+    0xccdd0312, 0x510fd99c, 0x7b075ce5, 0xf2d5972c, 0x13b1a565, 0x647f4407, 0x3dda1c52, 0x0db195b0, 0x2b2f8eff,
+    0xfa137377, 0x6caedd85, 0x8fe097e1, 0x10ac8564, 0x72981d2a, 0x08801390, 0x0e3f1ef3, 0x7108f544, 0x6633d426,
+    0xc4bd651b, 0x7d06da4d, 0xbc1d9a63, 0x90a067d5, 0x9a7df559, 0x1d0a11b7, 0x1e5da7f3, 0x29fc2c9b, 0xaf70f7dc,
+    0xe41b41fd, 0xab9624c3, 0x5d75b435, 0x002621ae, 0x7a9b9919, 0xa33b4861, 0x27d3f2cc, 0x9dd5a907, 0x065640c3,
+    0x07086a7c, 0x6ad3c7e8, 0xda61d0fd, 0x997065cc, 0x7ef2b121, 0xeb787574, 0x4d335fd6, 0x32924acd, 0x7a9b34e4,
+    0xb141aab8, 0x142c608c, 0x6da52db7, 0x38f48141, 0x3e8c6aa0, 0xb8096c4f, 0x7b861d61, 0xa60fd6b3, 0xc64e4612,
+    0x0df0efb5, 0x82a2098c, 0xf58f70cf, 0x090f9316, 0x7adc0c57, 0x89c80d7a, 0x98379e82, 0x07627449, 0xba249bde,
+    0xe4071277, 0x335b6e37, 0x10197c05, 0x9806fcf3, 0xd419c50c, 0xa924d154, 0x686a0968, 0x1d4b2dce, 0x5f21ba32,
+    0x22a288ce, 0xd46494a9, 0xcacd96f7, 0xd4fb0ef8, 0xb52990ff, 0x4328b4a4, 0xd53e43d5, 0xe17e01ab, 0x22c5f729,
+    0xee0e806e, 0xaea91ce4, 0xc9368cf1, 0x3298a441, 0xada607d5, 0x0ce64ea4, 0xb039ee8a, 0xc624916d, 0xce3cb963,
+    0x6a21afd7, 0x8bf96410, 0x4618d43b, 0x7def1c9e, 0xcbec3e7e, 0x2fd1e025, 0x87d93d6b, 0x0ff5f5d8, 0x7c21d0d1,
+    0xf5ec1657, 0xf4c2190b, 0x2eb3b608, 0x08745f07, 0x6ebf3462, 0xe421705c, 0xe86372f3, 0x49adf1da, 0x5aecc162,
+    0x671d0028, 0x1ebbda45, 0xd6d010cc, 0xf5395b97, 0x21df6419, 0x2d4b3d3a, 0x6ad03908, 0x81931219, 0xff65858c,
+    0x8e78697d, 0xa9ff5ca6, 0xf2e609c5, 0xccf21be7, 0x83966dfd, 0x8a3cc868, 0x39233e2a, 0xc8902098, 0x69c98dca,
+    0xe3ef8e7c, 0xa163b614, 0x14d2a62a, 0xc2c5c281, 0x6cc9b9d8, 0x1062064c, 0x6040cfcc, 0xf92fc8f3, 0xb802811e,
+    0xdf2af1db, 0xe8e6f840, 0x1f4ca9cf, 0x6ba56df1, 0xd0ca8462, 0xe37139a6, 0x2fa37f0e, 0x522fb55f, 0xf73269ef,
+    0x0a3d8ca8, 0xf16a0a01, 0x1802107c, 0xb4439056, 0x4b0a451d, 0x89ea2c4c, 0xa129618b, 0xceebbdb8, 0x4538462f,
+    0x0f0245f3, 0xba48bd00, 0xc35b8aec, 0x87486b26, 0x046413a7, 0x82f0e45f, 0x030c82f6, 0xc8863f3b, 0x5e477d1d,
+    0x9c146856, 0x13e2206d, 0x13bf11d4, 0x2be3908f, 0x7a4a1945, 0x1ac7ca96, 0x0c83535e, 0x7390f976, 0x2f2daefb,
+    0xf0d7a92d, 0x9fb3f3c2, 0xe1c6de32, 0x834e151b, 0x69ae51f8, 0x4ced1563, 0xec6fb8a2, 0xff68a14c, 0xdc0bf8fb,
+    0x01e1bd7b, 0xbc687394, 0x40c2f545, 0xe8af3002, 0xd37a3c35, 0xe7ab8da4, 0xd2096256, 0x838d60da, 0x5e44811f,
+    0xe67a6484, 0x272eba23, 0x34568289, 0xe665c623, 0x28e32ebb, 0x380e31e2, 0xec66fa5f, 0x9326ce9d, 0x5d566645,
+    0xe60c3eb5, 0x521e1756, 0x5480e735, 0x07b7f520, 0x344470f7, 0xbad01966, 0x435288a1, 0x1b8e3bd3, 0x840bfffc,
+    0x06e4073f, 0x5ab23cde, 0xdb0482be, 0xf53e30d1, 0x51d5640e, 0xb5572dcb, 0xad565df8, 0xe60e26c9, 0x03368102,
+    0x239bd1df, 0x80cff272, 0x9640352c, 0xa13d9d05, 0xf2e59975, 0x6eb89c1a, 0x081fc914, 0x5fd76af5, 0xb420cc67,
+    0xd3941e78, 0x1ad61f76, 0x8fc02d0e, 0xece7be6e, 0x7e13393c, 0xeea6da04, 0xa4a3d76e, 0x3648ad17, 0x8aef288e,
+    0xa1ce51e4, 0x64a93a93, 0xfd2f5089, 0x599bac3a, 0x8d3a0170, 0xf8b3cd30, 0x89ab7843, 0x1d3e5db8, 0x06cbb16a,
+    0xd28952d2, 0xca284893, 0x8fd1a1e1, 0xecc8aa4d, 0x465de563, 0xd600c55c, 0x8c8b4b96, 0xfcae28e5, 0x7f91590b,
+    0xd80818a5, 0xe7dde9c3, 0x32bda512, 0x0724f344, 0xbcb6b4d2, 0x07ec1b3e, 0xe9127652, 0x87906330, 0x90ca0901,
+    0x9e794663, 0xecda4063, 0x4f3c615e, 0x8c3d1553, 0x9536e091, 0x27f6b3f0, 0xad0cfa5a, 0xa6ee2cff, 0x3dc86de8,
+    0x5bee2390, 0x5bb0ac2d, 0xd4d7389b, 0x62cfd45b, 0x0f480e36, 0x65887c8b, 0x61d1bc58, 0x8a568dbd, 0x03ebb4e3,
+    0xcbc03381, 0x71750ff3, 0x8b232b86, 0xad7d6105, 0x250170ba, 0x905e8dda, 0x7dd5cf15, 0xe21f34a7, 0xfc7332bb,
+    0x98aa7898, 0x7b105575, 0xd42c5ba5, 0x0659a6a9, 0x1dd2d4a0, 0x327d0e0b, 0xee472cb0, 0xddd15781, 0x5e365ae5,
+    0x6d692079, 0x7996669c, 0xfadd39ff, 0x4f60d4f3, 0xcf8ba304, 0x843552a2, 0x56835804, 0x1da22f3d, 0xbde1988d,
+    0xdde9acb2, 0x984ee523, 0x95c333d1, 0x0d8aad64, 0xb60e8857, 0x1203591e, 0xc654b0f4, 0xb3c61edb, 0x34380acf,
+    0x1c7f42cc, 0x5b73a780, 0x3086017e, 0xa0f0cb25, 0xc4c7ab26, 0x34961122, 0x41b7b3e3, 0x111e8141, 0xa2006aef,
+    0xe09f29ac, 0x7d0d6d90, 0xd928b95b, 0x9b36ef99, 0xce837820, 0x990ea4dc, 0x04b4a83e, 0xed7a88a8, 0x159c901b,
+    0x6ca12b76, 0xca9e521a, 0x3de6ed99, 0x7bdccb3b, 0x1bb77977, 0x804974be, 0xadf7537b, 0x3d0b297b, 0x4ce960f0,
+    0xe3860943, 0xf1f3f4e7, 0x58ffad60, 0x92b0be9b, 0x35f5c369, 0xb4c1ec3d, 0xff1c0315, 0xf6c40009, 0x0b2cf6bd,
+    0x401dd9b2, 0x267eff83, 0xdf9fc68a, 0xc091e597, 0x87b3cad8, 0x35a40acb, 0x9c3e8a73, 0x5d1db62d, 0x2dbefaa4,
+    0xe643956f, 0x5a6f0a4e, 0x28e4a0e6, 0x96439f50, 0xadd45c15, 0x7214b9d6, 0x2260db9f, 0x9f76062a, 0x9c7c7cab,
+    0x0392f69c, 0xdfaf7b6f, 0x7ef834ec, 0x0a23e59a, 0xa3cc1875, 0xe8ba40dd, 0xfbceeb6b, 0x68fd2cdb, 0x5b325dc5,
+    0x5c5df314, 0x6d48191d, 0x2a04c3af, 0x31322dad, 0xbbcaa431, 0x5aeb4af7, 0xdfeceee9, 0xeff255fc, 0xfc97bd59,
+    0x8575215c, 0x3f77c9d7, 0xcbf3eb42, 0xe59efdbb, 0x3e0ede30, 0x08123223, 0x346bc373, 0xc740a4ec, 0xe186cf46,
+    0xfc7554bf, 0x341d0996, 0xf22fd6c3, 0x5ea34ad0, 0xca8d7068, 0x844e2ab6, 0xf737925a, 0xedd0de59, 0xd6cf3824,
+    0xa43f9aef, 0xcc9bf9ca, 0x21cf67fc, 0xfc618fad, 0x3aba6a92, 0x5ed838a3, 0xd3c92112, 0x01b2d1a3, 0x2895eb06,
+    0x19026be2, 0x106a090e, 0xcf1ebd90, 0xe80485d3, 0x89a067fa, 0x2b578f0f, 0xde28c5ad, 0x0772b060, 0xc328f323,
+    0xfd1119a3, 0x5dbcde7b, 0xf985b367, 0xe854333c, 0x98fd9454, 0x759e019f, 0xaa4c36e0, 0x60522c2e, 0x21f6ac01,
+    0x84d0e4eb, 0x64201905, 0x55d04812, 0x8179aadf, 0x052741f5, 0xfee75a6e, 0x788b005f, 0x1705dde7, 0x2e43d2db,
+    0x9423f4a8, 0x9529ea71, 0xad9ff77b, 0x93eaa219, 0xc8098c3e, 0x849ef43f, 0x74a408cf, 0x24996054, 0xe5fd7518,
+    0x10ff50ee, 0x99502cb8, 0x42f08ebe, 0xaefbb9fd, 0xd5502bf1, 0x17011e5c, 0x19490a6e, 0xbfcc1617, 0x967882fc,
+    0x7dabc6ac, 0x4d43af6d, 0x7d35eb74, 0x57fc672e, 0xc42f4215, 0x5dec239d, 0x0b8c66a8, 0xe1c9084f, 0x7638acf8,
+    0xd8339218, 0x4e3832ff, 0x7f0b5517, 0xd8463abd, 0xbcdee1ae, 0x58044907, 0xb1191896, 0x9253f687, 0x8ae80a55,
+    0x1f0a4d00, 0x89fb5583, 0xfc2d0242, 0xe9f95f7e, 0xdcd27423, 0x77524c1e, 0xfb80aa91, 0x1cc95380, 0xcb1fa465,
+    0x071ae0e6, 0xc3c8d053, 0x420a82f3, 0x5b5ac21a, 0xf77d1d1c, 0xb6dd3a1d, 0x59466a1d, 0x6cc8ba1a, 0xaa8593e0,
+    0x3678e185, 0x459da03a, 0xc8108d53, 0x4d8bf6e8, 0xadbb18b5, 0xe4b5b90c, 0x5d07d1ad, 0x0abddd9a, 0xbb0cff69,
+    0xb3d4cf08, 0xd3612384, 0x0c3afd9e, 0x0d0e4d39, 0xb78587d6, 0x8a4e1ca2, 0x84d21649, 0x573345ac, 0xb67c5819,
+    0x928a1863, 0xaadf3d46, 0xc7d9ba22, 0xea4d7fdf, 0x1624307b, 0x00986db1, 0xeed8dbb8, 0xc2222ef2, 0x5a046246,
+    0xc7b3eabd, 0xff5647c5, 0x7a47aea7, 0x14910d58, 0x04190102, 0x6bcf7e76, 0x54a3bc82, 0x5706694c, 0x4664f6db,
+    0x3f1e3487, 0x611488b8, 0xf7aaa276, 0x356cd750, 0x1d7e249f, 0xb29671f3, 0x34a50204, 0xba821762, 0x755bbc64,
+    0x904cdafa, 0x48dd953f, 0x7b032c92, 0x0e0bf1f6, 0x7144be72, 0xb2281608, 0xf9782f11, 0xe4f28e99, 0x877621d1,
+    0xce8f27be, 0x5a559021, 0x9b1740dd, 0xcaaa8c5c, 0x914ce8c4, 0xa200f85e, 0x819f2012, 0x474f36fa, 0x3c8fcd36,
+    0xe9952168, 0xdc81cac7, 0x57204da7, 0x08bdf73d, 0x5a4a4a77, 0x007fe3dd, 0x0dea2923, 0x1dc37f2f, 0x44ab21ff,
+    0xb58b5c72, 0x12f88874, 0xfa407115, 0x002820a5, 0x2df85b8d, 0x45e2fcd9, 0x9c0120d1, 0xc539c34e, 0x9c393022,
+    0x27340845, 0x6ebfc65d, 0x0cb3a6e5, 0x6f732a87, 0x1cf1fcf9, 0x52b26db3, 0x8c5c8424, 0xd3e58ec3, 0xd99e6ac7,
+    0x0b028a17, 0x33c8f957, 0x782c4957, 0x4fdadc92, 0x571b9295, 0xb88e25fd, 0xe9a63a98, 0x3635a87c, 0xcee78062,
+    0xf6e1b0e1, 0xff4b0dc4, 0x5a7417f1, 0x429e3665, 0x1a3ac88a, 0x2abd32d8, 0xf5d7d878, 0xad4b8ebc, 0xe2eb1ab2,
+    0x65c683fa, 0x0b5196f7, 0xb171b294, 0x6e2fb5ba, 0xd75ee248, 0x44c82fe0, 0x69ceb2f5, 0x31fd6a13, 0x44e59d31,
+    0xfb29627b, 0x4dfde733, 0x7dc2b374, 0x0f89afc8, 0x6a728754, 0x156fce7a, 0xbbbbbcf2, 0x03d0125a, 0x0a618c3e,
+    0x384ad656, 0x9d824935, 0xec915f03, 0xe0676c8e, 0xdfb9bb87, 0x367679a4, 0x133d14dc, 0x37aa4df6, 0xd489651c,
+    0x4064fbb5, 0x66ad961a, 0xab021723, 0xf90f66c1, 0xe582aa74, 0x367a62cf, 0x3f2bfb64, 0x2cc3e242, 0x3510fb59,
+    0xdbe24543, 0x523963ca, 0x5324f293, 0x5cdb591f, 0x9978f38b, 0xfb0dae7b, 0x9dac987d, 0x27ad85b3, 0xa1fb6748,
+    0xf36ee237, 0x29cca571, 0x808b522a, 0xec5d9c96, 0x6b2d15fe, 0xa26e0569, 0xb2a657a3, 0x6718f734, 0xcadaf946,
+    0xfd67647c, 0x97eedd17, 0x05dfbd2b, 0x95632786, 0x25109814, 0x2cdb98d3, 0xa158d1e2, 0x628675d3, 0x6b1d569f,
+    0xd2aa3c98, 0x828aebc4, 0x3c986c27, 0x571c5def, 0x033474e1, 0xf6e0990b, 0xd1fe22fd, 0xe5b1fe40, 0xab4ab524,
+    0x531475e8, 0xead9bd0e, 0x912ad957, 0x1d6285e9, 0x2e9155b4, 0x61a39429, 0x8144cd67, 0xd2f6c54b, 0x0bd39f54,
+    0x2ed3c047, 0x6669406d, 0xfa690caa, 0x31c4deab, 0xa9d37d2b, 0x913b118a, 0x9880ce88, 0x83cedc27, 0x968d229c,
+    0x8d3c9334, 0xe5c6c529, 0x20e898db, 0x011fb68d, 0x5dfcf22f, 0x9e3f42ea, 0x8c39f8ad, 0xaa01c4c1, 0xe9534452,
+    0x0d748033, 0xecc5393a, 0x25b6e154, 0x6f6bcbc9, 0xfaf77ff0, 0x54609fb2, 0x7f4bfd0f, 0xcea7e8b5, 0x98f8be3b,
+    0xf35661c3, 0x0a7a3c67, 0x5ea608aa, 0xe2724654, 0xc2875b5f, 0x61823832, 0x7de97631, 0xb1590811, 0x3c3df57b,
+    0xb9ecfabd, 0xc130e7fc, 0xd37513d7, 0xe9782a3d, 0x9cb4154a, 0x393dfbfa, 0xc06f4881, 0x61ac70c8, 0x5d2efdf7,
+    0x0f4e0041, 0x40ebb724, 0xb20cdbc0, 0xb3644a69, 0x75708f27, 0xdf522d37, 0x83b4adda, 0x69c800e0, 0x5d310e80,
+    0x9b0b9538, 0x3a5eb98c, 0x77caf795, 0x6de37057, 0xb355d01b, 0x014e1dad, 0xe9811969, 0xc08a7628, 0xe5e44555,
+    0xb3fc343d, 0x88a8612b, 0x340cc79f, 0x1b6b575d, 0x79fa7ef0, 0x491353f8, 0x7350e6f9, 0xdee5a45a, 0xe43bdae9,
+    0xd70c56ae, 0xed403e86, 0x6c5a5354, 0x9e1651fa, 0x2f236125, 0x0390f807, 0x0d2a075b, 0x514a3483, 0x9936c16d,
+    0x80082d96, 0xb5a06d54, 0x1612537d, 0x962125e1, 0x45eb1ca2, 0xdb15fb61, 0xad005ccc, 0x1548d2a0, 0x25800e08,
+    0xf2fac0cc, 0x737aeb61, 0xd892448c, 0x07c28d17, 0xf318aa6f, 0xc58e3a39, 0xf4dd4dbe, 0x9411e49e, 0x210fcbf2,
+    0xaa36609d, 0xb4d95c02, 0x6a8f19d5, 0xe370d49c, 0xa3c84de1, 0x735de824, 0x32fffa12, 0x4f3a3121, 0xbc13ab9b,
+    0x1a9218aa, 0xae8daec3, 0x955e5062, 0x79bee83b, 0x1094c531, 0x3d773876, 0x303c850d, 0x76bf9c52, 0x0c2f32bc,
+    0xc88dbf23, 0x5c804946, 0x520d89a0, 0x36d430af, 0xf60e1cce, 0xb3150eba, 0x0643f587, 0x6a6777dd, 0xa7029cb3,
+    0x99941fe3, 0x87c07ba1, 0x46e5cf71, 0x65bacf09, 0x559bdfe6, 0x8bdd8ad3, 0x59ebc41f, 0x7e55932d, 0xcf78bead,
+    0x0cd4e489, 0xb90ad2b7, 0x58eac751, 0x1b56d7a2, 0xc2487093, 0xc0aa7a64, 0xa905e9d8, 0xa7c43a2e, 0x25ea0b58,
+    0x85a3f54f, 0x10c6d4b3, 0x2b0b1e1c, 0x95ac942f, 0x6fec080a, 0xc51790a2, 0x8461bba0, 0x31efaaf4, 0x1d371322,
+    0xc99944ec, 0x5289e5ff, 0xd64dd767, 0xb6938070, 0x0794ef6e, 0x46b0a40c, 0x8a563291, 0xbe0f799a, 0xb2d7ff2e,
+    0x4cf9307b, 0x1b6533fa, 0x62db2987, 0xe2116167, 0x2d809c35, 0x6bc74ba2, 0x6da8bfd8, 0xf30e9390, 0x28415cf6,
+    0xe854ce92, 0x02465a49, 0x4fa98d16, 0x4ab1d89a, 0x50870f57, 0x57c283be, 0x5e1e0fc2, 0x247602a9, 0xe4786f47,
+    0x7969635e, 0x3672c88b, 0xacf55cb5, 0xe3133e77, 0xe92b50a1, 0x0b380d50, 0xe36d4b33, 0x49e7cc83, 0x408694a5,
+    0x0825b231, 0xee6a1e95, 0x4f4432b9, 0x878cf78d, 0x7309e88d, 0x7794bfc0, 0x55beb95b, 0x24ed6723, 0x0c24fa00,
+    0xaf487dce, 0x89d43c1b, 0x27b69a90, 0xe3495260, 0x6e360f86, 0x98fee59a, 0x7db55eaf, 0x0fa8aabb, 0x0e942194,
+    0xa047bf88, 0xa3460058, 0x6dccd3d4, 0x3add5264, 0xa74e5d1f, 0x0a4be925, 0xeb497cfd, 0x257c3ec5, 0xe721cf98,
+    0x0604b27f, 0xa14973e9, 0x3de5257e, 0x0c7e9080, 0xd63050bf, 0x09286198, 0xb48d32f1, 0xa97c74e7, 0x9c79ff0a,
+    0x0350d608, 0x54e77f30, 0x866c2575, 0x0e2b4912, 0xc01c478e, 0xc05e5859, 0x3dd37eef, 0x0eebdab0, 0x5d19cf3f,
+    0x3bf7c1bd, 0x5762abb7, 0x5c74f6c3, 0x769d60d4, 0xad2e158a, 0x15e3c181, 0x72e29acc, 0xfe82e2fb, 0x55ca03ea,
+    0xa9a36bdc, 0xeda78987, 0x0b5a2b00, 0x848a6ea0, 0x6cd57698, 0x60dfd963, 0x16815f1a, 0xe421dcb9, 0x821e15f6,
+    0x16965efa, 0x388eea84, 0x86f8a6d7, 0x008703f0, 0x3a0b64d4, 0x3a79ee37, 0xf82ab4f5, 0xff872ded, 0x5b171723,
+    0x7f5da1fe, 0xfe29717d, 0xf2be0340, 0x82368aee, 0xb96c073c, 0x18e22af2, 0xf3a16603, 0xe66188ab, 0x4d2b635b,
+    0xc0541ac2, 0x98fbe020, 0xe6fc9ca9, 0x71c4a0eb, 0xdb890815, 0x6bb37762, 0x4b0b34aa, 0xdc175fc2, 0x55136b6a,
+    0xb7a2fc52, 0xec32d768, 0x3856fb22, 0x6ae787ee, 0xd291b7ae, 0xa4261b5a, 0x96dda5d1, 0x31c6e7db, 0x3d18abc7,
+    0x7ffb2b20, 0xba1bc2e9, 0x4d654cc6, 0xdf503664, 0x1706b911, 0x688e901f, 0x3693469f, 0xb3b7d82c, 0xb32952bf,
+    0xa31e8408, 0xac80b477, 0x7e7ddefc, 0x9256f1d4, 0xd2e2236e, 0x1c4c2ba6, 0x3d0b8377, 0x1b31de69, 0xf2430e45,
+    0x22eb7378, 0x08773858, 0x735cf2d0, 0x2435e1f7, 0x0098062d, 0xe259fb20, 0x98bb7dc7, 0x4fe8666f, 0x4325c6e2,
+    0x65c5fac3, 0x54c12c8b, 0xa717c9fc, 0xbbee623d, 0x3f6982c1, 0xf539e965, 0x3bfc4321, 0x65557815, 0xcf4ea217,
+    0xf4a5c703, 0x7bb51dc2, 0x1a3ccedc, 0x10f1fed3, 0x9564b6b0, 0x86d54614, 0x4e832bb9, 0x9e08a2ef, 0x7b9de18a,
+    0xe3f94f98, 0xdeb2a16d, 0x865053e9, 0xc77e57a2, 0x08b2d22f, 0x6b14339c, 0x8a03536c, 0x804275c8, 0x6ff502be,
+    0xfd9a90ba, 0xd6ddb0bc, 0x52973d1b, 0xe0013b33, 0xf9bff65b, 0x5485e22c, 0xf65056f7, 0x18393ab3, 0xbf8c8b96,
+    0xad0a9fb8, 0x903c1b86, 0x8a112f64, 0x2b92f97f, 0xe9ddf040, 0xb6789340, 0x2de6f4ef, 0x3ad7178b, 0x3e7dc30b,
+    0x35bdf632, 0x7301086b, 0x692ebcf5, 0x30d7dc52, 0x64dfd466, 0x7105f6ef, 0x48397638, 0x45ff134b, 0x948a44d7,
+    0x9685fd96, 0xc354066f, 0x9cdbc452, 0xc3f9623f, 0x26a22395, 0x74d6d6ca, 0x55f4c68f, 0x3458b963, 0x0f00da6e,
+    0x328dfdbe, 0x7d168a67, 0x2621e1be, 0xac2b2fc8, 0x465f34a1, 0xbf3c8330, 0x647c462f, 0x8126d698, 0xa9a706fa,
+    0x5fd2e5d7, 0x18e53ac9, 0x3a7ec000, 0x6941b0f2, 0x88b9ab30, 0x083d89bc, 0xa651ba4b, 0x1576e953, 0xb8a419af,
+    0xf58ddd4e, 0x645f51ff, 0xa148ea0b, 0x98e77fbe, 0xab02a875, 0xdd39e005, 0x85552e1c, 0xcf833d62, 0x3fb91263,
+    0x598d45e5, 0xf9a86b5c, 0xb64f0d5b, 0x7538186f, 0xd2522fc2, 0x181c3f14, 0x33358f47, 0xca097d3e, 0xa90c478f,
+    0xd0aed5aa, 0x371adbac, 0x40ce1367, 0x426b236c, 0x89fe452a, 0xa8a88f38, 0x7f1f44d3, 0xfcb6a688, 0xadbe573a,
+    0x05bfe39c, 0xdb0e18d4, 0x3eb0b20b, 0x3fdb061b, 0x2845d7c0, 0xb359905f, 0x790681e1, 0x3e33a6ce, 0x1c9d84be,
+    0x2174b7dc, 0xcf87ebd6, 0x2df6918b, 0x9bbe6815, 0x29df3655, 0xe2c1565e, 0x62b203f3, 0x510f5c84, 0x61679298,
+    0x4b823e48, 0x581b2420, 0x4ff2d70c, 0xddf40ce5, 0x1611807f, 0x6c7d6f66, 0x0ab328eb, 0x22f4016c, 0xca6f0f1c,
+    0x476626bc, 0xad5c9d4c, 0x2eb80f72, 0xd42b5ff1, 0xf0f19ea6, 0x9fe66acc, 0x7ec78441, 0xf465f4d4, 0x79a9c60b,
+    0x766880ca, 0x7e122048, 0xfc9c311c, 0x9d1bd74c, 0x84aa1a87, 0x2b870d0b, 0x57fc595f, 0x601343be, 0x3158051c,
+    0x2ca2d76f, 0x9f72b900, 0x6481d2b2, 0x7d695f7e, 0x1c00580d, 0xc9ad4b93, 0x76852afc, 0x6c10130f, 0x89eac33c,
+    0x7d686990, 0x80060802, 0x70dea993, 0xe1fd36c8, 0xe1cb6b9f, 0xf786df9e, 0xb3475cae, 0x4eb31945, 0xf2c5d93b,
+    0xb1d54492, 0x126542ab, 0x56508594, 0x6efb515f, 0x3252839a, 0x8a040f25, 0x793fdc45, 0x519a1c15, 0xe31ee96d,
+    0xd3302ce5, 0x11db7990, 0x68461430, 0xa876f7db, 0x4256248f, 0x7cd8fd92, 0x4c16b9ad, 0x749c5375, 0x851c73ee,
+    0xfa134f37, 0xe2967469, 0xda5dd915, 0x7760f86d, 0x610b2421, 0x5adc488e, 0xb77550b9, 0x59b95ef8, 0xf38868df,
+    0xd036e501, 0x0cb814a8, 0x06b9ab5d, 0x49fec781, 0xfa40384b, 0x533be651, 0xb0e4a064, 0xc1c1afa8, 0xbdc16574,
+    0x9284b162, 0x2cd5b7ab, 0x52882ba1, 0xc779300c, 0x25450000, 0xa805b3ec, 0x0e89159e, 0x2b24bcde, 0x634827a6,
+    0x6ba484fe, 0xe418533e, 0xcc64d282, 0xf185de71, 0x83fe042c, 0x9df00287, 0x2ab8233a, 0x9243767c, 0x1c6432db,
+    0xf0393696, 0xa4f31d42, 0x9d599e1c, 0x6e4d31c8, 0x85830cd1, 0x5f2446d9, 0xac739059, 0x5868d669, 0xdd4c9f22,
+    0xf0163343, 0xd2411112, 0x925bfe3a, 0xf8366b70, 0x0f50e2fe, 0x6455e113, 0xfcd9f124, 0x7143f3bb, 0x540b1347,
+    0x5b007982, 0xd6d1360e, 0x64a10f13, 0xa8e2ebe5, 0x7374aead, 0xc8eb7e59, 0xb2874627, 0x7f0c9a4a, 0xf8106eae,
+    0x79d91558, 0xcc35a3ad, 0xd0af03b1, 0xf2393d2b, 0xc1dd105a, 0xdd73755e, 0xfec0b662, 0xe8bb98e1, 0x19a1f334,
+    0x5ab6406f, 0xbb1f4076, 0xc364bf19, 0xb1afa470, 0xb27fbb42, 0x9da2b23a, 0xc993c8e9, 0x0a5c8ada, 0x2822b6db,
+    0x3539b2d2, 0x11bd2dc7, 0xaae15f47, 0x54be4706, 0x5fbac156, 0x307381d3, 0xc4991868, 0x581d8460, 0xf4d54a36,
+    0x15aa0461, 0x1bc775e8, 0xb3f0c76c, 0x7ada6492, 0xd3b3f14e, 0x5eeb7f3c, 0x9d571222, 0x8d286b11, 0x9af26617,
+    0x68377d59, 0x99282b08, 0xb66fe8e5, 0x3b5b7d35, 0x98473fce, 0x619570f9, 0x62b28fae, 0xd5814430, 0x7df31c74,
+    0x2b3dd219, 0x710ce639, 0x676e0df4, 0x295d8f18, 0x17d8c6ad, 0x4acdf51b, 0xfb55e78f, 0xa13d7268, 0x90689424,
+    0x01b3b7bc, 0x18294267, 0xe2a2c733, 0x68ef19af, 0xe3c51209, 0x7c9db2e6, 0x31f5cc69, 0x362b4809, 0xec92588b,
+    0xdcd60935, 0x43760e68, 0x58f0ca7a, 0x51d4db10, 0x02bff479, 0xb78f0f19, 0x32a14d01, 0xf4f6fec4, 0xada9360c,
+    0x7aacb7aa, 0x978b18a2, 0x3f2bae8d, 0xb7394ff0, 0x0ff7c705, 0x2fdab3ad, 0x74b9fe7b, 0xb862f514, 0x59f03bcd,
+    0x30f6542c, 0x11a9df5f, 0x51a11235, 0x58d3d8cd, 0xd8b389bd, 0x6a389331, 0x4b20a4a3, 0xbb746c76, 0x30c3f0e7,
+    0x86428407, 0x45d6c023, 0xc77ebdeb, 0xeabefca3, 0x60250546, 0xe8476f57, 0xe9fd3f0b, 0xbd21df0b, 0xa9a5c6e5,
+    0xf8198b68, 0x881246e7, 0x00052c27, 0x64d3e8a5, 0xf2680866, 0x35bfb7de, 0x9d0f8ac7, 0xbcf2ebe5, 0xb144005e,
+    0x9e82681e, 0x2053b274, 0x66da2f7c, 0xd0393e7a, 0x53f83cfe, 0xe90804fe, 0xf5fd44f5, 0xf127c10a, 0xc70afa8e,
+    0xaf15c55e, 0x7c6dfbda, 0x80e0a920, 0x7b169698, 0xf8066cda, 0x1cf2a510, 0xef70f7ef, 0x000bc34e, 0x2d42e033,
+    0x17cf50f4, 0x6ab4c571, 0x5134bffe, 0xc47320b9, 0x3a32271d, 0xf183f54c, 0xc5e1e43c, 0x0d1c971e, 0xe7795114,
+    0x6ca29ccb, 0x9c446bd7, 0x3779f259, 0x5db53656, 0x6d105a7f, 0x31479f68, 0xb31d23cd, 0x8102d36d, 0x51aeed2d,
+    0x482bd4b7, 0x093ed959, 0xd6e0bb40, 0x3f9177cd, 0x1453f24f, 0x6fabfe89, 0x613efc72, 0x0910c552, 0xbe379d14,
+    0x78af4f98, 0x49d711ac, 0xc0fb4b1d, 0x20db2cad, 0x9a1b5401, 0x650f5035, 0x2ecd6e62, 0x5e107f7d, 0x91434da6,
+    0x63dd552c, 0x7e5a1cbf, 0xb202afe5, 0xeff1d62e, 0x684463d1, 0x8974e066, 0x27fd6fa0, 0x79febebc, 0x72be4703,
+    0xbd3d8fa0, 0xe798d010, 0xac6bd206, 0xa1d27bdf, 0x265ee01c, 0x70759e0c, 0x2728d64f, 0xe6d41d13, 0x1d09c684,
+    0xa956eb79, 0x38d9b259, 0xfdcc0187, 0x38341c48, 0x1d8a58b0, 0xa19cf231, 0x8da941d0, 0x103e013c, 0x015c3f4c,
+    0x60e5b7e9, 0xfcc13a66, 0xcaaf7feb, 0x945951cb, 0x9013a1d2, 0x3493cc53, 0xc2e7a8ed, 0x3f1b09ec, 0x723065f1,
+    0x0b12f08d, 0x9351d18b, 0x4bde8627, 0xfd5a4815, 0x178df664, 0xcc70d5a2, 0x94ffae9b, 0xac794782, 0x002064e9,
+    0x89b09c07, 0xa2675e5c, 0xd688b577, 0x616d96a5, 0x4c8f372e, 0x29380589, 0x344f1195, 0xa7181920, 0xd05fcfd2,
+    0xf8b0493b, 0xb5f7ed4a, 0x773d9e10, 0x638984e0, 0x24905e48, 0x5fd2fcf9, 0x1c0e9f82, 0xcc5e7ff2, 0x24357ecd,
+    0x6f7eda17, 0xf0741171, 0xe06135ce, 0x6ede60e1, 0xa1838ee9, 0x89da30a8, 0xdd929c2d, 0xf378f6e3, 0x82ab127f,
+    0xb75639f1, 0xadc76771, 0xd3543fd5, 0x6ab2bba6, 0xbd96c2f9, 0xdb40a45c, 0x49f78423, 0xa95428ed, 0x13103128,
+    0x6c95fd6a, 0xc3bb4a03, 0x77de024e, 0x0003585f, 0x6bddcbc5, 0x0e343cc7, 0xdbd11140, 0x48577260, 0x2dea7823,
+    0x045c945f, 0x63d857b7, 0x636bdb57, 0x6b74eb6d, 0xf6da7b8a, 0x8d48f7cb, 0xffa3af77, 0x7a4d08d7, 0xa04f7b02,
+    0x5e47752e, 0x15333def, 0x48b3b596, 0x316005b0, 0xf84ee6a5, 0xcc87dadb, 0x5467ba61, 0x669f0371, 0x5acd89f8,
+    0x7c834ed6, 0x033433b3, 0x54cfe3af, 0x4d1d6022, 0xa800b2fa, 0xa4e68446, 0xec7c30f2, 0x353f926c, 0xe3471231,
+    0xc902c21b, 0x90ac5d86, 0x00c86671, 0x4dc5aaf2, 0xe12d4914, 0xcc875d2b, 0xd16e5090, 0x9eff66f3, 0xa35ee078,
+    0x909d7e8c, 0xc27a8732, 0xdd4d5a89, 0x20275663, 0x4aaa383d, 0xe1521f40, 0x0e5d2cd9, 0xfd0d4aa0, 0x2f0f1b28,
+    0xaa93f083, 0xd4eb3c42, 0xf3cf4fa3, 0x16832a78, 0xbd8bd1a5, 0x05448d81, 0xef09e3bf, 0xf4c7fd7e, 0x3c928cbc,
+    0xc4062fef, 0x2bd3b757, 0xcbd45594, 0x051b3874, 0x50f2b65e, 0x9792bd7d, 0x3595cfeb, 0x49c03e8e, 0x81a17660,
+    0x2857a67c, 0xce5b2c90, 0x2ce68d4f, 0x89bb9cae, 0x69720f64, 0x2cab6070, 0x80536888, 0xb6146a8e, 0x3635f35c,
+    0xcd439cd3, 0x230f66a0, 0x48d4d5c3, 0x7c5ef87a, 0xe8a0ebf2, 0xc15f4664, 0x11a35d81, 0x232ca0df, 0xe2e05a1d,
+    0x3a8a9038, 0x7c5e6b7f, 0x0d39f620, 0x9482ef2d, 0xfd6fe563, 0xdfb2bc3f, 0x2c478622, 0x1b28a03c, 0xbb20e7d2,
+    0x46ee9e7b, 0x948d1151, 0x728cf9b3, 0x8dd1154d, 0xe79b2567, 0x17e1f8ce, 0xd8d2abc1, 0xee542f36, 0xb0807f6e,
+    0x0337db13, 0x74984ee3, 0x3f08606d, 0x98787c46, 0x6b61bb87, 0x60ab9f85, 0x5104928d, 0x047c150a, 0x328cc000,
+    0x1bc6762c, 0x160b5bab, 0x0769cdde, 0xab50811b, 0xb897102d, 0xe09cf35a, 0xd3263341, 0x21169dba, 0xa8c11149,
+    0x99955698, 0x028d088d, 0xe405d1e3, 0xd0af6c53, 0xbbd999db, 0xb65ce434, 0xb199b068, 0x59e27c8e, 0x6b25c316,
+    0xcd61b411, 0xfddd923d, 0x638d0e61, 0xad23b6f2, 0x99d4d084, 0x39824560, 0x804409e4, 0x9e0887ff, 0xc03fab0d,
+    0x6bef47aa, 0xf460b130, 0xa994b780, 0x4c4aa95e, 0x48b20731, 0x4218da48, 0x84dd2074, 0xa8aefa72, 0xea32042d,
+    0xdfe4f729, 0x0062fc69, 0x13d954a2, 0xa9d0f94d, 0x46910943, 0xc1c484c5, 0xc7d40547, 0xb879176b, 0xd2add9e7,
+    0xa61efc7f, 0xd901b0f7, 0x67b39591, 0x3e1875cb, 0xca0bc4b5, 0x45a79cbc, 0xc449a4a4, 0x09d77d15, 0x55d094ff,
+    0xe6b5d475, 0x3add8a6b, 0x705c27c8, 0x475105f1, 0x6e4170a0, 0x3dd8741a, 0xe7c779bc, 0x3161690b, 0x3ffa1fcd,
+    0x0fdb989a, 0x1f12c043, 0x316b1f4a, 0x268f2785, 0xd07bbf59, 0x22a51b9d, 0x8a41bcac, 0x38d2f20e, 0x9aac541c,
+    0x8257d618, 0x4b3e480e, 0x52b8d305, 0xcf449535, 0x322fcb60, 0x26fb9491, 0x881419f6, 0xc1485b11, 0x658200a8,
+    0xd3d47380, 0xd5d185a8, 0xa000bf6e, 0x857896f8, 0xb5d73ca2, 0x72e68282, 0x020b4293, 0x9d142ada, 0x5704bd98,
+    0x54705c7e, 0xba150347, 0xa80514ec, 0x7b833e2e, 0x0b47974d, 0x88cf75c8, 0x9a0be95f, 0xad3935ed, 0x5a7c2883,
+    0x7ce59906, 0x577da8f1, 0x82406f84, 0x0ad224b5, 0x2f66fdb5, 0x45ddb2e1, 0xf2d0365c, 0x00269fd8, 0xf304f2e1,
+    0xd28382ff, 0xee492fe9, 0x28d8d9c5, 0x0f3178fe, 0xeaece807, 0x81683d0b, 0x08eae84a, 0xf3df4c7b, 0xe9272fb4,
+    0xd08ed3e3, 0x572e8f33, 0xdbf08a4f, 0xebb4956f, 0x261a2075, 0x5ce9bc72, 0x462a0bfd, 0xd7e2b842, 0xb7bc9a79,
+    0xd5e7ff1a, 0xd7039c42, 0xf0afd3f4, 0xb677a73a, 0xfb0ee505, 0xe5814201, 0xe1925b67, 0xcc0be43f, 0xa606a522,
+    0xb4a600f7, 0x4c4e33a5, 0x260bde4f, 0xc287f5a1, 0xc3319284, 0x28118725, 0xea4a38b5, 0x76901b4b, 0xe2583ac7,
+    0xcc2fba9c, 0x3ef9bfe8, 0x71a79c11, 0x44cd186a, 0x8856278b, 0x0f28fba6, 0xf3ba4cfd, 0x13675090, 0x7ed139f1,
+    0xac2d4414, 0xbae9e310, 0x6dc5d195, 0xe204f016, 0xeafdcb81, 0xda3b6b04, 0x140d785e, 0x54ae9d08, 0x05e164b5,
+    0x0cfe6db5, 0x5accdc39, 0x3377eaed, 0x63e1a7f6, 0x9a423716, 0x50900058, 0x223f532e, 0xff244941, 0x16ca7166,
+    0xc8bd6a8f, 0x625a6215, 0x1d201a00, 0xe040bef3, 0x49d9842e, 0xcb58cb8d, 0x31c75ac0, 0xda976412, 0x1747734d,
+    0xae81db75, 0x520dfae3, 0xb173f21d, 0xcacde04b, 0x6fc83de7, 0x9e7f5424, 0xcda94d52, 0xb1c57eab, 0x25a3a3b5,
+    0x9454cffc, 0x2d6ee638, 0x6099b1b6, 0x709dcafa, 0xbc4fe650, 0x155ce3fb, 0x3bafd720, 0xf03e9043, 0xfee25664,
+    0xd077958b, 0x06965abb, 0x19a12d17, 0x75f35aee, 0x1a44d7a7, 0xfdd7157c, 0x64b87b76, 0x8bb3653b, 0x026eedbb,
+    0xb15256fa, 0x393e7046, 0x22397304, 0x9236421f, 0xb9de28bf, 0xecb4e961, 0xb5bcee42, 0x6db10b43, 0x9fec55e3,
+    0x8a69c7b8, 0xf6feb5a7, 0x5227019e, 0x750c4c87, 0x6e3cf4cf, 0x2073fc7e, 0x75a6bee5, 0x0a2f7151, 0x3ec31465,
+    0xd0fc46e4, 0xd5630fce, 0xca64c8d7, 0x0b3c93d8, 0x0b7b2019, 0x81d4b074, 0xd89f69cf, 0x83d817fc, 0xf92e6b80,
+    0x8aaf6b99, 0x6c6daa93, 0xabbe2f52, 0x0175f0c9, 0x8bea6775, 0xcaeb9432, 0x5bea64fe, 0x9700db05, 0x7b1242b4,
+    0x429e2dc7, 0xc309b30a, 0x28a40d38, 0x24efcde2, 0x9719b9de, 0x50eefdcd, 0xc3358091, 0x9b839b2f, 0xe732dd1c,
+    0x7874b53c, 0xa4d4a766, 0xf09eecd8, 0x1b8856fc, 0x80572ccd, 0x91fa6347, 0x153d987f, 0xf5c09fa9, 0x685706ab,
+    0x5b4fcc22, 0x4c284e60, 0x9710e37c, 0xd42e0381, 0x3557052b, 0xd2cf7e2d, 0x978e4a58, 0xc08eb043, 0xb92b80c7,
+    0x8a1c95ae, 0xc2fd5203, 0x38099ae0, 0x62dbf24b, 0x6cc853f4, 0xb21c5a78, 0x04760277, 0x3326a1a1, 0x78b01e6e,
+    0x90c44f8d, 0x8d4ba828, 0xd72fe5a2, 0xc20fcd82, 0xa233aad9, 0x29c130d6, 0xc2d5af30, 0x0d20d5c8, 0x4acc67a9,
+    0x21c3c85b, 0x3a8b8a01, 0xe128b8a0, 0x2eb1fc39, 0xce453c6e, 0xfef84bdf, 0xcc716130, 0x8735b30a, 0x74850ec4,
+    0x3f7c5f3a, 0x8b74cd8c, 0x7c0c4e29, 0x07f7d7f8, 0x8305a53e, 0x9bc266fe, 0xb8108ea1, 0x284023eb, 0x311d1da1,
+    0xc687b587, 0x383f7c40, 0x54830d04, 0x4707a520, 0x1459b071, 0xd6036f39, 0xf5261533, 0xf956efcd, 0x031a57b4,
+    0xbf32f0c7, 0x2a796a67, 0x20e2a891, 0x5750c57d, 0xbbf4d5b3, 0x25498150, 0x129c0216, 0x0d0e3f12, 0xc384e605,
+    0xfd0367d1, 0x36036aed, 0x5ade82f5, 0x77fca6dc, 0x683031dd, 0xe11345e0, 0x53243ce3, 0xa9cd040b, 0x086cbbe9,
+    0xb5d1d5b5, 0x4149cb46, 0x7bb2aef0, 0x4b26d5dc, 0xfa59125f, 0x7211ce84, 0x775f03c0, 0x2c7c4230, 0xc0e35390,
+    0x3e27886c, 0xb54b099a, 0x41464137, 0x7235edff, 0x5cfb6e38, 0xb719a5b3, 0x20b55951, 0xa32b3c81, 0x1d02d66b,
+    0xe8340192, 0x9c3bc17f, 0x1684c122, 0xaf031916, 0x8ac2bae5, 0x9ed9be94, 0x456c5876, 0x4c7a1f7d, 0x8210e535,
+    0x801bc93f, 0xd3c7257f, 0x9b97650d, 0xd03e75e9, 0x01019d14, 0xda736e42, 0x5e41ccc9, 0xcb26e331, 0x6a8f65b2,
+    0x8ebffd7e, 0x283f8097, 0xa41dfcea, 0xb4479a03, 0x426aaba9, 0x0953e3e0, 0x677f01d6, 0x769774fc, 0x25527d64,
+    0x03826132, 0xf505a1c5, 0x5536b8f5, 0xfd6d35fc, 0x7021210f, 0x4d909c11, 0xd7fd2b02, 0xcafa1402, 0xd42c12fc,
+    0x743d2b0d, 0xa82aed8d, 0xb0c85c17, 0x2b7b0ea6, 0x03dd3683, 0xe06fcdc8, 0xe0442226, 0x5e999cbf, 0x91234cfa,
+    0xafef4d80, 0xb9785e45, 0xe91cd5b2, 0xc81580fa, 0x2d7d7835, 0x3c4d8e98, 0xfb116cf7, 0x86d03742, 0xc5fa950c,
+    0x5621f877, 0xbb560e06, 0xa0297544, 0x2ab18f48, 0xc80a7381, 0x299b2394, 0x41e1a878, 0xf019009c, 0x6b311848,
+    0x319fea3f, 0x6a279853, 0x6fcc88f6, 0xec13d5b1, 0xe05e274a, 0xdd3a0863, 0x9da7439c, 0x129d80fd, 0x18982768,
+    0x74f70405, 0x5cf7d1d1, 0x9a5e490f, 0x0cca97ce, 0x69458438, 0xa659c9e0, 0xddaf3049, 0x6e6a53c8, 0xb79ad96e,
+    0x7317a8a6, 0xa9ce9549, 0x7edf1c7e, 0xd99e067d, 0x215a0acd, 0xc1aee649, 0x97d31e8f, 0x57d91b20, 0x762a0727,
+    0x02530ccb, 0x867b5f50, 0x63f580dc, 0x669f7f69, 0xee0a5567, 0x3991afba, 0x4195b0b0, 0xebd88723, 0x5880ed5c,
+    0xeaac07b5, 0x0a377949, 0xcea56fc5, 0x78345abc, 0xec1d5622, 0xf1683b88, 0x40f70da8, 0xedac4fb9, 0x76416d6c,
+    0x65e46fe0, 0x9a5df9f9, 0xa77ecf30, 0xa4de9fbf, 0x9053a80c, 0x16891ca7, 0xa78a3191, 0x7771fc47, 0x213eee79,
+    0x8358ab8c, 0x18c7e786, 0x588cc727, 0xf27bd84b, 0xcfad80b2, 0xdfbb0e0f, 0x4df82d85, 0xdd68efb5, 0xa80cfcac,
+    0x8e5f6b80, 0x2019afa0, 0x074d2eea, 0xef0c8c6b, 0x57396954, 0x06bd2d29, 0x5abd4931, 0xc0d52d4d, 0xdc18fabe,
+    0x5af31d39, 0x0decaeab, 0xf8d113af, 0xd5e0de10, 0x44e4aa74, 0x062cc41c, 0x3e8f967c, 0xd48cbb77, 0xcffdb7b0,
+    0xaa80c915, 0x04343e7d, 0x9554264a, 0x7a08a457, 0x2191cd64, 0xb2c896ea, 0x8ac94023, 0x11efd6fa, 0x5a6574f0,
+    0x3f719ee2, 0x141c3acc, 0x38e77b68, 0xe84df758, 0xb63ad9e1, 0xc63fad6b, 0x123b8d1b, 0xabf3e157, 0xbff009ce,
+    0x5112b892, 0x460e2d53, 0xa203d577, 0x20000508, 0xf83dd332, 0xcb9daf4f, 0xf1f720c3, 0x90c55b0a, 0x0298bec3,
+    0x2b0a25c2, 0x088b5ff4, 0xc12b8132, 0xaf648910, 0xc077261b, 0x8ace0a65, 0x1d955069, 0xbd9932a2, 0x562c3c00,
+    0x743b1a4d, 0xcd7ff202, 0xeef0b311, 0x33ea2ee7, 0x80510f80, 0x240b1bac, 0xcaac5b9d, 0x8da3935b, 0x344af930,
+    0x18060bb0, 0xc4283f29, 0xe55ab489, 0xf63a833b, 0xd8fb98f8, 0x304c6b32, 0x6274de1d, 0x8aaa2aef, 0xd224df76,
+    0x611dcdca, 0x7219e2a1, 0x9c47d397, 0xa67fce27, 0x19a3041b, 0x970f28f4, 0x1f7a913d, 0xb76cda63, 0x4bdc887f,
+    0x5aed3db4, 0x80c2109f, 0x6fedc25a, 0x56c67983, 0xd8a2df40, 0x632e4c58, 0x6c2255b8, 0x58f5a07b, 0x3c0266e5,
+    0xe60f5e55, 0x54fdc947, 0x4f7d267d, 0xe8c5b7db, 0xbca0df19, 0x6e230767, 0x594fa486, 0xaa7a1cdf, 0x3faa1b24,
+    0xdf04be5a, 0xa891ea41, 0x2e525239, 0xa53acad2, 0x2fa7f6ba, 0xb713d316, 0xdec06e82, 0x98e3eded, 0x74d057df,
+    0x59e29abe, 0xe156696e, 0x08756ed6, 0x947c1ead, 0xaefdfbd3, 0x52c4a6e8, 0xc809989e, 0xe07e481c, 0x534c0f35,
+    0xbbff8af7, 0xaab1617c, 0x596a01d9, 0x666a008e, 0xa6d488e4, 0x198da4fe, 0x8762d8b9, 0x9e476feb, 0xcd8fed3e,
+    0xd980aa05, 0x9269bb19, 0xbdf3be44, 0xe2fe28c4, 0xd7c70ad9, 0x8897a38b, 0x5b3dd2ea, 0x19cd92a9, 0xf2517e1c,
+    0x298eb742, 0xd24ab4fc, 0x4666e1e7, 0xbcfdcb2c, 0x5cb2f913, 0x8816533c, 0x109bed95, 0xdad41c77, 0xe96b141f,
+    0xb55f8bb1, 0x325e5d78, 0xa4475871, 0xf6308b21, 0x1896c0b2, 0x57eaf0b0, 0x291cde6b, 0x9977f69e, 0x27fd3816,
+    0xfbd6f071, 0x9c30f8ab, 0xa6874c2b, 0x8c6ce71f, 0xab9aac0c, 0x6872aa59, 0x8fe96cb1, 0x2ae780c3, 0x7374f385,
+    0x247b1761, 0xa33e6ebe, 0xbe0e2ccc, 0x809617ef, 0xf1c09484, 0xee10d4b1, 0x3bb6eece, 0x1f8c994c, 0x8f4f4a6d,
+    0xdc4d6c2e, 0x16b5ab0b, 0xc8101d01, 0x5fa74bb8, 0x3fbc852f, 0x2b9ab308, 0x8da67e1e, 0x136d5adb, 0x1fee6d5f,
+    0x06ca8042, 0x748b26fc, 0xb4ba6795, 0x92e293fc, 0x4a72bae5, 0xc77f2aa2, 0x1a0cf67f, 0xe3af76d0, 0x6db54a0f,
+    0x27e7aa1d, 0xcdfca6a8, 0xe9bed71c, 0x4d82b38b, 0xe57e1822, 0x4e00c5c4, 0x2733d84e, 0xaeea8a26, 0xfaab4518,
+    0xc19f5cac, 0x0bed2aa4, 0x57c96f61, 0x2231b708, 0xda1ed852, 0xc11cbedb, 0xebe9e8a6, 0xf527a1dc, 0x118d59d5,
+    0x783cfc66, 0xfe33765f, 0x3fafc2b1, 0x27d4882d, 0x7ae70bef, 0x66ae687f, 0x8f0eadfa, 0xe243de4c, 0x50d8ef45,
+    0x374cbc30, 0x0243c870, 0xc9a38573, 0x93583993, 0x5866d66a, 0x7e9300ec, 0x6bc149e1, 0xdf6ca967, 0x1628b35c,
+    0xff5bbb6d, 0x40e1c782, 0x9d0d408c, 0x30f63d99, 0x4e42c4a5, 0x03b7d2e5, 0x01af8ff7, 0xb361da26, 0xc0e2aa6b,
+    0xbb0ff907, 0x09cce034, 0x15cfeac0, 0x3cdd47c8, 0xfa1c890b, 0x9657dee7, 0x10f2492f, 0x231be0f1, 0x2b6fc840,
+    0xe2d4c4b5, 0xf6b028d4, 0xe8cac705, 0xd4849fe4, 0xd4cc137d, 0xe744e87b, 0xdb807fb7, 0xd249a8da, 0xe3f2851a,
+    0x73f84ba4, 0xde6a1537, 0xd7bca5a0, 0xdd83e623, 0xe92402b2, 0x26708f18, 0x2c08f3d4, 0x711e0c35, 0xe6913678,
+    0x7f6ace2b, 0x21514ebb, 0xc46d4800, 0x7bac4cc0, 0xa666c711, 0xa46cd8b6, 0x258840e5, 0xa024f792, 0x4c7ada10,
+    0xaf2ba637, 0xc4063ea0, 0xae703816, 0x46cb9555, 0xa3bc1664, 0x2fba7738, 0xbc9265ff, 0x446598b4, 0x9ac42684,
+    0xf942657f, 0x5e9f1b4d, 0xac3b6358, 0x9f2e08c8, 0xa9e27648, 0xa172189a, 0x2f5beeea, 0x78a5d53f, 0x55cfe63e,
+    0x49d377b1, 0x70b7043a, 0x296100dd, 0xa23c291d, 0x978ceff4, 0x056fd93e, 0x7f3f9d2c, 0x60181fd4, 0xea694198,
+    0x5047e201, 0xa8ba0451, 0x53bc5b17, 0x03f7dfc9, 0xbd1416c4, 0x399b1672, 0x06175688, 0xb453ee10, 0xafe27498,
+    0xc255c2ad, 0xf20450b2, 0x46a6c55b, 0x4faf404f, 0x8a41069a, 0x94df9940, 0xbb74e075, 0x4408ab02, 0x2eae958a,
+    0x2185bc30, 0xc9bd31f7, 0x9f9a504d, 0x0b0af000, 0xa6886529, 0x7156830c, 0x15ec0138, 0xdc314d4b, 0xddb7724f,
+    0x4cbd8450, 0x80031ed1, 0xf94c75d1, 0x3ffc5e6a, 0x8ae6bd16, 0x76b3f4a5, 0x405f1157, 0xcc29856b, 0xbff96795,
+    0x6e9e520e, 0x5a400b16, 0x8a6baf6d, 0x862521cc, 0x560947f5, 0x487e77c0, 0xb00d269d, 0xb16457e2, 0x50849628,
+    0xfc5ff382, 0xc25ae007, 0x7679538c, 0x7a1906c1, 0xa5cc4eda, 0xff58bd45, 0xf739bbad, 0x1156c512, 0x5a332d5e,
+    0xca5e1ee1, 0x6615bbb5, 0x09b078d9, 0x4f2d5e95, 0x636355b0, 0x51e26de0, 0x877b9f10, 0xccc1f593, 0x73b69b1f,
+    0xda27470d, 0xb5f73244, 0xe9df5ded, 0x50c7adc9, 0xfec11eae, 0x9c2e0afa, 0x01360598, 0x1d746283, 0x27c57f08,
+    0x764dd486, 0x45939cc1, 0x908fd571, 0x8555893f, 0x4f0c6516, 0x59d02f16, 0xc3221cab, 0x86952278, 0x2810740c,
+    0xaff4e24d, 0xf0466b27, 0xc61b58ff, 0x51302151, 0x3b37db2a, 0xbf02ec46, 0xabc1d828, 0x05b673a5, 0x93e0c5ce,
+    0xd03769cb, 0xcb45cf86, 0x50e1d41c, 0x95faae29, 0x7a4ef1b5, 0x92b00b1f, 0xc0eba62f, 0xad1f42a3, 0x4ac69a27,
+    0x5f0c284f, 0x13782dc4, 0x58015627, 0x5e5d89ca, 0x155f0bfe, 0x9412ac54, 0xfae35fa2, 0x7264d093, 0x072bfa0a,
+    0xfb1b7cb2, 0x0d8a3d57, 0x4bc5a0c7, 0xb7c7e0a3, 0x4750b882, 0x7da82edd, 0x12e382a2, 0xdbf1b0d8, 0xd9fc24be,
+    0x9d268a7e, 0x0485322e, 0xd7d5283c, 0x4fb84772, 0xb7cefb4e, 0x2c24f646, 0x3acaecdc, 0x6ecf163b, 0xd8b0f8eb,
+    0x4f7b98f0, 0xdbccccbc, 0x15baf1b1, 0x331db227, 0x85625873, 0x08a32949, 0xc8a8e4fc, 0xc4a80c39, 0xb3a222b9,
+    0x62662526, 0xd602afdb, 0x53c26c8a, 0xdafdc1ac, 0x96fbf361, 0x1faccad5, 0x35794989, 0x1d0c32b7, 0x9161c085,
+    0x8505da04, 0x99c9fcb1, 0xa4d33a6c, 0x74d37184, 0x2ee7abdb, 0x0da5a43b, 0x5dbbb1c9, 0xd6243501, 0x50f99e78,
+    0xbf38fc89, 0x87480829, 0x0d427d38, 0x13205817, 0x29f89153, 0x0d6912f4, 0xe7888474, 0x58967c61, 0x9c2344d8,
+    0xd9b342f6, 0x7b3e366f, 0xb5a5e275, 0xf230dc82, 0xa76485f4, 0x8f7d14af, 0x233caa9a, 0xcb28c333, 0x50f98666,
+    0x1984bc20, 0x46e2a620, 0xd5263808, 0x2e3db588, 0x47bfa4e0, 0xb32f2513, 0x0aa7f021, 0x6c9ff00f, 0x0fea3600,
+    0x4a543dd4, 0x72d27f50, 0x794b2c38, 0x9ba7e5c2, 0xc849fc1f, 0xe952c9aa, 0xc42d1a2d, 0x88e44e47, 0xba21f4c5,
+    0xde3dfa58, 0xeac4977f, 0x3be76723, 0x01b3900b, 0x25be356c, 0xdd950aa7, 0x851efc40, 0x6fb2735f, 0xbd7c202e,
+    0x4e87a4a4, 0x8661f1ff, 0x5b2fc885, 0x778e9da0, 0x29f0e085, 0xab396ade, 0x4917d26a, 0xec6a0a3f, 0x7dedac59,
+    0x3fbd180b, 0x22f5d3a5, 0x37858ee3, 0xce79c4bc, 0xe9e551f2, 0xac4748d3, 0x5b3b5879, 0xb1c3932c, 0x829272a4,
+    0x503bb2b2, 0x9684d42b, 0x6485bfe3, 0x4fc76b0b, 0x76994c6d, 0x6ccfffdc, 0x1ba4492f, 0x508ed11e, 0x34f13455,
+    0x2a4d05e2, 0x655bdda1, 0x8ffb4260, 0xffd1a823, 0x9077ab37, 0xe019379a, 0xd435af57, 0x3e86d270, 0x7f04d0f2,
+    0xce0369aa, 0x7c164c18, 0xe66ebb54, 0x95348b92, 0x6f3298df, 0x4115d689, 0xc8a989f5, 0xbd48714a, 0x9b30818c,
+    0x6bad3326, 0x044372e6, 0xefcadcf6, 0xec85d7f7, 0x37a627ff, 0x1cd43dee, 0xdcec6ebf, 0x952883a1, 0x78c45e86,
+    0xfc49bc3d, 0x55757973, 0x84149ef8, 0xbc16d2ec, 0x3e2d4793, 0x8ddf9746, 0x88b56996, 0x8eb8dd7b, 0x42cd9723,
+    0xa17f53c4, 0x882c2967, 0xe1d5d3d0, 0x010203f0, 0x3ad2ffca, 0x08d1f8d8, 0xb6514804, 0x6043e67d, 0xdaea0922,
+    0xb340d658, 0xd8a24b76, 0x22231462, 0x055f75a8, 0x52ab5a40, 0x40d17820, 0xac3acdb4, 0x11e7fb07, 0x3beff0a7,
+    0xa71ce863, 0x73e68102, 0x885a009e, 0xcd0f693b, 0xaf1cde98, 0x16efd7c8, 0xb7c4ec53, 0xbce66ead, 0x76c9e6a2,
+    0xf20e2458, 0x9710ef28, 0x8b6b415f, 0x43bd3fc8, 0x8f7e54f4, 0x888b7aa7, 0xa985f359, 0xcc17d17e, 0xc52d9ae0,
+    0x8180082f, 0x36a77648, 0x420e1c35, 0x40753602, 0x9f8130ae, 0xc7c66a16, 0xad9625b4, 0xdbb45f5b, 0xf707fbea,
+    0xe2e6c19e, 0xaef57e48, 0x7f5936f9, 0xb4713907, 0x419c4483, 0xdf4f9a33, 0x1d7cc630, 0x25ce202e, 0xddf24c56,
+    0xe7a78b6e, 0x9c483327, 0x4fdea710, 0xc083db43, 0xb926bbd2, 0xc2fdf22e, 0x3c0efb96, 0xacd0cf96, 0xaf46e2a6,
+    0x6107a718, 0x83643c4c, 0xf2f96503, 0xb44e939e, 0x7bd2ff75, 0xca7c61e9, 0x62cf2041, 0x84ea497d, 0x9ad06edb,
+    0x41397ea1, 0x5793b309, 0xe90d2a12, 0xecac4f77, 0x57a43182, 0x4367211c, 0x4ddebea8, 0xc0fa4336, 0xbd8648c8,
+    0x30ed4df8, 0x71b9bce9, 0xd30e5bb7, 0x9ed2bc51, 0x0d28391f, 0x69059f1b, 0xc2316ded, 0x25c041bc, 0xe829e82c,
+    0xeacd8b3a, 0x4a56cf25, 0xd952eec8, 0x12328288, 0x0a2caf34, 0xdc77a9c0, 0x896343cc, 0x1102463d, 0x9e264e70,
+    0xc99bc749, 0x298a8d6f, 0x1c1fca23, 0x7900e898, 0x95ec5005, 0xabfcf1f2, 0x7befc2c5, 0x3f767c6f, 0xd1c48bab,
+    0x96d44504, 0x6af41cc1, 0xe747aa52, 0x19cd5dc4, 0xcc5eef4f, 0x4d8e0211, 0x50da0980, 0xac96ecf6, 0x008c4910,
+    0x53271dd1, 0x2af356ac, 0xf2474681, 0x47e6ad5a, 0x4197a899, 0x4d707a35, 0xa899e63b, 0x92ab9c12, 0x9b7042ce,
+    0x29dd6582, 0xebb44855, 0x840552f4, 0x83e01e82, 0x33584216, 0x89b3872a, 0x023bf2b6, 0x353d3ccc, 0x03228e4a,
+    0xc0a9498a, 0x6ee6ea6b, 0xe4be0aa0, 0x1f64dba8, 0x7104bede, 0xd63fb4a9, 0x6a2949b7, 0xf7317a5e, 0x8caa5d79,
+    0x49a844d0, 0xbbf5495f, 0xb5327384, 0x7900764d, 0xdd1f7d2c, 0xbd24c8f6, 0xaaf61d6b, 0x82d537ba, 0x905a7603,
+    0xc41a3c1d, 0x264da2c7, 0x96fa52e6, 0x64b457aa, 0x0b153c49, 0xf94cc0f0, 0x8a4d3a50, 0x464ca1a6, 0x6f334cf6,
+    0x4ed75269, 0x90416304, 0x4b2d199d, 0xe27321c8, 0x96f62834, 0x206e763b, 0x6a5d737a, 0xb36b2ff0, 0xdea90048,
+    0x0d58e812, 0x1fd2e8d2, 0x102e4bb2, 0x15d20b5f, 0x9606845b, 0xa116a1de, 0x9ad1bd43, 0xb709b9fe, 0x4549aaea,
+    0x82961455, 0x4e97169e, 0xffb83ef3, 0xadae615b, 0x84d9ac85, 0x0da4a925, 0x5b9f0e07, 0x77355c4a, 0x1dd931f2,
+    0xfd91301d, 0x7faadcf5, 0xa40b85df, 0x528c05af, 0x86ee977d, 0x23488d1e, 0xe008f3c1, 0xdc8a8157, 0xc1a5a8b6,
+    0xfe6d58cb, 0x40435974, 0x2ed2f375, 0x9ffd78cf, 0x682ddc91, 0x51f8be64, 0x2a4b3549, 0xfe733368, 0xb9f583fb,
+    0x17a388b9, 0x78038049, 0xc505ab47, 0xcb927843, 0x508a48d9, 0x01aaaac0, 0x0eca9742, 0x0ad69c35, 0x9542b3d1,
+    0x7e6727d2, 0x9cef5fce, 0x8f3029f5, 0x0da699d8, 0x0d9c28e6, 0x9fd48334, 0x829c40e5, 0x13cc254d, 0x094ca454,
+    0x88bb5013, 0xcd841ebf, 0x8568a570, 0x42079c48, 0x0de0d666, 0xc3dbbd5e, 0xf3c85b77, 0x8471bfd0, 0x6060ec3b,
+    0x70cda06d, 0x3cb3baad, 0x1ba8159f, 0x72848736, 0x9b4fe0b9, 0xa63e5ad7, 0x725188a7, 0xaa4d6361, 0x17261a8e,
+    0x6a896049, 0x627d75a3, 0xc7606694, 0xed01a4b3, 0x898e408a, 0x3d48637e, 0x1ad9064e, 0xf480ab6d, 0x39525194,
+    0x09332273, 0xfa9da51a, 0x08a1abc7, 0xec0fb7ff, 0x6634c2c0, 0xe65896c8, 0xdfb74aec, 0x62aae2f0, 0x46b855b3,
+    0x9931b4ba, 0x4bf8ee31, 0x3e411d40, 0x0560ef7b, 0x5e45a39b, 0x017e193b, 0x1df65f11, 0x30175cef, 0x127d65d2,
+    0x6a1799af, 0xdd4b4d76, 0x4bcb67eb, 0x97d243ac, 0x42d2ee35, 0x29b9509b, 0xdc0ef377, 0xcc0f7700, 0x55e969d9,
+    0xe260be49, 0x18b01f3b, 0x0a2fc30f, 0x87ddafc7, 0xf1dc5da4, 0x426f9cfc, 0xf5848a50, 0xab26749b, 0xe82ec0a8,
+    0xfb85d9ea, 0x2ddace97, 0xcf06109a, 0x2843152c, 0x657e38c0, 0xd5265b0a, 0xf41d227a, 0xe3863b99, 0xc8cd0a3a,
+    0x8c823cb1, 0x257d0391, 0x381b4e9a, 0x08cb145a, 0x31809279, 0x419603bc, 0xe806094a, 0x9afab418, 0xada93d07,
+    0x98ee488a, 0x1ebc5b31, 0x9c1ff36b, 0xad1a7017, 0xbb6318ba, 0x119271db, 0x72317270, 0x42b3073b, 0xf22f9ccd,
+    0x91060525, 0x65b002bd, 0xee54e05c, 0xec6d83df, 0xeeee7844, 0x2cc4bea4, 0x043439c0, 0x769e9c28, 0x65f8905d,
+    0x8ecf8fc9, 0x2943f103, 0x5c4bc682, 0x820e7f9e, 0x182fc181, 0x380791d5, 0x631f0974, 0x3f48dae6, 0x025739cd,
+    0x82cf58ca, 0xe1713436, 0x335444d7, 0xf549a629, 0x85534177, 0xd76a9b89, 0x1d8a922c, 0x94934aaa, 0xb2566cd8,
+    0x27a0ed6f, 0xd62a5c24, 0x4ec25938, 0x00b23f3a, 0x231c3039, 0xee6b76b0, 0x76674774, 0x272ca533, 0xd2d8b623,
+    0x5113ea88, 0x72ef2942, 0xd4aa0766, 0xa4121419, 0x43d4cc5b, 0xf96d8a9e, 0xf5967133, 0x7b21edbb, 0x06c7b2b5,
+    0x74798f9c, 0x35e96814, 0xcfa48b77, 0xb9fe78b1, 0x00ddcdf1, 0xb0e33bae, 0xa103d721, 0x65c12cfa, 0x1533784d,
+    0x5ddb2efb, 0xc8e21ec2, 0x8566249e, 0x5ce64dd9, 0xe66b835a, 0xffc734f9, 0x37de2f58, 0xfb5fd023, 0xb1cff50a,
+    0x8a6046e1, 0x7c9f5ceb, 0x8353fd30, 0xcd9fe994, 0x3d05b398, 0xf24bbd63, 0x4d7983e5, 0x6df13218, 0xf4ab5191,
+    0xc2ac611d, 0xbc805c54, 0x50384b7d, 0x450bb619, 0xb1a97d6c, 0xad25adc0, 0x32598690, 0x88a6c986, 0xdb0e7bbb,
+    0x3289aa17, 0x01d8855d, 0x216a754f, 0x1f724eae, 0xfa1d603d, 0xf450c73f, 0x0baad5bf, 0xaed19942, 0x66e4b053,
+    0x8676dca8, 0x175e3cdb, 0x257db62a, 0x6e9feb60, 0x07566246, 0x17007af8, 0xa566c524, 0xca47041a, 0xc9a6fee4,
+    0x2113ffef, 0x6d2528fb, 0x3aac7627, 0x30ae42eb, 0x9869a5ff, 0x7c50a86e, 0x1ea1e3bd, 0x5c7adbda, 0x1b5701f1,
+    0x0c3ec855, 0x96e3ada2, 0x30d9fe16, 0x9e180ea4, 0xb7d4a5a4, 0x85910990, 0xbb78bfa1, 0x7ba029d5, 0x66ebf4d1,
+    0x34268b83, 0xe4bb7d3a, 0xf158bc14, 0xff06ca54, 0xfc0ed1c4, 0x60c3f500, 0x261d419c, 0xe8b577fe, 0xf48ee9e9,
+    0xac836a26, 0x5358b61a, 0x1daec88e, 0x38c8626f, 0x6b882eaf, 0x650330b9, 0x7c80eabd, 0x61861454, 0x9e7b7f20,
+    0x80c450ab, 0x7135cfb6, 0xface325c, 0x56eff7dc, 0x53cdb2b6, 0x36dbdc99, 0x7452b7e4, 0x3d11bfc0, 0xec264fe5,
+    0xa207dbaa, 0xd5d46e6e, 0xf8018aa8, 0x2b9177a6, 0xefe6b9e1, 0x9225659c, 0x3adc597d, 0x381f32a7, 0x20a5e8c0,
+    0x8e175709, 0x850dd86b, 0x9f0473bf, 0x4910fcea, 0xd427f014, 0xf1cb0305, 0x15470bc2, 0x9ef31ae9, 0xd9e26951,
+    0x06167ac3, 0x041bafaa, 0x3a769b2d, 0x9dde9357, 0xf8517a95, 0x938836d1, 0x34e5d393, 0x39fe8cd0, 0x3c3c7946,
+    0xfab35e30, 0x0f69ec7b, 0x045040df, 0x000305dd, 0x9b51e473, 0xadd93c42, 0xb8b171a4, 0x81d92e80, 0x21dfd564,
+    0x2bf519ed, 0xf57860ea, 0xd69ba992, 0x779d2e1b, 0xbfd5587b, 0xfc9a9ae9, 0x7e0edfa1, 0x33714c6d, 0xd5bc8b0e,
+    0xccfc8b54, 0x58a93087, 0x1fb60895, 0x7b60605e, 0xdd0141b7, 0x6a251712, 0x0a98a13e, 0x7bfae4aa, 0x5999f6f8,
+    0x60d94733, 0x1ad18a32, 0xfd40a3ad, 0x5a281170, 0x5fc28e03, 0xa83d7f89, 0x065a7966, 0x85a759d1, 0xf360e809,
+    0xb5cc59b0, 0x9e160e05, 0xc52efcad, 0xf578ee59, 0x4af7bcf1, 0x07e752e9, 0x10fd16bf, 0xbf12e279, 0x8ae04ca7,
+    0xd33392d5, 0x288ed4fe, 0x9a00c670, 0x3442d38e, 0xc6a646eb, 0x03f10d44, 0xe9f7225e, 0xca2f0fa1, 0xaac2e3bb,
+    0x3693ff2c, 0xa5fd5974, 0x10aca931, 0xc79d2fc5, 0x1905ec05, 0x3c0036af, 0xdb27a2a5, 0xc52a6a98, 0xe5c39241,
+    0x325db3ef, 0xfda6d410, 0x95f371af, 0xbbfdf27f, 0x2b969463, 0x00af9e8b, 0xfd0a06b6, 0x3b31138e, 0xd2f95b87,
+    0xaef407e6, 0xf7868f7a, 0xe2e14e9f, 0x7e47aa64, 0x7b5b0c18, 0x68064222, 0xb328e3da, 0x1ea963a5, 0x6a5eea69,
+    0x07796220, 0x0f0f8722, 0xbd6092dd, 0xf0592f24, 0xb4fe1244, 0xe8ced2c0, 0x5c403977, 0xb4f35d9c, 0xa43dfd70,
+    0x17862bac, 0x610b9ce2, 0xc23d5d6f, 0x63e577d9, 0xf2c93a3a, 0x97d9e1fd, 0xea202a67, 0x83a413f5, 0x192c7946,
+    0xcf3f6b27, 0x1a2a1b5b, 0x69200bcf, 0x2a15f583, 0xe85c8f31, 0xa7ada8bd, 0xb38ffdbb, 0x4c34dfd2, 0x94d23baa,
+    0xbb181ce0, 0x32a26282, 0xfcc7549e, 0x3c7eb423, 0x8e401587, 0x842bc8e9, 0xfac296d4, 0x109b4bd9, 0xff007778,
+    0xbbadb765, 0x3f019170, 0xe481e6d0, 0x6fe05289, 0x3ff23f25, 0xd9388c79, 0x5e4f7f1d, 0x15a2c929, 0x9263b116,
+    0x93cc63c9, 0xdcf6aa50, 0x0eefb65e, 0x9282866a, 0x62e33ae6, 0x4d899719, 0x187b9976, 0xf5ea2689, 0x87e3b151,
+    0x5fcdfdc0, 0xc0df4539, 0x9da3e612, 0x76c37aff, 0xc2f069e9, 0xb8aec95c, 0xcb9d0a10, 0xd48ef6e8, 0xd5edf990,
+    0xae53cc89, 0xbb24e2f4, 0xb5eb3dee, 0x5b395688, 0xf116f57f, 0x4a8f7128, 0x3411060e, 0x92c514ab, 0xe863937a,
+    0xbaa41197, 0xe5dcc72c, 0xaf16a669, 0x664039da, 0x3fc1734d, 0x4c72099b, 0xfc14ae40, 0xe9b31fd8, 0xce00343e,
+    0x257e15c8, 0x12fbc35b, 0x833e7679, 0x27ca0696, 0x2bf7bc36, 0x530a6eb4, 0xd3fcd805, 0x454b1b6a, 0xe4c47cdd,
+    0x4f1906d3, 0xd94d2f52, 0x5187a7f2, 0xf8592c40, 0x4b6c96d3, 0x7bd3ae52, 0x023e2427, 0x31c4282e, 0xd8215da0,
+    0x1f43189c, 0x9e0aebb1, 0x363b6924, 0xbc50d287, 0xf9496a6e, 0x23b54310, 0xc32a677b, 0xa843fa43, 0x6d7b3b88,
+    0xca4ae62d, 0x96b3fb52, 0x4727ad3f, 0xa1ba25f7, 0x6ce483c6, 0xe46d9127, 0xfb54eff3, 0xfc5fbfed, 0x18db2aa6,
+    0x82914797, 0x1705333b, 0x7c374aea, 0x358367d4, 0xaa6212d4, 0x66ac9f4d, 0x4429b1aa, 0x838682ab, 0x5bdfd86b,
+    0x1e82010d, 0xbc02c620, 0x7174d1ca, 0x5bb5714a, 0xb1a06898, 0x3481ea5a, 0xe6a3da25, 0xda747472, 0x70b33853,
+    0xbcb36fa7, 0xb328445b, 0x18007475, 0x468e0836, 0x144b837d, 0xfd420f44, 0x23cf8bf7, 0x112c60ce, 0x90f65308,
+    0x7361dbf0, 0xd8493b1e, 0x4dfe98e9, 0x879d857c, 0x1c1b4958, 0x0fda938f, 0xd8fc7208, 0x763b5a31, 0x4cc05a2e,
+    0x5e68e36b, 0x838322dc, 0x01fa6412, 0x2edca5b9, 0x33cac6df, 0xc4900965, 0x61e54212, 0x9b899ea0, 0x0adbe90e,
+    0xed6bf807, 0x871a2102, 0x99f83316, 0xfaa0132d, 0x33d7f86f, 0x6bdf45df, 0xaa4f88c6, 0x84b2b95d, 0x89221af7,
+    0xfde369e7, 0xadafaa15, 0x86c4f91b, 0xc21cee40, 0xe54929fe, 0xdc03e09a, 0x5b6edd32, 0x406e133b, 0xfb7507a4,
+    0x6449e3a1, 0x66263430, 0xbce0953b, 0x4b68eaaf, 0x4946a06a, 0xb40599a7, 0x4472dbc7, 0x532e6654, 0x0c528786,
+    0x2af9030a, 0xade14def, 0xf0e7432a, 0xd23120a5, 0xe174b6f5, 0xc9f1fcdb, 0x230b4319, 0xdd780574, 0x58889d79,
+    0x888b4746, 0xe266aec8, 0x1b30570f, 0xec9b4e22, 0x380e1fd9, 0x748f2bc2, 0xb50d9f1c, 0x22c3c3f3, 0x0698d82c,
+    0x15593d39, 0x6b503b3e, 0x9561ef62, 0x1ca680ad, 0x44f1187c, 0x7d336a7f, 0xdba1b444, 0xd66f8a0d, 0x7df2a3be,
+    0x0dcb441b, 0x5bb5e4bf, 0x381b707f, 0x818cadc7, 0x812e2773, 0xcbdaa154, 0x2bc1b9e7, 0x9f483af4, 0xeefc8478,
+    0x73e830ce, 0xb353b81d, 0x5d4cd927, 0x4e2fcaa6, 0x441673b9, 0x5ca461b9, 0xc1a3b77b, 0xbfd0216c, 0x06f67edb,
+    0xe7929941, 0x49354022, 0x54308318, 0x11dfcb9c, 0x9a840dd5, 0x1cea82ad, 0x4d3aead2, 0x4149bb2e, 0x24cadfe9,
+    0x36333d7d, 0xb546ed5f, 0xf963fcba, 0x19ab91a9, 0xa2cafa34, 0x498ca20a, 0xcd9ca5cc, 0x8430b35b, 0x45da675f,
+    0xd7fd46ba, 0x3818a7e3, 0x277c9116, 0xdb5813b5, 0x9f013844, 0x678c88e0, 0x2f19938f, 0x52a33502, 0x7d4b918c,
+    0x345aadad, 0x0f4d0020, 0x111c02f2, 0xa696fc3e, 0x8bfef5ca, 0xcaa6e446, 0x4b0a5e47, 0xce55bc17, 0x09656fd6,
+    0x9be84e6d, 0x1ac46e31, 0x456acca2, 0x53e98c55, 0xfedfd4fb, 0x36b56901, 0x74d876ca, 0x44c167c5, 0xa6610e87,
+    0x14314c33, 0x646dc908, 0x40a72887, 0x8ada7673, 0x83486b67, 0x7e718d49, 0x9ff5958e, 0x672a212d, 0xe2d6f1f3,
+    0xfe627e5d, 0x791daf5e, 0x50943665, 0xf33f68cb, 0x10d90654, 0x040a07c5, 0x698a5f7f, 0x834e5221, 0xfbb625b1,
+    0x3e6a0f21, 0x9dad2288, 0x3afe1dc3, 0x99f64d76, 0x6f1ec1df, 0xb0892ea1, 0x8932f631, 0x0f22400f, 0x44006261,
+    0x72f16cfc, 0xc89ad73f, 0xe60b27fd, 0xebdb2c52, 0xc5a2f965, 0x49880d53, 0xe0a377c7, 0x6d4b80c1, 0xe4d1b6b1,
+    0x28dfd6df, 0xda09bb42, 0x09468622, 0x9ee17fc9, 0xd6c9844e, 0xd921b960, 0xa9450866, 0x5eaec349, 0x86de5619,
+    0x221917c1, 0x29cd6536, 0x08c1e273, 0x3e7b474d, 0xb3504a33, 0x1c926f0a, 0xe1f1106e, 0x06add0d4, 0xd0c462c6,
+    0x25933747, 0xb131fa1c, 0xab9f2895, 0x175713ad, 0x48910c97, 0x90b455c3, 0x494f49bb, 0xcd7f90a5, 0xb6709e40,
+    0x3a456351, 0x16335aeb, 0x043069b8, 0xe2bc8b6f, 0x08484654, 0x35efc1c8, 0x7fb2d13a, 0x543a223a, 0xe52108d6,
+    0x3f252972, 0x42f5810a, 0x13c8b807, 0xa20bf6c0, 0xa5ae718d, 0x0bd09563, 0x66ac29ea, 0xb022acf9, 0x87dcb2d5,
+    0x9bafb81d, 0x62e53468, 0x86ec692b, 0x6f991bfc, 0x47158a15, 0x4bce9b45, 0x9bb8cf13, 0xe5529f03, 0xb9a287bb,
+    0x8d6632f1, 0x8ba05667, 0xb81c2be9, 0x9d263673, 0x926195ce, 0x250d2c83, 0xc292a076, 0x695c4902, 0x5550ec24,
+    0xcfad36f8, 0x9ee5e794, 0xa799f02d, 0xebf94220, 0x2282630d, 0xc5eaa672, 0x3ba5216f, 0xa823a2f0, 0x41eca645,
+    0x2ab990c7, 0x63a4c199, 0x2a903d84, 0x277dfbfe, 0xadd8e3b8, 0xd9ba55f8, 0x186e095b, 0x5e4075b3, 0x526af581,
+    0x87dcb079, 0xc0d7eb3d, 0x38315d3e, 0xf20278bd, 0x50c43023, 0x892d80a7, 0x5a009668, 0xdea23b22, 0x9f8c78c5,
+    0x7481420e, 0x043b1bd5, 0x8eef556b, 0x1d7ea637, 0xfb31497b, 0x5d2b8163, 0x8d801702, 0x98d2fe2d, 0x3ed6b821,
+    0xb4d9fc24, 0xc219cccb, 0xcd691896, 0x2ce68b7a, 0xff16d663, 0x8dd0fc68, 0xf5f02adc, 0x3af3459d, 0xaa9bf9e9,
+    0x8d436e6a, 0x11ce6040, 0x725e6507, 0xf043a268, 0x31ce4e7d, 0x2222e485, 0x8749b526, 0x6934e270, 0x462cb504,
+    0xb2ccc077, 0x6162fefd, 0xb3701463, 0xa2ba5d80, 0xc3cb7c32, 0xc7e6f695, 0x79fa72f9, 0x11aec8dc, 0x231320ce,
+    0xeabc4ede, 0x82191ff8, 0xafb8910c, 0x02da5f40, 0xd9d12334, 0x068ffbdc, 0xc3a0826c, 0x972a93c1, 0xc6ea0559,
+    0x3e457dab, 0x9b5b9b65, 0x37b878cb, 0x67b76884, 0x24478b3f, 0x4067efa2, 0xaf8dcc1e, 0xfeff3319, 0xeadd9464,
+    0x043a8784, 0x750aff92, 0xc349cfbc, 0x289ff1e0, 0x13e9cb37, 0x85c7625f, 0x1cd44f50, 0xec04c135, 0x5ecc278f,
+    0x2b74651f, 0x3453e62c, 0xedbc41e9, 0xe20b9267, 0x32e1c10b, 0xc7e81189, 0x1a5bcb57, 0x0862a010, 0xb3c9a772,
+    0xe95fe6af, 0xd9b1de34, 0x1fe8ba90, 0xb1e075de, 0x37822b05, 0x4c535295, 0xed37dba7, 0x26112057, 0x68c688f2,
+    0x41b19555, 0x354c296e, 0xeba9cc8b, 0x9467d5e6, 0xe6f57ae3, 0xd83de721, 0x8eb96774, 0x4a2283d2, 0x828c2992,
+    0x980ddb34, 0x50ebce4c, 0x647a0ab6, 0x0ed8dcf0, 0xc5b46a8b, 0x1a8ff7f2, 0xedcd633f, 0x60f035c6, 0xd1efc163,
+    0x67c335d0, 0x6981f384, 0x6ca54c87, 0xa073b4a6, 0x59d159ac, 0x7aead5c9, 0xbf09d971, 0xb25d18b9, 0x321eb98a,
+    0xf5315cf0, 0x995fb40e, 0x0cc73d86, 0x33ba70df, 0xa1c926d4, 0x854f6c47, 0x059670af, 0x4a31b851, 0x86e2a930,
+    0xa571dfbf, 0x3a3fe4b7, 0x267de697, 0xb31d69c6, 0x086ee6e5, 0x10a2d4ff, 0x6cc7ed19, 0xb156f99f, 0x925d2337,
+    0xe23cc3fc, 0x712f8c73, 0x6edcbe75, 0x32a84f9e, 0x3e99cfd5, 0xe714aaf8, 0xbc2cef3a, 0x29c40a00, 0x1ce39a6b,
+    0xbf7d9647, 0x75871913, 0x188709dc, 0x48ea3e9d, 0x36bb2748, 0xb36c6141, 0x3af7f514, 0x33a6d8b3, 0xd9101e64,
+    0xdfd8eca8, 0xd5f5153d, 0x874f27ed, 0x56aaaac5, 0x731e46bf, 0xa44437b1, 0x13eb0f7c, 0x77b31835, 0x65c53459,
+    0x6ee4421d, 0xd7e9c92c, 0xf5e288f2, 0x3e3a2146, 0x4f09dbcf, 0xde9cc772, 0x51ea38d1, 0xda51a661, 0x65ead2e8,
+    0x23d7cf11, 0xea5a5b4a, 0xa002bef1, 0xc2deee19, 0xeb90cf90, 0x1bdd3c5c, 0xf0797b5c, 0x4d56c8aa, 0xebf1443a,
+    0x0e5f8848, 0xd61ad101, 0xf44c42a4, 0x15414f09, 0xd77098e7, 0x5ee1914d, 0xbd9532b1, 0x42168fee, 0x28e6e936,
+    0xd37d5397, 0xeada6952, 0x21d17c84, 0xe40c49dd, 0x108eca26, 0xed56296a, 0x07f45509, 0xe5005df4, 0x8c5c2dff,
+    0xfea92813, 0xda2b4bf1, 0xc08ba2e1, 0x1c3a5981, 0x7f7abc76, 0x3bb01dfe, 0x3e82aaa1, 0x8ecb21c0, 0x201b7eb5,
+    0x482196b7, 0x182d7a24, 0x1722f6ec, 0xe502cbba, 0xad9b8b28, 0x228e2b59, 0x0f72fdb9, 0x123152f4, 0xded23976,
+    0x2e489f82, 0x6d3ee0df, 0xa3d63125, 0x565c4afb, 0x68791a17, 0x2c28fe12, 0xb69d42e8, 0x881ccb9e, 0xa1bb6a8d,
+    0xa040c8ce, 0x41854573, 0x2a5d6e2e, 0x820a67dc, 0x6dcf0caf, 0xb8bfb2c8, 0xe19a859f, 0xfb877d69, 0xc91faf5e,
+    0xae766ef9, 0x8ca3b4d2, 0xcf11d179, 0xf26ccb02, 0x857e2d03, 0x48f8a69e, 0xb4dbf074, 0xe92d4640, 0x2f423900,
+    0xdd79ffb3, 0x5750d90a, 0x58045a5f, 0x9b2c378f, 0x32864934, 0x95e4353a, 0x8b398bfc, 0x70b55cfc, 0x97012c7e,
+    0xd5e24aec, 0x6731d1b3, 0x48ebc226, 0x89672437, 0x2d28ee81, 0x7b149603, 0xdc32e155, 0x977f8753, 0x0ce8e2cb,
+    0x18281991, 0x42588569, 0x39d1418e, 0xd6da5eda, 0x642b4a5c, 0xf8ec48fb, 0x7f664711, 0x6a535412, 0x25c20971,
+    0x915978fc, 0xb7341495, 0x3f9f40a8, 0x871795ab, 0x23d301d9, 0xe7b80307, 0x0609bf8b, 0x7c87e829, 0xf959b7d9,
+    0x5d2420d9, 0x2ab2f53a, 0x9dca605d, 0x5120c0fc, 0xceecf120, 0x2d611e16, 0xdf4ff30c, 0xb6cc52fb, 0x4a5faf73,
+    0x1f0d6fc1, 0x46cc9793, 0x617a9aae, 0xfda4c737, 0x288969c6, 0x0a9f4b80, 0x5e319a89, 0x477d5c34, 0xe2ef3d70,
+    0x966339d1, 0xce684564, 0x83af2d51, 0x9f4f2628, 0x5a88ee8c, 0xf4b0bfa5, 0x6db3425d, 0xce451d6f, 0x6f2a53e9,
+    0xe9e41174, 0xfc571a6c, 0x1670ecf0, 0x4b376b4d, 0x7616a6c1, 0x8853617c, 0xec0277b2, 0xc5736a45, 0x4c22072e,
+    0x1e936d65, 0xacc7c5eb, 0x14a7d65c, 0x42d132eb, 0x9e2f1c77, 0x6413dae3, 0x017950b3, 0x1e54e24c, 0x65721063,
+    0x0365098d, 0x013e15ad, 0xc990d5f4, 0x10dff7c0, 0xffc2ab62, 0xc147c483, 0x6ff9edba, 0xd9abf52a, 0xa1d7537b,
+    0xed216f9a, 0xcb714de5, 0xd29ca05e, 0xa0a2ec8f, 0x1a4a2012, 0xa9ba4144, 0x1f79715b, 0x6adc31ff, 0x4d0d291f,
+    0xf602de55, 0xb69fb6a9, 0xeb575c85, 0x7445a9e9, 0x385b1051, 0xc15bc459, 0x1bc003d4, 0x844f0dc1, 0xbecc44de,
+    0x2c25c236, 0xa52f0a08, 0xc80aeee2, 0xaa209bf1, 0xde382e84, 0x43b0fe9b, 0xb83c1d09, 0x2a724431, 0x99029b50,
+    0x28f20221, 0x7751d0ac, 0x03dc05ca, 0xdf3723ae, 0x3e6637f1, 0x4dfd2fea, 0x39d98822, 0xbd2995e9, 0xd906ec04,
+    0x168f81f0, 0x39b22269, 0x143abd79, 0x8cd7c8a6, 0x831b3d21, 0xcf594cca, 0xb921c72a, 0x9fc5a234, 0x55d0fbec,
+    0x7589a27c, 0x8bd7dac4, 0x67b9a400, 0x612d2eab, 0xa70771d4, 0xd4c756a6, 0x43ee70e4, 0x10003659, 0xb3cc1090,
+    0x7bc2685a, 0x16c2c8b5, 0x90351619, 0x06aa683a, 0xda34591c, 0xe2daa397, 0xdd98960a, 0x0885497c, 0x7a2bf17c,
+    0x84b6ab49, 0x5b3c6835, 0x0015afb6, 0x3489b433, 0xcec96034, 0x0623a3a1, 0xe2cca1dc, 0x4b783cfc, 0x0601ceca,
+    0x89cc97bc, 0x713d3b24, 0xb2d7e2e4, 0xcf222af1, 0x4dfce26b, 0xec6f1b6c, 0x0ff86b84, 0xf13e1b76, 0x341590fe,
+    0x86363b5f, 0x374e92b4, 0xc0178983, 0x1aa64414, 0x578a98ce, 0xf2b52f50, 0x4de87319, 0x67200ef2, 0xe52c4101,
+    0x21d8a5e1, 0xa22063cc, 0x1d0e7882, 0x6d1ebaec, 0x068971e9, 0xfe6ca3d9, 0x1163a3b3, 0xff115bd4, 0x7368089c,
+    0x7286480b, 0xbb1f5fee, 0x3af095aa, 0x09f22cea, 0x4f9e1bd2, 0xfafbe980, 0xcc6e7b23, 0xe516c9a0, 0xeab5aa5d,
+    0xf99a0da8, 0xad5d5bb8, 0xe9632a22, 0x13a090db, 0xfce40b99, 0xa013961b, 0x614782cd, 0xce169d44, 0x6433de5e,
+    0xd1edc4f5, 0xae59131d, 0x37e4dcf9, 0x5e1da0bb, 0x67a48046, 0x089840f6, 0x4c181c61, 0x2518fe12, 0xeb3cbf13,
+    0x37c8aac9, 0x558f93f1, 0x95f11417, 0x3033a3e8, 0x3024f142, 0x6f86eee9, 0x099cdb88, 0xdd6706a1, 0x4f1b105e,
+    0xc0ac7573, 0xca381e11, 0xfc5916b6, 0xb6040daf, 0xee0c2e92, 0x983cc9ff, 0xbe618b41, 0x4399b558, 0xa40b3211,
+    0x332f9714, 0xa3804fc5, 0x52feadba, 0xd52ca3cd, 0xcbc279ba, 0xd44f56d6, 0x4a0ab377, 0x027e218f, 0x1e534958,
+    0x37552b9e, 0x9761e038, 0xa23e86a6, 0x116a9b41, 0x2d0b1f6d, 0xf16d572c, 0xf897617f, 0xb56d3dd8, 0xe6e2f78f,
+    0x9db48f44, 0x411d8628, 0x2deaa2d7, 0x01b02bc5, 0x3937c6a4, 0xc737e243, 0x3cd3dded, 0xae4691ad, 0xe9b11f94,
+    0x282cbcd3, 0xd22cd298, 0x2ee306fd, 0xc38041aa, 0x9b2f4362, 0xe525bc66, 0x293c892d, 0xcfed5315, 0x27f4a06d,
+    0xea70b3d8, 0xda6d733b, 0x3d8456a9, 0x978e905a, 0xbcd50896, 0xe213b4a8, 0x9a882442, 0xab4e1d7d, 0xf28f7f9e,
+    0x98cf670a, 0x5698df8d, 0x67450862, 0x63e316e6, 0xf786511c, 0xd2898b98, 0x9f18ac05, 0x5e438a95, 0xfa64de5a,
+    0x45ae6732, 0x2d8ad29f, 0x30c22b30, 0x15334b14, 0x11e40e82, 0xc2bca40d, 0x4a92cc5e, 0x1adbe429, 0xe6c611e2,
+    0x3c9c2d05, 0x6794edd6, 0xc22cc352, 0x60ff580f, 0x4fe05108, 0xad52940a, 0x5f3846f7, 0x3d01ac6e, 0xf38f23ef,
+    0xc045f697, 0xfd090038, 0x0e7dcda4, 0x0d731cb8, 0xa4b773d4, 0x5be0c93f, 0xcc6553f2, 0x0832409c, 0xd2af9e9e,
+    0x36ae74e4, 0x1529d05e, 0x549dd914, 0xde77cc81, 0x19b0e2f5, 0x0901f651, 0x709e3d23, 0x78bc29c7, 0x4807e79e,
+    0x265c6785, 0x0c1a690d, 0xfc691820, 0x15395067, 0xce84577e, 0x76703629, 0xdd775d2d, 0x0e30c2b9, 0xd85611c1,
+    0x4dcf3d54, 0x8d60151f, 0xb6f88148, 0x7ab50050, 0x254728df, 0xd6e8965e, 0xe9c765c6, 0xb326cc47, 0xe0faa978,
+    0x9cbb1de5, 0xf551ae5f, 0xd9ba5798, 0xc6390dac, 0x1cefcf7b, 0x2794ddf2, 0xb77eda67, 0xc49052e6, 0xc514a075,
+    0x48368808, 0xe70d1603, 0xa9e1c1f0, 0x6b3951fc, 0xc6bbd4e6, 0xe4557239, 0xf7b0e06b, 0xac77dcae, 0x275f014f,
+    0x2cb79526, 0xe5c1d388, 0x15601771, 0xc6029172, 0x15f82b87, 0x8a992da8, 0x3c4f8cd8, 0x25c4b7dc, 0x1eb3ae90,
+    0xf28a6231, 0x9eaa4f64, 0xe9468748, 0x1a69224f, 0x938bb596, 0x6c059416, 0x4dfb7956, 0x87b23c10, 0x07a04de9,
+    0xd8eae4af, 0x46876f0b, 0x68514f53, 0x310eac97, 0xd60f7bb9, 0xad7cd76d, 0xa6c2b817, 0x0dc8be0d, 0x262cfc11,
+    0xd1daf994, 0x8f2d60e5, 0xf5b7101b, 0xb0b164c0, 0x210a09be, 0x6feb0966, 0x4abbe46a, 0x6acaa72c, 0xbbd93713,
+    0xb96e1520, 0x15f4c9ed, 0x45d1266b, 0xc5b71d17, 0x801dba87, 0x98d7b025, 0x45b993ca, 0xe69d4732, 0x5389bce5,
+    0xf0484918, 0x7e227ef1, 0x534565f7, 0x0909ecd4, 0xfd3d98db, 0x2a97819e, 0xc1281216, 0x62a8e0a5, 0x200442ca,
+    0x1af1c025, 0xbb8bf576, 0xd6712785, 0x427d52e4, 0x108f84e0, 0x0e8cd3c4, 0xabb4ad93, 0x7ad9f9e8, 0xdd9423ba,
+    0xb05cc0e0, 0xa8f1cb79, 0xcb4c5765, 0xa37a506d, 0x4bf9a5ca, 0x07a073e8, 0xa1d2622e, 0xfdabc0e6, 0x951e3c27,
+    0x63d148e2, 0x939ad0f0, 0x29525a46, 0x311adadb, 0xcc76eed0, 0x96ad3585, 0x2c08eb33, 0xb3d31251, 0x6db63d2c,
+    0x1588ecd0, 0x18c5f341, 0xfc2acbe4, 0x4e639f0b, 0x912dbb3b, 0x4baa88f9, 0x70e8b98f, 0x425ce53e, 0xea08bce2,
+    0x29bc2f91, 0xac5eaa62, 0xfb4b56b4, 0x18575639, 0x7d43ceed, 0x96dab1a1, 0xe1646778, 0x9d68b63a, 0xb58638a4,
+    0x8bc6cf4f, 0x30f0365c, 0xe42ec54d, 0x6c07f688, 0x8897bc95, 0x96223af0, 0xd50a59ef, 0x960ef2b7, 0x634cdee4,
+    0xc846f19a, 0xb48cb95b, 0x44fe4aa5, 0x8f778228, 0x423fbd15, 0x5b40740d, 0xab51acfb, 0xb484398b, 0x6bbb33dd,
+    0xdb813471, 0xb4046784, 0xbf215e96, 0xf15716db, 0xb6445c93, 0x80df65ef, 0x8bb5d226, 0xf708838e, 0x2caf050b,
+    0xf8065c89, 0x1278f29e, 0xaa5362a0, 0xf72e9080, 0xfbd2452d, 0xf229bb5d, 0xbf557de9, 0xd7c2529a, 0xfd4cda3c,
+    0xe79c8672, 0x8b274a14, 0x3c0479c7, 0x9254685a, 0xaaeedd05, 0xa14482c6, 0x1d65d3dd, 0x143694ad, 0xe1dfb46f,
+    0x6612a41f, 0xde3390f3, 0x437d630f, 0xf2701fd8, 0x51b9cfe9, 0x0a455432, 0xc295db23, 0x2bb62a5b, 0xb204d0e8,
+    0x6746103e, 0xa0eff544, 0x0bba778a, 0x86f1078e, 0xcb59c4a9, 0x27934279, 0xb46e3ca7, 0xb9b49d7e, 0x38d0a791,
+    0xf1ee2d08, 0x1b100e82, 0x4ba518b3, 0x75ed5f41, 0x58f725cf, 0x0e618281, 0xa5574a16, 0x46f0d5be, 0x9d8c7768,
+    0x7ea8c2c3, 0x923d9271, 0x5eaf34d3, 0x79c7d183, 0x14a8fd0c, 0x0d5b51bf, 0x5ebd7950, 0x14ea6a26, 0x836db01b,
+    0xd7536e36, 0x2e87e1f8, 0xb70806df, 0xdd0fb988, 0x956656eb, 0x71824b50, 0x945074d9, 0x23322de1, 0xd1d5c2c0,
+    0x0f788f73, 0x9a1fac27, 0x168da944, 0xeece3bef, 0x6a2262e0, 0x0440ccb0, 0x479e6c92, 0x5ce3fa8a, 0x2075b595,
+    0x652c3e86, 0xa5812635, 0xc96d9bf5, 0xa5136312, 0x983aa9a4, 0xb41ddc82, 0xdb4a2241, 0x806460ec, 0x183637f9,
+    0xfb281422, 0x78691843, 0xb4a5778a, 0xfeb158ee, 0x9218ca7a, 0xcb9baccd, 0x4740f793, 0xae756dd4, 0xd0e93bd1,
+    0x5f394ac7, 0x7196fe01, 0x6803c5bb, 0xb56898e6, 0x38fb496a, 0xfd8aa499, 0xd3489c47, 0x58e42785, 0x2d9e5200,
+    0xfcf470a7, 0x4d36dd6d, 0x8d10a972, 0xf531beeb, 0xd5a9751d, 0xbf706d38, 0x12af2d21, 0x3804a901, 0xee4b2926,
+    0x724a1e6a, 0x1f49fcfc, 0xb0dc2751, 0x535504bb, 0x571ea1f0, 0x9a367ff0, 0x608c7c3f, 0xf8a002e6, 0x6eac9618,
+    0xf8481f7d, 0x58e023b6, 0x17397392, 0x0e1c3a37, 0x3a8e33d7, 0x6bf9a536, 0x9800d55f, 0x1f8a238e, 0x4a497edb,
+    0x4075c90e, 0x47e918aa, 0xcb184527, 0x307019fd, 0x8f25f29d, 0xd839eaa1, 0xe1894005, 0x43980af8, 0xc548731c,
+    0xb19aa6c3, 0x64041f13, 0x45d2b126, 0x19710770, 0xbc4bc2ef, 0xec8107d1, 0xf897d70c, 0x92d1c238, 0x59503c44,
+    0xa5a4d885, 0x4cce0663, 0x9144eb1c, 0xdf9190ba, 0xf5278dfb, 0x5bfe1c63, 0x82172a29, 0x5db3569b, 0x6a0ab6f7,
+    0x85882bb9, 0xa5501135, 0xb46f125f, 0xd404ea8f, 0x22ca5a64, 0xbf5b7905, 0x1fe2e366, 0x2308bd61, 0x97d85545,
+    0x188034ac, 0x059b1af2, 0x23bb66b6, 0xbfbf80fd, 0x3e248157, 0x81dd2ce0, 0x8dbd59b3, 0xabdbfe7d, 0x5aab6b45,
+    0x4f35d9ff, 0xbcdb779e, 0xd0c08a07, 0xfcd45320, 0x798e0a65, 0xdf20eb07, 0x34f8694e, 0x1c770666, 0x656f5851,
+    0xc2110048, 0xef4c9825, 0xa66a7b86, 0xa9b737f2, 0x5d9e546a, 0xe23ab35b, 0x9de51a14, 0x146c5f47, 0x0237ed3e,
+    0x3d923162, 0x421f596b, 0x882edd66, 0xf74a2293, 0x7b6e5b19, 0xad4d5830, 0x6cead3a8, 0x61adbb39, 0x49c719e5,
+    0xdd650415, 0xca931f31, 0xc74ecbe9, 0x266386a7, 0x0d42f1a4, 0x13e3d3a0, 0xe0a35fd5, 0xac3cdb15, 0xaddd3c63,
+    0x9d0f479b, 0xcfa8ad38, 0x9efaf5ed, 0x6ce6a128, 0x4e7651d7, 0x64c35ab4, 0xb7afe7e6, 0x20d00302, 0x0718e1f1,
+    0x9f2c8340, 0xfd1daef8, 0xa74fac13, 0x66e13a4e, 0x4e98435a, 0x10df673a, 0xb6747958, 0x6bcb60f5, 0xbce4158b,
+    0x6259bed2, 0xa6002f2c, 0x40dff3b0, 0x1fae6336, 0xf92e0164, 0x2d680e92, 0xf9799a6a, 0x1a67cf71, 0x7c761c44,
+    0x166cfe2e, 0x286d4b0f, 0x48d9a451, 0x248cbb97, 0xfaedb501, 0x06cfcbf3, 0xa46d054b, 0x11efbcb7, 0x2a7a9b08,
+    0x436ca416, 0x0091a7da, 0xe705853a, 0x124b6d44, 0x7237703b, 0x57652c28, 0x2f12db11, 0xde851d5d, 0x6a2c4895,
+    0x99f5e336, 0x67e6d388, 0x1ad75a86, 0xa85bc994, 0x21efee66, 0x92b14a16, 0xdea5cbad, 0x9538956b, 0xdeff2973,
+    0x20fa88af, 0xb24cf246, 0x54dcaac7, 0x35f9434f, 0x341701e9, 0xe34451dc, 0xf3f7ce3e, 0xa9274ddf, 0xdcffa15b,
+    0x1b7fcd81, 0x8b7788b2, 0xeed33956, 0xec54aae4, 0x5ec185e6, 0xe4d9db6b, 0x6ab131f2, 0x278febb0, 0xdeb5cc9a,
+    0xe5e16b56, 0x34dedee3, 0x0d18ecd5, 0xe39a969a, 0x11792fc6, 0xdf55d94b, 0x54afe658, 0x112a8ec2, 0x385e89a8,
+    0x75d09b3f, 0x3dfde633, 0x7ac9c8bb, 0xe31acfd0, 0x1ab0661b, 0xae2bce96, 0x0c60638a, 0x0c83492d, 0x95d61b20,
+    0x507dc3dd, 0x24eb3fdf, 0x74dbdf7a, 0x41c556d7, 0x58a46242, 0x004d0ad7, 0x0aad4ab7, 0x82dce589, 0x8550c98b,
+    0x31b2a19f, 0x712cd22a, 0xb9f104dd, 0x10bd45c3, 0xc9981e3e, 0xc0233ce5, 0x8a49a2ef, 0xee838f6b, 0x57dfc629,
+    0x50f5b110, 0x0c23b119, 0xbc27c7e8, 0x37add957, 0xf5219fa0, 0x7f574918, 0x81d51d31, 0xd084e8c8, 0xf3979f4f,
+    0xd1b98d82, 0x632df3e2, 0xfa56e889, 0x14466593, 0xbe5b3c45, 0x2e6a2e27, 0x01a6f752, 0x6e5a4db7, 0x961c96a0,
+    0xe98733e0, 0x32930ef9, 0x8bd935cb, 0x319d7323, 0x099f3234, 0x8044141c, 0x74cff4e6, 0xbf07f58b, 0x3507c13d,
+    0x03e71459, 0xe3a622da, 0x3ea22532, 0x1c6c91ff, 0x7dda5782, 0xff547f35, 0x462c2d50, 0xa1bee963, 0x75257595,
+    0xf7c526e9, 0x8b18c3f6, 0x3c228bac, 0xb121f930, 0x9d1a0840, 0xacd2676c, 0x4d827630, 0xf12a2f87, 0x900624fa,
+    0x60b463c3, 0x669e525b, 0xd7fefa7f, 0x96e4ce98, 0xe4a58e4e, 0xd4facc88, 0xf3be72c7, 0x01ca0052, 0xdf927440,
+    0x65b3e648, 0xfe80e75a, 0x17fdce18, 0x610ec9fa, 0x7ecfd059, 0x066f4a68, 0xa55688e1, 0x4f2df852, 0xfd63cd72,
+    0x55ac0ccf, 0xf300a4a5, 0x46bf3c5e, 0x08744922, 0x8766e5b4, 0x54de2a50, 0x9e2b0622, 0x22c7180d, 0xdad6b9e2,
+    0x6ac0a2b4, 0xacd63d88, 0x1b95c283, 0x023cd23d, 0xad931003, 0x5ce67a2f, 0xc3e5a1dd, 0xe283d568, 0xed5dde21,
+    0xc226cc77, 0x294e0e4e, 0xb1750995, 0xa38789ce, 0x125c482d, 0x53ae99f8, 0x026916e1, 0xac0ca1e8, 0x7dbd5b51,
+    0xd0489c01, 0xf275cdee, 0x61f03bea, 0x751d5196, 0x38bc0ba8, 0x992925ad, 0x8e9c3e6a, 0x84d8de17, 0x89816c5a,
+    0xd049db69, 0xe3bd73ab, 0xb0db4a15, 0x513d36c1, 0x825554d8, 0xfbe0cf2e, 0xf181c983, 0xf06e2fe9, 0x5d6bc3c2,
+    0xdd4943bf, 0xdeac8839, 0xe1b21b60, 0xf5de2ecd, 0x1d263007, 0x8aaa2383, 0x879fbf6f, 0x0c117533, 0x0b70ddeb,
+    0x2fb74b12, 0xf9cd9f82, 0xa0dfb688, 0xf124b4e3, 0x3167eb53, 0xa018e47e, 0x0f9ef6bd, 0x4a7a4ef5, 0xf3889c58,
+    0x3b2f6145, 0xe5997b81, 0x4489b2a1, 0x29d89905, 0xcdf9384a, 0xdc38cc9c, 0x6f2cdb89, 0xa16a270b, 0xd0e256f3,
+    0x39135fcb, 0x90c8508e, 0xf3d29eeb, 0x31854624, 0x8fffd4fb, 0xc55cbd39, 0xe47c7c7b, 0xee1a4675, 0xf2390d38,
+    0x4cd711a6, 0xc46a6a58, 0x2d82b595, 0x5a6aa783, 0x55b6eb3b, 0x059c5471, 0xdc545daf, 0xaf4d801d, 0x69036fe5,
+    0x9920ac09, 0x02db13ae, 0x1994470e, 0x8c368bad, 0x306407a7, 0xedcdee0e, 0xb35705e1, 0xfe7968ab, 0x057d744d,
+    0x108cdb88, 0x9bc9fc39, 0xdcf2a150, 0x5920a130, 0xd7309797, 0xe7432f51, 0xab3ca2ca, 0x675527dd, 0x43ec0351,
+    0x1b2cc70b, 0x393b5885, 0x49c355db, 0x8a8f0662, 0x6032cc37, 0xf382c1b4, 0xf8781fbb, 0x5d9b4f01, 0x2944706d,
+    0x17662038, 0xcbc11d90, 0x03fa3ca6, 0x959fa620, 0xacba35c8, 0xa0592429, 0x6e2f8da6, 0x8ee22fc9, 0x9970baae,
+    0x67e265d8, 0xdcd48050, 0x263d3753, 0x938899f1, 0x02733b96, 0xdd38455e, 0x253d5795, 0xa8e3738b, 0x9770975d,
+    0x8f9899b0, 0xc2baf18c, 0x93df2492, 0xbbade281, 0x52e900b7, 0x86d9909f, 0x233c4e67, 0x67b29b8e, 0x4a263bfc,
+    0x217b9e71, 0xe87ba100, 0xb2081099, 0x580c3602, 0x3c7426a1, 0x24385f7d, 0x138062fe, 0xce01781f, 0x469c954a,
+    0xacabe801, 0x47952193, 0xd3138e94, 0x3e6b18b7, 0x0084e991, 0xb39ab0d1, 0x3c4e8698, 0x9db0f02a, 0x05ca4a6c,
+    0x68161660, 0x6365afcf, 0xfe7c2c9b, 0x2e0ca2f6, 0x0de81591, 0x59530f41, 0x3755299e, 0x8951bdbf, 0x90ce9043,
+    0x96847976, 0x75263c8d, 0xc6feca9b, 0x2a1299d4, 0xc151b5dc, 0x4fef4e0c, 0x8b9371bd, 0x260abd19, 0x96804723,
+    0x0104776d, 0x0d089f9b, 0x646f75be, 0xbba86b30, 0xb3575a2d, 0x68358d00, 0x21c9b287, 0xa65e6a28, 0xedabeffe,
+    0x9ccdec13, 0xe9a805ab, 0xc0c35376, 0x3c841106, 0xfb4dc78b, 0x9cc21d3f, 0xea3ec0d8, 0x25d6ba47, 0xec63d289,
+    0x3803e7c4, 0x04feb5a0, 0x98ee239f, 0xb6e6d137, 0x75eccc6b, 0x3f327184, 0x671596a0, 0xa08b6a5b, 0x0bca7779,
+    0xb687cc6b, 0x6d028606, 0x8969cdc1, 0x9b5ccec4, 0x093bf3b5, 0x2ee44040, 0x42b7e533, 0xbdb2f9ab, 0xad4916cf,
+    0x8ec953aa, 0x4c869ce2, 0xc40abb60, 0xaac46459, 0x96110b50, 0x50eb5bb6, 0x8f71e7c5, 0x00becc1e, 0x08da58de,
+    0x9e283138, 0xb2631843, 0x8c9d46d6, 0x5a8f4929, 0x953f3773, 0xc44c858f, 0xa2b0a933, 0xa60e6a65, 0x594689f7,
+    0xa4fa2f87, 0x472f5be5, 0x3791c1f8, 0x15767f1b, 0x7bd3528e, 0x77e0c746, 0x08f97807, 0xd0658dd3, 0xbd160588,
+    0x6fba83bf, 0x0d4a30b4, 0x288f435d, 0xcaf84c6c, 0x3ca69254, 0xb4d22840, 0x3af925a3, 0x82eab3ff, 0xd2343fae,
+    0x288f025c, 0x5cb97759, 0xc8c85692, 0xb1a71f96, 0x3b4c6cb2, 0x1de25ce3, 0xab7bc371, 0x802889d1, 0x7d4f1ea5,
+    0x8431f79f, 0xa933f2d1, 0x58d325a4, 0x15a17320, 0x024552c8, 0x5378e29b, 0x8c33cc6c, 0x9b0b0ade, 0x6373a3b0,
+    0xa16c60de, 0xd40ffff5, 0x334f1a19, 0x7d195566, 0xb5f86898, 0x4d64e1d7, 0x4c9ca5fd, 0x7f1f3313, 0x30013306,
+    0xea8d1551, 0xbc14dbd5, 0x2186e991, 0x1eb5a04e, 0x5689b9b1, 0x0e5bcdbf, 0x40ee3943, 0xb7e06c50, 0x5e197a89,
+    0x6549d8b0, 0x99fa0ede, 0xa04353f8, 0x99fbebfb, 0x6bfcc2bf, 0x089d8fd6, 0x274cfb26, 0xbccfb003, 0x0659b886,
+    0x55f8d60f, 0x5fb7dd2f, 0xc0702858, 0xfa327edc, 0xf1c81c74, 0x83ac2e76, 0x38cb41ab, 0xc588c676, 0x5429f255,
+    0xbed76d66, 0xf5b960da, 0xf438566c, 0xec4bf3c1, 0x8d9c8650, 0x9c301d54, 0x7d988a89, 0xcbfd03b7, 0x5162edc3,
+    0xad500497, 0x4e7a1157, 0xbbdd371b, 0x17ad0e1c, 0x249f4579, 0xc2bb3437, 0x8d0f0fe9, 0x92283041, 0x6beeb579,
+    0xd63f0be5, 0xab6860e5, 0xe2accf1c, 0x399acb91, 0x7971524e, 0xd29f527f, 0xa46fe70d, 0x1592542b, 0xef6e61d8,
+    0x14e89c06, 0xbc2f4b3f, 0x8f62d408, 0xa37ed210, 0x990fad08, 0x7bbbdc0b, 0xa33121bc, 0x4ed7b964, 0xff1f6c98,
+    0x0c18e69a, 0x717d8944, 0x243406b3, 0xb193790c, 0x88b9c2d7, 0x0cd28f68, 0x7139ba2f, 0x1b1dccad, 0x72ce2fa3,
+    0x38d85aec, 0xd62520ba, 0x94bb4b98, 0x04995c60, 0xd2fc689d, 0x7e08cc0a, 0xf67b2bee, 0xf9e9c64e, 0xc82fa175,
+    0xb2e5a59c, 0x1d02dc38, 0x53198d25, 0x89898067, 0x418a2fef, 0xc749282d, 0x46db7d5c, 0xf2b3225b, 0x0b304f47,
+    0xbbdb8c62, 0xf6dd386b, 0xe3358787, 0xa60c7c5e, 0xcc385582, 0xfea550a4, 0x77ebb688, 0xc866ac78, 0x8b3af4c0,
+    0xce5af4fb, 0x712564e1, 0xaf51a941, 0xec9c804b, 0x4552c051, 0xefcf817f, 0x68b28a30, 0x435a0953, 0x426a1bc9,
+    0x66f6d4a7, 0x3e2a6c9c, 0xe0f894c7, 0xb80797cd, 0x7c26f4d8, 0x4c11143d, 0x23cf3dac, 0x08dac7b1, 0x33084521,
+    0x5b186874, 0xb7c6063e, 0x1619fecc, 0x171e9c40, 0xf67976da, 0xd7f61474, 0x6fb47b9e, 0xa4f458b1, 0x499c86a6,
+    0x2606ebaf, 0x310c0fb9, 0x762e81a3, 0xbc021357, 0xa8626735, 0x516dea22, 0x83df392a, 0xc94b8391, 0x7bd8e512,
+    0x1f518a9b, 0x34bec75e, 0x28a9fca2, 0xb6bb3140, 0x269527ef, 0x7611b5a8, 0x449df40e, 0x93f035f8, 0xafd2521a,
+    0x5ee63b58, 0x5e46dafc, 0x9cf4ebe3, 0xda251e5c, 0x7cf00d14, 0x86e98698, 0x21a0102c, 0xbd0e65a3, 0x036f9e12,
+    0x1160ebad, 0xfcfffb1d, 0xc57870c9, 0x83b7f3b3, 0xa95e13f5, 0xab66ec2f, 0xe7b9ffd7, 0x73d83727, 0xd27edb9b,
+    0x2d45cd2d, 0xf38f13da, 0x6e55cb65, 0x8a2bc57d, 0xd99e6a3b, 0x33d73f03, 0x5e260bcf, 0x341014e4, 0x18408784,
+    0xf9621d42, 0x77ee21f3, 0x7ab1a367, 0x2106e2a5, 0xed2f174e, 0x12af80b0, 0x71f79fe3, 0x848525e1, 0x56a214ad,
+    0x45317e93, 0x0ee6c982, 0x17b9321a, 0x0b82cc99, 0xbc9c1874, 0xe2fa59fc, 0xf8d51a00, 0x2324f29d, 0x1ec9c05e,
+    0x4999c91d, 0x2f605595, 0xebfd3edd, 0xd0bc14de, 0xdf02f2c2, 0x58b69b5f, 0x2e810888, 0x0b369cae, 0x080f5133,
+    0x8a9b5dca, 0xf8e5b728, 0xba755ca2, 0xfd30d47c, 0x6240207c, 0xb2305418, 0xe159fa21, 0xf8ab5684, 0xbd3b8b9a,
+    0x2495ce7e, 0xbe842f1a, 0xf25816d5, 0x4b50b624, 0xddfb7508, 0x873ceff5, 0x428761dc, 0x97459150, 0x709e0a12,
+    0x3932ed14, 0x8d65ac39, 0x9104ce3e, 0x19bcaaaf, 0xe4c40de3, 0x0631bf9b, 0xbe293e3b, 0x3be12b51, 0x69203de4,
+    0xac958667, 0x060c8fba, 0x56e70a6d, 0x1b35b75b, 0x409540b2, 0x12ee27f1, 0x5ecdb6f9, 0x7874bd29, 0x6676a89c,
+    0xac7d020e, 0xa7bf5312, 0x4c6834b7, 0x1c643739, 0xa9661633, 0x79f55e93, 0xb67f1c85, 0x04f3e211, 0x8c85efd2,
+    0x03f9e743, 0x3004dfb0, 0xce6cdcd7, 0xa80663ad, 0x62409b79, 0x2e7ab078, 0x754057a9, 0x61db725b, 0xfb7b8122,
+    0x9ad90bde, 0xf7806d7e, 0xe0b14b1f, 0x79cae866, 0x5b89d581, 0xcddb3f14, 0x186fe8c0, 0x53991454, 0xf3ab1f5e,
+    0x7192f548, 0x4148b4c9, 0xbcff8a9a, 0x062d1502, 0x224bdb3a, 0xb921903a, 0xc4de3842, 0xd2fdfb2c, 0xa1fc99fe,
+    0x1e858716, 0x1f433ad1, 0xed71fafd, 0xb5b18215, 0xdf83e68f, 0xbd52b4c4, 0xf7da8c4c, 0xfd35ccf2, 0xd2473bb9,
+    0xf999cf74, 0xc912402a, 0xb025c7f4, 0x5b08ffda, 0xbe62d1aa, 0xf6d8a9b5, 0x32e8b9f2, 0x103ef0a9, 0x1888642e,
+    0xfaede01f, 0x48eccb49, 0x07a87244, 0x9f2e0301, 0xebe37ead, 0x2adde9f0, 0xfa099ae9, 0xfc972f10, 0x3187f4d8,
+    0xe0de82c1, 0xaee9dcd8, 0xfd342170, 0xf3d36a92, 0xc8497e1c, 0xad45f850, 0x49fca786, 0x6f658235, 0x140e3402,
+    0x8ec2282a, 0x146232d5, 0xf4241f66, 0x44ab881f, 0x817e476e, 0x539c7855, 0xa1749c87, 0xefe6eeab, 0x4c6044ef,
+    0x2d03e06e, 0x305c322c, 0xd277728f, 0xcdaa2229, 0xe4c15451, 0x2fda9847, 0x84b8a8b0, 0x9c3c1d9e, 0xe8fd7509,
+    0x2c33b686, 0x6cdcd4e1, 0xb5a3fb7c, 0x5c5994e3, 0xfb055241, 0x1c65f66c, 0x9d8423e7, 0x435fb78e, 0xf69853f1,
+    0x132961c6, 0xbe0e857a, 0x67c2b6df, 0xfeef2aa7, 0xfdb6a205, 0x24760749, 0x1a35752b, 0xc5435823, 0xa9d0de99,
+    0x92c76088, 0x015b1ab5, 0xef160906, 0x3372b7b3, 0x54dcad9d, 0x25dce3fd, 0x0b0c3597, 0xce93f4cd, 0x822382ec,
+    0x9227d82e, 0x35a33745, 0x2bbfbeca, 0x698727d5, 0xcdf67a6f, 0xe13d1b95, 0x21ba5d29, 0x7f5f2e55, 0xa80c4f49,
+    0x411d115a, 0xb2a0d3c3, 0x0366e8db, 0xade19cdd, 0x588ee9a6, 0x22d8cf07, 0x1d102774, 0xe3a1c2c1, 0x88f530cf,
+    0x3ce11c61, 0x82fa3fa1, 0x8c186e14, 0xaa0959d2, 0x25fb2b8a, 0xee287e2a, 0x771beb25, 0xfda6fcc5, 0xfb167dcf,
+    0xc83c381c, 0x098d5293, 0xc0738c93, 0x43375662, 0xb0f9df24, 0x12d32283, 0x10f2cf5e, 0xda962c98, 0x7180ca56,
+    0x359fc239, 0x806328f8, 0xa6ad255d, 0x57ab6bed, 0xbb996b22, 0xc2dc0d9c, 0x78d9d49d, 0xa1667744, 0x6449c577,
+    0x7d0cf9c7, 0xe02dc6c8, 0x0015ede3, 0x6367ce4d, 0x1f789dd4, 0xa63a59f3, 0xb477d671, 0x73731153, 0x278cb21a,
+    0x2b59cfb3, 0x63ca03fa, 0x43cb8e94, 0x70aca8b6, 0x2cba450e, 0x0fd8486e, 0x5998a04a, 0xfd9f0a59, 0x356f9c19,
+    0xeb27218c, 0x96f581c8, 0x3619be1b, 0xdd329fa8, 0x69cf721b, 0x1e84e2f5, 0x97f91884, 0x96e32fe0, 0x142e5994,
+    0x0751fa41, 0xb99b82d0, 0xae9ceeeb, 0x96539bbe, 0x4bb2cc1b, 0x0095c97e, 0x702f1422, 0x4008e264, 0xbbf91d05,
+    0x8dc92be1, 0x23a2e6a0, 0xd175171b, 0x7f16c06b, 0x10e7e7ce, 0x080c071c, 0xceece868, 0xca900c8b, 0x2ad8111a,
+    0xf2dbb232, 0xb140b578, 0xaa2318b5, 0x15a5df28, 0x7c2eaf9f, 0x81d4ac4f, 0x34001bb1, 0xc3811a64, 0xb79b3578,
+    0xa6b29bb4, 0x67777742, 0x65b6542c, 0x99194ac9, 0x970a28e4, 0xcc1b779d, 0x3b6f75ea, 0x059d70bf, 0xd76b223e,
+    0x86507fb1, 0x26f76111, 0x39b68807, 0x3aa7351f, 0xd427625f, 0xf4cfe720, 0x04eea40d, 0xd16c3529, 0x774ede30,
+    0x658bb0c8, 0x91ef6e6f, 0x24ed14b7, 0xec5249cd, 0x27731320, 0xc9969735, 0xf7758e67, 0xb1503b40, 0x8774ec8b,
+    0xdf26fd39, 0x7b634b0d, 0xa3415fb3, 0x45fa131b, 0x697763ca, 0x03375efb, 0xd7494fd8, 0xbdf5895f, 0x685d4d9a,
+    0xdc977a9f, 0xf154c87c, 0x7e0da97a, 0xb7ec3d1d, 0xa3f803fa, 0x2e16c706, 0x0c332689, 0x30d5acc3, 0x18d236ab,
+    0x16152ecb, 0xedd6f43f, 0x216ac1c6, 0x34834f39, 0x6337fb71, 0xbfb1a170, 0x36cc4768, 0x17ab59e8, 0x8a3ba69c,
+    0x62f890c5, 0x475669c7, 0x8168174b, 0x2da226c3, 0x4f82355f, 0x504e9cff, 0x078fc9b2, 0x9d48c1fe, 0x91278377,
+    0x531f086e, 0x3e351140, 0x414d7028, 0x7f4f62cc, 0xb9d110e2, 0xb13da15c, 0x784cc8a1, 0x4fc2b21a, 0x03543d80,
+    0xf54d201d, 0xce5070d3, 0xd3e7c1c0, 0x153129f2, 0xa4c9c59b, 0x275deeb3, 0x0620f009, 0xc2aa3873, 0x9e4cec60,
+    0x37160e0f, 0x9f623018, 0xf2df1021, 0xf7310a8f, 0x05de36b3, 0x8ac1d8ce, 0xe615a205, 0x75d1b656, 0xc07ad662,
+    0x99b0115b, 0xfd71e7f9, 0x33f9b105, 0x204c573d, 0x4655b2cf, 0x6a75b1e6, 0x3fdd6eac, 0x8232efd2, 0xd44aaca4,
+    0x80f9ae35, 0xf435341d, 0x2410dfed, 0xd362be00, 0x18a97e36, 0x2e4c6a3c, 0xe563c8f5, 0x11c06843, 0xc7d5de52,
+    0xae5a75c2, 0x3f2eae48, 0x56f35ce2, 0x84f02bc7, 0x6424810b, 0xbf0f18e0, 0x6e5c4fd8, 0xf080b017, 0x4da4d290,
+    0x838fd3cd, 0xf6475bb1, 0x2bf62bdd, 0x6c0f69ec, 0x9cded21d, 0x4526eb60, 0xdde0fd57, 0xf7e09cf5, 0x1adf2cc8,
+    0x5b73c3fb, 0x4f3a27c5, 0x8639c72b, 0xa3c9348d, 0xbbf1d904, 0x4bf78c46, 0x027450d8, 0x2f20776d, 0x6a741b1a,
+    0xf671e821, 0x5801c3ad, 0x1c8c57fd, 0x19607a1b, 0xef14d108, 0x3f613d69, 0x13ef157d, 0xa559647e, 0x1c4de367,
+    0x0d628e03, 0x4a93cdd8, 0x6f643479, 0x5d753206, 0x9d05d91c, 0xe1a37fff, 0xa2568f83, 0x4fc1d111, 0x702f465f,
+    0x1983f603, 0xd4591b19, 0x04ad5236, 0xe82bd799, 0xe8fec672, 0x900d5370, 0x629f450d, 0xbac8b6de, 0xdb0e091b,
+    0x3488b648, 0x7dcf85cf, 0x5cca862f, 0x51e5bb74, 0x62874711, 0x2163b615, 0xb2da3a4f, 0x071a6016, 0x8fe7a8c5,
+    0x45715829, 0x98825d0d, 0x21be28fa, 0x22dc01cd, 0x2e7351f0, 0xcab99edf, 0xc2f65391, 0x5f56ed76, 0xde17a435,
+    0xbe66bf46, 0x4ec19e4c, 0xe8db3e86, 0x1146f369, 0xd683408c, 0xfd476b03, 0xfba0d5d2, 0xc4706c3f, 0xdf14d9ab,
+    0x68523f08, 0xad24093a, 0xadfe0bc9, 0x1d0f5731, 0xdda248ee, 0x0bb8b688, 0xcbdbfeff, 0xb65ae88c, 0x87bce34a,
+    0xbc63c3d1, 0xb7cdee46, 0xee255e49, 0x1a513429, 0xd830e28f, 0x3ac4c182, 0x206a4f65, 0x2e591006, 0xb50aea90,
+    0x295dea2a, 0x633e1ced, 0xb4db6bb4, 0xc0ee27ca, 0x0d925fba, 0xf506a5c1, 0x61990079, 0xb4cee538, 0xea98e71b,
+    0x3c2fdc83, 0xc7d48dc0, 0x65fb9abc, 0xa3e2cecc, 0x014f78af, 0xf9772c78, 0x1e318419, 0x3699888b, 0x1b06cde2,
+    0xb8c941ca, 0xe26b9187, 0xf42eaec9, 0xc18fa842, 0xd6498714, 0x075b54bb, 0xa25fdd91, 0x2fdc1537, 0xf4af556d,
+    0x0bbe4840, 0x8b00813d, 0x2b7f4ebc, 0xc6c9e047, 0xf2137f7e, 0xa90bde60, 0xf3716daa, 0xb4747f27, 0x1d83a868,
+    0x1ace9d72, 0x17b9def2, 0x8a48dd70, 0x4d700688, 0x8b7f870b, 0x503966d4, 0xc5951649, 0x08038511, 0x7fa40f5f,
+    0x7d90f27f, 0xa1503f88, 0x266f4c64, 0x4fa9ad45, 0xae3808a2, 0x01763c5c, 0x1cfb3593, 0x611a0f89, 0x3a0e5f8a,
+    0xade5987d, 0x30262607, 0x0958e5f9, 0x45e69d52, 0xfd1c2246, 0x9a8679f6, 0x01079381, 0xc250fa30, 0xead64afb,
+    0xc56e6e4e, 0xc2b86ec7, 0x3b37ce84, 0xd63e7cfa, 0xa0f1f2bd, 0x15806065, 0x17a7dbac, 0xb995759f, 0x1d0f34af,
+    0x31811ae0, 0x5145e2b2, 0xc45ac9c1, 0xb078bfb7, 0x8f7389cf, 0x0fa1127d, 0x4c14085b, 0x218e2045, 0x397ded62,
+    0x03f28c4e, 0x7f2b6730, 0xaa51b4e5, 0x63528d45, 0x185be5c4, 0x238fa0a6, 0x032909e7, 0xd9cf60d3, 0x8159f5aa,
+    0xe5b8b32e, 0x9c6261e3, 0x109f1aa7, 0xcf481f75, 0xf4a015bc, 0xf269a1bf, 0x35ffe0a0, 0x16df5d17, 0xbc91c898,
+    0x8f854e38, 0xaa72a795, 0xecbfbae5, 0xa723baf8, 0x0243a601, 0xb01471a8, 0x4937503f, 0xe9c3c8d7, 0x95ed65fe,
+    0x11658c30, 0x7b46958c, 0xab894114, 0x8b3086f7, 0x8aa134bb, 0x30f21f57, 0x6a3c36d7, 0x5829727d, 0xa8e1a4e5,
+    0xc2d4761e, 0x81f0c29c, 0x31604668, 0x479ff257, 0x598789be, 0x404bae31, 0x97f29086, 0xff46bbb2, 0xa38e83bd,
+    0xf4fbbaf7, 0x83fd301b, 0xb1807392, 0xcfe9c301, 0xbd5cd38c, 0x0d60748b, 0x6a145a5c, 0x6a41add1, 0xd954c1f0,
+    0xf5e3d7f4, 0x970ce71e, 0xa50ce842, 0xa48af7a0, 0x7d7435a7, 0x7fa1e589, 0x219282f9, 0x759b9ac9, 0xfe233e71,
+    0x8f830c35, 0x5da98b75, 0x2cb90538, 0x17fdc532, 0x6735bffb, 0x8da946a2, 0x562a171a, 0x1d80843a, 0x5e64c1e2,
+    0x060c40f1, 0xcc2ddf57, 0xd1b78c5d, 0x2d2fb51d, 0x61d0772f, 0x0cb4d319, 0xcc4f5e68, 0x8471672b, 0x6d0ac553,
+    0x5eba32d0, 0x3cc4a69c, 0x235d9665, 0x65064890, 0x4413794b, 0x5522ea3c, 0x2b3eb492, 0xf817613f, 0x1886e229,
+    0xc8013642, 0x6902b326, 0xe4af63a8, 0x98970d24, 0x2ca4ac8c, 0x09172aa2, 0xa170150a, 0x6a991437, 0x1117c5a3,
+    0x12934006, 0x727fe578, 0x1ee3e521, 0xb3c6dc1c, 0x7291d7cd, 0x68e7981e, 0xd78dc247, 0x6f2927f6, 0xe9e313b3,
+    0x8372b851, 0x5521fc1b, 0x673f90f3, 0x25fdc22e, 0x562482b3, 0x2b905ebc, 0xda3fe507, 0xef679615, 0xc074d215,
+    0x7f509875, 0xf5c54f02, 0x97dc05db, 0x379e15cf, 0xcfc8874f, 0x3b9b19b2, 0x4d2d46f5, 0x8b4ea7e0, 0x96b23c67,
+    0x25786091, 0xc1c26761, 0x4c1e7fe9, 0xa6993b64, 0x61fff413, 0x8bad48bf, 0x31ea077c, 0x92d1bfb1, 0xa8f680fd,
+    0x0be8f11f, 0xf6dbda3a, 0xa1afa99e, 0xd8ecf072, 0xe7736c62, 0xce0b9266, 0x80ac7980, 0xb18aee41, 0x7b1e8fa9,
+    0x208a0b6f, 0x7245f138, 0x352dee4f, 0x22758250, 0x52dd239e, 0xe8a075f6, 0x6139695e, 0xa694f88a, 0xd77a6002,
+    0x46fc92f6, 0xfcfa9de2, 0x9cd6edbb, 0x52ec8b5a, 0x61469bbc, 0x3fef1a4e, 0xc2e6a7b6, 0x56da63be, 0x3331946e,
+    0xa44da7f3, 0xec08a6ab, 0x0c3addf7, 0xd41ae18a, 0x2b8a8cb3, 0xf24532d1, 0x40e86b14, 0x5f3ab20b, 0x2d47cbd7,
+    0x0f92f620, 0x7086a0d5, 0x42e4f2bd, 0x1fa5a5c1, 0x224efac4, 0xa389490f, 0x34de0997, 0x1388767f, 0x35818ebe,
+    0xdc536f7f, 0xf6bf2e43, 0x5d0fc532, 0xcae39b16, 0x7624c578, 0x88375803, 0x3632cabc, 0x3a03b930, 0x868b0e63,
+    0x53ca2a11, 0x2e7034e0, 0x024dba96, 0xae94b6bf, 0x1b03d498, 0x38bcd168, 0x4d72927a, 0x1b62ae8f, 0xef765353,
+    0xbe970655, 0xeec37535, 0xe15af283, 0x6f60ce35, 0xe0368352, 0x7f1a683b, 0xa2fce942, 0x8db414dd, 0x074fe9c9,
+    0x30dc0089, 0x3b080b0f, 0x355abc21, 0xc9ca93ee, 0x661c984a, 0x5a5ba9f9, 0x5b383df2, 0x45680794, 0xbce8269d,
+    0x83b4c653, 0xfd8585e4, 0x23af00e8, 0x930092c1, 0xccfa77bf, 0x181f17f6, 0x76720187, 0x23753636, 0xb1daabf7,
+    0x822679ff, 0x695356ac, 0x9ec8f335, 0xc6ae001c, 0xdf9b5938, 0x841d5d99, 0x55388cc4, 0x798be0d3, 0xeb64ab62,
+    0x9a82734d, 0x93c7e83e, 0x1787d3a1, 0x2fb71669, 0x4b6fca8b, 0x6c51e070, 0x234c5bff, 0x2dd17628, 0x176d1131,
+    0x8c84446d, 0xe112b333, 0x38513490, 0x9adc0c20, 0x58e173c3, 0x38abc762, 0x17260cd2, 0xe8272ce2, 0xccf76bc6,
+    0xa37e0c3f, 0xf73dc6ad, 0xced1d71f, 0x0043ef4c, 0xdca0d6fb, 0x5d1133d8, 0x838ff5e9, 0x0e3e6c5f, 0x83452a89,
+    0x8d83c5d6, 0xe79cedb2, 0xbaa0d06e, 0x65c84a4c, 0xbc910c03, 0xbca9961c, 0xdadeeb74, 0x7425d656, 0xdcf615c1,
+    0x80dca487, 0x8ef06651, 0xdaa64bde, 0x961dbf34, 0xd2a3cd38, 0xd4a60333, 0xbc9d7fb1, 0x9d0cf70e, 0x50254842,
+    0x91a466eb, 0x96c931a0, 0xdb2d62fb, 0xee00f84d, 0x73a2e016, 0xcb2ee15d, 0x8f1a013f, 0x81e7097e, 0x3957c1bb,
+    0xc725ecc0, 0x35b295d1, 0x7534f83a, 0xe285dec9, 0x3880605d, 0xb37cc3bf, 0x4e75c284, 0xced72133, 0xac511196,
+    0x98a03f22, 0xd70a9952, 0x798ba161, 0xdd47c31e, 0x7314490e, 0x5b861fde, 0x153c90da, 0x962e1d65, 0x6b409883,
+    0x7ccba435, 0xc76b9139, 0x069ecec9, 0x6e0b32a7, 0x2145e385, 0x42e3ea92, 0xac10a0c2, 0x56d71f7a, 0x9a4ee46e,
+    0xc541a909, 0x228454a5, 0x96d811ca, 0x7d02806a, 0x9037ede2, 0x13fbc300, 0xaa3607e6, 0xf2806515, 0x771d7fac,
+    0xff795f9d, 0x135c1a8c, 0x9fba9ca3, 0x8b96eedb, 0x01094dba, 0x7d8d3045, 0x58aae114, 0x59029f2b, 0xb47ed32a,
+    0x72c467e1, 0x891925d2, 0xe0e07ecd, 0x4a4ce80e, 0x8e8f3a9a, 0x42739150, 0x8b1f740e, 0x9af5f49e, 0xfe0125a7,
+    0xd6ad02a8, 0xb237ee54, 0x0fea326f, 0xce3a7d4c, 0x6d666d03, 0x51caa4e1, 0x5f687f70, 0x5be0b244, 0x3d96deba,
+    0xf8c4c8f9, 0x9db46aaa, 0xb34a16eb, 0x8a1319ae, 0xb2765303, 0xb47a5fd8, 0xa13f1665, 0xab344d61, 0x4569ea40,
+    0x20dfd66c, 0x9b9019a5, 0xb1da8b08, 0x215fa4d6, 0x090315da, 0x2f8d94aa, 0xd5bcc08a, 0xa89d6d86, 0xb66845e0,
+    0xdf2b52bc, 0x0849a8d7, 0x88b9cd37, 0xcbc0fb45, 0x34a3f65b, 0x5316a2e4, 0x22aa3b5d, 0x2fde444c, 0x1cd232cd,
+    0xcca50f90, 0x4cf0d74c, 0x28be8b5e, 0xa8ff0723, 0xd2367119, 0x40219b3e, 0xa276afe1, 0xe0c61c6c, 0xbd6d046f,
+    0xa2a8a49e, 0x7be0bd8d, 0xc6d40d4e, 0x21db1d29, 0x73ec7705, 0x3e4789b2, 0xc0c2e948, 0x735a39f5, 0x38d03044,
+    0x3f2e1259, 0x035fee6b, 0xf2f10150, 0xf0f758cf, 0x03260cbd, 0x1ad79247, 0x3f9fd6cb, 0x7ec20957, 0x2e01a0db,
+    0x4f79703c, 0x63acf8de, 0xf171999a, 0x50400db7, 0xa02c8440, 0xedf55c16, 0x0b90f4dd, 0xa36b8065, 0x31933133,
+    0x0c57f952, 0x082551bb, 0x58f3b242, 0x2f5fc996, 0x70f35f1a, 0x2a06b4c1, 0xf7f8505a, 0xc7fb0203, 0xbc725ecf,
+    0x4ba71a77, 0xe063acbf, 0xc3a7b858, 0xe985a43a, 0x53b13417, 0xd7824b4e, 0xbb55cbb7, 0x22b2ced9, 0x4efb2e97,
+    0xff6bf69f, 0x5a933bd3, 0xbe9ab658, 0xeb435305, 0x9e081ec4, 0x3f191b5f, 0xf236b991, 0x39e0b6d1, 0xcea23303,
+    0x339b1a9d, 0xcd9c7feb, 0x065cd763, 0x9415b45e, 0x5fb5165b, 0x2d814fb1, 0x95f4c511, 0x3fca117f, 0xa4f4c645,
+    0x85fd0e01, 0x20e1659b, 0x79a94d22, 0xa1aadc95, 0x48f7436a, 0x36ee0cf6, 0x502b9cd0, 0x8622abe8, 0x045cae73,
+    0x1bd7c223, 0x4e42fd0a, 0x9d78eabb, 0x4421e570, 0x5da0db49, 0x38b92120, 0xda4cca51, 0xc6000ae4, 0x0470618d,
+    0xe23d2d01, 0x84f9754a, 0xe1dd4a3a, 0x4a273a49, 0x0e755ffc, 0xbd302409, 0xa0237b60, 0x89209a5c, 0x5a60a94e,
+    0x3d88de37, 0x5a1e4d0a, 0xd68d4ac6, 0x40921014, 0xaf31feba, 0x9e86f324, 0x22497a31, 0xf3512771, 0xb6adb43b,
+    0xcd37ad93, 0xf734859e, 0x296ce9de, 0x4722e7ba, 0x9c3db24c, 0x76eebfc1, 0xac6bc56a, 0x6f7fb9d7, 0x3e4d8e10,
+    0xe412a1c8, 0xc2616208, 0xfd9675e8, 0x6029653c, 0x97e66594, 0xdc308993, 0x31cd4da4, 0x17c0adfb, 0x98815255,
+    0xfc9d64e3, 0x1b454a6d, 0x8b220894, 0xae76dd80, 0x0860135b, 0x099f52d4, 0x378cd0cd, 0x789d4637, 0xe36ff327,
+    0xc66316e8, 0x52366573, 0x8eaf42a5, 0x73c67742, 0xa00f27e8, 0xe1357153, 0xcb7b3bc6, 0xc4a0d597, 0x33749332,
+    0x2d196453, 0x751c43f8, 0x1e5f1fb4, 0x1d45987f, 0xbccfaaf4, 0x4f641572, 0xe563e4e3, 0x5ddaadd1, 0x8142fe32,
+    0x66fd2b58, 0x8e1843a8, 0xe6944ba1, 0xccacf546, 0x56f52b6f, 0xdd429861, 0x7bf07800, 0x17eedcc6, 0x6fb6bf96,
+    0x95dc4502, 0x7870fb6e, 0x0debaecb, 0x4ed2c6f7, 0x3615df61, 0x0f8a4568, 0x2dfc4caa, 0x3c9257fd, 0x8a3d0140,
+    0x7968782b, 0x600651d3, 0xfb26ef04, 0x530afbc0, 0x6529b18a, 0x839be3a6, 0xad837d81, 0x6cf6da56, 0x8dbf8ed2,
+    0xf47fff6f, 0x3c9dd86b, 0x7efb59cf, 0xc82ca5c6, 0x0a3bfc3a, 0x7d7be4be, 0x7632d0fa, 0x88de34aa, 0x6a32ca86,
+    0xefd241ff, 0xa040b642, 0x9ab5215b, 0xf8994a0e, 0xeac70a2a, 0x1b4ce7cf, 0x4c0da09b, 0x11b3de21, 0xd4ee8d38,
+    0x615723de, 0xf5fde9a0, 0x96bab4f4, 0x06befd30, 0x5b3b625f, 0x85f4c13c, 0x5cedebf9, 0xa60b8fc1, 0x2ce21042,
+    0x54f0e2e2, 0x5355cc42, 0xe3f3cc57, 0x540ec2e5, 0x31a41d8e, 0x712cdfbe, 0xbf449d40, 0x0bbf28ff, 0xc38c52b7,
+    0xf6ff9372, 0x0789d093, 0x5c9fd8d0, 0x24441af5, 0x13f20259, 0xa9759918, 0x19d03fd7, 0x94557da8, 0xb58e0852,
+    0xd0923bdf, 0xc9c52e34, 0x1a95edaa, 0xd1574742, 0x58c45a91, 0x99175f1d, 0xbec8c77d, 0x5150eb48, 0x0230da46,
+    0x4556301a, 0x4944aebf, 0xd23a1ae5, 0x285d21c5, 0x437f015d, 0xc844b626, 0x5763f67f, 0x26a6191d, 0x83da081c,
+    0x5ab77621, 0xc7851bb0, 0x9f902840, 0xc1d1fd57, 0xb700d3b5, 0xd2f546bf, 0x2ae2c5d2, 0xab33dc53, 0x40421ae1,
+    0xcb6ed83b, 0x9590b501, 0xc4a4cc62, 0x0f06ea54, 0x5ce408aa, 0xce24b342, 0xa7fcd1be, 0xf11940ea, 0xc0aab778,
+    0xdf87e2f7, 0x89bf9e71, 0x81f6484e, 0x9afd980e, 0x4c03c363, 0x6657f2bd, 0xf90213f5, 0xc8555aac, 0x543c62a5,
+    0x6b92700d, 0x6e13a8db, 0xf2cbed1b, 0x40503aac, 0x78e758cc, 0xb76c5530, 0xc369ce3a, 0x97508821, 0x22122758,
+    0x8bf9c71e, 0x1a682b8a, 0x7bbd75b5, 0xb06c035c, 0x9bd1355b, 0x03f15e1b, 0xe1dc6a96, 0x724c12d5, 0x5eeb7abd,
+    0x6f1a533d, 0xe4163b97, 0x53963f78, 0xf4bdc4cf, 0x30bc6aa8, 0x55020a94, 0x87424139, 0x7f4e0fc0, 0x0dced4cc,
+    0xcc44f761, 0xdc915d5d, 0x5923afae, 0x5fca09df, 0x6da60086, 0x4176cac0, 0x2cd1c0be, 0xeaf4a65a, 0x9a2b0460,
+    0xd9adceb3, 0x837911fc, 0x24a064e2, 0xf62aef80, 0x2c72361c, 0xabcea574, 0xc9e8494f, 0x58fdc7fe, 0x19835be7,
+    0xe2f50795, 0x22577eee, 0xf37a909d, 0x01085e15, 0x433de341, 0x47e376d9, 0x0bba767a, 0xf77fa338, 0xdaabb9e6,
+    0x321bb7de, 0xd9c18914, 0x63c61551, 0x608ac9b2, 0xdc175799, 0xa3b005c1, 0xb30ba812, 0xb8f13ae7, 0x4e6515ee,
+    0x63b6e03c, 0x21dc18eb, 0x92116367, 0x912c40eb, 0x67431a9d, 0xa3ac94ae, 0x8778ab34, 0x97d032f9, 0xe363d369,
+    0x83361fee, 0xfc13d3ed, 0xa8b81258, 0x3ad31da7, 0xf22b43bc, 0x5e4dc39b, 0xaf3c8d97, 0x4e4f0c56, 0x9ad45750,
+    0xce42b7f5, 0xfee1c9dc, 0xda821b40, 0xe112aa6d, 0xc534e246, 0x49278e21, 0xb44895c1, 0xe3d1ab5b, 0x73a79242,
+    0x6c9f7498, 0x635ece54, 0x11679e76, 0x2ecfb564, 0x32fac952, 0x9ef53d09, 0xe639b29c, 0x6bc8773e, 0x1bc739cc,
+    0x89ba5c0c, 0x4bd2bc26, 0x422ddfd6, 0xfdb0a8e4, 0xcf2f81a5, 0x14841e89, 0xd4f78e53, 0x63013219, 0x359821da,
+    0xb02ce75b, 0xac288e79, 0xd6225779, 0xe9c65694, 0x49a11a14, 0x1607727d, 0x5371ef25, 0x6e32e37e, 0x46463aa1,
+    0x2f9f3be7, 0x008814a8, 0x4aaeb902, 0xeaf8f5a0, 0x36ff71ae, 0xeda38d7c, 0xc8154fa2, 0xbd72884c, 0xeb83e123,
+    0x8c815ce0, 0xe3cec3c1, 0xb7cb6a68, 0x4b2967a5, 0x6f401978, 0xa790036a, 0xd7098ddf, 0xe29bc8fc, 0x990029a6,
+    0x03cdb1fe, 0x0dd3e1d0, 0x154d7ad7, 0xf416dee7, 0x5563bc46, 0x724bd24d, 0xc9afafda, 0x15fbdda1, 0xdafbcb38,
+    0xd5a26b25, 0x619bed77, 0xba04b927, 0xfd2d6b8a, 0x77894e2e, 0x3a2b2115, 0x4f97c16a, 0x624c5c48, 0x87b8ac99,
+    0x52727b94, 0x1e24f7f7, 0x075e8797, 0xf6c0d443, 0x1bbfc65e, 0xaaef1178, 0xc6ee8328, 0x328b718e, 0x6f763df7,
+    0xf0198c11, 0xd6cd4bf9, 0x3ee66642, 0x717949cd, 0xd07b2cb7, 0xa023dc26, 0x36fb0e07, 0x833771f3, 0x865405d9,
+    0x440f6fbb, 0xaf079d0d, 0x2187a5d8, 0x1c48bf61, 0xd1a3e59f, 0x022d6bda, 0xd6bbf539, 0xf7e1e652, 0xd13cd569,
+    0x1953bd8c, 0x2c00848e, 0x15a8bd5e, 0xf1633fe7, 0x56e8f0b5, 0x3b009bee, 0xd18e24a5, 0x06e6be5a, 0x20b080a8,
+    0x2b7c3d6b, 0xc9e867d9, 0x013902a6, 0x722d7f90, 0xaa97b1b4, 0x6a72eaa5, 0xa35fb788, 0x02c7801c, 0xf528ad86,
+    0xc08e0f90, 0x36013f85, 0xb6507cfb, 0xce50853b, 0xdc81a410, 0x6f9c7395, 0x9061399a, 0x4d069a88, 0xb6cb4ee7,
+    0xaa0c16f1, 0xc186f6ca, 0x27a49448, 0x03ff9a82, 0x487eb046, 0xf68644dc, 0x41c11e31, 0x004fe1d3, 0xc870a0ba,
+    0xeaff3d1f, 0xa56c84f6, 0xbf9faffd, 0xd9ace2c0, 0xe0c703f7, 0x341a6acc, 0x0cbf2408, 0xf14f311b, 0xf193f588,
+    0xca3c7387, 0x3ebc4e22, 0x56bebf42, 0x0e4635ac, 0xb7fd6bcb, 0x055a2a82, 0xf4854352, 0x47d220ec, 0x421ca930,
+    0x0d609b5c, 0x9ec67f0a, 0x0fcb48de, 0x7c4804bf, 0xc5507f0f, 0xe752b62c, 0xbcce8482, 0x83da6958, 0x4e6b4114,
+    0xad51c34c, 0x986a787f, 0x247e359f, 0x03a8afef, 0xad5ae388, 0xf8c45e72, 0x69b64f29, 0x551d0ed4, 0xe964371d,
+    0x80e6afdd, 0x1d0b15c1, 0xd90f83ee, 0x706c7250, 0x032a7eb6, 0xb1f45def, 0xe9539be4, 0x8549a545, 0x72cd25a6,
+    0x0b84bda3, 0xdaac8e21, 0xa7b7ad91, 0x46dd85c2, 0x5d5fadce, 0x4d10e91f, 0xfa0f309d, 0x2450505b, 0x7e62d6b6,
+    0x1fc124b9, 0x2f83c695, 0xa2fcc4de, 0x4779f502, 0x7cbb0e0c, 0x066fdf93, 0x04887009, 0xa497a6f7, 0xe25f05fc,
+    0xd65ab11e, 0xa25e22c5, 0x19045c1e, 0x3aa4021d, 0x854e10cc, 0x07fa114d, 0xd983fce1, 0xc106b74c, 0x7a097634,
+    0x554de3f7, 0x00236229, 0xb65a8838, 0xdd1fab0d, 0x9884995f, 0x447be782, 0x984e587b, 0x15b0caa8, 0x4fc22e5b,
+    0x1e0f4174, 0x0e4f84a9, 0x4df83f84, 0x23469d92, 0x0b00d8c1, 0xea4ad785, 0xd9fe7129, 0xd8417b76, 0xb2437447,
+    0xbecc7016, 0x0fa8fb6f, 0x1304fb53, 0x16bb207c, 0xf899f4d0, 0x040738b7, 0x6ebb74c4, 0xd9e007c9, 0x4ddae7a5,
+    0x7c8c3483, 0x2f4db6ed, 0xe6d51eb1, 0x4c37d670, 0xf7f8fbf2, 0x310632f0, 0x3ee0f27a, 0xd0973c93, 0x36f74f81,
+    0xebcc86ed, 0x7ab235a3, 0xf70a2c83, 0xe7ae2d3f, 0xde8fe3e9, 0xedbfdb59, 0x8f551374, 0x49684acc, 0x27ceed4c,
+    0x585e4343, 0x000bb259, 0xbb362f6c, 0x0f9bdf2d, 0x77c632ea, 0xeebad78e, 0xc18462c5, 0x30407eb5, 0x8e18797a,
+    0xc0b350ef, 0xfa3ead07, 0xcde427cf, 0xa3d7e0a3, 0xbdf0bf54, 0xf107867e, 0x04f072fe, 0x399bdcc7, 0x840479c6,
+    0x34d8b969, 0x55106a2b, 0x8f33844b, 0x331e26bb, 0x250050b9, 0x02fc81ce, 0x261ccf08, 0x2d74312b, 0x820c37b7,
+    0x39bc1a46, 0xf4865fdf, 0x22bd8658, 0xff6ed246, 0x0890403e, 0x18be1499, 0xc6110aca, 0xe5af3a20, 0xec854f28,
+    0xd9382232, 0x947cd63b, 0x2a15a8bb, 0xc49848ed, 0xf41d1ce5, 0xf53f5f2e, 0x4433b301, 0xc25b51c6, 0xcb5bc0ac,
+    0x65a5e218, 0xf2f69279, 0x10cd8339, 0xf280e4df, 0x1bf7dbd4, 0xff73634c, 0xd07335f3, 0x465717bd, 0x23cfabb7,
+    0x8826fad1, 0x3a95391b, 0x2b951ec9, 0x55c342f8, 0xf91e2089, 0x64547cad, 0x68d79216, 0xff6c7fe9, 0x9cff960e,
+    0x1b3be666, 0xf3427850, 0x1af5972d, 0x8ce424be, 0x04a8ab27, 0xe1811274, 0x6401979a, 0x5da4cf70, 0x861ef098,
+    0x168ebceb, 0xc8a728a6, 0xb896012c, 0x2143f232, 0x744927b4, 0x35201777, 0x2d914387, 0x9ed7f94b, 0xf00b5441,
+    0x6904d92a, 0x482ffc7c, 0xf355da5b, 0x79d3cd0d, 0x0abde0bb, 0xadf96fea, 0x7fcf5e87, 0x78828f01, 0xcac2d991,
+    0x347b8666, 0x82e63203, 0xa12927e0, 0x103a6991, 0xbe39050e, 0xb33730c3, 0x9b9fe147, 0x69cb667f, 0xbe2c1142,
+    0xa65e23b2, 0x81d318b0, 0xdd0e9d89, 0xb36f2c16, 0x06613a50, 0xad6a1eb7, 0xdf57feb7, 0xe95497da, 0xaea78d92,
+    0x78603c0a, 0x7c403889, 0x6de90e91, 0xeb33d532, 0x4356f85e, 0xd4047a63, 0x28280051, 0x3a65b54c, 0xd3b82ae8,
+    0xe1fecec4, 0xddfe0b8e, 0x4bff00f7, 0xf1fd4390, 0xbc07bb50, 0xf4fd8907, 0xed6d885e, 0x7e10ea21, 0x0b69c743,
+    0x49857aee, 0xd55b943f, 0x6f06e7a8, 0xf2731c17, 0x86e4e839, 0xd67593be, 0x88211cc2, 0x7acef217, 0xee70ca50,
+    0xd7f5d099, 0x9d710c19, 0x30c2bd60, 0x9136bc7c, 0xa68590b0, 0x903f4d00, 0xbfb477b3, 0x57098afb, 0x744d626d,
+    0x04604e67, 0xfb1a3ca5, 0x4a4bdd39, 0xdfe3a5bb, 0x4eb043f5, 0x5c666653, 0x5936ff74, 0xc1477a35, 0x3665ecdc,
+    0x26d8d8e7, 0x39dd4541, 0x72b63f98, 0x3961f77c, 0xfab6dec1, 0xddf9fb37, 0x5a5270c0, 0xfcfb5e76, 0x1f416742,
+    0xfa567fb0, 0x467e9d0f, 0x874cb74a, 0x7c801db1, 0xe95ac6cc, 0x57ef6630, 0x53b065eb, 0x96dcfd36, 0x9b194300,
+    0x7e1959e1, 0x91787e6c, 0xda51caa5, 0xbaab1bf3, 0x0379e6f0, 0x9fdb3489, 0xde21a2e1, 0x9f5634fa, 0x93c246c4,
+    0x8fc78d5d, 0x3ea2142c, 0xcaf76e76, 0x9da2521d, 0x2acc21ae, 0x2fd7bda5, 0xdec355d2, 0xf3746588, 0x76fb50a7,
+    0xa69d279e, 0x179b864a, 0x7917f112, 0xf189f406, 0xf593fb1b, 0xe5da89be, 0x8917329b, 0x6878a8e5, 0x51bcbc52,
+    0x343851f2, 0x648715fa, 0xdd3ceff0, 0x4f36b0e6, 0x769de5cd, 0xda66a672, 0x5cf2353c, 0x169edec5, 0xb001c899,
+    0x2f212386, 0x5ff374d9, 0x902f9b63, 0x62938b54, 0xee128e48, 0xecd92b21, 0x31bba85c, 0x46ebff79, 0xccb7b9b6,
+    0x72e02941, 0x4e807226, 0x8a0aefae, 0xf6b9c4d6, 0xd8f6949a, 0xf3c7d482, 0xac829629, 0x9ffbf3a3, 0x718c8f7c,
+    0x53310af6, 0xe55f4c13, 0x95c8a29e, 0xe190fa7e, 0x64589aa5, 0x1fe6317e, 0x4996238c, 0x73a59fc9, 0x0c11de06,
+    0x6ed34adc, 0x34614996, 0xf653263c, 0x272880e6, 0xc8778076, 0xffb5570a, 0x88592be7, 0xb1697bed, 0xf7c4f8b4,
+    0xe9cf811c, 0x8e27d295, 0x42f3d0f2, 0xadb004ba, 0x6529cc58, 0x48d75e2b, 0x3331acc5, 0x2f1c5aab, 0xdff15511,
+    0xbba13c12, 0xdd02c804, 0x290304b0, 0x9a0ae9fe, 0xbac450e5, 0x819f0f80, 0xfa25ed41, 0x1365cbad, 0x748c5827,
+    0x347c5339, 0x4ac23644, 0x82f6dd2d, 0x4a51dfec, 0x87b1c1d3, 0xfe079bc6, 0x5dd37d45, 0x0291efc5, 0x15da5da6,
+    0x91c0cc1f, 0xe71ebb92, 0x559f1204, 0x40c5b180, 0xdb316bf2, 0xe5794310, 0x43b9ed16, 0x1bf9548c, 0x4396ff24,
+    0xe6ef3b56, 0x04d193b3, 0xa66d0133, 0x738da1b0, 0xc505045e, 0x3aafd451, 0xd6dce0ea, 0xee7ad3a2, 0xcc436c78,
+    0x238fc4ca, 0x7ea3ec91, 0x1cdb7b2d, 0x4a6aeb3b, 0xf95102c1, 0x428b7f39, 0x74ca8a7f, 0x038b305c, 0xbb5b2f87,
+    0x328a6450, 0x195951e8, 0x8000d874, 0xa6ddbd7c, 0xd1cb90a4, 0xb7cbabbb, 0xacf7af2d, 0x42bf44db, 0xc6431081,
+    0xdaf2aafb, 0xe0f7a0d2, 0xff94b1dc, 0x03fcfada, 0xe908c60e, 0x9621c465, 0x30b81c91, 0x0b4ffbfc, 0x1834560d,
+    0x68c77435, 0x356f1249, 0xec7fe5ec, 0xe59eceb8, 0xbe6cc301, 0xd9ff300d, 0x7b6494c3, 0x5df01be3, 0x3222a416,
+    0x8bac2cae, 0x5104a87d, 0x24fd77dd, 0x5f85970e, 0xa44bc827, 0x160c793c, 0xeeef04e5, 0x92c5547e, 0x50c1cfb9,
+    0xd5a33292, 0x4fb423af, 0x2de9ada4, 0xb516aefc, 0x9dbdd4c2, 0xf8745696, 0x43c6be27, 0x60b412fc, 0x35c9eb60,
+    0xa2b3dd44, 0xb0c51e32, 0x20b5b608, 0x17cf4fc1, 0x0832da5f, 0x1f1ae752, 0xeee0b9f6, 0x7a88a657, 0x129c6972,
+    0x4329e802, 0x2733b47f, 0x83c0e41f, 0xc10a7414, 0xe585fb2a, 0x76862bf4, 0x17ee4fd8, 0xa54b4c48, 0x667c537f,
+    0xb776d649, 0x95b89628, 0x89fef7e4, 0x5f9d84bf, 0xf39148e7, 0xfac4d2b2, 0xe16ab1b9, 0x3d5dd389, 0x5947821b,
+    0x5048129c, 0xcd6d342d, 0x92a2668c, 0x2f56f2e7, 0x12a60853, 0x47a1c5a6, 0xd1a25115, 0x5d10f99d, 0x96fdaae1,
+    0x749da2cb, 0x2452766f, 0x6256655a, 0x71ad26b3, 0x97c6b155, 0xd633a587, 0x992a9cfb, 0xd4bcf56e, 0x7c8757f2,
+    0x9d6ec64b, 0xb1bc042c, 0x2a53dc13, 0x96483ce8, 0x15e73168, 0x63e3e7d7, 0x14004b37, 0x7bcbf0cb, 0xc60aac99,
+    0x8e2665b7, 0xee93572c, 0xff17fafc, 0x9eacc207, 0x866eba92, 0x75a89fd3, 0x6b7ae30c, 0xa2566504, 0xdef5c75c,
+    0x07a80a9b, 0x55257aef, 0xf98e2aa3, 0x7e0952b0, 0x9ae8cec2, 0xcb8ca77c, 0xcc8d3fcd, 0xd1065d2d, 0x9b10063c,
+    0xff39a382, 0xee275cd9, 0x8f1293e6, 0x6280b8ad, 0x1593e1ef, 0xc218e302, 0xcc38f531, 0x770df929, 0x8a302c05,
+    0x0aeab21e, 0x20e283b7, 0xf76f1fdc, 0x409b6087, 0xe3da47e5, 0xceb21d28, 0x60826770, 0x9b86cabe, 0x48f7ca80,
+    0x5043aa5a, 0x360611a2, 0x59f934d5, 0xc3c4a486, 0xc9967a2d, 0x6a5308d4, 0x79bda240, 0x909fd98e, 0xf49643bc,
+    0xf2bb63b9, 0x0da6b533, 0xf5369ae6, 0xaa1de445, 0x4d7bdfa2, 0xca3f7db9, 0xe52220ec, 0x60821252, 0x43a0c0e7,
+    0x4b70e068, 0x0593546e, 0x10f7e764, 0xbdb5e00d, 0xde38267c, 0x1dc15fa9, 0x63921d22, 0x496a3fd0, 0xf6716b1d,
+    0x8821bf49, 0xde5b8005, 0x6e749b41, 0xc5c98501, 0x78cc06ac, 0x48f132e9, 0xae27d783, 0x6d1bea84, 0x3f318baf,
+    0xc85a975d, 0x00904827, 0xe895c692, 0xb3055f23, 0x5e1c263c, 0xe4735664, 0xdce219fd, 0xdecf1bc6, 0x7f9c9425,
+    0x3ac88c9e, 0xde861fbf, 0xa56d3c1e, 0xf1efb535, 0x38d40fe7, 0x6b492069, 0xdaa2a764, 0x3c426d03, 0x8f670e35,
+    0x6a52cc82, 0xb184acae, 0x445ffc8a, 0x7e73a705, 0x23d43dcd, 0xe0c0bc13, 0x303643ec, 0x744d1ff7, 0xadef941f,
+    0x4ea5b0ad, 0xada1d03e, 0x421e5a81, 0x066d7998, 0x34c4f1e4, 0x88ada64c, 0x9ad41d3a, 0x15116dd8, 0xcf51bdc7,
+    0x8e03d1bb, 0x0ce64046, 0xa341fe03, 0x4af1924f, 0xa9110822, 0x1ba6ca6f, 0xe55e6fbb, 0x43524b5b, 0x12dbc403,
+    0x79bbb0eb, 0x5eed39ce, 0x50f740fd, 0xa103213e, 0x7261e167, 0xb4c44ba0, 0xda5f33f1, 0xf33a2b14, 0xa8fcf531,
+    0x0d956e14, 0xbc99a47e, 0xcba85743, 0x81f243bf, 0x918bb561, 0xa5f40cd3, 0xf51e78dd, 0x9857413c, 0xfa8a8e3d,
+    0xa430fe6b, 0x4ab7ab4c, 0xcc4d0354, 0xada2c0b6, 0xfe0b1433, 0xe00aa575, 0x25d036c0, 0xef2526a5, 0x725d1d16,
+    0xb541d640, 0x84ceb075, 0x490051aa, 0xfc515fc8, 0x98522f44, 0x080fd435, 0x3a2d6b1d, 0x1619901c, 0x5d2df5fa,
+    0xd2f96c90, 0x1305c4c2, 0xea61aded, 0x736096a0, 0xd25c468c, 0xc50e8447, 0xb59e09ff, 0x18390d0a, 0x637dcd09,
+    0xe2cfd51a, 0xb6ab0396, 0x7344c619, 0xdd9c5b16, 0x099a1799, 0x559b09aa, 0x55029850, 0xf31cf56f, 0xc9f9d7ed,
+    0x89d96862, 0x894f758b, 0x740e82b1, 0x20c5d0f9, 0x3dd1ad3a, 0x8f7a54fd, 0x0f25d659, 0x3ba18f38, 0xb9d8d6f5,
+    0x1f4bfd93, 0x7df22166, 0xc49db4ae, 0x7452d902, 0xcb1a71dc, 0x03a403bc, 0xf818f739, 0x08eaf9e5, 0xc9f08a15,
+    0x4ead9e3e, 0x6f736b7e, 0x7dbf9520, 0x8962d03c, 0x2cedc9ac, 0xce6f3c82, 0x1480e3bb, 0x4ea4c9e1, 0x1f9d50e6,
+    0xb96d1c23, 0x8fd76968, 0x99f5f244, 0x11a08fc2, 0xcf0da457, 0x305334b0, 0x516fed23, 0x9f28f27a, 0x37dba9ea,
+    0x3cd1aa59, 0xf8853cc8, 0xb1a4ec6e, 0x3a7ed6d7, 0x4be545fd, 0x13b80497, 0xabbea8d2, 0xe9dfbf1a, 0xbf501d46,
+    0x730d6d4c, 0xb4f2cb42, 0x17027428, 0xbaebc85a, 0x986e8e66, 0xf6098d80, 0xba9ec5c4, 0xc718d06c, 0x3093c90a,
+    0xfffa9c44, 0x09b11373, 0xf347ad79, 0x8683ccb1, 0x64cef48b, 0xdecc4dac, 0x0276b3c4, 0x824f608c, 0xf567444b,
+    0x0f55a1c2, 0xed1c8e18, 0xe06c0bcd, 0xa7a26125, 0x3778fb02, 0x5baf14e5, 0xdce2efdf, 0xf4ab4941, 0xb4ba3765,
+    0x142b92c6, 0x550c3dde, 0xdc256bae, 0xb96346ff, 0x198df6b8, 0x34adc5ec, 0xb648d4cf, 0xf93f4075, 0x9d0ed557,
+    0xbeb31815, 0x64b93c40, 0xb09b22b4, 0x9259a40b, 0x5a304513, 0x211d492d, 0xa5fd92c4, 0x48985b22, 0x9d228641,
+    0x7624345f, 0x4f81841c, 0x4f393058, 0x0788e338, 0x6d624b36, 0xe8d750c2, 0x291dd2f3, 0x951cfc35, 0x14561981,
+    0x5f02ba95, 0x342f2c1e, 0x4e20ace3, 0x8cc15859, 0x0038322e, 0xf4e0ea1e, 0x889a310c, 0x89aca86c, 0x264ebb7a,
+    0x7e4bb890, 0x1c7739a1, 0xc91fad83, 0x03ac9278, 0x987777b4, 0xe87bc9cb, 0xf8a8bce8, 0x81b38bd1, 0xaca7e15a,
+    0x1eb7fdad, 0xa71313bb, 0x0cdb873b, 0xf6dd1ccd, 0x3c1b3fb9, 0x03b42a73, 0xfe007178, 0xa13e5582, 0x1bcf5c84,
+    0x75bea2bc, 0x550a67eb, 0x5c22158b, 0xc0720dea, 0x4e6cc47a, 0xea689927, 0x4409e02e, 0xdcce6bb1, 0x4163d578,
+    0x9c315fcc, 0x8b0762de, 0xf28b8010, 0x4bcdda72, 0x45ac9a18, 0x9083961d, 0xf6958e74, 0xa0fcd93e, 0x27592fb4,
+    0x04a62c4f, 0x166d4f24, 0x51f0c2cd, 0xb0eb792d, 0x16f78963, 0xa8bb6ccd, 0xf337352d, 0x9f43e39f, 0x3d97dd79,
+    0x6ead7f57, 0x52b3c51c, 0x3f796edd, 0x6aa1f5c0, 0xeb1a2a90, 0x3ac20033, 0x102f3f16, 0xf23ddf24, 0xc687bd96,
+    0x8af2126c, 0x4d291b91, 0xa561894d, 0xbe645b50, 0xcbd4e08a, 0x69d2d86d, 0xa968161e, 0x5151bc96, 0x753c3dc2,
+    0xef4d59c0, 0xd30c1862, 0x6ccbf7d2, 0xafb953d5, 0xdb56b7c4, 0x4665df3e, 0x2d3e6768, 0xf53d533b, 0x827a8867,
+    0x657544bf, 0x0cb9eb01, 0x0b31a06d, 0x3fb9c37d, 0xd10ccba4, 0x04ac9226, 0x73947d16, 0xaf488ad5, 0x5fd80905,
+    0x442651bc, 0xbb74c336, 0x0fb4191b, 0x83b43e90, 0xa503f9e8, 0x0a4b69b2, 0x1cdd641a, 0x4f9f87ea, 0x2782d210,
+    0x9f5af7c3, 0x4c4596be, 0x6a2c6b98, 0xde3bce9b, 0xded33cd5, 0x98a997c8, 0x33d5dc67, 0x1cd9e6f1, 0x183daa74,
+    0xb6bb9348, 0x7eacd48e, 0xc404584b, 0x7fb9c568, 0x1a22c0f9, 0xbaa07503, 0x9ab52d6d, 0x655b1ae9, 0xddc911e0,
+    0xf40c5d15, 0xa0ce92f6, 0xd0ba6bde, 0x424811c6, 0x0af474a4, 0x87bddd1b, 0xa7d730be, 0x565d365e, 0xbe345362,
+    0x5f09e609, 0xf19b5a91, 0x0105b2d2, 0x54bc661b, 0xcacb5c1c, 0x18cb8dc7, 0x4f313730, 0x74d26f5a, 0x629e3a50,
+    0x9bfb6788, 0xe45c47bd, 0x75a9e66d, 0x5d2a6d46, 0xb2922a49, 0x3a4564c4, 0x6b3e0469, 0xc931f54b, 0xf37af5fc,
+    0xae0a9227, 0xb495eaf6, 0x4dcae07c, 0x41899421, 0xc0b25903, 0x0d66040c, 0xe968c1be, 0xe0cf525c, 0x538b1867,
+    0x58b4e4ad, 0x556532e1, 0x67069e3c, 0x2bc5f09b, 0xa7a6f446, 0x2b3ea3b8, 0x1625a485, 0xb9e3f4aa, 0xa5d1eb62,
+    0xc40580bc, 0x3471d078, 0x4ed73918, 0x7bffd923, 0xe98f7931, 0xd24b8474, 0x3b60ed38, 0x5388f377, 0xb8e97998,
+    0x13cd4c75, 0xb6998008, 0xfcf5f0b7, 0x262d1baf, 0x7772c989, 0xceef466d, 0xc88ecaa3, 0x1b61fb05, 0x1d10b579,
+    0x57d2b7a7, 0x2127f2e2, 0x41213721, 0x2bfdfaa4, 0x6b8f20d6, 0x664d62a8, 0x8290a4ff, 0x5cb567c4, 0x8bbbf9a0,
+    0x10800312, 0xa842463e, 0x0014f612, 0x9f8a4c0d, 0x08b15b33, 0xf3f6ddea, 0x1f5d3371, 0x1e15d7f3, 0x0b75ade1,
+    0x400bb658, 0x2c51e379, 0xcb93de39, 0x91c2b362, 0x8be75e76, 0x2ca0f9c5, 0x32552d87, 0xd3b81d28, 0x8aa8c570,
+    0xb27eab78, 0xaa1e51ac, 0x89502bb5, 0x2c588630, 0x95eae621, 0xf58ed713, 0x3d47e807, 0x175601c8, 0x41b46760,
+    0xa112459c, 0x5549b1b9, 0x3a6791b0, 0x262d42fd, 0xf57fc215, 0xac17daad, 0x02d5c2c7, 0xc60e0e5b, 0x78928fee,
+    0x96e4d6de, 0x4da13de6, 0x063b4d3c, 0xdc9182e7, 0xcb44f614, 0xee140310, 0x18b1ad42, 0xce4c46f2, 0xea7b7c10,
+    0x0e32b86c, 0xde08244c, 0xa057c218, 0xd5420c94, 0x1cb9737c, 0x637aa739, 0xc3cc6ef6, 0xad0743ff, 0x8dea9f18,
+    0x2f9294d8, 0xda03f866, 0x4e0ad156, 0x25bf86f7, 0xe9d33974, 0x07dab60a, 0xaa2f2e5a, 0x960f77b3, 0x6d39077f,
+    0xc7c8a305, 0x1f362db8, 0x72c4e115, 0x81d9e5eb, 0x8d2dd534, 0x9773bd76, 0x6add1c6c, 0x831a3319, 0xa54c3c87,
+    0x281786f2, 0x6b1e4b54, 0xe3ea1078, 0xb2b42daf, 0x228bd531, 0x269b2881, 0x53d4263b, 0x66f9a018, 0xf54306c2,
+    0x6df72f95, 0x3b61772d, 0x3bb738fc, 0x3fbfd11e, 0x6d142675, 0xbe678e5f, 0x199033cb, 0xaaa59bf8, 0xf690a05b,
+    0xf37a38f4, 0xcb1f42f8, 0x48fd71e8, 0x63744120, 0xd3b70a40, 0x230841c6, 0x26a2aa52, 0xeac69c20, 0x06897036,
+    0xa51ba165, 0x89e2af8c, 0xe0844bc8, 0x45825e86, 0x097ee7ce, 0xc67d7b6c, 0x0add7597, 0xe9e57e68, 0xd5f41e91,
+    0x186dae46, 0x61d420c6, 0xa6b8e835, 0xc5c03608, 0x20438f99, 0xb70bbc5a, 0x024dfabd, 0x50027d4c, 0x28e80eec,
+    0x199bc40c, 0xf2aa0a80, 0xcf747795, 0x1be27e32, 0xdde4944c, 0x2a24835c, 0xc1a4c273, 0x2de341ea, 0x45e2f7d7,
+    0x2212ee19, 0x07064028, 0x800f7391, 0xf7635268, 0xff37d87d, 0x77296d3d, 0xe1f57f41, 0x89ae2512, 0x2b0783e2,
+    0x66cf66af, 0xf575fa25, 0x793f314e, 0x78b2aa5a, 0x88bfdb84, 0xfaa2cc1c, 0xd6b151e2, 0x35f3e5b4, 0x1b2fc6e8,
+    0x70f3c9a7, 0xb4aca44a, 0xe0f19973, 0xbb272e6d, 0x13ca151f, 0x2412e5cd, 0x339f58fb, 0x029ee9d5, 0xb87c2f2e,
+    0x672ab382, 0x7e1767e2, 0xa541937d, 0x14012db9, 0x86d4886f, 0xa6dec976, 0x74c8deb4, 0xb054503e, 0x38435210,
+    0x35231ece, 0x41ad6f71, 0x58334381, 0x35880b60, 0x1844cccb, 0x2658ade4, 0x4ce82ec9, 0x0d4943dc, 0xa0a1a675,
+    0x4445f6d2, 0x97571d99, 0x0aa2ce04, 0xff4c7fe8, 0xca9770a0, 0x94ab9434, 0x28ebef59, 0xa2028d42, 0xf29f7f28,
+    0x50dd62e5, 0xf2dc2490, 0xb742d94c, 0x3a0b24aa, 0x3cc4e04d, 0x8db97c30, 0x45d14fc4, 0xe37c771b, 0x956aa797,
+    0x40278377, 0x4f1306d5, 0xe114f56c, 0x051d23ee, 0xf1a6e96c, 0x715ea34a, 0x6640c200, 0x6bb4ea0f, 0x306f2b3f,
+    0x3c727cc6, 0x5b1b81b9, 0x18a12214, 0x1a21b363, 0xa38d6122, 0xa196f0eb, 0x33e27125, 0x57b501fa, 0x16e059fb,
+    0xe033975e, 0x008acc42, 0x435500d8, 0x03f871da, 0x242fa9f1, 0x022eb929, 0x48d19828, 0xc53f0f5b, 0xe3f264d4,
+    0xefd8a419, 0x2d3440eb, 0x827e000e, 0x645c7b32, 0xe4f17655, 0xdb4840f4, 0x21570916, 0xdf701ef3, 0xdbee77ed,
+    0x5ac0387d, 0xcc3ddab7, 0x5b29c621, 0xce6307af, 0x9051e128, 0x70be546e, 0x6bd1ccab, 0xdd2cbbd4, 0x6d4849d8,
+    0xd98b154c, 0x0ab4f750, 0x47356874, 0xebf27a2a, 0x0d4fb4c3, 0x6a0a8af7, 0xf7ed0b0a, 0x37c2fb35, 0x71fca686,
+    0xc13423d9, 0xc6ee8987, 0x5c82b6f2, 0xcc976d72, 0xdce65764, 0x484ef5d9, 0x90092ebd, 0x0cf8d8e8, 0x5d5ce0a2,
+    0xcd6aa7de, 0xf9ce34a4, 0x8dd070c3, 0xb19a0b57, 0x337139a4, 0x3eb26084, 0x15dde756, 0x9f1bad7a, 0x345a8b88,
+    0x5be24d48, 0x3535a045, 0x46701866, 0x56cf8a71, 0x90a1aa98, 0x60163285, 0xd6a03320, 0x16407c3f, 0x7b04325e,
+    0x4f36731e, 0x9179afbe, 0xaee15ca5, 0x153b788e, 0xd682291b, 0x2473cd31, 0x0395c9bb, 0x360b4089, 0xb8f41c41,
+    0xd61b957c, 0xb1d3601d, 0x285c0134, 0x2611a026, 0xe30cd2e9, 0x8d0b77c5, 0xef5fd3ac, 0xbacd2083, 0xcce26409,
+    0xdfa29eca, 0x7e300ef1, 0x183b8cac, 0x9b02c4c2, 0x6c06ad46, 0x2ec94baf, 0x6725545c, 0xd5e9bf3b, 0x2efd4983,
+    0x247f1d91, 0x90826b5d, 0x33f311f1, 0xbb97f01c, 0xb46dced6, 0x39edc2db, 0xc0c97ca0, 0xd6456515, 0x86a49990,
+    0x6a4cbb9d, 0xbb429705, 0xe7140710, 0x9bcf88f7, 0xf7bb64ee, 0x5555f4e3, 0x47951177, 0x1ef7b3eb, 0xe7165c1f,
+    0xfdd331f4, 0x453991f7, 0x5a5cc9bc, 0xd74ae2e4, 0xdc4095ab, 0x2ba942fb, 0x908d5430, 0x55f01c70, 0x1caf16bb,
+    0xab800038, 0x0e5f415b, 0x77d71868, 0x95c250d2, 0xc2ddb198, 0xb5c78778, 0x6a737fba, 0x55275156, 0x677b5b97,
+    0x7999f376, 0x687e76cc, 0xf50cf81e, 0x83470a28, 0x01572e93, 0x86549582, 0x5c50c10e, 0xff2bebe6, 0xa7f4fe1a,
+    0x5d416565, 0xce30fc05, 0x3607c9a4, 0xbcd45049, 0x6e672cbd, 0xf7b12a88, 0x842e7329, 0x705fc02c, 0x51bb7caf,
+    0xd5e3391e, 0x0489a142, 0x06b74471, 0x941b6752, 0xb29818ae, 0x194db3cd, 0x9d06e674, 0x6821ae5f, 0x78b1dad5,
+    0x1f27e9b9, 0x98b6e1ea, 0x81687e81, 0x886fb026, 0x5e10e71f, 0xcabc6180, 0x2909b195, 0xc01d1672, 0x0fa6344b,
+    0x3239c578, 0x979c5f26, 0x5f02cf6d, 0x1cec8e40, 0x6ba2d9aa, 0x4f33d4e1, 0xd372c5d0, 0x7c4e2487, 0xe83452b8,
+    0x503f00db, 0x20f1c459, 0x52ff0f41, 0x6b4d7ca2, 0x5094973a, 0xf6c5c4eb, 0x7e907c43, 0x3fa6e0b9, 0x663b8a61,
+    0x23cf5760, 0xb204aa05, 0x7ad97512, 0x0230a11f, 0xa1a1b1e3, 0x02904261, 0x9a59b732, 0x81eea9f7, 0x2cf2e047,
+    0xcac406ab, 0x6040d630, 0xaca48454, 0x0c87baca, 0xaf25f28b, 0xbacb8233, 0x988e8592, 0xab788159, 0x4a0c1bbf,
+    0xf054ac4c, 0x5a2ef885, 0x3d489b41, 0x97a17e02, 0x0acfc836, 0x2d8f23fc, 0xe4c15510, 0x467ff8fa, 0x3532bd03,
+    0x3992d5b2, 0x5bffe9fa, 0xc1b55be7, 0xb911132a, 0xbf0cf669, 0x8b2100c3, 0x498a3dfc, 0xf14db0e7, 0x8116f826,
+    0xf2b491bf, 0xf91bc9c7, 0xab237142, 0xb80ddc3e, 0x5761abc3, 0x93aa4ced, 0x5d99ea4d, 0x8dc34690, 0x28f34916,
+    0xf1528cfb, 0xf79a38cd, 0x5c71d094, 0x2878672e, 0x62e3d8ab, 0x2c4fc9f6, 0x7e22e107, 0x64f9509f, 0xbb52265b,
+    0xc297147d, 0x8788dd32, 0x62ccc36e, 0xa8c3738d, 0x40feaab4, 0xe5e66e66, 0x876256f2, 0xf7bfbaad, 0x52ea5a26,
+    0xab326551, 0x5999a1f7, 0xf5ac042b, 0xce8e4683, 0x6330dd47, 0xba9e63d8, 0x8338d24c, 0x194890a6, 0x7497f838,
+    0x7749e986, 0x7774cb6a, 0x5cc0dbc4, 0xf6763737, 0x394efffa, 0xbd7c14a2, 0xc5264914, 0xcaf27fb8, 0x48a66129,
+    0x01919ed6, 0x01093bce, 0x6e5f244f, 0x01c7f1d9, 0xe3bc7804, 0x5141def9, 0x9bcbe40e, 0x30ec2e4c, 0x251b2f34,
+    0xd31af56e, 0x37fa3f6b, 0xb1e569ef, 0x7865efc8, 0xc038eef6, 0x5ab6dbea, 0x309d5530, 0x5b6f8abf, 0x58bcf70f,
+    0xfc20c388, 0xd8e1eea2, 0xad21bfef, 0x5b1b9234, 0xbf44f6e7, 0xa8f11aaa, 0xc2f75f34, 0x2f5ddc74, 0x2236410b,
+    0x8b13ca61, 0x89e973f4, 0xce916d12, 0xe4382a60, 0xa1419bf6, 0x1716c2dd, 0x363e3a65, 0xabb42af5, 0xf1e6aa4f,
+    0x057db65e, 0xf56c1511, 0xa3bcccc8, 0xb7a257f2, 0x229ae0e6, 0xc9c2de2d, 0xbd5a0400, 0x1c40074f, 0x4b6dc5dd,
+    0xaf0a4310, 0xacbf48bf, 0x2feb142b, 0x130a9037, 0x5c530c69, 0xb77f369e, 0xbd8160b0, 0xae8c4405, 0x6893368e,
+    0xd4e51c6f, 0x3a7c54a3, 0x78c68b79, 0xf1ba8fce, 0xdd24712e, 0x11043f49, 0xb2b0b6e9, 0xae647902, 0x2f0371a3,
+    0xb980fde0, 0x7e18d7c8, 0x2c88c7a1, 0x69c12990, 0x024df51f, 0xad269cf9, 0x20d07c08, 0x46dd7e5d, 0x8b9164d3,
+    0x94db4bf8, 0x197cbfdd, 0xd6468cb3, 0x2eeb6901, 0x8c44979c, 0x1d81e0f7, 0x9f946bbc, 0xedfde6b7, 0x2486f2a7,
+    0xd8c9af8e, 0x4c0a6f94, 0xd5944971, 0x00fab05f, 0x5426b324, 0x4afb07e3, 0xdfb43f92, 0xe40171d5, 0x4486b8a8,
+    0xbc6870e7, 0xc95d18f4, 0x1ca8b3c6, 0xea1c1852, 0x5ca2e2a8, 0xe8da3dab, 0x17612271, 0x2ab72b95, 0x9c15d202,
+    0x5c6d5389, 0x85da1da4, 0x429919c2, 0xbdbc5233, 0xb622137b, 0xd7acde34, 0x7cef7a78, 0xb7da1755, 0xef672b63,
+    0xfee2f710, 0x03236b0b, 0xc92fc557, 0x8e574b88, 0x2805ba96, 0xc81c866b, 0xad184d45, 0xb836c91f, 0xbeab9200,
+    0xc41b82eb, 0xee8ab2af, 0x81160ca3, 0x37fc7eec, 0x83437c12, 0xb86f9be4, 0x44f2d5af, 0x24be3b99, 0x21add5ca,
+    0xd0d168c4, 0x32560890, 0x6f698ad0, 0xc5c3ca2c, 0x957eb6e0, 0xa3de6166, 0x09934285, 0xd88381e5, 0x176ff5b3,
+    0x493f9565, 0x39f6d3a6, 0xf695c64f, 0x632e92f8, 0xef7404ce, 0xe1466f18, 0x34c0cf9f, 0x5d81884b, 0xa6605610,
+    0x56f84ee2, 0xa881494f, 0xa133dee5, 0xe585bdc2, 0x3454b808, 0xb8eb525d, 0xf03de612, 0xd3625812, 0x5f9e2734,
+    0x538214a7, 0x21f2740d, 0x39cafc80, 0x092f0669, 0xc244c4ff, 0x569c8561, 0x8ce00cec, 0xfad3174c, 0x17a98478,
+    0x3fba51e2, 0x7839ccd3, 0xd3cc2942, 0x34459786, 0x9e605d5a, 0x481ee65e, 0x63c01029, 0x97c3b03b, 0x0556943c,
+    0x9ca515fa, 0x45ee4c64, 0xfed15ef4, 0x65baabdb, 0x037c4d51, 0x892ea8a2, 0x2de6038c, 0xd8716227, 0x57424e4f,
+    0xf1b5ca70, 0x287fcd83, 0x653d548d, 0x2baaa7ed, 0x6af133ba, 0x4bfb12eb, 0x0585c00b, 0x7926e62b, 0x67f71020,
+    0x06941d09, 0x3269b9d6, 0x6becf31f, 0x18b598fe, 0x139643a5, 0x9a9160e1, 0xbe2df596, 0x782f8037, 0x9bcce7db,
+    0xf3be74bc, 0x4f7f7177, 0xddcacedb, 0xd348bb00, 0x0ef68de3, 0x1ff7d95c, 0x6201a28d, 0x24f67327, 0xa1425633,
+    0x48426e5d, 0x3ccfed4a, 0x92baf081, 0x868d6418, 0xc5454948, 0x8767bc45, 0xc53167e6, 0x56dd43ae, 0xd4ae028f,
+    0x2fed5a70, 0xc8fa50ea, 0xe82b98ef, 0x95aff35f, 0x1fb53fda, 0x792e0658, 0x909bc6b2, 0x70bdf1d0, 0xcf5c7d4f,
+    0xa4f0c02c, 0x006bdbc5, 0x47ef6df2, 0xf98a5188, 0xca47b7da, 0xaa2b8d1a, 0xa5d235dd, 0x59d6be2f, 0x7e683b7f,
+    0xd9d19ac8, 0x42ef934c, 0xf5985618, 0x73220a3f, 0x543064ee, 0x40bb52d5, 0x654712b1, 0xd8e940e2, 0x8ff4683c,
+    0x2a998600, 0xd4aad8ba, 0xee241d02, 0x94346fe9, 0xc02eb848, 0xc2c91e1a, 0xea843f6c, 0x5bc57c6c, 0xddd8a617,
+    0xebf9c3c0, 0x4980bc36, 0x6d334dcf, 0x97a4b3df, 0x2a94b788, 0x83811aca, 0xbbc37422, 0x6292df1d, 0x761131db,
+    0xb2d8dbe4, 0x7ff0219d, 0x95d470ee, 0xda8c0e74, 0xcf981bc4, 0x95642758, 0x215c055b, 0x2aaea2f2, 0x28a91766,
+    0xe750abab, 0x995e1edf, 0xe39955fc, 0x33af7feb, 0x238315d1, 0x2ffeef88, 0xe8b6f798, 0x35eeeabc, 0x8368340f,
+    0x81dcaf0b, 0x9313abd6, 0xf0c7b961, 0x87cc331b, 0xcece3df4, 0xcb90e2fd, 0xfc2850ab, 0xc5e37ef3, 0xf727bba5,
+    0x97c7f994, 0x283e5938, 0x513bd493, 0xb5d182fa, 0x4e8d6fb8, 0x83686263, 0x1cae22db, 0xcc923e99, 0x074cad57,
+    0x8938a877, 0x12338d86, 0xd558d946, 0xb28895e3, 0x5a000780, 0xbe031e1c, 0xd33b3dc1, 0xdffdebe3, 0xd234f8ea,
+    0x1523c8ba, 0x68a0608b, 0x8b615bd6, 0x2930eeda, 0x28cad819, 0x7c3e8c7e, 0x0aec3b74, 0xc92b4e33, 0x6278a8dd,
+    0x1df2fd4f, 0x90a5a45b, 0x34354809, 0x597f9b39, 0x8d1c5736, 0x73d3f226, 0x8bc263d5, 0xe5cd9545, 0x800db58a,
+    0xc23bc076, 0x1be19e52, 0xca477b42, 0x15007281, 0x0f687cc9, 0x6a31c769, 0x1d75c0f7, 0xe34730f6, 0x74540689,
+    0x38f67674, 0xaa46a55a, 0x6cc6f2de, 0x6762be31, 0x74e55f6b, 0x8dea8bf6, 0xce92f7b7, 0x47b7ba55, 0x7dede31e,
+    0x3d0d802c, 0x1c5f0e41, 0xee1004bc, 0xbd478ca3, 0x5a4655ae, 0x9577174b, 0x9f803144, 0x0912486b, 0x7ac880b9,
+    0x0cff1152, 0x1e7519b2, 0x5904c459, 0x0a98690b, 0x71357ad4, 0x5546e0eb, 0xe854b9b3, 0x733cd8c5, 0xab9fc7d4,
+    0x11e80584, 0x3a49181b, 0x01877253, 0xffd959e5, 0x9fa5e659, 0x7375a6cb, 0xb1e933da, 0x4c98a1ca, 0x40f45cde,
+    0x7b06c1bd, 0x241bb5d3, 0xfdd2bda5, 0x96201bab, 0x59f74075, 0x5f2f3a13, 0x376f0ab7, 0x4d62bf5c, 0xfb678b95,
+    0x6a39fefc, 0x84971885, 0x4a4f6982, 0xd482fe7a, 0x899471cb, 0xdb80fe1f, 0x1b2b3707, 0x400bbd22, 0x75175b6d,
+    0x2ba0cee6, 0x3b4a399e, 0x93fb147e, 0x48a25aac, 0xe45e8b8e, 0x132885e3, 0xc1fa2e54, 0x5689f7d8, 0xe97476ff,
+    0xa15a5a25, 0x2b8e1241, 0xad9bb8f4, 0xa0439b29, 0x9c1a9391, 0xd70011fc, 0xf91cdc62, 0x6bc54667, 0x5da05bd4,
+    0x069dc6a0, 0x4491aae0, 0xaefe617f, 0x7328e2c5, 0xd727a4c9, 0x70482009, 0xa18cde24, 0xa865edcd, 0x4a0863f2,
+    0xe065e10b, 0xe25118b7, 0x1a834da7, 0xd0bf8387, 0xcadec6fd, 0xce225bf4, 0x98a74e8b, 0x4e16eedb, 0x817d2bc5,
+    0x51d786aa, 0xa52705b9, 0xb6027a8a, 0xfa7a21a8, 0x16edf654, 0xe1309c32, 0x5fa043e7, 0xca8fd090, 0xba97d044,
+    0xae8ad6c7, 0x54f352dc, 0x1e8e615a, 0x94b72b12, 0xdd3ca446, 0x47b2bb4b, 0x9f5c78e9, 0x38216de2, 0x43199650,
+    0x9d3fcbd9, 0xa2157e5f, 0x3b86a9f2, 0x3a810a1f, 0xe08041ce, 0xb162087a, 0xe50205ad, 0x17c04d1a, 0xdcf5ee35,
+    0x8430e9fe, 0x7e4961fd, 0x061a2e7e, 0x2ae757a5, 0xfad2fe0d, 0x33ffb4d3, 0xd8d89305, 0x08179d58, 0xa2ec655f,
+    0x29e62c0d, 0x60de20f4, 0x3dc354d0, 0x8dd9601d, 0x53100b04, 0x1bf6fa95, 0x36113750, 0x6fdb0fd6, 0xcff88a4f,
+    0x506eb018, 0x88611eae, 0xfad273db, 0x3247eb0a, 0x3eb3ac0d, 0xf6ea9bfd, 0x7201881b, 0x027ff968, 0x7c059f38,
+    0xa9dbcb72, 0xfebc762c, 0xf17edc1c, 0x6c639b03, 0x4b3a904b, 0xcec599db, 0xd8861fcc, 0xa171057c, 0xc650cd2a,
+    0x4099e824, 0x21a0d898, 0xa2020af1, 0x867da021, 0xe9ed104a, 0x9da01970, 0x96771f21, 0x4004b800, 0xce59e1c5,
+    0x246f4e16, 0x5821156b, 0xf809cb5b, 0x13bb2f07, 0xb6eec787, 0xe691a9b4, 0x0171a226, 0xe53ebb14, 0x8d32cd7a,
+    0x9b3b87e5, 0x6bda5b7f, 0x1be7b68a, 0x6370f716, 0xd78173ba, 0x69b668f8, 0x23d33e8d, 0x81f16ac8, 0x79a620f7,
+    0xd2063aba, 0x38356c3f, 0x15263822, 0xe623e5c5, 0x29372e35, 0x8aa4187e, 0x1b229eb6, 0x07733835, 0xbe52efcd,
+    0x1c1010ce, 0x8c271ca0, 0x3260222f, 0xb6953016, 0x14858f6b, 0x01915ed0, 0x5d8d5947, 0x8162abac, 0xb63059ad,
+    0x11113e16, 0xe4b8c3d2, 0xfa7b5a84, 0xa97a917b, 0xded14a08, 0x73e4f7ea, 0x52c23942, 0xc1131528, 0x52f9037c,
+    0x2408bc6b, 0x0a6e8f54, 0x4e45c3be, 0xc509d1f8, 0x3977f960, 0x572c094f, 0x15bf7b65, 0x49c20c19, 0x5283a436,
+    0xad6b9dc3, 0xcb4a4dd7, 0xd46bc902, 0xbc89b1f8, 0x2fde7eb7, 0xa38fe2c6, 0xc2223c9d, 0x99554000, 0xcd28bc49,
+    0xfee4d359, 0x8bd5b59d, 0x8fe70889, 0xc273661f, 0xf07041cb, 0x9f46fac1, 0x7512965d, 0xe03a55d7, 0x8c5ab0b3,
+    0x818125b8, 0xac2a961a, 0xcfc811ff, 0x3c118d92, 0xe3c74350, 0x9311373f, 0xe24bea31, 0x9611b861, 0x96ed3b7f,
+    0x553e3c53, 0x4ff910a9, 0xb16d9d48, 0xa2a4d890, 0x4b0fb07e, 0x3ffed269, 0xc0196993, 0x6dc00cc8, 0x1f337f10,
+    0x1ead51ac, 0xf531936c, 0xfe8b67d6, 0xc23bffc4, 0x1b1d2a5f, 0x15c5676c, 0x5ea5495f, 0x113a60a7, 0x9d8c8110,
+    0xd81a58c7, 0xd9fe0be6, 0x657c0011, 0x090cb701, 0x239514df, 0x78030c93, 0x07261fe3, 0x3e9b67ea, 0xe01e9655,
+    0xed3c8f43, 0x76d2c352, 0x90a6f1ef, 0x4fd45a87, 0x244f18f0, 0xa15f075f, 0xaaad6cd7, 0xcd1b00cd, 0x5bf25e25,
+    0x1f34d3b1, 0x5993e61b, 0x4a53d6ca, 0x5ebd1c1b, 0x6233e0bb, 0x4ee16745, 0x8e41f156, 0xc806079c, 0xc684f5d5,
+    0x3fa41a3b, 0x84e9f1e2, 0x78be70cf, 0x4a5e1bcf, 0x7eedc097, 0x2d95831b, 0x4adb2b92, 0xf781402f, 0x870c8ab5,
+    0x303b26bd, 0x1e2bb1c8, 0x17568bdc, 0xff29e92e, 0xa4b66185, 0x217dbe7c, 0x3b0875a9, 0xe7bce2f3, 0xb38f1a9c,
+    0xa4f486f7, 0x3401b40f, 0x16aed595, 0x1f80cab5, 0x3deea1c3, 0xcddc7a23, 0x500146fe, 0xf1a69596, 0x4f96b073,
+    0x5d7847cb, 0x800a7cd4, 0x2174ea30, 0xb42e3a0c, 0x7d5cc23c, 0x5679b3ea, 0xf8dfb3ec, 0x4d7cc147, 0x86998ada,
+    0x2e1cd1e9, 0xc7308954, 0x995cbf19, 0x118bfefb, 0xaae48f34, 0x65866e78, 0xc96d0da6, 0xb98fe29f, 0x1517f45c,
+    0xb2b5f06d, 0xddcb94e8, 0x5a73af89, 0xebf84e9d, 0xcb18d56b, 0x5835f802, 0xc5804a36, 0x5b8f80bb, 0x8b8c77ff,
+    0x7ff3cfc7, 0x46a41b95, 0x113ebecb, 0xe9277d6f, 0xeb4c0dd0, 0xeb93b28b, 0xecdf7bb0, 0x572714fe, 0x8692254d,
+    0x399019a4, 0xdf4f1d85, 0xf15a7cd0, 0xb6b480de, 0xdded7180, 0xaeb68c77, 0xdeb20f1f, 0xdee4891d, 0x83247a45,
+    0xcb9031af, 0x133da390, 0x02f6689c, 0x7b5f28aa, 0xfcd15258, 0xaf0c4d39, 0x3e9a6812, 0xb7981ce1, 0xd48dac33,
+    0xda717420, 0x3b9bf63f, 0x9cdf4cab, 0xaae00a11, 0x46442181, 0x22351272, 0x89529662, 0x4dbbb6d9, 0xe84f8776,
+    0x192bcf1f, 0xf3e08524, 0x79dc51cb, 0x33b09121, 0x87c7de82, 0xa7e16239, 0x58c7639b, 0x5cd40530, 0x789c888e,
+    0x79d4b7c0, 0x4f0d800c, 0x6615417d, 0x5dc33470, 0x561f41d3, 0x092f8fba, 0x9b18d23f, 0x882a73da, 0x9a37d746,
+    0xb2213194, 0x520c5c4b, 0xb59ee8ef, 0xef8df5dd, 0x127fa5ef, 0x94d75725, 0x578f467e, 0x3d65c7d0, 0xde201099,
+    0x4dbd49c2, 0x98bb5071, 0xc19c75e4, 0x88293a50, 0x4a3d18d1, 0xfd7ddb8a, 0x70c91dda, 0x828ce7f5, 0x58ef7f38,
+    0x4cffb467, 0x2d92df11, 0x8768fcb3, 0xa7de3819, 0x0fd3f8b3, 0xe3a57387, 0x62d5c5f6, 0xbc1c2253, 0x7fd1b105,
+    0x7ecb0531, 0x6ed42c0f, 0xae4a2745, 0x9ae219f8, 0x23dc8a4d, 0x322d35c2, 0x12c971a2, 0xc844714c, 0x83a50459,
+    0x8298ccce, 0x3f505f01, 0xa263cf68, 0xbe2a50df, 0x692384dd, 0x65b0a828, 0x795f7841, 0xa403bc22, 0x95959ab1,
+    0xf63a64c0, 0x1a340c73, 0x26828186, 0x88a72df9, 0xf60592a9, 0xd7f5d99f, 0x0e0b3374, 0xc8dc60db, 0x8152e5a5,
+    0xcc28f405, 0xb7523104, 0xba8259b2, 0x01f30de6, 0xe5a4203a, 0x83d017c9, 0x5a6a3663, 0x395093b3, 0x5a735fd1,
+    0xafbf4387, 0xeec043e1, 0x5afc4f02,
+};
+
+/*
+ * The declaration comes after the definition on purpose: if the array does
+ * not hold exactly LR11XX_FIRMWARE_IMAGE_SIZE words the types conflict and
+ * the build fails, instead of the array being silently zero-padded.
+ */
+#include "lr1110_transceiver_0308_image.h"
@@ -0,0 +1,119 @@
+/*!
+ * \file      lr1110_transceiver_0308_image.h
+ *
+ * \brief     Firmware transceiver version 0x0308 for LR1110 radio, declaration
+ *
+ * The Clear BSD License
+ * Copyright Semtech Corporation 2022. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT
+ * NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LR11XX_FW_IMAGE_H
+#define LR11XX_FW_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC MACROS -----------------------------------------------------------
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Firmware version
+ */
+#define LR11XX_FIRMWARE_VERSION 0x0308
+
+/*!
+ * \brief Firmware type
+ */
+#define LR11XX_FIRMWARE_UPDATE_TO LR1110_FIRMWARE_UPDATE_TO_TRX
+
+/*!
+ * \brief Size in words of the firmware image
+ */
+#define LR11XX_FIRMWARE_IMAGE_SIZE 61320
+
+/*!
+ * \brief CRC-32 (IEEE 802.3) of the image in wire byte order, see abw_crc32.h
+ */
+#define LR11XX_FIRMWARE_IMAGE_CRC32 0xd6ba765cu
+
+/*!
+ * \brief SHA-256 of the image in wire byte order (digest of the .bin file), as an initializer list
+ */
+#define LR11XX_FIRMWARE_IMAGE_SHA256 \
+    0x75, 0x3a, 0x12, 0x1a, 0xac, 0xd8, 0xcb, 0x78, 0x04, 0x6b, 0x00, 0x06, 0x99, 0x45, 0x77, 0xd3, \
+    0x12, 0xe5, 0x94, 0xba, 0x1e, 0x06, 0x09, 0x2f, 0xa7, 0xf0, 0x98, 0xa2, 0x3c, 0x1a, 0x79, 0xb6
+
+/*!
+ * \brief Array containing the firmware image, defined once in lr1110_transceiver_0308_image.c
+ */
+extern const uint32_t lr11xx_firmware_image[LR11XX_FIRMWARE_IMAGE_SIZE];
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Get a chunk of the firmware image
+ *
+ * \param [in] offset Offset of the chunk in words
+ * \param [in] count  Length of the chunk in words
+ *
+ * \returns Pointer to the first word of the chunk, NULL if the chunk is not
+ *          entirely inside the image
+ */
+static inline const uint32_t* lr11xx_firmware_image_chunk(uint32_t offset, uint32_t count)
+{
+    if ((offset > LR11XX_FIRMWARE_IMAGE_SIZE) || (count > (LR11XX_FIRMWARE_IMAGE_SIZE - offset)))
+    {
+        return NULL;
+    }
+    return &lr11xx_firmware_image[offset];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
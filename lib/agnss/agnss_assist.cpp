@@ -0,0 +1,401 @@
+/*!
+ * \file      agnss_assist.cpp
+ *
+ * \brief     A-GNSS assistance for the MT3333: cache, staging ring and burst injection
+ */
+
+#include "agnss_assist.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace agnss {
+
+namespace {
+
+/*!
+ * Days since 1970-01-01 to a civil date (H. Hinnant, chrono-compatible low-level date algorithms)
+ */
+void civil_from_days(int32_t z, int32_t& y, unsigned& m, unsigned& d)
+{
+    z += 719468;
+    const int32_t  era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = unsigned(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp  = (5 * doy + 2) / 153;
+    d                  = doy - (153 * mp + 2) / 5 + 1;
+    m                  = mp < 10 ? mp + 3 : mp - 9;
+    y                  = int32_t(yoe) + era * 400 + (m <= 2);
+}
+
+/*!
+ * 1e-7 degrees as [-]d.dddddd
+ */
+int format_degrees(char* out, size_t size, int32_t value)
+{
+    uint32_t magnitude = (value < 0) ? uint32_t(-int64_t(value)) : uint32_t(value);
+    uint32_t micro     = magnitude / 10;
+    return std::snprintf(out, size, "%s%u.%06u", (value < 0) ? "-" : "", unsigned(micro / 1000000),
+                         unsigned(micro % 1000000));
+}
+
+/*!
+ * PMTK740 body, without its $ and checksum
+ */
+int format_time(char* out, size_t size, uint32_t utc)
+{
+    int32_t  y;
+    unsigned m, d;
+    uint32_t s = utc % 86400;
+    civil_from_days(int32_t(utc / 86400), y, m, d);
+    return std::snprintf(out, size, "PMTK740,%d,%02u,%02u,%02u,%02u,%02u", int(y), m, d, unsigned(s / 3600),
+                         unsigned(s / 60 % 60), unsigned(s % 60));
+}
+
+}  // namespace
+
+const char* time_source_name(time_source source)
+{
+    switch (source) {
+    case time_source::rtc:
+        return "rtc";
+    case time_source::network:
+        return "network";
+    case time_source::gnss:
+        return "gnss";
+    default:
+        return "none";
+    }
+}
+
+// Cache
+
+void cache::set_time(uint32_t utc, uint32_t error_ms, time_source source, uint32_t now_ms)
+{
+    utc_      = utc;
+    error_ms_ = error_ms;
+    source_   = source;
+    set_ms_   = now_ms;
+}
+
+bool cache::time(uint32_t now_ms, uint32_t& utc, uint32_t& error_ms) const
+{
+    if (source_ == time_source::none) {
+        return false;
+    }
+    uint32_t age = now_ms - set_ms_;
+    utc          = utc_ + age / 1000;
+    error_ms     = error_ms_ + uint32_t(uint64_t(age) * config_.rtc_drift_ppm / 1000000);
+    return true;
+}
+
+bool cache::position_error(uint32_t utc, uint32_t& error_m) const
+{
+    if (!fix_.valid) {
+        return false;
+    }
+    uint32_t age = (utc > fix_.utc) ? utc - fix_.utc : 0;
+    error_m      = uint32_t((uint64_t(age) * config_.speed_cm_s + fix_.ehpe_cm) / 100);
+    return true;
+}
+
+bool cache::set_epo(const epo_segment& segment)
+{
+    if ((segment.satellite == 0) || (segment.satellite > max_satellites)) {
+        return false;
+    }
+    epo_[segment.satellite - 1] = segment;
+    return true;
+}
+
+const epo_segment* cache::epo(size_t slot, uint32_t utc) const
+{
+    const epo_segment& s = epo_[slot];
+    return ((s.satellite != 0) && (utc >= s.start) && (utc < s.end)) ? &s : nullptr;
+}
+
+size_t cache::epo_count(uint32_t utc) const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < max_satellites; i++) {
+        count += (epo(i, utc) != nullptr);
+    }
+    return count;
+}
+
+void cache::clear_epo()
+{
+    for (epo_segment& s : epo_) {
+        s = epo_segment();
+    }
+}
+
+// Ring
+
+void burst_ring::put(const uint8_t* p, size_t n)
+{
+    size_t tail  = (head_ + used_) % size_;
+    size_t first = (n < size_ - tail) ? n : size_ - tail;
+    std::memcpy(data_ + tail, p, first);
+    std::memcpy(data_, p + first, n - first);
+    used_ += n;
+}
+
+bool burst_ring::push(const char* body, size_t len)
+{
+    if (used_ + len + 6 > size_) {
+        return false;
+    }
+    uint8_t sum = 0;
+    for (size_t i = 0; i < len; i++) {
+        sum ^= uint8_t(body[i]);
+    }
+    static const char hex[] = "0123456789ABCDEF";
+    const uint8_t     dollar = '$';
+    const uint8_t     end[5] = {'*', uint8_t(hex[sum >> 4]), uint8_t(hex[sum & 15]), '\r', '\n'};
+    put(&dollar, 1);
+    put(reinterpret_cast<const uint8_t*>(body), len);
+    put(end, sizeof(end));
+    return true;
+}
+
+size_t burst_ring::peek(const uint8_t*& p) const
+{
+    p = data_ + head_;
+    return (used_ < size_ - head_) ? used_ : size_ - head_;
+}
+
+void burst_ring::consume(size_t n)
+{
+    head_ = (head_ + n) % size_;
+    used_ -= n;
+}
+
+// Injector
+
+injector::injector(cache& cache, link& link, burst_ring& ring, send_mode mode)
+    : cache_(cache), link_(link), ring_(ring), mode_(mode)
+{
+}
+
+bool injector::stage_entry(uint16_t command, uint8_t satellite, uint8_t sends)
+{
+    char     body[max_sentence];
+    int      len = 0;
+    uint32_t now = link_.now_ms();
+    uint32_t utc, error_ms, error_m;
+
+    if ((count_ == max_entries) || !cache_.time(now, utc, error_ms)) {
+        return false;
+    }
+    if (command == pmtk::time_oc) {
+        if (error_ms > cache_.config().max_time_error_ms) {
+            return false;
+        }
+        len = format_time(body, sizeof(body), utc);
+    } else if (command == pmtk::position_oc) {
+        const fix& f = cache_.last_fix();
+        if (!cache_.position_error(utc, error_m)) {
+            return false;
+        }
+        char lat[16], lon[16];
+        format_degrees(lat, sizeof(lat), f.latitude);
+        format_degrees(lon, sizeof(lon), f.longitude);
+        // As the MFG firmware: latitude, longitude, altitude, error ellipse (major, minor, bearing), vertical error
+        len = std::snprintf(body, sizeof(body), "PMTK713,%s,%s,%d.0,%u.0,%u.0,0.0,%u.0", lat, lon,
+                            int(f.altitude_cm / 100), unsigned(error_m), unsigned(error_m), unsigned(error_m));
+    } else if (command == pmtk::epo_oc) {
+        const epo_segment* segment = cache_.epo(satellite - 1, utc);
+        if (segment == nullptr) {
+            return false;
+        }
+        len = std::snprintf(body, sizeof(body), "PMTK721,%02X", unsigned(segment->satellite));
+        for (uint32_t word : segment->words) {
+            len += std::snprintf(body + len, sizeof(body) - size_t(len), ",%08X", unsigned(word));
+        }
+    } else {
+        return false;
+    }
+    if (!ring_.push(body, size_t(len))) {
+        return false;
+    }
+    entries_[count_++] = {command, satellite, sends, uint16_t(len + 6), 0};
+    stats_.staged++;
+    return true;
+}
+
+size_t injector::stage(bool with_time, bool with_epo)
+{
+    uint32_t utc, error_ms, error_m;
+
+    ring_.clear();
+    count_    = 0;
+    written_  = 0;
+    partial_  = 0;
+    stats_    = injector_stats();
+    powered_  = false;
+    started_  = false;
+    time_due_ = false;
+    if (!cache_.time(link_.now_ms(), utc, error_ms)) {
+        return 0;  // Without a time there is no EPO segment nor position error either
+    }
+    time_due_ = with_time && (error_ms <= cache_.config().max_time_error_ms);
+    if (cache_.position_error(utc, error_m) && (error_m <= cache_.config().max_position_error_m)) {
+        stage_entry(pmtk::position_oc, 0, 1);
+    }
+    for (size_t i = 0; with_epo && (i < max_satellites); i++) {
+        if (cache_.epo(i, utc) != nullptr) {
+            stage_entry(pmtk::epo_oc, uint8_t(i + 1), 1);
+        }
+    }
+    return count_ + time_due_;
+}
+
+void injector::power_on()
+{
+    powered_  = true;
+    started_  = false;
+    power_ms_ = link_.now_ms();
+}
+
+void injector::start()
+{
+    uint32_t utc, error_ms;
+
+    started_     = true;
+    time_length_ = 0;
+    time_done_   = 0;
+    if (time_due_ && (count_ < max_entries) && cache_.time(link_.now_ms(), utc, error_ms) &&
+        (error_ms <= cache_.config().max_time_error_ms)) {
+        char body[40];
+        int  len = format_time(body, sizeof(body), utc);
+        // Written ahead of the ring: the first entry
+        uint8_t sum = 0;
+        for (int i = 0; i < len; i++) {
+            sum ^= uint8_t(body[i]);
+        }
+        time_length_ = size_t(std::snprintf(time_, sizeof(time_), "$%s*%02X\r\n", body, unsigned(sum)));
+        std::memmove(entries_ + 1, entries_, count_ * sizeof(entry));
+        entries_[0] = {pmtk::time_oc, 0, 1, uint16_t(time_length_), 0};
+        count_++;
+        stats_.staged++;
+    }
+    if (count_ == 0) {
+        stats_.done_ms = elapsed();
+    }
+}
+
+void injector::written(size_t n)
+{
+    if ((n > 0) && (stats_.sent == 0) && (partial_ == 0)) {
+        stats_.start_ms = elapsed();
+    }
+    partial_ += n;
+    while ((written_ < count_) && (partial_ >= entries_[written_].length)) {
+        partial_ -= entries_[written_].length;
+        entries_[written_].sent_ms = link_.now_ms();
+        written_++;
+        stats_.sent++;
+        stats_.written_ms = elapsed();
+    }
+}
+
+void injector::resolve(size_t index, bool success)
+{
+    entry e = entries_[index];
+
+    std::memmove(entries_ + index, entries_ + index + 1, (count_ - index - 1) * sizeof(entry));
+    count_--;
+    written_--;
+    if (success) {
+        stats_.acked++;
+    } else if ((e.sends <= cache_.config().retries) && stage_entry(e.command, e.satellite, uint8_t(e.sends + 1))) {
+        // Staged again behind the rest, formatted now: a PMTK740 then goes through the ring, dropped if the
+        // time error has grown too large
+        stats_.staged--;
+        stats_.retries++;
+    }
+    if (count_ == 0) {
+        stats_.done_ms = elapsed();
+    }
+}
+
+void injector::poll()
+{
+    if (!powered_) {
+        return;
+    }
+    if (!started_) {
+        if (elapsed() < cache_.config().startup_timeout_ms) {
+            return;
+        }
+        start();
+    }
+
+    uint32_t now = link_.now_ms();
+    for (size_t i = 0; i < written_;) {
+        if (now - entries_[i].sent_ms >= cache_.config().ack_timeout_ms) {
+            stats_.timeouts++;
+            resolve(i, false);
+        } else {
+            i++;
+        }
+    }
+
+    for (;;) {
+        if ((mode_ == send_mode::one_by_one) && (written_ > 0)) {
+            return;  // Waiting for the ack of the previous sentence
+        }
+        const uint8_t* p;
+        size_t         n;
+        bool           from_time = time_done_ < time_length_;
+        if (from_time) {
+            p = reinterpret_cast<const uint8_t*>(time_) + time_done_;
+            n = time_length_ - time_done_;
+        } else {
+            n = ring_.peek(p);
+        }
+        if ((n == 0) || (written_ == count_)) {
+            return;
+        }
+        if (mode_ == send_mode::one_by_one) {
+            size_t left = entries_[written_].length - partial_;
+            n           = (n < left) ? n : left;
+        }
+        size_t w = link_.write(p, n);
+        if (from_time) {
+            time_done_ += w;
+        } else {
+            ring_.consume(w);
+        }
+        written(w);
+        if (w < n) {
+            return;
+        }
+    }
+}
+
+void injector::on_pmtk_ack(const nmea::pmtk_ack& ack)
+{
+    for (size_t i = 0; i < written_; i++) {
+        if (entries_[i].command == ack.command) {
+            if (ack.flag != nmea::ack_flag::success) {
+                stats_.failed++;
+            }
+            resolve(i, ack.flag == nmea::ack_flag::success);
+            poll();  // One-by-one: the next sentence goes at once
+            return;
+        }
+    }
+}
+
+void injector::on_pmtk(const nmea::pmtk& message)
+{
+    if ((message.type == pmtk::system_msg) && (message.data == "001") && powered_ && !started_) {
+        start();
+        poll();
+    }
+}
+
+}  // namespace agnss
@@ -0,0 +1,288 @@
+/*!
+ * \file      agnss_assist.hpp
+ *
+ * \brief     A-GNSS assistance for the MT3333: cache, staging ring and burst injection
+ *
+ * The cache keeps what the MCU knows between two acquisitions: the last good
+ * fix, the UTC time with its source and the error it has gathered since, and
+ * one EPO segment per GPS satellite. Before the MT3333 is powered, stage()
+ * formats the PMTK713 reference position and the PMTK721 EPO sentences into
+ * a ring buffer. The PMTK740 time is formatted when it is sent, so that it
+ * is not stale. The injector sends everything in one burst as soon as the
+ * MT3333 reports PMTK010,001 after power-on, or after a timeout. Acks are
+ * matched to the sentences in order, and a failed sentence is sent again. A
+ * PMTK740 sent again is formatted again, or dropped if the time error has
+ * grown over max_time_error_ms meanwhile.
+ *
+ * The one-by-one mode sends a sentence only when the previous one has been
+ * acknowledged, as the MFG firmware does. It is kept to compare the two.
+ *
+ * Sentences only go out when they help. The time is sent while its error
+ * bound, which grows with the RTC drift, stays under max_time_error_ms. The
+ * position is sent while the distance that can have been travelled since
+ * the fix stays under max_position_error_m. EPO is sent for the satellites
+ * whose segment covers the current time.
+ *
+ * The UART is behind a small interface, and the MT3333 replies come through
+ * nmea::parser. No heap, no exceptions; the ring storage is given by the
+ * caller.
+ */
+
+#ifndef AGNSS_ASSIST_HPP
+#define AGNSS_ASSIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "nmea_parser.hpp"
+
+namespace agnss {
+
+/*!
+ * \brief MTK commands and messages (PMTK packet user manual)
+ */
+namespace pmtk {
+constexpr uint16_t system_msg  = 10;   //!< PMTK010,<msg>
+constexpr uint16_t startup     = 1;    //!< PMTK010,001: ready for commands after power-on
+constexpr uint16_t epo_oc      = 721;  //!< PMTK721,<sat>,<18 words>: one EPO segment
+constexpr uint16_t position_oc = 713;  //!< PMTK713,<lat>,<lon>,<alt>,<major>,<minor>,<bearing>,<vertical>
+constexpr uint16_t time_oc     = 740;  //!< PMTK740,<YYYY>,<MM>,<DD>,<hh>,<mm>,<ss>: UTC time
+constexpr size_t   epo_words   = 18;   //!< 72 bytes per satellite and 6-hour segment
+}  // namespace pmtk
+
+constexpr size_t max_satellites = 32;  //!< GPS PRN 1 to 32
+constexpr size_t max_sentence   = 200;  //!< Longest sentence staged, PMTK721 takes 172
+
+enum class time_source : uint8_t { none, rtc, network, gnss };
+
+const char* time_source_name(time_source source);
+
+struct config {
+    uint32_t rtc_drift_ppm        = 20;     //!< Drift bound of the MCU RTC
+    uint32_t max_time_error_ms    = 2000;   //!< PMTK740 only below this error
+    uint32_t speed_cm_s           = 100;    //!< Motion assumed since the last fix
+    uint32_t max_position_error_m = 30000;  //!< PMTK713 only below this error
+    uint32_t startup_timeout_ms   = 1000;   //!< Flush without PMTK010,001 after this time
+    uint32_t ack_timeout_ms       = 3000;
+    uint8_t  retries              = 1;      //!< Sends of a failed sentence after the first
+};
+
+struct fix {
+    bool     valid       = false;
+    int32_t  latitude    = 0;  //!< 1e-7 degrees
+    int32_t  longitude   = 0;
+    int32_t  altitude_cm = 0;
+    uint32_t ehpe_cm     = 0;
+    uint32_t utc         = 0;  //!< Unix seconds
+};
+
+struct epo_segment {
+    uint8_t  satellite = 0;  //!< PRN, 0 for an empty slot
+    uint32_t start     = 0;  //!< Unix seconds
+    uint32_t end       = 0;
+    uint32_t words[pmtk::epo_words] = {};
+};
+
+/*!
+ * \brief What the MCU knows between acquisitions
+ *
+ * Times in ms are read from the monotonic MCU clock, and compared by
+ * difference so that they may wrap.
+ */
+class cache {
+public:
+    explicit cache(const config& config) : config_(config) {}
+
+    /*!
+     * \brief Set the UTC time at MCU time now_ms, with its error at that moment
+     */
+    void set_time(uint32_t utc, uint32_t error_ms, time_source source, uint32_t now_ms);
+
+    /*!
+     * \brief UTC time and error bound at MCU time now_ms
+     *
+     * \returns False if the time was never set
+     */
+    bool time(uint32_t now_ms, uint32_t& utc, uint32_t& error_ms) const;
+
+    time_source source() const { return source_; }
+
+    /*!
+     * \brief Keep a fix, e.g. the last one of an acquisition that met its EHPE target
+     */
+    void set_fix(const agnss::fix& fix) { fix_ = fix; }
+
+    const agnss::fix& last_fix() const { return fix_; }
+
+    /*!
+     * \brief Bound of the distance from the last fix at utc, in m
+     *
+     * \returns False without a fix
+     */
+    bool position_error(uint32_t utc, uint32_t& error_m) const;
+
+    /*!
+     * \brief Keep a segment, in place of the one of the same satellite
+     */
+    bool set_epo(const epo_segment& segment);
+
+    /*!
+     * \brief Segment of the slot, nullptr if the slot is empty or does not cover utc
+     */
+    const epo_segment* epo(size_t slot, uint32_t utc) const;
+
+    size_t epo_count(uint32_t utc) const;
+
+    void clear_epo();
+
+    const agnss::config& config() const { return config_; }
+
+private:
+    const agnss::config& config_;
+    time_source          source_   = time_source::none;
+    uint32_t             utc_      = 0;
+    uint32_t             error_ms_ = 0;
+    uint32_t             set_ms_   = 0;
+    agnss::fix           fix_;
+    epo_segment          epo_[max_satellites];
+};
+
+/*!
+ * \brief Byte ring of complete sentences, written to the UART as they are
+ */
+class burst_ring {
+public:
+    burst_ring(uint8_t* storage, size_t size) : data_(storage), size_(size) {}
+
+    /*!
+     * \brief Add $<body>*hh<CR><LF>, or nothing if it does not fit
+     */
+    bool push(const char* body, size_t len);
+
+    size_t used() const { return used_; }
+    bool   empty() const { return used_ == 0; }
+
+    /*!
+     * \brief Contiguous bytes at the head, for a UART or DMA write
+     */
+    size_t peek(const uint8_t*& p) const;
+
+    void consume(size_t n);
+    void clear() { head_ = used_ = 0; }
+
+private:
+    void put(const uint8_t* p, size_t n);
+
+    uint8_t* data_;
+    size_t   size_;
+    size_t   head_ = 0;
+    size_t   used_ = 0;
+};
+
+/*!
+ * \brief UART to the MT3333
+ */
+class link {
+public:
+    virtual ~link() = default;
+
+    /*!
+     * \brief Queue bytes for transmission
+     *
+     * \returns Bytes taken, fewer than n when the driver buffer is full
+     */
+    virtual size_t write(const uint8_t* p, size_t n) = 0;
+
+    /*!
+     * \brief Monotonic MCU time in ms
+     */
+    virtual uint32_t now_ms() = 0;
+};
+
+enum class send_mode : uint8_t { burst, one_by_one };
+
+struct injector_stats {
+    uint32_t staged     = 0;  //!< Sentences, PMTK740 included
+    uint32_t sent       = 0;  //!< Sends, retries included
+    uint32_t acked      = 0;
+    uint32_t failed     = 0;  //!< Acks with another flag than success
+    uint32_t timeouts   = 0;
+    uint32_t retries    = 0;
+    uint32_t start_ms   = 0;  //!< Power-on to the first byte written
+    uint32_t written_ms = 0;  //!< Power-on to the last byte written
+    uint32_t done_ms    = 0;  //!< Power-on to the last ack
+};
+
+class injector : public nmea::handler {
+public:
+    injector(cache& cache, link& link, burst_ring& ring, send_mode mode = send_mode::burst);
+
+    /*!
+     * \brief Format what helps at MCU time now into the ring, before power-on
+     *
+     * \param [in] with_time  Send a PMTK740 first, formatted at flush time
+     * \param [in] with_epo   Add the EPO segments that cover the current time
+     *
+     * \returns Sentences staged
+     */
+    size_t stage(bool with_time = true, bool with_epo = true);
+
+    /*!
+     * \brief The MT3333 has just been powered
+     */
+    void power_on();
+
+    /*!
+     * \brief Write what the UART takes and check the ack timeouts, from the main loop
+     */
+    void poll();
+
+    /*!
+     * \brief Everything staged has been acknowledged or given up
+     */
+    bool done() const { return started_ && (count_ == 0); }
+
+    const injector_stats& stats() const { return stats_; }
+
+    void on_pmtk_ack(const nmea::pmtk_ack& ack) override;
+    void on_pmtk(const nmea::pmtk& message) override;
+
+private:
+    // A sentence staged, being written, or waiting for its ack
+    struct entry {
+        uint16_t command;
+        uint8_t  satellite;  // PMTK721 only
+        uint8_t  sends;
+        uint16_t length;
+        uint32_t sent_ms;
+    };
+
+    static constexpr size_t max_entries = max_satellites + 4;
+
+    void     start();
+    bool     stage_entry(uint16_t command, uint8_t satellite, uint8_t sends);
+    void     written(size_t n);
+    void     resolve(size_t index, bool success);
+    uint32_t elapsed() { return link_.now_ms() - power_ms_; }
+
+    cache&         cache_;
+    link&          link_;
+    burst_ring&    ring_;
+    send_mode      mode_;
+    bool           powered_  = false;
+    bool           started_  = false;
+    bool           time_due_ = false;  // PMTK740 to format at start
+    uint32_t       power_ms_ = 0;
+    char           time_[48];          // PMTK740 written ahead of the ring
+    size_t         time_length_ = 0;
+    size_t         time_done_   = 0;
+    entry          entries_[max_entries];
+    size_t         count_   = 0;  // Entries in order: written and unacknowledged first, then staged
+    size_t         written_ = 0;  // Entries fully written
+    size_t         partial_ = 0;  // Bytes written of entries_[written_]
+    injector_stats stats_;
+};
+
+}  // namespace agnss
+
+#endif  // AGNSS_ASSIST_HPP
@@ -0,0 +1,206 @@
+/*!
+ * \file      abw_cli_json.c
+ *
+ * \brief     Streaming writer of the JSON records of the MFG CLI
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "abw_cli_json.h"
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PRIVATE FUNCTIONS DEFINITION --------------------------------------------
+ */
+
+static void abw_cli_json_put(abw_cli_json_t* ctx, const char* text)
+{
+    ctx->out(ctx->out_ctx, text, ( uint32_t ) strlen(text));
+}
+
+/*!
+ * \brief Quoted string, with the escapes JSON requires
+ */
+static void abw_cli_json_quote(abw_cli_json_t* ctx, const char* s)
+{
+    static const char hex[] = "0123456789abcdef";
+    const char*       run   = s;
+
+    abw_cli_json_put(ctx, "\"");
+    for (; *s != '\0'; s++)
+    {
+        unsigned char c = ( unsigned char ) *s;
+        if ((c >= 0x20) && (c != '"') && (c != '\\'))
+        {
+            continue;
+        }
+        // Flush the plain characters before the one to escape
+        ctx->out(ctx->out_ctx, run, ( uint32_t ) (s - run));
+        run = s + 1;
+        if ((c == '"') || (c == '\\'))
+        {
+            char esc[3] = { '\\', ( char ) c, '\0' };
+            abw_cli_json_put(ctx, esc);
+        }
+        else
+        {
+            char esc[7] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF], '\0' };
+            abw_cli_json_put(ctx, esc);
+        }
+    }
+    ctx->out(ctx->out_ctx, run, ( uint32_t ) (s - run));
+    abw_cli_json_put(ctx, "\"");
+}
+
+/*!
+ * \brief Separator and key of the next member of the open object
+ */
+static void abw_cli_json_key(abw_cli_json_t* ctx, const char* key)
+{
+    uint8_t bit = ( uint8_t ) (1u << (ctx->depth - 1));
+
+    if ((ctx->first & bit) != 0)
+    {
+        ctx->first &= ( uint8_t ) ~bit;
+    }
+    else
+    {
+        abw_cli_json_put(ctx, ",");
+    }
+    abw_cli_json_quote(ctx, key);
+    abw_cli_json_put(ctx, ":");
+}
+
+static void abw_cli_json_decimal(abw_cli_json_t* ctx, uint32_t value, bool negative)
+{
+    char  text[12];
+    char* p = text + sizeof(text) - 1;
+
+    *p = '\0';
+    do
+    {
+        *--p = ( char ) ('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+    if (negative)
+    {
+        *--p = '-';
+    }
+    abw_cli_json_put(ctx, p);
+}
+
+/*!
+ * \brief Open the record, its first member, then "data"
+ */
+static void abw_cli_json_start(abw_cli_json_t* ctx, const char* kind, const char* name)
+{
+    ctx->depth = 1;
+    ctx->first = 1;
+    abw_cli_json_put(ctx, "{");
+    abw_cli_json_key(ctx, kind);
+    abw_cli_json_quote(ctx, name);
+}
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS DEFINITION ---------------------------------------------
+ */
+
+void abw_cli_json_init(abw_cli_json_t* ctx, abw_cli_json_out_t out, void* out_ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->out     = out;
+    ctx->out_ctx = out_ctx;
+}
+
+void abw_cli_json_result(abw_cli_json_t* ctx, const char* cmd)
+{
+    abw_cli_json_start(ctx, "cmd", cmd);
+    abw_cli_json_open(ctx, "data");
+}
+
+void abw_cli_json_event(abw_cli_json_t* ctx, const char* event, uint32_t uptime_ms)
+{
+    abw_cli_json_start(ctx, "event", event);
+    abw_cli_json_uint(ctx, "uptime_ms", uptime_ms);
+    abw_cli_json_open(ctx, "data");
+}
+
+void abw_cli_json_string(abw_cli_json_t* ctx, const char* key, const char* value)
+{
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_quote(ctx, value);
+}
+
+void abw_cli_json_int(abw_cli_json_t* ctx, const char* key, int32_t value)
+{
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_decimal(ctx, (value < 0) ? (0u - ( uint32_t ) value) : ( uint32_t ) value, value < 0);
+}
+
+void abw_cli_json_uint(abw_cli_json_t* ctx, const char* key, uint32_t value)
+{
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_decimal(ctx, value, false);
+}
+
+void abw_cli_json_bool(abw_cli_json_t* ctx, const char* key, bool value)
+{
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_put(ctx, value ? "true" : "false");
+}
+
+void abw_cli_json_hex(abw_cli_json_t* ctx, const char* key, const uint8_t* data, uint32_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_put(ctx, "\"");
+    for (uint32_t i = 0; i < len; i++)
+    {
+        char byte[2] = { hex[data[i] >> 4], hex[data[i] & 0xF] };
+        ctx->out(ctx->out_ctx, byte, 2);
+    }
+    abw_cli_json_put(ctx, "\"");
+}
+
+bool abw_cli_json_open(abw_cli_json_t* ctx, const char* key)
+{
+    if (ctx->depth >= ABW_CLI_JSON_DEPTH_MAX)
+    {
+        return false;
+    }
+    abw_cli_json_key(ctx, key);
+    abw_cli_json_put(ctx, "{");
+    ctx->first |= ( uint8_t ) (1u << ctx->depth);
+    ctx->depth++;
+    return true;
+}
+
+void abw_cli_json_close(abw_cli_json_t* ctx)
+{
+    if (ctx->depth > 1)
+    {
+        ctx->depth--;
+        abw_cli_json_put(ctx, "}");
+    }
+}
+
+void abw_cli_json_end(abw_cli_json_t* ctx, abw_cli_code_t code, const char* error)
+{
+    while (ctx->depth > 1)
+    {
+        abw_cli_json_close(ctx);
+    }
+    abw_cli_json_uint(ctx, "code", ( uint32_t ) code);
+    if ((code != ABW_CLI_OK) && (error != NULL))
+    {
+        abw_cli_json_string(ctx, "error", error);
+    }
+    abw_cli_json_put(ctx, "}\r\n");
+    ctx->depth = 0;
+}
@@ -0,0 +1,136 @@
+/*!
+ * \file      abw_cli_json.h
+ *
+ * \brief     Line-delimited JSON records for the machine output mode of the MFG CLI
+ *
+ * In JSON mode ("system output json") the CLI stops echoing and prompting.
+ * It answers each command line with one result record, and prints each
+ * asynchronous event, such as a log line, as an event record. A record is
+ * one line of compact JSON ended by CR LF:
+ *
+ *   {"cmd":"provis lora display","data":{"valid":true,...},"code":0}
+ *   {"cmd":"provis lora set deveui","data":{},"code":2,"error":"Invalid EUI value 'xyz'"}
+ *   {"event":"log","uptime_ms":160340,"data":{"source":"GNSS","text":"MT. Started"},"code":0}
+ *
+ * "cmd" is the command with its abbreviations expanded and without its
+ * arguments. "data" is always present, and its field names are fixed for
+ * each command. "code" is an abw_cli_code_t, and "error" is only present
+ * when code is not ABW_CLI_OK. EUIs and keys are lowercase hex strings.
+ *
+ * MFG 3.0 has no JSON mode yet. This header is the format the MFG
+ * application is to implement, and the stand-in of
+ * tools/common/mfg_cli_sim.hpp writes its JSON mode with it.
+ *
+ * The writer streams the record to a callback as it is built, with no
+ * buffer. Up to ABW_CLI_JSON_DEPTH_MAX objects can be open at once, the
+ * record itself included.
+ */
+
+#ifndef ABW_CLI_JSON_H
+#define ABW_CLI_JSON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Objects open at once, the record itself included
+ */
+#define ABW_CLI_JSON_DEPTH_MAX 8
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC TYPES ------------------------------------------------------------
+ */
+
+/*!
+ * \brief Status of a result record, stable across releases
+ */
+typedef enum abw_cli_code_e
+{
+    ABW_CLI_OK = 0,            //!< Done
+    ABW_CLI_UNKNOWN_COMMAND,   //!< No such command, or an ambiguous abbreviation
+    ABW_CLI_INVALID_ARGUMENT,  //!< Missing or malformed argument
+    ABW_CLI_FAILED,            //!< The command ran and failed
+} abw_cli_code_t;
+
+/*!
+ * \brief Output of the writer, e.g. the UART or USB CDC transmit of the CLI
+ */
+typedef void ( *abw_cli_json_out_t )(void* ctx, const char* data, uint32_t len);
+
+/*!
+ * \brief Writer context
+ *
+ * Fields are private to the writer.
+ */
+typedef struct abw_cli_json_s
+{
+    abw_cli_json_out_t out;
+    void*              out_ctx;
+    uint8_t            depth;  //!< Objects open in the record, the record itself included
+    uint8_t            first;  //!< Bit n set while object n has no member yet
+} abw_cli_json_t;
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Prepare a writer
+ */
+void abw_cli_json_init(abw_cli_json_t* ctx, abw_cli_json_out_t out, void* out_ctx);
+
+/*!
+ * \brief Start the result record of a command, then open its "data"
+ */
+void abw_cli_json_result(abw_cli_json_t* ctx, const char* cmd);
+
+/*!
+ * \brief Start an event record, then open its "data"
+ */
+void abw_cli_json_event(abw_cli_json_t* ctx, const char* event, uint32_t uptime_ms);
+
+/*!
+ * \brief Members of the open object
+ *
+ * abw_cli_json_hex() writes len bytes as a string of 2 * len lowercase hex digits.
+ */
+void abw_cli_json_string(abw_cli_json_t* ctx, const char* key, const char* value);
+void abw_cli_json_int(abw_cli_json_t* ctx, const char* key, int32_t value);
+void abw_cli_json_uint(abw_cli_json_t* ctx, const char* key, uint32_t value);
+void abw_cli_json_bool(abw_cli_json_t* ctx, const char* key, bool value);
+void abw_cli_json_hex(abw_cli_json_t* ctx, const char* key, const uint8_t* data, uint32_t len);
+
+/*!
+ * \brief Open an object member, closed by abw_cli_json_close()
+ *
+ * \returns False, and opens nothing, past ABW_CLI_JSON_DEPTH_MAX
+ */
+bool abw_cli_json_open(abw_cli_json_t* ctx, const char* key);
+void abw_cli_json_close(abw_cli_json_t* ctx);
+
+/*!
+ * \brief Close what is open, add the code and the error message (NULL if none), and end the line
+ */
+void abw_cli_json_end(abw_cli_json_t* ctx, abw_cli_code_t code, const char* error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_CLI_JSON_H
@@ -0,0 +1,55 @@
+/*!
+ * \file      abw_crc16.h
+ *
+ * \brief     CRC-16/XMODEM (CCITT polynomial, initial value 0) for XMODEM transfers
+ *
+ * Typical use on a block:
+ *
+ *   uint16_t crc = abw_crc16_update(ABW_CRC16_INIT, block, len);
+ */
+
+#ifndef ABW_CRC16_H
+#define ABW_CRC16_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Initial value of a running CRC
+ */
+#define ABW_CRC16_INIT 0x0000u
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Add bytes to a running CRC
+ *
+ * \param [in] crc  Running CRC, ABW_CRC16_INIT for the first call
+ * \param [in] data Bytes to add
+ * \param [in] len  Number of bytes
+ *
+ * \returns Updated CRC, which is also the CRC of the bytes seen so far
+ */
+uint16_t abw_crc16_update(uint16_t crc, const uint8_t* data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_CRC16_H
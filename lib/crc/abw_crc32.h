@@ -0,0 +1,82 @@
+/*!
+ * \file      abw_crc32.h
+ *
+ * \brief     Incremental CRC-32 (IEEE 802.3, as zlib and `crc32`) for firmware images
+ *
+ * The CRC can be fed a byte stream or 32-bit words. Words are processed
+ * most significant byte first, which is the order of the LR11xx .bin files
+ * and of the SPI transfer, so the CRC of lr11xx_firmware_image[] computed
+ * word by word equals the CRC of the .bin file.
+ *
+ * Typical use while streaming an image:
+ *
+ *   uint32_t crc = ABW_CRC32_INIT;
+ *   for each chunk:
+ *       crc = abw_crc32_update_words(crc, chunk, count);
+ *   ok = (abw_crc32_final(crc) == LR11XX_FIRMWARE_IMAGE_CRC32);
+ */
+
+#ifndef ABW_CRC32_H
+#define ABW_CRC32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Initial value of a running CRC
+ */
+#define ABW_CRC32_INIT 0xFFFFFFFFu
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Add bytes to a running CRC
+ *
+ * \param [in] crc  Running CRC, ABW_CRC32_INIT for the first call
+ * \param [in] data Bytes to add
+ * \param [in] len  Number of bytes
+ *
+ * \returns Updated running CRC
+ */
+uint32_t abw_crc32_update(uint32_t crc, const uint8_t* data, uint32_t len);
+
+/*!
+ * \brief Add 32-bit words to a running CRC, most significant byte first
+ *
+ * \param [in] crc   Running CRC, ABW_CRC32_INIT for the first call
+ * \param [in] words Words to add
+ * \param [in] count Number of words
+ *
+ * \returns Updated running CRC
+ */
+uint32_t abw_crc32_update_words(uint32_t crc, const uint32_t* words, uint32_t count);
+
+/*!
+ * \brief Turn a running CRC into the CRC-32 value
+ */
+static inline uint32_t abw_crc32_final(uint32_t crc)
+{
+    return crc ^ 0xFFFFFFFFu;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_CRC32_H
@@ -0,0 +1,256 @@
+/*!
+ * \file      abw_delta.c
+ *
+ * \brief     Streaming patch applier rebuilding a firmware image from the resident one
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "abw_crc32.h"
+#include "abw_delta.h"
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PRIVATE FUNCTIONS DEFINITION --------------------------------------------
+ */
+
+static uint32_t abw_delta_get32(const uint8_t* p)
+{
+    return ( uint32_t ) p[0] | (( uint32_t ) p[1] << 8) | (( uint32_t ) p[2] << 16) | (( uint32_t ) p[3] << 24);
+}
+
+static uint8_t abw_delta_base_byte(const abw_delta_t* ctx, uint32_t pos)
+{
+    if (ctx->base != NULL)
+    {
+        return ctx->base[pos];
+    }
+    return ( uint8_t ) (ctx->base_words[pos / 4] >> (24 - 8 * (pos % 4)));
+}
+
+static int abw_delta_varint(abw_delta_t* ctx, uint32_t* value)
+{
+    uint32_t v     = 0;
+    unsigned shift = 0;
+
+    while (ctx->patch_pos < ctx->patch_len)
+    {
+        uint8_t byte = ctx->patch[ctx->patch_pos++];
+
+        v |= ( uint32_t ) (byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = v;
+            return 1;
+        }
+        shift += 7;
+        if (shift > 28)
+        {
+            break;
+        }
+    }
+    return 0;
+}
+
+// Start the next command, 0 if the patch is corrupt
+static int abw_delta_next(abw_delta_t* ctx)
+{
+    uint32_t v;
+    uint32_t zigzag;
+    int32_t  delta;
+
+    if (!abw_delta_varint(ctx, &v) || ((v >> 1) == 0))
+    {
+        return 0;
+    }
+    ctx->left    = v >> 1;
+    ctx->copying = ( uint8_t ) (v & 1);
+    if (ctx->left > (ctx->info.target_len - ctx->out_pos))
+    {
+        return 0;
+    }
+
+    if (ctx->copying)
+    {
+        if (!abw_delta_varint(ctx, &zigzag))
+        {
+            return 0;
+        }
+        delta = ( int32_t ) (zigzag >> 1) ^ -( int32_t ) (zigzag & 1);
+        // Each bound on its own, in 64 bits for -INT32_MIN: a sum could wrap
+        if ((delta < 0) ? (( uint64_t ) -( int64_t ) delta > ctx->copy_pos)
+                        : (( uint32_t ) delta > (ctx->info.base_len - ctx->copy_pos)))
+        {
+            return 0;
+        }
+        ctx->copy_pos = ( uint32_t ) (( int64_t ) ctx->copy_pos + delta);
+        if (ctx->left > (ctx->info.base_len - ctx->copy_pos))
+        {
+            return 0;
+        }
+    }
+    else if (ctx->left > (ctx->patch_len - ctx->patch_pos))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+static abw_delta_status_t abw_delta_attach(abw_delta_t* ctx, const uint8_t* patch, uint32_t patch_len,
+                                           uint32_t base_len, uint32_t max_target_len)
+{
+    abw_delta_status_t status = abw_delta_info(patch, patch_len, &ctx->info);
+
+    if (status != ABW_DELTA_OK)
+    {
+        return status;
+    }
+    if (ctx->info.target_len > max_target_len)
+    {
+        return ABW_DELTA_ERR_HEADER;
+    }
+    ctx->patch     = patch;
+    ctx->patch_len = patch_len;
+    ctx->patch_pos = ABW_DELTA_HEADER_SIZE;
+    ctx->out_pos   = 0;
+    ctx->copy_pos  = 0;
+    ctx->left      = 0;
+    ctx->copying   = 0;
+    ctx->ended     = 0;
+    abw_sha256_init(&ctx->sha256);
+
+    return (base_len == ctx->info.base_len) ? ABW_DELTA_OK : ABW_DELTA_ERR_BASE;
+}
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS DEFINITION ---------------------------------------------
+ */
+
+abw_delta_status_t abw_delta_info(const uint8_t* patch, uint32_t patch_len, abw_delta_info_t* info)
+{
+    if ((patch_len < ABW_DELTA_HEADER_SIZE) || (patch[0] != 'A') || (patch[1] != 'B') || (patch[2] != 'W') ||
+        (patch[3] != 'D') || (patch[4] != ABW_DELTA_FORMAT))
+    {
+        return ABW_DELTA_ERR_HEADER;
+    }
+
+    info->update_to  = patch[5];
+    info->version    = ( uint16_t ) (patch[6] | (patch[7] << 8));
+    info->base_len   = abw_delta_get32(patch + 8);
+    info->base_crc   = abw_delta_get32(patch + 12);
+    info->target_len = abw_delta_get32(patch + 16);
+    info->target_crc = abw_delta_get32(patch + 20);
+    memcpy(info->target_sha256, patch + 24, ABW_SHA256_DIGEST_SIZE);
+
+    return ABW_DELTA_OK;
+}
+
+abw_delta_status_t abw_delta_init(abw_delta_t* ctx, const uint8_t* patch, uint32_t patch_len, const uint8_t* base,
+                                  uint32_t base_len, uint32_t max_target_len)
+{
+    ctx->base       = base;
+    ctx->base_words = NULL;
+    return abw_delta_attach(ctx, patch, patch_len, base_len, max_target_len);
+}
+
+abw_delta_status_t abw_delta_init_words(abw_delta_t* ctx, const uint8_t* patch, uint32_t patch_len,
+                                        const uint32_t* base, uint32_t base_words, uint32_t max_target_len)
+{
+    ctx->base       = NULL;
+    ctx->base_words = base;
+    return abw_delta_attach(ctx, patch, patch_len, base_words * 4, max_target_len);
+}
+
+abw_delta_status_t abw_delta_check_base(const abw_delta_t* ctx)
+{
+    uint32_t crc = ABW_CRC32_INIT;
+
+    if (ctx->base != NULL)
+    {
+        crc = abw_crc32_update(crc, ctx->base, ctx->info.base_len);
+    }
+    else
+    {
+        crc = abw_crc32_update_words(crc, ctx->base_words, ctx->info.base_len / 4);
+    }
+    return (abw_crc32_final(crc) == ctx->info.base_crc) ? ABW_DELTA_OK : ABW_DELTA_ERR_BASE;
+}
+
+const abw_delta_info_t* abw_delta_get_info(const abw_delta_t* ctx)
+{
+    return &ctx->info;
+}
+
+abw_delta_status_t abw_delta_read(abw_delta_t* ctx, uint8_t* dst, uint32_t len, uint32_t* produced)
+{
+    uint32_t           done   = 0;
+    abw_delta_status_t status = ABW_DELTA_OK;
+
+    if (ctx->ended)
+    {
+        if (produced != NULL)
+        {
+            *produced = 0;
+        }
+        return ( abw_delta_status_t ) ctx->end_status;
+    }
+
+    while ((done < len) && (ctx->out_pos < ctx->info.target_len))
+    {
+        uint32_t n;
+
+        if ((ctx->left == 0) && !abw_delta_next(ctx))
+        {
+            status = ABW_DELTA_ERR_CORRUPT;
+            break;
+        }
+
+        n = ctx->left;
+        if (n > (len - done))
+        {
+            n = len - done;
+        }
+        if (!ctx->copying)
+        {
+            memcpy(dst + done, ctx->patch + ctx->patch_pos, n);
+            ctx->patch_pos += n;
+        }
+        else if (ctx->base != NULL)
+        {
+            memcpy(dst + done, ctx->base + ctx->copy_pos, n);
+            ctx->copy_pos += n;
+        }
+        else
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                dst[done + i] = abw_delta_base_byte(ctx, ctx->copy_pos++);
+            }
+        }
+        done += n;
+        ctx->out_pos += n;
+        ctx->left -= n;
+    }
+
+    abw_sha256_update(&ctx->sha256, dst, done);
+    if (produced != NULL)
+    {
+        *produced = done;
+    }
+    if ((status == ABW_DELTA_OK) && (ctx->out_pos >= ctx->info.target_len))
+    {
+        uint8_t digest[ABW_SHA256_DIGEST_SIZE];
+
+        abw_sha256_final(&ctx->sha256, digest);
+        status = memcmp(digest, ctx->info.target_sha256, sizeof(digest)) ? ABW_DELTA_ERR_DIGEST : ABW_DELTA_END;
+        ctx->ended      = 1;
+        ctx->end_status = ( uint8_t ) status;
+    }
+    return status;
+}
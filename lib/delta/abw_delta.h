@@ -0,0 +1,189 @@
+/*!
+ * \file      abw_delta.h
+ *
+ * \brief     Streaming patch applier rebuilding a firmware image from the resident one
+ *
+ * A patch produced by the host tool `abw-delta` describes a new image as
+ * copies from the resident (base) image and inserted bytes. The applier
+ * hands out the new image in caller-sized pieces, e.g. the 64 words of an
+ * LR11xx bootloader write, with constant RAM: the context holds no window
+ * and no copy of either image. The new image is hashed on the way out and
+ * the last piece is only delivered if it matches the SHA-256 of the patch.
+ *
+ * Patch layout (all multi-byte fields little-endian):
+ *
+ *   offset  size  field
+ *   0       4     magic "ABWD"
+ *   4       1     format, ABW_DELTA_FORMAT
+ *   5       1     update target of the new image (LR11XX_FIRMWARE_UPDATE_TO), 0xFF if none
+ *   6       2     version of the new image (LR11XX_FIRMWARE_VERSION), 0 if none
+ *   8       4     size of the base in bytes
+ *   12      4     CRC-32 of the base (LR11XX_FIRMWARE_IMAGE_CRC32 of the resident image)
+ *   16      4     size of the new image in bytes
+ *   20      4     CRC-32 of the new image
+ *   24      32    SHA-256 of the new image
+ *   56      ...   commands
+ *
+ * A command starts with a varint (LEB128) v. If bit 0 of v is set, the
+ * command copies v >> 1 bytes from the base; a zigzag varint follows with
+ * the copy position relative to the end of the previous copy. Otherwise
+ * v >> 1 literal bytes follow, inserted as they are.
+ *
+ * Images are in wire order, the bytes of the .bin. The base can also be
+ * given as host-order words, as the lr11xx_firmware_image[] array.
+ */
+
+#ifndef ABW_DELTA_H
+#define ABW_DELTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include "abw_sha256.h"
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Size in bytes of the patch header
+ */
+#define ABW_DELTA_HEADER_SIZE 56
+
+/*!
+ * \brief Patch format handled by the applier
+ */
+#define ABW_DELTA_FORMAT 1
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC TYPES ------------------------------------------------------------
+ */
+
+/*!
+ * \brief Applier status
+ */
+typedef enum abw_delta_status_e
+{
+    ABW_DELTA_OK = 0,       //!< Data produced, more may follow
+    ABW_DELTA_END,          //!< The whole image has been produced and matches its SHA-256
+    ABW_DELTA_ERR_HEADER,   //!< Bad magic or unsupported format
+    ABW_DELTA_ERR_BASE,     //!< The base does not have the size or CRC the patch was made for
+    ABW_DELTA_ERR_CORRUPT,  //!< Truncated patch or copy outside the base
+    ABW_DELTA_ERR_DIGEST,   //!< The rebuilt image does not match the SHA-256 of the patch
+} abw_delta_status_t;
+
+/*!
+ * \brief Header fields of a patch
+ */
+typedef struct abw_delta_info_s
+{
+    uint8_t  update_to;    //!< Update target of the new image, 0xFF if none
+    uint16_t version;      //!< Version of the new image, 0 if none
+    uint32_t base_len;     //!< Size of the base in bytes
+    uint32_t base_crc;     //!< CRC-32 of the base
+    uint32_t target_len;   //!< Size of the new image in bytes
+    uint32_t target_crc;   //!< CRC-32 of the new image
+    uint8_t  target_sha256[ABW_SHA256_DIGEST_SIZE];
+} abw_delta_info_t;
+
+/*!
+ * \brief Applier context
+ *
+ * Fields are private to the applier.
+ */
+typedef struct abw_delta_s
+{
+    const uint8_t*   patch;      //!< Patch
+    uint32_t         patch_len;  //!< Length of the patch
+    uint32_t         patch_pos;  //!< Read position in the patch
+    const uint8_t*   base;       //!< Base image in wire order, or NULL
+    const uint32_t*  base_words; //!< Base image as host-order words, or NULL
+    abw_delta_info_t info;       //!< Patch header
+    uint32_t         out_pos;    //!< Number of bytes produced so far
+    uint32_t         copy_pos;   //!< Base position of the copy in progress, end of the last copy otherwise
+    uint32_t         left;       //!< Bytes of the command in progress still to produce
+    uint8_t          copying;    //!< The command in progress is a copy
+    uint8_t          ended;      //!< The digest has been checked, end_status holds the outcome
+    uint8_t          end_status; //!< ABW_DELTA_END or ABW_DELTA_ERR_DIGEST
+    abw_sha256_t     sha256;     //!< Hash of the bytes produced
+} abw_delta_t;
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Read the header of a patch
+ *
+ * \returns ABW_DELTA_OK or ABW_DELTA_ERR_HEADER
+ */
+abw_delta_status_t abw_delta_info(const uint8_t* patch, uint32_t patch_len, abw_delta_info_t* info);
+
+/*!
+ * \brief Attach an applier to a patch and a base in wire order
+ *
+ * \param [out] ctx            Applier context
+ * \param [in]  patch          Patch, must stay readable while applying
+ * \param [in]  patch_len      Length of the patch in bytes
+ * \param [in]  base           Base image, must stay readable while applying
+ * \param [in]  base_len       Length of the base in bytes
+ * \param [in]  max_target_len Largest new image the caller accepts, in bytes
+ *
+ * \returns ABW_DELTA_OK, ABW_DELTA_ERR_HEADER (also for a new image over
+ *          max_target_len) or ABW_DELTA_ERR_BASE (size only, see
+ *          abw_delta_check_base())
+ */
+abw_delta_status_t abw_delta_init(abw_delta_t* ctx, const uint8_t* patch, uint32_t patch_len, const uint8_t* base,
+                                  uint32_t base_len, uint32_t max_target_len);
+
+/*!
+ * \brief Same as abw_delta_init() with a base of host-order words (lr11xx_firmware_image[])
+ */
+abw_delta_status_t abw_delta_init_words(abw_delta_t* ctx, const uint8_t* patch, uint32_t patch_len,
+                                        const uint32_t* base, uint32_t base_words, uint32_t max_target_len);
+
+/*!
+ * \brief Check the CRC-32 of the base against the patch header
+ *
+ * Reads the whole base. Not needed when the base is known by other means,
+ * e.g. LR11XX_FIRMWARE_IMAGE_CRC32 of the resident image.
+ *
+ * \returns ABW_DELTA_OK or ABW_DELTA_ERR_BASE
+ */
+abw_delta_status_t abw_delta_check_base(const abw_delta_t* ctx);
+
+/*!
+ * \brief Header of the attached patch
+ */
+const abw_delta_info_t* abw_delta_get_info(const abw_delta_t* ctx);
+
+/*!
+ * \brief Produce the next bytes of the new image
+ *
+ * \param [in]  ctx      Applier context
+ * \param [out] dst      Output buffer
+ * \param [in]  len      Number of bytes wanted
+ * \param [out] produced Number of bytes written to dst, may be NULL
+ *
+ * \returns ABW_DELTA_OK if len bytes were produced and data remains,
+ *          ABW_DELTA_END once the last byte has been produced and the image
+ *          matches its SHA-256, an error otherwise. On ABW_DELTA_ERR_DIGEST
+ *          the last bytes are in dst but must not be used.
+ */
+abw_delta_status_t abw_delta_read(abw_delta_t* ctx, uint8_t* dst, uint32_t len, uint32_t* produced);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_DELTA_H
@@ -0,0 +1,196 @@
+/*!
+ * \file      gnss_acquisition.cpp
+ *
+ * \brief     GNSS acquisition state machine: T0/T1 timeouts, EHPE target and convergence
+ */
+
+#include "gnss_acquisition.hpp"
+
+namespace gnssacq {
+
+namespace {
+
+uint32_t isqrt(uint64_t v)
+{
+    uint64_t root = 0;
+    for (uint64_t bit = 1ull << 62; bit != 0; bit >>= 2) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+    }
+    return uint32_t(root);
+}
+
+bool same_time(const nmea::utc_time& a, const nmea::utc_time& b)
+{
+    return a.valid && b.valid && (a.hour == b.hour) && (a.minute == b.minute) && (a.second == b.second) &&
+           (a.millisecond == b.millisecond);
+}
+
+}  // namespace
+
+const char* outcome_name(outcome o)
+{
+    switch (o) {
+    case outcome::target:
+        return "target";
+    case outcome::convergence_timeout:
+        return "convergence timeout";
+    case outcome::t0_timeout:
+        return "T0 timeout";
+    case outcome::t1_timeout:
+        return "T1 timeout";
+    case outcome::acquisition_timeout:
+        return "acquisition timeout";
+    default:
+        return "running";
+    }
+}
+
+void acquisition::start(uint32_t now_ms)
+{
+    start_ms_ = now_ms;
+    now_ms_   = now_ms;
+    running_  = true;
+    gst_      = false;
+    pending_  = fix();
+    result_   = gnssacq::result();
+}
+
+bool acquisition::update(uint32_t now_ms)
+{
+    now_ms_ = now_ms;
+    if (!running_ || done()) {
+        return false;
+    }
+    result_.on_ms = now_ms - start_ms_;
+    outcome o     = timeout();
+    if (o != outcome::running) {
+        finish(o);
+    }
+    return !done();
+}
+
+outcome acquisition::timeout() const
+{
+    uint32_t elapsed = now_ms_ - start_ms_;
+
+    if (elapsed >= config_.acquisition_s * 1000) {
+        return outcome::acquisition_timeout;
+    }
+    if (!result_.first.valid) {
+        if ((result_.tracked_ms == 0) && (elapsed >= config_.t0_s * 1000)) {
+            return outcome::t0_timeout;
+        }
+        return (elapsed >= config_.t1_s * 1000) ? outcome::t1_timeout : outcome::running;
+    }
+    return (elapsed - result_.first.at_ms >= config_.convergence_s * 1000) ? outcome::convergence_timeout
+                                                                            : outcome::running;
+}
+
+void acquisition::on_gga(const nmea::gga& g)
+{
+    if (!running_ || done()) {
+        return;
+    }
+    if (pending_.valid) {
+        // No GST for the previous fix: keep its EHPE from HDOP
+        fix f          = pending_;
+        pending_.valid = false;
+        accept(f);
+        if (done()) {
+            return;
+        }
+    }
+    if ((g.quality == 0) || (g.latitude == nmea::no_value) || (g.longitude == nmea::no_value)) {
+        return;
+    }
+    fix f;
+    f.valid       = true;
+    f.latitude    = g.latitude;
+    f.longitude   = g.longitude;
+    f.altitude_cm = (g.altitude == nmea::no_value) ? 0 : g.altitude;
+    f.ehpe_cm     = (g.hdop == nmea::no_value) ? UINT32_MAX : uint32_t(uint64_t(g.hdop) * config_.uere_cm / 100);
+    f.satellites  = g.satellites;
+    f.at_ms       = now_ms_ - start_ms_;
+    if (gst_) {
+        pending_      = f;
+        pending_time_ = g.time;
+    } else {
+        accept(f);
+    }
+}
+
+void acquisition::on_gsv(const nmea::gsv& g)
+{
+    if (!running_ || done() || (result_.tracked_ms != 0)) {
+        return;
+    }
+    for (uint8_t i = 0; i < g.count; i++) {
+        if (g.satellites[i].snr > 0) {
+            result_.tracked_ms = (now_ms_ - start_ms_) | 1;  // Not 0 when tracked at the start
+            return;
+        }
+    }
+}
+
+void acquisition::on_gst(const nmea::gst& g)
+{
+    if (!running_ || done()) {
+        return;
+    }
+    gst_ = true;
+    if (pending_.valid && same_time(g.time, pending_time_) && (g.latitude != nmea::no_value) &&
+        (g.longitude != nmea::no_value)) {
+        fix     f      = pending_;
+        int64_t lat    = g.latitude;
+        int64_t lon    = g.longitude;
+        f.ehpe_cm      = isqrt(uint64_t(lat * lat + lon * lon));
+        pending_.valid = false;
+        accept(f);
+    }
+}
+
+void acquisition::accept(fix f)
+{
+    result_.fixes++;
+    if (!result_.first.valid) {
+        result_.first   = f;
+        result_.ttff_ms = f.at_ms;
+    }
+    if (!result_.best.valid || (f.ehpe_cm < result_.best.ehpe_cm)) {
+        result_.best = f;
+    }
+    if (f.ehpe_cm <= config_.ehpe_target_cm) {
+        finish(outcome::target);
+    } else if (config_.convergence_s == 0) {
+        finish(outcome::convergence_timeout);
+    }
+}
+
+void acquisition::finish(outcome o)
+{
+    if (pending_.valid) {
+        // A fix still waiting for its GST counts, with its EHPE from HDOP
+        fix f          = pending_;
+        pending_.valid = false;
+        accept(f);
+        if (done()) {
+            return;
+        }
+        // It came before T0 or T1: those no longer apply, the convergence may still run
+        if ((o == outcome::t0_timeout) || (o == outcome::t1_timeout)) {
+            o = timeout();
+            if (o == outcome::running) {
+                return;
+            }
+        }
+    }
+    result_.outcome = o;
+    result_.on_ms   = now_ms_ - start_ms_;
+}
+
+}  // namespace gnssacq
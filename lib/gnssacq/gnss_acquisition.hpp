@@ -0,0 +1,105 @@
+/*!
+ * \file      gnss_acquisition.hpp
+ *
+ * \brief     GNSS acquisition state machine: T0/T1 timeouts, EHPE target and convergence
+ *
+ * One acquisition runs from power-on of the receiver until one of:
+ *
+ *   target               A fix with an EHPE under the target ("MT. Acceptable EHPE")
+ *   convergence timeout  No such fix within convergence_s of the first fix,
+ *                        the best fix is kept ("MT. Convergence timeout")
+ *   T0 timeout           No satellite tracked within t0_s, e.g. indoors
+ *   T1 timeout           No fix within t1_s
+ *   acquisition timeout  On for acquisition_s, the best fix if any is kept
+ *
+ * The machine takes the receiver output as an nmea::handler: GSV for the
+ * satellites tracked, GGA for the fixes, and GST for their EHPE when the
+ * receiver sends it. Without GST the EHPE is the HDOP times uere_cm, as
+ * for a fix still waiting for its GST when a timeout stops the machine. The
+ * clock is given to update(), from a timer on the board or from the replay
+ * of a recorded stream on a host. No heap, no exceptions.
+ */
+
+#ifndef GNSS_ACQUISITION_HPP
+#define GNSS_ACQUISITION_HPP
+
+#include <cstdint>
+
+#include "nmea_parser.hpp"
+
+namespace gnssacq {
+
+struct config {
+    uint32_t t0_s           = 20;
+    uint32_t t1_s           = 90;
+    uint32_t acquisition_s  = 180;
+    uint32_t ehpe_target_cm = 1000;
+    uint32_t convergence_s  = 30;  //!< 0 to stop at the first fix
+    uint32_t uere_cm        = 500;  //!< Range error for the EHPE from HDOP
+};
+
+enum class outcome : uint8_t { running, target, convergence_timeout, t0_timeout, t1_timeout, acquisition_timeout };
+
+const char* outcome_name(outcome o);
+
+struct fix {
+    bool     valid       = false;
+    int32_t  latitude    = 0;  //!< 1e-7 degrees
+    int32_t  longitude   = 0;
+    int32_t  altitude_cm = 0;
+    uint32_t ehpe_cm     = 0;
+    uint8_t  satellites  = 0;
+    uint32_t at_ms       = 0;  //!< From the start
+};
+
+struct result {
+    gnssacq::outcome outcome      = outcome::running;
+    uint32_t         tracked_ms   = 0;  //!< First satellite tracked, 0 before
+    uint32_t         ttff_ms      = 0;  //!< 0 before the first fix
+    uint32_t         on_ms        = 0;  //!< Start to the end, or to the last update while running
+    uint32_t         fixes        = 0;
+    fix              first;
+    fix              best;  //!< Lowest EHPE, the fix reported
+};
+
+class acquisition : public nmea::handler {
+public:
+    explicit acquisition(const gnssacq::config& config) : config_(config) {}
+
+    /*!
+     * \brief Receiver powered at now_ms
+     */
+    void start(uint32_t now_ms);
+
+    /*!
+     * \brief Advance the clock, and stop on a timeout
+     *
+     * \returns False once the acquisition is over
+     */
+    bool update(uint32_t now_ms);
+
+    bool                   done() const { return result_.outcome != outcome::running; }
+    const gnssacq::result& result() const { return result_; }
+
+    void on_gga(const nmea::gga& g) override;
+    void on_gsv(const nmea::gsv& g) override;
+    void on_gst(const nmea::gst& g) override;
+
+private:
+    outcome timeout() const;
+    void    accept(fix f);
+    void    finish(outcome o);
+
+    gnssacq::config config_;  // By value, acquisition(config{...}) is allowed
+    uint32_t        start_ms_ = 0;
+    uint32_t        now_ms_   = 0;
+    bool            running_  = false;
+    bool            gst_      = false;  // The receiver sends GST: EHPE from there
+    fix             pending_;           // Last GGA fix, waiting for its GST
+    nmea::utc_time  pending_time_;
+    gnssacq::result result_;
+};
+
+}  // namespace gnssacq
+
+#endif  // GNSS_ACQUISITION_HPP
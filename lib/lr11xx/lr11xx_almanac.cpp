@@ -0,0 +1,229 @@
+/*!
+ * \file      lr11xx_almanac.cpp
+ *
+ * \brief     Packed GPS and BeiDou almanac blob, checked and written to the LR11xx in batches
+ */
+
+#include "lr11xx_almanac.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+}
+
+namespace lr11xx {
+
+namespace almanac {
+
+namespace {
+
+const uint8_t magic[4] = {'A', 'L', 'M', '1'};
+
+void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+uint32_t get32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+uint32_t blob_crc(const uint8_t* blob, size_t entries)
+{
+    return abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, blob, uint32_t(header_size + entries * entry_size)));
+}
+
+void put_entry(uint8_t* p, const entry& e)
+{
+    p[0] = e.sid;
+    p[1] = uint8_t(e.week);
+    p[2] = uint8_t(e.week >> 8);
+    for (unsigned i = 0; i < 8; i++) {
+        p[3 + 3 * i]     = uint8_t(e.words[i]);
+        p[3 + 3 * i + 1] = uint8_t(e.words[i] >> 8);
+        p[3 + 3 * i + 2] = uint8_t(e.words[i] >> 16);
+    }
+}
+
+}  // namespace
+
+const char* status_name(status s)
+{
+    switch (s) {
+    case status::ok:
+        return "ok";
+    case status::too_short:
+        return "too short";
+    case status::bad_magic:
+        return "bad magic";
+    case status::bad_version:
+        return "bad version";
+    case status::too_many:
+        return "too many entries";
+    case status::bad_crc:
+        return "bad CRC";
+    case status::bad_satellite:
+        return "satellite ID out of range";
+    case status::duplicate:
+        return "duplicate satellite";
+    case status::bad_word:
+        return "word over 24 bits";
+    case status::no_space:
+        return "no space";
+    default:
+        return "write failed";
+    }
+}
+
+status check_entry(const entry& e)
+{
+    if (e.sid == 0 || e.sid > satellites(e.constellation)) {
+        return status::bad_satellite;
+    }
+    for (uint32_t w : e.words) {
+        if (w > word_mask) {
+            return status::bad_word;
+        }
+    }
+    return status::ok;
+}
+
+status encode(const entry* entries, size_t count, uint8_t* out, size_t out_size, size_t& len)
+{
+    uint64_t seen[2]   = {0, 0};
+    uint8_t  counts[2] = {0, 0};
+
+    len = 0;
+    for (size_t i = 0; i < count; i++) {
+        status s = check_entry(entries[i]);
+        if (s != status::ok) {
+            return s;
+        }
+        unsigned c   = unsigned(entries[i].constellation);
+        uint64_t bit = 1ull << (entries[i].sid - 1);
+        if (seen[c] & bit) {
+            return status::duplicate;
+        }
+        seen[c] |= bit;
+        counts[c]++;
+    }
+    if (out_size < encoded_size(count)) {
+        return status::no_space;
+    }
+
+    out[0] = magic[0];
+    out[1] = magic[1];
+    out[2] = magic[2];
+    out[3] = magic[3];
+    out[4] = version;
+    out[5] = counts[0];
+    out[6] = counts[1];
+    out[7] = 0;
+    // GPS then BeiDou, in satellite order: the same almanac always gives the same blob
+    uint8_t* p = out + header_size;
+    for (unsigned c = 0; c < 2; c++) {
+        for (uint8_t sid = 1; sid <= satellites(constellation(c)); sid++) {
+            for (size_t i = 0; (seen[c] >> (sid - 1)) & 1 && i < count; i++) {
+                if (unsigned(entries[i].constellation) == c && entries[i].sid == sid) {
+                    put_entry(p, entries[i]);
+                    p += entry_size;
+                    break;
+                }
+            }
+        }
+    }
+    put32(p, blob_crc(out, count));
+    len = encoded_size(count);
+    return status::ok;
+}
+
+status check(const uint8_t* blob, size_t len, uint32_t& gps, uint32_t& beidou)
+{
+    gps    = 0;
+    beidou = 0;
+    if (len < header_size) {
+        return status::too_short;
+    }
+    if (blob[0] != magic[0] || blob[1] != magic[1] || blob[2] != magic[2] || blob[3] != magic[3]) {
+        return status::bad_magic;
+    }
+    if (blob[4] != version) {
+        return status::bad_version;
+    }
+    if (blob[5] > gps_satellites || blob[6] > beidou_satellites) {
+        return status::too_many;
+    }
+    size_t count = size_t(blob[5]) + blob[6];
+    if (len < encoded_size(count)) {
+        return status::too_short;
+    }
+    if (get32(blob + header_size + count * entry_size) != blob_crc(blob, count)) {
+        return status::bad_crc;
+    }
+
+    uint64_t seen[2] = {0, 0};
+    for (size_t i = 0; i < count; i++) {
+        entry e = read_entry(blob, i);
+        if (check_entry(e) != status::ok) {
+            return status::bad_satellite;
+        }
+        unsigned c   = unsigned(e.constellation);
+        uint64_t bit = 1ull << (e.sid - 1);
+        if (seen[c] & bit) {
+            return status::duplicate;
+        }
+        seen[c] |= bit;
+    }
+    gps    = blob[5];
+    beidou = blob[6];
+    return status::ok;
+}
+
+entry read_entry(const uint8_t* blob, size_t index)
+{
+    const uint8_t* p = blob + header_size + index * entry_size;
+    entry          e;
+
+    e.constellation = index < blob[5] ? constellation::gps : constellation::beidou;
+    e.sid           = p[0];
+    e.week          = uint16_t(p[1] | (p[2] << 8));
+    for (unsigned i = 0; i < 8; i++) {
+        e.words[i] = uint32_t(p[3 + 3 * i]) | (uint32_t(p[3 + 3 * i + 1]) << 8) | (uint32_t(p[3 + 3 * i + 2]) << 16);
+    }
+    return e;
+}
+
+}  // namespace almanac
+
+almanac::status write_almanac(const uint8_t* blob, size_t len, almanac_port& port, size_t batch, uint32_t& writes)
+{
+    uint32_t        gps;
+    uint32_t        beidou;
+    almanac::status s = almanac::check(blob, len, gps, beidou);
+
+    writes = 0;
+    if (s != almanac::status::ok) {
+        return s;
+    }
+    batch = batch == 0 || batch > almanac::max_batch ? almanac::max_batch : batch;
+
+    almanac::entry entries[almanac::max_batch];
+    size_t         pending = 0;
+    for (size_t i = 0, count = size_t(gps) + beidou; i < count; i++) {
+        entries[pending++] = almanac::read_entry(blob, i);
+        // A batch ends when full, at the last entry and at the change of constellation
+        if (pending == batch || i + 1 == count || i + 1 == gps) {
+            if (!port.write(entries, pending)) {
+                return almanac::status::write_failed;
+            }
+            writes++;
+            pending = 0;
+        }
+    }
+    return almanac::status::ok;
+}
+
+}  // namespace lr11xx
@@ -0,0 +1,132 @@
+/*!
+ * \file      lr11xx_almanac.hpp
+ *
+ * \brief     Packed GPS and BeiDou almanac blob, checked and written to the LR11xx in batches
+ *
+ * The MFG CLI takes the almanac one satellite per line ("gnss almanac set
+ * sid,week,word0,..word7"), GPS only. The blob carries the whole almanac of
+ * both constellations in one transfer instead:
+ *
+ *   header   "ALM1", version, GPS count, BeiDou count, 0    8 bytes
+ *   entries  GPS first, by satellite ID                      27 bytes each
+ *              satellite ID, week (LE16), 8 words (LE24)
+ *   CRC-32   of the header and entries (lib/crc)             4 bytes
+ *
+ * The length follows from the header, so padding after the CRC (XMODEM
+ * fills its last block with 0x1A) is ignored. A blob is checked as a whole
+ * before any entry goes to the LR11xx: satellite IDs in range (GPS 1-32,
+ * BeiDou 1-63), no satellite twice, words of 24 bits and the CRC.
+ *
+ * The entries are then handed to an almanac_port in batches of up to
+ * max_batch, one LR11xx command each instead of one per satellite. The
+ * conversion to the LR11xx almanac format is left to the port. No heap, no
+ * exceptions.
+ */
+
+#ifndef LR11XX_ALMANAC_HPP
+#define LR11XX_ALMANAC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lr11xx {
+
+namespace almanac {
+
+constexpr uint8_t  version           = 1;
+constexpr uint8_t  gps_satellites    = 32;
+constexpr uint8_t  beidou_satellites = 63;
+constexpr size_t   header_size       = 8;
+constexpr size_t   entry_size        = 27;
+constexpr size_t   max_entries       = gps_satellites + beidou_satellites;
+constexpr size_t   max_size          = header_size + max_entries * entry_size + 4;
+constexpr size_t   max_batch         = 12;  //!< Entries per LR11xx command, within its 256-byte buffer
+constexpr uint32_t word_mask         = 0xFFFFFF;
+
+enum class constellation : uint8_t { gps, beidou };
+
+struct entry {
+    almanac::constellation constellation = constellation::gps;
+    uint8_t                sid           = 0;  //!< Satellite ID, from 1
+    uint16_t               week          = 0;
+    uint32_t               words[8]      = {};  //!< 24-bit words
+};
+
+enum class status : uint8_t {
+    ok,
+    too_short,      //!< Shorter than its header says
+    bad_magic,
+    bad_version,
+    too_many,       //!< More entries than satellites
+    bad_crc,
+    bad_satellite,  //!< Satellite ID out of range
+    duplicate,      //!< Same satellite twice
+    bad_word,       //!< Word over 24 bits
+    no_space,       //!< Output buffer too small
+    write_failed,   //!< The port refused a batch
+};
+
+const char* status_name(status s);
+
+/*!
+ * \brief Highest satellite ID of a constellation
+ */
+inline uint8_t satellites(constellation c)
+{
+    return c == constellation::gps ? gps_satellites : beidou_satellites;
+}
+
+inline size_t encoded_size(size_t entries)
+{
+    return header_size + entries * entry_size + 4;
+}
+
+/*!
+ * \brief Satellite ID range and word width of one entry
+ */
+status check_entry(const entry& e);
+
+/*!
+ * \brief Pack entries into a blob, GPS first, each constellation in satellite order
+ *
+ * \param [out] len Bytes written, encoded_size(count)
+ */
+status encode(const entry* entries, size_t count, uint8_t* out, size_t out_size, size_t& len);
+
+/*!
+ * \brief Check a received blob; len may include padding after the CRC
+ */
+status check(const uint8_t* blob, size_t len, uint32_t& gps, uint32_t& beidou);
+
+/*!
+ * \brief Entry index of a checked blob
+ */
+entry read_entry(const uint8_t* blob, size_t index);
+
+}  // namespace almanac
+
+/*!
+ * \brief Almanac writes to the LR11xx
+ */
+class almanac_port {
+public:
+    virtual ~almanac_port() = default;
+
+    /*!
+     * \brief Write count entries of one constellation in one LR11xx command
+     */
+    virtual bool write(const almanac::entry* entries, size_t count) = 0;
+};
+
+/*!
+ * \brief Check a blob, then write its entries in batches of up to batch (at most almanac::max_batch)
+ *
+ * A batch holds entries of a single constellation.
+ *
+ * \param [out] writes Batches written
+ */
+almanac::status write_almanac(const uint8_t* blob, size_t len, almanac_port& port, size_t batch, uint32_t& writes);
+
+}  // namespace lr11xx
+
+#endif  // LR11XX_ALMANAC_HPP
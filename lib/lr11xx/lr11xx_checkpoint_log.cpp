@@ -0,0 +1,153 @@
+/*!
+ * \file      lr11xx_checkpoint_log.cpp
+ *
+ * \brief     Checkpoint store of the LR11xx update engine as a record log in a flash area
+ */
+
+#include "lr11xx_checkpoint_log.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+}
+
+namespace lr11xx {
+
+namespace {
+
+// Record layout, little-endian words:
+//   magic, sequence, image words, version, image CRC, next chunk, running CRC, CRC-32 of the first 28 bytes
+void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+uint32_t get32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+uint32_t record_crc(const uint8_t* record)
+{
+    return abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, record, checkpoint_log::record_size - 4));
+}
+
+}  // namespace
+
+checkpoint_log::slot_state checkpoint_log::read_slot(uint32_t slot, update_checkpoint& checkpoint,
+                                                     uint32_t& sequence)
+{
+    uint8_t record[record_size];
+    bool    erased = true;
+
+    if (!area_.read(slot * record_size, record, record_size)) {
+        return slot_state::invalid;
+    }
+    for (uint32_t i = 0; i < record_size; i++) {
+        erased = erased && (record[i] == 0xFF);
+    }
+    if (erased) {
+        return slot_state::erased;
+    }
+    if ((get32(record) != magic) || (get32(record + 28) != record_crc(record))) {
+        return slot_state::invalid;  // Torn by a power loss
+    }
+    sequence               = get32(record + 4);
+    checkpoint.image_words = get32(record + 8);
+    checkpoint.version     = uint16_t(get32(record + 12));
+    checkpoint.image_crc   = get32(record + 16);
+    checkpoint.next_chunk  = get32(record + 20);
+    checkpoint.crc         = get32(record + 24);
+    return slot_state::valid;
+}
+
+void checkpoint_log::scan()
+{
+    const uint32_t slots = area_.size() / record_size;
+
+    valid_    = false;
+    sequence_ = 0;
+    for (next_ = 0; next_ < slots; next_++) {
+        update_checkpoint checkpoint;
+        uint32_t          sequence = 0;
+        slot_state        state    = read_slot(next_, checkpoint, sequence);
+
+        // Records are only appended: the first erased slot ends the log
+        if (state == slot_state::erased) {
+            break;
+        }
+        if ((state == slot_state::valid) && (!valid_ || (sequence > sequence_))) {
+            valid_    = true;
+            sequence_ = sequence;
+            last_     = checkpoint;
+        }
+    }
+    scanned_ = true;
+}
+
+bool checkpoint_log::load(update_checkpoint& checkpoint)
+{
+    if (!scanned_) {
+        scan();
+    }
+    if (valid_) {
+        checkpoint = last_;
+    }
+    return valid_;
+}
+
+bool checkpoint_log::save(const update_checkpoint& checkpoint)
+{
+    uint8_t record[record_size];
+
+    if (!scanned_) {
+        scan();
+    }
+    if (next_ >= (area_.size() / record_size)) {
+        if (!area_.erase()) {
+            scanned_ = false;
+            return false;
+        }
+        next_ = 0;
+    }
+
+    put32(record, magic);
+    put32(record + 4, sequence_ + 1);
+    put32(record + 8, checkpoint.image_words);
+    put32(record + 12, checkpoint.version);
+    put32(record + 16, checkpoint.image_crc);
+    put32(record + 20, checkpoint.next_chunk);
+    put32(record + 24, checkpoint.crc);
+    put32(record + 28, record_crc(record));
+
+    // A failed program still uses the slot, it cannot be programmed again
+    bool ok = area_.program(next_ * record_size, record, record_size);
+    next_++;
+    if (ok) {
+        sequence_++;
+        valid_ = true;
+        last_  = checkpoint;
+    }
+    return ok;
+}
+
+bool checkpoint_log::clear()
+{
+    if (!scanned_) {
+        scan();
+    }
+    if (next_ == 0) {
+        return true;  // Already erased
+    }
+    valid_ = false;
+    next_  = 0;
+    if (!area_.erase()) {
+        scanned_ = false;  // Partly erased: read it again
+        return false;
+    }
+    return true;
+}
+
+}  // namespace lr11xx
@@ -0,0 +1,79 @@
+/*!
+ * \file      lr11xx_checkpoint_log.hpp
+ *
+ * \brief     Checkpoint store of the LR11xx update engine as a record log in a flash area
+ *
+ * Checkpoints are appended as 32-byte records to an erased area, e.g. the
+ * part of the user-config page set aside for them, so that a save is a
+ * single program operation. The area is only erased when it is full or
+ * when the checkpoint is cleared. Each record carries a sequence number and
+ * its own CRC-32: a record torn by a power loss is ignored and the previous
+ * one is used.
+ *
+ * With the default 16 chunks between checkpoints, an LR1110 update saves 59
+ * checkpoints: a 4 KiB area (128 records) holds them all and is erased
+ * once per update, when the checkpoint is cleared.
+ */
+
+#ifndef LR11XX_CHECKPOINT_LOG_HPP
+#define LR11XX_CHECKPOINT_LOG_HPP
+
+#include <cstdint>
+
+#include "lr11xx_update_engine.hpp"
+
+namespace lr11xx {
+
+/*!
+ * \brief Flash area holding the log
+ */
+class flash_area {
+public:
+    virtual ~flash_area() = default;
+
+    /*!
+     * \brief Size of the area in bytes, a multiple of 32
+     */
+    virtual uint32_t size() = 0;
+
+    virtual bool read(uint32_t offset, uint8_t* dst, uint32_t len) = 0;
+
+    /*!
+     * \brief Program erased bytes, offset and len are multiples of 8 (STM32WB double words)
+     */
+    virtual bool program(uint32_t offset, const uint8_t* src, uint32_t len) = 0;
+
+    /*!
+     * \brief Erase the whole area to 0xFF
+     */
+    virtual bool erase() = 0;
+};
+
+class checkpoint_log : public checkpoint_store {
+public:
+    static constexpr uint32_t record_size = 32;
+    static constexpr uint32_t magic       = 0x4C524350;  //!< "LRCP"
+
+    explicit checkpoint_log(flash_area& area) : area_(area) {}
+
+    bool load(update_checkpoint& checkpoint) override;
+    bool save(const update_checkpoint& checkpoint) override;
+    bool clear() override;
+
+private:
+    enum class slot_state { erased, valid, invalid };
+
+    slot_state read_slot(uint32_t slot, update_checkpoint& checkpoint, uint32_t& sequence);
+    void       scan();
+
+    flash_area&       area_;
+    bool              scanned_  = false;
+    uint32_t          next_     = 0;  // First slot never programmed
+    uint32_t          sequence_ = 0;  // Sequence number of the last valid record
+    bool              valid_    = false;
+    update_checkpoint last_;
+};
+
+}  // namespace lr11xx
+
+#endif  // LR11XX_CHECKPOINT_LOG_HPP
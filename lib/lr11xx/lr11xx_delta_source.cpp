@@ -0,0 +1,82 @@
+/*!
+ * \file      lr11xx_delta_source.cpp
+ *
+ * \brief     Update engine source rebuilding the new LR11xx image from the resident one and a patch
+ */
+
+#include "lr11xx_delta_source.hpp"
+
+namespace lr11xx {
+
+delta_source::delta_source(const uint8_t* patch, uint32_t patch_len, const uint32_t* base, uint32_t base_words,
+                           uint32_t max_words)
+    : patch_(patch), patch_len_(patch_len), base_(base), base_words_(base_words), max_words_(max_words)
+{
+    status_ = restart();
+    if (status_ == ABW_DELTA_OK) {
+        status_ = abw_delta_check_base(&ctx_);
+    }
+
+    // Dry run: every command and the SHA-256 are checked before a word goes to the LR11xx
+    while (status_ == ABW_DELTA_OK) {
+        status_ = abw_delta_read(&ctx_, chunk_, sizeof(chunk_), nullptr);
+    }
+    if (status_ == ABW_DELTA_END) {
+        status_ = restart();
+    }
+}
+
+abw_delta_status_t delta_source::restart()
+{
+    uint32_t max_len = max_words_ > UINT32_MAX / 4 ? UINT32_MAX : max_words_ * 4;
+
+    return abw_delta_init_words(&ctx_, patch_, patch_len_, base_, base_words_, max_len);
+}
+
+const uint8_t* delta_source::wire_chunk(uint32_t offset, uint32_t count)
+{
+    const uint64_t at = uint64_t(offset) * 4;
+    uint32_t       produced;
+
+    if ((status_ != ABW_DELTA_OK) || (count > bootloader::chunk_words) ||
+        ((uint64_t(offset) + count) * 4 > ctx_.info.target_len)) {
+        return nullptr;
+    }
+
+    // Only forward: restart from the beginning to go back
+    if (at < ctx_.out_pos) {
+        status_ = restart();
+    }
+    while ((status_ == ABW_DELTA_OK) && (ctx_.out_pos < at)) {
+        uint32_t skip = uint32_t(at - ctx_.out_pos);
+        status_       = abw_delta_read(&ctx_, chunk_, skip < sizeof(chunk_) ? skip : sizeof(chunk_), nullptr);
+    }
+    if (status_ != ABW_DELTA_OK) {
+        return nullptr;
+    }
+
+    status_ = abw_delta_read(&ctx_, chunk_, count * 4, &produced);
+    if ((produced != count * 4) || ((status_ != ABW_DELTA_OK) && (status_ != ABW_DELTA_END))) {
+        return nullptr;
+    }
+    if (status_ == ABW_DELTA_END) {
+        status_ = ABW_DELTA_OK;  // Allow going back, e.g. for a resumed update
+    }
+    return chunk_;
+}
+
+bool delta_source::read_words(uint32_t offset, uint32_t* dst, uint32_t count)
+{
+    const uint8_t* bytes = wire_chunk(offset, count);
+
+    if (bytes == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* b = bytes + i * 4;
+        dst[i]           = uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3];
+    }
+    return true;
+}
+
+}  // namespace lr11xx
@@ -0,0 +1,76 @@
+/*!
+ * \file      lr11xx_delta_source.hpp
+ *
+ * \brief     Update engine source rebuilding the new LR11xx image from the resident one and a patch
+ *
+ * The chunks come out of lib/delta/abw_delta.c in wire order and are sent
+ * from a single chunk buffer. The applier only moves forward: a chunk
+ * before the current position (a resumed update) restarts it from the
+ * beginning of the patch, discarding what comes before the chunk.
+ *
+ * The constructor checks the CRC-32 of the resident image against the
+ * patch, then decodes the whole patch once and hashes the image it
+ * rebuilds. A patch made for another base or a corrupt one is refused there
+ * (status()), before the engine erases the LR11xx. The dry run costs one
+ * more pass of the applier. The last chunk is still only handed out if the
+ * rebuilt image matches the SHA-256 of the patch.
+ */
+
+#ifndef LR11XX_DELTA_SOURCE_HPP
+#define LR11XX_DELTA_SOURCE_HPP
+
+#include <cstdint>
+
+#include "lr11xx_update_engine.hpp"
+
+extern "C" {
+#include "abw_delta.h"
+}
+
+namespace lr11xx {
+
+class delta_source : public image_source {
+public:
+    /*!
+     * \param [in] patch      Patch, readable during the update
+     * \param [in] patch_len  Length of the patch in bytes
+     * \param [in] base       Resident image, host-order words (lr11xx_firmware_image)
+     * \param [in] base_words Size of the resident image
+     * \param [in] max_words  Largest new image accepted, a patch for a larger one is refused
+     */
+    delta_source(const uint8_t* patch, uint32_t patch_len, const uint32_t* base, uint32_t base_words,
+                 uint32_t max_words);
+
+    /*!
+     * \brief ABW_DELTA_OK if the patch applies to the base, the last applier status otherwise
+     *
+     * Check it before the update: the engine erases the LR11xx first.
+     */
+    abw_delta_status_t status() const { return status_; }
+
+    /*!
+     * \brief Words of the new image, 0 if the patch is not usable
+     */
+    uint32_t words() const { return status_ == ABW_DELTA_ERR_HEADER ? 0 : ctx_.info.target_len / 4; }
+
+    const abw_delta_info_t& info() const { return ctx_.info; }
+
+    bool           read_words(uint32_t offset, uint32_t* dst, uint32_t count) override;
+    const uint8_t* wire_chunk(uint32_t offset, uint32_t count) override;
+
+private:
+    abw_delta_status_t restart();
+
+    const uint8_t*     patch_;
+    uint32_t           patch_len_;
+    const uint32_t*    base_;
+    uint32_t           base_words_;
+    uint32_t           max_words_;
+    abw_delta_t        ctx_;
+    abw_delta_status_t status_;
+    uint8_t            chunk_[bootloader::chunk_words * 4];
+};
+
+}  // namespace lr11xx
+
+#endif  // LR11XX_DELTA_SOURCE_HPP
@@ -0,0 +1,63 @@
+/*!
+ * \file      lr11xx_fw_check.hpp
+ *
+ * \brief     Compile-time consistency checks of an LR11xx firmware image header
+ *
+ * Include it after the image header, either lr1110_transceiver_0308.h or
+ * the split lr1110_transceiver_0308_image.h, in one C++ translation unit of
+ * the application. It fails the build if the array does not hold exactly
+ * LR11XX_FIRMWARE_IMAGE_SIZE words or if the integrity metadata is
+ * malformed.
+ *
+ * The metadata itself is checked at run time, in the same pass that streams
+ * the image to the radio, with abw_crc32_update_words() against
+ * LR11XX_FIRMWARE_IMAGE_CRC32 (see abw_crc32.h).
+ */
+
+#ifndef LR11XX_FW_CHECK_HPP
+#define LR11XX_FW_CHECK_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(LR11XX_FIRMWARE_VERSION) || !defined(LR11XX_FIRMWARE_IMAGE_SIZE)
+#error "include the LR11xx firmware image header before lr11xx_fw_check.hpp"
+#endif
+
+namespace lr11xx_fw_check {
+
+/*!
+ * \brief Number of 32-bit words held by an image array, whatever its element type
+ */
+template <typename T, std::size_t N>
+constexpr std::size_t image_words(const T (&)[N])
+{
+    return (N * sizeof(T)) / sizeof(uint32_t);
+}
+
+#ifdef LR11XX_FIRMWARE_IMAGE_SHA256
+/*!
+ * \brief SHA-256 of the image, as a constant array
+ */
+constexpr uint8_t image_sha256[] = {LR11XX_FIRMWARE_IMAGE_SHA256};
+
+static_assert(sizeof(image_sha256) == 32, "LR11XX_FIRMWARE_IMAGE_SHA256 must hold 32 bytes");
+#endif
+
+#ifdef LR11XX_FIRMWARE_IMAGE_CRC32
+/*!
+ * \brief CRC-32 of the image
+ */
+constexpr uint32_t image_crc32 = LR11XX_FIRMWARE_IMAGE_CRC32;
+#endif
+
+}  // namespace lr11xx_fw_check
+
+static_assert(lr11xx_fw_check::image_words(lr11xx_firmware_image) == LR11XX_FIRMWARE_IMAGE_SIZE,
+              "lr11xx_firmware_image does not hold LR11XX_FIRMWARE_IMAGE_SIZE words");
+static_assert(sizeof(lr11xx_firmware_image) % sizeof(uint32_t) == 0,
+              "lr11xx_firmware_image is not a whole number of words");
+static_assert((LR11XX_FIRMWARE_VERSION > 0) && (LR11XX_FIRMWARE_VERSION <= 0xFFFF),
+              "LR11XX_FIRMWARE_VERSION is a 16-bit version");
+
+#endif  // LR11XX_FW_CHECK_HPP
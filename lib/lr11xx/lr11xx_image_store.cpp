@@ -0,0 +1,260 @@
+/*!
+ * \file      lr11xx_image_store.cpp
+ *
+ * \brief     LR11xx images staged in an external W25Q flash and streamed to the update engine
+ */
+
+#include "lr11xx_image_store.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+}
+
+namespace lr11xx {
+
+namespace {
+
+constexpr uint32_t header_bytes = 32;
+
+// Header layout, little-endian words:
+//   magic, sequence, image words, version | update_to << 16, image CRC, 0xFFFFFFFF x2, CRC-32 of the first 28 bytes
+void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+uint32_t get32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+uint32_t header_crc(const uint8_t* header)
+{
+    return abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, header, header_bytes - 4));
+}
+
+}  // namespace
+
+bool image_store::image(uint32_t slot, stored_image& image)
+{
+    uint8_t header[header_bytes];
+
+    if ((slot >= slots()) || !flash_.read(slot * slot_size, header, sizeof(header))) {
+        return false;
+    }
+    if ((get32(header) != magic) || (get32(header + 28) != header_crc(header)) ||
+        (get32(header + 8) > max_words)) {
+        return false;
+    }
+    image.slot      = slot;
+    image.sequence  = get32(header + 4);
+    image.words     = get32(header + 8);
+    image.version   = uint16_t(get32(header + 12));
+    image.update_to = uint8_t(get32(header + 12) >> 16);
+    image.crc       = get32(header + 16);
+    return true;
+}
+
+bool image_store::latest(uint8_t update_to, stored_image& image, stored_image* previous)
+{
+    bool found    = false;
+    bool has_prev = false;
+
+    for (uint32_t slot = 0; slot < slots(); slot++) {
+        stored_image candidate;
+        if (!this->image(slot, candidate) || (candidate.update_to != update_to)) {
+            continue;
+        }
+        if (!found || (candidate.sequence > image.sequence)) {
+            if (found && previous) {
+                *previous = image;
+                has_prev  = true;
+            }
+            image = candidate;
+            found = true;
+        } else if (previous && (!has_prev || (candidate.sequence > previous->sequence))) {
+            *previous = candidate;
+            has_prev  = true;
+        }
+    }
+    if (previous && !has_prev) {
+        *previous = stored_image();
+    }
+    return found;
+}
+
+bool image_store::find(uint8_t update_to, uint16_t version, stored_image& image)
+{
+    bool found = false;
+
+    for (uint32_t slot = 0; slot < slots(); slot++) {
+        stored_image candidate;
+        if (this->image(slot, candidate) && (candidate.update_to == update_to) && (candidate.version == version) &&
+            (!found || (candidate.sequence > image.sequence))) {
+            image = candidate;
+            found = true;
+        }
+    }
+    return found;
+}
+
+uint32_t image_store::staging_slot(uint8_t update_to)
+{
+    uint32_t own            = slots();  // Oldest image of update_to
+    uint32_t superseded     = slots();  // Oldest image of another target that has a newer one
+    uint32_t own_seq        = 0;
+    uint32_t superseded_seq = 0;
+    uint32_t own_images     = 0;
+
+    for (uint32_t slot = 0; slot < slots(); slot++) {
+        stored_image candidate;
+        if (!image(slot, candidate)) {
+            return slot;
+        }
+        if (candidate.update_to == update_to) {
+            own_images++;
+            if ((own == slots()) || (candidate.sequence < own_seq)) {
+                own     = slot;
+                own_seq = candidate.sequence;
+            }
+            continue;
+        }
+        stored_image newest;
+        if (latest(candidate.update_to, newest) && (newest.slot != slot) &&
+            ((superseded == slots()) || (candidate.sequence < superseded_seq))) {
+            superseded     = slot;
+            superseded_seq = candidate.sequence;
+        }
+    }
+    // The only image of update_to goes last: it is the rollback while the new one is staged
+    if ((own_images > 1) || (superseded == slots())) {
+        return own;
+    }
+    return superseded;
+}
+
+bool image_store::begin(uint32_t slot)
+{
+    if (slot >= slots()) {
+        return false;
+    }
+    // The first block holds the header: the slot is free from the first erase on
+    for (uint32_t block = 0; block < slot_size / w25q::block_size; block++) {
+        if (!flash_.erase_block(slot * slot_size + block * w25q::block_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool image_store::write(uint32_t slot, uint32_t offset, const uint8_t* wire, uint32_t len)
+{
+    if ((slot >= slots()) || ((uint64_t(offset) + len) > max_words * 4)) {
+        return false;
+    }
+    return flash_.program(image_address(slot) + offset, wire, len);
+}
+
+bool image_store::commit(uint32_t slot, uint32_t words, uint16_t version, uint8_t update_to, uint32_t crc)
+{
+    uint8_t  buffer[256];
+    uint32_t running  = ABW_CRC32_INIT;
+    uint32_t sequence = 0;
+
+    if ((slot >= slots()) || (words > max_words)) {
+        return false;
+    }
+    for (uint32_t at = 0; at < words * 4; at += sizeof(buffer)) {
+        uint32_t len = words * 4 - at;
+        if (len > sizeof(buffer)) {
+            len = sizeof(buffer);
+        }
+        if (!flash_.read(image_address(slot) + at, buffer, len)) {
+            return false;
+        }
+        running = abw_crc32_update(running, buffer, len);
+    }
+    if (abw_crc32_final(running) != crc) {
+        return false;
+    }
+
+    for (uint32_t other = 0; other < slots(); other++) {
+        stored_image candidate;
+        if ((other != slot) && image(other, candidate) && (candidate.sequence > sequence)) {
+            sequence = candidate.sequence;
+        }
+    }
+
+    put32(buffer, magic);
+    put32(buffer + 4, sequence + 1);
+    put32(buffer + 8, words);
+    put32(buffer + 12, uint32_t(version) | (uint32_t(update_to) << 16));
+    put32(buffer + 16, crc);
+    put32(buffer + 20, 0xFFFFFFFF);
+    put32(buffer + 24, 0xFFFFFFFF);
+    put32(buffer + 28, header_crc(buffer));
+    return flash_.program(slot * slot_size, buffer, header_bytes);
+}
+
+bool image_store::erase(uint32_t slot)
+{
+    return (slot < slots()) && flash_.erase_sector(slot * slot_size);
+}
+
+bool store_source::settle()
+{
+    if (!pending_) {
+        return true;
+    }
+    pending_ = false;
+    return flash_.read_wait();
+}
+
+bool store_source::read_words(uint32_t offset, uint32_t* dst, uint32_t count)
+{
+    uint8_t* bytes = buffers_[ahead_];
+
+    if (!settle() || ((offset + count) > words_) || (count > bootloader::chunk_words) ||
+        !flash_.read(address_ + offset * 4, bytes, count * 4)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* b = bytes + i * 4;
+        dst[i]           = uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3];
+    }
+    return true;
+}
+
+const uint8_t* store_source::wire_chunk(uint32_t offset, uint32_t count)
+{
+    if (((offset + count) > words_) || (count > bootloader::chunk_words)) {
+        return nullptr;
+    }
+
+    // The chunk was read ahead, or is read now
+    bool hit = pending_ && (ahead_offset_ == offset) && (ahead_count_ == count);
+    if (!settle()) {
+        return nullptr;
+    }
+    uint8_t* chunk = buffers_[ahead_];
+    if (!hit && !flash_.read(address_ + offset * 4, chunk, count * 4)) {
+        return nullptr;
+    }
+
+    // The engine is done with the other buffer: fetch the next chunk into it
+    ahead_ ^= 1;
+    if (read_ahead_ && ((offset + count) < words_)) {
+        ahead_offset_ = offset + count;
+        ahead_count_  = words_ - ahead_offset_;
+        if (ahead_count_ > bootloader::chunk_words) {
+            ahead_count_ = bootloader::chunk_words;
+        }
+        pending_ = flash_.read_start(address_ + ahead_offset_ * 4, buffers_[ahead_], ahead_count_ * 4);
+    }
+    return chunk;
+}
+
+}  // namespace lr11xx
@@ -0,0 +1,142 @@
+/*!
+ * \file      lr11xx_image_store.hpp
+ *
+ * \brief     LR11xx images staged in an external W25Q flash and streamed to the update engine
+ *
+ * The W25Q16JL of the EVB is split in 256 KiB slots, eight on 2 MiB. A
+ * slot holds one image in wire order (the bytes of the .bin) after a 4 KiB
+ * header sector. The header carries the image identity of the generated
+ * image header: LR11XX_FIRMWARE_VERSION, LR11XX_FIRMWARE_UPDATE_TO, the size
+ * and the CRC-32, plus a sequence number that orders the images.
+ *
+ * Staging erases the slot, which invalidates its header first, programs the
+ * image, reads it back against the CRC and only then programs the header.
+ * A slot cut during staging has no valid header and is simply free. When
+ * no slot is free, staging takes the oldest image of the same target if it
+ * has another one, else a superseded image of another target, so the
+ * previous image stays available for a rollback. The only image of the
+ * target itself is taken last, and never the only image of another target.
+ *
+ * store_source streams a stored image to the update engine. It reads one
+ * chunk ahead: while the LR11xx takes chunk N, chunk N+1 is already on its
+ * way from the W25Q, so the application no longer links
+ * lr11xx_firmware_image into the internal flash.
+ */
+
+#ifndef LR11XX_IMAGE_STORE_HPP
+#define LR11XX_IMAGE_STORE_HPP
+
+#include <cstdint>
+
+#include "lr11xx_update_engine.hpp"
+#include "w25q_flash.hpp"
+
+namespace lr11xx {
+
+/*!
+ * \brief Header of a stored image
+ */
+struct stored_image {
+    uint32_t slot      = 0;
+    uint32_t sequence  = 0;  //!< Higher is more recent
+    uint32_t words     = 0;  //!< LR11XX_FIRMWARE_IMAGE_SIZE
+    uint16_t version   = 0;  //!< LR11XX_FIRMWARE_VERSION
+    uint8_t  update_to = 0;  //!< LR11XX_FIRMWARE_UPDATE_TO (lr11xx_fw_update_t)
+    uint32_t crc       = 0;  //!< LR11XX_FIRMWARE_IMAGE_CRC32, over the wire-order bytes
+};
+
+class image_store {
+public:
+    static constexpr uint32_t slot_size   = 256 * 1024;
+    static constexpr uint32_t header_size = w25q::sector_size;
+    static constexpr uint32_t max_words   = (slot_size - header_size) / 4;
+    static constexpr uint32_t magic       = 0x4C524953;  //!< "LRIS"
+
+    explicit image_store(w25q::flash& flash) : flash_(flash) {}
+
+    uint32_t slots() const { return flash_.size() / slot_size; }
+
+    /*!
+     * \brief Header of a slot, false if the slot holds no complete image
+     */
+    bool image(uint32_t slot, stored_image& image);
+
+    /*!
+     * \brief Most recent image for a target, and optionally the one before it
+     */
+    bool latest(uint8_t update_to, stored_image& image, stored_image* previous = nullptr);
+
+    bool find(uint8_t update_to, uint16_t version, stored_image& image);
+
+    /*!
+     * \brief Slot to stage the next image of a target in
+     *
+     * A free slot, else the oldest image of the same target if it keeps
+     * another one, else the oldest image of another target that has a newer
+     * image in another slot, else the only image of the same target. The
+     * only image of another target is never taken.
+     *
+     * \returns slots() when no slot can be taken
+     */
+    uint32_t staging_slot(uint8_t update_to);
+
+    /*!
+     * \brief Erase a slot before staging, its header first
+     */
+    bool begin(uint32_t slot);
+
+    /*!
+     * \brief Program wire-order image bytes at a byte offset of the image
+     */
+    bool write(uint32_t slot, uint32_t offset, const uint8_t* wire, uint32_t len);
+
+    /*!
+     * \brief Check the staged bytes against crc, then write the header
+     *
+     * \returns False if the image does not read back with this CRC; the slot
+     *          then stays free
+     */
+    bool commit(uint32_t slot, uint32_t words, uint16_t version, uint8_t update_to, uint32_t crc);
+
+    /*!
+     * \brief Drop the image of a slot
+     */
+    bool erase(uint32_t slot);
+
+private:
+    uint32_t image_address(uint32_t slot) const { return slot * slot_size + header_size; }
+
+    w25q::flash& flash_;
+};
+
+/*!
+ * \brief Update engine source reading a stored image, one chunk ahead
+ */
+class store_source : public image_source {
+public:
+    store_source(w25q::flash& flash, const stored_image& image, bool read_ahead = true)
+        : flash_(flash), address_(image.slot * image_store::slot_size + image_store::header_size),
+          words_(image.words), read_ahead_(read_ahead)
+    {
+    }
+
+    bool           read_words(uint32_t offset, uint32_t* dst, uint32_t count) override;
+    const uint8_t* wire_chunk(uint32_t offset, uint32_t count) override;
+
+private:
+    bool settle();
+
+    w25q::flash& flash_;
+    uint32_t     address_;
+    uint32_t     words_;
+    bool         read_ahead_;
+    bool         pending_ = false;  // A read into buffers_[ahead_] is in flight
+    uint32_t     ahead_offset_ = 0;
+    uint32_t     ahead_count_  = 0;
+    unsigned     ahead_        = 0;
+    uint8_t      buffers_[2][bootloader::chunk_words * 4];
+};
+
+}  // namespace lr11xx
+
+#endif  // LR11XX_IMAGE_STORE_HPP
@@ -0,0 +1,295 @@
+/*!
+ * \file      lr11xx_update_engine.cpp
+ *
+ * \brief     Pipelined LR11xx firmware update through the LR11xx bootloader
+ */
+
+#include "lr11xx_update_engine.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+}
+
+namespace lr11xx {
+
+bool memory_source::read_words(uint32_t offset, uint32_t* dst, uint32_t count)
+{
+    if ((offset > words_) || (count > (words_ - offset))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = image_[offset + i];
+    }
+    return true;
+}
+
+bool wire_memory_source::read_words(uint32_t offset, uint32_t* dst, uint32_t count)
+{
+    const uint8_t* p = wire_chunk(offset, count);
+
+    if (p == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++, p += 4) {
+        dst[i] = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+    return true;
+}
+
+const uint8_t* wire_memory_source::wire_chunk(uint32_t offset, uint32_t count)
+{
+    if ((offset > words_) || (count > (words_ - offset))) {
+        return nullptr;
+    }
+    return image_ + (offset * 4);
+}
+
+bool update_engine::wait_ready(uint32_t timeout_us)
+{
+    uint32_t start = bus_.now_us();
+
+    while (bus_.busy()) {
+        if ((bus_.now_us() - start) > timeout_us) {
+            return false;
+        }
+    }
+    return true;
+}
+
+update_status update_engine::command(uint16_t opcode, const uint8_t* params, size_t len, uint32_t timeout_us)
+{
+    uint8_t cmd[2] = {uint8_t(opcode >> 8), uint8_t(opcode)};
+
+    if (!wait_ready(timeout_us)) {
+        return update_status::busy_timeout;
+    }
+    if (!bus_.write(cmd, sizeof(cmd), params, len)) {
+        return update_status::transport_error;
+    }
+    if (!wait_ready(timeout_us)) {
+        return update_status::busy_timeout;
+    }
+    return update_status::ok;
+}
+
+update_status update_engine::get_version(const update_config& config, uint8_t& type, uint16_t& version)
+{
+    uint8_t       rsp[4];
+    update_status status = command(bootloader::get_version_oc, nullptr, 0, config.busy_timeout_us);
+
+    if (status != update_status::ok) {
+        return status;
+    }
+    if (!bus_.read(rsp, sizeof(rsp))) {
+        return update_status::transport_error;
+    }
+    type    = rsp[1];
+    version = uint16_t((rsp[2] << 8) | rsp[3]);
+    return update_status::ok;
+}
+
+bool update_engine::prepare(uint32_t chunk, const update_config& config, unsigned slot)
+{
+    uint32_t words[bootloader::chunk_words];
+    uint8_t* frame  = frames_[slot];
+    uint32_t offset = chunk * bootloader::chunk_words;
+    uint32_t count  = config.image_words - offset;
+    uint32_t bytes  = offset * 4;
+    uint32_t start  = bus_.now_us();
+
+    if (count > bootloader::chunk_words) {
+        count = bootloader::chunk_words;
+    }
+
+    frame[0] = uint8_t(bootloader::write_flash_encrypted_oc >> 8);
+    frame[1] = uint8_t(bootloader::write_flash_encrypted_oc);
+    frame[2] = uint8_t(bytes >> 24);
+    frame[3] = uint8_t(bytes >> 16);
+    frame[4] = uint8_t(bytes >> 8);
+    frame[5] = uint8_t(bytes);
+
+    payload_len_[slot] = count * 4;
+
+    // Already in wire order: the chunk is sent from where it is
+    const uint8_t* wire = source_.wire_chunk(offset, count);
+    if (wire != nullptr) {
+        if (config.check_crc) {
+            crc_ = abw_crc32_update(crc_, wire, count * 4);
+        }
+        payload_[slot]   = wire;
+        crc_after_[slot] = crc_;
+        stats_.prepare_us += bus_.now_us() - start;
+        return true;
+    }
+
+    if (!source_.read_words(offset, words, count)) {
+        return false;
+    }
+    if (config.check_crc) {
+        crc_ = abw_crc32_update_words(crc_, words, count);
+    }
+
+    // The LR11xx expects the words most significant byte first
+    uint8_t* p = frame + frame_header;
+    for (uint32_t i = 0; i < count; i++) {
+        *p++ = uint8_t(words[i] >> 24);
+        *p++ = uint8_t(words[i] >> 16);
+        *p++ = uint8_t(words[i] >> 8);
+        *p++ = uint8_t(words[i]);
+    }
+    payload_[slot]   = frame + frame_header;
+    crc_after_[slot] = crc_;
+    stats_.staged++;
+    stats_.prepare_us += bus_.now_us() - start;
+    return true;
+}
+
+update_status update_engine::write_image(const update_config& config, uint32_t first_chunk, uint32_t crc)
+{
+    const uint32_t chunks = (config.image_words + bootloader::chunk_words - 1) / bootloader::chunk_words;
+    uint32_t       start  = bus_.now_us();
+
+    crc_ = crc;
+    if (!prepare(first_chunk, config, first_chunk & 1)) {
+        return update_status::source_error;
+    }
+
+    for (uint32_t i = first_chunk; i < chunks; i++) {
+        const unsigned cur  = i & 1;
+        const bool     more = (i + 1) < chunks;
+
+        if (!wait_ready(config.busy_timeout_us)) {
+            return update_status::busy_timeout;
+        }
+        uint32_t sent = bus_.now_us();
+        if (!bus_.write(frames_[cur], frame_header, payload_[cur], payload_len_[cur])) {
+            return update_status::transport_error;
+        }
+
+        // The previous chunk was acknowledged: record it while this one is written
+        if (checkpoints_ && (i > first_chunk) && config.checkpoint_every && ((i % config.checkpoint_every) == 0)) {
+            update_checkpoint checkpoint;
+            checkpoint.image_words = config.image_words;
+            checkpoint.version     = config.expected_version;
+            checkpoint.image_crc   = config.expected_crc;
+            checkpoint.next_chunk  = i;
+            checkpoint.crc         = crc_after_[!cur];
+            if (checkpoints_->save(checkpoint)) {
+                stats_.checkpoints++;
+            }
+        }
+
+        // The LR11xx now writes its flash: build the next frame meanwhile
+        if (more && config.pipelined && !prepare(i + 1, config, !cur)) {
+            return update_status::source_error;
+        }
+        if (!wait_ready(config.busy_timeout_us)) {
+            return update_status::busy_timeout;
+        }
+
+        uint32_t elapsed = bus_.now_us() - sent;
+        if ((stats_.chunks == 0) || (elapsed < stats_.chunk_min_us)) {
+            stats_.chunk_min_us = elapsed;
+        }
+        if (elapsed > stats_.chunk_max_us) {
+            stats_.chunk_max_us = elapsed;
+        }
+        stats_.chunk_sum_us += elapsed;
+        stats_.chunks++;
+
+        if (more && !config.pipelined && !prepare(i + 1, config, !cur)) {
+            return update_status::source_error;
+        }
+    }
+
+    stats_.write_us = bus_.now_us() - start;
+    if (config.check_crc && (abw_crc32_final(crc_) != config.expected_crc)) {
+        return update_status::crc_mismatch;
+    }
+    return update_status::ok;
+}
+
+update_status update_engine::attempt(const update_config& config, bool resume)
+{
+    const uint32_t    chunks = (config.image_words + bootloader::chunk_words - 1) / bootloader::chunk_words;
+    update_checkpoint checkpoint;
+    uint8_t           type;
+    uint16_t          version;
+    update_status     status;
+
+    if (!bus_.enter_bootloader()) {
+        return update_status::transport_error;
+    }
+    status = get_version(config, type, version);
+    if (status != update_status::ok) {
+        return status;
+    }
+    if (type != bootloader::version_type) {
+        return update_status::not_in_bootloader;
+    }
+
+    // Resume only the same image, from a chunk it actually has
+    resume = resume && checkpoints_ && checkpoints_->load(checkpoint) &&
+             (checkpoint.image_words == config.image_words) && (checkpoint.version == config.expected_version) &&
+             (checkpoint.image_crc == config.expected_crc) && (checkpoint.next_chunk > 0) &&
+             (checkpoint.next_chunk < chunks);
+    if (resume) {
+        stats_.resumed_at = checkpoint.next_chunk;
+        status            = write_image(config, checkpoint.next_chunk, checkpoint.crc);
+    } else {
+        // Nothing to resume from until the first checkpoint after this erase
+        if (checkpoints_) {
+            checkpoints_->clear();
+        }
+        stats_.resumed_at = 0;
+        uint32_t erase_start = bus_.now_us();
+        status               = command(bootloader::erase_flash_oc, nullptr, 0, config.erase_timeout_us);
+        if (status != update_status::ok) {
+            return status;
+        }
+        stats_.erase_us = bus_.now_us() - erase_start;
+        status          = write_image(config, 0, ABW_CRC32_INIT);
+    }
+    if (status != update_status::ok) {
+        return status;
+    }
+
+    // Leave the bootloader and check what the LR11xx now runs
+    const uint8_t stay_in_bootloader = 0;
+    status = command(bootloader::reboot_oc, &stay_in_bootloader, 1, config.busy_timeout_us);
+    if (status != update_status::ok) {
+        return status;
+    }
+    status = get_version(config, type, version);
+    if (status != update_status::ok) {
+        return status;
+    }
+    if ((type == bootloader::version_type) || (config.expected_version && (version != config.expected_version))) {
+        return update_status::version_mismatch;
+    }
+    if (checkpoints_) {
+        checkpoints_->clear();
+    }
+    return update_status::ok;
+}
+
+update_status update_engine::run(const update_config& config)
+{
+    uint32_t      start = bus_.now_us();
+    update_status status;
+
+    stats_ = update_stats();
+
+    status = attempt(config, true);
+    if (stats_.resumed_at &&
+        ((status == update_status::crc_mismatch) || (status == update_status::version_mismatch))) {
+        // The flash of the LR11xx did not keep what the checkpoint says: start over
+        status = attempt(config, false);
+    }
+    if (status == update_status::ok) {
+        stats_.total_us = bus_.now_us() - start;
+    }
+    return status;
+}
+
+}  // namespace lr11xx
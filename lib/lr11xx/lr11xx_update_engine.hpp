@@ -0,0 +1,254 @@
+/*!
+ * \file      lr11xx_update_engine.hpp
+ *
+ * \brief     Pipelined LR11xx firmware update through the LR11xx bootloader
+ *
+ * The engine pushes an image to the LR11xx bootloader in 64-word encrypted
+ * write chunks. Two frame buffers are used: while the LR11xx is busy
+ * writing chunk N to its flash, the next chunk is read from the image
+ * source, byte-swapped to wire order and added to the running CRC. BUSY is
+ * polled instead of waiting fixed delays.
+ *
+ * An image already stored in wire order (lr11xx-fwgen --split --bytes) is
+ * not copied: each write hands the transport a 6-byte command header and a
+ * pointer to the chunk in flash, which an SPI DMA can chain as they are.
+ *
+ * With a checkpoint store, the engine records every few chunks how far the
+ * LR11xx has acknowledged the image. An update cut by a power loss then
+ * resumes from there instead of erasing and starting over; a resumed image
+ * that does not boot is erased and written again from the start.
+ *
+ * Bus access and image storage are behind small interfaces, so the same
+ * engine runs on the STM32WB (SPI + GPIO) and on a host against a
+ * simulated LR11xx. The engine uses no heap and no exceptions.
+ */
+
+#ifndef LR11XX_UPDATE_ENGINE_HPP
+#define LR11XX_UPDATE_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lr11xx {
+
+/*!
+ * \brief LR11xx bootloader commands and constants (Semtech lr11xx_bootloader)
+ */
+namespace bootloader {
+constexpr uint16_t get_version_oc           = 0x0101;
+constexpr uint16_t erase_flash_oc           = 0x8000;
+constexpr uint16_t write_flash_encrypted_oc = 0x8003;
+constexpr uint16_t reboot_oc                = 0x8005;
+constexpr uint8_t  version_type             = 0xDF;  //!< Type reported by GetVersion in bootloader mode
+constexpr uint32_t chunk_words              = 64;    //!< Max words per encrypted write
+}  // namespace bootloader
+
+/*!
+ * \brief Access to the LR11xx: SPI commands, BUSY line, reset
+ */
+class update_transport {
+public:
+    virtual ~update_transport() = default;
+
+    /*!
+     * \brief Send a command: opcode and parameters, then an optional payload
+     *
+     * cmd is in RAM. data may point into a flash-resident image, so a DMA
+     * transport can send both parts back to back without copying them.
+     */
+    virtual bool write(const uint8_t* cmd, size_t cmd_len, const uint8_t* data, size_t data_len) = 0;
+
+    /*!
+     * \brief Read the response of the previous command (status byte excluded)
+     */
+    virtual bool read(uint8_t* rsp, size_t rsp_len) = 0;
+
+    /*!
+     * \brief Level of the BUSY line
+     */
+    virtual bool busy() = 0;
+
+    /*!
+     * \brief Reset the LR11xx with BUSY held low so that it starts in bootloader mode
+     */
+    virtual bool enter_bootloader() = 0;
+
+    /*!
+     * \brief Monotonic time in microseconds, for timeouts and statistics
+     */
+    virtual uint32_t now_us() = 0;
+};
+
+/*!
+ * \brief Source of the image words, in host order as in lr11xx_firmware_image[]
+ */
+class image_source {
+public:
+    virtual ~image_source() = default;
+
+    /*!
+     * \brief Read count words starting at word offset
+     */
+    virtual bool read_words(uint32_t offset, uint32_t* dst, uint32_t count) = 0;
+
+    /*!
+     * \brief Chunk already in wire order (big-endian words) in addressable memory
+     *
+     * \returns Pointer to count * 4 bytes that stay valid until the next
+     *          call, nullptr if the source cannot provide one: the engine
+     *          then uses read_words() and swaps the words itself
+     */
+    virtual const uint8_t* wire_chunk(uint32_t offset, uint32_t count)
+    {
+        (void) offset;
+        (void) count;
+        return nullptr;
+    }
+};
+
+/*!
+ * \brief Image source over a flash-resident array
+ */
+class memory_source : public image_source {
+public:
+    memory_source(const uint32_t* image, uint32_t words) : image_(image), words_(words) {}
+
+    bool read_words(uint32_t offset, uint32_t* dst, uint32_t count) override;
+
+private:
+    const uint32_t* image_;
+    uint32_t        words_;
+};
+
+/*!
+ * \brief Image source over a flash-resident array in wire order, written without copies
+ */
+class wire_memory_source : public image_source {
+public:
+    wire_memory_source(const uint8_t* image, uint32_t words) : image_(image), words_(words) {}
+
+    bool           read_words(uint32_t offset, uint32_t* dst, uint32_t count) override;
+    const uint8_t* wire_chunk(uint32_t offset, uint32_t count) override;
+
+private:
+    const uint8_t* image_;
+    uint32_t       words_;
+};
+
+/*!
+ * \brief Progress of an update, as saved by the engine
+ */
+struct update_checkpoint {
+    uint32_t image_words = 0;  //!< Identity of the image: size, version and CRC
+    uint16_t version     = 0;
+    uint32_t image_crc   = 0;
+    uint32_t next_chunk  = 0;  //!< First chunk not acknowledged by the LR11xx
+    uint32_t crc         = 0;  //!< Running CRC of the chunks before next_chunk
+};
+
+/*!
+ * \brief Non-volatile storage of the last checkpoint, e.g. a flash area of the user-config page
+ */
+class checkpoint_store {
+public:
+    virtual ~checkpoint_store() = default;
+
+    /*!
+     * \brief Last checkpoint saved, false if there is none or it is unreadable
+     */
+    virtual bool load(update_checkpoint& checkpoint) = 0;
+
+    /*!
+     * \brief Save a checkpoint, replacing the previous one
+     */
+    virtual bool save(const update_checkpoint& checkpoint) = 0;
+
+    /*!
+     * \brief Forget the checkpoint, once an update is complete or restarted
+     */
+    virtual bool clear() = 0;
+};
+
+/*!
+ * \brief Update outcome
+ */
+enum class update_status {
+    ok,
+    transport_error,    //!< SPI or reset failure
+    busy_timeout,       //!< BUSY stayed high
+    not_in_bootloader,  //!< GetVersion did not report the bootloader after reset
+    source_error,       //!< The image source failed
+    crc_mismatch,       //!< The streamed image does not match the expected CRC
+    version_mismatch,   //!< The LR11xx does not run the expected version after reboot
+};
+
+/*!
+ * \brief Update parameters
+ */
+struct update_config {
+    uint32_t image_words      = 0;        //!< LR11XX_FIRMWARE_IMAGE_SIZE
+    uint16_t expected_version = 0;        //!< LR11XX_FIRMWARE_VERSION, 0 to skip the check
+    bool     check_crc        = false;    //!< Compare the streamed data with expected_crc
+    uint32_t expected_crc     = 0;        //!< LR11XX_FIRMWARE_IMAGE_CRC32
+    bool     pipelined        = true;     //!< Prepare the next chunk while the LR11xx is busy
+    uint32_t busy_timeout_us  = 100000;   //!< Longest accepted BUSY for a command
+    uint32_t erase_timeout_us = 5000000;  //!< Longest accepted BUSY for the flash erase
+    uint32_t checkpoint_every = 16;       //!< Chunks between checkpoints, with a checkpoint store
+};
+
+/*!
+ * \brief Timing of the last update
+ */
+struct update_stats {
+    uint32_t chunks       = 0;
+    uint32_t chunk_min_us = 0;  //!< Shortest send-to-ready time of a chunk
+    uint32_t chunk_max_us = 0;  //!< Longest send-to-ready time of a chunk
+    uint64_t chunk_sum_us = 0;  //!< Sum of the chunk times, from first send to last ready
+    uint32_t erase_us     = 0;
+    uint32_t write_us     = 0;  //!< All chunks, including preparation
+    uint32_t prepare_us   = 0;  //!< MCU time spent preparing chunks (read, swap, CRC)
+    uint32_t staged       = 0;  //!< Chunks copied to a frame buffer, the others were sent in place
+    uint32_t resumed_at   = 0;  //!< First chunk written when resuming, 0 otherwise
+    uint32_t checkpoints  = 0;  //!< Checkpoints saved
+    uint32_t total_us     = 0;  //!< Whole update, bootloader entry to version check
+};
+
+/*!
+ * \brief Update engine
+ */
+class update_engine {
+public:
+    update_engine(update_transport& bus, image_source& source, checkpoint_store* checkpoints = nullptr)
+        : bus_(bus), source_(source), checkpoints_(checkpoints)
+    {
+    }
+
+    update_status run(const update_config& config);
+
+    const update_stats& stats() const { return stats_; }
+
+private:
+    static constexpr size_t frame_header = 6;  // Opcode and byte offset
+    static constexpr size_t frame_size   = frame_header + bootloader::chunk_words * 4;
+
+    update_status command(uint16_t opcode, const uint8_t* params, size_t len, uint32_t timeout_us);
+    update_status get_version(const update_config& config, uint8_t& type, uint16_t& version);
+    update_status attempt(const update_config& config, bool resume);
+    update_status write_image(const update_config& config, uint32_t first_chunk, uint32_t crc);
+    bool          prepare(uint32_t chunk, const update_config& config, unsigned slot);
+    bool          wait_ready(uint32_t timeout_us);
+
+    update_transport& bus_;
+    image_source&     source_;
+    checkpoint_store* checkpoints_;
+    update_stats      stats_;
+    uint32_t          crc_ = 0;
+    uint8_t           frames_[2][frame_size];
+    const uint8_t*    payload_[2];  // Frame buffer data or the chunk in the image
+    size_t            payload_len_[2];
+    uint32_t          crc_after_[2];  // Running CRC once the chunk of the frame is included
+};
+
+}  // namespace lr11xx
+
+#endif  // LR11XX_UPDATE_ENGINE_HPP
@@ -0,0 +1,313 @@
+/*!
+ * \file      abw_lzss.c
+ *
+ * \brief     Streaming LZSS decoder for compressed firmware images
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include "abw_lzss.h"
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PRIVATE FUNCTIONS DEFINITION --------------------------------------------
+ */
+
+static void abw_lzss_put(abw_lzss_t* ctx, uint8_t byte)
+{
+    ctx->window[ctx->win_pos] = byte;
+    ctx->win_pos              = (ctx->win_pos + 1) & ctx->win_mask;
+    ctx->out_pos++;
+}
+
+static abw_lzss_status_t abw_lzss_start(abw_lzss_t* ctx, const uint8_t* header)
+{
+    if ((header[0] != 'A') || (header[1] != 'L') || (header[2] != 'Z'))
+    {
+        return ABW_LZSS_ERR_HEADER;
+    }
+    if ((header[3] < ABW_LZSS_WINDOW_BITS_MIN) || (header[3] > ABW_LZSS_WINDOW_BITS_MAX))
+    {
+        return ABW_LZSS_ERR_HEADER;
+    }
+
+    ctx->out_len    = ( uint32_t ) header[4] | (( uint32_t ) header[5] << 8) | (( uint32_t ) header[6] << 16) |
+                   (( uint32_t ) header[7] << 24);
+    ctx->out_pos    = 0;
+    ctx->win_bits   = header[3];
+    ctx->win_mask   = (1u << header[3]) - 1;
+    ctx->win_pos    = 0;
+    ctx->match_dist = 0;
+    ctx->match_left = 0;
+    ctx->flags      = 0;
+    ctx->flag_count = 0;
+
+    return ABW_LZSS_OK;
+}
+
+// Hand the decoded bytes not yet given to the callback, in at most two pieces around the end of the window
+static int abw_lzss_flush(abw_lzss_t* ctx)
+{
+    while (ctx->flushed < ctx->out_pos)
+    {
+        uint32_t at = ctx->flushed & ctx->win_mask;
+        uint32_t n  = ctx->out_pos - ctx->flushed;
+
+        if (n > (ctx->win_mask + 1 - at))
+        {
+            n = ctx->win_mask + 1 - at;
+        }
+        if (ctx->sink(ctx->sink_ctx, ctx->flushed, ctx->window + at, n) != 0)
+        {
+            return 0;
+        }
+        ctx->flushed += n;
+    }
+    return 1;
+}
+
+// Append a byte for the push interface, making room in the window first
+static int abw_lzss_push_byte(abw_lzss_t* ctx, uint8_t byte)
+{
+    if (((ctx->out_pos - ctx->flushed) > ctx->win_mask) && !abw_lzss_flush(ctx))
+    {
+        return 0;
+    }
+    abw_lzss_put(ctx, byte);
+    return 1;
+}
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS DEFINITION ---------------------------------------------
+ */
+
+abw_lzss_status_t abw_lzss_init(abw_lzss_t* ctx, const uint8_t* src, uint32_t src_len)
+{
+    if (src_len < ABW_LZSS_HEADER_SIZE)
+    {
+        return ABW_LZSS_ERR_HEADER;
+    }
+
+    ctx->src     = src;
+    ctx->src_len = src_len;
+    ctx->src_pos = ABW_LZSS_HEADER_SIZE;
+
+    return abw_lzss_start(ctx, src);
+}
+
+uint32_t abw_lzss_size(const abw_lzss_t* ctx)
+{
+    return ctx->out_len;
+}
+
+abw_lzss_status_t abw_lzss_read(abw_lzss_t* ctx, uint8_t* dst, uint32_t len, uint32_t* produced)
+{
+    uint32_t done = 0;
+    abw_lzss_status_t status = ABW_LZSS_OK;
+
+    while ((done < len) && (ctx->out_pos < ctx->out_len))
+    {
+        // Finish the match in progress first
+        if (ctx->match_left)
+        {
+            uint8_t byte = ctx->window[(ctx->win_pos - ctx->match_dist) & ctx->win_mask];
+
+            abw_lzss_put(ctx, byte);
+            dst[done++] = byte;
+            ctx->match_left--;
+            continue;
+        }
+
+        if (ctx->flag_count == 0)
+        {
+            if (ctx->src_pos >= ctx->src_len)
+            {
+                status = ABW_LZSS_ERR_CORRUPT;
+                break;
+            }
+            ctx->flags      = ctx->src[ctx->src_pos++];
+            ctx->flag_count = 8;
+        }
+
+        if (ctx->flags & 1)
+        {
+            if (ctx->src_pos >= ctx->src_len)
+            {
+                status = ABW_LZSS_ERR_CORRUPT;
+                break;
+            }
+            abw_lzss_put(ctx, ctx->src[ctx->src_pos]);
+            dst[done++] = ctx->src[ctx->src_pos++];
+        }
+        else
+        {
+            uint32_t token;
+            uint32_t dist;
+            uint32_t mlen;
+
+            if ((ctx->src_pos + 2) > ctx->src_len)
+            {
+                status = ABW_LZSS_ERR_CORRUPT;
+                break;
+            }
+            token = ( uint32_t ) ctx->src[ctx->src_pos] | (( uint32_t ) ctx->src[ctx->src_pos + 1] << 8);
+            ctx->src_pos += 2;
+
+            dist = (token & ctx->win_mask) + 1;
+            mlen = (token >> ctx->win_bits) + ABW_LZSS_MIN_MATCH;
+            if ((dist > ctx->out_pos) || (mlen > (ctx->out_len - ctx->out_pos)))
+            {
+                status = ABW_LZSS_ERR_CORRUPT;
+                break;
+            }
+            ctx->match_dist = ( uint16_t ) dist;
+            ctx->match_left = ( uint16_t ) mlen;
+        }
+        ctx->flags >>= 1;
+        ctx->flag_count--;
+    }
+
+    if (produced != NULL)
+    {
+        *produced = done;
+    }
+    if ((status == ABW_LZSS_OK) && (ctx->out_pos >= ctx->out_len))
+    {
+        status = ABW_LZSS_END;
+    }
+    return status;
+}
+
+abw_lzss_status_t abw_lzss_read_words(abw_lzss_t* ctx, uint32_t* dst, uint32_t count, uint32_t* produced)
+{
+    uint8_t*          bytes = ( uint8_t* ) dst;
+    uint32_t          done;
+    abw_lzss_status_t status;
+
+    status = abw_lzss_read(ctx, bytes, count * 4, &done);
+    if ((status == ABW_LZSS_END) && (done & 3))
+    {
+        // The stream does not hold a whole number of words
+        status = ABW_LZSS_ERR_CORRUPT;
+    }
+
+    done /= 4;
+    for (uint32_t i = 0; i < done; i++)
+    {
+        const uint8_t* b = bytes + (i * 4);
+
+        dst[i] = (( uint32_t ) b[0] << 24) | (( uint32_t ) b[1] << 16) | (( uint32_t ) b[2] << 8) | b[3];
+    }
+
+    if (produced != NULL)
+    {
+        *produced = done;
+    }
+    return status;
+}
+
+void abw_lzss_init_push(abw_lzss_t* ctx, abw_lzss_sink_t sink, void* sink_ctx)
+{
+    ctx->src        = NULL;
+    ctx->src_len    = 0;
+    ctx->src_pos    = 0;
+    ctx->sink       = sink;
+    ctx->sink_ctx   = sink_ctx;
+    ctx->flushed    = 0;
+    ctx->header_len = 0;
+    ctx->token_half = 0;
+    ctx->status     = ABW_LZSS_OK;
+}
+
+abw_lzss_status_t abw_lzss_push(abw_lzss_t* ctx, const uint8_t* data, uint32_t len)
+{
+    uint32_t          pos    = 0;
+    abw_lzss_status_t status = ABW_LZSS_OK;
+
+    if (ctx->status != ABW_LZSS_OK)
+    {
+        return ( abw_lzss_status_t ) ctx->status;
+    }
+
+    if (ctx->header_len < ABW_LZSS_HEADER_SIZE)
+    {
+        while ((ctx->header_len < ABW_LZSS_HEADER_SIZE) && (pos < len))
+        {
+            ctx->header[ctx->header_len++] = data[pos++];
+        }
+        if (ctx->header_len < ABW_LZSS_HEADER_SIZE)
+        {
+            return ABW_LZSS_OK;
+        }
+        status = abw_lzss_start(ctx, ctx->header);
+    }
+
+    while ((status == ABW_LZSS_OK) && (pos < len) && (ctx->out_pos < ctx->out_len))
+    {
+        if (ctx->flag_count == 0)
+        {
+            ctx->flags      = data[pos++];
+            ctx->flag_count = 8;
+            continue;
+        }
+
+        if (ctx->flags & 1)
+        {
+            if (!abw_lzss_push_byte(ctx, data[pos++]))
+            {
+                status = ABW_LZSS_ERR_OUTPUT;
+                break;
+            }
+        }
+        else
+        {
+            uint32_t token;
+            uint32_t dist;
+            uint32_t mlen;
+
+            // The two bytes of a match may come in different pieces
+            if (!ctx->token_half)
+            {
+                ctx->token_low  = data[pos++];
+                ctx->token_half = 1;
+                continue;
+            }
+            token           = ( uint32_t ) ctx->token_low | (( uint32_t ) data[pos++] << 8);
+            ctx->token_half = 0;
+
+            dist = (token & ctx->win_mask) + 1;
+            mlen = (token >> ctx->win_bits) + ABW_LZSS_MIN_MATCH;
+            if ((dist > ctx->out_pos) || (mlen > (ctx->out_len - ctx->out_pos)))
+            {
+                status = ABW_LZSS_ERR_CORRUPT;
+                break;
+            }
+            while (mlen-- > 0)
+            {
+                if (!abw_lzss_push_byte(ctx, ctx->window[(ctx->win_pos - dist) & ctx->win_mask]))
+                {
+                    status = ABW_LZSS_ERR_OUTPUT;
+                    break;
+                }
+            }
+        }
+        ctx->flags >>= 1;
+        ctx->flag_count--;
+    }
+
+    if ((status == ABW_LZSS_OK) && !abw_lzss_flush(ctx))
+    {
+        status = ABW_LZSS_ERR_OUTPUT;
+    }
+    if ((status == ABW_LZSS_OK) && (ctx->out_pos >= ctx->out_len))
+    {
+        status = ABW_LZSS_END;
+    }
+    ctx->status = ( uint8_t ) status;
+    return status;
+}
@@ -0,0 +1,210 @@
+/*!
+ * \file      abw_lzss.h
+ *
+ * \brief     Streaming LZSS decoder for compressed firmware images
+ *
+ * The decoder inflates a compressed stream produced by the host tool
+ * `abw-lzss` in caller-sized pieces. Its only RAM is the history window held
+ * in the context, so a flash-resident image can be pushed to a peripheral
+ * (e.g. the LR11xx bootloader, 64 words per write) without ever being
+ * inflated as a whole.
+ *
+ * Stream layout (all multi-byte fields little-endian):
+ *
+ *   offset  size  field
+ *   0       3     magic "ALZ"
+ *   3       1     window bits W (ABW_LZSS_WINDOW_BITS_MIN..ABW_LZSS_WINDOW_BITS_MAX)
+ *   4       4     size of the decoded data in bytes
+ *   8       ...   token groups
+ *
+ * A token group starts with a flag byte, consumed LSB first. A set bit is a
+ * literal byte, a cleared bit is a 16-bit match: bits [W-1:0] hold the
+ * distance minus one and bits [15:W] hold the length minus
+ * ABW_LZSS_MIN_MATCH.
+ *
+ * A stream that arrives piece by piece, such as the XMODEM blocks of ABWu,
+ * goes through the push interface instead: abw_lzss_init_push() and
+ * abw_lzss_push(). The decoded data is handed to a callback straight from
+ * the history window, in pieces of any length up to the window size, so
+ * neither the stream nor the image is ever held in RAM.
+ */
+
+#ifndef ABW_LZSS_H
+#define ABW_LZSS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC MACROS -----------------------------------------------------------
+ */
+
+/*!
+ * \brief Largest window supported by the decoder, sets the context RAM size
+ */
+#ifndef ABW_LZSS_WINDOW_BITS_MAX
+#define ABW_LZSS_WINDOW_BITS_MAX 12
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Size in bytes of the stream header
+ */
+#define ABW_LZSS_HEADER_SIZE 8
+
+/*!
+ * \brief Smallest window accepted in a stream header
+ */
+#define ABW_LZSS_WINDOW_BITS_MIN 8
+
+/*!
+ * \brief Shortest encoded match
+ */
+#define ABW_LZSS_MIN_MATCH 3
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC TYPES ------------------------------------------------------------
+ */
+
+/*!
+ * \brief Decoder status
+ */
+typedef enum abw_lzss_status_e
+{
+    ABW_LZSS_OK = 0,        //!< Data produced, more may follow
+    ABW_LZSS_END,           //!< All decoded data has been produced
+    ABW_LZSS_ERR_HEADER,    //!< Bad magic or unsupported window size
+    ABW_LZSS_ERR_CORRUPT,   //!< Truncated stream or match outside the window
+    ABW_LZSS_ERR_OUTPUT,    //!< The output callback of the push interface failed
+} abw_lzss_status_t;
+
+/*!
+ * \brief Output callback of the push interface, returns 0 on success
+ *
+ * \param [in] ctx    Context given to abw_lzss_init_push()
+ * \param [in] offset Position of data in the decoded image
+ * \param [in] data   Decoded bytes
+ * \param [in] len    Number of decoded bytes
+ */
+typedef int ( *abw_lzss_sink_t )(void* ctx, uint32_t offset, const uint8_t* data, uint32_t len);
+
+/*!
+ * \brief Decoder context
+ *
+ * Fields are private to the decoder.
+ */
+typedef struct abw_lzss_s
+{
+    const uint8_t*  src;         //!< Compressed stream
+    uint32_t        src_len;     //!< Length of the compressed stream
+    uint32_t        src_pos;     //!< Read position in the compressed stream
+    uint32_t        out_len;     //!< Decoded size announced by the header
+    uint32_t        out_pos;     //!< Number of bytes produced so far
+    uint32_t        win_mask;    //!< Window size minus one
+    uint32_t        win_pos;     //!< Next write position in the window
+    uint16_t        match_dist;  //!< Distance of the match being copied
+    uint16_t        match_left;  //!< Bytes of the match still to copy
+    uint8_t         win_bits;    //!< Window bits of the stream
+    uint8_t         flags;       //!< Current flag byte
+    uint8_t         flag_count;  //!< Flags left in the current flag byte
+    abw_lzss_sink_t sink;        //!< Push interface: output callback
+    void*           sink_ctx;    //!< Push interface: context of the callback
+    uint32_t        flushed;     //!< Push interface: bytes handed to the callback
+    uint8_t         header[ABW_LZSS_HEADER_SIZE];  //!< Push interface: header received so far
+    uint8_t         header_len;  //!< Push interface: bytes in header
+    uint8_t         token_low;   //!< Push interface: first byte of a split match token
+    uint8_t         token_half;  //!< Push interface: token_low is pending
+    uint8_t         status;      //!< Push interface: sticky end or error
+    uint8_t         window[1u << ABW_LZSS_WINDOW_BITS_MAX];  //!< History
+} abw_lzss_t;
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Attach a decoder to a compressed stream
+ *
+ * \param [out] ctx     Decoder context
+ * \param [in]  src     Compressed stream, must stay readable while decoding
+ * \param [in]  src_len Length of the compressed stream in bytes
+ *
+ * \returns ABW_LZSS_OK or ABW_LZSS_ERR_HEADER
+ */
+abw_lzss_status_t abw_lzss_init(abw_lzss_t* ctx, const uint8_t* src, uint32_t src_len);
+
+/*!
+ * \brief Decoded size announced by the stream header, in bytes
+ */
+uint32_t abw_lzss_size(const abw_lzss_t* ctx);
+
+/*!
+ * \brief Decode the next bytes of the stream
+ *
+ * \param [in]  ctx      Decoder context
+ * \param [out] dst      Output buffer
+ * \param [in]  len      Number of bytes wanted
+ * \param [out] produced Number of bytes written to dst, may be NULL
+ *
+ * \returns ABW_LZSS_OK if len bytes were produced and data remains,
+ *          ABW_LZSS_END once the last byte has been produced, an error otherwise
+ */
+abw_lzss_status_t abw_lzss_read(abw_lzss_t* ctx, uint8_t* dst, uint32_t len, uint32_t* produced);
+
+/*!
+ * \brief Decode the next words of a stream holding big-endian 32-bit words
+ *
+ * This is the layout of the LR11xx .bin images: the words come out in host
+ * order, ready for the lr11xx_bootloader_write_flash_encrypted() path.
+ *
+ * \param [in]  ctx      Decoder context
+ * \param [out] dst      Output buffer
+ * \param [in]  count    Number of words wanted
+ * \param [out] produced Number of words written to dst, may be NULL
+ *
+ * \returns Same as abw_lzss_read()
+ */
+abw_lzss_status_t abw_lzss_read_words(abw_lzss_t* ctx, uint32_t* dst, uint32_t count, uint32_t* produced);
+
+/*!
+ * \brief Prepare a decoder for a stream pushed piece by piece, header included
+ *
+ * \param [out] ctx      Decoder context
+ * \param [in]  sink     Called with the decoded data, in order
+ * \param [in]  sink_ctx Passed to sink
+ */
+void abw_lzss_init_push(abw_lzss_t* ctx, abw_lzss_sink_t sink, void* sink_ctx);
+
+/*!
+ * \brief Decode the next piece of a pushed stream
+ *
+ * Everything decoded from the piece is handed to the callback before the
+ * call returns. Bytes after the end of the stream, such as XMODEM padding,
+ * are ignored.
+ *
+ * \returns ABW_LZSS_OK while more of the stream is expected,
+ *          ABW_LZSS_END once the last byte has been handed out, an error
+ *          otherwise. Errors and the end are sticky.
+ */
+abw_lzss_status_t abw_lzss_push(abw_lzss_t* ctx, const uint8_t* data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_LZSS_H
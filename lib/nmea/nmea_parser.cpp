@@ -0,0 +1,626 @@
+/*!
+ * \file      nmea_parser.cpp
+ *
+ * \brief     Streaming NMEA 0183 and PMTK parser for the MT3333 UART
+ */
+
+#include "nmea_parser.hpp"
+
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && defined(__GNUC__)
+#define NMEA_X86 1
+#include <immintrin.h>
+#endif
+
+namespace nmea {
+
+namespace {
+
+// Body scans: index of the first '*', '$' or '\n' in p[0..n), or n, and the XOR of the bytes before it.
+// The narrower scans are inlined into the wider ones for their tails: a call from the AVX2 scan costs a
+// vzeroupper and a spill, which halves its speed when the UART is read in 64-byte chunks.
+
+inline uint32_t has_byte(uint32_t w, uint8_t c)
+{
+    uint32_t v = w ^ (0x01010101u * c);
+    return (v - 0x01010101u) & ~v & 0x80808080u;  // May flag bytes above a match, never misses one
+}
+
+inline uint8_t hex_value(uint8_t c)
+{
+    if ((c >= '0') && (c <= '9')) {
+        return uint8_t(c - '0');
+    }
+    c |= 0x20;
+    return ((c >= 'a') && (c <= 'f')) ? uint8_t(c - 'a' + 10) : 0xFF;
+}
+
+inline bool is_end(uint8_t c)
+{
+    return (c == '*') || (c == '$') || (c == '\n');
+}
+
+__attribute__((always_inline)) inline size_t scan_scalar(const uint8_t* p, size_t n, uint8_t& sum)
+{
+    uint32_t x = 0;
+    size_t   i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint32_t w;
+        std::memcpy(&w, p + i, 4);  // A single LDR on the Cortex-M4, unaligned is fine
+        if (has_byte(w, '*') | has_byte(w, '$') | has_byte(w, '\n')) {
+            break;
+        }
+        x ^= w;
+    }
+    uint8_t s = uint8_t(x ^ (x >> 8) ^ (x >> 16) ^ (x >> 24));
+    for (; (i < n) && !is_end(p[i]); i++) {
+        s ^= p[i];
+    }
+    sum = s;
+    return i;
+}
+
+#ifdef NMEA_X86
+
+// 32 bytes of 0xFF then 32 of 0: loading from prefix + 32 - k keeps the first k bytes of a vector
+alignas(64) const uint8_t prefix[64] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+inline uint8_t fold128(__m128i x)
+{
+    x          = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+    x          = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+    uint32_t w = uint32_t(_mm_cvtsi128_si32(x));
+    return uint8_t(w ^ (w >> 8) ^ (w >> 16) ^ (w >> 24));
+}
+
+__attribute__((always_inline)) inline size_t scan_sse2(const uint8_t* p, size_t n, uint8_t& sum)
+{
+    const __m128i star   = _mm_set1_epi8('*');
+    const __m128i dollar = _mm_set1_epi8('$');
+    const __m128i eol    = _mm_set1_epi8('\n');
+    __m128i       x      = _mm_setzero_si128();
+    size_t        i      = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i  v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i  m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, star), _mm_cmpeq_epi8(v, dollar)),
+                                  _mm_cmpeq_epi8(v, eol));
+        uint32_t mask = uint32_t(_mm_movemask_epi8(m));
+        if (mask != 0) {
+            unsigned k    = unsigned(__builtin_ctz(mask));
+            __m128i  keep = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prefix + 32 - k));
+            sum           = fold128(_mm_xor_si128(x, _mm_and_si128(v, keep)));
+            return i + k;
+        }
+        x = _mm_xor_si128(x, v);
+    }
+    uint8_t tail = 0;
+    i += scan_scalar(p + i, n - i, tail);
+    sum = fold128(x) ^ tail;
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t scan_avx2(const uint8_t* p, size_t n, uint8_t& sum)
+{
+    const __m256i star   = _mm256_set1_epi8('*');
+    const __m256i dollar = _mm256_set1_epi8('$');
+    const __m256i eol    = _mm256_set1_epi8('\n');
+    __m256i       x      = _mm256_setzero_si256();
+    size_t        i      = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        __m256i  v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i  m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, star), _mm256_cmpeq_epi8(v, dollar)),
+                                     _mm256_cmpeq_epi8(v, eol));
+        uint32_t mask = uint32_t(_mm256_movemask_epi8(m));
+        if (mask != 0) {
+            unsigned k    = unsigned(__builtin_ctz(mask));
+            __m256i  keep = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prefix + 32 - k));
+            x             = _mm256_xor_si256(x, _mm256_and_si256(v, keep));
+            sum           = fold128(_mm_xor_si128(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+            return i + k;
+        }
+        x = _mm256_xor_si256(x, v);
+    }
+    uint8_t tail = 0;
+    i += scan_sse2(p + i, n - i, tail);
+    sum = fold128(_mm_xor_si128(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1))) ^ tail;
+    return i;
+}
+
+#endif  // NMEA_X86
+
+// Field decoding
+
+struct fields {
+    std::string_view f[max_fields];
+    size_t           count = 0;
+
+    std::string_view operator[](size_t i) const { return (i < count) ? f[i] : std::string_view(); }
+};
+
+bool split(std::string_view s, fields& out)
+{
+    const char* p     = s.data();
+    const char* end   = p + s.size();
+    const char* start = p;
+
+    out.count = 0;
+    for (; p < end; p++) {
+        if (*p == ',') {
+            if (out.count == max_fields - 1) {
+                return false;
+            }
+            out.f[out.count++] = std::string_view(start, size_t(p - start));
+            start              = p + 1;
+        }
+    }
+    out.f[out.count++] = std::string_view(start, size_t(end - start));
+    return true;
+}
+
+inline bool is_digit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+/*!
+ * Unsigned decimal of 1 to 9 digits, at most max
+ */
+bool parse_uint(std::string_view f, uint32_t max, uint32_t& v)
+{
+    if (f.empty() || (f.size() > 9)) {
+        return false;
+    }
+    v = 0;
+    for (char c : f) {
+        if (!is_digit(c)) {
+            return false;
+        }
+        v = v * 10 + uint32_t(c - '0');
+    }
+    return v <= max;
+}
+
+template <typename T>
+bool parse_small(std::string_view f, T& v)
+{
+    uint32_t u;
+    if (!parse_uint(f, T(~T(0)), u)) {
+        return false;
+    }
+    v = T(u);
+    return true;
+}
+
+/*!
+ * Signed decimal scaled by 10^decimals, extra decimals truncated; no_value when empty
+ */
+bool parse_fixed(std::string_view f, unsigned decimals, int32_t& v)
+{
+    if (f.empty()) {
+        v = no_value;
+        return true;
+    }
+    const char* p        = f.data();
+    const char* end      = p + f.size();
+    bool        negative = (*p == '-');
+    uint32_t    value    = 0;
+    unsigned    whole    = 0;  // Digits before the dot
+    unsigned    taken    = 0;  // Decimals kept
+    bool        dot      = false;
+
+    p += negative;
+    for (; p < end; p++) {
+        char c = *p;
+        if (is_digit(c)) {
+            if (!dot) {
+                whole++;
+            } else if (taken < decimals) {
+                taken++;
+            } else {
+                continue;  // Truncated
+            }
+            value = value * 10 + uint32_t(c - '0');
+        } else if ((c == '.') && !dot) {
+            dot = true;
+        } else {
+            return false;
+        }
+    }
+    if ((whole + taken == 0) || (whole + decimals > 9)) {
+        return false;  // No digit, or might not fit
+    }
+    for (; taken < decimals; taken++) {
+        value *= 10;
+    }
+    v = negative ? -int32_t(value) : int32_t(value);
+    return true;
+}
+
+bool parse_time(std::string_view f, utc_time& t)
+{
+    t = utc_time();
+    if (f.empty()) {
+        return true;
+    }
+    int32_t ms;
+    if ((f.size() < 6) || !is_digit(f[0]) || !is_digit(f[1]) || !is_digit(f[2]) || !is_digit(f[3]) ||
+        !parse_fixed(f.substr(4), 3, ms) || (ms < 0) || (ms >= 61000)) {
+        return false;
+    }
+    t.hour        = uint8_t((f[0] - '0') * 10 + (f[1] - '0'));
+    t.minute      = uint8_t((f[2] - '0') * 10 + (f[3] - '0'));
+    t.second      = uint8_t(ms / 1000);
+    t.millisecond = uint16_t(ms % 1000);
+    t.valid       = (t.hour < 24) && (t.minute < 60);
+    return t.valid;
+}
+
+/*!
+ * ddmm.mmmm or dddmm.mmmm and its hemisphere, to 1e-7 degrees
+ */
+bool parse_coordinate(std::string_view f, std::string_view hemisphere, size_t degree_digits, int32_t& v)
+{
+    if (f.empty() && hemisphere.empty()) {
+        v = no_value;
+        return true;
+    }
+    uint32_t degrees;
+    int32_t  minutes;  // 1e-6 minutes
+    if ((f.size() < degree_digits + 2) || !parse_uint(f.substr(0, degree_digits), 180, degrees) ||
+        !parse_fixed(f.substr(degree_digits), 6, minutes) || (minutes < 0) || (minutes >= 60000000) ||
+        (hemisphere.size() != 1)) {
+        return false;
+    }
+    v = int32_t(degrees * 10000000u) + minutes / 6;
+    if ((hemisphere[0] == 'S') || (hemisphere[0] == 'W')) {
+        v = -v;
+    } else if ((hemisphere[0] != 'N') && (hemisphere[0] != 'E')) {
+        return false;
+    }
+    return true;
+}
+
+bool parse_date(std::string_view f, rmc& r)
+{
+    if (f.empty()) {
+        return true;
+    }
+    uint32_t ddmmyy;
+    if ((f.size() != 6) || !parse_uint(f, 999999, ddmmyy)) {
+        return false;
+    }
+    r.day   = uint8_t(ddmmyy / 10000);
+    r.month = uint8_t(ddmmyy / 100 % 100);
+    r.year  = uint16_t(2000 + ddmmyy % 100);
+    return (r.day >= 1) && (r.day <= 31) && (r.month >= 1) && (r.month <= 12);
+}
+
+inline char single(std::string_view f)
+{
+    return (f.size() == 1) ? f[0] : 0;
+}
+
+// Optional trailing field: 0 when absent or empty
+bool parse_optional(std::string_view f, uint8_t& v)
+{
+    v = 0;
+    return f.empty() || parse_small(f, v);
+}
+
+bool decode_gga(const fields& f, gga& g)
+{
+    return (f.count >= 12) && parse_time(f[1], g.time) && parse_coordinate(f[2], f[3], 2, g.latitude) &&
+           parse_coordinate(f[4], f[5], 3, g.longitude) && parse_small(f[6], g.quality) &&
+           (f[7].empty() || parse_small(f[7], g.satellites)) && parse_fixed(f[8], 2, g.hdop) &&
+           parse_fixed(f[9], 2, g.altitude) && parse_fixed(f[11], 2, g.geoid);
+}
+
+bool decode_rmc(const fields& f, rmc& r)
+{
+    char status = single(f[2]);
+    r.valid     = (status == 'A');
+    r.mode      = single(f[12]);
+    return (f.count >= 10) && ((status == 'A') || (status == 'V')) && parse_time(f[1], r.time) &&
+           parse_coordinate(f[3], f[4], 2, r.latitude) && parse_coordinate(f[5], f[6], 3, r.longitude) &&
+           parse_fixed(f[7], 2, r.speed) && parse_fixed(f[8], 2, r.course) && parse_date(f[9], r);
+}
+
+bool decode_gsv(const fields& f, gsv& g)
+{
+    if ((f.count < 4) || !parse_small(f[1], g.messages) || !parse_small(f[2], g.number) ||
+        !parse_small(f[3], g.in_view) || (g.number == 0) || (g.number > g.messages)) {
+        return false;
+    }
+    size_t rest = f.count - 4;
+    g.count     = uint8_t(rest / 4);
+    if ((g.count > 4) || ((rest % 4) > 1) || ((rest % 4 == 1) && !parse_optional(f[f.count - 1], g.signal))) {
+        return false;
+    }
+    for (uint8_t i = 0; i < g.count; i++) {
+        gsv_satellite& s = g.satellites[i];
+        size_t         k = 4 + 4 * i;
+        int32_t        elevation, azimuth, snr;
+        if (!parse_small(f[k], s.prn) || !parse_fixed(f[k + 1], 0, elevation) || !parse_fixed(f[k + 2], 0, azimuth) ||
+            !parse_fixed(f[k + 3], 0, snr) || (elevation > 90) || (azimuth > 359) || (snr > 99)) {
+            return false;
+        }
+        s.elevation = int16_t((elevation == no_value) ? -1 : elevation);
+        s.azimuth   = int16_t((azimuth == no_value) ? -1 : azimuth);
+        s.snr       = int16_t((snr == no_value) ? -1 : snr);
+    }
+    return true;
+}
+
+bool decode_gsa(const fields& f, gsa& g)
+{
+    g.mode = single(f[1]);
+    if ((f.count < 18) || !parse_small(f[2], g.fix) || !parse_fixed(f[15], 2, g.pdop) ||
+        !parse_fixed(f[16], 2, g.hdop) || !parse_fixed(f[17], 2, g.vdop) || !parse_optional(f[18], g.system)) {
+        return false;
+    }
+    for (size_t k = 3; k < 15; k++) {
+        if (!f[k].empty() && !parse_small(f[k], g.prns[g.count++])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool decode_gst(const fields& f, gst& g)
+{
+    return (f.count >= 9) && parse_time(f[1], g.time) && parse_fixed(f[2], 2, g.rms) &&
+           parse_fixed(f[3], 2, g.major) && parse_fixed(f[4], 2, g.minor) && parse_fixed(f[5], 2, g.orientation) &&
+           parse_fixed(f[6], 2, g.latitude) && parse_fixed(f[7], 2, g.longitude) && parse_fixed(f[8], 2, g.altitude);
+}
+
+}  // namespace
+
+const char* scan_path_name(scan_path path)
+{
+    switch (path) {
+    case scan_path::sse2:
+        return "sse2";
+    case scan_path::avx2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+bool scan_path_supported(scan_path path)
+{
+#ifdef NMEA_X86
+    if (path == scan_path::avx2) {
+        return __builtin_cpu_supports("avx2");
+    }
+    return true;
+#else
+    return path == scan_path::scalar;
+#endif
+}
+
+scan_path best_scan_path()
+{
+    if (scan_path_supported(scan_path::avx2)) {
+        return scan_path::avx2;
+    }
+    return scan_path_supported(scan_path::sse2) ? scan_path::sse2 : scan_path::scalar;
+}
+
+parser::parser(handler& handler, scan_path path) : handler_(handler), path_(scan_path::scalar), scan_(scan_scalar)
+{
+#ifdef NMEA_X86
+    if (scan_path_supported(path) && (path == scan_path::avx2)) {
+        path_ = path;
+        scan_ = scan_avx2;
+    } else if (path != scan_path::scalar) {
+        path_ = scan_path::sse2;
+        scan_ = scan_sse2;
+    }
+#else
+    (void) path;
+#endif
+}
+
+void parser::reset()
+{
+    state_  = state::idle;
+    length_ = 0;
+}
+
+bool parser::append(const uint8_t* p, size_t n)
+{
+    if (length_ + n > max_sentence) {
+        return false;
+    }
+    std::memcpy(buffer_ + length_, p, n);
+    length_ += n;
+    return true;
+}
+
+void parser::feed(const uint8_t* data, size_t len)
+{
+    const uint8_t*   p        = data;
+    const uint8_t*   end      = data + len;
+    bool             in_place = false;  // The body started in this chunk and is not copied
+    std::string_view sentence;          // The body, when in place
+
+    stats_.bytes += len;
+    while (p < end) {
+        if (state_ == state::idle) {
+            p = static_cast<const uint8_t*>(std::memchr(p, '$', size_t(end - p)));
+            if (p == nullptr) {
+                return;
+            }
+            p++;
+            state_   = state::body;
+            sum_     = 0;
+            length_  = 0;
+            in_place = true;
+            continue;
+        }
+
+        if (state_ == state::body) {
+            uint8_t sum = 0;
+            size_t  n   = scan_(p, size_t(end - p), sum);
+            sum_ ^= sum;
+            if ((!in_place || (p + n == end) || (n > max_sentence)) && !append(p, n)) {
+                stats_.too_long++;
+                state_ = state::idle;
+                p += n;
+                continue;
+            }
+            if (p + n == end) {
+                return;  // The rest comes with the next chunk
+            }
+            sentence = std::string_view(reinterpret_cast<const char*>(p), n);
+            uint8_t c = p[n];
+            p += n + 1;
+            if (c == '*') {
+                state_    = state::checksum;
+                digits_   = 0;
+                received_ = 0;
+            } else if (c == '$') {
+                stats_.truncated++;
+                sum_     = 0;
+                length_  = 0;
+                in_place = true;
+            } else {
+                stats_.truncated++;
+                state_ = state::idle;
+            }
+            continue;
+        }
+
+        // state::checksum
+        for (; (digits_ < 2) && (p < end); p++, digits_++) {
+            uint8_t v = hex_value(*p);
+            if (v > 15) {
+                break;
+            }
+            received_ = uint8_t((received_ << 4) | v);
+        }
+        if (digits_ == 2) {
+            dispatch(in_place ? sentence : std::string_view(buffer_, length_), received_);
+            state_ = state::idle;
+        } else if (p < end) {
+            stats_.checksum_errors++;  // Not a hex digit, left for the idle scan
+            state_ = state::idle;
+        }
+    }
+    if ((state_ == state::checksum) && in_place) {
+        append(reinterpret_cast<const uint8_t*>(sentence.data()), sentence.size());  // Checksum in the next chunk
+    }
+}
+
+void parser::dispatch(std::string_view sentence, uint8_t received)
+{
+    if (received != sum_) {
+        stats_.checksum_errors++;
+        return;
+    }
+    stats_.sentences++;
+    if (!decode_) {
+        handler_.on_sentence(sentence);
+    } else if (!decode(sentence)) {
+        stats_.bad_fields++;
+    }
+}
+
+bool parser::decode(std::string_view sentence)
+{
+    fields f;
+    if (!split(sentence, f)) {
+        return false;
+    }
+
+    std::string_view address = f[0];
+    if ((address.size() == 7) && (address.compare(0, 4, "PMTK") == 0)) {
+        uint16_t type;
+        if (!parse_small(address.substr(4), type)) {
+            return false;
+        }
+        if (type == 1) {
+            pmtk_ack ack;
+            uint8_t  flag;
+            if ((f.count != 3) || !parse_small(f[1], ack.command) || !parse_small(f[2], flag) || (flag > 3)) {
+                return false;
+            }
+            ack.flag = ack_flag(flag);
+            handler_.on_pmtk_ack(ack);
+        } else {
+            pmtk other;
+            other.type = type;
+            other.data = (sentence.size() > 8) ? sentence.substr(8) : std::string_view();
+            handler_.on_pmtk(other);
+        }
+        stats_.pmtk++;
+        return true;
+    }
+
+    if (address.size() == 5) {
+        std::string_view type = address.substr(2);
+        if (type == "GGA") {
+            gga g;
+            if (!decode_gga(f, g)) {
+                return false;
+            }
+            std::memcpy(g.talker, address.data(), 2);
+            handler_.on_gga(g);
+            stats_.gga++;
+            return true;
+        }
+        if (type == "RMC") {
+            rmc r;
+            if (!decode_rmc(f, r)) {
+                return false;
+            }
+            std::memcpy(r.talker, address.data(), 2);
+            handler_.on_rmc(r);
+            stats_.rmc++;
+            return true;
+        }
+        if (type == "GSV") {
+            gsv g;
+            if (!decode_gsv(f, g)) {
+                return false;
+            }
+            std::memcpy(g.talker, address.data(), 2);
+            handler_.on_gsv(g);
+            stats_.gsv++;
+            return true;
+        }
+        if (type == "GSA") {
+            gsa g;
+            if (!decode_gsa(f, g)) {
+                return false;
+            }
+            std::memcpy(g.talker, address.data(), 2);
+            handler_.on_gsa(g);
+            stats_.gsa++;
+            return true;
+        }
+        if (type == "GST") {
+            gst g;
+            if (!decode_gst(f, g)) {
+                return false;
+            }
+            std::memcpy(g.talker, address.data(), 2);
+            handler_.on_gst(g);
+            stats_.gst++;
+            return true;
+        }
+    }
+    handler_.on_sentence(sentence);
+    stats_.other++;
+    return true;
+}
+
+}  // namespace nmea
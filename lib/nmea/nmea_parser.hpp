@@ -0,0 +1,231 @@
+/*!
+ * \file      nmea_parser.hpp
+ *
+ * \brief     Streaming NMEA 0183 and PMTK parser for the MT3333 UART
+ *
+ * The parser takes the UART stream in chunks of any size, finds the
+ * sentences, checks their *hh checksum and decodes GGA, RMC, GSV, GSA, GST
+ * and the PMTK001 acknowledgements into fixed structs. Other valid sentences are
+ * passed on as text. A sentence that lies within one chunk is decoded in
+ * place. Only a sentence split over two chunks is copied to the 128-byte
+ * buffer of the parser. No heap, no exceptions, no floating point: angles
+ * are in 1e-7 degrees, DOPs in hundredths.
+ *
+ * The body of a sentence is scanned for its end ('*', or '$' or '\n' when
+ * it is cut) and XORed for the checksum in a single pass. This pass runs
+ * 4 bytes at a time on the Cortex-M4 (SWAR on 32-bit words), and 16 or 32
+ * bytes at a time with SSE2 or AVX2 on x86 hosts. The path is chosen when
+ * the parser is made, AVX2 only if the CPU has it.
+ */
+
+#ifndef NMEA_PARSER_HPP
+#define NMEA_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nmea {
+
+constexpr size_t  max_sentence = 128;  //!< Bytes between '$' and '*', MTK sentences go beyond the 82 of NMEA 0183
+constexpr size_t  max_fields   = 24;
+constexpr int32_t no_value     = INT32_MIN;
+
+/*!
+ * \brief Implementation of the body scan
+ */
+enum class scan_path { scalar, sse2, avx2 };
+
+const char* scan_path_name(scan_path path);
+
+/*!
+ * \brief Fastest path this build and this CPU support
+ */
+scan_path best_scan_path();
+
+/*!
+ * \brief Whether this build and this CPU support path
+ */
+bool scan_path_supported(scan_path path);
+
+struct utc_time {
+    bool     valid = false;
+    uint8_t  hour = 0, minute = 0, second = 0;
+    uint16_t millisecond = 0;
+};
+
+struct gga {
+    char     talker[2]  = {};      //!< GP, GL, GN, ...
+    utc_time time;
+    int32_t  latitude   = no_value;  //!< 1e-7 degrees, north positive
+    int32_t  longitude  = no_value;  //!< 1e-7 degrees, east positive
+    uint8_t  quality    = 0;       //!< 0 no fix, 1 GPS, 2 DGPS, ...
+    uint8_t  satellites = 0;
+    int32_t  hdop       = no_value;  //!< Hundredths
+    int32_t  altitude   = no_value;  //!< Above mean sea level, cm
+    int32_t  geoid      = no_value;  //!< Geoid separation, cm
+};
+
+struct rmc {
+    char     talker[2] = {};
+    utc_time time;
+    bool     valid     = false;     //!< Status A
+    int32_t  latitude  = no_value;
+    int32_t  longitude = no_value;
+    int32_t  speed     = no_value;  //!< Hundredths of a knot
+    int32_t  course    = no_value;  //!< Hundredths of a degree
+    uint8_t  day = 0, month = 0;
+    uint16_t year      = 0;
+    char     mode      = 0;         //!< A, D, E, N, or 0 before NMEA 2.3
+};
+
+struct gsv_satellite {
+    uint16_t prn       = 0;
+    int16_t  elevation = -1;  //!< Degrees, -1 when not given
+    int16_t  azimuth   = -1;
+    int16_t  snr       = -1;  //!< dB-Hz, -1 when not tracked
+};
+
+struct gsv {
+    char          talker[2] = {};
+    uint8_t       messages  = 0;
+    uint8_t       number    = 0;  //!< 1 to messages
+    uint8_t       in_view   = 0;
+    uint8_t       count     = 0;  //!< Entries of satellites
+    gsv_satellite satellites[4];
+    uint8_t       signal    = 0;  //!< NMEA 4.10 signal ID, 0 when not given
+};
+
+struct gsa {
+    char     talker[2] = {};
+    char     mode      = 0;  //!< A automatic, M manual
+    uint8_t  fix       = 0;  //!< 1 none, 2 2D, 3 3D
+    uint8_t  count     = 0;  //!< Entries of prns
+    uint16_t prns[12]  = {};
+    int32_t  pdop = no_value, hdop = no_value, vdop = no_value;
+    uint8_t  system    = 0;  //!< NMEA 4.10 system ID, 0 when not given
+};
+
+/*!
+ * \brief Error statistics of the fix, one sigma
+ */
+struct gst {
+    char     talker[2] = {};
+    utc_time time;
+    int32_t  rms         = no_value;  //!< Of the range residuals, cm
+    int32_t  major       = no_value;  //!< Error ellipse, cm
+    int32_t  minor       = no_value;
+    int32_t  orientation = no_value;  //!< Of the major axis, hundredths of a degree from north
+    int32_t  latitude    = no_value;  //!< cm
+    int32_t  longitude   = no_value;
+    int32_t  altitude    = no_value;
+};
+
+enum class ack_flag : uint8_t { invalid = 0, unsupported = 1, failed = 2, success = 3 };
+
+/*!
+ * \brief $PMTK001,<command>,<flag>
+ */
+struct pmtk_ack {
+    uint16_t command = 0;
+    ack_flag flag    = ack_flag::invalid;
+};
+
+/*!
+ * \brief Any other $PMTKnnn, e.g. PMTK010 system messages or PMTK705 release
+ */
+struct pmtk {
+    uint16_t         type = 0;
+    std::string_view data;  //!< Fields after the type, without the leading comma
+};
+
+/*!
+ * \brief Sentence counters, as "Get NMEA stats" of the MFG firmware
+ */
+struct stats {
+    uint64_t bytes     = 0;
+    uint32_t sentences = 0;  //!< With a valid checksum
+    uint32_t gga = 0, rmc = 0, gsv = 0, gsa = 0, gst = 0, pmtk = 0, other = 0;
+    uint32_t checksum_errors = 0;
+    uint32_t truncated       = 0;  //!< Cut by '$' or an end of line before '*'
+    uint32_t too_long        = 0;
+    uint32_t bad_fields      = 0;  //!< Valid checksum, fields that do not decode
+};
+
+/*!
+ * \brief Receives the decoded sentences, all valid for the call only
+ */
+class handler {
+public:
+    virtual ~handler() = default;
+
+    virtual void on_gga(const gga&) {}
+    virtual void on_rmc(const rmc&) {}
+    virtual void on_gsv(const gsv&) {}
+    virtual void on_gsa(const gsa&) {}
+    virtual void on_gst(const gst&) {}
+    virtual void on_pmtk_ack(const pmtk_ack&) {}
+    virtual void on_pmtk(const pmtk&) {}
+
+    /*!
+     * \brief Any other valid sentence, or every one when decoding is off
+     *
+     * \param [in] sentence   Text between '$' and '*', e.g. "GNVTG,..."
+     */
+    virtual void on_sentence(std::string_view) {}
+};
+
+class parser {
+public:
+    explicit parser(handler& handler, scan_path path = best_scan_path());
+
+    /*!
+     * \brief Parse the next bytes of the stream
+     */
+    void feed(const uint8_t* data, size_t len);
+
+    /*!
+     * \brief Pass every valid sentence to on_sentence() only, for framing and checksum checks
+     */
+    void set_decode(bool decode) { decode_ = decode; }
+
+    /*!
+     * \brief Drop a partial sentence, e.g. after a speed change of the UART
+     */
+    void reset();
+
+    const nmea::stats& stats() const { return stats_; }
+    void               clear_stats() { stats_ = nmea::stats(); }
+    scan_path          path() const { return path_; }
+
+    /*!
+     * \brief Decode one sentence, text between '$' and '*', without checking it
+     *
+     * \returns False if the fields of a decoded type are malformed
+     */
+    bool decode(std::string_view sentence);
+
+private:
+    enum class state : uint8_t { idle, body, checksum };
+
+    typedef size_t (*scan_fn)(const uint8_t* p, size_t n, uint8_t& sum);
+
+    void dispatch(std::string_view sentence, uint8_t received);
+    bool append(const uint8_t* p, size_t n);
+
+    handler&    handler_;
+    scan_path   path_;
+    scan_fn     scan_;
+    bool        decode_ = true;
+    state       state_  = state::idle;
+    uint8_t     sum_    = 0;  // XOR of the body so far
+    uint8_t     digits_ = 0;  // Checksum digits received
+    uint8_t     received_ = 0;
+    size_t      length_ = 0;  // Bytes in buffer_
+    nmea::stats stats_;
+    char        buffer_[max_sentence];
+};
+
+}  // namespace nmea
+
+#endif  // NMEA_PARSER_HPP
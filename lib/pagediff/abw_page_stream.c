@@ -0,0 +1,190 @@
+/*!
+ * \file      abw_page_stream.c
+ *
+ * \brief     Streaming applier of the page records sent through ABWd
+ */
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "abw_page_stream.h"
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PRIVATE FUNCTIONS DEFINITION --------------------------------------------
+ */
+
+static uint32_t abw_page_stream_get32(const uint8_t* p)
+{
+    return ( uint32_t ) p[0] | (( uint32_t ) p[1] << 8) | (( uint32_t ) p[2] << 16) | (( uint32_t ) p[3] << 24);
+}
+
+static abw_page_stream_status_t abw_page_stream_fail(abw_page_stream_t* ctx, abw_page_stream_status_t status)
+{
+    ctx->status = ( uint8_t ) status;
+    return status;
+}
+
+static abw_page_stream_status_t abw_page_stream_parse_header(abw_page_stream_t* ctx)
+{
+    const uint8_t* h = ctx->header;
+
+    if ((h[0] != 'A') || (h[1] != 'B') || (h[2] != 'W') || (h[3] != 'P') || (h[4] != ABW_PAGE_STREAM_FORMAT) ||
+        (h[5] > 31) || ((1u << h[5]) != ctx->page_size))
+    {
+        return ABW_PAGE_STREAM_ERR_HEADER;
+    }
+    ctx->info.page_shift = h[5];
+    ctx->info.records    = ( uint16_t ) (h[6] | (h[7] << 8));
+    ctx->info.image_len  = abw_page_stream_get32(h + 8);
+    ctx->info.image_crc  = abw_page_stream_get32(h + 12);
+
+    // The size against the slot before any page count, in 64 bits
+    if ((ctx->info.image_len == 0) || (ctx->info.image_len > ( uint64_t ) ctx->slot_pages * ctx->page_size) ||
+        (ctx->info.records > abw_page_stream_image_pages(ctx)))
+    {
+        return ABW_PAGE_STREAM_ERR_HEADER;
+    }
+    return (ctx->info.records == 0) ? ABW_PAGE_STREAM_END : ABW_PAGE_STREAM_OK;
+}
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS DEFINITION ---------------------------------------------
+ */
+
+void abw_page_stream_init(abw_page_stream_t* ctx, const abw_page_stream_flash_t* flash, uint32_t slot_pages,
+                          uint32_t page_size)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->flash      = flash;
+    ctx->slot_pages = slot_pages;
+    ctx->page_size  = page_size;
+    ctx->status     = ABW_PAGE_STREAM_OK;
+}
+
+abw_page_stream_status_t abw_page_stream_write(abw_page_stream_t* ctx, const uint8_t* data, uint32_t len)
+{
+    uint32_t pos = 0;
+
+    if (ctx->status != ABW_PAGE_STREAM_OK)
+    {
+        return ( abw_page_stream_status_t ) ctx->status;
+    }
+
+    if (ctx->header_len < ABW_PAGE_STREAM_HEADER_SIZE)
+    {
+        uint32_t n = ABW_PAGE_STREAM_HEADER_SIZE - ctx->header_len;
+
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(ctx->header + ctx->header_len, data, n);
+        ctx->header_len += n;
+        pos = n;
+        if (ctx->header_len < ABW_PAGE_STREAM_HEADER_SIZE)
+        {
+            return ABW_PAGE_STREAM_OK;
+        }
+        ctx->status = ( uint8_t ) abw_page_stream_parse_header(ctx);
+        if (ctx->status != ABW_PAGE_STREAM_OK)
+        {
+            return ( abw_page_stream_status_t ) ctx->status;
+        }
+    }
+
+    while (pos < len)
+    {
+        // Page index, then the page itself
+        if (ctx->offset < 2)
+        {
+            ctx->page |= ( uint32_t ) data[pos++] << (8 * ctx->offset);
+            ctx->offset++;
+            if (ctx->offset < 2)
+            {
+                continue;
+            }
+            if (ctx->page >= abw_page_stream_image_pages(ctx))
+            {
+                return abw_page_stream_fail(ctx, ABW_PAGE_STREAM_ERR_PAGE);
+            }
+            if (ctx->flash->erase(ctx->flash->ctx, ctx->page) != 0)
+            {
+                return abw_page_stream_fail(ctx, ABW_PAGE_STREAM_ERR_FLASH);
+            }
+            continue;
+        }
+
+        {
+            uint32_t in_page = ctx->offset - 2;
+            uint32_t n       = ctx->page_size - in_page;
+
+            if (n > (len - pos))
+            {
+                n = len - pos;
+            }
+
+            // Complete a pending double word, then program whole ones straight from the input
+            if ((ctx->unit_len > 0) || (n < ABW_PAGE_STREAM_PROGRAM_SIZE))
+            {
+                uint32_t take = ABW_PAGE_STREAM_PROGRAM_SIZE - ctx->unit_len;
+
+                if (take > n)
+                {
+                    take = n;
+                }
+                memcpy(ctx->unit + ctx->unit_len, data + pos, take);
+                ctx->unit_len = ( uint8_t ) (ctx->unit_len + take);
+                pos += take;
+                ctx->offset += take;
+                if (ctx->unit_len == ABW_PAGE_STREAM_PROGRAM_SIZE)
+                {
+                    if (ctx->flash->program(ctx->flash->ctx, ctx->page, in_page + take - ABW_PAGE_STREAM_PROGRAM_SIZE,
+                                            ctx->unit, ABW_PAGE_STREAM_PROGRAM_SIZE) != 0)
+                    {
+                        return abw_page_stream_fail(ctx, ABW_PAGE_STREAM_ERR_FLASH);
+                    }
+                    ctx->unit_len = 0;
+                }
+            }
+            else
+            {
+                n &= ~( uint32_t ) (ABW_PAGE_STREAM_PROGRAM_SIZE - 1);
+                if (ctx->flash->program(ctx->flash->ctx, ctx->page, in_page, data + pos, n) != 0)
+                {
+                    return abw_page_stream_fail(ctx, ABW_PAGE_STREAM_ERR_FLASH);
+                }
+                pos += n;
+                ctx->offset += n;
+            }
+        }
+
+        if (ctx->offset == ctx->page_size + 2)
+        {
+            ctx->records++;
+            ctx->page   = 0;
+            ctx->offset = 0;
+            if (ctx->records == ctx->info.records)
+            {
+                ctx->status = ABW_PAGE_STREAM_END;
+                return ABW_PAGE_STREAM_END;
+            }
+        }
+    }
+    return ABW_PAGE_STREAM_OK;
+}
+
+const abw_page_stream_info_t* abw_page_stream_get_info(const abw_page_stream_t* ctx)
+{
+    return &ctx->info;
+}
+
+uint32_t abw_page_stream_image_pages(const abw_page_stream_t* ctx)
+{
+    return (ctx->info.image_len / ctx->page_size) + ((ctx->info.image_len % ctx->page_size) != 0);
+}
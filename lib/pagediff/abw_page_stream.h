@@ -0,0 +1,174 @@
+/*!
+ * \file      abw_page_stream.h
+ *
+ * \brief     Bootloader side of the differential application update (ABWh and ABWd)
+ *
+ * The host first asks for the digest of every flash page of the
+ * application slot (ABWh), then sends over XMODEM (ABWd) a page stream
+ * with only the pages whose content differs. The bootloader feeds the
+ * XMODEM payload to abw_page_stream_write() as it arrives. Each page is
+ * erased when its record starts and programmed in double words, so no page
+ * buffer is needed. Once the stream has ended, the bootloader checks the
+ * CRC-32 of the whole image in flash and erases the pages past its end.
+ *
+ * ABWh answer, one line each, then the bootloader prompt:
+ *
+ *   Pages <n> <page size>
+ *   <CRC-32 of page 0, 8 hex digits>
+ *   ...
+ *   <CRC-32 of page n - 1>
+ *
+ * where n is the number of pages up to the last one that is not erased.
+ *
+ * Page stream (all multi-byte fields little-endian):
+ *
+ *   offset  size  field
+ *   0       4     magic "ABWP"
+ *   4       1     format, ABW_PAGE_STREAM_FORMAT
+ *   5       1     log2 of the page size, 12 for the 4 KiB pages of the STM32WB
+ *   6       2     number of records
+ *   8       4     image size in bytes
+ *   12      4     CRC-32 of the image
+ *   16      ...   records: page index (2 bytes), then the whole page
+ *
+ * The bytes of the last page past the image are 0xFF. Whatever follows the
+ * last record, such as XMODEM padding, is ignored.
+ */
+
+#ifndef ABW_PAGE_STREAM_H
+#define ABW_PAGE_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Size in bytes of the stream header
+ */
+#define ABW_PAGE_STREAM_HEADER_SIZE 16
+
+/*!
+ * \brief Stream format handled by the applier
+ */
+#define ABW_PAGE_STREAM_FORMAT 1
+
+/*!
+ * \brief Programming unit, the double word of the STM32WB flash
+ */
+#define ABW_PAGE_STREAM_PROGRAM_SIZE 8
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC TYPES ------------------------------------------------------------
+ */
+
+/*!
+ * \brief Applier status
+ */
+typedef enum abw_page_stream_status_e
+{
+    ABW_PAGE_STREAM_OK = 0,        //!< Data consumed, more expected
+    ABW_PAGE_STREAM_END,           //!< The last record has been programmed
+    ABW_PAGE_STREAM_ERR_HEADER,    //!< Bad magic, format or page size, or an image larger than the slot
+    ABW_PAGE_STREAM_ERR_PAGE,      //!< Record for a page outside the image
+    ABW_PAGE_STREAM_ERR_FLASH,     //!< The erase or program callback failed
+} abw_page_stream_status_t;
+
+/*!
+ * \brief Header fields of a stream
+ */
+typedef struct abw_page_stream_info_s
+{
+    uint8_t  page_shift;  //!< log2 of the page size
+    uint16_t records;     //!< Number of pages in the stream
+    uint32_t image_len;   //!< Size of the image in bytes
+    uint32_t image_crc;   //!< CRC-32 of the image
+} abw_page_stream_info_t;
+
+/*!
+ * \brief Flash access of the bootloader
+ *
+ * Both return 0 on success. program() is called with offsets and lengths
+ * that are multiples of ABW_PAGE_STREAM_PROGRAM_SIZE, within one page.
+ */
+typedef struct abw_page_stream_flash_s
+{
+    int ( *erase )(void* ctx, uint32_t page);
+    int ( *program )(void* ctx, uint32_t page, uint32_t offset, const uint8_t* data, uint32_t len);
+    void* ctx;
+} abw_page_stream_flash_t;
+
+/*!
+ * \brief Applier context
+ *
+ * Fields are private to the applier.
+ */
+typedef struct abw_page_stream_s
+{
+    const abw_page_stream_flash_t* flash;
+    uint32_t                       slot_pages;  //!< Pages of the application slot
+    uint32_t                       page_size;   //!< ABW_PAGE_STREAM_FORMAT only knows 4 KiB pages
+    abw_page_stream_info_t         info;
+    uint8_t                        header[ABW_PAGE_STREAM_HEADER_SIZE];
+    uint32_t                       header_len;  //!< Header bytes received
+    uint32_t                       records;     //!< Records completed
+    uint32_t                       page;        //!< Page of the record in progress
+    uint32_t                       offset;      //!< Offset in the record, index included
+    uint8_t                        unit[ABW_PAGE_STREAM_PROGRAM_SIZE];
+    uint8_t                        unit_len;    //!< Bytes waiting in unit
+    uint8_t                        status;      //!< Sticky error or end
+} abw_page_stream_t;
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Prepare an applier for a new stream
+ *
+ * \param [out] ctx        Applier context
+ * \param [in]  flash      Flash access, must stay valid while applying
+ * \param [in]  slot_pages Number of pages of the application slot
+ * \param [in]  page_size  Flash page size in bytes, 4096 on the STM32WB
+ */
+void abw_page_stream_init(abw_page_stream_t* ctx, const abw_page_stream_flash_t* flash, uint32_t slot_pages,
+                          uint32_t page_size);
+
+/*!
+ * \brief Apply the next bytes of the stream, as received
+ *
+ * \returns ABW_PAGE_STREAM_OK while more records are expected,
+ *          ABW_PAGE_STREAM_END once the last one is programmed, an error
+ *          otherwise. Errors and the end are sticky.
+ */
+abw_page_stream_status_t abw_page_stream_write(abw_page_stream_t* ctx, const uint8_t* data, uint32_t len);
+
+/*!
+ * \brief Header of the stream, valid once abw_page_stream_write() has returned something else than an
+ *        ABW_PAGE_STREAM_ERR_HEADER after the first 16 bytes
+ */
+const abw_page_stream_info_t* abw_page_stream_get_info(const abw_page_stream_t* ctx);
+
+/*!
+ * \brief Pages covered by the image of the stream
+ */
+uint32_t abw_page_stream_image_pages(const abw_page_stream_t* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_PAGE_STREAM_H
@@ -0,0 +1,78 @@
+/*!
+ * \file      abw_sha256.h
+ *
+ * \brief     Incremental SHA-256 (FIPS 180-4) for firmware image verification
+ */
+
+#ifndef ABW_SHA256_H
+#define ABW_SHA256_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- DEPENDENCIES ------------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC CONSTANTS --------------------------------------------------------
+ */
+
+/*!
+ * \brief Size in bytes of a digest
+ */
+#define ABW_SHA256_DIGEST_SIZE 32
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC TYPES ------------------------------------------------------------
+ */
+
+/*!
+ * \brief Hash context, fields are private
+ */
+typedef struct abw_sha256_s
+{
+    uint32_t state[8];   //!< Intermediate hash value
+    uint64_t length;     //!< Bytes hashed so far
+    uint8_t  block[64];  //!< Pending partial block
+} abw_sha256_t;
+
+/*
+ * -----------------------------------------------------------------------------
+ * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
+ */
+
+/*!
+ * \brief Start a new hash
+ */
+void abw_sha256_init(abw_sha256_t* ctx);
+
+/*!
+ * \brief Add bytes to the hash
+ */
+void abw_sha256_update(abw_sha256_t* ctx, const uint8_t* data, uint32_t len);
+
+/*!
+ * \brief Add 32-bit words to the hash, most significant byte first (.bin order)
+ */
+void abw_sha256_update_words(abw_sha256_t* ctx, const uint32_t* words, uint32_t count);
+
+/*!
+ * \brief Finish the hash
+ *
+ * \param [in]  ctx    Hash context, must be initialized again before reuse
+ * \param [out] digest ABW_SHA256_DIGEST_SIZE bytes
+ */
+void abw_sha256_final(abw_sha256_t* ctx, uint8_t digest[ABW_SHA256_DIGEST_SIZE]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ABW_SHA256_H
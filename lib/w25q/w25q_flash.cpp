@@ -0,0 +1,119 @@
+/*!
+ * \file      w25q_flash.cpp
+ *
+ * \brief     Winbond W25Q serial NOR flash driver (W25Q16JL of the EVB)
+ */
+
+#include "w25q_flash.hpp"
+
+namespace w25q {
+
+void flash::address_command(uint8_t opcode, uint32_t address, uint8_t* cmd)
+{
+    cmd[0] = opcode;
+    cmd[1] = uint8_t(address >> 16);
+    cmd[2] = uint8_t(address >> 8);
+    cmd[3] = uint8_t(address);
+}
+
+bool flash::probe()
+{
+    uint8_t cmd = read_jedec_id_oc;
+    uint8_t id[3];
+
+    if (!bus_.transfer(&cmd, 1, id, sizeof(id)) || (id[0] != winbond_id) || (id[2] < 16) || (id[2] > 24)) {
+        return false;
+    }
+    // The capacity byte is log2 of the size in bytes: 0x15 for the 2 MiB W25Q16JL
+    device_id_ = uint16_t((id[1] << 8) | id[2]);
+    size_      = uint32_t(1) << id[2];
+    return true;
+}
+
+bool flash::read(uint32_t address, uint8_t* dst, uint32_t len)
+{
+    return read_start(address, dst, len) && read_wait();
+}
+
+bool flash::read_start(uint32_t address, uint8_t* dst, uint32_t len)
+{
+    uint8_t cmd[5];
+
+    if ((address + len) > size_) {
+        return false;
+    }
+    address_command(fast_read_oc, address, cmd);
+    cmd[4] = 0;  // Dummy byte
+    return bus_.read_start(cmd, sizeof(cmd), dst, len);
+}
+
+bool flash::write_enable()
+{
+    uint8_t cmd = write_enable_oc;
+
+    return bus_.transfer(&cmd, 1, nullptr, 0);
+}
+
+bool flash::wait_ready(uint32_t timeout_us)
+{
+    uint8_t  cmd   = read_status_oc;
+    uint8_t  status;
+    uint32_t start = bus_.now_us();
+
+    do {
+        if (!bus_.transfer(&cmd, 1, &status, 1)) {
+            return false;
+        }
+        if (!(status & status_busy)) {
+            return true;
+        }
+    } while ((bus_.now_us() - start) < timeout_us);
+    return false;
+}
+
+bool flash::program(uint32_t address, const uint8_t* src, uint32_t len)
+{
+    uint8_t frame[4 + page_size];
+
+    if ((address + len) > size_) {
+        return false;
+    }
+    while (len) {
+        // A page program wraps around within its page: stop at the boundary
+        uint32_t count = page_size - (address % page_size);
+        if (count > len) {
+            count = len;
+        }
+        address_command(page_program_oc, address, frame);
+        for (uint32_t i = 0; i < count; i++) {
+            frame[4 + i] = src[i];
+        }
+        if (!write_enable() || !bus_.transfer(frame, 4 + count, nullptr, 0) || !wait_ready(program_timeout)) {
+            return false;
+        }
+        address += count;
+        src += count;
+        len -= count;
+    }
+    return true;
+}
+
+bool flash::erase_sector(uint32_t address)
+{
+    uint8_t cmd[4];
+
+    address_command(sector_erase_oc, address, cmd);
+    return (address < size_) && write_enable() && bus_.transfer(cmd, sizeof(cmd), nullptr, 0) &&
+           wait_ready(sector_timeout);
+}
+
+bool flash::erase_block(uint32_t address)
+{
+    uint8_t cmd[4];
+
+    address_command(block_erase_oc, address, cmd);
+    return (address < size_) && write_enable() && bus_.transfer(cmd, sizeof(cmd), nullptr, 0) &&
+           wait_ready(block_timeout);
+}
+
+}  // namespace w25q
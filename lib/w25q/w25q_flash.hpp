@@ -0,0 +1,115 @@
+/*!
+ * \file      w25q_flash.hpp
+ *
+ * \brief     Winbond W25Q serial NOR flash driver (W25Q16JL of the EVB)
+ *
+ * Standard SPI commands only: JEDEC ID, fast read, page program, 4 KiB
+ * sector and 64 KiB block erase, status polling. Reads can be started
+ * without waiting for them, e.g. on a DMA channel, so that a consumer can
+ * fetch the next block while it processes the current one.
+ *
+ * The bus is an interface, as for the LR11xx update engine: the driver runs
+ * on the STM32WB and on a host against a simulated chip. No heap, no
+ * exceptions.
+ */
+
+#ifndef W25Q_FLASH_HPP
+#define W25Q_FLASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace w25q {
+
+constexpr uint8_t  read_jedec_id_oc  = 0x9F;
+constexpr uint8_t  fast_read_oc      = 0x0B;
+constexpr uint8_t  write_enable_oc   = 0x06;
+constexpr uint8_t  page_program_oc   = 0x02;
+constexpr uint8_t  sector_erase_oc   = 0x20;
+constexpr uint8_t  block_erase_oc    = 0xD8;
+constexpr uint8_t  read_status_oc    = 0x05;
+constexpr uint8_t  status_busy       = 0x01;
+constexpr uint8_t  winbond_id        = 0xEF;
+constexpr uint32_t page_size         = 256;
+constexpr uint32_t sector_size       = 4096;
+constexpr uint32_t block_size        = 65536;
+constexpr uint32_t program_timeout   = 3000;     //!< tPP max, us
+constexpr uint32_t sector_timeout    = 400000;   //!< tSE max, us
+constexpr uint32_t block_timeout     = 2000000;  //!< tBE2 max, us
+
+/*!
+ * \brief SPI access to the chip, one chip-select frame per call
+ */
+class bus {
+public:
+    virtual ~bus() = default;
+
+    /*!
+     * \brief Send tx, then clock in rx_len bytes, in one frame
+     */
+    virtual bool transfer(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) = 0;
+
+    /*!
+     * \brief Start a transfer that completes in the background
+     *
+     * The default runs it at once. rx must stay valid until read_wait().
+     */
+    virtual bool read_start(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len)
+    {
+        return transfer(tx, tx_len, rx, rx_len);
+    }
+
+    /*!
+     * \brief Wait for the transfer started by read_start()
+     */
+    virtual bool read_wait() { return true; }
+
+    /*!
+     * \brief Monotonic time in microseconds, for timeouts
+     */
+    virtual uint32_t now_us() = 0;
+};
+
+class flash {
+public:
+    explicit flash(bus& bus) : bus_(bus) {}
+
+    /*!
+     * \brief Read the JEDEC ID and the size of the chip
+     *
+     * \returns False if no Winbond chip answers
+     */
+    bool probe();
+
+    uint32_t size() const { return size_; }
+    uint16_t device_id() const { return device_id_; }
+
+    bool read(uint32_t address, uint8_t* dst, uint32_t len);
+
+    /*!
+     * \brief Start a read completed by read_wait(), dst must stay valid until then
+     */
+    bool read_start(uint32_t address, uint8_t* dst, uint32_t len);
+    bool read_wait() { return bus_.read_wait(); }
+
+    /*!
+     * \brief Program erased bytes, split into page programs
+     */
+    bool program(uint32_t address, const uint8_t* src, uint32_t len);
+
+    bool erase_sector(uint32_t address);
+    bool erase_block(uint32_t address);
+
+private:
+    bool write_enable();
+    bool wait_ready(uint32_t timeout_us);
+    void address_command(uint8_t opcode, uint32_t address, uint8_t* cmd);
+
+    bus&     bus_;
+    uint32_t size_      = 0;
+    uint16_t device_id_ = 0;
+};
+
+}  // namespace w25q
+
+#endif  // W25Q_FLASH_HPP
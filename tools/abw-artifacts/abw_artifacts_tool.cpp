@@ -0,0 +1,216 @@
+/*!
+ * \file      abw_artifacts_tool.cpp
+ *
+ * \brief     Manifest and integrity check of the firmware-binaries tree
+ *
+ * Usage:
+ *   abw-artifacts manifest [--json] [--cache FILE | --no-cache] [dir]
+ *   abw-artifacts verify   [--cache FILE | --no-cache] [dir]
+ *   abw-artifacts check    [--bootloader] [--repeat N] <file.bin>...
+ *
+ * dir defaults to firmware-binaries. manifest lists each artifact with its
+ * size, digests, component, version and load address; --json prints the
+ * same as a JSON array. verify checks every file that has an md5sum file
+ * next to it, and fails if one does not match or if a known component is
+ * missing, or if the vector table of the MFG application or the bootloader
+ * does not fit its flash slot.
+ *
+ * check runs the vector table check of tools/common/abw_app_image.hpp on
+ * candidate images, as an application for ABWu (0x08006000 to 0x080CE000)
+ * or with --bootloader as a bootloader. --repeat times the map and check
+ * of each file over N runs.
+ *
+ * Digests are cached in ${XDG_CACHE_HOME:-~/.cache}/abw-artifacts.cache,
+ * see tools/common/abw_artifacts.hpp.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abw_app_image.hpp"
+#include "abw_artifacts.hpp"
+
+namespace {
+
+int usage()
+{
+    std::cerr << "usage: abw-artifacts manifest [--json] [--cache FILE | --no-cache] [dir]\n"
+                 "       abw-artifacts verify   [--cache FILE | --no-cache] [dir]\n"
+                 "       abw-artifacts check    [--bootloader] [--repeat N] <file.bin>...\n";
+    return 2;
+}
+
+void print_table(const std::vector<abw::artifact>& artifacts)
+{
+    for (const auto& a : artifacts) {
+        char address[16] = "-";
+        if (a.load_address != abw::no_load_address) {
+            std::snprintf(address, sizeof(address), "0x%08X", unsigned(a.load_address));
+        }
+        std::printf("%-64s %8llu %-13s %-8s %-10s %s%s\n", a.path.c_str(), (unsigned long long)a.size,
+                    a.component.empty() ? "-" : a.component.c_str(), a.version.empty() ? "-" : a.version.c_str(),
+                    address, a.sha256.c_str(),
+                    a.md5_expected.empty() ? "" : a.md5_matches() ? " md5 ok" : " MD5 MISMATCH");
+    }
+}
+
+bool verify(const std::string& dir, const std::vector<abw::artifact>& artifacts)
+{
+    bool ok = true;
+    for (const auto& a : artifacts) {
+        if (!a.md5_matches()) {
+            std::printf("%s: md5 %s, %s.md5 says %s\n", a.path.c_str(), a.md5.c_str(), a.path.c_str(),
+                        a.md5_expected.c_str());
+            ok = false;
+        }
+        if (a.component == "mfg" || a.component == "bootloader") {
+            abw::mapped_file  file(dir + "/" + a.path);
+            abw::vector_check c = abw::check_vectors(file.data(), file.size(),
+                                                     a.component == "mfg" ? abw::app_slot : abw::bootloader_slot);
+            if (!c.ok) {
+                std::printf("%s: %s\n", a.path.c_str(), c.error.c_str());
+                ok = false;
+            }
+        }
+    }
+    for (const auto& rule : abw::artifact_rules) {
+        bool found = false;
+        for (const auto& a : artifacts) {
+            found = found || a.component == rule.component;
+        }
+        if (!found) {
+            std::printf("no %s artifact\n", rule.component);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/*!
+ * \brief Check candidate images, timing the mapping and the check of each
+ */
+bool check(const std::vector<std::string>& files, const abw::flash_slot& slot, unsigned repeat)
+{
+    using clock_type = std::chrono::steady_clock;
+
+    bool ok = true;
+    for (const auto& path : files) {
+        abw::vector_check c;
+        double            map_us   = 0;
+        double            check_us = 0;  // First read of the table, with its page fault
+        double            warm_us  = 0;
+        for (unsigned run = 0; run < repeat; run++) {
+            auto             t0 = clock_type::now();
+            abw::mapped_file file(path);
+            auto             t1 = clock_type::now();
+            c                   = abw::check_vectors(file.data(), file.size(), slot);
+            auto t2             = clock_type::now();
+            c                   = abw::check_vectors(file.data(), file.size(), slot);
+            auto t3             = clock_type::now();
+            map_us += std::chrono::duration<double, std::micro>(t1 - t0).count();
+            check_us += std::chrono::duration<double, std::micro>(t2 - t1).count();
+            warm_us += std::chrono::duration<double, std::micro>(t3 - t2).count();
+        }
+
+        if (c.ok) {
+            std::printf("%s: ok, SP 0x%08X, reset 0x%08X, ends at 0x%08X, %u bytes free in the %s slot\n",
+                        path.c_str(), unsigned(c.initial_sp), unsigned(c.reset), unsigned(c.end),
+                        unsigned(slot.limit - c.end), slot.name);
+        } else {
+            std::printf("%s: REJECTED, %s\n", path.c_str(), c.error.c_str());
+            ok = false;
+        }
+        std::fprintf(stderr, "%s: map %.2f us, check %.2f us, %.3f us once the table is in memory\n", path.c_str(),
+                     map_us / repeat, check_us / repeat, warm_us / repeat);
+    }
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd        = argv[1];
+    std::string              dir        = "firmware-binaries";
+    std::string              cache_path = abw::digest_cache::default_path();
+    bool                     json       = false;
+    const abw::flash_slot*   slot       = &abw::app_slot;
+    unsigned                 repeat     = 1;
+    std::vector<std::string> files;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            std::string option = argv[i];
+            if (cmd == "check" && option == "--bootloader") {
+                slot = &abw::bootloader_slot;
+            } else if (cmd == "check" && option == "--repeat" && i + 1 < argc) {
+                repeat = std::max(1u, unsigned(std::stoul(argv[++i])));
+            } else if (cmd == "check" && option.compare(0, 2, "--")) {
+                files.push_back(option);
+            } else if (option == "--json") {
+                json = true;
+            } else if (option == "--no-cache") {
+                cache_path.clear();
+            } else if (option == "--cache" && i + 1 < argc) {
+                cache_path = argv[++i];
+            } else if (option.compare(0, 2, "--")) {
+                dir = option;
+            } else {
+                return usage();
+            }
+        }
+
+        if (cmd == "check") {
+            if (files.empty()) {
+                return usage();
+            }
+            if (!check(files, *slot, repeat)) {
+                std::cerr << "abw-artifacts: image rejected\n";
+                return 1;
+            }
+            return 0;
+        }
+
+        using clock_type = std::chrono::steady_clock;
+        auto                               start = clock_type::now();
+        std::unique_ptr<abw::digest_cache> cache;
+        if (!cache_path.empty()) {
+            cache.reset(new abw::digest_cache(cache_path));
+        }
+        abw::scan_stats stats;
+        auto            artifacts = abw::scan_artifacts(dir, cache.get(), &stats);
+        double          ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+
+        bool ok = true;
+        if (cmd == "manifest") {
+            if (json) {
+                std::fputs(abw::manifest_json(artifacts).c_str(), stdout);
+            } else {
+                print_table(artifacts);
+            }
+        } else if (cmd == "verify") {
+            ok = verify(dir, artifacts);
+        } else {
+            return usage();
+        }
+        std::fprintf(stderr, "%zu artifacts, %zu hashed (%llu bytes), %zu from the cache, %.2f ms\n", stats.files,
+                     stats.hashed, (unsigned long long)stats.bytes_hashed, stats.cached, ms);
+        if (!ok) {
+            std::cerr << "abw-artifacts: verification failed\n";
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "abw-artifacts: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,348 @@
+/*!
+ * \file      abw_delta_tool.cpp
+ *
+ * \brief     Patch generator, applier and benchmark for LR11xx firmware deltas
+ *
+ * Usage:
+ *   abw-delta diff  [--version V] [--update-to N] <old.bin> <new.bin> <patch>
+ *   abw-delta apply <old.bin> <patch> <new.bin>
+ *   abw-delta bench [--seed N] [--chain N] [base.bin]
+ *
+ * diff writes a patch for lib/delta/abw_delta.c; --version and --update-to
+ * fill the identity of the new image in its header (LR11XX_FIRMWARE_VERSION
+ * and LR11XX_FIRMWARE_UPDATE_TO). apply rebuilds the new image with the
+ * applier, 64 words at a time, and checks its SHA-256.
+ *
+ * bench derives synthetic releases from a base image (by default the
+ * LR1110 transceiver 0308) and reports, for each, the patch size, the diff
+ * time and the apply throughput. Each new image is then pushed to a
+ * simulated LR11xx by the update engine through lr11xx::delta_source. A
+ * patch with one flipped byte, or applied to another base of the same size,
+ * must be refused before the engine erases the chip.
+ * Crafted patches (a copy whose bounds wrap in 32 bits, a copy moving back
+ * by INT32_MIN, a new image over the size limit) must be refused by the
+ * applier.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abw_delta_encoder.hpp"
+#include "abw_file.hpp"
+#include "abw_releases.hpp"
+#include "lr11xx_delta_source.hpp"
+#include "lr11xx_sim.hpp"
+#include "lr11xx_update_engine.hpp"
+
+extern "C" {
+#include "abw_delta.h"
+}
+
+namespace {
+
+constexpr uint32_t    chunk_bytes     = lr11xx::bootloader::chunk_words * 4;
+constexpr uint32_t    max_image_bytes = 256 * 1024;  //!< Largest new image accepted from a patch
+constexpr const char* default_base    = "firmware-binaries/lr11xx/lr1110_transceiver_0308/lr1110_transceiver_0308.bin";
+
+const char* status_name(abw_delta_status_t status)
+{
+    switch (status) {
+    case ABW_DELTA_OK:
+        return "ok";
+    case ABW_DELTA_END:
+        return "end";
+    case ABW_DELTA_ERR_HEADER:
+        return "bad patch header";
+    case ABW_DELTA_ERR_BASE:
+        return "patch made for another base image";
+    case ABW_DELTA_ERR_CORRUPT:
+        return "corrupt patch";
+    case ABW_DELTA_ERR_DIGEST:
+        return "rebuilt image does not match the patch SHA-256";
+    }
+    return "?";
+}
+
+/*!
+ * \brief Rebuild the new image 64 words at a time, throws std::runtime_error on failure
+ */
+std::vector<uint8_t> apply_patch(const std::vector<uint8_t>& base, const std::vector<uint8_t>& patch)
+{
+    auto               ctx    = std::make_unique<abw_delta_t>();
+    abw_delta_status_t status = abw_delta_init(ctx.get(), patch.data(), uint32_t(patch.size()), base.data(),
+                                               uint32_t(base.size()), max_image_bytes);
+    if (status == ABW_DELTA_OK) {
+        status = abw_delta_check_base(ctx.get());
+    }
+    if (status != ABW_DELTA_OK) {
+        throw std::runtime_error(status_name(status));
+    }
+
+    std::vector<uint8_t> out(abw_delta_get_info(ctx.get())->target_len);
+    uint32_t             at = 0;
+    while (status == ABW_DELTA_OK) {
+        uint32_t got = 0;
+        status       = abw_delta_read(ctx.get(), out.data() + at,
+                                      std::min<uint32_t>(chunk_bytes, uint32_t(out.size()) - at), &got);
+        at += got;
+    }
+    if (status != ABW_DELTA_END) {
+        throw std::runtime_error(status_name(status));
+    }
+    return out;
+}
+
+std::vector<uint32_t> host_words(const std::vector<uint8_t>& wire)
+{
+    std::vector<uint32_t> words(wire.size() / 4);
+    for (size_t i = 0; i < words.size(); i++) {
+        const uint8_t* b = &wire[i * 4];
+        words[i]         = uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3];
+    }
+    return words;
+}
+
+/*!
+ * \brief Update a simulated LR11xx running base to the image of the patch
+ *
+ * The patch is not sent if the source refuses it, as the MFG firmware would
+ * do: status then holds the refusal and the chip still runs the old image.
+ *
+ * \returns True if the engine succeeded and the chip runs the new image
+ */
+bool update(const std::vector<uint32_t>& base, const std::vector<uint8_t>& target, const std::vector<uint8_t>& patch,
+            uint16_t version, abw_delta_status_t& refused, lr11xx::update_status& status, uint32_t& update_us)
+{
+    std::vector<uint32_t> image = host_words(target);
+    abw::lr11xx_sim       sim(image.data(), uint32_t(image.size()), version, {}, uint16_t(version - 1));
+    lr11xx::delta_source  source(patch.data(), uint32_t(patch.size()), base.data(), uint32_t(base.size()),
+                                 max_image_bytes / 4);
+    lr11xx::update_engine engine(sim, source);
+    lr11xx::update_config config;
+
+    refused   = source.status();
+    update_us = 0;
+    if (refused != ABW_DELTA_OK) {
+        status = lr11xx::update_status::source_error;
+        return false;
+    }
+
+    config.image_words      = source.words();
+    config.expected_version = source.info().version;
+    config.check_crc        = true;
+    config.expected_crc     = source.info().target_crc;
+
+    status    = engine.run(config);
+    update_us = engine.stats().total_us;
+    return status == lr11xx::update_status::ok && !sim.in_bootloader() && sim.running_version() == version;
+}
+
+/*!
+ * \brief Apply a patch up to its end or its first error
+ */
+abw_delta_status_t apply_status(const std::vector<uint8_t>& base, const std::vector<uint8_t>& patch,
+                                uint32_t max_target_len)
+{
+    abw_delta_t        ctx;
+    uint8_t            chunk[chunk_bytes];
+    abw_delta_status_t status = abw_delta_init(&ctx, patch.data(), uint32_t(patch.size()), base.data(),
+                                               uint32_t(base.size()), max_target_len);
+    while (status == ABW_DELTA_OK) {
+        status = abw_delta_read(&ctx, chunk, sizeof(chunk), nullptr);
+    }
+    return status;
+}
+
+/*!
+ * \brief Patches an applier must refuse, each with the status it must return
+ *
+ * header is the header of a valid patch for base; the crafted ones announce
+ * a new image of 4 GiB so that only the copy bounds can stop them.
+ */
+bool check_corrupt(const std::vector<uint8_t>& base, const std::vector<uint8_t>& header)
+{
+    using abw::delta_detail::put_varint;
+
+    struct crafted {
+        const char*          name;
+        std::vector<uint8_t> patch;
+        uint32_t             max_target_len;
+        abw_delta_status_t   expected;
+    };
+    std::vector<uint8_t> huge = header;
+    huge[16] = huge[17] = huge[18] = huge[19] = 0xFF;
+
+    // 16 bytes from the start, then 2^31 - 1 bytes 2^31 - 1 further: the end wraps past 2^32 to 14
+    crafted wrap = {"wrapping copy", huge, UINT32_MAX, ABW_DELTA_ERR_CORRUPT};
+    put_varint(wrap.patch, 16 << 1 | 1);
+    put_varint(wrap.patch, 0);
+    put_varint(wrap.patch, UINT32_MAX);
+    put_varint(wrap.patch, UINT32_MAX - 1);
+
+    // Zigzag 0xFFFFFFFF is a move of INT32_MIN, whose negation does not fit an int32_t
+    crafted back = {"INT32_MIN copy", huge, UINT32_MAX, ABW_DELTA_ERR_CORRUPT};
+    put_varint(back.patch, 16 << 1 | 1);
+    put_varint(back.patch, 0);
+    put_varint(back.patch, 4 << 1 | 1);
+    put_varint(back.patch, UINT32_MAX);
+
+    crafted large = {"oversized image", huge, max_image_bytes, ABW_DELTA_ERR_HEADER};
+    put_varint(large.patch, 16 << 1 | 1);
+    put_varint(large.patch, 0);
+
+    bool ok = true;
+    for (const crafted& c : {wrap, back, large}) {
+        abw_delta_status_t status = apply_status(base, c.patch, c.max_target_len);
+        if (status != c.expected) {
+            std::printf("%-16s returned \"%s\" instead of \"%s\"\n", c.name, status_name(status),
+                        status_name(c.expected));
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void bench(const std::string& path, uint32_t seed, unsigned chain)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<uint8_t> base = abw::read_file(path);
+    base.resize(base.size() & ~size_t(3));
+    std::vector<uint32_t> base_words = host_words(base);
+
+    std::printf("base %s, %zu bytes, applier RAM %zu bytes (abw_delta_t) + %u bytes (chunk)\n",
+                abw::base_name(path).c_str(), base.size(), sizeof(abw_delta_t), unsigned(chunk_bytes));
+    std::printf("%-12s %-44s %8s %8s %7s %9s %10s %9s\n", "release", "changes", "size", "patch", "ratio", "diff ms",
+                "apply MB/s", "update");
+
+    uint16_t             version = 0x0309;
+    bool                 ok      = true;
+    std::vector<uint8_t> header;
+    for (const auto& r : abw::make_releases(base, seed)) {
+        abw::delta_target identity;
+        identity.version = version;
+
+        auto                 t0    = clock::now();
+        std::vector<uint8_t> patch = abw::delta_encode(base, r.image, identity, nullptr, chain);
+        double               t_enc = std::chrono::duration<double>(clock::now() - t0).count();
+        header.assign(patch.begin(), patch.begin() + ABW_DELTA_HEADER_SIZE);
+
+        // Repeat until the measurement is long enough to be meaningful
+        double   t_apply = 0;
+        unsigned rounds  = 0;
+        while (t_apply < 0.3) {
+            auto                 t1    = clock::now();
+            std::vector<uint8_t> built = apply_patch(base, patch);
+            t_apply += std::chrono::duration<double>(clock::now() - t1).count();
+            if (rounds++ == 0 && built != r.image) {
+                throw std::runtime_error(std::string(r.name) + ": round trip mismatch");
+            }
+        }
+
+        abw_delta_status_t    refused;
+        lr11xx::update_status status;
+        uint32_t              update_us = 0;
+        bool updated = update(base_words, r.image, patch, version, refused, status, update_us);
+        char outcome[32] = "FAILED";
+        if (updated) {
+            std::snprintf(outcome, sizeof(outcome), "%.0f ms", update_us / 1e3);
+        }
+        std::printf("%-12s %-44s %8zu %8zu %7.4f %9.1f %10.1f %9s\n", r.name, r.what, r.image.size(), patch.size(),
+                    double(patch.size()) / double(r.image.size()), t_enc * 1e3,
+                    r.image.size() / (t_apply / rounds) / 1e6, outcome);
+        ok = ok && updated;
+
+        // One flipped byte in the last command, or another base of the same size, must be refused before the erase
+        std::vector<uint8_t> bad = patch;
+        bad.back() ^= 0x01;
+        std::vector<uint32_t> other = base_words;
+        other[other.size() / 2] ^= 0x01;
+        uint32_t unused;
+        if (update(base_words, r.image, bad, version, refused, status, unused) || refused == ABW_DELTA_OK) {
+            std::printf("%-12s corrupted patch not refused: %s\n", r.name, status_name(refused));
+            ok = false;
+        }
+        if (update(other, r.image, patch, version, refused, status, unused) || refused != ABW_DELTA_ERR_BASE) {
+            std::printf("%-12s patch for another base not refused: %s\n", r.name, status_name(refused));
+            ok = false;
+        }
+        version++;
+    }
+    ok = check_corrupt(base, header) && ok;
+    if (!ok) {
+        throw std::runtime_error("bench failed");
+    }
+    std::printf("corrupted patches and patches for another base refused before the erase\n");
+    std::printf("wrapping and INT32_MIN copies rejected as corrupt, oversized image rejected\n");
+}
+
+int usage()
+{
+    std::cerr << "usage: abw-delta diff  [--version V] [--update-to N] <old.bin> <new.bin> <patch>\n"
+                 "       abw-delta apply <old.bin> <patch> <new.bin>\n"
+                 "       abw-delta bench [--seed N] [--chain N] [base.bin]\n";
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd = argv[1];
+    abw::delta_target        identity;
+    uint32_t                 seed  = 1;
+    unsigned                 chain = 32;
+    std::vector<std::string> args;
+
+    for (int i = 2; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--version") && i + 1 < argc) {
+            identity.version = uint16_t(std::stoul(argv[++i], nullptr, 0));
+        } else if (!std::strcmp(argv[i], "--update-to") && i + 1 < argc) {
+            identity.update_to = uint8_t(std::stoul(argv[++i], nullptr, 0));
+        } else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = uint32_t(std::stoul(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--chain") && i + 1 < argc) {
+            chain = unsigned(std::stoul(argv[++i]));
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    try {
+        if (cmd == "diff" && args.size() == 3) {
+            std::vector<uint8_t> base   = abw::read_file(args[0]);
+            std::vector<uint8_t> target = abw::read_file(args[1]);
+            abw::delta_stats     stats;
+            std::vector<uint8_t> patch = abw::delta_encode(base, target, identity, &stats, chain);
+            abw::write_file(args[2], patch);
+            std::printf("%s: %zu bytes for a %zu-byte image (%.4f), %u copies (%llu bytes), %u inserts (%llu bytes)\n",
+                        args[2].c_str(), patch.size(), target.size(), double(patch.size()) / double(target.size()),
+                        unsigned(stats.copies), (unsigned long long)stats.copied, unsigned(stats.inserts),
+                        (unsigned long long)stats.literals);
+            if (patch.size() >= target.size()) {
+                std::fprintf(stderr, "warning: the patch is not smaller than %s, send the full image\n",
+                             args[1].c_str());
+            }
+        } else if (cmd == "apply" && args.size() == 3) {
+            abw::write_file(args[2], apply_patch(abw::read_file(args[0]), abw::read_file(args[1])));
+        } else if (cmd == "bench" && args.size() <= 1) {
+            bench(args.empty() ? default_base : args[0], seed, chain);
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "abw-delta: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
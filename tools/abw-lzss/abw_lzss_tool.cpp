@@ -0,0 +1,190 @@
+/*!
+ * \file      abw_lzss_tool.cpp
+ *
+ * \brief     LZSS compressor, C header generator and benchmark for firmware images
+ *
+ * Usage:
+ *   abw-lzss compress [-w bits] <in> <out>
+ *   abw-lzss header   [-w bits] [-n symbol] <in.bin> <out.h>
+ *   abw-lzss bench    [-w bits] <file>...
+ *
+ * The bench command decodes every file through lib/lzss/abw_lzss.c in
+ * 64-word pieces, the LR11xx bootloader write size, and reports compression
+ * ratio and decode throughput.
+ */
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abw_carray.hpp"
+#include "abw_file.hpp"
+#include "abw_lzss_encoder.hpp"
+
+extern "C" {
+#include "abw_lzss.h"
+}
+
+namespace {
+
+constexpr uint32_t chunk_words = 64;
+
+std::string upper(std::string s)
+{
+    for (auto& c : s) {
+        c = char(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return s;
+}
+
+std::string guard_from_path(const std::string& path)
+{
+    std::string guard = upper(abw::base_name(path));
+    for (auto& c : guard) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            c = '_';
+        }
+    }
+    return guard;
+}
+
+void make_header(const std::string& in_path, const std::string& out_path, const std::string& symbol,
+                 unsigned window_bits)
+{
+    std::vector<uint8_t> raw = abw::read_file(in_path);
+    std::vector<uint8_t> lz  = abw::lzss_compress(raw, window_bits);
+    std::string          guard = guard_from_path(out_path);
+    std::string          macro = upper(symbol);
+
+    std::string h;
+    h += "/*!\n * \\file      " + abw::base_name(out_path) + "\n *\n";
+    h += " * \\brief     LZSS-compressed copy of " + abw::base_name(in_path) + "\n *\n";
+    h += " * Generated by abw-lzss, do not edit. Decode with abw_lzss_read_words()\n";
+    h += " * from lib/lzss/abw_lzss.h.\n */\n\n";
+    h += "#ifndef " + guard + "\n#define " + guard + "\n\n";
+    h += "#include <stdint.h>\n\n";
+    h += "/*!\n * \\brief Size in bytes of the compressed stream\n */\n";
+    h += "#define " + macro + "_SIZE " + std::to_string(lz.size()) + "\n\n";
+    h += "/*!\n * \\brief Size in bytes of the decoded image\n */\n";
+    h += "#define " + macro + "_DECODED_SIZE " + std::to_string(raw.size()) + "\n\n";
+    h += "/*!\n * \\brief Compressed stream\n */\n";
+    h += "static const uint8_t " + symbol + "[] = {\n";
+    abw::append_c_bytes(h, lz.data(), lz.size());
+    h += "};\n\n#endif\n";
+    abw::write_file(out_path, h);
+
+    std::printf("%s: %zu -> %zu bytes (%.3f)\n", out_path.c_str(), raw.size(), lz.size(),
+                double(lz.size()) / double(raw.size()));
+    if (lz.size() >= raw.size()) {
+        std::fprintf(stderr, "warning: %s does not compress, the plain image is smaller\n", in_path.c_str());
+    }
+}
+
+void bench(const std::string& path, unsigned window_bits)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<uint8_t> raw = abw::read_file(path);
+    raw.resize(raw.size() & ~size_t(3));  // Whole words only
+
+    auto                 t0 = clock::now();
+    std::vector<uint8_t> lz = abw::lzss_compress(raw, window_bits);
+    double               t_comp = std::chrono::duration<double>(clock::now() - t0).count();
+
+    auto                     ctx   = std::make_unique<abw_lzss_t>();
+    uint32_t                 words = uint32_t(raw.size() / 4);
+    std::vector<uint32_t>    chunk(chunk_words);
+    unsigned                 rounds = 0;
+    double                   t_dec  = 0;
+
+    // Repeat until the measurement is long enough to be meaningful
+    while (t_dec < 0.5) {
+        auto     t1     = clock::now();
+        uint32_t offset = 0;
+        if (abw_lzss_init(ctx.get(), lz.data(), uint32_t(lz.size())) != ABW_LZSS_OK) {
+            throw std::runtime_error("bad stream header");
+        }
+        for (;;) {
+            uint32_t          got    = 0;
+            abw_lzss_status_t status = abw_lzss_read_words(ctx.get(), chunk.data(), chunk_words, &got);
+            if (status > ABW_LZSS_END) {
+                throw std::runtime_error("decode error");
+            }
+            for (uint32_t i = 0; i < got && rounds == 0; i++) {
+                const uint8_t* b = &raw[size_t(offset + i) * 4];
+                if (chunk[i] != (uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3])) {
+                    throw std::runtime_error("round trip mismatch");
+                }
+            }
+            offset += got;
+            if (status == ABW_LZSS_END) {
+                break;
+            }
+        }
+        if (offset != words) {
+            throw std::runtime_error("short decode");
+        }
+        t_dec += std::chrono::duration<double>(clock::now() - t1).count();
+        rounds++;
+    }
+
+    double per_run = t_dec / rounds;
+    std::printf("%-48s %8zu -> %8zu  ratio %.3f  compress %7.1f ms  decode %6.2f Mwords/s (%6.1f MB/s)\n",
+                abw::base_name(path).c_str(), raw.size(), lz.size(), double(lz.size()) / double(raw.size()),
+                t_comp * 1e3, words / per_run / 1e6, raw.size() / per_run / 1e6);
+}
+
+int usage()
+{
+    std::cerr << "usage: abw-lzss compress [-w bits] <in> <out>\n"
+                 "       abw-lzss header   [-w bits] [-n symbol] <in.bin> <out.h>\n"
+                 "       abw-lzss bench    [-w bits] <file>...\n";
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd         = argv[1];
+    unsigned                 window_bits = 12;
+    std::string              symbol      = "lr11xx_firmware_image_lzss";
+    std::vector<std::string> args;
+
+    for (int i = 2; i < argc; i++) {
+        if (!std::strcmp(argv[i], "-w") && i + 1 < argc) {
+            window_bits = unsigned(std::stoul(argv[++i]));
+        } else if (!std::strcmp(argv[i], "-n") && i + 1 < argc) {
+            symbol = argv[++i];
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    try {
+        if (cmd == "compress" && args.size() == 2) {
+            abw::write_file(args[1], abw::lzss_compress(abw::read_file(args[0]), window_bits));
+        } else if (cmd == "header" && args.size() == 2) {
+            make_header(args[0], args[1], symbol, window_bits);
+        } else if (cmd == "bench" && !args.empty()) {
+            for (const auto& path : args) {
+                bench(path, window_bits);
+            }
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "abw-lzss: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,609 @@
+/*!
+ * \file      abw_mfg_cli_tool.cpp
+ *
+ * \brief     Scripted access to the MFG CLI, with pipelined commands
+ *
+ * Usage:
+ *   abw-mfg-cli run      [options] <tty> [command...]
+ *   abw-mfg-cli lora     [options] <tty>
+ *   abw-mfg-cli loopback [options] [--ports N] [--rounds N] [--round-trip-us N] [--command-us N]
+ *                        [--baud N] [--fast]
+ *   abw-mfg-cli json-loopback [options] [--rounds N] [--round-trip-us N] [--command-us N] [--baud N] [--fast]
+ *
+ * Options:
+ *   --password PIN   MFG CLI password (default 456)
+ *   --depth N        Commands typed ahead of their answers (default 8, 1 for one round trip each)
+ *   --window N       Bytes typed ahead of their answers (default 128)
+ *   --json           Use the JSON output of the CLI (lib/clijson/abw_cli_json.h) for the session
+ *
+ * run logs in and runs the commands given, or the lines of the standard
+ * input, in order. Commands may be abbreviated as on the board. Each output
+ * is printed under its expanded command, and the tool fails if any command
+ * answers ERROR. lora prints the answers of "lora info" and "provis lora
+ * display" as parsed by tools/common/abw_mfg_replies.hpp. With --json, the
+ * session is switched to JSON output and back to text at the end; run
+ * prints the records of each command, log events first, and lora decodes
+ * them with tools/common/abw_mfg_json.hpp.
+ *
+ * loopback provisions the LoRa settings of simulated boards (see
+ * tools/common/mfg_cli_sim.hpp), one per pty, with a station script of 14
+ * abbreviated commands, one round trip at a time and then pipelined. It
+ * checks every answer and the settings left in flash, and reports commands
+ * per second on each port. The boards take --command-us for each command
+ * (default 1000). Between the tool and each board, a link thread delays
+ * both directions by half of --round-trip-us (default 2000, the host, its
+ * USB stack and adapter) and carries the board output at --baud (default
+ * 57600, the LPUART of mfg-serial); the board paces what it reads at the
+ * same rate. --fast turns off the timing model.
+ *
+ * json-loopback runs a corpus of the commands the stand-in serves, error
+ * cases included, on two simulated boards: one in text output, its answers
+ * turned into records by text_record(), one in JSON output, its records
+ * decoded by parse_record(). The records must match, with the status codes
+ * expected, and the session must get back to text output. It reports the
+ * bytes each board sent, commands per second and decoding time for both.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_mfg_cli.hpp"
+#include "abw_mfg_commands.hpp"
+#include "abw_mfg_json.hpp"
+#include "abw_mfg_replies.hpp"
+#include "abw_serial.hpp"
+#include "mfg_cli_sim.hpp"
+#include "mfg_cli_sim_json.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct cli_options {
+    std::string password = "456";
+    unsigned    depth    = 8;
+    size_t      window   = 128;
+    bool        json     = false;
+};
+
+int usage()
+{
+    std::cerr << "usage: abw-mfg-cli run      [options] <tty> [command...]\n"
+                 "       abw-mfg-cli lora     [options] <tty>\n"
+                 "       abw-mfg-cli loopback [options] [--ports N] [--rounds N] [--round-trip-us N] "
+                 "[--command-us N] [--baud N] [--fast]\n"
+                 "       abw-mfg-cli json-loopback [options] [--rounds N] [--round-trip-us N] [--command-us N] "
+                 "[--baud N] [--fast]\n";
+    return 2;
+}
+
+bool run(const std::string& tty, std::vector<std::string> commands, const cli_options& options)
+{
+    if (commands.empty()) {
+        for (std::string line; std::getline(std::cin, line);) {
+            if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                commands.push_back(line);
+            }
+        }
+    }
+
+    abw::serial_port port(tty, abw::mfg_cli::default_baud);
+    abw::mfg_cli     cli(port);
+    cli.login(options.password);
+
+    bool ok = true;
+    if (options.json) {
+        cli.set_output(true);
+        auto replies = cli.run(commands, options.depth, options.window);
+        cli.set_output(false);
+        for (const auto& reply : replies) {
+            for (const auto& log : reply.logs) {
+                std::printf("%s\n", log.c_str());
+            }
+            std::printf("%s\n", reply.output.c_str());
+            ok = ok && reply.ok;
+        }
+        return ok;
+    }
+    for (const auto& reply : cli.run(commands, options.depth, options.window)) {
+        std::printf("%s%s\n%s%s\n", cli.prompt().c_str(), reply.command.c_str(), reply.output.c_str(),
+                    reply.ok ? "OK" : "ERROR");
+        for (const auto& log : reply.logs) {
+            std::fprintf(stderr, "%s\n", log.c_str());
+        }
+        ok = ok && reply.ok;
+    }
+    return ok;
+}
+
+void lora(const std::string& tty, const cli_options& options)
+{
+    abw::serial_port port(tty, abw::mfg_cli::default_baud);
+    abw::mfg_cli     cli(port);
+    cli.login(options.password);
+
+    cli.set_output(options.json);
+    auto replies = cli.run({"lora info", "provis lora display"}, options.depth, options.window);
+    cli.set_output(false);
+    for (const auto& reply : replies) {
+        if (!reply.ok) {
+            throw std::runtime_error(reply.command + ": ERROR");
+        }
+    }
+    abw::lora_info         info;
+    abw::lora_provisioning prov;
+    if (options.json) {
+        info = abw::to_lora_info(abw::parse_record(replies[0].output));
+        prov = abw::to_lora_provisioning(abw::parse_record(replies[1].output));
+    } else {
+        info = abw::parse_lora_info(replies[0].output);
+        prov = abw::parse_lora_provisioning(replies[1].output);
+    }
+
+    std::printf("LoRaWAN %s, regional %s, modem %s, LR11xx HW %d type %d FW 0x%02X\n", info.lorawan.c_str(),
+                info.regional.c_str(), info.modem.c_str(), info.chip_hw, info.chip_type, unsigned(info.chip_fw));
+    std::printf("running:     DevEUI %s, JoinEUI %s, %s, %s, %s, %s, DevAddr 0x%08X, DevNonce %d\n",
+                info.dev_eui.c_str(), info.join_eui.c_str(), info.region.c_str(), info.tx_strategy.c_str(),
+                info.state.c_str(), info.joined ? "joined" : "not joined", unsigned(info.dev_addr), info.dev_nonce);
+    if (!prov.valid) {
+        std::printf("provisioned: none\n");
+        return;
+    }
+    std::printf("provisioned: DevEUI %s, JoinEUI %s, %s, %s, appkey %s, nwkkey %s%s\n", prov.dev_eui.c_str(),
+                prov.join_eui.c_str(), prov.region.c_str(), prov.activation.c_str(), prov.appkey ? "set" : "unset",
+                prov.nwkkey ? "set" : "unset", prov.saved ? "" : " (unsaved)");
+}
+
+/*!
+ * \brief Line between the tool and a simulated board: latency both ways, board output at the line rate
+ */
+class host_link {
+public:
+    host_link(abw::serial_port& host, abw::serial_port& board, uint32_t round_trip_us, uint32_t baud)
+        : host_(host), board_(board), latency_(std::chrono::microseconds(round_trip_us / 2)),
+          byte_(std::chrono::nanoseconds(10000000000ull / baud))
+    {
+    }
+
+    void run(const std::atomic<bool>& stop)
+    {
+        char buf[512];
+        while (!stop) {
+            auto   now  = clock_type::now();
+            auto   next = now + std::chrono::milliseconds(20);
+            pollfd pfd[2] = {{host_.fd(), POLLIN, 0}, {board_.fd(), POLLIN, 0}};
+            for (auto* q : {&to_board_, &to_host_}) {
+                if (!q->empty() && q->front().due < next) {
+                    next = q->front().due;
+                }
+            }
+            int64_t  wait = std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(next - now).count(), 0);
+            timespec ts   = {time_t(wait / 1000000000), long(wait % 1000000000)};
+            ::ppoll(pfd, 2, &ts, nullptr);
+
+            now = clock_type::now();
+            if (size_t n = host_.read(buf, sizeof(buf), 0)) {
+                to_board_.push_back({now + latency_, std::string(buf, n)});
+            }
+            if (size_t n = board_.read(buf, sizeof(buf), 0)) {
+                // Serialized behind what is still on the wire
+                auto start = std::max(now + latency_, to_host_.empty() ? now : to_host_.back().due);
+                to_host_.push_back({start + byte_ * n, std::string(buf, n)});
+            }
+            deliver(to_board_, board_);
+            deliver(to_host_, host_);
+        }
+    }
+
+private:
+    struct chunk {
+        clock_type::time_point due;
+        std::string            data;
+    };
+
+    static void deliver(std::deque<chunk>& queue, abw::serial_port& port)
+    {
+        while (!queue.empty() && queue.front().due <= clock_type::now()) {
+            port.write(queue.front().data);
+            queue.pop_front();
+        }
+    }
+
+    abw::serial_port&    host_;
+    abw::serial_port&    board_;
+    clock_type::duration latency_;
+    clock_type::duration byte_;
+    std::deque<chunk>    to_board_;
+    std::deque<chunk>    to_host_;
+};
+
+/*!
+ * \brief Station script provisioning dev_eui, abbreviated
+ */
+std::vector<std::string> station_script(const std::string& dev_eui)
+{
+    const std::string key = "000102030405060708090a0b0c0d0e0f";
+    return {"sys ver",
+            "ble ver",
+            "lr11xx firm ver",
+            "gnss on",
+            "gnss mt ver",
+            "lora inf",
+            "prov lora set dev " + abw::eui_text(dev_eui),
+            "prov lora set join 20-63-5f-00-00-00-00-01",
+            "prov lora set app " + key,
+            "prov lora set nwk " + key,
+            "prov lora set reg EU868",
+            "prov lora disp",
+            "prov lora save",
+            "prov lora disp"};
+}
+
+/*!
+ * \brief Check the answers of station_script(), empty if they are right
+ */
+std::string check_script(const std::vector<abw::cli_reply>& replies, const std::string& dev_eui, unsigned round)
+{
+    for (const auto& reply : replies) {
+        if (!reply.ok) {
+            return reply.command + ": ERROR";
+        }
+    }
+    if (replies[0].command != "system version" || replies[0].output.find("MFG: ") == std::string::npos) {
+        return "system version: unexpected answer";
+    }
+    if (replies[3].logs.empty()) {
+        return "gnss on: no log line";
+    }
+    abw::lora_info         info   = abw::parse_lora_info(replies[5].output);
+    abw::lora_provisioning edited = abw::parse_lora_provisioning(replies[11].output);
+    abw::lora_provisioning saved  = abw::parse_lora_provisioning(replies[13].output);
+    if (round > 0 && info.dev_eui != dev_eui) {
+        return "lora info: DevEUI " + info.dev_eui + " instead of " + dev_eui;
+    }
+    if (edited.dev_eui != dev_eui || (edited.saved && round == 0) || !saved.saved || saved.dev_eui != dev_eui ||
+        saved.join_eui != "20635f0000000001" || !saved.appkey || !saved.nwkkey || saved.region != "EU868") {
+        return "provis lora display: settings not as set";
+    }
+    return "";
+}
+
+struct port_result {
+    double      seconds  = 0;
+    unsigned    commands = 0;
+    std::string error;
+};
+
+/*!
+ * \brief Run the station script rounds times on N simulated boards at once
+ */
+std::vector<port_result> bench(unsigned ports, unsigned rounds, const cli_options& options,
+                               const abw::mfg_cli_sim_config& config, uint32_t round_trip_us)
+{
+    std::vector<std::unique_ptr<abw::pty_pair>>    tool_ptys;
+    std::vector<std::unique_ptr<abw::pty_pair>>    board_ptys;
+    std::vector<std::unique_ptr<abw::mfg_cli_sim>> boards;
+    std::vector<std::unique_ptr<host_link>>        links;
+    std::vector<std::string>                       euis;
+    std::vector<port_result>                       results(ports);
+    std::vector<std::thread>                       threads;
+    std::atomic<bool>                              stop(false);
+
+    for (unsigned i = 0; i < ports; i++) {
+        char eui[20];
+        std::snprintf(eui, sizeof(eui), "20635f01%08x", 0x100 + i);
+        euis.push_back(eui);
+        tool_ptys.emplace_back(new abw::pty_pair(abw::mfg_cli::default_baud));
+        board_ptys.emplace_back(new abw::pty_pair(config.cli_baud));
+        boards.emplace_back(new abw::mfg_cli_sim(board_ptys.back()->master, board_ptys.back()->slave_path, config));
+        links.emplace_back(new host_link(tool_ptys.back()->master, board_ptys.back()->slave,
+                                         config.pacing ? round_trip_us : 0,
+                                         config.pacing ? config.cli_baud : 1000000000));
+    }
+    for (unsigned i = 0; i < ports; i++) {
+        threads.emplace_back([&, i] { boards[i]->run(stop); });
+        threads.emplace_back([&, i] { links[i]->run(stop); });
+    }
+    for (unsigned i = 0; i < ports; i++) {
+        threads.emplace_back([&, i] {
+            port_result& r = results[i];
+            try {
+                abw::mfg_cli cli(tool_ptys[i]->slave);
+                cli.login(options.password);
+                auto script = station_script(euis[i]);
+                auto start  = clock_type::now();
+                for (unsigned round = 0; round < rounds && r.error.empty(); round++) {
+                    r.error = check_script(cli.run(script, options.depth, options.window), euis[i], round);
+                    r.commands += unsigned(script.size());
+                }
+                r.seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+            } catch (const std::exception& e) {
+                r.error = e.what();
+            }
+        });
+    }
+    for (unsigned i = 2 * ports; i < 3 * ports; i++) {
+        threads[i].join();
+    }
+    stop = true;
+    for (unsigned i = 0; i < ports; i++) {
+        threads[2 * i].join();
+        threads[2 * i + 1].join();
+        if (results[i].error.empty() && boards[i]->lora_saved().dev_eui != euis[i]) {
+            results[i].error = "DevEUI not saved";
+        }
+    }
+    return results;
+}
+
+bool loopback(unsigned ports, unsigned rounds, const cli_options& options, const abw::mfg_cli_sim_config& config,
+              uint32_t round_trip_us)
+{
+    try {
+        abw::resolve_command("l info");
+        std::printf("\"l info\" not refused as ambiguous\n");
+        return false;
+    } catch (const std::invalid_argument& e) {
+        std::printf("%s\n", e.what());
+    }
+
+    std::printf("%u ports, %u rounds of %zu commands, %u baud, %u us per command, %u us round trip%s\n", ports,
+                rounds, station_script("").size(), unsigned(config.cli_baud), unsigned(config.command_us),
+                unsigned(round_trip_us), config.pacing ? "" : ", unpaced");
+    std::printf("%-6s %8s %10s %10s %14s %12s\n", "depth", "commands", "wall s", "cmd/s/port", "min cmd/s/port",
+                "cmd/s total");
+
+    bool ok = true;
+    for (unsigned depth : {1u, options.depth}) {
+        cli_options o = options;
+        o.depth       = depth;
+        auto   start  = clock_type::now();
+        auto   result = bench(ports, rounds, o, config, round_trip_us);
+        double wall   = std::chrono::duration<double>(clock_type::now() - start).count();
+
+        unsigned commands = 0;
+        double   sum = 0, min = 1e30;
+        for (unsigned i = 0; i < ports; i++) {
+            if (!result[i].error.empty()) {
+                std::printf("port %u: %s\n", i, result[i].error.c_str());
+                ok = false;
+                continue;
+            }
+            double rate = result[i].commands / result[i].seconds;
+            commands += result[i].commands;
+            sum += rate;
+            min = std::min(min, rate);
+        }
+        std::printf("%-6u %8u %10.2f %10.1f %14.1f %12.1f\n", depth, commands, wall, sum / ports, min, commands / wall);
+    }
+    return ok;
+}
+
+/*!
+ * \brief Commands of the stand-in, and the status code each must end with
+ */
+std::vector<std::pair<std::string, int>> json_corpus()
+{
+    std::vector<std::pair<std::string, int>> corpus;
+    for (const auto& line : station_script("20635f0100000100")) {
+        corpus.push_back({line, ABW_CLI_OK});
+    }
+    std::vector<std::pair<std::string, int>> more = {
+        {"prov lora set dev 20-63-5f", ABW_CLI_INVALID_ARGUMENT},
+        {"prov lora set dev", ABW_CLI_INVALID_ARGUMENT},
+        {"prov lora set app 0011", ABW_CLI_INVALID_ARGUMENT},
+        {"prov lora set reg XX123", ABW_CLI_INVALID_ARGUMENT},
+        {"prov lora set act OTAA", ABW_CLI_OK},
+        {"prov lora erase", ABW_CLI_OK},
+        {"prov lora rest", ABW_CLI_OK},
+        {"prov lora disp", ABW_CLI_OK},
+        {"prov lora fact US915", ABW_CLI_OK},
+        {"prov lora disp", ABW_CLI_OK},
+        {"prov lora save", ABW_CLI_OK},
+        {"lora info", ABW_CLI_OK},
+        {"lr1110 firmware version", ABW_CLI_OK},
+        {"gnss mt on", ABW_CLI_OK},
+        {"lora nonce", ABW_CLI_UNKNOWN_COMMAND},
+        {"wifi scan", ABW_CLI_UNKNOWN_COMMAND},
+        {"sys out xml", ABW_CLI_INVALID_ARGUMENT},
+    };
+    corpus.insert(corpus.end(), more.begin(), more.end());
+    return corpus;
+}
+
+struct json_session {
+    std::vector<abw::cli_reply> replies;  //!< Of every round
+    uint64_t                    bytes   = 0;
+    double                      seconds = 0;
+    std::string                 error;
+};
+
+/*!
+ * \brief Run the corpus rounds times on a simulated board, in text or JSON output
+ */
+json_session run_corpus(bool json, unsigned rounds, const cli_options& options, const abw::mfg_cli_sim_config& config,
+                        uint32_t round_trip_us)
+{
+    abw::pty_pair     tool_pty(abw::mfg_cli::default_baud);
+    abw::pty_pair     board_pty(config.cli_baud);
+    abw::mfg_cli_json records;
+    abw::mfg_cli_sim  board(board_pty.master, board_pty.slave_path, config);
+    host_link         link(tool_pty.master, board_pty.slave, config.pacing ? round_trip_us : 0,
+                           config.pacing ? config.cli_baud : 1000000000);
+    std::atomic<bool> stop(false);
+    json_session      session;
+
+    board.set_records(records);
+    std::thread board_thread([&] { board.run(stop); });
+    std::thread link_thread([&] { link.run(stop); });
+
+    try {
+        std::vector<std::string> lines;
+        for (const auto& c : json_corpus()) {
+            lines.push_back(c.first);
+        }
+        abw::mfg_cli cli(tool_pty.slave);
+        cli.login(options.password);
+        cli.set_output(json);
+        uint64_t from  = cli.received();
+        auto     start = clock_type::now();
+        for (unsigned round = 0; round < rounds; round++) {
+            auto replies = cli.run(lines, options.depth, options.window);
+            session.replies.insert(session.replies.end(), replies.begin(), replies.end());
+        }
+        session.seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+        session.bytes   = cli.received() - from;
+        cli.set_output(false);
+        if (cli.command("sys ver").find("MFG: ") == std::string::npos) {
+            session.error = "no text output after \"system output text\"";
+        }
+    } catch (const std::exception& e) {
+        session.error = e.what();
+    }
+    stop = true;
+    board_thread.join();
+    link_thread.join();
+    return session;
+}
+
+/*!
+ * \brief Microseconds to decode each reply, best of a few passes
+ */
+double decode_us(const std::vector<abw::cli_reply>& replies, bool json)
+{
+    double best = 1e30;
+    for (int pass = 0; pass < 5; pass++) {
+        auto   start = clock_type::now();
+        size_t n     = 0;
+        for (int i = 0; i < 20; i++) {
+            n += abw::decode_replies(replies, json).size();
+        }
+        double us = std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+        best      = std::min(best, us / (20.0 * replies.size()));
+        (void) n;
+    }
+    return best;
+}
+
+bool json_loopback(unsigned rounds, const cli_options& options, const abw::mfg_cli_sim_config& config,
+                   uint32_t round_trip_us)
+{
+    auto corpus = json_corpus();
+    std::printf("corpus of %zu commands, %u rounds, %u baud, %u us per command, %u us round trip, depth %u%s\n",
+                corpus.size(), rounds, unsigned(config.cli_baud), unsigned(config.command_us),
+                unsigned(round_trip_us), options.depth, config.pacing ? "" : ", unpaced");
+
+    json_session text = run_corpus(false, rounds, options, config, round_trip_us);
+    json_session json = run_corpus(true, rounds, options, config, round_trip_us);
+    for (const auto* s : {&text, &json}) {
+        if (!s->error.empty()) {
+            std::printf("%s: %s\n", s == &text ? "text" : "json", s->error.c_str());
+            return false;
+        }
+    }
+
+    auto     from_text = abw::decode_replies(text.replies, false);
+    auto     from_json = abw::decode_replies(json.replies, true);
+    unsigned differ    = 0;
+    for (size_t i = 0; i < std::max(from_text.size(), from_json.size()); i++) {
+        if (i >= from_text.size() || i >= from_json.size() || from_text[i] != from_json[i]) {
+            if (differ++ < 5) {
+                std::printf("record %zu differs\n  text: %s\n  json: %s\n", i,
+                            i < from_text.size() ? to_json(from_text[i]).c_str() : "none",
+                            i < from_json.size() ? to_json(from_json[i]).c_str() : "none");
+            }
+        }
+    }
+    unsigned wrong = 0;
+    for (size_t i = 0; i < json.replies.size(); i++) {
+        int expected = corpus[i % corpus.size()].second;
+        int code     = abw::parse_record(json.replies[i].output).code;
+        if (code != expected && wrong++ < 5) {
+            std::printf("%s: code %d instead of %d\n", json.replies[i].command.c_str(), code, expected);
+        }
+    }
+    std::printf("%zu records, %u differ, %u wrong codes\n", from_json.size(), differ, wrong);
+
+    std::printf("%-6s %12s %10s %14s\n", "output", "bytes/round", "cmd/s", "decode us/cmd");
+    for (const auto* s : {&text, &json}) {
+        std::printf("%-6s %12.0f %10.1f %14.2f\n", s == &text ? "text" : "json", double(s->bytes) / rounds,
+                    s->replies.size() / s->seconds, decode_us(s->replies, s == &json));
+    }
+    return differ == 0 && wrong == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd = argv[1];
+    cli_options              options;
+    abw::mfg_cli_sim_config  config;
+    unsigned                 ports         = 1;
+    unsigned                 rounds        = 20;
+    uint32_t                 round_trip_us = 2000;
+    std::vector<std::string> args;
+
+    config.command_us = 1000;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            if (!std::strcmp(argv[i], "--password") && i + 1 < argc) {
+                options.password = argv[++i];
+            } else if (!std::strcmp(argv[i], "--depth") && i + 1 < argc) {
+                options.depth = unsigned(std::stoul(argv[++i]));
+            } else if (!std::strcmp(argv[i], "--window") && i + 1 < argc) {
+                options.window = std::stoul(argv[++i]);
+            } else if (!std::strcmp(argv[i], "--ports") && i + 1 < argc) {
+                ports = unsigned(std::stoul(argv[++i]));
+            } else if (!std::strcmp(argv[i], "--rounds") && i + 1 < argc) {
+                rounds = unsigned(std::stoul(argv[++i]));
+            } else if (!std::strcmp(argv[i], "--round-trip-us") && i + 1 < argc) {
+                round_trip_us = uint32_t(std::stoul(argv[++i]));
+            } else if (!std::strcmp(argv[i], "--command-us") && i + 1 < argc) {
+                config.command_us = uint32_t(std::stoul(argv[++i]));
+            } else if (!std::strcmp(argv[i], "--baud") && i + 1 < argc) {
+                config.cli_baud = uint32_t(std::stoul(argv[++i]));
+                abw::baud_speed(config.cli_baud);
+            } else if (!std::strcmp(argv[i], "--json")) {
+                options.json = true;
+            } else if (!std::strcmp(argv[i], "--fast")) {
+                config.pacing = false;
+            } else {
+                args.push_back(argv[i]);
+            }
+        }
+        config.password      = options.password;
+        config.clean_baud    = std::max(config.clean_baud, config.cli_baud);
+        config.marginal_baud = std::max(config.marginal_baud, config.cli_baud);
+
+        if (cmd == "run" && !args.empty()) {
+            return run(args[0], std::vector<std::string>(args.begin() + 1, args.end()), options) ? 0 : 1;
+        } else if (cmd == "lora" && args.size() == 1) {
+            lora(args[0], options);
+        } else if (cmd == "loopback" && args.empty() && ports > 0 && rounds > 0) {
+            return loopback(ports, rounds, options, config, round_trip_us) ? 0 : 1;
+        } else if (cmd == "json-loopback" && args.empty() && rounds > 0) {
+            return json_loopback(rounds, options, config, round_trip_us) ? 0 : 1;
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "abw-mfg-cli: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
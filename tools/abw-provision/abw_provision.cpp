@@ -0,0 +1,1264 @@
+/*!
+ * \file      abw_provision.cpp
+ *
+ * \brief     First-flash provisioning of several boards at once, from one epoll event loop
+ *
+ * Usage:
+ *   abw-provision [options] --device name:tty[:gnss_tty[:stlink_sn]]...
+ *   abw-provision [options] --sim N [--sim-fast]
+ *
+ * Options:
+ *   --firmware-dir DIR        Root of the firmware binaries (default firmware-binaries)
+ *   --steps a,b,...           Steps to run, in order (default fus,ble,bootloader,mfg,lr11xx,mt3333)
+ *   --programmer CMD          STM32 programmer command prefix, {sn} is the ST-Link serial number
+ *                             (default "STM32_Programmer_CLI -c port=SWD sn={sn}")
+ *   --mt3333-flasher CMD      MT3333 flasher command, with {gnss_tty}, {da} and {file}; the
+ *                             mt3333 step only enables the GNSS and checks its version without it
+ *   --bridge-speed I          First LR11xx bridge speed index, lowered on each retry (default 8)
+ *   --bridge-interface N      LR11xx bridge serial interface (default 2)
+ *   --chip lr11xx|lr1110      MFG CLI command prefix of the LR11xx (default lr11xx)
+ *   --password PIN            MFG CLI password (default 456)
+ *   --attempts N              Attempts per step (default 3)
+ *   --max-parallel N          Boards provisioned at the same time (default all)
+ *   --csv FILE                Per-step records
+ *   --plan                    Survey each board first and only run the steps of what differs
+ *   --plan-only               Survey the boards and print their plans, flash nothing
+ *
+ * Each board runs the sequence of docs/Type1WL-EVB_first_flash.md as a
+ * state machine over a list of actions: FUS and BLE stack at 0x080CE000 and
+ * the bootloader at 0x08000000 through the STM32 programmer, the MFG
+ * application through the bootloader (ABWe, ABWu and XMODEM), the LR11xx
+ * update through the MFG bridge, and the MT3333 update. All serial lines
+ * and programmer processes are served by a single epoll loop, so the
+ * number of boards is not limited by threads.
+ *
+ * With --plan, a survey step reads the versions on each board from the MFG
+ * CLI (or the ABW bootloader) and compares them with the artifacts (see
+ * tools/common/abw_fleet_plan.hpp). The board then skips the steps of the
+ * components it already runs, e.g. the LR11xx reflash of a chip already at
+ * the version of the image.
+ *
+ * --sim N provisions N simulated boards on pseudo-terminals (see
+ * tools/common/mfg_cli_sim.hpp), with "sleep" standing in for the external
+ * programmers. --sim-fast turns off the line and flash timing model.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include "abw_app_image.hpp"
+#include "abw_artifacts.hpp"
+#include "abw_event_loop.hpp"
+#include "abw_file.hpp"
+#include "abw_fleet_plan.hpp"
+#include "abw_mfg_cli.hpp"
+#include "abw_serial.hpp"
+#include "abw_xmodem.hpp"
+#include "mfg_cli_sim.hpp"
+
+extern char** environ;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr clock_type::time_point never = clock_type::time_point::max();
+
+/*!
+ * \brief One operation of a provisioning step
+ */
+struct action {
+    enum class kind {
+        send,    //!< Queue text on the serial line
+        expect,  //!< Wait for text matching a regular expression
+        prompt,  //!< Wait for the CLI prompt, fails if the answer holds ERROR
+        login,   //!< Poke the CLI until it prompts, log in if asked to
+        probe,   //!< Same as login, but in the ABW bootloader ask its version and end the step
+        capture, //!< Wait for the prompt, or a complete line matching text, and keep the output for the plan
+        baud,    //!< Change the rate of the serial line once the output is sent
+        xmodem,  //!< Send an image to the XMODEM receiver on the line
+        spawn,   //!< Run a shell command
+        delay,   //!< Let time pass
+    };
+
+    kind                        type;
+    std::string                 text;
+    uint32_t                    value = 0;  //!< Timeout in ms, or baud rate
+    const abw::mapped_file*     image = nullptr;
+};
+
+action send(const std::string& text)
+{
+    return {action::kind::send, text};
+}
+action expect(const std::string& regex, uint32_t timeout_ms)
+{
+    return {action::kind::expect, regex, timeout_ms};
+}
+action prompt(uint32_t timeout_ms)
+{
+    return {action::kind::prompt, "", timeout_ms};
+}
+action login(const std::string& password, uint32_t timeout_ms)
+{
+    return {action::kind::login, password, timeout_ms};
+}
+action probe(const std::string& password, uint32_t timeout_ms)
+{
+    return {action::kind::probe, password, timeout_ms};
+}
+action capture(const std::string& regex, uint32_t timeout_ms)
+{
+    return {action::kind::capture, regex, timeout_ms};
+}
+action set_baud(uint32_t baud)
+{
+    return {action::kind::baud, "", baud};
+}
+action xmodem(const abw::mapped_file& image, uint32_t start_timeout_ms)
+{
+    return {action::kind::xmodem, "", start_timeout_ms, &image};
+}
+action spawn(const std::string& command, uint32_t timeout_ms)
+{
+    return {action::kind::spawn, command, timeout_ms};
+}
+action delay(uint32_t ms)
+{
+    return {action::kind::delay, "", ms};
+}
+
+struct device_config {
+    std::string name;
+    std::string tty;
+    std::string gnss_tty;
+    std::string stlink_sn;
+    bool        in_mfg_cli = false;  //!< Found running the MFG application by the survey
+};
+
+/*!
+ * \brief Actions of one attempt of a step, and what distinguishes it from the others
+ */
+struct attempt_plan {
+    std::vector<action> actions;
+    std::string         note;
+};
+
+struct step_spec {
+    std::string                                                               name;
+    std::function<attempt_plan(const device_config& device, unsigned attempt)> plan;
+    unsigned                                                                  attempts = 0;  //!< 0 for --attempts
+
+    /*!
+     * \brief Steps to keep from what the step captured, with a note; a step
+     *        with replan does not stop the board when it fails
+     */
+    std::function<std::vector<std::string>(device_config& device, const std::string& captured, std::string& note)>
+        replan = nullptr;
+};
+
+struct step_record {
+    std::string name;
+    unsigned    attempts = 0;
+    double      seconds  = 0;
+    bool        ok       = false;
+    std::string detail;  //!< Note of the last attempt, and the failure if any
+};
+
+std::string replace_all(std::string text, const std::map<std::string, std::string>& values)
+{
+    for (const auto& value : values) {
+        for (size_t at; (at = text.find(value.first)) != std::string::npos;) {
+            text.replace(at, value.first.size(), value.second);
+        }
+    }
+    return text;
+}
+
+/*!
+ * \brief Provisioning state machine of one board
+ */
+class device {
+public:
+    device(abw::event_loop& loop, const device_config& config, const std::vector<step_spec>& steps,
+           unsigned max_attempts)
+        : loop_(loop), config_(config), max_attempts_(max_attempts)
+    {
+        for (const auto& step : steps) {
+            steps_.push_back(&step);
+        }
+    }
+
+    device(const device&) = delete;
+    device& operator=(const device&) = delete;
+
+    ~device() { stop_child(); }
+
+    const device_config&            config() const { return config_; }
+    const std::vector<step_record>& records() const { return records_; }
+    const std::vector<std::string>& skipped() const { return skipped_; }
+    bool                            started() const { return started_; }
+    bool                            finished() const { return finished_; }
+    bool                            ok() const { return ok_; }
+    double                          seconds() const { return seconds_; }
+    clock_type::time_point          deadline() const { return deadline_; }
+
+    void start()
+    {
+        started_ = true;
+        start_   = clock_type::now();
+        try {
+            port_ = abw::serial_port(config_.tty, abw::mfg_cli::default_baud);
+            abw::set_nonblocking(port_.fd());
+            loop_.add(port_.fd(), EPOLLIN, [this](uint32_t events) { on_serial(events); });
+        } catch (const std::exception& e) {
+            records_.push_back({"open", 1, 0, false, e.what()});
+            finish(false);
+            return;
+        }
+        begin_step();
+    }
+
+    void on_deadline()
+    {
+        if (clock_type::now() < deadline_) {
+            return;
+        }
+        deadline_        = never;
+        const action& a = actions_[action_];
+
+        switch (a.type) {
+        case action::kind::probe:
+            if (in_bootloader_) {
+                fail("no bootloader version");
+                break;
+            }
+            // Fall through
+        case action::kind::login:
+            if (clock_type::now() < action_end_) {
+                queue("\r");
+                wait_until(clock_type::now() + std::chrono::seconds(1));
+                return;
+            }
+            fail("no CLI prompt");
+            break;
+        case action::kind::expect:
+            fail("timeout waiting for \"" + a.text + "\"");
+            break;
+        case action::kind::prompt:
+            fail("timeout waiting for the prompt");
+            break;
+        case action::kind::capture:
+            captured_ += rx_;  // Whatever came, the plan treats the rest as unknown
+            rx_.clear();
+            next();
+            break;
+        case action::kind::delay:
+            next();
+            break;
+        case action::kind::xmodem:
+            sender_->on_timeout();
+            pump_xmodem();
+            break;
+        case action::kind::spawn:
+            stop_child();
+            fail("programmer timeout");
+            break;
+        default:
+            break;
+        }
+    }
+
+private:
+    const step_spec& step() const { return *steps_[step_]; }
+    step_record&     record() { return records_.back(); }
+
+    void wait_until(clock_type::time_point t) { deadline_ = std::min(t, action_end_); }
+
+    void begin_step()
+    {
+        if (step_ == steps_.size()) {
+            finish(true);
+            return;
+        }
+        records_.push_back({step().name, 0, 0, false, ""});
+        step_start_ = clock_type::now();
+        attempt_    = 0;
+        captured_.clear();
+        begin_attempt();
+    }
+
+    void begin_attempt()
+    {
+        attempt_plan plan = step().plan(config_, attempt_);
+        record().attempts = ++attempt_;
+        record().detail   = plan.note;
+        actions_          = std::move(plan.actions);
+        action_           = 0;
+        run();
+    }
+
+    void next()
+    {
+        action_++;
+        run();
+    }
+
+    void run()
+    {
+        deadline_ = never;
+        if (action_ == actions_.size()) {
+            record().ok      = true;
+            record().seconds = std::chrono::duration<double>(clock_type::now() - step_start_).count();
+            if (step().replan) {
+                replan();
+            }
+            step_++;
+            begin_step();
+            return;
+        }
+
+        const action& a = actions_[action_];
+        action_end_     = clock_type::now() + std::chrono::milliseconds(a.value);
+        switch (a.type) {
+        case action::kind::send:
+            queue(a.text);
+            next();
+            break;
+        case action::kind::expect:
+        case action::kind::prompt:
+        case action::kind::capture:
+            wait_until(action_end_);
+            check_input();
+            break;
+        case action::kind::login:
+        case action::kind::probe:
+            logging_in_    = false;
+            in_bootloader_ = false;
+            queue("\r");
+            wait_until(clock_type::now() + std::chrono::seconds(1));
+            check_input();
+            break;
+        case action::kind::baud:
+            if (out_.empty()) {
+                change_baud(a.value);
+            }  // else once the output is sent
+            break;
+        case action::kind::xmodem: {
+            abw::xmodem_options options;
+            options.start_timeout_ms = a.value;
+            options.ack_timeout_ms   = 3000;
+            options.max_retries      = 5;
+            sender_.reset(new abw::xmodem_sender(a.image->data(), a.image->size(), options));
+            sender_->on_input(reinterpret_cast<const uint8_t*>(rx_.data()), rx_.size());
+            rx_.clear();
+            pump_xmodem();
+            break;
+        }
+        case action::kind::spawn:
+            start_child(a.text);
+            wait_until(action_end_);
+            break;
+        case action::kind::delay:
+            wait_until(action_end_);
+            break;
+        }
+    }
+
+    void fail(const std::string& why)
+    {
+        sender_.reset();
+        stop_child();
+        deadline_ = never;
+        rx_.clear();
+        record().detail = record().detail.empty() ? why : record().detail + ": " + why;
+        if (attempt_ < (step().attempts ? step().attempts : max_attempts_)) {
+            begin_attempt();
+            return;
+        }
+        record().seconds = std::chrono::duration<double>(clock_type::now() - step_start_).count();
+        if (step().replan) {
+            // Plan with what was captured, the rest counts as unknown
+            std::string why_failed = record().detail;
+            replan();
+            record().ok     = true;
+            record().detail = why_failed + ", " + record().detail;
+            step_++;
+            begin_step();
+            return;
+        }
+        finish(false);
+    }
+
+    /*!
+     * \brief Drop the later steps that the plan of the current one leaves out
+     */
+    void replan()
+    {
+        std::string              note;
+        std::vector<std::string> keep = step().replan(config_, captured_, note);
+        record().detail               = note;
+
+        auto end = std::remove_if(steps_.begin() + step_ + 1, steps_.end(), [&](const step_spec* s) {
+            if (std::find(keep.begin(), keep.end(), s->name) != keep.end()) {
+                return false;
+            }
+            skipped_.push_back(s->name);
+            return true;
+        });
+        steps_.erase(end, steps_.end());
+    }
+
+    void finish(bool ok)
+    {
+        if (port_.fd() >= 0) {
+            loop_.remove(port_.fd());
+            port_ = abw::serial_port();
+        }
+        finished_ = true;
+        ok_       = ok;
+        deadline_ = never;
+        seconds_  = std::chrono::duration<double>(clock_type::now() - start_).count();
+    }
+
+    // --- Serial line -------------------------------------------------------
+
+    void queue(const std::string& text) { queue(reinterpret_cast<const uint8_t*>(text.data()), text.size()); }
+
+    void queue(const uint8_t* p, size_t n)
+    {
+        out_.insert(out_.end(), p, p + n);
+        flush();
+    }
+
+    void flush()
+    {
+        while (!out_.empty()) {
+            ssize_t n = ::write(port_.fd(), out_.data(), out_.size());
+            if (n <= 0) {
+                break;
+            }
+            out_.erase(out_.begin(), out_.begin() + n);
+        }
+        loop_.modify(port_.fd(), out_.empty() ? EPOLLIN : EPOLLIN | EPOLLOUT);
+    }
+
+    void change_baud(uint32_t baud)
+    {
+        port_.set_baud(baud);  // Waits for the last bytes to leave
+        port_.flush_input();
+        rx_.clear();
+        next();
+    }
+
+    void on_serial(uint32_t events)
+    {
+        if (events & EPOLLOUT) {
+            flush();
+            if (out_.empty() && !finished_ && actions_[action_].type == action::kind::baud) {
+                change_baud(actions_[action_].value);
+            }
+        }
+        if (finished_ || !(events & (EPOLLIN | EPOLLERR | EPOLLHUP))) {
+            return;
+        }
+
+        char buf[1024];
+        for (;;) {
+            ssize_t n = ::read(port_.fd(), buf, sizeof(buf));
+            for (ssize_t i = 0; i < n; i++) {
+                // What follows the end of a transfer is for the next action
+                if (sender_ && !sender_->finished()) {
+                    sender_->on_input(reinterpret_cast<const uint8_t*>(buf + i), 1);
+                } else {
+                    rx_ += buf[i];
+                }
+            }
+            if (n > 0) {
+                continue;
+            }
+            if (n == 0 || errno == EAGAIN || errno == EINTR) {
+                break;  // Raw ttys read 0 when empty, hangups show as errors
+            }
+            // Board unplugged or stand-in gone: nothing more to do
+            records_.back().detail += ": serial line closed";
+            finish(false);
+            return;
+        }
+        if (sender_) {
+            pump_xmodem();
+        } else {
+            check_input();
+        }
+    }
+
+    void check_input()
+    {
+        if (action_ >= actions_.size()) {
+            return;
+        }
+        const action& a = actions_[action_];
+        std::smatch   match;
+
+        switch (a.type) {
+        case action::kind::expect:
+            if (std::regex_search(rx_, match, std::regex(a.text))) {
+                rx_.erase(0, size_t(match.position(0) + match.length(0)));
+                next();
+            }
+            break;
+        case action::kind::prompt:
+            if (abw::mfg_cli::ends_with_prompt(rx_)) {
+                bool error = rx_.find("ERROR") != std::string::npos;
+                rx_.clear();
+                if (error) {
+                    fail("command failed");
+                } else {
+                    next();
+                }
+            }
+            break;
+        case action::kind::capture:
+            if (a.text.empty() ? abw::mfg_cli::ends_with_prompt(rx_)
+                               : std::regex_search(rx_, match, std::regex(a.text + "[^\n]*\n"))) {
+                size_t end = a.text.empty() ? rx_.size() : size_t(match.position(0) + match.length(0));
+                captured_ += rx_.substr(0, end);
+                rx_.erase(0, end);
+                next();
+            }
+            break;
+        case action::kind::probe:
+            if (in_bootloader_) {
+                if (rx_.find("bootloader v") != std::string::npos && abw::mfg_cli::ends_with_prompt(rx_)) {
+                    captured_ += rx_;
+                    rx_.clear();
+                    // What follows is for the MFG CLI, the bootloader would take it as keystrokes
+                    action_ = actions_.size() - 1;
+                    next();
+                }
+                break;
+            }
+            if (abw::mfg_cli::ends_with_prompt(rx_) && bootloader_prompt(rx_)) {
+                in_bootloader_ = true;
+                rx_.clear();
+                queue("v");
+                wait_until(action_end_);
+                break;
+            }
+            // Fall through
+        case action::kind::login:
+            if (!abw::mfg_cli::ends_with_prompt(rx_)) {
+                break;
+            }
+            if (rx_.find("login:") == std::string::npos) {
+                rx_.clear();
+                next();
+            } else if (logging_in_) {
+                fail("login refused");
+            } else {
+                logging_in_ = true;
+                rx_.clear();
+                queue(a.text + "\r");
+                wait_until(action_end_);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    /*!
+     * \brief True when the last line is the bare prompt of the ABW bootloader
+     */
+    static bool bootloader_prompt(const std::string& text)
+    {
+        size_t end = text.find_last_not_of(' ');
+        return end != std::string::npos && text[end] == '>' &&
+               (end == 0 || text[end - 1] == '\n' || text[end - 1] == '\r');
+    }
+
+    void pump_xmodem()
+    {
+        if (sender_->output_size()) {
+            queue(sender_->output(), sender_->output_size());
+            sender_->output_done();
+        }
+
+        const auto& st = sender_->stats();
+        if (sender_->finished()) {
+            bool ok = sender_->get_state() == abw::xmodem_sender::state::done;
+            char text[80];
+            std::snprintf(text, sizeof(text), "%u blocks, %u NAKs", unsigned(st.blocks), unsigned(st.naks));
+            record().detail += record().detail.empty() ? text : std::string(", ") + text;
+            sender_.reset();
+            if (ok) {
+                next();
+            } else {
+                fail(st.started ? "XMODEM transfer failed" : "no XMODEM receiver");
+            }
+            return;
+        }
+
+        // Too many errors: leave the line to a slower retry
+        uint32_t errors = st.naks + st.timeouts;
+        if (errors >= 3 && errors > 0.05 * (st.blocks + errors)) {
+            sender_->cancel();
+            pump_xmodem();
+            return;
+        }
+        sender_->prefetch();
+        deadline_ = clock_type::now() + std::chrono::milliseconds(sender_->timeout_ms());
+    }
+
+    // --- External programmer ----------------------------------------------
+
+    void start_child(const std::string& command)
+    {
+        int fds[2];
+        if (::pipe2(fds, O_CLOEXEC) < 0) {
+            fail(std::string("pipe: ") + std::strerror(errno));
+            return;
+        }
+
+        posix_spawn_file_actions_t files;
+        ::posix_spawn_file_actions_init(&files);
+        ::posix_spawn_file_actions_adddup2(&files, fds[1], 1);
+        ::posix_spawn_file_actions_adddup2(&files, fds[1], 2);
+        ::posix_spawn_file_actions_addopen(&files, 0, "/dev/null", O_RDONLY, 0);
+
+        std::string shell = "/bin/sh";
+        std::string flag  = "-c";
+        char*       argv[] = {&shell[0], &flag[0], const_cast<char*>(command.c_str()), nullptr};
+        int         err    = ::posix_spawn(&child_, "/bin/sh", &files, nullptr, argv, environ);
+        ::posix_spawn_file_actions_destroy(&files);
+        ::close(fds[1]);
+        if (err) {
+            ::close(fds[0]);
+            child_ = -1;
+            fail(std::string("spawn: ") + std::strerror(err));
+            return;
+        }
+
+        child_out_ = fds[0];
+        child_log_.clear();
+        abw::set_nonblocking(child_out_);
+        loop_.add(child_out_, EPOLLIN, [this](uint32_t) { on_child(); });
+    }
+
+    void on_child()
+    {
+        char buf[512];
+        for (;;) {
+            ssize_t n = ::read(child_out_, buf, sizeof(buf));
+            if (n > 0) {
+                child_log_.append(buf, size_t(n));
+                if (child_log_.size() > 4096) {
+                    child_log_.erase(0, child_log_.size() - 4096);
+                }
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+                return;
+            }
+            break;  // End of output: the command is exiting
+        }
+
+        int status = 0;
+        ::waitpid(child_, &status, 0);
+        child_ = -1;
+        close_child_output();
+
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+            next();
+            return;
+        }
+        std::string last = child_log_.substr(0, child_log_.find_last_not_of("\r\n") + 1);
+        last             = last.substr(last.find_last_of("\r\n") + 1);
+        fail("programmer exit status " + std::to_string(WIFEXITED(status) ? WEXITSTATUS(status) : -1) +
+             (last.empty() ? "" : " (" + last + ")"));
+    }
+
+    void close_child_output()
+    {
+        if (child_out_ >= 0) {
+            loop_.remove(child_out_);
+            ::close(child_out_);
+            child_out_ = -1;
+        }
+    }
+
+    void stop_child()
+    {
+        if (child_ > 0) {
+            ::kill(child_, SIGKILL);
+            ::waitpid(child_, nullptr, 0);
+            child_ = -1;
+        }
+        close_child_output();
+    }
+
+    abw::event_loop&                    loop_;
+    device_config                       config_;
+    std::vector<const step_spec*>       steps_;
+    unsigned                            max_attempts_;
+    abw::serial_port                    port_;
+    std::vector<step_record>            records_;
+    std::vector<std::string>            skipped_;
+    std::vector<action>                 actions_;
+    size_t                              step_          = 0;
+    size_t                              action_        = 0;
+    unsigned                            attempt_       = 0;
+    bool                                logging_in_    = false;
+    bool                                in_bootloader_ = false;  //!< The probe met the ABW bootloader
+    bool                                started_       = false;
+    bool                                finished_      = false;
+    bool                                ok_            = false;
+    double                              seconds_       = 0;
+    std::string                         rx_;
+    std::string                         captured_;  //!< Output kept by capture and probe for the plan
+    std::vector<uint8_t>                out_;
+    std::unique_ptr<abw::xmodem_sender> sender_;
+    pid_t                               child_     = -1;
+    int                                 child_out_ = -1;
+    std::string                         child_log_;
+    clock_type::time_point              start_;
+    clock_type::time_point              step_start_;
+    clock_type::time_point              action_end_;
+    clock_type::time_point              deadline_ = never;
+};
+
+/*!
+ * \brief Station settings and the artifacts shared by all boards
+ */
+struct station {
+    std::string              firmware_dir   = "firmware-binaries";
+    std::vector<std::string> steps          = {"fus", "ble", "bootloader", "mfg", "lr11xx", "mt3333"};
+    std::string              programmer     = "STM32_Programmer_CLI -c port=SWD sn={sn}";
+    std::string              mt3333_flasher;
+    unsigned                 bridge_speed   = 8;
+    unsigned                 bridge_if      = 2;
+    std::string              chip           = "lr11xx";
+    std::string              password       = "456";
+    unsigned                 attempts       = 3;
+    size_t                   max_parallel   = 0;
+    std::string              csv;
+    bool                     plan           = false;
+    bool                     plan_only      = false;
+
+    std::vector<abw::artifact> artifacts;
+    abw::mapped_file           mfg;
+    abw::mapped_file           lr11xx;
+    uint16_t                   lr11xx_version = 0;
+    std::string                gnss_version;
+    abw::fleet_target          target;  //!< Versions of the selected steps, for --plan
+};
+
+const char* const fus_image        = "ble/stm32wb5x_FUS_fw_1.2.0.bin";
+const char* const ble_image        = "ble/stm32wb5x_BLE_Stack_full_fw_1.15.0.bin";
+const char* const bootloader_image = "bootloader/abw-bootloader-release_v3.0.bin";
+const char* const mfg_image        = "mfg/mfg-usb-evk-debug.bin";
+const char* const lr11xx_image     = "lr11xx/lr1110_transceiver_0308/lr1110_transceiver_0308.bin";
+const char* const mt3333_image     = "mt33xx/20190417_GENERAL_Module_AXN5.1.7_C33_SDK_11.bin";
+const char* const mt3333_da        = "mt33xx/MTK_AllInOne_DA_MT3333_MP.BIN";
+
+/*!
+ * \brief Artifact of the manifest, throws std::runtime_error if missing or not matching its md5sum file
+ */
+const abw::artifact& need(const station& st, const std::string& path)
+{
+    const abw::artifact* a = abw::find_artifact(st.artifacts, path);
+    if (!a) {
+        throw std::runtime_error("no " + st.firmware_dir + "/" + path);
+    }
+    if (!a->md5_matches()) {
+        throw std::runtime_error(st.firmware_dir + "/" + path + " does not match its md5sum file");
+    }
+    return *a;
+}
+
+std::string hex_address(const abw::artifact& a)
+{
+    char text[12];
+    std::snprintf(text, sizeof(text), "0x%08X", unsigned(a.load_address));
+    return text;
+}
+
+/*!
+ * \brief Check the artifacts against the manifest, map the images sent over XMODEM
+ */
+void load_artifacts(station& st)
+{
+    abw::digest_cache cache(abw::digest_cache::default_path());
+    st.artifacts = abw::scan_artifacts(st.firmware_dir, &cache);
+    for (const auto& step : st.steps) {
+        if (step == "fus") {
+            need(st, fus_image);
+        } else if (step == "ble") {
+            need(st, ble_image);
+        } else if (step == "bootloader") {
+            need(st, bootloader_image);
+            abw::mapped_file  image(st.firmware_dir + "/" + bootloader_image);
+            abw::vector_check c = abw::check_vectors(image.data(), image.size(), abw::bootloader_slot);
+            if (!c.ok) {
+                throw std::runtime_error(st.firmware_dir + "/" + bootloader_image + " is not a bootloader: " + c.error);
+            }
+        } else if (step == "mt3333") {
+            need(st, mt3333_image);
+            need(st, mt3333_da);
+        }
+    }
+
+    // Also needed by the simulated boards
+    need(st, mfg_image);
+    st.mfg            = abw::mapped_file(st.firmware_dir + "/" + mfg_image);
+    st.lr11xx         = abw::mapped_file(st.firmware_dir + "/" + lr11xx_image);
+    st.lr11xx_version = uint16_t(std::stoul(need(st, lr11xx_image).version, nullptr, 16));
+    st.gnss_version   = abw::find_artifact(st.artifacts, mt3333_image)
+                          ? abw::find_artifact(st.artifacts, mt3333_image)->version
+                          : std::string();
+
+    // Sent through ABWu, checked before any board gets it
+    abw::vector_check app = abw::check_vectors(st.mfg.data(), st.mfg.size());
+    if (!app.ok) {
+        throw std::runtime_error(st.firmware_dir + "/" + mfg_image + " is not an application for ABWu: " + app.error);
+    }
+
+    for (const auto& step : st.steps) {
+        if (step == "fus") {
+            st.target.fus = need(st, fus_image).version;
+        } else if (step == "ble") {
+            st.target.ble_stack = need(st, ble_image).version;
+        } else if (step == "bootloader") {
+            st.target.bootloader = need(st, bootloader_image).version;
+        } else if (step == "mfg") {
+            st.target.mfg_build = abw::mfg_build_stamp(st.mfg.data(), st.mfg.size());
+            if (st.target.mfg_build.empty() && st.plan) {
+                throw std::runtime_error("no build stamp in " + st.firmware_dir + "/" + mfg_image);
+            }
+        } else if (step == "lr11xx") {
+            st.target.lr11xx_version = st.lr11xx_version;
+        } else if (step == "mt3333") {
+            st.target.mt3333 = st.gnss_version;
+        }
+    }
+}
+
+/*!
+ * \brief Components that differ, "up to date" if none
+ */
+std::string describe(const std::vector<abw::component_plan>& plan)
+{
+    std::string text;
+    for (const auto& c : plan) {
+        if (c.needed) {
+            text += (text.empty() ? "" : ", ") + c.step + " " + (c.have.empty() ? "?" : c.have) + " -> " + c.want;
+        }
+    }
+    return text.empty() ? "up to date" : text;
+}
+
+std::vector<step_spec> make_steps(station& st)
+{
+    std::vector<step_spec> steps;
+    const std::string      dir = st.firmware_dir + "/";
+
+    auto programmer = [&st](const device_config& d, const std::string& args) {
+        return replace_all(st.programmer, {{"{sn}", d.stlink_sn}}) + " " + args;
+    };
+
+    if (st.plan) {
+        steps.push_back({"survey",
+                         [&st](const device_config&, unsigned) {
+                             attempt_plan plan;
+                             plan.actions.push_back(probe(st.password, 15000));
+                             for (std::string command : abw::survey_commands) {
+                                 if (command.compare(0, 7, "lr11xx ") == 0) {
+                                     command = st.chip + command.substr(6);
+                                 }
+                                 plan.actions.push_back(send(command + "\r"));
+                                 // The MT3333 answers after the prompt of the command
+                                 plan.actions.push_back(command == "gnss mt3333 version"
+                                                            ? capture("MT3333 [a-z]+\\s*:", 5000)
+                                                            : capture("", 5000));
+                             }
+                             return plan;
+                         },
+                         1,
+                         [&st](device_config& d, const std::string& captured, std::string& note) {
+                             abw::board_versions v = abw::parse_versions(captured);
+                             d.in_mfg_cli          = !captured.empty() && !v.in_bootloader;
+                             auto plan             = abw::plan_board(v, st.target);
+                             note                  = describe(plan);
+                             return abw::needed_steps(plan);
+                         }});
+        if (st.plan_only) {
+            return steps;
+        }
+    }
+
+    for (const auto& name : st.steps) {
+        if (name == "fus") {
+            const std::string address = hex_address(need(st, fus_image));
+            steps.push_back({name, [=](const device_config& d, unsigned) {
+                                 return attempt_plan{
+                                     {spawn(programmer(d, "-startfus -fwupgrade " + dir + fus_image + " " + address),
+                                            300000)},
+                                     ""};
+                             }});
+        } else if (name == "ble") {
+            const std::string address = hex_address(need(st, ble_image));
+            steps.push_back({name, [=](const device_config& d, unsigned) {
+                                 return attempt_plan{
+                                     {spawn(programmer(d, "-fwupgrade " + dir + ble_image + " " + address +
+                                                              " firstinstall=1"),
+                                            300000)},
+                                     ""};
+                             }});
+        } else if (name == "bootloader") {
+            const std::string address = hex_address(need(st, bootloader_image));
+            steps.push_back({name, [=](const device_config& d, unsigned) {
+                                 return attempt_plan{
+                                     {spawn(programmer(d, "-w " + dir + bootloader_image + " " + address + " -v -rst"),
+                                            120000)},
+                                     ""};
+                             }});
+        } else if (name == "mfg") {
+            steps.push_back({name, [&st](const device_config& d, unsigned attempt) {
+                                 attempt_plan plan;
+                                 if (d.in_mfg_cli && attempt == 0) {
+                                     // Restart the running application in the bootloader
+                                     plan.actions = {set_baud(abw::mfg_cli::default_baud), login(st.password, 15000),
+                                                     send("system bootloader\r"),
+                                                     expect("bootloader v[0-9.]+[^>]*>", 10000)};
+                                 }
+                                 std::vector<action> flash = {set_baud(abw::mfg_cli::default_baud), send("\r"),
+                                                              expect(">", 5000), send("ABWe"), delay(500), send("\r"),
+                                                              expect(">", 5000), send("ABWu"), xmodem(st.mfg, 10000),
+                                                              expect(">", 10000), send("r"),
+                                                              expect("Welcome to AOS", 15000)};
+                                 plan.actions.insert(plan.actions.end(), flash.begin(), flash.end());
+                                 return plan;
+                             }});
+        } else if (name == "lr11xx") {
+            steps.push_back({name, [&st](const device_config&, unsigned attempt) {
+                                 // Each retry goes one speed lower, not below 57600 baud
+                                 unsigned speed = st.bridge_speed > 6 + attempt ? st.bridge_speed - attempt
+                                                                                : std::min(st.bridge_speed, 6u);
+                                 uint32_t baud  = abw::bridge_speeds[speed];
+                                 return attempt_plan{
+                                     {set_baud(abw::mfg_cli::default_baud), login(st.password, 15000),
+                                      send(st.chip + " firmware update bridge " + std::to_string(st.bridge_if) +
+                                           " " + std::to_string(speed) + "\r"),
+                                      expect("Bootloader version[^\n]*\n", 5000), set_baud(baud),
+                                      xmodem(st.lr11xx, 3000), set_baud(abw::mfg_cli::default_baud),
+                                      login(st.password, 15000), send(st.chip + " firmware version\r"),
+                                      expect("Firmware version\\s*:\\s*" + abw::hex_version(st.lr11xx_version), 5000),
+                                      prompt(5000)},
+                                     std::to_string(baud) + " baud"};
+                             }});
+        } else if (name == "mt3333") {
+            std::string flash;
+            if (!st.mt3333_flasher.empty()) {
+                flash = replace_all(st.mt3333_flasher, {{"{da}", dir + mt3333_da}, {"{file}", dir + mt3333_image}});
+            }
+            steps.push_back({name, [&st, flash](const device_config& d, unsigned) {
+                                 attempt_plan plan;
+                                 plan.actions = {login(st.password, 15000), send("gnss mt3333 on\r"), prompt(5000)};
+                                 if (!flash.empty()) {
+                                     plan.actions.push_back(spawn(replace_all(flash, {{"{gnss_tty}", d.gnss_tty}}),
+                                                                  600000));
+                                 } else {
+                                     plan.note = "version check only";
+                                 }
+                                 plan.actions.push_back(send("gnss mt3333 version\r"));
+                                 plan.actions.push_back(expect(st.gnss_version, 5000));
+                                 plan.actions.push_back(prompt(5000));
+                                 return plan;
+                             }});
+        } else {
+            throw std::runtime_error("unknown step " + name);
+        }
+    }
+    return steps;
+}
+
+void report(const std::vector<std::unique_ptr<device>>& devices, const std::vector<std::string>& steps, double wall,
+            const std::string& csv)
+{
+    std::printf("%-10s", "board");
+    for (const auto& step : steps) {
+        std::printf(" %14s", step.c_str());
+    }
+    std::printf(" %10s\n", "total");
+
+    double sum = 0;
+    size_t ok  = 0;
+    for (const auto& d : devices) {
+        std::printf("%-10s", d->config().name.c_str());
+        for (const auto& step : steps) {
+            auto r = std::find_if(d->records().begin(), d->records().end(),
+                                  [&](const step_record& r) { return r.name == step; });
+            char cell[32] = "-";
+            if (std::find(d->skipped().begin(), d->skipped().end(), step) != d->skipped().end()) {
+                std::snprintf(cell, sizeof(cell), "skip");
+            } else if (r != d->records().end()) {
+                std::snprintf(cell, sizeof(cell), "%s%.1f s%s", r->ok ? "" : "FAIL ", r->seconds,
+                              r->attempts > 1 ? (" x" + std::to_string(r->attempts)).c_str() : "");
+            }
+            std::printf(" %14s", cell);
+        }
+        std::printf(" %8.1f s\n", d->seconds());
+        sum += d->seconds();
+        ok += d->ok();
+    }
+    std::printf("%zu of %zu boards provisioned, %.1f s wall time for %.1f s of board time (%.1fx)\n", ok,
+                devices.size(), wall, sum, sum / wall);
+
+    for (const auto& d : devices) {
+        for (const auto& r : d->records()) {
+            if (!r.ok || r.name == "survey") {
+                std::printf("%s %s: %s\n", d->config().name.c_str(), r.name.c_str(), r.detail.c_str());
+            }
+        }
+    }
+
+    if (!csv.empty()) {
+        std::ostringstream out;
+        out << "board,step,attempts,seconds,result,detail\n";
+        for (const auto& d : devices) {
+            for (const auto& r : d->records()) {
+                out << d->config().name << ',' << r.name << ',' << r.attempts << ',' << r.seconds << ','
+                    << (r.ok ? "ok" : "fail") << ",\"" << r.detail << "\"\n";
+            }
+        }
+        abw::write_file(csv, out.str());
+    }
+}
+
+bool provision(station& st, const std::vector<device_config>& configs)
+{
+    std::vector<step_spec>               steps = make_steps(st);
+    abw::event_loop                      loop;
+    std::vector<std::unique_ptr<device>> devices;
+    size_t                               limit = st.max_parallel ? st.max_parallel : configs.size();
+
+    for (const auto& config : configs) {
+        devices.emplace_back(new device(loop, config, steps, st.attempts));
+    }
+
+    auto start = clock_type::now();
+    for (;;) {
+        size_t active = 0;
+        bool   done   = true;
+        for (const auto& d : devices) {
+            active += d->started() && !d->finished();
+            done = done && d->finished();
+        }
+        for (auto it = devices.begin(); it != devices.end() && active < limit; ++it) {
+            if (!(*it)->started()) {
+                (*it)->start();
+                active++;
+                done = false;
+            }
+        }
+        if (done) {
+            break;
+        }
+
+        auto next = never;
+        for (const auto& d : devices) {
+            next = std::min(next, d->deadline());
+        }
+        int timeout = -1;
+        if (next != never) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(next - clock_type::now()).count();
+            timeout = int(std::max<int64_t>(0, ms + 1));
+        }
+        loop.run_once(timeout);
+        for (const auto& d : devices) {
+            d->on_deadline();
+        }
+    }
+
+    std::vector<std::string> columns;
+    for (const auto& step : steps) {
+        columns.push_back(step.name);
+    }
+    report(devices, columns, std::chrono::duration<double>(clock_type::now() - start).count(), st.csv);
+    return std::all_of(devices.begin(), devices.end(), [](const std::unique_ptr<device>& d) { return d->ok(); });
+}
+
+/*!
+ * \brief Provision simulated boards, each served by a stand-in thread on a pty
+ */
+bool simulate(station& st, unsigned count, bool fast)
+{
+    std::vector<std::unique_ptr<abw::pty_pair>>     ptys;
+    std::vector<std::unique_ptr<abw::mfg_cli_sim>>  boards;
+    std::vector<std::thread>                        threads;
+    std::vector<device_config>                      configs;
+    std::atomic<bool>                               stop(false);
+
+    for (unsigned i = 0; i < count; i++) {
+        abw::mfg_cli_sim_config config;
+        config.in_bootloader  = true;
+        config.app_build      = abw::mfg_build_stamp(st.mfg.data(), st.mfg.size());
+        if (st.plan) {
+            // A mix for the survey: current, LR11xx behind, older MFG and BLE stack, blank
+            config.in_bootloader = i % 4 == 3;
+            config.mfg_build     = i % 4 == 2 ? "Mar  4 2024, 10:12:40" : config.app_build;
+            config.ble_version   = i % 4 == 2 ? "1.13.0" : config.ble_version;
+            config.version       = i % 4 == 0 ? st.lr11xx_version : 0x0307;
+        }
+        config.app            = st.mfg.data();
+        config.app_size       = st.mfg.size();
+        config.image          = st.lr11xx.data();
+        config.image_size     = st.lr11xx.size();
+        config.update_version = st.lr11xx_version;
+        config.gnss_version   = st.gnss_version;
+        config.pacing         = !fast;
+        config.seed           = i + 1;
+
+        ptys.emplace_back(new abw::pty_pair(abw::mfg_cli::default_baud));
+        boards.emplace_back(new abw::mfg_cli_sim(ptys.back()->master, ptys.back()->slave_path, config));
+        configs.push_back({"sim" + std::to_string(i), ptys.back()->slave_path, "", std::to_string(i)});
+    }
+    for (auto& board : boards) {
+        abw::mfg_cli_sim* b = board.get();
+        threads.emplace_back([b, &stop] { b->run(stop); });
+    }
+
+    bool ok = false;
+    try {
+        ok = provision(st, configs);
+    } catch (...) {
+        stop = true;
+        for (auto& t : threads) {
+            t.join();
+        }
+        throw;
+    }
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    return ok;
+}
+
+int usage()
+{
+    std::cerr << "usage: abw-provision [options] [--plan|--plan-only] --device name:tty[:gnss_tty[:stlink_sn]]...\n"
+                 "       abw-provision [options] [--plan|--plan-only] --sim N [--sim-fast]\n";
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    station                    st;
+    std::vector<device_config> configs;
+    unsigned                   sim  = 0;
+    bool                       fast = false;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+            if (option == "--sim-fast") {
+                fast = true;
+                continue;
+            }
+            if (option == "--plan" || option == "--plan-only") {
+                st.plan      = true;
+                st.plan_only = st.plan_only || option == "--plan-only";
+                continue;
+            }
+            if (i + 1 >= argc) {
+                return usage();
+            }
+            std::string value = argv[++i];
+            if (option == "--device") {
+                std::vector<std::string> fields;
+                std::istringstream       in(value);
+                for (std::string field; std::getline(in, field, ':');) {
+                    fields.push_back(field);
+                }
+                if (fields.size() < 2) {
+                    return usage();
+                }
+                fields.resize(4);
+                configs.push_back({fields[0], fields[1], fields[2], fields[3]});
+            } else if (option == "--sim") {
+                sim = unsigned(std::stoul(value));
+            } else if (option == "--firmware-dir") {
+                st.firmware_dir = value;
+            } else if (option == "--steps") {
+                st.steps.clear();
+                std::istringstream in(value);
+                for (std::string step; std::getline(in, step, ',');) {
+                    st.steps.push_back(step);
+                }
+            } else if (option == "--programmer") {
+                st.programmer = value;
+            } else if (option == "--mt3333-flasher") {
+                st.mt3333_flasher = value;
+            } else if (option == "--bridge-speed") {
+                st.bridge_speed = std::min(9u, unsigned(std::stoul(value)));
+            } else if (option == "--bridge-interface") {
+                st.bridge_if = unsigned(std::stoul(value));
+            } else if (option == "--chip") {
+                st.chip = value;
+            } else if (option == "--password") {
+                st.password = value;
+            } else if (option == "--attempts") {
+                st.attempts = std::max(1u, unsigned(std::stoul(value)));
+            } else if (option == "--max-parallel") {
+                st.max_parallel = size_t(std::stoul(value));
+            } else if (option == "--csv") {
+                st.csv = value;
+            } else {
+                std::cerr << "unknown option " << option << "\n";
+                return 2;
+            }
+        }
+        if (configs.empty() == !sim) {
+            return usage();
+        }
+
+        load_artifacts(st);
+
+        bool ok;
+        if (sim) {
+            if (st.programmer == station().programmer) {
+                st.programmer = "sleep 1 && true";
+            }
+            if (st.mt3333_flasher.empty()) {
+                st.mt3333_flasher = "sleep 2 && true";
+            }
+            ok = simulate(st, sim, fast);
+        } else {
+            ok = provision(st, configs);
+        }
+        return ok ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "abw-provision: " << e.what() << "\n";
+        return 1;
+    }
+}
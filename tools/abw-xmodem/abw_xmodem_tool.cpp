@@ -0,0 +1,599 @@
+/*!
+ * \file      abw_xmodem_tool.cpp
+ *
+ * \brief     XMODEM-1K sender for the ABW bootloader (ABWu) and pty loopback benchmark
+ *
+ * Usage:
+ *   abw-xmodem send     [-b baud] [--128] [--command text] [--no-check] [--raw] <tty> <file.bin>
+ *   abw-xmodem send     --diff [-b baud] [--no-check] [--raw] <tty> <app.bin>
+ *   abw-xmodem loopback [-b baud] [--turnaround-us N] <file.bin>
+ *   abw-xmodem diff-loopback [--seed N] [--fast] <app.bin> [other.bin...]
+ *   abw-xmodem lzss-loopback [--fast] <file.bin>...
+ *
+ * send pushes a binary to a receiver already waiting on the line, or first
+ * types --command (e.g. ABWu) to start one. With ABWu, the image must pass
+ * the application vector table check of tools/common/abw_app_image.hpp
+ * before anything is typed, unless --no-check is given. When the bootloader
+ * answers ABWu with "Start xmodem, lzss <bits>", the image is sent as an LZSS
+ * stream (tools/common/abw_lzss_encoder.hpp) that it inflates into flash as
+ * the blocks arrive, unless --raw is given or the stream is not smaller.
+ * loopback runs the sender
+ * against an XMODEM receiver on the other side of a pseudo-terminal, in
+ * checksum, CRC-16, XMODEM-1K and 1K-refused modes. The receiver consumes
+ * the line at the given baud rate and waits --turnaround-us before each
+ * answer, as a bootloader programming its flash would. Every transfer is
+ * checked byte for byte; the exit status is non-zero on any failure.
+ *
+ * send --diff updates the application through the bootloader with only the
+ * flash pages that differ: ABWh lists the digests of the pages on the
+ * board, and ABWd receives the page stream of tools/common/abw_page_diff.hpp.
+ * If the bootloader reports the transfer as failed, the image is sent again
+ * in full through ABWu. diff-loopback runs the same flow against the
+ * bootloader of tools/common/mfg_cli_sim.hpp holding app.bin, for the
+ * synthetic releases of abw_releases.hpp, a rebuild of the same sources and
+ * each other image given, and reports what the differential update saves.
+ * lzss-loopback sends each file through ABWu to the same simulated
+ * bootloader, plain then compressed, and reports the transfer times.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_app_image.hpp"
+#include "abw_file.hpp"
+#include "abw_fleet_plan.hpp"
+#include "abw_lzss_encoder.hpp"
+#include "abw_mfg_cli.hpp"
+#include "abw_page_diff.hpp"
+#include "abw_releases.hpp"
+#include "abw_serial.hpp"
+#include "abw_xmodem.hpp"
+#include "mfg_cli_sim.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+int usage()
+{
+    std::cerr << "usage: abw-xmodem send     [-b baud] [--128] [--command text] [--no-check] [--raw] <tty> <file.bin>\n"
+                 "       abw-xmodem send     --diff [-b baud] [--no-check] [--raw] <tty> <app.bin>\n"
+                 "       abw-xmodem loopback [-b baud] [--turnaround-us N] <file.bin>\n"
+                 "       abw-xmodem diff-loopback [--seed N] [--fast] <app.bin> [other.bin...]\n"
+                 "       abw-xmodem lzss-loopback [--fast] <file.bin>...\n";
+    return 2;
+}
+
+/*!
+ * \brief Send data to the receiver waiting on the line, with progress and a summary on stderr
+ */
+bool transfer(abw::serial_port& port, const std::vector<uint8_t>& data, bool allow_1k, bool quiet = false)
+{
+    abw::xmodem_options options;
+    options.allow_1k = allow_1k;
+
+    abw::xmodem_sender sender(data.data(), data.size(), options);
+    auto               start = clock_type::now();
+    bool               ok    = abw::xmodem_send(port, sender, [&](size_t done) {
+        if (!quiet) {
+            std::fprintf(stderr, "\r%zu / %zu bytes", done, data.size());
+        }
+    });
+    double             secs  = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    const auto& st = sender.stats();
+    if (!quiet) {
+        std::fprintf(stderr, "\n%s: %s, %u blocks (%u of 1K), %u NAKs, %u timeouts, %.1f s, %.0f bytes/s\n",
+                     ok ? "done" : "failed", st.crc ? (st.blocks_1k ? "XMODEM-1K" : "XMODEM-CRC") : "XMODEM-checksum",
+                     unsigned(st.blocks), unsigned(st.blocks_1k), unsigned(st.naks), unsigned(st.timeouts), secs,
+                     sender.acknowledged() / secs);
+    }
+    return ok;
+}
+
+void check_app(const std::vector<uint8_t>& image, const std::string& path)
+{
+    abw::vector_check c = abw::check_vectors(image.data(), image.size());
+    if (!c.ok) {
+        throw std::runtime_error(path + " is not an application for ABWu: " + c.error);
+    }
+}
+
+/*!
+ * \brief After ABWu, what to send: the image, or its LZSS stream if the bootloader announces that it takes one
+ *
+ * The announcement is read byte by byte, so that the first poll of the
+ * receiver stays on the line.
+ */
+std::vector<uint8_t> app_payload(abw::serial_port& port, const std::vector<uint8_t>& image, bool lzss, bool quiet)
+{
+    static const std::regex announce("Start xmodem, lzss ([0-9]+)");
+
+    std::string line;
+    auto        end = clock_type::now() + std::chrono::seconds(5);
+    while (line.find("Start xmodem") == std::string::npos || line.back() != '\n') {
+        char c;
+        if (clock_type::now() > end) {
+            return image;  // Nothing announced, the receiver may still start
+        }
+        if (port.read(&c, 1, 100)) {
+            line += c;
+        }
+    }
+
+    std::smatch match;
+    unsigned    bits = std::regex_search(line, match, announce) ? unsigned(std::stoul(match[1])) : 0;
+    if (!lzss || bits < 8) {
+        return image;
+    }
+    std::vector<uint8_t> stream = abw::lzss_compress(image, std::min(bits, 12u));
+    if (!quiet) {
+        std::fprintf(stderr, "lzss %u: %zu bytes for %zu (%.3f)%s\n", std::min(bits, 12u), stream.size(),
+                     image.size(), double(stream.size()) / double(image.size()),
+                     stream.size() < image.size() ? "" : ", sending the image as is");
+    }
+    return stream.size() < image.size() ? stream : image;
+}
+
+void send(const std::string& tty, const std::string& path, uint32_t baud, bool allow_1k, const std::string& command,
+          bool check, bool lzss)
+{
+    std::vector<uint8_t> image = abw::read_file(path);
+    if (check && command == "ABWu") {
+        check_app(image, path);
+    }
+    abw::serial_port port(tty, baud);
+
+    if (!command.empty()) {
+        port.flush_input();
+        port.write(command + "\r");
+    }
+    if (!transfer(port, command == "ABWu" ? app_payload(port, image, lzss, false) : image, allow_1k)) {
+        throw std::runtime_error("transfer failed");
+    }
+}
+
+/*!
+ * \brief What a differential update did
+ */
+struct diff_result {
+    abw::page_stream_stats pages;
+    size_t                 stream_bytes = 0;
+    bool                   applied      = false;  //!< The bootloader accepted the page stream
+    bool                   full         = false;  //!< The image then went through ABWu
+};
+
+/*!
+ * \brief Bootloader answer to a transfer, true for "Transfer done"
+ */
+bool transfer_verdict(abw::mfg_cli& cli)
+{
+    std::string text = cli.read_prompt(10000);
+    return text.find("Transfer done") != std::string::npos;
+}
+
+/*!
+ * \brief Update the application through ABWh and ABWd, or through ABWu if the bootloader refuses the page stream
+ */
+diff_result send_diff(abw::serial_port& port, const std::vector<uint8_t>& image, bool lzss = true, bool quiet = false)
+{
+    abw::mfg_cli cli(port);
+    diff_result  r;
+
+    // Bootloader commands are keystrokes, no Enter
+    port.flush_input();
+    port.write("\r");
+    cli.read_prompt(3000);
+    cli.read_idle(100);
+    port.write("ABWh");
+    std::vector<uint32_t> resident = abw::parse_page_digests(cli.read_prompt(10000));
+
+    std::vector<uint8_t> stream = abw::make_page_stream(image.data(), image.size(), resident, &r.pages);
+    r.stream_bytes              = stream.size();
+    if (!quiet) {
+        std::fprintf(stderr, "%u of %u pages differ, %u to erase past the image: %zu bytes instead of %zu\n",
+                     unsigned(r.pages.sent), unsigned(r.pages.image_pages), unsigned(r.pages.stale), stream.size(),
+                     image.size());
+    }
+
+    port.write("ABWd");
+    r.applied = transfer(port, stream, true, quiet) && transfer_verdict(cli);
+    if (!r.applied) {
+        std::fprintf(stderr, "page stream refused, sending the whole image through ABWu\n");
+        port.flush_input();
+        port.write("ABWu");
+        r.full = true;
+        if (!transfer(port, app_payload(port, image, lzss, quiet), true, quiet) || !transfer_verdict(cli)) {
+            throw std::runtime_error("transfer failed");
+        }
+    }
+    return r;
+}
+
+/*!
+ * \brief Receiver thread of the loopback: paces the line and checks the frames
+ */
+void receive(abw::serial_port& line, abw::xmodem_receiver& rx, uint32_t baud, uint32_t turnaround_us)
+{
+    const auto start   = clock_type::now();
+    double     line_us = 0;
+    uint8_t    buf[256];
+
+    auto transmit = [&](uint8_t c) {
+        if (turnaround_us) {
+            std::this_thread::sleep_for(std::chrono::microseconds(turnaround_us));
+            line_us += turnaround_us;
+        }
+        line.write(&c, 1);
+        line_us += baud ? 10e6 / baud : 0;
+    };
+
+    uint8_t c = rx.poll();
+    line.write(&c, 1);
+    for (unsigned idle = 0; !rx.done() && !rx.failed() && idle < 10;) {
+        size_t n = line.read(buf, sizeof(buf), 1000);
+        if (!n) {
+            transmit(rx.poll());
+            idle++;
+            continue;
+        }
+        idle = 0;
+        // Bytes cannot arrive faster than the line carries them
+        if (baud) {
+            line_us += n * 10e6 / baud;
+            std::this_thread::sleep_until(start + std::chrono::microseconds(int64_t(line_us)));
+        }
+        for (size_t off = 0, used; off < n; off += used) {
+            uint8_t answer = rx.on_input(buf + off, n - off, used);
+            if (answer) {
+                transmit(answer);
+            }
+        }
+    }
+}
+
+bool loopback_run(const char* label, const std::vector<uint8_t>& image, uint32_t baud, uint32_t turnaround_us,
+                  bool rx_crc, bool rx_1k, bool tx_1k, double& rate)
+{
+    abw::pty_pair        pty(baud ? baud : 115200);
+    abw::xmodem_receiver rx(rx_crc, rx_1k);
+    abw::xmodem_options  options;
+    options.allow_1k = tx_1k;
+    abw::xmodem_sender sender(image.data(), image.size(), options);
+
+    auto        start = clock_type::now();
+    std::thread board([&] { receive(pty.master, rx, baud, turnaround_us); });
+    bool        ok = abw::xmodem_send(pty.slave, sender);
+    board.join();
+    double secs = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    const auto& data = rx.data();
+    ok               = ok && rx.done() && data.size() >= image.size() &&
+         std::equal(image.begin(), image.end(), data.begin()) &&
+         std::all_of(data.begin() + image.size(), data.end(), [](uint8_t c) { return c == abw::xmodem::pad; });
+
+    const auto& st = sender.stats();
+    rate           = image.size() / secs;
+    std::printf("%-12s %5u blocks (%4u of 1K)  %7llu wire bytes  %3u NAKs  %7.2f s  %8.0f bytes/s  %s\n", label,
+                unsigned(st.blocks), unsigned(st.blocks_1k), (unsigned long long)st.wire_bytes, unsigned(st.naks),
+                secs, rate, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+bool loopback(const std::string& path, uint32_t baud, uint32_t turnaround_us)
+{
+    std::vector<uint8_t> image = abw::read_file(path);
+    double               base, rate;
+
+    std::printf("%s: %zu bytes, %u baud, %u us turnaround\n", abw::base_name(path).c_str(), image.size(),
+                unsigned(baud), unsigned(turnaround_us));
+    bool ok = loopback_run("checksum", image, baud, turnaround_us, false, false, false, base);
+    ok      = loopback_run("crc-128", image, baud, turnaround_us, true, false, false, rate) && ok;
+    ok      = loopback_run("crc-1k", image, baud, turnaround_us, true, true, true, rate) && ok;
+    std::printf("XMODEM-1K is %.2fx the 128-byte checksum baseline\n", rate / base);
+    ok = loopback_run("1k-refused", image, baud, turnaround_us, true, false, true, rate) && ok;
+    return ok;
+}
+
+/*!
+ * \brief Image rebuilt from the same sources: only the build stamp changes
+ */
+std::vector<uint8_t> restamp(const std::vector<uint8_t>& image)
+{
+    std::string          stamp = abw::mfg_build_stamp(image.data(), image.size());
+    std::vector<uint8_t> out   = image;
+    if (stamp.size() < 8) {
+        return out;
+    }
+    std::string time = stamp.substr(stamp.size() - 8);
+    auto        at   = std::search(out.begin(), out.end(), time.begin(), time.end());
+    if (at != out.end()) {
+        std::copy_n("09:41:07", 8, at);
+    }
+    return out;
+}
+
+/*!
+ * \brief Update a simulated bootloader holding resident to target with send_diff(), and check its flash
+ */
+bool diff_run(const char* name, const char* what, const std::vector<uint8_t>& resident,
+              const std::vector<uint8_t>& target, bool pacing, double full_secs_per_byte)
+{
+    abw::pty_pair           pty(abw::mfg_cli::default_baud);
+    std::atomic<bool>       stop(false);
+    abw::mfg_cli_sim_config config;
+    config.in_bootloader = true;
+    config.pacing        = pacing;
+    config.resident      = resident.data();
+    config.resident_size = resident.size();
+    config.app           = target.data();
+    config.app_size      = target.size();
+
+    abw::mfg_cli_sim board(pty.master, pty.slave_path, config);
+    std::thread      thread([&] { board.run(stop); });
+    diff_result      r;
+    auto             start = clock_type::now();
+    try {
+        abw::serial_port port(pty.slave_path, abw::mfg_cli::default_baud);
+        r = send_diff(port, target, true, true);
+    } catch (...) {
+        stop = true;
+        thread.join();
+        throw;
+    }
+    double secs = std::chrono::duration<double>(clock_type::now() - start).count();
+    stop        = true;
+    thread.join();
+
+    const auto& flash = board.flash();
+    bool        ok    = r.applied && board.counters().apps == 1 &&
+             std::equal(target.begin(), target.end(), flash.begin()) &&
+             std::all_of(flash.begin() + target.size(), flash.end(), [](uint8_t c) { return c == 0xFF; });
+
+    char full[16] = "-";
+    if (full_secs_per_byte > 0) {
+        std::snprintf(full, sizeof(full), "%.1f s", full_secs_per_byte * target.size());
+    }
+    std::printf("%-12s %-44s %4u/%-4u %5u %8zu %8zu %6.1f%% %8.1f s %8s  %s\n", name, what, unsigned(r.pages.sent),
+                unsigned(r.pages.image_pages), unsigned(r.pages.stale), r.stream_bytes, target.size(),
+                100.0 * (1 - double(r.stream_bytes) / double(target.size())), secs, full, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+/*!
+ * \brief A page stream made for other flash content must leave the board in the bootloader
+ */
+bool diff_refused(const std::vector<uint8_t>& resident, const std::vector<uint8_t>& target)
+{
+    abw::pty_pair           pty(abw::mfg_cli::default_baud);
+    std::atomic<bool>       stop(false);
+    abw::mfg_cli_sim_config config;
+    config.in_bootloader = true;
+    config.pacing        = false;
+    config.resident      = resident.data();
+    config.resident_size = resident.size();
+    config.app           = target.data();
+    config.app_size      = target.size();
+
+    abw::mfg_cli_sim board(pty.master, pty.slave_path, config);
+    std::thread      thread([&] { board.run(stop); });
+    bool             refused = false;
+    try {
+        abw::serial_port port(pty.slave_path, abw::mfg_cli::default_baud);
+        abw::mfg_cli     cli(port);
+
+        // Digests of the target itself: nothing is sent, and the image check must catch it
+        std::vector<uint8_t> stream =
+            abw::make_page_stream(target.data(), target.size(), abw::page_digests(target.data(), target.size()));
+        cli.read_idle(100);
+        port.write("ABWd");
+        refused = transfer(port, stream, true, true) && !transfer_verdict(cli);
+    } catch (...) {
+        stop = true;
+        thread.join();
+        throw;
+    }
+    stop = true;
+    thread.join();
+    return refused && board.counters().apps == 0;
+}
+
+bool diff_loopback(const std::vector<std::string>& paths, uint32_t seed, bool fast)
+{
+    std::vector<uint8_t> base = abw::read_file(paths[0]);
+    check_app(base, paths[0]);
+
+    // Full transfer time, measured once on the resident image and scaled by size
+    double full_secs_per_byte = 0;
+    if (!fast) {
+        abw::pty_pair           pty(abw::mfg_cli::default_baud);
+        std::atomic<bool>       stop(false);
+        abw::mfg_cli_sim_config config;
+        config.in_bootloader = true;
+        config.app           = base.data();
+        config.app_size      = base.size();
+
+        abw::mfg_cli_sim board(pty.master, pty.slave_path, config);
+        std::thread      thread([&] { board.run(stop); });
+        abw::serial_port port(pty.slave_path, abw::mfg_cli::default_baud);
+        abw::mfg_cli     cli(port);
+        auto             start = clock_type::now();
+        cli.read_idle(100);
+        port.write("ABWu");
+        bool ok            = transfer(port, base, true, true) && transfer_verdict(cli);
+        full_secs_per_byte = std::chrono::duration<double>(clock_type::now() - start).count() / double(base.size());
+        stop               = true;
+        thread.join();
+        if (!ok) {
+            throw std::runtime_error("full transfer of " + paths[0] + " failed");
+        }
+    }
+
+    std::printf("resident %s, %zu bytes, %u pages of %u bytes%s\n", abw::base_name(paths[0]).c_str(), base.size(),
+                unsigned(abw::page_digests(base.data(), base.size()).size()), unsigned(abw::flash_page_size),
+                fast ? ", unpaced" : ", 57600 baud");
+    std::printf("%-12s %-44s %9s %5s %8s %8s %7s %10s %8s\n", "release", "changes", "pages", "stale", "stream", "image",
+                "saved", "diff", "full");
+
+    bool ok = diff_run("identical", "same image", base, base, !fast, full_secs_per_byte);
+    ok      = diff_run("rebuild", "same sources, new build time", base, restamp(base), !fast, full_secs_per_byte) && ok;
+    for (const auto& r : abw::make_releases(base, seed)) {
+        ok = diff_run(r.name, r.what, base, r.image, !fast, full_secs_per_byte) && ok;
+    }
+    for (size_t i = 1; i < paths.size(); i++) {
+        std::vector<uint8_t> other = abw::read_file(paths[i]);
+        std::string          name  = abw::base_name(paths[i]);
+        ok = diff_run("other", name.c_str(), base, other, !fast, full_secs_per_byte) && ok;
+    }
+
+    if (diff_refused(base, restamp(base))) {
+        std::printf("a page stream made for other flash content was refused\n");
+    } else {
+        std::printf("a page stream made for other flash content was NOT refused\n");
+        ok = false;
+    }
+    return ok;
+}
+
+/*!
+ * \brief Send an image through ABWu to a simulated bootloader, and check its flash
+ *
+ * \returns Seconds from ABWu to the bootloader verdict, negative on failure
+ */
+double lzss_run(const std::vector<uint8_t>& image, bool lzss, bool pacing, size_t& sent)
+{
+    abw::pty_pair           pty(abw::mfg_cli::default_baud);
+    std::atomic<bool>       stop(false);
+    abw::mfg_cli_sim_config config;
+    config.in_bootloader = true;
+    config.pacing        = pacing;
+    config.app           = image.data();
+    config.app_size      = image.size();
+
+    abw::mfg_cli_sim board(pty.master, pty.slave_path, config);
+    std::thread      thread([&] { board.run(stop); });
+    bool             ok   = false;
+    double           secs = 0;
+    try {
+        abw::serial_port port(pty.slave_path, abw::mfg_cli::default_baud);
+        abw::mfg_cli     cli(port);
+        cli.read_idle(100);
+
+        auto start = clock_type::now();
+        port.write("ABWu");
+        std::vector<uint8_t> payload = app_payload(port, image, lzss, true);
+        sent                         = payload.size();
+        ok   = transfer(port, payload, true, true) && transfer_verdict(cli);
+        secs = std::chrono::duration<double>(clock_type::now() - start).count();
+    } catch (...) {
+        stop = true;
+        thread.join();
+        throw;
+    }
+    stop = true;
+    thread.join();
+
+    // Compressed or not, the slot must hold the image; a plain transfer leaves the XMODEM padding after it
+    const auto& flash = board.flash();
+    ok = ok && board.counters().apps == 1 && std::equal(image.begin(), image.end(), flash.begin());
+    return ok ? secs : -1;
+}
+
+bool lzss_loopback(const std::vector<std::string>& paths, bool fast)
+{
+    std::printf("ABWu at 57600 baud, 2 ms per KiB programmed%s\n", fast ? ", unpaced" : "");
+    std::printf("%-48s %8s %8s %6s %9s %9s %6s\n", "image", "size", "sent", "ratio", "plain", "lzss", "gain");
+
+    bool ok = true;
+    for (const auto& path : paths) {
+        std::vector<uint8_t> image = abw::read_file(path);
+        size_t               plain_sent, lzss_sent;
+        double               plain = lzss_run(image, false, !fast, plain_sent);
+        double               lzss  = lzss_run(image, true, !fast, lzss_sent);
+
+        std::printf("%-48s %8zu %8zu %6.3f %7.1f s %7.1f s %5.2fx  %s\n", abw::base_name(path).c_str(), image.size(),
+                    lzss_sent, double(lzss_sent) / double(image.size()), plain, lzss, plain / lzss,
+                    plain > 0 && lzss > 0 ? "ok" : "FAILED");
+        ok = ok && plain > 0 && lzss > 0;
+    }
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd           = argv[1];
+    uint32_t                 baud          = 57600;
+    uint32_t                 turnaround_us = 0;
+    bool                     allow_1k      = true;
+    bool                     check         = true;
+    bool                     diff          = false;
+    bool                     fast          = false;
+    bool                     lzss          = true;
+    uint32_t                 seed          = 1;
+    std::string              command;
+    std::vector<std::string> args;
+
+    for (int i = 2; i < argc; i++) {
+        if (!std::strcmp(argv[i], "-b") && i + 1 < argc) {
+            baud = uint32_t(std::stoul(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--turnaround-us") && i + 1 < argc) {
+            turnaround_us = uint32_t(std::stoul(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--command") && i + 1 < argc) {
+            command = argv[++i];
+        } else if (!std::strcmp(argv[i], "--128")) {
+            allow_1k = false;
+        } else if (!std::strcmp(argv[i], "--no-check")) {
+            check = false;
+        } else if (!std::strcmp(argv[i], "--diff")) {
+            diff = true;
+        } else if (!std::strcmp(argv[i], "--fast")) {
+            fast = true;
+        } else if (!std::strcmp(argv[i], "--raw")) {
+            lzss = false;
+        } else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = uint32_t(std::stoul(argv[++i]));
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    try {
+        if (cmd == "send" && args.size() == 2 && diff) {
+            std::vector<uint8_t> image = abw::read_file(args[1]);
+            if (check) {
+                check_app(image, args[1]);
+            }
+            abw::serial_port port(args[0], baud);
+            send_diff(port, image, lzss);
+        } else if (cmd == "send" && args.size() == 2) {
+            send(args[0], args[1], baud, allow_1k, command, check, lzss);
+        } else if (cmd == "loopback" && args.size() == 1) {
+            return loopback(args[0], baud, turnaround_us) ? 0 : 1;
+        } else if (cmd == "diff-loopback" && !args.empty()) {
+            return diff_loopback(args, seed, fast) ? 0 : 1;
+        } else if (cmd == "lzss-loopback" && !args.empty()) {
+            return lzss_loopback(args, fast) ? 0 : 1;
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "abw-xmodem: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,581 @@
+/*!
+ * \file      agnss_bench.cpp
+ *
+ * \brief     Replay tracker sessions through the A-GNSS injector of lib/agnss and compare TTFF by strategy
+ *
+ * Usage:
+ *   agnss-bench [--days N] [--interval-min N] [--seed N] [--sigma S] [--backup] [--loop-ms N]
+ *               [--drift-ppm N] [--timeout-s N] [--rx-buffer N] [--epo-us N] [log...]
+ *   agnss-bench --write <file> [--days N] [--interval-min N] [--seed N]
+ *
+ * The logs are MFG console captures of a tracker. A session runs from
+ * "MT. Set power to on" to "MT. Set power to off"; its true position is the
+ * one of its "MT. FIX" line (or of the last one before), and its UTC time
+ * follows the last "MT. Setting system time" line. "MT. TTFF in" lines are
+ * reported as recorded. Without logs a tracker is generated: a fix every
+ * --interval-min minutes (default 30) for --days days (default 2), moving
+ * around a town. --write saves it as a log.
+ *
+ * Every session is replayed on a virtual clock against mt3333_gnss_sim.hpp,
+ * once per strategy:
+ *
+ *   cold        No assistance, the receiver is only powered
+ *   mfg         PMTK740 and PMTK713, one by one, as the MFG firmware
+ *   one-by-one  PMTK740, PMTK713 and PMTK721 EPO, one by one
+ *   burst       The same, staged before power-on and sent in one burst
+ *
+ * The MCU keeps a cache between sessions as lib/agnss would on the board:
+ * the time of the last fix, on an RTC that drifts --drift-ppm (default 10,
+ * the bound is the default 20 of agnss::config), the last fix, and EPO for
+ * all satellites. The first session starts with a network time within
+ * 500 ms. Each session draws one sky factor (lognormal, --sigma, default
+ * 0.3), used by every strategy. With --backup the receiver keeps its
+ * backup domain and starts hot within 2 hours of a fix.
+ *
+ * The MCU reads the UART and calls poll() every --loop-ms (default 1). The
+ * output of the receiver goes through nmea::parser; the fix is the first GGA
+ * with a quality, and a session without one after --timeout-s (default 120)
+ * counts that long.
+ *
+ * --rx-buffer (default 2048) and --epo-us (default 1500) set the receive
+ * buffer of the MT3333 and its handling time of a PMTK721: a burst into a
+ * buffer that the receiver empties slower than the line fills it loses
+ * sentences, which the injector sends again after their ack timeout.
+ *
+ * A last check leaves a PMTK740 unacknowledged: it must be sent again with
+ * the time of the resend, or not at all once the time error is too large.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "agnss_assist.hpp"
+#include "mt3333_gnss_sim.hpp"
+#include "nmea_parser.hpp"
+
+namespace {
+
+struct session {
+    uint32_t on_ms        = 0;  //!< Uptime at power-on
+    uint32_t utc          = 0;  //!< At power-on
+    int32_t  latitude     = 0;  //!< 1e-7 degrees
+    int32_t  longitude    = 0;
+    int32_t  altitude_m   = 0;
+    uint32_t ehpe_cm      = 1000;
+    int32_t  recorded_s   = -1;  //!< "MT. TTFF in", -1 without
+    bool     has_position = false;
+};
+
+struct strategy {
+    const char*      name;
+    bool             assist;
+    bool             epo;
+    agnss::send_mode mode;
+};
+
+const strategy strategies[] = {
+    {"cold", false, false, agnss::send_mode::burst},
+    {"mfg", true, false, agnss::send_mode::one_by_one},
+    {"one-by-one", true, true, agnss::send_mode::one_by_one},
+    {"burst", true, true, agnss::send_mode::burst},
+};
+
+std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* fmt, ...)
+{
+    char    line[256];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    return line;
+}
+
+int64_t days_from_civil(int y, int m, int d)
+{
+    y -= m <= 2;
+    int      era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = unsigned(y - era * 400);
+    unsigned doy = unsigned((153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1);
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return int64_t(era) * 146097 + int64_t(doe) - 719468;
+}
+
+/*!
+ * \brief "-33.8688000" to 1e-7 degrees
+ */
+int32_t parse_degrees(const std::string& text)
+{
+    bool        negative = !text.empty() && text[0] == '-';
+    std::string digits   = text.substr(negative);
+    size_t      dot      = digits.find('.');
+    std::string fraction = (dot == std::string::npos) ? "" : digits.substr(dot + 1);
+    fraction.resize(7, '0');
+    int64_t value = int64_t(std::stol(digits.substr(0, dot))) * 10000000 + std::stol(fraction);
+    return int32_t(negative ? -value : value);
+}
+
+std::string print_degrees(int32_t value)
+{
+    uint32_t magnitude = uint32_t(std::llabs(int64_t(value)));
+    return format("%s%u.%07u", value < 0 ? "-" : "", unsigned(magnitude / 10000000), unsigned(magnitude % 10000000));
+}
+
+std::string log_line(uint32_t uptime_ms, const std::string& text)
+{
+    uint32_t s = uptime_ms / 1000;
+    return format("%ud,%02u:%02u:%02u.%03u. (GNSS) %s\r\n", s / 86400, s / 3600 % 24, s / 60 % 60, s % 60,
+                  uptime_ms % 1000, text.c_str());
+}
+
+/*!
+ * \brief Sessions of an MFG console log
+ */
+std::vector<session> parse_log(const std::string& text)
+{
+    std::vector<session> sessions;
+    std::istringstream   in(text);
+    std::string          line;
+    int64_t              utc_offset = 1790812800;  // 2026-10-01, until a "Setting system time"
+    bool                 on         = false;
+    session              last;
+
+    while (std::getline(in, line)) {
+        unsigned days = 0, h = 0, m = 0, s = 0, ms = 0;
+        int      used = 0;
+        if (std::sscanf(line.c_str(), "%ud,%2u:%2u:%2u.%3u. (GNSS) %n", &days, &h, &m, &s, &ms, &used) != 5 ||
+            !used) {
+            continue;
+        }
+        uint32_t    uptime_ms = (((days * 24 + h) * 60 + m) * 60 + s) * 1000 + ms;
+        const char* t         = line.c_str() + used;
+        int         y, mo, d, hh, mm, ss, ehpe_m, ehpe_cent, sats, alt;
+        unsigned    ttff;
+        char        type[16], lat[24], lon[24];
+        if (std::sscanf(t, "MT. Setting system time to %d/%d/%d %d:%d:%d", &y, &mo, &d, &hh, &mm, &ss) == 6) {
+            utc_offset = days_from_civil(y, mo, d) * 86400 + hh * 3600 + mm * 60 + ss - uptime_ms / 1000;
+        } else if (!std::strncmp(t, "MT. Set power to on", 19)) {
+            on             = true;
+            last.on_ms     = uptime_ms;
+            last.utc       = uint32_t(utc_offset + uptime_ms / 1000);
+            last.recorded_s = -1;
+            sessions.push_back(last);
+        } else if (on && std::sscanf(t, "MT. TTFF in %us", &ttff) == 1) {
+            sessions.back().recorded_s = int32_t(ttff);
+        } else if (on && std::sscanf(t, "MT. FIX: %15[^,], ehpe %d.%d, %d sats - %23s %23s ALT=%d", type, &ehpe_m,
+                                     &ehpe_cent, &sats, lat, lon, &alt) == 7) {
+            session& c     = sessions.back();
+            c.latitude     = parse_degrees(lat);
+            c.longitude    = parse_degrees(lon);
+            c.altitude_m   = alt;
+            c.ehpe_cm      = uint32_t(ehpe_m * 100 + ehpe_cent);
+            c.has_position = true;
+            last           = c;
+        } else if (!std::strncmp(t, "MT. Set power to off", 20)) {
+            on = false;
+        }
+    }
+    // Sessions before the first fix take the first position known
+    for (size_t i = sessions.size(); i-- > 0;) {
+        if (!sessions[i].has_position && (i + 1 < sessions.size())) {
+            session& c  = sessions[i];
+            c.latitude  = sessions[i + 1].latitude;
+            c.longitude = sessions[i + 1].longitude;
+            c.altitude_m = sessions[i + 1].altitude_m;
+        }
+    }
+    return sessions;
+}
+
+/*!
+ * \brief Log of a tracker that moves around a town
+ */
+std::string generate_log(uint32_t days, uint32_t interval_min, uint32_t seed)
+{
+    std::mt19937                           random(seed);
+    std::normal_distribution<double>       step(0, 2000);  // 1e-7 degrees per minute, about 20 m
+    std::uniform_int_distribution<int>     on_s(15, 45);
+    std::string                            log;
+    int32_t                                lat = 488566000, lon = 23522000;  // Paris
+    uint32_t                               uptime_ms = 1200;
+
+    log += log_line(uptime_ms, "MT. Started");
+    log += log_line(uptime_ms + 300, "MT. Setting system time to 2026/10/1 00:00:01");
+    for (uint32_t minute = 1; minute < days * 1440; minute += interval_min) {
+        for (uint32_t i = 0; i < interval_min; i++) {
+            lat += int32_t(step(random));
+            lon += int32_t(step(random));
+        }
+        uptime_ms = minute * 60000 + 500;
+        int ehpe  = 300 + int(random() % 1200);
+        log += log_line(uptime_ms, "MT. Set power to on");
+        log += log_line(uptime_ms + 260, "MT. Started");
+        uptime_ms += uint32_t(on_s(random)) * 1000;
+        log += log_line(uptime_ms, format("MT. FIX: 3D, ehpe %d.%02d, %d sats - %s %s ALT=%d", ehpe / 100, ehpe % 100,
+                                          7 + int(random() % 5), print_degrees(lat).c_str(),
+                                          print_degrees(lon).c_str(), 35 + int(random() % 10)));
+        log += log_line(uptime_ms + 5, "MT. Set power to off");
+    }
+    return log;
+}
+
+/*!
+ * \brief UART of the MCU on the stand-in receiver; the MCU clock drifts
+ */
+class sim_link : public agnss::link {
+public:
+    sim_link(abw::mt3333_gnss_sim& sim, double drift_ppm) : sim_(sim), drift_(drift_ppm * 1e-6) {}
+
+    void session(uint32_t on_ms)
+    {
+        on_ms_ = on_ms;
+        on_us_ = sim_.now_us();
+    }
+
+    size_t   write(const uint8_t* p, size_t n) override { return sim_.write(p, n); }
+    uint32_t now_ms() override
+    {
+        double true_ms = double(on_ms_) + double(sim_.now_us() - on_us_) / 1000;
+        return uint32_t(std::llround(true_ms * (1 + drift_)));
+    }
+
+private:
+    abw::mt3333_gnss_sim& sim_;
+    double                drift_;
+    uint32_t              on_ms_ = 0;
+    uint64_t              on_us_ = 0;
+};
+
+/*!
+ * \brief What the MCU does with the receiver output
+ */
+class mcu : public nmea::handler {
+public:
+    agnss::injector* injector = nullptr;
+    nmea::gga        fix;
+    bool             fixed = false;
+
+    void on_gga(const nmea::gga& g) override
+    {
+        if (!fixed && g.quality != 0) {
+            fix   = g;
+            fixed = true;
+        }
+    }
+    void on_pmtk_ack(const nmea::pmtk_ack& ack) override
+    {
+        if (injector) {
+            injector->on_pmtk_ack(ack);
+        }
+    }
+    void on_pmtk(const nmea::pmtk& message) override
+    {
+        if (injector) {
+            injector->on_pmtk(message);
+        }
+    }
+};
+
+struct options {
+    double   sigma        = 0.3;
+    double   drift_ppm    = 10;
+    bool     backup       = false;
+    uint32_t loop_ms      = 1;
+    uint32_t timeout_s    = 120;
+    uint32_t seed         = 1;
+    uint32_t rx_buffer    = 2048;
+    uint32_t epo_us       = 1500;
+};
+
+struct result {
+    std::vector<double> ttff_s;
+    uint32_t            fixes     = 0;
+    uint32_t            time_sent = 0;  //!< Sessions with a PMTK740 acknowledged
+    uint32_t            epo_sent  = 0;  //!< Sessions with EPO
+    uint32_t            unfinished = 0; //!< Injections not done at the fix
+    uint64_t            written_ms = 0; //!< Sum of power-on to the last byte written
+    uint64_t            done_ms    = 0; //!< Sum of power-on to the last ack
+    uint32_t            injected   = 0;
+    uint32_t            failed     = 0;
+    uint32_t            levels[5]  = {};
+};
+
+/*!
+ * \brief EPO of all satellites for the 6-hour segment around utc, content made up
+ */
+void fill_epo(agnss::cache& cache, uint32_t utc)
+{
+    uint32_t start = utc - utc % 21600;
+    for (uint8_t prn = 1; prn <= agnss::max_satellites; prn++) {
+        agnss::epo_segment s;
+        s.satellite = prn;
+        s.start     = start;
+        s.end       = start + 21600;
+        for (size_t i = 0; i < agnss::pmtk::epo_words; i++) {
+            s.words[i] = (start / 21600) * 2654435761u ^ (uint32_t(prn) << 24) ^ uint32_t(i * 0x9E3779B9u);
+        }
+        cache.set_epo(s);
+    }
+}
+
+result replay(const std::vector<session>& sessions, const strategy& how, const options& o)
+{
+    abw::mt3333_gnss_sim_config sim_config;
+    sim_config.rx_buffer = o.rx_buffer;
+    sim_config.epo_us    = o.epo_us;
+    abw::mt3333_gnss_sim sim(sim_config);
+    sim_link             link(sim, o.drift_ppm);
+    agnss::config        config;
+    agnss::cache         cache(config);
+    uint8_t              storage[6144];  // 32 PMTK721 take 5.6 KiB
+    agnss::burst_ring    ring(storage, sizeof(storage));
+    agnss::injector      injector(cache, link, ring, how.mode);
+    result               r;
+    uint32_t             last_fix_utc = 0;
+    bool                 have_fix     = false;
+
+    for (size_t i = 0; i < sessions.size(); i++) {
+        const session& s = sessions[i];
+        std::mt19937   random(o.seed * 1000003u + uint32_t(i));
+        double         factor = std::exp(std::normal_distribution<double>(0, o.sigma)(random));
+        bool           hot    = o.backup && have_fix && (s.utc - last_fix_utc < 7200);
+
+        link.session(s.on_ms);
+        if (i == 0) {
+            cache.set_time(s.utc, 500, agnss::time_source::network, link.now_ms());
+        }
+        mcu          m;
+        nmea::parser parser(m);
+        if (how.assist) {
+            if (how.epo) {
+                fill_epo(cache, s.utc);
+            } else {
+                cache.clear_epo();
+            }
+            injector.stage(true, how.epo);
+            injector.power_on();
+            m.injector = &injector;
+        }
+        sim.power_on(s.utc, s.latitude, s.longitude, s.altitude_m, hot, factor);
+        uint64_t start = sim.now_us();
+        uint8_t  buffer[512];
+        while (!m.fixed && (sim.now_us() - start < uint64_t(o.timeout_s) * 1000000)) {
+            sim.advance(uint64_t(o.loop_ms) * 1000);
+            for (size_t n; (n = sim.read(buffer, sizeof(buffer))) != 0;) {
+                parser.feed(buffer, n);
+            }
+            if (how.assist) {
+                injector.poll();
+            }
+        }
+        sim.power_off();
+        double ttff = double(sim.now_us() - start) / 1e6;
+        r.ttff_s.push_back(ttff);
+        r.levels[int(sim.counters().level)]++;
+        if (m.fixed) {
+            r.fixes++;
+            // The MCU keeps the fix and sets its RTC from it
+            agnss::fix f;
+            f.valid       = true;
+            f.latitude    = m.fix.latitude;
+            f.longitude   = m.fix.longitude;
+            f.altitude_cm = m.fix.altitude;
+            f.ehpe_cm     = s.ehpe_cm;
+            f.utc         = s.utc + uint32_t(ttff);
+            cache.set_fix(f);
+            cache.set_time(f.utc, 0, agnss::time_source::gnss, link.now_ms());
+            last_fix_utc = f.utc;
+            have_fix     = true;
+        }
+        if (how.assist) {
+            const agnss::injector_stats& st = injector.stats();
+            r.time_sent += sim.counters().time;
+            r.epo_sent += sim.counters().epo != 0;
+            r.unfinished += !injector.done();
+            r.failed += st.failed + st.timeouts;
+            if (st.staged != 0) {
+                r.injected++;
+                r.written_ms += st.written_ms;
+                r.done_ms += st.done_ms;
+            }
+        }
+    }
+    return r;
+}
+
+/*!
+ * \brief A PMTK740 sent again carries the time of its resend, and is dropped once the time error is over the bound
+ */
+bool check_time_retry()
+{
+    class capture : public agnss::link {
+    public:
+        std::string out;
+        uint32_t    now = 0;
+
+        size_t write(const uint8_t* p, size_t n) override
+        {
+            out.append(reinterpret_cast<const char*>(p), n);
+            return n;
+        }
+        uint32_t now_ms() override { return now; }
+    };
+
+    // 2023-11-14 22:13:20 UTC, the PMTK740 is never acknowledged
+    auto sent = [](uint32_t error_ms, uint32_t drift_ppm) {
+        agnss::config config;
+        config.rtc_drift_ppm = drift_ppm;
+        agnss::cache      cache(config);
+        capture           line;
+        uint8_t           storage[256];
+        agnss::burst_ring ring(storage, sizeof(storage));
+        agnss::injector   injector(cache, line, ring);
+
+        cache.set_time(1700000000, error_ms, agnss::time_source::network, 0);
+        injector.stage(true, false);
+        injector.power_on();
+        line.now = config.startup_timeout_ms;
+        injector.poll();
+        line.now += config.ack_timeout_ms;
+        injector.poll();
+        return line.out;
+    };
+
+    const char* first   = "$PMTK740,2023,11,14,22,13,21*";
+    const char* again   = "$PMTK740,2023,11,14,22,13,24*";
+    std::string resent  = sent(500, 20);
+    std::string dropped = sent(1990, 5000);  // 1995 ms at the first send, 2010 ms at the resend
+    bool        ok      = resent.find(first) == 0 && resent.find(again) != std::string::npos &&
+                   dropped.find(first) == 0 && dropped.find("$PMTK740", 1) == std::string::npos;
+    std::printf("\nPMTK740 resend: %s\n", ok ? "formatted again, dropped over max_time_error_ms" : "FAILED");
+    return ok;
+}
+
+double percentile(std::vector<double> v, double p)
+{
+    std::sort(v.begin(), v.end());
+    return v.empty() ? 0 : v[std::min(v.size() - 1, size_t(p * double(v.size())))];
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    options                  o;
+    uint32_t                 days         = 2;
+    uint32_t                 interval_min = 30;
+    std::string              write_path;
+    std::vector<std::string> logs;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+            if (option.compare(0, 2, "--")) {
+                logs.push_back(option);
+                continue;
+            }
+            if (option == "--backup") {
+                o.backup = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "missing value for %s\n", option.c_str());
+                return 2;
+            }
+            std::string value = argv[++i];
+            if (option == "--days") {
+                days = uint32_t(std::stoul(value));
+            } else if (option == "--interval-min") {
+                interval_min = std::max<uint32_t>(1, uint32_t(std::stoul(value)));
+            } else if (option == "--seed") {
+                o.seed = uint32_t(std::stoul(value));
+            } else if (option == "--sigma") {
+                o.sigma = std::stod(value);
+            } else if (option == "--loop-ms") {
+                o.loop_ms = std::max<uint32_t>(1, uint32_t(std::stoul(value)));
+            } else if (option == "--drift-ppm") {
+                o.drift_ppm = std::stod(value);
+            } else if (option == "--timeout-s") {
+                o.timeout_s = uint32_t(std::stoul(value));
+            } else if (option == "--rx-buffer") {
+                o.rx_buffer = uint32_t(std::stoul(value));
+            } else if (option == "--epo-us") {
+                o.epo_us = uint32_t(std::stoul(value));
+            } else if (option == "--write") {
+                write_path = value;
+            } else {
+                std::fprintf(stderr, "unknown option %s\n", option.c_str());
+                return 2;
+            }
+        }
+
+        std::string text;
+        if (logs.empty()) {
+            text = generate_log(days, interval_min, o.seed);
+        }
+        for (const std::string& path : logs) {
+            std::vector<uint8_t> data = abw::read_file(path);
+            text.append(data.begin(), data.end());
+        }
+        if (!write_path.empty()) {
+            abw::write_file(write_path, text);
+            return 0;
+        }
+        std::vector<session> sessions = parse_log(text);
+        if (sessions.empty()) {
+            throw std::runtime_error("no \"MT. Set power to on\" in the log");
+        }
+        double span_days = std::max(1.0, double(sessions.back().on_ms - sessions.front().on_ms) / 86400000);
+        std::printf("%zu sessions over %.1f days%s\n", sessions.size(), span_days, o.backup ? ", backup kept" : "");
+
+        std::vector<double> recorded;
+        for (const session& s : sessions) {
+            if (s.recorded_s >= 0) {
+                recorded.push_back(s.recorded_s);
+            }
+        }
+        if (!recorded.empty()) {
+            std::printf("recorded TTFF: p50 %.1f s, p90 %.1f s over %zu sessions\n", percentile(recorded, 0.5),
+                        percentile(recorded, 0.9), recorded.size());
+        }
+
+        std::printf("\n%-11s %6s %7s %7s %7s %7s %9s %9s %9s  %s\n", "strategy", "fixes", "p10 s", "p50 s", "p90 s",
+                    "mean s", "on h/day", "write ms", "acked ms", "levels cold/warm/epo_time/epo/hot");
+        for (const strategy& how : strategies) {
+            result r    = replay(sessions, how, o);
+            double mean = 0;
+            for (double t : r.ttff_s) {
+                mean += t;
+            }
+            double total = mean;
+            mean /= double(r.ttff_s.size());
+            std::printf("%-11s %6u %7.1f %7.1f %7.1f %7.1f %9.2f %9.0f %9.0f  %u/%u/%u/%u/%u\n", how.name,
+                        unsigned(r.fixes), percentile(r.ttff_s, 0.1), percentile(r.ttff_s, 0.5),
+                        percentile(r.ttff_s, 0.9), mean, total / 3600 / span_days,
+                        r.injected ? double(r.written_ms) / r.injected : 0.0,
+                        r.injected ? double(r.done_ms) / r.injected : 0.0, unsigned(r.levels[0]),
+                        unsigned(r.levels[1]), unsigned(r.levels[2]), unsigned(r.levels[3]), unsigned(r.levels[4]));
+            if (how.assist && (r.unfinished != 0 || r.failed != 0)) {
+                std::printf("%-11s %u injections unfinished at the fix, %u failed or timed out\n", "",
+                            unsigned(r.unfinished), unsigned(r.failed));
+            }
+        }
+        if (!check_time_retry()) {
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "agnss-bench: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*!
+ * \file      abw_app_image.hpp
+ *
+ * \brief     Pre-flight check of the Cortex-M vector table of an STM32WB image
+ *
+ * An image sent through ABWu is an application linked at 0x08006000. Its
+ * vector table comes first: the initial stack pointer, then the reset
+ * handler and the other exception and interrupt handlers. check_vectors()
+ * reads the 79 words of the STM32WB55 table (16 system exceptions and 63
+ * interrupts) and checks that:
+ *
+ * - the initial SP is the expected top of SRAM1, or within SRAM1 if none
+ *   is expected;
+ * - the reset, NMI and HardFault handlers are set;
+ * - every handler that is set is a Thumb address inside the image;
+ * - the image fits in its flash slot, below the BLE stack at 0x080CE000 for
+ *   an application.
+ *
+ * A bootloader image, whose handlers point at 0x0800xxxx, fails the
+ * application check at its reset handler. Encrypted images (FUS, BLE
+ * stack) and other targets fail at the stack pointer.
+ *
+ * The check only reads the table, so it costs far less than mapping the
+ * file. Nothing is allocated unless the image is rejected.
+ */
+
+#ifndef ABW_APP_IMAGE_HPP
+#define ABW_APP_IMAGE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace abw {
+
+/*!
+ * \brief Where an image runs from
+ */
+struct flash_slot {
+    const char* name;
+    uint32_t    load;        //!< Address of the vector table
+    uint32_t    limit;       //!< First address past the slot
+    uint32_t    initial_sp;  //!< Expected initial SP, 0 for anywhere in SRAM1
+};
+
+constexpr flash_slot app_slot        = {"application", 0x08006000, 0x080CE000, 0x20030000};
+constexpr flash_slot bootloader_slot = {"bootloader", 0x08000000, 0x08006000, 0x20030000};
+
+constexpr uint32_t sram1_start     = 0x20000000;
+constexpr uint32_t sram1_end       = 0x20030000;
+constexpr unsigned stm32wb_vectors = 79;  //!< 16 system exceptions and 63 interrupts
+
+struct vector_check {
+    bool        ok         = false;
+    std::string error;           //!< Why the image was rejected
+    uint32_t    initial_sp = 0;
+    uint32_t    reset      = 0;  //!< Reset handler, Thumb bit included
+    uint32_t    end        = 0;  //!< First flash address past the image
+};
+
+namespace app_image_detail {
+
+inline uint32_t get32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+}
+
+inline std::string hex(uint32_t v)
+{
+    char text[12];
+    std::snprintf(text, sizeof(text), "0x%08X", unsigned(v));
+    return text;
+}
+
+}  // namespace app_image_detail
+
+/*!
+ * \brief Check the vector table of an image meant for slot
+ */
+inline vector_check check_vectors(const uint8_t* image, size_t size, const flash_slot& slot = app_slot)
+{
+    using namespace app_image_detail;
+
+    vector_check r;
+    if (size < 4 * stm32wb_vectors) {
+        r.error = std::to_string(size) + " bytes, too short for a vector table";
+        return r;
+    }
+    r.initial_sp = get32(image);
+    r.reset      = get32(image + 4);
+    r.end        = uint32_t(slot.load + size);
+
+    if (size > slot.limit - slot.load) {
+        r.error = std::to_string(size) + " bytes do not fit in the " + slot.name + " slot, " + hex(slot.load) +
+                  " to " + hex(slot.limit);
+        return r;
+    }
+    if (slot.initial_sp ? r.initial_sp != slot.initial_sp
+                        : r.initial_sp <= sram1_start || r.initial_sp > sram1_end || (r.initial_sp & 7)) {
+        r.error = "initial SP " + hex(r.initial_sp) + " is not " +
+                  (slot.initial_sp ? hex(slot.initial_sp) : "the top of a stack in SRAM1") +
+                  ", not a Cortex-M image for this target";
+        return r;
+    }
+
+    for (unsigned i = 1; i < stm32wb_vectors; i++) {
+        uint32_t v = get32(image + 4 * i);
+        if (v == 0 && i > 3) {
+            continue;  // Reserved or unused
+        }
+        if ((v & 1) && v - 1 >= slot.load && v - 1 < r.end) {
+            continue;
+        }
+
+        std::string what = i == 1 ? "reset handler" : "vector " + std::to_string(i);
+        if (v == 0) {
+            r.error = what + " is not set";
+        } else if (!(v & 1)) {
+            r.error = what + " " + hex(v) + " is not a Thumb address";
+        } else if (slot.load == app_slot.load && v - 1 >= bootloader_slot.load && v - 1 < bootloader_slot.limit) {
+            r.error = what + " " + hex(v) + " points into the bootloader, not an application linked at " +
+                      hex(slot.load);
+        } else {
+            r.error = what + " " + hex(v) + " is outside the image, " + hex(slot.load) + " to " + hex(r.end);
+        }
+        return r;
+    }
+    r.ok = true;
+    return r;
+}
+
+}  // namespace abw
+
+#endif  // ABW_APP_IMAGE_HPP
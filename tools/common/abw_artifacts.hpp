@@ -0,0 +1,417 @@
+/*!
+ * \file      abw_artifacts.hpp
+ *
+ * \brief     Manifest of the firmware artifacts, with memory-mapped hashing and a digest cache
+ *
+ * scan_artifacts() walks a firmware-binaries tree and describes each file:
+ * size, MD5 (checked against the md5sum file next to it when there is one),
+ * SHA-256, and the component, version and load address taken from its
+ * path. Files are hashed from a read-only mapping, MD5 and SHA-256 in the
+ * same pass.
+ *
+ * Digests are cached by device, inode, size and modification time, so a
+ * station that scans an unchanged tree only pays one stat() per file. A
+ * file modified less than a second before it was hashed is not cached, as
+ * a later change within the same timestamp would go unnoticed.
+ *
+ * Needs lib/sha256/abw_sha256.c.
+ */
+
+#ifndef ABW_ARTIFACTS_HPP
+#define ABW_ARTIFACTS_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "abw_md5.hpp"
+#include "abw_sha256.h"
+
+namespace abw {
+
+/*!
+ * \brief Read-only mapping of a whole file
+ */
+class mapped_file {
+public:
+    mapped_file() = default;
+
+    explicit mapped_file(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("cannot open " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) < 0) {
+            ::close(fd);
+            throw std::runtime_error("cannot stat " + path);
+        }
+        size_ = size_t(st.st_size);
+        if (size_) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("cannot map " + path + ": " + std::strerror(errno));
+            }
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const uint8_t*>(p);
+        }
+        ::close(fd);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept { swap(other); }
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+    ~mapped_file()
+    {
+        if (data_) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+    }
+
+    const uint8_t* data() const { return data_; }
+    size_t         size() const { return size_; }
+
+private:
+    void swap(mapped_file& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t         size_ = 0;
+};
+
+/*!
+ * \brief MD5 and SHA-256 of a buffer in one pass, as lowercase hex
+ */
+inline std::pair<std::string, std::string> digests(const uint8_t* data, size_t len)
+{
+    md5          m;
+    abw_sha256_t s;
+    abw_sha256_init(&s);
+
+    // Both hashes take each piece while it is still in cache
+    const size_t piece = 64 * 1024;
+    for (size_t off = 0; off < len; off += piece) {
+        size_t n = std::min(piece, len - off);
+        m.update(data + off, n);
+        abw_sha256_update(&s, data + off, uint32_t(n));
+    }
+
+    uint8_t digest[ABW_SHA256_DIGEST_SIZE];
+    char    hex[2 * ABW_SHA256_DIGEST_SIZE + 1];
+    abw_sha256_final(&s, digest);
+    for (size_t i = 0; i < sizeof(digest); i++) {
+        std::snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+    }
+    return {m.hex(), hex};
+}
+
+constexpr uint32_t no_load_address = 0xFFFFFFFF;  //!< Not programmed into the STM32WB flash
+
+struct artifact {
+    std::string path;  //!< Relative to the scanned root
+    uint64_t    size         = 0;
+    std::string md5;
+    std::string md5_expected;  //!< From <path>.md5, empty if there is none
+    std::string sha256;
+    std::string component;  //!< Empty when the path matches no known artifact
+    std::string version;
+    uint32_t    load_address = no_load_address;
+
+    bool md5_matches() const { return md5_expected.empty() || md5_expected == md5; }
+};
+
+/*!
+ * \brief How the paths of firmware-binaries map to components
+ *
+ * The first group of the pattern, if any, is the version.
+ */
+struct artifact_rule {
+    const char* pattern;
+    const char* component;
+    uint32_t    load_address;
+};
+
+constexpr artifact_rule artifact_rules[] = {
+    {"^ble/stm32wb5x_FUS_fw_([0-9.]+)\\.bin$", "fus", 0x080CE000},
+    {"^ble/stm32wb5x_BLE_Stack_full_fw_([0-9.]+)\\.bin$", "ble_stack", 0x080CE000},
+    {"^bootloader/abw-bootloader-release_v([0-9.]+)\\.bin$", "bootloader", 0x08000000},
+    {"^mfg/mfg-(?:serial|usb)-evk-debug\\.bin$", "mfg", 0x08006000},
+    {"^lr11xx/[^/]+/lr1110_transceiver_([0-9a-fA-F]{4})\\.bin$", "lr1110", no_load_address},
+    {"^lr11xx/[^/]+/lr1110_transceiver_([0-9a-fA-F]{4})(?:_image)?\\.[ch]$", "lr1110_source", no_load_address},
+    {"^mt33xx/[^/]*_(AXN[0-9.]*[0-9])_[^/]*\\.bin$", "mt3333", no_load_address},
+    {"^mt33xx/MTK_AllInOne_DA_[^/]*\\.BIN$", "mt3333_da", no_load_address},
+};
+
+/*!
+ * \brief Fill component, version and load address from the path
+ */
+inline void classify(artifact& a)
+{
+    static const std::vector<std::regex> patterns = [] {
+        std::vector<std::regex> v;
+        for (const auto& rule : artifact_rules) {
+            v.emplace_back(rule.pattern);
+        }
+        return v;
+    }();
+
+    for (size_t i = 0; i < patterns.size(); i++) {
+        const artifact_rule& rule = artifact_rules[i];
+        std::smatch          match;
+        if (std::regex_search(a.path, match, patterns[i])) {
+            a.component    = rule.component;
+            a.load_address = rule.load_address;
+            a.version      = match.size() > 1 ? match[1].str() : std::string();
+            return;
+        }
+    }
+}
+
+/*!
+ * \brief Digests by file identity, stored as one line per file
+ */
+class digest_cache {
+public:
+    /*!
+     * \brief ${XDG_CACHE_HOME:-~/.cache}/abw-artifacts.cache, empty if there is no home
+     */
+    static std::string default_path()
+    {
+        const char* dir = std::getenv("XDG_CACHE_HOME");
+        if (dir && *dir) {
+            return std::string(dir) + "/abw-artifacts.cache";
+        }
+        const char* home = std::getenv("HOME");
+        return home && *home ? std::string(home) + "/.cache/abw-artifacts.cache" : std::string();
+    }
+
+    explicit digest_cache(const std::string& path) : path_(path)
+    {
+        std::ifstream in(path_);
+        entry         e;
+        uint64_t      dev, ino;
+        while (in >> dev >> ino >> e.size >> e.mtime_ns >> e.md5 >> e.sha256) {
+            entries_[{dev, ino}] = e;
+        }
+    }
+
+    bool lookup(const struct stat& st, std::string& md5, std::string& sha256) const
+    {
+        auto it = entries_.find({uint64_t(st.st_dev), uint64_t(st.st_ino)});
+        if (it == entries_.end() || it->second.size != uint64_t(st.st_size) ||
+            it->second.mtime_ns != mtime_ns(st)) {
+            return false;
+        }
+        md5    = it->second.md5;
+        sha256 = it->second.sha256;
+        return true;
+    }
+
+    void store(const struct stat& st, const std::string& md5, const std::string& sha256)
+    {
+        entries_[{uint64_t(st.st_dev), uint64_t(st.st_ino)}] = {uint64_t(st.st_size), mtime_ns(st), md5, sha256};
+        dirty_ = true;
+    }
+
+    /*!
+     * \brief Write the cache back if it changed, silently giving up when the file cannot be written
+     */
+    void save()
+    {
+        if (!dirty_ || path_.empty()) {
+            return;
+        }
+        std::string tmp = path_ + "." + std::to_string(::getpid());
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            for (const auto& e : entries_) {
+                out << e.first.first << ' ' << e.first.second << ' ' << e.second.size << ' ' << e.second.mtime_ns << ' '
+                    << e.second.md5 << ' ' << e.second.sha256 << '\n';
+            }
+            if (!out) {
+                ::unlink(tmp.c_str());
+                return;
+            }
+        }
+        // Atomic for concurrent stations sharing a home directory
+        if (::rename(tmp.c_str(), path_.c_str()) < 0) {
+            ::unlink(tmp.c_str());
+        }
+        dirty_ = false;
+    }
+
+    static int64_t mtime_ns(const struct stat& st)
+    {
+        return int64_t(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    }
+
+private:
+    struct entry {
+        uint64_t    size     = 0;
+        int64_t     mtime_ns = 0;
+        std::string md5;
+        std::string sha256;
+    };
+
+    std::string                                         path_;
+    std::map<std::pair<uint64_t, uint64_t>, entry>      entries_;
+    bool                                                dirty_ = false;
+};
+
+struct scan_stats {
+    size_t   files        = 0;
+    size_t   hashed       = 0;
+    size_t   cached       = 0;
+    uint64_t bytes_hashed = 0;
+};
+
+namespace detail {
+
+inline void list_files(const std::string& root, const std::string& rel, std::vector<std::string>& out)
+{
+    std::string dir = rel.empty() ? root : root + "/" + rel;
+    DIR*        d   = ::opendir(dir.c_str());
+    if (!d) {
+        throw std::runtime_error("cannot open directory " + dir);
+    }
+    while (dirent* e = ::readdir(d)) {
+        std::string name = e->d_name;
+        if (name[0] == '.') {
+            continue;
+        }
+        std::string path = rel.empty() ? name : rel + "/" + name;
+        struct stat st;
+        if (::stat((root + "/" + path).c_str(), &st) < 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            list_files(root, path, out);
+        } else if (S_ISREG(st.st_mode) && (name.size() < 4 || name.compare(name.size() - 4, 4, ".md5"))) {
+            out.push_back(path);
+        }
+    }
+    ::closedir(d);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Describe every file under root except md5sum files, sorted by path
+ *
+ * \param [in]  root   Directory to scan, e.g. firmware-binaries
+ * \param [in]  cache  Digest cache, nullptr to hash everything
+ * \param [out] stats  What was hashed and what came from the cache, may be nullptr
+ */
+inline std::vector<artifact> scan_artifacts(const std::string& root, digest_cache* cache = nullptr,
+                                            scan_stats* stats = nullptr)
+{
+    std::vector<std::string> paths;
+    detail::list_files(root, "", paths);
+    std::sort(paths.begin(), paths.end());
+
+    scan_stats  local;
+    scan_stats& s   = stats ? *stats : local;
+    auto        now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+
+    std::vector<artifact> out;
+    for (const auto& rel : paths) {
+        std::string full = root + "/" + rel;
+        struct stat st;
+        if (::stat(full.c_str(), &st) < 0) {
+            continue;
+        }
+
+        artifact a;
+        a.path = rel;
+        a.size = uint64_t(st.st_size);
+        if (cache && cache->lookup(st, a.md5, a.sha256)) {
+            s.cached++;
+        } else {
+            mapped_file file(full);
+            auto        d = digests(file.data(), file.size());
+            a.md5         = d.first;
+            a.sha256      = d.second;
+            s.hashed++;
+            s.bytes_hashed += file.size();
+            if (cache && digest_cache::mtime_ns(st) < now - 1000000000) {
+                cache->store(st, a.md5, a.sha256);
+            }
+        }
+        a.md5_expected = read_md5_file(full + ".md5");
+        classify(a);
+        out.push_back(std::move(a));
+        s.files++;
+    }
+    if (cache) {
+        cache->save();
+    }
+    return out;
+}
+
+/*!
+ * \brief Artifact with the given relative path, nullptr if absent
+ */
+inline const artifact* find_artifact(const std::vector<artifact>& artifacts, const std::string& path)
+{
+    auto it = std::find_if(artifacts.begin(), artifacts.end(), [&](const artifact& a) { return a.path == path; });
+    return it == artifacts.end() ? nullptr : &*it;
+}
+
+/*!
+ * \brief Manifest as a JSON array, one object per artifact
+ */
+inline std::string manifest_json(const std::vector<artifact>& artifacts)
+{
+    std::ostringstream out;
+    out << "[\n";
+    for (size_t i = 0; i < artifacts.size(); i++) {
+        const artifact& a = artifacts[i];
+        char            address[16] = "null";
+        if (a.load_address != no_load_address) {
+            std::snprintf(address, sizeof(address), "\"0x%08X\"", unsigned(a.load_address));
+        }
+        out << "  {\"path\": \"" << a.path << "\", \"size\": " << a.size << ", \"md5\": \"" << a.md5
+            << "\", \"sha256\": \"" << a.sha256 << "\", \"component\": "
+            << (a.component.empty() ? "null" : "\"" + a.component + "\"")
+            << ", \"version\": " << (a.version.empty() ? "null" : "\"" + a.version + "\"")
+            << ", \"load_address\": " << address << ", \"md5_file\": "
+            << (a.md5_expected.empty() ? "null" : a.md5_matches() ? "\"match\"" : "\"mismatch\"") << "}"
+            << (i + 1 < artifacts.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+    return out.str();
+}
+
+}  // namespace abw
+
+#endif  // ABW_ARTIFACTS_HPP
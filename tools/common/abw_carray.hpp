@@ -0,0 +1,53 @@
+/*!
+ * \file      abw_carray.hpp
+ *
+ * \brief     C array initializer formatting shared by the header generators
+ *
+ * The layout matches the Semtech firmware headers: four spaces of indent,
+ * every element followed by a comma, nine 32-bit words per line.
+ */
+
+#ifndef ABW_CARRAY_HPP
+#define ABW_CARRAY_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace abw {
+
+/*!
+ * \brief Append the initializer lines of a uint32_t array
+ */
+inline void append_c_words(std::string& out, const uint32_t* words, size_t count, unsigned per_line = 9)
+{
+    char buf[16];
+    for (size_t i = 0; i < count; i++) {
+        out += (i % per_line) ? " " : "    ";
+        std::snprintf(buf, sizeof(buf), "0x%08x,", unsigned(words[i]));
+        out += buf;
+        if ((i % per_line) == per_line - 1 || i + 1 == count) {
+            out += '\n';
+        }
+    }
+}
+
+/*!
+ * \brief Append the initializer lines of a uint8_t array
+ */
+inline void append_c_bytes(std::string& out, const uint8_t* bytes, size_t count, unsigned per_line = 16)
+{
+    char buf[8];
+    for (size_t i = 0; i < count; i++) {
+        out += (i % per_line) ? " " : "    ";
+        std::snprintf(buf, sizeof(buf), "0x%02x,", unsigned(bytes[i]));
+        out += buf;
+        if ((i % per_line) == per_line - 1 || i + 1 == count) {
+            out += '\n';
+        }
+    }
+}
+
+}  // namespace abw
+
+#endif  // ABW_CARRAY_HPP
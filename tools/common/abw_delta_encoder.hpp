@@ -0,0 +1,207 @@
+/*!
+ * \file      abw_delta_encoder.hpp
+ *
+ * \brief     Host-side diff generator producing patches for lib/delta/abw_delta.c
+ *
+ * See abw_delta.h for the patch layout. The generator indexes every
+ * position of the base by its first 8 bytes and walks the new image
+ * greedily. At each position it first tries the copy that continues the
+ * previous one past the bytes inserted since, which is what an in-place
+ * edit looks like, then the indexed candidates. The longest match wins if
+ * it is worth a copy command; matches are also extended backwards over the
+ * pending literals.
+ */
+
+#ifndef ABW_DELTA_ENCODER_HPP
+#define ABW_DELTA_ENCODER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+extern "C" {
+#include "abw_crc32.h"
+#include "abw_delta.h"
+#include "abw_sha256.h"
+}
+
+namespace abw {
+
+/*!
+ * \brief Identity of the new image written to the patch header
+ */
+struct delta_target {
+    uint8_t  update_to = 0xFF;  //!< LR11XX_FIRMWARE_UPDATE_TO, 0xFF if none
+    uint16_t version   = 0;     //!< LR11XX_FIRMWARE_VERSION, 0 if none
+};
+
+/*!
+ * \brief Counters of a patch
+ */
+struct delta_stats {
+    uint32_t copies   = 0;
+    uint32_t inserts  = 0;
+    uint64_t copied   = 0;  //!< Bytes taken from the base
+    uint64_t literals = 0;  //!< Bytes carried by the patch
+};
+
+namespace delta_detail {
+
+inline void put_varint(std::vector<uint8_t>& out, uint32_t v)
+{
+    while (v >= 0x80) {
+        out.push_back(uint8_t(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(uint8_t(v));
+}
+
+inline void put32(std::vector<uint8_t>& out, uint32_t v)
+{
+    out.insert(out.end(), {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16), uint8_t(v >> 24)});
+}
+
+}  // namespace delta_detail
+
+/*!
+ * \brief Make a patch turning base into target
+ *
+ * \param [in] max_chain Indexed candidates examined per position, trades
+ *                       speed for patch size
+ */
+inline std::vector<uint8_t> delta_encode(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target,
+                                         const delta_target& identity = {}, delta_stats* stats = nullptr,
+                                         unsigned max_chain = 32)
+{
+    using namespace delta_detail;
+
+    constexpr size_t   gram        = 8;   // Indexed prefix, also the shortest indexed match
+    constexpr size_t   min_resume  = 4;   // Shortest continued copy, its offset costs one byte
+    constexpr unsigned hash_bits   = 18;
+    constexpr uint32_t max_command = (1u << 30) - 1;
+
+    if (base.size() > 0x7FFFFFFF || target.size() > 0x7FFFFFFF) {
+        throw std::invalid_argument("delta images must be under 2 GiB");
+    }
+
+    const size_t n = target.size();
+    delta_stats  st;
+
+    std::vector<uint8_t> out = {'A', 'B', 'W', 'D', ABW_DELTA_FORMAT, identity.update_to, uint8_t(identity.version),
+                                uint8_t(identity.version >> 8)};
+    put32(out, uint32_t(base.size()));
+    put32(out, abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, base.data(), uint32_t(base.size()))));
+    put32(out, uint32_t(n));
+    put32(out, abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, target.data(), uint32_t(n))));
+    abw_sha256_t sha;
+    uint8_t      digest[ABW_SHA256_DIGEST_SIZE];
+    abw_sha256_init(&sha);
+    abw_sha256_update(&sha, target.data(), uint32_t(n));
+    abw_sha256_final(&sha, digest);
+    out.insert(out.end(), digest, digest + sizeof(digest));
+
+    // Hash chains over the base, every position
+    auto hash = [](const uint8_t* p) {
+        uint64_t v = 0;
+        for (size_t i = 0; i < gram; i++) {
+            v = v << 8 | p[i];
+        }
+        return uint32_t((v * 0x9E3779B97F4A7C15ull) >> (64 - hash_bits));
+    };
+    std::vector<int32_t> head(size_t(1) << hash_bits, -1);
+    std::vector<int32_t> next(base.size(), -1);
+    for (size_t p = 0; p + gram <= base.size(); p++) {
+        uint32_t h = hash(&base[p]);
+        next[p]    = head[h];
+        head[h]    = int32_t(p);
+    }
+
+    auto match_length = [&](size_t b, size_t t) {
+        size_t len = 0;
+        while (b + len < base.size() && t + len < n && base[b + len] == target[t + len]) {
+            len++;
+        }
+        return len;
+    };
+
+    size_t   literal_start = 0;  // First target byte not yet encoded
+    uint32_t copy_end      = 0;  // Base position after the last copy
+
+    auto flush_literals = [&](size_t end) {
+        while (literal_start < end) {
+            uint32_t len = uint32_t(std::min<size_t>(end - literal_start, max_command));
+            put_varint(out, len << 1);
+            out.insert(out.end(), target.begin() + literal_start, target.begin() + literal_start + len);
+            st.inserts++;
+            st.literals += len;
+            literal_start += len;
+        }
+    };
+    auto emit_copy = [&](size_t from, size_t len) {
+        while (len) {
+            uint32_t chunk  = uint32_t(std::min<size_t>(len, max_command));
+            int64_t  delta  = int64_t(from) - int64_t(copy_end);
+            uint32_t zigzag = uint32_t((uint64_t(delta) << 1) ^ uint64_t(delta >> 63));
+            put_varint(out, chunk << 1 | 1);
+            put_varint(out, zigzag);
+            st.copies++;
+            st.copied += chunk;
+            copy_end = uint32_t(from + chunk);
+            from += chunk;
+            len -= chunk;
+        }
+    };
+
+    size_t pos = 0;
+    while (pos < n) {
+        size_t best_len  = 0;
+        size_t best_from = 0;
+
+        // Continue the previous copy over what was inserted since (an in-place edit)
+        size_t resume = size_t(copy_end) + (pos - literal_start);
+        if (resume < base.size()) {
+            size_t len = match_length(resume, pos);
+            if (len >= min_resume) {
+                best_len  = len;
+                best_from = resume;
+            }
+        }
+        if (pos + gram <= n && best_len < 64) {
+            unsigned chain = 0;
+            for (int32_t c = head[hash(&target[pos])]; c >= 0 && chain < max_chain; c = next[c], chain++) {
+                size_t len = match_length(size_t(c), pos);
+                if (len >= gram && len > best_len) {
+                    best_len  = len;
+                    best_from = size_t(c);
+                }
+            }
+        }
+
+        if (best_len == 0) {
+            pos++;
+            continue;
+        }
+
+        // Take back pending literals that the base has right before the match
+        while (pos > literal_start && best_from > 0 && base[best_from - 1] == target[pos - 1]) {
+            pos--;
+            best_from--;
+            best_len++;
+        }
+        flush_literals(pos);
+        emit_copy(best_from, best_len);
+        pos += best_len;
+        literal_start = pos;
+    }
+    flush_literals(n);
+
+    if (stats) {
+        *stats = st;
+    }
+    return out;
+}
+
+}  // namespace abw
+
+#endif  // ABW_DELTA_ENCODER_HPP
@@ -0,0 +1,109 @@
+/*!
+ * \file      abw_event_loop.hpp
+ *
+ * \brief     Minimal epoll event loop for the host tools (Linux)
+ *
+ * File descriptors are registered with a handler that receives the epoll
+ * events. Timeouts are left to the caller, which passes the time until its
+ * nearest deadline to run_once().
+ */
+
+#ifndef ABW_EVENT_LOOP_HPP
+#define ABW_EVENT_LOOP_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace abw {
+
+/*!
+ * \brief Switch a descriptor to non-blocking mode
+ */
+inline void set_nonblocking(int fd)
+{
+    int flags = ::fcntl(fd, F_GETFL);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        throw std::runtime_error(std::string("fcntl: ") + std::strerror(errno));
+    }
+}
+
+class event_loop {
+public:
+    using handler = std::function<void(uint32_t events)>;
+
+    event_loop() : fd_(::epoll_create1(EPOLL_CLOEXEC))
+    {
+        if (fd_ < 0) {
+            throw std::runtime_error(std::string("epoll_create1: ") + std::strerror(errno));
+        }
+    }
+    event_loop(const event_loop&) = delete;
+    event_loop& operator=(const event_loop&) = delete;
+    ~event_loop() { ::close(fd_); }
+
+    void add(int fd, uint32_t events, handler h)
+    {
+        handlers_[fd] = std::move(h);
+        control(EPOLL_CTL_ADD, fd, events);
+    }
+
+    void modify(int fd, uint32_t events) { control(EPOLL_CTL_MOD, fd, events); }
+
+    void remove(int fd)
+    {
+        ::epoll_ctl(fd_, EPOLL_CTL_DEL, fd, nullptr);
+        handlers_.erase(fd);
+    }
+
+    size_t size() const { return handlers_.size(); }
+
+    /*!
+     * \brief Wait up to timeout_ms (-1: no limit) and dispatch the ready descriptors
+     *
+     * \returns Number of descriptors dispatched
+     */
+    int run_once(int timeout_ms)
+    {
+        epoll_event events[32];
+        int         n = ::epoll_wait(fd_, events, 32, timeout_ms);
+        if (n < 0 && errno != EINTR) {
+            throw std::runtime_error(std::string("epoll_wait: ") + std::strerror(errno));
+        }
+        for (int i = 0; i < n; i++) {
+            // A handler may remove other descriptors: look them up again
+            auto it = handlers_.find(events[i].data.fd);
+            if (it != handlers_.end()) {
+                handler h = it->second;
+                h(events[i].events);
+            }
+        }
+        return n < 0 ? 0 : n;
+    }
+
+private:
+    void control(int op, int fd, uint32_t events)
+    {
+        epoll_event ev = {};
+        ev.events      = events;
+        ev.data.fd     = fd;
+        if (::epoll_ctl(fd_, op, fd, &ev) < 0) {
+            throw std::runtime_error(std::string("epoll_ctl: ") + std::strerror(errno));
+        }
+    }
+
+    int                              fd_;
+    std::unordered_map<int, handler> handlers_;
+};
+
+}  // namespace abw
+
+#endif  // ABW_EVENT_LOOP_HPP
@@ -0,0 +1,63 @@
+/*!
+ * \file      abw_file.hpp
+ *
+ * \brief     Whole-file helpers shared by the host tools
+ */
+
+#ifndef ABW_FILE_HPP
+#define ABW_FILE_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace abw {
+
+/*!
+ * \brief Read a whole file, throws std::runtime_error on failure
+ */
+inline std::vector<uint8_t> read_file(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+/*!
+ * \brief Replace a file with the given bytes, throws std::runtime_error on failure
+ */
+inline void write_file(const std::string& path, const void* data, size_t len)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(static_cast<const char*>(data), static_cast<std::streamsize>(len))) {
+        throw std::runtime_error("cannot write " + path);
+    }
+}
+
+inline void write_file(const std::string& path, const std::string& text)
+{
+    write_file(path, text.data(), text.size());
+}
+
+inline void write_file(const std::string& path, const std::vector<uint8_t>& data)
+{
+    write_file(path, data.data(), data.size());
+}
+
+/*!
+ * \brief Last path component
+ */
+inline std::string base_name(const std::string& path)
+{
+    size_t slash = path.find_last_of('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+}  // namespace abw
+
+#endif  // ABW_FILE_HPP
@@ -0,0 +1,226 @@
+/*!
+ * \file      abw_fleet_plan.hpp
+ *
+ * \brief     Versions reported by a board, and the provisioning steps that bring it to the station's artifacts
+ *
+ * parse_versions() reads the output of the MFG CLI commands of
+ * survey_commands (system, BLE, LR11xx and MT3333 versions), or the banner
+ * of the ABW bootloader. plan_board() compares what it found with the
+ * versions of the artifacts and keeps the steps of the components that
+ * differ, or that the board did not report.
+ *
+ * The MFG application reports no version of its own that the artifacts
+ * carry, only its build date and time. mfg_build_stamp() finds the same
+ * stamp in the image, right after the format string of "system version".
+ *
+ * The bootloader version is only readable from the bootloader itself. A
+ * board that runs the MFG application keeps its bootloader.
+ */
+
+#ifndef ABW_FLEET_PLAN_HPP
+#define ABW_FLEET_PLAN_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace abw {
+
+/*!
+ * \brief MFG CLI commands whose output parse_versions() understands
+ */
+constexpr const char* survey_commands[] = {"system version", "ble version", "lr11xx firmware version",
+                                           "gnss mt3333 version"};
+
+/*!
+ * \brief What a board reported, empty or negative when it did not
+ */
+struct board_versions {
+    bool        in_bootloader = false;  //!< Answered from the ABW bootloader
+    std::string bootloader;             //!< "3.0"
+    std::string mfg_version;            //!< "3.0-192"
+    std::string mfg_build;              //!< "Jun 18 2024, 15:18:50"
+    std::string ble_stack;              //!< "1.15.0"
+    std::string fus;                    //!< "1.2.0"
+    int         lr11xx_type    = -1;    //!< System Type, 1 for a transceiver, 223 for the LR11xx bootloader
+    int         lr11xx_version = -1;    //!< Firmware version, 0x0308
+    std::string mt3333;                 //!< Normalized, see mt3333_version()
+};
+
+/*!
+ * \brief Versions the station installs, empty or negative for a component it does not handle
+ */
+struct fleet_target {
+    std::string fus;
+    std::string ble_stack;
+    std::string bootloader;
+    std::string mfg_build;  //!< From mfg_build_stamp()
+    int         lr11xx_version = -1;
+    std::string mt3333;
+};
+
+/*!
+ * \brief One component of a board against the target
+ */
+struct component_plan {
+    std::string step;  //!< Provisioning step that installs the component
+    std::string have;  //!< Reported version, empty if unknown
+    std::string want;
+    bool        needed = false;
+};
+
+/*!
+ * \brief MT3333 version without the separators and build suffix of the CLI
+ *
+ * "AXN_5.1.7_3333_19041711" and "AXN5.1.7" both give "AXN5.1.7", the form
+ * of the artifact names.
+ */
+inline std::string mt3333_version(const std::string& text)
+{
+    static const std::regex axn("AXN_?([0-9]+(?:\\.[0-9]+)*)");
+    std::smatch             match;
+    return std::regex_search(text, match, axn) ? "AXN" + match[1].str() : text;
+}
+
+/*!
+ * \brief Parse the output of the survey commands, or of the bootloader, in any order
+ */
+inline board_versions parse_versions(const std::string& text)
+{
+    static const std::regex bootloader("Abeeway bootloader v([0-9]+(?:\\.[0-9]+)*)");
+    static const std::regex mfg("MFG:\\s*([0-9]+\\.[0-9]+-[0-9]+)\\.?\\s*Buil[dt] on:\\s*"
+                                "([A-Z][a-z]{2} [ 0-9][0-9] [0-9]{4}),\\s*([0-9]{2}:[0-9]{2}:[0-9]{2})");
+    static const std::regex ble("\\(BLE STACK\\)\\s*([0-9]+(?:\\.[0-9]+)*)");
+    static const std::regex fus("FUS version\\s*([0-9]+(?:\\.[0-9]+)*)");
+    static const std::regex type("System Type\\s*:\\s*([0-9]+)");
+    static const std::regex lr11xx("\\bFirmware version\\s*:\\s*0x([0-9A-Fa-f]{1,4})\\b");
+    static const std::regex mt3333("MT3333 (?:version|firmware)\\s*:\\s*(\\S+)");
+
+    board_versions v;
+    std::smatch    match;
+    if (std::regex_search(text, match, bootloader)) {
+        v.bootloader = match[1];
+    }
+    if (std::regex_search(text, match, mfg)) {
+        v.mfg_version = match[1];
+        v.mfg_build   = match[2].str() + ", " + match[3].str();
+    }
+    v.in_bootloader = !v.bootloader.empty() && v.mfg_build.empty();
+    if (std::regex_search(text, match, ble)) {
+        v.ble_stack = match[1];
+    }
+    if (std::regex_search(text, match, fus)) {
+        v.fus = match[1];
+    }
+    if (std::regex_search(text, match, type)) {
+        v.lr11xx_type = std::stoi(match[1]);
+    }
+    if (std::regex_search(text, match, lr11xx)) {
+        v.lr11xx_version = int(std::stoul(match[1], nullptr, 16));
+    }
+    if (std::regex_search(text, match, mt3333)) {
+        v.mt3333 = mt3333_version(match[1]);
+    }
+    return v;
+}
+
+/*!
+ * \brief Build stamp of an MFG image, "Jun 18 2024, 15:18:50", empty if not found
+ *
+ * The stamp is the pair of __TIME__ and __DATE__ strings that follow the
+ * "MFG: ... Build on: %s, %s" format string.
+ */
+inline std::string mfg_build_stamp(const uint8_t* image, size_t size)
+{
+    static const char format[] = "Build on: %s, %s";
+    static const std::regex time("^[0-9]{2}:[0-9]{2}:[0-9]{2}$");
+    static const std::regex date("^[A-Z][a-z]{2} [ 0-9][0-9] [0-9]{4}$");
+
+    const char* begin = reinterpret_cast<const char*>(image);
+    const char* end   = begin + size;
+    const char* at    = std::search(begin, end, format, format + sizeof(format) - 1);
+    if (at == end) {
+        return "";
+    }
+
+    // The next NUL-terminated strings after the format, skipping the padding between them
+    std::string stamp_time;
+    for (const char* p = std::find(at, end, '\0'); p < end;) {
+        const char* nul = std::find(p, end, '\0');
+        std::string s(p, nul);
+        p = nul + 1;
+        if (s.empty()) {
+            continue;
+        }
+        if (stamp_time.empty() && std::regex_match(s, time)) {
+            stamp_time = s;
+        } else if (!stamp_time.empty() && std::regex_match(s, date)) {
+            return s + ", " + stamp_time;
+        } else {
+            break;
+        }
+    }
+    return "";
+}
+
+/*!
+ * \brief LR11xx version as the CLI prints it, "0x0308", empty if negative
+ */
+inline std::string hex_version(int version)
+{
+    char text[8];
+    std::snprintf(text, sizeof(text), "0x%04X", unsigned(version));
+    return version < 0 ? std::string() : text;
+}
+
+/*!
+ * \brief Components of a board against the target, in provisioning order
+ *
+ * A component the target does not handle is left out. A component the
+ * board did not report is needed, except for the bootloader under a
+ * running MFG application. An LR11xx left in its bootloader (System Type
+ * 223) reports the bootloader version and needs the firmware.
+ */
+inline std::vector<component_plan> plan_board(const board_versions& v, const fleet_target& target)
+{
+    std::vector<component_plan> plan;
+    auto add = [&](const char* step, const std::string& have, const std::string& want) {
+        if (!want.empty()) {
+            plan.push_back({step, have, want, have != want});
+        }
+    };
+
+    add("fus", v.fus, target.fus);
+    add("ble", v.ble_stack, target.ble_stack);
+    if (!target.bootloader.empty()) {
+        bool running = !v.mfg_build.empty();
+        plan.push_back({"bootloader", running && v.bootloader.empty() ? "running" : v.bootloader, target.bootloader,
+                        !running && v.bootloader != target.bootloader});
+    }
+    add("mfg", v.mfg_build, target.mfg_build);
+    add("lr11xx", v.lr11xx_type == 1 ? hex_version(v.lr11xx_version) : std::string(),
+        hex_version(target.lr11xx_version));
+    add("mt3333", v.mt3333, target.mt3333.empty() ? std::string() : mt3333_version(target.mt3333));
+    return plan;
+}
+
+/*!
+ * \brief Steps of the needed components
+ */
+inline std::vector<std::string> needed_steps(const std::vector<component_plan>& plan)
+{
+    std::vector<std::string> steps;
+    for (const auto& c : plan) {
+        if (c.needed) {
+            steps.push_back(c.step);
+        }
+    }
+    return steps;
+}
+
+}  // namespace abw
+
+#endif  // ABW_FLEET_PLAN_HPP
@@ -0,0 +1,148 @@
+/*!
+ * \file      abw_lzss_encoder.hpp
+ *
+ * \brief     Host-side LZSS encoder producing streams for lib/lzss/abw_lzss.c
+ *
+ * See abw_lzss.h for the stream layout.
+ */
+
+#ifndef ABW_LZSS_ENCODER_HPP
+#define ABW_LZSS_ENCODER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace abw {
+
+/*!
+ * \brief Compress a buffer
+ *
+ * \param [in] in          Data to compress
+ * \param [in] window_bits History window, 8..12 bits (the decoder default
+ *                         supports up to 12)
+ * \param [in] max_chain   Candidates examined per position, trades speed for
+ *                         ratio
+ */
+inline std::vector<uint8_t> lzss_compress(const std::vector<uint8_t>& in, unsigned window_bits = 12,
+                                          unsigned max_chain = 256)
+{
+    constexpr unsigned min_match = 3;
+    constexpr unsigned hash_bits = 15;
+
+    if (window_bits < 8 || window_bits > 12) {
+        throw std::invalid_argument("lzss window bits must be within 8..12");
+    }
+
+    const size_t   n        = in.size();
+    const size_t   win_size = size_t(1) << window_bits;
+    const size_t   win_mask = win_size - 1;
+    const unsigned max_len  = (1u << (16 - window_bits)) - 1 + min_match;
+
+    std::vector<uint8_t> out = {'A', 'L', 'Z', uint8_t(window_bits), uint8_t(n), uint8_t(n >> 8), uint8_t(n >> 16),
+                                uint8_t(n >> 24)};
+    out.reserve(n + n / 8 + 16);
+
+    // Hash chains over 3-byte prefixes; chain links live in a window-sized ring
+    std::vector<int32_t> head(size_t(1) << hash_bits, -1);
+    std::vector<int32_t> prev(win_size, -1);
+
+    auto hash = [&](size_t p) {
+        uint32_t v = uint32_t(in[p]) | uint32_t(in[p + 1]) << 8 | uint32_t(in[p + 2]) << 16;
+        return (v * 2654435761u) >> (32 - hash_bits);
+    };
+    auto insert = [&](size_t p) {
+        if (p + min_match <= n) {
+            uint32_t h         = hash(p);
+            prev[p & win_mask] = head[h];
+            head[h]            = int32_t(p);
+        }
+    };
+    auto longest = [&](size_t p, unsigned& best_dist) {
+        unsigned best = 0;
+        if (p + min_match > n) {
+            return best;
+        }
+        unsigned limit = unsigned(std::min<size_t>(max_len, n - p));
+        int32_t  cand  = head[hash(p)];
+        for (unsigned chain = 0; cand >= 0 && chain < max_chain; chain++) {
+            size_t dist = p - size_t(cand);
+            if (dist == 0 || dist > win_size) {
+                break;
+            }
+            unsigned len = 0;
+            while (len < limit && in[size_t(cand) + len] == in[p + len]) {
+                len++;
+            }
+            if (len > best) {
+                best      = len;
+                best_dist = unsigned(dist);
+                if (len == limit) {
+                    break;
+                }
+            }
+            int32_t next = prev[size_t(cand) & win_mask];
+            if (next >= cand) {
+                break;  // Slot recycled by a newer position
+            }
+            cand = next;
+        }
+        return best;
+    };
+
+    size_t  flag_pos  = 0;
+    uint8_t flag_bit  = 8;
+    auto    next_flag = [&](bool literal) {
+        if (flag_bit == 8) {
+            flag_pos = out.size();
+            out.push_back(0);
+            flag_bit = 0;
+        }
+        if (literal) {
+            out[flag_pos] |= uint8_t(1u << flag_bit);
+        }
+        flag_bit++;
+    };
+
+    size_t p = 0;
+    while (p < n) {
+        unsigned dist = 0;
+        unsigned len  = longest(p, dist);
+
+        // One step of lazy evaluation: prefer a literal if the next position matches longer
+        if (len >= min_match && len < max_len) {
+            insert(p);
+            unsigned next_dist = 0;
+            unsigned next_len  = longest(p + 1, next_dist);
+            if (next_len > len) {
+                next_flag(true);
+                out.push_back(in[p]);
+                p++;
+                continue;
+            }
+        } else {
+            insert(p);
+        }
+
+        if (len >= min_match) {
+            uint16_t token = uint16_t((dist - 1) | ((len - min_match) << window_bits));
+            next_flag(false);
+            out.push_back(uint8_t(token));
+            out.push_back(uint8_t(token >> 8));
+            for (size_t i = 1; i < len; i++) {
+                insert(p + i);
+            }
+            p += len;
+        } else {
+            next_flag(true);
+            out.push_back(in[p]);
+            p++;
+        }
+    }
+    return out;
+}
+
+}  // namespace abw
+
+#endif  // ABW_LZSS_ENCODER_HPP
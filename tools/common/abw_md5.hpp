@@ -0,0 +1,158 @@
+/*!
+ * \file      abw_md5.hpp
+ *
+ * \brief     MD5 (RFC 1321) and helpers for the md5sum files shipped with the binaries
+ */
+
+#ifndef ABW_MD5_HPP
+#define ABW_MD5_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace abw {
+
+/*!
+ * \brief Incremental MD5
+ */
+class md5 {
+public:
+    void update(const void* data, size_t len)
+    {
+        const uint8_t* p   = static_cast<const uint8_t*>(data);
+        size_t         use = size_t(total_ & 63);
+
+        total_ += len;
+        if (use) {
+            size_t n = std::min(len, 64 - use);
+            std::memcpy(block_ + use, p, n);
+            p += n;
+            len -= n;
+            if (use + n < 64) {
+                return;
+            }
+            transform(block_);
+        }
+        for (; len >= 64; p += 64, len -= 64) {
+            transform(p);
+        }
+        std::memcpy(block_, p, len);
+    }
+
+    /*!
+     * \brief Finish the digest, the object must not be updated afterwards
+     */
+    void final(uint8_t digest[16])
+    {
+        static const uint8_t pad[64] = {0x80};
+        uint64_t             bits    = total_ * 8;
+        uint8_t              len_le[8];
+
+        for (int i = 0; i < 8; i++) {
+            len_le[i] = uint8_t(bits >> (8 * i));
+        }
+        update(pad, 1 + ((119 - (total_ & 63)) & 63));
+        update(len_le, 8);
+        for (int i = 0; i < 16; i++) {
+            digest[i] = uint8_t(h_[i / 4] >> (8 * (i % 4)));
+        }
+    }
+
+    std::string hex()
+    {
+        static const char digits[] = "0123456789abcdef";
+        uint8_t           d[16];
+        std::string       s;
+
+        final(d);
+        for (uint8_t b : d) {
+            s += digits[b >> 4];
+            s += digits[b & 15];
+        }
+        return s;
+    }
+
+private:
+    static uint32_t rol(uint32_t x, int c) { return (x << c) | (x >> (32 - c)); }
+
+    void transform(const uint8_t* p)
+    {
+        static const uint32_t k[64] = {
+            0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+            0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+            0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+            0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+            0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+            0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+            0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+            0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+        static const int r[64] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+                                  5, 9,  14, 20, 5, 9,  14, 20, 5, 9,  14, 20, 5, 9,  14, 20,
+                                  4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                                  6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+        uint32_t m[16];
+        uint32_t a = h_[0], b = h_[1], c = h_[2], d = h_[3];
+
+        for (int i = 0; i < 16; i++) {
+            m[i] = uint32_t(p[4 * i]) | uint32_t(p[4 * i + 1]) << 8 | uint32_t(p[4 * i + 2]) << 16 |
+                   uint32_t(p[4 * i + 3]) << 24;
+        }
+        for (int i = 0; i < 64; i++) {
+            uint32_t f;
+            int      g;
+            if (i < 16) {
+                f = (b & c) | (~b & d);
+                g = i;
+            } else if (i < 32) {
+                f = (d & b) | (~d & c);
+                g = (5 * i + 1) % 16;
+            } else if (i < 48) {
+                f = b ^ c ^ d;
+                g = (3 * i + 5) % 16;
+            } else {
+                f = c ^ (b | ~d);
+                g = (7 * i) % 16;
+            }
+            uint32_t t = d;
+            d          = c;
+            c          = b;
+            b          = b + rol(a + f + k[i] + m[g], r[i]);
+            a          = t;
+        }
+        h_[0] += a;
+        h_[1] += b;
+        h_[2] += c;
+        h_[3] += d;
+    }
+
+    uint32_t h_[4]      = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    uint64_t total_     = 0;
+    uint8_t  block_[64] = {};
+};
+
+inline std::string md5_hex(const void* data, size_t len)
+{
+    md5 ctx;
+    ctx.update(data, len);
+    return ctx.hex();
+}
+
+/*!
+ * \brief Digest recorded in an md5sum file ("<hex>  <name>"), empty if unreadable
+ */
+inline std::string read_md5_file(const std::string& path)
+{
+    std::ifstream in(path);
+    std::string   digest;
+    if (!(in >> digest) || digest.size() != 32) {
+        return std::string();
+    }
+    return digest;
+}
+
+}  // namespace abw
+
+#endif  // ABW_MD5_HPP
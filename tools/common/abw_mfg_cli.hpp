@@ -0,0 +1,368 @@
+/*!
+ * \file      abw_mfg_cli.hpp
+ *
+ * \brief     Line-oriented access to the CLI of the MFG firmware over a serial port
+ *
+ * The CLI echoes what is typed and ends every answer with a prompt:
+ * "login: " before authentication, "super> " (or another "<level>> ") after.
+ * The ABW bootloader uses ">".
+ *
+ * run() pipelines a list of commands: it types the next ones without
+ * waiting for the answer of the previous one, as the CLI reads its input in
+ * order and answers each line before reading the next. Answers are split on
+ * the echo of each line and the prompt that follows it. Lines of the
+ * asynchronous log ("0d,00:02:40.340. (GNSS) MT. Started") are set apart
+ * from the output. Commands are resolved with resolve_command() first, so
+ * an abbreviation the CLI would refuse stops the list before it is sent.
+ *
+ * After set_output(true) the session uses the JSON records of
+ * lib/clijson/abw_cli_json.h: no echo and no prompt, each answer is the
+ * next line starting with {"cmd", and lines starting with {"event" are the
+ * log. run() then returns each record line as the output of its command,
+ * for abw_mfg_json.hpp to decode.
+ */
+
+#ifndef ABW_MFG_CLI_HPP
+#define ABW_MFG_CLI_HPP
+
+#include <chrono>
+#include <deque>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "abw_mfg_commands.hpp"
+#include "abw_serial.hpp"
+
+namespace abw {
+
+/*!
+ * \brief Answer of one command of run()
+ */
+struct cli_reply {
+    std::string              command;     //!< As sent, abbreviations expanded
+    std::string              output;      //!< Lines between the echo and the status, '\n' separated; the record in JSON
+    std::vector<std::string> logs;        //!< Asynchronous log lines (event records) printed meanwhile
+    bool                     ok = false;  //!< Ended with OK, code 0 in JSON
+};
+
+class mfg_cli {
+public:
+    static constexpr uint32_t default_baud = 57600;
+
+    explicit mfg_cli(serial_port& port) : port_(port) {}
+
+    /*!
+     * \brief True when text ends with a CLI prompt
+     */
+    static bool ends_with_prompt(const std::string& text)
+    {
+        size_t      nl   = text.find_last_of("\r\n");
+        std::string last = nl == std::string::npos ? text : text.substr(nl + 1);
+        while (!last.empty() && last.back() == ' ') {
+            last.pop_back();
+        }
+        return last == "login:" || (!last.empty() && last.back() == '>');
+    }
+
+    /*!
+     * \brief Read until a prompt, throws std::runtime_error on timeout
+     *
+     * \returns Everything read, prompt included
+     */
+    std::string read_prompt(int timeout_ms)
+    {
+        return read_while([](const std::string& text) { return !ends_with_prompt(text); }, timeout_ms);
+    }
+
+    /*!
+     * \brief Read until text contains a complete line holding needle, throws std::runtime_error on timeout
+     */
+    std::string read_line_with(const std::string& needle, int timeout_ms)
+    {
+        return read_while(
+            [&](const std::string& text) {
+                size_t at = text.find(needle);
+                return at == std::string::npos || text.find('\n', at) == std::string::npos;
+            },
+            timeout_ms);
+    }
+
+    /*!
+     * \brief Read until the line stays silent for idle_ms
+     */
+    std::string read_idle(int idle_ms)
+    {
+        std::string text;
+        char        buf[256];
+        while (size_t n = port_.read(buf, sizeof(buf), idle_ms)) {
+            text.append(buf, n);
+        }
+        return text;
+    }
+
+    /*!
+     * \brief Get to an authenticated prompt, logging in if the CLI asks for it
+     */
+    void login(const std::string& password, int timeout_ms = 3000)
+    {
+        port_.flush_input();
+        port_.write("\r");
+        std::string text = read_prompt(timeout_ms);
+        if (text.find("login:") != std::string::npos) {
+            port_.write(password + "\r");
+            text = read_prompt(timeout_ms);
+            if (text.find("login:") != std::string::npos) {
+                throw std::runtime_error("CLI login refused");
+            }
+        }
+        size_t nl = text.find_last_of("\r\n");
+        prompt_   = nl == std::string::npos ? text : text.substr(nl + 1);
+    }
+
+    /*!
+     * \brief Prompt of the authenticated CLI, "super> ", known after login()
+     */
+    const std::string& prompt() const { return prompt_; }
+
+    /*!
+     * \brief Switch the session between the text and the JSON output of the CLI, throws if it is refused
+     */
+    void set_output(bool json, int timeout_ms = 5000)
+    {
+        if (json == json_) {
+            return;
+        }
+        std::string line = json ? "system output json" : "system output text";
+        send(line);
+        if (json) {
+            std::string text = read_while(
+                [&](const std::string& t) {
+                    return t.find(line) == std::string::npos ||
+                           (t.find("\nOK\r\n") == std::string::npos && t.find("\nERROR\r\n") == std::string::npos);
+                },
+                timeout_ms);
+            if (text.find("\nOK\r\n") == std::string::npos) {
+                throw std::runtime_error("CLI has no JSON output");
+            }
+        } else {
+            std::string text = read_line_with("{\"cmd\"", timeout_ms);
+            size_t      at   = text.find("{\"cmd\"");
+            if (!ok_record(text.substr(at, text.find('\n', at) + 1 - at))) {
+                throw std::runtime_error("CLI refused text output");
+            }
+            if (!ends_with_prompt(text)) {
+                read_prompt(timeout_ms);
+            }
+        }
+        json_ = json;
+    }
+
+    bool json_output() const { return json_; }
+
+    /*!
+     * \brief Bytes read by run(), since the start
+     */
+    uint64_t received() const { return received_; }
+
+    /*!
+     * \brief Send a command line without waiting for its answer
+     */
+    void send(const std::string& line) { port_.write(line + "\r"); }
+
+    /*!
+     * \brief Run a command and return its output, echo and prompt excluded
+     */
+    std::string command(const std::string& line, int timeout_ms = 5000)
+    {
+        send(line);
+        std::string text = read_while(
+            [&](const std::string& t) { return t.find(line) == std::string::npos || !ends_with_prompt(t); },
+            timeout_ms);
+        size_t      from = text.find(line);
+        from             = from == std::string::npos ? 0 : text.find('\n', from) + 1;
+        size_t to        = text.find_last_of("\r\n");
+        return to == std::string::npos || to < from ? std::string() : text.substr(from, to - from);
+    }
+
+    /*!
+     * \brief True if a command output ends with the OK status line
+     */
+    static bool ok(const std::string& output)
+    {
+        size_t at = output.rfind("OK");
+        return at != std::string::npos && output.find_first_not_of("\r\n", at + 2) == std::string::npos;
+    }
+
+    /*!
+     * \brief Run commands in order, with up to depth of them typed ahead, throws on timeout or ambiguous command
+     *
+     * \param [in] depth  Commands sent and not yet answered, 1 for one round trip per command
+     * \param [in] window Bytes sent and not yet answered, kept within the input buffer of the board;
+     *                    a longer command is sent alone
+     * \param [in] timeout_ms Longest wait for each answer
+     */
+    std::vector<cli_reply> run(const std::vector<std::string>& lines, unsigned depth = 8, size_t window = 128,
+                               int timeout_ms = 5000)
+    {
+        using clock_type = std::chrono::steady_clock;
+
+        if (prompt_.empty()) {
+            throw std::runtime_error("CLI prompt unknown, log in first");
+        }
+        std::vector<cli_reply> replies;
+        for (const auto& line : lines) {
+            replies.push_back({resolve_command(line), "", {}, false});
+        }
+
+        std::deque<size_t> pending;  // Commands sent and not answered
+        size_t             next     = 0;
+        size_t             inflight = 0;
+        std::string        rx;
+        char               buf[512];
+        auto               deadline = clock_type::now() + std::chrono::milliseconds(timeout_ms);
+
+        while (next < replies.size() || !pending.empty()) {
+            while (next < replies.size() && pending.size() < std::max(depth, 1u) &&
+                   (pending.empty() || inflight + replies[next].command.size() + 1 <= window)) {
+                send(replies[next].command);
+                inflight += replies[next].command.size() + 1;
+                pending.push_back(next++);
+            }
+
+            size_t consumed = split_reply(rx, replies[pending.front()]);
+            if (consumed) {
+                rx.erase(0, consumed);
+                inflight -= replies[pending.front()].command.size() + 1;
+                pending.pop_front();
+                deadline = clock_type::now() + std::chrono::milliseconds(timeout_ms);
+                continue;
+            }
+            int left = int(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock_type::now()).count());
+            if (left <= 0) {
+                throw std::runtime_error("CLI timeout on \"" + replies[pending.front()].command + "\", got \"" + rx +
+                                         "\"");
+            }
+            size_t n = port_.read(buf, sizeof(buf), left);
+            rx.append(buf, n);
+            received_ += n;
+        }
+        return replies;
+    }
+
+    /*!
+     * \brief True for a line of the asynchronous log, "<days>d,<hh:mm:ss.mmm>. ..."
+     */
+    static bool is_log_line(const std::string& line)
+    {
+        static const std::regex log("^[0-9]+d,[0-9]{2}:[0-9]{2}:[0-9]{2}\\.[0-9]{3}\\. ");
+        return std::regex_search(line, log);
+    }
+
+    /*!
+     * \brief True for a JSON record that ends with code 0
+     */
+    static bool ok_record(const std::string& line)
+    {
+        size_t end = line.find_last_not_of("\r\n");
+        return end != std::string::npos && end >= 9 && line.compare(end - 9, 10, ",\"code\":0}") == 0;
+    }
+
+private:
+    /*!
+     * \brief Fill reply from the head of rx once it holds the echo, the answer and the next prompt
+     *
+     * \returns Bytes of rx used, 0 while the answer is incomplete
+     */
+    size_t split_reply(const std::string& rx, cli_reply& reply) const
+    {
+        if (json_) {
+            return split_record(rx, reply);
+        }
+        std::string echo = reply.command + "\r\n";
+        size_t      from = rx.find(echo);
+        if (from == std::string::npos) {
+            return 0;
+        }
+        from += echo.size();
+        size_t end = rx.find("\n" + prompt_, from - 1);
+        if (end == std::string::npos) {
+            return 0;
+        }
+
+        std::vector<std::string> lines;
+        for (size_t at = from; at <= end;) {
+            size_t      nl   = rx.find('\n', at);
+            std::string line = rx.substr(at, nl - at);
+            at               = nl + 1;
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (is_log_line(line)) {
+                reply.logs.push_back(line);
+            } else {
+                lines.push_back(line);
+            }
+        }
+        while (!lines.empty() && lines.back().empty()) {
+            lines.pop_back();
+        }
+        if (!lines.empty() && (lines.back() == "OK" || lines.back() == "ERROR")) {
+            reply.ok = lines.back() == "OK";
+            lines.pop_back();
+        }
+        for (const auto& line : lines) {
+            reply.output += line + "\n";
+        }
+        return end + 1 + prompt_.size();
+    }
+
+    /*!
+     * \brief split_reply() in JSON mode: event lines up to the result record
+     */
+    static size_t split_record(const std::string& rx, cli_reply& reply)
+    {
+        std::vector<std::string> events;
+        for (size_t at = 0, nl; (nl = rx.find('\n', at)) != std::string::npos; at = nl + 1) {
+            size_t end = nl > at && rx[nl - 1] == '\r' ? nl - 1 : nl;
+            if (rx.compare(at, 7, "{\"cmd\":") == 0) {
+                reply.logs   = events;
+                reply.output = rx.substr(at, end - at);
+                reply.ok     = ok_record(reply.output);
+                return nl + 1;
+            }
+            if (rx.compare(at, 9, "{\"event\":") == 0) {
+                events.push_back(rx.substr(at, end - at));
+            }
+        }
+        return 0;
+    }
+
+    template <typename More>
+    std::string read_while(More more, int timeout_ms)
+    {
+        using clock_type = std::chrono::steady_clock;
+        auto        end  = clock_type::now() + std::chrono::milliseconds(timeout_ms);
+        std::string text;
+        char        buf[256];
+
+        while (more(text)) {
+            int left = int(std::chrono::duration_cast<std::chrono::milliseconds>(end - clock_type::now()).count());
+            if (left <= 0) {
+                throw std::runtime_error("CLI timeout, got \"" + text + "\"");
+            }
+            text.append(buf, port_.read(buf, sizeof(buf), left));
+        }
+        return text;
+    }
+
+    serial_port& port_;
+    std::string  prompt_;
+    bool         json_     = false;
+    uint64_t     received_ = 0;
+};
+
+}  // namespace abw
+
+#endif  // ABW_MFG_CLI_HPP
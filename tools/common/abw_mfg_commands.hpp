@@ -0,0 +1,200 @@
+/*!
+ * \file      abw_mfg_commands.hpp
+ *
+ * \brief     Command tree of the MFG firmware CLI, and resolution of abbreviated commands
+ *
+ * The CLI accepts any unambiguous prefix of each word of a command:
+ * "prov l disp" runs "provis lora display". resolve_command() expands a
+ * line the same way, so that a script can be checked before anything is
+ * sent and its answers matched to full command names.
+ *
+ * The tree is the one of MFG 3.0 (mfg-*-evk-debug.bin), as far as the
+ * stations use it. A group whose subcommands are not listed takes the rest
+ * of the line as typed, and so does a group when a word matches none of its
+ * subcommands: the board has the last word on commands this table does not
+ * know. Only a word that is a prefix of several subcommands is refused.
+ *
+ * "system output" is not in MFG 3.0: it is the switch to the JSON records of
+ * lib/clijson/abw_cli_json.h. Neither is "gnss almanac load": the bulk
+ * almanac transfer of lib/lr11xx/lr11xx_almanac.hpp.
+ */
+
+#ifndef ABW_MFG_COMMANDS_HPP
+#define ABW_MFG_COMMANDS_HPP
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace abw {
+
+struct cli_command {
+    std::string              name;
+    std::vector<cli_command> sub;  //!< Empty when the rest of the line is not resolved
+};
+
+/*!
+ * \brief Commands of the MFG firmware, from its help strings
+ */
+inline const cli_command& mfg_commands()
+{
+    static const cli_command root = {
+        "",
+        {
+            {"ble",
+             {{"address", {}},
+              {"beacon", {}},
+              {"clear", {}},
+              {"close", {}},
+              {"connect", {}},
+              {"open", {}},
+              {"scan", {}},
+              {"service", {}},
+              {"version", {}}}},
+            {"flash", {}},
+            {"gnss",
+             {{"almanac",
+               {{"get", {}},
+                {"load", {}},  // Proposed, see lib/lr11xx/lr11xx_almanac.hpp
+                {"set", {}},
+                {"validity", {}}}},
+              {"lr1110", {}},
+              {"mt3333",
+               {{"clear", {}},
+                {"cmd", {}},
+                {"fix", {}},
+                {"msg", {}},
+                {"off", {}},
+                {"on", {}},
+                {"prn", {}},
+                {"query", {}},
+                {"show", {}},
+                {"track", {}},
+                {"version", {}}}},
+              {"off", {}},
+              {"on", {}}}},
+            {"gpio", {}},
+            {"help", {}},
+            {"i2c", {}},
+            {"lis2dw", {}},
+            {"logout", {}},
+            {"lora",
+             {{"close", {}},
+              {"date", {}},
+              {"info", {}},
+              {"join", {}},
+              {"leave", {}},
+              {"link", {}},
+              {"live", {}},
+              {"nonce", {}},
+              {"open", {}}}},
+            {"lpm", {}},
+            {"lr11xx", {{"firmware", {{"update", {{"bridge", {}}}}, {"version", {}}}}, {"system", {}}, {"uid", {}}}},
+            {"parameters", {}},
+            {"provis",
+             {{"lora",
+               {{"display", {}},
+                {"erase", {}},
+                {"factory", {}},
+                {"restore", {}},
+                {"save", {}},
+                {"set",
+                 {{"activation", {}},
+                  {"appkey", {}},
+                  {"deveui", {}},
+                  {"joineui", {}},
+                  {"nwkkey", {}},
+                  {"parameter", {}},
+                  {"region", {}}}}}},
+              {"system", {}}}},
+            {"pwm", {}},
+            {"spi", {}},
+            {"system",
+             {{"bootloader", {}},
+              {"date", {}},
+              {"error", {}},
+              {"hsi", {}},
+              {"info", {}},
+              {"log", {}},
+              {"output", {}},  // Proposed, see lib/clijson/abw_cli_json.h
+              {"parameter", {}},
+              {"reset", {}},
+              {"thread", {}},
+              {"uart", {}},
+              {"uid", {}},
+              {"version", {}}}},
+            {"tester", {}},
+            {"timer", {}},
+            {"wifi", {}},
+        }};
+    return root;
+}
+
+/*!
+ * \brief Expand the abbreviated words of a command line, throws std::invalid_argument on an ambiguous word
+ *
+ * Words are separated by single spaces in the result; arguments are kept as typed.
+ */
+inline std::string resolve_command(const std::string& line, const cli_command& root = mfg_commands())
+{
+    static const std::vector<cli_command> none;
+
+    std::istringstream in(line);
+    std::string        resolved;
+    const cli_command* group = &root;
+
+    for (std::string word; in >> word;) {
+        const cli_command* found   = nullptr;
+        std::string        matches;
+        for (const auto& c : group ? group->sub : none) {
+            if (c.name == word) {
+                found   = &c;
+                matches = c.name;
+                break;
+            }
+            if (c.name.compare(0, word.size(), word) == 0) {
+                matches += (found ? ", " : "") + c.name;
+                found = found ? &root : &c;  // root marks an ambiguous word
+            }
+        }
+        if (found == &root) {
+            throw std::invalid_argument("ambiguous command \"" + word + "\" in \"" + line + "\": " + matches);
+        }
+        resolved += (resolved.empty() ? "" : " ") + (found ? found->name : word);
+        group = found && !found->sub.empty() ? found : nullptr;
+    }
+    return resolved;
+}
+
+/*!
+ * \brief Name of the command of an expanded line, its arguments left out: "provis lora set deveui"
+ *
+ * The first word stands for a command the tree does not know.
+ */
+inline std::string command_name(const std::string& line, const cli_command& root = mfg_commands())
+{
+    std::istringstream in(line);
+    std::string        name;
+    const cli_command* group = &root;
+
+    for (std::string word; group && in >> word;) {
+        const cli_command* found = nullptr;
+        for (const auto& c : group->sub) {
+            if (c.name == word) {
+                found = &c;
+                break;
+            }
+        }
+        if (!found && !name.empty()) {
+            break;
+        }
+        name += (name.empty() ? "" : " ") + word;
+        group = found && !found->sub.empty() ? found : nullptr;
+    }
+    return name;
+}
+
+}  // namespace abw
+
+#endif  // ABW_MFG_COMMANDS_HPP
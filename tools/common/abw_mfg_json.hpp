@@ -0,0 +1,623 @@
+/*!
+ * \file      abw_mfg_json.hpp
+ *
+ * \brief     Decoder of the JSON records of the MFG CLI, and the same records from its text output
+ *
+ * In JSON mode (lib/clijson/abw_cli_json.h) each command is answered with
+ * one line, {"cmd":..,"data":{..},"code":N[,"error":..]}, and each log line
+ * becomes an event record. parse_record() reads one with a small JSON
+ * parser: objects, arrays, strings, integers, true, false and null, which is
+ * all the records hold.
+ *
+ * text_record() and log_record() build the same records from the text
+ * output of a board that has no JSON mode, for the commands whose answers
+ * they know (version tables, "lora info", "provis lora display"). The data
+ * of other commands is left empty. The text output carries no status code:
+ * "Unknown command" maps to ABW_CLI_UNKNOWN_COMMAND, the "Invalid..." and
+ * "Missing..." messages to ABW_CLI_INVALID_ARGUMENT, any other ERROR to
+ * ABW_CLI_FAILED.
+ */
+
+#ifndef ABW_MFG_JSON_HPP
+#define ABW_MFG_JSON_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abw_mfg_cli.hpp"
+#include "abw_mfg_commands.hpp"
+#include "abw_mfg_replies.hpp"
+
+namespace abw {
+
+/*!
+ * \brief JSON value, members of objects kept in order
+ */
+struct json_value {
+    enum kind_type { null, boolean, integer, string, object, array };
+
+    kind_type                                        kind   = null;
+    bool                                             flag   = false;
+    int64_t                                          number = 0;
+    std::string                                      text;
+    std::vector<std::pair<std::string, json_value>> members;
+    std::vector<json_value>                          items;
+
+    json_value() = default;
+    json_value(bool value) : kind(boolean), flag(value) {}
+    json_value(int64_t value) : kind(integer), number(value) {}
+    json_value(int value) : kind(integer), number(value) {}
+    json_value(const std::string& value) : kind(string), text(value) {}
+    json_value(const char* value) : kind(string), text(value) {}
+
+    static json_value make_object()
+    {
+        json_value v;
+        v.kind = object;
+        return v;
+    }
+
+    /*!
+     * \brief Member of an object, nullptr if none
+     */
+    const json_value* find(const std::string& key) const
+    {
+        for (const auto& m : members) {
+            if (m.first == key) {
+                return &m.second;
+            }
+        }
+        return nullptr;
+    }
+
+    void set(const std::string& key, const json_value& value) { members.emplace_back(key, value); }
+
+    bool operator==(const json_value& o) const
+    {
+        return kind == o.kind && flag == o.flag && number == o.number && text == o.text && members == o.members &&
+               items == o.items;
+    }
+    bool operator!=(const json_value& o) const { return !(*this == o); }
+};
+
+/*!
+ * \brief Compact JSON text of a value, as the board writes it
+ */
+inline std::string to_json(const json_value& v)
+{
+    switch (v.kind) {
+    case json_value::boolean:
+        return v.flag ? "true" : "false";
+    case json_value::integer:
+        return std::to_string(v.number);
+    case json_value::string: {
+        std::string out = "\"";
+        for (char c : v.text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char esc[8];
+                std::snprintf(esc, sizeof(esc), "\\u%04x", unsigned(c));
+                out += esc;
+            } else {
+                out += c;
+            }
+        }
+        return out + "\"";
+    }
+    case json_value::object: {
+        std::string out = "{";
+        for (const auto& m : v.members) {
+            out += (out.size() > 1 ? "," : "") + to_json(json_value(m.first)) + ":" + to_json(m.second);
+        }
+        return out + "}";
+    }
+    case json_value::array: {
+        std::string out = "[";
+        for (const auto& item : v.items) {
+            out += (out.size() > 1 ? "," : "") + to_json(item);
+        }
+        return out + "]";
+    }
+    default:
+        return "null";
+    }
+}
+
+namespace json_detail {
+
+class parser {
+public:
+    explicit parser(const std::string& text) : text_(text) {}
+
+    json_value parse()
+    {
+        json_value v = value(0);
+        skip_space();
+        if (at_ != text_.size()) {
+            fail("trailing characters");
+        }
+        return v;
+    }
+
+private:
+    static constexpr unsigned depth_max = 16;
+
+    [[noreturn]] void fail(const char* what) const
+    {
+        throw std::runtime_error(std::string("JSON: ") + what + " at " + std::to_string(at_));
+    }
+
+    void skip_space()
+    {
+        while (at_ < text_.size() && (text_[at_] == ' ' || text_[at_] == '\t' || text_[at_] == '\r' ||
+                                      text_[at_] == '\n')) {
+            at_++;
+        }
+    }
+
+    bool take(char c)
+    {
+        skip_space();
+        if (at_ < text_.size() && text_[at_] == c) {
+            at_++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!take(c)) {
+            fail(("'" + std::string(1, c) + "' expected").c_str());
+        }
+    }
+
+    bool word(const char* w)
+    {
+        size_t n = std::char_traits<char>::length(w);
+        if (text_.compare(at_, n, w) == 0) {
+            at_ += n;
+            return true;
+        }
+        return false;
+    }
+
+    json_value value(unsigned depth)
+    {
+        if (depth >= depth_max) {
+            fail("too deep");
+        }
+        skip_space();
+        if (at_ >= text_.size()) {
+            fail("value expected");
+        }
+        char c = text_[at_];
+        if (c == '{') {
+            at_++;
+            json_value v = json_value::make_object();
+            if (take('}')) {
+                return v;
+            }
+            do {
+                skip_space();
+                std::string key = quoted();
+                expect(':');
+                v.members.emplace_back(std::move(key), value(depth + 1));
+            } while (take(','));
+            expect('}');
+            return v;
+        }
+        if (c == '[') {
+            at_++;
+            json_value v;
+            v.kind = json_value::array;
+            if (take(']')) {
+                return v;
+            }
+            do {
+                v.items.push_back(value(depth + 1));
+            } while (take(','));
+            expect(']');
+            return v;
+        }
+        if (c == '"') {
+            return json_value(quoted());
+        }
+        if (c == '-' || (c >= '0' && c <= '9')) {
+            return json_value(integer());
+        }
+        if (word("true")) {
+            return json_value(true);
+        }
+        if (word("false")) {
+            return json_value(false);
+        }
+        if (word("null")) {
+            return json_value();
+        }
+        fail("value expected");
+    }
+
+    /*!
+     * \brief Integer; the records hold no fractions or exponents
+     */
+    int64_t integer()
+    {
+        bool negative = text_[at_] == '-';
+        at_ += negative;
+        size_t  from  = at_;
+        int64_t value = 0;
+        while (at_ < text_.size() && text_[at_] >= '0' && text_[at_] <= '9' && at_ - from < 18) {
+            value = value * 10 + (text_[at_++] - '0');
+        }
+        if (at_ == from || (at_ < text_.size() && (text_[at_] == '.' || text_[at_] == 'e' || text_[at_] == 'E' ||
+                                                   (text_[at_] >= '0' && text_[at_] <= '9')))) {
+            fail("integer expected");
+        }
+        return negative ? -value : value;
+    }
+
+    std::string quoted()
+    {
+        if (at_ >= text_.size() || text_[at_] != '"') {
+            fail("string expected");
+        }
+        std::string out;
+        for (at_++; at_ < text_.size() && text_[at_] != '"'; at_++) {
+            char c = text_[at_];
+            if (static_cast<unsigned char>(c) < 0x20) {
+                fail("control character in string");
+            }
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (++at_ >= text_.size()) {
+                break;
+            }
+            switch (text_[at_]) {
+            case '"':
+            case '\\':
+            case '/':
+                out += text_[at_];
+                break;
+            case 'b':
+                out += '\b';
+                break;
+            case 'f':
+                out += '\f';
+                break;
+            case 'n':
+                out += '\n';
+                break;
+            case 'r':
+                out += '\r';
+                break;
+            case 't':
+                out += '\t';
+                break;
+            case 'u': {
+                if (at_ + 4 >= text_.size()) {
+                    fail("short \\u escape");
+                }
+                unsigned code = unsigned(std::stoul(text_.substr(at_ + 1, 4), nullptr, 16));
+                at_ += 4;
+                // UTF-8, surrogate pairs left as they are: the board only escapes control characters
+                if (code < 0x80) {
+                    out += char(code);
+                } else if (code < 0x800) {
+                    out += char(0xC0 | (code >> 6));
+                    out += char(0x80 | (code & 0x3F));
+                } else {
+                    out += char(0xE0 | (code >> 12));
+                    out += char(0x80 | ((code >> 6) & 0x3F));
+                    out += char(0x80 | (code & 0x3F));
+                }
+                break;
+            }
+            default:
+                fail("bad escape");
+            }
+        }
+        if (at_ >= text_.size()) {
+            fail("unterminated string");
+        }
+        at_++;
+        return out;
+    }
+
+    const std::string& text_;
+    size_t             at_ = 0;
+};
+
+}  // namespace json_detail
+
+/*!
+ * \brief Parse JSON text, throws std::runtime_error if it is not valid
+ */
+inline json_value parse_json(const std::string& text)
+{
+    return json_detail::parser(text).parse();
+}
+
+/*!
+ * \brief One result or event record
+ */
+struct cli_record {
+    bool        event     = false;  //!< Event record, otherwise the result of a command
+    std::string name;               //!< Command without its arguments, or event name ("log")
+    uint32_t    uptime_ms = 0;      //!< Events only
+    json_value  data      = json_value::make_object();
+    int         code      = 0;      //!< abw_cli_code_t
+    std::string error;              //!< Only when code is not 0, and not always then
+
+    bool operator==(const cli_record& o) const
+    {
+        return event == o.event && name == o.name && data == o.data && code == o.code && error == o.error;
+    }
+    bool operator!=(const cli_record& o) const { return !(*this == o); }  //!< Uptimes are not compared
+};
+
+/*!
+ * \brief Record as the board writes it, without the CR LF
+ */
+inline std::string to_json(const cli_record& r)
+{
+    std::string out = r.event ? "{\"event\":" + to_json(json_value(r.name)) +
+                                    ",\"uptime_ms\":" + std::to_string(r.uptime_ms)
+                              : "{\"cmd\":" + to_json(json_value(r.name));
+    out += ",\"data\":" + to_json(r.data) + ",\"code\":" + std::to_string(r.code);
+    if (r.code != 0 && !r.error.empty()) {
+        out += ",\"error\":" + to_json(json_value(r.error));
+    }
+    return out + "}";
+}
+
+/*!
+ * \brief Parse one record line, throws std::runtime_error if it is not one
+ */
+inline cli_record parse_record(const std::string& line)
+{
+    json_value  v = parse_json(line);
+    cli_record  r;
+    const auto* cmd   = v.find("cmd");
+    const auto* event = v.find("event");
+    const auto* data  = v.find("data");
+    const auto* code  = v.find("code");
+    const auto* error = v.find("error");
+    const auto* up    = v.find("uptime_ms");
+
+    if (v.kind != json_value::object || !(cmd || event) || !data || data->kind != json_value::object || !code ||
+        code->kind != json_value::integer) {
+        throw std::runtime_error("not a CLI record: " + line);
+    }
+    const auto* name = cmd ? cmd : event;
+    r.event          = !cmd;
+    r.name           = name->text;
+    r.data           = *data;
+    r.code           = int(code->number);
+    r.error          = error ? error->text : "";
+    r.uptime_ms      = up ? uint32_t(up->number) : 0;
+    return r;
+}
+
+/*!
+ * \brief Member of the data of a record, with a default
+ */
+inline std::string data_text(const cli_record& r, const char* key)
+{
+    const json_value* v = r.data.find(key);
+    return v && v->kind == json_value::string ? v->text : std::string();
+}
+
+inline int64_t data_int(const cli_record& r, const char* key, int64_t otherwise = -1)
+{
+    const json_value* v = r.data.find(key);
+    return v && v->kind == json_value::integer ? v->number : otherwise;
+}
+
+inline bool data_bool(const cli_record& r, const char* key)
+{
+    const json_value* v = r.data.find(key);
+    return v && v->kind == json_value::boolean && v->flag;
+}
+
+/*!
+ * \brief Structs of abw_mfg_replies.hpp from records
+ */
+inline lora_info to_lora_info(const cli_record& r)
+{
+    lora_info info;
+    info.lorawan     = data_text(r, "lorawan");
+    info.regional    = data_text(r, "regional");
+    info.modem       = data_text(r, "modem");
+    info.chip_hw     = int(data_int(r, "chip_hw"));
+    info.chip_type   = int(data_int(r, "chip_type"));
+    info.chip_fw     = int(data_int(r, "chip_fw"));
+    info.dev_eui     = data_text(r, "dev_eui");
+    info.join_eui    = data_text(r, "join_eui");
+    info.region      = data_text(r, "region");
+    info.tx_strategy = data_text(r, "tx_strategy");
+    info.state       = data_text(r, "state");
+    info.joined      = data_bool(r, "joined");
+    info.dev_addr    = uint32_t(data_int(r, "dev_addr", 0));
+    info.dev_nonce   = int(data_int(r, "dev_nonce"));
+    return info;
+}
+
+inline lora_provisioning to_lora_provisioning(const cli_record& r)
+{
+    lora_provisioning p;
+    p.valid      = data_bool(r, "valid");
+    p.saved      = data_bool(r, "saved");
+    p.region     = data_text(r, "region");
+    p.activation = data_text(r, "activation");
+    p.dev_eui    = data_text(r, "dev_eui");
+    p.join_eui   = data_text(r, "join_eui");
+    p.nwkkey     = data_bool(r, "nwkkey");
+    p.appkey     = data_bool(r, "appkey");
+    return p;
+}
+
+namespace json_detail {
+
+inline int64_t hex_value(const std::string& text)
+{
+    return text.empty() ? -1 : int64_t(std::stoul(text, nullptr, 16));
+}
+
+/*!
+ * \brief Data of the text output of the commands known, empty otherwise
+ */
+inline json_value text_data(const std::string& name, const std::string& text)
+{
+    static const std::regex aos("AOS: (\\S+)\\. Built on: ([^\\r\\n]*)");
+    static const std::regex mfg("MFG: (\\S+)\\. Build on: ([^\\r\\n]*)");
+    static const std::regex ble("\\(BLE STACK\\) (\\S+)");
+    static const std::regex fus("FUS version (\\S+)");
+
+    json_value  data  = json_value::make_object();
+    auto        pairs = parse_key_values(text);
+    auto        get   = [&](const char* key) {
+        const std::string* v = find_value(pairs, key);
+        return v ? *v : std::string();
+    };
+    std::smatch a, b;
+
+    if (name == "system version" && std::regex_search(text, a, aos) && std::regex_search(text, b, mfg)) {
+        data.set("aos", a.str(1));
+        data.set("aos_build", a.str(2));
+        data.set("mfg", b.str(1));
+        data.set("mfg_build", b.str(2));
+    } else if (name == "ble version" && std::regex_search(text, a, ble) && std::regex_search(text, b, fus)) {
+        data.set("ble_stack", a.str(1));
+        data.set("fus", b.str(1));
+    } else if ((name == "lr11xx firmware version" || name == "lr1110") && !get("Firmware version").empty()) {
+        data.set("system_type", int64_t(std::stoul(get("System Type"))));
+        data.set("hardware", hex_value(get("Hardware version")));
+        data.set("firmware", hex_value(get("Firmware version")));
+    } else if (name == "lr11xx firmware update bridge" && !get("Bootloader version").empty()) {
+        data.set("bootloader", hex_value(get("Bootloader version")));
+    } else if (name == "gnss mt3333 version" && !get("MT3333 firmware").empty()) {
+        data.set("firmware", get("MT3333 firmware"));
+    } else if (name == "lora info") {
+        lora_info info = parse_lora_info(text);
+        data.set("lorawan", info.lorawan);
+        data.set("regional", info.regional);
+        data.set("modem", info.modem);
+        data.set("chip_hw", info.chip_hw);
+        data.set("chip_type", info.chip_type);
+        data.set("chip_fw", info.chip_fw);
+        data.set("dev_eui", info.dev_eui);
+        data.set("join_eui", info.join_eui);
+        data.set("region", info.region);
+        data.set("tx_strategy", info.tx_strategy);
+        data.set("state", info.state);
+        data.set("joined", info.joined);
+        data.set("dev_addr", int64_t(info.dev_addr));
+        data.set("dev_nonce", info.dev_nonce);
+    } else if (name == "provis lora display") {
+        lora_provisioning p = parse_lora_provisioning(text);
+        data.set("valid", p.valid);
+        if (p.valid) {
+            data.set("saved", p.saved);
+            data.set("region", p.region);
+            data.set("activation", p.activation);
+            data.set("dev_eui", p.dev_eui);
+            data.set("join_eui", p.join_eui);
+            data.set("nwkkey", p.nwkkey);
+            data.set("appkey", p.appkey);
+        }
+    }
+    return data;
+}
+
+}  // namespace json_detail
+
+/*!
+ * \brief Record of the text answer of a command
+ */
+inline cli_record text_record(const cli_reply& reply)
+{
+    cli_record  r;
+    std::string text = reply.output;
+    r.name           = command_name(reply.command);
+    if (!reply.ok) {
+        // The error message, if any, is the last line before ERROR
+        size_t      from = text.rfind('\n', text.size() > 1 ? text.size() - 2 : 0);
+        std::string last = text.substr(from == std::string::npos ? 0 : from + 1);
+        if (!last.empty() && last.back() == '\n') {
+            last.pop_back();
+        }
+        if (last == "Unknown command") {
+            r.code = 1;
+        } else if (last.compare(0, 8, "Invalid ") == 0 || last.compare(0, 8, "Missing ") == 0 ||
+                   last.compare(0, 6, "usage:") == 0) {
+            r.code = 2;
+        } else {
+            r.code = 3;
+        }
+        if (r.code != 3) {
+            r.error = last;
+            text.erase(from == std::string::npos ? 0 : from + 1);
+        }
+    }
+    try {
+        r.data = json_detail::text_data(r.name, text);
+    } catch (const std::runtime_error&) {
+        // Not the answer expected, kept out of the data
+    }
+    return r;
+}
+
+/*!
+ * \brief Record of a line of the asynchronous log, "0d,00:02:40.340. (GNSS) MT. Started"
+ */
+inline cli_record log_record(const std::string& line)
+{
+    unsigned days = 0, h = 0, m = 0, s = 0, ms = 0;
+    int      used = 0;
+    if (std::sscanf(line.c_str(), "%ud,%2u:%2u:%2u.%3u. %n", &days, &h, &m, &s, &ms, &used) != 5 || !used) {
+        throw std::runtime_error("not a log line: " + line);
+    }
+    cli_record  r;
+    std::string text = line.substr(size_t(used));
+    std::string source;
+    size_t      close = text.find(") ");
+    if (!text.empty() && text[0] == '(' && close != std::string::npos) {
+        source = text.substr(1, close - 1);
+        text   = text.substr(close + 2);
+    }
+    r.event     = true;
+    r.name      = "log";
+    r.uptime_ms = (((days * 24 + h) * 60 + m) * 60 + s) * 1000 + ms;
+    r.data.set("source", source);
+    r.data.set("text", text);
+    return r;
+}
+
+/*!
+ * \brief Records of replies of mfg_cli::run(), logs first, in either output mode
+ */
+inline std::vector<cli_record> decode_replies(const std::vector<cli_reply>& replies, bool json)
+{
+    std::vector<cli_record> records;
+    for (const auto& reply : replies) {
+        for (const auto& log : reply.logs) {
+            records.push_back(json ? parse_record(log) : log_record(log));
+        }
+        records.push_back(json ? parse_record(reply.output) : text_record(reply));
+    }
+    return records;
+}
+
+}  // namespace abw
+
+#endif  // ABW_MFG_JSON_HPP
@@ -0,0 +1,216 @@
+/*!
+ * \file      abw_mfg_replies.hpp
+ *
+ * \brief     Parsers of the key/value tables printed by the MFG CLI
+ *
+ * Most MFG commands print one "key : value" pair per line, right-aligned
+ * ("%25s : %10s") or indented under a section title ("  DevEUI: ...").
+ * parse_key_values() reads any of them; parse_lora_info() and
+ * parse_lora_provisioning() turn the answers of "lora info" and
+ * "provis lora display" into structs.
+ *
+ * EUIs are printed as dash-separated bytes, "20-63-5f-01-00-00-12-34". The
+ * structs hold them as 16 lowercase hex digits, the form "provis lora set
+ * deveui" takes.
+ */
+
+#ifndef ABW_MFG_REPLIES_HPP
+#define ABW_MFG_REPLIES_HPP
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace abw {
+
+struct key_value {
+    std::string key;
+    std::string value;
+};
+
+/*!
+ * \brief Answer of "lora info"
+ */
+struct lora_info {
+    std::string lorawan;           //!< LoRaWAN version, "1.0.4.0"
+    std::string regional;          //!< Regional parameters version
+    std::string modem;             //!< LoRa Basics Modem version
+    int         chip_hw   = -1;
+    int         chip_type = -1;
+    int         chip_fw   = -1;
+    std::string dev_eui;           //!< 16 hex digits
+    std::string join_eui;
+    std::string region;            //!< "EU868"
+    std::string tx_strategy;       //!< "Network (ADR)" or "Custom"
+    std::string state;
+    bool        joined    = false;
+    uint32_t    dev_addr  = 0;
+    int         dev_nonce = -1;
+};
+
+/*!
+ * \brief Answer of "provis lora display"
+ */
+struct lora_provisioning {
+    bool        valid  = false;  //!< False for "No valid provisioning data exists."
+    bool        saved  = false;  //!< The settings shown are the ones in flash
+    std::string region;
+    std::string activation;
+    std::string dev_eui;         //!< 16 hex digits
+    std::string join_eui;
+    bool        nwkkey = false;  //!< A key is set, the CLI never shows it
+    bool        appkey = false;
+};
+
+/*!
+ * \brief Every "key : value" or "key: value" line of text, in order, section titles left out
+ */
+inline std::vector<key_value> parse_key_values(const std::string& text)
+{
+    std::vector<key_value> pairs;
+    size_t                 start = 0;
+    while (start < text.size()) {
+        size_t      end  = text.find('\n', start);
+        std::string line = text.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        start            = end == std::string::npos ? text.size() : end + 1;
+
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        size_t key_begin = line.find_first_not_of(' ');
+        size_t key_end   = line.find_last_not_of(' ', colon ? colon - 1 : 0);
+        size_t val_begin = line.find_first_not_of(' ', colon + 1);
+        size_t val_end   = line.find_last_not_of(" \r");
+        if (key_begin >= colon || key_end == std::string::npos) {
+            continue;
+        }
+        pairs.push_back({line.substr(key_begin, key_end + 1 - key_begin),
+                         val_begin == std::string::npos || val_begin > val_end
+                             ? std::string()
+                             : line.substr(val_begin, val_end + 1 - val_begin)});
+    }
+    return pairs;
+}
+
+/*!
+ * \brief Value of the first pair with this key, nullptr if none
+ */
+inline const std::string* find_value(const std::vector<key_value>& pairs, const std::string& key)
+{
+    for (const auto& kv : pairs) {
+        if (kv.key == key) {
+            return &kv.value;
+        }
+    }
+    return nullptr;
+}
+
+/*!
+ * \brief 16 lowercase hex digits of an EUI written with or without separators, empty if it is not 8 bytes
+ */
+inline std::string eui_hex(const std::string& text)
+{
+    std::string hex;
+    for (char c : text) {
+        if (std::isxdigit(static_cast<unsigned char>(c))) {
+            hex += char(std::tolower(static_cast<unsigned char>(c)));
+        } else if (c != '-' && c != ':' && c != ' ') {
+            return "";
+        }
+    }
+    return hex.size() == 16 ? hex : "";
+}
+
+/*!
+ * \brief EUI as the CLI prints it, "20-63-5f-01-00-00-12-34"
+ */
+inline std::string eui_text(const std::string& hex)
+{
+    std::string text;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        text += (text.empty() ? "" : "-") + hex.substr(i, 2);
+    }
+    return text;
+}
+
+/*!
+ * \brief Parse the answer of "lora info", throws std::runtime_error if it is not one
+ */
+inline lora_info parse_lora_info(const std::string& text)
+{
+    static const std::regex chip("Chip\\. HW: ([0-9]+)\\. Type: ([0-9]+), FW: 0x([0-9A-Fa-f]+)");
+
+    if (text.find("LoRa information") == std::string::npos) {
+        throw std::runtime_error("not a \"lora info\" answer");
+    }
+    auto        pairs = parse_key_values(text);
+    auto        get   = [&](const char* key) {
+        const std::string* v = find_value(pairs, key);
+        return v ? *v : std::string();
+    };
+    lora_info   info;
+    std::smatch match;
+
+    info.lorawan     = get("LoRa");
+    info.regional    = get("Regional");
+    info.modem       = get("Modem");
+    info.dev_eui     = eui_hex(get("DevEUI"));
+    info.join_eui    = eui_hex(get("JoinEUI"));
+    info.region      = get("Region");
+    info.tx_strategy = get("TX strategy");
+    info.state       = get("State");
+    info.joined      = get("Joined") == "Yes";
+    if (std::regex_search(text, match, chip)) {
+        info.chip_hw   = std::stoi(match[1]);
+        info.chip_type = std::stoi(match[2]);
+        info.chip_fw   = int(std::stoul(match[3], nullptr, 16));
+    }
+    std::string addr  = get("DevAddr");
+    std::string nonce = get("DevNonce");
+    if (!addr.empty()) {
+        info.dev_addr = uint32_t(std::stoul(addr, nullptr, 16));
+    }
+    if (!nonce.empty()) {
+        info.dev_nonce = std::stoi(nonce);
+    }
+    return info;
+}
+
+/*!
+ * \brief Parse the answer of "provis lora display", throws std::runtime_error if it is not one
+ */
+inline lora_provisioning parse_lora_provisioning(const std::string& text)
+{
+    lora_provisioning p;
+    if (text.find("No valid provisioning data exists.") != std::string::npos) {
+        return p;
+    }
+    bool unsaved = text.find("Provisioning data (unsaved):") != std::string::npos;
+    if (!unsaved && text.find("Provisioning data (saved):") == std::string::npos) {
+        throw std::runtime_error("not a \"provis lora display\" answer");
+    }
+
+    auto pairs = parse_key_values(text);
+    auto get   = [&](const char* key) {
+        const std::string* v = find_value(pairs, key);
+        return v ? *v : std::string();
+    };
+    p.valid      = true;
+    p.saved      = !unsaved;
+    p.region     = get("MAC Region");
+    p.activation = get("Activation");
+    p.dev_eui    = eui_hex(get("Device EUI"));
+    p.join_eui   = eui_hex(get("Join EUI"));
+    p.nwkkey     = get("nwkkey defined") == "yes";
+    p.appkey     = get("appkey defined") == "yes";
+    return p;
+}
+
+}  // namespace abw
+
+#endif  // ABW_MFG_REPLIES_HPP
@@ -0,0 +1,481 @@
+/*!
+ * \file      abw_mt3333.hpp
+ *
+ * \brief     MT3333 download over its UART: boot ROM handshake, download agent, ROM write
+ *
+ * The MT3333 boot ROM (BROM) listens at 115200 baud right after power-up.
+ * It answers the sync bytes A0 0A 50 05 with their complements, loads the
+ * download agent (DA, MTK_AllInOne_DA_MT3333_MP.BIN) into SRAM and jumps to
+ * it. BROM commands echo every byte, 32-bit arguments are big-endian, and
+ * each step ends with a 16-bit status, 0 for success:
+ *
+ *   SEND_DA  D7, address, length, signature length (0) -> status;
+ *            data -> XOR of the little-endian 16-bit words, status
+ *   JUMP_DA  D5, address -> status
+ *
+ * The DA starts at 115200 with C0, the JEDEC ID of the flash, its size and
+ * ACK (5A). Its commands answer ACK, or NACK (A5) when refused:
+ *
+ *   SPEED    D2, index, probe length (16 bits) -> ACK; then at the new
+ *            rate C0 until echoed, the probe bytes -> ACK, 16-bit sum;
+ *            the host commits with ACK. NACK, or no sync within a second,
+ *            takes the DA back to 115200.
+ *   FORMAT   D4, address, length -> ACK once the 64 KiB blocks are erased
+ *   WRITE    D5, address, length, packet length -> ACK; then packets of
+ *            data and their 16-bit sum, each answered CONT (69) once
+ *            programmed, or NACK (the DA then drops its input until the line
+ *            is idle and waits for the same packet again); ACK after the last
+ *   CHECKSUM D8, address, length -> 16-bit sum of the flash, ACK
+ *   FINISH   D9 -> ACK, and the MT3333 boots the new ROM
+ *
+ * Sums are of bytes, modulo 65536. C0 on its own is a sync and is echoed.
+ *
+ * mt3333_flasher drives the sequence. It raises the DA to the fastest speed
+ * whose probe comes back right, and keeps up to depth packets on the wire
+ * while the DA programs the previous ones, within the DA receive buffer.
+ */
+
+#ifndef ABW_MT3333_HPP
+#define ABW_MT3333_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "abw_serial.hpp"
+
+namespace abw {
+
+namespace mt3333 {
+constexpr uint8_t  brom_sync[4] = {0xA0, 0x0A, 0x50, 0x05};  //!< Answered with their complements
+constexpr uint8_t  send_da      = 0xD7;
+constexpr uint8_t  jump_da      = 0xD5;
+constexpr uint32_t brom_baud    = 115200;
+constexpr uint32_t da_address   = 0x00000000;  //!< SRAM; the DA is linked there, stack at the top of 32 KiB
+
+constexpr uint8_t sync     = 0xC0;
+constexpr uint8_t ack      = 0x5A;
+constexpr uint8_t nack     = 0xA5;
+constexpr uint8_t cont     = 0x69;
+constexpr uint8_t speed    = 0xD2;
+constexpr uint8_t format   = 0xD4;
+constexpr uint8_t write    = 0xD5;
+constexpr uint8_t checksum = 0xD8;
+constexpr uint8_t finish   = 0xD9;
+
+constexpr uint32_t speeds[]   = {921600, 460800, 230400, 115200};  //!< By index of SPEED
+constexpr uint32_t block_size = 0x10000;                           //!< FORMAT granularity
+constexpr uint32_t revert_ms  = 1000;  //!< The DA goes back to 115200 without a sync at a new speed
+}  // namespace mt3333
+
+/*!
+ * \brief Checksum of the DA as the BROM computes it: XOR of little-endian 16-bit words
+ */
+inline uint16_t mt3333_xor16(const uint8_t* data, size_t len)
+{
+    uint16_t value = 0;
+    for (size_t i = 0; i < len; i += 2) {
+        value ^= uint16_t(data[i] | (i + 1 < len ? data[i + 1] << 8 : 0));
+    }
+    return value;
+}
+
+/*!
+ * \brief Sum of bytes modulo 65536, the checksum of DA packets and of CHECKSUM
+ */
+inline uint16_t mt3333_sum16(const uint8_t* data, size_t len, uint16_t value = 0)
+{
+    for (size_t i = 0; i < len; i++) {
+        value = uint16_t(value + data[i]);
+    }
+    return value;
+}
+
+struct mt3333_options {
+    uint32_t max_baud     = 921600;
+    uint32_t min_baud     = 115200;
+    uint32_t packet       = 1024;   //!< WRITE packet length
+    unsigned depth        = 4;      //!< Packets sent and not yet answered, 1 to wait for each CONT
+    uint32_t rx_buffer    = 4096;   //!< DA receive buffer, bounds depth * (packet + 2)
+    uint16_t probe        = 16384;  //!< Bytes of the speed probe, enough to catch a byte error rate of 1e-4
+    uint32_t handshake_ms = 10000;  //!< Wait for the BROM, from power-up
+};
+
+struct mt3333_stats {
+    uint32_t baud       = mt3333::brom_baud;  //!< Speed of the ROM transfer
+    uint32_t flash_id   = 0;                  //!< JEDEC ID, 3 bytes
+    uint32_t flash_size = 0;
+    uint32_t packets    = 0;  //!< Sent, resent ones included
+    uint32_t nacks      = 0;
+    double   brom_s     = 0;  //!< Handshake and DA load
+    double   speed_s    = 0;
+    double   format_s   = 0;
+    double   write_s    = 0;
+    double   verify_s   = 0;
+};
+
+/*!
+ * \brief Host side of the MT3333 download, blocking; errors throw std::runtime_error
+ */
+class mt3333_flasher {
+public:
+    using log_type = std::function<void(const std::string&)>;
+
+    mt3333_flasher(serial_port& port, const mt3333_options& options, log_type log = {})
+        : port_(port), options_(options), log_(log)
+    {
+    }
+
+    const mt3333_stats& stats() const { return stats_; }
+
+    /*!
+     * \brief Whole download: DA, speed, format, write, verify, finish
+     */
+    void flash(const std::vector<uint8_t>& da, const std::vector<uint8_t>& rom, uint32_t address = 0)
+    {
+        auto start = clock_type::now();
+        handshake();
+        load_da(da);
+        stats_.brom_s = lap(start);
+        raise_speed();
+        stats_.speed_s = lap(start);
+        format_flash(address, uint32_t(rom.size()));
+        stats_.format_s = lap(start);
+        write_flash(address, rom);
+        stats_.write_s = lap(start);
+        verify_flash(address, rom);
+        stats_.verify_s = lap(start);
+        command(mt3333::finish);
+        expect(mt3333::ack, 2000, "FINISH");
+    }
+
+    /*!
+     * \brief BROM sync, repeated until the BROM answers or handshake_ms runs out
+     */
+    void handshake()
+    {
+        port_.set_baud(mt3333::brom_baud);
+        port_.flush_input();
+        auto deadline = clock_type::now() + std::chrono::milliseconds(options_.handshake_ms);
+        while (clock_type::now() < deadline) {
+            put(mt3333::brom_sync[0]);
+            int b = get(20);
+            if (b != uint8_t(~mt3333::brom_sync[0])) {
+                continue;
+            }
+            bool ok = true;
+            for (int i = 1; i < 4 && ok; i++) {
+                put(mt3333::brom_sync[i]);
+                ok = get(100) == uint8_t(~mt3333::brom_sync[i]);
+            }
+            if (ok) {
+                return;
+            }
+            idle(50);
+        }
+        throw std::runtime_error("no answer from the MT3333 boot ROM, is it powered up in download mode?");
+    }
+
+    /*!
+     * \brief SEND_DA and JUMP_DA, then the greeting of the DA
+     */
+    void load_da(const std::vector<uint8_t>& da)
+    {
+        brom_byte(mt3333::send_da);
+        brom_word(mt3333::da_address);
+        brom_word(uint32_t(da.size()));
+        brom_word(0);
+        brom_status("SEND_DA");
+        port_.write(da.data(), da.size());
+        uint16_t sum = uint16_t(read_be(2, 5000, "DA checksum"));
+        if (sum != mt3333_xor16(da.data(), da.size())) {
+            throw std::runtime_error("DA corrupted on its way to the boot ROM");
+        }
+        brom_status("SEND_DA");
+
+        brom_byte(mt3333::jump_da);
+        brom_word(mt3333::da_address);
+        brom_status("JUMP_DA");
+
+        expect(mt3333::sync, 2000, "DA start");
+        stats_.flash_id   = read_be(3, 1000, "flash ID");
+        stats_.flash_size = read_be(4, 1000, "flash size");
+        expect(mt3333::ack, 1000, "DA start");
+        note("DA running, flash " + hex(stats_.flash_id, 6) + ", " + std::to_string(stats_.flash_size / 1024) +
+             " KiB");
+    }
+
+    /*!
+     * \brief Fastest speed between min_baud and max_baud whose probe passes
+     */
+    void raise_speed()
+    {
+        for (size_t i = 0; i < sizeof(mt3333::speeds) / sizeof(mt3333::speeds[0]); i++) {
+            uint32_t baud = mt3333::speeds[i];
+            if (baud > options_.max_baud || baud < options_.min_baud || baud == mt3333::brom_baud) {
+                continue;
+            }
+            if (try_speed(uint8_t(i))) {
+                stats_.baud = baud;
+                note(std::to_string(baud) + " baud: probe passed");
+                return;
+            }
+        }
+        stats_.baud = mt3333::brom_baud;
+    }
+
+    void format_flash(uint32_t address, uint32_t len)
+    {
+        command(mt3333::format);
+        put_be(address, 4);
+        put_be(len, 4);
+        uint32_t blocks = (len + mt3333::block_size - 1) / mt3333::block_size;
+        expect(mt3333::ack, int(5000 + blocks * 1000), "FORMAT");
+    }
+
+    /*!
+     * \brief WRITE, pipelined: packets go out while earlier ones are programmed, a NACK resends from there
+     */
+    void write_flash(uint32_t address, const std::vector<uint8_t>& data)
+    {
+        const uint32_t packet = options_.packet;
+        const uint32_t count  = uint32_t((data.size() + packet - 1) / packet);
+        unsigned       depth  = std::max(1u, std::min(options_.depth, options_.rx_buffer / (packet + 2)));
+
+        command(mt3333::write);
+        put_be(address, 4);
+        put_be(uint32_t(data.size()), 4);
+        put_be(packet, 4);
+        expect(mt3333::ack, 2000, "WRITE");
+
+        std::vector<uint8_t> frame;
+        uint32_t             next  = 0;  // Next packet to send
+        uint32_t             acked = 0;  // Packets answered CONT
+        while (acked < count) {
+            while (next < count && next - acked < depth) {
+                size_t   at  = size_t(next) * packet;
+                size_t   len = std::min<size_t>(packet, data.size() - at);
+                uint16_t sum = mt3333_sum16(data.data() + at, len);
+                frame.assign(data.begin() + long(at), data.begin() + long(at + len));
+                frame.push_back(uint8_t(sum >> 8));
+                frame.push_back(uint8_t(sum));
+                port_.write(frame.data(), frame.size());
+                next++;
+                stats_.packets++;
+            }
+            int reply = get(5000);
+            if (reply == mt3333::cont) {
+                acked++;
+            } else if (reply == mt3333::nack) {
+                // The DA drops the packets behind the bad one until the line is idle
+                stats_.nacks++;
+                if (stats_.nacks > 16 + count / 8) {
+                    throw std::runtime_error("WRITE: too many NACKs at " + std::to_string(stats_.baud) +
+                                             " baud, lower the maximum speed");
+                }
+                port_.drain();
+                idle(60);
+                next = acked;
+            } else {
+                throw std::runtime_error(reply < 0 ? "WRITE: no answer to packet " + std::to_string(acked)
+                                                   : "WRITE: unexpected answer " + hex(uint32_t(reply), 2) +
+                                                         " to packet " + std::to_string(acked));
+            }
+        }
+        expect(mt3333::ack, 2000, "WRITE");
+    }
+
+    /*!
+     * \brief CHECKSUM of the flash range against the image
+     */
+    void verify_flash(uint32_t address, const std::vector<uint8_t>& data)
+    {
+        command(mt3333::checksum);
+        put_be(address, 4);
+        put_be(uint32_t(data.size()), 4);
+        uint16_t sum = uint16_t(read_be(2, 10000, "CHECKSUM"));
+        expect(mt3333::ack, 1000, "CHECKSUM");
+        if (sum != mt3333_sum16(data.data(), data.size())) {
+            throw std::runtime_error("flash checksum " + hex(sum, 4) + " instead of " +
+                                     hex(mt3333_sum16(data.data(), data.size()), 4));
+        }
+    }
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    /*!
+     * \brief SPEED at one index; on failure the DA is back at 115200 and answering
+     */
+    bool try_speed(uint8_t index)
+    {
+        const uint32_t baud = mt3333::speeds[index];
+        command(mt3333::speed);
+        put(index);
+        put_be(options_.probe, 2);
+        expect(mt3333::ack, 1000, "SPEED");
+        port_.drain();
+        port_.set_baud(baud);
+
+        bool synced = false;
+        for (int i = 0; i < 25 && !synced; i++) {
+            put(mt3333::sync);
+            synced = get(20) == mt3333::sync;
+        }
+        bool passed = false;
+        if (synced) {
+            std::vector<uint8_t> probe(options_.probe);
+            for (size_t i = 0; i < probe.size(); i++) {
+                probe[i] = uint8_t(i * 7 + (i >> 8));  // Never C0 first, every byte value
+            }
+            port_.write(probe.data(), probe.size());
+            int b;
+            while ((b = get(int(200 + probe.size() * 10000 / baud))) == mt3333::sync) {
+                // Echoes of the syncs still on their way
+            }
+            if (b == mt3333::ack) {
+                int hi = get(100), lo = get(100);
+                passed = hi >= 0 && lo >= 0 && uint16_t(hi << 8 | lo) == mt3333_sum16(probe.data(), probe.size());
+            }
+            put(passed ? mt3333::ack : mt3333::nack);
+        }
+        if (passed) {
+            // The DA reverts unless it got the ACK
+            put(mt3333::sync);
+            if (get(200) == mt3333::sync) {
+                return true;
+            }
+            synced = false;
+        }
+
+        note(std::to_string(baud) + " baud: " + (synced ? "probe failed" : passed ? "lost after the probe" : "no sync"));
+        port_.drain();
+        port_.set_baud(mt3333::brom_baud);
+        if (!synced) {
+            idle(int(mt3333::revert_ms));
+        }
+        // Back at 115200, the DA echoes syncs
+        for (int i = 0; i < 40; i++) {
+            put(mt3333::sync);
+            if (get(50) == mt3333::sync) {
+                idle(30);
+                return false;
+            }
+        }
+        throw std::runtime_error("DA lost after a failed speed change");
+    }
+
+    void command(uint8_t cmd) { put(cmd); }
+
+    void brom_byte(uint8_t b)
+    {
+        put(b);
+        if (get(1000) != b) {
+            throw std::runtime_error("boot ROM did not echo " + hex(b, 2));
+        }
+    }
+
+    void brom_word(uint32_t value)
+    {
+        put_be(value, 4);
+        if (read_be(4, 1000, "echo") != value) {
+            throw std::runtime_error("boot ROM did not echo " + hex(value, 8));
+        }
+    }
+
+    void brom_status(const char* step)
+    {
+        uint32_t status = read_be(2, 2000, step);
+        if (status != 0) {
+            throw std::runtime_error(std::string(step) + ": boot ROM status " + hex(status, 4));
+        }
+    }
+
+    void put(uint8_t b) { port_.write(&b, 1); }
+
+    void put_be(uint32_t value, int bytes)
+    {
+        uint8_t buf[4];
+        for (int i = 0; i < bytes; i++) {
+            buf[i] = uint8_t(value >> (8 * (bytes - 1 - i)));
+        }
+        port_.write(buf, size_t(bytes));
+    }
+
+    /*!
+     * \brief Next byte, -1 after timeout_ms
+     */
+    int get(int timeout_ms)
+    {
+        uint8_t b;
+        return port_.read(&b, 1, timeout_ms) ? b : -1;
+    }
+
+    uint32_t read_be(int bytes, int timeout_ms, const char* what)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; i++) {
+            int b = get(timeout_ms);
+            if (b < 0) {
+                throw std::runtime_error(std::string("timeout on ") + what);
+            }
+            value = value << 8 | uint32_t(b);
+        }
+        return value;
+    }
+
+    void expect(uint8_t want, int timeout_ms, const char* what)
+    {
+        int b = get(timeout_ms);
+        if (b != want) {
+            throw std::runtime_error(std::string(what) + ": " +
+                                     (b < 0 ? std::string("no answer") : "answer " + hex(uint32_t(b), 2)));
+        }
+    }
+
+    /*!
+     * \brief Drop input until the line stays silent for ms
+     */
+    void idle(int ms)
+    {
+        uint8_t buf[256];
+        while (port_.read(buf, sizeof(buf), ms)) {
+        }
+    }
+
+    void note(const std::string& text)
+    {
+        if (log_) {
+            log_(text);
+        }
+    }
+
+    static std::string hex(uint32_t value, int digits)
+    {
+        char text[16];
+        std::snprintf(text, sizeof(text), "0x%0*X", digits, unsigned(value));
+        return text;
+    }
+
+    static double lap(clock_type::time_point& start)
+    {
+        auto   now  = clock_type::now();
+        double secs = std::chrono::duration<double>(now - start).count();
+        start       = now;
+        return secs;
+    }
+
+    serial_port&   port_;
+    mt3333_options options_;
+    log_type       log_;
+    mt3333_stats   stats_;
+};
+
+}  // namespace abw
+
+#endif  // ABW_MT3333_HPP
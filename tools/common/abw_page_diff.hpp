@@ -0,0 +1,152 @@
+/*!
+ * \file      abw_page_diff.hpp
+ *
+ * \brief     Host side of the differential application update through the ABW bootloader
+ *
+ * ABWh lists the CRC-32 of each 4 KiB flash page of the application slot,
+ * up to the last page that is not erased. page_digests() computes the same
+ * list for the image to install, its last page padded with 0xFF as the
+ * erased flash is. make_page_stream() keeps the pages whose digests differ,
+ * or that the board does not have, and frames them as lib/pagediff expects
+ * (see abw_page_stream.h) for ABWd.
+ *
+ * A CRC-32 collision would leave a stale page in place; the bootloader
+ * checks the CRC-32 of the whole image once the stream is applied and
+ * reports the transfer as failed, after which the image goes through ABWu.
+ */
+
+#ifndef ABW_PAGE_DIFF_HPP
+#define ABW_PAGE_DIFF_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "abw_app_image.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+#include "abw_page_stream.h"
+}
+
+namespace abw {
+
+constexpr uint32_t flash_page_size = 4096;  //!< STM32WB flash page
+constexpr uint32_t app_slot_pages  = (app_slot.limit - app_slot.load) / flash_page_size;
+
+/*!
+ * \brief Digest of one flash page, bytes past size read as erased
+ */
+inline uint32_t page_digest(const uint8_t* data, size_t size, uint32_t page_size = flash_page_size)
+{
+    uint32_t crc = abw_crc32_update(ABW_CRC32_INIT, data, uint32_t(std::min<size_t>(size, page_size)));
+    if (size < page_size) {
+        std::vector<uint8_t> erased(page_size - size, 0xFF);
+        crc = abw_crc32_update(crc, erased.data(), uint32_t(erased.size()));
+    }
+    return abw_crc32_final(crc);
+}
+
+/*!
+ * \brief Digests of the pages an image covers, as ABWh reports them once it is in flash
+ */
+inline std::vector<uint32_t> page_digests(const uint8_t* image, size_t size, uint32_t page_size = flash_page_size)
+{
+    std::vector<uint32_t> digests;
+    for (size_t at = 0; at < size; at += page_size) {
+        digests.push_back(page_digest(image + at, size - at, page_size));
+    }
+    return digests;
+}
+
+/*!
+ * \brief Parse the answer to ABWh, echo and prompt included, throws std::runtime_error if malformed
+ */
+inline std::vector<uint32_t> parse_page_digests(const std::string& text, uint32_t page_size = flash_page_size)
+{
+    size_t at = text.find("Pages ");
+    if (at == std::string::npos) {
+        throw std::runtime_error("no page list in the bootloader answer, ABWh not supported");
+    }
+
+    std::istringstream in(text.substr(at + 6));
+    unsigned long      count = 0, size = 0;
+    if (!(in >> count >> size) || size != page_size || count > app_slot_pages) {
+        throw std::runtime_error("unexpected page list header in \"" + text.substr(at, 32) + "\"");
+    }
+
+    std::vector<uint32_t> digests;
+    for (std::string word; digests.size() < count && in >> word;) {
+        if (word.size() != 8 || word.find_first_not_of("0123456789ABCDEFabcdef") != std::string::npos) {
+            throw std::runtime_error("bad page digest \"" + word + "\"");
+        }
+        digests.push_back(uint32_t(std::stoul(word, nullptr, 16)));
+    }
+    if (digests.size() != count) {
+        throw std::runtime_error("page list cut short, " + std::to_string(digests.size()) + " of " +
+                                 std::to_string(count) + " digests");
+    }
+    return digests;
+}
+
+/*!
+ * \brief Counters of a page stream
+ */
+struct page_stream_stats {
+    uint32_t image_pages = 0;  //!< Pages the image covers
+    uint32_t sent        = 0;  //!< Pages in the stream
+    uint32_t stale       = 0;  //!< Pages of the board past the image, erased by the bootloader
+};
+
+/*!
+ * \brief Page stream turning the flash described by resident into image
+ *
+ * resident holds the digests reported by ABWh; pages past its end are
+ * erased. Only pages whose digests differ are sent.
+ */
+inline std::vector<uint8_t> make_page_stream(const uint8_t* image, size_t size, const std::vector<uint32_t>& resident,
+                                             page_stream_stats* stats = nullptr)
+{
+    if (size == 0 || size > size_t(app_slot_pages) * flash_page_size) {
+        throw std::invalid_argument(std::to_string(size) + " bytes do not fit in the application slot");
+    }
+
+    std::vector<uint32_t> digests = page_digests(image, size);
+    const uint32_t        erased  = page_digest(nullptr, 0);
+    const uint32_t        crc     = abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, image, uint32_t(size)));
+    page_stream_stats     st;
+
+    std::vector<uint8_t> out = {'A', 'B', 'W', 'P', ABW_PAGE_STREAM_FORMAT, 12, 0, 0};
+    for (uint32_t v : {uint32_t(size), crc}) {
+        out.insert(out.end(), {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16), uint8_t(v >> 24)});
+    }
+
+    st.image_pages = uint32_t(digests.size());
+    st.stale       = resident.size() > digests.size() ? uint32_t(resident.size() - digests.size()) : 0;
+    for (uint32_t page = 0; page < digests.size(); page++) {
+        uint32_t have = page < resident.size() ? resident[page] : erased;
+        if (have == digests[page]) {
+            continue;
+        }
+        size_t at = size_t(page) * flash_page_size;
+        size_t n  = std::min<size_t>(size - at, flash_page_size);
+        out.insert(out.end(), {uint8_t(page), uint8_t(page >> 8)});
+        out.insert(out.end(), image + at, image + at + n);
+        out.insert(out.end(), flash_page_size - n, 0xFF);
+        st.sent++;
+    }
+    out[6] = uint8_t(st.sent);
+    out[7] = uint8_t(st.sent >> 8);
+
+    if (stats) {
+        *stats = st;
+    }
+    return out;
+}
+
+}  // namespace abw
+
+#endif  // ABW_PAGE_DIFF_HPP
@@ -0,0 +1,124 @@
+/*!
+ * \file      abw_releases.hpp
+ *
+ * \brief     Synthetic firmware releases derived from a base image, for the update benches
+ *
+ * make_releases() gives, from the smallest change to the largest: a few
+ * constants, a bug fix with small inserts and a delete, a feature adding
+ * 8 KiB, a refactor moving blocks, and a fully re-encrypted image. Edits,
+ * inserts and deletes are on word boundaries; an insert or a delete shifts
+ * everything after it, as a relinked image does.
+ */
+
+#ifndef ABW_RELEASES_HPP
+#define ABW_RELEASES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace abw {
+
+/*!
+ * \brief Random edits on whole words, as a relinked image would have
+ */
+struct release_maker {
+    std::mt19937 rng;
+
+    uint32_t below(uint32_t n) { return std::uniform_int_distribution<uint32_t>(0, n - 1)(rng); }
+    uint32_t word_at(size_t size) { return below(uint32_t(size / 4)) * 4; }
+
+    std::vector<uint8_t> random_bytes(size_t n)
+    {
+        std::vector<uint8_t> bytes(n);
+        for (auto& b : bytes) {
+            b = uint8_t(rng());
+        }
+        return bytes;
+    }
+    void replace(std::vector<uint8_t>& img, size_t len)
+    {
+        size_t at = word_at(img.size() - len);
+        auto   r  = random_bytes(len);
+        std::copy(r.begin(), r.end(), img.begin() + at);
+    }
+    void insert(std::vector<uint8_t>& img, size_t len)
+    {
+        auto r = random_bytes(len);
+        img.insert(img.begin() + word_at(img.size()), r.begin(), r.end());
+    }
+    void erase(std::vector<uint8_t>& img, size_t len)
+    {
+        size_t at = word_at(img.size() - len);
+        img.erase(img.begin() + at, img.begin() + at + len);
+    }
+    void move(std::vector<uint8_t>& img, size_t len)
+    {
+        size_t               from = word_at(img.size() - len);
+        std::vector<uint8_t> block(img.begin() + from, img.begin() + from + len);
+        img.erase(img.begin() + from, img.begin() + from + len);
+        img.insert(img.begin() + word_at(img.size()), block.begin(), block.end());
+    }
+    size_t words(uint32_t min, uint32_t max) { return size_t(min + below(max - min + 1)) * 4; }
+};
+
+/*!
+ * \brief A synthetic release and what changed from the base
+ */
+struct release {
+    const char*          name;
+    const char*          what;
+    std::vector<uint8_t> image;
+};
+
+/*!
+ * \brief The releases of the delta and page-diff benches, from the same seed for the same releases
+ */
+inline std::vector<release> make_releases(const std::vector<uint8_t>& base, uint32_t seed)
+{
+    release_maker        m{std::mt19937(seed)};
+    std::vector<release> releases;
+    std::vector<uint8_t> img;
+
+    img = base;
+    for (int i = 0; i < 16; i++) {
+        m.replace(img, 4);
+    }
+    releases.push_back({"constants", "16 words changed", img});
+
+    img = base;
+    for (int i = 0; i < 6; i++) {
+        m.replace(img, m.words(4, 64));
+    }
+    m.insert(img, m.words(16, 128));
+    m.insert(img, m.words(16, 128));
+    m.erase(img, m.words(16, 128));
+    releases.push_back({"bugfix", "6 edits, 2 inserts, 1 delete", img});
+
+    img = base;
+    m.insert(img, 8192);
+    for (int i = 0; i < 32; i++) {
+        m.replace(img, 4);
+    }
+    releases.push_back({"feature", "8 KiB added, 32 words changed", img});
+
+    img = base;
+    for (int i = 0; i < 6; i++) {
+        m.replace(img, 4096);
+    }
+    for (int i = 0; i < 2; i++) {
+        m.move(img, 16384);
+    }
+    for (int i = 0; i < 64; i++) {
+        m.replace(img, m.words(1, 16));
+    }
+    releases.push_back({"refactor", "24 KiB rewritten, 2 blocks moved, 64 edits", img});
+
+    releases.push_back({"reencrypted", "every byte changed", m.random_bytes(base.size())});
+    return releases;
+}
+
+}  // namespace abw
+
+#endif  // ABW_RELEASES_HPP
@@ -0,0 +1,243 @@
+/*!
+ * \file      abw_serial.hpp
+ *
+ * \brief     Raw serial port and pseudo-terminal helpers for the host tools (POSIX)
+ */
+
+#ifndef ABW_SERIAL_HPP
+#define ABW_SERIAL_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace abw {
+
+struct baud_entry {
+    uint32_t baud;
+    speed_t  speed;
+};
+
+constexpr baud_entry baud_table[] = {
+    {1200, B1200},
+    {2400, B2400},
+    {4800, B4800},
+    {9600, B9600},
+    {19200, B19200},
+    {38400, B38400},
+    {57600, B57600},
+    {115200, B115200},
+    {230400, B230400},
+#ifdef B460800
+    {460800, B460800},
+#endif
+#ifdef B921600
+    {921600, B921600},
+#endif
+};
+
+/*!
+ * \brief termios speed of a baud rate, throws std::runtime_error if unsupported
+ */
+inline speed_t baud_speed(uint32_t baud)
+{
+    for (const auto& entry : baud_table) {
+        if (entry.baud == baud) {
+            return entry.speed;
+        }
+    }
+    throw std::runtime_error("unsupported baud rate " + std::to_string(baud));
+}
+
+/*!
+ * \brief Output baud rate currently set on a tty, 0 if unknown
+ */
+inline uint32_t tty_baud(int fd)
+{
+    termios tio;
+    if (::tcgetattr(fd, &tio) < 0) {
+        return 0;
+    }
+    for (const auto& entry : baud_table) {
+        if (entry.speed == ::cfgetospeed(&tio)) {
+            return entry.baud;
+        }
+    }
+    return 0;
+}
+
+/*!
+ * \brief Serial line in raw 8N1 mode, owns its file descriptor
+ */
+class serial_port {
+public:
+    serial_port() = default;
+
+    /*!
+     * \brief Open a tty, throws std::runtime_error on failure
+     */
+    serial_port(const std::string& path, uint32_t baud)
+    {
+        fd_ = ::open(path.c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC);
+        if (fd_ < 0) {
+            throw std::runtime_error("cannot open " + path + ": " + std::strerror(errno));
+        }
+        set_baud(baud);
+    }
+
+    /*!
+     * \brief Take ownership of an open tty, e.g. one side of a pty pair
+     */
+    serial_port(int fd, uint32_t baud) : fd_(fd) { set_baud(baud); }
+
+    serial_port(const serial_port&) = delete;
+    serial_port& operator=(const serial_port&) = delete;
+    serial_port(serial_port&& other) noexcept : fd_(other.fd_), baud_(other.baud_) { other.fd_ = -1; }
+    serial_port& operator=(serial_port&& other) noexcept
+    {
+        std::swap(fd_, other.fd_);
+        std::swap(baud_, other.baud_);
+        return *this;
+    }
+    ~serial_port()
+    {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    int      fd() const { return fd_; }
+    uint32_t baud() const { return baud_; }
+
+    /*!
+     * \brief Switch to raw 8N1 at the given rate, once pending output is sent
+     */
+    void set_baud(uint32_t baud)
+    {
+        termios tio;
+        if (::tcgetattr(fd_, &tio) < 0) {
+            throw std::runtime_error(std::string("tcgetattr: ") + std::strerror(errno));
+        }
+        ::cfmakeraw(&tio);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+        tio.c_cc[VMIN]  = 0;
+        tio.c_cc[VTIME] = 0;
+        ::cfsetispeed(&tio, baud_speed(baud));
+        ::cfsetospeed(&tio, baud_speed(baud));
+        if (::tcsetattr(fd_, TCSADRAIN, &tio) < 0) {
+            throw std::runtime_error(std::string("tcsetattr: ") + std::strerror(errno));
+        }
+        baud_ = baud;
+    }
+
+    /*!
+     * \brief Write everything, throws std::runtime_error on failure
+     */
+    void write(const void* data, size_t len)
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        while (len) {
+            ssize_t n = ::write(fd_, p, len);
+            if (n < 0 && errno == EAGAIN) {
+                wait(POLLOUT, -1);
+                continue;
+            }
+            if (n < 0 && errno != EINTR) {
+                throw std::runtime_error(std::string("serial write: ") + std::strerror(errno));
+            }
+            if (n > 0) {
+                p += n;
+                len -= size_t(n);
+            }
+        }
+    }
+
+    void write(const std::string& text) { write(text.data(), text.size()); }
+
+    /*!
+     * \brief Read what is available, waiting up to timeout_ms for the first byte
+     *
+     * \returns Number of bytes read, 0 on timeout
+     */
+    size_t read(void* data, size_t len, int timeout_ms)
+    {
+        if (!wait(POLLIN, timeout_ms)) {
+            return 0;
+        }
+        ssize_t n = ::read(fd_, data, len);
+        if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+            return 0;
+        }
+        if (n < 0) {
+            throw std::runtime_error(std::string("serial read: ") + std::strerror(errno));
+        }
+        return size_t(n);
+    }
+
+    /*!
+     * \brief Wait until everything written has left the port
+     */
+    void drain() { ::tcdrain(fd_); }
+
+    /*!
+     * \brief Drop unread input
+     */
+    void flush_input() { ::tcflush(fd_, TCIFLUSH); }
+
+private:
+    bool wait(short events, int timeout_ms)
+    {
+        pollfd pfd = {fd_, events, 0};
+        int    n;
+        do {
+            n = ::poll(&pfd, 1, timeout_ms);
+        } while (n < 0 && errno == EINTR);
+        if (n < 0) {
+            throw std::runtime_error(std::string("poll: ") + std::strerror(errno));
+        }
+        if (n && (pfd.revents & (POLLERR | POLLNVAL))) {
+            throw std::runtime_error("serial port closed");
+        }
+        return n > 0;
+    }
+
+    int      fd_   = -1;
+    uint32_t baud_ = 0;
+};
+
+/*!
+ * \brief Pseudo-terminal pair standing in for a board on a serial line
+ *
+ * The tool under test opens the slave path (or uses the slave port); the
+ * stand-in for the board uses the master side.
+ */
+struct pty_pair {
+    serial_port master;
+    serial_port slave;
+    std::string slave_path;
+
+    explicit pty_pair(uint32_t baud)
+    {
+        int fd = ::posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+        if (fd < 0 || ::grantpt(fd) < 0 || ::unlockpt(fd) < 0) {
+            throw std::runtime_error(std::string("cannot create a pty: ") + std::strerror(errno));
+        }
+        slave_path = ::ptsname(fd);
+        master     = serial_port(fd, baud);
+        slave      = serial_port(slave_path, baud);
+    }
+};
+
+}  // namespace abw
+
+#endif  // ABW_SERIAL_HPP
@@ -0,0 +1,451 @@
+/*!
+ * \file      abw_xmodem.hpp
+ *
+ * \brief     XMODEM / XMODEM-1K sender and receiver as event-driven state machines
+ *
+ * Neither side does I/O. The caller writes output(), then feeds the bytes
+ * it receives to on_input(), or calls on_timeout() when nothing arrived
+ * within timeout_ms(). The same objects therefore run behind a blocking
+ * loop (xmodem_send) or an event loop serving several ports.
+ *
+ * The sender follows the receiver: 'C' selects CRC-16 and 1024-byte blocks,
+ * NAK selects the original 128-byte blocks with an additive checksum. If a
+ * receiver rejects 1024-byte blocks, the sender falls back to 128-byte
+ * blocks for the rest of the transfer. The next block is framed while the
+ * current one is on the wire (prefetch()), so an ACK is answered at once.
+ */
+
+#ifndef ABW_XMODEM_HPP
+#define ABW_XMODEM_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "abw_serial.hpp"
+
+extern "C" {
+#include "abw_crc16.h"
+}
+
+namespace abw {
+
+namespace xmodem {
+constexpr uint8_t  soh       = 0x01;  //!< 128-byte block
+constexpr uint8_t  stx       = 0x02;  //!< 1024-byte block
+constexpr uint8_t  eot       = 0x04;
+constexpr uint8_t  ack       = 0x06;
+constexpr uint8_t  nak       = 0x15;
+constexpr uint8_t  can       = 0x18;
+constexpr uint8_t  crc_start = 'C';
+constexpr uint8_t  pad       = 0x1A;  //!< Fill of the last block
+constexpr uint32_t block_128 = 128;
+constexpr uint32_t block_1k  = 1024;
+constexpr uint32_t frame_max = 3 + block_1k + 2;
+}  // namespace xmodem
+
+/*!
+ * \brief Build one XMODEM frame, shorter data is padded
+ *
+ * \returns Frame size
+ */
+inline size_t xmodem_frame(uint8_t* frame, uint8_t number, const uint8_t* data, size_t len, uint32_t block_size,
+                           bool crc)
+{
+    frame[0] = block_size == xmodem::block_1k ? xmodem::stx : xmodem::soh;
+    frame[1] = number;
+    frame[2] = uint8_t(~number);
+    std::memcpy(frame + 3, data, len);
+    std::memset(frame + 3 + len, xmodem::pad, block_size - len);
+
+    if (crc) {
+        uint16_t value        = abw_crc16_update(ABW_CRC16_INIT, frame + 3, block_size);
+        frame[3 + block_size] = uint8_t(value >> 8);
+        frame[4 + block_size] = uint8_t(value);
+        return 5 + block_size;
+    }
+    uint8_t sum = 0;
+    for (uint32_t i = 0; i < block_size; i++) {
+        sum = uint8_t(sum + frame[3 + i]);
+    }
+    frame[3 + block_size] = sum;
+    return 4 + block_size;
+}
+
+/*!
+ * \brief Sender settings
+ */
+struct xmodem_options {
+    bool     allow_1k         = true;        //!< Use 1024-byte blocks when the receiver asks for CRC
+    uint32_t start_timeout_ms = 60000;       //!< Wait for the receiver to start (the ABW bootloader gives up after 60 s)
+    uint32_t ack_timeout_ms   = 10000;       //!< Wait for the answer to a block
+    uint32_t max_retries      = 10;          //!< Consecutive NAKs or timeouts on one block
+    uint32_t max_noise        = UINT32_MAX;  //!< Stray bytes accepted before the receiver starts
+};
+
+/*!
+ * \brief Counters of a transfer
+ */
+struct xmodem_stats {
+    bool     started    = false;  //!< The receiver answered the handshake
+    bool     crc        = false;  //!< CRC-16 mode negotiated
+    bool     fallback   = false;  //!< 1024-byte blocks refused, continued with 128-byte blocks
+    uint32_t blocks     = 0;      //!< Blocks acknowledged
+    uint32_t blocks_1k  = 0;
+    uint32_t naks       = 0;
+    uint32_t timeouts   = 0;
+    uint32_t noise      = 0;  //!< Stray bytes received before the receiver started
+    uint64_t wire_bytes = 0;  //!< Bytes sent, including retransmissions
+};
+
+class xmodem_sender {
+public:
+    enum class state { negotiating, sending, ending, done, failed };
+
+    xmodem_sender(const uint8_t* data, size_t size, const xmodem_options& options = {})
+        : data_(data), size_(size), options_(options)
+    {
+    }
+
+    state               get_state() const { return state_; }
+    bool                finished() const { return state_ == state::done || state_ == state::failed; }
+    const xmodem_stats& stats() const { return stats_; }
+    size_t              acknowledged() const { return acked_; }
+
+    /*!
+     * \brief Bytes to write to the line now, empty while waiting for the receiver
+     */
+    const uint8_t* output() const { return out_; }
+    size_t         output_size() const { return out_len_; }
+    void           output_done()
+    {
+        stats_.wire_bytes += out_len_;
+        out_len_ = 0;
+    }
+
+    int timeout_ms() const
+    {
+        return int(state_ == state::negotiating ? options_.start_timeout_ms : options_.ack_timeout_ms);
+    }
+
+    /*!
+     * \brief Frame the next block ahead of its ACK, call while waiting for the receiver
+     */
+    void prefetch()
+    {
+        size_t offset = acked_ + cur_block_size_;
+        if (state_ == state::sending && !next_ready_ && offset < size_) {
+            build(offset, uint8_t(number_ + 1), frames_[!cur_], next_len_, next_block_size_);
+            next_ready_ = true;
+        }
+    }
+
+    void on_input(const uint8_t* p, size_t n)
+    {
+        for (size_t i = 0; i < n && !finished(); i++) {
+            on_byte(p[i]);
+        }
+    }
+
+    void on_timeout()
+    {
+        if (state_ == state::negotiating) {
+            fail();
+            return;
+        }
+        stats_.timeouts++;
+        retry();
+    }
+
+    /*!
+     * \brief Abort the transfer, the receiver is told with CAN CAN
+     */
+    void cancel() { fail(); }
+
+private:
+    void on_byte(uint8_t c)
+    {
+        if (c == xmodem::can) {
+            // Two CAN in a row cancel, a single one may be line noise
+            if (last_ == xmodem::can) {
+                state_ = state::failed;
+            }
+            last_ = c;
+            return;
+        }
+        last_ = c;
+
+        switch (state_) {
+        case state::negotiating:
+            if (c == xmodem::crc_start || c == xmodem::nak) {
+                stats_.started = true;
+                stats_.crc     = c == xmodem::crc_start;
+                state_         = state::sending;
+                start_block(0);
+            } else if (++stats_.noise > options_.max_noise) {
+                // Garbage instead of a handshake: most likely a baud rate mismatch
+                fail();
+            }
+            break;
+        case state::sending:
+            if (c == xmodem::ack) {
+                acked_ += cur_len_ < (size_ - acked_) ? cur_len_ : (size_ - acked_);
+                stats_.blocks++;
+                stats_.blocks_1k += cur_block_size_ == xmodem::block_1k;
+                number_++;
+                retries_ = 0;
+                if (acked_ >= size_) {
+                    state_ = state::ending;
+                    send(&xmodem::eot, 1);
+                } else {
+                    next_block();
+                }
+            } else if (c == xmodem::nak) {
+                stats_.naks++;
+                if (cur_block_size_ == xmodem::block_1k && retries_ >= 1) {
+                    // Twice refused: assume a receiver without XMODEM-1K
+                    one_k_          = false;
+                    stats_.fallback = true;
+                    next_ready_     = false;
+                    retries_        = 0;
+                    start_block(acked_);
+                    return;
+                }
+                retry();
+            }
+            break;
+        case state::ending:
+            if (c == xmodem::ack) {
+                state_ = state::done;
+            } else if (c == xmodem::nak) {
+                retry();
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    size_t block_size_for(size_t offset) const
+    {
+        // A short tail goes in 128-byte blocks rather than a mostly padded 1K block
+        return one_k_ && stats_.crc && (size_ - offset) > 7 * xmodem::block_128 ? xmodem::block_1k
+                                                                                 : xmodem::block_128;
+    }
+
+    void build(size_t offset, uint8_t number, uint8_t* frame, size_t& len, uint32_t& block_size)
+    {
+        block_size = uint32_t(block_size_for(offset));
+        size_t n   = size_ - offset < block_size ? size_ - offset : block_size;
+        len        = xmodem_frame(frame, number, data_ + offset, n, block_size, stats_.crc);
+    }
+
+    void start_block(size_t offset)
+    {
+        one_k_ = one_k_ && options_.allow_1k;
+        build(offset, number_, frames_[cur_], frame_len_, cur_block_size_);
+        cur_len_ = cur_block_size_;
+        send(frames_[cur_], frame_len_);
+    }
+
+    void next_block()
+    {
+        if (!next_ready_) {
+            build(acked_, number_, frames_[!cur_], next_len_, next_block_size_);
+        }
+        cur_            = !cur_;
+        frame_len_      = next_len_;
+        cur_block_size_ = next_block_size_;
+        cur_len_        = cur_block_size_;
+        next_ready_     = false;
+        send(frames_[cur_], frame_len_);
+    }
+
+    void retry()
+    {
+        if (++retries_ > options_.max_retries) {
+            fail();
+            return;
+        }
+        if (state_ == state::ending) {
+            send(&xmodem::eot, 1);
+        } else {
+            send(frames_[cur_], frame_len_);
+        }
+    }
+
+    void send(const uint8_t* p, size_t n)
+    {
+        out_     = p;
+        out_len_ = n;
+    }
+
+    void fail()
+    {
+        static const uint8_t cancel[] = {xmodem::can, xmodem::can, xmodem::can};
+        state_                        = state::failed;
+        send(cancel, sizeof(cancel));
+    }
+
+    const uint8_t* data_;
+    size_t         size_;
+    xmodem_options options_;
+    xmodem_stats   stats_;
+    state          state_           = state::negotiating;
+    bool           one_k_           = true;
+    uint8_t        number_          = 1;
+    uint8_t        last_            = 0;
+    uint32_t       retries_         = 0;
+    size_t         acked_           = 0;
+    unsigned       cur_             = 0;
+    size_t         cur_len_         = 0;
+    uint32_t       cur_block_size_  = 0;
+    size_t         frame_len_       = 0;
+    bool           next_ready_      = false;
+    size_t         next_len_        = 0;
+    uint32_t       next_block_size_ = 0;
+    const uint8_t* out_             = nullptr;
+    size_t         out_len_         = 0;
+    uint8_t        frames_[2][xmodem::frame_max];
+};
+
+/*!
+ * \brief XMODEM receiver, the board side of loopback benches and stand-ins
+ */
+class xmodem_receiver {
+public:
+    /*!
+     * \param [in] crc      Ask for CRC-16 ('C') rather than checksums (NAK)
+     * \param [in] allow_1k Accept 1024-byte blocks, otherwise NAK them
+     */
+    explicit xmodem_receiver(bool crc = true, bool allow_1k = true) : crc_(crc), allow_1k_(allow_1k) {}
+
+    bool                        done() const { return done_; }
+    bool                        failed() const { return failed_; }
+    const std::vector<uint8_t>& data() const { return data_; }
+    uint32_t                    naks() const { return naks_; }
+
+    /*!
+     * \brief Byte to send to start or to poke a silent sender
+     */
+    uint8_t poll() const { return started_ ? xmodem::nak : (crc_ ? xmodem::crc_start : xmodem::nak); }
+
+    /*!
+     * \brief Feed received bytes
+     *
+     * \returns Answer to send (ACK, NAK or CAN), 0 when nothing is due yet
+     */
+    uint8_t on_input(const uint8_t* p, size_t n, size_t& used)
+    {
+        used = 0;
+        while (used < n) {
+            uint8_t c = p[used++];
+            if (frame_.empty()) {
+                if (c == xmodem::eot) {
+                    done_ = true;
+                    return xmodem::ack;
+                }
+                if (c == xmodem::can) {
+                    failed_ = true;
+                    return 0;
+                }
+                if (c != xmodem::soh && c != xmodem::stx) {
+                    continue;  // Line noise between frames
+                }
+                started_ = true;
+            }
+            frame_.push_back(c);
+            if (frame_.size() == frame_size()) {
+                return check();
+            }
+        }
+        return 0;
+    }
+
+private:
+    size_t frame_size() const
+    {
+        return 3 + (frame_[0] == xmodem::stx ? xmodem::block_1k : xmodem::block_128) + (crc_ ? 2 : 1);
+    }
+
+    uint8_t check()
+    {
+        std::vector<uint8_t> frame;
+        frame.swap(frame_);
+
+        uint32_t block_size = frame[0] == xmodem::stx ? xmodem::block_1k : xmodem::block_128;
+        uint8_t  expected[xmodem::frame_max];
+        xmodem_frame(expected, frame[1], frame.data() + 3, block_size, block_size, crc_);
+
+        if ((frame[0] == xmodem::stx && !allow_1k_) || uint8_t(frame[1] ^ frame[2]) != 0xFF ||
+            std::memcmp(expected, frame.data(), frame.size())) {
+            naks_++;
+            return xmodem::nak;
+        }
+        if (frame[1] == uint8_t(number_ - 1)) {
+            return xmodem::ack;  // Our ACK was lost, the sender repeats
+        }
+        if (frame[1] != number_) {
+            failed_ = true;
+            return xmodem::can;
+        }
+        number_++;
+        data_.insert(data_.end(), frame.begin() + 3, frame.begin() + 3 + block_size);
+        return xmodem::ack;
+    }
+
+    bool                 crc_;
+    bool                 allow_1k_;
+    bool                 started_ = false;
+    bool                 done_    = false;
+    bool                 failed_  = false;
+    uint8_t              number_  = 1;
+    uint32_t             naks_    = 0;
+    std::vector<uint8_t> frame_;
+    std::vector<uint8_t> data_;
+};
+
+/*!
+ * \brief Run a sender to completion on a serial port
+ *
+ * \param [in] progress Called with the acknowledged byte count after each answer or timeout
+ *
+ * \returns true when the receiver acknowledged the end of the transfer
+ */
+template <typename Progress>
+bool xmodem_send(serial_port& port, xmodem_sender& sender, Progress progress)
+{
+    uint8_t buf[64];
+
+    while (true) {
+        if (sender.output_size()) {
+            port.write(sender.output(), sender.output_size());
+            sender.output_done();
+        }
+        if (sender.finished()) {
+            break;
+        }
+        sender.prefetch();
+
+        // Byte by byte once EOT is out, to leave what follows the last ACK on the line
+        size_t n = port.read(buf, sender.get_state() == xmodem_sender::state::ending ? 1 : sizeof(buf),
+                             sender.timeout_ms());
+        if (n) {
+            sender.on_input(buf, n);
+        } else {
+            sender.on_timeout();
+        }
+        progress(sender.acknowledged());
+    }
+    port.drain();
+    return sender.get_state() == xmodem_sender::state::done;
+}
+
+inline bool xmodem_send(serial_port& port, xmodem_sender& sender)
+{
+    return xmodem_send(port, sender, [](size_t) {});
+}
+
+}  // namespace abw
+
+#endif  // ABW_XMODEM_HPP
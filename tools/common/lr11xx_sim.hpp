@@ -0,0 +1,422 @@
+/*!
+ * \file      lr11xx_sim.hpp
+ *
+ * \brief     Simulated LR11xx behind the update engine transport, on a virtual clock
+ *
+ * The model implements the LR11xx bootloader command set used for updates:
+ * reset into the bootloader, GetVersion, EraseFlash, WriteFlashEncrypted and
+ * Reboot. It advances a virtual clock for SPI transfers, BUSY phases and
+ * BUSY polls, so update timings can be measured on a host without an EVB.
+ *
+ * The flash content is compared with the reference image on reboot: only an
+ * exact copy starts, and GetVersion then reports the reference version.
+ * Anything else leaves the chip in bootloader mode, as the real bootloader
+ * does with an incomplete or unauthentic image.
+ *
+ * Faults can be injected to exercise the error paths of the engine: BUSY
+ * jitter, BUSY stuck high, corrupted chunks and spontaneous resets.
+ *
+ * A power cut can be scheduled at a virtual time: the chip and the MCU stop
+ * there, the chunk being programmed is lost, and nothing answers until
+ * power_on(). lr11xx_sim_flash_area models the MCU flash area holding the
+ * update checkpoints on the same clock, so a cut can tear its writes too.
+ */
+
+#ifndef LR11XX_SIM_HPP
+#define LR11XX_SIM_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "lr11xx_checkpoint_log.hpp"
+#include "lr11xx_update_engine.hpp"
+
+namespace abw {
+
+/*!
+ * \brief Timing model, in microseconds unless stated otherwise
+ */
+struct lr11xx_sim_timing {
+    uint32_t spi_hz     = 8000000;  //!< SPI clock
+    uint32_t poll_us    = 2;        //!< Cost of one BUSY poll
+    uint32_t command_us = 20;       //!< BUSY after a plain command
+    uint32_t write_us   = 1500;     //!< BUSY after an encrypted 64-word write
+    uint32_t erase_us   = 600000;   //!< BUSY after a flash erase
+    uint32_t boot_us    = 30000;    //!< BUSY after a reset or reboot
+};
+
+/*!
+ * \brief Fault injection, probabilities are per command
+ */
+struct lr11xx_sim_faults {
+    uint32_t busy_jitter_us = 0;  //!< Random extra BUSY time, up to this value
+    double   stuck_busy     = 0;  //!< BUSY stays high until the next reset
+    double   corrupt_chunk  = 0;  //!< A bit of a written chunk is flipped on the way
+    double   reset          = 0;  //!< The chip resets, losing the chunk being written
+};
+
+/*!
+ * \brief Counters of the simulated device
+ */
+struct lr11xx_sim_counters {
+    uint32_t commands   = 0;
+    uint32_t chunks     = 0;
+    uint32_t erases     = 0;
+    uint32_t rejected   = 0;  //!< Commands refused (while BUSY, wrong mode, bad frame)
+    uint32_t corrupted  = 0;
+    uint32_t resets     = 0;  //!< Spontaneous resets
+    uint32_t stuck      = 0;
+    uint32_t power_cuts = 0;
+    uint64_t polls      = 0;
+};
+
+class lr11xx_sim : public lr11xx::update_transport {
+public:
+    static constexpr uint16_t bootloader_version = 0x6500;
+    static constexpr uint8_t  hardware_version   = 0x22;
+    static constexpr uint8_t  transceiver_type   = 0x01;
+
+    /*!
+     * \param [in] image           Reference image, host-order words
+     * \param [in] words           Size of the image
+     * \param [in] version         Version reported once the reference image runs
+     * \param [in] initial_version Version running before the update, 0 for an empty chip
+     */
+    lr11xx_sim(const uint32_t* image, uint32_t words, uint16_t version, const lr11xx_sim_timing& timing = {},
+               uint16_t initial_version = 0)
+        : image_(image, image + words), version_(version), app_version_(initial_version), timing_(timing)
+    {
+        bootloader_ = app_version_ == 0;
+    }
+
+    void inject(const lr11xx_sim_faults& faults, uint32_t seed)
+    {
+        faults_ = faults;
+        rng_.seed(seed);
+    }
+
+    /*!
+     * \brief Cut the power once the virtual clock reaches us
+     */
+    void cut_power_at(uint64_t us) { cut_at_ = us; }
+
+    /*!
+     * \brief Power up after a cut: the chip boots whatever is in its flash
+     */
+    void power_on()
+    {
+        off_        = false;
+        cut_at_     = std::numeric_limits<uint64_t>::max();
+        bootloader_ = app_version_ == 0;
+        writing_    = false;
+        busy_until_ = now_ + timing_.boot_us;
+    }
+
+    /*!
+     * \brief False from the scheduled cut until power_on()
+     */
+    bool powered()
+    {
+        if (!off_ && now_ >= cut_at_) {
+            power_off();
+        }
+        return !off_;
+    }
+
+    bool write(const uint8_t* cmd, size_t cmd_len, const uint8_t* data, size_t data_len) override
+    {
+        if (!powered()) {
+            return false;
+        }
+        if (busy_now() || cmd_len < 2) {
+            return reject();
+        }
+        frame_.assign(cmd, cmd + cmd_len);
+        if (data_len) {
+            frame_.insert(frame_.end(), data, data + data_len);
+        }
+        spi(frame_.size());
+        counters_.commands++;
+
+        if (chance(faults_.reset)) {
+            spontaneous_reset();
+            return true;  // The frame went out, the chip just did not process it
+        }
+
+        uint16_t opcode = uint16_t(frame_[0] << 8 | frame_[1]);
+        bool     ok;
+        switch (opcode) {
+        case lr11xx::bootloader::get_version_oc:
+            response_ = {hardware_version, bootloader_ ? lr11xx::bootloader::version_type : transceiver_type,
+                         uint8_t(running_version() >> 8), uint8_t(running_version())};
+            ok        = busy_for(timing_.command_us);
+            break;
+        case lr11xx::bootloader::erase_flash_oc:
+            ok = bootloader_ && erase();
+            break;
+        case lr11xx::bootloader::write_flash_encrypted_oc:
+            ok = bootloader_ && write_flash();
+            break;
+        case lr11xx::bootloader::reboot_oc:
+            ok = (frame_.size() == 3) && reboot(frame_[2] != 0);
+            break;
+        default:
+            ok = false;
+            break;
+        }
+        return ok ? true : reject();
+    }
+
+    bool read(uint8_t* rsp, size_t rsp_len) override
+    {
+        if (!powered()) {
+            return false;
+        }
+        if (busy_now() || rsp_len > response_.size()) {
+            return reject();
+        }
+        spi(rsp_len + 1);  // Status byte first
+        std::memcpy(rsp, response_.data(), rsp_len);
+        return true;
+    }
+
+    bool busy() override
+    {
+        now_ += timing_.poll_us;
+        counters_.polls++;
+        return powered() && busy_now();
+    }
+
+    bool enter_bootloader() override
+    {
+        if (!powered()) {
+            return false;
+        }
+        bootloader_ = true;
+        writing_    = false;
+        busy_until_ = now_ + timing_.boot_us;
+        return true;
+    }
+
+    uint32_t now_us() override { return uint32_t(now_); }
+
+    /*!
+     * \brief Let time pass, e.g. to account for MCU processing
+     */
+    void advance(uint32_t us) { now_ += us; }
+
+    bool                       in_bootloader() const { return bootloader_; }
+    uint16_t                   running_version() const { return bootloader_ ? bootloader_version : app_version_; }
+    const lr11xx_sim_counters& counters() const { return counters_; }
+
+private:
+    bool busy_now() const { return now_ < busy_until_; }
+    void spi(size_t bytes) { now_ += (uint64_t(bytes) * 8 * 1000000 + timing_.spi_hz - 1) / timing_.spi_hz; }
+
+    bool chance(double p) { return p > 0 && std::uniform_real_distribution<double>(0, 1)(rng_) < p; }
+
+    bool reject()
+    {
+        counters_.rejected++;
+        return false;
+    }
+
+    bool busy_for(uint32_t us)
+    {
+        if (chance(faults_.stuck_busy)) {
+            counters_.stuck++;
+            busy_until_ = std::numeric_limits<uint64_t>::max();
+            return true;
+        }
+        if (faults_.busy_jitter_us) {
+            us += std::uniform_int_distribution<uint32_t>(0, faults_.busy_jitter_us)(rng_);
+        }
+        busy_until_ = now_ + us;
+        return true;
+    }
+
+    bool erase()
+    {
+        flash_.assign(image_.size(), 0xFFFFFFFF);
+        counters_.erases++;
+        app_version_ = 0;
+        writing_     = false;
+        return busy_for(timing_.erase_us);
+    }
+
+    bool write_flash()
+    {
+        if (frame_.size() < 6 || ((frame_.size() - 6) % 4) ||
+            (frame_.size() - 6) > lr11xx::bootloader::chunk_words * 4) {
+            return false;
+        }
+        uint32_t offset = uint32_t(frame_[2]) << 24 | uint32_t(frame_[3]) << 16 | uint32_t(frame_[4]) << 8 | frame_[5];
+        uint32_t count  = uint32_t(frame_.size() - 6) / 4;
+        if ((offset % 4) || flash_.empty() || (offset / 4 + count) > flash_.size()) {
+            return false;
+        }
+        if (chance(faults_.corrupt_chunk)) {
+            counters_.corrupted++;
+            frame_[6 + std::uniform_int_distribution<size_t>(0, count * 4 - 1)(rng_)] ^= 0x01;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            const uint8_t* b       = &frame_[6 + i * 4];
+            flash_[offset / 4 + i] = uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3];
+        }
+        writing_       = true;
+        write_offset_  = offset / 4;
+        write_count_   = count;
+        counters_.chunks++;
+        return busy_for(timing_.write_us);
+    }
+
+    bool reboot(bool stay_in_bootloader)
+    {
+        // The bootloader only starts a complete, authentic image
+        if (!flash_.empty() && flash_ == image_) {
+            app_version_ = version_;
+        }
+        bootloader_ = stay_in_bootloader || app_version_ == 0;
+        writing_    = false;
+        return busy_for(timing_.boot_us);
+    }
+
+    void power_off()
+    {
+        counters_.power_cuts++;
+        if (writing_ && cut_at_ < busy_until_) {
+            // The chunk being programmed is lost
+            for (uint32_t i = 0; i < write_count_; i++) {
+                flash_[write_offset_ + i] = 0xFFFFFFFF;
+            }
+        }
+        writing_ = false;
+        off_     = true;
+    }
+
+    void spontaneous_reset()
+    {
+        counters_.resets++;
+        if (writing_ && busy_now()) {
+            // The chunk being programmed is lost
+            for (uint32_t i = 0; i < write_count_; i++) {
+                flash_[write_offset_ + i] = 0xFFFFFFFF;
+            }
+        }
+        writing_    = false;
+        bootloader_ = app_version_ == 0;
+        busy_until_ = now_ + timing_.boot_us;
+    }
+
+    std::vector<uint32_t> image_;
+    std::vector<uint32_t> flash_;
+    std::vector<uint8_t>  frame_;
+    std::vector<uint8_t>  response_;
+    uint16_t              version_;
+    uint16_t              app_version_;  // Version of a valid application in flash, 0 if none
+    bool                  bootloader_   = true;
+    bool                  writing_      = false;
+    bool                  off_          = false;
+    uint32_t              write_offset_ = 0;
+    uint32_t              write_count_  = 0;
+    uint64_t              now_          = 0;
+    uint64_t              busy_until_   = 0;
+    uint64_t              cut_at_       = std::numeric_limits<uint64_t>::max();
+    lr11xx_sim_timing     timing_;
+    lr11xx_sim_faults     faults_;
+    lr11xx_sim_counters   counters_;
+    std::mt19937          rng_;
+};
+
+/*!
+ * \brief STM32WB flash area on the clock of an lr11xx_sim, torn by its power cuts
+ *
+ * Programming takes 82 us per double word and the erase 22 ms, as for a 4 KiB
+ * STM32WB page. A cut during a program leaves the double word in progress
+ * with random bits; a cut during the erase leaves random double words not
+ * erased. Programming bytes that are not erased fails, as on the STM32.
+ */
+class lr11xx_sim_flash_area : public lr11xx::flash_area {
+public:
+    static constexpr uint32_t double_word_us = 82;
+    static constexpr uint32_t erase_us       = 22000;
+
+    lr11xx_sim_flash_area(lr11xx_sim& sim, uint32_t size, uint32_t seed = 1) : sim_(sim), bytes_(size, 0xFF)
+    {
+        rng_.seed(seed);
+    }
+
+    uint32_t size() override { return uint32_t(bytes_.size()); }
+
+    bool read(uint32_t offset, uint8_t* dst, uint32_t len) override
+    {
+        if (!sim_.powered() || offset + len > bytes_.size()) {
+            return false;
+        }
+        std::memcpy(dst, &bytes_[offset], len);
+        return true;
+    }
+
+    bool program(uint32_t offset, const uint8_t* src, uint32_t len) override
+    {
+        if (!sim_.powered() || (offset % 8) || (len % 8) || offset + len > bytes_.size()) {
+            return false;
+        }
+        for (uint32_t at = offset; at < offset + len; at += 8) {
+            for (uint32_t i = 0; i < 8; i++) {
+                if (bytes_[at + i] != 0xFF) {
+                    return false;
+                }
+            }
+            sim_.advance(double_word_us);
+            if (!sim_.powered()) {
+                garble(at);
+                return false;
+            }
+            std::memcpy(&bytes_[at], src + (at - offset), 8);
+        }
+        programs_++;
+        return true;
+    }
+
+    bool erase() override
+    {
+        if (!sim_.powered()) {
+            return false;
+        }
+        sim_.advance(erase_us);
+        for (uint32_t at = 0; at < bytes_.size(); at += 8) {
+            if (sim_.powered() || (rng_() & 1)) {
+                std::memset(&bytes_[at], 0xFF, 8);
+            } else {
+                garble(at);
+            }
+        }
+        erases_++;
+        return sim_.powered();
+    }
+
+    uint32_t programs() const { return programs_; }
+    uint32_t erases() const { return erases_; }
+
+private:
+    void garble(uint32_t at)
+    {
+        for (uint32_t i = 0; i < 8; i++) {
+            bytes_[at + i] = uint8_t(rng_());
+        }
+    }
+
+    lr11xx_sim&          sim_;
+    std::vector<uint8_t> bytes_;
+    std::mt19937         rng_;
+    uint32_t             programs_ = 0;
+    uint32_t             erases_   = 0;
+};
+
+}  // namespace abw
+
+#endif  // LR11XX_SIM_HPP
@@ -0,0 +1,868 @@
+/*!
+ * \file      mfg_cli_sim.hpp
+ *
+ * \brief     Stand-in for a board running the MFG firmware, on the master side of a pty
+ *
+ * The model serves the CLI at 57600 baud (cli_baud): login, "lr11xx
+ * firmware version" and "lr11xx firmware update bridge <if> <speed>"
+ * ("lr1110" is accepted as well), with the output format of the MFG
+ * firmware. The bridge command prints the LR11xx bootloader version, moves
+ * the line to the requested speed and receives the image over XMODEM, as
+ * the board does before forwarding it to the LR11xx. A transfer that matches the expected image
+ * changes the reported firmware version. "gnss on" and "gnss mt3333 version"
+ * are served as well, and so are "system version" and "ble version" with
+ * configurable versions. "lora info" and the "provis lora" commands (set,
+ * display, save, restore, erase, factory) work on a model of the LoRa
+ * provisioning, in flash and being edited. Commands can be abbreviated as on
+ * the board (see abw_mfg_commands.hpp), and "gnss on" prints a line of the
+ * asynchronous log before its status. A board given the records of
+ * mfg_cli_sim_json.hpp serves "system output json", the proposed machine
+ * output of lib/clijson (no echo, no prompt, one JSON record per command or
+ * log line), and "system output text" back. Without them the command is
+ * unknown, as on MFG 3.0, and the tool does not build lib/clijson.
+ *
+ * A tool adds commands with an mfg_cli_extension, as the "gnss almanac"
+ * commands of mfg_cli_sim_almanac.hpp; the others leave them unknown.
+ *
+ * The board can also start in its ABW bootloader (no application yet), which
+ * reacts to keystrokes: ABWe, ABWu (XMODEM receive of the application), v,
+ * r and ?. Resetting with the expected application in flash starts the MFG
+ * CLI, and "system bootloader" goes back to the bootloader. The bootloader
+ * keeps a model of the application slot, so it also serves the page digests
+ * (ABWh) and the page stream (ABWd, through lib/pagediff) of the
+ * differential update of abw_page_diff.hpp. ABWu announces that it takes
+ * LZSS streams as well ("Start xmodem, lzss 12"), and inflates a transfer
+ * that starts with the ALZ magic into flash as the blocks arrive, through
+ * the push interface of lib/lzss.
+ *
+ * The line is modelled rather than just passed through:
+ * - the pty carries no baud rate, so the stand-in reads the rate the host
+ *   set on the slave side; every byte is garbled while the two sides do
+ *   not agree, as on a real UART;
+ * - up to clean_baud the line is error free, up to marginal_baud bytes are
+ *   corrupted at marginal_error, above it nothing gets through;
+ * - reads are paced at the line rate and each XMODEM block costs the time
+ *   the board needs to program it, and each CLI command command_us
+ *   (pacing can be turned off). Output is written at once.
+ */
+
+#ifndef MFG_CLI_SIM_HPP
+#define MFG_CLI_SIM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_mfg_commands.hpp"
+#include "abw_mfg_replies.hpp"
+#include "abw_page_diff.hpp"
+#include "abw_serial.hpp"
+#include "abw_xmodem.hpp"
+
+extern "C" {
+#include "abw_lzss.h"
+}
+
+namespace abw {
+
+/*!
+ * \brief Speeds of "lr11xx firmware update bridge", by index
+ */
+constexpr uint32_t bridge_speeds[] = {1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200, 230400, 460800};
+
+/*!
+ * \brief Status of a command, numbered as abw_cli_code_t of lib/clijson
+ */
+enum class mfg_cli_code : uint8_t { ok, unknown_command, invalid_argument, failed };
+
+/*!
+ * \brief Machine output of the board, one record per command or log line (mfg_cli_sim_json.hpp)
+ *
+ * A record is started with result(), takes the fields of the command and is
+ * returned as the line to send by end().
+ */
+class mfg_cli_records {
+public:
+    virtual ~mfg_cli_records() = default;
+
+    virtual void        result(const std::string& cmd)                                = 0;
+    virtual void        field_text(const char* key, const std::string& value)         = 0;
+    virtual void        field_int(const char* key, int32_t value)                     = 0;
+    virtual void        field_bool(const char* key, bool value)                       = 0;
+    virtual std::string end(mfg_cli_code code, const std::string& error)              = 0;
+    virtual std::string log(const char* source, const char* text, uint32_t uptime_ms) = 0;
+};
+
+/*!
+ * \brief Commands a tool adds to the board (mfg_cli_sim_almanac.hpp), run on the thread of the board
+ */
+class mfg_cli_extension {
+public:
+    virtual ~mfg_cli_extension() = default;
+
+    /*!
+     * \brief Run a command, false if it is not one of the extension
+     *
+     * \param [in] cmd   Expanded command without its arguments
+     * \param [in] words Expanded command line, word by word
+     */
+    virtual bool execute(const std::string& cmd, const std::vector<std::string>& words, mfg_cli_code& code,
+                         std::string& error) = 0;
+};
+
+struct mfg_cli_sim_config {
+    std::string    password         = "456";
+    uint32_t       cli_baud         = 57600;  //!< CLI and bootloader rate, the USB CDC of mfg-usb has none
+    uint16_t       version          = 0x0307;  //!< LR11xx firmware before the update
+    uint16_t       update_version   = 0x0308;  //!< Reported after a transfer of image
+    const uint8_t* image            = nullptr;
+    size_t         image_size       = 0;
+    uint32_t       clean_baud       = 230400;  //!< Highest error-free rate
+    uint32_t       marginal_baud    = 460800;  //!< Highest rate that works at all
+    double         marginal_error   = 2e-4;    //!< Byte error rate between the two
+    uint32_t       flash_us_per_kib = 6000;    //!< Board time to program 1 KiB into the LR11xx
+    uint32_t       seed             = 1;
+    bool           pacing           = true;    //!< Model line and flash time
+    bool           in_bootloader    = false;   //!< Start in the ABW bootloader
+    const uint8_t* app              = nullptr;  //!< Application expected by the bootloader (MFG)
+    size_t         app_size         = 0;
+    uint32_t       app_us_per_kib   = 2000;  //!< Bootloader time to program 1 KiB of application
+    uint32_t       hash_us_per_kib  = 160;   //!< Bootloader time to digest 1 KiB of flash (ABWh)
+    bool           app_lzss         = true;  //!< ABWu takes LZSS streams, and says so
+    const uint8_t* resident         = nullptr;  //!< Application slot content at start, erased if none
+    size_t         resident_size    = 0;
+    std::string    gnss_version     = "AXN5.1.7";
+    std::string    ble_version      = "1.15.0";
+    std::string    fus_version      = "1.2.0";
+    std::string    mfg_build        = "Jun 18 2024, 15:18:50";  //!< Build stamp of the resident application
+    std::string    app_build;  //!< Build stamp once the expected application is received, mfg_build if empty
+    std::string    dev_eui          = "20635f0100000001";  //!< LoRa provisioning in flash at start
+    uint32_t       command_us       = 0;  //!< Board time to run a CLI command
+};
+
+struct mfg_cli_sim_counters {
+    uint32_t commands  = 0;
+    uint32_t transfers = 0;  //!< Bridge transfers started
+    uint32_t updates   = 0;  //!< Transfers that delivered the expected image
+    uint32_t apps      = 0;  //!< Applications received by the bootloader
+    uint32_t garbled   = 0;  //!< Bytes garbled by a rate mismatch or line errors
+};
+
+class mfg_cli_sim {
+public:
+    mfg_cli_sim(serial_port& line, const std::string& slave_path, const mfg_cli_sim_config& config)
+        : line_(line), config_(config), version_(config.version), bootloader_(config.in_bootloader),
+          app_ok_(!config.in_bootloader), mfg_build_(config.mfg_build),
+          flash_(size_t(app_slot_pages) * flash_page_size, 0xFF), baud_(config.cli_baud), rng_(config.seed)
+    {
+        lora_saved_ = factory_lora("EU868");
+        lora_       = lora_saved_;
+        if (config.resident) {
+            std::copy(config.resident, config.resident + std::min(config.resident_size, flash_.size()), flash_.begin());
+        }
+        // Own descriptor on the slave, only to read the rate set by the host
+        host_ = serial_port(slave_path, config.cli_baud);
+    }
+
+    const mfg_cli_sim_config&   config() const { return config_; }
+    const mfg_cli_sim_counters& counters() const { return counters_; }
+    uint16_t                    version() const { return version_; }
+    bool                        in_bootloader() const { return bootloader_; }
+    const std::vector<uint8_t>& flash() const { return flash_; }  //!< Application slot
+    const lora_provisioning&    lora_saved() const { return lora_saved_; }  //!< LoRa provisioning in flash
+
+    /*!
+     * \brief Serve "system output json" with these records, which must outlive the board
+     */
+    void set_records(mfg_cli_records& records) { records_ = &records; }
+
+    /*!
+     * \brief Add commands to the CLI, the extension must outlive the board
+     */
+    void add_extension(mfg_cli_extension& extension) { extensions_.push_back(&extension); }
+
+    /*!
+     * \brief Serve the CLI until stop is set
+     */
+    void run(const std::atomic<bool>& stop)
+    {
+        std::string input;
+        uint8_t     buf[256];
+
+        if (bootloader_) {
+            transmit(bootloader_banner);
+        }
+        while (!stop) {
+            size_t n = receive(buf, sizeof(buf), 50);
+            for (size_t i = 0; i < n; i++) {
+                char c = char(buf[i]);
+                if (bootloader_) {
+                    bootloader_key(c, input);
+                } else if (c == '\r' || c == '\n') {
+                    if (c == '\r' || !input.empty()) {
+                        say("\r\n");
+                        execute(input);
+                    }
+                    input.clear();
+                } else if (c == '\b' || c == 0x7F) {
+                    if (!input.empty()) {
+                        input.pop_back();
+                        say("\b \b");
+                    }
+                } else {
+                    input += c;
+                    say(logged_in_ ? std::string(1, c) : std::string("*"));
+                }
+            }
+        }
+    }
+
+    // For the commands of extensions, on the thread of the board
+
+    /*!
+     * \brief Text of the current command, left out in JSON mode
+     */
+    void say(const std::string& text)
+    {
+        if (!json_) {
+            transmit(text);
+        }
+    }
+
+    /*!
+     * \brief Members of the data of the current command, left out in text mode
+     */
+    void field_text(const char* key, const std::string& value)
+    {
+        if (open_record()) {
+            records_->field_text(key, value);
+        }
+    }
+
+    void field_int(const char* key, int32_t value)
+    {
+        if (open_record()) {
+            records_->field_int(key, value);
+        }
+    }
+
+    void field_bool(const char* key, bool value)
+    {
+        if (open_record()) {
+            records_->field_bool(key, value);
+        }
+    }
+
+    /*!
+     * \brief XMODEM receive at the given rate, as the bridge and the bootloader do
+     *
+     * \param [in] program Called with each new block, returns the bytes it programmed and that cost us_per_kib;
+     *                     by default every byte received does
+     */
+    bool receive_image(uint32_t baud, uint32_t us_per_kib, std::vector<uint8_t>& data,
+                       const std::function<size_t(const uint8_t*, size_t)>& program = {})
+    {
+        baud_ = baud;
+        xmodem_receiver rx(true, true);
+        uint8_t         buf[1100];
+        unsigned        polls = 0;
+        auto            last  = std::chrono::steady_clock::now();
+
+        // Poll every second, give up after 5 polls without an answer, like the board
+        transmit(std::string(1, char(rx.poll())));
+        while (!rx.done() && !rx.failed() && polls < 5) {
+            size_t n = receive(buf, sizeof(buf), 200);
+            for (size_t off = 0, used; off < n; off += used) {
+                size_t  before = rx.data().size();
+                uint8_t answer = rx.on_input(buf + off, n - off, used);
+                if (rx.data().size() > before) {
+                    // The block is programmed before it is acknowledged
+                    size_t block = rx.data().size() - before;
+                    size_t bytes = program ? program(rx.data().data() + before, block) : block;
+                    pace(double(us_per_kib) * bytes / 1024);
+                }
+                if (answer) {
+                    transmit(std::string(1, char(answer)));
+                    last  = std::chrono::steady_clock::now();
+                    polls = 0;
+                }
+            }
+            if (std::chrono::steady_clock::now() - last >= std::chrono::seconds(1)) {
+                transmit(std::string(1, char(rx.poll())));
+                last = std::chrono::steady_clock::now();
+                polls++;
+            }
+        }
+        data = rx.data();
+        return rx.done();
+    }
+
+    /*!
+     * \brief Account for us of line or board time, and wait until it has elapsed
+     */
+    void pace(double us)
+    {
+        using namespace std::chrono;
+        if (!config_.pacing) {
+            return;
+        }
+        double now = double(duration_cast<microseconds>(steady_clock::now() - start_).count());
+        line_us_   = (line_us_ < now ? now : line_us_) + us;
+        std::this_thread::sleep_until(start_ + microseconds(int64_t(line_us_)));
+    }
+
+private:
+    static constexpr const char* bootloader_banner =
+        "\r\nAbeeway bootloader v3.0\r\nHelp\r\n ABWu: xModem transfer\r\n ABWh: page digests\r\n"
+        " ABWd: xModem page diff\r\n ABWe: erase user config\r\n v: version\r\n r: reset\r\n ?: help\r\n\r\n>";
+
+    void bootloader_key(char c, std::string& input)
+    {
+        if (c == '\r' || c == '\n') {
+            input.clear();
+            transmit("\r\n>");
+            return;
+        }
+        input += c;
+        if (input == "ABWu") {
+            transmit(config_.app_lzss ? "\r\nStart xmodem, lzss " + std::to_string(ABW_LZSS_WINDOW_BITS_MAX) + "\r\n"
+                                      : std::string("\r\nStart xmodem\r\n"));
+            transmit(app_received(receive_app()) ? "\r\nTransfer done\r\n>" : "\r\nTransfer failed\r\n>");
+        } else if (input == "ABWh") {
+            send_page_digests();
+        } else if (input == "ABWd") {
+            transmit("\r\nStart xmodem\r\n");
+            transmit(apply_page_stream() ? "\r\nTransfer done\r\n>" : "\r\nTransfer failed\r\n>");
+        } else if (input == "ABWe") {
+            transmit("\r\nUser config erased\r\n>");
+        } else if (input == "v" || input == "?") {
+            transmit(input == "v" ? "\r\nAbeeway bootloader v3.0\r\n>" : bootloader_banner);
+        } else if (input == "r") {
+            if (app_ok_) {
+                bootloader_ = false;
+                logged_in_  = false;
+                transmit("\r\nWelcome to AOS\r\n");
+            } else {
+                transmit(bootloader_banner);
+            }
+        } else if (std::string("ABW").compare(0, input.size(), input) == 0) {
+            transmit(std::string(1, c));  // Part of a command, echoed
+            return;
+        } else {
+            transmit(std::string(1, c));
+        }
+        input.clear();
+    }
+
+    /*!
+     * \brief ABWu: erase the slot, then program it block by block with the image or what its LZSS stream inflates to
+     *
+     * A plain image is programmed as received, XMODEM padding included.
+     */
+    bool receive_app()
+    {
+        flash_output      out = {flash_, 0};
+        abw_lzss_t        lz;
+        abw_lzss_status_t lz_status = ABW_LZSS_OK;
+        enum { unknown, plain, compressed } mode = unknown;
+
+        std::fill(flash_.begin(), flash_.end(), 0xFF);
+        std::vector<uint8_t> data;
+        bool                 received = receive_image(
+            config_.cli_baud, config_.app_us_per_kib, data, [&](const uint8_t* p, size_t n) {
+                size_t before = out.programmed;
+                if (mode == unknown) {
+                    mode = config_.app_lzss && n >= 3 && p[0] == 'A' && p[1] == 'L' && p[2] == 'Z' ? compressed : plain;
+                    abw_lzss_init_push(&lz, program_flash, &out);
+                }
+                if (mode == compressed) {
+                    lz_status = abw_lzss_push(&lz, p, uint32_t(n));
+                } else if (program_flash(&out, uint32_t(out.programmed), p, uint32_t(n)) != 0) {
+                    return size_t(0);
+                }
+                return out.programmed - before;
+            });
+        return received && (mode != compressed || lz_status == ABW_LZSS_END);
+    }
+
+    struct flash_output {
+        std::vector<uint8_t>& flash;
+        size_t                programmed;
+    };
+
+    static int program_flash(void* ctx, uint32_t offset, const uint8_t* data, uint32_t len)
+    {
+        auto& out = *static_cast<flash_output*>(ctx);
+        if (offset + size_t(len) > out.flash.size()) {
+            return 1;
+        }
+        std::copy(data, data + len, out.flash.begin() + offset);
+        out.programmed += len;
+        return 0;
+    }
+
+    /*!
+     * \brief Whether the slot now holds the expected application, after a transfer
+     */
+    bool app_received(bool transferred)
+    {
+        bool ok = transferred && config_.app && config_.app_size <= flash_.size() &&
+                  std::equal(config_.app, config_.app + config_.app_size, flash_.begin());
+        app_ok_ = ok;
+        counters_.apps += ok;
+        if (ok && !config_.app_build.empty()) {
+            mfg_build_ = config_.app_build;
+        }
+        return ok;
+    }
+
+    uint32_t used_pages() const
+    {
+        size_t end = flash_.size();
+        while (end > 0 && flash_[end - 1] == 0xFF) {
+            end--;
+        }
+        return uint32_t((end + flash_page_size - 1) / flash_page_size);
+    }
+
+    void send_page_digests()
+    {
+        uint32_t    pages = used_pages();
+        std::string text  = "\r\nPages " + std::to_string(pages) + " " + std::to_string(flash_page_size) + "\r\n";
+        char        line[16];
+
+        pace(double(config_.hash_us_per_kib) * pages * (flash_page_size / 1024));
+        for (uint32_t page = 0; page < pages; page++) {
+            std::snprintf(line, sizeof(line), "%08X\r\n",
+                          unsigned(page_digest(&flash_[size_t(page) * flash_page_size], flash_page_size)));
+            text += line;
+        }
+        transmit(text + ">");
+    }
+
+    /*!
+     * \brief ABWd: apply the page stream received over XMODEM, check the image and erase the pages past it
+     */
+    bool apply_page_stream()
+    {
+        std::vector<uint8_t> data;
+        bool                 received = receive_image(config_.cli_baud, config_.app_us_per_kib, data);
+
+        abw_page_stream_flash_t access = {
+            [](void* ctx, uint32_t page) {
+                auto& flash = *static_cast<std::vector<uint8_t>*>(ctx);
+                std::fill_n(flash.begin() + size_t(page) * flash_page_size, flash_page_size, 0xFF);
+                return 0;
+            },
+            [](void* ctx, uint32_t page, uint32_t offset, const uint8_t* data, uint32_t len) {
+                auto& flash = *static_cast<std::vector<uint8_t>*>(ctx);
+                std::copy(data, data + len, flash.begin() + size_t(page) * flash_page_size + offset);
+                return 0;
+            },
+            &flash_};
+        abw_page_stream_t        stream;
+        abw_page_stream_status_t status = ABW_PAGE_STREAM_OK;
+        abw_page_stream_init(&stream, &access, app_slot_pages, flash_page_size);
+
+        // Fed block by block, as the bootloader does on each XMODEM block
+        for (size_t at = 0; received && status == ABW_PAGE_STREAM_OK && at < data.size(); at += 1024) {
+            status = abw_page_stream_write(&stream, &data[at], uint32_t(std::min<size_t>(1024, data.size() - at)));
+        }
+        if (status != ABW_PAGE_STREAM_END) {
+            return app_received(false);
+        }
+
+        const abw_page_stream_info_t* info = abw_page_stream_get_info(&stream);
+        for (uint32_t page = abw_page_stream_image_pages(&stream), end = used_pages(); page < end; page++) {
+            access.erase(access.ctx, page);
+        }
+        uint32_t crc = abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, flash_.data(), info->image_len));
+        return app_received(crc == info->image_crc);
+    }
+
+    void execute(const std::string& typed)
+    {
+        if (!logged_in_) {
+            logged_in_ = typed == config_.password;
+            transmit(logged_in_ ? "super> " : "login: ");
+            return;
+        }
+
+        // Commands are matched expanded; an ambiguous one is left as typed, and unknown
+        std::string line = typed;
+        try {
+            line = resolve_command(typed);
+        } catch (const std::invalid_argument&) {
+        }
+        std::istringstream       in(line);
+        std::vector<std::string> words;
+        for (std::string word; in >> word;) {
+            words.push_back(word);
+        }
+        if (words.empty()) {
+            say("super> ");
+            return;
+        }
+        counters_.commands++;
+        pace(config_.command_us);
+        record_cmd_  = command_name(line);
+        record_open_ = false;
+
+        mfg_cli_code code  = mfg_cli_code::ok;
+        std::string  error;
+        bool         json  = json_;
+        bool         chip  = words[0] == "lr11xx" || words[0] == "lr1110";
+        if (chip && words.size() == 3 && words[1] == "firmware" && words[2] == "version") {
+            print_version(1, "(transceiver)", "Firmware version", version_);
+            field_int("system_type", 1);
+            field_int("hardware", 0x22);
+            field_int("firmware", version_);
+        } else if (chip && words.size() == 6 && words[1] == "firmware" && words[2] == "update" &&
+                   words[3] == "bridge" && (words[4] == "0" || words[4] == "2") && words[5].size() == 1 &&
+                   words[5][0] >= '0' && words[5][0] <= '9') {
+            code = bridge(bridge_speeds[words[5][0] - '0']) ? mfg_cli_code::ok : mfg_cli_code::failed;
+        } else if (words[0] == "gnss" && (line == "gnss on" || line == "gnss mt3333 on")) {
+            log("GNSS", "MT. Started");
+        } else if (line == "gnss mt3333 version") {
+            say("MT3333 firmware : " + config_.gnss_version + "\r\n");
+            field_text("firmware", config_.gnss_version);
+        } else if (line == "system version") {
+            say(" AOS: 1.0-0. Built on: Jun 18 2024, 15:17:35\r\n MFG: 3.0-192. Build on: " + mfg_build_ + "\r\n");
+            field_text("aos", "1.0-0");
+            field_text("aos_build", "Jun 18 2024, 15:17:35");
+            field_text("mfg", "3.0-192");
+            field_text("mfg_build", mfg_build_);
+        } else if (line == "ble version") {
+            say("Wireless Firmware version (BLE STACK) " + config_.ble_version + "\r\nFUS version " +
+                config_.fus_version + "\r\n");
+            field_text("ble_stack", config_.ble_version);
+            field_text("fus", config_.fus_version);
+        } else if (line == "lora info") {
+            print_lora_info();
+        } else if (words.size() >= 3 && words[0] == "provis" && words[1] == "lora") {
+            code = provis_lora(words, error);
+        } else if (records_ && record_cmd_ == "system output" && words.size() == 3 &&
+                   (words[2] == "json" || words[2] == "text")) {
+            json = words[2] == "json";
+        } else if (records_ && record_cmd_ == "system output") {
+            code  = mfg_cli_code::invalid_argument;
+            error = "usage: system output <text|json>";
+        } else if (line == "system bootloader") {
+            say("Bootloader entrance set\r\n");
+            bootloader_ = true;
+        } else if (!extended(words, code, error)) {
+            code  = mfg_cli_code::unknown_command;
+            error = "Unknown command";
+        }
+
+        finish(code, error);
+        json_ = json && !bootloader_;
+        if (bootloader_) {
+            transmit(bootloader_banner);
+        } else {
+            say("super> ");
+        }
+    }
+
+    /*!
+     * \brief In JSON mode, start the result record of the current command if not done yet
+     */
+    bool open_record()
+    {
+        if (json_ && !record_open_) {
+            records_->result(record_cmd_);
+            record_open_ = true;
+        }
+        return json_;
+    }
+
+    /*!
+     * \brief Status of the current command, as a line of text or at the end of its record
+     */
+    void finish(mfg_cli_code code, const std::string& error)
+    {
+        if (open_record()) {
+            transmit(records_->end(code, error));
+        } else {
+            transmit((error.empty() ? "" : error + "\r\n") + (code == mfg_cli_code::ok ? "OK\r\n" : "ERROR\r\n"));
+        }
+    }
+
+    /*!
+     * \brief Line of the asynchronous log, or its event record; comes before anything else of the command
+     */
+    void log(const char* source, const char* text)
+    {
+        using namespace std::chrono;
+        auto ms = duration_cast<milliseconds>(steady_clock::now() - start_).count();
+        if (json_) {
+            transmit(records_->log(source, text, uint32_t(ms)));
+            return;
+        }
+        char     line[96];
+        unsigned s = unsigned(ms / 1000);
+        std::snprintf(line, sizeof(line), "%ud,%02u:%02u:%02u.%03u. (%s) %s\r\n", s / 86400, s / 3600 % 24,
+                      s / 60 % 60, s % 60, unsigned(ms % 1000), source, text);
+        transmit(line);
+    }
+
+    /*!
+     * \brief Run the command with the extension that has it, false if none does
+     */
+    bool extended(const std::vector<std::string>& words, mfg_cli_code& code, std::string& error)
+    {
+        for (mfg_cli_extension* extension : extensions_) {
+            if (extension->execute(record_cmd_, words, code, error)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void print_version(unsigned type, const char* type_name, const char* label, uint16_t version)
+    {
+        char text[160];
+        std::snprintf(text, sizeof(text),
+                      "        System Type : %10u %s\r\n"
+                      "   Hardware version : %10s\r\n"
+                      "%19s : %10s\r\n",
+                      type, type_name, "0x22", label, hex(version).c_str());
+        say(text);
+    }
+
+    void print_lora_info()
+    {
+        char text[512];
+        std::snprintf(text, sizeof(text),
+                      "LoRa information\r\n"
+                      " Versions\r\n"
+                      "  LoRa: 1.0.4.0\r\n"
+                      "  Regional: 2.1.0.0\r\n"
+                      "  Modem: 3.1.7\r\n"
+                      "  Chip. HW: 34. Type: 1, FW: 0x%02x\r\n"
+                      " EUIs\r\n"
+                      "  DevEUI: %s\r\n"
+                      "  JoinEUI: %s\r\n"
+                      " MAC\r\n"
+                      "  Region: %s\r\n"
+                      "  TX strategy: Network (ADR)\r\n"
+                      "  State: Idle\r\n"
+                      "  Joined: No\r\n"
+                      "  DevAddr: 0x%08x\r\n"
+                      "  DevNonce: %d\r\n"
+                      "  Duty-cycle: Accept. Remaining 0 ms\r\n",
+                      unsigned(version_ & 0xFF), eui_text(lora_saved_.dev_eui).c_str(),
+                      eui_text(lora_saved_.join_eui).c_str(), lora_saved_.region.c_str(), 0u, 12);
+        say(text);
+
+        field_text("lorawan", "1.0.4.0");
+        field_text("regional", "2.1.0.0");
+        field_text("modem", "3.1.7");
+        field_int("chip_hw", 34);
+        field_int("chip_type", 1);
+        field_int("chip_fw", version_ & 0xFF);
+        field_text("dev_eui", lora_saved_.dev_eui);
+        field_text("join_eui", lora_saved_.join_eui);
+        field_text("region", lora_saved_.region);
+        field_text("tx_strategy", "Network (ADR)");
+        field_text("state", "Idle");
+        field_bool("joined", false);
+        field_int("dev_addr", 0);
+        field_int("dev_nonce", 12);
+    }
+
+    lora_provisioning factory_lora(const std::string& region) const
+    {
+        lora_provisioning p;
+        p.valid      = true;
+        p.region     = region;
+        p.activation = "OTAA";
+        p.dev_eui    = config_.dev_eui;
+        p.join_eui   = "0000000000000000";
+        return p;
+    }
+
+    /*!
+     * \brief "provis lora ...", with the messages of the MFG firmware
+     */
+    mfg_cli_code provis_lora(const std::vector<std::string>& words, std::string& error)
+    {
+        static const char* regions[] = {"EU868",    "US915",    "AS923-1", "AS923-JP", "AS923-2", "AS923-3",
+                                        "AS923-4",  "AU915",    "CN470",   "IN865",    "KR920",   "RU864"};
+
+        const std::string& what = words[2];
+        const std::string  arg  = words.size() > 4 ? words[4] : std::string();
+        auto               row  = [this](const char* key, const std::string& value) {
+            char text[96];
+            std::snprintf(text, sizeof(text), "%25s : %10s\r\n", key, value.c_str());
+            say(text);
+        };
+
+        if (what == "display" && !lora_.valid) {
+            say("No valid provisioning data exists.\r\n");
+            field_bool("valid", false);
+        } else if (what == "display") {
+            bool saved = lora_saved_.valid && lora_.region == lora_saved_.region &&
+                         lora_.dev_eui == lora_saved_.dev_eui && lora_.join_eui == lora_saved_.join_eui &&
+                         lora_.appkey == lora_saved_.appkey && lora_.nwkkey == lora_saved_.nwkkey;
+            say(saved ? "Provisioning data (saved):\r\n" : "Provisioning data (unsaved):\r\n");
+            row("MAC Region", lora_.region);
+            row("Activation", lora_.activation);
+            row("Device EUI", eui_text(lora_.dev_eui));
+            row("Join EUI", eui_text(lora_.join_eui));
+            row("nwkkey defined", lora_.nwkkey ? "yes" : "no");
+            row("appkey defined", lora_.appkey ? "yes" : "no");
+            field_bool("valid", true);
+            field_bool("saved", saved);
+            field_text("region", lora_.region);
+            field_text("activation", lora_.activation);
+            field_text("dev_eui", lora_.dev_eui);
+            field_text("join_eui", lora_.join_eui);
+            field_bool("nwkkey", lora_.nwkkey);
+            field_bool("appkey", lora_.appkey);
+        } else if (what == "save") {
+            say("Save provisioning\r\n");
+            lora_saved_ = lora_;
+        } else if (what == "restore") {
+            say("Read provisioning:\r\n");
+            lora_ = lora_saved_;
+        } else if (what == "erase") {
+            say("Erase provisioning:\r\n");
+            lora_saved_ = lora_provisioning();
+        } else if (what == "factory") {
+            say("Factory settings:\r\n");
+            lora_ = factory_lora(words.size() > 3 ? words[3] : "EU868");
+        } else if (what == "set" && words.size() >= 4) {
+            const std::string& field = words[3];
+            if (field == "deveui" || field == "joineui") {
+                if (arg.empty() || eui_hex(arg).empty()) {
+                    error = arg.empty() ? "Missing EUI value" : "Invalid EUI value '" + arg + "'";
+                    return mfg_cli_code::invalid_argument;
+                }
+                (field == "deveui" ? lora_.dev_eui : lora_.join_eui) = eui_hex(arg);
+            } else if (field == "appkey" || field == "nwkkey") {
+                bool hex = arg.size() == 32 && arg.find_first_not_of("0123456789abcdefABCDEF") == std::string::npos;
+                if (!hex) {
+                    error = arg.empty() ? "Missing key value" : "Invalid key value '" + arg + "'";
+                    return mfg_cli_code::invalid_argument;
+                }
+                (field == "appkey" ? lora_.appkey : lora_.nwkkey) = true;
+            } else if (field == "region") {
+                std::string region = arg.empty() ? "EU868" : arg;
+                if (std::find(std::begin(regions), std::end(regions), region) == std::end(regions)) {
+                    error = "Invalid MAC region '" + region + "'";
+                    return mfg_cli_code::invalid_argument;
+                }
+                lora_.region = region;
+            } else if (field == "activation") {
+                lora_.activation = "OTAA";
+            } else if (field != "parameter" || words.size() != 6) {
+                error = "Unknown command";
+                return mfg_cli_code::unknown_command;
+            }
+            lora_.valid = true;
+        } else {
+            error = "Unknown command";
+            return mfg_cli_code::unknown_command;
+        }
+        return mfg_cli_code::ok;
+    }
+
+    static std::string hex(uint16_t value)
+    {
+        char text[8];
+        std::snprintf(text, sizeof(text), "0x%04X", value);
+        return text;
+    }
+
+    bool bridge(uint32_t baud)
+    {
+        print_version(223, "(bootloader)", "Bootloader version", 0x6500);
+        field_int("bootloader", 0x6500);
+        counters_.transfers++;
+
+        std::vector<uint8_t> data;
+        bool                 received = receive_image(baud, config_.flash_us_per_kib, data);
+
+        // Let the host see the last answer at the bridge rate
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        baud_ = config_.cli_baud;
+
+        bool ok = received && config_.image && data.size() >= config_.image_size &&
+                  std::equal(config_.image, config_.image + config_.image_size, data.begin());
+        if (ok) {
+            version_ = config_.update_version;
+            counters_.updates++;
+        }
+        return ok;
+    }
+
+    double error_rate() const
+    {
+        if (tty_baud(host_.fd()) != baud_ || baud_ > config_.marginal_baud) {
+            return 1;
+        }
+        return baud_ > config_.clean_baud ? config_.marginal_error : 0;
+    }
+
+    void garble(uint8_t* p, size_t n)
+    {
+        double rate = error_rate();
+        for (size_t i = 0; rate > 0 && i < n; i++) {
+            if (rate >= 1 || std::uniform_real_distribution<double>(0, 1)(rng_) < rate) {
+                p[i] ^= uint8_t(std::uniform_int_distribution<int>(1, 255)(rng_));
+                counters_.garbled++;
+            }
+        }
+    }
+
+    size_t receive(uint8_t* buf, size_t len, int timeout_ms)
+    {
+        size_t n = line_.read(buf, len, timeout_ms);
+        if (n) {
+            pace(n * 10e6 / baud_);
+            garble(buf, n);
+        }
+        return n;
+    }
+
+    void transmit(std::string text)
+    {
+        std::vector<uint8_t> bytes(text.begin(), text.end());
+        garble(bytes.data(), bytes.size());
+        line_.write(bytes.data(), bytes.size());
+    }
+
+    serial_port&                          line_;
+    serial_port                           host_;
+    mfg_cli_sim_config                    config_;
+    mfg_cli_sim_counters                  counters_;
+    uint16_t                              version_;
+    bool                                  bootloader_;
+    bool                                  app_ok_;
+    std::string                           mfg_build_;
+    std::vector<uint8_t>                  flash_;
+    uint32_t                              baud_;
+    bool                                  logged_in_ = false;
+    lora_provisioning                     lora_;        //!< Being edited by "provis lora set"
+    lora_provisioning                     lora_saved_;  //!< In flash
+    std::vector<mfg_cli_extension*>       extensions_;
+    mfg_cli_records*                      records_ = nullptr;  //!< JSON output, if the board has it
+    bool                                  json_    = false;    //!< "system output json"
+    std::string                           record_cmd_;  //!< Name of the command being run
+    bool                                  record_open_ = false;
+    std::mt19937                          rng_;
+    std::chrono::steady_clock::time_point start_   = std::chrono::steady_clock::now();
+    double                                line_us_ = 0;
+};
+
+}  // namespace abw
+
+#endif  // MFG_CLI_SIM_HPP
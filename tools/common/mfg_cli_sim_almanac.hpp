@@ -0,0 +1,199 @@
+/*!
+ * \file      mfg_cli_sim_almanac.hpp
+ *
+ * \brief     "gnss almanac" commands of the simulated MFG board, and the almanac of its LR11xx
+ *
+ * An extension of mfg_cli_sim.hpp, registered on a board by constructing it
+ * there. "gnss almanac set sid,week,word0,..word7 [END]" takes one GPS
+ * almanac entry per command, with the checks and messages of the MFG
+ * firmware. "gnss almanac load" (not in MFG 3.0) receives the blob of
+ * lib/lr11xx/lr11xx_almanac.hpp over XMODEM at the CLI rate, GPS and BeiDou
+ * together, checks it and writes it in batches. Each LR11xx almanac write
+ * costs write_us, plus entry_us per entry it carries.
+ *
+ * Only the tools that include this header build lr11xx_almanac.cpp.
+ */
+
+#ifndef MFG_CLI_SIM_ALMANAC_HPP
+#define MFG_CLI_SIM_ALMANAC_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lr11xx_almanac.hpp"
+#include "mfg_cli_sim.hpp"
+
+namespace abw {
+
+struct mfg_cli_almanac_config {
+    uint32_t write_us = 3000;  //!< LR11xx time for one almanac write command
+    uint32_t entry_us = 300;   //!< LR11xx time for each entry of an almanac write
+};
+
+struct mfg_cli_almanac_counters {
+    uint32_t writes  = 0;  //!< LR11xx almanac write commands
+    uint32_t entries = 0;  //!< Almanac entries written
+    uint32_t updates = 0;  //!< Almanac updates closed, by END or a load
+};
+
+class mfg_cli_almanac : public mfg_cli_extension, public lr11xx::almanac_port {
+public:
+    mfg_cli_almanac(mfg_cli_sim& board, const mfg_cli_almanac_config& config = {})
+        : board_(board), config_(config), almanac_(lr11xx::almanac::max_entries)
+    {
+        board_.add_extension(*this);
+    }
+
+    const mfg_cli_almanac_counters& counters() const { return counters_; }
+
+    /*!
+     * \brief Almanac in the LR11xx: GPS satellites 1-32 then BeiDou 1-63, sid 0 where none was written
+     */
+    const std::vector<lr11xx::almanac::entry>& almanac() const { return almanac_; }
+
+    bool execute(const std::string& cmd, const std::vector<std::string>& words, mfg_cli_code& code,
+                 std::string& error) override
+    {
+        if (cmd == "gnss almanac set") {
+            code = set(words, error);
+        } else if (cmd == "gnss almanac load" && words.size() == 3) {
+            code = load(error);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+     * \brief One LR11xx almanac write
+     */
+    bool write(const lr11xx::almanac::entry* entries, size_t count) override
+    {
+        board_.pace(config_.write_us + double(config_.entry_us) * count);
+        counters_.writes++;
+        counters_.entries += uint32_t(count);
+        for (size_t i = 0; i < count; i++) {
+            bool gps = entries[i].constellation == lr11xx::almanac::constellation::gps;
+            almanac_[(gps ? 0 : lr11xx::almanac::gps_satellites) + entries[i].sid - 1] = entries[i];
+        }
+        return true;
+    }
+
+private:
+    /*!
+     * \brief "gnss almanac set sid,week,word0,..word7 [END]", one GPS entry, with the messages of the MFG firmware
+     */
+    mfg_cli_code set(const std::vector<std::string>& words, std::string& error)
+    {
+        static const char* fields_error =
+            "The fields of the last argument should be separated by a comma without space.";
+
+        if (words.size() == 5 && words[4] != "END") {
+            error = "The third argument must be END if provided";
+            return mfg_cli_code::invalid_argument;
+        }
+        std::vector<std::string> fields;
+        std::istringstream       in(words.size() >= 4 ? words[3] : std::string());
+        for (std::string field; std::getline(in, field, ',');) {
+            fields.push_back(field);
+        }
+        if (words.size() < 4 || words.size() > 5 || fields.size() != 10) {
+            error = fields_error;
+            return mfg_cli_code::invalid_argument;
+        }
+
+        lr11xx::almanac::entry e;
+        unsigned long          value;
+        if (!number(fields[0], value) || value > 255) {
+            error = "Invalid satellite ID: " + fields[0];
+            return mfg_cli_code::invalid_argument;
+        }
+        e.sid = uint8_t(value);
+        if (lr11xx::almanac::check_entry(e) != lr11xx::almanac::status::ok) {
+            error = "Satellite ID " + std::to_string(value) + " not in range";
+            return mfg_cli_code::invalid_argument;
+        }
+        for (size_t i = 1; i < fields.size(); i++) {
+            if (!number(fields[i], value) || value > (i == 1 ? 0xFFFFul : lr11xx::almanac::word_mask)) {
+                error = fields_error;
+                return mfg_cli_code::invalid_argument;
+            }
+            if (i == 1) {
+                e.week = uint16_t(value);
+            } else {
+                e.words[i - 2] = uint32_t(value);
+            }
+        }
+
+        write(&e, 1);
+        if (words.size() == 5) {
+            close();
+        }
+        board_.say("GPS almanac set success\r\n");
+        board_.field_int("sid", e.sid);
+        board_.field_bool("end", words.size() == 5);
+        return mfg_cli_code::ok;
+    }
+
+    /*!
+     * \brief "gnss almanac load": the whole almanac as one blob over XMODEM, checked before the first write
+     */
+    mfg_cli_code load(std::string& error)
+    {
+        std::vector<uint8_t> data;
+        uint32_t             writes;
+
+        board_.say("Start xmodem\r\n");
+        if (!board_.receive_image(board_.config().cli_baud, 0, data)) {
+            error = "Transfer failed";
+            return mfg_cli_code::failed;
+        }
+        lr11xx::almanac::status s = lr11xx::write_almanac(data.data(), data.size(), *this, 0, writes);
+        if (s != lr11xx::almanac::status::ok) {
+            error = std::string("Almanac rejected: ") + lr11xx::almanac::status_name(s);
+            return mfg_cli_code::failed;
+        }
+        close();
+
+        uint32_t gps;
+        uint32_t beidou;
+        lr11xx::almanac::check(data.data(), data.size(), gps, beidou);
+        char text[96];
+        std::snprintf(text, sizeof(text), "Almanac loaded: %u GPS, %u BeiDou, %u writes\r\n", unsigned(gps),
+                      unsigned(beidou), unsigned(writes));
+        board_.say(text);
+        board_.field_int("gps", int32_t(gps));
+        board_.field_int("beidou", int32_t(beidou));
+        board_.field_int("writes", int32_t(writes));
+        return mfg_cli_code::ok;
+    }
+
+    /*!
+     * \brief End of an update: one more write for the LR11xx to take the almanac
+     */
+    void close()
+    {
+        board_.pace(config_.write_us);
+        counters_.updates++;
+    }
+
+    static bool number(const std::string& text, unsigned long& value)
+    {
+        char* end;
+        value = std::strtoul(text.c_str(), &end, 0);
+        return !text.empty() && text[0] != '-' && *end == '\0';
+    }
+
+    mfg_cli_sim&                        board_;
+    mfg_cli_almanac_config              config_;
+    mfg_cli_almanac_counters            counters_;
+    std::vector<lr11xx::almanac::entry> almanac_;
+};
+
+}  // namespace abw
+
+#endif  // MFG_CLI_SIM_ALMANAC_HPP
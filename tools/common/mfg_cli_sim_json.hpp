@@ -0,0 +1,83 @@
+/*!
+ * \file      mfg_cli_sim_json.hpp
+ *
+ * \brief     JSON output of the simulated MFG board, written by lib/clijson
+ *
+ * A board of mfg_cli_sim.hpp answers "system output json" once it is given
+ * these records with set_records(). Each record is built by the C writer
+ * the MFG application would embed, so the stand-in exercises the format of
+ * lib/clijson/abw_cli_json.h. Only the tools that include this header build
+ * abw_cli_json.c.
+ */
+
+#ifndef MFG_CLI_SIM_JSON_HPP
+#define MFG_CLI_SIM_JSON_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "mfg_cli_sim.hpp"
+
+extern "C" {
+#include "abw_cli_json.h"
+}
+
+namespace abw {
+
+static_assert(int(mfg_cli_code::unknown_command) == ABW_CLI_UNKNOWN_COMMAND &&
+                  int(mfg_cli_code::invalid_argument) == ABW_CLI_INVALID_ARGUMENT &&
+                  int(mfg_cli_code::failed) == ABW_CLI_FAILED,
+              "mfg_cli_code must follow abw_cli_code_t");
+
+class mfg_cli_json : public mfg_cli_records {
+public:
+    mfg_cli_json() { abw_cli_json_init(&writer_, append, this); }
+
+    mfg_cli_json(const mfg_cli_json&)            = delete;
+    mfg_cli_json& operator=(const mfg_cli_json&) = delete;
+
+    void result(const std::string& cmd) override { abw_cli_json_result(&writer_, cmd.c_str()); }
+
+    void field_text(const char* key, const std::string& value) override
+    {
+        abw_cli_json_string(&writer_, key, value.c_str());
+    }
+
+    void field_int(const char* key, int32_t value) override { abw_cli_json_int(&writer_, key, value); }
+    void field_bool(const char* key, bool value) override { abw_cli_json_bool(&writer_, key, value); }
+
+    std::string end(mfg_cli_code code, const std::string& error) override
+    {
+        abw_cli_json_end(&writer_, abw_cli_code_t(code), error.empty() ? nullptr : error.c_str());
+        return take();
+    }
+
+    std::string log(const char* source, const char* text, uint32_t uptime_ms) override
+    {
+        abw_cli_json_event(&writer_, "log", uptime_ms);
+        abw_cli_json_string(&writer_, "source", source);
+        abw_cli_json_string(&writer_, "text", text);
+        abw_cli_json_end(&writer_, ABW_CLI_OK, nullptr);
+        return take();
+    }
+
+private:
+    static void append(void* ctx, const char* data, uint32_t len)
+    {
+        static_cast<mfg_cli_json*>(ctx)->record_.append(data, len);
+    }
+
+    std::string take()
+    {
+        std::string record;
+        record.swap(record_);
+        return record;
+    }
+
+    abw_cli_json_t writer_;
+    std::string    record_;  //!< Record being written
+};
+
+}  // namespace abw
+
+#endif  // MFG_CLI_SIM_JSON_HPP
@@ -0,0 +1,385 @@
+/*!
+ * \file      mt3333_gnss_sim.hpp
+ *
+ * \brief     Stand-in for an MT3333 in navigation mode, for A-GNSS injection, on a virtual clock
+ *
+ * The model boots boot_ms after power-on and reports $PMTK010,001. Bytes
+ * that arrive before are lost, as with the real UART. Then it outputs GGA,
+ * RMC, GSA and GSV once a second. Both directions run at the line rate.
+ * The bytes written by the MCU wait in a queue of tx_queue bytes (the MCU
+ * driver buffer), then in the receive buffer of the MT3333 (rx_buffer), and
+ * bytes that do not fit are lost. Sentences are handled one after the other,
+ * in command_us (epo_us for a PMTK721), and acknowledged with PMTK001 when
+ * done. A sentence with a bad checksum is dropped without an ack.
+ *
+ * Time to first fix follows the assistance level, as medians in s:
+ *
+ *   hot        Backup kept since a recent fix: time and ephemeris known
+ *   epo        Time and EPO for at least epo_min satellites, and position
+ *   epo_time   Time and EPO, no position
+ *   warm       Time and position
+ *   cold       Nothing
+ *
+ * Each session draws a factor for sky conditions, which the caller gives
+ * to power_on() so that strategies are compared on the same draws. The fix
+ * comes at the earliest of boot + T(level at boot) and, for each
+ * assistance sentence handled, now + T(level then). The defaults are the
+ * typical values of MT3333 module datasheets, not measurements of this
+ * board; the PMTK740 time counts only within time_tolerance_ms of the true
+ * time.
+ */
+
+#ifndef MT3333_GNSS_SIM_HPP
+#define MT3333_GNSS_SIM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+
+namespace abw {
+
+struct mt3333_gnss_sim_config {
+    uint32_t baud              = 115200;
+    uint32_t boot_ms           = 250;   //!< Power-on to PMTK010,001
+    uint32_t tx_queue          = 256;   //!< MCU driver buffer in front of the line
+    uint32_t rx_buffer         = 2048;  //!< MT3333 receive buffer
+    uint32_t command_us        = 2000;  //!< Handling of a PMTK740 or PMTK713
+    uint32_t epo_us            = 1500;  //!< Handling of a PMTK721
+    uint32_t time_tolerance_ms = 3000;
+    uint32_t epo_min           = 24;    //!< EPO satellites for the epo levels
+    double   hot_s             = 1.5;
+    double   epo_s             = 11;
+    double   epo_time_s        = 15;
+    double   warm_s            = 28;
+    double   cold_s            = 34;
+};
+
+enum class gnss_level { cold, warm, epo_time, epo, hot };
+
+inline const char* gnss_level_name(gnss_level level)
+{
+    static const char* names[] = {"cold", "warm", "epo_time", "epo", "hot"};
+    return names[int(level)];
+}
+
+struct mt3333_gnss_sim_counters {
+    uint32_t sentences  = 0;  //!< Received with a valid checksum
+    uint32_t bad        = 0;  //!< Checksum errors
+    uint32_t lost       = 0;  //!< Bytes lost before boot or to a full receive buffer
+    uint32_t epo        = 0;  //!< Satellites with EPO
+    bool     time       = false;
+    bool     position   = false;
+    uint64_t assist_us  = 0;  //!< Power-on to the last assistance handled
+    uint64_t fix_us     = 0;  //!< Power-on to the first fix output, 0 before
+    gnss_level boot_level = gnss_level::cold;
+    gnss_level level      = gnss_level::cold;
+};
+
+class mt3333_gnss_sim {
+public:
+    explicit mt3333_gnss_sim(const mt3333_gnss_sim_config& config) : config_(config) {}
+
+    /*!
+     * \brief Power the receiver at the current time
+     *
+     * \param [in] utc        True UTC time, Unix seconds
+     * \param [in] latitude   True position, 1e-7 degrees
+     * \param [in] longitude
+     * \param [in] altitude_m
+     * \param [in] hot        Backup domain kept since a recent fix
+     * \param [in] factor     Sky conditions of the session, 1 for the medians
+     */
+    void power_on(uint32_t utc, int32_t latitude, int32_t longitude, int32_t altitude_m, bool hot, double factor)
+    {
+        on_       = true;
+        power_us_ = now_;
+        utc_ms_   = uint64_t(utc) * 1000;
+        lat_      = latitude;
+        lon_      = longitude;
+        alt_m_    = altitude_m;
+        factor_   = factor;
+        counters_ = mt3333_gnss_sim_counters();
+        tx_.clear();
+        rx_.clear();
+        out_.clear();
+        pending_.clear();
+        busy_until_ = 0;
+        in_credit_ = out_credit_ = 0;
+        counters_.boot_level = counters_.level = hot ? gnss_level::hot : gnss_level::cold;
+        boot_us_  = now_ + uint64_t(config_.boot_ms) * 1000;
+        fix_at_   = boot_us_ + seconds(counters_.level);
+        next_epoch_ = 0;
+        booted_   = false;
+    }
+
+    void power_off() { on_ = false; }
+
+    /*!
+     * \brief MCU write to the UART
+     *
+     * \returns Bytes taken by the driver queue
+     */
+    size_t write(const uint8_t* p, size_t n)
+    {
+        size_t room = config_.tx_queue - std::min<size_t>(tx_.size(), config_.tx_queue);
+        n           = std::min(n, room);
+        tx_.insert(tx_.end(), p, p + n);
+        return n;
+    }
+
+    /*!
+     * \brief Bytes output by the receiver and arrived at the MCU so far
+     */
+    size_t read(uint8_t* p, size_t max)
+    {
+        size_t n = std::min(max, arrived_.size());
+        std::copy(arrived_.begin(), arrived_.begin() + long(n), p);
+        arrived_.erase(arrived_.begin(), arrived_.begin() + long(n));
+        return n;
+    }
+
+    /*!
+     * \brief Run the model for us microseconds
+     */
+    void advance(uint64_t us)
+    {
+        uint64_t end = now_ + us;
+        while (now_ < end) {
+            uint64_t step = std::min<uint64_t>(end - now_, byte_us());
+            if (tx_.empty() && rx_.empty() && out_.empty() && pending_.empty() && booted_) {
+                // Idle up to the next epoch
+                step = std::max(step, std::min(end, next_epoch_) - std::min(now_, std::min(end, next_epoch_)));
+            }
+            now_ += step;
+            tick(step);
+        }
+    }
+
+    uint64_t                        now_us() const { return now_; }
+    const mt3333_gnss_sim_counters& counters() const { return counters_; }
+
+private:
+    uint64_t byte_us() const { return 10000000ull / config_.baud; }
+
+    uint64_t seconds(gnss_level level) const
+    {
+        const double s[] = {config_.cold_s, config_.warm_s, config_.epo_time_s, config_.epo_s, config_.hot_s};
+        return uint64_t(s[int(level)] * factor_ * 1e6);
+    }
+
+    uint32_t utc_now() const { return uint32_t((utc_ms_ + (now_ - power_us_) / 1000) / 1000); }
+
+    void tick(uint64_t step)
+    {
+        // MCU to MT3333, at the line rate
+        in_credit_ += step;
+        while (!tx_.empty() && in_credit_ >= byte_us()) {
+            in_credit_ -= byte_us();
+            uint8_t b = tx_.front();
+            tx_.pop_front();
+            if (!on_ || now_ < boot_us_ || rx_.size() >= config_.rx_buffer) {
+                counters_.lost++;
+            } else {
+                rx_.push_back(b);
+            }
+        }
+        if (tx_.empty()) {
+            in_credit_ = 0;
+        }
+        if (on_ && now_ >= boot_us_) {
+            if (!booted_) {
+                booted_     = true;
+                next_epoch_ = now_;
+                send("PMTK010,001");
+            }
+            handle();
+            if (now_ >= next_epoch_) {
+                epoch();
+                next_epoch_ += 1000000;
+            }
+        }
+        // MT3333 to MCU
+        out_credit_ += step;
+        while (!out_.empty() && out_credit_ >= byte_us()) {
+            out_credit_ -= byte_us();
+            arrived_.push_back(out_.front());
+            out_.pop_front();
+        }
+        if (out_.empty()) {
+            out_credit_ = 0;
+        }
+    }
+
+    // One sentence of the receive buffer at a time
+    void handle()
+    {
+        if (now_ < busy_until_) {
+            return;
+        }
+        if (!pending_.empty()) {
+            send(pending_);
+            pending_.clear();
+        }
+        auto dollar = std::find(rx_.begin(), rx_.end(), uint8_t('$'));
+        rx_.erase(rx_.begin(), dollar);
+        auto lf = std::find(rx_.begin(), rx_.end(), uint8_t('\n'));
+        if (lf == rx_.end()) {
+            return;
+        }
+        std::string line(rx_.begin(), lf);
+        rx_.erase(rx_.begin(), lf + 1);
+
+        size_t star = line.find('*');
+        if (star == std::string::npos || star + 3 > line.size() || line.find('$', 1) != std::string::npos) {
+            counters_.bad++;
+            return;
+        }
+        uint8_t sum = 0;
+        for (size_t i = 1; i < star; i++) {
+            sum ^= uint8_t(line[i]);
+        }
+        if (std::strtoul(line.substr(star + 1, 2).c_str(), nullptr, 16) != sum) {
+            counters_.bad++;
+            return;
+        }
+        counters_.sentences++;
+        std::string body = line.substr(1, star - 1);
+        unsigned    type = 0;
+        if (std::sscanf(body.c_str(), "PMTK%u", &type) != 1) {
+            return;
+        }
+        int flag    = 3;
+        busy_until_ = now_ + config_.command_us;
+        if (type == 740) {
+            int y, mo, d, h, mi, s;
+            if (std::sscanf(body.c_str(), "PMTK740,%d,%d,%d,%d,%d,%d", &y, &mo, &d, &h, &mi, &s) != 6) {
+                flag = 1;
+            } else {
+                int64_t error = int64_t(unix_time(y, mo, d, h, mi, s)) * 1000 - int64_t(utc_now()) * 1000;
+                counters_.time |= std::llabs(error) <= config_.time_tolerance_ms;
+            }
+        } else if (type == 713) {
+            counters_.position = std::count(body.begin(), body.end(), ',') == 7;
+            flag               = counters_.position ? 3 : 1;
+        } else if (type == 721) {
+            busy_until_ = now_ + config_.epo_us;
+            if (std::count(body.begin(), body.end(), ',') == 19) {
+                counters_.epo++;
+            } else {
+                flag = 1;
+            }
+        } else {
+            flag = 1;
+        }
+        if (type == 740 || type == 713 || type == 721) {
+            counters_.assist_us = busy_until_ - power_us_;
+            assisted(busy_until_);
+        }
+        char ack[32];
+        std::snprintf(ack, sizeof(ack), "PMTK001,%u,%d", type, flag);
+        pending_ = ack;
+    }
+
+    void assisted(uint64_t at)
+    {
+        gnss_level level = gnss_level::cold;
+        if (counters_.boot_level == gnss_level::hot) {
+            level = gnss_level::hot;
+        } else if (counters_.time && counters_.epo >= config_.epo_min) {
+            level = counters_.position ? gnss_level::epo : gnss_level::epo_time;
+        } else if (counters_.time && counters_.position) {
+            level = gnss_level::warm;
+        }
+        if (level > counters_.level) {
+            counters_.level = level;
+            fix_at_         = std::min(fix_at_, at + seconds(level));
+        }
+    }
+
+    void epoch()
+    {
+        uint32_t utc   = utc_now();
+        bool     fixed = now_ >= fix_at_;
+        char     t[16], lat[24], lon[24], body[120];
+        std::snprintf(t, sizeof(t), "%02u%02u%02u.000", utc / 3600 % 24, utc / 60 % 60, utc % 60);
+        if (fixed) {
+            if (counters_.fix_us == 0) {
+                counters_.fix_us = now_ - power_us_;
+            }
+            coordinate(lat, sizeof(lat), lat_, 2, "NS");
+            coordinate(lon, sizeof(lon), lon_, 3, "EW");
+            std::snprintf(body, sizeof(body), "GPGGA,%s,%s,%s,1,08,1.10,%d.0,M,0.0,M,,", t, lat, lon, int(alt_m_));
+            send(body);
+            std::snprintf(body, sizeof(body), "GPRMC,%s,A,%s,%s,0.00,0.00,,,,A", t, lat, lon);
+            send(body);
+            send("GPGSA,A,3,02,05,06,12,15,19,24,25,,,,,1.90,1.10,1.55");
+        } else {
+            std::snprintf(body, sizeof(body), "GPGGA,%s,,,,,0,00,,,M,,M,,", t);
+            send(body);
+            std::snprintf(body, sizeof(body), "GPRMC,%s,V,,,,,0.00,0.00,,,,N", t);
+            send(body);
+            send("GPGSA,A,1,,,,,,,,,,,,,,,");
+        }
+        send("GPGSV,1,1,04,02,45,120,38,05,30,250,35,12,60,045,41,25,15,300,29");
+    }
+
+    static void coordinate(char* out, size_t size, int32_t value, int degree_digits, const char* hemispheres)
+    {
+        uint64_t magnitude = uint64_t(std::llabs(int64_t(value)));
+        uint64_t degrees   = magnitude / 10000000;
+        uint64_t minutes   = (magnitude % 10000000) * 60;  // 1e-7 minutes
+        std::snprintf(out, size, "%0*u%02u.%04u,%c", degree_digits, unsigned(degrees), unsigned(minutes / 10000000),
+                      unsigned(minutes % 10000000 / 1000), hemispheres[value < 0]);
+    }
+
+    void send(const std::string& body)
+    {
+        uint8_t sum = 0;
+        for (char c : body) {
+            sum ^= uint8_t(c);
+        }
+        char end[8];
+        std::snprintf(end, sizeof(end), "*%02X\r\n", unsigned(sum));
+        out_.push_back('$');
+        out_.insert(out_.end(), body.begin(), body.end());
+        out_.insert(out_.end(), end, end + 5);
+    }
+
+    static uint32_t unix_time(int y, int mo, int d, int h, int mi, int s)
+    {
+        // Days from civil (H. Hinnant)
+        y -= mo <= 2;
+        int      era  = (y >= 0 ? y : y - 399) / 400;
+        unsigned yoe  = unsigned(y - era * 400);
+        unsigned doy  = unsigned((153 * (mo + (mo > 2 ? -3 : 9)) + 2) / 5 + d - 1);
+        unsigned doe  = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        int64_t  days = int64_t(era) * 146097 + int64_t(doe) - 719468;
+        return uint32_t(days * 86400 + h * 3600 + mi * 60 + s);
+    }
+
+    mt3333_gnss_sim_config   config_;
+    mt3333_gnss_sim_counters counters_;
+    uint64_t                 now_        = 0;
+    uint64_t                 power_us_   = 0;
+    uint64_t                 boot_us_    = 0;
+    uint64_t                 busy_until_ = 0;
+    uint64_t                 fix_at_     = 0;
+    uint64_t                 next_epoch_ = 0;
+    uint64_t                 in_credit_  = 0;
+    uint64_t                 out_credit_ = 0;
+    uint64_t                 utc_ms_     = 0;
+    int32_t                  lat_ = 0, lon_ = 0, alt_m_ = 0;
+    double                   factor_ = 1;
+    bool                     on_     = false;
+    bool                     booted_ = false;
+    std::string              pending_;  // Ack sent when the sentence is handled
+    std::deque<uint8_t>      tx_, rx_, out_, arrived_;
+};
+
+}  // namespace abw
+
+#endif  // MT3333_GNSS_SIM_HPP
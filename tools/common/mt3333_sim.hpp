@@ -0,0 +1,469 @@
+/*!
+ * \file      mt3333_sim.hpp
+ *
+ * \brief     Stand-in for an MT3333 in download mode, boot ROM and DA, on the master side of a pty
+ *
+ * The model follows the protocol of abw_mt3333.hpp: BROM handshake,
+ * SEND_DA and JUMP_DA, then the DA commands SPEED, FORMAT, WRITE, CHECKSUM
+ * and FINISH on a model of the flash. The DA received must be the expected
+ * one (da), or the chip stays silent after JUMP_DA.
+ *
+ * The line is modelled as in mfg_cli_sim.hpp: the stand-in reads the rate
+ * the host set on the slave side and garbles every byte while the two sides
+ * do not agree; up to clean_baud the line is error free, up to
+ * marginal_baud bytes are corrupted at marginal_error, above it nothing
+ * gets through. Reads are paced at the line rate. Each answer reaches the
+ * host turnaround_us after it is due (USB adapter and host scheduling).
+ *
+ * The DA programs a packet while the next ones arrive, in a receive buffer
+ * of rx_buffer bytes: a packet that would not fit is lost and answered
+ * NACK. Program, erase and read times are per KiB or per block of flash.
+ */
+
+#ifndef MT3333_SIM_HPP
+#define MT3333_SIM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_mt3333.hpp"
+#include "abw_serial.hpp"
+
+namespace abw {
+
+struct mt3333_sim_config {
+    const uint8_t* da                 = nullptr;  //!< DA expected from the host
+    size_t         da_size            = 0;
+    uint32_t       flash_id           = 0xC84014;  //!< JEDEC ID, 8 Mbit
+    uint32_t       flash_size         = 0x100000;
+    uint32_t       clean_baud         = 921600;  //!< Highest error-free rate
+    uint32_t       marginal_baud      = 921600;  //!< Highest rate that works at all
+    double         marginal_error     = 2e-4;    //!< Byte error rate between the two
+    uint32_t       turnaround_us      = 2000;    //!< Delay of each answer
+    uint32_t       rx_buffer          = 4096;    //!< DA receive buffer
+    uint32_t       program_us_per_kib = 2500;
+    uint32_t       erase_us_per_block = 150000;  //!< 64 KiB block erase
+    uint32_t       read_us_per_kib    = 100;
+    uint32_t       seed               = 1;
+    bool           pacing             = true;  //!< Model line, flash and turnaround time
+};
+
+struct mt3333_sim_counters {
+    uint32_t handshakes = 0;
+    uint32_t da_loads   = 0;  //!< DA received intact
+    uint32_t speeds     = 0;  //!< Speed changes committed
+    uint32_t reverts    = 0;  //!< Speed changes abandoned
+    uint32_t packets    = 0;  //!< Packets programmed
+    uint32_t nacks      = 0;
+    uint32_t overflows  = 0;  //!< Packets lost to a full receive buffer
+    uint32_t garbled    = 0;
+    bool     finished   = false;  //!< FINISH received, the new ROM boots
+};
+
+class mt3333_sim {
+public:
+    mt3333_sim(serial_port& line, const std::string& slave_path, const mt3333_sim_config& config)
+        : line_(line), config_(config), flash_(config.flash_size, 0xFF), rng_(config.seed)
+    {
+        // Own descriptor on the slave, only to read the rate set by the host
+        host_ = serial_port(slave_path, mt3333::brom_baud);
+    }
+
+    const mt3333_sim_counters&  counters() const { return counters_; }
+    const std::vector<uint8_t>& flash() const { return flash_; }
+
+    /*!
+     * \brief Serve the download until stop is set or FINISH
+     */
+    void run(const std::atomic<bool>& stop)
+    {
+        stop_ = &stop;
+        try {
+            if (brom()) {
+                da();
+            }
+            flush_out(true);
+        } catch (const stopped&) {
+        }
+    }
+
+private:
+    struct stopped {
+    };
+
+    using clock_type = std::chrono::steady_clock;
+
+    struct answer {
+        clock_type::time_point due;
+        std::vector<uint8_t>   bytes;
+    };
+
+    /*!
+     * \brief Handshake and BROM commands, true once a good DA runs
+     */
+    bool brom()
+    {
+        for (unsigned step = 0; step < 4;) {
+            uint8_t b = get();
+            if (b == mt3333::brom_sync[step]) {
+                put(uint8_t(~b));
+                step++;
+            } else if (b == mt3333::brom_sync[0]) {
+                put(uint8_t(~b));
+                step = 1;
+            } else {
+                step = 0;
+            }
+        }
+        counters_.handshakes++;
+
+        bool da_ok = false;
+        for (;;) {
+            uint8_t cmd = get();
+            if (cmd == mt3333::send_da) {
+                put(cmd);
+                uint32_t address = echo_word();
+                uint32_t len     = echo_word();
+                echo_word();
+                put_be(0, 2);
+                std::vector<uint8_t> da(len);
+                for (auto& b : da) {
+                    b = get();
+                }
+                put_be(mt3333_xor16(da.data(), da.size()), 2);
+                put_be(0, 2);
+                da_ok = address == mt3333::da_address && config_.da &&
+                        std::equal(da.begin(), da.end(), config_.da, config_.da + config_.da_size) &&
+                        len == config_.da_size;
+                counters_.da_loads += da_ok;
+            } else if (cmd == mt3333::jump_da) {
+                put(cmd);
+                echo_word();
+                put_be(0, 2);
+                if (!da_ok) {
+                    return false;
+                }
+                put(mt3333::sync);
+                put_be(config_.flash_id, 3);
+                put_be(config_.flash_size, 4);
+                put(mt3333::ack);
+                return true;
+            }
+        }
+    }
+
+    void da()
+    {
+        for (;;) {
+            uint8_t cmd = get();
+            if (cmd == mt3333::sync) {
+                put(cmd);
+            } else if (cmd == mt3333::speed) {
+                uint8_t  index = get();
+                uint32_t probe = get_be(2);
+                if (index >= sizeof(mt3333::speeds) / sizeof(mt3333::speeds[0]) || probe == 0) {
+                    put(mt3333::nack);
+                    continue;
+                }
+                put(mt3333::ack);
+                flush_out(true);
+                change_speed(mt3333::speeds[index], probe);
+            } else if (cmd == mt3333::format) {
+                uint32_t address = get_be(4);
+                uint32_t len     = get_be(4);
+                uint32_t first   = address / mt3333::block_size;
+                uint32_t last    = (address + len + mt3333::block_size - 1) / mt3333::block_size;
+                if (uint64_t(last) * mt3333::block_size > flash_.size()) {
+                    put(mt3333::nack);
+                    continue;
+                }
+                std::fill(flash_.begin() + long(first * mt3333::block_size),
+                          flash_.begin() + long(last * mt3333::block_size), 0xFF);
+                busy(double(last - first) * config_.erase_us_per_block);
+                put(mt3333::ack);
+            } else if (cmd == mt3333::write) {
+                uint32_t address = get_be(4);
+                uint32_t len     = get_be(4);
+                uint32_t packet  = get_be(4);
+                if (uint64_t(address) + len > flash_.size() || packet == 0 || packet + 2 > config_.rx_buffer) {
+                    put(mt3333::nack);
+                    continue;
+                }
+                put(mt3333::ack);
+                write_packets(address, len, packet);
+            } else if (cmd == mt3333::checksum) {
+                uint32_t address = get_be(4);
+                uint32_t len     = get_be(4);
+                if (uint64_t(address) + len > flash_.size()) {
+                    put(mt3333::nack);
+                    continue;
+                }
+                busy(double(len) / 1024 * config_.read_us_per_kib);
+                put_be(mt3333_sum16(flash_.data() + address, len), 2);
+                put(mt3333::ack);
+            } else if (cmd == mt3333::finish) {
+                put(mt3333::ack);
+                counters_.finished = true;
+                return;
+            }
+        }
+    }
+
+    /*!
+     * \brief Sync and probe at a new rate, back to 115200 unless the host commits
+     */
+    void change_speed(uint32_t baud, uint32_t probe)
+    {
+        baud_         = baud;
+        auto deadline = clock_type::now() + std::chrono::milliseconds(mt3333::revert_ms);
+        int  b;
+        while ((b = get_until(deadline)) >= 0 && b != mt3333::sync) {
+        }
+        if (b == mt3333::sync) {
+            put(mt3333::sync);
+            while ((b = get_until(deadline)) == mt3333::sync) {
+                put(mt3333::sync);
+            }
+            uint16_t sum = 0;
+            for (uint32_t i = 0; b >= 0 && i < probe; i++) {
+                sum = uint16_t(sum + b);
+                b   = i + 1 < probe ? get_until(clock_type::now() + std::chrono::milliseconds(200)) : 0;
+            }
+            if (b >= 0) {
+                put(mt3333::ack);
+                put_be(sum, 2);
+                if (get_until(clock_type::now() + std::chrono::milliseconds(500)) == mt3333::ack) {
+                    counters_.speeds++;
+                    return;
+                }
+            }
+        }
+        flush_out(true);
+        counters_.reverts++;
+        baud_ = mt3333::brom_baud;
+    }
+
+    /*!
+     * \brief Packets of WRITE, programmed one at a time while the next ones arrive
+     */
+    void write_packets(uint32_t address, uint32_t len, uint32_t packet)
+    {
+        std::deque<clock_type::time_point> programming;  // End of each packet received and not programmed
+        clock_type::time_point             flash_free = clock_type::now();
+        uint32_t                           done       = 0;
+
+        while (done < len) {
+            uint32_t             size = std::min(packet, len - done);
+            std::vector<uint8_t> data(size);
+            for (auto& b : data) {
+                b = get();
+            }
+            uint32_t sum = get_be(2);
+
+            auto now = clock_type::now();
+            while (!programming.empty() && programming.front() <= now) {
+                programming.pop_front();
+            }
+            bool overflow = (programming.size() + 1) * (packet + 2) > config_.rx_buffer;
+            counters_.overflows += overflow;
+            if (overflow || sum != mt3333_sum16(data.data(), data.size())) {
+                counters_.nacks++;
+                put(mt3333::nack, std::max(now, flash_free));
+                drop_until_idle();
+                continue;
+            }
+            std::copy(data.begin(), data.end(), flash_.begin() + long(address + done));
+            done += size;
+            counters_.packets++;
+
+            flash_free = std::max(now, flash_free);
+            if (config_.pacing) {
+                flash_free += std::chrono::microseconds(int64_t(double(size) / 1024 * config_.program_us_per_kib));
+            }
+            programming.push_back(flash_free);
+            put(mt3333::cont, flash_free);
+        }
+        put(mt3333::ack, flash_free);
+    }
+
+    uint32_t echo_word()
+    {
+        uint32_t value = get_be(4);
+        put_be(value, 4);
+        return value;
+    }
+
+    uint32_t get_be(int bytes)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; i++) {
+            value = value << 8 | get();
+        }
+        return value;
+    }
+
+    uint8_t get()
+    {
+        int b;
+        while ((b = get_until(clock_type::now() + std::chrono::milliseconds(50))) < 0) {
+        }
+        return uint8_t(b);
+    }
+
+    /*!
+     * \brief Next byte, -1 at the deadline; sends the answers that are due meanwhile
+     */
+    int get_until(clock_type::time_point deadline)
+    {
+        for (;;) {
+            if (*stop_) {
+                throw stopped();
+            }
+            flush_out(false);
+            if (in_at_ < in_.size()) {
+                return in_[in_at_++];
+            }
+            auto now  = clock_type::now();
+            auto wake = std::min(deadline, now + std::chrono::milliseconds(50));
+            if (!out_.empty()) {
+                wake = std::min(wake, out_.front().due);
+            }
+            if (now >= deadline) {
+                return -1;
+            }
+            int     ms = int(std::chrono::duration_cast<std::chrono::microseconds>(wake - now).count() + 999) / 1000;
+            uint8_t buf[512];
+            size_t  n = line_.read(buf, sizeof(buf), std::max(ms, 0));
+            if (n) {
+                pace(n * 10e6 / baud_);
+                garble(buf, n);
+                in_.assign(buf, buf + n);
+                in_at_ = 0;
+            }
+        }
+    }
+
+    /*!
+     * \brief After a NACK: drop what the host still sends until the line is idle for 20 ms
+     */
+    void drop_until_idle()
+    {
+        in_.clear();
+        in_at_ = 0;
+        while (get_until(clock_type::now() + std::chrono::milliseconds(20)) >= 0) {
+            in_.clear();
+            in_at_ = 0;
+        }
+    }
+
+    void put(uint8_t b, clock_type::time_point due = clock_type::now()) { put_bytes({b}, due); }
+
+    void put_be(uint32_t value, int bytes)
+    {
+        std::vector<uint8_t> out;
+        for (int i = bytes - 1; i >= 0; i--) {
+            out.push_back(uint8_t(value >> (8 * i)));
+        }
+        put_bytes(out, clock_type::now());
+    }
+
+    void put_bytes(const std::vector<uint8_t>& bytes, clock_type::time_point due)
+    {
+        if (config_.pacing) {
+            due += std::chrono::microseconds(config_.turnaround_us);
+        }
+        // Answers leave in order
+        if (!out_.empty() && due < out_.back().due) {
+            due = out_.back().due;
+        }
+        out_.push_back({due, bytes});
+    }
+
+    /*!
+     * \brief Send the answers that are due, or all of them (waiting) if all is set
+     */
+    void flush_out(bool all)
+    {
+        while (!out_.empty()) {
+            if (config_.pacing && out_.front().due > clock_type::now()) {
+                if (!all) {
+                    return;
+                }
+                std::this_thread::sleep_until(out_.front().due);
+            }
+            std::vector<uint8_t>& bytes = out_.front().bytes;
+            garble(bytes.data(), bytes.size());
+            line_.write(bytes.data(), bytes.size());
+            out_.pop_front();
+        }
+    }
+
+    /*!
+     * \brief Flash time the DA spends before it reads on
+     */
+    void busy(double us)
+    {
+        if (config_.pacing) {
+            flush_out(true);
+            std::this_thread::sleep_for(std::chrono::microseconds(int64_t(us)));
+        }
+    }
+
+    double error_rate() const
+    {
+        if (tty_baud(host_.fd()) != baud_ || baud_ > config_.marginal_baud) {
+            return 1;
+        }
+        return baud_ > config_.clean_baud ? config_.marginal_error : 0;
+    }
+
+    void garble(uint8_t* p, size_t n)
+    {
+        double rate = error_rate();
+        for (size_t i = 0; rate > 0 && i < n; i++) {
+            if (rate >= 1 || std::uniform_real_distribution<double>(0, 1)(rng_) < rate) {
+                p[i] ^= uint8_t(std::uniform_int_distribution<int>(1, 255)(rng_));
+                counters_.garbled++;
+            }
+        }
+    }
+
+    /*!
+     * \brief Account for us of line time, and wait until it has elapsed
+     */
+    void pace(double us)
+    {
+        using namespace std::chrono;
+        if (!config_.pacing) {
+            return;
+        }
+        double now = double(duration_cast<microseconds>(clock_type::now() - start_).count());
+        line_us_   = (line_us_ < now ? now : line_us_) + us;
+        std::this_thread::sleep_until(start_ + microseconds(int64_t(line_us_)));
+    }
+
+    serial_port&                    line_;
+    serial_port                     host_;
+    mt3333_sim_config               config_;
+    mt3333_sim_counters             counters_;
+    std::vector<uint8_t>            flash_;
+    uint32_t                        baud_ = mt3333::brom_baud;
+    std::mt19937                    rng_;
+    const std::atomic<bool>*        stop_ = nullptr;
+    std::vector<uint8_t>            in_;
+    size_t                          in_at_ = 0;
+    std::deque<answer>              out_;
+    clock_type::time_point          start_   = clock_type::now();
+    double                          line_us_ = 0;
+};
+
+}  // namespace abw
+
+#endif  // MT3333_SIM_HPP
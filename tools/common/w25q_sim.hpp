@@ -0,0 +1,166 @@
+/*!
+ * \file      w25q_sim.hpp
+ *
+ * \brief     Simulated W25Q16JL behind the w25q::bus interface, on the clock of an lr11xx_sim
+ *
+ * The model decodes the commands used by w25q::flash (JEDEC ID, fast read,
+ * write enable, page program, sector and block erase, read status) and
+ * charges their SPI transfers and busy times to the virtual clock shared
+ * with the simulated LR11xx. Programming only clears bits, as on NOR flash.
+ *
+ * read_start() models a DMA read on the W25Q SPI: the MCU is free at once
+ * and read_wait() only waits for what is left of the transfer.
+ */
+
+#ifndef W25Q_SIM_HPP
+#define W25Q_SIM_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "lr11xx_sim.hpp"
+#include "w25q_flash.hpp"
+
+namespace abw {
+
+/*!
+ * \brief Timing model, typical W25Q16JL values, in microseconds
+ */
+struct w25q_sim_timing {
+    uint32_t spi_hz     = 32000000;  //!< SPI clock, the STM32WB limit at 64 MHz
+    uint32_t program_us = 400;       //!< tPP
+    uint32_t sector_us  = 45000;     //!< tSE
+    uint32_t block_us   = 150000;    //!< tBE2
+};
+
+class w25q_sim : public w25q::bus {
+public:
+    static constexpr uint8_t jedec_id[3] = {w25q::winbond_id, 0x40, 0x15};
+
+    w25q_sim(lr11xx_sim& clock, const w25q_sim_timing& timing = {})
+        : clock_(clock), timing_(timing), bytes_(size_t(1) << jedec_id[2], 0xFF)
+    {
+    }
+
+    bool transfer(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) override
+    {
+        wait_dma();
+        clock_.advance(spi_us(tx_len + rx_len));
+        return execute(tx, tx_len, rx, rx_len);
+    }
+
+    bool read_start(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) override
+    {
+        wait_dma();
+        dma_until_ = uint64_t(clock_.now_us()) + spi_us(tx_len + rx_len);
+        return execute(tx, tx_len, rx, rx_len);
+    }
+
+    bool read_wait() override
+    {
+        wait_dma();
+        return true;
+    }
+
+    uint32_t now_us() override { return clock_.now_us(); }
+
+    /*!
+     * \brief Direct access to the array, e.g. to corrupt a stored image
+     */
+    std::vector<uint8_t>& bytes() { return bytes_; }
+
+    uint32_t programs() const { return programs_; }
+    uint32_t erases() const { return erases_; }
+
+private:
+    uint32_t spi_us(size_t bytes) const
+    {
+        return uint32_t((uint64_t(bytes) * 8 * 1000000 + timing_.spi_hz - 1) / timing_.spi_hz);
+    }
+
+    void wait_dma()
+    {
+        if (dma_until_ > clock_.now_us()) {
+            clock_.advance(uint32_t(dma_until_ - clock_.now_us()));
+        }
+        dma_until_ = 0;
+    }
+
+    bool busy() { return clock_.now_us() < busy_until_; }
+
+    bool execute(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len)
+    {
+        if (tx_len == 0) {
+            return false;
+        }
+        uint8_t  opcode  = tx[0];
+        uint32_t address = tx_len >= 4 ? uint32_t(tx[1]) << 16 | uint32_t(tx[2]) << 8 | tx[3] : 0;
+
+        if (opcode == w25q::read_status_oc) {
+            if (rx_len) {
+                std::memset(rx, busy() ? w25q::status_busy : 0, rx_len);
+            }
+            return true;
+        }
+        if (busy()) {
+            return true;  // Ignored by the chip, as everything but Read Status
+        }
+        switch (opcode) {
+        case w25q::read_jedec_id_oc:
+            for (size_t i = 0; i < rx_len; i++) {
+                rx[i] = i < sizeof(jedec_id) ? jedec_id[i] : 0;
+            }
+            return true;
+        case w25q::fast_read_oc:
+            for (size_t i = 0; i < rx_len; i++) {
+                rx[i] = bytes_[(address + i) % bytes_.size()];
+            }
+            return tx_len == 5;
+        case w25q::write_enable_oc:
+            write_enabled_ = true;
+            return true;
+        case w25q::page_program_oc:
+            if (write_enabled_ && tx_len >= 4) {
+                // Within one page, wrapping at its end
+                uint32_t page = address & ~(w25q::page_size - 1);
+                for (size_t i = 4; i < tx_len; i++) {
+                    bytes_[page + ((address + i - 4) % w25q::page_size)] &= tx[i];
+                }
+                programs_++;
+                start(timing_.program_us);
+            }
+            return true;
+        case w25q::sector_erase_oc:
+        case w25q::block_erase_oc:
+            if (write_enabled_ && tx_len == 4) {
+                uint32_t size = opcode == w25q::sector_erase_oc ? w25q::sector_size : w25q::block_size;
+                std::memset(&bytes_[address & ~(size - 1)], 0xFF, size);
+                erases_++;
+                start(opcode == w25q::sector_erase_oc ? timing_.sector_us : timing_.block_us);
+            }
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    void start(uint32_t us)
+    {
+        write_enabled_ = false;
+        busy_until_    = uint64_t(clock_.now_us()) + us;
+    }
+
+    lr11xx_sim&          clock_;
+    w25q_sim_timing      timing_;
+    std::vector<uint8_t> bytes_;
+    bool                 write_enabled_ = false;
+    uint64_t             busy_until_    = 0;
+    uint64_t             dma_until_     = 0;
+    uint32_t             programs_      = 0;
+    uint32_t             erases_        = 0;
+};
+
+}  // namespace abw
+
+#endif  // W25Q_SIM_HPP
@@ -0,0 +1,540 @@
+/*!
+ * \file      lr11xx_almanac_tool.cpp
+ *
+ * \brief     GPS and BeiDou almanac for the LR11xx: blob encoder, bulk upload and line-by-line upload
+ *
+ * Usage:
+ *   lr11xx-almanac encode   <entries.txt> <almanac.bin>
+ *   lr11xx-almanac upload   [options] <tty> <almanac.bin>
+ *   lr11xx-almanac text     [options] <tty> <entries.txt>
+ *   lr11xx-almanac loopback [options] [--command-us N] [--write-us N] [--entry-us N] [--fast] [entries.txt]
+ *
+ * Options:
+ *   --password PIN   MFG CLI password (default 456)
+ *   --depth N        Commands of the text path typed ahead of their answers (default 8)
+ *   --window N       Bytes of the text path typed ahead of their answers (default 128)
+ *   --baud N         CLI rate (default 57600)
+ *
+ * An entries file has one satellite per line, "gps" or "beidou", then the
+ * fields of "gnss almanac set": "gps 12,2388,0x2A1F03,...". Words may be
+ * decimal or 0x hex; '#' starts a comment.
+ *
+ * encode checks every entry, satellite ID in range (GPS 1-32, BeiDou 1-63),
+ * no satellite twice and words of 24 bits, naming the line at fault, and
+ * writes the blob of lib/lr11xx/lr11xx_almanac.hpp: GPS and BeiDou entries
+ * packed after a header, under a CRC-32. upload logs in to the MFG CLI,
+ * types "gnss almanac load" and sends the blob over XMODEM in one transfer;
+ * the board checks it as a whole and writes it to the LR11xx in batches.
+ * text sends the GPS entries the way the MFG firmware takes them today, one
+ * "gnss almanac set" per satellite, the last one with END; the firmware has
+ * no BeiDou path, so BeiDou entries are left out.
+ *
+ * loopback runs both paths against the board of tools/common/mfg_cli_sim.hpp
+ * with the almanac commands of mfg_cli_sim_almanac.hpp, on a pty, with the
+ * entries given or a generated almanac of 32 GPS and 46 BeiDou satellites.
+ * The text path runs one round trip at a time, then pipelined; the load
+ * path with the GPS entries alone, then with both constellations. Each run
+ * starts on a fresh board and must leave the entries sent in its LR11xx. The board takes --command-us for each command
+ * (default 1000), and the LR11xx --write-us per almanac write (default
+ * 3000) plus --entry-us per entry (default 300), and the line is paced at
+ * --baud. --fast turns off the timing model.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "abw_mfg_cli.hpp"
+#include "abw_serial.hpp"
+#include "abw_xmodem.hpp"
+#include "lr11xx_almanac.hpp"
+#include "mfg_cli_sim.hpp"
+#include "mfg_cli_sim_almanac.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+using lr11xx::almanac::constellation;
+using lr11xx::almanac::entry;
+
+struct upload_options {
+    std::string password = "456";
+    unsigned    depth    = 8;
+    size_t      window   = 128;
+    uint32_t    baud     = abw::mfg_cli::default_baud;
+};
+
+/*!
+ * \brief Outcome of one upload
+ */
+struct upload_result {
+    size_t      entries  = 0;
+    size_t      commands = 0;
+    uint64_t    sent     = 0;  //!< Bytes sent to the board
+    double      seconds  = 0;
+    std::string board;  //!< Last answer of the board
+};
+
+int usage()
+{
+    std::cerr << "usage: lr11xx-almanac encode   <entries.txt> <almanac.bin>\n"
+                 "       lr11xx-almanac upload   [options] <tty> <almanac.bin>\n"
+                 "       lr11xx-almanac text     [options] <tty> <entries.txt>\n"
+                 "       lr11xx-almanac loopback [options] [--command-us N] [--write-us N] [--entry-us N] [--fast] "
+                 "[entries.txt]\n";
+    return 2;
+}
+
+std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* fmt, ...)
+{
+    char    line[256];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    return line;
+}
+
+double seconds_since(clock_type::time_point start)
+{
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+bool number(const std::string& text, unsigned long& value)
+{
+    char* end;
+    value = std::strtoul(text.c_str(), &end, 0);
+    return !text.empty() && text[0] != '-' && *end == '\0';
+}
+
+/*!
+ * \brief Entries of a text file, throws std::runtime_error naming the first line at fault
+ */
+std::vector<entry> read_entries(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    std::vector<entry> entries;
+    std::string        line;
+    for (unsigned line_number = 1; std::getline(in, line); line_number++) {
+        auto fail = [&](const std::string& why) {
+            throw std::runtime_error(format("%s:%u: ", path.c_str(), line_number) + why);
+        };
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string        system;
+        std::string        fields;
+        std::string        extra;
+        if (!(words >> system)) {
+            continue;
+        }
+        if ((system != "gps" && system != "beidou") || !(words >> fields) || (words >> extra)) {
+            fail("expected \"gps|beidou sid,week,word0,..word7\"");
+        }
+
+        std::vector<std::string> values;
+        std::istringstream       list(fields);
+        for (std::string value; std::getline(list, value, ',');) {
+            values.push_back(value);
+        }
+        if (values.size() != 10) {
+            fail(format("%zu fields, expected sid, week and 8 words", values.size()));
+        }
+
+        entry         e;
+        unsigned long value;
+        e.constellation = system == "gps" ? constellation::gps : constellation::beidou;
+        if (!number(values[0], value) || value == 0 || value > lr11xx::almanac::satellites(e.constellation)) {
+            fail(format("satellite ID %s not in range (%s 1-%u)", values[0].c_str(), system.c_str(),
+                        unsigned(lr11xx::almanac::satellites(e.constellation))));
+        }
+        e.sid = uint8_t(value);
+        if (!number(values[1], value) || value > 0xFFFF) {
+            fail("invalid week " + values[1]);
+        }
+        e.week = uint16_t(value);
+        for (unsigned i = 0; i < 8; i++) {
+            if (!number(values[2 + i], value) || value > lr11xx::almanac::word_mask) {
+                fail(format("word%u %s is not a 24-bit value", i, values[2 + i].c_str()));
+            }
+            e.words[i] = uint32_t(value);
+        }
+        for (const auto& other : entries) {
+            if (other.constellation == e.constellation && other.sid == e.sid) {
+                fail(format("%s satellite %u given twice", system.c_str(), unsigned(e.sid)));
+            }
+        }
+        entries.push_back(e);
+    }
+    return entries;
+}
+
+std::vector<uint8_t> encode_entries(const std::vector<entry>& entries)
+{
+    std::vector<uint8_t>    blob(lr11xx::almanac::encoded_size(entries.size()));
+    size_t                  len;
+    lr11xx::almanac::status s = lr11xx::almanac::encode(entries.data(), entries.size(), blob.data(), blob.size(), len);
+    if (s != lr11xx::almanac::status::ok) {
+        throw std::runtime_error(std::string("cannot encode the almanac: ") + lr11xx::almanac::status_name(s));
+    }
+    return blob;
+}
+
+/*!
+ * \brief "gnss almanac set" lines of the GPS entries, END on the last one
+ */
+std::vector<std::string> text_commands(const std::vector<entry>& entries)
+{
+    std::vector<std::string> lines;
+    for (const auto& e : entries) {
+        if (e.constellation != constellation::gps) {
+            continue;
+        }
+        std::string line = format("gnss almanac set %u,%u", unsigned(e.sid), unsigned(e.week));
+        for (uint32_t w : e.words) {
+            line += format(",0x%06X", unsigned(w));
+        }
+        lines.push_back(line);
+    }
+    if (!lines.empty()) {
+        lines.back() += " END";
+    }
+    return lines;
+}
+
+size_t gps_entries(const std::vector<entry>& entries)
+{
+    size_t n = 0;
+    for (const auto& e : entries) {
+        n += e.constellation == constellation::gps;
+    }
+    return n;
+}
+
+/*!
+ * \brief Last line of a command output before its status line
+ */
+std::string last_line(const std::string& output)
+{
+    std::istringstream in(output);
+    std::string        last;
+    for (std::string line; std::getline(in, line);) {
+        while (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty() && line != "OK" && line != "ERROR") {
+            last = line;
+        }
+    }
+    return last;
+}
+
+void encode(const std::string& in, const std::string& out)
+{
+    std::vector<entry>   entries = read_entries(in);
+    std::vector<uint8_t> blob    = encode_entries(entries);
+    size_t               text    = 0;
+    for (const auto& line : text_commands(entries)) {
+        text += line.size() + 1;
+    }
+    abw::write_file(out, blob);
+    std::printf("%zu GPS, %zu BeiDou: %zu bytes, CRC-32 checked on the board (text path: %zu bytes for the GPS "
+                "entries)\n",
+                gps_entries(entries), entries.size() - gps_entries(entries), blob.size(), text);
+}
+
+/*!
+ * \brief Wait for the announcement of the XMODEM receiver, read byte by byte to leave its first poll on the line
+ */
+void wait_start(abw::serial_port& port)
+{
+    std::string text;
+    auto        end = clock_type::now() + std::chrono::seconds(5);
+    while (text.find("Start xmodem") == std::string::npos || text.back() != '\n') {
+        char c;
+        if (clock_type::now() > end) {
+            throw std::runtime_error("no \"Start xmodem\" after gnss almanac load, got \"" + text + "\"");
+        }
+        if (port.read(&c, 1, 100)) {
+            text += c;
+        }
+    }
+}
+
+upload_result upload_blob(const std::string& tty, const std::vector<uint8_t>& blob, const upload_options& options)
+{
+    uint32_t gps;
+    uint32_t beidou;
+    auto     s = lr11xx::almanac::check(blob.data(), blob.size(), gps, beidou);
+    if (s != lr11xx::almanac::status::ok) {
+        throw std::runtime_error(std::string("not an almanac blob: ") + lr11xx::almanac::status_name(s));
+    }
+
+    abw::serial_port port(tty, options.baud);
+    abw::mfg_cli     cli(port);
+    cli.login(options.password);
+
+    upload_result     result;
+    const std::string command = "gnss almanac load";
+    auto              start   = clock_type::now();
+    cli.send(command);
+    wait_start(port);
+
+    abw::xmodem_options xopt;
+    xopt.start_timeout_ms = 3000;
+    xopt.ack_timeout_ms   = 2000;
+    abw::xmodem_sender sender(blob.data(), blob.size(), xopt);
+    if (!abw::xmodem_send(port, sender)) {
+        throw std::runtime_error("XMODEM transfer failed");
+    }
+    std::string output = cli.read_prompt(10000);
+    output             = output.substr(0, output.find_last_of("\r\n") + 1);  // Prompt left out
+    result.seconds     = seconds_since(start);
+    result.entries     = size_t(gps) + beidou;
+    result.commands    = 1;
+    result.sent        = command.size() + 1 + sender.stats().wire_bytes;
+    result.board       = last_line(output);
+    if (!abw::mfg_cli::ok(output)) {
+        throw std::runtime_error("board refused the almanac: " + result.board);
+    }
+    return result;
+}
+
+upload_result upload_text(const std::string& tty, const std::vector<entry>& entries, const upload_options& options)
+{
+    std::vector<std::string> lines = text_commands(entries);
+    if (lines.empty()) {
+        throw std::runtime_error("no GPS entry to send");
+    }
+
+    abw::serial_port port(tty, options.baud);
+    abw::mfg_cli     cli(port);
+    cli.login(options.password);
+
+    upload_result result;
+    auto          start   = clock_type::now();
+    auto          replies = cli.run(lines, options.depth, options.window);
+    result.seconds        = seconds_since(start);
+    for (const auto& reply : replies) {
+        if (!reply.ok || reply.output.find("GPS almanac set success") == std::string::npos) {
+            throw std::runtime_error("\"" + reply.command + "\" failed: " + last_line(reply.output));
+        }
+        result.sent += reply.command.size() + 1;
+    }
+    result.entries  = lines.size();
+    result.commands = lines.size();
+    result.board    = last_line(replies.back().output);
+    return result;
+}
+
+/*!
+ * \brief 32 GPS and 46 BeiDou satellites, fixed by the seed
+ */
+std::vector<entry> generated_almanac(uint32_t seed)
+{
+    std::mt19937       rng(seed);
+    std::vector<entry> entries;
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned sid = 1; sid <= (c == 0 ? 32u : 46u); sid++) {
+            entry e;
+            e.constellation = constellation(c);
+            e.sid           = uint8_t(sid);
+            e.week          = uint16_t(c == 0 ? 2388 : 1032);
+            for (auto& w : e.words) {
+                w = rng() & lr11xx::almanac::word_mask;
+            }
+            entries.push_back(e);
+        }
+    }
+    return entries;
+}
+
+bool same_entry(const entry& a, const entry& b)
+{
+    return a.constellation == b.constellation && a.sid == b.sid && a.week == b.week &&
+           std::equal(std::begin(a.words), std::end(a.words), std::begin(b.words));
+}
+
+/*!
+ * \brief Run one upload against a fresh simulated board, and check the almanac it leaves in the LR11xx
+ */
+template <typename Upload>
+upload_result on_board(const abw::mfg_cli_sim_config& config, const abw::mfg_cli_almanac_config& lr11xx,
+                       const std::vector<entry>& expected, Upload upload, abw::mfg_cli_almanac_counters& counters)
+{
+    abw::pty_pair        pty(config.cli_baud);
+    std::atomic<bool>    stop(false);
+    abw::mfg_cli_sim     board(pty.master, pty.slave_path, config);
+    abw::mfg_cli_almanac almanac(board, lr11xx);
+    std::thread          thread([&] { board.run(stop); });
+    upload_result        result;
+    try {
+        result = upload(pty.slave_path);
+    } catch (...) {
+        stop = true;
+        thread.join();
+        throw;
+    }
+    stop = true;
+    thread.join();
+
+    counters       = almanac.counters();
+    size_t written = 0;
+    for (const auto& e : almanac.almanac()) {
+        written += e.sid != 0;
+    }
+    bool ok = written == expected.size();
+    for (const auto& e : expected) {
+        size_t at = (e.constellation == constellation::gps ? 0 : lr11xx::almanac::gps_satellites) + e.sid - 1;
+        ok        = ok && same_entry(almanac.almanac()[at], e);
+    }
+    if (!ok || counters.updates != 1) {
+        throw std::runtime_error(format("board almanac differs: %zu entries written for %zu sent", written,
+                                        expected.size()));
+    }
+    return result;
+}
+
+void loopback(const std::vector<entry>& entries, const upload_options& options, const abw::mfg_cli_sim_config& config,
+              const abw::mfg_cli_almanac_config& lr11xx)
+{
+    std::vector<entry> gps;
+    for (const auto& e : entries) {
+        if (e.constellation == constellation::gps) {
+            gps.push_back(e);
+        }
+    }
+    std::printf("%zu GPS, %zu BeiDou entries, %u baud, %u us per command, %u us per LR11xx write + %u us per "
+                "entry%s\n",
+                gps.size(), entries.size() - gps.size(), unsigned(config.cli_baud), unsigned(config.command_us),
+                unsigned(lr11xx.write_us), unsigned(lr11xx.entry_us),
+                config.pacing ? "" : ", unpaced");
+    std::printf("%-26s %7s %8s %10s %6s %8s %8s %7s\n", "path", "entries", "commands", "bytes sent", "writes",
+                "time (s)", "ms/entry", "vs text");
+
+    // Writes include the one closing the update; the gain is per entry, against the first text run
+    double text_ms = 0;
+    auto   row     = [&](const std::string& name, const upload_result& r, const abw::mfg_cli_almanac_counters& c) {
+        double ms = 1000 * r.seconds / double(r.entries);
+        text_ms   = text_ms == 0 ? ms : text_ms;
+        std::printf("%-26s %7zu %8zu %10llu %6u %8.3f %8.2f %6.1fx\n", name.c_str(), r.entries, r.commands,
+                    (unsigned long long)r.sent, unsigned(c.writes + c.updates), r.seconds, ms,
+                    text_ms / ms);
+    };
+    abw::mfg_cli_almanac_counters counters;
+
+    if (!gps.empty()) {
+        upload_options sequential = options;
+        sequential.depth          = 1;
+        auto r = on_board(
+            config, lr11xx, gps, [&](const std::string& tty) { return upload_text(tty, gps, sequential); }, counters);
+        row("text, one round trip each", r, counters);
+        r = on_board(
+            config, lr11xx, gps, [&](const std::string& tty) { return upload_text(tty, gps, options); }, counters);
+        row(format("text, depth %u", options.depth), r, counters);
+
+        std::vector<uint8_t> blob = encode_entries(gps);
+        r = on_board(
+            config, lr11xx, gps, [&](const std::string& tty) { return upload_blob(tty, blob, options); }, counters);
+        row("load, GPS", r, counters);
+    }
+    std::vector<uint8_t> blob = encode_entries(entries);
+    auto r = on_board(
+        config, lr11xx, entries, [&](const std::string& tty) { return upload_blob(tty, blob, options); }, counters);
+    row("load, GPS and BeiDou", r, counters);
+    std::printf("board: %s\n", r.board.c_str());
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string                 cmd = argv[1];
+    upload_options              options;
+    abw::mfg_cli_sim_config     config;
+    abw::mfg_cli_almanac_config lr11xx;
+    std::vector<std::string>    args;
+
+    config.command_us = 1000;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            std::string option = argv[i];
+            if (option == "--fast") {
+                config.pacing = false;
+                continue;
+            }
+            if (option.compare(0, 2, "--") || i + 1 >= argc) {
+                args.push_back(option);
+                continue;
+            }
+            std::string value = argv[++i];
+            if (option == "--password") {
+                options.password = value;
+            } else if (option == "--depth") {
+                options.depth = unsigned(std::stoul(value));
+            } else if (option == "--window") {
+                options.window = std::stoul(value);
+            } else if (option == "--command-us") {
+                config.command_us = uint32_t(std::stoul(value));
+            } else if (option == "--write-us") {
+                lr11xx.write_us = uint32_t(std::stoul(value));
+            } else if (option == "--entry-us") {
+                lr11xx.entry_us = uint32_t(std::stoul(value));
+            } else if (option == "--baud") {
+                options.baud    = uint32_t(std::stoul(value));
+                config.cli_baud = options.baud;
+            } else {
+                std::cerr << "unknown option " << option << "\n";
+                return 2;
+            }
+        }
+
+        config.clean_baud    = std::max(config.clean_baud, config.cli_baud);
+        config.marginal_baud = std::max(config.marginal_baud, config.cli_baud);
+
+        if (cmd == "encode" && args.size() == 2) {
+            encode(args[0], args[1]);
+        } else if (cmd == "upload" && args.size() == 2) {
+            upload_result r = upload_blob(args[0], abw::read_file(args[1]), options);
+            std::printf("%s, %.2f s\n", r.board.c_str(), r.seconds);
+        } else if (cmd == "text" && args.size() == 2) {
+            std::vector<entry> entries = read_entries(args[1]);
+            if (gps_entries(entries) < entries.size()) {
+                std::printf("%zu BeiDou entries left out, the text path is GPS only\n",
+                            entries.size() - gps_entries(entries));
+            }
+            upload_result r = upload_text(args[0], entries, options);
+            std::printf("%zu entries, %.2f s\n", r.entries, r.seconds);
+        } else if (cmd == "loopback" && args.size() <= 1) {
+            loopback(args.empty() ? generated_almanac(1) : read_entries(args[0]), options, config, lr11xx);
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "lr11xx-almanac: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*!
+ * \file      lr11xx_bridge_update.cpp
+ *
+ * \brief     LR11xx update through "lr11xx firmware update bridge" with automatic speed selection
+ *
+ * Usage:
+ *   lr11xx-bridge-update update   [options] <tty> <lr11xx_image.bin>
+ *   lr11xx-bridge-update loopback [options] [--clean-baud N] [--marginal-baud N] <lr11xx_image.bin>
+ *
+ * Options:
+ *   --chip lr11xx|lr1110    CLI command prefix (default lr11xx)
+ *   --interface N           Bridge serial interface (default 2)
+ *   --password PIN          MFG CLI password (default 456)
+ *   --max-speed I           Highest bridge speed index to try (default 9, 460800 baud)
+ *   --min-speed I           Lowest bridge speed index to try (default 6, 57600 baud)
+ *   --nak-limit P           Give up on a speed above this rate of NAKs and timeouts (default 0.05)
+ *   --version 0xVVVV        Expected firmware version (default: from the file name)
+ *
+ * The tool logs in to the MFG CLI at 57600 baud and starts the bridge at
+ * the highest speed, switching the local port in step. A speed is dropped
+ * when the XMODEM handshake does not come through clean (no 'C' within
+ * the probe time, or garbage instead), or when the NAK rate goes over the
+ * limit; the next lower speed is then tried. Once a transfer completes,
+ * the port returns to 57600 baud and the firmware version is checked.
+ *
+ * loopback runs the same flow against a simulated MFG board on a pty.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "abw_mfg_cli.hpp"
+#include "abw_serial.hpp"
+#include "abw_xmodem.hpp"
+#include "mfg_cli_sim.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct bridge_options {
+    std::string chip      = "lr11xx";
+    std::string password  = "456";
+    unsigned    interface = 2;
+    unsigned    max_speed = 9;
+    unsigned    min_speed = 6;
+    double      nak_limit = 0.05;
+    uint32_t    probe_ms  = 3000;  //!< Wait for the handshake at a new speed
+    uint16_t    version   = 0;
+};
+
+int usage()
+{
+    std::cerr << "usage: lr11xx-bridge-update update   [options] <tty> <lr11xx_image.bin>\n"
+                 "       lr11xx-bridge-update loopback [options] [--clean-baud N] [--marginal-baud N] "
+                 "<lr11xx_image.bin>\n";
+    return 2;
+}
+
+double seconds_since(clock_type::time_point start)
+{
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+/*!
+ * \brief Version from a <chip>_<type>_<vvvv>.bin file name, 0 if none
+ */
+uint16_t version_from_name(const std::string& path)
+{
+    std::smatch match;
+    std::string name = abw::base_name(path);
+    if (std::regex_search(name, match, std::regex("_([0-9a-fA-F]{4})\\.bin$"))) {
+        return uint16_t(std::stoul(match[1], nullptr, 16));
+    }
+    return 0;
+}
+
+/*!
+ * \brief Get back to the CLI prompt at 57600 baud after a bridge transfer
+ */
+void resync(abw::serial_port& port, abw::mfg_cli& cli)
+{
+    port.drain();
+    port.set_baud(abw::mfg_cli::default_baud);
+    for (int i = 0; i < 15; i++) {
+        port.flush_input();
+        port.write("\r");
+        try {
+            cli.read_prompt(1000);
+            cli.read_idle(100);  // Prompts answering earlier attempts
+            return;
+        } catch (const std::runtime_error&) {
+            // The board may still be leaving the bridge
+        }
+    }
+    throw std::runtime_error("no CLI prompt after the bridge transfer");
+}
+
+/*!
+ * \brief One bridge transfer at a given speed index
+ */
+bool transfer(abw::serial_port& port, abw::mfg_cli& cli, const std::vector<uint8_t>& image, unsigned speed,
+              const bridge_options& options)
+{
+    const uint32_t baud  = abw::bridge_speeds[speed];
+    auto           start = clock_type::now();
+
+    cli.send(options.chip + " firmware update bridge " + std::to_string(options.interface) + " " +
+             std::to_string(speed));
+    try {
+        cli.read_line_with("Bootloader version", 5000);
+    } catch (const std::runtime_error&) {
+        throw std::runtime_error("the bridge did not start, is the CLI logged in as super user?");
+    }
+
+    // Whatever came after the banner was sent at the new speed
+    port.set_baud(baud);
+    port.flush_input();
+
+    abw::xmodem_options xopt;
+    xopt.start_timeout_ms = options.probe_ms;
+    xopt.ack_timeout_ms   = 2000;
+    xopt.max_retries      = 5;
+    xopt.max_noise        = 2;
+
+    abw::xmodem_sender sender(image.data(), image.size(), xopt);
+    const char*        why = nullptr;
+    abw::xmodem_send(port, sender, [&](size_t) {
+        const auto& st     = sender.stats();
+        uint32_t    errors = st.naks + st.timeouts;
+        if (!sender.finished() && errors >= 3 && errors > options.nak_limit * (st.blocks + errors)) {
+            why = "NAK rate over the limit";
+            sender.cancel();
+        }
+    });
+
+    const auto& st = sender.stats();
+    bool        ok = sender.get_state() == abw::xmodem_sender::state::done;
+    if (!ok && !why) {
+        why = !st.started ? (st.noise > xopt.max_noise ? "garbled handshake" : "no handshake") : "transfer failed";
+    }
+    double secs = seconds_since(start);
+    std::printf("%6u baud: %-24s %4u blocks %4u NAKs %7.2f s", unsigned(baud), ok ? "done" : why,
+                unsigned(st.blocks), unsigned(st.naks), secs);
+    if (ok) {
+        std::printf(" %7.0f bytes/s", image.size() / secs);
+    }
+    std::printf("\n");
+
+    resync(port, cli);
+    return ok;
+}
+
+bool update(const std::string& tty, const std::string& path, const bridge_options& options)
+{
+    std::vector<uint8_t> image = abw::read_file(path);
+    abw::serial_port     port(tty, abw::mfg_cli::default_baud);
+    abw::mfg_cli         cli(port);
+    auto                 start = clock_type::now();
+    bool                 ok    = false;
+
+    cli.login(options.password);
+    for (unsigned speed = options.max_speed + 1; !ok && speed-- > options.min_speed;) {
+        ok = transfer(port, cli, image, speed, options);
+    }
+    if (!ok) {
+        std::printf("no speed between %u and %u baud worked\n", unsigned(abw::bridge_speeds[options.min_speed]),
+                    unsigned(abw::bridge_speeds[options.max_speed]));
+        return false;
+    }
+
+    std::string output = cli.command(options.chip + " firmware version");
+    std::smatch match;
+    if (!std::regex_search(output, match, std::regex("Firmware version\\s*:\\s*0x([0-9a-fA-F]+)"))) {
+        throw std::runtime_error("unexpected version output \"" + output + "\"");
+    }
+    uint16_t version = uint16_t(std::stoul(match[1], nullptr, 16));
+    std::printf("LR11xx firmware 0x%04X, %.1f s in total\n", unsigned(version), seconds_since(start));
+    return !options.version || version == options.version;
+}
+
+bool loopback(const std::string& path, const bridge_options& options, abw::mfg_cli_sim_config config)
+{
+    std::vector<uint8_t> image = abw::read_file(path);
+    abw::pty_pair        pty(abw::mfg_cli::default_baud);
+    std::atomic<bool>    stop(false);
+
+    config.image          = image.data();
+    config.image_size     = image.size();
+    config.update_version = options.version;
+
+    abw::mfg_cli_sim board(pty.master, pty.slave_path, config);
+    std::thread      thread([&] { board.run(stop); });
+    bool             ok = false;
+    try {
+        ok = update(pty.slave_path, path, options);
+    } catch (...) {
+        stop = true;
+        thread.join();
+        throw;
+    }
+    stop = true;
+    thread.join();
+
+    const auto& c = board.counters();
+    std::printf("board: %u transfers, %u updates, %u garbled bytes\n", unsigned(c.transfers), unsigned(c.updates),
+                unsigned(c.garbled));
+    return ok && c.updates == 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd = argv[1];
+    bridge_options           options;
+    abw::mfg_cli_sim_config  config;
+    std::vector<std::string> args;
+    bool                     version_set = false;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            std::string option = argv[i];
+            if (option.compare(0, 2, "--") || i + 1 >= argc) {
+                args.push_back(option);
+                continue;
+            }
+            std::string value = argv[++i];
+            if (option == "--chip") {
+                options.chip = value;
+            } else if (option == "--interface") {
+                options.interface = unsigned(std::stoul(value));
+            } else if (option == "--password") {
+                options.password = value;
+            } else if (option == "--max-speed") {
+                options.max_speed = unsigned(std::stoul(value));
+            } else if (option == "--min-speed") {
+                options.min_speed = unsigned(std::stoul(value));
+            } else if (option == "--nak-limit") {
+                options.nak_limit = std::stod(value);
+            } else if (option == "--version") {
+                options.version = uint16_t(std::stoul(value, nullptr, 0));
+                version_set     = true;
+            } else if (option == "--clean-baud") {
+                config.clean_baud = uint32_t(std::stoul(value));
+            } else if (option == "--marginal-baud") {
+                config.marginal_baud = uint32_t(std::stoul(value));
+            } else {
+                std::cerr << "unknown option " << option << "\n";
+                return 2;
+            }
+        }
+        if (options.max_speed > 9 || options.min_speed > options.max_speed) {
+            return usage();
+        }
+        if (!version_set && !args.empty()) {
+            options.version = version_from_name(args.back());
+        }
+
+        bool ok;
+        if (cmd == "update" && args.size() == 2) {
+            ok = update(args[0], args[1], options);
+        } else if (cmd == "loopback" && args.size() == 1) {
+            ok = loopback(args[0], options, config);
+        } else {
+            return usage();
+        }
+        if (!ok) {
+            std::cerr << "lr11xx-bridge-update: update failed\n";
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "lr11xx-bridge-update: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
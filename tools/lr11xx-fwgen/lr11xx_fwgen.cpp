@@ -0,0 +1,624 @@
+/*!
+ * \file      lr11xx_fwgen.cpp
+ *
+ * \brief     Generate the C header of an LR11xx firmware image from its .bin
+ *
+ * Usage:
+ *   lr11xx-fwgen [options] <lr11xx_type_vvvv.bin>
+ *
+ * The .bin holds the image as big-endian 32-bit words. Chip, firmware type
+ * and version are taken from the Semtech file name (e.g.
+ * lr1110_transceiver_0308.bin) unless given on the command line. Without
+ * layout options the output is the Semtech header, byte for byte.
+ *
+ * With --split the image is emitted as an extern declaration header plus a
+ * single .c holding the definition, so that including the header costs
+ * nothing and the image is linked exactly once. The declaration header also
+ * carries the CRC-32 and SHA-256 of the image, for lib/crc/abw_crc32.h and
+ * lib/lr11xx/lr11xx_fw_check.hpp.
+ *
+ * Both md5sum files next to the image are checked: <bin>.md5 must match the
+ * input, and <out>.md5 must match each generated file when the reference
+ * layout is produced. A missing <bin>.md5 is an error unless --no-bin-md5 is
+ * given. A missing <out>.md5 is created once every check has passed, so a
+ * new release only needs its .bin and .bin.md5.
+ *
+ * The copyright year of the banner is that of the existing output, so that
+ * regenerating the Semtech header reproduces it; the current year for a new
+ * output.
+ *
+ * --time-build writes nothing next to the image. It generates both layouts
+ * in a temporary directory and times the compiler (--cc, default $CC or cc)
+ * on a translation unit using the image through each header, and on the .c
+ * of the split layout, --runs times each (default 10).
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "abw_carray.hpp"
+#include "abw_file.hpp"
+#include "abw_md5.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+#include "abw_sha256.h"
+}
+
+namespace {
+
+struct options {
+    std::string bin_path;
+    std::string out_path;
+    std::string chip;       // lr1110, lr1120, ...
+    std::string type;       // transceiver or modem
+    unsigned    version = 0;
+    bool        has_version = false;
+    std::string linkage;    // empty (Semtech default), "static" or "extern"
+    std::string section;
+    unsigned    align = 0;
+    bool        bytes = false;
+    bool        split = false;
+    int         year  = 0;
+    bool        no_bin_md5 = false;
+    bool        time_build = false;
+    std::string cc;         // compiler of --time-build
+    unsigned    runs = 10;
+
+    bool reference_layout() const { return linkage.empty() && section.empty() && !align && !bytes; }
+};
+
+const char* const license_text =
+    " * The Clear BSD License\n"
+    " * Copyright Semtech Corporation %d. All rights reserved.\n"
+    " *\n"
+    " * Redistribution and use in source and binary forms, with or without\n"
+    " * modification, are permitted (subject to the limitations in the disclaimer\n"
+    " * below) provided that the following conditions are met:\n"
+    " *     * Redistributions of source code must retain the above copyright\n"
+    " *       notice, this list of conditions and the following disclaimer.\n"
+    " *     * Redistributions in binary form must reproduce the above copyright\n"
+    " *       notice, this list of conditions and the following disclaimer in the\n"
+    " *       documentation and/or other materials provided with the distribution.\n"
+    " *     * Neither the name of the Semtech corporation nor the\n"
+    " *       names of its contributors may be used to endorse or promote products\n"
+    " *       derived from this software without specific prior written permission.\n"
+    " *\n"
+    " * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY\n"
+    " * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND\n"
+    " * CONTRIBUTORS \"AS IS\" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT\n"
+    " * NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A\n"
+    " * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE\n"
+    " * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR\n"
+    " * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF\n"
+    " * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS\n"
+    " * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN\n"
+    " * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)\n"
+    " * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE\n"
+    " * POSSIBILITY OF SUCH DAMAGE.\n";
+
+std::string upper(std::string s)
+{
+    for (auto& c : s) {
+        c = char(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return s;
+}
+
+std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* fmt, ...)
+{
+    char    buf[4096];
+    va_list ap;
+    va_start(ap, fmt);
+    std::vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+// Fill chip, type and version from a Semtech image name: <chip>_<type>_<vvvv>.bin
+void parse_name(options& opt)
+{
+    std::string name = abw::base_name(opt.bin_path);
+    name             = name.substr(0, name.rfind('.'));
+
+    size_t first = name.find('_');
+    size_t last  = name.rfind('_');
+    if (first != std::string::npos && last != first) {
+        if (opt.chip.empty()) {
+            opt.chip = name.substr(0, first);
+        }
+        if (opt.type.empty()) {
+            opt.type = name.substr(first + 1, last - first - 1);
+        }
+        if (!opt.has_version) {
+            opt.version     = unsigned(std::stoul(name.substr(last + 1), nullptr, 16));
+            opt.has_version = true;
+        }
+    }
+    if (opt.chip.empty() || opt.type.empty() || !opt.has_version) {
+        throw std::runtime_error("cannot infer chip/type/version from " + name + ", use --chip/--type/--version");
+    }
+    if (opt.type != "transceiver" && opt.type != "modem") {
+        throw std::runtime_error("unknown firmware type " + opt.type);
+    }
+}
+
+// Definition file of the split layout, next to the declaration header
+std::string source_path(const options& opt)
+{
+    return opt.out_path.substr(0, opt.out_path.rfind('.')) + ".c";
+}
+
+std::string array_attributes(const options& opt)
+{
+    std::string attr;
+    if (!opt.section.empty()) {
+        attr += "section(\"" + opt.section + "\")";
+    }
+    if (opt.align) {
+        attr += (attr.empty() ? "" : ", ") + format("aligned(%u)", opt.align);
+    }
+    return attr.empty() ? attr : " __attribute__((" + attr + "))";
+}
+
+std::string banner(const options& opt, const std::string& file_name, const std::string& brief)
+{
+    std::string h;
+    h += "/*!\n";
+    h += " * \\file      " + file_name + "\n";
+    h += " *\n";
+    h += " * \\brief     " + brief + "\n";
+    h += " *\n";
+    h += format(license_text, opt.year);
+    h += " */\n\n";
+    return h;
+}
+
+std::string section_title(const char* title)
+{
+    std::string line = format(" * --- %s ", title);
+    line.resize(80, '-');
+    return "/*\n"
+           " * -----------------------------------------------------------------------------\n" +
+           line + "\n */\n\n";
+}
+
+std::string image_brief(const options& opt)
+{
+    return format("Firmware %s version 0x%04x for %s radio", opt.type.c_str(), opt.version, upper(opt.chip).c_str());
+}
+
+std::string constants(const options& opt, size_t words)
+{
+    const bool trx = opt.type == "transceiver";
+    std::string h;
+
+    h += "/*!\n * \\brief Firmware version\n */\n";
+    h += format("#define LR11XX_FIRMWARE_VERSION 0x%04x\n\n", opt.version);
+    h += "/*!\n * \\brief Firmware type\n */\n";
+    h += format("#define LR11XX_FIRMWARE_UPDATE_TO %s_FIRMWARE_UPDATE_TO_%s\n\n", upper(opt.chip).c_str(),
+                trx ? "TRX" : "MODEM");
+    h += "/*!\n * \\brief Size in words of the firmware image\n */\n";
+    h += format("#define LR11XX_FIRMWARE_IMAGE_SIZE %zu\n\n", words);
+    return h;
+}
+
+// CRC-32 and SHA-256 of the image in wire byte order, i.e. of the .bin file
+std::string integrity(const std::vector<uint8_t>& bin)
+{
+    uint8_t      digest[ABW_SHA256_DIGEST_SIZE];
+    abw_sha256_t sha;
+    std::string  h;
+
+    abw_sha256_init(&sha);
+    abw_sha256_update(&sha, bin.data(), uint32_t(bin.size()));
+    abw_sha256_final(&sha, digest);
+
+    h += "/*!\n * \\brief CRC-32 (IEEE 802.3) of the image in wire byte order, see abw_crc32.h\n */\n";
+    h += format("#define LR11XX_FIRMWARE_IMAGE_CRC32 0x%08xu\n\n",
+                unsigned(abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, bin.data(), uint32_t(bin.size())))));
+    h += "/*!\n * \\brief SHA-256 of the image in wire byte order (digest of the .bin file), as an initializer list\n */\n";
+    h += "#define LR11XX_FIRMWARE_IMAGE_SHA256";
+    for (int i = 0; i < ABW_SHA256_DIGEST_SIZE; i++) {
+        h += (i % 16) ? " " : " \\\n    ";
+        h += format("0x%02x%s", digest[i], i + 1 < ABW_SHA256_DIGEST_SIZE ? "," : "");
+    }
+    h += "\n\n";
+    return h;
+}
+
+// Array definition, decl put in front of it (linkage)
+std::string array_definition(const options& opt, const std::vector<uint8_t>& bin, const std::string& decl)
+{
+    const size_t words = bin.size() / 4;
+    std::string  h;
+
+    if (opt.bytes) {
+        h += "/*!\n * \\brief Array containing the firmware image, big-endian words as sent on the wire\n */\n";
+        h += decl + "const uint8_t lr11xx_firmware_image[]" + array_attributes(opt) + " = {\n";
+        abw::append_c_bytes(h, bin.data(), words * 4);
+    } else {
+        std::vector<uint32_t> host(words);
+        for (size_t i = 0; i < words; i++) {
+            const uint8_t* b = &bin[i * 4];
+            host[i]          = uint32_t(b[0]) << 24 | uint32_t(b[1]) << 16 | uint32_t(b[2]) << 8 | b[3];
+        }
+        h += "/*!\n * \\brief Array containing the firmware image\n */\n";
+        h += decl + "const uint32_t lr11xx_firmware_image[]" + array_attributes(opt) + " = {\n";
+        abw::append_c_words(h, host.data(), host.size());
+    }
+    h += "};\n";
+    return h;
+}
+
+// Single header holding the constants and the array definition (Semtech layout)
+std::string render_header(const options& opt, const std::vector<uint8_t>& bin)
+{
+    const bool trx = opt.type == "transceiver";
+    std::string h;
+
+    h += banner(opt, format("%s_%s_%04x.h", opt.chip.c_str(), trx ? "trx" : "modem", opt.version), image_brief(opt));
+    h += "#ifndef LR11XX_FW_H\n#define LR11XX_FW_H\n\n";
+    h += section_title("DEPENDENCIES");
+    h += "#include <stdint.h>\n\n";
+    h += section_title("PUBLIC MACROS");
+    h += section_title("PUBLIC CONSTANTS");
+    h += constants(opt, bin.size() / 4);
+    h += array_definition(opt, bin, opt.linkage.empty() ? "" : opt.linkage + " ");
+    h += "\n#endif\n";
+    return h;
+}
+
+// Declaration header of the split layout
+std::string render_split_header(const options& opt, const std::vector<uint8_t>& bin)
+{
+    const char* type = opt.bytes ? "uint8_t" : "uint32_t";
+    std::string h;
+
+    h += banner(opt, abw::base_name(opt.out_path), image_brief(opt) + ", declaration");
+    h += "#ifndef LR11XX_FW_IMAGE_H\n#define LR11XX_FW_IMAGE_H\n\n";
+    h += "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n";
+    h += section_title("DEPENDENCIES");
+    h += "#include <stddef.h>\n#include <stdint.h>\n\n";
+    h += section_title("PUBLIC MACROS");
+    h += section_title("PUBLIC CONSTANTS");
+    h += constants(opt, bin.size() / 4);
+    if (opt.bytes) {
+        h += "/*!\n * \\brief The image is stored in wire order and can be sent to the LR11xx in place\n */\n";
+        h += "#define LR11XX_FIRMWARE_IMAGE_WIRE_ORDER 1\n\n";
+    }
+    h += integrity(bin);
+    h += "/*!\n * \\brief Array containing the firmware image, defined once in " +
+         abw::base_name(source_path(opt)) + "\n";
+    if (opt.bytes) {
+        h += " *\n * The image is stored as big-endian words, in the order sent on the wire.\n";
+    }
+    h += " */\n";
+    h += format("extern const %s lr11xx_firmware_image[LR11XX_FIRMWARE_IMAGE_SIZE%s];\n\n", type,
+                opt.bytes ? " * 4" : "");
+    h += section_title("PUBLIC FUNCTIONS PROTOTYPES");
+    h += "/*!\n"
+         " * \\brief Get a chunk of the firmware image\n"
+         " *\n"
+         " * \\param [in] offset Offset of the chunk in words\n"
+         " * \\param [in] count  Length of the chunk in words\n"
+         " *\n"
+         " * \\returns Pointer to the first word of the chunk, NULL if the chunk is not\n"
+         " *          entirely inside the image\n"
+         " */\n";
+    h += format("static inline const %s* lr11xx_firmware_image_chunk(uint32_t offset, uint32_t count)\n", type);
+    h += "{\n"
+         "    if ((offset > LR11XX_FIRMWARE_IMAGE_SIZE) || (count > (LR11XX_FIRMWARE_IMAGE_SIZE - offset)))\n"
+         "    {\n"
+         "        return NULL;\n"
+         "    }\n";
+    h += opt.bytes ? "    return &lr11xx_firmware_image[offset * 4];\n" : "    return &lr11xx_firmware_image[offset];\n";
+    h += "}\n\n";
+    h += "#ifdef __cplusplus\n}\n#endif\n\n#endif\n";
+    return h;
+}
+
+// Single definition of the split layout
+std::string render_split_source(const options& opt, const std::vector<uint8_t>& bin)
+{
+    std::string c;
+
+    c += banner(opt, abw::base_name(source_path(opt)), image_brief(opt) + ", definition");
+    c += section_title("DEPENDENCIES");
+    c += "#include <stdint.h>\n\n";
+    c += section_title("PUBLIC CONSTANTS");
+    // Keep C linkage, and external linkage of a const, if the .c is built as C++
+    c += array_definition(opt, bin, "#ifdef __cplusplus\nextern \"C\"\n#endif\n");
+    c += "\n/*\n"
+         " * The declaration comes after the definition on purpose: if the array does\n"
+         " * not hold exactly LR11XX_FIRMWARE_IMAGE_SIZE words the types conflict and\n"
+         " * the build fails, instead of the array being silently zero-padded.\n"
+         " */\n";
+    c += "#include \"" + abw::base_name(opt.out_path) + "\"\n";
+    return c;
+}
+
+enum class md5_check { match, mismatch, missing };
+
+// Check <path>.md5 against the digest
+md5_check check_md5(const std::string& path, const std::string& digest)
+{
+    std::string expected = abw::read_md5_file(path + ".md5");
+    if (expected.empty()) {
+        return md5_check::missing;
+    }
+    if (expected != digest) {
+        std::fprintf(stderr, "error: %s md5 %s does not match %s.md5 (%s)\n", path.c_str(), digest.c_str(),
+                     path.c_str(), expected.c_str());
+        return md5_check::mismatch;
+    }
+    return md5_check::match;
+}
+
+// Copyright year of the Semtech banner of an existing file, 0 if none
+int banner_year(const std::string& path)
+{
+    std::ifstream in(path);
+    const char*   copyright = " * Copyright Semtech Corporation ";
+    for (std::string line; std::getline(in, line);) {
+        if (line.compare(0, std::strlen(copyright), copyright) == 0) {
+            return std::atoi(line.c_str() + std::strlen(copyright));
+        }
+    }
+    return 0;
+}
+
+// Temporary directory of --time-build, removed with the files written in it
+struct scratch_dir {
+    std::string              path;
+    std::vector<std::string> files;
+
+    scratch_dir()
+    {
+        char name[] = "/tmp/lr11xx-fwgen-XXXXXX";
+        if (::mkdtemp(name) == nullptr) {
+            throw std::runtime_error("cannot create a temporary directory");
+        }
+        path = name;
+    }
+
+    ~scratch_dir()
+    {
+        for (const auto& file : files) {
+            ::unlink(file.c_str());
+        }
+        ::rmdir(path.c_str());
+    }
+
+    std::string write(const std::string& name, const std::string& text)
+    {
+        files.push_back(path + "/" + name);
+        abw::write_file(files.back(), text);
+        return files.back();
+    }
+};
+
+// Compile time of a user of the image with each layout, and of the definition of the split layout
+void time_build(const options& opt, const std::vector<uint8_t>& bin)
+{
+    using clock = std::chrono::steady_clock;
+
+    scratch_dir dir;
+    std::string stem   = abw::base_name(opt.bin_path.substr(0, opt.bin_path.rfind('.')));
+    options     single = opt;
+    options     split  = opt;
+    single.split       = false;
+    single.out_path    = dir.path + "/" + stem + ".h";
+    split.split        = true;
+    split.linkage.clear();
+    split.out_path = dir.path + "/" + stem + (opt.bytes ? "_image_wire.h" : "_image.h");
+
+    auto user = [](const options& layout) {
+        return "#include \"" + abw::base_name(layout.out_path) + "\"\n\n"
+               "const void* image_user(void)\n{\n    return lr11xx_firmware_image;\n}\n";
+    };
+    dir.write(abw::base_name(single.out_path), render_header(single, bin));
+    dir.write(abw::base_name(split.out_path), render_split_header(split, bin));
+    std::string definition = dir.write(abw::base_name(source_path(split)), render_split_source(split, bin));
+
+    const std::pair<std::string, std::string> units[] = {
+        {"includes " + abw::base_name(single.out_path), dir.write("user_single.c", user(single))},
+        {"includes " + abw::base_name(split.out_path), dir.write("user_split.c", user(split))},
+        {abw::base_name(definition) + " (built once)", definition},
+    };
+    std::string object = dir.path + "/unit.o";
+    dir.files.push_back(object);
+
+    std::printf("%s -O2 -c, mean of %u runs\n", opt.cc.c_str(), opt.runs);
+    for (const auto& unit : units) {
+        std::string command = opt.cc + " -O2 -c " + unit.second + " -o " + object;
+        double      total   = 0;
+        for (unsigned run = 0; run < opt.runs; run++) {
+            auto start = clock::now();
+            if (std::system(command.c_str()) != 0) {
+                throw std::runtime_error("failed: " + command);
+            }
+            total += std::chrono::duration<double>(clock::now() - start).count();
+        }
+        std::printf("%-48s %6.0f ms\n", unit.first.c_str(), total / opt.runs * 1e3);
+    }
+}
+
+int usage()
+{
+    std::cerr << "usage: lr11xx-fwgen [options] <image.bin>\n"
+                 "  -o <file.h>            output header (default: image name with .h)\n"
+                 "  --chip <lr11xx>        chip name (default: from the file name)\n"
+                 "  --type <transceiver|modem>\n"
+                 "  --version <hex>        firmware version (default: from the file name)\n"
+                 "  --year <yyyy>          copyright year of the Semtech banner (default: the year of the\n"
+                 "                         existing output, 2022 for the 0x0308 header, else the current year)\n"
+                 "  --no-bin-md5           accept an image without <image.bin>.md5\n"
+                 "  --linkage <static|extern>\n"
+                 "  --section <name>       place the array in a linker section\n"
+                 "  --align <bytes>        alignment of the array\n"
+                 "  --bytes                uint8_t array in .bin (wire) byte order\n"
+                 "  --split                extern declaration header plus a single-definition .c\n"
+                 "                         (default output: image name with _image.h/_image.c,\n"
+                 "                         _image_wire.h/_image_wire.c with --bytes)\n"
+                 "  --time-build           time the compiler on both layouts, write nothing\n"
+                 "  --cc <command>         compiler of --time-build (default: $CC, or cc)\n"
+                 "  --runs <n>             builds of each unit for --time-build (default: 10)\n";
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    options opt;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg  = argv[i];
+        auto        next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + arg);
+            }
+            return argv[++i];
+        };
+        try {
+            if (arg == "-o") {
+                opt.out_path = next();
+            } else if (arg == "--chip") {
+                opt.chip = next();
+            } else if (arg == "--type") {
+                opt.type = next();
+            } else if (arg == "--version") {
+                opt.version     = unsigned(std::stoul(next(), nullptr, 16));
+                opt.has_version = true;
+            } else if (arg == "--year") {
+                opt.year = std::stoi(next());
+            } else if (arg == "--linkage") {
+                opt.linkage = next();
+                if (opt.linkage != "static" && opt.linkage != "extern") {
+                    return usage();
+                }
+            } else if (arg == "--section") {
+                opt.section = next();
+            } else if (arg == "--align") {
+                opt.align = unsigned(std::stoul(next()));
+            } else if (arg == "--bytes") {
+                opt.bytes = true;
+            } else if (arg == "--split") {
+                opt.split = true;
+            } else if (arg == "--no-bin-md5") {
+                opt.no_bin_md5 = true;
+            } else if (arg == "--time-build") {
+                opt.time_build = true;
+            } else if (arg == "--cc") {
+                opt.cc = next();
+            } else if (arg == "--runs") {
+                opt.runs = std::max(1u, unsigned(std::stoul(next())));
+            } else if (arg[0] == '-' || !opt.bin_path.empty()) {
+                return usage();
+            } else {
+                opt.bin_path = arg;
+            }
+        } catch (const std::exception&) {
+            return usage();
+        }
+    }
+    if (opt.bin_path.empty()) {
+        return usage();
+    }
+
+    try {
+        parse_name(opt);
+        if (opt.split && !opt.linkage.empty()) {
+            throw std::runtime_error("--linkage cannot be combined with --split, the image has external linkage");
+        }
+        if (opt.out_path.empty()) {
+            opt.out_path = opt.bin_path.substr(0, opt.bin_path.rfind('.')) +
+                           (opt.split ? (opt.bytes ? "_image_wire.h" : "_image.h") : ".h");
+        }
+        if (!opt.year) {
+            opt.year = banner_year(opt.out_path);
+        }
+        if (!opt.year) {
+            std::time_t now = std::time(nullptr);
+            opt.year        = std::localtime(&now)->tm_year + 1900;
+        }
+
+        std::vector<uint8_t> bin = abw::read_file(opt.bin_path);
+        if (bin.empty() || (bin.size() % 4)) {
+            throw std::runtime_error(opt.bin_path + " is not a whole number of 32-bit words");
+        }
+        switch (check_md5(opt.bin_path, abw::md5_hex(bin.data(), bin.size()))) {
+        case md5_check::mismatch:
+            return 1;
+        case md5_check::missing:
+            if (!opt.no_bin_md5) {
+                std::fprintf(stderr, "error: no %s.md5 to check against, --no-bin-md5 to go on without\n",
+                             opt.bin_path.c_str());
+                return 1;
+            }
+            std::fprintf(stderr, "warning: no %s.md5, image not checked\n", opt.bin_path.c_str());
+            break;
+        case md5_check::match:
+            break;
+        }
+        if (opt.time_build) {
+            if (opt.cc.empty()) {
+                opt.cc = std::getenv("CC") ? std::getenv("CC") : "cc";
+            }
+            time_build(opt, bin);
+            return 0;
+        }
+
+        std::vector<std::pair<std::string, std::string>> outputs;
+        if (opt.split) {
+            outputs.emplace_back(opt.out_path, render_split_header(opt, bin));
+            outputs.emplace_back(source_path(opt), render_split_source(opt, bin));
+        } else {
+            outputs.emplace_back(opt.out_path, render_header(opt, bin));
+        }
+
+        // Check everything before writing anything, the missing .md5 files included
+        std::vector<std::pair<std::string, std::string>> sums;
+        for (const auto& out : outputs) {
+            std::string digest = abw::md5_hex(out.second.data(), out.second.size());
+            if (!opt.reference_layout()) {
+                std::printf("custom layout, %s.md5 not checked\n", out.first.c_str());
+                continue;
+            }
+            md5_check check = check_md5(out.first, digest);
+            if (check == md5_check::mismatch) {
+                return 1;
+            }
+            if (check == md5_check::missing) {
+                sums.emplace_back(out.first + ".md5", digest + "  " + abw::base_name(out.first) + "\n");
+            }
+        }
+        for (const auto& out : outputs) {
+            abw::write_file(out.first, out.second);
+            std::printf("%s: %zu words\n", out.first.c_str(), bin.size() / 4);
+        }
+        for (const auto& sum : sums) {
+            abw::write_file(sum.first, sum.second);
+            std::printf("created %s\n", sum.first.c_str());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "lr11xx-fwgen: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,555 @@
+/*!
+ * \file      lr11xx_update_bench.cpp
+ *
+ * \brief     Time an LR11xx update with the update engine against the simulated LR11xx
+ *
+ * Usage:
+ *   lr11xx-update-bench [--spi-hz N] [--write-us N] [--erase-us N] [--prepare-us N] [--wire-prepare-us N]
+ *                       [--run-ma X] [--sleep-ma X] [--vdd X] [--flash-spi-hz N]
+ *   lr11xx-update-bench --fuzz N [--seed N] [--jitter-us N] [--stuck P] [--corrupt P] [--reset P]
+ *   lr11xx-update-bench --power-cuts N [--cuts K] [--seed N]
+ *
+ * The engine pushes lr11xx_firmware_image (linked from the split .c) to
+ * lr11xx_sim twice: once preparing each chunk after the previous one is
+ * written, once preparing it while the LR11xx is busy. --prepare-us models
+ * the MCU time spent reading, byte-swapping and CRC-ing one 64-word chunk.
+ *
+ * A third run sends a wire-order copy of the image in place, as from a
+ * flash array generated with lr11xx-fwgen --split --bytes. Its chunks only
+ * cost the CRC of the flash bytes, --wire-prepare-us. The MCU can sleep
+ * while SPI DMA and BUSY run, so the difference in preparation time is the
+ * awake time saved; the energy follows from the run and sleep currents.
+ *
+ * Two more runs stage the wire-order image in a simulated W25Q16JL with
+ * lr11xx::image_store and stream it from there, with and without reading
+ * the next chunk ahead. --flash-spi-hz is the W25Q SPI clock. A last check
+ * fills the W25Q with small images of several targets and verifies that
+ * staging never replaces the only image of a target.
+ *
+ * With --fuzz, N updates run with injected faults (per-command
+ * probabilities). Every outcome is checked against the state of the
+ * simulated chip: the engine must report success exactly when the chip runs
+ * the new image. The exit status is non-zero on any inconsistency.
+ *
+ * With --power-cuts, N updates are each cut K times (default 1) at random
+ * times, and rerun after every power-up until they succeed. Each scenario
+ * runs twice on the same cut times: restarting from the erase every time,
+ * and resuming from the checkpoints saved in a simulated 4 KiB STM32WB flash
+ * area. Both must end with the chip running the new image.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "lr11xx_image_store.hpp"
+#include "lr11xx_sim.hpp"
+#include "lr11xx_update_engine.hpp"
+#include "w25q_sim.hpp"
+
+extern "C" {
+#include "abw_crc32.h"
+#include "lr1110_transceiver_0308_image.h"
+}
+
+namespace {
+
+// Memory source that charges the modelled MCU time of each chunk to the virtual clock
+class timed_source : public lr11xx::memory_source {
+public:
+    timed_source(abw::lr11xx_sim& sim, uint32_t prepare_us)
+        : memory_source(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE), sim_(sim), prepare_us_(prepare_us)
+    {
+    }
+
+    bool read_words(uint32_t offset, uint32_t* dst, uint32_t count) override
+    {
+        sim_.advance(prepare_us_);
+        return memory_source::read_words(offset, dst, count);
+    }
+
+private:
+    abw::lr11xx_sim& sim_;
+    uint32_t         prepare_us_;
+};
+
+// Wire-order source: chunks are sent in place, only their CRC is charged
+class timed_wire_source : public lr11xx::wire_memory_source {
+public:
+    timed_wire_source(abw::lr11xx_sim& sim, const std::vector<uint8_t>& wire, uint32_t prepare_us)
+        : wire_memory_source(wire.data(), uint32_t(wire.size() / 4)), sim_(sim), prepare_us_(prepare_us)
+    {
+    }
+
+    const uint8_t* wire_chunk(uint32_t offset, uint32_t count) override
+    {
+        sim_.advance(prepare_us_);
+        return wire_memory_source::wire_chunk(offset, count);
+    }
+
+private:
+    abw::lr11xx_sim& sim_;
+    uint32_t         prepare_us_;
+};
+
+// Stored image source: the CRC of each chunk is charged, reads cost what the W25Q model says
+class timed_store_source : public lr11xx::store_source {
+public:
+    timed_store_source(abw::lr11xx_sim& sim, w25q::flash& flash, const lr11xx::stored_image& image, bool read_ahead,
+                       uint32_t prepare_us)
+        : store_source(flash, image, read_ahead), sim_(sim), prepare_us_(prepare_us)
+    {
+    }
+
+    const uint8_t* wire_chunk(uint32_t offset, uint32_t count) override
+    {
+        sim_.advance(prepare_us_);
+        return store_source::wire_chunk(offset, count);
+    }
+
+private:
+    abw::lr11xx_sim& sim_;
+    uint32_t         prepare_us_;
+};
+
+// LR11XX_FIRMWARE_UPDATE_TO of the linked image, LR1110_FIRMWARE_UPDATE_TO_TRX in lr11xx_fw_update_t
+constexpr uint8_t image_update_to = 0;
+
+/*!
+ * \brief One update, from the host-order array or, if wire is given, from its wire-order copy
+ */
+bool run(const char* label, const abw::lr11xx_sim_timing& timing, uint32_t prepare_us, bool pipelined,
+         const std::vector<uint8_t>* wire, lr11xx::update_stats& stats)
+{
+    abw::lr11xx_sim       sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing);
+    timed_source          host_source(sim, prepare_us);
+    std::vector<uint8_t>  none;
+    timed_wire_source     wire_source(sim, wire ? *wire : none, prepare_us);
+    lr11xx::update_engine engine(sim, wire ? static_cast<lr11xx::image_source&>(wire_source) : host_source);
+    lr11xx::update_config config;
+
+    config.image_words      = LR11XX_FIRMWARE_IMAGE_SIZE;
+    config.expected_version = LR11XX_FIRMWARE_VERSION;
+    config.check_crc        = true;
+    config.expected_crc     = LR11XX_FIRMWARE_IMAGE_CRC32;
+    config.pipelined        = pipelined;
+
+    lr11xx::update_status status = engine.run(config);
+    const auto&           st     = engine.stats();
+    if (status != lr11xx::update_status::ok) {
+        std::printf("%-10s failed with status %d\n", label, int(status));
+        return false;
+    }
+    std::printf("%-10s %5u chunks (%4u staged)  chunk min/avg/max %5u/%5.0f/%5u us  erase %7.1f ms  write %8.1f ms"
+                "  total %8.1f ms  prepare %6.1f ms\n",
+                label, unsigned(st.chunks), unsigned(st.staged), unsigned(st.chunk_min_us),
+                double(st.chunk_sum_us) / st.chunks, unsigned(st.chunk_max_us), st.erase_us / 1e3, st.write_us / 1e3,
+                st.total_us / 1e3, st.prepare_us / 1e3);
+    stats = st;
+    return true;
+}
+
+/*!
+ * \brief Stage the wire-order image twice in a simulated W25Q16JL, then update from the latest copy
+ */
+bool run_store(const char* label, const abw::lr11xx_sim_timing& timing, const abw::w25q_sim_timing& flash_timing,
+               uint32_t prepare_us, bool read_ahead, const std::vector<uint8_t>& wire, lr11xx::update_stats& stats)
+{
+    abw::lr11xx_sim     sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing);
+    abw::w25q_sim       chip(sim, flash_timing);
+    w25q::flash         flash(chip);
+    lr11xx::image_store store(flash);
+
+    if (!flash.probe()) {
+        std::printf("%-10s no W25Q answers\n", label);
+        return false;
+    }
+
+    // The first copy stands for the rollback image, the second for the new one
+    uint32_t stage_us = 0;
+    for (int copy = 0; copy < 2; copy++) {
+        uint32_t start = sim.now_us();
+        uint32_t slot  = store.staging_slot(image_update_to);
+        bool     ok    = store.begin(slot);
+        for (uint32_t at = 0; ok && at < wire.size(); at += w25q::page_size) {
+            ok = store.write(slot, at, &wire[at], uint32_t(std::min<size_t>(w25q::page_size, wire.size() - at)));
+        }
+        if (!ok || !store.commit(slot, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, image_update_to,
+                                 LR11XX_FIRMWARE_IMAGE_CRC32)) {
+            std::printf("%-10s staging in slot %u failed\n", label, unsigned(slot));
+            return false;
+        }
+        stage_us = sim.now_us() - start;
+    }
+    lr11xx::stored_image latest, previous;
+    if (!store.latest(image_update_to, latest, &previous) || !previous.sequence) {
+        std::printf("%-10s stored images not found\n", label);
+        return false;
+    }
+
+    timed_store_source    source(sim, flash, latest, read_ahead, prepare_us);
+    lr11xx::update_engine engine(sim, source);
+    lr11xx::update_config config;
+    config.image_words      = latest.words;
+    config.expected_version = latest.version;
+    config.check_crc        = true;
+    config.expected_crc     = latest.crc;
+
+    uint32_t              start  = sim.now_us();
+    lr11xx::update_status status = engine.run(config);
+    const auto&           st     = engine.stats();
+    if (status != lr11xx::update_status::ok) {
+        std::printf("%-10s failed with status %d\n", label, int(status));
+        return false;
+    }
+    std::printf("%-10s %5u chunks (%4u staged)  chunk min/avg/max %5u/%5.0f/%5u us  erase %7.1f ms  write %8.1f ms"
+                "  total %8.1f ms  prepare %6.1f ms\n",
+                label, unsigned(st.chunks), unsigned(st.staged), unsigned(st.chunk_min_us),
+                double(st.chunk_sum_us) / st.chunks, unsigned(st.chunk_max_us), st.erase_us / 1e3, st.write_us / 1e3,
+                (sim.now_us() - start) / 1e3, st.prepare_us / 1e3);
+    if (read_ahead) {
+        std::printf("%-10s W25Q %04X: updated from slot %u (seq %u), slot %u (seq %u) kept for rollback,"
+                    " %.1f ms to stage a copy\n",
+                    label, unsigned(flash.device_id()), unsigned(latest.slot), unsigned(latest.sequence),
+                    unsigned(previous.slot), unsigned(previous.sequence), stage_us / 1e3);
+    }
+    stats = st;
+    return true;
+}
+
+const char* status_name(lr11xx::update_status status)
+{
+    switch (status) {
+    case lr11xx::update_status::ok:
+        return "ok";
+    case lr11xx::update_status::transport_error:
+        return "transport_error";
+    case lr11xx::update_status::busy_timeout:
+        return "busy_timeout";
+    case lr11xx::update_status::not_in_bootloader:
+        return "not_in_bootloader";
+    case lr11xx::update_status::source_error:
+        return "source_error";
+    case lr11xx::update_status::crc_mismatch:
+        return "crc_mismatch";
+    case lr11xx::update_status::version_mismatch:
+        return "version_mismatch";
+    }
+    return "?";
+}
+
+bool fuzz(uint32_t runs, uint32_t seed, const abw::lr11xx_sim_timing& timing, const abw::lr11xx_sim_faults& faults)
+{
+    std::map<std::string, uint32_t> outcomes;
+    uint32_t                        errors = 0;
+    uint64_t                        sim_us = 0;
+    auto                            start  = std::chrono::steady_clock::now();
+
+    for (uint32_t run = 0; run < runs; run++) {
+        // Start from the previous release, as in the field
+        abw::lr11xx_sim sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing,
+                            LR11XX_FIRMWARE_VERSION - 1);
+        sim.inject(faults, seed + run);
+
+        lr11xx::memory_source source(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE);
+        lr11xx::update_engine engine(sim, source);
+        lr11xx::update_config config;
+        config.image_words      = LR11XX_FIRMWARE_IMAGE_SIZE;
+        config.expected_version = LR11XX_FIRMWARE_VERSION;
+        config.check_crc        = true;
+        config.expected_crc     = LR11XX_FIRMWARE_IMAGE_CRC32;
+
+        lr11xx::update_status status  = engine.run(config);
+        const auto&           c       = sim.counters();
+        bool                  updated = !sim.in_bootloader() && sim.running_version() == LR11XX_FIRMWARE_VERSION;
+        bool                  faulted = c.corrupted || c.resets || c.stuck;
+
+        outcomes[status_name(status)]++;
+        sim_us += sim.now_us();
+        if ((status == lr11xx::update_status::ok) != updated || (!faulted && status != lr11xx::update_status::ok)) {
+            std::printf("run %u (seed %u): engine says %s, chip %s, %u corrupted, %u resets, %u stuck\n", unsigned(run),
+                        unsigned(seed + run), status_name(status), updated ? "updated" : "not updated",
+                        unsigned(c.corrupted), unsigned(c.resets), unsigned(c.stuck));
+            errors++;
+        }
+    }
+
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%u updates in %.2f s (%.0f updates/min), %.1f s of simulated time\n", unsigned(runs), wall,
+                runs / wall * 60, sim_us / 1e6);
+    for (const auto& outcome : outcomes) {
+        std::printf("  %-18s %u\n", outcome.first.c_str(), unsigned(outcome.second));
+    }
+    std::printf("%u inconsistencies\n", unsigned(errors));
+    return errors == 0;
+}
+
+// Totals of one power-cut mode over all scenarios
+struct cut_totals {
+    uint32_t updates    = 0;  //!< Engine runs, the interrupted ones included
+    uint32_t cuts       = 0;
+    uint32_t resumed    = 0;
+    uint64_t chunks     = 0;
+    uint32_t erases     = 0;
+    uint64_t sim_us     = 0;
+    uint32_t records    = 0;  //!< Checkpoint records programmed
+    uint32_t area_erase = 0;
+};
+
+/*!
+ * \brief One update cut at the given times after each start, until it succeeds
+ */
+bool cut_scenario(const abw::lr11xx_sim_timing& timing, const std::vector<uint32_t>& cuts, bool resume,
+                  uint32_t seed, cut_totals& totals)
+{
+    abw::lr11xx_sim sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing,
+                        LR11XX_FIRMWARE_VERSION - 1);
+    abw::lr11xx_sim_flash_area area(sim, 4096, seed);
+    lr11xx::memory_source      source(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE);
+    lr11xx::update_config      config;
+    lr11xx::update_status      status = lr11xx::update_status::transport_error;
+
+    config.image_words      = LR11XX_FIRMWARE_IMAGE_SIZE;
+    config.expected_version = LR11XX_FIRMWARE_VERSION;
+    config.check_crc        = true;
+    config.expected_crc     = LR11XX_FIRMWARE_IMAGE_CRC32;
+
+    // A cut past the end of a (shorter, resumed) update does not happen
+    for (size_t attempt = 0; attempt <= cuts.size(); attempt++) {
+        sim.cut_power_at(attempt < cuts.size() ? uint64_t(sim.now_us()) + cuts[attempt]
+                                               : std::numeric_limits<uint64_t>::max());
+
+        // The MCU restarts too: nothing survives but the flash area
+        lr11xx::checkpoint_log log(area);
+        lr11xx::update_engine  engine(sim, source, resume ? &log : nullptr);
+        status = engine.run(config);
+        totals.updates++;
+        totals.resumed += engine.stats().resumed_at != 0;
+        if (status == lr11xx::update_status::ok) {
+            break;
+        }
+        if (sim.powered()) {
+            break;  // Failed on its own: reported below
+        }
+        sim.power_on();
+    }
+
+    const auto& c = sim.counters();
+    totals.cuts += c.power_cuts;
+    totals.chunks += c.chunks;
+    totals.erases += c.erases;
+    totals.sim_us += sim.now_us();
+    totals.records += area.programs();
+    totals.area_erase += area.erases();
+    return status == lr11xx::update_status::ok && !sim.in_bootloader() &&
+           sim.running_version() == LR11XX_FIRMWARE_VERSION;
+}
+
+bool power_cuts(uint32_t scenarios, uint32_t cuts_per_update, uint32_t seed, const abw::lr11xx_sim_timing& timing)
+{
+    // Cut times are drawn over the length of an uninterrupted update
+    abw::lr11xx_sim       sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing,
+                              LR11XX_FIRMWARE_VERSION - 1);
+    lr11xx::memory_source source(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE);
+    lr11xx::update_engine engine(sim, source);
+    lr11xx::update_config config;
+    config.image_words      = LR11XX_FIRMWARE_IMAGE_SIZE;
+    config.expected_version = LR11XX_FIRMWARE_VERSION;
+    if (engine.run(config) != lr11xx::update_status::ok) {
+        std::printf("uninterrupted update failed\n");
+        return false;
+    }
+    const uint32_t update_us = sim.now_us();
+
+    std::mt19937 rng(seed);
+    cut_totals   restart, resume;
+    uint32_t     errors = 0;
+    for (uint32_t n = 0; n < scenarios; n++) {
+        std::vector<uint32_t> cuts(cuts_per_update);
+        for (auto& cut : cuts) {
+            cut = std::uniform_int_distribution<uint32_t>(0, update_us - 1)(rng);
+        }
+        for (bool resuming : {false, true}) {
+            if (!cut_scenario(timing, cuts, resuming, seed + n, resuming ? resume : restart)) {
+                std::printf("scenario %u (%s): the chip does not run the new image\n", unsigned(n),
+                            resuming ? "resume" : "restart");
+                errors++;
+            }
+        }
+    }
+
+    std::printf("%u updates of %.1f ms, %u power cuts each at a random time\n", unsigned(scenarios), update_us / 1e3,
+                unsigned(cuts_per_update));
+    for (const auto* t : {&restart, &resume}) {
+        std::printf("%-8s %5u runs  %5u cuts  %5u resumed  %7.1f chunks/update  %5.2f erases/update  %8.1f ms/update"
+                    "  %5.1f records/update  %5.2f area erases/update\n",
+                    t == &restart ? "restart" : "resume", unsigned(t->updates), unsigned(t->cuts), unsigned(t->resumed),
+                    double(t->chunks) / scenarios, double(t->erases) / scenarios, t->sim_us / 1e3 / scenarios,
+                    double(t->records) / scenarios, double(t->area_erase) / scenarios);
+    }
+    std::printf("resume saves %.1f chunks, %.2f erases and %.1f ms per update\n",
+                (double(restart.chunks) - double(resume.chunks)) / scenarios,
+                (double(restart.erases) - double(resume.erases)) / scenarios,
+                (double(restart.sim_us) - double(resume.sim_us)) / 1e3 / scenarios);
+    std::printf("%u inconsistencies\n", unsigned(errors));
+    return errors == 0;
+}
+
+}  // namespace
+
+/*!
+ * \brief Slots chosen by image_store::staging_slot() on a full W25Q, with one-page images of several targets
+ *
+ * Target 1 has a single image, the oldest; target 0 fills the other slots. Staging for target 2 must
+ * replace the oldest image of target 0, not the only one of target 1, and staging for target 1 its own
+ * image. New targets then take the other images of target 0, until every slot holds the only image of
+ * its target and staging finds no slot.
+ */
+bool check_staging(const abw::lr11xx_sim_timing& timing, const abw::w25q_sim_timing& flash_timing,
+                   const std::vector<uint8_t>& wire)
+{
+    abw::lr11xx_sim     sim(lr11xx_firmware_image, LR11XX_FIRMWARE_IMAGE_SIZE, LR11XX_FIRMWARE_VERSION, timing);
+    abw::w25q_sim       chip(sim, flash_timing);
+    w25q::flash         flash(chip);
+    lr11xx::image_store store(flash);
+    const uint32_t      crc = abw_crc32_final(abw_crc32_update(ABW_CRC32_INIT, wire.data(), w25q::page_size));
+
+    auto stage = [&](uint8_t update_to) {
+        uint32_t slot = store.staging_slot(update_to);
+        bool     ok   = store.begin(slot) && store.write(slot, 0, wire.data(), w25q::page_size) &&
+                  store.commit(slot, w25q::page_size / 4, LR11XX_FIRMWARE_VERSION, update_to, crc);
+        return ok ? slot : store.slots();
+    };
+    auto owner = [&](uint32_t slot) {
+        lr11xx::stored_image image;
+        return store.image(slot, image) ? int(image.update_to) : -1;
+    };
+
+    if (!flash.probe()) {
+        std::printf("staging: no W25Q answers\n");
+        return false;
+    }
+    bool ok = stage(1) == 0;
+    for (uint32_t slot = 1; slot < store.slots(); slot++) {
+        ok = ok && stage(0) == slot;
+    }
+    ok = ok && stage(2) == 1 && owner(0) == 1;  // Oldest image of target 0, target 1 keeps its only one
+    ok = ok && stage(1) == 2 && owner(0) == 1;  // A superseded image of target 0, target 1 keeps its rollback
+    ok = ok && stage(1) == 0 && owner(2) == 1;  // Now its own oldest image, the one before stays
+    ok = ok && owner(1) == 2;                   // Target 2 keeps its only one
+    // New targets take the superseded images of target 0 until every target has a single image
+    uint8_t target = 10;
+    while (ok && target < 30 && stage(target) != store.slots()) {
+        target++;
+    }
+    uint64_t owners = 0;
+    for (uint32_t slot = 0; slot < store.slots(); slot++) {
+        owners |= owner(slot) >= 0 ? 1ull << owner(slot) : 0;
+    }
+    ok = ok && target == 10 + store.slots() - 3 && __builtin_popcountll(owners) == int(store.slots());
+    std::printf("staging: %s\n", ok ? "the rollback image is kept, the only image of a target is never replaced"
+                                      : "FAILED");
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    abw::lr11xx_sim_timing timing;
+    abw::lr11xx_sim_faults faults;
+    abw::w25q_sim_timing   flash_timing;
+    uint32_t               prepare_us = 50;
+    uint32_t               wire_us    = 30;
+    double                 run_ma     = 3.4;
+    double                 sleep_ma   = 1.0;
+    double                 vdd        = 3.0;
+    uint32_t               runs       = 0;
+    uint32_t               cut_runs   = 0;
+    uint32_t               cuts       = 1;
+    uint32_t               seed       = 1;
+
+    faults.busy_jitter_us = 500;
+    faults.stuck_busy     = 1e-5;
+    faults.corrupt_chunk  = 1e-4;
+    faults.reset          = 1e-4;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value  = argv[i + 1];
+        if (option == "--spi-hz") {
+            timing.spi_hz = uint32_t(std::stoul(value));
+        } else if (option == "--write-us") {
+            timing.write_us = uint32_t(std::stoul(value));
+        } else if (option == "--erase-us") {
+            timing.erase_us = uint32_t(std::stoul(value));
+        } else if (option == "--prepare-us") {
+            prepare_us = uint32_t(std::stoul(value));
+        } else if (option == "--wire-prepare-us") {
+            wire_us = uint32_t(std::stoul(value));
+        } else if (option == "--run-ma") {
+            run_ma = std::stod(value);
+        } else if (option == "--sleep-ma") {
+            sleep_ma = std::stod(value);
+        } else if (option == "--vdd") {
+            vdd = std::stod(value);
+        } else if (option == "--flash-spi-hz") {
+            flash_timing.spi_hz = uint32_t(std::stoul(value));
+        } else if (option == "--fuzz") {
+            runs = uint32_t(std::stoul(value));
+        } else if (option == "--power-cuts") {
+            cut_runs = uint32_t(std::stoul(value));
+        } else if (option == "--cuts") {
+            cuts = uint32_t(std::stoul(value));
+        } else if (option == "--seed") {
+            seed = uint32_t(std::stoul(value));
+        } else if (option == "--jitter-us") {
+            faults.busy_jitter_us = uint32_t(std::stoul(value));
+        } else if (option == "--stuck") {
+            faults.stuck_busy = std::stod(value);
+        } else if (option == "--corrupt") {
+            faults.corrupt_chunk = std::stod(value);
+        } else if (option == "--reset") {
+            faults.reset = std::stod(value);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", option.c_str());
+            return 2;
+        }
+    }
+
+    if (runs) {
+        return fuzz(runs, seed, timing, faults) ? 0 : 1;
+    }
+    if (cut_runs) {
+        return power_cuts(cut_runs, cuts, seed, timing) ? 0 : 1;
+    }
+
+    // What lr11xx-fwgen --bytes puts in flash: the .bin bytes
+    std::vector<uint8_t> wire;
+    for (uint32_t word : lr11xx_firmware_image) {
+        wire.insert(wire.end(), {uint8_t(word >> 24), uint8_t(word >> 16), uint8_t(word >> 8), uint8_t(word)});
+    }
+
+    std::printf("%u words, SPI %u Hz, write busy %u us, chunk preparation %u us (wire order %u us)\n",
+                unsigned(LR11XX_FIRMWARE_IMAGE_SIZE), unsigned(timing.spi_hz), unsigned(timing.write_us),
+                unsigned(prepare_us), unsigned(wire_us));
+    lr11xx::update_stats sequential, pipelined, in_place, stored, stored_ahead;
+    bool                 ok = run("sequential", timing, prepare_us, false, nullptr, sequential);
+    ok                      = run("pipelined", timing, prepare_us, true, nullptr, pipelined) && ok;
+    ok                      = run("wire", timing, wire_us, true, &wire, in_place) && ok;
+    ok = run_store("w25q", timing, flash_timing, wire_us, false, wire, stored) && ok;
+    ok = run_store("w25q+ahead", timing, flash_timing, wire_us, true, wire, stored_ahead) && ok;
+    ok = check_staging(timing, flash_timing, wire) && ok;
+    if (ok) {
+        double saved_ms = (pipelined.prepare_us - double(in_place.prepare_us)) / 1e3;
+        std::printf("wire order: %.1f ms less MCU time per update, %.3f mJ at %.1f V (run %.1f mA, sleep %.1f mA)\n",
+                    saved_ms, saved_ms * (run_ma - sleep_ma) * vdd / 1e3, vdd, run_ma, sleep_ma);
+        std::printf("w25q: %u bytes of internal flash freed, reading ahead saves %.1f ms of MCU time per update\n",
+                    unsigned(LR11XX_FIRMWARE_IMAGE_SIZE * 4), (stored.prepare_us - double(stored_ahead.prepare_us)) / 1e3);
+    }
+    return ok ? 0 : 1;
+}
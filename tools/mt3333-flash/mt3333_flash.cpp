@@ -0,0 +1,222 @@
+/*!
+ * \file      mt3333_flash.cpp
+ *
+ * \brief     MT3333 ROM download on Linux, in place of the MediaTek Flash Tool
+ *
+ * Usage:
+ *   mt3333-flash flash    [options] <gnss_tty> <da.bin> <rom.bin>
+ *   mt3333-flash loopback [options] [--clean-baud N] [--marginal-baud N] [--turnaround-us N] [--seed N]
+ *                         [--fast] <da.bin> <rom.bin>
+ *
+ * Options:
+ *   --max-baud N       Highest DA speed to try (default 921600)
+ *   --min-baud N       Lowest DA speed to try before staying at 115200 (default 115200)
+ *   --packet N         WRITE packet length (default 1024)
+ *   --depth N          Packets on the wire ahead of their answers (default 4, 1 to wait for each)
+ *   --probe N          Bytes of the speed probe (default 16384)
+ *   --handshake-ms N   Wait for the boot ROM after power-up (default 10000)
+ *
+ * flash loads the DA (MTK_AllInOne_DA_MT3333_MP.BIN) through the boot ROM
+ * at 115200 baud, raises the DA to the fastest speed whose probe comes back
+ * right, erases the ROM range, writes the ROM with packets pipelined, and
+ * checks the checksum of the flash before the MT3333 boots it. The MT3333
+ * must be powered up in download mode on gnss_tty (USB1 of the EVK) when
+ * the tool starts, e.g. by "gnss mt3333 on" on the MFG CLI; the boot ROM
+ * handshake is retried for --handshake-ms.
+ *
+ * loopback runs the download twice against a simulated MT3333 on a pty (see
+ * tools/common/mt3333_sim.hpp): first as the Flash Tool does (115200 baud,
+ * one packet at a time), then with the options given. It checks the flash
+ * content of the stand-in against the ROM and compares the times.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "abw_mt3333.hpp"
+#include "abw_serial.hpp"
+#include "mt3333_sim.hpp"
+
+namespace {
+
+int usage()
+{
+    std::cerr << "usage: mt3333-flash flash    [options] <gnss_tty> <da.bin> <rom.bin>\n"
+                 "       mt3333-flash loopback [options] [--clean-baud N] [--marginal-baud N] [--turnaround-us N] "
+                 "[--seed N] [--fast] <da.bin> <rom.bin>\n";
+    return 2;
+}
+
+void print_stats(const char* name, const abw::mt3333_stats& st)
+{
+    double total = st.brom_s + st.speed_s + st.format_s + st.write_s + st.verify_s;
+    std::printf("%-10s %7u %7.2f %7.2f %7.2f %7.2f %7.2f %8.2f %7u %5u\n", name, unsigned(st.baud), st.brom_s,
+                st.speed_s, st.format_s, st.write_s, st.verify_s, total, unsigned(st.packets), unsigned(st.nacks));
+}
+
+void print_header()
+{
+    std::printf("%-10s %7s %7s %7s %7s %7s %7s %8s %7s %5s\n", "", "baud", "DA s", "speed s", "erase s", "write s",
+                "check s", "total s", "packets", "NACKs");
+}
+
+bool flash(const std::string& tty, const std::string& da_path, const std::string& rom_path,
+           const abw::mt3333_options& options)
+{
+    std::vector<uint8_t> da  = abw::read_file(da_path);
+    std::vector<uint8_t> rom = abw::read_file(rom_path);
+    abw::serial_port     port(tty, abw::mt3333::brom_baud);
+    abw::mt3333_flasher  flasher(port, options, [](const std::string& line) { std::printf("%s\n", line.c_str()); });
+
+    flasher.flash(da, rom);
+    print_header();
+    print_stats("download", flasher.stats());
+    return true;
+}
+
+/*!
+ * \brief One download against a fresh stand-in, false if the flash does not hold the ROM
+ */
+bool loopback_run(const char* name, const std::vector<uint8_t>& da, const std::vector<uint8_t>& rom,
+                  const abw::mt3333_options& options, abw::mt3333_sim_config config, abw::mt3333_stats& stats)
+{
+    abw::pty_pair     pty(abw::mt3333::brom_baud);
+    std::atomic<bool> stop(false);
+
+    config.da      = da.data();
+    config.da_size = da.size();
+    abw::mt3333_sim board(pty.master, pty.slave_path, config);
+    std::thread     thread([&] { board.run(stop); });
+
+    std::string error;
+    try {
+        abw::mt3333_flasher flasher(pty.slave, options, [&](const std::string& line) {
+            std::printf("%-10s %s\n", name, line.c_str());
+        });
+        flasher.flash(da, rom);
+        stats = flasher.stats();
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+    stop = true;
+    thread.join();
+
+    const auto& c = board.counters();
+    if (error.empty() && !c.finished) {
+        error = "no FINISH";
+    }
+    if (error.empty() && !std::equal(rom.begin(), rom.end(), board.flash().begin())) {
+        error = "flash differs from the ROM";
+    }
+    std::printf("%-10s stand-in: %u packets programmed, %u NACKs, %u overflows, %u speed changes, %u reverts, "
+                "%u garbled bytes%s%s\n",
+                name, unsigned(c.packets), unsigned(c.nacks), unsigned(c.overflows), unsigned(c.speeds),
+                unsigned(c.reverts), unsigned(c.garbled), error.empty() ? "" : ", ", error.c_str());
+    return error.empty();
+}
+
+bool loopback(const std::string& da_path, const std::string& rom_path, const abw::mt3333_options& options,
+              const abw::mt3333_sim_config& config)
+{
+    std::vector<uint8_t> da  = abw::read_file(da_path);
+    std::vector<uint8_t> rom = abw::read_file(rom_path);
+
+    std::printf("DA %zu bytes, ROM %zu bytes, line clean up to %u baud, usable up to %u, %u us turnaround%s\n",
+                da.size(), rom.size(), unsigned(config.clean_baud), unsigned(config.marginal_baud),
+                unsigned(config.turnaround_us), config.pacing ? "" : ", unpaced");
+
+    abw::mt3333_options baseline = options;
+    baseline.max_baud            = abw::mt3333::brom_baud;
+    baseline.depth               = 1;
+    abw::mt3333_stats slow, fast;
+    bool              ok = loopback_run("baseline", da, rom, baseline, config, slow);
+    ok                   = loopback_run("tuned", da, rom, options, config, fast) && ok;
+    if (ok) {
+        print_header();
+        print_stats("baseline", slow);
+        print_stats("tuned", fast);
+        double a = slow.brom_s + slow.speed_s + slow.format_s + slow.write_s + slow.verify_s;
+        double b = fast.brom_s + fast.speed_s + fast.format_s + fast.write_s + fast.verify_s;
+        std::printf("%.2fx faster\n", a / b);
+    }
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+
+    std::string              cmd = argv[1];
+    abw::mt3333_options      options;
+    abw::mt3333_sim_config   config;
+    std::vector<std::string> args;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            std::string option = argv[i];
+            if (option == "--fast") {
+                config.pacing = false;
+                continue;
+            }
+            if (option.compare(0, 2, "--") || i + 1 >= argc) {
+                args.push_back(option);
+                continue;
+            }
+            std::string value = argv[++i];
+            if (option == "--max-baud") {
+                options.max_baud = uint32_t(std::stoul(value));
+            } else if (option == "--min-baud") {
+                options.min_baud = uint32_t(std::stoul(value));
+            } else if (option == "--packet") {
+                options.packet = uint32_t(std::stoul(value));
+            } else if (option == "--depth") {
+                options.depth = unsigned(std::stoul(value));
+            } else if (option == "--probe") {
+                options.probe = uint16_t(std::stoul(value));
+            } else if (option == "--handshake-ms") {
+                options.handshake_ms = uint32_t(std::stoul(value));
+            } else if (option == "--clean-baud") {
+                config.clean_baud = uint32_t(std::stoul(value));
+            } else if (option == "--marginal-baud") {
+                config.marginal_baud = uint32_t(std::stoul(value));
+            } else if (option == "--turnaround-us") {
+                config.turnaround_us = uint32_t(std::stoul(value));
+            } else if (option == "--seed") {
+                config.seed = uint32_t(std::stoul(value));
+            } else {
+                std::cerr << "unknown option " << option << "\n";
+                return 2;
+            }
+        }
+        if (options.packet == 0 || options.probe == 0) {
+            return usage();
+        }
+
+        bool ok;
+        if (cmd == "flash" && args.size() == 3) {
+            ok = flash(args[0], args[1], args[2], options);
+        } else if (cmd == "loopback" && args.size() == 2) {
+            ok = loopback(args[0], args[1], options, config);
+        } else {
+            return usage();
+        }
+        if (!ok) {
+            std::cerr << "mt3333-flash: download failed\n";
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "mt3333-flash: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,495 @@
+/*!
+ * \file      nmea_bench.cpp
+ *
+ * \brief     Check and time the NMEA/PMTK parser of lib/nmea on recorded or generated MT3333 streams
+ *
+ * Usage:
+ *   nmea-bench [--epochs N] [--errors P] [--seed N] [--chunk N] [--min-ms N] [capture...]
+ *   nmea-bench --write <file> [--epochs N] [--errors P] [--seed N]
+ *
+ * The captures are raw dumps of the GNSS UART, e.g. "cat /dev/ttyUSB1 >
+ * gnss.log". Without captures the stream is generated: --epochs seconds
+ * (default 3600) of the 1 Hz output of the MT3333 with GPS and GLONASS
+ * (RMC, VTG, GGA, two GSA, GPGSV and GLGSV), with a PMTK001 ack and a
+ * PMTK010 message every minute. A fraction --errors of the sentences
+ * (default 0.001) get a corrupted byte or are cut short. --write saves it
+ * as a capture.
+ *
+ * Each scan path the CPU supports first parses the stream in chunks of
+ * random size, down to one byte, and must give the same counters and
+ * decoded values as in whole --chunk reads (default 4096 bytes, a tty
+ * read). For a generated stream they must also match what was generated. A
+ * line-based parser as a log script would write it (getline, split into
+ * strings, strtol and strtod) gives the counters once more, and a baseline.
+ *
+ * The throughput is then measured for each path, framing and checksums
+ * only and with decoding, repeating the stream for at least --min-ms.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "nmea_parser.hpp"
+
+namespace {
+
+/*!
+ * \brief What the parser has to find in a generated stream
+ */
+struct expected {
+    uint32_t sentences = 0, gga = 0, rmc = 0, gsv = 0, gsa = 0, pmtk = 0, other = 0;
+    uint32_t checksum_errors = 0, truncated = 0;
+    int64_t  position_sum = 0;  //!< Latitudes and longitudes of the decoded GGA and RMC, 1e-7 degrees
+    uint32_t acks         = 0;
+};
+
+/*!
+ * \brief Decoded values folded into a few numbers, to compare runs
+ */
+class digest : public nmea::handler {
+public:
+    void on_gga(const nmea::gga& g) override
+    {
+        positions += int64_t(g.latitude) + g.longitude;
+        mix(uint32_t(g.time.hour * 3600 + g.time.minute * 60 + g.time.second) ^ (uint32_t(g.satellites) << 17) ^
+            uint32_t(g.hdop) ^ uint32_t(g.altitude));
+    }
+    void on_rmc(const nmea::rmc& r) override
+    {
+        positions += int64_t(r.latitude) + r.longitude;
+        mix(uint32_t(r.speed) ^ (uint32_t(r.course) << 7) ^ (uint32_t(r.day) << 24) ^ uint32_t(r.valid));
+    }
+    void on_gsv(const nmea::gsv& g) override
+    {
+        for (uint8_t i = 0; i < g.count; i++) {
+            mix(uint32_t(g.satellites[i].prn) ^ (uint32_t(g.satellites[i].elevation) << 8) ^
+                (uint32_t(g.satellites[i].azimuth) << 16) ^ (uint32_t(g.satellites[i].snr) << 25));
+        }
+    }
+    void on_gsa(const nmea::gsa& g) override
+    {
+        for (uint8_t i = 0; i < g.count; i++) {
+            mix(g.prns[i]);
+        }
+        mix(uint32_t(g.pdop) ^ uint32_t(g.fix));
+    }
+    void on_pmtk_ack(const nmea::pmtk_ack& a) override
+    {
+        acks++;
+        mix(a.command ^ (uint32_t(a.flag) << 12));
+    }
+    void on_pmtk(const nmea::pmtk& p) override { mix(p.type ^ uint32_t(p.data.size() << 10)); }
+    void on_sentence(std::string_view s) override { mix(uint32_t(s.size())); }
+
+    bool operator==(const digest& o) const { return (hash == o.hash) && (positions == o.positions) && (acks == o.acks); }
+
+    uint64_t hash      = 0;
+    int64_t  positions = 0;
+    uint32_t acks      = 0;
+
+private:
+    void mix(uint32_t v) { hash = (hash ^ v) * 0x100000001B3ull; }
+};
+
+bool same(const nmea::stats& a, const nmea::stats& b)
+{
+    return (a.bytes == b.bytes) && (a.sentences == b.sentences) && (a.gga == b.gga) && (a.rmc == b.rmc) &&
+           (a.gsv == b.gsv) && (a.gsa == b.gsa) && (a.gst == b.gst) && (a.pmtk == b.pmtk) && (a.other == b.other) &&
+           (a.checksum_errors == b.checksum_errors) && (a.truncated == b.truncated) && (a.too_long == b.too_long) &&
+           (a.bad_fields == b.bad_fields);
+}
+
+void print_stats(const char* name, const nmea::stats& s)
+{
+    std::printf("%-10s %6u sentences (GGA %u, RMC %u, GSV %u, GSA %u, GST %u, PMTK %u, other %u), %u checksum "
+                "errors, %u truncated, %u too long, %u bad fields\n",
+                name, unsigned(s.sentences), unsigned(s.gga), unsigned(s.rmc), unsigned(s.gsv), unsigned(s.gsa),
+                unsigned(s.gst), unsigned(s.pmtk), unsigned(s.other), unsigned(s.checksum_errors), unsigned(s.truncated),
+                unsigned(s.too_long), unsigned(s.bad_fields));
+}
+
+std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* fmt, ...)
+{
+    char    buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    std::vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+// Stream generator
+
+class generator {
+public:
+    generator(uint32_t seed, double errors) : rng_(seed), errors_(errors) {}
+
+    std::string epochs(uint32_t count)
+    {
+        std::string out;
+        out.reserve(size_t(count) * 900);
+        for (uint32_t t = 0; t < count; t++) {
+            epoch(t, out);
+        }
+        return out;
+    }
+
+    expected want;
+
+private:
+    struct satellite {
+        unsigned prn, elevation, azimuth, snr;
+    };
+
+    int pick(int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng_); }
+
+    // Coordinate as the MT3333 prints it, and its value in 1e-7 degrees as the parser computes it
+    std::string coordinate(int degree_digits, int degrees, int minutes_e4, char hemisphere, int64_t& value)
+    {
+        value = int64_t(degrees) * 10000000 + int64_t(minutes_e4) * 100 / 6;
+        if ((hemisphere == 'S') || (hemisphere == 'W')) {
+            value = -value;
+        }
+        return format("%0*d%02d.%04d,%c", degree_digits, degrees, minutes_e4 / 10000, minutes_e4 % 10000, hemisphere);
+    }
+
+    void emit(std::string body, std::string& out, uint32_t* counter, int64_t positions = 0, bool ack = false)
+    {
+        uint8_t sum = 0;
+        for (char c : body) {
+            sum ^= uint8_t(c);
+        }
+        std::string line = "$" + body + format("*%02X\r\n", sum);
+        double      roll = std::uniform_real_distribution<double>(0, 1)(rng_);
+        if (roll < errors_ / 2) {
+            // A byte of the body changed to another character that cannot end a sentence
+            size_t k = 1 + size_t(pick(0, int(body.size()) - 1));
+            char   c = line[k];
+            do {
+                c = char(pick('0', 'Z'));
+            } while (c == line[k]);
+            line[k] = c;
+            want.checksum_errors++;
+        } else if (roll < errors_) {
+            // Cut before the '*', the next sentence follows on the same line
+            line.resize(1 + size_t(pick(0, int(body.size()) - 1)));
+            want.truncated++;
+        } else {
+            want.sentences++;
+            (*counter)++;
+            want.position_sum += positions;
+            want.acks += ack;
+        }
+        out += line;
+    }
+
+    void epoch(uint32_t t, std::string& out)
+    {
+        unsigned hh = (t / 3600 + 9) % 24, mm = t / 60 % 60, ss = t % 60;
+        int64_t  lat, lon;
+        // 43°36.xxxx'N 1°26.xxxx'E, around Toulouse
+        std::string position = coordinate(2, 43, 360000 + pick(0, 9999), 'N', lat) + "," +
+                               coordinate(3, 1, 260000 + pick(0, 9999), 'E', lon);
+        std::string time     = format("%02u%02u%02u.000", hh, mm, ss);
+        double      speed    = pick(0, 300) / 100.0;
+        double      course   = pick(0, 35999) / 100.0;
+
+        std::vector<satellite> gps(12), glonass(7);
+        for (size_t i = 0; i < gps.size(); i++) {
+            gps[i] = {unsigned(1 + (i * 3 + t / 600) % 32), unsigned(pick(5, 89)), unsigned(pick(0, 359)),
+                      unsigned(i < 9 ? pick(20, 48) : 0)};
+        }
+        for (size_t i = 0; i < glonass.size(); i++) {
+            glonass[i] = {unsigned(65 + (i * 2 + t / 600) % 24), unsigned(pick(5, 89)), unsigned(pick(0, 359)),
+                          unsigned(i < 5 ? pick(20, 45) : 0)};
+        }
+
+        emit(format("GNRMC,%s,A,%s,%.2f,%.2f,161026,,,A", time.c_str(), position.c_str(), speed, course), out,
+             &want.rmc, lat + lon);
+        emit(format("GNVTG,%.2f,T,,M,%.2f,N,%.2f,K,A", course, speed, speed * 1.852), out, &want.other);
+        emit(format("GNGGA,%s,%s,1,14,%d.%02d,%d.%d,M,49.2,M,,", time.c_str(), position.c_str(), pick(0, 2),
+                    pick(0, 99), pick(140, 160), pick(0, 9)),
+             out, &want.gga, lat + lon);
+        for (const auto* system : {&gps, &glonass}) {
+            std::string prns;
+            for (size_t i = 0; i < 12; i++) {
+                prns += (i < system->size() && (*system)[i].snr) ? format("%02u,", (*system)[i].prn) : ",";
+            }
+            emit("GNGSA,A,3," + prns + "1.17,0.85,0.81", out, &want.gsa);
+        }
+        for (const auto* system : {&gps, &glonass}) {
+            const char* talker   = (system == &gps) ? "GP" : "GL";
+            unsigned    messages = unsigned((system->size() + 3) / 4);
+            for (unsigned m = 0; m < messages; m++) {
+                std::string body = format("%sGSV,%u,%u,%02u", talker, messages, m + 1, unsigned(system->size()));
+                for (size_t i = m * 4; (i < system->size()) && (i < m * 4 + 4); i++) {
+                    const satellite& s = (*system)[i];
+                    body += format(",%02u,%02u,%03u,", s.prn, s.elevation, s.azimuth);
+                    if (s.snr) {
+                        body += format("%02u", s.snr);
+                    }
+                }
+                emit(body, out, &want.gsv);
+            }
+        }
+        if (t % 60 == 30) {
+            emit("PMTK001,886,3", out, &want.pmtk, 0, true);
+            emit("PMTK010,002", out, &want.pmtk);
+        }
+    }
+
+    std::mt19937 rng_;
+    double       errors_;
+};
+
+// Line-based reference, as a log collector script would parse the stream
+
+nmea::stats reference(const std::string& stream, int64_t& positions)
+{
+    nmea::stats        s;
+    std::istringstream in(stream);
+    std::string        line;
+
+    positions = 0;
+    while (std::getline(in, line)) {
+        size_t dollar = line.rfind('$');
+        if (dollar == std::string::npos) {
+            continue;
+        }
+        s.truncated += unsigned(std::count(line.begin(), line.begin() + long(dollar), '$'));
+        size_t star = line.find('*', dollar);
+        if ((star == std::string::npos) || (star + 3 > line.size())) {
+            s.truncated++;
+            continue;
+        }
+        unsigned sum = 0;
+        for (size_t i = dollar + 1; i < star; i++) {
+            sum ^= uint8_t(line[i]);
+        }
+        if (std::strtoul(line.substr(star + 1, 2).c_str(), nullptr, 16) != sum) {
+            s.checksum_errors++;
+            continue;
+        }
+        s.sentences++;
+
+        std::vector<std::string> f;
+        std::stringstream        body(line.substr(dollar + 1, star - dollar - 1));
+        std::string              field;
+        while (std::getline(body, field, ',')) {
+            f.push_back(field);
+        }
+        if (f.empty()) {
+            s.other++;
+            continue;
+        }
+        std::string type = f[0].substr(f[0].size() < 3 ? 0 : f[0].size() - 3);
+        auto        degrees = [](const std::string& v, const std::string& h) {
+            double d = std::strtod(v.c_str(), nullptr);
+            d        = int(d / 100) + (d - 100 * int(d / 100)) / 60;
+            return int64_t(((h == "S") || (h == "W") ? -d : d) * 1e7);
+        };
+        if (f[0].compare(0, 4, "PMTK") == 0) {
+            s.pmtk++;
+        } else if ((type == "GGA") && (f.size() >= 12)) {
+            s.gga++;
+            positions += degrees(f[2], f[3]) + degrees(f[4], f[5]);
+        } else if ((type == "RMC") && (f.size() >= 10)) {
+            s.rmc++;
+            positions += degrees(f[3], f[4]) + degrees(f[5], f[6]);
+        } else if (type == "GSV") {
+            s.gsv++;
+        } else if (type == "GSA") {
+            s.gsa++;
+        } else {
+            s.other++;
+        }
+    }
+    s.bytes = stream.size();
+    return s;
+}
+
+// Runs
+
+struct result {
+    nmea::stats stats;
+    digest      values;
+};
+
+result parse(const std::string& stream, nmea::scan_path path, bool decode, size_t chunk, std::mt19937* random)
+{
+    result        r;
+    nmea::parser  parser(r.values, path);
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(stream.data());
+
+    parser.set_decode(decode);
+    for (size_t i = 0; i < stream.size();) {
+        size_t n = random ? size_t(std::uniform_int_distribution<int>(1, 200)(*random)) : chunk;
+        n        = std::min(n, stream.size() - i);
+        parser.feed(p + i, n);
+        i += n;
+    }
+    r.stats = parser.stats();
+    return r;
+}
+
+double megabytes_per_s(const std::string& stream, nmea::scan_path path, bool decode, size_t chunk, uint32_t min_ms)
+{
+    digest         sink;
+    nmea::parser   parser(sink, path);
+    const uint8_t* p      = reinterpret_cast<const uint8_t*>(stream.data());
+    uint64_t       bytes  = 0;
+    auto           start  = std::chrono::steady_clock::now();
+    double         elapsed = 0;
+
+    parser.set_decode(decode);
+    do {
+        for (size_t i = 0; i < stream.size(); i += chunk) {
+            parser.feed(p + i, std::min(chunk, stream.size() - i));
+        }
+        bytes += stream.size();
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed * 1000 < min_ms);
+    return double(bytes) / elapsed / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    uint32_t                 epochs = 3600;
+    double                   errors = 0.001;
+    uint32_t                 seed   = 1;
+    size_t                   chunk  = 4096;
+    uint32_t                 min_ms = 500;
+    std::string              write_path;
+    std::vector<std::string> captures;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+            if (option.compare(0, 2, "--")) {
+                captures.push_back(option);
+                continue;
+            }
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "missing value for %s\n", option.c_str());
+                return 2;
+            }
+            std::string value = argv[++i];
+            if (option == "--epochs") {
+                epochs = uint32_t(std::stoul(value));
+            } else if (option == "--errors") {
+                errors = std::stod(value);
+            } else if (option == "--seed") {
+                seed = uint32_t(std::stoul(value));
+            } else if (option == "--chunk") {
+                chunk = std::max<size_t>(1, std::stoul(value));
+            } else if (option == "--min-ms") {
+                min_ms = uint32_t(std::stoul(value));
+            } else if (option == "--write") {
+                write_path = value;
+            } else {
+                std::fprintf(stderr, "unknown option %s\n", option.c_str());
+                return 2;
+            }
+        }
+
+        std::string stream;
+        generator   gen(seed, errors);
+        bool        generated = captures.empty();
+        if (generated) {
+            stream = gen.epochs(epochs);
+            std::printf("generated %u epochs, %zu bytes\n", unsigned(epochs), stream.size());
+        }
+        for (const std::string& path : captures) {
+            std::vector<uint8_t> data = abw::read_file(path);
+            stream.append(data.begin(), data.end());
+            std::printf("%s: %zu bytes\n", path.c_str(), data.size());
+        }
+        if (!write_path.empty()) {
+            abw::write_file(write_path, stream);
+            return 0;
+        }
+
+        std::vector<nmea::scan_path> paths;
+        for (nmea::scan_path path : {nmea::scan_path::scalar, nmea::scan_path::sse2, nmea::scan_path::avx2}) {
+            if (nmea::scan_path_supported(path)) {
+                paths.push_back(path);
+            }
+        }
+
+        // Every path, whole and random chunks, must agree
+        bool         ok = true;
+        std::mt19937 random(seed);
+        result       first = parse(stream, paths[0], true, chunk, nullptr);
+        print_stats("parser", first.stats);
+        for (nmea::scan_path path : paths) {
+            result whole = parse(stream, path, true, chunk, nullptr);
+            result split = parse(stream, path, true, 0, &random);
+            result frame = parse(stream, path, false, chunk, nullptr);
+            if (!same(whole.stats, first.stats) || !same(split.stats, first.stats) ||
+                !(whole.values == first.values) || !(split.values == first.values) ||
+                (frame.stats.sentences != first.stats.sentences)) {
+                std::printf("%-10s differs\n", nmea::scan_path_name(path));
+                print_stats(nmea::scan_path_name(path), split.stats);
+                ok = false;
+            }
+        }
+
+        int64_t     positions = 0;
+        nmea::stats ref       = reference(stream, positions);
+        print_stats("reference", ref);
+        if ((ref.sentences != first.stats.sentences) || (ref.gga != first.stats.gga) ||
+            (ref.rmc != first.stats.rmc) || (ref.gsv != first.stats.gsv) || (ref.gsa != first.stats.gsa) ||
+            (ref.pmtk != first.stats.pmtk) || (ref.checksum_errors != first.stats.checksum_errors) ||
+            (std::llabs(positions - first.values.positions) > 2 * int64_t(ref.gga + ref.rmc))) {
+            std::printf("reference counters differ\n");
+            ok = false;
+        }
+        if (generated) {
+            const expected& w = gen.want;
+            if ((w.sentences != first.stats.sentences) || (w.gga != first.stats.gga) ||
+                (w.rmc != first.stats.rmc) || (w.gsv != first.stats.gsv) || (w.gsa != first.stats.gsa) ||
+                (w.pmtk != first.stats.pmtk) || (w.other != first.stats.other) ||
+                (w.checksum_errors != first.stats.checksum_errors) || (w.truncated != first.stats.truncated) ||
+                (first.stats.bad_fields != 0) || (w.position_sum != first.values.positions) ||
+                (w.acks != first.values.acks)) {
+                std::printf("generated %u sentences, %u checksum errors, %u truncated: parser differs\n",
+                            unsigned(w.sentences), unsigned(w.checksum_errors), unsigned(w.truncated));
+                ok = false;
+            }
+        }
+        if (!ok) {
+            std::fprintf(stderr, "nmea-bench: check failed\n");
+            return 1;
+        }
+        std::printf("all paths agree, %s\n", generated ? "as generated" : "with the reference");
+
+        std::printf("\n%-10s %12s %12s\n", "MB/s", "framing", "decoding");
+        for (nmea::scan_path path : paths) {
+            std::printf("%-10s %12.1f %12.1f\n", nmea::scan_path_name(path),
+                        megabytes_per_s(stream, path, false, chunk, min_ms),
+                        megabytes_per_s(stream, path, true, chunk, min_ms));
+        }
+        auto    start   = std::chrono::steady_clock::now();
+        int64_t ignored = 0;
+        reference(stream, ignored);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%-10s %12s %12.1f\n", "reference", "-", double(stream.size()) / seconds / 1e6);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "nmea-bench: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
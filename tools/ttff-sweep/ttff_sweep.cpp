@@ -0,0 +1,601 @@
+/*!
+ * \file      ttff_sweep.cpp
+ *
+ * \brief     Replay recorded MT3333 sessions through the acquisition state machine and sweep its parameters
+ *
+ * Usage:
+ *   ttff-sweep [--t0 LIST] [--t1 LIST] [--target LIST] [--convergence LIST] [--acquisition LIST]
+ *              [--uere M] [--current-ma N] [--truth LAT,LON] [--max-error LIST] [--threads N] [--top N]
+ *              [--sessions N] [--record-s N] [--seed N] [capture...]
+ *   ttff-sweep --write <file> [--sessions N] [--record-s N] [--seed N]
+ *
+ * The captures are raw dumps of the GNSS UART over sessions recorded with
+ * the receiver left on, e.g. "cat /dev/ttyUSB1 > gnss.log" while the MFG
+ * firmware powers the MT3333 with "gnss mt3333 on" and a long timeout. A
+ * session starts at each $PMTK010,001 (at the start of a file without
+ * one), and lasts as long as it was recorded. Without captures sessions
+ * are generated: --sessions (default 200) of --record-s seconds (default
+ * 240), open sky, urban and indoor, with GGA, RMC, GSA, GSV and GST.
+ * --write saves them as a capture.
+ *
+ * The clock of a session advances by one second at each GGA, the 1 Hz
+ * output of the MT3333. The stream is fed to nmea::parser with the
+ * gnssacq::acquisition of each configuration as handler, until the
+ * acquisition stops. A session recording that ends first is counted as
+ * cut, on for its whole length.
+ *
+ * Each configuration is a combination of the comma-separated lists: --t0,
+ * --t1, --acquisition and --convergence in seconds, --target EHPE in m.
+ * The configurations are spread over --threads (default, all cores).
+ * The accuracy is the distance of the fix kept to the true position:
+ * generated, given by --truth, or else the median of the fixes of the last
+ * minute of the recording. The energy is the on-time at --current-ma
+ * (default 25 mA, MT3333 acquisition).
+ *
+ * The tool prints the default configuration of lib/gnssacq. For each p90
+ * error bound of --max-error (default 15,20,30,50 m), it prints the
+ * configuration with the least mean on-time that stays within the bound
+ * with a fix rate at least that of the default. Last come the
+ * configurations that no other beats on mean on-time, p90 error and fix
+ * rate at once, by on-time, at most --top (default 20).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "abw_file.hpp"
+#include "gnss_acquisition.hpp"
+#include "nmea_parser.hpp"
+
+namespace {
+
+struct session {
+    std::string         stream;
+    std::vector<size_t> epochs;  //!< Offset of each GGA, the first chunk starts at 0
+    bool                has_truth = false;
+    int32_t             latitude  = 0;  //!< True position, 1e-7 degrees
+    int32_t             longitude = 0;
+};
+
+std::string format(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* fmt, ...)
+{
+    char    line[256];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    return line;
+}
+
+std::string sentence(const std::string& body)
+{
+    uint8_t sum = 0;
+    for (char c : body) {
+        sum ^= uint8_t(c);
+    }
+    return "$" + body + format("*%02X\r\n", unsigned(sum));
+}
+
+std::string coordinate(int32_t value, int degree_digits, const char* hemispheres)
+{
+    uint64_t magnitude = uint64_t(std::llabs(int64_t(value)));
+    uint64_t minutes   = (magnitude % 10000000) * 60;  // 1e-7 minutes
+    return format("%0*u%02u.%04u,%c", degree_digits, unsigned(magnitude / 10000000), unsigned(minutes / 10000000),
+                  unsigned(minutes % 10000000 / 1000), hemispheres[value < 0]);
+}
+
+/*!
+ * \brief Distance in m, flat earth
+ */
+double distance_m(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2)
+{
+    const double m_per_unit = 0.011132;  // 1e-7 degree of latitude
+    double       dy         = double(lat1 - lat2) * m_per_unit;
+    double       dx         = double(lon1 - lon2) * m_per_unit * std::cos(double(lat1) * 1e-7 * M_PI / 180);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+/*!
+ * \brief Sessions of a tracker: 65% open sky, 30% urban, 5% indoors
+ *
+ * After the fix, the EHPE falls from 20-60 m to a floor (2.5 m open sky,
+ * 9-20 m urban) with a time constant of 5-40 s. The position wanders around
+ * the truth as much, and 1.5 times more than the EHPE says in town.
+ */
+std::vector<session> generate(uint32_t sessions, uint32_t record_s, uint32_t seed)
+{
+    std::mt19937                     random(seed);
+    std::uniform_real_distribution<> uniform(0, 1);
+    std::normal_distribution<>       normal(0, 1);
+    std::vector<session>             out;
+    uint32_t                         utc = 1790812800;  // 2026-10-01
+
+    for (uint32_t n = 0; n < sessions; n++, utc += 1800) {
+        session s;
+        s.has_truth  = true;
+        s.latitude   = 488566000 + int32_t(normal(random) * 200000);
+        s.longitude  = 23522000 + int32_t(normal(random) * 300000);
+        double kind  = uniform(random);
+        bool   indoor = kind < 0.05, urban = !indoor && kind < 0.35;
+        double tracked_s = indoor ? (uniform(random) < 0.7 ? 1e9 : 3 + 10 * uniform(random)) : 1 + 4 * uniform(random);
+        double ttff_s    = urban ? 45 * std::exp(0.4 * normal(random)) : 30 * std::exp(0.3 * normal(random));
+        if (indoor || (urban && uniform(random) < 0.1)) {
+            ttff_s = 1e9;
+        } else if (uniform(random) < 0.15) {
+            ttff_s = 1 + 2 * uniform(random);  // Hot start
+        }
+        double floor_m = urban ? 9 + 11 * uniform(random) : 2.5 * (0.8 + 0.7 * uniform(random));
+        double start_m = 20 + 40 * uniform(random);
+        double tau_s   = urban ? 10 + 30 * uniform(random) : 5 + 15 * uniform(random);
+        double actual  = urban ? 1.5 : 1.0;
+        double ex = normal(random), ey = normal(random);
+
+        s.stream = sentence("PMTK010,001");
+        for (uint32_t t = 1; t <= record_s; t++) {
+            uint32_t    now  = utc + t;
+            std::string time = format("%02u%02u%02u.000", now / 3600 % 24, now / 60 % 60, now % 60);
+            bool        fix  = t >= ttff_s;
+            unsigned    sats = (t < tracked_s) ? 0 : std::min(12u, 1 + unsigned((t - tracked_s) / 3));
+            double      snr  = indoor ? 18 : 38;
+            s.epochs.push_back(s.stream.size());
+            if (fix) {
+                double ehpe_m = (floor_m + (start_m - floor_m) * std::exp(-(t - ttff_s) / tau_s)) *
+                                (1 + 0.1 * normal(random));
+                ehpe_m        = std::max(ehpe_m, 1.0);
+                ex            = 0.95 * ex + 0.31 * normal(random);  // Unit variance, 20 s correlation
+                ey            = 0.95 * ey + 0.31 * normal(random);
+                double  sigma = ehpe_m / std::sqrt(2.0) * actual;
+                int32_t lat   = s.latitude + int32_t(ey * sigma / 0.011132);
+                int32_t lon   = s.longitude +
+                              int32_t(ex * sigma / 0.011132 / std::cos(double(s.latitude) * 1e-7 * M_PI / 180));
+                double hdop = std::max(0.7, ehpe_m / 5);
+                sats        = std::max(sats, 5u);
+                s.stream += sentence(format("GPGGA,%s,%s,%s,1,%02u,%.2f,35.0,M,47.0,M,,", time.c_str(),
+                                            coordinate(lat, 2, "NS").c_str(), coordinate(lon, 3, "EW").c_str(), sats,
+                                            hdop));
+                s.stream += sentence(format("GPRMC,%s,A,%s,%s,0.10,0.00,011026,,,A", time.c_str(),
+                                            coordinate(lat, 2, "NS").c_str(), coordinate(lon, 3, "EW").c_str()));
+                s.stream += sentence(format("GPGSA,A,3,02,05,06,12,15,19,24,25,,,,,%.2f,%.2f,%.2f", hdop * 1.6, hdop,
+                                            hdop * 1.3));
+                s.stream += sentence(format("GPGST,%s,%.1f,%.1f,%.1f,0.0,%.1f,%.1f,%.1f", time.c_str(), hdop * 2,
+                                            ehpe_m, ehpe_m * 0.7, ehpe_m / std::sqrt(2.0), ehpe_m / std::sqrt(2.0),
+                                            ehpe_m * 1.5));
+            } else {
+                s.stream += sentence(format("GPGGA,%s,,,,,0,%02u,,,M,,M,,", time.c_str(), sats));
+                s.stream += sentence(format("GPRMC,%s,V,,,,,0.00,0.00,011026,,,N", time.c_str()));
+                s.stream += sentence("GPGSA,A,1,,,,,,,,,,,,,,,");
+            }
+            std::string gsv = format("GPGSV,1,1,%02u", sats);
+            for (unsigned i = 0; i < std::min(sats, 4u); i++) {
+                gsv += format(",%02u,%02u,%03u,%02u", 2 + 3 * i, 20 + 10 * i, 90 * i, unsigned(snr + 3 * i));
+            }
+            s.stream += sentence(gsv);
+        }
+        out.push_back(std::move(s));
+    }
+    return out;
+}
+
+/*!
+ * \brief Offsets of the GGA sentences
+ */
+void find_epochs(session& s)
+{
+    s.epochs.clear();
+    for (size_t p = s.stream.find('$'); p != std::string::npos; p = s.stream.find('$', p + 1)) {
+        if (s.stream.compare(p + 3, 4, "GGA,") == 0) {
+            s.epochs.push_back(p);
+        }
+    }
+}
+
+std::vector<session> split_capture(const std::string& stream)
+{
+    std::vector<session> out;
+    const std::string    startup = "$PMTK010,001";
+    size_t               start   = 0;
+    while (start < stream.size()) {
+        size_t next = stream.find(startup, start + 1);
+        if (next == std::string::npos) {
+            next = stream.size();
+        }
+        session s;
+        s.stream = stream.substr(start, next - start);
+        find_epochs(s);
+        if (!s.epochs.empty()) {
+            out.push_back(std::move(s));
+        }
+        start = next;
+    }
+    return out;
+}
+
+/*!
+ * \brief Median of the fixes of the last minute, as the truth of a recording
+ */
+class last_minute : public nmea::handler {
+public:
+    std::vector<std::pair<uint32_t, nmea::gga>> fixes;
+    uint32_t                                    epoch = 0;
+
+    void on_gga(const nmea::gga& g) override
+    {
+        epoch++;
+        if (g.quality != 0 && g.latitude != nmea::no_value && g.longitude != nmea::no_value) {
+            fixes.emplace_back(epoch, g);
+        }
+    }
+};
+
+void set_truth(session& s)
+{
+    last_minute  collect;
+    nmea::parser parser(collect);
+    parser.feed(reinterpret_cast<const uint8_t*>(s.stream.data()), s.stream.size());
+    std::vector<int32_t> lats, lons;
+    for (const auto& f : collect.fixes) {
+        if (f.first + 60 > collect.epoch) {
+            lats.push_back(f.second.latitude);
+            lons.push_back(f.second.longitude);
+        }
+    }
+    if (lats.size() >= 30) {
+        std::nth_element(lats.begin(), lats.begin() + long(lats.size() / 2), lats.end());
+        std::nth_element(lons.begin(), lons.begin() + long(lons.size() / 2), lons.end());
+        s.has_truth = true;
+        s.latitude  = lats[lats.size() / 2];
+        s.longitude = lons[lons.size() / 2];
+    }
+}
+
+struct outcome_counts {
+    uint32_t counts[6] = {};  //!< By gnssacq::outcome, running for the cut sessions
+};
+
+struct config_result {
+    gnssacq::config     config;
+    std::vector<double> ttff_s, on_s, error_m, ehpe_m;
+    outcome_counts      outcomes;
+    uint32_t            sessions = 0;
+    uint32_t            fixes    = 0;
+    double              mean_on_s = 0, p90_error_m = 0, fix_rate = 0;
+};
+
+double percentile(std::vector<double> v, double p)
+{
+    std::sort(v.begin(), v.end());
+    return v.empty() ? 0 : v[std::min(v.size() - 1, size_t(p * double(v.size())))];
+}
+
+/*!
+ * \brief A GGA fix still waiting for its GST at a timeout is counted, and a T1 timeout then no longer applies
+ */
+bool check_pending()
+{
+    gnssacq::acquisition acquisition(gnssacq::config{20, 2, 3});  // T1 at 2 s, over at 3 s
+    nmea::parser         parser(acquisition);
+    const std::string    gst = sentence("GPGST,120000.000,,,,,,,");
+    const std::string    gga = sentence("GPGGA,120001.000,4851.3960,N,00221.1320,E,1,08,3.00,35.0,M,47.0,M,,");
+
+    acquisition.start(0);
+    parser.feed(reinterpret_cast<const uint8_t*>(gst.data()), gst.size());  // The receiver sends GST
+    acquisition.update(1000);
+    parser.feed(reinterpret_cast<const uint8_t*>(gga.data()), gga.size());  // A fix of 15 m, its GST never comes
+    bool                   running = acquisition.update(2000);
+    const gnssacq::result& r       = acquisition.result();
+    acquisition.update(3000);
+    bool ok = running && (r.outcome == gnssacq::outcome::acquisition_timeout) && (r.fixes == 1) &&
+              (r.ttff_ms == 1000) && (r.best.ehpe_cm == 1500);
+    std::printf("fix without its GST: %s\n", ok ? "counted at the timeout" : "FAILED");
+    return ok;
+}
+
+config_result replay(const std::vector<session>& sessions, const gnssacq::config& config)
+{
+    config_result r;
+    r.config = config;
+    for (const session& s : sessions) {
+        gnssacq::acquisition acquisition(config);
+        nmea::parser         parser(acquisition);
+        acquisition.start(0);
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(s.stream.data());
+        for (size_t k = 0; k <= s.epochs.size() && !acquisition.done(); k++) {
+            size_t from = (k == 0) ? 0 : s.epochs[k - 1];
+            size_t to   = (k == s.epochs.size()) ? s.stream.size() : s.epochs[k];
+            parser.feed(data + from, to - from);
+            acquisition.update(uint32_t(k + 1) * 1000);  // GGA k is seen at k + 1 s
+        }
+        const gnssacq::result& a = acquisition.result();
+        r.sessions++;
+        r.outcomes.counts[int(a.outcome)]++;
+        r.on_s.push_back(a.on_ms / 1000.0);
+        if (a.best.valid) {
+            r.fixes++;
+            r.ttff_s.push_back(a.ttff_ms / 1000.0);
+            r.ehpe_m.push_back(a.best.ehpe_cm / 100.0);
+            if (s.has_truth) {
+                r.error_m.push_back(distance_m(a.best.latitude, a.best.longitude, s.latitude, s.longitude));
+            }
+        }
+    }
+    for (double t : r.on_s) {
+        r.mean_on_s += t;
+    }
+    r.mean_on_s /= std::max<size_t>(1, r.on_s.size());
+    r.p90_error_m = percentile(r.error_m, 0.9);
+    r.fix_rate    = double(r.fixes) / std::max(1u, r.sessions);
+    return r;
+}
+
+std::vector<uint32_t> parse_list(const std::string& text, uint32_t scale)
+{
+    std::vector<uint32_t> values;
+    std::stringstream     in(text);
+    std::string           item;
+    while (std::getline(in, item, ',')) {
+        values.push_back(uint32_t(std::stod(item) * scale + 0.5));
+    }
+    if (values.empty()) {
+        throw std::runtime_error("empty list");
+    }
+    return values;
+}
+
+void print_header()
+{
+    std::printf("%4s %4s %5s %6s %5s | %5s | %6s %6s | %6s %6s %6s | %6s %6s %6s | %s\n", "T0", "T1", "acq", "target",
+                "conv", "fix %", "TTFF50", "TTFF90", "on s", "on90 s", "mAs", "err50", "err90", "ehpe50",
+                "target/conv/T0/T1/acq/cut");
+}
+
+void print_row(const config_result& r, double current_ma)
+{
+    const gnssacq::config& c = r.config;
+    const uint32_t*        o = r.outcomes.counts;
+    std::printf("%4u %4u %5u %6.1f %5u | %5.1f | %6.1f %6.1f | %6.1f %6.1f %6.0f | %6.1f %6.1f %6.1f | "
+                "%u/%u/%u/%u/%u/%u\n",
+                unsigned(c.t0_s), unsigned(c.t1_s), unsigned(c.acquisition_s), c.ehpe_target_cm / 100.0,
+                unsigned(c.convergence_s), 100 * r.fix_rate, percentile(r.ttff_s, 0.5), percentile(r.ttff_s, 0.9),
+                r.mean_on_s, percentile(r.on_s, 0.9), r.mean_on_s * current_ma, percentile(r.error_m, 0.5),
+                r.p90_error_m, percentile(r.ehpe_m, 0.5), unsigned(o[int(gnssacq::outcome::target)]),
+                unsigned(o[int(gnssacq::outcome::convergence_timeout)]), unsigned(o[int(gnssacq::outcome::t0_timeout)]),
+                unsigned(o[int(gnssacq::outcome::t1_timeout)]), unsigned(o[int(gnssacq::outcome::acquisition_timeout)]),
+                unsigned(o[int(gnssacq::outcome::running)]));
+}
+
+bool dominates(const config_result& a, const config_result& b)
+{
+    bool no_worse = (a.mean_on_s <= b.mean_on_s) && (a.p90_error_m <= b.p90_error_m) && (a.fix_rate >= b.fix_rate);
+    bool better   = (a.mean_on_s < b.mean_on_s) || (a.p90_error_m < b.p90_error_m) || (a.fix_rate > b.fix_rate);
+    return no_worse && better;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<uint32_t>    t0 = {10, 20, 30}, t1 = {45, 60, 90, 120}, acquisition = {180};
+    std::vector<uint32_t>    target = {500, 1000, 1500, 2500, 5000}, convergence = {0, 10, 20, 30, 60};
+    std::vector<uint32_t>    max_error = {15, 20, 30, 50};
+    uint32_t                 uere_cm    = 500;
+    double                   current_ma = 25;
+    unsigned                 threads    = std::max(1u, std::thread::hardware_concurrency());
+    size_t                   top        = 20;
+    uint32_t                 count      = 200;
+    uint32_t                 record_s   = 240;
+    uint32_t                 seed       = 1;
+    bool                     truth      = false;
+    int32_t                  truth_lat = 0, truth_lon = 0;
+    std::string              write_path;
+    std::vector<std::string> captures;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+            if (option.compare(0, 2, "--")) {
+                captures.push_back(option);
+                continue;
+            }
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "missing value for %s\n", option.c_str());
+                return 2;
+            }
+            std::string value = argv[++i];
+            if (option == "--t0") {
+                t0 = parse_list(value, 1);
+            } else if (option == "--t1") {
+                t1 = parse_list(value, 1);
+            } else if (option == "--acquisition") {
+                acquisition = parse_list(value, 1);
+            } else if (option == "--target") {
+                target = parse_list(value, 100);
+            } else if (option == "--convergence") {
+                convergence = parse_list(value, 1);
+            } else if (option == "--max-error") {
+                max_error = parse_list(value, 1);
+            } else if (option == "--uere") {
+                uere_cm = uint32_t(std::stod(value) * 100);
+            } else if (option == "--current-ma") {
+                current_ma = std::stod(value);
+            } else if (option == "--truth") {
+                double lat, lon;
+                if (std::sscanf(value.c_str(), "%lf,%lf", &lat, &lon) != 2) {
+                    std::fprintf(stderr, "--truth takes LAT,LON in degrees\n");
+                    return 2;
+                }
+                truth     = true;
+                truth_lat = int32_t(std::lround(lat * 1e7));
+                truth_lon = int32_t(std::lround(lon * 1e7));
+            } else if (option == "--threads") {
+                threads = std::max(1u, unsigned(std::stoul(value)));
+            } else if (option == "--top") {
+                top = std::stoul(value);
+            } else if (option == "--sessions") {
+                count = uint32_t(std::stoul(value));
+            } else if (option == "--record-s") {
+                record_s = uint32_t(std::stoul(value));
+            } else if (option == "--seed") {
+                seed = uint32_t(std::stoul(value));
+            } else if (option == "--write") {
+                write_path = value;
+            } else {
+                std::fprintf(stderr, "unknown option %s\n", option.c_str());
+                return 2;
+            }
+        }
+
+        std::vector<session> sessions;
+        if (captures.empty()) {
+            sessions = generate(count, record_s, seed);
+        }
+        for (const std::string& path : captures) {
+            std::vector<uint8_t> data = abw::read_file(path);
+            for (session& s : split_capture(std::string(data.begin(), data.end()))) {
+                if (truth) {
+                    s.has_truth = true;
+                    s.latitude  = truth_lat;
+                    s.longitude = truth_lon;
+                } else {
+                    set_truth(s);
+                }
+                sessions.push_back(std::move(s));
+            }
+        }
+        if (!write_path.empty()) {
+            std::string all;
+            for (const session& s : sessions) {
+                all += s.stream;
+            }
+            abw::write_file(write_path, all);
+            return 0;
+        }
+        if (sessions.empty()) {
+            throw std::runtime_error("no session with a GGA");
+        }
+        size_t epochs = 0, with_truth = 0;
+        for (const session& s : sessions) {
+            epochs += s.epochs.size();
+            with_truth += s.has_truth;
+        }
+        std::printf("%zu sessions, %.0f s recorded on average, %zu with a true position\n", sessions.size(),
+                    double(epochs) / double(sessions.size()), with_truth);
+        if (!check_pending()) {
+            return 1;
+        }
+
+        std::vector<gnssacq::config> configs;
+        for (uint32_t a : t0) {
+            for (uint32_t b : t1) {
+                for (uint32_t q : acquisition) {
+                    for (uint32_t e : target) {
+                        for (uint32_t c : convergence) {
+                            gnssacq::config config;
+                            config.t0_s           = a;
+                            config.t1_s           = b;
+                            config.acquisition_s  = q;
+                            config.ehpe_target_cm = e;
+                            config.convergence_s  = c;
+                            config.uere_cm        = uere_cm;
+                            configs.push_back(config);
+                        }
+                    }
+                }
+            }
+        }
+
+        gnssacq::config baseline;
+        baseline.uere_cm               = uere_cm;
+        config_result baseline_result  = replay(sessions, baseline);
+
+        std::vector<config_result> results(configs.size());
+        std::atomic<size_t>        next(0);
+        std::vector<std::thread>   workers;
+        auto                       start = std::chrono::steady_clock::now();
+        threads                          = unsigned(std::min<size_t>(threads, configs.size()));
+        for (unsigned i = 0; i < threads; i++) {
+            workers.emplace_back([&] {
+                for (size_t k; (k = next++) < configs.size();) {
+                    results[k] = replay(sessions, configs[k]);
+                }
+            });
+        }
+        for (std::thread& w : workers) {
+            w.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%zu configurations on %u threads in %.2f s, %.0f session replays/s\n", configs.size(), threads,
+                    seconds, double(configs.size() * sessions.size()) / seconds);
+
+        // The baseline, when swept too, must come out the same from the threads
+        for (const config_result& r : results) {
+            const gnssacq::config& c = r.config;
+            if (c.t0_s == baseline.t0_s && c.t1_s == baseline.t1_s && c.acquisition_s == baseline.acquisition_s &&
+                c.ehpe_target_cm == baseline.ehpe_target_cm && c.convergence_s == baseline.convergence_s &&
+                (r.on_s != baseline_result.on_s || r.error_m != baseline_result.error_m)) {
+                std::fprintf(stderr, "ttff-sweep: threaded replay differs from the sequential one\n");
+                return 1;
+            }
+        }
+
+        std::printf("\ndefault configuration\n");
+        print_header();
+        print_row(baseline_result, current_ma);
+
+        std::printf("\nleast on-time for a p90 error within a bound, at the fix rate of the default or better\n");
+        print_header();
+        for (uint32_t bound : max_error) {
+            const config_result* best = nullptr;
+            for (const config_result& r : results) {
+                if ((r.p90_error_m <= bound) && (r.fix_rate >= baseline_result.fix_rate) &&
+                    (!best || r.mean_on_s < best->mean_on_s)) {
+                    best = &r;
+                }
+            }
+            if (best) {
+                print_row(*best, current_ma);
+            } else {
+                std::printf("none within %u m\n", unsigned(bound));
+            }
+        }
+
+        // Configurations with the same figures are shown once, the first of the sweep
+        std::vector<const config_result*> front;
+        for (size_t i = 0; i < results.size(); i++) {
+            const config_result& r         = results[i];
+            bool                 dominated = false;
+            for (size_t j = 0; j < results.size() && !dominated; j++) {
+                const config_result& o = results[j];
+                dominated              = dominates(o, r) || ((j < i) && (o.mean_on_s == r.mean_on_s) &&
+                                                (o.p90_error_m == r.p90_error_m) && (o.fix_rate == r.fix_rate));
+            }
+            if (!dominated) {
+                front.push_back(&r);
+            }
+        }
+        std::sort(front.begin(), front.end(),
+                  [](const config_result* a, const config_result* b) { return a->mean_on_s < b->mean_on_s; });
+        std::printf("\n%zu configurations not beaten on on-time, p90 error and fix rate at once%s\n", front.size(),
+                    front.size() > top ? format(", the first %zu", top).c_str() : "");
+        print_header();
+        for (size_t i = 0; i < front.size() && i < top; i++) {
+            print_row(*front[i], current_ma);
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "ttff-sweep: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}